@@ -0,0 +1,229 @@
+// concurrentmultipool_scaling.cpp                                    -*-C++-*-
+
+// This program measures how the throughput of 'bdlma::ConcurrentMultipool'
+// (through 'bdlma::ConcurrentMultipoolAllocator') scales with the number of
+// threads, with and without the per-thread magazine cache.  Two workloads are
+// measured:
+//
+//: o LOCAL: each thread repeatedly allocates a batch of blocks of mixed sizes
+//:   and deallocates them in the same thread.
+//:
+//: o CROSS: threads are paired, and each block allocated by one thread of a
+//:   pair is deallocated by the other (through a 'bdlcc::BoundedQueue'), so
+//:   that blocks continually migrate between threads.
+//
+// Usage:
+//..
+//  concurrentmultipool_scaling [maxThreads [opsPerThread [magazineCapacity]]]
+//..
+// For each thread count from 1 to 'maxThreads' (doubling), the program prints
+// the aggregate number of allocations per second for a magazine capacity of 0
+// (no thread caching) and for 'magazineCapacity'.
+
+#include <bdlcc_boundedqueue.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_blockgrowth.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+enum {
+    k_NUM_POOLS    = 8,     // block sizes 8 to 1024 bytes
+    k_MAX_CHUNK    = 32,
+    k_BATCH_SIZE   = 64,    // blocks live at once per thread (LOCAL)
+    k_QUEUE_SIZE   = 1024   // capacity of each queue (CROSS)
+};
+
+const int k_SIZES[] = { 8, 24, 16, 48, 8, 100, 32, 8, 200, 64, 16, 8 };
+const int k_NUM_SIZES = sizeof k_SIZES / sizeof *k_SIZES;
+
+struct LocalArgs {
+    bslma::Allocator *d_allocator_p;
+    bslmt::Barrier   *d_barrier_p;
+    int               d_numOps;
+};
+
+struct CrossArgs {
+    bslma::Allocator            *d_allocator_p;
+    bslmt::Barrier              *d_barrier_p;
+    bdlcc::BoundedQueue<void *> *d_queue_p;
+    int                          d_numOps;
+    bool                         d_isProducer;
+};
+
+extern "C" void *localWorker(void *arg)
+{
+    LocalArgs        *args      = static_cast<LocalArgs *>(arg);
+    bslma::Allocator *allocator = args->d_allocator_p;
+    void             *blocks[k_BATCH_SIZE];
+
+    args->d_barrier_p->wait();
+
+    for (int n = 0, s = 0; n < args->d_numOps; n += k_BATCH_SIZE) {
+        for (int i = 0; i < k_BATCH_SIZE; ++i, ++s) {
+            blocks[i] = allocator->allocate(k_SIZES[s % k_NUM_SIZES]);
+            *static_cast<char *>(blocks[i]) = 1;
+        }
+        for (int i = 0; i < k_BATCH_SIZE; ++i) {
+            allocator->deallocate(blocks[i]);
+        }
+    }
+    return 0;
+}
+
+extern "C" void *crossWorker(void *arg)
+{
+    CrossArgs        *args      = static_cast<CrossArgs *>(arg);
+    bslma::Allocator *allocator = args->d_allocator_p;
+
+    args->d_barrier_p->wait();
+
+    if (args->d_isProducer) {
+        for (int n = 0; n < args->d_numOps; ++n) {
+            void *block = allocator->allocate(k_SIZES[n % k_NUM_SIZES]);
+            *static_cast<char *>(block) = 1;
+            args->d_queue_p->pushBack(block);
+        }
+    }
+    else {
+        for (int n = 0; n < args->d_numOps; ++n) {
+            void *block;
+            args->d_queue_p->popFront(&block);
+            allocator->deallocate(block);
+        }
+    }
+    return 0;
+}
+
+double runLocal(int numThreads, int numOps, int magazineCapacity)
+    // Return the number of allocations per second performed by the specified
+    // 'numThreads' threads, each performing 'numOps' LOCAL allocations, using
+    // a multipool allocator having the specified 'magazineCapacity'.
+{
+    bdlma::ConcurrentMultipoolAllocator allocator(
+                                            k_NUM_POOLS,
+                                            bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                            k_MAX_CHUNK,
+                                            magazineCapacity);
+
+    bslmt::Barrier barrier(numThreads + 1);
+    LocalArgs      args = { &allocator, &barrier, numOps };
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], localWorker, &args);
+    }
+
+    bsls::Stopwatch timer;
+    barrier.wait();
+    timer.start();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    timer.stop();
+
+    return static_cast<double>(numThreads) * numOps / timer.elapsedTime();
+}
+
+double runCross(int numThreads, int numOps, int magazineCapacity)
+    // Return the number of allocations per second performed by the specified
+    // 'numThreads' threads, half of which allocate 'numOps' blocks each that
+    // are deallocated by the other half, using a multipool allocator having
+    // the specified 'magazineCapacity'.
+{
+    bdlma::ConcurrentMultipoolAllocator allocator(
+                                            k_NUM_POOLS,
+                                            bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                            k_MAX_CHUNK,
+                                            magazineCapacity);
+
+    const int numPairs = numThreads < 2 ? 1 : numThreads / 2;
+
+    bslmt::Barrier barrier(2 * numPairs + 1);
+
+    bsl::vector<bdlcc::BoundedQueue<void *> *> queues(numPairs);
+    bsl::vector<CrossArgs>                     args(2 * numPairs);
+    for (int i = 0; i < numPairs; ++i) {
+        queues[i] = new bdlcc::BoundedQueue<void *>(k_QUEUE_SIZE);
+
+        CrossArgs producer = { &allocator, &barrier, queues[i], numOps, true };
+        CrossArgs consumer = { &allocator, &barrier, queues[i], numOps, false};
+        args[2 * i]     = producer;
+        args[2 * i + 1] = consumer;
+    }
+
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(2 * numPairs);
+    for (int i = 0; i < 2 * numPairs; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], crossWorker, &args[i]);
+    }
+
+    bsls::Stopwatch timer;
+    barrier.wait();
+    timer.start();
+    for (int i = 0; i < 2 * numPairs; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    timer.stop();
+
+    for (int i = 0; i < numPairs; ++i) {
+        delete queues[i];
+    }
+
+    return static_cast<double>(numPairs) * numOps / timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const int maxThreads = argc > 1 ? bsl::atoi(argv[1]) : 8;
+    const int numOps     = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+    const int capacity   = argc > 3 ? bsl::atoi(argv[3]) : 64;
+
+    bsl::printf("%-8s %8s %16s %16s %8s\n",
+                "workload", "threads", "cap=0 (op/s)", "cap=N (op/s)",
+                "speedup");
+
+    for (int t = 1; t <= maxThreads; t *= 2) {
+        const double base   = runLocal(t, numOps, 0);
+        const double cached = runLocal(t, numOps, capacity);
+        bsl::printf("%-8s %8d %16.0f %16.0f %8.2f\n",
+                    "LOCAL", t, base, cached, cached / base);
+    }
+
+    for (int t = 2; t <= (maxThreads < 2 ? 2 : maxThreads); t *= 2) {
+        const double base   = runCross(t, numOps, 0);
+        const double cached = runCross(t, numOps, capacity);
+        bsl::printf("%-8s %8d %16.0f %16.0f %8.2f\n",
+                    "CROSS", t, base, cached, cached / base);
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -477,27 +477,17 @@ static int encodeValue(SimpleFormatter    *formatter,
     return result;
 }
 
-}  // close unnamed namespace
-
-                              // ----------------
-                              // struct DatumUtil
-                              // ----------------
-
-// CLASS METHODS
-int DatumUtil::decode(bdld::ManagedDatum *result,
-                      bsl::ostream       *errorStream,
-                      bsl::streambuf     *jsonBuffer)
+static int decodeDocument(bdld::ManagedDatum *result,
+                          bsl::ostream       *errorStream,
+                          baljsn::Tokenizer  *tokenizer)
+    // Decode into the specified 'result' the single JSON value read by the
+    // specified 'tokenizer', which has just been reset, and verify that no
+    // token follows it.  If the specified 'errorStream' is non-null, describe
+    // any error on it.  Return 0 on success, and a negative value otherwise.
 {
-    bsls::AlignedBuffer<8 * 1024>      buffer;
-    bdlma::BufferedSequentialAllocator bsa(
-        buffer.buffer(), sizeof(buffer));
-
-    baljsn::Tokenizer tokenizer(&bsa);
-    tokenizer.reset(jsonBuffer);
-
     // Advance from e_BEGIN
-    tokenizer.advanceToNextToken();
-    if (baljsn::Tokenizer::e_ERROR == tokenizer.tokenType()) {
+    tokenizer->advanceToNextToken();
+    if (baljsn::Tokenizer::e_ERROR == tokenizer->tokenType()) {
         if (errorStream) {
             *errorStream << "Unexpected token";
         }
@@ -505,7 +495,7 @@ int DatumUtil::decode(bdld::ManagedDatum *result,
     }
 
     bdld::ManagedDatum value(result->allocator());
-    int                rc = decodeValue(&value, errorStream, &tokenizer);
+    int                rc = decodeValue(&value, errorStream, tokenizer);
     if (0 != rc) {
         if (errorStream) {
             *errorStream << "decodeValue failed, rc = " << rc << '\n';
@@ -513,7 +503,7 @@ int DatumUtil::decode(bdld::ManagedDatum *result,
         return -2;                                                    // RETURN
     }
 
-    if (0 == tokenizer.advanceToNextToken()) {
+    if (0 == tokenizer->advanceToNextToken()) {
         if (errorStream) {
             *errorStream << "decodeValue failed, extra token detected after "
                             "value, rc = "
@@ -526,6 +516,44 @@ int DatumUtil::decode(bdld::ManagedDatum *result,
     return 0;
 }
 
+}  // close unnamed namespace
+
+                              // ----------------
+                              // struct DatumUtil
+                              // ----------------
+
+// CLASS METHODS
+int DatumUtil::decode(bdld::ManagedDatum       *result,
+                      bsl::ostream             *errorStream,
+                      const bslstl::StringRef&  json)
+{
+    bsls::AlignedBuffer<8 * 1024>      buffer;
+    bdlma::BufferedSequentialAllocator bsa(
+        buffer.buffer(), sizeof(buffer));
+
+    // The tokenizer reads 'json' in place, so string values and member names
+    // are copied only when they are adopted by the resulting datum.
+
+    baljsn::Tokenizer tokenizer(&bsa);
+    tokenizer.reset(json);
+
+    return decodeDocument(result, errorStream, &tokenizer);
+}
+
+int DatumUtil::decode(bdld::ManagedDatum *result,
+                      bsl::ostream       *errorStream,
+                      bsl::streambuf     *jsonBuffer)
+{
+    bsls::AlignedBuffer<8 * 1024>      buffer;
+    bdlma::BufferedSequentialAllocator bsa(
+        buffer.buffer(), sizeof(buffer));
+
+    baljsn::Tokenizer tokenizer(&bsa);
+    tokenizer.reset(jsonBuffer);
+
+    return decodeDocument(result, errorStream, &tokenizer);
+}
+
 int DatumUtil::encode(bsl::string                *result,
                       const bdld::Datum&          datum,
                       const DatumEncoderOptions&  options)
@@ -232,7 +232,6 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bdld_datum.h>
 #include <bdld_manageddatum.h>
-#include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bsl_iosfwd.h>
 #include <bsl_streambuf.h>
@@ -299,7 +298,9 @@ struct DatumUtil {
         // errors that occur during parsing will be output to this stream.
         // Return 0 on success, and a negative value if 'json' could not be
         // decoded (if it is ill-formed).  The mapping of types in JSON to the
-        // types supported by 'Datum' is described in {Supported Types}.
+        // types supported by 'Datum' is described in {Supported Types}.  Note
+        // that 'json' is read in place, without first being copied to an
+        // internal buffer.
 
     static int decode(bdld::ManagedDatum *result,
                       bsl::streambuf     *jsonBuffer);
@@ -325,17 +326,7 @@ inline
 int DatumUtil::decode(bdld::ManagedDatum       *result,
                       const bslstl::StringRef&  json)
 {
-    bdlsb::FixedMemInStreamBuf buffer(json.data(), json.length());
-    return decode(result, 0, &buffer);
-}
-
-inline
-int DatumUtil::decode(bdld::ManagedDatum       *result,
-                      bsl::ostream             *errorStream,
-                      const bslstl::StringRef&  json)
-{
-    bdlsb::FixedMemInStreamBuf buffer(json.data(), json.length());
-    return decode(result, errorStream, &buffer);
+    return decode(result, 0, json);
 }
 
 inline
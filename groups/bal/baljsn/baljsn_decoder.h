@@ -15,11 +15,17 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
+// from a specified stream.  There are three overloaded versions of this
 // function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads from a contiguous 'bslstl::StringRef'
+//
+// When the JSON data is already held in contiguous memory, the
+// 'bslstl::StringRef' overload should be preferred: the tokenizer then scans
+// the input in place, rather than first copying it, block by block, into an
+// internal buffer.
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -148,6 +154,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_types.h>
 
+#include <bslstl_stringref.h>
+
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_streambuf.h>
@@ -219,6 +227,13 @@ class Decoder {
         // all the data associated with it and advancing the parser to the next
         // element.  Return 0 on success and a non-zero value otherwise.
 
+    template <class TYPE>
+    int decodeTokens(TYPE *value, const DecoderOptions& options);
+        // Decode into the specified 'value', of a (template parameter)
+        // 'TYPE', the JSON data read by the tokenizer owned by this object,
+        // which has just been reset, using the specified 'options'.  Return 0
+        // on success, and a non-zero value otherwise.
+
   private:
     // Not implemented:
     Decoder(const Decoder&);
@@ -269,6 +284,25 @@ class Decoder {
         // if decoding is successful, will attempt to update the input position
         // of 'stream' to the last unprocessed byte.
 
+    template <class TYPE>
+    int decode(const bslstl::StringRef&  input,
+               TYPE                     *value,
+               const DecoderOptions&     options);
+    template <class TYPE>
+    int decode(const bslstl::StringRef&  input,
+               TYPE                     *value,
+               const DecoderOptions     *options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data held in the contiguous characters of the specified
+        // 'input' and using the specified 'options'.  Specifying a nullptr
+        // 'options' is equivalent to passing a default-constructed
+        // DecoderOptions in 'options'.  'TYPE' shall be a 'bdeat'-compatible
+        // sequence, choice, or array type, or a 'bdeat'-compatible dynamic
+        // type referring to one of those types.  Return 0 on success, and a
+        // non-zero value otherwise.  Note that 'input' is read in place,
+        // without being copied to an internal buffer, and need not be
+        // null-terminated.
+
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
         // Decode an object of (template parameter) 'TYPE' from the specified
@@ -862,27 +896,9 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-{
-}
-
-// MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::decodeTokens(TYPE *value, const DecoderOptions& options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     d_logStream.clear();
     d_logStream.str("");
 
@@ -897,7 +913,6 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer.setAllowStandAloneValues(false);
     d_tokenizer.setAllowHeterogenousArrays(false);
 
@@ -915,7 +930,33 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     d_maxDepth            = options.maxDepth();
     d_skipUnknownElements = options.skipUnknownElements();
 
-    rc = decodeImp(value, 0, TypeCategory());
+    return decodeImp(value, 0, TypeCategory());
+}
+
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+
+    const int rc = decodeTokens(value, options);
 
     d_tokenizer.resetStreamBufGetPointer();
 
@@ -957,6 +998,27 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const bslstl::StringRef&  input,
+                    TYPE                     *value,
+                    const DecoderOptions&     options)
+{
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(input);
+
+    return decodeTokens(value, options);
+}
+
+template <class TYPE>
+int Decoder::decode(const bslstl::StringRef&  input,
+                    TYPE                     *value,
+                    const DecoderOptions     *options)
+{
+    DecoderOptions localOpts;
+    return decode(input, value, options ? *options : localOpts);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
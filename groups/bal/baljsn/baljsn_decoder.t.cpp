@@ -72,12 +72,14 @@ using bsl::endl;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [ 9] int decode(const bslstl::StringRef& input, TYPE *v, options);
+// [ 9] int decode(const bslstl::StringRef& input, TYPE *v, &options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
 
@@ -35324,6 +35326,26 @@ bsl::ostream& test::operator<<(
 }
 
 
+inline
+bool test::operator==(
+        const test::Address& lhs,
+        const test::Address& rhs)
+{
+    return  lhs.street() == rhs.street()
+         && lhs.city() == rhs.city()
+         && lhs.state() == rhs.state();
+}
+
+inline
+bool test::operator==(
+        const test::Employee& lhs,
+        const test::Employee& rhs)
+{
+    return  lhs.name() == rhs.name()
+         && lhs.homeAddress() == rhs.homeAddress()
+         && lhs.age() == rhs.age();
+}
+
 inline
 bool test::operator==(
         const test::Palette& lhs,
@@ -37678,7 +37700,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -37785,6 +37807,209 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 //..
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING CONTIGUOUS INPUT
+        //   This case tests the 'decode' overloads taking a
+        //   'bslstl::StringRef', which read the input in place.
+        //
+        // Concerns:
+        //: 1 Decoding from a 'bslstl::StringRef' gives the same result and
+        //:   status as decoding the same characters from a 'bsl::streambuf'.
+        //:
+        //: 2 Only the characters within the 'bslstl::StringRef' are read, so
+        //:   the input need not be null-terminated, and a truncated input
+        //:   fails to decode.
+        //:
+        //: 3 Values longer than the block size used to read a 'streambuf',
+        //:   and values containing escape sequences, are decoded correctly.
+        //:
+        //: 4 The options are honored, and passing a null pointer to
+        //:   'DecoderOptions' is equivalent to passing default options.
+        //:
+        //: 5 The logged messages are reset on each call.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, decode a set of valid and
+        //:   invalid JSON documents into a 'test::Employee', both from a
+        //:   'bdlsb::FixedMemInStreamBuf' and from a 'bslstl::StringRef', and
+        //:   verify that the status and decoded value are the same.  Include
+        //:   long and escaped string values.  (C-1, 3)
+        //:
+        //: 2 Decode each valid document from a copy followed by extra
+        //:   characters that are not part of the 'bslstl::StringRef', and
+        //:   from each proper prefix of it, and verify the results.  (C-2)
+        //:
+        //: 3 Decode a document having an unknown element with and without
+        //:   'skipUnknownElements', and with a null options pointer.  (C-4)
+        //:
+        //: 4 Verify that a failed decode logs a message, and that a
+        //:   subsequent successful decode clears it.  (C-5)
+        //
+        // Testing:
+        //   int decode(const bslstl::StringRef& input, TYPE *v, options);
+        //   int decode(const bslstl::StringRef& input, TYPE *v, &options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING CONTIGUOUS INPUT" << endl
+                          << "=================================" << endl;
+
+        const bsl::string LONG_NAME(20000, 'x');
+        const bsl::string LONG_JSON = "{\"name\":\"" + LONG_NAME + "\","
+                                      "\"homeAddress\":{},\"age\":7}";
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_input;    // JSON input
+            bool        d_isValid;  // 'true' if 'd_input' decodes
+            const char *d_name;     // expected name
+            int         d_age;      // expected age
+        } DATA[] = {
+            //LINE INPUT                                VALID  NAME      AGE
+            //---- ------------------------------------ -----  --------- ---
+            { L_,  "{}",                                true,  "",         0 },
+            { L_,  "{\"name\":\"Bob\",\"age\":21}",     true,  "Bob",     21 },
+            { L_,  " \n\t{\"age\":3,\"name\":\"Al\"} ", true,  "Al",       3 },
+            { L_,  "{\"name\":\"a\\\"b\\\\c\\u0041\"}", true,  "a\"b\\cA", 0 },
+            { L_,  "{\"name\":\"Bob\",\"homeAddress\":{\"street\":"
+                   "\"Lexington Ave\",\"city\":\"New York City\","
+                   "\"state\":\"New York\"},\"age\":21}",
+                                                        true,  "Bob",     21 },
+            { L_,  "",                                  false, "",         0 },
+            { L_,  "   ",                               false, "",         0 },
+            { L_,  "{\"name\":\"Bob\"",                 false, "",         0 },
+            { L_,  "{\"name\":Bob}",                    false, "",         0 },
+            { L_,  "{\"age\":\"old\"}",                 false, "",         0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) cout << "\nCompare with decoding from a 'streambuf'."
+                          << endl;
+
+        for (int ti = 0; ti <= NUM_DATA; ++ti) {
+            const bool        IS_LONG  = NUM_DATA == ti;
+            const int         LINE     = IS_LONG ? L_ : DATA[ti].d_line;
+            const bsl::string INPUT    = IS_LONG ? LONG_JSON
+                                                 : DATA[ti].d_input;
+            const bool        IS_VALID = IS_LONG || DATA[ti].d_isValid;
+            const bsl::string NAME     = IS_LONG ? LONG_NAME
+                                                 : DATA[ti].d_name;
+            const int         AGE      = IS_LONG ? 7 : DATA[ti].d_age;
+
+            if (veryVerbose) { P_(LINE) P(IS_VALID) }
+
+            const baljsn::DecoderOptions options;
+
+            test::Employee             fromStreamBuf;
+            baljsn::Decoder            streamBufDecoder;
+            bdlsb::FixedMemInStreamBuf isb(INPUT.data(), INPUT.length());
+
+            const int STREAMBUF_RC = streamBufDecoder.decode(&isb,
+                                                             &fromStreamBuf,
+                                                             options);
+
+            test::Employee  fromStringRef;
+            baljsn::Decoder stringRefDecoder;
+
+            const int STRINGREF_RC = stringRefDecoder.decode(
+                                                bslstl::StringRef(INPUT),
+                                                &fromStringRef,
+                                                options);
+
+            ASSERTV(LINE, STREAMBUF_RC, IS_VALID == (0 == STREAMBUF_RC));
+            ASSERTV(LINE, STRINGREF_RC, IS_VALID == (0 == STRINGREF_RC));
+
+            if (!IS_VALID) {
+                continue;
+            }
+
+            ASSERTV(LINE, fromStreamBuf == fromStringRef);
+            ASSERTV(LINE, NAME == fromStringRef.name());
+            ASSERTV(LINE, AGE  == fromStringRef.age());
+
+            // The input need not be null-terminated, and characters past
+            // its end are never read.
+
+            bsl::string padded(INPUT);
+            padded.append("}}]]garbage");
+
+            test::Employee  fromPadded;
+            baljsn::Decoder paddedDecoder;
+
+            ASSERTV(LINE, 0 == paddedDecoder.decode(
+                                      bslstl::StringRef(padded.data(),
+                                                        INPUT.length()),
+                                      &fromPadded,
+                                      options));
+            ASSERTV(LINE, fromStringRef == fromPadded);
+
+            // Every proper prefix that ends before the closing brace fails
+            // to decode.
+
+            const bsl::size_t closing = INPUT.rfind('}');
+
+            for (bsl::size_t len = 0; len <= closing; ++len) {
+                if (IS_LONG && len % 997 && len + 8 < closing) {
+                    continue;
+                }
+
+                test::Employee  fromPrefix;
+                baljsn::Decoder prefixDecoder;
+
+                ASSERTV(LINE, len, 0 != prefixDecoder.decode(
+                                            bslstl::StringRef(padded.data(),
+                                                              len),
+                                            &fromPrefix,
+                                            options));
+            }
+        }
+
+        if (verbose) cout << "\nTesting options." << endl;
+        {
+            const char *INPUT = "{\"name\":\"Bob\",\"unknown\":[1,2],"
+                                "\"age\":21}";
+
+            baljsn::DecoderOptions options;
+            baljsn::Decoder        decoder;
+
+            test::Employee value;
+
+            options.setSkipUnknownElements(false);
+            ASSERT(0 != decoder.decode(bslstl::StringRef(INPUT),
+                                       &value,
+                                       options));
+            ASSERT(!decoder.loggedMessages().empty());
+
+            options.setSkipUnknownElements(true);
+            ASSERT(0 == decoder.decode(bslstl::StringRef(INPUT),
+                                       &value,
+                                       options));
+            ASSERTV(decoder.loggedMessages(),
+                    decoder.loggedMessages().empty());
+            ASSERT("Bob" == value.name());
+            ASSERT(21    == value.age());
+
+            test::Employee other;
+
+            ASSERT(0 == decoder.decode(bslstl::StringRef(INPUT),
+                                       &other,
+                                       &options));
+            ASSERT(value == other);
+
+            other.reset();
+            ASSERT(0 == decoder.decode(
+                                 bslstl::StringRef(INPUT),
+                                 &other,
+                                 static_cast<baljsn::DecoderOptions *>(0)));
+            ASSERT(value == other);
+
+            options.setMaxDepth(1);
+            ASSERT(0 != decoder.decode(bslstl::StringRef(INPUT),
+                                       &value,
+                                       options));
+        }
+      } break;
       case 8: {
         // ------------------------------------------------------------------
         // TESTING CLEARING OF LOGGED MESSAGES ON DECODE CALLS
@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bdlde_charconvertutf32.h>
 
 #include <bdlb_chartype.h>
+#include <bdlb_numericparseutil.h>
 #include <bdlb_string.h>
 
 #include <bdldfp_decimalutil.h>
@@ -366,6 +367,24 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return loadInfOrNan(value, data);                             // RETURN
     }
 
+    // Most numbers are converted by the locale-independent fast path, which
+    // fails (rather than reporting an out-of-range value) for any text it
+    // does not handle; 'strtod' is used for the rest.
+
+    double            tmp;
+    bslstl::StringRef remainder;
+
+    if (0 == bdlb::NumericParseUtil::parseDoubleFast(&tmp, &remainder, data)) {
+        const unsigned char lastChar = data[data.length() - 1];
+
+        if (0 != remainder.length() || !bsl::isdigit(lastChar)) {
+            return -1;                                                // RETURN
+        }
+
+        *value = tmp;
+        return 0;                                                     // RETURN
+    }
+
     const int k_MAX_STRING_LENGTH = 63;
     char      buffer[k_MAX_STRING_LENGTH + 1];
 
@@ -377,7 +396,7 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
 
     char   *endPtr = 0;
     errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
+    tmp            = bsl::strtod(dataString.c_str(), &endPtr);
 
     if (endPtr    != dataString.end()
      || (0        == tmp && 0 != errno)
@@ -621,26 +640,21 @@ int ParserUtil::getValue(bsl::vector<char> *value,
         return -1;                                                    // RETURN
     }
 
-    value->clear();
-
-    bdlde::Base64Decoder base64Decoder(true);
-    bsl::back_insert_iterator<bsl::vector<char> > outputIterator(*value);
+    const int length = static_cast<int>(base64String.length());
 
-    rc = base64Decoder.convert(outputIterator,
-                               base64String.begin(),
-                               base64String.end());
+    value->resize(bdlde::Base64Decoder::maxDecodedLength(length));
 
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
+    int numOut;
+    int numIn;
+    rc = bdlde::Base64Decoder::decode(value->data(),
+                                      &numOut,
+                                      &numIn,
+                                      base64String.data(),
+                                      base64String.data() + length);
 
-    rc = base64Decoder.endConvert(outputIterator);
+    value->resize(numOut);
 
-    if (rc < 0) {
-        return rc;                                                    // RETURN
-    }
-
-    return 0;
+    return rc;
 }
 }  // close package namespace
 
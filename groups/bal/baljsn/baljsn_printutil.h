@@ -82,6 +82,7 @@ BSLS_IDENT("$Id: $")
 #include <baljsn_encoderoptions.h>
 
 #include <bdlb_float.h>
+#include <bdlb_numericformatutil.h>
 
 #include <bdldfp_decimal.h>
 #include <bdldfp_decimalconvertutil.h>
@@ -302,19 +303,39 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         const int k_SIZE = 32;
         char      buffer[k_SIZE];
 
+        // A precision of at least 'maxDigits' (the number of digits that
+        // always suffices to round-trip, i.e., 'max_digits10') is satisfied
+        // by the shortest round-trip representation.  At a precision not
+        // exceeding 'digits10', the shortest representation, if it has no
+        // more digits than the precision, is identical to the output of
+        // 'snprintf'.  Otherwise, fall back to 'snprintf'.
+
+        const int precision = maxStreamPrecision<TYPE>(options);
+        const int maxDigits = sizeof(TYPE) == sizeof(float)
+                              ? bdlb::NumericFormatUtil::k_MAX_FLOAT_DIGITS
+                              : bdlb::NumericFormatUtil::k_MAX_DOUBLE_DIGITS;
+        int       len       = 0;
+
+        if (precision >= maxDigits) {
+            len = bdlb::NumericFormatUtil::formatShortest(buffer, value);
+        }
+        else if (precision <= bsl::numeric_limits<TYPE>::digits10) {
+            len = bdlb::NumericFormatUtil::formatShortest(buffer,
+                                                          value,
+                                                          precision);
+        }
+
+        if (0 == len) {
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #define snprintf _snprintf
 #endif
 
-        const int len = snprintf(buffer,
-                                 k_SIZE,
-                                 "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
-                                 value);
+            len = snprintf(buffer, k_SIZE, "%-1.*g", precision, value);
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #undef snprintf
 #endif
+        }
         stream.write(buffer, len);
       }
     }
@@ -1,6 +1,8 @@
 // baljsn_printutil.t.cpp                                             -*-C++-*-
 #include <baljsn_printutil.h>
 
+#include <baljsn_parserutil.h>
+
 #include <bdldfp_decimal.h>
 
 #include <bdlt_date.h>
@@ -12,13 +14,17 @@
 
 #include <bslim_testutil.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using bsl::cout;
@@ -66,6 +72,7 @@ using bsl::endl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: ENCODE AND DECODE 'double'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -855,26 +862,29 @@ int main(int argc, char *argv[])
                 { L_,        1.0e-1f, 1, "0.1" },
                 { L_,  0.1234567891f, 1, "0.1" },
                 { L_,  0.1234567891f, 4, "0.1235" },
-                { L_,  0.1234567891f, 9, "0.123456791" },
+                { L_,  0.1234567891f, 9, "0.12345679" },
+
+                // Values formatted by 'bdlb::NumericFormatUtil' (rather than
+                // by 'snprintf') have two-digit exponents on all platforms.
 
 #if defined(BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
-                { L_,           10.0, 1, "1e+001" },
+                { L_,           10.0, 1, "1e+01" },
                 { L_,         -1.5e1, 1, "-2e+001" },
                 { L_,-1.23456789e-20, 1, "-1e-020" },
                 { L_,-1.23456789e-20, 2, "-1.2e-020" },
                 { L_,-1.23456789e-20, 8, "-1.2345679e-020"  },
-                { L_,-1.23456789e-20, 9, "-1.23456787e-020" },
+                { L_,-1.23456789e-20, 9, "-1.2345679e-20" },
                 { L_, 1.23456789e-20, 1, "1e-020" },
-                { L_, 1.23456789e-20, 9, "1.23456787e-020" },
+                { L_, 1.23456789e-20, 9, "1.2345679e-20" },
 #else
                 { L_,           10.0f, 1, "1e+01" },
                 { L_,         -1.5e1f, 1, "-2e+01" },
                 { L_,-1.23456789e-20f, 1, "-1e-20" },
                 { L_,-1.23456789e-20f, 2, "-1.2e-20" },
                 { L_,-1.23456789e-20f, 8, "-1.2345679e-20"  },
-                { L_,-1.23456789e-20f, 9, "-1.23456787e-20" },
+                { L_,-1.23456789e-20f, 9, "-1.2345679e-20" },
                 { L_, 1.23456789e-20f, 1, "1e-20" },
-                { L_, 1.23456789e-20f, 9, "1.23456787e-20" },
+                { L_, 1.23456789e-20f, 9, "1.2345679e-20" },
 #endif
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
@@ -961,14 +971,14 @@ int main(int argc, char *argv[])
       { L_,                     -1.5,  2, "-1.5" },
       { L_,                 -9.9e100,  2, "-9.9e+100" },
       { L_,                 -9.9e100, 15, "-9.9e+100" },
-      { L_,                 -9.9e100, 17, "-9.9000000000000003e+100" },
+      { L_,                 -9.9e100, 17, "-9.9e+100" },
       { L_,                -3.14e300, 15, "-3.14e+300" },
-      { L_,                -3.14e300, 17, "-3.1400000000000001e+300" },
+      { L_,                -3.14e300, 17, "-3.14e+300" },
       { L_,                 3.14e300,  2, "3.1e+300" },
-      { L_,                 3.14e300, 17, "3.1400000000000001e+300" },
+      { L_,                 3.14e300, 17, "3.14e+300" },
       { L_,                   1.0e-1,  1, "0.1" },
       { L_,                2.23e-308,  2, "2.2e-308" },
-      { L_,                2.23e-308, 17, "2.2300000000000001e-308" },
+      { L_,                2.23e-308, 17, "2.23e-308" },
       { L_,     0.123456789012345678,  1, "0.1" },
       { L_,     0.123456789012345678,  2, "0.12" },
       { L_,     0.123456789012345678, 15, "0.123456789012346" },
@@ -976,13 +986,13 @@ int main(int argc, char *argv[])
       { L_,     0.123456789012345678, 17, "0.12345678901234568" },
 
 #if defined(BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
-      { L_,                     10.0,  1, "1e+001" },
+      { L_,                     10.0,  1, "1e+01" },
       { L_,                   -1.5e1,  1, "-2e+001" },
       { L_,  -1.2345678901234567e-20,  1, "-1e-020" },
       { L_,  -1.2345678901234567e-20,  2, "-1.2e-020" },
       { L_,  -1.2345678901234567e-20, 15, "-1.23456789012346e-020"  },
       { L_,  -1.2345678901234567e-20, 16, "-1.234567890123457e-020" },
-      { L_,  -1.2345678901234567e-20, 17, "-1.2345678901234567e-020" },
+      { L_,  -1.2345678901234567e-20, 17, "-1.2345678901234567e-20" },
 #else
       { L_,                     10.0,  1, "1e+01" },
       { L_,                   -1.5e1,  1, "-2e+01" },
@@ -1533,6 +1543,131 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ENCODE AND DECODE 'double'
+        //
+        // Concerns:
+        //: 1 Encoding 'double' values with 'printValue' and decoding them with
+        //:   'baljsn::ParserUtil::getValue' is substantially faster than
+        //:   formatting with 'snprintf' and parsing with 'strtod', as was
+        //:   formerly done.
+        //:
+        //: 2 At the maximum precision, the encoded values round-trip.
+        //
+        // Plan:
+        //: 1 For "price-like" values having few digits, and for values having
+        //:   pseudo-random bit patterns, encode an array of 'double' values
+        //:   into a comma-separated string using 'printValue' at the default
+        //:   and the maximum precision, and using 'snprintf("%-1.*g")' at the
+        //:   same precisions; then decode each string using 'getValue' and
+        //:   using 'strtod' on a null-terminated copy.  Report the time per
+        //:   value of each, and verify that values encoded at the maximum
+        //:   precision decode to the original values.  (C-1, 2)
+        //
+        // Testing:
+        //   PERFORMANCE: ENCODE AND DECODE 'double'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: ENCODE AND DECODE 'double'" << endl
+                          << "=======================================" << endl;
+
+        const int NUM_VALUES = 1 << 16;
+        const int NUM_ROUNDS = argc > 2 ? atoi(argv[2]) : 10;
+
+        bsl::vector<double> values(NUM_VALUES);
+        bsl::vector<double> decoded(NUM_VALUES);
+
+        for (int mode = 0; mode < 2; ++mode) {
+            Uint64 state = 0x9e3779b97f4a7c15ULL;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                if (0 == mode) {
+                    values[i] = static_cast<double>(state % 10000000) / 100.0;
+                }
+                else {
+                    const Uint64 bits = state & ~(1ULL << 62);  // finite
+                    bsl::memcpy(&values[i], &bits, sizeof(double));
+                }
+            }
+
+            cout << (0 == mode ? "prices" : "random bit patterns") << endl;
+
+            for (int precision = 15; precision <= 17; precision += 2) {
+                baljsn::EncoderOptions options;
+                options.setMaxDoublePrecision(precision);
+
+                for (int method = 0; method < 2; ++method) {
+                    bsl::ostringstream oss;
+
+                    bsls::Stopwatch timer;
+                    timer.start();
+                    for (int r = 0; r < NUM_ROUNDS; ++r) {
+                        oss.str("");
+                        for (int i = 0; i < NUM_VALUES; ++i) {
+                            if (0 == method) {
+                                Obj::printValue(oss, values[i], &options);
+                            }
+                            else {
+                                char buffer[32];
+                                const int len = snprintf(buffer,
+                                                         sizeof buffer,
+                                                         "%-1.*g",
+                                                         precision,
+                                                         values[i]);
+                                oss.write(buffer, len);
+                            }
+                            oss << ',';
+                        }
+                    }
+                    timer.stop();
+                    const double encodeTime = timer.elapsedTime();
+
+                    const bsl::string encoded = oss.str();
+
+                    timer.reset();
+                    timer.start();
+                    for (int r = 0; r < NUM_ROUNDS; ++r) {
+                        const char *begin = encoded.data();
+                        for (int i = 0; i < NUM_VALUES; ++i) {
+                            const char *end = bsl::strchr(begin, ',');
+                            if (0 == method) {
+                                baljsn::ParserUtil::getValue(
+                                          &decoded[i],
+                                          bslstl::StringRef(begin, end));
+                            }
+                            else {
+                                const bsl::string copy(begin, end);
+                                decoded[i] = strtod(copy.c_str(), 0);
+                            }
+                            begin = end + 1;
+                        }
+                    }
+                    timer.stop();
+                    const double decodeTime = timer.elapsedTime();
+
+                    if (17 == precision) {
+                        for (int i = 0; i < NUM_VALUES; ++i) {
+                            ASSERTV(i, values[i] == decoded[i]);
+                        }
+                    }
+
+                    const double N = static_cast<double>(NUM_VALUES)
+                                                                 * NUM_ROUNDS;
+                    cout << "  precision " << precision
+                         << (0 == method ? "  printValue/getValue: "
+                                         : "  snprintf/strtod:     ")
+                         << "encode " << encodeTime * 1e9 / N << " ns, "
+                         << "decode " << decodeTime * 1e9 / N << " ns, "
+                         << static_cast<double>(encoded.size()) / NUM_VALUES
+                         << " bytes/value" << endl;
+                }
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -4,12 +4,19 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
 
-#include <bsl_cstring.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define BALJSN_TOKENIZER_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
 #include <baljsn_parserutil.h>                 // for testing only
 
 // IMPLEMENTATION NOTES
@@ -52,12 +59,194 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_OBJECT                   '}'         ']'              END_ARRAY
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
+//
+///Scanning
+///--------
+// Most of the characters of a typical JSON document belong to strings, to
+// unquoted values, or to whitespace, so the three loops that skip over such
+// runs of characters dominate the cost of tokenizing.  Each loop is
+// implemented by a function in the unnamed namespace below that returns the
+// position of the first character that ends the run.  Where SSE2 is
+// available, each function classifies 16 characters with a handful of
+// comparisons and uses the resulting bit mask to locate the first
+// terminating character, falling back to a table lookup per character for
+// the final partial block; elsewhere the table lookup is used throughout.
+//
+// Escape sequences within a string are handled by stopping at each backslash
+// and skipping the character that follows it, which may lie beyond the
+// characters currently buffered.
 
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+enum {
+    // This 'enum' lists the bits of the character classes used for scanning.
+
+    k_WHITESPACE       = 1,  // ' ', '\t', '\n', '\v', '\f', and '\r'
+    k_STRING_DELIMITER = 2,  // '"' and '\\'
+    k_VALUE_DELIMITER  = 4   // whitespace, '\0', '{', '}', '[', ']', ':', ','
+};
+
+static const unsigned char CHARACTER_CLASS[256] = {
+    // This table maps each character to the bitwise OR of its character
+    // classes.
+
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 0, 0,  // 00 - 0F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 10 - 1F
+    5, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,  // 20 - 2F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,  // 30 - 3F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 40 - 4F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 4, 0, 0,  // 50 - 5F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 60 - 6F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0,  // 70 - 7F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 80 - 8F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 90 - 9F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // A0 - AF
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // B0 - BF
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // C0 - CF
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // D0 - DF
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // E0 - EF
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0   // F0 - FF
+};
+
+inline
+bool isInClass(char character, int characterClass)
+    // Return 'true' if the specified 'character' belongs to the specified
+    // 'characterClass', and 'false' otherwise.
+{
+    return CHARACTER_CLASS[static_cast<unsigned char>(character)]
+                                                              & characterClass;
+}
+
+#if defined(BALJSN_TOKENIZER_USE_SSE2)
+inline
+__m128i whitespaceMask(__m128i characters)
+    // Return a mask having each byte set to 0xFF if the corresponding byte of
+    // the specified 'characters' is whitespace, and to 0 otherwise.
+{
+    // The control characters '\t', '\n', '\v', '\f', and '\r' are the
+    // contiguous range 9 to 13, which is tested with a single unsigned
+    // comparison.
+
+    const __m128i offset  = _mm_sub_epi8(characters, _mm_set1_epi8(9));
+    const __m128i control = _mm_cmpeq_epi8(
+                                      _mm_min_epu8(offset, _mm_set1_epi8(4)),
+                                      offset);
+    return _mm_or_si128(control,
+                        _mm_cmpeq_epi8(characters, _mm_set1_epi8(' ')));
+}
+#endif
+
+bsl::size_t findNonWhitespace(const char  *data,
+                              bsl::size_t  position,
+                              bsl::size_t  length)
+    // Return the position of the first character at or after the specified
+    // 'position' in the specified 'data' having the specified 'length' that
+    // is not whitespace, or a value not less than 'length' if there is no
+    // such character.
+{
+#if defined(BALJSN_TOKENIZER_USE_SSE2)
+    while (position + 16 <= length) {
+        const __m128i characters = _mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(data + position));
+        const bsl::uint32_t mask = ~_mm_movemask_epi8(
+                                      whitespaceMask(characters)) & 0xFFFF;
+        if (mask) {
+            return position + bdlb::BitUtil::numTrailingUnsetBits(mask);
+                                                                      // RETURN
+        }
+        position += 16;
+    }
+#endif
+    while (position < length && isInClass(data[position], k_WHITESPACE)) {
+        ++position;
+    }
+    return position;
+}
+
+bsl::size_t findStringDelimiter(const char  *data,
+                                bsl::size_t  position,
+                                bsl::size_t  length)
+    // Return the position of the first '"' or '\' character at or after the
+    // specified 'position' in the specified 'data' having the specified
+    // 'length', or a value not less than 'length' if there is no such
+    // character.
+{
+#if defined(BALJSN_TOKENIZER_USE_SSE2)
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+
+    while (position + 16 <= length) {
+        const __m128i characters = _mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(data + position));
+        const bsl::uint32_t mask = _mm_movemask_epi8(
+                             _mm_or_si128(_mm_cmpeq_epi8(characters, quote),
+                                          _mm_cmpeq_epi8(characters,
+                                                         backslash)));
+        if (mask) {
+            return position + bdlb::BitUtil::numTrailingUnsetBits(mask);
+                                                                      // RETURN
+        }
+        position += 16;
+    }
+#endif
+    while (position < length
+        && !isInClass(data[position], k_STRING_DELIMITER)) {
+        ++position;
+    }
+    return position;
+}
+
+bsl::size_t findValueDelimiter(const char  *data,
+                               bsl::size_t  position,
+                               bsl::size_t  length)
+    // Return the position of the first whitespace, null, or structural
+    // ('{', '}', '[', ']', ':', or ',') character at or after the specified
+    // 'position' in the specified 'data' having the specified 'length', or a
+    // value not less than 'length' if there is no such character.
+{
+#if defined(BALJSN_TOKENIZER_USE_SSE2)
+    // Setting bit 5 maps '[' and ']' onto '{' and '}' respectively, and no
+    // other character onto either.
+
+    const __m128i zero        = _mm_setzero_si128();
+    const __m128i bit5        = _mm_set1_epi8(0x20);
+    const __m128i openBrace   = _mm_set1_epi8('{');
+    const __m128i closeBrace  = _mm_set1_epi8('}');
+    const __m128i colon       = _mm_set1_epi8(':');
+    const __m128i comma       = _mm_set1_epi8(',');
+
+    while (position + 16 <= length) {
+        const __m128i characters = _mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(data + position));
+        const __m128i folded     = _mm_or_si128(characters, bit5);
+
+        __m128i delimiters = whitespaceMask(characters);
+        delimiters = _mm_or_si128(delimiters,
+                                  _mm_cmpeq_epi8(characters, zero));
+        delimiters = _mm_or_si128(delimiters,
+                                  _mm_cmpeq_epi8(folded, openBrace));
+        delimiters = _mm_or_si128(delimiters,
+                                  _mm_cmpeq_epi8(folded, closeBrace));
+        delimiters = _mm_or_si128(delimiters,
+                                  _mm_cmpeq_epi8(characters, colon));
+        delimiters = _mm_or_si128(delimiters,
+                                  _mm_cmpeq_epi8(characters, comma));
+
+        const bsl::uint32_t mask = _mm_movemask_epi8(delimiters);
+        if (mask) {
+            return position + bdlb::BitUtil::numTrailingUnsetBits(mask);
+                                                                      // RETURN
+        }
+        position += 16;
+    }
+#endif
+    while (position < length
+        && !isInClass(data[position], k_VALUE_DELIMITER)) {
+        ++position;
+    }
+    return position;
+}
 
 }  // close unnamed namespace
 
@@ -70,17 +259,26 @@ namespace baljsn {
 // PRIVATE MANIPULATORS
 int Tokenizer::reloadStringBuffer()
 {
+    if (!d_streambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
     const int numRead =
                      static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[0],
                                                            k_MAX_STRING_SIZE));
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
+    updateDataView();
     return numRead;
 }
 
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (!d_streambuf_p) {
+        return -1;                                                    // RETURN
+    }
+
     const bsl::string::size_type currLength = d_stringBuffer.length();
     d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
@@ -88,11 +286,16 @@ int Tokenizer::expandBufferForLargeValue()
             static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
                                                   k_MAX_STRING_SIZE));
     d_stringBuffer.resize(currLength + numRead);
+    updateDataView();
     return numRead ? 0 : -1;
 }
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (!d_streambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -105,6 +308,7 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
                                              k_MAX_STRING_SIZE - d_valueIter));
 
     d_stringBuffer.resize(d_valueIter + numRead);
+    updateDataView();
 
     return numRead;
 }
@@ -112,10 +316,8 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
+        d_cursor = findNonWhitespace(d_data_p, d_cursor, d_dataLength);
+        if (d_cursor < d_dataLength) {
             break;
         }
 
@@ -129,61 +331,59 @@ int Tokenizer::skipWhitespace()
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime = true;
+    bool escaped   = false;  // 'true' if the character at 'd_valueIter' is
+                             // preceded by an unescaped '\\'
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        while (d_valueIter < d_dataLength) {
+            if (escaped) {
+                ++d_valueIter;
+                escaped = false;
+                continue;
+            }
 
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
+            d_valueIter = findStringDelimiter(d_data_p,
+                                              d_valueIter,
+                                              d_dataLength);
+            if (d_valueIter >= d_dataLength) {
+                break;
             }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
+
+            if ('"' == d_data_p[d_valueIter]) {
+                d_valueEnd = d_valueIter;
+                return 0;                                             // RETURN
             }
 
             ++d_valueIter;
+            escaped = true;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        // There isn't enough room in the internal buffer to hold the value.
+        // If this is the first time through the loop, we move the current
+        // sequence of characters being processed to the front of the
+        // internal buffer, otherwise we must expand the internal buffer to
+        // hold additional characters.  If we are at the beginning of the
+        // string buffer then we dont need to move any characters and we
+        // simply expand the string buffer.
 
-            // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
-            // current sequence of characters being processed to the front of
-            // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.  If we are at the
-            // beginning of the string buffer then we dont need to move any
-            // characters and we simply expand the string buffer.
+        if (0 == d_valueBegin) {
+            firstTime = false;
+        }
 
-            if (0 == d_valueBegin) {
-                firstTime = false;
+        if (firstTime) {
+            const int numRead = moveValueCharsToStartAndReloadBuffer();
+            if (0 == numRead) {
+                return -1;                                            // RETURN
             }
 
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
-                if (0 == numRead) {
-                    return -1;                                        // RETURN
-                }
-
-                firstTime = false;
-            }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
-                }
-            }
+            firstTime = false;
         }
         else {
-            if ('\\' == previousChar) {
-                ++d_valueIter;
-                previousChar = 0;
-                continue;
+            const int rc = expandBufferForLargeValue();
+            if (rc) {
+                return rc;                                            // RETURN
             }
-            d_valueEnd = d_valueIter;
-            return 0;                                                 // RETURN
         }
     }
     return 0;
@@ -194,13 +394,9 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
-        }
+        d_valueIter = findValueDelimiter(d_data_p, d_valueIter, d_dataLength);
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_dataLength) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -239,7 +435,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_dataLength) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -258,7 +454,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (d_data_p[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -572,12 +768,11 @@ int Tokenizer::advanceToNextToken()
 
 int Tokenizer::resetStreamBufGetPointer()
 {
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (!d_streambuf_p || d_cursor >= d_dataLength) {
         return 0;                                                     // RETURN
     }
 
-    const int numExtraCharsRead = static_cast<int>(d_stringBuffer.size()
-                                                                   - d_cursor);
+    const int numExtraCharsRead = static_cast<int>(d_dataLength - d_cursor);
     const bsl::streamoff newPos = d_streambuf_p->pubseekoff(-numExtraCharsRead,
                                                             bsl::ios_base::cur,
                                                             bsl::ios_base::in);
@@ -590,8 +785,7 @@ int Tokenizer::value(bslstl::StringRef *data) const
 {
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(d_data_p + d_valueBegin, d_data_p + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
@@ -23,6 +23,23 @@ BSLS_IDENT("$Id: $")
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
 //
+///Contiguous Input
+///----------------
+// When the JSON data is already held in contiguous memory, the 'reset'
+// overload taking a 'bslstl::StringRef' associates the tokenizer directly
+// with that memory.  In this mode the tokenizer does not copy the input into
+// its internal buffer, and the string references loaded by 'value' refer
+// directly into the supplied input, which must therefore outlive their use.
+//
+///Performance
+///-----------
+// The tokenizer locates the end of each string, the end of each unquoted
+// value, and the end of each run of whitespace by classifying 16 characters
+// at a time using SSE2 instructions on platforms that support them, and one
+// character at a time using a lookup table elsewhere.  The structural
+// characters themselves ('{', '}', '[', ']', ':', and ',') are validated one
+// at a time by the tokenizer's state machine.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -131,6 +148,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #include <bsls_types.h>
 
+#include <bslstl_stringref.h>
+
 #include <bsl_streambuf.h>
 #include <bsl_string.h>
 #include <bsl_vector.h>
@@ -207,9 +226,21 @@ class Tokenizer {
     bsl::string                          d_stringBuffer;    // string buffer
 
     bsl::streambuf                      *d_streambuf_p;     // streambuf
+                                                            // (held, not
+                                                            // owned), or 0
+                                                            // for contiguous
+                                                            // input
+
+    const char                          *d_data_p;          // characters
+                                                            // being
+                                                            // tokenized
                                                             // (held, not
                                                             // owned)
 
+    bsl::size_t                          d_dataLength;      // number of
+                                                            // characters at
+                                                            // 'd_data_p'
+
     bsl::size_t                          d_cursor;          // current cursor
 
     bsl::size_t                          d_valueBegin;      // cursor for
@@ -265,6 +296,10 @@ class Tokenizer {
         // 'd_streambuf_p') to the end of the current sequence of characters.
         // Return 0 on success and a non-zero value otherwise.
 
+    void updateDataView();
+        // Set 'd_data_p' and 'd_dataLength' to refer to the characters
+        // currently held in the internal string buffer, 'd_stringBuffer'.
+
     int skipWhitespace();
         // Skip all whitespace characters and position the cursor onto the
         // first non-whitespace character.  Return 0 on success and a non-zero
@@ -307,6 +342,16 @@ class Tokenizer {
         // 'advanceToNextToken' is called.  Note that this function does not
         // change the value of the 'allowStandAloneValues' option.
 
+    void reset(const bslstl::StringRef& input);
+        // Reset this tokenizer to read data directly from the contiguous
+        // characters of the specified 'input', without copying them.  The
+        // string references subsequently loaded by 'value' refer into
+        // 'input', and the behavior is undefined if 'input' is modified or
+        // destroyed while this tokenizer reads from it.  Note that the reader
+        // will not be on a valid node until 'advanceToNextToken' is called.
+        // Note that this function does not change the value of the
+        // 'allowStandAloneValues' option.
+
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
         // non-zero value otherwise.  Note that each call to
@@ -323,7 +368,8 @@ class Tokenizer {
         // from where this object stopped.  Also note that this call implies
         // the end of processing for this object and any subsequent methods
         // invoked on this object should only be done after calling 'reset' and
-        // specifying a new 'streambuf'.
+        // specifying a new 'streambuf'.  If this tokenizer reads contiguous
+        // input (see 'reset'), this function has no effect and returns 0.
 
     void setAllowStandAloneValues(bool value);
         // Set the 'allowStandAloneValues' option to the specified 'value'.  If
@@ -366,6 +412,13 @@ class Tokenizer {
 // ============================================================================
 
 // PRIVATE MANIPULATORS
+inline
+void Tokenizer::updateDataView()
+{
+    d_data_p     = d_stringBuffer.data();
+    d_dataLength = d_stringBuffer.length();
+}
+
 inline
 Tokenizer::ContextType Tokenizer::popContext()
 {
@@ -399,6 +452,8 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_stackAllocator(d_stackBuffer.buffer(), k_STACKBUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
 , d_streambuf_p(0)
+, d_data_p(d_stringBuffer.data())
+, d_dataLength(0)
 , d_cursor(0)
 , d_valueBegin(0)
 , d_valueEnd(0)
@@ -425,6 +480,24 @@ void Tokenizer::reset(bsl::streambuf *streambuf)
 {
     d_streambuf_p = streambuf;
     d_stringBuffer.clear();
+    updateDataView();
+    d_cursor      = 0;
+    d_valueBegin  = 0;
+    d_valueEnd    = 0;
+    d_valueIter   = 0;
+    d_tokenType   = e_BEGIN;
+
+    d_contextStack.clear();
+    pushContext(e_OBJECT_CONTEXT);
+}
+
+inline
+void Tokenizer::reset(const bslstl::StringRef& input)
+{
+    d_streambuf_p = 0;
+    d_stringBuffer.clear();
+    d_data_p      = input.data();
+    d_dataLength  = input.length();
     d_cursor      = 0;
     d_valueBegin  = 0;
     d_valueEnd    = 0;
@@ -17,6 +17,8 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bdlsb_memoutstreambuf.h>            // for testing only
 #include <bdlsb_fixedmemoutstreambuf.h>       // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>        // for testing only
@@ -49,6 +51,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [ 9] void reset(bsl::streambuf &streamBuf);
+// [17] void reset(const bslstl::StringRef& input);
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
@@ -61,7 +64,9 @@ using bsl::endl;
 // [ 3] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [17] USAGE EXAMPLE
+// [17] CONTIGUOUS INPUT AND BLOCK-WISE SCANNING
+// [18] USAGE EXAMPLE
+// [-1] PERFORMANCE: TOKENIZING A LARGE DOCUMENT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -196,7 +201,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -318,6 +323,262 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // CONTIGUOUS INPUT AND BLOCK-WISE SCANNING
+        //
+        // Concerns:
+        //: 1 Tokenizing contiguous input produces the same tokens and values
+        //:   as tokenizing the same input from a 'streambuf'.
+        //:
+        //: 2 The values loaded for contiguous input refer into the input.
+        //:
+        //: 3 Strings, unquoted values, and whitespace are delimited
+        //:   correctly wherever their terminating character falls relative
+        //:   to the blocks of characters classified together.
+        //:
+        //: 4 An escaped '"' is not taken to end a string, including when the
+        //:   escaping '\' is the last character read from the 'streambuf'
+        //:   before the internal buffer is reloaded.
+        //:
+        //: 5 Unterminated strings are reported as errors for contiguous
+        //:   input, and 'resetStreamBufGetPointer' has no effect.
+        //
+        // Plan:
+        //: 1 Tokenize a table of documents, both from a 'streambuf' and as
+        //:   contiguous input, and compare the resulting token types and
+        //:   values.  (C-1..2)
+        //:
+        //: 2 Tokenize documents having strings, values, and whitespace of
+        //:   each length from 0 to 40, and verify the values.  (C-3)
+        //:
+        //: 3 Tokenize documents in which a '\' followed by '"' straddles each
+        //:   offset around the size of the internal buffer.  (C-4)
+        //:
+        //: 4 Tokenize an unterminated string as contiguous input.  (C-5)
+        //
+        // Testing:
+        //   void reset(const bslstl::StringRef& input);
+        //   CONTIGUOUS INPUT AND BLOCK-WISE SCANNING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                       << endl
+                       << "CONTIGUOUS INPUT AND BLOCK-WISE SCANNING" << endl
+                       << "========================================" << endl;
+
+        if (verbose) cout << "\nComparing with 'streambuf' input." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input_p;
+            } DATA[] = {
+                //LINE  INPUT
+                //----  -----
+                { L_,   "{}"                                                },
+                { L_,   WS "{" WS "}" WS                                    },
+                { L_,   "{\"a\":1}"                                         },
+                { L_,   "{\"name\":\"value\",\"number\":-1.5e+10}"          },
+                { L_,   "{\"a\":[1,2,3],\"b\":{\"c\":\"d\"}}"               },
+                { L_,   "[\"x\",\"y\",[true,false,null]]"                   },
+                { L_,   "{\"esc\":\"a\\\"b\\\\c\\/d\\u0041\"}"              },
+                { L_,   "{\"s\":\"\\\\\"}"                                  },
+                { L_,   "{\"s\":\"\\\\\\\"\"}"                              },
+                { L_,   "{\"long name exceeding sixteen\":"
+                        "\"and a value exceeding sixteen characters\"}"     },
+                { L_,   "{\"a\":12345678901234567890123456789}"             },
+                { L_,   "{\"a\"" WS ":" WS "\"b\"" WS "," WS "\"c\":2}"     },
+                { L_,   "\"standalone\""                                    },
+                { L_,   "1234567890123456789"                               },
+                { L_,   "{\"a\":1,}"                                        },
+                { L_,   "{\"a\" 1}"                                         },
+                { L_,   "{\"a\":\"unterminated}"                            },
+                { L_,   "{\"a\":[1,2}"                                      },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE  = DATA[ti].d_line;
+                const bsl::string  INPUT = DATA[ti].d_input_p;
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                bsl::istringstream iss(INPUT);
+
+                Obj mX;  const Obj& X = mX;
+                Obj mY;  const Obj& Y = mY;
+
+                mX.reset(iss.rdbuf());
+                mY.reset(bslstl::StringRef(INPUT));
+
+                for (int i = 0; i < 100; ++i) {
+                    const int rcX = mX.advanceToNextToken();
+                    const int rcY = mY.advanceToNextToken();
+
+                    ASSERTV(LINE, i, rcX, rcY, rcX == rcY);
+                    ASSERTV(LINE, i, X.tokenType(), Y.tokenType(),
+                            X.tokenType() == Y.tokenType());
+
+                    bslstl::StringRef valueX, valueY;
+                    const int vrcX = X.value(&valueX);
+                    const int vrcY = Y.value(&valueY);
+
+                    ASSERTV(LINE, i, vrcX, vrcY, vrcX == vrcY);
+                    ASSERTV(LINE, i, valueX, valueY, valueX == valueY);
+
+                    if (0 == vrcY) {
+                        ASSERTV(LINE, i, INPUT.data() <= valueY.data());
+                        ASSERTV(LINE, i, valueY.data() + valueY.length()
+                                            <= INPUT.data() + INPUT.length());
+                    }
+
+                    if (rcX || rcY) {
+                        break;
+                    }
+                }
+
+                ASSERTV(LINE, 0 == mY.resetStreamBufGetPointer());
+            }
+        }
+
+        if (verbose) cout << "\nTesting block boundaries." << endl;
+        {
+            for (int padding = 0; padding <= 40; ++padding) {
+                for (int length = 0; length <= 40; ++length) {
+                    const bsl::string PAD(padding, ' ');
+                    const bsl::string NAME(length, 'n');
+                    const bsl::string NUMBER(length + 1, '7');
+
+                    // Place an escaped quote at each position of the string.
+
+                    for (int escape = -1; escape < length; ++escape) {
+                        bsl::string text(length, 's');
+                        if (0 <= escape) {
+                            text.insert(escape, "\\\"");
+                        }
+
+                        const bsl::string INPUT = PAD + "{" + PAD
+                                                + "\"" + NAME + "\"" + PAD
+                                                + ":\"" + text + "\"," + PAD
+                                                + "\"b\":" + NUMBER + PAD
+                                                + "}";
+
+                        for (int mode = 0; mode < 2; ++mode) {
+                            bsl::istringstream iss(INPUT);
+
+                            Obj mX;  const Obj& X = mX;
+                            if (mode) {
+                                mX.reset(bslstl::StringRef(INPUT));
+                            }
+                            else {
+                                mX.reset(iss.rdbuf());
+                            }
+
+                            bslstl::StringRef value;
+
+                            ASSERTV(padding, length, escape, mode,
+                                    0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_START_OBJECT == X.tokenType());
+
+                            ASSERTV(padding, length, escape, mode,
+                                    0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_ELEMENT_NAME == X.tokenType());
+                            ASSERTV(0 == X.value(&value) || 0 == length);
+                            ASSERTV(padding, length, mode,
+                                    NAME == bsl::string(value) || 0 == length);
+
+                            ASSERTV(padding, length, escape, mode,
+                                    0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_ELEMENT_VALUE == X.tokenType());
+                            ASSERTV(0 == X.value(&value));
+                            ASSERTV(padding, length, escape, mode, value,
+                                    "\"" + text + "\"" == value);
+
+                            ASSERTV(padding, length, escape, mode,
+                                    0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_ELEMENT_NAME == X.tokenType());
+
+                            ASSERTV(padding, length, escape, mode,
+                                    0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_ELEMENT_VALUE == X.tokenType());
+                            ASSERTV(0 == X.value(&value));
+                            ASSERTV(padding, length, mode, value,
+                                    NUMBER == value);
+
+                            ASSERTV(padding, length, escape, mode,
+                                    0 == mX.advanceToNextToken());
+                            ASSERTV(Obj::e_END_OBJECT == X.tokenType());
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting escapes across buffer reloads."
+                          << endl;
+        {
+            const int BUFFER_SIZE = 8 * 1024;
+
+            for (int offset = BUFFER_SIZE - 40;
+                 offset < BUFFER_SIZE + 40;
+                 ++offset) {
+
+                // Arrange that the string value begins at the start of the
+                // buffer, so that it is expanded rather than moved, and that
+                // its '\' is at 'offset'.
+
+                const bsl::string PREFIX = "{\"a\":";
+                const bsl::string BODY(offset - PREFIX.length() - 1, 'x');
+                const bsl::string INPUT = PREFIX + "\"" + BODY
+                                        + "\\\"y\",\"b\":\"\\\\\"}";
+
+                for (int mode = 0; mode < 2; ++mode) {
+                    bsl::istringstream iss(INPUT);
+
+                    Obj mX;  const Obj& X = mX;
+                    if (mode) {
+                        mX.reset(bslstl::StringRef(INPUT));
+                    }
+                    else {
+                        mX.reset(iss.rdbuf());
+                    }
+
+                    bslstl::StringRef value;
+
+                    ASSERTV(offset, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, Obj::e_ELEMENT_VALUE == X.tokenType());
+                    ASSERTV(offset, 0 == X.value(&value));
+                    ASSERTV(offset, mode, value.length(),
+                            "\"" + BODY + "\\\"y\"" == value);
+
+                    ASSERTV(offset, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, Obj::e_ELEMENT_NAME == X.tokenType());
+                    ASSERTV(offset, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, 0 == X.value(&value));
+                    ASSERTV(offset, mode, value, "\"\\\\\"" == value);
+                    ASSERTV(offset, 0 == mX.advanceToNextToken());
+                    ASSERTV(offset, Obj::e_END_OBJECT == X.tokenType());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting unterminated contiguous input."
+                          << endl;
+        {
+            const char INPUT[] = "{\"a\":\"abc\\\"";
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(bslstl::StringRef(INPUT));
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 != mX.advanceToNextToken());
+            ASSERT(Obj::e_ERROR == X.tokenType());
+            ASSERT(0 == mX.resetStreamBufGetPointer());
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // TESTING that arrays of heterogenous types are handled correctly
@@ -6814,6 +7075,82 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TOKENIZING A LARGE DOCUMENT
+        //
+        // Concerns:
+        //: 1 Tokenizing scales linearly with the size of the input, and is
+        //:   fast for input having long strings and deep indentation.
+        //
+        // Plan:
+        //: 1 Generate a document of records having names, strings (some with
+        //:   escape sequences), and numbers, and report the throughput of
+        //:   tokenizing it in full from a 'bdlsb::FixedMemInStreamBuf', and
+        //:   as contiguous input.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: TOKENIZING A LARGE DOCUMENT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                       << endl
+                       << "PERFORMANCE: TOKENIZING A LARGE DOCUMENT" << endl
+                       << "========================================" << endl;
+
+        const int NUM_RECORDS = argc > 2 ? atoi(argv[2]) : 20000;
+        const int NUM_PASSES  = 10;
+
+        bsl::string input("[\n");
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            if (i) {
+                input += ",\n";
+            }
+            bsl::ostringstream oss;
+            oss << "    {\n"
+                << "        \"identifier\" : " << i * 7919 << ",\n"
+                << "        \"name\"       : \"Record number " << i
+                << " of the performance test\",\n"
+                << "        \"comment\"    : \"A \\\"quoted\\\" phrase and a"
+                << " path C:\\\\data\\\\records\\\\" << i << "\",\n"
+                << "        \"price\"      : " << i << ".25,\n"
+                << "        \"active\"     : " << (i % 2 ? "true" : "false")
+                << "\n"
+                << "    }";
+            input += oss.str();
+        }
+        input += "\n]\n";
+
+        const double MB = static_cast<double>(input.length()) * NUM_PASSES
+                                                              / (1024 * 1024);
+
+        for (int contiguous = 0; contiguous < 2; ++contiguous) {
+            Int64 numTokens = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int pass = 0; pass < NUM_PASSES; ++pass) {
+                bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+                Obj mX;
+                if (contiguous) {
+                    mX.reset(bslstl::StringRef(input));
+                }
+                else {
+                    mX.reset(&isb);
+                }
+                while (0 == mX.advanceToNextToken()) {
+                    ++numTokens;
+                }
+            }
+            timer.stop();
+
+            cout << (contiguous ? "contiguous: " : "streambuf:  ")
+                 << input.length() << " bytes, "
+                 << numTokens / NUM_PASSES << " tokens, "
+                 << MB / timer.elapsedTime() << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -13,15 +13,20 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bdlf_memfn.h>
 #include <bdls_processutil.h>
 #include <bdlt_currenttime.h>
+#include <bdlt_datetime.h>
 
 #include <bslma_default.h>
+#include <bslmf_assert.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_threadattributes.h>
 
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
+#include <bsl_cstring.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
+#include <bsl_new.h>
 #include <bsl_ostream.h>
 
 ///IMPLEMENTATION NOTES
@@ -34,6 +39,15 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 // thread is restarted, 'shutdownThread' clears the queue in order to simplify
 // the implementation.  Alternative designs are possible, but are not perceived
 // to be worth the added complexity.
+//
+// When the record ring is in use, each message on the ring begins with a
+// 'RingRecordHeader' describing its kind.  A serialized record is followed by
+// its null-terminated file name and category, and its message; the publication
+// thread deserializes it into 'd_ringRecord', whose string and stream buffer
+// capacity is reused from one record to the next.  A shared record is
+// followed by a 'bsl::shared_ptr<const Record>' constructed in place, which
+// must be destroyed when the message is removed from the ring.  The 'e_END'
+// record of 'stopThread' is a header alone.
 
 namespace BloombergLP {
 namespace ball {
@@ -42,9 +56,76 @@ namespace {
 
 enum {
     k_DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    k_FORCE_WARN_THRESHOLD     = 5000
+    k_FORCE_WARN_THRESHOLD     = 5000,
+    k_SAMPLE_RATE              = 16    // one in 'k_SAMPLE_RATE' records is
+                                       // published when sampling
+};
+
+enum RingRecordKind {
+    // Enumerate the kinds of messages on the record ring.
+
+    e_SERIALIZED_RECORD,  // fixed fields serialized after the header
+    e_SHARED_RECORD,      // 'bsl::shared_ptr<const Record>' after the header
+    e_END_RECORD          // request to stop the publication thread
+};
+
+struct RingRecordHeader {
+    // This 'struct' is the header of a message on the record ring of an async
+    // file observer.  See the implementation notes.
+
+    // PUBLIC DATA
+    bdlt::Datetime      d_timestamp;          // record timestamp
+    bsls::Types::Uint64 d_threadID;           // record thread id
+    int                 d_kind;               // 'RingRecordKind'
+    int                 d_transmissionCause;  // context transmission cause
+    int                 d_recordIndex;        // context record index
+    int                 d_sequenceLength;     // context sequence length
+    int                 d_processID;          // record process id
+    int                 d_lineNumber;         // record line number
+    int                 d_severity;           // record severity
+    int                 d_fileNameLength;     // length of file name
+    int                 d_categoryLength;     // length of category
+    int                 d_messageLength;      // length of message
 };
 
+BSLMF_ASSERT(0 == sizeof(RingRecordHeader) % 8);
+
+typedef bsl::shared_ptr<const Record> RecordSharedPtr;
+
+static RingRecordHeader *createRingRecordHeader(void           *buffer,
+                                                RingRecordKind  kind,
+                                                const Context&  context)
+    // Create a 'RingRecordHeader' of the specified 'kind' describing the
+    // specified 'context' in the specified 'buffer', and return its address.
+{
+    RingRecordHeader *header = new (buffer) RingRecordHeader;
+
+    header->d_kind              = kind;
+    header->d_transmissionCause = context.transmissionCause();
+    header->d_recordIndex       = context.recordIndex();
+    header->d_sequenceLength    = context.sequenceLength();
+    return header;
+}
+
+static RecordSharedPtr *sharedRecord(const RingRecordHeader *header)
+    // Return the address of the shared pointer following the specified
+    // 'header' of an 'e_SHARED_RECORD' message.
+{
+    return reinterpret_cast<RecordSharedPtr *>(
+                           const_cast<RingRecordHeader *>(header + 1));
+}
+
+static void releaseRingRecord(const void *message)
+    // Release the resources held by the specified 'message' on a record ring.
+{
+    const RingRecordHeader *header =
+                                static_cast<const RingRecordHeader *>(message);
+
+    if (e_SHARED_RECORD == header->d_kind) {
+        sharedRecord(header)->~RecordSharedPtr();
+    }
+}
+
 static const char *const k_LOG_CATEGORY = "BALL.ASYNCFILEOBSERVER";
 
 static void populateWarnRecord(ball::Record *record,
@@ -79,12 +160,77 @@ void AsyncFileObserver::logDroppedMessageWarning(int numDropped)
     d_fileObserver.publish(d_droppedRecordWarning, context);
 }
 
+void AsyncFileObserver::publishRingRecords()
+{
+    bool done = false;
+
+    while (!done) {
+        int         length;
+        const void *message = d_recordRing_mp->front(&length);
+        BSLS_ASSERT(message);
+
+        const RingRecordHeader *header =
+                                static_cast<const RingRecordHeader *>(message);
+
+        // Publish the next log record on the ring only if the observer is not
+        // shutting down.
+
+        if (e_END_RECORD == header->d_kind || d_shuttingDownFlag) {
+            done = true;
+        }
+        else {
+            const Context context(static_cast<Transmission::Cause>(
+                                                 header->d_transmissionCause),
+                                  header->d_recordIndex,
+                                  header->d_sequenceLength);
+
+            if (e_SHARED_RECORD == header->d_kind) {
+                d_fileObserver.publish(**sharedRecord(header), context);
+            }
+            else {
+                const char *fileName = reinterpret_cast<const char *>(
+                                                                  header + 1);
+                const char *category = fileName + header->d_fileNameLength
+                                                                          + 1;
+                const char *text     = category + header->d_categoryLength
+                                                                          + 1;
+
+                RecordAttributes& fields = d_ringRecord.fixedFields();
+
+                fields.setTimestamp(header->d_timestamp);
+                fields.setProcessID(header->d_processID);
+                fields.setThreadID(header->d_threadID);
+                fields.setFileName(fileName);
+                fields.setLineNumber(header->d_lineNumber);
+                fields.setCategory(category);
+                fields.setSeverity(header->d_severity);
+                fields.clearMessage();
+                fields.messageStreamBuf().sputn(text,
+                                                header->d_messageLength);
+
+                d_fileObserver.publish(d_ringRecord, context);
+            }
+        }
+
+        releaseRingRecord(message);
+        d_recordRing_mp->popFront();
+
+        reportDroppedRecords(d_recordRing_mp->usedBytes()
+                                           <= d_recordRing_mp->capacity() / 2);
+    }
+}
+
 void AsyncFileObserver::publishThreadEntryPoint()
 {
     bool done = false;
     d_droppedRecordWarning.fixedFields().setThreadID(
                                           bslmt::ThreadUtil::selfIdAsUint64());
 
+    if (d_recordRing_mp) {
+        publishRingRecords();
+        return;                                                       // RETURN
+    }
+
     while (!done) {
         AsyncFileObserver_Record asyncRecord = d_recordQueue.popFront();
 
@@ -100,22 +246,115 @@ void AsyncFileObserver::publishThreadEntryPoint()
                                    asyncRecord.d_context);
         }
 
-        // Publish the count of dropped records.  To avoid repeatedly
-        // publishing this information when the record queue is full, we
-        // publish the number of dropped records only when the queue becomes
-        // half empty or when a sufficient number of records have been dropped.
-        // Finally, we publish the dropped record count if the observer is
-        // shutting down, so the information is not lost.
-
-        if (0 < d_dropCount.loadRelaxed()) {
-            if (d_recordQueue.length() <= d_recordQueue.size() / 2
-            ||  d_dropCount.loadRelaxed() >= k_FORCE_WARN_THRESHOLD
-            ||  d_shuttingDownFlag) {
-                int numDropped = d_dropCount.swap(0);
-                BSLS_ASSERT(0 < numDropped); // No other thread should have
-                                             // cleared the count.
-                logDroppedMessageWarning(numDropped);
-            }
+        reportDroppedRecords(d_recordQueue.length()
+                                               <= d_recordQueue.size() / 2);
+    }
+}
+
+void AsyncFileObserver::pushRingRecord(
+                                  const bsl::shared_ptr<const Record>& record,
+                                  const Context&                       context)
+{
+    const RecordAttributes& fields = record->fixedFields();
+
+    if (e_SAMPLE == d_overflowPolicy
+     && d_recordRing_mp->usedBytes() > d_recordRing_mp->capacity() / 4 * 3
+     && 0 != d_sampleCount.addRelaxed(1) % k_SAMPLE_RATE) {
+        d_dropCount.addRelaxed(1);
+        return;                                                       // RETURN
+    }
+
+    // Records having user fields, records whose message formatting is
+    // deferred (so that the message is rendered by the publication thread),
+    // and records too large for the ring, are held by shared reference.
+
+    const bool               isDeferred     = fields.isMessageDeferred();
+    const char              *fileName       = fields.fileName();
+    const char              *category       = fields.category();
+    const bslstl::StringRef  text           = isDeferred
+                                              ? bslstl::StringRef()
+                                              : fields.messageRef();
+    const int                fileNameLength =
+                                 static_cast<int>(bsl::strlen(fileName));
+    const int                categoryLength =
+                                 static_cast<int>(bsl::strlen(category));
+    const int                textLength     = static_cast<int>(text.length());
+
+    int            length = static_cast<int>(sizeof(RingRecordHeader))
+                          + fileNameLength + 1
+                          + categoryLength + 1
+                          + textLength;
+    RingRecordKind kind   = e_SERIALIZED_RECORD;
+
+    if (isDeferred
+     || 0 != record->customFields().length()
+     || length > d_recordRing_mp->maxMessageLength()) {
+        length = static_cast<int>(sizeof(RingRecordHeader)
+                                + sizeof(RecordSharedPtr));
+        kind   = e_SHARED_RECORD;
+    }
+
+    void *buffer = e_BLOCK == d_overflowPolicy
+                   ? d_recordRing_mp->reserve(length)
+                   : d_recordRing_mp->tryReserve(length);
+    if (!buffer) {
+        d_dropCount.addRelaxed(1);
+        return;                                                       // RETURN
+    }
+
+    RingRecordHeader *header = createRingRecordHeader(buffer, kind, context);
+
+    if (e_SHARED_RECORD == kind) {
+        new (sharedRecord(header)) RecordSharedPtr(record);
+    }
+    else {
+        header->d_timestamp      = fields.timestamp();
+        header->d_threadID       = fields.threadID();
+        header->d_processID      = fields.processID();
+        header->d_lineNumber     = fields.lineNumber();
+        header->d_severity       = fields.severity();
+        header->d_fileNameLength = fileNameLength;
+        header->d_categoryLength = categoryLength;
+        header->d_messageLength  = textLength;
+
+        char *data = reinterpret_cast<char *>(header + 1);
+        bsl::memcpy(data, fileName, fileNameLength + 1);
+        data += fileNameLength + 1;
+        bsl::memcpy(data, category, categoryLength + 1);
+        data += categoryLength + 1;
+        bsl::memcpy(data, text.data(), textLength);
+    }
+
+    d_recordRing_mp->commit(buffer, length);
+}
+
+void AsyncFileObserver::removeRingRecords()
+{
+    int         length;
+    const void *message;
+    while (0 != (message = d_recordRing_mp->tryFront(&length))) {
+        releaseRingRecord(message);
+        d_recordRing_mp->popFront();
+    }
+}
+
+void AsyncFileObserver::reportDroppedRecords(bool hasSpareCapacity)
+{
+    // Publish the count of dropped records.  To avoid repeatedly publishing
+    // this information when the record queue is full, we publish the number
+    // of dropped records only when the queue becomes half empty or when a
+    // sufficient number of records have been dropped.  Finally, we publish the
+    // dropped record count if the observer is shutting down, so the
+    // information is not lost.
+
+    if (0 < d_dropCount.loadRelaxed()) {
+        if (hasSpareCapacity
+        ||  d_dropCount.loadRelaxed() >= k_FORCE_WARN_THRESHOLD
+        ||  d_shuttingDownFlag) {
+            int numDropped = d_dropCount.swap(0);
+            BSLS_ASSERT(0 < numDropped); // No other thread should have
+                                         // cleared the count.
+            logDroppedMessageWarning(numDropped);
         }
     }
 }
@@ -134,6 +373,22 @@ int AsyncFileObserver::startThread()
 int AsyncFileObserver::stopThread()
 {
     if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
+        if (d_recordRing_mp) {
+            // Push an 'e_END_RECORD' header.
+
+            const int length = static_cast<int>(sizeof(RingRecordHeader));
+
+            void *buffer = d_recordRing_mp->reserve(length);
+            createRingRecordHeader(buffer,
+                                   e_END_RECORD,
+                                   Context(Transmission::e_END, 0, 1));
+            d_recordRing_mp->commit(buffer, length);
+
+            int ret = bslmt::ThreadUtil::join(d_threadHandle);
+            d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+            return ret;                                               // RETURN
+        }
+
         // Push an empty record with 'e_END' set in context.
 
         AsyncFileObserver_Record asyncRecord;
@@ -166,7 +421,12 @@ int AsyncFileObserver::shutdownThread()
     // We clear the queue to remove the bogus log record appended by
     // 'stopThread'.
 
-    d_recordQueue.removeAll();
+    if (d_recordRing_mp) {
+        removeRingRecords();
+    }
+    else {
+        d_recordQueue.removeAll();
+    }
     d_shuttingDownFlag = 0;
     return ret;
 }
@@ -174,6 +434,8 @@ int AsyncFileObserver::shutdownThread()
 void AsyncFileObserver::construct()
 {
     d_threadHandle     = bslmt::ThreadUtil::invalidHandle();
+    d_overflowPolicy   = e_DROP;
+    d_sampleCount      = 0;
     d_shuttingDownFlag = 0;
     d_dropCount        = 0;
 
@@ -193,6 +455,7 @@ void AsyncFileObserver::construct()
 AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 : d_fileObserver(Severity::e_WARN, basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_ringRecord(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -205,6 +468,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_ringRecord(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -218,6 +482,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
+, d_ringRecord(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -232,6 +497,7 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
                                      bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
+, d_ringRecord(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
 , d_droppedRecordWarning(basicAllocator)
@@ -248,6 +514,7 @@ AsyncFileObserver::AsyncFileObserver(
                              bslma::Allocator *basicAllocator)
 : d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
+, d_ringRecord(basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
 , d_droppedRecordWarning(basicAllocator)
@@ -256,9 +523,36 @@ AsyncFileObserver::AsyncFileObserver(
     construct();
 }
 
+AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
+                                     bool              publishInLocalTime,
+                                     OverflowPolicy    overflowPolicy,
+                                     int               recordRingSize,
+                                     bslma::Allocator *basicAllocator)
+: d_fileObserver(stdoutThreshold, publishInLocalTime, basicAllocator)
+, d_recordQueue(1, basicAllocator)
+, d_ringRecord(basicAllocator)
+, d_shuttingDownFlag(0)
+, d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_droppedRecordWarning(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < recordRingSize);
+
+    construct();
+
+    d_overflowPolicy = overflowPolicy;
+    d_recordRing_mp.load(new (*d_allocator_p) AsyncRecordRing(recordRingSize,
+                                                               d_allocator_p),
+                         d_allocator_p);
+}
+
 AsyncFileObserver::~AsyncFileObserver()
 {
     stopPublicationThread();
+
+    if (d_recordRing_mp) {
+        removeRingRecords();
+    }
 }
 
 // MANIPULATORS
@@ -267,6 +561,11 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
 {
     BSLS_ASSERT(record);
 
+    if (d_recordRing_mp) {
+        pushRingRecord(record, context);
+        return;                                                       // RETURN
+    }
+
     AsyncFileObserver_Record asyncRecord;
 
     asyncRecord.d_record  = record;
@@ -289,6 +588,9 @@ void AsyncFileObserver::releaseRecords()
         shutdownThread();
         startThread();
     }
+    else if (d_recordRing_mp) {
+        removeRingRecords();
+    }
     else {
         d_recordQueue.removeAll();
     }
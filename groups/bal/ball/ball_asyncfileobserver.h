@@ -18,7 +18,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  ball::AsyncFileObserver: observer that outputs logs to a file and 'stdout'
 //
-//@SEE_ALSO: ball_record, ball_context, ball_observer, ball_fileobserver
+//@SEE_ALSO: ball_record, ball_context, ball_observer, ball_fileobserver,
+//           ball_asyncrecordring
 //
 //@DESCRIPTION: This component provides a concrete implementation of the
 // 'ball::Observer' protocol, 'ball::AsyncFileObserver', for *asynchronously*
@@ -97,6 +98,9 @@ BSLS_IDENT("$Id: $")
 // | Log Record Queue      | maxRecordQueueSize              |
 // |                       | dropRecordsOnFullQueueThreshold |
 // +-----------------------+---------------------------------+
+// | Log Record Ring       | overflowPolicy                  |
+// |                       | recordRingSize                  |
+// +-----------------------+---------------------------------+
 //
 // +-------------+-----------------------------+------------------------------+
 // | Aspect      | Manipulators                | Accessors                    |
@@ -164,6 +168,41 @@ BSLS_IDENT("$Id: $")
 // record count is reset to 0 after each such warning is published, so each
 // dropped record is counted only once.
 //
+///Log Record Ring
+///---------------
+// An async file observer constructed with an 'OverflowPolicy' (and a
+// 'recordRingSize', in bytes) uses a log record *ring* in place of the log
+// record queue.  Rather than retaining a shared reference to each record
+// received by 'publish' (which keeps the record alive, and its memory
+// unavailable to the logger, until it is published), 'publish' serializes the
+// fixed fields of the record directly into a pre-allocated lock-free ring
+// (see 'ball_asyncrecordring').  Logging threads never allocate memory nor
+// contend on a lock in 'publish', and the publication thread deserializes
+// each record into a single reused 'ball::Record' before formatting it.
+// Records having user fields, records too large to be serialized into the
+// ring, and records whose message formatting is deferred (see the
+// 'BALL_LOGDF' macros in 'ball_log'), are instead held in the ring by shared
+// reference, as they are in the queue; the message of a deferred record is
+// therefore formatted by the publication thread.
+//
+// The handling of records received while the ring is full is determined by
+// the 'OverflowPolicy' supplied at construction:
+//
+//: 'e_DROP':
+//:   The record is dropped.
+//:
+//: 'e_BLOCK':
+//:   'publish' blocks until the ring has room for the record.
+//:
+//: 'e_SAMPLE':
+//:   Once the ring is three-quarters full, only one in every 16 records is
+//:   published; the others are dropped.  Records that do not fit in the ring
+//:   are dropped.
+//
+// Dropped records are counted, and reported, as described in
+// {Log Record Queue}.  Note that the 'dropRecordsOnFullQueueThreshold'
+// constructor argument does not apply to a ring.
+//
 ///Log Record Formatting
 ///---------------------
 // By default, the output format of published log records (whether to 'stdout'
@@ -465,6 +504,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <ball_context.h>
+#include <ball_asyncrecordring.h>
 #include <ball_fileobserver.h>
 #include <ball_fileobserver2.h>
 #include <ball_observer.h>
@@ -477,6 +517,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_datetimeinterval.h>
 
 #include <bslma_allocator.h>
+#include <bslma_managedptr.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
 
@@ -515,6 +556,31 @@ class AsyncFileObserver : public Observer {
     // can operate on an object concurrently.  This class is exception-neutral
     // with no guarantee of rollback.  In no event is memory leaked.
 
+  public:
+    // TYPES
+    typedef FileObserver::OnFileRotationCallback OnFileRotationCallback;
+        // 'OnFileRotationCallback' is an alias for a user-supplied callback
+        // function that is invoked after the file observer attempts to rotate
+        // its log file.  The callback takes two arguments: (1) an integer
+        // status value where 0 indicates a new log file was successfully
+        // created and a non-zero value indicates an error occurred during
+        // rotation, and (2) a string that provides the name of the rotated log
+        // file if the rotation was successful.  E.g.:
+        //..
+        //  void onLogFileRotation(int                rotationStatus,
+        //                         const bsl::string& rotatedLogFileName);
+        //..
+
+    enum OverflowPolicy {
+        // Enumerate the ways in which 'publish' handles records received
+        // while the log record ring is full (see {Log Record Ring}).
+
+        e_DROP,    // drop the record
+        e_BLOCK,   // block until the ring has room for the record
+        e_SAMPLE   // publish one in 16 records once the ring is 3/4 full
+    };
+
+  private:
     // DATA
     FileObserver                   d_fileObserver;   // forward most public
                                                      // method calls to this
@@ -529,6 +595,28 @@ class AsyncFileObserver : public Observer {
                                                      // records processed by
                                                      // the publication thread
 
+    bslma::ManagedPtr<AsyncRecordRing>
+                                   d_recordRing_mp;  // ring of serialized
+                                                     // records processed by
+                                                     // the publication thread,
+                                                     // used in place of
+                                                     // 'd_recordQueue' if
+                                                     // non-null
+
+    OverflowPolicy                 d_overflowPolicy; // handling of records
+                                                     // received while
+                                                     // 'd_recordRing_mp' is
+                                                     // full
+
+    bsls::AtomicUint               d_sampleCount;    // count of records
+                                                     // received while sampling
+                                                     // under 'e_SAMPLE'
+
+    Record                         d_ringRecord;     // record into which the
+                                                     // publication thread
+                                                     // deserializes records
+                                                     // from 'd_recordRing_mp'
+
     bsls::AtomicInt                d_shuttingDownFlag;
                                                      // flag that indicates the
                                                      // publication thread is
@@ -560,7 +648,6 @@ class AsyncFileObserver : public Observer {
     bslma::Allocator              *d_allocator_p;    // memory allocator (held,
                                                      // not owned)
 
-  private:
     // NOT IMPLEMENTED
     AsyncFileObserver(const AsyncFileObserver&);
     AsyncFileObserver& operator=(const AsyncFileObserver&);
@@ -578,6 +665,12 @@ class AsyncFileObserver : public Observer {
         // is undefined if this method is invoked concurrently from multiple
         // threads, i.e., it is *not* thread-safe.
 
+    void publishRingRecords();
+        // Publish records from the record ring, to the log file and 'stdout',
+        // until signaled to stop.  The behavior is undefined unless this
+        // method is invoked from the publication thread, and the record ring
+        // is in use.
+
     void publishThreadEntryPoint();
         // Publish records from the record queue, to the log file and 'stdout',
         // until signaled to stop.  The behavior is undefined if this method is
@@ -585,6 +678,26 @@ class AsyncFileObserver : public Observer {
         // thread-safe.  Note that this function is the entry point for the
         // publication thread.
 
+    void pushRingRecord(const bsl::shared_ptr<const Record>& record,
+                        const Context&                       context);
+        // Append the specified 'record' having the specified 'context' to the
+        // record ring according to the overflow policy of this observer.  The
+        // behavior is undefined unless the record ring is in use.
+
+    void removeRingRecords();
+        // Discard all records on the record ring, releasing any shared
+        // references to records held by the ring.  The behavior is undefined
+        // unless the record ring is in use, and the publication thread is not
+        // running.
+
+    void reportDroppedRecords(bool hasSpareCapacity);
+        // Publish a warning of the number of records dropped since the last
+        // such warning, if any records have been dropped and either the
+        // specified 'hasSpareCapacity' is 'true', a sufficient number of
+        // records have been dropped, or this observer is shutting down.  The
+        // behavior is undefined unless this method is invoked from the
+        // publication thread.
+
     int shutdownThread();
         // Stop the publication thread and discard all currently queued log
         // records.  Return 0 on success, and a non-zero value if there is an
@@ -607,20 +720,6 @@ class AsyncFileObserver : public Observer {
         // thread holds a lock on 'd_mutex'.
 
   public:
-    // TYPES
-    typedef FileObserver::OnFileRotationCallback OnFileRotationCallback;
-        // 'OnFileRotationCallback' is an alias for a user-supplied callback
-        // function that is invoked after the file observer attempts to rotate
-        // its log file.  The callback takes two arguments: (1) an integer
-        // status value where 0 indicates a new log file was successfully
-        // created and a non-zero value indicates an error occurred during
-        // rotation, and (2) a string that provides the name of the rotated log
-        // file if the rotation was successful.  E.g.:
-        //..
-        //  void onLogFileRotation(int                rotationStatus,
-        //                         const bsl::string& rotatedLogFileName);
-        //..
-
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(AsyncFileObserver,
                                    bslma::UsesBslmaAllocator);
@@ -695,6 +794,28 @@ class AsyncFileObserver : public Observer {
         // used.  Note that independent default record formats are in effect
         // for 'stdout' and file logging (see 'setLogFormat').
 
+    AsyncFileObserver(Severity::Level   stdoutThreshold,
+                      bool              publishInLocalTime,
+                      OverflowPolicy    overflowPolicy,
+                      int               recordRingSize,
+                      bslma::Allocator *basicAllocator = 0);
+        // Create an async file observer that asynchronously publishes log
+        // records to 'stdout' if their severity is at least as severe as the
+        // specified 'stdoutThreshold' level, and has file logging initially
+        // disabled.  The timestamp attribute of published records is written
+        // in local time if the specified 'publishInLocalTime' flag is 'true',
+        // and in UTC time otherwise.  Records received by the 'publish' method
+        // are serialized into a lock-free ring having a capacity of (at least)
+        // the specified 'recordRingSize' bytes, and published later by an
+        // independent publication thread.  Records received while the ring is
+        // full are handled according to the specified 'overflowPolicy'.  (See
+        // {Log Record Ring} for further information.)  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < recordRingSize <= 1 << 30'.  Note that
+        // independent default record formats are in effect for 'stdout' and
+        // file logging (see 'setLogFormat').
+
     ~AsyncFileObserver();
         // Publish all records that were on the record queue upon entry if a
         // publication thread is running, stop the publication thread (if any),
@@ -811,7 +932,11 @@ class AsyncFileObserver : public Observer {
         // 'Severity::Level' at construction, 'record' and 'context' are
         // discarded only if the severity of 'record' is below that threshold,
         // otherwise, this method will block waiting until space is available
-        // on the queue.  See {Log Record Queue} for further information.
+        // on the queue.  See {Log Record Queue} for further information.  If
+        // this observer was constructed with an 'OverflowPolicy', 'record' and
+        // 'context' are instead serialized into the record ring, and handled
+        // according to that policy if the ring is full (see
+        // {Log Record Ring}).
 
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
@@ -956,8 +1081,8 @@ class AsyncFileObserver : public Observer {
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
     int recordQueueLength() const;
-        // Return the number of log records currently on the record queue of
-        // this async file observer.
+        // Return the number of log records currently on the record queue (or
+        // the record ring) of this async file observer.
 
     bdlt::DatetimeInterval rotationLifetime() const;
         // Return the log file lifetime that will trigger a file rotation by
@@ -1135,7 +1260,8 @@ bdlt::DatetimeInterval AsyncFileObserver::localTimeOffset() const
 inline
 int AsyncFileObserver::recordQueueLength() const
 {
-    return d_recordQueue.length();
+    return d_recordRing_mp ? d_recordRing_mp->numMessages()
+                           : d_recordQueue.length();
 }
 
 inline
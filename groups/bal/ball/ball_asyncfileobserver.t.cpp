@@ -39,6 +39,7 @@
 #include <bsl_iomanip.h>     // 'setfill'
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>    // 'unsetenv'
 
@@ -84,6 +85,7 @@ using bsl::flush;
 // [ X] AsyncFileObserver(ball::Severity::Level, bool, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity::Level, bool, int, bslma::Allocator *);
 // [ 5] AsyncFileObserver(Severity, bool, int, Severity, Allocator *);
+// [12] AsyncFileObserver(Severity, bool, OverflowPolicy, int, Allocator *);
 // [ 2] ~AsyncFileObserver();
 //
 // MANIPULATORS
@@ -128,7 +130,8 @@ using bsl::flush;
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [12] USAGE EXAMPLE
+// [12] CONCERN: LOG RECORD RING
+// [13] USAGE EXAMPLE
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -623,7 +626,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -775,6 +778,298 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CONCERN: LOG RECORD RING
+        //
+        // Concerns:
+        //:  1 An observer constructed with an 'OverflowPolicy' publishes the
+        //:    records it receives, with all of their fixed fields, in order.
+        //:
+        //:  2 Records having user fields, and records too large to be
+        //:    serialized into the ring, are published intact.
+        //:
+        //:  3 Publishing records not having user fields allocates no memory.
+        //:
+        //:  4 Under 'e_DROP', records received while the ring is full are
+        //:    dropped, and the number of dropped records is reported.
+        //:
+        //:  5 Under 'e_BLOCK', no records are dropped.
+        //:
+        //:  6 Under 'e_SAMPLE', only some records are accepted once the ring
+        //:    is three-quarters full.
+        //:
+        //:  7 'releaseRecords', 'shutdownPublicationThread', and the
+        //:    destructor release the shared references held by the ring.
+        //
+        // Plan:
+        //:  1 Publish records having distinct fixed fields, including a record
+        //:    having user fields and a record with a long message, to a
+        //:    ring-based observer, and verify the contents of the log file.
+        //:    Verify, using a test allocator, that publishing the serialized
+        //:    records does not allocate.  (C-1..3)
+        //:
+        //:  2 Without a running publication thread, publish more records than
+        //:    fit in the ring under 'e_DROP', then start and stop the
+        //:    publication thread and verify the number of logged records and
+        //:    the reported number of dropped records.  (C-4)
+        //:
+        //:  3 Publish many records to a small ring under 'e_BLOCK' with a
+        //:    running publication thread, and verify that all are logged.
+        //:    (C-5)
+        //:
+        //:  4 Publish the number of records that fill the ring under
+        //:    'e_DROP' to an observer under 'e_SAMPLE', and verify that fewer
+        //:    records, but more than three-quarters as many, are accepted.
+        //:    (C-6)
+        //:
+        //:  5 Publish a record having user fields, and verify its use count
+        //:    after calling 'releaseRecords', 'shutdownPublicationThread', and
+        //:    destroying the observer.  (C-7)
+        //
+        // Testing:
+        //   AsyncFileObserver(Severity, bool, OverflowPolicy, int, Alloc *);
+        //   CONCERN: LOG RECORD RING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: LOG RECORD RING"
+                          << "\n========================" << endl;
+
+        const ball::Context CONTEXT(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (veryVerbose) cout << "\tPublishing record fields." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF, false, Obj::e_BLOCK, 1024, &ta);
+
+            mX.setLogFormat("%s %f:%l %c %m %u\n", "%s %f:%l %c %m %u\n");
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            enum { NUM_RECORDS = 10 };
+
+            bsl::vector<bsl::shared_ptr<ball::Record> > records;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                bsl::shared_ptr<ball::Record> record;
+                record.createInplace(&ta, &ta);
+
+                bsl::ostringstream message;
+                message << "message " << i;
+
+                record->fixedFields().setSeverity(i % 2
+                                                  ? ball::Severity::e_ERROR
+                                                  : ball::Severity::e_INFO);
+                record->fixedFields().setFileName(i % 3 ? "a.cpp" : "bb.h");
+                record->fixedFields().setLineNumber(100 + i);
+                record->fixedFields().setCategory(i % 4 ? "CAT" : "");
+                record->fixedFields().setMessage(message.str().c_str());
+                records.push_back(record);
+            }
+
+            // A record having user fields, and a record whose message is too
+            // large for the ring.
+
+            records[3]->customFields().appendString("user3");
+            records[7]->fixedFields().setMessage(
+                                         bsl::string(2000, 'x').c_str());
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                if (3 == i) {
+                    continue;
+                }
+                mX.publish(records[i], CONTEXT);
+            }
+            ASSERTV(NUM_ALLOCATIONS, ta.numAllocations(),
+                    NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERT(NUM_RECORDS - 1 == mX.recordQueueLength());
+
+            mX.publish(records[3], CONTEXT);
+            ASSERT(NUM_RECORDS == mX.recordQueueLength());
+
+            // Serialized records are not retained; the shared records are.
+
+            ASSERT(1 == records[0].use_count());
+            ASSERT(2 == records[3].use_count());
+            ASSERT(2 == records[7].use_count());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(0 == mX.recordQueueLength());
+            ASSERT(1 == records[3].use_count());
+            ASSERT(1 == records[7].use_count());
+
+            mX.disableFileLogging();
+
+            bsl::ostringstream expected;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                if (3 == i) {
+                    continue;
+                }
+                expected << (i % 2 ? "ERROR" : "INFO") << ' '
+                         << (i % 3 ? "a.cpp" : "bb.h") << ':' << 100 + i
+                         << ' ' << (i % 4 ? "CAT" : "") << ' '
+                         << records[i]->fixedFields().message() << ' '
+                         << '\n';
+            }
+            expected << "ERROR bb.h:103 CAT message 3 user3\n";
+
+            const bsl::string actual = readPartialFile(fileName, 0);
+            ASSERTV(expected.str(), actual, expected.str() == actual);
+        }
+
+        if (veryVerbose) cout << "\tDropping records." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF, false, Obj::e_DROP, 4096, &ta);
+
+            mX.setLogFormat("%m\n", "%m\n");
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ball::Severity::e_TRACE);
+            record->fixedFields().setMessage("message");
+
+            enum { NUM_RECORDS = 1000 };
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.publish(record, CONTEXT);
+            }
+            const int NUM_QUEUED = mX.recordQueueLength();
+            ASSERTV(NUM_QUEUED, 0 < NUM_QUEUED && NUM_QUEUED < NUM_RECORDS);
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            // The warning is published once the ring is half empty.
+
+            bsl::ostringstream warning;
+            warning << "\nDropped " << NUM_RECORDS - NUM_QUEUED
+                    << " log records.\n";
+
+            const bsl::string actual = readPartialFile(fileName, 0);
+            ASSERTV(actual, bsl::string::npos != actual.find(warning.str()));
+
+            int                    numLines = 0;
+            bsl::string::size_type pos      = 0;
+            while (bsl::string::npos != (pos = actual.find('\n', pos))) {
+                ++numLines;
+                ++pos;
+            }
+            ASSERTV(NUM_QUEUED, numLines, NUM_QUEUED + 1 == numLines);
+        }
+
+        if (veryVerbose) cout << "\tBlocking." << endl;
+        {
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF, false, Obj::e_BLOCK, 256, &ta);
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.startPublicationThread());
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ball::Severity::e_TRACE);
+            record->fixedFields().setMessage("message");
+
+            enum { NUM_RECORDS = 1000 };
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.publish(record, CONTEXT);
+            }
+
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            ASSERTV(countLoggedRecords(fileName),
+                    NUM_RECORDS == countLoggedRecords(fileName));
+        }
+
+        if (veryVerbose) cout << "\tSampling." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ball::Severity::e_TRACE);
+            record->fixedFields().setMessage("message");
+
+            Obj mD(ball::Severity::e_OFF, false, Obj::e_DROP,   4096, &ta);
+            Obj mS(ball::Severity::e_OFF, false, Obj::e_SAMPLE, 4096, &ta);
+
+            for (int i = 0; i < 1000; ++i) {
+                mD.publish(record, CONTEXT);
+            }
+            const int NUM_FULL = mD.recordQueueLength();
+
+            for (int i = 0; i < NUM_FULL; ++i) {
+                mS.publish(record, CONTEXT);
+            }
+            ASSERTV(NUM_FULL, mS.recordQueueLength(),
+                    mS.recordQueueLength() < NUM_FULL);
+            ASSERTV(NUM_FULL, mS.recordQueueLength(),
+                    mS.recordQueueLength() >= NUM_FULL * 3 / 4);
+
+            // Sampled records continue to be accepted until the ring is full.
+
+            for (int i = 0; i < NUM_FULL * 16; ++i) {
+                mS.publish(record, CONTEXT);
+            }
+            ASSERTV(NUM_FULL, mS.recordQueueLength(),
+                    NUM_FULL == mS.recordQueueLength());
+        }
+
+        if (veryVerbose) cout << "\tReleasing shared records." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace(&ta, &ta);
+            record->fixedFields().setSeverity(ball::Severity::e_TRACE);
+            record->customFields().appendInt64(1);
+
+            {
+                Obj mX(ball::Severity::e_OFF, false, Obj::e_DROP, 1024, &ta);
+
+                mX.publish(record, CONTEXT);
+                mX.publish(record, CONTEXT);
+                ASSERT(3 == record.use_count());
+
+                mX.releaseRecords();
+                ASSERT(1 == record.use_count());
+                ASSERT(0 == mX.recordQueueLength());
+
+                mX.publish(record, CONTEXT);
+                ASSERT(0 == mX.startPublicationThread());
+                ASSERT(0 == mX.shutdownPublicationThread());
+                ASSERT(1 == record.use_count());
+
+                mX.publish(record, CONTEXT);
+                ASSERT(2 == record.use_count());
+            }
+            ASSERT(1 == record.use_count());
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'recordQueueLength'
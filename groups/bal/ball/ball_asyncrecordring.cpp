@@ -0,0 +1,305 @@
+// ball_asyncrecordring.cpp                                           -*-C++-*-
+#include <ball_asyncrecordring.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_asyncrecordring_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The ring is addressed by two monotonically increasing 64-bit positions;
+// the offset of a position within 'd_buffer_p' is the position modulo the
+// (power of two) capacity.  Every message is preceded by an 8-byte header
+// holding the message length and flags.  A header of 0 indicates a message
+// that has been reserved, but not committed.  Producers reserve space by
+// advancing 'd_writePosition' with a compare-and-swap, after verifying that
+// the reservation would not overtake 'd_readPosition'.  If a message would
+// straddle the end of the buffer, the producer reserves the remaining space as
+// well, and immediately marks it as skipped (using 'k_PADDING_FLAG').
+//
+// Since any 8-byte aligned offset may later hold a header, the consumer zeroes
+// the entire slot of a consumed message before advancing 'd_readPosition'.
+// This guarantees that producers always reserve zeroed memory, so that the
+// consumer can rely on a zero header to identify uncommitted messages.
+//
+// The wake-up protocol for waiting threads follows 'bdlcc::FixedQueue': a
+// thread increments the count of waiting threads, re-checks the condition it
+// is waiting for with a sequentially consistent load, and only then waits on
+// the semaphore; the thread changing the condition does so with a
+// sequentially consistent store before checking the count of waiting threads.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+enum {
+    k_MIN_CAPACITY = 256,  // minimum capacity of a ring
+
+    k_SPIN_COUNT   = 64    // number of times 'front' polls for a message
+                           // before waiting on a semaphore
+};
+
+}  // close unnamed namespace
+
+                           // ---------------------
+                           // class AsyncRecordRing
+                           // ---------------------
+
+// PRIVATE ACCESSORS
+bool AsyncRecordRing::hasSpace(int length) const
+{
+    const bsls::Types::Int64 size     = slotSize(length);
+    const bsls::Types::Int64 position = d_writePosition.load();
+
+    return position + skipSize(position, size) + size - d_readPosition.load()
+                                                                <= d_capacity;
+}
+
+// CREATORS
+AsyncRecordRing::AsyncRecordRing(int               capacity,
+                                 bslma::Allocator *basicAllocator)
+: d_buffer_p(0)
+, d_capacity(k_MIN_CAPACITY)
+, d_bufferPad()
+, d_writePosition(0)
+, d_writePositionPad()
+, d_readPosition(0)
+, d_numMessages(0)
+, d_numWaitingPoppers(0)
+, d_wakeConsumerFlag(0)
+, d_popControlSema()
+, d_popControlSemaPad()
+, d_numWaitingPushers(0)
+, d_pushControlSema()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(capacity <= (1 << 30));
+
+    while (d_capacity < capacity) {
+        d_capacity <<= 1;
+    }
+
+    d_buffer_p = static_cast<char *>(
+                     d_allocator_p->allocate(static_cast<int>(d_capacity)));
+    bsl::memset(d_buffer_p, 0, static_cast<bsl::size_t>(d_capacity));
+}
+
+AsyncRecordRing::~AsyncRecordRing()
+{
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+// MANIPULATORS
+void *AsyncRecordRing::reserve(int length)
+{
+    BSLS_ASSERT(0 <= length);
+
+    if (length > maxMessageLength()) {
+        return 0;                                                     // RETURN
+    }
+
+    void *buffer;
+    while (0 == (buffer = tryReserve(length))) {
+        d_numWaitingPushers.add(1);
+
+        // SYNCHRONIZATION POINT 2-Prime
+        //
+        // The sequentially consistent increment above, and the load of
+        // 'd_readPosition' below, pair with SYNCHRONIZATION POINT 2 in
+        // 'popFront'.
+
+        if (!hasSpace(length)) {
+            d_pushControlSema.wait();
+        }
+
+        d_numWaitingPushers.add(-1);
+    }
+    return buffer;
+}
+
+void *AsyncRecordRing::tryReserve(int length)
+{
+    BSLS_ASSERT(0 <= length);
+
+    if (length > maxMessageLength()) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Int64 size = slotSize(length);
+
+    bsls::Types::Int64 position = d_writePosition.loadRelaxed();
+    for (;;) {
+        const bsls::Types::Int64 skip = skipSize(position, size);
+        const bsls::Types::Int64 next = position + skip + size;
+
+        if (next - d_readPosition.load() > d_capacity) {
+            return 0;                                                 // RETURN
+        }
+
+        const bsls::Types::Int64 prev = d_writePosition.testAndSwap(position,
+                                                                    next);
+        if (prev == position) {
+            if (skip) {
+                AtomicOp::setInt64Release(
+                         headerAt(position),
+                         ((skip - k_HEADER_SIZE) << k_LENGTH_SHIFT)
+                                         | k_COMMITTED_FLAG | k_PADDING_FLAG);
+            }
+            return reinterpret_cast<char *>(headerAt(position + skip))
+                                                            + k_HEADER_SIZE;
+                                                                  // RETURN
+        }
+        position = prev;
+    }
+}
+
+const void *AsyncRecordRing::front(int *length)
+{
+    BSLS_ASSERT(length);
+
+    for (int i = 0; i < k_SPIN_COUNT; ++i) {
+        const void *message = tryFront(length);
+        if (message) {
+            return message;                                           // RETURN
+        }
+        bslmt::ThreadUtil::yield();
+    }
+
+    for (;;) {
+        const void *message = tryFront(length);
+        if (message) {
+            return message;                                           // RETURN
+        }
+        if (d_wakeConsumerFlag.swap(0)) {
+            return 0;                                                 // RETURN
+        }
+
+        d_numWaitingPoppers.add(1);
+
+        // SYNCHRONIZATION POINT 1-Prime
+        //
+        // The sequentially consistent increment above, and the load of the
+        // header in 'tryFront' below, pair with SYNCHRONIZATION POINT 1 in
+        // 'commit'.
+
+        message = tryFront(length);
+        if (0 == message && 0 == d_wakeConsumerFlag.load()) {
+            d_popControlSema.wait();
+        }
+
+        d_numWaitingPoppers.add(-1);
+
+        if (message) {
+            return message;                                           // RETURN
+        }
+    }
+}
+
+void AsyncRecordRing::popFront()
+{
+    const bsls::Types::Int64 position = d_readPosition.loadRelaxed();
+
+    AtomicOp::AtomicTypes::Int64 *header = headerAt(position);
+    const bsls::Types::Int64      value  = AtomicOp::getInt64Relaxed(header);
+
+    BSLS_ASSERT(value & k_COMMITTED_FLAG);
+    BSLS_ASSERT(!(value & k_PADDING_FLAG));
+
+    const int length = static_cast<int>(value >> k_LENGTH_SHIFT);
+    const int size   = slotSize(length);
+
+    bsl::memset(header, 0, size);
+    d_numMessages.addRelaxed(-1);
+
+    // SYNCHRONIZATION POINT 2
+    //
+    // The read position is stored with full sequential consistency, so that
+    // the following load of 'd_numWaitingPushers' is ordered after it,
+    // pairing with SYNCHRONIZATION POINT 2-Prime in 'reserve'.
+
+    d_readPosition.store(position + size);
+
+    if (0 < d_numWaitingPushers.load()) {
+        d_pushControlSema.post();
+    }
+}
+
+int AsyncRecordRing::removeAll()
+{
+    int numRemoved = 0;
+    int length;
+    while (tryFront(&length)) {
+        popFront();
+        ++numRemoved;
+    }
+    return numRemoved;
+}
+
+const void *AsyncRecordRing::tryFront(int *length)
+{
+    BSLS_ASSERT(length);
+
+    for (;;) {
+        const bsls::Types::Int64 position = d_readPosition.loadRelaxed();
+
+        AtomicOp::AtomicTypes::Int64 *header = headerAt(position);
+        const bsls::Types::Int64      value  = AtomicOp::getInt64(header);
+
+        if (0 == (value & k_COMMITTED_FLAG)) {
+            return 0;                                                 // RETURN
+        }
+
+        const int messageLength = static_cast<int>(value >> k_LENGTH_SHIFT);
+
+        if (0 == (value & k_PADDING_FLAG)) {
+            *length = messageLength;
+            return reinterpret_cast<char *>(header) + k_HEADER_SIZE;
+                                                                  // RETURN
+        }
+
+        // Skip the unused space at the end of the buffer.
+
+        const int size = slotSize(messageLength);
+
+        bsl::memset(header, 0, size);
+        d_readPosition.store(position + size);
+
+        if (0 < d_numWaitingPushers.load()) {
+            d_pushControlSema.post();
+        }
+    }
+}
+
+void AsyncRecordRing::wakeConsumer()
+{
+    d_wakeConsumerFlag.store(1);
+    d_popControlSema.post();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,435 @@
+// ball_asyncrecordring.h                                             -*-C++-*-
+#ifndef INCLUDED_BALL_ASYNCRECORDRING
+#define INCLUDED_BALL_ASYNCRECORDRING
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free multi-producer ring of serialized records.
+//
+//@CLASSES:
+//  ball::AsyncRecordRing: bounded MPSC ring of variable-length messages
+//
+//@SEE_ALSO: ball_asyncfileobserver
+//
+//@DESCRIPTION: This component provides a mechanism, 'ball::AsyncRecordRing',
+// that is a bounded, lock-free, multi-producer single-consumer (MPSC) ring of
+// variable-length byte messages, intended for passing serialized log records
+// from logging threads to a single publication thread (see
+// 'ball_asyncfileobserver').  The memory of the ring is allocated on
+// construction; thereafter, neither producers nor the consumer allocate
+// memory.
+//
+// A producer publishes a message in two steps: it calls 'tryReserve' (or
+// 'reserve') to obtain a suitably aligned buffer within the ring, writes the
+// message directly into that buffer, and then calls 'commit' to make the
+// message visible to the consumer.  Reservation is a single compare-and-swap
+// on the write position of the ring, so producers never wait on one another,
+// and a message is written only once (there is no intermediate copy).
+//
+// The consumer obtains the oldest committed message by calling 'tryFront' (or
+// 'front', which waits for a message), processes it in place, and then calls
+// 'popFront' to return the space it occupies to the ring.  Messages are
+// consumed in the order in which they were *reserved*; a message that has been
+// reserved but not yet committed prevents the consumer from observing any
+// later message until it is committed.
+//
+///Capacity
+///--------
+// The capacity of a ring, in bytes, is a power of two chosen on construction.
+// Each message occupies its length, rounded up to a multiple of 8, plus an
+// 8-byte header.  A message is never split across the end of the ring; when a
+// message would not fit before the end, the remaining space is skipped, so
+// the number of messages that fit in a ring depends on their lengths and
+// order.  The length of a message may not exceed 'maxMessageLength', which is
+// chosen so that an empty ring can always accommodate any single message.
+//
+///Waiting
+///-------
+// 'tryReserve' and 'tryFront' never block.  'reserve' blocks the calling
+// producer until the ring has space for the message, and 'front' blocks the
+// consumer until a message has been committed.  Waiting threads block on
+// semaphores; a producer or consumer posts to the semaphore of the other side
+// only if a thread is waiting, so that, in the absence of waiting threads,
+// neither 'commit' nor 'popFront' invokes the operating system.  'front' spins
+// briefly before blocking, so that a consumer keeping up with its producers
+// rarely needs to be woken.
+//
+///Thread Safety
+///-------------
+// 'ball::AsyncRecordRing' is *thread-safe* for any number of producers (i.e.,
+// threads calling 'tryReserve', 'reserve', and 'commit') and a *single*
+// consumer (i.e., a thread calling 'tryFront', 'front', 'popFront',
+// 'removeAll', and 'wakeConsumer').  Accessors may be called from any thread,
+// but their results are, in general, only a snapshot of a changing value.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Strings Between Threads
+///- - - - - - - - - - - - - - - - - - - - -
+// In the following example a producer passes a string to a consumer through a
+// 'ball::AsyncRecordRing'.
+//
+// First, we create a ring having a capacity of 4096 bytes:
+//..
+//  ball::AsyncRecordRing ring(4096);
+//  assert(4096 == ring.capacity());
+//  assert(ring.isEmpty());
+//..
+// Then, the producer reserves space for the message, writes the message into
+// the reserved buffer, and commits it:
+//..
+//  const char   *MESSAGE = "Hello, world!";
+//  const int     LENGTH  = static_cast<int>(bsl::strlen(MESSAGE));
+//
+//  void *buffer = ring.tryReserve(LENGTH);
+//  assert(buffer);
+//
+//  bsl::memcpy(buffer, MESSAGE, LENGTH);
+//  ring.commit(buffer, LENGTH);
+//  assert(1 == ring.numMessages());
+//..
+// Finally, the consumer obtains the message, processes it in place, and
+// returns its space to the ring:
+//..
+//  int         length;
+//  const void *message = ring.tryFront(&length);
+//  assert(message);
+//  assert(LENGTH == length);
+//  assert(0 == bsl::memcmp(MESSAGE, message, length));
+//
+//  ring.popFront();
+//  assert(ring.isEmpty());
+//  assert(0 == ring.tryFront(&length));
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_semaphore.h>
+
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                           // =====================
+                           // class AsyncRecordRing
+                           // =====================
+
+class AsyncRecordRing {
+    // This class provides a bounded, lock-free, multi-producer single-consumer
+    // ring of variable-length byte messages.  See the component documentation
+    // for details.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations AtomicOp;
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_HEADER_SIZE      = 8,       // size of a message header
+
+        k_COMMITTED_FLAG   = 1,       // header flag of a committed message
+
+        k_PADDING_FLAG     = 2,       // header flag of skipped space
+
+        k_LENGTH_SHIFT     = 8,       // position of the length in a header
+
+        k_INT64_PADDING    = bslmt::Platform::e_CACHE_LINE_SIZE
+                           - sizeof(bsls::AtomicInt64),
+
+        k_SEMA_PADDING     = bslmt::Platform::e_CACHE_LINE_SIZE
+                           - sizeof(bslmt::Semaphore)
+    };
+
+    // DATA
+    char               *d_buffer_p;          // ring storage (owned)
+
+    bsls::Types::Int64  d_capacity;          // size of 'd_buffer_p' (a
+                                             // power of two)
+
+    const char          d_bufferPad[k_INT64_PADDING];
+                                             // padding to prevent false
+                                             // sharing
+
+    bsls::AtomicInt64   d_writePosition;     // position of the next
+                                             // reservation (monotonic)
+
+    const char          d_writePositionPad[k_INT64_PADDING];
+                                             // padding to prevent false
+                                             // sharing
+
+    bsls::AtomicInt64   d_readPosition;      // position of the oldest
+                                             // message (monotonic)
+
+    bsls::AtomicInt     d_numMessages;       // number of committed,
+                                             // unconsumed messages
+
+    bsls::AtomicInt     d_numWaitingPoppers; // number of consumers waiting
+                                             // on 'd_popControlSema'
+
+    bsls::AtomicInt     d_wakeConsumerFlag;  // 'wakeConsumer' was called
+
+    bslmt::Semaphore    d_popControlSema;    // semaphore on which the
+                                             // consumer waits for a message
+
+    const char          d_popControlSemaPad[k_SEMA_PADDING];
+                                             // padding to prevent false
+                                             // sharing
+
+    bsls::AtomicInt     d_numWaitingPushers; // number of producers waiting
+                                             // on 'd_pushControlSema'
+
+    bslmt::Semaphore    d_pushControlSema;   // semaphore on which producers
+                                             // wait for space
+
+    bslma::Allocator   *d_allocator_p;       // allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static int slotSize(int length);
+        // Return the number of bytes occupied in a ring by a message having
+        // the specified 'length', including its header.
+
+    // PRIVATE MANIPULATORS
+    AtomicOp::AtomicTypes::Int64 *headerAt(bsls::Types::Int64 position);
+        // Return the address of the message header at the specified
+        // 'position' in this ring.
+
+    // PRIVATE ACCESSORS
+    bool hasSpace(int length) const;
+        // Return 'true' if a message having the specified 'length' would fit
+        // in this ring at the current write position, and 'false' otherwise.
+
+    bsls::Types::Int64 skipSize(bsls::Types::Int64 position,
+                                bsls::Types::Int64 size) const;
+        // Return the number of bytes that must be skipped at the end of the
+        // buffer to reserve a slot of the specified 'size' at the specified
+        // 'position', i.e., 0 if the slot fits before the end of the buffer,
+        // and the number of bytes remaining before the end otherwise.
+
+    // NOT IMPLEMENTED
+    AsyncRecordRing(const AsyncRecordRing&);
+    AsyncRecordRing& operator=(const AsyncRecordRing&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncRecordRing, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AsyncRecordRing(int               capacity,
+                             bslma::Allocator *basicAllocator = 0);
+        // Create an empty ring able to hold messages totaling at least the
+        // specified 'capacity' bytes (including per-message overhead).  The
+        // capacity of the ring is 'capacity' rounded up to a power of two,
+        // and is at least 256.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 < capacity <= 1 << 30'.
+
+    ~AsyncRecordRing();
+        // Destroy this ring.  The behavior is undefined if any thread is
+        // waiting in 'reserve' or 'front', or any message is reserved but
+        // not committed.
+
+    // MANIPULATORS
+    void commit(void *buffer, int length);
+        // Make the message of the specified 'length' held in the specified
+        // 'buffer' visible to the consumer, and wake the consumer if it is
+        // waiting in 'front'.  The behavior is undefined unless 'buffer' was
+        // returned by a call to 'tryReserve' or 'reserve' with 'length', and
+        // has not been committed.
+
+    void *reserve(int length);
+        // Return the address of a buffer of the specified 'length' bytes,
+        // aligned to 8 bytes, reserved within this ring for a message,
+        // blocking until sufficient space is available; return 0 if 'length'
+        // exceeds 'maxMessageLength()'.  The message must subsequently be
+        // passed to 'commit'.  The behavior is undefined unless
+        // '0 <= length'.
+
+    void *tryReserve(int length);
+        // Return the address of a buffer of the specified 'length' bytes,
+        // aligned to 8 bytes, reserved within this ring for a message, if
+        // sufficient space is available, and 0 otherwise.  The message must
+        // subsequently be passed to 'commit'.  This method never blocks.  The
+        // behavior is undefined unless '0 <= length'.
+
+                        // Consumer Manipulators
+
+    const void *front(int *length);
+        // Return the address of the oldest message in this ring, and load its
+        // length into the specified 'length', blocking until a message is
+        // committed, or return 0 (without blocking further) if
+        // 'wakeConsumer' is called while waiting.  The message remains in
+        // the ring until 'popFront' is called.  The behavior is undefined
+        // unless this method is called from the consumer thread.
+
+    void popFront();
+        // Remove the oldest message from this ring, returning the space it
+        // occupies to producers, and wake a producer if any is waiting in
+        // 'reserve'.  The behavior is undefined unless a message was returned
+        // by the most recent call to 'front' or 'tryFront', and this method
+        // is called from the consumer thread.
+
+    int removeAll();
+        // Remove all committed messages from this ring, and return the number
+        // of messages removed.  The behavior is undefined unless this method
+        // is called from the consumer thread.  Note that the messages are
+        // removed without being inspected, so this method is not suitable for
+        // messages owning resources.
+
+    const void *tryFront(int *length);
+        // Return the address of the oldest message in this ring, and load its
+        // length into the specified 'length', if the ring has a committed
+        // message, and return 0 otherwise.  The message remains in the ring
+        // until 'popFront' is called.  This method never blocks.  The
+        // behavior is undefined unless this method is called from the
+        // consumer thread.
+
+    void wakeConsumer();
+        // Cause the consumer, if it is waiting in 'front', to return 0.  If
+        // the consumer is not waiting, the next call to 'front' that would
+        // block instead returns 0.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the capacity, in bytes, of this ring.
+
+    bool isEmpty() const;
+        // Return 'true' if this ring has no committed or reserved messages,
+        // and 'false' otherwise.
+
+    int maxMessageLength() const;
+        // Return the maximum length of a message that can be reserved in this
+        // ring.
+
+    int numMessages() const;
+        // Return the number of committed messages in this ring.
+
+    int usedBytes() const;
+        // Return the number of bytes of this ring that are occupied by
+        // committed or reserved messages (including their headers and any
+        // space skipped at the end of the ring).
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class AsyncRecordRing
+                           // ---------------------
+
+// PRIVATE CLASS METHODS
+inline
+int AsyncRecordRing::slotSize(int length)
+{
+    return k_HEADER_SIZE + ((length + 7) & ~7);
+}
+
+// PRIVATE MANIPULATORS
+inline
+bsls::AtomicOperations::AtomicTypes::Int64 *
+AsyncRecordRing::headerAt(bsls::Types::Int64 position)
+{
+    return reinterpret_cast<AtomicOp::AtomicTypes::Int64 *>(
+                                  d_buffer_p + (position & (d_capacity - 1)));
+}
+
+// PRIVATE ACCESSORS
+inline
+bsls::Types::Int64 AsyncRecordRing::skipSize(bsls::Types::Int64 position,
+                                             bsls::Types::Int64 size) const
+{
+    const bsls::Types::Int64 offset = position & (d_capacity - 1);
+
+    return offset + size > d_capacity ? d_capacity - offset : 0;
+}
+
+// MANIPULATORS
+inline
+void AsyncRecordRing::commit(void *buffer, int length)
+{
+    // SYNCHRONIZATION POINT 1
+    //
+    // The header is stored with full sequential consistency, so that the
+    // following load of 'd_numWaitingPoppers' is ordered after it, pairing
+    // with SYNCHRONIZATION POINT 1-Prime in 'front'.
+
+    AtomicOp::setInt64(
+               reinterpret_cast<AtomicOp::AtomicTypes::Int64 *>(
+                               static_cast<char *>(buffer) - k_HEADER_SIZE),
+               (static_cast<bsls::Types::Int64>(length) << k_LENGTH_SHIFT)
+                                                         | k_COMMITTED_FLAG);
+    d_numMessages.addRelaxed(1);
+
+    if (0 < d_numWaitingPoppers.load()) {
+        d_popControlSema.post();
+    }
+}
+
+// ACCESSORS
+inline
+int AsyncRecordRing::capacity() const
+{
+    return static_cast<int>(d_capacity);
+}
+
+inline
+bool AsyncRecordRing::isEmpty() const
+{
+    return d_writePosition.load() == d_readPosition.load();
+}
+
+inline
+int AsyncRecordRing::maxMessageLength() const
+{
+    return static_cast<int>(d_capacity / 2) - k_HEADER_SIZE;
+}
+
+inline
+int AsyncRecordRing::numMessages() const
+{
+    return d_numMessages.loadRelaxed();
+}
+
+inline
+int AsyncRecordRing::usedBytes() const
+{
+    // Load the read position first, so that (since neither position ever
+    // decreases) the result is non-negative.
+
+    const bsls::Types::Int64 readPosition = d_readPosition.load();
+
+    return static_cast<int>(d_writePosition.load() - readPosition);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
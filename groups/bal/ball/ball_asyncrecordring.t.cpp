@@ -0,0 +1,1077 @@
+// ball_asyncrecordring.t.cpp                                         -*-C++-*-
+#include <ball_asyncrecordring.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'ball::AsyncRecordRing' is a bounded multi-producer single-consumer ring of
+// variable-length messages.  We first verify the single-threaded behavior of
+// the reservation and consumption methods, including the accounting of used
+// space, the skipping of space at the end of the buffer, and the ordering of
+// messages that are committed out of order.  We then verify that the
+// blocking methods wait (and are woken) as documented, and finally verify,
+// with multiple producers, that every message is delivered intact and in
+// per-producer order.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] AsyncRecordRing(int capacity, bslma::Allocator *basicAllocator = 0);
+// [ 2] ~AsyncRecordRing();
+//
+// MANIPULATORS
+// [ 2] void commit(void *buffer, int length);
+// [ 5] void *reserve(int length);
+// [ 2] void *tryReserve(int length);
+// [ 5] const void *front(int *length);
+// [ 2] void popFront();
+// [ 3] int removeAll();
+// [ 2] const void *tryFront(int *length);
+// [ 5] void wakeConsumer();
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 2] int maxMessageLength() const;
+// [ 2] int numMessages() const;
+// [ 2] int usedBytes() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] WRAPPING AROUND THE END OF THE BUFFER
+// [ 4] OUT-OF-ORDER COMMITS
+// [ 6] CONCURRENCY TEST
+// [ 7] USAGE EXAMPLE
+// [-1] THROUGHPUT BENCHMARK
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::AsyncRecordRing Obj;
+typedef bsls::Types::Int64    Int64;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int slotSize(int length)
+    // Return the number of bytes occupied in a ring by a message having the
+    // specified 'length'.
+{
+    return 8 + ((length + 7) & ~7);
+}
+
+static void fillMessage(char *buffer, int length, int producer, int sequence)
+    // Load into the specified 'buffer' a message of the specified 'length'
+    // identifying the specified 'producer' and 'sequence' number.  The
+    // behavior is undefined unless '8 <= length'.
+{
+    bsl::memcpy(buffer,     &producer, sizeof producer);
+    bsl::memcpy(buffer + 4, &sequence, sizeof sequence);
+    for (int i = 8; i < length; ++i) {
+        buffer[i] = static_cast<char>(producer + sequence + i);
+    }
+}
+
+static bool checkMessage(const void *message,
+                         int         length,
+                         int        *producer,
+                         int        *sequence)
+    // Load into the specified 'producer' and 'sequence' the producer and
+    // sequence number identified by the specified 'message' of the specified
+    // 'length', and return 'true' if the remainder of 'message' has the
+    // contents loaded by 'fillMessage', and 'false' otherwise.
+{
+    const char *buffer = static_cast<const char *>(message);
+
+    bsl::memcpy(producer, buffer,     sizeof *producer);
+    bsl::memcpy(sequence, buffer + 4, sizeof *sequence);
+    for (int i = 8; i < length; ++i) {
+        if (buffer[i] != static_cast<char>(*producer + *sequence + i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+static int messageLength(int sequence)
+    // Return the length of the message having the specified 'sequence'
+    // number, varying between 8 and 100 bytes.
+{
+    return 8 + (sequence * 37) % 93;
+}
+
+static void delayedCommit(Obj *ring, int length)
+    // Sleep briefly, then publish to the specified 'ring' a message of the
+    // specified 'length'.
+{
+    bslmt::ThreadUtil::microSleep(100 * 1000);
+
+    void *buffer = ring->tryReserve(length);
+    BSLS_ASSERT_OPT(buffer);
+    fillMessage(static_cast<char *>(buffer), length, 0, 0);
+    ring->commit(buffer, length);
+}
+
+static void delayedPopFront(Obj *ring)
+    // Sleep briefly, then remove the oldest message from the specified
+    // 'ring'.
+{
+    bslmt::ThreadUtil::microSleep(100 * 1000);
+
+    int length;
+    BSLS_ASSERT_OPT(ring->tryFront(&length));
+    ring->popFront();
+}
+
+static void delayedWakeConsumer(Obj *ring)
+    // Sleep briefly, then call 'wakeConsumer' on the specified 'ring'.
+{
+    bslmt::ThreadUtil::microSleep(100 * 1000);
+
+    ring->wakeConsumer();
+}
+
+extern "C" {
+
+struct ProducerArgs {
+    Obj            *d_ring_p;
+    bslmt::Barrier *d_barrier_p;
+    int             d_producer;
+    int             d_numMessages;
+    bool            d_blocking;
+};
+
+void *producerThread(void *arg)
+    // Publish the messages described by the specified 'arg', a
+    // 'ProducerArgs', to its ring.
+{
+    ProducerArgs *args = static_cast<ProducerArgs *>(arg);
+
+    args->d_barrier_p->wait();
+
+    for (int i = 0; i < args->d_numMessages; ++i) {
+        const int length = messageLength(i);
+
+        void *buffer;
+        if (args->d_blocking) {
+            buffer = args->d_ring_p->reserve(length);
+        }
+        else {
+            while (0 == (buffer = args->d_ring_p->tryReserve(length))) {
+                bslmt::ThreadUtil::yield();
+            }
+        }
+        fillMessage(static_cast<char *>(buffer), length, args->d_producer, i);
+        args->d_ring_p->commit(buffer, length);
+    }
+    return 0;
+}
+
+}  // close extern "C"
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING USAGE EXAMPLE"
+                          << endl << "=====================" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Strings Between Threads
+///- - - - - - - - - - - - - - - - - - - - -
+// In the following example a producer passes a string to a consumer through a
+// 'ball::AsyncRecordRing'.
+//
+// First, we create a ring having a capacity of 4096 bytes:
+//..
+    ball::AsyncRecordRing ring(4096);
+    ASSERT(4096 == ring.capacity());
+    ASSERT(ring.isEmpty());
+//..
+// Then, the producer reserves space for the message, writes the message into
+// the reserved buffer, and commits it:
+//..
+    const char   *MESSAGE = "Hello, world!";
+    const int     LENGTH  = static_cast<int>(bsl::strlen(MESSAGE));
+
+    void *buffer = ring.tryReserve(LENGTH);
+    ASSERT(buffer);
+
+    bsl::memcpy(buffer, MESSAGE, LENGTH);
+    ring.commit(buffer, LENGTH);
+    ASSERT(1 == ring.numMessages());
+//..
+// Finally, the consumer obtains the message, processes it in place, and
+// returns its space to the ring:
+//..
+    int         length;
+    const void *message = ring.tryFront(&length);
+    ASSERT(message);
+    ASSERT(LENGTH == length);
+    ASSERT(0 == bsl::memcmp(MESSAGE, message, length));
+
+    ring.popFront();
+    ASSERT(ring.isEmpty());
+    ASSERT(0 == ring.tryFront(&length));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Every message published concurrently by multiple producers is
+        //:   delivered to the consumer exactly once, with its contents
+        //:   intact.
+        //:
+        //: 2 The messages of each producer are delivered in the order in
+        //:   which they were published.
+        //:
+        //: 3 Producers using 'reserve' are woken as space becomes available.
+        //
+        // Plan:
+        //: 1 For both 'reserve' and 'tryReserve', start a number of producer
+        //:   threads each publishing a sequence of messages of varying length
+        //:   to a small ring, and consume the messages using 'front' on the
+        //:   main thread, verifying the contents and per-producer sequence
+        //:   number of each message.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY TEST"
+                          << endl << "================" << endl;
+
+        enum { k_NUM_PRODUCERS = 4, k_NUM_MESSAGES = 20000 };
+
+        for (int blocking = 0; blocking < 2; ++blocking) {
+            if (veryVerbose) { T_ P(blocking) }
+
+            bslma::TestAllocator ta("object", veryVerbose);
+
+            Obj            mX(1024, &ta);
+            bslmt::Barrier barrier(k_NUM_PRODUCERS + 1);
+
+            ProducerArgs              args[k_NUM_PRODUCERS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_PRODUCERS];
+
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                args[i].d_ring_p      = &mX;
+                args[i].d_barrier_p   = &barrier;
+                args[i].d_producer    = i;
+                args[i].d_numMessages = k_NUM_MESSAGES;
+                args[i].d_blocking    = blocking;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      producerThread,
+                                                      &args[i]));
+            }
+            barrier.wait();
+
+            int next[k_NUM_PRODUCERS] = { 0 };
+            for (int n = 0; n < k_NUM_PRODUCERS * k_NUM_MESSAGES; ++n) {
+                int         length;
+                const void *message = mX.front(&length);
+                ASSERT(message);
+
+                int producer, sequence;
+                ASSERTV(n,
+                        checkMessage(message, length, &producer, &sequence));
+                ASSERTV(producer, 0 <= producer && producer < k_NUM_PRODUCERS);
+                ASSERTV(producer, next[producer], sequence,
+                        next[producer] == sequence);
+                ASSERTV(length, messageLength(sequence) == length);
+
+                next[producer] = sequence + 1;
+                mX.popFront();
+            }
+
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                ASSERTV(i, next[i], k_NUM_MESSAGES == next[i]);
+            }
+            ASSERT(mX.isEmpty());
+            ASSERT(0 == mX.numMessages());
+            ASSERT(1 == ta.numAllocations());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCKING METHODS
+        //
+        // Concerns:
+        //: 1 'front' returns a committed message without blocking.
+        //:
+        //: 2 'front' blocks until a message is committed by another thread.
+        //:
+        //: 3 'front' returns 0 if 'wakeConsumer' is called while it is
+        //:   waiting, or was called before 'front' would block.
+        //:
+        //: 4 'reserve' returns a buffer without blocking if space is
+        //:   available, and blocks until space is made available otherwise.
+        //:
+        //: 5 'reserve' returns 0 for a message longer than
+        //:   'maxMessageLength()'.
+        //
+        // Plan:
+        //: 1 Commit a message and call 'front'.  (C-1)
+        //:
+        //: 2 Call 'front' on an empty ring while another thread commits a
+        //:   message after a delay.  (C-2)
+        //:
+        //: 3 Call 'front' on an empty ring while another thread calls
+        //:   'wakeConsumer' after a delay, and call 'front' after calling
+        //:   'wakeConsumer'.  (C-3)
+        //:
+        //: 4 Fill a ring, and call 'reserve' while another thread consumes a
+        //:   message after a delay.  (C-4)
+        //:
+        //: 5 Call 'reserve' with a length exceeding 'maxMessageLength()'.
+        //:   (C-5)
+        //
+        // Testing:
+        //   void *reserve(int length);
+        //   const void *front(int *length);
+        //   void wakeConsumer();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING BLOCKING METHODS"
+                          << endl << "========================" << endl;
+
+        if (verbose) cout << "\t'front' with a committed message." << endl;
+        {
+            Obj mX(256);
+
+            void *buffer = mX.reserve(16);
+            ASSERT(buffer);
+            fillMessage(static_cast<char *>(buffer), 16, 1, 2);
+            mX.commit(buffer, 16);
+
+            int         length;
+            const void *message = mX.front(&length);
+            ASSERT(message);
+            ASSERT(16 == length);
+
+            int producer, sequence;
+            ASSERT(checkMessage(message, length, &producer, &sequence));
+            ASSERT(1 == producer);
+            ASSERT(2 == sequence);
+            mX.popFront();
+        }
+
+        if (verbose) cout << "\t'front' waiting for a message." << endl;
+        {
+            Obj mX(256);
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                           &handle,
+                           bdlf::BindUtil::bind(&delayedCommit, &mX, 24)));
+
+            int         length;
+            const void *message = mX.front(&length);
+            ASSERT(message);
+            ASSERT(24 == length);
+            mX.popFront();
+
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(mX.isEmpty());
+        }
+
+        if (verbose) cout << "\t'front' woken by 'wakeConsumer'." << endl;
+        {
+            Obj mX(256);
+
+            mX.wakeConsumer();
+
+            int length;
+            ASSERT(0 == mX.front(&length));
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                           &handle,
+                           bdlf::BindUtil::bind(&delayedWakeConsumer, &mX)));
+
+            ASSERT(0 == mX.front(&length));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            // A committed message is returned in preference to waking.
+
+            mX.wakeConsumer();
+            void *buffer = mX.tryReserve(8);
+            mX.commit(buffer, 8);
+            ASSERT(buffer == mX.front(&length));
+            mX.popFront();
+            ASSERT(0 == mX.front(&length));
+        }
+
+        if (verbose) cout << "\t'reserve' waiting for space." << endl;
+        {
+            Obj mX(256);
+
+            // Fill the ring with messages of 56 bytes (64 with the header).
+
+            for (int i = 0; i < 4; ++i) {
+                void *buffer = mX.reserve(56);
+                ASSERT(buffer);
+                mX.commit(buffer, 56);
+            }
+            ASSERT(256 == mX.usedBytes());
+            ASSERT(0   == mX.tryReserve(0));
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                               &handle,
+                               bdlf::BindUtil::bind(&delayedPopFront, &mX)));
+
+            void *buffer = mX.reserve(56);
+            ASSERT(buffer);
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            mX.commit(buffer, 56);
+            ASSERT(4   == mX.numMessages());
+            ASSERT(256 == mX.usedBytes());
+            ASSERT(4   == mX.removeAll());
+        }
+
+        if (verbose) cout << "\t'reserve' of an oversized message." << endl;
+        {
+            Obj mX(256);
+
+            ASSERT(120 == mX.maxMessageLength());
+            ASSERT(0   != mX.tryReserve(120));
+            ASSERT(0   == mX.reserve(121));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // OUT-OF-ORDER COMMITS
+        //
+        // Concerns:
+        //: 1 A message that has been reserved, but not committed, hides any
+        //:   later (committed) messages from the consumer.
+        //:
+        //: 2 Once the earlier message is committed, messages are delivered in
+        //:   the order in which they were reserved.
+        //
+        // Plan:
+        //: 1 Reserve three messages, commit them in reverse order, and verify
+        //:   the messages visible to the consumer after each commit.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   OUT-OF-ORDER COMMITS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "OUT-OF-ORDER COMMITS"
+                          << endl << "====================" << endl;
+
+        Obj mX(256);  const Obj& X = mX;
+
+        void *buffers[3];
+        for (int i = 0; i < 3; ++i) {
+            buffers[i] = mX.tryReserve(16);
+            ASSERT(buffers[i]);
+            fillMessage(static_cast<char *>(buffers[i]), 16, 0, i);
+        }
+        ASSERT(!X.isEmpty());
+        ASSERT(3 * slotSize(16) == X.usedBytes());
+
+        int length;
+
+        mX.commit(buffers[2], 16);
+        ASSERT(1 == X.numMessages());
+        ASSERT(0 == mX.tryFront(&length));
+
+        mX.commit(buffers[1], 16);
+        ASSERT(2 == X.numMessages());
+        ASSERT(0 == mX.tryFront(&length));
+
+        mX.commit(buffers[0], 16);
+        ASSERT(3 == X.numMessages());
+
+        for (int i = 0; i < 3; ++i) {
+            const void *message = mX.tryFront(&length);
+            ASSERTV(i, buffers[i] == message);
+
+            int producer, sequence;
+            ASSERTV(i, checkMessage(message, length, &producer, &sequence));
+            ASSERTV(i, sequence, i == sequence);
+            mX.popFront();
+        }
+        ASSERT(X.isEmpty());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // WRAPPING AROUND THE END OF THE BUFFER
+        //
+        // Concerns:
+        //: 1 A message that would straddle the end of the buffer is placed at
+        //:   the start of the buffer, and the space skipped at the end is
+        //:   accounted for in 'usedBytes'.
+        //:
+        //: 2 The skipped space is transparent to the consumer.
+        //:
+        //: 3 Messages of varying length are delivered intact over many
+        //:   traversals of the buffer.
+        //:
+        //: 4 'removeAll' removes every committed message and returns their
+        //:   number.
+        //
+        // Plan:
+        //: 1 Fill a ring so that the next message does not fit before the
+        //:   end, consume a message at the start of the buffer, and verify the
+        //:   placement of the next message and the used space.  (C-1..2)
+        //:
+        //: 2 Repeatedly publish as many messages of varying length as fit in
+        //:   a ring, then consume and verify them.  (C-3)
+        //:
+        //: 3 Publish messages and call 'removeAll'.  (C-4)
+        //
+        // Testing:
+        //   int removeAll();
+        //   WRAPPING AROUND THE END OF THE BUFFER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "WRAPPING AROUND THE END OF THE BUFFER"
+                          << endl << "====================================="
+                          << endl;
+
+        if (verbose) cout << "\tSkipping space at the end." << endl;
+        {
+            Obj mX(256);  const Obj& X = mX;
+
+            // Occupy [0, 80), [80, 160), and [160, 240).
+
+            void *buffers[3];
+            for (int i = 0; i < 3; ++i) {
+                buffers[i] = mX.tryReserve(72);
+                ASSERT(buffers[i]);
+                fillMessage(static_cast<char *>(buffers[i]), 72, 0, i);
+                mX.commit(buffers[i], 72);
+            }
+            ASSERT(240 == X.usedBytes());
+
+            // Neither the 16 bytes at the end of the buffer, nor the start of
+            // the buffer, is free.
+
+            ASSERT(0 == mX.tryReserve(16));
+
+            int length;
+            ASSERT(buffers[0] == mX.tryFront(&length));
+            mX.popFront();
+            ASSERT(160 == X.usedBytes());
+
+            // A message that does not fit in the 16 bytes at the end of the
+            // buffer skips to the start of the buffer, provided the skipped
+            // space and the message together fit.
+
+            ASSERT(0 == mX.tryReserve(80));
+
+            void *wrapped = mX.tryReserve(64);
+            ASSERT(buffers[0] == wrapped);
+            ASSERT(160 + 16 + 72 == X.usedBytes());
+            fillMessage(static_cast<char *>(wrapped), 64, 0, 3);
+            mX.commit(wrapped, 64);
+
+            ASSERT(buffers[1] == mX.tryFront(&length));  mX.popFront();
+            ASSERT(buffers[2] == mX.tryFront(&length));  mX.popFront();
+            ASSERT(16 + 72 == X.usedBytes());
+
+            // The skipped space is consumed along with the next message.
+
+            ASSERT(wrapped == mX.tryFront(&length));
+            ASSERT(64      == length);
+            ASSERT(72      == X.usedBytes());
+            ASSERT(1       == X.numMessages());
+
+            int producer, sequence;
+            ASSERT(checkMessage(wrapped, length, &producer, &sequence));
+            ASSERT(3 == sequence);
+
+            mX.popFront();
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.usedBytes());
+            ASSERT(0 == mX.tryFront(&length));
+        }
+
+        if (verbose) cout << "\tMany traversals of the buffer." << endl;
+        {
+            Obj mX(512);  const Obj& X = mX;
+
+            int sequence = 0;
+            int consumed = 0;
+            for (int round = 0; round < 200; ++round) {
+                for (;;) {
+                    const int  length = messageLength(sequence);
+                    void      *buffer = mX.tryReserve(length);
+                    if (!buffer) {
+                        break;
+                    }
+                    fillMessage(static_cast<char *>(buffer),
+                                length,
+                                round,
+                                sequence);
+                    mX.commit(buffer, length);
+                    ++sequence;
+                }
+                ASSERTV(round, X.usedBytes(), X.usedBytes() <= 512);
+                ASSERTV(round, X.usedBytes(), X.usedBytes() > 512 - 256);
+
+                // Consume all but one message, so that the positions of the
+                // messages vary between rounds.
+
+                while (1 < X.numMessages()) {
+                    int         length;
+                    const void *message = mX.tryFront(&length);
+                    ASSERT(message);
+
+                    int p, s;
+                    ASSERTV(round, checkMessage(message, length, &p, &s));
+                    ASSERTV(round, consumed, s, consumed == s);
+                    ASSERTV(round, messageLength(s) == length);
+                    ++consumed;
+                    mX.popFront();
+                }
+            }
+            ASSERTV(sequence, 1000 < sequence);
+            ASSERT(1 == mX.removeAll());
+            ASSERT(X.isEmpty());
+        }
+
+        if (verbose) cout << "\t'removeAll'." << endl;
+        {
+            Obj mX(256);  const Obj& X = mX;
+
+            ASSERT(0 == mX.removeAll());
+
+            for (int i = 0; i < 5; ++i) {
+                void *buffer = mX.tryReserve(i);
+                ASSERT(buffer);
+                mX.commit(buffer, i);
+            }
+            ASSERT(5 == X.numMessages());
+            ASSERT(5 == mX.removeAll());
+            ASSERT(0 == X.numMessages());
+            ASSERT(X.isEmpty());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BASIC MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The capacity is the requested capacity rounded up to a power of
+        //:   two, and at least 256; 'maxMessageLength' is derived from it.
+        //:
+        //: 2 The ring allocates its buffer from the supplied allocator on
+        //:   construction, and does not allocate thereafter.
+        //:
+        //: 3 'tryReserve' returns adjacent, 8-byte aligned buffers, and fails
+        //:   if the ring lacks space or the message is too long.
+        //:
+        //: 4 'usedBytes', 'numMessages', and 'isEmpty' reflect reserved,
+        //:   committed, and consumed messages.
+        //:
+        //: 5 'tryFront' returns committed messages in order, and 'popFront'
+        //:   releases their space.
+        //:
+        //: 6 Zero-length messages are supported.
+        //
+        // Plan:
+        //: 1 Create rings with various capacities and verify 'capacity' and
+        //:   'maxMessageLength'.  (C-1)
+        //:
+        //: 2 Using a test allocator, verify the number of allocations after
+        //:   construction and after publishing and consuming messages.  (C-2)
+        //:
+        //: 3 Reserve, commit, and consume messages of various lengths,
+        //:   verifying the returned addresses and the accessors after each
+        //:   step.  (C-3..6)
+        //
+        // Testing:
+        //   AsyncRecordRing(int capacity, bslma::Allocator *basicAllocator);
+        //   ~AsyncRecordRing();
+        //   void commit(void *buffer, int length);
+        //   void *tryReserve(int length);
+        //   void popFront();
+        //   const void *tryFront(int *length);
+        //   int capacity() const;
+        //   bool isEmpty() const;
+        //   int maxMessageLength() const;
+        //   int numMessages() const;
+        //   int usedBytes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BASIC MANIPULATORS AND ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        if (verbose) cout << "\tCapacity." << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_capacity;
+                int d_expected;
+            } DATA[] = {
+                { L_,       1,     256 },
+                { L_,     255,     256 },
+                { L_,     256,     256 },
+                { L_,     257,     512 },
+                { L_,    1000,    1024 },
+                { L_,    4096,    4096 },
+                { L_,   65537,  131072 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int LINE     = DATA[i].d_line;
+                const int CAPACITY = DATA[i].d_capacity;
+                const int EXPECTED = DATA[i].d_expected;
+
+                bslma::TestAllocator ta("object", veryVerbose);
+                {
+                    const Obj X(CAPACITY, &ta);
+
+                    ASSERTV(LINE, X.capacity(), EXPECTED == X.capacity());
+                    ASSERTV(LINE, EXPECTED / 2 - 8 == X.maxMessageLength());
+                    ASSERTV(LINE, X.isEmpty());
+                    ASSERTV(LINE, 0 == X.numMessages());
+                    ASSERTV(LINE, 0 == X.usedBytes());
+                    ASSERTV(LINE, 1 == ta.numBlocksInUse());
+                    ASSERTV(LINE, EXPECTED <= ta.numBytesInUse());
+                }
+                ASSERTV(LINE, 0 == ta.numBlocksInUse());
+            }
+            ASSERT(0 == defaultAllocator.numAllocations());
+        }
+
+        if (verbose) cout << "\tDefault allocator." << endl;
+        {
+            const Obj X(256);
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\tReserving, committing, and consuming."
+                          << endl;
+        {
+            bslma::TestAllocator ta("object", veryVerbose);
+
+            Obj mX(256, &ta);  const Obj& X = mX;
+
+            const int LENGTHS[] = { 0, 1, 7, 8, 9, 16, 17 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            char *previous = 0;
+            int   used     = 0;
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                const int LENGTH = LENGTHS[i];
+
+                char *buffer = static_cast<char *>(mX.tryReserve(LENGTH));
+                ASSERTV(LENGTH, buffer);
+                ASSERTV(LENGTH, 0 == (reinterpret_cast<bsls::Types::UintPtr>(
+                                                               buffer) & 7));
+                if (previous) {
+                    ASSERTV(LENGTH,
+                            previous + slotSize(LENGTHS[i - 1]) == buffer);
+                }
+                previous  = buffer;
+                used     += slotSize(LENGTH);
+
+                ASSERTV(LENGTH, used == X.usedBytes());
+                ASSERTV(LENGTH, i    == X.numMessages());
+                ASSERTV(LENGTH, !X.isEmpty());
+
+                bsl::memset(buffer, 'a' + i, LENGTH);
+                mX.commit(buffer, LENGTH);
+
+                ASSERTV(LENGTH, i + 1 == X.numMessages());
+            }
+
+            // The ring now holds 136 bytes; a message of 120 bytes does not
+            // fit, but one of 112 bytes does.
+
+            ASSERT(136 == X.usedBytes());
+            ASSERT(0   == mX.tryReserve(120));
+            ASSERT(0   == mX.tryReserve(X.maxMessageLength() + 1));
+
+            void *last = mX.tryReserve(112);
+            ASSERT(last);
+            ASSERT(256 == X.usedBytes());
+            mX.commit(last, 112);
+            ASSERT(0   == mX.tryReserve(0));
+
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                const int LENGTH = LENGTHS[i];
+
+                int         length  = -1;
+                const char *message = static_cast<const char *>(
+                                                         mX.tryFront(&length));
+                ASSERTV(LENGTH, message);
+                ASSERTV(LENGTH, length, LENGTH == length);
+                for (int j = 0; j < LENGTH; ++j) {
+                    ASSERTV(LENGTH, j, 'a' + i == message[j]);
+                }
+
+                // 'tryFront' does not consume the message.
+
+                ASSERTV(LENGTH, message == mX.tryFront(&length));
+
+                used -= slotSize(LENGTH);
+                mX.popFront();
+                ASSERTV(LENGTH, used + 120 == X.usedBytes());
+                ASSERTV(LENGTH, NUM_LENGTHS - i == X.numMessages());
+            }
+
+            int length;
+            ASSERT(last == mX.tryFront(&length));
+            ASSERT(112  == length);
+            mX.popFront();
+
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.usedBytes());
+            ASSERT(0 == X.numMessages());
+            ASSERT(0 == mX.tryFront(&length));
+            ASSERT(1 == ta.numAllocations());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Publish and consume a few messages.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST"
+                          << endl << "==============" << endl;
+
+        Obj mX(1024);  const Obj& X = mX;
+
+        ASSERT(1024 == X.capacity());
+        ASSERT(X.isEmpty());
+
+        for (int i = 0; i < 10; ++i) {
+            const int length = messageLength(i);
+            void     *buffer = mX.tryReserve(length);
+            ASSERTV(i, buffer);
+
+            fillMessage(static_cast<char *>(buffer), length, 0, i);
+            mX.commit(buffer, length);
+        }
+        ASSERT(10 == X.numMessages());
+
+        for (int i = 0; i < 10; ++i) {
+            int         length;
+            const void *message = mX.front(&length);
+            ASSERTV(i, message);
+
+            int producer, sequence;
+            ASSERTV(i, checkMessage(message, length, &producer, &sequence));
+            ASSERTV(i, sequence, i == sequence);
+            mX.popFront();
+        }
+        ASSERT(X.isEmpty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT BENCHMARK
+        //
+        // Concerns:
+        //: 1 Measure the number of messages per second that can be passed
+        //:   through a ring for an increasing number of producers.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 producers using 'reserve', publish messages
+        //:   of varying length through a ring of 64KB, consuming them on the
+        //:   main thread, and report the number of messages per second.  The
+        //:   3rd command line argument, if supplied, is the number of messages
+        //:   per producer.
+        //
+        // Testing:
+        //   THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        cout << endl << "THROUGHPUT BENCHMARK"
+             << endl << "====================" << endl;
+
+        const int NUM_MESSAGES = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        for (int numProducers = 1; numProducers <= 8; numProducers *= 2) {
+            Obj            mX(64 * 1024);
+            bslmt::Barrier barrier(numProducers + 1);
+
+            bsl::vector<ProducerArgs>              args(numProducers);
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(numProducers);
+
+            for (int i = 0; i < numProducers; ++i) {
+                args[i].d_ring_p      = &mX;
+                args[i].d_barrier_p   = &barrier;
+                args[i].d_producer    = i;
+                args[i].d_numMessages = NUM_MESSAGES;
+                args[i].d_blocking    = true;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      producerThread,
+                                                      &args[i]));
+            }
+
+            bsls::Stopwatch timer;
+            barrier.wait();
+            timer.start(true);
+
+            const Int64 TOTAL = static_cast<Int64>(numProducers)
+                                                                * NUM_MESSAGES;
+            for (Int64 n = 0; n < TOTAL; ++n) {
+                int length;
+                mX.front(&length);
+                mX.popFront();
+            }
+            timer.stop();
+
+            for (int i = 0; i < numProducers; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            cout << "producers: "   << numProducers
+                 << "\tmessages/s: "
+                 << static_cast<double>(TOTAL) / timer.elapsedTime()
+                 << "\tCPU time (s): "
+                 << timer.accumulatedUserTime() +
+                                                timer.accumulatedSystemTime()
+                 << endl;
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
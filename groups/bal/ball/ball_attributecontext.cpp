@@ -50,6 +50,23 @@ BSLS_IDENT_RCSID(ball_attributecontext_cpp,"$Id$ $CSID$")
 // lock would need to be held (until the message was actually written to the
 // log).
 //
+///Threshold Cache
+///---------------
+// 'determineThresholdLevels' additionally caches, per category, the levels
+// imposed by the relevant and active rules ('AttributeContext_ThresholdCache')
+// so that a cache hit requires neither the rule mutex nor a walk of the rule
+// set.  The same "good enough" reasoning applies: an entry is stored with the
+// sequence number read while holding the rule mutex, so it can only describe
+// the rule set having that sequence number, and any later change to the rule
+// set increments the sequence number before releasing the mutex.  The
+// relevant rule mask of the category, which is changed along with the
+// sequence number, is therefore read again under the mutex before computing
+// the levels to cache; otherwise, a rule added between the unlocked read of
+// the mask and the locking of the mutex would be ignored by an entry tagged
+// with the new sequence number.  The levels of the category itself are read
+// on every call rather than cached, as they may be changed without changing
+// the rule set.
+//
 ///'initialize' and 'reset'
 ///------------------------
 // Although there is no lock in the implementation of this component, the
@@ -159,6 +176,26 @@ namespace {
 BSLMT_THREAD_LOCAL_VARIABLE(ball::AttributeContext *, g_threadLocalContext, 0);
 #endif
 
+void raiseLevels(ball::ThresholdAggregate        *levels,
+                 const ball::ThresholdAggregate&  other)
+    // Set each threshold level of the specified 'levels' that is numerically
+    // less than the corresponding level of the specified 'other' to that
+    // level.
+{
+    if (other.recordLevel() > levels->recordLevel()) {
+        levels->setRecordLevel(other.recordLevel());
+    }
+    if (other.passLevel() > levels->passLevel()) {
+        levels->setPassLevel(other.passLevel());
+    }
+    if (other.triggerLevel() > levels->triggerLevel()) {
+        levels->setTriggerLevel(other.triggerLevel());
+    }
+    if (other.triggerAllLevel() > levels->triggerAllLevel()) {
+        levels->setTriggerAllLevel(other.triggerAllLevel());
+    }
+}
+
 }  // close unnamed namespace
 
 namespace ball {
@@ -343,8 +380,17 @@ AttributeContext::determineThresholdLevels(ThresholdAggregate *levels,
     }
 
     // The 'rulesetMutex' is intentionally *not* locked before checking the
-    // cache (see implementation note at the top).  Return if there are no
-    // active rules for 'category'.
+    // caches (see implementation note at the top).  Return if the levels
+    // imposed by the active rules for 'category' are cached, or if there are
+    // no active rules for 'category'.
+
+    const ThresholdAggregate *cachedLevels = d_thresholdCache.lookup(
+                                  s_categoryManager_p->ruleSetSequenceNumber(),
+                                  category);
+    if (cachedLevels) {
+        raiseLevels(levels, *cachedLevels);
+        return;                                                       // RETURN
+    }
 
     RuleSet::MaskType activeAndRelevantRules = 0;
     if (d_ruleCache_p.isDataAvailable(
@@ -357,27 +403,31 @@ AttributeContext::determineThresholdLevels(ThresholdAggregate *levels,
         }
     }
 
-    // We obtain the lock because we will need to process the rules.  Note that
-    // we must again call 'isDataAvailable' in case the rules were modified
-    // before the lock was obtained.
+    // We obtain the lock because we will need to process the rules.  The
+    // relevant rule mask is read again under the lock, as the rules may have
+    // been modified since it was read above: the levels cached below are
+    // tagged with the sequence number read under the lock, so they must be
+    // computed from the mask matching that sequence number (both are changed
+    // together while holding the lock).
 
     bslmt::LockGuard<bslmt::Mutex> ruleGuard(
                                          &s_categoryManager_p->rulesetMutex());
 
-    // If 'isDataAvailable' returns 'true', the rule set has not changed and we
-    // must have assigned 'activeAndRelevantRules' before obtaining the lock.
+    const bsls::Types::Int64 sequenceNumber =
+                                  s_categoryManager_p->ruleSetSequenceNumber();
 
-    if (!d_ruleCache_p.isDataAvailable(
-                                  s_categoryManager_p->ruleSetSequenceNumber(),
-                                  relevantRulesMask)) {
-          activeAndRelevantRules =
-                relevantRulesMask
-                & d_ruleCache_p.update(
-                                  s_categoryManager_p->ruleSetSequenceNumber(),
-                                  relevantRulesMask,
-                                  s_categoryManager_p->ruleSet(),
-                                  d_containerList);
+    relevantRulesMask = category->relevantRuleMask();
+
+    if (!d_ruleCache_p.isDataAvailable(sequenceNumber, relevantRulesMask)) {
+        d_ruleCache_p.update(sequenceNumber,
+                             relevantRulesMask,
+                             s_categoryManager_p->ruleSet(),
+                             d_containerList);
     }
+    activeAndRelevantRules = relevantRulesMask
+                           & d_ruleCache_p.knownActiveRules();
+
+    ThresholdAggregate ruleLevels(0, 0, 0, 0);
 
     int i;
 
@@ -389,19 +439,15 @@ AttributeContext::determineThresholdLevels(ThresholdAggregate *levels,
         const Rule *rule = s_categoryManager_p->ruleSet().getRuleById(i);
         BSLS_ASSERT(0 != rule);
 
-        if (rule->recordLevel() > levels->recordLevel()) {
-            levels->setRecordLevel(rule->recordLevel());
-        }
-        if (rule->passLevel() > levels->passLevel()) {
-            levels->setPassLevel(rule->passLevel());
-        }
-        if (rule->triggerLevel() > levels->triggerLevel()) {
-            levels->setTriggerLevel(rule->triggerLevel());
-        }
-        if (rule->triggerAllLevel() > levels->triggerAllLevel()) {
-            levels->setTriggerAllLevel(rule->triggerAllLevel());
-        }
+        raiseLevels(&ruleLevels,
+                    ThresholdAggregate(rule->recordLevel(),
+                                       rule->passLevel(),
+                                       rule->triggerLevel(),
+                                       rule->triggerAllLevel()));
     }
+
+    d_thresholdCache.update(sequenceNumber, category, ruleLevels);
+    raiseLevels(levels, ruleLevels);
 }
 
 // ACCESSORS
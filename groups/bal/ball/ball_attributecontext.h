@@ -67,6 +67,21 @@ BSLS_IDENT("$Id: $")
 // category, factoring in any active rules that apply to the category that
 // might override the category's thresholds.
 //
+///Threshold Cache
+///---------------
+// Each 'ball::AttributeContext' caches, for the categories most recently
+// supplied to 'determineThresholdLevels', the threshold levels imposed by the
+// relevant and active rules.  A cached entry is tagged with the sequence
+// number of the rule set for which it was computed; the category manager
+// increments that sequence number whenever a rule is added or removed (e.g.,
+// by 'ball::Administration'), which invalidates the entries cached by every
+// thread.  Adding or removing attributes, or calling 'clearCache', discards
+// the entries cached by the current thread.  The thresholds of the category
+// itself are not cached, so changes to them take effect immediately.  As a
+// result, determining that a log statement in a category having relevant
+// rules is disabled for the current thread does not, once the entry for the
+// category is cached, acquire any lock or evaluate any rule.
+//
 ///Usage
 ///-----
 // This section illustrates the intended use of 'ball::AttributeContext'.
@@ -298,6 +313,7 @@ BSLS_IDENT("$Id: $")
 
 #include <ball_attributecontainerlist.h>
 #include <ball_ruleset.h>
+#include <ball_thresholdaggregate.h>
 
 #include <bslma_allocator.h>
 
@@ -316,7 +332,6 @@ class Attribute;
 class AttributeContainer;
 class Category;
 class CategoryManager;
-class ThresholdAggregate;
 
              // ==========================================
              // class AttributeContext_RuleEvaluationCache
@@ -444,6 +459,83 @@ bsl::ostream& operator<<(
     // specified 'stream' in some single-line human readable format, and return
     // the modifiable 'stream'.
 
+             // =====================================
+             // class AttributeContext_ThresholdCache
+             // =====================================
+
+class AttributeContext_ThresholdCache {
+    // This is an implementation type of 'AttributeContext' and should not be
+    // used by clients of this package.  A threshold cache is a mechanism for
+    // caching, for a small number of categories, the threshold levels imposed
+    // on each category by the rules that are relevant to the category and
+    // active for the attributes of the current thread.  Each cached entry is
+    // tagged with the rule set sequence number for which it was computed, and
+    // 'lookup' ignores an entry once that sequence number has changed.  The
+    // cache is direct-mapped: caching the levels of one category may displace
+    // those of another.
+
+    // PRIVATE TYPES
+    enum {
+        k_NUM_ENTRIES_LOG2 = 6,                       // log2 of capacity
+        k_NUM_ENTRIES      = 1 << k_NUM_ENTRIES_LOG2  // number of entries
+    };
+
+    struct Entry {
+        // This 'struct' holds the threshold levels cached for one category.
+
+        const Category     *d_category_p;     // category (held, not owned),
+                                              // or 0 if the entry is empty
+
+        bsls::Types::Int64  d_sequenceNumber; // rule set sequence number for
+                                              // which 'd_levels' was computed
+
+        ThresholdAggregate  d_levels;         // levels imposed by the active
+                                              // rules relevant to the category
+    };
+
+    // DATA
+    Entry d_entries[k_NUM_ENTRIES];  // direct-mapped cache entries
+
+    // NOT IMPLEMENTED
+    AttributeContext_ThresholdCache(const AttributeContext_ThresholdCache&);
+    AttributeContext_ThresholdCache& operator=(
+                                       const AttributeContext_ThresholdCache&);
+
+    // PRIVATE CLASS METHODS
+    static int entryIndex(const Category *category);
+        // Return the index of the entry in which the threshold levels of the
+        // specified 'category' are cached.
+
+  public:
+    // CREATORS
+    AttributeContext_ThresholdCache();
+        // Create an empty threshold cache.
+
+    // ~AttributeContext_ThresholdCache();
+        // Destroy this threshold cache.  Note that this trivial destructor is
+        // generated by the compiler.
+
+    // MANIPULATORS
+    void clear();
+        // Discard all cached threshold levels, restoring this object to its
+        // default constructed state (empty).
+
+    void update(bsls::Types::Int64         sequenceNumber,
+                const Category            *category,
+                const ThresholdAggregate&  levels);
+        // Cache the specified 'levels' as the threshold levels imposed on the
+        // specified 'category' by the relevant and active rules of the rule
+        // set having the specified 'sequenceNumber', displacing any levels
+        // cached for another category in the same entry.
+
+    // ACCESSORS
+    const ThresholdAggregate *lookup(bsls::Types::Int64  sequenceNumber,
+                                     const Category     *category) const;
+        // Return the address of the threshold levels cached for the specified
+        // 'category' for the rule set having the specified 'sequenceNumber',
+        // or 0 if no such levels are cached.
+};
+
                         // ======================
                         // class AttributeContext
                         // ======================
@@ -479,6 +571,7 @@ class AttributeContext {
 
     // PRIVATE TYPES
     typedef AttributeContext_RuleEvaluationCache RuleEvaluationCache;
+    typedef AttributeContext_ThresholdCache      ThresholdCache;
 
     // CLASS DATA
     static CategoryManager  *s_categoryManager_p;  // holds the rule set, rule
@@ -495,6 +588,10 @@ class AttributeContext {
     mutable RuleEvaluationCache
                              d_ruleCache_p;        // cache of rule evaluations
 
+    mutable ThresholdCache   d_thresholdCache;     // cache of the threshold
+                                                   // levels imposed by active
+                                                   // rules
+
     bslma::Allocator        *d_allocator_p;        // allocator used to create
                                                    // this object (held, not
                                                    // owned)
@@ -582,9 +679,10 @@ class AttributeContext {
         // called.
 
     void clearCache();
-        // Clear this object's cache of evaluated rules.  Note that this method
-        // must be called if an 'AttributeContainer' object supplied to
-        // 'addAttributes' is modified outside of this context.
+        // Clear this object's cache of evaluated rules and of the threshold
+        // levels they impose.  Note that this method must be called if an
+        // 'AttributeContainer' object supplied to 'addAttributes' is modified
+        // outside of this context.
 
     void removeAttributes(iterator element);
         // Remove the specified 'element' from the list of attribute containers
@@ -623,11 +721,14 @@ class AttributeContext {
         // collection of attributes maintained by this object).  This method
         // operates on the set of rules maintained by the category manager
         // supplied to the 'initialize' class method (which, in practice,
-        // should be the global set of rules for the process).  The behavior is
-        // undefined unless 'initialize' has previously been invoked without a
-        // subsequent call to 'reset', and 'category' is contained in the
-        // registry maintained by the category manager supplied to
-        // 'initialize'.
+        // should be the global set of rules for the process).  The levels
+        // imposed by the active rules are cached (see {Threshold Cache}), so
+        // that subsequent calls for 'category' neither acquire a lock nor
+        // evaluate any rule until the rule set or the attributes of this
+        // object change.  The behavior is undefined unless 'initialize' has
+        // previously been invoked without a subsequent call to 'reset', and
+        // 'category' is contained in the registry maintained by the category
+        // manager supplied to 'initialize'.
 
     bool hasAttribute(const Attribute& value) const;
         // Return 'true' if an attribute having the specified 'value' exists in
@@ -730,6 +831,67 @@ AttributeContext_RuleEvaluationCache::knownActiveRules() const
     return d_resultMask;
 }
 
+                 // -------------------------------------
+                 // class AttributeContext_ThresholdCache
+                 // -------------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+int AttributeContext_ThresholdCache::entryIndex(const Category *category)
+{
+    // Categories are allocated individually, so the low-order bits of their
+    // addresses vary little; multiplicative hashing folds in the higher ones.
+
+    const bsls::Types::Uint64 address =
+                              reinterpret_cast<bsls::Types::UintPtr>(category);
+
+    return static_cast<int>((address * 0x9E3779B97F4A7C15ULL)
+                                                 >> (64 - k_NUM_ENTRIES_LOG2));
+}
+
+// CREATORS
+inline
+AttributeContext_ThresholdCache::AttributeContext_ThresholdCache()
+{
+    clear();
+}
+
+// MANIPULATORS
+inline
+void AttributeContext_ThresholdCache::clear()
+{
+    for (int i = 0; i < k_NUM_ENTRIES; ++i) {
+        d_entries[i].d_category_p = 0;
+    }
+}
+
+inline
+void AttributeContext_ThresholdCache::update(
+                                     bsls::Types::Int64         sequenceNumber,
+                                     const Category            *category,
+                                     const ThresholdAggregate&  levels)
+{
+    Entry& entry = d_entries[entryIndex(category)];
+
+    entry.d_category_p     = category;
+    entry.d_sequenceNumber = sequenceNumber;
+    entry.d_levels         = levels;
+}
+
+// ACCESSORS
+inline
+const ThresholdAggregate *AttributeContext_ThresholdCache::lookup(
+                                      bsls::Types::Int64  sequenceNumber,
+                                      const Category     *category) const
+{
+    const Entry& entry = d_entries[entryIndex(category)];
+
+    return category       == entry.d_category_p
+        && sequenceNumber == entry.d_sequenceNumber
+           ? &entry.d_levels
+           : 0;
+}
+
                         // ----------------------
                         // class AttributeContext
                         // ----------------------
@@ -742,6 +904,7 @@ AttributeContext::addAttributes(const AttributeContainer *attributes)
     BSLS_ASSERT(attributes);
 
     d_ruleCache_p.clear();
+    d_thresholdCache.clear();
     return d_containerList.pushFront(attributes);
 }
 
@@ -749,12 +912,14 @@ inline
 void AttributeContext::clearCache()
 {
     d_ruleCache_p.clear();
+    d_thresholdCache.clear();
 }
 
 inline
 void AttributeContext::removeAttributes(iterator element)
 {
     d_ruleCache_p.clear();
+    d_thresholdCache.clear();
     d_containerList.remove(element);
 }
 
@@ -30,10 +30,12 @@
 #include <bslmt_mutex.h>
 
 #include <bsls_asserttest.h>
+#include <bsls_atomic.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -68,9 +70,11 @@ using namespace bsl;
 // [ 2] static AttributeContext *lookupContext();
 // [ 3] iterator addAttributes(const AttributeContainer *attributes);
 // [ 4] void clearCache();
+// [ 7] void clearCache();
 // [ 3] void removeAttributes(iterator element);
 // [ 4] bool hasRelevantActiveRules(const Cat *cat) const;
 // [ 4] void determineThresholdLevels(TL *lvls, const Cat *cat) const;
+// [ 7] void determineThresholdLevels(TL *lvls, const Cat *cat) const;
 // [ 3] bool hasAttribute(const Attribute& value) const;
 // [ 3] const AttributeContainerList& containers() const;
 // [  ] bsl::ostream& print(bsl::ostream& stream, int level, int spl) const;
@@ -82,9 +86,10 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] AttributeSet
 // [ 6] CONCERN: No false positives from 'hasRelevantActiveRules'.
-// [ 7] (OLD) USAGE EXAMPLE
-// [ 8] USAGE EXAMPLE 1
-// [ 9] USAGE EXAMPLE 2
+// [ 7] CONCERN: Threshold levels are cached and invalidated correctly.
+// [ 8] (OLD) USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE 1
+// [10] USAGE EXAMPLE 2
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -688,6 +693,107 @@ extern "C" void *oldUsageExample(void *args)
 
 }  // close namespace BALL_ATTRIBUTECONTEXT_USAGE_EXAMPLE_OLD
 
+//=============================================================================
+//                         CASE 7 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace BALL_ATTRIBUTECONTEXT_TEST_CASE_7 {
+
+enum {
+    e_STARTED,     // the cached-lookup thread has not yet populated its cache
+    e_CACHED,      // the cached-lookup thread has populated its cache
+    e_LOCKED,      // the main thread holds the rule set mutex
+    e_RULE_ADDED,  // the main thread has added a rule
+    e_DONE         // the cached-lookup thread has determined the levels again
+};
+
+struct ThreadArgs {
+    const ball::Category     *d_category_p;   // category to look up
+    ball::ThresholdAggregate  d_expected;     // expected threshold levels
+    bsls::AtomicInt           d_state;        // progress of the test
+};
+
+extern "C" void *cachedLookupThread(void *args)
+    // Add to the attribute context of this thread an attribute activating the
+    // rule installed by test case 7, and determine the threshold levels of
+    // the category supplied in the specified 'args' to populate the threshold
+    // cache.  Then, once the main thread holds the rule set mutex, determine
+    // the threshold levels of that category again.
+{
+    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
+
+    AttributeSet attributes;
+    attributes.insert(ball::Attribute("uuid", 7));
+
+    Obj                *mX = Obj::getContext();
+    const Obj&          X  = *mX;
+    Obj::iterator       it = mX->addAttributes(&attributes);
+
+    ball::ThresholdAggregate levels(0, 0, 0, 0);
+
+    X.determineThresholdLevels(&levels, threadArgs->d_category_p);
+    ASSERT(threadArgs->d_expected == levels);
+
+    threadArgs->d_state = e_CACHED;
+    while (e_LOCKED != threadArgs->d_state) {
+        bslmt::ThreadUtil::yield();
+    }
+
+    levels.setLevels(0, 0, 0, 0);
+    X.determineThresholdLevels(&levels, threadArgs->d_category_p);
+    ASSERT(threadArgs->d_expected == levels);
+
+    threadArgs->d_state = e_DONE;
+
+    mX->removeAttributes(it);
+
+    return 0;
+}
+
+extern "C" void *ruleAddedThread(void *args)
+    // Add to the attribute context of this thread an attribute activating the
+    // rules installed by test case 7, then, once the main thread holds the
+    // rule set mutex, determine the threshold levels of the category supplied
+    // in the specified 'args', which blocks on the mutex after reading the
+    // relevant rule mask of the category.  Then, once the main thread has
+    // added a rule relevant to the category, determine the threshold levels of
+    // that category again, and verify that they are the expected ones.
+{
+    ThreadArgs *threadArgs = reinterpret_cast<ThreadArgs *>(args);
+
+    AttributeSet attributes;
+    attributes.insert(ball::Attribute("uuid", 7));
+
+    Obj                *mX = Obj::getContext();
+    const Obj&          X  = *mX;
+    Obj::iterator       it = mX->addAttributes(&attributes);
+
+    ball::ThresholdAggregate levels(0, 0, 0, 0);
+
+    while (e_LOCKED != threadArgs->d_state) {
+        bslmt::ThreadUtil::yield();
+    }
+
+    X.determineThresholdLevels(&levels, threadArgs->d_category_p);
+
+    while (e_RULE_ADDED != threadArgs->d_state) {
+        bslmt::ThreadUtil::yield();
+    }
+
+    levels.setLevels(0, 0, 0, 0);
+    X.determineThresholdLevels(&levels, threadArgs->d_category_p);
+    ASSERTV(threadArgs->d_expected, levels,
+            threadArgs->d_expected == levels);
+
+    threadArgs->d_state = e_DONE;
+
+    mX->removeAttributes(it);
+
+    return 0;
+}
+
+}  // close namespace BALL_ATTRIBUTECONTEXT_TEST_CASE_7
+
 //=============================================================================
 //                         CASE 4 RELATED ENTITIES
 //-----------------------------------------------------------------------------
@@ -1320,7 +1426,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
         //   Extracted from component header file.
@@ -1371,7 +1477,7 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(mainThread);
 
       } break;
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //   Extracted from component header file.
@@ -1403,7 +1509,7 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(threads[0]);
         bslmt::ThreadUtil::join(threads[1]);
       } break;
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING ORIGINAL USAGE EXAMPLE
         //   This test runs the original usage example for this component.  It
@@ -1435,6 +1541,422 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(mainThread);
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: THRESHOLD LEVELS ARE CACHED AND INVALIDATED CORRECTLY
+        //
+        // Concerns:
+        //: 1 'AttributeContext_ThresholdCache' returns cached levels only for
+        //:   the category and sequence number for which they were stored, and
+        //:   'clear' discards all cached levels.
+        //:
+        //: 2 'determineThresholdLevels' returns the same levels whether or not
+        //:   they are cached.
+        //:
+        //: 3 Adding or removing a rule, changing the levels of a category, and
+        //:   adding or removing attributes are reflected in the levels
+        //:   returned by the next call to 'determineThresholdLevels'.
+        //:
+        //: 4 Modifying an attribute container in place is reflected in the
+        //:   levels returned by 'determineThresholdLevels' after 'clearCache'
+        //:   is called.
+        //:
+        //: 5 The levels returned are correct when more categories are looked
+        //:   up than the cache can hold at once.
+        //:
+        //: 6 Determining the cached levels of a category does not acquire the
+        //:   rule set mutex.
+        //:
+        //: 7 A rule added while 'determineThresholdLevels' waits for the rule
+        //:   set mutex, after it has read the relevant rule mask of the
+        //:   category, is reflected in the levels returned by the next call.
+        //
+        // Plan:
+        //: 1 Store levels in a 'AttributeContext_ThresholdCache' and look them
+        //:   up for various categories and sequence numbers, before and after
+        //:   calling 'clear'.  (C-1)
+        //:
+        //: 2 Using ad hoc testing, create a category manager having one
+        //:   category and one rule, relevant to that category, whose predicate
+        //:   is satisfied by an attribute held in an attribute container.
+        //:   Repeatedly call 'determineThresholdLevels', and verify the result
+        //:   after each of the operations in C-3 and C-4.  (C-2..4)
+        //:
+        //: 3 Create many categories, each having a distinct name and distinct
+        //:   levels, and install a rule relevant to every second category.
+        //:   Call 'determineThresholdLevels' for every category several times
+        //:   and verify the results.  (C-5)
+        //:
+        //: 4 In a second thread, populate the cache for a category.  Then,
+        //:   while the main thread holds the rule set mutex, determine the
+        //:   levels of that category again in the second thread, and verify
+        //:   that it completes before the main thread releases the mutex.
+        //:   (C-6)
+        //:
+        //: 5 While the main thread holds the rule set mutex, determine the
+        //:   levels of a category in a second thread, which reads the
+        //:   relevant rule mask of the category and then waits for the mutex.
+        //:   Release the mutex and immediately add a second rule relevant to
+        //:   the category, so that the second thread usually acquires the
+        //:   mutex after the rule is added.  Then determine the levels again
+        //:   in the second thread, and verify that they reflect both rules.
+        //:   Repeat several times, as the order in which the threads acquire
+        //:   the mutex is not controlled.  (C-7)
+        //
+        // Testing:
+        //   void clearCache();
+        //   void determineThresholdLevels(TL *lvls, const Cat *cat) const;
+        //   CONCERN: Threshold levels are cached and invalidated correctly.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: THRESHOLD LEVELS ARE CACHED CORRECTLY"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        using namespace BALL_ATTRIBUTECONTEXT_TEST_CASE_7;
+
+        typedef ball::AttributeContext_ThresholdCache ThresholdCache;
+        typedef ball::ThresholdAggregate              Levels;
+
+        if (verbose) cout << "\nTesting 'AttributeContext_ThresholdCache'."
+                          << endl;
+        {
+            CatMngr manager(Z);
+
+            enum { k_NUM_CATEGORIES = 200 };
+
+            const ball::Category *categories[k_NUM_CATEGORIES];
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                bsl::string name("Category-");
+                name += static_cast<char>('A' + i % 26);
+                name += static_cast<char>('A' + i / 26);
+                categories[i] = manager.addCategory(name.c_str(),
+                                                    0,
+                                                    0,
+                                                    0,
+                                                    0);
+                ASSERT(categories[i]);
+            }
+
+            ThresholdCache mX;  const ThresholdCache& X = mX;
+
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                ASSERTV(i, 0 == X.lookup(0, categories[i]));
+            }
+
+            const Levels LEVELS(40, 30, 20, 10);
+
+            mX.update(5, categories[0], LEVELS);
+
+            ASSERT(0 != X.lookup(5, categories[0]));
+            ASSERT(LEVELS == *X.lookup(5, categories[0]));
+            ASSERT(0 == X.lookup(4, categories[0]));
+            ASSERT(0 == X.lookup(6, categories[0]));
+            for (int i = 1; i < k_NUM_CATEGORIES; ++i) {
+                ASSERTV(i, 0 == X.lookup(5, categories[i]));
+            }
+
+            // Each cached entry either holds the levels stored for a category
+            // or is displaced by those stored later for another category.
+
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                mX.update(7, categories[i], Levels(i, i, i, i));
+            }
+
+            int numCached = 0;
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                const Levels *levels = X.lookup(7, categories[i]);
+                if (levels) {
+                    ASSERTV(i, Levels(i, i, i, i) == *levels);
+                    ++numCached;
+                }
+            }
+            ASSERTV(numCached, 0 < numCached);
+
+            mX.clear();
+
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                ASSERTV(i, 0 == X.lookup(7, categories[i]));
+            }
+        }
+
+        if (verbose) cout << "\nTesting invalidation." << endl;
+        {
+            CatMngr manager(Z);
+            Obj::initialize(&manager, &globalAllocator);
+
+            Obj *mX = Obj::getContext();  const Obj& X = *mX;
+
+            ball::Category *cat =
+                         manager.addCategory("ABC-Category", 128, 96, 64, 32);
+            ASSERT(cat);
+
+            const Levels CAT_LEVELS(128, 96, 64, 32);
+            const Levels RULE_LEVELS(130, 110, 70, 40);
+
+            ball::Rule rule("ABC-*", 130, 110, 70, 40);
+            rule.addPredicate(ball::Predicate("uuid", 2468));
+
+            AttributeSet attributes;
+            attributes.insert(ball::Attribute("uuid", 2468));
+
+            Levels levels(0, 0, 0, 0);
+
+            // No rule.
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, CAT_LEVELS == levels);
+            }
+
+            // Relevant rule, inactive.
+
+            manager.addRule(rule);
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, CAT_LEVELS == levels);
+            }
+
+            // Relevant rule, active.
+
+            Obj::iterator it = mX->addAttributes(&attributes);
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, RULE_LEVELS == levels);
+            }
+
+            // The levels of the category above those of the rule are read on
+            // every call.
+
+            ASSERT(0 == cat->setLevels(140, 96, 64, 50));
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, Levels(140, 110, 70, 50) == levels);
+            }
+
+            ASSERT(0 == cat->setLevels(128, 96, 64, 32));
+
+            // Relevant rule, inactive after modifying the attribute container
+            // in place and calling 'clearCache'.
+
+            attributes.remove(ball::Attribute("uuid", 2468));
+            attributes.insert(ball::Attribute("uuid", 1357));
+            mX->clearCache();
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, CAT_LEVELS == levels);
+            }
+
+            attributes.remove(ball::Attribute("uuid", 1357));
+            attributes.insert(ball::Attribute("uuid", 2468));
+            mX->clearCache();
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, RULE_LEVELS == levels);
+            }
+
+            // Relevant rule, inactive after removing the attributes.
+
+            mX->removeAttributes(it);
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, CAT_LEVELS == levels);
+            }
+
+            // Relevant rule, active after adding the attributes again.
+
+            it = mX->addAttributes(&attributes);
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, RULE_LEVELS == levels);
+            }
+
+            // No rule, after removing the rule.
+
+            ASSERT(1 == manager.removeRule(rule));
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, CAT_LEVELS == levels);
+            }
+
+            // Relevant rule, active after adding the rule again.
+
+            ASSERT(1 == manager.addRule(rule));
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, RULE_LEVELS == levels);
+            }
+
+            // Two relevant rules, both active.
+
+            ball::Rule rule2("ABC-Cat*", 100, 120, 60, 45);
+            rule2.addPredicate(ball::Predicate("uuid", 2468));
+            ASSERT(1 == manager.addRule(rule2));
+
+            for (int i = 0; i < 3; ++i) {
+                X.determineThresholdLevels(&levels, cat);
+                ASSERTV(i, Levels(130, 120, 70, 45) == levels);
+            }
+
+            mX->removeAttributes(it);
+
+            ball::AttributeContextProctor proctor;  // destroys context
+            Obj::reset();
+        }
+
+        if (verbose) cout << "\nTesting many categories." << endl;
+        {
+            CatMngr manager(Z);
+            Obj::initialize(&manager, &globalAllocator);
+
+            Obj *mX = Obj::getContext();  const Obj& X = *mX;
+
+            enum { k_NUM_CATEGORIES = 200 };
+
+            const ball::Category *categories[k_NUM_CATEGORIES];
+            for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                bsl::string name(i % 2 ? "Ruled-" : "Plain-");
+                name += static_cast<char>('A' + i % 26);
+                name += static_cast<char>('A' + i / 26);
+                categories[i] = manager.addCategory(name.c_str(),
+                                                    i,
+                                                    i,
+                                                    i,
+                                                    i);
+                ASSERT(categories[i]);
+            }
+
+            ball::Rule rule("Ruled-*", 100, 150, 100, 150);
+            rule.addPredicate(ball::Predicate("uuid", 2468));
+            ASSERT(1 == manager.addRule(rule));
+
+            AttributeSet attributes;
+            attributes.insert(ball::Attribute("uuid", 2468));
+            Obj::iterator it = mX->addAttributes(&attributes);
+
+            Levels levels(0, 0, 0, 0);
+
+            for (int j = 0; j < 3; ++j) {
+                for (int i = 0; i < k_NUM_CATEGORIES; ++i) {
+                    const int RECORD = i % 2 ? bsl::max(i, 100) : i;
+                    const int PASS   = i % 2 ? bsl::max(i, 150) : i;
+
+                    X.determineThresholdLevels(&levels, categories[i]);
+                    ASSERTV(j, i, Levels(RECORD, PASS, RECORD, PASS)
+                                                                   == levels);
+                }
+            }
+
+            mX->removeAttributes(it);
+
+            ball::AttributeContextProctor proctor;  // destroys context
+            Obj::reset();
+        }
+
+        if (verbose) cout << "\nTesting lookup without locking." << endl;
+        {
+            CatMngr manager(Z);
+            Obj::initialize(&manager, &globalAllocator);
+
+            ThreadArgs args;
+            args.d_category_p =
+                         manager.addCategory("ABC-Category", 128, 96, 64, 32);
+            args.d_expected.setLevels(130, 110, 70, 40);
+            args.d_state = e_STARTED;
+
+            ball::Rule rule("ABC-*", 130, 110, 70, 40);
+            rule.addPredicate(ball::Predicate("uuid", 7));
+            ASSERT(1 == manager.addRule(rule));
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  cachedLookupThread,
+                                                  &args));
+
+            while (e_CACHED != args.d_state) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&manager.rulesetMutex());
+
+                args.d_state = e_LOCKED;
+
+                // Wait for up to 10 seconds for the cached lookup to complete.
+
+                for (int i = 0; i < 10000 && e_DONE != args.d_state; ++i) {
+                    bslmt::ThreadUtil::microSleep(1000);
+                }
+                ASSERT(e_DONE == args.d_state);
+            }
+
+            bslmt::ThreadUtil::join(handle);
+
+            Obj::reset();
+        }
+
+        if (verbose) cout << "\nTesting a rule added while locking." << endl;
+        {
+            CatMngr manager(Z);
+            Obj::initialize(&manager, &globalAllocator);
+
+            ball::Category *cat =
+                         manager.addCategory("ABC-Category", 128, 96, 64, 32);
+            ASSERT(cat);
+
+            ball::Rule rule("ABC-*", 130, 110, 70, 40);
+            rule.addPredicate(ball::Predicate("uuid", 7));
+            ASSERT(1 == manager.addRule(rule));
+
+            ball::Rule rule2("ABC-Cat*", 100, 120, 60, 45);
+            rule2.addPredicate(ball::Predicate("uuid", 7));
+
+            for (int i = 0; i < 10; ++i) {
+                ThreadArgs args;
+                args.d_category_p = cat;
+                args.d_expected.setLevels(130, 120, 70, 45);
+                args.d_state = e_STARTED;
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      ruleAddedThread,
+                                                      &args));
+
+                {
+                    bslmt::LockGuard<bslmt::Mutex> guard(
+                                                    &manager.rulesetMutex());
+
+                    args.d_state = e_LOCKED;
+
+                    // Give the second thread time to read the relevant rule
+                    // mask and block on the mutex.
+
+                    bslmt::ThreadUtil::microSleep(10000);
+                }
+
+                ASSERT(1 == manager.addRule(rule2));
+                args.d_state = e_RULE_ADDED;
+
+                bslmt::ThreadUtil::join(handle);
+                ASSERTV(i, e_DONE == args.d_state);
+
+                ASSERT(1 == manager.removeRule(rule2));
+            }
+
+            Obj::reset();
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // NO FALSE POSITIVES FROM 'hasRelevantActiveRules'
@@ -0,0 +1,561 @@
+// ball_concurrentrecordbuffer.cpp                                    -*-C++-*-
+#include <ball_concurrentrecordbuffer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_concurrentrecordbuffer_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+
+#include <new>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The ring is addressed by two 32-bit positions, packed into the single word
+// 'd_ends' so that both ends of the buffer can be moved with one
+// compare-and-swap: the position of the front record, and the position one
+// past the back record.  Positions wrap around modulo 2^32, and the slot of a
+// position is the position modulo the (power of two) capacity.  'pushBack'
+// and 'popBack' move the back position; 'pushFront' and 'popFront' move the
+// front position.
+//
+// Each slot is 'e_EMPTY' or 'e_FULL' according to whether its position within
+// the buffer is occupied, except while a thread holds it 'e_BUSY'.  To push
+// (or pop) a record, a thread loads 'd_ends', marks the slot at the position
+// to be claimed 'e_BUSY' with a compare-and-swap from 'e_EMPTY' (or
+// 'e_FULL'), and only then claims the position by moving the end with a
+// compare-and-swap of 'd_ends'; it then copies the handle into (or out of)
+// the slot, and releases the slot with the opposite state.  If either
+// compare-and-swap fails, the slot is released unchanged, and the operation
+// is retried.  Since a position is claimed only by the thread holding its
+// slot, and the slot is released only once filled (or emptied), the
+// operations on each slot are serialized in the order in which they claimed
+// their positions, and a slot that is not held always reflects the occupancy
+// of its position (the only position of the slot within the bounds of
+// 'd_ends').  In particular, a slot observed in the wrong state indicates
+// that the loaded 'd_ends' is stale.  Note that a thread holds at most one
+// slot at a time, and never waits while holding one.
+//
+// Handles removed from a slot are destroyed only after the slot is released,
+// so that a record whose last reference is held by the buffer is returned to
+// its pool without delaying other threads waiting for the slot.
+//
+// The sequence is a ring of 'Entry' objects of the same capacity as the ring
+// of slots, accessed only by the thread holding 'd_sequenceMutex'.  Other
+// threads read only 'd_sequenceDepth', to determine whether a sequence exists
+// (and only then compare their thread id with 'd_sequenceThread'), and
+// 'd_sequenceLength', in 'length'.
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+
+typedef bsls::Types::Uint64 Uint64;
+
+enum {
+    k_SPIN_COUNT = 16  // number of attempts to claim a slot before yielding
+};
+
+inline
+Uint64 makeEnds(unsigned int front, unsigned int back)
+    // Return the value of 'd_ends' for the specified 'front' and 'back'
+    // positions.
+{
+    return (static_cast<Uint64>(front) << 32) | back;
+}
+
+inline
+void waitForSlot(int *spin)
+    // Yield the processor if the specified 'spin' count of failed attempts to
+    // claim a slot has reached 'k_SPIN_COUNT' (resetting it), and increment
+    // 'spin' otherwise.
+{
+    if (++*spin == k_SPIN_COUNT) {
+        bslmt::ThreadUtil::yield();
+        *spin = 0;
+    }
+}
+
+}  // close unnamed namespace
+
+                        // ----------------------------
+                        // class ConcurrentRecordBuffer
+                        // ----------------------------
+
+// PRIVATE CLASS METHODS
+int ConcurrentRecordBuffer::recordSize(const Record& record)
+{
+    return record.numAllocatedBytes()
+         + static_cast<int>(
+               bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Record)));
+}
+
+// PRIVATE MANIPULATORS
+void ConcurrentRecordBuffer::discardRecords(End end)
+{
+    while (d_totalSize.load() > d_maxTotalSize) {
+        Entry discarded;
+        if (!popRing(&discarded, end)) {
+            return;                                                   // RETURN
+        }
+        d_totalSize.add(-discarded.d_size);
+    }
+}
+
+bool ConcurrentRecordBuffer::popRing(Entry *result, End end)
+{
+    bsl::shared_ptr<Record> handle;
+    int                     size = 0;
+
+    for (int spin = 0;; waitForSlot(&spin)) {
+        const Uint64       ends  = d_ends.loadAcquire();
+        const unsigned int front = static_cast<unsigned int>(ends >> 32);
+        const unsigned int back  = static_cast<unsigned int>(ends);
+
+        if (front == back) {
+            return false;                                             // RETURN
+        }
+
+        const unsigned int position = e_FRONT == end ? front : back - 1;
+        const Uint64       newEnds  = e_FRONT == end
+                                      ? makeEnds(front + 1, back)
+                                      : makeEnds(front, back - 1);
+
+        Slot& slot = d_slots_p[position & (d_capacity - 1)];
+
+        if (e_FULL != slot.d_state.testAndSwapAcqRel(e_FULL, e_BUSY)) {
+            // The slot is held by another thread, or 'ends' is stale.
+
+            continue;
+        }
+
+        if (ends != d_ends.testAndSwapAcqRel(ends, newEnds)) {
+            slot.d_state.storeRelease(e_FULL);
+            continue;
+        }
+
+        handle.swap(slot.d_handle.object());
+        slot.d_handle.object().~shared_ptr<Record>();
+        size = slot.d_size;
+
+        slot.d_state.storeRelease(e_EMPTY);
+        break;
+    }
+
+    if (result) {
+        result->d_handle.swap(handle);
+        result->d_size = size;
+    }
+    return true;
+}
+
+bool ConcurrentRecordBuffer::pushRing(const bsl::shared_ptr<Record>& handle,
+                                      int                            size,
+                                      End                            end,
+                                      bool                           replace)
+{
+    const End opposite = e_FRONT == end ? e_BACK : e_FRONT;
+
+    for (int spin = 0;; waitForSlot(&spin)) {
+        const Uint64       ends  = d_ends.loadAcquire();
+        const unsigned int front = static_cast<unsigned int>(ends >> 32);
+        const unsigned int back  = static_cast<unsigned int>(ends);
+
+        if (back - front == d_capacity) {
+            if (!replace) {
+                return false;                                         // RETURN
+            }
+
+            Entry replaced;
+            if (popRing(&replaced, opposite)) {
+                d_totalSize.add(-replaced.d_size);
+            }
+            spin = 0;
+            continue;
+        }
+
+        const unsigned int position = e_FRONT == end ? front - 1 : back;
+        const Uint64       newEnds  = e_FRONT == end
+                                      ? makeEnds(front - 1, back)
+                                      : makeEnds(front, back + 1);
+
+        Slot& slot = d_slots_p[position & (d_capacity - 1)];
+
+        if (e_EMPTY != slot.d_state.testAndSwapAcqRel(e_EMPTY, e_BUSY)) {
+            // The slot is held by another thread, or 'ends' is stale.
+
+            continue;
+        }
+
+        if (ends != d_ends.testAndSwapAcqRel(ends, newEnds)) {
+            slot.d_state.storeRelease(e_EMPTY);
+            continue;
+        }
+
+        new (slot.d_handle.buffer()) bsl::shared_ptr<Record>(handle);
+        slot.d_size = size;
+
+        slot.d_state.storeRelease(e_FULL);
+        break;
+    }
+    return true;
+}
+
+void ConcurrentRecordBuffer::popSequence(Entry *result, End end)
+{
+    const int length = d_sequenceLength.loadRelaxed();
+
+    BSLS_ASSERT(0 < length);
+
+    const unsigned int index = e_FRONT == end
+                                  ? d_sequenceFront
+                                  : (d_sequenceFront + length - 1)
+                                                          & (d_capacity - 1);
+
+    Entry& entry = d_sequence[index];
+
+    if (result) {
+        result->d_handle.swap(entry.d_handle);
+        result->d_size = entry.d_size;
+    }
+    entry.d_handle.reset();
+
+    if (e_FRONT == end) {
+        d_sequenceFront = (d_sequenceFront + 1) & (d_capacity - 1);
+    }
+    d_sequenceLength.storeRelaxed(length - 1);
+    d_sequenceSize -= entry.d_size;
+}
+
+int ConcurrentRecordBuffer::pushSequence(const bsl::shared_ptr<Record>& handle,
+                                         End                            end)
+{
+    const int size = recordSize(*handle);
+
+    if (size > d_maxTotalSize) {
+        // Impossible to accommodate this record.
+
+        return -1;                                                    // RETURN
+    }
+
+    const End opposite = e_FRONT == end ? e_BACK : e_FRONT;
+
+    if (static_cast<unsigned int>(d_sequenceLength.loadRelaxed())
+                                                              == d_capacity) {
+        Entry replaced;
+        popSequence(&replaced, opposite);
+        d_totalSize.add(-replaced.d_size);
+    }
+
+    const int    length = d_sequenceLength.loadRelaxed();
+    unsigned int index;
+
+    if (e_FRONT == end) {
+        d_sequenceFront = (d_sequenceFront - 1) & (d_capacity - 1);
+        index           = d_sequenceFront;
+    }
+    else {
+        index = (d_sequenceFront + length) & (d_capacity - 1);
+    }
+
+    d_sequence[index].d_handle = handle;
+    d_sequence[index].d_size   = size;
+    d_sequenceLength.storeRelaxed(length + 1);
+    d_sequenceSize += size;
+
+    d_totalSize.add(size);
+
+    while (d_sequenceSize > d_maxTotalSize) {
+        Entry discarded;
+        popSequence(&discarded, opposite);
+        d_totalSize.add(-discarded.d_size);
+    }
+
+    // Restore the size limit, if necessary, by discarding the oldest of the
+    // records pushed to the ring by other threads during the sequence.
+
+    discardRecords(e_FRONT);
+
+    return 0;
+}
+
+int ConcurrentRecordBuffer::pushRecord(const bsl::shared_ptr<Record>& handle,
+                                       End                            end)
+{
+    const int size = recordSize(*handle);
+
+    if (size > d_maxTotalSize) {
+        // Impossible to accommodate this record.
+
+        return -1;                                                    // RETURN
+    }
+
+    // Add the size before the record becomes visible, so that the total size
+    // is never decreased by a size that was not yet added.
+
+    d_totalSize.add(size);
+
+    pushRing(handle, size, end, true);
+
+    discardRecords(e_FRONT == end ? e_BACK : e_FRONT);
+
+    return 0;
+}
+
+void ConcurrentRecordBuffer::removeRecord(End end)
+{
+    Entry removed;
+    if (popRing(&removed, end)) {
+        d_totalSize.add(-removed.d_size);
+    }
+}
+
+// PRIVATE ACCESSORS
+bool ConcurrentRecordBuffer::holdsSequence() const
+{
+    return 0 < d_sequenceDepth.loadAcquire()
+        && bslmt::ThreadUtil::selfIdAsUint64()
+                                          == d_sequenceThread.loadRelaxed();
+}
+
+int ConcurrentRecordBuffer::ringLength() const
+{
+    const Uint64 ends = d_ends.loadAcquire();
+
+    return static_cast<int>(static_cast<unsigned int>(ends)
+                                  - static_cast<unsigned int>(ends >> 32));
+}
+
+const ConcurrentRecordBuffer::Entry&
+ConcurrentRecordBuffer::sequenceEntry(End end) const
+{
+    const int length = d_sequenceLength.loadRelaxed();
+
+    BSLS_ASSERT(0 < length);
+
+    return e_FRONT == end
+           ? d_sequence[d_sequenceFront]
+           : d_sequence[(d_sequenceFront + length - 1) & (d_capacity - 1)];
+}
+
+// CREATORS
+ConcurrentRecordBuffer::ConcurrentRecordBuffer(
+                                          int               maxTotalSize,
+                                          bslma::Allocator *basicAllocator)
+: d_slots_p(0)
+, d_capacity(2)
+, d_maxTotalSize(maxTotalSize)
+, d_slotsPad()
+, d_ends(0)
+, d_endsPad()
+, d_totalSize(0)
+, d_totalSizePad()
+, d_sequenceDepth(0)
+, d_sequenceThread(0)
+, d_sequenceMutex()
+, d_sequence(basicAllocator)
+, d_sequenceFront(0)
+, d_sequenceLength(0)
+, d_sequenceSize(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < maxTotalSize);
+
+    const int minRecordSize = static_cast<int>(
+               bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Record)));
+    const int maxNumRecords = maxTotalSize / minRecordSize;
+
+    while (d_capacity < static_cast<unsigned int>(maxNumRecords)
+        && d_capacity < static_cast<unsigned int>(k_MAX_CAPACITY)) {
+        d_capacity <<= 1;
+    }
+
+    d_sequence.resize(d_capacity);
+
+    d_slots_p = static_cast<Slot *>(
+                           d_allocator_p->allocate(d_capacity * sizeof(Slot)));
+    for (unsigned int i = 0; i < d_capacity; ++i) {
+        new (d_slots_p + i) Slot();
+    }
+}
+
+ConcurrentRecordBuffer::~ConcurrentRecordBuffer()
+{
+    while (popRing(0, e_FRONT)) {
+    }
+
+    for (unsigned int i = 0; i < d_capacity; ++i) {
+        d_slots_p[i].~Slot();
+    }
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+// MANIPULATORS
+void ConcurrentRecordBuffer::beginSequence()
+{
+    if (holdsSequence()) {
+        d_sequenceDepth.storeRelease(d_sequenceDepth.loadRelaxed() + 1);
+        return;                                                       // RETURN
+    }
+
+    d_sequenceMutex.lock();
+
+    BSLS_ASSERT(0 == d_sequenceLength.loadRelaxed());
+
+    // Move the records in the ring to the sequence, oldest first.  Records
+    // pushed concurrently at the back of the ring after 'numRecords' is
+    // loaded remain in the ring.
+
+    const int numRecords = ringLength();
+
+    for (int i = 0; i < numRecords; ++i) {
+        Entry& entry = d_sequence[(d_sequenceFront + i) & (d_capacity - 1)];
+
+        if (!popRing(&entry, e_FRONT)) {
+            break;
+        }
+        d_sequenceLength.storeRelaxed(i + 1);
+        d_sequenceSize += entry.d_size;
+    }
+
+    d_sequenceThread.storeRelaxed(bslmt::ThreadUtil::selfIdAsUint64());
+    d_sequenceDepth.storeRelease(1);
+}
+
+void ConcurrentRecordBuffer::endSequence()
+{
+    BSLS_ASSERT(holdsSequence());
+
+    const int depth = d_sequenceDepth.loadRelaxed() - 1;
+
+    if (0 < depth) {
+        d_sequenceDepth.storeRelease(depth);
+        return;                                                       // RETURN
+    }
+
+    // Return the remaining records to the front of the ring, newest first.  If
+    // the ring fills up with records pushed during the sequence, the oldest
+    // records are discarded instead.
+
+    while (0 < d_sequenceLength.loadRelaxed()) {
+        Entry entry;
+        popSequence(&entry, e_BACK);
+
+        if (!pushRing(entry.d_handle, entry.d_size, e_FRONT, false)) {
+            d_totalSize.add(-entry.d_size);
+
+            while (0 < d_sequenceLength.loadRelaxed()) {
+                popSequence(&entry, e_FRONT);
+                d_totalSize.add(-entry.d_size);
+            }
+        }
+    }
+    d_sequenceFront = 0;
+
+    d_sequenceDepth.storeRelease(0);
+    d_sequenceMutex.unlock();
+}
+
+void ConcurrentRecordBuffer::popBack()
+{
+    if (holdsSequence()) {
+        Entry removed;
+        popSequence(&removed, e_BACK);
+        d_totalSize.add(-removed.d_size);
+    }
+    else {
+        removeRecord(e_BACK);
+    }
+}
+
+void ConcurrentRecordBuffer::popFront()
+{
+    if (holdsSequence()) {
+        Entry removed;
+        popSequence(&removed, e_FRONT);
+        d_totalSize.add(-removed.d_size);
+    }
+    else {
+        removeRecord(e_FRONT);
+    }
+}
+
+int ConcurrentRecordBuffer::pushBack(const bsl::shared_ptr<Record>& handle)
+{
+    return holdsSequence() ? pushSequence(handle, e_BACK)
+                           : pushRecord(handle, e_BACK);
+}
+
+int ConcurrentRecordBuffer::pushFront(const bsl::shared_ptr<Record>& handle)
+{
+    return holdsSequence() ? pushSequence(handle, e_FRONT)
+                           : pushRecord(handle, e_FRONT);
+}
+
+void ConcurrentRecordBuffer::removeAll()
+{
+    if (holdsSequence()) {
+        while (0 < d_sequenceLength.loadRelaxed()) {
+            Entry removed;
+            popSequence(&removed, e_FRONT);
+            d_totalSize.add(-removed.d_size);
+        }
+    }
+
+    // Records pushed after 'numRecords' is loaded are not removed.
+
+    const int numRecords = ringLength();
+
+    for (int i = 0; i < numRecords; ++i) {
+        Entry removed;
+        if (!popRing(&removed, e_FRONT)) {
+            break;
+        }
+        d_totalSize.add(-removed.d_size);
+    }
+}
+
+// ACCESSORS
+const bsl::shared_ptr<Record>& ConcurrentRecordBuffer::back() const
+{
+    BSLS_ASSERT_SAFE(holdsSequence());
+
+    return sequenceEntry(e_BACK).d_handle;
+}
+
+const bsl::shared_ptr<Record>& ConcurrentRecordBuffer::front() const
+{
+    BSLS_ASSERT_SAFE(holdsSequence());
+
+    return sequenceEntry(e_FRONT).d_handle;
+}
+
+int ConcurrentRecordBuffer::length() const
+{
+    const int sequenceLength = d_sequenceLength.loadRelaxed();
+
+    return holdsSequence() ? sequenceLength : ringLength() + sequenceLength;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,536 @@
+// ball_concurrentrecordbuffer.h                                      -*-C++-*-
+#ifndef INCLUDED_BALL_CONCURRENTRECORDBUFFER
+#define INCLUDED_BALL_CONCURRENTRECORDBUFFER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free bounded buffer of record handles.
+//
+//@CLASSES:
+//  ball::ConcurrentRecordBuffer: lock-free bounded buffer of record handles
+//
+//@SEE_ALSO: ball_recordbuffer, ball_fixedsizerecordbuffer, ball_loggermanager
+//
+//@DESCRIPTION: This component provides a concrete thread-safe implementation
+// of the 'ball::RecordBuffer' protocol, 'ball::ConcurrentRecordBuffer':
+//..
+//              ( ball::ConcurrentRecordBuffer )
+//                            |              ctor
+//                            V
+//                  ( ball::RecordBuffer )
+//                                           dtor
+//                                           beginSequence
+//                                           endSequence
+//                                           popBack
+//                                           popFront
+//                                           pushBack
+//                                           pushFront
+//                                           removeAll
+//                                           length
+//                                           back
+//                                           front
+//..
+// Like 'ball::FixedSizeRecordBuffer', a 'ball::ConcurrentRecordBuffer' manages
+// record handles (specifically, instances of 'bsl::shared_ptr<ball::Record>')
+// in a double-ended buffer whose contents are limited by the total size of
+// the contained records: the sum of the sizes of the contained records is
+// bounded by a 'maxTotalSize' specified at creation.  Records are removed from
+// the front of the buffer to accommodate a 'pushBack' request, and from the
+// back of the buffer to accommodate a 'pushFront' request.  A record that can
+// not be accommodated at all is silently (but otherwise safely) discarded.
+//
+// Unlike 'ball::FixedSizeRecordBuffer', a 'ball::ConcurrentRecordBuffer' does
+// not serialize access to its contents with a mutex.  Record handles are held
+// in a pre-allocated ring of slots, and the positions of both ends of the
+// buffer are updated together by a single atomic compare-and-swap, so that
+// threads that concurrently push records -- typically all of the threads of a
+// process logging records below the "pass" threshold -- contend only briefly
+// on that word, and never on a lock.  Pushing a record does not allocate
+// memory.
+//
+///Sequences
+///---------
+// 'beginSequence' does *not* stop other threads from pushing records.
+// Instead, it moves the records currently in the buffer to a private sequence
+// that is accessible only to the thread that called 'beginSequence'.  Until
+// that thread calls 'endSequence':
+//
+//: o All methods invoked by the sequence thread (including 'length', 'back',
+//:   'front', the push methods, and the pop methods) operate on the records of
+//:   the sequence only, which are therefore not changed by other threads.
+//:
+//: o Records pushed by other threads are added to the buffer, but are not
+//:   part of the sequence, and are available to the next sequence.
+//:
+//: o Only one thread at a time can hold a sequence; other threads calling
+//:   'beginSequence' block until 'endSequence' is called.
+//
+// 'endSequence' returns any records remaining in the sequence to the front of
+// the buffer, ahead of (i.e., older than) the records pushed during the
+// sequence.  Calls to 'beginSequence' may be nested; only the outermost call
+// to 'endSequence' ends the sequence.
+//
+// Therefore, when a record logged at "trigger" severity causes
+// 'ball::LoggerManager' to publish the contents of a buffer (which it does
+// between calls to 'beginSequence' and 'endSequence'), the other threads of
+// the process continue to log records without waiting for that publication to
+// complete.
+//
+///Size Limit
+///----------
+// The size of a record is the value returned by its 'numAllocatedBytes'
+// method, plus the size of a 'ball::Record' object.  The sum of the sizes of
+// the records in the buffer never exceeds 'maxTotalSize' once all concurrent
+// push operations have completed; while a push is in progress the limit may
+// be exceeded by the size of the pushed record, until the pushing thread
+// removes records to restore it.  Records held by a sequence count against the
+// limit; records pushed by other threads during a sequence are discarded if
+// the limit can not be restored by removing records that are not in the
+// sequence.
+//
+// The ring of slots is allocated at construction, with one slot for each
+// record of minimal size (i.e., a 'ball::Record' object) that fits within
+// 'maxTotalSize', up to a maximum of 2^20 slots.  Neither the ring nor the
+// storage reserved for sequences counts against 'maxTotalSize'.
+//
+///Progress Guarantee
+///------------------
+// To push or pop a record, a thread briefly holds the slot of the ring at the
+// position to be claimed, moves the end of the buffer with a compare-and-swap
+// (which fails only if another thread has moved an end of the buffer), and
+// copies the record handle into or out of the slot.  A thread never waits
+// while holding a slot, and no slot is held for longer than it takes to copy
+// a 'bsl::shared_ptr'.  However, if a thread is descheduled while holding a
+// slot, other threads needing that slot wait, yielding their processor, until
+// it is released.  'beginSequence' is the only method that can block for a
+// longer period (see {Sequences}).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Recent Records from a Busy Process
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example, several threads store records into a buffer,
+// while another thread publishes the contents of the buffer in LIFO order.
+//
+// First, we create a buffer whose records may total at most 32K bytes:
+//..
+//  enum {
+//      k_MAX_TOTAL_SIZE = 32 * 1024,
+//      k_NUM_RECORDS    = 1000,
+//      k_NUM_THREADS    = 4
+//  };
+//
+//  bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+//
+//  ball::ConcurrentRecordBuffer recordBuffer(k_MAX_TOTAL_SIZE, allocator);
+//..
+// Then, we define a function, executed by each of the worker threads, that
+// creates records and pushes them into the buffer:
+//..
+//  extern "C" void *workerThread(void *arg)
+//  {
+//      int id = static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(arg));
+//
+//      for (int i = 0; i < k_NUM_RECORDS; ++i) {
+//          bsl::shared_ptr<ball::Record> handle;
+//          handle.createInplace(allocator, allocator);
+//
+//          char message[64];
+//          bsl::sprintf(message, "message %d from thread %d", i, id);
+//          handle->fixedFields().setMessage(message);
+//
+//          recordBuffer.pushBack(handle);
+//      }
+//      return 0;
+//  }
+//..
+// Next, we start the worker threads:
+//..
+//  bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+//  for (bsls::Types::IntPtr i = 0; i < k_NUM_THREADS; ++i) {
+//      bslmt::ThreadUtil::create(&threads[i],
+//                                workerThread,
+//                                reinterpret_cast<void *>(i));
+//  }
+//..
+// Then, while the workers are still pushing records, we publish the records
+// currently in the buffer, most recent first.  The length of the sequence
+// does not change while we iterate, although the workers are not stopped:
+//..
+//  recordBuffer.beginSequence();
+//
+//  const int length = recordBuffer.length();
+//  for (int i = 0; i < length; ++i) {
+//      const ball::Record& record = *recordBuffer.back();
+//      if (verbose) {
+//          bsl::cout << record.fixedFields().message() << bsl::endl;
+//      }
+//      recordBuffer.popBack();
+//  }
+//  assert(0 == recordBuffer.length());
+//
+//  recordBuffer.endSequence();
+//..
+// Finally, we join the worker threads, and observe that the records pushed
+// after the sequence began remain in the buffer, and that their sizes total
+// at most 32K bytes:
+//..
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      bslmt::ThreadUtil::join(threads[i]);
+//  }
+//  assert(k_MAX_TOTAL_SIZE >= recordBuffer.totalSize());
+//..
+
+#include <balscm_version.h>
+
+#include <ball_record.h>
+#include <ball_recordbuffer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+
+#include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                        // ============================
+                        // class ConcurrentRecordBuffer
+                        // ============================
+
+class ConcurrentRecordBuffer : public RecordBuffer {
+    // This class provides a concrete, thread-safe implementation of the
+    // 'RecordBuffer' protocol that does not serialize access to its contents
+    // with a lock.  The sum of the sizes of the records contained in a
+    // 'ConcurrentRecordBuffer' object is bounded by an upper limit specified
+    // at creation.  'beginSequence' moves the contents of the buffer to a
+    // sequence private to the calling thread, and does not block other
+    // threads from pushing records.  See the component documentation for
+    // details.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    enum End {
+        // This enumeration identifies an end of the buffer.
+
+        e_FRONT,
+        e_BACK
+    };
+
+    enum SlotState {
+        // This enumeration defines the states of a slot in the ring.
+
+        e_EMPTY,  // the slot holds no record handle
+        e_BUSY,   // a thread is filling or emptying the slot
+        e_FULL    // the slot holds a record handle
+    };
+
+    struct Slot {
+        // This 'struct' defines a slot of the ring holding a record handle.
+
+        bsls::AtomicInt                              d_state;   // 'SlotState'
+        int                                          d_size;    // record size
+        bsls::ObjectBuffer<bsl::shared_ptr<Record> > d_handle;  // if 'e_FULL'
+    };
+
+    struct Entry {
+        // This 'struct' defines an entry of a sequence.
+
+        bsl::shared_ptr<Record> d_handle;  // record handle
+        int                     d_size;    // record size
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_MAX_CAPACITY   = 1 << 20,  // maximum number of slots in the ring
+
+        k_INT64_PADDING  = bslmt::Platform::e_CACHE_LINE_SIZE
+                         - sizeof(bsls::AtomicUint64),
+
+        k_INT_PADDING    = bslmt::Platform::e_CACHE_LINE_SIZE
+                         - sizeof(bsls::AtomicInt)
+    };
+
+    // DATA
+    Slot                 *d_slots_p;         // ring of slots (owned)
+
+    unsigned int          d_capacity;        // number of slots (a power of
+                                             // two)
+
+    int                   d_maxTotalSize;    // maximum sum of the sizes of
+                                             // the contained records
+
+    const char            d_slotsPad[k_INT64_PADDING];
+                                             // padding to prevent false
+                                             // sharing
+
+    bsls::AtomicUint64    d_ends;            // position of the front (high
+                                             // 32 bits) and one past the back
+                                             // (low 32 bits) of the ring
+
+    const char            d_endsPad[k_INT64_PADDING];
+                                             // padding to prevent false
+                                             // sharing
+
+    bsls::AtomicInt       d_totalSize;       // sum of the sizes of the
+                                             // contained records (including
+                                             // the sequence)
+
+    const char            d_totalSizePad[k_INT_PADDING];
+                                             // padding to prevent false
+                                             // sharing
+
+    bsls::AtomicInt       d_sequenceDepth;   // number of nested calls to
+                                             // 'beginSequence' by the
+                                             // sequence thread
+
+    bsls::AtomicUint64    d_sequenceThread;  // id of the thread holding the
+                                             // sequence, if 0 < depth
+
+    bslmt::Mutex          d_sequenceMutex;   // held by the sequence thread
+
+    bsl::vector<Entry>    d_sequence;        // ring of the records of the
+                                             // sequence
+
+    unsigned int          d_sequenceFront;   // index of the front of the
+                                             // sequence in 'd_sequence'
+
+    bsls::AtomicInt       d_sequenceLength;  // number of records in the
+                                             // sequence
+
+    int                   d_sequenceSize;    // sum of the sizes of the
+                                             // records in the sequence
+
+    bslma::Allocator     *d_allocator_p;     // memory allocator (held, not
+                                             // owned)
+
+    // PRIVATE CLASS METHODS
+    static int recordSize(const Record& record);
+        // Return the size of the specified 'record' as counted against the
+        // maximum total size of a buffer.
+
+    // PRIVATE MANIPULATORS
+    void discardRecords(End end);
+        // Remove records that are not in the sequence from the specified
+        // 'end' of this buffer until the sum of the sizes of the contained
+        // records does not exceed the maximum total size, or no such records
+        // remain.
+
+    bool popRing(Entry *result, End end);
+        // Remove the record at the specified 'end' of the ring and, if
+        // 'result' is not 0, load its handle and size into 'result'.  Return
+        // 'true' if a record was removed, and 'false' if the ring is empty.
+        // Note that this method does not update the total size.
+
+    bool pushRing(const bsl::shared_ptr<Record>& handle,
+                  int                            size,
+                  End                            end,
+                  bool                           replace);
+        // Add the specified 'handle' to a record having the specified 'size'
+        // at the specified 'end' of the ring.  If the ring is full and the
+        // specified 'replace' is 'true', first remove the record at the
+        // opposite end of the ring (subtracting its size from the total
+        // size).  Return 'true' if 'handle' was added, and 'false' if the
+        // ring is full and 'replace' is 'false'.  Note that this method does
+        // not add 'size' to the total size.
+
+    void popSequence(Entry *result, End end);
+        // Remove the record at the specified 'end' of the sequence and, if
+        // 'result' is not 0, load its handle and size into 'result'.  The
+        // behavior is undefined unless the calling thread holds the sequence
+        // and the sequence is not empty.  Note that this method updates the
+        // size of the sequence, but not the total size.
+
+    int pushSequence(const bsl::shared_ptr<Record>& handle, End end);
+        // Add the specified 'handle' at the specified 'end' of the sequence,
+        // removing records from the opposite end of the sequence until the
+        // records of the sequence satisfy the size limit of this buffer, and
+        // then removing records pushed to the buffer during the sequence, if
+        // necessary, to satisfy the size limit.  Return 0 on success, and a
+        // non-zero value if the record can not be accommodated.  The behavior
+        // is undefined unless the calling thread holds the sequence.
+
+    int pushRecord(const bsl::shared_ptr<Record>& handle, End end);
+        // Add the specified 'handle' at the specified 'end' of this buffer,
+        // removing records from the opposite end to satisfy the size limit of
+        // this buffer.  Return 0 on success, and a non-zero value if the
+        // record can not be accommodated.
+
+    void removeRecord(End end);
+        // Remove the record at the specified 'end' of this buffer.
+
+    // PRIVATE ACCESSORS
+    bool holdsSequence() const;
+        // Return 'true' if the calling thread holds the sequence of this
+        // buffer, and 'false' otherwise.
+
+    int ringLength() const;
+        // Return the number of records in the ring (i.e., that are not in the
+        // sequence).
+
+    const Entry& sequenceEntry(End end) const;
+        // Return a reference providing non-modifiable access to the entry at
+        // the specified 'end' of the sequence.  The behavior is undefined
+        // unless the sequence is not empty.
+
+    // NOT IMPLEMENTED
+    ConcurrentRecordBuffer(const ConcurrentRecordBuffer&);
+    ConcurrentRecordBuffer& operator=(const ConcurrentRecordBuffer&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ConcurrentRecordBuffer,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit ConcurrentRecordBuffer(int               maxTotalSize,
+                                    bslma::Allocator *basicAllocator = 0);
+        // Create an empty record buffer such that the sum of the sizes of
+        // the contained records is at most the specified 'maxTotalSize'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < maxTotalSize'.  Note
+        // that the memory used by the buffer itself is allocated at
+        // construction, and does not count against 'maxTotalSize' (see {Size
+        // Limit}).
+
+    virtual ~ConcurrentRecordBuffer();
+        // Remove all record handles from this record buffer and destroy this
+        // record buffer.  The behavior is undefined unless no thread is
+        // accessing this buffer.
+
+    // MANIPULATORS
+    virtual void beginSequence();
+        // Move the records in this buffer to a sequence that is accessed by
+        // all methods invoked by the calling thread, and not by other
+        // threads, until 'endSequence' is called, blocking until no other
+        // thread holds a sequence.  If the calling thread already holds the
+        // sequence, only increment the nesting depth of the sequence.  See
+        // {Sequences}.
+
+    virtual void endSequence();
+        // Decrement the nesting depth of the sequence held by the calling
+        // thread and, if it becomes 0, return any records remaining in the
+        // sequence to the front of this buffer and release the sequence.  The
+        // behavior is undefined unless the calling thread holds the sequence.
+
+    virtual void popBack();
+        // Remove from this record buffer the record handle positioned at the
+        // back end of the buffer (or of the sequence, if the calling thread
+        // holds the sequence).  If the calling thread does not hold the
+        // sequence and no records are available outside of the sequence
+        // (e.g., because they were concurrently removed by other threads),
+        // this method has no effect.  The behavior is undefined if the
+        // calling thread holds the sequence and '0 == length()'.
+
+    virtual void popFront();
+        // Remove from this record buffer the record handle positioned at the
+        // front end of the buffer (or of the sequence, if the calling thread
+        // holds the sequence).  If the calling thread does not hold the
+        // sequence and no records are available outside of the sequence
+        // (e.g., because they were concurrently removed by other threads),
+        // this method has no effect.  The behavior is undefined if the
+        // calling thread holds the sequence and '0 == length()'.
+
+    virtual int pushBack(const bsl::shared_ptr<Record>& handle);
+        // Push the specified 'handle' at the back end of this record buffer
+        // (or of the sequence, if the calling thread holds the sequence).
+        // Return 0 on success, and a non-zero value otherwise.  In order to
+        // accommodate a record, the records from the front end of the buffer
+        // may be removed.  If a record can not be accommodated in the buffer,
+        // it is silently discarded.
+
+    virtual int pushFront(const bsl::shared_ptr<Record>& handle);
+        // Push the specified 'handle' at the front end of this record buffer
+        // (or of the sequence, if the calling thread holds the sequence).
+        // Return 0 on success, and a non-zero value otherwise.  In order to
+        // accommodate a record, the records from the back end of the buffer
+        // may be removed.  If a record can not be accommodated in the buffer,
+        // it is silently discarded.
+
+    virtual void removeAll();
+        // Remove all record handles stored in this record buffer (including
+        // those in the sequence, if the calling thread holds the sequence).
+        // Note that records pushed concurrently by other threads may remain.
+
+    // ACCESSORS
+    virtual const bsl::shared_ptr<Record>& back() const;
+        // Return a reference of the shared pointer referring to the record
+        // positioned at the back end of the sequence.  The behavior is
+        // undefined unless the calling thread holds the sequence (i.e., has
+        // called 'beginSequence') and '0 < length()'.
+
+    virtual const bsl::shared_ptr<Record>& front() const;
+        // Return a reference of the shared pointer referring to the record
+        // positioned at the front end of the sequence.  The behavior is
+        // undefined unless the calling thread holds the sequence (i.e., has
+        // called 'beginSequence') and '0 < length()'.
+
+    virtual int length() const;
+        // Return the number of record handles in the sequence, if the calling
+        // thread holds the sequence, and in this record buffer (including
+        // any sequence) otherwise.
+
+    int maxTotalSize() const;
+        // Return the maximum sum of the sizes of the records in this buffer.
+
+    int totalSize() const;
+        // Return the sum of the sizes of the records in this buffer
+        // (including any sequence).
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class ConcurrentRecordBuffer
+                        // ----------------------------
+
+// ACCESSORS
+inline
+int ConcurrentRecordBuffer::maxTotalSize() const
+{
+    return d_maxTotalSize;
+}
+
+inline
+int ConcurrentRecordBuffer::totalSize() const
+{
+    return d_totalSize.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
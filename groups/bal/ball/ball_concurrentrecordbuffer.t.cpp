@@ -0,0 +1,1316 @@
+// ball_concurrentrecordbuffer.t.cpp                                  -*-C++-*-
+#include <ball_concurrentrecordbuffer.h>
+
+#include <ball_fixedsizerecordbuffer.h>
+#include <ball_record.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'ball::ConcurrentRecordBuffer' is a bounded double-ended buffer of record
+// handles that does not serialize access with a lock.  We first verify, in a
+// single thread, the push and pop methods at both ends of the buffer, the
+// accounting of the total size of the contained records, and the removal of
+// records to satisfy the size limit.  We then verify the semantics of
+// sequences: records are moved to a sequence private to the calling thread,
+// records pushed by other threads during a sequence are not part of it, and
+// records remaining in the sequence are returned to the front of the buffer.
+// Finally, we verify with multiple threads that concurrent pushes preserve
+// the order of each thread's records, that sequences are not disturbed by
+// concurrent pushes, and that no record is leaked or destroyed prematurely
+// when all of the manipulators are invoked concurrently.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ConcurrentRecordBuffer(int maxTotalSize, bslma::Allocator *ba = 0);
+// [ 4] ~ConcurrentRecordBuffer();
+//
+// MANIPULATORS
+// [ 6] void beginSequence();
+// [ 6] void endSequence();
+// [ 3] void popBack();
+// [ 2] void popFront();
+// [ 2] int pushBack(const bsl::shared_ptr<Record>& handle);
+// [ 3] int pushFront(const bsl::shared_ptr<Record>& handle);
+// [ 4] void removeAll();
+//
+// ACCESSORS
+// [ 2] const bsl::shared_ptr<Record>& back() const;
+// [ 2] const bsl::shared_ptr<Record>& front() const;
+// [ 2] int length() const;
+// [ 2] int maxTotalSize() const;
+// [ 2] int totalSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] SIZE LIMIT
+// [ 7] CONCURRENT PUSHES AND SEQUENCES
+// [ 8] CONCURRENCY STRESS TEST
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE: CONCURRENT VS. FIXED-SIZE RECORD BUFFER
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::ConcurrentRecordBuffer  Obj;
+typedef bsl::shared_ptr<ball::Record> Handle;
+
+static bool verbose;
+static bool veryVerbose;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static Handle makeRecord(int               id,
+                         bslma::Allocator *allocator,
+                         const char       *message = "")
+    // Return a handle to a new record, allocated from the specified
+    // 'allocator', identified by the specified 'id' (stored as its line
+    // number) and optionally having the specified 'message'.
+{
+    Handle handle;
+    handle.createInplace(allocator, allocator);
+    handle->fixedFields().setLineNumber(id);
+    handle->fixedFields().setMessage(message);
+    return handle;
+}
+
+static int recordId(const Handle& handle)
+    // Return the identifier of the record referred to by the specified
+    // 'handle'.
+{
+    return handle->fixedFields().lineNumber();
+}
+
+static int recordSize(const Handle& handle)
+    // Return the size of the record referred to by the specified 'handle',
+    // as counted against the size limit of a record buffer.
+{
+    return handle->numAllocatedBytes()
+         + static_cast<int>(
+               bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                        sizeof(ball::Record)));
+}
+
+static bsl::vector<int> drain(Obj *buffer)
+    // Remove all of the records from the specified 'buffer' within a
+    // sequence, and return their identifiers, front first.
+{
+    bsl::vector<int> ids;
+    buffer->beginSequence();
+    while (0 < buffer->length()) {
+        ids.push_back(recordId(buffer->front()));
+        buffer->popFront();
+    }
+    buffer->endSequence();
+    return ids;
+}
+
+static void pushRecords(Obj              *buffer,
+                        int               firstId,
+                        int               numRecords,
+                        bslma::Allocator *allocator)
+    // Push to the back of the specified 'buffer' the specified 'numRecords'
+    // records, allocated from the specified 'allocator', identified by
+    // consecutive integers starting at the specified 'firstId'.
+{
+    for (int i = 0; i < numRecords; ++i) {
+        buffer->pushBack(makeRecord(firstId + i, allocator));
+    }
+}
+
+static void loadLength(const Obj *buffer, int *result)
+    // Load the length of the specified 'buffer' into the specified 'result'.
+{
+    *result = buffer->length();
+}
+
+// ============================================================================
+//                       CASE-SPECIFIC HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace CASE7 {
+
+enum {
+    k_NUM_PRODUCERS = 4,
+    k_NUM_RECORDS   = 5000,
+    k_ID_SHIFT      = 16
+};
+
+void producer(Obj              *buffer,
+              bslmt::Barrier   *barrier,
+              int               producerId,
+              bslma::Allocator *allocator,
+              bsls::AtomicInt  *done)
+    // Push 'k_NUM_RECORDS' records, identifying the specified 'producerId'
+    // and a sequence number, to the back of the specified 'buffer' after
+    // waiting on the specified 'barrier', allocating the records from the
+    // specified 'allocator', and increment the specified 'done' when
+    // finished.
+{
+    Handle handle;
+    barrier->wait();
+    for (int i = 0; i < k_NUM_RECORDS; ++i) {
+        handle = makeRecord((producerId << k_ID_SHIFT) | i, allocator);
+        LOOP2_ASSERT(producerId, i, 0 == buffer->pushBack(handle));
+    }
+    ++*done;
+}
+
+}  // close namespace CASE7
+
+namespace CASE8 {
+
+enum {
+    k_NUM_THREADS    = 4,
+    k_NUM_ITERATIONS = 4000
+};
+
+void worker(Obj              *buffer,
+            bslmt::Barrier   *barrier,
+            int               threadId,
+            bslma::Allocator *allocator)
+    // Invoke a pseudo-random sequence of the manipulators of the specified
+    // 'buffer', using the specified 'threadId' to seed the sequence, after
+    // waiting on the specified 'barrier', and allocating records from the
+    // specified 'allocator'.
+{
+    unsigned int seed = 1 + threadId;
+
+    barrier->wait();
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        seed = seed * 1103515245 + 12345;
+
+        const int id = (threadId << 16) | i;
+
+        switch ((seed >> 16) % 16) {
+          case 0: {
+            buffer->pushFront(makeRecord(id, allocator));
+          } break;
+          case 1: {
+            buffer->popBack();
+          } break;
+          case 2: {
+            buffer->popFront();
+          } break;
+          case 3: {
+            if (0 == (seed >> 20) % 8) {
+                buffer->removeAll();
+            }
+          } break;
+          case 4: {
+            buffer->beginSequence();
+
+            const int length = buffer->length();
+            int       sum    = 0;
+            for (int j = 0; j < length; ++j) {
+                sum += recordSize(buffer->back());
+                buffer->popBack();
+            }
+            LOOP2_ASSERT(length, buffer->length(), 0 == buffer->length());
+            LOOP_ASSERT(sum, 0 <= sum);
+
+            buffer->pushBack(makeRecord(id, allocator));
+            buffer->endSequence();
+          } break;
+          case 5: {
+            buffer->beginSequence();
+            buffer->beginSequence();
+
+            const int length = buffer->length();
+            if (0 < length) {
+                const int frontId = recordId(buffer->front());
+                buffer->pushFront(makeRecord(id, allocator));
+                LOOP2_ASSERT(frontId,
+                             recordId(buffer->front()),
+                             id == recordId(buffer->front()));
+                buffer->popFront();
+                LOOP2_ASSERT(frontId,
+                             recordId(buffer->front()),
+                             frontId == recordId(buffer->front()));
+            }
+            buffer->endSequence();
+
+            // 'pushFront' may have removed the record at the back to satisfy
+            // the size limit.
+
+            LOOP2_ASSERT(length,
+                         buffer->length(),
+                         length     >= buffer->length() &&
+                         length - 1 <= buffer->length());
+            buffer->endSequence();
+          } break;
+          default: {
+            buffer->pushBack(makeRecord(id, allocator));
+          } break;
+        }
+    }
+}
+
+}  // close namespace CASE8
+
+namespace CASE_MINUS_1 {
+
+template <class BUFFER>
+void producer(BUFFER         *buffer,
+              bslmt::Barrier *barrier,
+              const Handle   *handle,
+              int             numRecords)
+    // Push the specified 'handle' to the back of the specified 'buffer' the
+    // specified 'numRecords' times, after waiting on the specified 'barrier'.
+{
+    barrier->wait();
+    for (int i = 0; i < numRecords; ++i) {
+        buffer->pushBack(*handle);
+    }
+}
+
+template <class BUFFER>
+void runBenchmark(const char *name,
+                  int         numThreads,
+                  int         numRecords,
+                  int         numDumps)
+    // Push 'numRecords' records from each of the specified 'numThreads'
+    // threads to a buffer of the (template parameter) 'BUFFER' type, while
+    // the main thread publishes the contents of the buffer, within a
+    // sequence, the specified 'numDumps' times, and report the elapsed time
+    // per record using the specified 'name' for the buffer type.
+{
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+    BUFFER         buffer(64 * 1024, allocator);
+    bslmt::Barrier barrier(numThreads + 1);
+    Handle         handle = makeRecord(0, allocator, "benchmark record");
+
+    bsl::vector<bslmt::ThreadUtil::Handle> threads(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::create(&threads[i],
+                                  bdlf::BindUtil::bind(&producer<BUFFER>,
+                                                       &buffer,
+                                                       &barrier,
+                                                       &handle,
+                                                       numRecords));
+    }
+
+    bsls::Stopwatch timer;
+    barrier.wait();
+    timer.start(true);
+
+    for (int i = 0; i < numDumps; ++i) {
+        buffer.beginSequence();
+        const int length = buffer.length();
+        for (int j = 0; j < length; ++j) {
+            buffer.popFront();
+        }
+        buffer.endSequence();
+        bslmt::ThreadUtil::microSleep(100);
+    }
+
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(threads[i]);
+    }
+    timer.stop();
+
+    const double total = static_cast<double>(numThreads) * numRecords;
+
+    cout << name
+         << "\tthreads: " << numThreads
+         << "\tns/record: " << timer.elapsedTime() * 1e9 / total
+         << "\tCPU ns/record: "
+         << (timer.accumulatedUserTime() + timer.accumulatedSystemTime())
+                                                                  * 1e9 / total
+         << endl;
+}
+
+}  // close namespace CASE_MINUS_1
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Recent Records from a Busy Process
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example, several threads store records into a buffer,
+// while another thread publishes the contents of the buffer in LIFO order.
+//
+// First, we create a buffer whose records may total at most 32K bytes:
+//..
+    enum {
+        k_MAX_TOTAL_SIZE = 32 * 1024,
+        k_NUM_RECORDS    = 1000,
+        k_NUM_THREADS    = 4
+    };
+
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+    ball::ConcurrentRecordBuffer recordBuffer(k_MAX_TOTAL_SIZE, allocator);
+//..
+// Then, we define a function, executed by each of the worker threads, that
+// creates records and pushes them into the buffer:
+//..
+    extern "C" void *workerThread(void *arg)
+    {
+        int id = static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(arg));
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::shared_ptr<ball::Record> handle;
+            handle.createInplace(allocator, allocator);
+
+            char message[64];
+            bsl::sprintf(message, "message %d from thread %d", i, id);
+            handle->fixedFields().setMessage(message);
+
+            recordBuffer.pushBack(handle);
+        }
+        return 0;
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE"
+                          << endl << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Next, we start the worker threads:
+//..
+    bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+    for (bsls::Types::IntPtr i = 0; i < k_NUM_THREADS; ++i) {
+        bslmt::ThreadUtil::create(&threads[i],
+                                  workerThread,
+                                  reinterpret_cast<void *>(i));
+    }
+//..
+// Then, while the workers are still pushing records, we publish the records
+// currently in the buffer, most recent first.  The length of the sequence
+// does not change while we iterate, although the workers are not stopped:
+//..
+    recordBuffer.beginSequence();
+
+    const int length = recordBuffer.length();
+    for (int i = 0; i < length; ++i) {
+        const ball::Record& record = *recordBuffer.back();
+        if (verbose) {
+            bsl::cout << record.fixedFields().message() << bsl::endl;
+        }
+        recordBuffer.popBack();
+    }
+    ASSERT(0 == recordBuffer.length());
+
+    recordBuffer.endSequence();
+//..
+// Finally, we join the worker threads, and observe that the records pushed
+// after the sequence began remain in the buffer, and that their sizes total
+// at most 32K bytes:
+//..
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        bslmt::ThreadUtil::join(threads[i]);
+    }
+    ASSERT(k_MAX_TOTAL_SIZE >= recordBuffer.totalSize());
+//..
+
+        recordBuffer.removeAll();
+        ASSERT(0 == recordBuffer.totalSize());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY STRESS TEST
+        //
+        // Concerns:
+        //: 1 All of the manipulators, including sequences, can be invoked
+        //:   concurrently without corrupting the buffer.
+        //:
+        //: 2 Within a sequence, the records of the sequence are changed only
+        //:   by the thread holding the sequence.
+        //:
+        //: 3 Every record is released exactly once: no record is leaked, and
+        //:   the total size is consistent with the remaining records.
+        //
+        // Plan:
+        //: 1 Run several threads, each invoking a pseudo-random sequence of
+        //:   the manipulators on a buffer small enough that records are
+        //:   frequently removed to satisfy the size limit, and verifying the
+        //:   records of the sequence while holding one.  (C-1..2)
+        //:
+        //: 2 After joining the threads, verify that the total size equals the
+        //:   sum of the sizes of the remaining records, that 'removeAll'
+        //:   leaves the buffer empty, and that all of the memory of the
+        //:   records has been returned to the test allocator.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY STRESS TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY STRESS TEST"
+                          << endl << "=======================" << endl;
+
+        using namespace CASE8;
+
+        bslma::TestAllocator ta("records", veryVerbose);
+        bslma::TestAllocator oa("object",  veryVerbose);
+
+        {
+            const int RECORD_SIZE = recordSize(makeRecord(0, &ta));
+
+            Obj            mX(16 * RECORD_SIZE, &oa);
+            bslmt::Barrier barrier(k_NUM_THREADS);
+
+            bsl::vector<bslmt::ThreadUtil::Handle> threads(k_NUM_THREADS);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &threads[i],
+                                    bdlf::BindUtil::bind(&worker,
+                                                         &mX,
+                                                         &barrier,
+                                                         i,
+                                                         &ta)));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(threads[i]);
+            }
+
+            if (veryVerbose) {
+                P_(mX.length()); P(mX.totalSize());
+            }
+
+            ASSERTV(mX.totalSize(), mX.maxTotalSize() >= mX.totalSize());
+
+            mX.beginSequence();
+            int sum = 0;
+            for (int i = 0; i < mX.length(); ++i) {
+                sum += recordSize(mX.front());
+                mX.pushBack(mX.front());
+                mX.popFront();
+            }
+            ASSERTV(sum, mX.totalSize(), sum == mX.totalSize());
+            mX.endSequence();
+
+            mX.removeAll();
+            ASSERTV(mX.length(),    0 == mX.length());
+            ASSERTV(mX.totalSize(), 0 == mX.totalSize());
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PUSHES AND SEQUENCES
+        //
+        // Concerns:
+        //: 1 Records pushed concurrently to the back of a buffer by several
+        //:   threads remain in the order in which each thread pushed them.
+        //:
+        //: 2 A sequence can be held while other threads push records, and its
+        //:   length does not change unless the thread holding it changes it.
+        //:
+        //: 3 The size limit holds once all of the pushes have completed.
+        //
+        // Plan:
+        //: 1 Run several threads pushing records, identified by producer and
+        //:   sequence number, to the back of a buffer while the main thread
+        //:   repeatedly drains the buffer within a sequence, verifying that
+        //:   the length of the sequence is stable and that the records of
+        //:   each producer are in increasing order.  (C-1..2)
+        //:
+        //: 2 After joining the threads, verify the size limit and that no
+        //:   memory is leaked.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENT PUSHES AND SEQUENCES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT PUSHES AND SEQUENCES"
+                          << endl << "===============================" << endl;
+
+        using namespace CASE7;
+
+        bslma::TestAllocator ta("records", veryVerbose);
+        bslma::TestAllocator oa("object",  veryVerbose);
+
+        {
+            const int RECORD_SIZE = recordSize(makeRecord(0, &ta));
+
+            Obj             mX(64 * RECORD_SIZE, &oa);
+            bslmt::Barrier  barrier(k_NUM_PRODUCERS + 1);
+            bsls::AtomicInt done(0);
+
+            bsl::vector<bslmt::ThreadUtil::Handle> threads(k_NUM_PRODUCERS);
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &threads[i],
+                                    bdlf::BindUtil::bind(&producer,
+                                                         &mX,
+                                                         &barrier,
+                                                         i,
+                                                         &ta,
+                                                         &done)));
+            }
+
+            bsl::vector<int> lastSeen(k_NUM_PRODUCERS, -1);
+            int              numSequences = 0;
+            int              numDrained   = 0;
+
+            barrier.wait();
+            while (k_NUM_PRODUCERS != done) {
+                mX.beginSequence();
+                ++numSequences;
+
+                const int LENGTH = mX.length();
+                for (int i = 0; i < LENGTH; ++i) {
+                    ASSERTV(LENGTH, i, mX.length(), LENGTH - i == mX.length());
+
+                    const int id       = recordId(mX.front());
+                    const int producer = id >> k_ID_SHIFT;
+                    const int sequence = id & ((1 << k_ID_SHIFT) - 1);
+
+                    ASSERTV(producer, 0 <= producer);
+                    ASSERTV(producer, producer < k_NUM_PRODUCERS);
+                    ASSERTV(producer,
+                            sequence,
+                            lastSeen[producer],
+                            lastSeen[producer] < sequence);
+                    lastSeen[producer] = sequence;
+
+                    mX.popFront();
+                    ++numDrained;
+                    if (0 == i % 16) {
+                        bslmt::ThreadUtil::yield();
+                    }
+                }
+                mX.endSequence();
+                bslmt::ThreadUtil::yield();
+            }
+
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                bslmt::ThreadUtil::join(threads[i]);
+            }
+
+            if (veryVerbose) {
+                P_(numSequences); P_(numDrained); P(mX.length());
+            }
+
+            ASSERTV(mX.totalSize(), mX.maxTotalSize() >= mX.totalSize());
+            ASSERTV(mX.length(), 64 >= mX.length());
+
+            const bsl::vector<int> ids = drain(&mX);
+            for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                const int producer = ids[i] >> k_ID_SHIFT;
+                const int sequence = ids[i] & ((1 << k_ID_SHIFT) - 1);
+
+                ASSERTV(producer,
+                        sequence,
+                        lastSeen[producer],
+                        lastSeen[producer] < sequence);
+                lastSeen[producer] = sequence;
+            }
+            ASSERTV(mX.totalSize(), 0 == mX.totalSize());
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // SEQUENCES
+        //
+        // Concerns:
+        //: 1 'beginSequence' moves the records of the buffer to a sequence,
+        //:   on which all of the methods invoked by the calling thread
+        //:   operate.
+        //:
+        //: 2 Records pushed by another thread during a sequence are not part
+        //:   of the sequence, but are counted by 'length' when invoked by
+        //:   another thread.
+        //:
+        //: 3 'endSequence' returns the records remaining in the sequence to
+        //:   the front of the buffer, ahead of records pushed by other
+        //:   threads during the sequence.
+        //:
+        //: 4 Sequences can be nested; only the outermost 'endSequence' ends
+        //:   the sequence.
+        //
+        // Plan:
+        //: 1 Push records, begin a sequence, push records from another thread,
+        //:   and verify the length of the buffer from both threads.
+        //:   (C-1..2)
+        //:
+        //: 2 Pop and push records within the sequence, end the sequence, and
+        //:   verify the contents of the buffer.  (C-3)
+        //:
+        //: 3 Repeat with nested sequences.  (C-4)
+        //
+        // Testing:
+        //   void beginSequence();
+        //   void endSequence();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "SEQUENCES"
+                          << endl << "=========" << endl;
+
+        bslma::TestAllocator ta("records", veryVerbose);
+        bslma::TestAllocator oa("object",  veryVerbose);
+
+        {
+            Obj mX(64 * 1024, &oa);  const Obj& X = mX;
+
+            pushRecords(&mX, 0, 4, &ta);             // 0 1 2 3
+            const int SIZE = X.totalSize();
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 4 == X.length());
+
+            bslmt::ThreadUtil::Handle thread;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &thread,
+                                  bdlf::BindUtil::bind(&pushRecords,
+                                                       &mX,
+                                                       10,
+                                                       3,
+                                                       &ta)));
+            bslmt::ThreadUtil::join(thread);
+
+            ASSERTV(X.length(), 4 == X.length());
+            ASSERTV(X.totalSize(), SIZE < X.totalSize());
+
+            int otherLength = -1;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &thread,
+                                  bdlf::BindUtil::bind(&loadLength,
+                                                       &X,
+                                                       &otherLength)));
+            bslmt::ThreadUtil::join(thread);
+            ASSERTV(otherLength, 7 == otherLength);
+
+            ASSERTV(recordId(X.front()), 0 == recordId(X.front()));
+            ASSERTV(recordId(X.back()),  3 == recordId(X.back()));
+
+            mX.popFront();                           // 1 2 3
+            mX.pushBack(makeRecord(4, &ta));         // 1 2 3 4
+            mX.popBack();                            // 1 2 3
+            mX.pushFront(makeRecord(5, &ta));        // 5 1 2 3
+            ASSERTV(X.length(), 4 == X.length());
+            ASSERTV(recordId(X.front()), 5 == recordId(X.front()));
+
+            mX.endSequence();
+            ASSERTV(X.length(), 7 == X.length());
+
+            const bsl::vector<int> ids = drain(&mX);
+            const int EXPECTED[] = { 5, 1, 2, 3, 10, 11, 12 };
+            ASSERTV(ids.size(), 7 == ids.size());
+            for (bsl::size_t i = 0; i < ids.size() && i < 7; ++i) {
+                ASSERTV(i, ids[i], EXPECTED[i] == ids[i]);
+            }
+            ASSERTV(X.length(),    0 == X.length());
+            ASSERTV(X.totalSize(), 0 == X.totalSize());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNested sequences." << endl;
+        {
+            Obj mX(64 * 1024, &oa);  const Obj& X = mX;
+
+            pushRecords(&mX, 0, 3, &ta);             // 0 1 2
+
+            mX.beginSequence();
+            mX.popFront();                           // 1 2
+            mX.beginSequence();
+            ASSERTV(X.length(), 2 == X.length());
+            mX.popFront();                           // 2
+            mX.endSequence();
+
+            // The sequence is still held by this thread.
+
+            bslmt::ThreadUtil::Handle thread;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                  &thread,
+                                  bdlf::BindUtil::bind(&pushRecords,
+                                                       &mX,
+                                                       10,
+                                                       1,
+                                                       &ta)));
+            bslmt::ThreadUtil::join(thread);
+
+            ASSERTV(X.length(), 1 == X.length());
+            ASSERTV(recordId(X.back()), 2 == recordId(X.back()));
+            mX.endSequence();
+
+            ASSERTV(X.length(), 2 == X.length());
+
+            const bsl::vector<int> ids = drain(&mX);
+            ASSERTV(ids.size(), 2 == ids.size());
+            ASSERTV(ids[0], 2  == ids[0]);
+            ASSERTV(ids[1], 10 == ids[1]);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SIZE LIMIT
+        //
+        // Concerns:
+        //: 1 The sum of the sizes of the records in the buffer never exceeds
+        //:   'maxTotalSize'.
+        //:
+        //: 2 Records are removed from the front to accommodate 'pushBack',
+        //:   and from the back to accommodate 'pushFront', both outside of
+        //:   and within a sequence.
+        //:
+        //: 3 A record larger than 'maxTotalSize' is rejected without changing
+        //:   the buffer.
+        //:
+        //: 4 Pushing records does not allocate memory.
+        //
+        // Plan:
+        //: 1 Push records of known size into a buffer that can hold 10 of
+        //:   them, and verify the contents and the total size of the buffer.
+        //:   Verify that the object allocator is not used.  (C-1..2, 4)
+        //:
+        //: 2 Push a record whose message is larger than 'maxTotalSize', and
+        //:   verify that it is rejected.  (C-3)
+        //
+        // Testing:
+        //   SIZE LIMIT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "SIZE LIMIT"
+                          << endl << "==========" << endl;
+
+        bslma::TestAllocator ta("records", veryVerbose);
+        bslma::TestAllocator oa("object",  veryVerbose);
+
+        {
+            const int RECORD_SIZE = recordSize(makeRecord(0, &ta));
+            const int MAX_SIZE    = 10 * RECORD_SIZE + RECORD_SIZE / 2;
+
+            Obj mX(MAX_SIZE, &oa);  const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            for (int i = 0; i < 20; ++i) {
+                ASSERTV(i, 0 == mX.pushBack(makeRecord(i, &ta)));
+                ASSERTV(i, X.totalSize(), MAX_SIZE >= X.totalSize());
+            }
+            ASSERTV(X.length(), 10 == X.length());
+            ASSERTV(X.totalSize(), 10 * RECORD_SIZE == X.totalSize());
+
+            ASSERTV(0 == mX.pushFront(makeRecord(20, &ta)));
+            ASSERTV(X.length(), 10 == X.length());
+
+            ASSERTV(NUM_ALLOCATIONS == oa.numAllocations());
+
+            mX.beginSequence();
+            ASSERTV(recordId(X.front()), 20 == recordId(X.front()));
+            ASSERTV(recordId(X.back()),  18 == recordId(X.back()));
+
+            // Within a sequence.
+
+            ASSERTV(0 == mX.pushBack(makeRecord(21, &ta)));
+            ASSERTV(X.length(), 10 == X.length());
+            ASSERTV(recordId(X.front()), 10 == recordId(X.front()));
+            ASSERTV(recordId(X.back()),  21 == recordId(X.back()));
+
+            ASSERTV(0 == mX.pushFront(makeRecord(22, &ta)));
+            ASSERTV(X.length(), 10 == X.length());
+            ASSERTV(recordId(X.front()), 22 == recordId(X.front()));
+            ASSERTV(recordId(X.back()),  18 == recordId(X.back()));
+            ASSERTV(X.totalSize(), 10 * RECORD_SIZE == X.totalSize());
+            mX.endSequence();
+
+            if (verbose) cout << "\tOversized records." << endl;
+
+            const bsl::string LONG(MAX_SIZE, 'x', &ta);
+
+            ASSERT(0 != mX.pushBack(makeRecord(30, &ta, LONG.c_str())));
+            ASSERT(0 != mX.pushFront(makeRecord(31, &ta, LONG.c_str())));
+            ASSERTV(X.length(), 10 == X.length());
+            ASSERTV(X.totalSize(), 10 * RECORD_SIZE == X.totalSize());
+
+            mX.beginSequence();
+            ASSERT(0 != mX.pushBack(makeRecord(32, &ta, LONG.c_str())));
+            ASSERTV(X.length(), 10 == X.length());
+            mX.endSequence();
+
+            if (verbose) cout << "\tRecords of different sizes." << endl;
+
+            const bsl::string MEDIUM(3 * RECORD_SIZE, 'x', &ta);
+
+            ASSERT(0 == mX.pushBack(makeRecord(40, &ta, MEDIUM.c_str())));
+            ASSERTV(X.totalSize(), MAX_SIZE >= X.totalSize());
+            ASSERTV(X.length(), 10 > X.length());
+
+            mX.beginSequence();
+            ASSERTV(recordId(X.back()), 40 == recordId(X.back()));
+            mX.endSequence();
+
+            if (verbose) cout << "\tThe ring is never larger than needed."
+                              << endl;
+
+            mX.removeAll();
+            for (int i = 0; i < 1000; ++i) {
+                mX.pushBack(makeRecord(i, &ta));
+            }
+            ASSERTV(X.length(), 10 == X.length());
+            ASSERTV(NUM_ALLOCATIONS == oa.numAllocations());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'removeAll' AND THE DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 'removeAll' removes all of the records, releasing the references
+        //:   held by the buffer, both outside of and within a sequence.
+        //:
+        //: 2 The destructor releases the references held by the buffer, and
+        //:   all of the memory allocated by the buffer.
+        //
+        // Plan:
+        //: 1 Push records allocated from a test allocator, invoke 'removeAll',
+        //:   and verify that the memory of the records is released.  (C-1)
+        //:
+        //: 2 Destroy a buffer holding records, and verify that all memory is
+        //:   released.  (C-2)
+        //
+        // Testing:
+        //   ~ConcurrentRecordBuffer();
+        //   void removeAll();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'removeAll' AND THE DESTRUCTOR"
+                          << endl << "======================================"
+                          << endl;
+
+        bslma::TestAllocator ta("records", veryVerbose);
+        bslma::TestAllocator oa("object",  veryVerbose);
+
+        {
+            Obj mX(64 * 1024, &oa);  const Obj& X = mX;
+
+            for (int n = 0; n < 8; ++n) {
+                pushRecords(&mX, 0, n, &ta);
+                ASSERTV(n, X.length(), n == X.length());
+                ASSERTV(n, (0 == n) == (0 == ta.numBlocksInUse()));
+
+                mX.removeAll();
+                ASSERTV(n, X.length(),    0 == X.length());
+                ASSERTV(n, X.totalSize(), 0 == X.totalSize());
+                ASSERTV(n, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+            }
+
+            pushRecords(&mX, 0, 5, &ta);
+            mX.beginSequence();
+            mX.removeAll();
+            ASSERTV(X.length(), 0 == X.length());
+            mX.pushBack(makeRecord(5, &ta));
+            ASSERTV(X.length(), 1 == X.length());
+            mX.endSequence();
+            ASSERTV(X.length(), 1 == X.length());
+
+            pushRecords(&mX, 6, 5, &ta);
+            ASSERTV(X.length(), 6 == X.length());
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tDestroying a buffer with a full ring."
+                          << endl;
+        {
+            const int RECORD_SIZE = recordSize(makeRecord(0, &ta));
+
+            Obj mX(4 * RECORD_SIZE, &oa);
+
+            pushRecords(&mX, 0, 100, &ta);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'pushFront' AND 'popBack'
+        //
+        // Concerns:
+        //: 1 'pushFront' adds a record at the front of the buffer, and
+        //:   'popBack' removes the record at the back of the buffer, both
+        //:   outside of and within a sequence.
+        //:
+        //: 2 Both ends of the buffer can be used together, including when
+        //:   the positions of the ends wrap around the ring.
+        //
+        // Plan:
+        //: 1 Push and pop records at both ends of a buffer, in a pattern that
+        //:   moves the front of the buffer around the ring several times,
+        //:   verifying the contents of the buffer against a model.  (C-1..2)
+        //
+        // Testing:
+        //   void popBack();
+        //   int pushFront(const bsl::shared_ptr<Record>& handle);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'pushFront' AND 'popBack'"
+                          << endl << "================================="
+                          << endl;
+
+        bslma::TestAllocator ta("records", veryVerbose);
+        bslma::TestAllocator oa("object",  veryVerbose);
+
+        {
+            Obj mX(64 * 1024, &oa);  const Obj& X = mX;
+
+            bsl::vector<int> model;
+            int              nextId = 0;
+
+            for (int round = 0; round < 50; ++round) {
+                const bool inSequence = 1 == round % 2;
+
+                if (inSequence) {
+                    mX.beginSequence();
+                }
+
+                for (int i = 0; i < 7; ++i) {
+                    ASSERTV(0 == mX.pushFront(makeRecord(nextId, &ta)));
+                    model.insert(model.begin(), nextId);
+                    ++nextId;
+                }
+                for (int i = 0; i < 5; ++i) {
+                    mX.popBack();
+                    model.pop_back();
+                }
+                ASSERTV(round,
+                        X.length(),
+                        model.size(),
+                        static_cast<int>(model.size()) == X.length());
+
+                if (inSequence) {
+                    mX.endSequence();
+                }
+            }
+
+            const bsl::vector<int> ids = drain(&mX);
+            ASSERTV(ids.size(), model.size(), ids == model);
+            ASSERTV(X.totalSize(), 0 == X.totalSize());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'pushBack', 'popFront', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The buffer is created empty, with the specified size limit, and
+        //:   all of its memory is allocated from the specified allocator.
+        //:
+        //: 2 'pushBack' adds a record at the back of the buffer, and
+        //:   'popFront' removes the record at the front of the buffer.
+        //:
+        //: 3 'length' and 'totalSize' reflect the records in the buffer.
+        //:
+        //: 4 'front' and 'back' refer to the records at the ends of the
+        //:   sequence.
+        //:
+        //: 5 The buffer holds a reference to each record it contains.
+        //
+        // Plan:
+        //: 1 Create a buffer, and verify its initial state and that memory is
+        //:   allocated from the specified allocator only.  (C-1)
+        //:
+        //: 2 Push and pop records, verifying the length, total size, and
+        //:   contents (within a sequence) of the buffer.  (C-2..4)
+        //:
+        //: 3 Verify the use count of a pushed handle.  (C-5)
+        //
+        // Testing:
+        //   ConcurrentRecordBuffer(int maxTotalSize, bslma::Allocator *ba);
+        //   void popFront();
+        //   int pushBack(const bsl::shared_ptr<Record>& handle);
+        //   const bsl::shared_ptr<Record>& back() const;
+        //   const bsl::shared_ptr<Record>& front() const;
+        //   int length() const;
+        //   int maxTotalSize() const;
+        //   int totalSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'pushBack', 'popFront', AND ACCESSORS"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        bslma::TestAllocator ta("records", veryVerbose);
+        bslma::TestAllocator oa("object",  veryVerbose);
+
+        {
+            Obj mX(32 * 1024, &oa);  const Obj& X = mX;
+
+            ASSERTV(X.maxTotalSize(), 32 * 1024 == X.maxTotalSize());
+            ASSERTV(X.length(),       0 == X.length());
+            ASSERTV(X.totalSize(),    0 == X.totalSize());
+            ASSERT(0 < oa.numBlocksInUse());
+            ASSERTV(defaultAllocator.numBlocksTotal(),
+                    0 == defaultAllocator.numBlocksTotal());
+
+            Handle h = makeRecord(0, &ta);
+            ASSERTV(h.use_count(), 1 == h.use_count());
+
+            ASSERT(0 == mX.pushBack(h));
+            ASSERTV(h.use_count(), 2 == h.use_count());
+            ASSERTV(X.length(),    1 == X.length());
+            ASSERTV(X.totalSize(), recordSize(h) == X.totalSize());
+
+            int expectedSize = recordSize(h);
+            for (int i = 1; i < 5; ++i) {
+                Handle r = makeRecord(i, &ta);
+                expectedSize += recordSize(r);
+                ASSERT(0 == mX.pushBack(r));
+                ASSERTV(i, X.length(),    i + 1 == X.length());
+                ASSERTV(i, X.totalSize(), expectedSize == X.totalSize());
+            }
+
+            mX.beginSequence();
+            ASSERTV(X.length(), 5 == X.length());
+            ASSERT(h == X.front());
+            ASSERTV(recordId(X.back()), 4 == recordId(X.back()));
+
+            mX.popFront();
+            ASSERTV(h.use_count(), 1 == h.use_count());
+            ASSERTV(X.length(), 4 == X.length());
+            ASSERTV(recordId(X.front()), 1 == recordId(X.front()));
+            mX.endSequence();
+
+            ASSERTV(X.length(), 4 == X.length());
+            mX.popFront();
+            ASSERTV(X.length(), 3 == X.length());
+
+            mX.beginSequence();
+            ASSERTV(recordId(X.front()), 2 == recordId(X.front()));
+            ASSERTV(recordId(X.back()),  4 == recordId(X.back()));
+            mX.endSequence();
+
+            mX.popFront();
+            mX.popFront();
+            mX.popFront();
+            ASSERTV(X.length(),    0 == X.length());
+            ASSERTV(X.totalSize(), 0 == X.totalSize());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push, inspect, and pop a few records.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST"
+                          << endl << "==============" << endl;
+
+        bslma::TestAllocator ta("records", veryVerbose);
+
+        Obj mX(32 * 1024, &ta);  const Obj& X = mX;
+
+        ASSERT(0 == X.length());
+
+        mX.pushBack(makeRecord(1, &ta));
+        mX.pushBack(makeRecord(2, &ta));
+        mX.pushFront(makeRecord(0, &ta));
+        ASSERT(3 == X.length());
+
+        mX.beginSequence();
+        ASSERT(0 == recordId(X.front()));
+        ASSERT(2 == recordId(X.back()));
+        mX.popBack();
+        mX.popFront();
+        ASSERT(1 == X.length());
+        ASSERT(1 == recordId(X.front()));
+        mX.endSequence();
+
+        ASSERT(1 == X.length());
+        mX.removeAll();
+        ASSERT(0 == X.length());
+        ASSERT(0 == X.totalSize());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONCURRENT VS. FIXED-SIZE RECORD BUFFER
+        //
+        // Concerns:
+        //: 1 Measure the cost of 'pushBack' for an increasing number of
+        //:   threads, while another thread periodically publishes the
+        //:   contents of the buffer, compared with
+        //:   'ball::FixedSizeRecordBuffer'.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, push records to each kind of buffer
+        //:   while the main thread drains the buffer within a sequence 100
+        //:   times, and report the time per record.  The 3rd command line
+        //:   argument, if supplied, is the number of records per thread.
+        //
+        // Testing:
+        //   PERFORMANCE: CONCURRENT VS. FIXED-SIZE RECORD BUFFER
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: CONCURRENT VS. FIXED-SIZE RECORD BUFFER" << endl
+             << "====================================================" << endl;
+
+        using namespace CASE_MINUS_1;
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            runBenchmark<ball::FixedSizeRecordBuffer>("FixedSize ",
+                                                      numThreads,
+                                                      NUM_RECORDS,
+                                                      100);
+            runBenchmark<ball::ConcurrentRecordBuffer>("Concurrent",
+                                                       numThreads,
+                                                       NUM_RECORDS,
+                                                       100);
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,909 @@
+// ball_deferredformatutil.cpp                                        -*-C++-*-
+#include <ball_deferredformatutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_deferredformatutil_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_cwchar.h>
+#include <bsl_vector.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Each captured value is encoded as a one-byte tag identifying its type,
+// followed by the bytes of the value (copied without regard to alignment).
+// Strings are encoded as a 32-bit length, followed by the characters of the
+// string and a terminating null character, so that 'render' can pass a pointer
+// into the encoded arguments directly to 'snprintf'.  A string converted with
+// a precision is captured only up to that many characters, as 'printf' reads
+// no further, so the argument need not be null-terminated.
+//
+// Integer arguments are converted to the type designated by their length
+// modifier when captured (so that, e.g., '%hhd' truncates as 'printf' would),
+// and are stored as 64-bit values.  When rendering, the length modifier of
+// each integer conversion is replaced by 'll', so that a single 'snprintf'
+// call per conversion reproduces the original text.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+enum ArgumentTag {
+    // This enumeration defines the tags identifying the type of an encoded
+    // argument.
+
+    e_STAR_TAG = 1,     // 'int' field width or precision
+    e_CHAR_TAG,         // 'int' character
+    e_INT64_TAG,        // signed integer
+    e_UINT64_TAG,       // unsigned integer
+    e_DOUBLE_TAG,       // 'double'
+    e_LONG_DOUBLE_TAG,  // 'long double'
+    e_POINTER_TAG,      // 'const void *'
+    e_STRING_TAG,       // null-terminated string
+    e_NULL_STRING_TAG   // null string pointer
+};
+
+enum LengthModifier {
+    // This enumeration defines the length modifiers of a conversion.
+
+    e_NO_LENGTH,
+    e_HH_LENGTH,
+    e_H_LENGTH,
+    e_L_LENGTH,
+    e_LL_LENGTH,
+    e_J_LENGTH,
+    e_Z_LENGTH,
+    e_T_LENGTH,
+    e_LONG_DOUBLE_LENGTH
+};
+
+enum {
+    k_MAX_SPEC_LENGTH  = 64,   // maximum length of the flags, width, and
+                               // precision of a supported conversion
+
+    k_LOCAL_BUFFER_SIZE = 256  // size of the buffer in which a single
+                               // conversion is rendered
+};
+
+struct ConversionSpec {
+    // This 'struct' describes a single conversion specification of a
+    // 'printf'-style format string.
+
+    const char     *d_begin_p;   // address of the '%'
+    const char     *d_length_p;  // address of the length modifier (or
+                                 // conversion specifier, if none)
+    const char     *d_end_p;     // address one past the conversion specifier
+    int             d_numStars;  // number of '*' (0, 1, or 2)
+    LengthModifier  d_length;    // length modifier
+    char            d_conversion;
+                                 // conversion specifier
+};
+
+bool isDigit(char character)
+    // Return 'true' if the specified 'character' is a decimal digit, and
+    // 'false' otherwise.
+{
+    return '0' <= character && character <= '9';
+}
+
+bool parseConversion(ConversionSpec *spec, const char *format)
+    // Load into the specified 'spec' the description of the conversion
+    // specification starting at the specified 'format'.  Return 'true' if the
+    // conversion is supported, and 'false' otherwise.  The behavior is
+    // undefined unless '*format' is '%'.
+{
+    BSLS_ASSERT('%' == *format);
+
+    const char *p = format + 1;
+
+    spec->d_begin_p  = format;
+    spec->d_numStars = 0;
+
+    while (*p && bsl::strchr("-+ #0'", *p)) {
+        ++p;
+    }
+
+    if ('*' == *p) {
+        ++spec->d_numStars;
+        ++p;
+    }
+    else {
+        while (isDigit(*p)) {
+            ++p;
+        }
+        if ('$' == *p) {
+            return false;                                             // RETURN
+        }
+    }
+
+    if ('.' == *p) {
+        ++p;
+        if ('*' == *p) {
+            ++spec->d_numStars;
+            ++p;
+        }
+        else {
+            while (isDigit(*p)) {
+                ++p;
+            }
+        }
+    }
+
+    if (p - format > k_MAX_SPEC_LENGTH) {
+        return false;                                                 // RETURN
+    }
+
+    spec->d_length_p = p;
+
+    switch (*p) {
+      case 'h': {
+        ++p;
+        if ('h' == *p) {
+            ++p;
+            spec->d_length = e_HH_LENGTH;
+        }
+        else {
+            spec->d_length = e_H_LENGTH;
+        }
+      } break;
+      case 'l': {
+        ++p;
+        if ('l' == *p) {
+            ++p;
+            spec->d_length = e_LL_LENGTH;
+        }
+        else {
+            spec->d_length = e_L_LENGTH;
+        }
+      } break;
+      case 'q': {
+        ++p;
+        spec->d_length = e_LL_LENGTH;
+      } break;
+      case 'j': {
+        ++p;
+        spec->d_length = e_J_LENGTH;
+      } break;
+      case 'z': {
+        ++p;
+        spec->d_length = e_Z_LENGTH;
+      } break;
+      case 't': {
+        ++p;
+        spec->d_length = e_T_LENGTH;
+      } break;
+      case 'L': {
+        ++p;
+        spec->d_length = e_LONG_DOUBLE_LENGTH;
+      } break;
+      default: {
+        spec->d_length = e_NO_LENGTH;
+      }
+    }
+
+    if (0 == *p || 0 == bsl::strchr("diouxXeEfFgGaAcspn%", *p)) {
+        return false;                                                 // RETURN
+    }
+
+    spec->d_conversion = *p;
+    spec->d_end_p      = p + 1;
+
+    return true;
+}
+
+int getPrecision(const ConversionSpec& conversion, const int *stars)
+    // Return the precision of the specified 'conversion', using the leading
+    // elements of the specified 'stars' as its field width and precision, or
+    // -1 if it has none.  Note that, as with 'printf', a negative precision
+    // supplied as '*' is treated as if the precision were omitted.
+{
+    const char *p = conversion.d_begin_p + 1;
+
+    while (p != conversion.d_length_p && bsl::strchr("-+ #0'", *p)) {
+        ++p;
+    }
+
+    if ('*' == *p) {
+        ++stars;
+        ++p;
+    }
+    else {
+        while (isDigit(*p)) {
+            ++p;
+        }
+    }
+
+    if ('.' != *p) {
+        return -1;                                                    // RETURN
+    }
+    ++p;
+
+    if ('*' == *p) {
+        return *stars < 0 ? -1 : *stars;                              // RETURN
+    }
+
+    int precision = 0;
+    for (; isDigit(*p); ++p) {
+        precision = precision * 10 + (*p - '0');
+    }
+    return precision;
+}
+
+template <class CHAR_TYPE>
+bsl::size_t boundedLength(const CHAR_TYPE *value, int precision)
+    // Return the length of the specified null-terminated 'value' string, or
+    // the specified 'precision' if it is non-negative and 'value' has no null
+    // character among its first 'precision' characters.  Note that, as with
+    // 'printf', no character of 'value' beyond the first 'precision' is read.
+{
+    if (precision < 0) {
+        bsl::size_t length = 0;
+        while (value[length]) {
+            ++length;
+        }
+        return length;                                                // RETURN
+    }
+
+    const bsl::size_t maxLength = static_cast<bsl::size_t>(precision);
+
+    bsl::size_t length = 0;
+    while (length < maxLength && value[length]) {
+        ++length;
+    }
+    return length;
+}
+
+template <class VALUE>
+void putValue(bsl::streambuf *arguments, ArgumentTag tag, const VALUE& value)
+    // Append to the specified 'arguments' the specified 'tag' followed by the
+    // bytes of the specified 'value'.
+{
+    arguments->sputc(static_cast<char>(tag));
+    arguments->sputn(reinterpret_cast<const char *>(&value), sizeof value);
+}
+
+void putString(bsl::streambuf *arguments, const char *value, int precision)
+    // Append to the specified 'arguments' the encoding of the specified
+    // 'value' string, which may be null, truncated to the specified
+    // 'precision' characters if 'precision' is non-negative.  Note that
+    // 'value' need not be null-terminated if it has at least 'precision'
+    // characters.
+{
+    if (0 == value) {
+        arguments->sputc(static_cast<char>(e_NULL_STRING_TAG));
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t   length   = boundedLength(value, precision);
+    const unsigned int  length32 = static_cast<unsigned int>(length);
+
+    arguments->sputc(static_cast<char>(e_STRING_TAG));
+    arguments->sputn(reinterpret_cast<const char *>(&length32),
+                     sizeof length32);
+    arguments->sputn(value, length);
+    arguments->sputc(0);
+}
+
+char narrowCharacter(int character)
+    // Return the specified wide 'character' if it is in the ASCII range, and
+    // '?' otherwise.
+{
+    return 0 <= character && character < 128 ? static_cast<char>(character)
+                                              : '?';
+}
+
+void putWideString(bsl::streambuf *arguments,
+                   const wchar_t  *value,
+                   int             precision)
+    // Append to the specified 'arguments' the encoding of the narrow string
+    // corresponding to the specified 'value' wide string, which may be null,
+    // truncated to the specified 'precision' characters if 'precision' is
+    // non-negative.  Note that 'value' need not be null-terminated if it has
+    // at least 'precision' characters.
+{
+    if (0 == value) {
+        arguments->sputc(static_cast<char>(e_NULL_STRING_TAG));
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t   length   = boundedLength(value, precision);
+    const unsigned int  length32 = static_cast<unsigned int>(length);
+
+    arguments->sputc(static_cast<char>(e_STRING_TAG));
+    arguments->sputn(reinterpret_cast<const char *>(&length32),
+                     sizeof length32);
+    for (bsl::size_t i = 0; i < length; ++i) {
+        arguments->sputc(narrowCharacter(static_cast<int>(value[i])));
+    }
+    arguments->sputc(0);
+}
+
+                           // ====================
+                           // class ArgumentCursor
+                           // ====================
+
+class ArgumentCursor {
+    // This class provides sequential access to encoded arguments.
+
+    // DATA
+    const char *d_current_p;  // next unread byte
+    const char *d_end_p;      // end of the encoded arguments
+
+  public:
+    // CREATORS
+    ArgumentCursor(const char *arguments, bsl::size_t numBytes)
+        // Create a cursor positioned at the start of the specified
+        // 'arguments' having the specified 'numBytes' length.
+    : d_current_p(arguments)
+    , d_end_p(arguments + numBytes)
+    {
+    }
+
+    // MANIPULATORS
+    template <class VALUE>
+    bool getValue(VALUE *value, ArgumentTag tag)
+        // Load into the specified 'value' the next encoded argument and
+        // advance this cursor past it if that argument has the specified
+        // 'tag'.  Return 'true' on success, and 'false' (with no effect)
+        // otherwise.
+    {
+        if (d_end_p - d_current_p < static_cast<int>(1 + sizeof *value)
+         || tag != static_cast<unsigned char>(*d_current_p)) {
+            return false;                                             // RETURN
+        }
+        bsl::memcpy(static_cast<void *>(value),
+                    d_current_p + 1,
+                    sizeof *value);
+        d_current_p += 1 + sizeof *value;
+        return true;
+    }
+
+    bool getString(const char **value)
+        // Load into the specified 'value' the address of the next encoded
+        // argument, or of "(null)" for an encoded null string, and advance
+        // this cursor past it if that argument is a string.  Return 'true' on
+        // success, and 'false' (with no effect) otherwise.
+    {
+        if (d_current_p == d_end_p) {
+            return false;                                             // RETURN
+        }
+
+        const unsigned char tag = static_cast<unsigned char>(*d_current_p);
+
+        if (e_NULL_STRING_TAG == tag) {
+            *value = "(null)";
+            ++d_current_p;
+            return true;                                              // RETURN
+        }
+
+        unsigned int length;
+        if (e_STRING_TAG != tag
+         || d_end_p - d_current_p < static_cast<int>(1 + sizeof length)) {
+            return false;                                             // RETURN
+        }
+        bsl::memcpy(&length, d_current_p + 1, sizeof length);
+
+        const char *string = d_current_p + 1 + sizeof length;
+        if (static_cast<bsl::size_t>(d_end_p - string) < length + 1
+         || 0 != string[length]) {
+            return false;                                             // RETURN
+        }
+
+        *value      = string;
+        d_current_p = string + length + 1;
+        return true;
+    }
+};
+
+template <class VALUE>
+int formatValue(char        *buffer,
+                bsl::size_t  size,
+                const char  *spec,
+                const int   *stars,
+                int          numStars,
+                VALUE        value)
+    // Format the specified 'value' according to the specified single
+    // conversion 'spec', using the specified 'numStars' leading elements of
+    // the specified 'stars' as field width and precision, into the specified
+    // 'buffer' of the specified 'size'.  Return the value returned by
+    // 'snprintf'.
+{
+    switch (numStars) {
+      case 0: {
+        return bsl::snprintf(buffer, size, spec, value);              // RETURN
+      }
+      case 1: {
+        return bsl::snprintf(buffer, size, spec, stars[0], value);    // RETURN
+      }
+      default: {
+        return bsl::snprintf(buffer,
+                             size,
+                             spec,
+                             stars[0],
+                             stars[1],
+                             value);                                  // RETURN
+      }
+    }
+}
+
+template <class VALUE>
+void writeValue(bsl::streambuf   *output,
+                const char       *spec,
+                const int        *stars,
+                int               numStars,
+                VALUE             value,
+                bslma::Allocator *allocator)
+    // Append to the specified 'output' the specified 'value' formatted
+    // according to the specified single conversion 'spec', using the
+    // specified 'numStars' leading elements of the specified 'stars' as field
+    // width and precision, and the specified 'allocator' to supply memory if
+    // the formatted value is too long for a local buffer.
+{
+    char buffer[k_LOCAL_BUFFER_SIZE];
+
+    const int length = formatValue(buffer,
+                                   sizeof buffer,
+                                   spec,
+                                   stars,
+                                   numStars,
+                                   value);
+    if (length < 0) {
+        return;                                                       // RETURN
+    }
+
+    if (length < static_cast<int>(sizeof buffer)) {
+        output->sputn(buffer, length);
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<char> largeBuffer(length + 1, allocator);
+    formatValue(largeBuffer.data(),
+                largeBuffer.size(),
+                spec,
+                stars,
+                numStars,
+                value);
+    output->sputn(largeBuffer.data(), length);
+}
+
+void writeString(bsl::streambuf        *output,
+                 const ConversionSpec&  conversion,
+                 const int             *stars,
+                 const char            *value)
+    // Append to the specified 'output' the specified 'value' string formatted
+    // according to the specified '%s' 'conversion', using the leading
+    // elements of the specified 'stars' as field width and precision.  Note
+    // that strings are formatted directly, rather than by 'snprintf', as
+    // their length is unbounded.
+{
+    bool        leftJustify = false;
+    int         width       = 0;
+    int         precision   = -1;
+    const char *p           = conversion.d_begin_p + 1;
+
+    for (; p != conversion.d_length_p && bsl::strchr("-+ #0'", *p); ++p) {
+        leftJustify = leftJustify || '-' == *p;
+    }
+
+    if ('*' == *p) {
+        width = *stars++;
+        ++p;
+        if (width < 0) {
+            leftJustify = true;
+            width       = -width;
+        }
+    }
+    else {
+        for (; isDigit(*p); ++p) {
+            width = width * 10 + (*p - '0');
+        }
+    }
+
+    if ('.' == *p) {
+        ++p;
+        if ('*' == *p) {
+            precision = *stars;
+        }
+        else {
+            for (precision = 0; isDigit(*p); ++p) {
+                precision = precision * 10 + (*p - '0');
+            }
+        }
+    }
+
+    bsl::size_t length = bsl::strlen(value);
+    if (0 <= precision && static_cast<bsl::size_t>(precision) < length) {
+        length = precision;
+    }
+
+    const int padding = width > static_cast<int>(length)
+                      ? width - static_cast<int>(length)
+                      : 0;
+
+    if (!leftJustify) {
+        for (int i = 0; i < padding; ++i) {
+            output->sputc(' ');
+        }
+    }
+    output->sputn(value, length);
+    if (leftJustify) {
+        for (int i = 0; i < padding; ++i) {
+            output->sputc(' ');
+        }
+    }
+}
+
+bool renderConversion(bsl::streambuf        *output,
+                      ArgumentCursor        *cursor,
+                      const ConversionSpec&  conversion,
+                      bslma::Allocator      *allocator)
+    // Append to the specified 'output' the text for the specified
+    // 'conversion', whose arguments are read from the specified 'cursor',
+    // using the specified 'allocator' to supply memory.  Return 'true' on
+    // success, and 'false' if the arguments required by 'conversion' are not
+    // available.
+{
+    int stars[2];
+    for (int i = 0; i < conversion.d_numStars; ++i) {
+        if (!cursor->getValue(&stars[i], e_STAR_TAG)) {
+            return false;                                             // RETURN
+        }
+    }
+
+    // Copy the flags, width, and precision, and substitute the length
+    // modifier.
+
+    char spec[k_MAX_SPEC_LENGTH + 4];
+
+    bsl::size_t length = conversion.d_length_p - conversion.d_begin_p;
+    bsl::memcpy(spec, conversion.d_begin_p, length);
+
+    switch (conversion.d_conversion) {
+      case 'd':
+      case 'i': {
+        bsls::Types::Int64 value;
+        if (!cursor->getValue(&value, e_INT64_TAG)) {
+            return false;                                             // RETURN
+        }
+        spec[length++] = 'l';
+        spec[length++] = 'l';
+        spec[length++] = conversion.d_conversion;
+        spec[length]   = 0;
+        writeValue(output,
+                   spec,
+                   stars,
+                   conversion.d_numStars,
+                   static_cast<long long>(value),
+                   allocator);
+      } break;
+      case 'o':
+      case 'u':
+      case 'x':
+      case 'X': {
+        bsls::Types::Uint64 value;
+        if (!cursor->getValue(&value, e_UINT64_TAG)) {
+            return false;                                             // RETURN
+        }
+        spec[length++] = 'l';
+        spec[length++] = 'l';
+        spec[length++] = conversion.d_conversion;
+        spec[length]   = 0;
+        writeValue(output,
+                   spec,
+                   stars,
+                   conversion.d_numStars,
+                   static_cast<unsigned long long>(value),
+                   allocator);
+      } break;
+      case 'e':
+      case 'E':
+      case 'f':
+      case 'F':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A': {
+        if (e_LONG_DOUBLE_LENGTH == conversion.d_length) {
+            long double value;
+            if (!cursor->getValue(&value, e_LONG_DOUBLE_TAG)) {
+                return false;                                         // RETURN
+            }
+            spec[length++] = 'L';
+            spec[length++] = conversion.d_conversion;
+            spec[length]   = 0;
+            writeValue(output,
+                   spec,
+                   stars,
+                   conversion.d_numStars,
+                   value,
+                   allocator);
+        }
+        else {
+            double value;
+            if (!cursor->getValue(&value, e_DOUBLE_TAG)) {
+                return false;                                         // RETURN
+            }
+            spec[length++] = conversion.d_conversion;
+            spec[length]   = 0;
+            writeValue(output,
+                   spec,
+                   stars,
+                   conversion.d_numStars,
+                   value,
+                   allocator);
+        }
+      } break;
+      case 'c': {
+        int value;
+        if (!cursor->getValue(&value, e_CHAR_TAG)) {
+            return false;                                             // RETURN
+        }
+        spec[length++] = 'c';
+        spec[length]   = 0;
+        writeValue(output,
+                   spec,
+                   stars,
+                   conversion.d_numStars,
+                   value,
+                   allocator);
+      } break;
+      case 's': {
+        const char *value;
+        if (!cursor->getString(&value)) {
+            return false;                                             // RETURN
+        }
+        writeString(output, conversion, stars, value);
+      } break;
+      case 'p': {
+        const void *value;
+        if (!cursor->getValue(&value, e_POINTER_TAG)) {
+            return false;                                             // RETURN
+        }
+        spec[length++] = 'p';
+        spec[length]   = 0;
+        writeValue(output,
+                   spec,
+                   stars,
+                   conversion.d_numStars,
+                   value,
+                   allocator);
+      } break;
+      default: {
+        // '%n' produces no output.
+      }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+                         // -------------------------
+                         // struct DeferredFormatUtil
+                         // -------------------------
+
+// CLASS METHODS
+void DeferredFormatUtil::capture(bsl::streambuf *arguments,
+                                 const char     *format,
+                                 ...)
+{
+    bsl::va_list argumentList;
+    va_start(argumentList, format);
+    vcapture(arguments, format, argumentList);
+    va_end(argumentList);
+}
+
+void DeferredFormatUtil::render(bsl::streambuf   *output,
+                                const char       *format,
+                                const char       *arguments,
+                                bsl::size_t       numBytes,
+                                bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(output);
+    BSLS_ASSERT(format);
+    BSLS_ASSERT(arguments || 0 == numBytes);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+    ArgumentCursor    cursor(arguments, numBytes);
+
+    const char *current = format;
+    for (;;) {
+        const char *percent = bsl::strchr(current, '%');
+        if (0 == percent) {
+            output->sputn(current, bsl::strlen(current));
+            return;                                                   // RETURN
+        }
+
+        output->sputn(current, percent - current);
+
+        ConversionSpec conversion;
+        if (!parseConversion(&conversion, percent)) {
+            output->sputn(percent, bsl::strlen(percent));
+            return;                                                   // RETURN
+        }
+
+        if ('%' == conversion.d_conversion) {
+            output->sputc('%');
+        }
+        else if (!renderConversion(output, &cursor, conversion, allocator)) {
+            output->sputn(percent, bsl::strlen(percent));
+            return;                                                   // RETURN
+        }
+
+        current = conversion.d_end_p;
+    }
+}
+
+void DeferredFormatUtil::vcapture(bsl::streambuf *arguments,
+                                  const char     *format,
+                                  bsl::va_list    argumentList)
+{
+    BSLS_ASSERT(arguments);
+    BSLS_ASSERT(format);
+
+    const char *current = format;
+    while (0 != (current = bsl::strchr(current, '%'))) {
+        ConversionSpec conversion;
+        if (!parseConversion(&conversion, current)) {
+            return;                                                   // RETURN
+        }
+        current = conversion.d_end_p;
+
+        if ('%' == conversion.d_conversion) {
+            continue;                                               // CONTINUE
+        }
+
+        int stars[2] = { 0, 0 };
+        for (int i = 0; i < conversion.d_numStars; ++i) {
+            stars[i] = va_arg(argumentList, int);
+            putValue(arguments, e_STAR_TAG, stars[i]);
+        }
+
+        switch (conversion.d_conversion) {
+          case 'd':
+          case 'i': {
+            bsls::Types::Int64 value;
+            switch (conversion.d_length) {
+              case e_HH_LENGTH: {
+                value = static_cast<signed char>(va_arg(argumentList, int));
+              } break;
+              case e_H_LENGTH: {
+                value = static_cast<short>(va_arg(argumentList, int));
+              } break;
+              case e_L_LENGTH: {
+                value = va_arg(argumentList, long);
+              } break;
+              case e_LL_LENGTH: {
+                value = va_arg(argumentList, long long);
+              } break;
+              case e_J_LENGTH: {
+                value = va_arg(argumentList, bsl::intmax_t);
+              } break;
+              case e_Z_LENGTH: {
+                value = static_cast<bsls::Types::IntPtr>(
+                                         va_arg(argumentList, bsl::size_t));
+              } break;
+              case e_T_LENGTH: {
+                value = va_arg(argumentList, bsl::ptrdiff_t);
+              } break;
+              default: {
+                value = va_arg(argumentList, int);
+              }
+            }
+            putValue(arguments, e_INT64_TAG, value);
+          } break;
+          case 'o':
+          case 'u':
+          case 'x':
+          case 'X': {
+            bsls::Types::Uint64 value;
+            switch (conversion.d_length) {
+              case e_HH_LENGTH: {
+                value = static_cast<unsigned char>(
+                                         va_arg(argumentList, unsigned int));
+              } break;
+              case e_H_LENGTH: {
+                value = static_cast<unsigned short>(
+                                         va_arg(argumentList, unsigned int));
+              } break;
+              case e_L_LENGTH: {
+                value = va_arg(argumentList, unsigned long);
+              } break;
+              case e_LL_LENGTH: {
+                value = va_arg(argumentList, unsigned long long);
+              } break;
+              case e_J_LENGTH: {
+                value = va_arg(argumentList, bsl::uintmax_t);
+              } break;
+              case e_Z_LENGTH: {
+                value = va_arg(argumentList, bsl::size_t);
+              } break;
+              case e_T_LENGTH: {
+                value = static_cast<bsls::Types::UintPtr>(
+                                      va_arg(argumentList, bsl::ptrdiff_t));
+              } break;
+              default: {
+                value = va_arg(argumentList, unsigned int);
+              }
+            }
+            putValue(arguments, e_UINT64_TAG, value);
+          } break;
+          case 'e':
+          case 'E':
+          case 'f':
+          case 'F':
+          case 'g':
+          case 'G':
+          case 'a':
+          case 'A': {
+            if (e_LONG_DOUBLE_LENGTH == conversion.d_length) {
+                putValue(arguments,
+                         e_LONG_DOUBLE_TAG,
+                         va_arg(argumentList, long double));
+            }
+            else {
+                putValue(arguments,
+                         e_DOUBLE_TAG,
+                         va_arg(argumentList, double));
+            }
+          } break;
+          case 'c': {
+            int value = va_arg(argumentList, int);
+            if (e_L_LENGTH == conversion.d_length) {
+                value = narrowCharacter(value);
+            }
+            putValue(arguments, e_CHAR_TAG, value);
+          } break;
+          case 's': {
+            // Capture no more characters than 'printf' would read.
+
+            const int precision = getPrecision(conversion, stars);
+            if (e_L_LENGTH == conversion.d_length) {
+                putWideString(arguments,
+                              va_arg(argumentList, const wchar_t *),
+                              precision);
+            }
+            else {
+                putString(arguments,
+                          va_arg(argumentList, const char *),
+                          precision);
+            }
+          } break;
+          case 'p': {
+            const void *value = va_arg(argumentList, const void *);
+            putValue(arguments, e_POINTER_TAG, value);
+          } break;
+          default: {
+            // '%n': consume the argument, but store nothing.
+
+            (void)va_arg(argumentList, void *);
+          }
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
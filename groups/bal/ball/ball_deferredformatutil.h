@@ -0,0 +1,162 @@
+// ball_deferredformatutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_DEFERREDFORMATUTIL
+#define INCLUDED_BALL_DEFERREDFORMATUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to capture 'printf' arguments for later output.
+//
+//@CLASSES:
+//  ball::DeferredFormatUtil: namespace for deferred 'printf'-style formatting
+//
+//@SEE_ALSO: ball_recordattributes, ball_log
+//
+//@DESCRIPTION: This component provides a 'struct', 'ball::DeferredFormatUtil',
+// that splits 'printf'-style formatting into two steps: 'capture' (and
+// 'vcapture') copies the *values* of the arguments described by a format
+// string into a compact binary encoding, and 'render' later produces the
+// formatted text from the format string and that encoding.  Capturing an
+// argument copies its bytes; no digits are generated, no floating-point
+// values are converted, and no locale is consulted, so that the cost of
+// formatting can be moved off of a latency-sensitive thread (see
+// 'ball_recordattributes' and the 'BALL_LOGDF' macros of 'ball_log').
+//
+// The format string itself is *not* copied; only its address is needed when
+// rendering.  Clients must therefore ensure that the format string (typically
+// a string literal) outlives the encoded arguments.  Strings supplied for '%s'
+// conversions, on the other hand, are copied when captured, so they need not
+// outlive the call to 'capture'.
+//
+///Supported Conversions
+///---------------------
+// All conversions of C99 'printf' are supported, with flags, field widths and
+// precisions (including those supplied as '*' arguments), and length
+// modifiers, with the following exceptions:
+//
+//: o Wide characters ('%lc') and wide strings ('%ls') are captured as narrow
+//:   characters, substituting '?' for characters outside of the ASCII range.
+//:
+//: o '%n' consumes its argument, but stores nothing.
+//:
+//: o Positional arguments (e.g., '%1$d') and unrecognized conversions are not
+//:   supported; the arguments for such a conversion, and for all subsequent
+//:   conversions, are not captured, and the remainder of the format string is
+//:   rendered verbatim.
+//
+// Rendering a captured integer or floating-point value produces exactly the
+// text that 'snprintf' would have produced for the original argument.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting on Another Thread
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose a latency-sensitive thread must report a value, but the cost of
+// formatting that report should be borne by another thread.
+//
+// First, the latency-sensitive thread captures the arguments of the report
+// into a stream buffer:
+//..
+//  const char *FORMAT = "order %d filled at %.2f (%s)";
+//
+//  bdlsb::MemOutStreamBuf arguments;
+//  ball::DeferredFormatUtil::capture(&arguments, FORMAT, 42, 99.5, "IBM");
+//..
+// Note that the captured string "IBM" is copied into 'arguments'.
+//
+// Then, the encoded arguments (and the format) are passed to another thread
+// (not shown).
+//
+// Finally, that thread renders the report:
+//..
+//  bdlsb::MemOutStreamBuf text;
+//  ball::DeferredFormatUtil::render(&text,
+//                                   FORMAT,
+//                                   arguments.data(),
+//                                   arguments.length());
+//
+//  assert(bsl::string(text.data(), text.length())
+//                                        == "order 42 filled at 99.50 (IBM)");
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_annotation.h>
+
+#include <bsl_cstdarg.h>
+#include <bsl_cstddef.h>
+#include <bsl_streambuf.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                         // =========================
+                         // struct DeferredFormatUtil
+                         // =========================
+
+struct DeferredFormatUtil {
+    // This 'struct' provides a namespace for utility functions that capture
+    // the arguments of a 'printf'-style format, and later render the
+    // formatted text from the captured arguments.
+
+    // CLASS METHODS
+    static void capture(bsl::streambuf *arguments,
+                        const char     *format,
+                        ...) BSLS_ANNOTATION_PRINTF(2, 3);
+        // Append to the specified 'arguments' stream buffer an encoding of
+        // the values of the variable arguments described by the specified
+        // 'printf'-style 'format'.  The behavior is undefined unless the
+        // variable arguments are valid for 'format'.  See {Supported
+        // Conversions}.
+
+    static void render(bsl::streambuf   *output,
+                       const char       *format,
+                       const char       *arguments,
+                       bsl::size_t       numBytes,
+                       bslma::Allocator *basicAllocator = 0);
+        // Append to the specified 'output' stream buffer the text produced by
+        // formatting, according to the specified 'printf'-style 'format', the
+        // argument values encoded in the specified 'arguments' having the
+        // specified 'numBytes' length.  Optionally specify a 'basicAllocator'
+        // used to supply temporary memory for a conversion (other than '%s')
+        // producing more than 256 characters.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  If 'arguments'
+        // encodes fewer values than are required by 'format', the portion of
+        // 'format' for which values are missing is appended verbatim.  The
+        // behavior is undefined unless '[arguments, arguments + numBytes)'
+        // was produced by 'capture' or 'vcapture' for 'format'.
+
+    static void vcapture(bsl::streambuf *arguments,
+                         const char     *format,
+                         bsl::va_list    argumentList);
+        // Append to the specified 'arguments' stream buffer an encoding of
+        // the values of the specified 'argumentList' described by the
+        // specified 'printf'-style 'format'.  The behavior is undefined
+        // unless 'argumentList' is valid for 'format'.  See {Supported
+        // Conversions}.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,838 @@
+// ball_deferredformatutil.t.cpp                                      -*-C++-*-
+#include <ball_deferredformatutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdarg.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_cwchar.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'ball::DeferredFormatUtil' provides functions that capture the arguments of
+// a 'printf'-style format, and that render the formatted text from the
+// captured arguments.  The rendered text is verified against the text
+// produced by 'vsnprintf' for the same format and arguments, for each
+// conversion, length modifier, flag, and combination of '*' field width and
+// precision.  We then verify the documented deviations from 'printf', and the
+// handling of unsupported conversions and of incomplete encoded arguments.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void capture(bsl::streambuf *arguments, const char *format, ...);
+// [ 2] void render(streambuf *, const char *, const char *, size_t, *ba);
+// [ 2] void vcapture(bsl::streambuf *, const char *, bsl::va_list);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] STRINGS AND DEVIATIONS FROM 'printf'
+// [ 4] UNSUPPORTED CONVERSIONS AND INCOMPLETE ARGUMENTS
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: CAPTURE VS. 'vsnprintf'
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::DeferredFormatUtil Util;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bsl::string renderCaptured(const char *format, bsl::va_list arguments)
+    // Return the text rendered by 'Util::render' for the specified 'format'
+    // from the encoding of the specified 'arguments' produced by
+    // 'Util::vcapture'.
+{
+    bdlsb::MemOutStreamBuf encoded;
+    Util::vcapture(&encoded, format, arguments);
+
+    bdlsb::MemOutStreamBuf text;
+    Util::render(&text, format, encoded.data(), encoded.length());
+    return bsl::string(text.data(), text.length());
+}
+
+static bsl::string deferredFormat(const char *format, ...)
+    // Return the text rendered by 'Util::render' for the specified 'format'
+    // from the encoding of the variable arguments produced by 'Util::capture'.
+{
+    bsl::va_list arguments;
+    va_start(arguments, format);
+    bsl::string result = renderCaptured(format, arguments);
+    va_end(arguments);
+    return result;
+}
+
+static bsl::string immediateFormat(const char *format, ...)
+    // Return the text produced by 'vsnprintf' for the specified 'format' and
+    // the variable arguments.
+{
+    char buffer[8192];
+
+    bsl::va_list arguments;
+    va_start(arguments, format);
+    ::vsnprintf(buffer, sizeof buffer, format, arguments);
+    va_end(arguments);
+    return buffer;
+}
+
+template <class ARG1>
+void check(int line, const char *format, ARG1 arg1)
+    // Verify that the text rendered from the captured 'format' and specified
+    // 'arg1' matches the text produced by 'vsnprintf', reporting a failure
+    // with the specified 'line'.
+{
+    const bsl::string EXP = immediateFormat(format, arg1);
+    const bsl::string act = deferredFormat(format, arg1);
+
+    if (veryVerbose) { T_ P_(line) P_(format) P(act) }
+
+    ASSERTV(line, format, EXP, act, EXP == act);
+}
+
+template <class ARG1, class ARG2>
+void check(int line, const char *format, ARG1 arg1, ARG2 arg2)
+    // Verify that the text rendered from the captured 'format' and specified
+    // 'arg1' and 'arg2' matches the text produced by 'vsnprintf', reporting a
+    // failure with the specified 'line'.
+{
+    const bsl::string EXP = immediateFormat(format, arg1, arg2);
+    const bsl::string act = deferredFormat(format, arg1, arg2);
+
+    if (veryVerbose) { T_ P_(line) P_(format) P(act) }
+
+    ASSERTV(line, format, EXP, act, EXP == act);
+}
+
+template <class ARG1, class ARG2, class ARG3>
+void check(int line, const char *format, ARG1 arg1, ARG2 arg2, ARG3 arg3)
+    // Verify that the text rendered from the captured 'format' and specified
+    // 'arg1', 'arg2', and 'arg3' matches the text produced by 'vsnprintf',
+    // reporting a failure with the specified 'line'.
+{
+    const bsl::string EXP = immediateFormat(format, arg1, arg2, arg3);
+    const bsl::string act = deferredFormat(format, arg1, arg2, arg3);
+
+    if (veryVerbose) { T_ P_(line) P_(format) P(act) }
+
+    ASSERTV(line, format, EXP, act, EXP == act);
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose     = argc > 2;
+    veryVerbose = argc > 3;
+
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE"
+                          << endl << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting on Another Thread
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose a latency-sensitive thread must report a value, but the cost of
+// formatting that report should be borne by another thread.
+//
+// First, the latency-sensitive thread captures the arguments of the report
+// into a stream buffer:
+//..
+    const char *FORMAT = "order %d filled at %.2f (%s)";
+
+    bdlsb::MemOutStreamBuf arguments;
+    ball::DeferredFormatUtil::capture(&arguments, FORMAT, 42, 99.5, "IBM");
+//..
+// Note that the captured string "IBM" is copied into 'arguments'.
+//
+// Then, the encoded arguments (and the format) are passed to another thread
+// (not shown).
+//
+// Finally, that thread renders the report:
+//..
+    bdlsb::MemOutStreamBuf text;
+    ball::DeferredFormatUtil::render(&text,
+                                     FORMAT,
+                                     arguments.data(),
+                                     arguments.length());
+
+    ASSERT(bsl::string(text.data(), text.length())
+                                          == "order 42 filled at 99.50 (IBM)");
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // UNSUPPORTED CONVERSIONS AND INCOMPLETE ARGUMENTS
+        //
+        // Concerns:
+        //: 1 A positional argument, or an unrecognized conversion, stops
+        //:   capture, and the remainder of the format (from that conversion)
+        //:   is rendered verbatim.
+        //:
+        //: 2 If the encoded arguments are incomplete, or do not match the
+        //:   type required by a conversion, the remainder of the format (from
+        //:   that conversion) is rendered verbatim.
+        //:
+        //: 3 A format ending in an incomplete conversion is rendered
+        //:   verbatim from that conversion.
+        //
+        // Plan:
+        //: 1 Capture and render formats containing positional and
+        //:   unrecognized conversions.  (C-1)
+        //:
+        //: 2 Render every prefix of an encoding, and render an encoding with
+        //:   a format requiring different types.  (C-2)
+        //:
+        //: 3 Render a format ending in '%' and in '%5.2'.  (C-3)
+        //
+        // Testing:
+        //   UNSUPPORTED CONVERSIONS AND INCOMPLETE ARGUMENTS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                         << "UNSUPPORTED CONVERSIONS AND INCOMPLETE ARGUMENTS"
+                         << endl
+                         << "================================================"
+                         << endl;
+
+        if (verbose) cout << "\tUnsupported conversions." << endl;
+        {
+            ASSERT("1 %2$d %d" == deferredFormat("%d %2$d %d", 1, 2, 3));
+            ASSERT("1 %y %d"   == deferredFormat("%d %y %d", 1, 3));
+            ASSERT("4 %Q"      == deferredFormat("%ld %Q", 4L));
+        }
+
+        if (verbose) cout << "\tIncomplete arguments." << endl;
+        {
+            const char *FORMAT = "a=%d b=%s c=%5.1f";
+
+            bdlsb::MemOutStreamBuf encoded;
+            Util::capture(&encoded, FORMAT, 12, "xyz", 2.25);
+
+            const bsl::size_t LENGTH = encoded.length();
+
+            for (bsl::size_t i = 0; i <= LENGTH; ++i) {
+                bdlsb::MemOutStreamBuf text;
+                Util::render(&text, FORMAT, encoded.data(), i);
+
+                const bsl::string result(text.data(), text.length());
+
+                if (veryVerbose) { T_ P_(i) P(result) }
+
+                if (LENGTH == i) {
+                    ASSERTV(result, "a=12 b=xyz c=  2.2" == result);
+                }
+                else {
+                    ASSERTV(i,
+                            result,
+                            FORMAT                 == result
+                         || "a=12 b=%s c=%5.1f"    == result
+                         || "a=12 b=xyz c=%5.1f"   == result);
+                }
+            }
+
+            bdlsb::MemOutStreamBuf text;
+            Util::render(&text,
+                         "a=%s b=%s c=%5.1f",
+                         encoded.data(),
+                         encoded.length());
+            ASSERT("a=%s b=%s c=%5.1f" ==
+                                      bsl::string(text.data(), text.length()));
+        }
+
+        if (verbose) cout << "\tIncomplete conversions." << endl;
+        {
+            ASSERT("5 %"     == deferredFormat("%d %", 5));
+            ASSERT("5 %5.2"  == deferredFormat("%d %5.2", 5));
+            ASSERT("5 %l"    == deferredFormat("%d %l", 5));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // STRINGS AND DEVIATIONS FROM 'printf'
+        //
+        // Concerns:
+        //: 1 Strings are copied when captured.
+        //:
+        //: 2 A null string is rendered as "(null)".
+        //:
+        //: 3 Strings longer than the local rendering buffer are rendered
+        //:   completely, and without allocating memory.  Other conversions
+        //:   longer than the local buffer allocate temporary memory from the
+        //:   supplied allocator.
+        //:
+        //: 4 Wide characters and strings are rendered as narrow characters,
+        //:   with '?' substituted for non-ASCII characters.
+        //:
+        //: 5 '%n' consumes its argument, stores nothing, and produces no
+        //:   output, and '%%' produces '%'.
+        //:
+        //: 6 A format without conversions is rendered verbatim, and captures
+        //:   nothing.
+        //:
+        //: 7 A string converted with a precision, given in the format or as
+        //:   '*', is not read beyond that many characters, so it need not be
+        //:   null-terminated.
+        //
+        // Plan:
+        //: 1 Capture a string from a buffer, overwrite the buffer, then
+        //:   render.  (C-1)
+        //:
+        //: 2 Render a null string with '%s' and with a field width.  (C-2)
+        //:
+        //: 3 Render a string of 5000 characters, with and without a
+        //:   precision, and render a long string and a long floating-point
+        //:   value with a supplied test allocator and a test allocator
+        //:   installed as the default.  (C-3)
+        //:
+        //: 4 Render '%lc' and '%ls' arguments.  (C-4)
+        //:
+        //: 5 Render formats containing '%n' and '%%'.  (C-5..6)
+        //:
+        //: 6 Capture, with a precision, narrow and wide character arrays
+        //:   that have no null terminator and are followed by other non-null
+        //:   characters, and verify the rendered text and that the encoded
+        //:   string holds exactly the characters within the precision.
+        //:   (C-7)
+        //
+        // Testing:
+        //   STRINGS AND DEVIATIONS FROM 'printf'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "STRINGS AND DEVIATIONS FROM 'printf'"
+                          << endl << "====================================="
+                          << endl;
+
+        if (verbose) cout << "\tStrings are copied." << endl;
+        {
+            char buffer[] = "hello";
+
+            bdlsb::MemOutStreamBuf encoded;
+            Util::capture(&encoded, "<%s>", buffer);
+            bsl::strcpy(buffer, "HELLO");
+
+            bdlsb::MemOutStreamBuf text;
+            Util::render(&text, "<%s>", encoded.data(), encoded.length());
+            ASSERT("<hello>" == bsl::string(text.data(), text.length()));
+        }
+
+        if (verbose) cout << "\tNull strings." << endl;
+        {
+            const char *NULL_STRING = 0;
+
+            ASSERT("(null)"       == deferredFormat("%s", NULL_STRING));
+            ASSERT("  (null)"     == deferredFormat("%8s", NULL_STRING));
+        }
+
+        if (verbose) cout << "\tLong strings." << endl;
+        {
+            const bsl::string LONG(5000, 'x');
+
+            ASSERT(LONG == deferredFormat("%s", LONG.c_str()));
+            ASSERT(LONG + LONG ==
+                        deferredFormat("%s%s", LONG.c_str(), LONG.c_str()));
+            ASSERT(bsl::string(300, 'x') ==
+                                   deferredFormat("%.300s", LONG.c_str()));
+            check(L_, "%6000s|", LONG.c_str());
+            check(L_, "%-*s|", 5500, "abc");
+        }
+
+        if (verbose) cout << "\tTemporary memory." << endl;
+        {
+            bslma::TestAllocator         da("default",  veryVeryVerbose);
+            bslma::TestAllocator         sa("supplied", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            char                        buffer[8192];
+            bdlsb::FixedMemOutStreamBuf encoded(buffer, 2048);
+            bdlsb::FixedMemOutStreamBuf text(buffer + 2048,
+                                             sizeof buffer - 2048);
+
+            const char *FORMAT = "%s %.300f %d";
+
+            char LONG[1001];
+            bsl::memset(LONG, 'y', 1000);
+            LONG[1000] = 0;
+
+            Util::capture(&encoded, FORMAT, LONG, 1.0 / 3, 5);
+            Util::render(&text, FORMAT, buffer, encoded.length(), &sa);
+
+            ASSERT(1000 + 1 + 302 + 2 == text.length());
+            ASSERT(0 == da.numBlocksTotal());
+            ASSERT(0 <  sa.numBlocksTotal());
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tWide characters." << endl;
+        {
+            const wchar_t WIDE[] = { L'a', L'b', 0x263a, L'c', 0 };
+            const wint_t  SMILE  = 0x263a;
+            const wint_t  Z      = L'z';
+
+            ASSERT("[ab?c]"   == deferredFormat("[%ls]", WIDE));
+            ASSERT("[  ab?c]" == deferredFormat("[%6ls]", WIDE));
+            ASSERT("[ab]"     == deferredFormat("[%.2ls]", WIDE));
+            ASSERT("z?"       == deferredFormat("%lc%lc", Z, SMILE));
+
+            const wchar_t *NULL_STRING = 0;
+            ASSERT("(null)"   == deferredFormat("%ls", NULL_STRING));
+        }
+
+        if (verbose) cout << "\t'%n' and '%%'." << endl;
+        {
+            int count = -1;
+
+            ASSERT("ab7"  == deferredFormat("ab%n%d", &count, 7));
+            ASSERT(-1     == count);
+            ASSERT("100%" == deferredFormat("%d%%", 100));
+            ASSERT("%5"   == deferredFormat("%%%d", 5));
+        }
+
+        if (verbose) cout << "\tStrings without null terminator." << endl;
+        {
+            // Each encoded string holds a one-byte tag, a 32-bit length, its
+            // characters, and a null terminator.
+
+            const bsl::size_t STRING_OVERHEAD = 1 + 4 + 1;
+
+            struct {
+                char d_text[4];
+                char d_following[8];
+            } narrow = { { 'a', 'b', 'c', 'd' },
+                         { 'X', 'X', 'X', 'X', 'X', 'X', 'X', 'X' } };
+
+            {
+                bdlsb::MemOutStreamBuf encoded;
+                Util::capture(&encoded, "<%.4s>", narrow.d_text);
+                ASSERTV(encoded.length(),
+                        STRING_OVERHEAD + 4 == encoded.length());
+
+                bdlsb::MemOutStreamBuf text;
+                Util::render(&text,
+                             "<%.4s>",
+                             encoded.data(),
+                             encoded.length());
+                ASSERT("<abcd>" == bsl::string(text.data(), text.length()));
+            }
+
+            {
+                // The precision is given as '*', after a '*' field width.
+
+                const int STAR_OVERHEAD = 1 + sizeof(int);
+
+                bdlsb::MemOutStreamBuf encoded;
+                Util::capture(&encoded, "<%*.*s>", 6, 3, narrow.d_text);
+                ASSERTV(encoded.length(),
+                        2 * STAR_OVERHEAD + STRING_OVERHEAD + 3 ==
+                                                            encoded.length());
+
+                bdlsb::MemOutStreamBuf text;
+                Util::render(&text,
+                             "<%*.*s>",
+                             encoded.data(),
+                             encoded.length());
+                ASSERT("<   abc>" == bsl::string(text.data(), text.length()));
+            }
+
+            ASSERT("ab"   == deferredFormat("%.2s", narrow.d_text));
+            ASSERT("abcd" == deferredFormat("%.*s", 4, narrow.d_text));
+            ASSERT("ab"   == deferredFormat("%.5s", "ab"));
+
+            struct {
+                wchar_t d_text[3];
+                wchar_t d_following[4];
+            } wide = { { L'x', L'y', L'z' }, { L'W', L'W', L'W', L'W' } };
+
+            {
+                bdlsb::MemOutStreamBuf encoded;
+                Util::capture(&encoded, "%.3ls", wide.d_text);
+                ASSERTV(encoded.length(),
+                        STRING_OVERHEAD + 3 == encoded.length());
+            }
+
+            ASSERT("xyz" == deferredFormat("%.3ls", wide.d_text));
+            ASSERT("xy"  == deferredFormat("%.*ls", 2, wide.d_text));
+        }
+
+        if (verbose) cout << "\tNo conversions." << endl;
+        {
+            bdlsb::MemOutStreamBuf encoded;
+            Util::capture(&encoded, "plain text");
+            ASSERT(0 == encoded.length());
+
+            bdlsb::MemOutStreamBuf text;
+            Util::render(&text, "plain text", 0, 0);
+            ASSERT("plain text" == bsl::string(text.data(), text.length()));
+
+            ASSERT("" == deferredFormat(""));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CAPTURE AND RENDER
+        //
+        // Concerns:
+        //: 1 Every supported conversion, with every applicable length
+        //:   modifier, is rendered exactly as by 'vsnprintf'.
+        //:
+        //: 2 Flags, field widths, and precisions, including those supplied
+        //:   by '*' arguments, are honored.
+        //:
+        //: 3 Values at the limits of their types are rendered exactly, and
+        //:   length modifiers truncate values as 'printf' does.
+        //:
+        //: 4 'capture' appends to the supplied stream buffer.
+        //
+        // Plan:
+        //: 1 Using 'check', compare the rendered text with the output of
+        //:   'vsnprintf' for a set of formats and values.  (C-1..3)
+        //:
+        //: 2 Capture into a stream buffer holding data, and render from the
+        //:   appended portion.  (C-4)
+        //
+        // Testing:
+        //   void capture(bsl::streambuf *arguments, const char *format, ...);
+        //   void render(streambuf *, const char *, const char *, size_t, *ba);
+        //   void vcapture(bsl::streambuf *, const char *, bsl::va_list);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CAPTURE AND RENDER"
+                          << endl << "==================" << endl;
+
+        if (verbose) cout << "\tSigned integers." << endl;
+        {
+            check(L_, "%d",      0);
+            check(L_, "%d",      INT_MIN);
+            check(L_, "%i",      INT_MAX);
+            check(L_, "%+5d|",   42);
+            check(L_, "%-5d|",   42);
+            check(L_, "% 05d|",  -42);
+            check(L_, "%.3d",    7);
+            check(L_, "%hd",     70000);
+            check(L_, "%hhd",    300);
+            check(L_, "%hhi",    -129);
+            check(L_, "%ld",     LONG_MIN);
+            check(L_, "%lld",    LLONG_MAX);
+            check(L_, "%qd",     -1LL);
+            check(L_, "%jd",     static_cast<bsl::intmax_t>(-5));
+            check(L_, "%zd",     static_cast<bsl::size_t>(-5));
+            check(L_, "%td",     static_cast<bsl::ptrdiff_t>(-9));
+        }
+
+        if (verbose) cout << "\tUnsigned integers." << endl;
+        {
+            check(L_, "%u",      UINT_MAX);
+            check(L_, "%o",      8u);
+            check(L_, "%#o",     8u);
+            check(L_, "%x",      0xbeefu);
+            check(L_, "%#X",     0xbeefu);
+            check(L_, "%08x",    0xbeefu);
+            check(L_, "%hu",     70000u);
+            check(L_, "%hhx",    0x1ffu);
+            check(L_, "%lu",     ULONG_MAX);
+            check(L_, "%llx",    ULLONG_MAX);
+            check(L_, "%ju",     static_cast<bsl::uintmax_t>(17));
+            check(L_, "%zu",     static_cast<bsl::size_t>(123456789));
+            check(L_, "%tx",     static_cast<bsl::ptrdiff_t>(-1));
+            check(L_, "%u",      -1);
+        }
+
+        if (verbose) cout << "\tFloating-point values." << endl;
+        {
+            check(L_, "%f",      1.5);
+            check(L_, "%.0f",    2.5);
+            check(L_, "%10.3f|", -3.14159);
+            check(L_, "%-10.3e|", 12345.678);
+            check(L_, "%E",      1e-300);
+            check(L_, "%g",      0.0001);
+            check(L_, "%G",      1e20);
+            check(L_, "%#g",     1.0);
+            check(L_, "%a",      1.0);
+            check(L_, "%A",      -0.5);
+            check(L_, "%F",      1e308 * 10);
+            check(L_, "%f",      1.5f);
+            check(L_, "%.40f",   1.0 / 3);
+            check(L_, "%Lf",     static_cast<long double>(1) / 3);
+            check(L_, "%.20Lg",  static_cast<long double>(2) / 3);
+            check(L_, "%f",      1e300);
+        }
+
+        if (verbose) cout << "\tCharacters, strings, and pointers." << endl;
+        {
+            int object;
+
+            check(L_, "%c",      'a');
+            check(L_, "[%3c]",   'b');
+            check(L_, "[%-3c]",  'c');
+            check(L_, "%s",      "text");
+            check(L_, "[%8s]",   "text");
+            check(L_, "[%-8s]",  "text");
+            check(L_, "[%.2s]",  "text");
+            check(L_, "%s",      "");
+            check(L_, "%p",      static_cast<void *>(&object));
+            check(L_, "%p",      static_cast<void *>(0));
+            check(L_, "[%20p]",  static_cast<void *>(&object));
+        }
+
+        if (verbose) cout << "\t'*' field widths and precisions." << endl;
+        {
+            check(L_, "[%*d]",    6, 42);
+            check(L_, "[%*d]",   -6, 42);
+            check(L_, "[%.*d]",   4, 42);
+            check(L_, "[%*.*f]", 10, 2, 3.14159);
+            check(L_, "[%-*.*s]", 8, 3, "abcdef");
+            check(L_, "[%.*s]",  -1, "abcdef");
+            check(L_, "[%*c]",    4, 'x');
+            check(L_, "[%*.*Lf]", 12, 3, static_cast<long double>(1) / 7);
+        }
+
+        if (verbose) cout << "\tMultiple conversions." << endl;
+        {
+            check(L_, "%d %s %f",       1, "two", 3.0);
+            check(L_, "%s=%lld (%c)",   "x", 9LL, 'y');
+            check(L_, "%%%d%%%s%%",     5, "z");
+            check(L_, "pre %5.1f post", 2.25);
+            check(L_, "%hhd%hd%d",      -1, -2, -3);
+        }
+
+        if (verbose) cout << "\tAppending to a stream buffer." << endl;
+        {
+            bdlsb::MemOutStreamBuf encoded;
+            encoded.sputn("prefix", 6);
+
+            Util::capture(&encoded, "%d-%s", 17, "abc");
+
+            bdlsb::MemOutStreamBuf text;
+            Util::render(&text,
+                         "%d-%s",
+                         encoded.data() + 6,
+                         encoded.length() - 6);
+            ASSERT("17-abc" == bsl::string(text.data(), text.length()));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Capture and render a format with several conversions.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST"
+                          << endl << "==============" << endl;
+
+        bdlsb::MemOutStreamBuf encoded;
+        Util::capture(&encoded, "%s: %d of %5.2f%%", "progress", 3, 42.125);
+        ASSERT(0 < encoded.length());
+
+        bdlsb::MemOutStreamBuf text;
+        Util::render(&text,
+                     "%s: %d of %5.2f%%",
+                     encoded.data(),
+                     encoded.length());
+
+        const bsl::string result(text.data(), text.length());
+        if (veryVerbose) { P(result) }
+
+        ASSERT("progress: 3 of 42.12%" == result
+            || "progress: 3 of 42.13%" == result);
+        ASSERT(immediateFormat("%s: %d of %5.2f%%", "progress", 3, 42.125)
+                                                                    == result);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CAPTURE VS. 'vsnprintf'
+        //
+        // Concerns:
+        //: 1 Capturing arguments is faster than formatting them.
+        //
+        // Plan:
+        //: 1 Time capturing a typical log message format, and time formatting
+        //:   the same format with 'vsnprintf', and report the time per
+        //:   message for each (and for rendering the captured arguments).
+        //
+        // Testing:
+        //   PERFORMANCE: CAPTURE VS. 'vsnprintf'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "PERFORMANCE: CAPTURE VS. 'vsnprintf'"
+                          << endl << "===================================="
+                          << endl;
+
+        const int   NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+        const char *FORMAT = "order %d for %s: %lld shares at %.4f (%x)";
+
+        bdlsb::MemOutStreamBuf encoded;
+        char                   buffer[256];
+        bsls::Stopwatch        timer;
+
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            encoded.pubseekpos(0);
+            Util::capture(&encoded, FORMAT, i, "IBM", 100LL * i, 1.5 * i, i);
+        }
+        timer.stop();
+        const double captureTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            bsl::snprintf(buffer,
+                          sizeof buffer,
+                          FORMAT,
+                          i,
+                          "IBM",
+                          100LL * i,
+                          1.5 * i,
+                          i);
+        }
+        timer.stop();
+        const double formatTime = timer.elapsedTime();
+
+        bdlsb::MemOutStreamBuf text;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            text.pubseekpos(0);
+            Util::render(&text, FORMAT, encoded.data(), encoded.length());
+        }
+        timer.stop();
+        const double renderTime = timer.elapsedTime();
+
+        cout << "capture:   " << captureTime * 1e9 / NUM_ITERATIONS
+             << " ns/message" << endl
+             << "snprintf:  " << formatTime * 1e9 / NUM_ITERATIONS
+             << " ns/message" << endl
+             << "render:    " << renderTime * 1e9 / NUM_ITERATIONS
+             << " ns/message" << endl;
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
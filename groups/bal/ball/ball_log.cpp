@@ -74,6 +74,27 @@ Record *Log::getRecord(const Category *category, const char *file, int line)
     }
 }
 
+void Log::logDeferredMessage(const Category *category,
+                             int             severity,
+                             const char     *fileName,
+                             int             lineNumber,
+                             const char     *format,
+                             ...)
+{
+    BSLS_ASSERT(1 <= severity);  BSLS_ASSERT(severity <= 255);
+    BSLS_ASSERT(fileName);
+    BSLS_ASSERT(format);
+
+    Record *record = getRecord(category, fileName, lineNumber);
+
+    bsl::va_list arguments;
+    va_start(arguments, format);
+    record->fixedFields().setDeferredMessage(format, arguments);
+    va_end(arguments);
+
+    logMessage(category, severity, record);
+}
+
 void Log::logMessage(const Category *category,
                      int             severity,
                      const char     *fileName,
@@ -283,6 +283,28 @@ BSLS_IDENT("$Id: $")
 //      compatible with the format specification in 'MSG'.  Note that each use
 //      of this macro must be terminated by a ';'.
 //..
+// Each of the 'printf'-style macros has a deferred-format counterpart that
+// captures the values of the arguments rather than formatting them:
+//..
+//  BALL_LOGDF_TRACE(MSG, ...);
+//  BALL_LOGDF_DEBUG(MSG, ...);
+//  BALL_LOGDF_INFO( MSG, ...);
+//  BALL_LOGDF_WARN( MSG, ...);
+//  BALL_LOGDF_ERROR(MSG, ...);
+//  BALL_LOGDF_FATAL(MSG, ...);
+//  BALL_LOGDF(SEVERITY, MSG, ...);
+//      Log a message with the severity indicated by the name of the macro (or
+//      the specified 'SEVERITY') as by the corresponding 'BALL_LOGVA' macro,
+//      but defer the formatting of the message until the message is first
+//      accessed, typically by an observer (e.g., on the publication thread of
+//      'ball::AsyncFileObserver').  The values of the arguments (including
+//      the characters of any strings) are copied into the log record, but
+//      'MSG' is not, and must therefore be a string literal (or otherwise
+//      remain valid until the record is published).  The behavior is
+//      undefined unless the number and types of optional arguments are
+//      compatible with the format specification in 'MSG'.  See {Deferred
+//      Message Formatting} in 'ball_recordattributes'.
+//..
 //
 ///Macros for Logging Code Blocks
 /// - - - - - - - - - - - - - - -
@@ -1268,6 +1290,23 @@ do {                                                                          \
     }                                                                         \
 } while(0)
 
+// BALL_LOGDF_CONST_IMP requires its first argument to be a compile-time
+// constant, while all the others may be variables.
+
+#define BALL_LOGDF_CONST_IMP(SEVERITY, ...)                                   \
+do {                                                                          \
+    if (const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =    \
+               BloombergLP::ball::Log::categoryHolderIfEnabled<(SEVERITY)>(   \
+                      ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER))) { \
+        BloombergLP::ball::Log::logDeferredMessage(                           \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       (SEVERITY),                            \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       __VA_ARGS__);                          \
+    }                                                                         \
+} while(0)
+
                        // =====================
                        // 'printf'-style macros
                        // =====================
@@ -1311,6 +1350,44 @@ do {                                                                          \
 #define BALL_LOGVA_FATAL(...)                                                 \
     BALL_LOGVA_CONST_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
 
+                  // =====================================
+                  // Deferred-format 'printf'-style macros
+                  // =====================================
+
+#define BALL_LOGDF(SEVERITY, ...)                                             \
+do {                                                                          \
+    const BloombergLP::ball::CategoryHolder *ball_log_cAtEgOrYhOlDeR =        \
+                         ball_log_getCategoryHolder(BALL_LOG_CATEGORYHOLDER); \
+    if (ball_log_cAtEgOrYhOlDeR->threshold() >= (SEVERITY) &&                 \
+           BloombergLP::ball::Log::isCategoryEnabled(ball_log_cAtEgOrYhOlDeR, \
+                                                     (SEVERITY))) {           \
+        BloombergLP::ball::Log::logDeferredMessage(                           \
+                                       ball_log_cAtEgOrYhOlDeR->category(),   \
+                                       (SEVERITY),                            \
+                                       __FILE__,                              \
+                                       __LINE__,                              \
+                                       __VA_ARGS__);                          \
+    }                                                                         \
+} while(0)
+
+#define BALL_LOGDF_TRACE(...)                                                 \
+    BALL_LOGDF_CONST_IMP(BloombergLP::ball::Severity::e_TRACE, __VA_ARGS__)
+
+#define BALL_LOGDF_DEBUG(...)                                                 \
+    BALL_LOGDF_CONST_IMP(BloombergLP::ball::Severity::e_DEBUG, __VA_ARGS__)
+
+#define BALL_LOGDF_INFO( ...)                                                 \
+    BALL_LOGDF_CONST_IMP(BloombergLP::ball::Severity::e_INFO,  __VA_ARGS__)
+
+#define BALL_LOGDF_WARN( ...)                                                 \
+    BALL_LOGDF_CONST_IMP(BloombergLP::ball::Severity::e_WARN,  __VA_ARGS__)
+
+#define BALL_LOGDF_ERROR(...)                                                 \
+    BALL_LOGDF_CONST_IMP(BloombergLP::ball::Severity::e_ERROR, __VA_ARGS__)
+
+#define BALL_LOGDF_FATAL(...)                                                 \
+    BALL_LOGDF_CONST_IMP(BloombergLP::ball::Severity::e_FATAL, __VA_ARGS__)
+
                        // ==============
                        // Utility Macros
                        // ==============
@@ -1391,6 +1468,25 @@ struct Log {
         // default allocator otherwise.  The behavior is undefined unless the
         // logger manager singleton is initialized when 'category' is non-null.
 
+    static void logDeferredMessage(const Category *category,
+                                   int             severity,
+                                   const char     *fileName,
+                                   int             lineNumber,
+                                   const char     *format,
+                                   ...) BSLS_ANNOTATION_PRINTF(5, 6);
+        // Log a record containing the text produced by formatting the
+        // variable argument list according to the specified 'printf'-style
+        // 'format', the specified 'fileName', 'lineNumber', and 'severity',
+        // and the name of the specified 'category', as if by 'logMessage'.
+        // The values of the arguments are captured, but the message text is
+        // not rendered until it is first accessed (typically by an observer,
+        // possibly on another thread).  The behavior is undefined unless the
+        // variable arguments are valid for 'format', 'format' remains valid
+        // until the message is rendered, 'severity' is in the range
+        // '[1 .. 255]', and the logger manager singleton is initialized when
+        // 'category' is non-null.  See {Deferred Message Formatting} in
+        // 'ball_recordattributes'.
+
     static void logMessage(const Category *category,
                            int             severity,
                            const char     *fileName,
@@ -118,6 +118,7 @@ using bsl::flush;
 // [ 1] static char *messageBuffer();
 // [ 1] static int messageBufferSize();
 // [ 1] static void logMessage(*category, severity, *file, line, *msg);
+// [41] static void logDeferredMessage(*cat, sev, *file, line, *fmt, ...);
 // [ 1] static const ball::Category *setCategory(const char *categoryName);
 // ----------------------------------------------------------------------------
 // [ 2] BALL_LOG_SET_CATEGORY
@@ -164,6 +165,9 @@ using bsl::flush;
 // [38] RULE-BASED LOGGING USAGE EXAMPLE
 // [39] CLASS-SCOPE LOGGING USAGE EXAMPLE
 // [40] BASIC LOGGING USAGE EXAMPLE
+// [41] DEFERRED-FORMAT MACROS
+// [-3] PERFORMANCE: STREAM VS. PRINTF VS. DEFERRED MACROS
+// [-4] PERFORMANCE: DISABLED STATEMENTS IN RULE-BASED CATEGORIES
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -692,6 +696,50 @@ void processData(int                      uuid,
 }  // close enterprise namespace
 
 
+// ============================================================================
+//                         CASE 41 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_41 {
+
+class DeferralObserver : public BloombergLP::ball::Observer {
+    // This class implements an observer that records, for the last published
+    // record, whether its message was deferred on receipt, and its message.
+
+    // DATA
+    bool        d_wasDeferred;  // whether the last message was deferred
+    bsl::string d_message;      // text of the last message
+    int         d_numRecords;   // number of published records
+
+  public:
+    // CREATORS
+    DeferralObserver()
+    : d_wasDeferred(false)
+    , d_message()
+    , d_numRecords(0)
+    {
+    }
+
+    // MANIPULATORS
+    using BloombergLP::ball::Observer::publish;
+
+    void publish(
+             const bsl::shared_ptr<const BloombergLP::ball::Record>& record,
+             const BloombergLP::ball::Context&)
+    {
+        d_wasDeferred = record->fixedFields().isMessageDeferred();
+        d_message     = record->fixedFields().message();
+        ++d_numRecords;
+    }
+
+    // ACCESSORS
+    const bsl::string& message() const { return d_message; }
+    int numRecords() const { return d_numRecords; }
+    bool wasDeferred() const { return d_wasDeferred; }
+};
+
+}  // close namespace BALL_LOG_TEST_CASE_41
+
 // ============================================================================
 //                         CASE 35 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2917,6 +2965,42 @@ void *workerThreadPerformance(void *)
 
 }  // close namespace BALL_LOG_TEST_CASE_MINUS_2
 
+// ============================================================================
+//                         CASE -3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOG_TEST_CASE_MINUS_3 {
+
+class CountingObserver : public BloombergLP::ball::Observer {
+    // This class implements an observer that counts published records without
+    // accessing them, so that the cost of logging measured in case -3 is the
+    // cost borne by the logging thread.
+
+    // DATA
+    int d_numRecords;  // number of published records
+
+  public:
+    // CREATORS
+    CountingObserver()
+    : d_numRecords(0)
+    {
+    }
+
+    // MANIPULATORS
+    using BloombergLP::ball::Observer::publish;
+
+    void publish(const bsl::shared_ptr<const BloombergLP::ball::Record>&,
+                 const BloombergLP::ball::Context&)
+    {
+        ++d_numRecords;
+    }
+
+    // ACCESSORS
+    int numRecords() const { return d_numRecords; }
+};
+
+}  // close namespace BALL_LOG_TEST_CASE_MINUS_3
+
 // ============================================================================
 //                              MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2934,6 +3018,174 @@ int main(int argc, char *argv[])
     TestAllocator ta("test", veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 41: {
+        // --------------------------------------------------------------------
+        // DEFERRED-FORMAT MACROS
+        //
+        // Concerns:
+        //: 1 Each 'BALL_LOGDF' macro logs a record having the expected
+        //:   category, severity, file name, line number, and message.
+        //:
+        //: 2 The message of a record logged by a 'BALL_LOGDF' macro is not
+        //:   formatted before the record is published.
+        //:
+        //: 3 A 'BALL_LOGDF' macro has no effect if its severity is not
+        //:   enabled for the category in scope.
+        //:
+        //: 4 Arguments are captured by value when the macro is invoked.
+        //
+        // Plan:
+        //: 1 Register an observer recording whether the message of each
+        //:   published record is deferred, and invoke each macro, verifying
+        //:   the published record.  (C-1..2)
+        //:
+        //: 2 Invoke each macro in a category that disables its severity.
+        //:   (C-3)
+        //:
+        //: 3 Log a string from a buffer and overwrite the buffer before the
+        //:   message is accessed.  (C-4)
+        //
+        // Testing:
+        //   BALL_LOGDF
+        //   BALL_LOGDF_TRACE
+        //   BALL_LOGDF_DEBUG
+        //   BALL_LOGDF_INFO
+        //   BALL_LOGDF_WARN
+        //   BALL_LOGDF_ERROR
+        //   BALL_LOGDF_FATAL
+        //   static void logDeferredMessage(*cat, sev, *file, line, *fmt, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nDEFERRED-FORMAT MACROS"
+                               << "\n======================" << bsl::endl;
+
+        using namespace BALL_LOG_TEST_CASE_41;
+
+        BloombergLP::ball::LoggerManagerConfiguration lmc;
+        BloombergLP::ball::LoggerManagerScopedGuard   lmg(lmc, &ta);
+
+        bsl::shared_ptr<DeferralObserver> observer(new (ta) DeferralObserver(),
+                                                   &ta);
+
+        BloombergLP::ball::LoggerManager& manager =
+                                 BloombergLP::ball::LoggerManager::singleton();
+
+        ASSERT(0 == manager.registerObserver(observer, "test"));
+
+        const int TRACE = BloombergLP::ball::Severity::e_TRACE;
+        const int DEBUG = BloombergLP::ball::Severity::e_DEBUG;
+        const int INFO  = BloombergLP::ball::Severity::e_INFO;
+        const int WARN  = BloombergLP::ball::Severity::e_WARN;
+        const int ERROR = BloombergLP::ball::Severity::e_ERROR;
+        const int FATAL = BloombergLP::ball::Severity::e_FATAL;
+
+        BloombergLP::ball::Administration::addCategory("pass", 0, TRACE, 0, 0);
+        BloombergLP::ball::Administration::addCategory("none", 0, 0, 0, 0);
+
+        if (veryVerbose) bsl::cout << "\tEnabled severities." << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("pass")
+
+            BALL_LOGDF_TRACE("trace %d", 1);
+            ASSERT(1            == observer->numRecords());
+            ASSERT(true         == observer->wasDeferred());
+            ASSERT("trace 1"    == observer->message());
+
+            BALL_LOGDF_DEBUG("debug %s", "two");
+            ASSERT(2            == observer->numRecords());
+            ASSERT(true         == observer->wasDeferred());
+            ASSERT("debug two"  == observer->message());
+
+            BALL_LOGDF_INFO("info %.1f", 3.0);
+            ASSERT(3            == observer->numRecords());
+            ASSERT(true         == observer->wasDeferred());
+            ASSERT("info 3.0"   == observer->message());
+
+            BALL_LOGDF_WARN("warn %c", '4');
+            ASSERT(4            == observer->numRecords());
+            ASSERT(true         == observer->wasDeferred());
+            ASSERT("warn 4"     == observer->message());
+
+            BALL_LOGDF_ERROR("error %x", 5u);
+            ASSERT(5            == observer->numRecords());
+            ASSERT(true         == observer->wasDeferred());
+            ASSERT("error 5"    == observer->message());
+
+            BALL_LOGDF_FATAL("fatal %lld", 6LL);
+            ASSERT(6            == observer->numRecords());
+            ASSERT(true         == observer->wasDeferred());
+            ASSERT("fatal 6"    == observer->message());
+
+            int severity = WARN;
+            BALL_LOGDF(severity, "severity %d", severity);
+            ASSERT(7            == observer->numRecords());
+            ASSERT(true         == observer->wasDeferred());
+            ASSERT("severity 96" == observer->message());
+
+            BALL_LOGDF_INFO("no arguments");
+            ASSERT(8            == observer->numRecords());
+            ASSERT("no arguments" == observer->message());
+        }
+
+        if (veryVerbose) bsl::cout << "\tRecorded fields." << bsl::endl;
+        {
+            bsl::shared_ptr<BloombergLP::ball::TestObserver> testObserver(
+               new (ta) BloombergLP::ball::TestObserver(&bsl::cout, &ta), &ta);
+
+            ASSERT(0 == manager.registerObserver(testObserver, "test2"));
+
+            BALL_LOG_SET_CATEGORY("pass")
+
+            const int LINE = L_ + 1;
+            BALL_LOGDF_ERROR("%s=%d", "value", 42);
+            ASSERT(u::isRecordOkay(testObserver,
+                                   BALL_LOG_CATEGORY,
+                                   ERROR,
+                                   __FILE__,
+                                   LINE,
+                                   "value=42"));
+
+            ASSERT(0 == manager.deregisterObserver("test2"));
+        }
+
+        if (veryVerbose) bsl::cout << "\tDisabled severities." << bsl::endl;
+        {
+            BALL_LOG_SET_CATEGORY("none")
+
+            const int NUM_RECORDS = observer->numRecords();
+
+            BALL_LOGDF_TRACE("%d", 1);
+            BALL_LOGDF_DEBUG("%d", 1);
+            BALL_LOGDF_INFO( "%d", 1);
+            BALL_LOGDF_WARN( "%d", 1);
+            BALL_LOGDF_ERROR("%d", 1);
+            BALL_LOGDF_FATAL("%d", 1);
+            BALL_LOGDF(INFO, "%d", 1);
+
+            ASSERT(NUM_RECORDS == observer->numRecords());
+        }
+
+        if (veryVerbose) bsl::cout << "\tCapture by value." << bsl::endl;
+        {
+            bsl::shared_ptr<BloombergLP::ball::TestObserver> testObserver(
+               new (ta) BloombergLP::ball::TestObserver(&bsl::cout, &ta), &ta);
+
+            ASSERT(0 == manager.deregisterObserver("test"));
+            ASSERT(0 == manager.registerObserver(testObserver, "test2"));
+
+            BALL_LOG_SET_CATEGORY("pass")
+
+            char buffer[] = "before";
+            BALL_LOGDF_INFO("<%s>", buffer);
+            bsl::strcpy(buffer, "after!");
+
+            const BloombergLP::ball::RecordAttributes& fields =
+                             testObserver->lastPublishedRecord().fixedFields();
+            ASSERT(0 == bsl::strcmp("<before>", fields.message()));
+        }
+        (void)DEBUG;
+        (void)FATAL;
+      } break;
       case 40: {
         // --------------------------------------------------------------------
         // BASIC LOGGING USAGE EXAMPLE
@@ -11968,6 +12220,196 @@ if (verbose) bsl::cout << "printf-style macro usage" << bsl::endl;
                   << " seconds."
                   << bsl::endl;
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: STREAM VS. PRINTF VS. DEFERRED MACROS
+        //
+        // Concerns:
+        //: 1 The cost borne by the logging thread for a 'BALL_LOGDF' macro is
+        //:   less than that of the corresponding stream and 'BALL_LOGVA'
+        //:   macros.
+        //
+        // Plan:
+        //: 1 Register an observer that does not access the message of the
+        //:   published records, and log the same message, with several
+        //:   arguments, using 'BALL_LOG_INFO', 'BALL_LOGVA_INFO', and
+        //:   'BALL_LOGDF_INFO'.  Report the time per message for each.
+        //
+        // Testing:
+        //   PERFORMANCE: STREAM VS. PRINTF VS. DEFERRED MACROS
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout
+                << "\nPERFORMANCE: STREAM VS. PRINTF VS. DEFERRED MACROS"
+                << "\n=================================================="
+                << bsl::endl;
+
+        using namespace BALL_LOG_TEST_CASE_MINUS_3;
+
+        const int NUM_MESSAGES = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        BloombergLP::ball::LoggerManagerConfiguration lmc;
+        lmc.setDefaultThresholdLevelsIfValid(
+                    BloombergLP::ball::Severity::e_OFF,    // record level
+                    BloombergLP::ball::Severity::e_INFO,   // passthrough level
+                    BloombergLP::ball::Severity::e_OFF,    // trigger level
+                    BloombergLP::ball::Severity::e_OFF);   // triggerAll level
+        BloombergLP::ball::LoggerManagerScopedGuard lmg(lmc);
+
+        bsl::shared_ptr<CountingObserver> observer(new CountingObserver());
+
+        ASSERT(0 == BloombergLP::ball::LoggerManager::singleton().
+                                          registerObserver(observer, "test"));
+
+        BALL_LOG_SET_CATEGORY("PERFORMANCE")
+
+        const char *SYMBOL = "IBM";
+
+        BloombergLP::bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            BALL_LOG_INFO << "order " << i << " for " << SYMBOL << ": "
+                          << 100LL * i << " shares at " << 1.5 * i;
+        }
+        timer.stop();
+        const double streamTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            BALL_LOGVA_INFO("order %d for %s: %lld shares at %g",
+                            i,
+                            SYMBOL,
+                            100LL * i,
+                            1.5 * i);
+        }
+        timer.stop();
+        const double printfTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_MESSAGES; ++i) {
+            BALL_LOGDF_INFO("order %d for %s: %lld shares at %g",
+                            i,
+                            SYMBOL,
+                            100LL * i,
+                            1.5 * i);
+        }
+        timer.stop();
+        const double deferredTime = timer.elapsedTime();
+
+        ASSERT(3 * NUM_MESSAGES == observer->numRecords());
+
+        bsl::cout << "BALL_LOG_INFO:   "
+                  << streamTime * 1e9 / NUM_MESSAGES << " ns/message\n"
+                  << "BALL_LOGVA_INFO: "
+                  << printfTime * 1e9 / NUM_MESSAGES << " ns/message\n"
+                  << "BALL_LOGDF_INFO: "
+                  << deferredTime * 1e9 / NUM_MESSAGES << " ns/message"
+                  << bsl::endl;
+      } break;
+      case -4: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DISABLED STATEMENTS IN RULE-BASED CATEGORIES
+        //
+        // Concerns:
+        //: 1 A log statement that is disabled for the current thread costs
+        //:   little more than one that is disabled for every thread, even if
+        //:   the statement's category is relevant to a logging rule (active
+        //:   or not) that enables the statement's severity.
+        //
+        // Plan:
+        //: 1 Install two rules relevant to one category: one enabling 'TRACE'
+        //:   for a 'uuid' that is not that of the current thread, and one
+        //:   enabling 'INFO' for the 'uuid' of the current thread.  Time a
+        //:   disabled 'BALL_LOG_DEBUG' statement in a category to which no
+        //:   rule is relevant, in the rule-relevant category with only the
+        //:   inactive rule installed, and in the rule-relevant category with
+        //:   both rules installed.  Report the time per statement for each.
+        //
+        // Testing:
+        //   PERFORMANCE: DISABLED STATEMENTS IN RULE-BASED CATEGORIES
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout
+         << "\nPERFORMANCE: DISABLED STATEMENTS IN RULE-BASED CATEGORIES"
+         << "\n========================================================="
+         << bsl::endl;
+
+        using namespace BloombergLP;  // okay here
+
+        const int NUM_STATEMENTS = argc > 2 ? bsl::atoi(argv[2]) : 10000000;
+
+        ball::LoggerManagerConfiguration lmc;
+        lmc.setDefaultThresholdLevelsIfValid(
+                                        ball::Severity::e_OFF,    // record
+                                        ball::Severity::e_WARN,   // pass
+                                        ball::Severity::e_OFF,    // trigger
+                                        ball::Severity::e_OFF);   // triggerAll
+        ball::LoggerManagerScopedGuard lmg(lmc);
+
+        ball::LoggerManager& manager = ball::LoggerManager::singleton();
+
+        ball::ScopedAttribute uuidAttribute("uuid", 2);
+
+        ball::Rule inactiveRule("RULED", 0, ball::Severity::e_TRACE, 0, 0);
+        inactiveRule.addPredicate(ball::Predicate("uuid", 1));
+
+        ball::Rule activeRule("RULED", 0, ball::Severity::e_INFO, 0, 0);
+        activeRule.addPredicate(ball::Predicate("uuid", 2));
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        {
+            BALL_LOG_SET_CATEGORY("PLAIN");
+
+            for (int i = 0; i < NUM_STATEMENTS; ++i) {
+                BALL_LOG_DEBUG << "disabled " << i;
+            }
+        }
+        timer.stop();
+        const double noRuleTime = timer.elapsedTime();
+
+        manager.addRule(inactiveRule);
+
+        timer.reset();
+        timer.start();
+        {
+            BALL_LOG_SET_CATEGORY("RULED");
+
+            for (int i = 0; i < NUM_STATEMENTS; ++i) {
+                BALL_LOG_DEBUG << "disabled " << i;
+            }
+        }
+        timer.stop();
+        const double inactiveRuleTime = timer.elapsedTime();
+
+        manager.addRule(activeRule);
+
+        timer.reset();
+        timer.start();
+        {
+            BALL_LOG_SET_CATEGORY("RULED");
+
+            for (int i = 0; i < NUM_STATEMENTS; ++i) {
+                BALL_LOG_DEBUG << "disabled " << i;
+            }
+        }
+        timer.stop();
+        const double activeRuleTime = timer.elapsedTime();
+
+        bsl::cout << "no relevant rule:      "
+                  << noRuleTime * 1e9 / NUM_STATEMENTS
+                  << " ns/statement\n"
+                  << "inactive rule:         "
+                  << inactiveRuleTime * 1e9 / NUM_STATEMENTS
+                  << " ns/statement\n"
+                  << "inactive, active rule: "
+                  << activeRuleTime * 1e9 / NUM_STATEMENTS
+                  << " ns/statement" << bsl::endl;
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
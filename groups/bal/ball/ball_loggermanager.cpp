@@ -5,8 +5,8 @@
 BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 
 #include <ball_attributecontext.h>
+#include <ball_concurrentrecordbuffer.h>
 #include <ball_context.h>
-#include <ball_fixedsizerecordbuffer.h>
 #include <ball_loggermanagerdefaults.h>
 #include <ball_recordattributes.h>
 #include <ball_severity.h>
@@ -638,7 +638,7 @@ void LoggerManager::constructObject(
       bdlf::MemFnUtil::memFn(&LoggerManager::publishAllImp, this));
 
     int recordBufferSize = configuration.defaults().defaultRecordBufferSize();
-    d_recordBuffer_p     = new(*d_allocator_p) FixedSizeRecordBuffer(
+    d_recordBuffer_p     = new(*d_allocator_p) ConcurrentRecordBuffer(
                                                               recordBufferSize,
                                                               d_allocator_p);
 
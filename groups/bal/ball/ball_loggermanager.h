@@ -65,15 +65,18 @@ BSLS_IDENT("$Id: $")
 // "default" record manager to the default logger; loggers allocated by the
 // logger manager's 'allocateLogger' method use a record manager supplied by
 // the client.  The default log record buffer is of user-configurable static
-// size and is circular (see the 'ball_circularrecordbuffer' component for
+// size and is circular (see the 'ball_concurrentrecordbuffer' component for
 // details), whereby continuous logging (without publication of logged records)
 // can result in older records being overwritten by newer ones.  A circular
 // buffer provides an efficient "trace-back" strategy, wherein only log records
-// proximate to a user-specified logging event (see below) are published.  Such
-// a circular buffer may not be appropriate for all situations; the user can
-// change the behavior of the default logger by adjusting the logging threshold
-// levels (see below) or can install a logger that uses a different kind of
-// record buffer.
+// proximate to a user-specified logging event (see below) are published.  The
+// default buffer does not serialize the threads storing records into it with
+// a lock, and while its records are published in response to a "trigger"
+// event, other threads continue to store records without waiting for the
+// publication to complete.  Such a circular buffer may not be appropriate for
+// all situations; the user can change the behavior of the default logger by
+// adjusting the logging threshold levels (see below) or can install a logger
+// that uses a different kind of record buffer.
 //
 ///Logger Manager Singleton Initialization
 ///---------------------------------------
@@ -12,13 +12,19 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(ball_recordattributes_cpp,"$Id$ $CSID$")
 
+#include <ball_deferredformatutil.h>
+
 #include <bdlb_print.h>
 
+#include <bdlma_localsequentialallocator.h>
+
 #include <bslma_default.h>
+#include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 
 #include <bsl_cstring.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace ball {
@@ -27,6 +33,48 @@ namespace ball {
                         // class RecordAttributes
                         // ----------------------
 
+// PRIVATE ACCESSORS
+void RecordAttributes::renderMessage() const
+{
+    if (e_DEFERRED_MESSAGE != d_messageState.testAndSwap(
+                                                      e_DEFERRED_MESSAGE,
+                                                      e_RENDERING_MESSAGE)) {
+        // Another thread is rendering the message (or has done so).
+
+        while (e_TEXT_MESSAGE != d_messageState.loadAcquire()) {
+            bslmt::ThreadUtil::yield();
+        }
+        return;                                                       // RETURN
+    }
+
+    // The captured arguments are moved out of the stream buffer, so that the
+    // text can be rendered into it.
+
+    enum { k_ARGUMENTS_BUFFER_SIZE = 256 };
+
+    bslma::Allocator *basicAllocator = d_fileName.get_allocator().mechanism();
+
+    bdlma::LocalSequentialAllocator<k_ARGUMENTS_BUFFER_SIZE> allocator(
+                                                              basicAllocator);
+
+    const char       *data = d_messageStreamBuf.data();
+    bsl::vector<char> arguments(data,
+                                data + d_messageStreamBuf.length(),
+                                &allocator);
+
+    bdlsb::MemOutStreamBuf& streamBuf =
+                  const_cast<RecordAttributes *>(this)->d_messageStreamBuf;
+
+    streamBuf.pubseekpos(0);
+    DeferredFormatUtil::render(&streamBuf,
+                               d_messageFormat_p,
+                               arguments.data(),
+                               arguments.size(),
+                               basicAllocator);
+
+    d_messageState.storeRelease(e_TEXT_MESSAGE);
+}
+
 // CREATORS
 RecordAttributes::RecordAttributes(bslma::Allocator *basicAllocator)
 : d_timestamp()
@@ -37,6 +85,8 @@ RecordAttributes::RecordAttributes(bslma::Allocator *basicAllocator)
 , d_category(basicAllocator)
 , d_severity(0)
 , d_messageStreamBuf(basicAllocator)
+, d_messageFormat_p(0)
+, d_messageState(e_TEXT_MESSAGE)
 {
 }
 
@@ -57,6 +107,8 @@ RecordAttributes::RecordAttributes(const bdlt::Datetime&  timestamp,
 , d_category(category, basicAllocator)
 , d_severity(severity)
 , d_messageStreamBuf(basicAllocator)
+, d_messageFormat_p(0)
+, d_messageState(e_TEXT_MESSAGE)
 {
     setMessage(message);
 }
@@ -71,15 +123,33 @@ RecordAttributes::RecordAttributes(const RecordAttributes&  original,
 , d_category(original.d_category, basicAllocator)
 , d_severity(original.d_severity)
 , d_messageStreamBuf(basicAllocator)
+, d_messageFormat_p(0)
+, d_messageState(e_TEXT_MESSAGE)
 {
+    original.loadMessage();
+
     d_messageStreamBuf.pubseekpos(0);
     d_messageStreamBuf.sputn(original.d_messageStreamBuf.data(),
                              original.d_messageStreamBuf.length());
 }
 
 // MANIPULATORS
+void RecordAttributes::setDeferredMessage(const char   *format,
+                                          bsl::va_list  arguments)
+{
+    BSLS_ASSERT(format);
+
+    d_messageStreamBuf.pubseekpos(0);
+    DeferredFormatUtil::vcapture(&d_messageStreamBuf, format, arguments);
+
+    d_messageFormat_p = format;
+    d_messageState.storeRelease(e_DEFERRED_MESSAGE);
+}
+
 void RecordAttributes::setMessage(const char *message)
 {
+    d_messageState.storeRelaxed(e_TEXT_MESSAGE);
+
     d_messageStreamBuf.pubseekpos(0);
     while (*message) {
         d_messageStreamBuf.sputc(*message);
@@ -97,6 +167,10 @@ RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
         d_lineNumber = rhs.d_lineNumber;
         d_category   = rhs.d_category;
         d_severity   = rhs.d_severity;
+
+        rhs.loadMessage();
+
+        d_messageState.storeRelaxed(e_TEXT_MESSAGE);
         d_messageStreamBuf.pubseekpos(0);
         d_messageStreamBuf.sputn(rhs.d_messageStreamBuf.data(),
                                  rhs.d_messageStreamBuf.length());
@@ -107,6 +181,8 @@ RecordAttributes& RecordAttributes::operator=(const RecordAttributes& rhs)
 // ACCESSORS
 const char *RecordAttributes::message() const
 {
+    loadMessage();
+
     const bsl::size_t length = d_messageStreamBuf.length();
     if (0 == length || '\0' != *(d_messageStreamBuf.data() + length - 1)) {
         // Null terminate the string.
@@ -122,6 +198,8 @@ const char *RecordAttributes::message() const
 
 bslstl::StringRef RecordAttributes::messageRef() const
 {
+    loadMessage();
+
     const bsl::size_t length = d_messageStreamBuf.length();
     const char *str = d_messageStreamBuf.data();
 #if defined(BSLS_PLATFORM_OS_SOLARIS) || defined(BSLS_PLATFORM_OS_SUNOS)
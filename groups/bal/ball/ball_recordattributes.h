@@ -54,6 +54,19 @@ BSLS_IDENT("$Id: $")
 // the values given to the respective attributes by the default constructor of
 // 'ball::RecordAttributes'.
 //
+///Deferred Message Formatting
+///---------------------------
+// The message attribute may be supplied as a 'printf'-style format string and
+// a list of arguments using the 'setDeferredMessage' method.  Rather than
+// formatting the message immediately, 'setDeferredMessage' captures the values
+// of the arguments (see 'ball_deferredformatutil'), and the message text is
+// rendered on the first subsequent access to the message attribute (e.g., by
+// 'message', 'messageRef', or 'messageStreamBuf'), possibly by another thread.
+// Rendering the message of a 'const' object is thread-safe: concurrent
+// accessors of the message attribute wait for the thread performing the
+// rendering to finish.  Note that the format string is not copied, and must
+// remain valid until the message is rendered (or reset).
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -180,6 +193,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_atomic.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
@@ -190,6 +204,7 @@ BSLS_IDENT("$Id: $")
 #else
 #include <bsl_iosfwd.h>
 #endif
+#include <bsl_cstdarg.h>
 #include <bsl_string.h>
 
 namespace BloombergLP {
@@ -227,6 +242,15 @@ class RecordAttributes {
                                                // (and not rewound)
     };
 
+    enum MessageState {
+        // This enumeration defines the states of the message attribute.
+
+        e_TEXT_MESSAGE,      // the stream buffer holds the message text
+        e_DEFERRED_MESSAGE,  // the stream buffer holds the captured arguments
+                             // of 'd_messageFormat_p'
+        e_RENDERING_MESSAGE  // the message text is being rendered
+    };
+
     // DATA
     bdlt::Datetime   d_timestamp;    // creation date and time
     int              d_processID;    // process id of creator
@@ -239,9 +263,26 @@ class RecordAttributes {
     bdlsb::MemOutStreamBuf d_messageStreamBuf;  // stream buffer associated
                                                 // with the message attribute
 
+    const char      *d_messageFormat_p;
+                                     // format of a deferred message (held,
+                                     // not owned)
+
+    mutable bsls::AtomicInt
+                     d_messageState; // state of the message attribute (see
+                                     // 'MessageState')
+
     // FRIENDS
     friend bool operator==(const RecordAttributes&, const RecordAttributes&);
 
+    // PRIVATE ACCESSORS
+    void loadMessage() const;
+        // Render the text of the message attribute of this object if it is
+        // deferred.  Note that this method is thread-safe.
+
+    void renderMessage() const;
+        // Render the text of the message attribute of this object if it is
+        // deferred, or wait until another thread has done so.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecordAttributes,
@@ -309,6 +350,15 @@ class RecordAttributes {
         // Set the message attribute of this record attributes object to the
         // specified (non-null) 'message'.
 
+    void setDeferredMessage(const char *format, bsl::va_list arguments);
+        // Set the message attribute of this record attributes object to the
+        // text produced by formatting the specified 'arguments' according to
+        // the specified 'printf'-style 'format', deferring the formatting
+        // until the message attribute is next accessed.  The behavior is
+        // undefined unless 'arguments' is valid for 'format', and 'format'
+        // remains valid until the message attribute is accessed or reset.
+        // See {Deferred Message Formatting}.
+
     void setProcessID(int processID);
         // Set the processID attribute of this record attributes object to the
         // specified 'processID'.
@@ -332,6 +382,11 @@ class RecordAttributes {
     const char *fileName() const;
         // Return the filename attribute of this record attributes object.
 
+    bool isMessageDeferred() const;
+        // Return 'true' if the message attribute of this record attributes
+        // object was set by 'setDeferredMessage' and has not yet been
+        // rendered, and 'false' otherwise.
+
     int lineNumber() const;
         // Return the line number attribute of this record attributes object.
 
@@ -403,10 +458,23 @@ bsl::ostream& operator<<(bsl::ostream& stream, const RecordAttributes& object);
                         // class RecordAttributes
                         // ----------------------
 
+// PRIVATE ACCESSORS
+inline
+void RecordAttributes::loadMessage() const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                           e_TEXT_MESSAGE != d_messageState.loadAcquire())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        renderMessage();
+    }
+}
+
 // MANIPULATORS
 inline
 void RecordAttributes::clearMessage()
 {
+    d_messageState.storeRelaxed(e_TEXT_MESSAGE);
+
     // Note that the stream buffer holding the message attribute has initial
     // capacity of 256 bytes (by implementation).  Reset those stream buffers
     // that are bigger than the default and "rewind" those that are smaller or
@@ -424,6 +492,7 @@ void RecordAttributes::clearMessage()
 inline
 bdlsb::MemOutStreamBuf& RecordAttributes::messageStreamBuf()
 {
+    loadMessage();
     return d_messageStreamBuf;
 }
 
@@ -482,6 +551,12 @@ const char *RecordAttributes::fileName() const
     return d_fileName.c_str();
 }
 
+inline
+bool RecordAttributes::isMessageDeferred() const
+{
+    return e_DEFERRED_MESSAGE == d_messageState.loadAcquire();
+}
+
 inline
 int RecordAttributes::lineNumber() const
 {
@@ -509,6 +584,7 @@ bsls::Types::Uint64 RecordAttributes::threadID() const
 inline
 const bdlsb::MemOutStreamBuf& RecordAttributes::messageStreamBuf() const
 {
+    loadMessage();
     return d_messageStreamBuf;
 }
 
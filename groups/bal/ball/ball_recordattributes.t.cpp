@@ -16,21 +16,29 @@
 #include <bdlt_datetimeutil.h>
 #include <bdlt_epochutil.h>
 
+#include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
 
 #include <bslmf_assert.h>
 
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_cstdarg.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>      // atoi()
 #include <bsl_cstring.h>      // strlen(), memset(), memcpy(), memcmp()
 #include <bsl_iostream.h>
 #include <bsl_new.h>          // placement 'new' syntax
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <unistd.h>           // getpid()
@@ -75,12 +83,14 @@ using namespace bsl;
 // [ 2] void setFileName(const char *fileName);
 // [ 2] void setLineNumber(int lineNumber);
 // [ 2] void setMessage(const char *message);
+// [ 6] void setDeferredMessage(const char *format, bsl::va_list arguments);
 // [ 2] void setProcessID(int processID);
 // [ 2] void setSeverity(int severity);
 // [ 2] void setThreadID(bsls::Types::Uint64 threadID);
 // [ 2] void setTimestamp(const bdlt::Datetime& timestamp);
 // [ 2] const char *category() const;
 // [ 2] const char *fileName() const;
+// [ 6] bool isMessageDeferred() const;
 // [ 2] int lineNumber() const;
 // [ 2] const char *message() const;
 // [ 2] bslstl::StringRef messageRef() const;
@@ -97,8 +107,9 @@ using namespace bsl;
 // [ 2] ostream& operator<<(ostream& os, const ball::RecordAttributes&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 5] USAGE EXAMPLE 1
-// [ 6] USAGE EXAMPLE 2
+// [ 4] USAGE EXAMPLE 1
+// [ 5] USAGE EXAMPLE 2
+// [ 6] CONCURRENT RENDERING OF A DEFERRED MESSAGE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -291,6 +302,34 @@ void initRecordAttributes(ball::RecordAttributes&    lhs,
     ASSERT(lhs.timestamp()  == rhs.timestamp);
 }
 
+void setDeferred(ball::RecordAttributes *attributes, const char *format, ...)
+    // Set the message attribute of the specified 'attributes' to the deferred
+    // formatting of the variable arguments according to the specified
+    // 'format'.
+{
+    va_list arguments;
+    va_start(arguments, format);
+    attributes->setDeferredMessage(format, arguments);
+    va_end(arguments);
+}
+
+struct ReadMessageJob {
+    // This 'struct' defines a function object that reads the message of a
+    // record attributes object after waiting on a barrier.
+
+    const ball::RecordAttributes *d_attributes_p;  // object to read
+    bslmt::Barrier               *d_barrier_p;     // start barrier
+    bsl::string                  *d_result_p;      // message read
+
+    void operator()() const
+        // Wait on the barrier, then load the message into the result.
+    {
+        d_barrier_p->wait();
+        bslstl::StringRef message = d_attributes_p->messageRef();
+        d_result_p->assign(message.data(), message.length());
+    }
+};
+
 #define EXPLICIT_CONSTRUCTOR(OBJ, ORA, ALLOC)                       \
     Obj OBJ(ORA.timestamp,                                          \
             ORA.processID,                                          \
@@ -326,6 +365,185 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING DEFERRED MESSAGES
+        //
+        // Concerns:
+        //: 1 'setDeferredMessage' sets a message that is rendered, exactly as
+        //:   'printf' would, on first access through any of 'message',
+        //:   'messageRef', and either 'messageStreamBuf'.
+        //:
+        //: 2 'isMessageDeferred' is 'true' only until the message is
+        //:   rendered.
+        //:
+        //: 3 Copy construction, assignment, equality comparison, and 'print'
+        //:   render a deferred message.
+        //:
+        //: 4 'setMessage' and 'clearMessage' discard a deferred message.
+        //:
+        //: 5 Rendering allocates only from the object allocator.
+        //:
+        //: 6 Concurrent accesses to the message of a 'const' object all
+        //:   observe the rendered message.
+        //
+        // Plan:
+        //: 1 Set a deferred message and access it through each accessor,
+        //:   verifying 'isMessageDeferred' before and after.  (C-1..2)
+        //:
+        //: 2 Copy, assign, compare, and print objects holding deferred
+        //:   messages.  (C-3)
+        //:
+        //: 3 Reset deferred messages with 'setMessage' and 'clearMessage'.
+        //:   (C-4)
+        //:
+        //: 4 Install a test allocator as the default allocator, and verify
+        //:   that it is not used.  (C-5)
+        //:
+        //: 5 Create several threads that access the message of an object
+        //:   simultaneously, and verify that each sees the rendered message.
+        //:   (C-6)
+        //
+        // Testing:
+        //   void setDeferredMessage(const char *format, bsl::va_list args);
+        //   bool isMessageDeferred() const;
+        //   CONCURRENT RENDERING OF A DEFERRED MESSAGE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING DEFERRED MESSAGES" << endl
+                                  << "=========================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const char *FORMAT = "%s: %d at %.2f%c";
+        const char *EXP    = "ask: 500 at 101.25!";
+
+        if (verbose) cout << "\tRendering on access." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            ASSERT(false == X.isMessageDeferred());
+
+            setDeferred(&mX, FORMAT, "ask", 500, 101.25, '!');
+            ASSERT(true  == X.isMessageDeferred());
+            ASSERT(0     == strcmp(EXP, X.message()));
+            ASSERT(false == X.isMessageDeferred());
+            ASSERT(0     == strcmp(EXP, X.message()));
+
+            setDeferred(&mX, FORMAT, "ask", 500, 101.25, '!');
+            ASSERT(true  == X.isMessageDeferred());
+            ASSERT(EXP   == X.messageRef());
+            ASSERT(false == X.isMessageDeferred());
+
+            setDeferred(&mX, FORMAT, "ask", 500, 101.25, '!');
+            ASSERT(strlen(EXP) == X.messageStreamBuf().length());
+            ASSERT(0 == memcmp(EXP, X.messageStreamBuf().data(),
+                               strlen(EXP)));
+
+            setDeferred(&mX, "%d-", 1);
+            mX.messageStreamBuf().sputc('2');
+            ASSERT(false == X.isMessageDeferred());
+            ASSERT("1-2" == X.messageRef());
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tValue-semantic operations." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+            Obj mY(&testAllocator);  const Obj& Y = mY;
+
+            setDeferred(&mX, FORMAT, "ask", 500, 101.25, '!');
+            mY.setMessage(EXP);
+            ASSERT(X == Y);
+            ASSERT(false == X.isMessageDeferred());
+
+            setDeferred(&mX, FORMAT, "ask", 500, 101.25, '!');
+            Obj mZ(X, &testAllocator);  const Obj& Z = mZ;
+            ASSERT(false == X.isMessageDeferred());
+            ASSERT(false == Z.isMessageDeferred());
+            ASSERT(EXP   == Z.messageRef());
+
+            setDeferred(&mX, "%d", 7);
+            mZ = X;
+            ASSERT(false == Z.isMessageDeferred());
+            ASSERT("7"   == Z.messageRef());
+
+            setDeferred(&mZ, "%d", 8);
+            mZ = Y;
+            ASSERT(false == Z.isMessageDeferred());
+            ASSERT(EXP   == Z.messageRef());
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tResetting a deferred message." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            setDeferred(&mX, FORMAT, "ask", 500, 101.25, '!');
+            mX.setMessage("plain");
+            ASSERT(false   == X.isMessageDeferred());
+            ASSERT("plain" == X.messageRef());
+
+            setDeferred(&mX, FORMAT, "ask", 500, 101.25, '!');
+            mX.clearMessage();
+            ASSERT(false   == X.isMessageDeferred());
+            ASSERT(""      == X.messageRef());
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tLong messages." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            const bsl::string LONG(1000, 'x', &testAllocator);
+            bsl::string       expected(LONG, &testAllocator);
+            expected += '|';
+            expected += LONG;
+
+            setDeferred(&mX, "%s|%s", LONG.c_str(), LONG.c_str());
+            ASSERT(expected == X.messageRef());
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\tPrinting." << endl;
+        {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            setDeferred(&mX, "[%5s]", "abc");
+            bsl::ostringstream os;
+            X.print(os, 0, -1);
+            ASSERT(bsl::string::npos != os.str().find("[  abc]"));
+        }
+
+        if (verbose) cout << "\tConcurrent rendering." << endl;
+        {
+            enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 200 };
+
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                Obj mX(&testAllocator);  const Obj& X = mX;
+
+                setDeferred(&mX, "%d %s %f", i, "concurrent", 0.5 * i);
+
+                const bsl::string EXPECTED = bsl::string(
+                            bsl::to_string(i) + " concurrent "
+                                              + bsl::to_string(0.5 * i));
+
+                bslmt::Barrier            barrier(k_NUM_THREADS);
+                bsl::vector<bsl::string>  results(k_NUM_THREADS);
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    ReadMessageJob job = { &X, &barrier, &results[j] };
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[j], job));
+                }
+                for (int j = 0; j < k_NUM_THREADS; ++j) {
+                    bslmt::ThreadUtil::join(handles[j]);
+                    ASSERTV(i, j, results[j], EXPECTED == results[j]);
+                }
+            }
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
@@ -19,6 +19,7 @@ BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslma_managedptr.h>
 #include <bsls_assert.h>
 
 #include <bsl_algorithm.h>   // for 'bsl::min' and 'bsl::max'
@@ -259,7 +260,9 @@ class CollectorRepository_MetricCollectors {
     // the 'Collector' and 'IntegerCollector' objects associated with a single
     // metric.  The 'collector' and 'intCollector' methods are provided to
     // access the individual containers for 'Collector' objects and
-    // 'IntegerCollector' objects, respectively.   The 'collectAndReset' method
+    // 'IntegerCollector' objects, respectively.  In addition, a single
+    // 'ShardedCollector' and a single 'ShardedIntegerCollector' can be
+    // (lazily) created for the metric.   The 'collectAndReset' method
     // obtains the aggregate value of all the owned collectors and integer
     // collectors, and then resets those collectors and integer collectors to
     // their default state.
@@ -271,8 +274,21 @@ class CollectorRepository_MetricCollectors {
                                                         IntCollectors;
 
     // DATA
-    Collectors    d_collectors;     // collector objects
-    IntCollectors d_intCollectors;  // integer collector objects
+    Collectors                                  d_collectors;
+                                           // collector objects
+
+    IntCollectors                               d_intCollectors;
+                                           // integer collector objects
+
+    bslma::ManagedPtr<ShardedCollector>         d_shardedCollector;
+                                           // sharded collector (may be null)
+
+    bslma::ManagedPtr<ShardedIntegerCollector>  d_shardedIntCollector;
+                                           // sharded integer collector (may
+                                           // be null)
+
+    bslma::Allocator                           *d_allocator_p;
+                                           // allocator (held, not owned)
 
     // NOT IMPLEMENTED
     CollectorRepository_MetricCollectors(
@@ -306,6 +322,14 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the modifiable container of
         // 'IntegerCollector' objects.
 
+    ShardedCollector *shardedCollector();
+        // Return the address of the modifiable sharded collector for this
+        // metric, creating it if it does not already exist.
+
+    ShardedIntegerCollector *shardedIntCollector();
+        // Return the address of the modifiable sharded integer collector for
+        // this metric, creating it if it does not already exist.
+
     void collectAndReset(MetricRecord *record);
         // Load into the specified 'record' the aggregate value of all the
         // records collected by the collectors owned by this object; then
@@ -336,6 +360,14 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the non-modifiable 'MetricId' object
         // identifying the metric for which the collectors in this container
         // are collecting values.
+
+    ShardedCollector *findShardedCollector() const;
+        // Return the address of the modifiable sharded collector for this
+        // metric, or 0 if one has not been created.
+
+    ShardedIntegerCollector *findShardedIntCollector() const;
+        // Return the address of the modifiable sharded integer collector for
+        // this metric, or 0 if one has not been created.
 };
 
                  // ------------------------------------------
@@ -349,6 +381,9 @@ CollectorRepository_MetricCollectors(const MetricId&   id,
                                      bslma::Allocator *basicAllocator)
 : d_collectors(id, basicAllocator)
 , d_intCollectors(id, basicAllocator)
+, d_shardedCollector()
+, d_shardedIntCollector()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -373,6 +408,28 @@ CollectorRepository_MetricCollectors::intCollectors()
     return d_intCollectors;
 }
 
+ShardedCollector *CollectorRepository_MetricCollectors::shardedCollector()
+{
+    if (!d_shardedCollector) {
+        d_shardedCollector.load(
+              new (*d_allocator_p) ShardedCollector(d_collectors.metricId()),
+              d_allocator_p);
+    }
+    return d_shardedCollector.get();
+}
+
+ShardedIntegerCollector *
+CollectorRepository_MetricCollectors::shardedIntCollector()
+{
+    if (!d_shardedIntCollector) {
+        d_shardedIntCollector.load(
+              new (*d_allocator_p) ShardedIntegerCollector(
+                                                     d_collectors.metricId()),
+              d_allocator_p);
+    }
+    return d_shardedIntCollector.get();
+}
+
 void CollectorRepository_MetricCollectors::collectAndReset(
                                                           MetricRecord *record)
 {
@@ -380,6 +437,15 @@ void CollectorRepository_MetricCollectors::collectAndReset(
     MetricRecord tempRecord;
     d_intCollectors.collectAndReset(&tempRecord);
     combine(record, tempRecord);
+
+    if (d_shardedCollector) {
+        d_shardedCollector->loadAndReset(&tempRecord);
+        combine(record, tempRecord);
+    }
+    if (d_shardedIntCollector) {
+        d_shardedIntCollector->loadAndReset(&tempRecord);
+        combine(record, tempRecord);
+    }
 }
 
 void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
@@ -388,6 +454,15 @@ void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
     MetricRecord tempRecord;
     d_intCollectors.collect(&tempRecord);
     combine(record, tempRecord);
+
+    if (d_shardedCollector) {
+        d_shardedCollector->load(&tempRecord);
+        combine(record, tempRecord);
+    }
+    if (d_shardedIntCollector) {
+        d_shardedIntCollector->load(&tempRecord);
+        combine(record, tempRecord);
+    }
 }
 
 // ACCESSORS
@@ -412,6 +487,20 @@ CollectorRepository_MetricCollectors::metricId() const
     return d_collectors.metricId();
 }
 
+inline
+ShardedCollector *
+CollectorRepository_MetricCollectors::findShardedCollector() const
+{
+    return d_shardedCollector.get();
+}
+
+inline
+ShardedIntegerCollector *
+CollectorRepository_MetricCollectors::findShardedIntCollector() const
+{
+    return d_shardedIntCollector.get();
+}
+
                          // -------------------------
                          // class CollectorRepository
                          // -------------------------
@@ -531,6 +620,54 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
     return getMetricCollectors(metricId).intCollectors().defaultCollector();
 }
 
+ShardedCollector *CollectorRepository::getDefaultShardedCollector(
+                                                      const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the sharded collector for
+    // 'metricId' already exists.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end()) {
+            ShardedCollector *collector = it->second->findShardedCollector();
+            if (collector) {
+                return collector;                                     // RETURN
+            }
+        }
+    }
+
+    // Use 'getMetricCollectors' to create the metrics collectors object and
+    // the sharded collector (if they have not been created since the
+    // read-lock was released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).shardedCollector();
+}
+
+ShardedIntegerCollector *
+CollectorRepository::getDefaultShardedIntegerCollector(
+                                                      const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the sharded integer collector
+    // for 'metricId' already exists.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end()) {
+            ShardedIntegerCollector *collector =
+                                        it->second->findShardedIntCollector();
+            if (collector) {
+                return collector;                                     // RETURN
+            }
+        }
+    }
+
+    // Use 'getMetricCollectors' to create the metrics collectors object and
+    // the sharded integer collector (if they have not been created since the
+    // read-lock was released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).shardedIntCollector();
+}
+
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                       const MetricId& metricId)
 {
@@ -34,7 +34,13 @@ BSLS_IDENT("$Id: $")
 // can safely collect values from multiple threads, however, the collector does
 // use a mutex: Applications anticipating high contention for that lock can use
 // 'addCollector' (and 'addIntegerCollector') to obtain multiple collectors and
-// thereby reduce contention.  Finally, the 'collectAndReset' operation
+// thereby reduce contention.  Alternatively, the 'getDefaultShardedCollector'
+// (and 'getDefaultShardedIntegerCollector') operations return a lock-free
+// 'balm::ShardedCollector' (or 'balm::ShardedIntegerCollector') for the
+// supplied metric, whose updates are spread across per-thread shards (see
+// 'balm_shardedcollector').  A sharded collector is created the first time it
+// is requested for a metric, and is merged with the other collectors for that
+// metric when values are collected.  Finally, the 'collectAndReset' operation
 // collects and returns metric records from each of the collectors in the
 // repository.
 //
@@ -113,6 +119,7 @@ BSLS_IDENT("$Id: $")
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
 #include <balm_metricregistry.h>
+#include <balm_shardedcollector.h>
 
 #include <bslmt_rwmutex.h>
 
@@ -261,6 +268,47 @@ class CollectorRepository {
         // repository, create one, add it to the repository, and return its
         // address.
 
+    ShardedCollector *getDefaultShardedCollector(const char *category,
+                                                 const char *metricName);
+        // Return the address of the modifiable default sharded collector
+        // identified by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a sharded collector for the identified metric does
+        // not already exist in the repository, create one, add it to the
+        // repository, and return its address.  In addition, if the identified
+        // metric has not already been registered, add the identified metric to
+        // the 'metricRegistry' supplied at construction.  Note that this
+        // operation is logically equivalent to:
+        //..
+        //  getDefaultShardedCollector(registry().getId(category, metricName))
+        //..
+
+    ShardedCollector *getDefaultShardedCollector(const MetricId& metricId);
+        // Return the address of the modifiable default sharded collector
+        // identified by the specified 'metricId'.  If a default sharded
+        // collector for the identified metric does not already exist in the
+        // repository, create one, add it to the repository, and return its
+        // address.
+
+    ShardedIntegerCollector *getDefaultShardedIntegerCollector(
+                                                       const char *category,
+                                                       const char *metricName);
+        // Return the address of the modifiable default sharded integer
+        // collector identified by the specified 'category' and 'metricName'.
+        // If a default sharded integer collector for the identified metric
+        // does not already exist in the repository, create one, add it to the
+        // repository, and return its address.  In addition, if the identified
+        // metric has not already been registered, add the identified metric
+        // to the 'metricRegistry' supplied at construction.  The behavior is
+        // undefined unless 'category' and 'metricName' are null-terminated.
+
+    ShardedIntegerCollector *getDefaultShardedIntegerCollector(
+                                                     const MetricId& metricId);
+        // Return the address of the modifiable default sharded integer
+        // collector identified by the specified 'metricId'.  If a default
+        // sharded integer collector for the identified metric does not
+        // already exist in the repository, create one, add it to the
+        // repository, and return its address.
+
     bsl::shared_ptr<Collector> addCollector(const char *category,
                                             const char *metricName);
         // Return a shared pointer to a newly-created modifiable collector
@@ -366,6 +414,24 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                           metricName));
 }
 
+inline
+ShardedCollector *CollectorRepository::getDefaultShardedCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultShardedCollector(d_registry_p->getId(category,
+                                                          metricName));
+}
+
+inline
+ShardedIntegerCollector *
+CollectorRepository::getDefaultShardedIntegerCollector(const char *category,
+                                                       const char *metricName)
+{
+    return getDefaultShardedIntegerCollector(d_registry_p->getId(category,
+                                                                 metricName));
+}
+
 inline
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                         const char *category,
@@ -63,6 +63,10 @@ using bsl::flush;
 // [ 3] IntegerCollector *getDefaultIntegerCollector(const MetricId&);
 // [ 5] addCollector(const StringRef&, const StringRef&);
 // [ 2] addCollector(const MetricId& metricId);
+// [ 9] getDefaultShardedCollector(const char *, const char *);
+// [ 9] getDefaultShardedCollector(const MetricId&);
+// [ 9] getDefaultShardedIntegerCollector(const char *, const char *);
+// [ 9] getDefaultShardedIntegerCollector(const MetricId&);
 // [ 5] addIntegerCollector(const StringRef&, const StringRef&);
 // [ 2] addIntegerCollector(const MetricId&);
 // [ 2] int getAddedCollectors(v<C *> *, v<IC *> *, const MetricId&);
@@ -74,7 +78,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -399,7 +403,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -476,6 +480,94 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING SHARDED COLLECTORS
+        //
+        // Concerns:
+        //: 1 'getDefaultShardedCollector' and
+        //:   'getDefaultShardedIntegerCollector' return the same collector
+        //:   for the same metric, and distinct collectors for distinct
+        //:   metrics.
+        //:
+        //: 2 The returned collectors collect values for the identified
+        //:   metric.
+        //:
+        //: 3 The values of the sharded collectors are combined with the
+        //:   values of the other collectors for the same metric by 'collect'
+        //:   and 'collectAndReset'.
+        //:
+        //: 4 'collectAndReset' resets the sharded collectors.
+        //:
+        //: 5 All memory is supplied by the allocator supplied at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Obtain sharded collectors, update them and the (non-sharded)
+        //:   default collectors for the same metric, then verify the values
+        //:   returned by 'collect' and 'collectAndReset'.  (C-1..5)
+        //
+        // Testing:
+        //   getDefaultShardedCollector(const char *, const char *);
+        //   getDefaultShardedCollector(const MetricId&);
+        //   getDefaultShardedIntegerCollector(const char *, const char *);
+        //   getDefaultShardedIntegerCollector(const MetricId&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING SHARDED COLLECTORS" << endl
+                                  << "==========================" << endl;
+
+        Registry registry(Z);
+        Obj      mX(&registry, Z);
+
+        const Id A = registry.getId("Cat", "A");
+        const Id B = registry.getId("Cat", "B");
+
+        balm::ShardedCollector        *sA  = mX.getDefaultShardedCollector(A);
+        balm::ShardedIntegerCollector *siA =
+                                       mX.getDefaultShardedIntegerCollector(A);
+        balm::ShardedCollector        *sB  =
+                                    mX.getDefaultShardedCollector("Cat", "B");
+
+        ASSERT(0  != sA);
+        ASSERT(0  != siA);
+        ASSERT(sA != sB);
+        ASSERT(A  == sA->metricId());
+        ASSERT(A  == siA->metricId());
+        ASSERT(B  == sB->metricId());
+        ASSERT(sA == mX.getDefaultShardedCollector("Cat", "A"));
+        ASSERT(siA == mX.getDefaultShardedIntegerCollector("Cat", "A"));
+        ASSERT(0  == defaultAllocator.numBytesInUse());
+
+        sA->update(1.0);
+        siA->update(5);
+        mX.getDefaultCollector(A)->update(-2.0);
+        sB->update(3.0);
+
+        bsl::vector<Rec> records(Z);
+        mX.collect(&records, A.category());
+        ASSERT(2 == records.size());
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            if (A == records[i].metricId()) {
+                ASSERTV(records[i], Rec(A, 3, 4.0, -2.0, 5.0) == records[i]);
+            }
+            else {
+                ASSERTV(records[i], Rec(B, 1, 3.0, 3.0, 3.0) == records[i]);
+            }
+        }
+
+        records.clear();
+        mX.collectAndReset(&records, A.category());
+        ASSERT(2 == records.size());
+
+        Rec r;
+        sA->load(&r);
+        ASSERT(Rec(A) == r);
+        siA->load(&r);
+        ASSERT(Rec(A) == r);
+        sB->load(&r);
+        ASSERT(Rec(B) == r);
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -0,0 +1,383 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <balm_category.h>
+#include <balm_metricregistry.h>
+#include <balm_publicationtype.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace balm {
+
+namespace {
+
+const bsls::Types::Int64 k_DEFAULT_MIN = LLONG_MAX;
+const bsls::Types::Int64 k_DEFAULT_MAX = LLONG_MIN;
+    // Sentinel minimum and maximum of an empty histogram.
+
+const double k_DEFAULT_FRACTIONS[] = { 0.5, 0.9, 0.99, 0.999 };
+    // The percentiles published by default by a 'HistogramRegistration'.
+
+int toCount(bsls::Types::Int64 count)
+    // Return the specified 'count' converted to 'int', saturating at
+    // 'INT_MAX'.
+{
+    return count > INT_MAX ? INT_MAX : static_cast<int>(count);
+}
+
+}  // close unnamed namespace
+
+                          // -----------------------
+                          // class HistogramSnapshot
+                          // -----------------------
+
+// CLASS METHODS
+bsls::Types::Int64 HistogramSnapshot::bucketLowerBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (index < 2 * k_SUB_BUCKET_COUNT) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index >> k_SUB_BUCKET_BITS) - 1;
+    const bsls::Types::Int64 mantissa =
+                    k_SUB_BUCKET_COUNT + (index & (k_SUB_BUCKET_COUNT - 1));
+
+    return mantissa << shift;
+}
+
+bsls::Types::Int64 HistogramSnapshot::bucketUpperBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (index < 2 * k_SUB_BUCKET_COUNT) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index >> k_SUB_BUCKET_BITS) - 1;
+
+    return bucketLowerBound(index) + ((bsls::Types::Int64(1) << shift) - 1);
+}
+
+// CREATORS
+HistogramSnapshot::HistogramSnapshot()
+{
+    reset();
+}
+
+// MANIPULATORS
+void HistogramSnapshot::merge(const HistogramSnapshot& other)
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i] += other.d_buckets[i];
+    }
+    d_count += other.d_count;
+    d_total += other.d_total;
+    d_min    = bsl::min(d_min, other.d_min);
+    d_max    = bsl::max(d_max, other.d_max);
+}
+
+void HistogramSnapshot::reset()
+{
+    bsl::memset(d_buckets, 0, sizeof d_buckets);
+    d_count = 0;
+    d_total = 0;
+    d_min   = k_DEFAULT_MIN;
+    d_max   = k_DEFAULT_MAX;
+}
+
+// ACCESSORS
+double HistogramSnapshot::percentile(double fraction) const
+{
+    BSLS_ASSERT(0.0 <= fraction);
+    BSLS_ASSERT(fraction <= 1.0);
+
+    if (0 == d_count) {
+        return 0.0;                                                   // RETURN
+    }
+
+    bsls::Types::Int64 rank = static_cast<bsls::Types::Int64>(
+                   bsl::ceil(fraction * static_cast<double>(d_count)));
+    if (rank < 1) {
+        rank = 1;
+    }
+
+    bsls::Types::Int64 seen  = 0;
+    int                index = 0;
+    for (; index < k_NUM_BUCKETS - 1; ++index) {
+        seen += d_buckets[index];
+        if (seen >= rank) {
+            break;
+        }
+    }
+
+    const double lower    = static_cast<double>(bucketLowerBound(index));
+    const double upper    = static_cast<double>(bucketUpperBound(index));
+    const double midpoint = lower + (upper - lower) / 2.0;
+
+    return bsl::min(bsl::max(midpoint, static_cast<double>(d_min)),
+                    static_cast<double>(d_max));
+}
+
+void HistogramSnapshot::loadRecord(MetricRecord *record) const
+{
+    BSLS_ASSERT(record);
+
+    record->count() = toCount(d_count);
+    record->total() = static_cast<double>(d_total);
+    if (0 == d_count) {
+        record->min() = MetricRecord::k_DEFAULT_MIN;
+        record->max() = MetricRecord::k_DEFAULT_MAX;
+    }
+    else {
+        record->min() = static_cast<double>(d_min);
+        record->max() = static_cast<double>(d_max);
+    }
+}
+
+// FREE OPERATORS
+bool operator==(const HistogramSnapshot& lhs, const HistogramSnapshot& rhs)
+{
+    if (lhs.count() != rhs.count() || lhs.total() != rhs.total()) {
+        return false;                                                 // RETURN
+    }
+    if (0 != lhs.count()
+     && (lhs.min() != rhs.min() || lhs.max() != rhs.max())) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < HistogramSnapshot::k_NUM_BUCKETS; ++i) {
+        if (lhs.bucketCount(i) != rhs.bucketCount(i)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_total(0)
+, d_min(k_DEFAULT_MIN)
+, d_max(k_DEFAULT_MAX)
+{
+}
+
+// MANIPULATORS
+void HistogramCollector::loadAndReset(HistogramSnapshot *snapshot)
+{
+    BSLS_ASSERT(snapshot);
+
+    bsls::Types::Int64 count = 0;
+    for (int i = 0; i < HistogramSnapshot::k_NUM_BUCKETS; ++i) {
+        // Avoid writing to buckets that are already 0, which, for a typical
+        // distribution, is most of them.
+
+        bsls::Types::Int64 value = d_buckets[i].loadRelaxed();
+        if (0 != value) {
+            value = d_buckets[i].swap(0);
+        }
+        snapshot->d_buckets[i] = value;
+        count                 += value;
+    }
+    snapshot->d_count = count;
+    snapshot->d_total = d_total.swap(0);
+    snapshot->d_min   = d_min.swap(k_DEFAULT_MIN);
+    snapshot->d_max   = d_max.swap(k_DEFAULT_MAX);
+}
+
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < HistogramSnapshot::k_NUM_BUCKETS; ++i) {
+        d_buckets[i].store(0);
+    }
+    d_total.store(0);
+    d_min.store(k_DEFAULT_MIN);
+    d_max.store(k_DEFAULT_MAX);
+}
+
+// ACCESSORS
+void HistogramCollector::load(HistogramSnapshot *snapshot) const
+{
+    BSLS_ASSERT(snapshot);
+
+    bsls::Types::Int64 count = 0;
+    for (int i = 0; i < HistogramSnapshot::k_NUM_BUCKETS; ++i) {
+        const bsls::Types::Int64 value = d_buckets[i].load();
+
+        snapshot->d_buckets[i] = value;
+        count                 += value;
+    }
+    snapshot->d_count = count;
+    snapshot->d_total = d_total.load();
+    snapshot->d_min   = d_min.load();
+    snapshot->d_max   = d_max.load();
+}
+
+                        // ---------------------------
+                        // class HistogramRegistration
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+void HistogramRegistration::addPercentile(double fraction)
+{
+    BSLS_ASSERT(0.0 <= fraction);
+    BSLS_ASSERT(fraction <= 1.0);
+
+    // Name the percentile by the significant digits of its percentage, e.g.,
+    // "p50" for 0.5, and "p999" for 0.999.
+
+    char digits[32];
+    bsl::snprintf(digits, sizeof digits, "%g", fraction * 100.0);
+
+    const MetricId& metricId = d_collector_p->metricId();
+
+    bsl::string name(metricId.metricName());
+    name += ".p";
+    for (const char *c = digits; *c; ++c) {
+        if ('.' != *c) {
+            name += *c;
+        }
+    }
+
+    MetricRegistry& registry = d_manager_p->metricRegistry();
+    MetricId        id = registry.getId(metricId.categoryName(), name.c_str());
+    registry.setPreferredPublicationType(id, PublicationType::e_MAX);
+
+    d_percentiles.push_back(PercentileMetric(fraction, id));
+}
+
+void HistogramRegistration::registerCallback()
+{
+    d_handle = d_manager_p->registerCollectionCallback(
+                              d_collector_p->metricId().category(),
+                              bdlf::BindUtil::bind(
+                                             &HistogramRegistration::collect,
+                                             this,
+                                             bdlf::PlaceHolders::_1,
+                                             bdlf::PlaceHolders::_2));
+}
+
+// CREATORS
+HistogramRegistration::HistogramRegistration(
+                                      HistogramCollector *collector,
+                                      MetricsManager     *manager,
+                                      bslma::Allocator   *basicAllocator)
+: d_collector_p(collector)
+, d_manager_p(manager)
+, d_percentiles(basicAllocator)
+, d_handle(MetricsManager::e_INVALID_HANDLE)
+{
+    BSLS_ASSERT(collector);
+    BSLS_ASSERT(manager);
+
+    const int numFractions = sizeof  k_DEFAULT_FRACTIONS
+                           / sizeof *k_DEFAULT_FRACTIONS;
+
+    d_percentiles.reserve(numFractions);
+    for (int i = 0; i < numFractions; ++i) {
+        addPercentile(k_DEFAULT_FRACTIONS[i]);
+    }
+    registerCallback();
+}
+
+HistogramRegistration::HistogramRegistration(
+                                      HistogramCollector *collector,
+                                      MetricsManager     *manager,
+                                      const double       *fractions,
+                                      int                 numFractions,
+                                      bslma::Allocator   *basicAllocator)
+: d_collector_p(collector)
+, d_manager_p(manager)
+, d_percentiles(basicAllocator)
+, d_handle(MetricsManager::e_INVALID_HANDLE)
+{
+    BSLS_ASSERT(collector);
+    BSLS_ASSERT(manager);
+    BSLS_ASSERT(0 <= numFractions);
+    BSLS_ASSERT(fractions || 0 == numFractions);
+
+    d_percentiles.reserve(numFractions);
+    for (int i = 0; i < numFractions; ++i) {
+        addPercentile(fractions[i]);
+    }
+    registerCallback();
+}
+
+HistogramRegistration::~HistogramRegistration()
+{
+    d_manager_p->removeCollectionCallback(d_handle);
+}
+
+// MANIPULATORS
+void HistogramRegistration::collect(bsl::vector<MetricRecord> *records,
+                                    bool                       resetFlag)
+{
+    BSLS_ASSERT(records);
+
+    HistogramSnapshot snapshot;
+    if (resetFlag) {
+        d_collector_p->loadAndReset(&snapshot);
+    }
+    else {
+        d_collector_p->load(&snapshot);
+    }
+
+    MetricRecord record(d_collector_p->metricId());
+    snapshot.loadRecord(&record);
+    records->push_back(record);
+
+    if (0 == snapshot.count()) {
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<PercentileMetric>::const_iterator it = d_percentiles.begin();
+    for (; it != d_percentiles.end(); ++it) {
+        const double value = snapshot.percentile(it->first);
+
+        records->push_back(MetricRecord(it->second,
+                                        toCount(snapshot.count()),
+                                        value,
+                                        value,
+                                        value));
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,622 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free log-linear histogram of metric values.
+//
+//@CLASSES:
+//   balm::HistogramSnapshot: mergeable value of a log-linear histogram
+//   balm::HistogramCollector: lock-free collector of a log-linear histogram
+//   balm::HistogramRegistration: publishes a histogram's percentiles
+//
+//@SEE_ALSO: balm_integercollector, balm_shardedcollector,
+//           balm_metricsmanager, balm_publicationscheduler,
+//           balm_streampublisher
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'balm::HistogramCollector', for collecting the distribution of the
+// (non-negative, integral) values of a metric, a value-semantic type,
+// 'balm::HistogramSnapshot', describing the distribution collected over an
+// interval, and a mechanism, 'balm::HistogramRegistration', that publishes
+// percentiles of that distribution through a 'balm::MetricsManager'.
+//
+// A 'balm::MetricRecord' describes a metric by the count, total, minimum, and
+// maximum of the measured values, which does not allow a publisher to report
+// percentiles (e.g., the 99th percentile of a request latency).  A
+// 'balm::HistogramCollector' additionally counts the recorded values in a
+// fixed set of buckets, from which percentiles can be estimated.
+//
+///Bucket Layout
+///-------------
+// The buckets of a histogram are log-linear: the range of 'Int64' values is
+// divided into groups, each spanning a power of two, and each group is
+// divided into 'k_SUB_BUCKET_COUNT' (16) buckets of equal width.  Values less
+// than 32 are counted exactly.  The bucket to which a value 'v' belongs is:
+//..
+//  Value Range               Bucket Width
+//  ------------------------  ------------
+//  [0, 32)                   1
+//  [32, 64)                  2
+//  [64, 128)                 4
+//  ...                       ...
+//  [2^62, 2^63)              2^58
+//..
+// The bucket containing a value is computed, in constant time, from the
+// position of the value's most-significant bit.  The width of a bucket is at
+// most 1/16th of its lower bound, so a percentile estimated from the buckets
+// (which is the midpoint of the bucket containing the percentile) is within
+// approximately 3% of the exact value.  There are 'k_NUM_BUCKETS' (960)
+// buckets, so a histogram has a fixed footprint of approximately 7.5K bytes.
+//
+// Because every histogram has the same bucket layout, histograms are
+// *mergeable*: the histogram of the union of two sets of values is obtained
+// by adding the counts of their corresponding buckets (see
+// 'balm::HistogramSnapshot::merge').  Histograms collected on different
+// threads, processes, or intervals can therefore be combined before
+// percentiles are computed, which is not possible for percentiles themselves.
+//
+///Recording Values
+///----------------
+// 'balm::HistogramCollector::update' records a value using a fixed number of
+// atomic operations on the collector's buckets and totals, and never
+// allocates memory or acquires a lock.  'loadAndReset' atomically exchanges
+// each bucket with 0 to obtain a 'balm::HistogramSnapshot' of the values
+// recorded since the previous reset.  Note that negative values are recorded
+// as 0.
+//
+///Publishing Percentiles
+///----------------------
+// A 'balm::HistogramRegistration' object registers a collection callback with
+// a 'balm::MetricsManager' for the category of a histogram's metric.  Each
+// time that category is published (for example, periodically by a
+// 'balm::PublicationScheduler'), the callback performs a 'loadAndReset' of
+// the histogram (so that each publication reports the values recorded during
+// the preceding interval), and appends to the published records:
+//
+//: o A record for the histogram's metric itself, having the count, total,
+//:   minimum, and maximum of the recorded values (i.e., the same record a
+//:   'balm::IntegerCollector' would have produced).
+//:
+//: o A record for each configured percentile, whose metric has the
+//:   histogram's metric name followed by a suffix naming the percentile
+//:   (".p50", ".p90", ".p99", and ".p999" by default).  The minimum, maximum,
+//:   and total of a percentile record are the estimated percentile value, and
+//:   its count is the number of values in the histogram.  Percentile records
+//:   are omitted for an interval in which no values were recorded.
+//
+// The preferred publication type of each percentile metric is set to
+// 'balm::PublicationType::e_MAX' (a percentile being the maximum of the
+// fraction of values at or below it), so a 'balm::StreamPublisher' reports a
+// histogram as:
+//..
+//      MyCategory.Latency[ count = 4, total = 1280, min = 10, max = 1000 ]
+//      MyCategory.Latency.p50[ max = 89.5 ]
+//      MyCategory.Latency.p90[ max = 1000 ]
+//      MyCategory.Latency.p99[ max = 1000 ]
+//      MyCategory.Latency.p999[ max = 1000 ]
+//..
+// Note that a percentile is the midpoint of the bucket containing it, clamped
+// to the minimum and maximum of the recorded values (e.g., 90 lies in the
+// bucket '[88, 91]', so the estimated 50th percentile above is 89.5).
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  As with 'balm::ShardedCollector',
+// the buckets of a histogram are not read and reset as a single atomic unit:
+// a value recorded concurrently with a 'loadAndReset' is counted exactly
+// once, but its bucket may be reported in one interval and its contribution
+// to the total, minimum, and maximum in the next.
+//
+// 'balm::HistogramSnapshot' is *const* *thread-safe*, meaning that accessors
+// may be invoked concurrently from different threads, but it is not safe to
+// access or modify a 'balm::HistogramSnapshot' in one thread while another
+// thread modifies the same object.
+//
+// 'balm::HistogramRegistration' is *thread-safe* with respect to the
+// publication of its metrics manager; its callback may be invoked by the
+// metrics manager from any thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Request Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example we record the latency of requests handled by a
+// service, and publish the 50th, 90th, 99th, and 99.9th percentiles of that
+// latency using a 'balm::StreamPublisher'.
+//
+// We start by creating a metrics manager, and adding a stream publisher to it:
+//..
+//  bslma::Allocator     *allocator = bslma::Default::allocator(0);
+//  balm::MetricsManager  manager(allocator);
+//
+//  bsl::ostringstream                 stream;
+//  bsl::shared_ptr<balm::Publisher>   publisher(
+//                         new (*allocator) balm::StreamPublisher(stream),
+//                         allocator);
+//  manager.addGeneralPublisher(publisher);
+//..
+// Then we create a 'balm::HistogramCollector' for the "Latency"
+// metric, and a 'balm::HistogramRegistration' that publishes the
+// histogram's default percentiles whenever "MyCategory" is published:
+//..
+//  balm::MetricId latencyId = manager.metricRegistry().getId("MyCategory",
+//                                                                 "Latency");
+//
+//  balm::HistogramCollector    latency(latencyId);
+//  balm::HistogramRegistration registration(&latency, &manager, allocator);
+//..
+// Next, we record the latency of a few requests (in practice, 'update' would
+// be invoked from the threads processing those requests):
+//..
+//  latency.update(10);
+//  latency.update(90);
+//  latency.update(180);
+//  latency.update(1000);
+//..
+// Finally, we publish the metrics of "MyCategory".  In practice, publication
+// would typically be performed periodically by a
+// 'balm::PublicationScheduler'.  Because publication resets the histogram,
+// each publication reports the distribution of the values recorded since the
+// previous publication:
+//..
+//  manager.publish(manager.metricRegistry().getCategory("MyCategory"));
+//
+//  balm::HistogramSnapshot snapshot;
+//  latency.load(&snapshot);
+//  assert(0 == snapshot.count());
+//..
+// The output of the stream publisher will include:
+//..
+//      MyCategory.Latency[ count = 4, total = 1280, min = 10, max = 1000 ]
+//      MyCategory.Latency.p50[ max = 89.5 ]
+//      MyCategory.Latency.p90[ max = 1000 ]
+//      MyCategory.Latency.p99[ max = 1000 ]
+//      MyCategory.Latency.p999[ max = 1000 ]
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+#include <balm_metricsmanager.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                          // =======================
+                          // class HistogramSnapshot
+                          // =======================
+
+class HistogramSnapshot {
+    // This value-semantic type describes the distribution of a set of
+    // non-negative integral values, using the log-linear bucket layout
+    // described in the component documentation.  A 'HistogramSnapshot'
+    // provides the count, total, minimum, and maximum of the values, the
+    // count of values in each bucket, and an estimate of any percentile of
+    // the values.  Snapshots of the same (or of different) metrics can be
+    // combined using 'merge'.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_SUB_BUCKET_BITS  = 4,                         // log2 of sub-buckets
+        k_SUB_BUCKET_COUNT = 1 << k_SUB_BUCKET_BITS,    // buckets per group
+        k_NUM_BUCKETS      = (64 - k_SUB_BUCKET_BITS) * k_SUB_BUCKET_COUNT
+                                                        // total buckets
+    };
+
+  private:
+    // DATA
+    bsls::Types::Int64 d_buckets[k_NUM_BUCKETS];  // count in each bucket
+    bsls::Types::Int64 d_count;                   // count of values
+    bsls::Types::Int64 d_total;                   // total of values
+    bsls::Types::Int64 d_min;                     // minimum value
+    bsls::Types::Int64 d_max;                     // maximum value
+
+    // FRIENDS
+    friend class HistogramCollector;
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(bsls::Types::Int64 value);
+        // Return the index of the bucket containing the specified 'value'.
+        // The behavior is undefined unless '0 <= value'.
+
+    static bsls::Types::Int64 bucketLowerBound(int index);
+        // Return the smallest value contained in the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static bsls::Types::Int64 bucketUpperBound(int index);
+        // Return the largest value contained in the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    HistogramSnapshot();
+        // Create an empty histogram snapshot (i.e., having a count of 0).
+
+    // HistogramSnapshot(const HistogramSnapshot& original) = default;
+    // ~HistogramSnapshot() = default;
+
+    // MANIPULATORS
+    // HistogramSnapshot& operator=(const HistogramSnapshot& rhs) = default;
+
+    void merge(const HistogramSnapshot& other);
+        // Add the values described by the specified 'other' snapshot to the
+        // values described by this snapshot.
+
+    void reset();
+        // Reset this snapshot to the empty state (i.e., having a count of 0).
+
+    // ACCESSORS
+    bsls::Types::Int64 bucketCount(int index) const;
+        // Return the number of values in the bucket having the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    bsls::Types::Int64 count() const;
+        // Return the number of values described by this snapshot.
+
+    bsls::Types::Int64 total() const;
+        // Return the total of the values described by this snapshot.
+
+    bsls::Types::Int64 min() const;
+        // Return the minimum of the values described by this snapshot.  The
+        // behavior is undefined unless '0 < count()'.
+
+    bsls::Types::Int64 max() const;
+        // Return the maximum of the values described by this snapshot.  The
+        // behavior is undefined unless '0 < count()'.
+
+    double percentile(double fraction) const;
+        // Return an estimate of the value below which the specified
+        // 'fraction' of the values described by this snapshot lie (e.g., the
+        // 99th percentile for a 'fraction' of 0.99), or 0 if 'count()' is 0.
+        // The estimate is the midpoint of the bucket containing the
+        // 'ceil(fraction * count())'th smallest value, clamped to the range
+        // '[min(), max()]'.  The behavior is undefined unless
+        // '0.0 <= fraction <= 1.0'.
+
+    void loadRecord(MetricRecord *record) const;
+        // Load into the specified 'record' the count, total, minimum, and
+        // maximum of the values described by this snapshot.  If 'count()' is
+        // 0, the minimum and maximum of 'record' are set to
+        // 'MetricRecord::k_DEFAULT_MIN' and 'MetricRecord::k_DEFAULT_MAX'
+        // respectively.  Note that the metric id of 'record' is unchanged.
+};
+
+// FREE OPERATORS
+bool operator==(const HistogramSnapshot& lhs, const HistogramSnapshot& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' snapshots have the same
+    // value, and 'false' otherwise.  Two snapshots have the same value if they
+    // have the same count, total, minimum, maximum, and bucket counts.
+
+bool operator!=(const HistogramSnapshot& lhs, const HistogramSnapshot& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' snapshots do not have the
+    // same value, and 'false' otherwise.  Two snapshots do not have the same
+    // value if they differ in count, total, minimum, maximum, or any bucket
+    // count.
+
+                          // ========================
+                          // class HistogramCollector
+                          // ========================
+
+class HistogramCollector {
+    // This class provides a mechanism for collecting the distribution of the
+    // values of a metric, using a fixed set of log-linear buckets (see
+    // 'HistogramSnapshot').  Values are recorded without locking or
+    // allocating memory, and the collected distribution is retrieved (and
+    // optionally reset) as a 'HistogramSnapshot'.
+
+    // DATA
+    MetricId           d_metricId;                                // metric id
+
+    bsls::AtomicInt64  d_buckets[HistogramSnapshot::k_NUM_BUCKETS];
+                                                          // count per bucket
+
+    bsls::AtomicInt64  d_total;                           // total of values
+
+    bsls::AtomicInt64  d_min;                             // minimum value
+
+    bsls::AtomicInt64  d_max;                             // maximum value
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+  public:
+    // CREATORS
+    explicit HistogramCollector(const MetricId& metricId);
+        // Create an empty histogram collector for the specified 'metricId'.
+
+    // ~HistogramCollector() = default;
+
+    // MANIPULATORS
+    void loadAndReset(HistogramSnapshot *snapshot);
+        // Load into the specified 'snapshot' the distribution of the values
+        // recorded by this collector, and reset this collector to its
+        // default (empty) state.
+
+    void reset();
+        // Reset this collector to its default (empty) state.
+
+    void update(bsls::Types::Int64 value);
+        // Record the specified 'value' in this histogram.  If 'value' is
+        // negative, 0 is recorded.  This operation does not allocate memory
+        // or acquire a lock.
+
+    // ACCESSORS
+    void load(HistogramSnapshot *snapshot) const;
+        // Load into the specified 'snapshot' the distribution of the values
+        // recorded by this collector.
+
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable metric identifier for this
+        // collector.
+};
+
+                        // ===========================
+                        // class HistogramRegistration
+                        // ===========================
+
+class HistogramRegistration {
+    // This class provides a mechanism that, for its lifetime, registers a
+    // collection callback with a 'MetricsManager' that publishes the
+    // distribution of a 'HistogramCollector', and a set of its percentiles,
+    // each time the category of the histogram's metric is published.  See
+    // the component documentation for the records that are published.
+
+  public:
+    // TYPES
+    typedef bsl::pair<double, MetricId> PercentileMetric;
+        // A percentile (as a fraction in the range '[0.0 .. 1.0]') and the
+        // metric under which it is published.
+
+  private:
+    // DATA
+    HistogramCollector              *d_collector_p;    // collector (held)
+
+    MetricsManager                  *d_manager_p;      // metrics manager
+                                                       // (held)
+
+    bsl::vector<PercentileMetric>    d_percentiles;    // published
+                                                       // percentiles
+
+    MetricsManager::CallbackHandle   d_handle;         // registered callback
+
+    // PRIVATE MANIPULATORS
+    void addPercentile(double fraction);
+        // Add the specified 'fraction' to the published percentiles,
+        // registering its metric (and setting its preferred publication type)
+        // with the metric registry of 'd_manager_p'.
+
+    void registerCallback();
+        // Register the collection callback of this object with 'd_manager_p'.
+
+    // NOT IMPLEMENTED
+    HistogramRegistration(const HistogramRegistration&);
+    HistogramRegistration& operator=(const HistogramRegistration&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(HistogramRegistration,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    HistogramRegistration(HistogramCollector *collector,
+                          MetricsManager     *manager,
+                          bslma::Allocator   *basicAllocator = 0);
+        // Create an object that publishes the distribution of the specified
+        // 'collector', and its 50th, 90th, 99th, and 99.9th percentiles,
+        // each time the category of 'collector->metricId()' is published by
+        // the specified 'manager'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'collector' is valid, was created with a metric id obtained
+        // from 'manager->metricRegistry()', and outlives this object.
+
+    HistogramRegistration(HistogramCollector *collector,
+                          MetricsManager     *manager,
+                          const double       *fractions,
+                          int                 numFractions,
+                          bslma::Allocator   *basicAllocator = 0);
+        // Create an object that publishes the distribution of the specified
+        // 'collector', and the percentiles in the specified 'fractions' array
+        // of the specified 'numFractions' length (e.g., 0.99 for the 99th
+        // percentile), each time the category of 'collector->metricId()' is
+        // published by the specified 'manager'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The name of the
+        // metric for a percentile is the histogram's metric name followed by
+        // ".p" and the percentile's decimal digits (e.g., ".p99" for 0.99,
+        // and ".p999" for 0.999).  The behavior is undefined unless
+        // 'collector' is valid, was created with a metric id obtained from
+        // 'manager->metricRegistry()', and outlives this object,
+        // '0 <= numFractions', and each fraction is in the range
+        // '[0.0 .. 1.0]'.
+
+    ~HistogramRegistration();
+        // Remove the collection callback of this object from the metrics
+        // manager supplied at construction, and destroy this object.
+
+    // MANIPULATORS
+    void collect(bsl::vector<MetricRecord> *records, bool resetFlag);
+        // Append to the specified 'records' the record for the histogram's
+        // metric and, if any values were recorded, a record for each
+        // published percentile, computed from the distribution collected by
+        // the histogram.  If the specified 'resetFlag' is 'true', reset the
+        // histogram.  Note that this is the collection callback registered
+        // with the metrics manager.
+
+    // ACCESSORS
+    const bsl::vector<PercentileMetric>& percentiles() const;
+        // Return a reference to the non-modifiable percentiles published by
+        // this object, and the metrics under which they are published.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HistogramSnapshot
+                          // -----------------------
+
+// CLASS METHODS
+inline
+int HistogramSnapshot::bucketIndex(bsls::Types::Int64 value)
+{
+    const bsl::uint64_t v = static_cast<bsl::uint64_t>(value);
+
+    if (v < 2 * k_SUB_BUCKET_COUNT) {
+        return static_cast<int>(v);                                   // RETURN
+    }
+
+    // 'shift' is the position of the most-significant bit of 'v', less
+    // 'k_SUB_BUCKET_BITS', so that 'v >> shift' is in
+    // '[k_SUB_BUCKET_COUNT .. 2 * k_SUB_BUCKET_COUNT)'.
+
+    const int shift = 63 - k_SUB_BUCKET_BITS
+                    - bdlb::BitUtil::numLeadingUnsetBits(v);
+
+    return (shift << k_SUB_BUCKET_BITS) + static_cast<int>(v >> shift);
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 HistogramSnapshot::bucketCount(int index) const
+{
+    return d_buckets[index];
+}
+
+inline
+bsls::Types::Int64 HistogramSnapshot::count() const
+{
+    return d_count;
+}
+
+inline
+bsls::Types::Int64 HistogramSnapshot::total() const
+{
+    return d_total;
+}
+
+inline
+bsls::Types::Int64 HistogramSnapshot::min() const
+{
+    return d_min;
+}
+
+inline
+bsls::Types::Int64 HistogramSnapshot::max() const
+{
+    return d_max;
+}
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// MANIPULATORS
+inline
+void HistogramCollector::update(bsls::Types::Int64 value)
+{
+    if (value < 0) {
+        value = 0;
+    }
+
+    d_buckets[HistogramSnapshot::bucketIndex(value)].addRelaxed(1);
+    d_total.addRelaxed(value);
+
+    // The minimum and maximum are written only when 'value' is a new extreme,
+    // so in the steady state updating them requires only a load.
+
+    bsls::Types::Int64 current = d_min.loadRelaxed();
+    while (value < current) {
+        const bsls::Types::Int64 prev = d_min.testAndSwap(current, value);
+        if (prev == current) {
+            break;
+        }
+        current = prev;
+    }
+
+    current = d_max.loadRelaxed();
+    while (value > current) {
+        const bsls::Types::Int64 prev = d_max.testAndSwap(current, value);
+        if (prev == current) {
+            break;
+        }
+        current = prev;
+    }
+}
+
+// ACCESSORS
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+                        // ---------------------------
+                        // class HistogramRegistration
+                        // ---------------------------
+
+// ACCESSORS
+inline
+const bsl::vector<HistogramRegistration::PercentileMetric>&
+HistogramRegistration::percentiles() const
+{
+    return d_percentiles;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool balm::operator!=(const HistogramSnapshot& lhs,
+                      const HistogramSnapshot& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1135 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_integercollector.h>
+#include <balm_metricdescription.h>
+#include <balm_metricregistry.h>
+#include <balm_metricsample.h>
+#include <balm_metricsmanager.h>
+#include <balm_publicationtype.h>
+#include <balm_publisher.h>
+#include <balm_streampublisher.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::HistogramSnapshot' is a value-semantic type describing a log-linear
+// histogram, 'balm::HistogramCollector' is a mechanism for recording values
+// into such a histogram, and 'balm::HistogramRegistration' publishes the
+// histogram through a 'balm::MetricsManager'.  Ensure that the bucket layout
+// is correct (contiguous, and bounded in relative width), that values can be
+// recorded into, and read out of, the collector, that percentiles and merged
+// snapshots are computed correctly, that the registration publishes the
+// expected records with snapshot-and-reset semantics, and that recording is
+// thread safe.
+// ----------------------------------------------------------------------------
+// balm::HistogramSnapshot
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int bucketIndex(bsls::Types::Int64 value);
+// [ 2] bsls::Types::Int64 bucketLowerBound(int index);
+// [ 2] bsls::Types::Int64 bucketUpperBound(int index);
+//
+// CREATORS
+// [ 3] balm::HistogramSnapshot();
+//
+// MANIPULATORS
+// [ 4] void merge(const balm::HistogramSnapshot& other);
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 3] bsls::Types::Int64 bucketCount(int index) const;
+// [ 3] bsls::Types::Int64 count() const;
+// [ 3] bsls::Types::Int64 total() const;
+// [ 3] bsls::Types::Int64 min() const;
+// [ 3] bsls::Types::Int64 max() const;
+// [ 4] double percentile(double fraction) const;
+// [ 3] void loadRecord(balm::MetricRecord *record) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const HistogramSnapshot&, const HistogramSnapshot&);
+// [ 4] bool operator!=(const HistogramSnapshot&, const HistogramSnapshot&);
+// ----------------------------------------------------------------------------
+// balm::HistogramCollector
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 3] balm::HistogramCollector(const balm::MetricId& metricId);
+// [ 3] ~balm::HistogramCollector();
+//
+// MANIPULATORS
+// [ 3] void loadAndReset(balm::HistogramSnapshot *snapshot);
+// [ 3] void reset();
+// [ 3] void update(bsls::Types::Int64 value);
+//
+// ACCESSORS
+// [ 3] void load(balm::HistogramSnapshot *snapshot) const;
+// [ 3] const balm::MetricId& metricId() const;
+// ----------------------------------------------------------------------------
+// balm::HistogramRegistration
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 5] HistogramRegistration(Collector *, MetricsManager *, Allocator *);
+// [ 5] HistogramRegistration(Collector *, Manager *, double *, int, Alloc *);
+// [ 5] ~HistogramRegistration();
+//
+// MANIPULATORS
+// [ 5] void collect(bsl::vector<MetricRecord> *records, bool resetFlag);
+//
+// ACCESSORS
+// [ 5] const bsl::vector<PercentileMetric>& percentiles() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCURRENCY TEST
+// [ 7] USAGE EXAMPLE
+// [-1] UPDATE THROUGHPUT: INTEGER VS. HISTOGRAM COLLECTORS
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramSnapshot     Snap;
+typedef balm::HistogramCollector    Obj;
+typedef balm::HistogramRegistration Reg;
+typedef balm::MetricRecord          Rec;
+typedef balm::MetricDescription     Desc;
+typedef balm::MetricId              Id;
+typedef bsls::Types::Int64          Int64;
+
+const int NUM_BUCKETS = Snap::k_NUM_BUCKETS;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class COLLECTOR>
+void updateCollector(COLLECTOR       *collector,
+                     bslmt::Barrier  *barrier,
+                     int              numIterations,
+                     int              threadIndex)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // the specified 'numIterations' times with the values
+    // '[0 .. numIterations)' scaled by the specified 'threadIndex'.
+{
+    barrier->wait();
+    for (int i = 0; i < numIterations; ++i) {
+        collector->update(i * threadIndex);
+    }
+}
+
+template <class COLLECTOR>
+double runThroughputTest(COLLECTOR *collector,
+                         int        numThreads,
+                         int        numIterations)
+    // Update the specified 'collector' the specified 'numIterations' times
+    // from each of the specified 'numThreads' threads, and return the elapsed
+    // wall time, in seconds.
+{
+    bslmt::Barrier                         barrier(numThreads + 1);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    for (int i = 0; i < numThreads; ++i) {
+        int rc = bslmt::ThreadUtil::create(
+                             &handles[i],
+                             bdlf::BindUtil::bind(&updateCollector<COLLECTOR>,
+                                                  collector,
+                                                  &barrier,
+                                                  numIterations,
+                                                  i + 1));
+        ASSERT(0 == rc);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    barrier.wait();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+const Rec *findRecord(const bsl::vector<Rec>& records, const char *name)
+    // Return the address of the record in the specified 'records' whose
+    // metric has the specified 'name', or 0 if there is no such record.
+{
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        if (0 == bsl::strcmp(name, records[i].metricId().metricName())) {
+            return &records[i];                                       // RETURN
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Example 1: Publishing Request Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example we record the latency of requests handled by a
+// service, and publish the 50th, 90th, 99th, and 99.9th percentiles of that
+// latency using a 'balm::StreamPublisher'.
+//
+// We start by creating a metrics manager, and adding a stream publisher to it:
+//..
+    bslma::Allocator     *allocator = bslma::Default::allocator(0);
+    balm::MetricsManager  manager(allocator);
+
+    bsl::ostringstream                 stream;
+    bsl::shared_ptr<balm::Publisher>   publisher(
+                           new (*allocator) balm::StreamPublisher(stream),
+                           allocator);
+    manager.addGeneralPublisher(publisher);
+//..
+// Then we create a 'balm::HistogramCollector' for the "Latency"
+// metric, and a 'balm::HistogramRegistration' that publishes the
+// histogram's default percentiles whenever "MyCategory" is published:
+//..
+    balm::MetricId latencyId = manager.metricRegistry().getId("MyCategory",
+                                                                   "Latency");
+
+    balm::HistogramCollector    latency(latencyId);
+    balm::HistogramRegistration registration(&latency, &manager, allocator);
+//..
+// Next, we record the latency of a few requests (in practice, 'update' would
+// be invoked from the threads processing those requests):
+//..
+    latency.update(10);
+    latency.update(90);
+    latency.update(180);
+    latency.update(1000);
+//..
+// Finally, we publish the metrics of "MyCategory".  In practice, publication
+// would typically be performed periodically by a
+// 'balm::PublicationScheduler'.  Because publication resets the histogram,
+// each publication reports the distribution of the values recorded since the
+// previous publication:
+//..
+    manager.publish(manager.metricRegistry().getCategory("MyCategory"));
+
+    balm::HistogramSnapshot snapshot;
+    latency.load(&snapshot);
+    ASSERT(0 == snapshot.count());
+//..
+// The output of the stream publisher will include:
+//..
+//      MyCategory.Latency[ count = 4, total = 1280, min = 10, max = 1000 ]
+//      MyCategory.Latency.p50[ max = 89.5 ]
+//      MyCategory.Latency.p90[ max = 1000 ]
+//      MyCategory.Latency.p99[ max = 1000 ]
+//      MyCategory.Latency.p999[ max = 1000 ]
+//..
+
+        const char *EXPECTED[] = {
+            "MyCategory.Latency[ count = 4, total = 1280, min = 10, "
+                                                               "max = 1000 ]",
+            "MyCategory.Latency.p50[ max = 89.5 ]",
+            "MyCategory.Latency.p90[ max = 1000 ]",
+            "MyCategory.Latency.p99[ max = 1000 ]",
+            "MyCategory.Latency.p999[ max = 1000 ]"
+        };
+        const int NUM_EXPECTED = sizeof EXPECTED / sizeof *EXPECTED;
+
+        if (veryVerbose) {
+            cout << stream.str() << endl;
+        }
+        for (int i = 0; i < NUM_EXPECTED; ++i) {
+            ASSERTV(i, stream.str(),
+                    bsl::string::npos != stream.str().find(EXPECTED[i]));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Values recorded concurrently from multiple threads are each
+        //:   counted exactly once, in the correct bucket.
+        //:
+        //: 2 Values recorded concurrently with 'loadAndReset' are each
+        //:   reported exactly once across the snapshots.
+        //
+        // Plan:
+        //: 1 Record a known set of values from several threads, and verify
+        //:   the resulting snapshot against one computed serially.  (C-1)
+        //:
+        //: 2 Repeat, while the main thread repeatedly performs
+        //:   'loadAndReset' and merges the snapshots.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENCY TEST"
+                          << "\n================" << endl;
+
+        const int NUM_THREADS    = 4;
+        const int NUM_ITERATIONS = 20000;
+
+        Snap expected;
+        {
+            Obj serial(METRIC_A);
+            for (int t = 1; t <= NUM_THREADS; ++t) {
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    serial.update(i * t);
+                }
+            }
+            serial.load(&expected);
+        }
+
+        if (verbose) cout << "\tConcurrent updates." << endl;
+        {
+            Obj mX(METRIC_A);
+            runThroughputTest(&mX, NUM_THREADS, NUM_ITERATIONS);
+
+            Snap s;
+            mX.load(&s);
+            ASSERT(expected == s);
+        }
+
+        if (verbose) cout << "\tConcurrent updates and resets." << endl;
+        {
+            Obj                                    mX(METRIC_A);
+            bslmt::Barrier                         barrier(NUM_THREADS + 1);
+            bsl::vector<bslmt::ThreadUtil::Handle> handles(NUM_THREADS);
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::create(
+                                   &handles[i],
+                                   bdlf::BindUtil::bind(&updateCollector<Obj>,
+                                                        &mX,
+                                                        &barrier,
+                                                        NUM_ITERATIONS,
+                                                        i + 1));
+                ASSERT(0 == rc);
+            }
+
+            Snap merged;
+            barrier.wait();
+            for (int i = 0; i < 100; ++i) {
+                Snap s;
+                mX.loadAndReset(&s);
+                merged.merge(s);
+                bslmt::ThreadUtil::yield();
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+            Snap s;
+            mX.loadAndReset(&s);
+            merged.merge(s);
+
+            ASSERTV(expected.count(), merged.count(),
+                    expected.count() == merged.count());
+            ASSERTV(expected.total(), merged.total(),
+                    expected.total() == merged.total());
+            ASSERT(expected == merged);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING: HistogramRegistration
+        //
+        // Concerns:
+        //: 1 The registration adds a metric for each percentile, named by the
+        //:   histogram's metric name and the digits of the percentile, whose
+        //:   preferred publication type is 'e_MAX'.
+        //:
+        //: 2 'collect' appends the histogram's record followed by a record
+        //:   for each percentile, and resets the histogram only if
+        //:   'resetFlag' is 'true'.
+        //:
+        //: 3 No percentile records are appended if the histogram is empty.
+        //:
+        //: 4 Publishing the histogram's category through the metrics manager
+        //:   invokes 'collect'.
+        //:
+        //: 5 The callback is removed when the registration is destroyed.
+        //:
+        //: 6 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Create registrations using the default and a user supplied set
+        //:   of percentiles, and verify the registered metrics.  (C-1, 6)
+        //:
+        //: 2 Record values, call 'collect' with both values of 'resetFlag',
+        //:   and verify the records and the state of the histogram.  (C-2..3)
+        //:
+        //: 3 Collect the category's records through the metrics manager,
+        //:   before and after destroying the registration.  (C-4..5)
+        //
+        // Testing:
+        //   HistogramRegistration(Collector *, MetricsManager *, Allocator *);
+        //   HistogramRegistration(Collector *, Manager *, double *, int, ...);
+        //   ~HistogramRegistration();
+        //   void collect(bsl::vector<MetricRecord> *records, bool resetFlag);
+        //   const bsl::vector<PercentileMetric>& percentiles() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING: HistogramRegistration"
+                          << "\n==============================" << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::TestAllocator         ta("test",    veryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        balm::MetricsManager  manager(&ta);
+        balm::MetricRegistry& registry = manager.metricRegistry();
+
+        Id  id = registry.getId("Cat", "Latency");
+        Obj mX(id);
+
+        if (verbose) cout << "\tDefault percentiles." << endl;
+        {
+            Reg reg(&mX, &manager, &ta);
+
+            const char *NAMES[] = {
+                "Latency.p50", "Latency.p90", "Latency.p99", "Latency.p999"
+            };
+            const double FRACTIONS[] = { 0.5, 0.9, 0.99, 0.999 };
+            const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+            ASSERTV(reg.percentiles().size(),
+                    NUM_NAMES == (int)reg.percentiles().size());
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                const Id& ID = reg.percentiles()[i].second;
+
+                ASSERTV(i, FRACTIONS[i] == reg.percentiles()[i].first);
+                ASSERTV(i, ID.metricName(),
+                        0 == bsl::strcmp(NAMES[i], ID.metricName()));
+                ASSERTV(i, ID == registry.findId("Cat", NAMES[i]));
+                ASSERTV(i, balm::PublicationType::e_MAX ==
+                           ID.description()->preferredPublicationType());
+            }
+            ASSERT(0 == da.numBytesInUse());
+
+            bsl::vector<Rec> records(&ta);
+            reg.collect(&records, true);
+            ASSERTV(records.size(), 1 == records.size());
+            ASSERT(id == records[0].metricId());
+            ASSERT(0  == records[0].count());
+            ASSERT(Rec::k_DEFAULT_MIN == records[0].min());
+            ASSERT(Rec::k_DEFAULT_MAX == records[0].max());
+
+            for (int i = 1; i <= 100; ++i) {
+                mX.update(i);
+            }
+
+            Snap expected;
+            mX.load(&expected);
+
+            records.clear();
+            reg.collect(&records, false);
+            ASSERTV(records.size(), 5 == records.size());
+
+            Snap s;
+            mX.load(&s);
+            ASSERT(expected == s);
+
+            records.clear();
+            reg.collect(&records, true);
+            ASSERTV(records.size(), 5 == records.size());
+
+            mX.load(&s);
+            ASSERT(0 == s.count());
+
+            ASSERT(id  == records[0].metricId());
+            ASSERT(100 == records[0].count());
+            ASSERT(5050 == records[0].total());
+            ASSERT(1   == records[0].min());
+            ASSERT(100 == records[0].max());
+
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                const Rec&   R = records[i + 1];
+                const double V = expected.percentile(FRACTIONS[i]);
+
+                ASSERTV(i, R.metricId() == reg.percentiles()[i].second);
+                ASSERTV(i, 100 == R.count());
+                ASSERTV(i, V, R.max(), V == R.max());
+                ASSERTV(i, V == R.min());
+                ASSERTV(i, V == R.total());
+            }
+
+            if (verbose) cout << "\tPublication through the manager." << endl;
+
+            mX.update(7);
+
+            bsl::vector<Rec>   sample(&ta);
+            balm::MetricSample metricSample(&ta);
+            const balm::Category *CAT = registry.getCategory("Cat");
+            manager.collectSample(&metricSample, &sample, &CAT, 1, true);
+            ASSERTV(sample.size(), 5 == sample.size());
+
+            const Rec *R = findRecord(sample, "Latency.p99");
+            ASSERT(0 != R);
+            if (R) {
+                ASSERTV(R->max(), 7 == R->max());
+            }
+
+            mX.load(&s);
+            ASSERT(0 == s.count());
+        }
+
+        if (verbose) cout << "\tCallback removed on destruction." << endl;
+        {
+            mX.update(7);
+
+            bsl::vector<Rec>   sample(&ta);
+            balm::MetricSample metricSample(&ta);
+            const balm::Category *CAT = registry.getCategory("Cat");
+            manager.collectSample(&metricSample, &sample, &CAT, 1, true);
+            ASSERTV(sample.size(), 0 == sample.size());
+
+            Snap s;
+            mX.load(&s);
+            ASSERT(1 == s.count());
+            mX.reset();
+        }
+
+        if (verbose) cout << "\tUser supplied percentiles." << endl;
+        {
+            const double FRACTIONS[] = { 0.0, 0.25, 0.999, 0.9999, 1.0 };
+            const char  *NAMES[]     = { "Latency.p0",
+                                         "Latency.p25",
+                                         "Latency.p999",
+                                         "Latency.p9999",
+                                         "Latency.p100" };
+            const int NUM_FRACTIONS = sizeof FRACTIONS / sizeof *FRACTIONS;
+
+            Reg reg(&mX, &manager, FRACTIONS, NUM_FRACTIONS, &ta);
+
+            ASSERT(NUM_FRACTIONS == (int)reg.percentiles().size());
+            for (int i = 0; i < NUM_FRACTIONS; ++i) {
+                const Id& ID = reg.percentiles()[i].second;
+                ASSERTV(i, ID.metricName(),
+                        0 == bsl::strcmp(NAMES[i], ID.metricName()));
+            }
+
+            mX.update(3);
+            mX.update(1000);
+
+            bsl::vector<Rec> records(&ta);
+            reg.collect(&records, true);
+            ASSERTV(records.size(), 6 == records.size());
+
+            ASSERTV(records[1].max(), 3    == records[1].max());
+            ASSERTV(records[5].max(), 1000 == records[5].max());
+
+            Reg empty(&mX, &manager, 0, 0, &ta);
+            ASSERT(0 == empty.percentiles().size());
+        }
+        ASSERT(0 == da.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING: percentile, merge, and equality
+        //
+        // Concerns:
+        //: 1 'percentile' returns 0 for an empty snapshot.
+        //:
+        //: 2 'percentile' returns the exact value for values counted exactly,
+        //:   and otherwise the midpoint of the bucket holding the
+        //:   'ceil(fraction * count())'th value, clamped to '[min, max]'.
+        //:
+        //: 3 The relative error of 'percentile' is bounded by the bucket
+        //:   width.
+        //:
+        //: 4 'merge' produces the snapshot of the union of the values.
+        //:
+        //: 5 Equality compares count, total, min, max, and buckets.
+        //
+        // Plan:
+        //: 1 Verify 'percentile' for a table of small distributions.
+        //:   (C-1..2)
+        //:
+        //: 2 Record a wide range of values, and compare each percentile with
+        //:   the exact percentile.  (C-3)
+        //:
+        //: 3 Merge snapshots of disjoint sets of values, and compare with a
+        //:   snapshot of their union.  (C-4..5)
+        //
+        // Testing:
+        //   double percentile(double fraction) const;
+        //   void merge(const balm::HistogramSnapshot& other);
+        //   bool operator==(const Snapshot&, const Snapshot&);
+        //   bool operator!=(const Snapshot&, const Snapshot&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING: percentile, merge, and equality"
+                          << "\n========================================"
+                          << endl;
+
+        if (verbose) cout << "\tTesting 'percentile'." << endl;
+        {
+            Snap s;
+            ASSERT(0.0 == s.percentile(0.0));
+            ASSERT(0.0 == s.percentile(0.5));
+            ASSERT(0.0 == s.percentile(1.0));
+
+            Obj mX(METRIC_A);
+            for (int i = 1; i <= 10; ++i) {
+                mX.update(i);
+            }
+            mX.load(&s);
+            ASSERT(1.0  == s.percentile(0.0));
+            ASSERT(1.0  == s.percentile(0.1));
+            ASSERT(2.0  == s.percentile(0.11));
+            ASSERT(5.0  == s.percentile(0.5));
+            ASSERT(9.0  == s.percentile(0.9));
+            ASSERT(10.0 == s.percentile(0.91));
+            ASSERT(10.0 == s.percentile(1.0));
+
+            // Values in wider buckets report the bucket midpoint, clamped to
+            // the extreme values.
+
+            mX.reset();
+            mX.update(100);     // bucket [100, 103]
+            mX.update(101);
+            mX.update(1000);    // bucket [992, 1023]
+            mX.load(&s);
+            ASSERTV(s.percentile(0.5), 101.5  == s.percentile(0.5));
+            ASSERTV(s.percentile(0.3), 101.5  == s.percentile(0.3));
+            ASSERTV(s.percentile(1.0), 1000.0 == s.percentile(1.0));
+
+            mX.reset();
+            mX.update(102);
+            mX.load(&s);
+            ASSERTV(s.percentile(0.5), 102.0 == s.percentile(0.5));
+        }
+
+        if (verbose) cout << "\tTesting relative error." << endl;
+        {
+            Obj                 mX(METRIC_A);
+            bsl::vector<Int64>  values;
+
+            // A geometric sequence of values, so that every group of buckets
+            // is populated.
+
+            for (double v = 1.0; v < 1e15; v *= 1.01) {
+                values.push_back(static_cast<Int64>(v));
+                mX.update(static_cast<Int64>(v));
+            }
+            Snap s;
+            mX.load(&s);
+
+            const double FRACTIONS[] = {
+                0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 1.0
+            };
+            const int NUM_FRACTIONS = sizeof FRACTIONS / sizeof *FRACTIONS;
+
+            for (int i = 0; i < NUM_FRACTIONS; ++i) {
+                const double F    = FRACTIONS[i];
+                const Int64  RANK = static_cast<Int64>(
+                                     bsl::ceil(F * (double)values.size()));
+                const double EXACT  = static_cast<double>(values[RANK - 1]);
+                const double ACTUAL = s.percentile(F);
+                const double ERROR  = bsl::fabs(ACTUAL - EXACT) / EXACT;
+
+                if (veryVerbose) { P_(F) P_(EXACT) P_(ACTUAL) P(ERROR) }
+                ASSERTV(F, EXACT, ACTUAL, ERROR <= 1.0 / 32);
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'merge' and equality." << endl;
+        {
+            Obj mA(METRIC_A);
+            Obj mB(METRIC_A);
+            Obj mU(METRIC_A);
+
+            for (int i = 0; i < 1000; ++i) {
+                const Int64 V = i * 37 + 5;
+                (0 == i % 3 ? mA : mB).update(V);
+                mU.update(V);
+            }
+
+            Snap a, b, u;
+            mA.load(&a);
+            mB.load(&b);
+            mU.load(&u);
+
+            ASSERT(a != u);
+            ASSERT(b != u);
+            ASSERT(a != b);
+
+            Snap m(a);
+            ASSERT(m == a);
+            m.merge(b);
+            ASSERT(m == u);
+            ASSERT(!(m != u));
+            ASSERT(u.percentile(0.5) == m.percentile(0.5));
+
+            Snap e;
+            m.merge(e);
+            ASSERT(m == u);
+
+            e.merge(u);
+            ASSERT(e == u);
+
+            // Equality considers the total, and the extreme values, which
+            // are not implied by the buckets.
+
+            Obj mX(METRIC_A);
+            Obj mY(METRIC_A);
+            mX.update(100);
+            mY.update(101);
+            Snap x, y;
+            mX.load(&x);
+            mY.load(&y);
+            ASSERT(x.bucketCount(Snap::bucketIndex(100)) ==
+                                   y.bucketCount(Snap::bucketIndex(100)));
+            ASSERT(x != y);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING: update, load, loadAndReset, and reset
+        //
+        // Concerns:
+        //: 1 A default constructed snapshot and a new collector are empty.
+        //:
+        //: 2 'update' counts each value in its bucket, and accumulates the
+        //:   total, minimum, and maximum.
+        //:
+        //: 3 Negative values are recorded as 0.
+        //:
+        //: 4 'load' does not modify the collector, while 'loadAndReset' and
+        //:   'reset' return it to the empty state.
+        //:
+        //: 5 'loadRecord' loads the count, total, min, and max (and the
+        //:   default min and max for an empty snapshot).
+        //:
+        //: 6 'update' does not allocate memory.
+        //
+        // Plan:
+        //: 1 Record sequences of values and verify the resulting snapshots
+        //:   against the expected values.  (C-1..5)
+        //:
+        //: 2 Install a test allocator as the default allocator, and verify
+        //:   it is not used.  (C-6)
+        //
+        // Testing:
+        //   balm::HistogramSnapshot();
+        //   void reset();
+        //   bsls::Types::Int64 bucketCount(int index) const;
+        //   bsls::Types::Int64 count() const;
+        //   bsls::Types::Int64 total() const;
+        //   bsls::Types::Int64 min() const;
+        //   bsls::Types::Int64 max() const;
+        //   void loadRecord(balm::MetricRecord *record) const;
+        //   balm::HistogramCollector(const balm::MetricId& metricId);
+        //   ~balm::HistogramCollector();
+        //   void loadAndReset(balm::HistogramSnapshot *snapshot);
+        //   void reset();
+        //   void update(bsls::Types::Int64 value);
+        //   void load(balm::HistogramSnapshot *snapshot) const;
+        //   const balm::MetricId& metricId() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING: update, load, loadAndReset, and reset"
+                          << "\n=============================================="
+                          << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        Snap s;
+        ASSERT(0 == s.count());
+        ASSERT(0 == s.total());
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            ASSERTV(i, 0 == s.bucketCount(i));
+        }
+
+        Rec r(METRIC_A);
+        s.loadRecord(&r);
+        ASSERT(METRIC_A == r.metricId());
+        ASSERT(0 == r.count());
+        ASSERT(0 == r.total());
+        ASSERT(Rec::k_DEFAULT_MIN == r.min());
+        ASSERT(Rec::k_DEFAULT_MAX == r.max());
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+        ASSERT(METRIC_A == X.metricId());
+
+        X.load(&s);
+        ASSERT(0 == s.count());
+
+        const Int64 BIG = LLONG_MAX - 1000000000;
+
+        const Int64 VALUES[] = {
+            0, 1, 31, 32, 33, 1000, 1000, 1000000, BIG, 17
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        Int64 total = 0;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.update(VALUES[i]);
+            total += VALUES[i];
+        }
+
+        X.load(&s);
+        ASSERTV(s.count(), NUM_VALUES == s.count());
+        ASSERTV(s.total(), total == s.total());
+        ASSERT(0   == s.min());
+        ASSERT(BIG == s.max());
+        ASSERT(1 == s.bucketCount(0));
+        ASSERT(1 == s.bucketCount(1));
+        ASSERT(1 == s.bucketCount(17));
+        ASSERT(1 == s.bucketCount(31));
+        ASSERT(2 == s.bucketCount(Snap::bucketIndex(32)));
+        ASSERT(2 == s.bucketCount(Snap::bucketIndex(1000)));
+        ASSERT(1 == s.bucketCount(Snap::bucketIndex(1000000)));
+        ASSERT(1 == s.bucketCount(NUM_BUCKETS - 1));
+
+        Int64 bucketSum = 0;
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            bucketSum += s.bucketCount(i);
+        }
+        ASSERT(NUM_VALUES == bucketSum);
+
+        // 'load' does not reset.
+
+        Snap s2;
+        X.load(&s2);
+        ASSERT(s == s2);
+
+        s.loadRecord(&r);
+        ASSERT(NUM_VALUES == r.count());
+        ASSERT(0.0 == r.min());
+        ASSERT(static_cast<double>(BIG) == r.max());
+
+        // 'loadAndReset' resets.
+
+        mX.loadAndReset(&s2);
+        ASSERT(s == s2);
+        X.load(&s2);
+        ASSERT(0 == s2.count());
+        ASSERT(0 == s2.total());
+        ASSERT(Snap() == s2);
+
+        // Negative values are recorded as 0.
+
+        mX.update(-5);
+        mX.update(-1);
+        X.load(&s2);
+        ASSERT(2 == s2.count());
+        ASSERT(0 == s2.total());
+        ASSERT(0 == s2.min());
+        ASSERT(0 == s2.max());
+        ASSERT(2 == s2.bucketCount(0));
+
+        // 'reset'
+
+        mX.reset();
+        X.load(&s2);
+        ASSERT(Snap() == s2);
+
+        s.reset();
+        ASSERT(Snap() == s);
+
+        mX.update(5);
+        mX.update(3);
+        X.load(&s);
+        ASSERT(3 == s.min());
+        ASSERT(5 == s.max());
+        ASSERT(8 == s.total());
+
+        ASSERT(0 == da.numAllocations());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING: bucketIndex, bucketLowerBound, and bucketUpperBound
+        //
+        // Concerns:
+        //: 1 Values less than 32 each have their own bucket.
+        //:
+        //: 2 The buckets are contiguous, non-overlapping, and cover the
+        //:   range '[0 .. LLONG_MAX]'.
+        //:
+        //: 3 Each value lies within the bounds of its bucket.
+        //:
+        //: 4 The width of a bucket is at most 1/16th of its lower bound.
+        //
+        // Plan:
+        //: 1 Verify the bucket of each value in '[0 .. 32)'.  (C-1)
+        //:
+        //: 2 For each bucket, verify that its lower bound is one more than
+        //:   the upper bound of the previous bucket, that both bounds map to
+        //:   the bucket, and that the bucket is suitably narrow.  (C-2..4)
+        //:
+        //: 3 Verify the bucket of the values adjacent to each power of two,
+        //:   and of a sequence of pseudo-random values.  (C-3)
+        //
+        // Testing:
+        //   int bucketIndex(bsls::Types::Int64 value);
+        //   bsls::Types::Int64 bucketLowerBound(int index);
+        //   bsls::Types::Int64 bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING: bucketIndex and bucket bounds"
+                          << "\n======================================"
+                          << endl;
+
+        for (int v = 0; v < 32; ++v) {
+            ASSERTV(v, v == Snap::bucketIndex(v));
+            ASSERTV(v, v == Snap::bucketLowerBound(v));
+            ASSERTV(v, v == Snap::bucketUpperBound(v));
+        }
+
+        ASSERT(0 == Snap::bucketLowerBound(0));
+        ASSERT(LLONG_MAX == Snap::bucketUpperBound(NUM_BUCKETS - 1));
+        ASSERT(NUM_BUCKETS - 1 == Snap::bucketIndex(LLONG_MAX));
+
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            const Int64 LOWER = Snap::bucketLowerBound(i);
+            const Int64 UPPER = Snap::bucketUpperBound(i);
+
+            if (veryVerbose) { P_(i) P_(LOWER) P(UPPER) }
+
+            ASSERTV(i, LOWER <= UPPER);
+            if (0 < i) {
+                ASSERTV(i, LOWER == Snap::bucketUpperBound(i - 1) + 1);
+            }
+            ASSERTV(i, i == Snap::bucketIndex(LOWER));
+            ASSERTV(i, i == Snap::bucketIndex(UPPER));
+            ASSERTV(i, LOWER, UPPER, (UPPER - LOWER) <= LOWER / 16);
+        }
+
+        for (int b = 1; b < 63; ++b) {
+            const Int64 V = Int64(1) << b;
+            for (Int64 d = -1; d <= 1; ++d) {
+                const int INDEX = Snap::bucketIndex(V + d);
+                ASSERTV(b, d, Snap::bucketLowerBound(INDEX) <= V + d);
+                ASSERTV(b, d, V + d <= Snap::bucketUpperBound(INDEX));
+            }
+        }
+
+        bsls::Types::Uint64 x = 88172645463325252ULL;
+        for (int i = 0; i < 100000; ++i) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            const Int64 V     = static_cast<Int64>(x >> (1 + i % 63));
+            const int   INDEX = Snap::bucketIndex(V);
+            ASSERTV(V, 0 <= INDEX && INDEX < NUM_BUCKETS);
+            ASSERTV(V, Snap::bucketLowerBound(INDEX) <= V);
+            ASSERTV(V, V <= Snap::bucketUpperBound(INDEX));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a collector, record values, and verify the snapshot.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+
+        mX.update(1);
+        mX.update(5);
+        mX.update(100);
+
+        Snap s;
+        X.load(&s);
+        ASSERT(3   == s.count());
+        ASSERT(106 == s.total());
+        ASSERT(1   == s.min());
+        ASSERT(100 == s.max());
+        ASSERT(5.0 == s.percentile(0.5));
+
+        mX.loadAndReset(&s);
+        ASSERT(3 == s.count());
+
+        X.load(&s);
+        ASSERT(0 == s.count());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // UPDATE THROUGHPUT: INTEGER VS. HISTOGRAM COLLECTORS
+        //
+        // Concerns:
+        //: 1 Compare the throughput of 'update' on the mutex-based
+        //:   'balm::IntegerCollector' with that of 'balm::HistogramCollector'
+        //:   for an increasing number of threads.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, ..., 32 threads, update a single collector of each
+        //:   type from all threads and report the number of updates per
+        //:   second.  The 3rd command line argument, if supplied, is the
+        //:   number of updates per thread.
+        //
+        // Testing:
+        //   UPDATE THROUGHPUT: INTEGER VS. HISTOGRAM COLLECTORS
+        // --------------------------------------------------------------------
+
+        cout << endl << "UPDATE THROUGHPUT: INTEGER VS. HISTOGRAM COLLECTORS"
+             << endl << "==================================================="
+             << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        for (int numThreads = 1; numThreads <= 32; numThreads *= 2) {
+            const double TOTAL = static_cast<double>(numThreads) *
+                                                                NUM_ITERATIONS;
+
+            balm::IntegerCollector ic(METRIC_A);
+            Obj                    hc(METRIC_A);
+
+            const double icTime = runThroughputTest(&ic,
+                                                    numThreads,
+                                                    NUM_ITERATIONS);
+            const double hcTime = runThroughputTest(&hc,
+                                                    numThreads,
+                                                    NUM_ITERATIONS);
+
+            cout << "threads: "             << numThreads
+                 << "\tIntegerCollector: "   << TOTAL / icTime << "/s"
+                 << "\tHistogramCollector: " << TOTAL / hcTime << "/s"
+                 << endl;
+
+            if (veryVerbose) {
+                Snap s;
+                hc.load(&s);
+                P_(s.count()) P_(s.percentile(0.5)) P(s.percentile(0.99))
+            }
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -66,6 +66,13 @@ BSLS_IDENT("$Id: $")
 //       Update each of up to 6 metrics by the corresponding values.
 //       The supplied category and metric names must be *runtime* *constants*.
 //
+//   BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)
+//       Update the identified metric by 'VALUE' (or 1) using a lock-free,
+//       per-thread sharded collector.  'CATEGORY' and 'METRIC' must be
+//       *runtime* *constants*.
+//
 //   BALM_METRICS_TYPED_UPDATE(CATEGORY, METRIC, VALUE, PREFERRED_TYPE)
 //   BALM_METRICS_TYPED_INT_UPDATE(CATEGORY, METRIC, VALUE, PREFERRED_TYPE)
 //       Update the identified metric by 'VALUE' and set its preferred
@@ -213,6 +220,26 @@ BSLS_IDENT("$Id: $")
 //       initialized, or if the indicated 'CATEGORY' is currently disabled,
 //       these macros have no effect.
 //
+//   BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, VALUE)
+//       The behavior of these macros is logically equivalent to
+//       'BALM_METRICS_UPDATE(CATEGORY, METRIC, VALUE)' and
+//       'BALM_METRICS_INT_UPDATE(CATEGORY, METRIC, VALUE)', respectively,
+//       except that the value is recorded by a 'balm::ShardedCollector' (or
+//       'balm::ShardedIntegerCollector'), which does not acquire a lock, and
+//       spreads updates from different threads across different cache lines.
+//       These macros are intended for metrics updated at a high rate from
+//       many threads concurrently.  The values recorded through these macros
+//       are combined with the values recorded for the same metric through
+//       the other macros when the metric is published.  Note that the
+//       aggregates of an update that is concurrent with publication may be
+//       split across consecutive publication intervals (see
+//       'balm_shardedcollector').
+//
+//   BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)
+//       The behavior of this macro is logically equivalent to:
+//       'BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, 1)'.
+//
 //   BALM_METRICS_TYPED_UPDATE(CATEGORY,
 //                             METRIC,
 //                             VALUE,
@@ -510,6 +537,7 @@ BSLS_IDENT("$Id: $")
 #include <balm_metricregistry.h>
 #include <balm_metricsmanager.h>
 #include <balm_publicationtype.h>
+#include <balm_shardedcollector.h>
 #include <balm_stopwatchscopedguard.h>
 
 #include <bsls_performancehint.h>
@@ -987,9 +1015,48 @@ do {                                                                          \
     }                                                                         \
   } while (0)
 
+                        // ===========================
+                        // BALM_METRICS_SHARDED_UPDATE
+                        // ===========================
+
+#define BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, VALUE) do {             \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::ShardedCollector *collector1 = 0;                             \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       collector1 = Helper::getShardedCollector(CATEGORY, METRIC);            \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE);                                             \
+   }                                                                          \
+ } while (0)
+
+#define BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, VALUE) do {         \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::ShardedIntegerCollector *collector1 = 0;                      \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       collector1 = Helper::getShardedIntegerCollector(CATEGORY, METRIC);     \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE);                                             \
+   }                                                                          \
+ } while (0)
+
 #define BALM_METRICS_INCREMENT(CATEGORY, METRIC)                              \
     BALM_METRICS_INT_UPDATE(CATEGORY, METRIC, 1)
 
+#define BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)                      \
+    BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, 1)
+
 #define BALM_METRICS_TYPED_INCREMENT(CATEGORY, METRIC, PREFERRED_TYPE)        \
     BALM_METRICS_TYPED_INT_UPDATE(CATEGORY, METRIC, 1, PREFERRED_TYPE)
 
@@ -1202,6 +1269,21 @@ struct Metrics_Helper {
         // The behavior is undefined unless the 'balm' metrics manager
         // singleton is valid.
 
+    static ShardedCollector *getShardedCollector(const char *category,
+                                                 const char *metric);
+        // Return the address of the default sharded metrics collector for the
+        // metric identified by the specified 'category' and 'metric' names.
+        // The behavior is undefined unless the 'balm' metrics manager
+        // singleton is valid.
+
+    static ShardedIntegerCollector *getShardedIntegerCollector(
+                                                        const char *category,
+                                                        const char *metric);
+        // Return the address of the default sharded integer metrics collector
+        // for the metric identified by the specified 'category' and 'metric'
+        // names.  The behavior is undefined unless the 'balm' metrics manager
+        // singleton is valid.
+
     static void setPublicationType(const MetricId&        id,
                                    PublicationType::Value type);
         // Set the publication type for the metric identified by the specified
@@ -1256,6 +1338,26 @@ IntegerCollector *Metrics_Helper::getIntegerCollector(const char *category,
                                                                      metric);
 }
 
+inline
+ShardedCollector *Metrics_Helper::getShardedCollector(const char *category,
+                                                      const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultShardedCollector(category,
+                                                                     metric);
+}
+
+inline
+ShardedIntegerCollector *Metrics_Helper::getShardedIntegerCollector(
+                                                          const char *category,
+                                                          const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultShardedIntegerCollector(
+                                                                     category,
+                                                                     metric);
+}
+
 inline
 void Metrics_Helper::setPublicationType(const MetricId&        id,
                                         PublicationType::Value type)
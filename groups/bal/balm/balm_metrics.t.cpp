@@ -101,7 +101,8 @@ using bsl::flush;
 //                                             const char *file,
 //                                             int         line);
 // [18] WARNING LOG TEST: ALL MACROS
-// [19] USAGE EXAMPLE
+// [19] CONCURRENCY TEST: SHARDED MACROS
+// [20] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -1280,6 +1281,22 @@ void TlsIntMacroConcurrencyTest::runTest()
 
 #endif
 
+// ------------------- case 19: shardedMacroJob ------------------------------
+
+void shardedMacroJob(Corp::bslmt::Barrier *barrier, int numIterations)
+    // Wait on the specified 'barrier', then update the metrics "A", "B", and
+    // "C" in the category "Sharded" the specified 'numIterations' times using
+    // the sharded macros.
+{
+    barrier->wait();
+    for (int i = 0; i < numIterations; ++i) {
+        BALM_METRICS_SHARDED_UPDATE("Sharded", "A", 1.5);
+        BALM_METRICS_SHARDED_INT_UPDATE("Sharded", "B", 2);
+        BALM_METRICS_SHARDED_INCREMENT("Sharded", "C");
+        BALM_METRICS_INT_UPDATE("Sharded", "C", 1);
+    }
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -1385,7 +1402,7 @@ int main(int argc, char *argv[])
     Corp::bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1443,6 +1460,98 @@ int main(int argc, char *argv[])
 
     }
     } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST: SHARDED MACROS
+        //
+        // Concerns:
+        //: 1 The sharded macros record each update exactly once when invoked
+        //:   concurrently from multiple threads.
+        //:
+        //: 2 Values recorded by the sharded macros are combined with values
+        //:   recorded for the same metric by the standard macros.
+        //:
+        //: 3 The sharded macros have no effect if the category is disabled.
+        //
+        // Plan:
+        //: 1 Invoke the sharded macros from several threads, then collect the
+        //:   records for the category and verify the aggregated values.
+        //:   (C-1..2)
+        //:
+        //: 2 Disable the category, invoke the sharded macros, and verify no
+        //:   values are recorded.  (C-3)
+        //
+        // Testing:
+        //   BALM_METRICS_SHARDED_UPDATE(CATEGORY, METRIC, VALUE)
+        //   BALM_METRICS_SHARDED_INT_UPDATE(CATEGORY, METRIC, VALUE)
+        //   BALM_METRICS_SHARDED_INCREMENT(CATEGORY, METRIC)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST: SHARDED MACROS" << endl
+                          << "================================" << endl;
+
+        Corp::bslma::TestAllocator testAllocator;
+
+        BALM::DefaultMetricsManagerScopedGuard scopedGuard(&testAllocator);
+        BALM::MetricsManager& mgr        = *DefaultManager::instance();
+        Repository&           repository = mgr.collectorRepository();
+        Registry&             registry   = mgr.metricRegistry();
+
+        const int NUM_THREADS    = 8;
+        const int NUM_ITERATIONS = 1000;
+        const int TOTAL          = NUM_THREADS * NUM_ITERATIONS;
+
+        {
+            Corp::bslmt::Barrier     barrier(NUM_THREADS);
+            Corp::bdlmt::FixedThreadPool pool(NUM_THREADS,
+                                              NUM_THREADS,
+                                              &testAllocator);
+            pool.start();
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                pool.enqueueJob(Corp::bdlf::BindUtil::bind(&shardedMacroJob,
+                                                           &barrier,
+                                                           NUM_ITERATIONS));
+            }
+            pool.drain();
+        }
+
+        const Category *CATEGORY = registry.getCategory("Sharded");
+        const Id        A        = registry.getId("Sharded", "A");
+        const Id        B        = registry.getId("Sharded", "B");
+
+        bsl::vector<BALM::MetricRecord> records(Z);
+        repository.collectAndReset(&records, CATEGORY);
+        ASSERTV(records.size(), 3 == records.size());
+
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            const BALM::MetricRecord& R = records[i];
+            if (A == R.metricId()) {
+                ASSERTV(R, BALM::MetricRecord(A, TOTAL, 1.5 * TOTAL, 1.5, 1.5)
+                                                                         == R);
+            }
+            else if (B == R.metricId()) {
+                ASSERTV(R, BALM::MetricRecord(B, TOTAL, 2.0 * TOTAL, 2, 2)
+                                                                         == R);
+            }
+            else {
+                ASSERTV(R, 2 * TOTAL == R.count());
+                ASSERTV(R, 2 * TOTAL == R.total());
+            }
+        }
+
+        mgr.setCategoryEnabled("Sharded", false);
+        {
+            Corp::bslmt::Barrier barrier(1);
+            shardedMacroJob(&barrier, 10);
+        }
+        records.clear();
+        repository.collect(&records, CATEGORY);
+        ASSERTV(records.size(), 3 == records.size());
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            ASSERTV(records[i], 0 == records[i].count());
+        }
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // Testing:
@@ -0,0 +1,339 @@
+// balm_shardedcollector.cpp                                          -*-C++-*-
+#include <balm_shardedcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_shardedcollector_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace balm {
+
+namespace {
+
+const bsls::Types::Int64 k_INT_DEFAULT_MIN = LLONG_MAX;
+const bsls::Types::Int64 k_INT_DEFAULT_MAX = LLONG_MIN;
+    // Sentinel minimum and maximum of a 'ShardedIntegerCollector' cell,
+    // indicating that no value has been recorded.  Note that these values are
+    // outside the range of 'int', so they cannot collide with an update.
+
+int toCount(bsls::Types::Int64 count)
+    // Return the specified 'count' converted to 'int', saturating at
+    // 'INT_MAX'.
+{
+    return count > INT_MAX ? INT_MAX : static_cast<int>(count);
+}
+
+void constructCells(ShardedCollector_Cell *cells,
+                    bsls::Types::Int64     defaultMin,
+                    bsls::Types::Int64     defaultMax)
+    // Construct 'ShardedCollector_Util::k_NUM_SHARDS' cells at the specified
+    // 'cells' address, having a count and total of 0, and a minimum and
+    // maximum of the specified 'defaultMin' and 'defaultMax' respectively.
+{
+    for (int i = 0; i < ShardedCollector_Util::k_NUM_SHARDS; ++i) {
+        ShardedCollector_Cell *cell = new (cells + i) ShardedCollector_Cell();
+        cell->d_min.storeRelaxed(defaultMin);
+        cell->d_max.storeRelaxed(defaultMax);
+    }
+}
+
+void resetCell(ShardedCollector_Cell *cell,
+               bsls::Types::Int64     defaultMin,
+               bsls::Types::Int64     defaultMax)
+    // Reset the specified 'cell' to have a count and total of 0, and a minimum
+    // and maximum of the specified 'defaultMin' and 'defaultMax'
+    // respectively.
+{
+    cell->d_count.store(0);
+    cell->d_total.store(0);
+    cell->d_min.store(defaultMin);
+    cell->d_max.store(defaultMax);
+}
+
+}  // close unnamed namespace
+
+                           // ----------------------
+                           // class ShardedCollector
+                           // ----------------------
+
+// CREATORS
+ShardedCollector::ShardedCollector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_cells_p(Util::alignCells(d_buffer.buffer()))
+{
+    constructCells(d_cells_p,
+                   Util::toBits(MetricRecord::k_DEFAULT_MIN),
+                   Util::toBits(MetricRecord::k_DEFAULT_MAX));
+}
+
+// MANIPULATORS
+void ShardedCollector::reset()
+{
+    const bsls::Types::Int64 defaultMin =
+                                    Util::toBits(MetricRecord::k_DEFAULT_MIN);
+    const bsls::Types::Int64 defaultMax =
+                                    Util::toBits(MetricRecord::k_DEFAULT_MAX);
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        resetCell(d_cells_p + i, defaultMin, defaultMax);
+    }
+}
+
+void ShardedCollector::loadAndReset(MetricRecord *record)
+{
+    BSLS_ASSERT(record);
+
+    const bsls::Types::Int64 defaultMin =
+                                    Util::toBits(MetricRecord::k_DEFAULT_MIN);
+    const bsls::Types::Int64 defaultMax =
+                                    Util::toBits(MetricRecord::k_DEFAULT_MAX);
+
+    bsls::Types::Int64 count = 0;
+    double             total = 0.0;
+    double             min   = MetricRecord::k_DEFAULT_MIN;
+    double             max   = MetricRecord::k_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        Cell& cell = d_cells_p[i];
+
+        count += cell.d_count.swap(0);
+        total += Util::toDouble(cell.d_total.swap(0));
+        min    = bsl::min(min, Util::toDouble(cell.d_min.swap(defaultMin)));
+        max    = bsl::max(max, Util::toDouble(cell.d_max.swap(defaultMax)));
+    }
+
+    record->metricId() = d_metricId;
+    record->count()    = toCount(count);
+    record->total()    = total;
+    record->min()      = min;
+    record->max()      = max;
+}
+
+void ShardedCollector::accumulateCountTotalMinMax(int    count,
+                                                  double total,
+                                                  double min,
+                                                  double max)
+{
+    Cell& cell = d_cells_p[Util::shardIndex()];
+
+    cell.d_count.addRelaxed(count);
+
+    bsls::Types::Int64 bits = cell.d_total.loadRelaxed();
+    for (;;) {
+        const bsls::Types::Int64 prev = cell.d_total.testAndSwap(
+                                   bits,
+                                   Util::toBits(Util::toDouble(bits) + total));
+        if (prev == bits) {
+            break;
+        }
+        bits = prev;
+    }
+
+    bits = cell.d_min.loadRelaxed();
+    while (min < Util::toDouble(bits)) {
+        const bsls::Types::Int64 prev =
+                              cell.d_min.testAndSwap(bits, Util::toBits(min));
+        if (prev == bits) {
+            break;
+        }
+        bits = prev;
+    }
+
+    bits = cell.d_max.loadRelaxed();
+    while (max > Util::toDouble(bits)) {
+        const bsls::Types::Int64 prev =
+                              cell.d_max.testAndSwap(bits, Util::toBits(max));
+        if (prev == bits) {
+            break;
+        }
+        bits = prev;
+    }
+}
+
+void ShardedCollector::setCountTotalMinMax(int    count,
+                                           double total,
+                                           double min,
+                                           double max)
+{
+    reset();
+
+    Cell& cell = d_cells_p[0];
+    cell.d_count.store(count);
+    cell.d_total.store(Util::toBits(total));
+    cell.d_min.store(Util::toBits(min));
+    cell.d_max.store(Util::toBits(max));
+}
+
+// ACCESSORS
+void ShardedCollector::load(MetricRecord *record) const
+{
+    BSLS_ASSERT(record);
+
+    bsls::Types::Int64 count = 0;
+    double             total = 0.0;
+    double             min   = MetricRecord::k_DEFAULT_MIN;
+    double             max   = MetricRecord::k_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        const Cell& cell = d_cells_p[i];
+
+        count += cell.d_count.load();
+        total += Util::toDouble(cell.d_total.load());
+        min    = bsl::min(min, Util::toDouble(cell.d_min.load()));
+        max    = bsl::max(max, Util::toDouble(cell.d_max.load()));
+    }
+
+    record->metricId() = d_metricId;
+    record->count()    = toCount(count);
+    record->total()    = total;
+    record->min()      = min;
+    record->max()      = max;
+}
+
+                       // -----------------------------
+                       // class ShardedIntegerCollector
+                       // -----------------------------
+
+// CREATORS
+ShardedIntegerCollector::ShardedIntegerCollector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_cells_p(Util::alignCells(d_buffer.buffer()))
+{
+    constructCells(d_cells_p, k_INT_DEFAULT_MIN, k_INT_DEFAULT_MAX);
+}
+
+// MANIPULATORS
+void ShardedIntegerCollector::reset()
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        resetCell(d_cells_p + i, k_INT_DEFAULT_MIN, k_INT_DEFAULT_MAX);
+    }
+}
+
+void ShardedIntegerCollector::loadAndReset(MetricRecord *record)
+{
+    BSLS_ASSERT(record);
+
+    bsls::Types::Int64 count = 0;
+    bsls::Types::Int64 total = 0;
+    bsls::Types::Int64 min   = k_INT_DEFAULT_MIN;
+    bsls::Types::Int64 max   = k_INT_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        Cell& cell = d_cells_p[i];
+
+        count += cell.d_count.swap(0);
+        total += cell.d_total.swap(0);
+        min    = bsl::min(min, cell.d_min.swap(k_INT_DEFAULT_MIN));
+        max    = bsl::max(max, cell.d_max.swap(k_INT_DEFAULT_MAX));
+    }
+
+    // Perform the conversion to double values after the shards are reset.
+
+    record->metricId() = d_metricId;
+    record->count()    = toCount(count);
+    record->total()    = static_cast<double>(total);
+    record->min()      = (k_INT_DEFAULT_MIN == min)
+                       ? MetricRecord::k_DEFAULT_MIN
+                       : static_cast<double>(min);
+    record->max()      = (k_INT_DEFAULT_MAX == max)
+                       ? MetricRecord::k_DEFAULT_MAX
+                       : static_cast<double>(max);
+}
+
+void ShardedIntegerCollector::accumulateCountTotalMinMax(int count,
+                                                         int total,
+                                                         int min,
+                                                         int max)
+{
+    Cell& cell = d_cells_p[Util::shardIndex()];
+
+    cell.d_count.addRelaxed(count);
+    cell.d_total.addRelaxed(total);
+
+    bsls::Types::Int64 current = cell.d_min.loadRelaxed();
+    while (min < current) {
+        const bsls::Types::Int64 prev = cell.d_min.testAndSwap(current, min);
+        if (prev == current) {
+            break;
+        }
+        current = prev;
+    }
+
+    current = cell.d_max.loadRelaxed();
+    while (max > current) {
+        const bsls::Types::Int64 prev = cell.d_max.testAndSwap(current, max);
+        if (prev == current) {
+            break;
+        }
+        current = prev;
+    }
+}
+
+void ShardedIntegerCollector::setCountTotalMinMax(int count,
+                                                  int total,
+                                                  int min,
+                                                  int max)
+{
+    reset();
+
+    Cell& cell = d_cells_p[0];
+    cell.d_count.store(count);
+    cell.d_total.store(total);
+    cell.d_min.store(min);
+    cell.d_max.store(max);
+}
+
+// ACCESSORS
+void ShardedIntegerCollector::load(MetricRecord *record) const
+{
+    BSLS_ASSERT(record);
+
+    bsls::Types::Int64 count = 0;
+    bsls::Types::Int64 total = 0;
+    bsls::Types::Int64 min   = k_INT_DEFAULT_MIN;
+    bsls::Types::Int64 max   = k_INT_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        const Cell& cell = d_cells_p[i];
+
+        count += cell.d_count.load();
+        total += cell.d_total.load();
+        min    = bsl::min(min, cell.d_min.load());
+        max    = bsl::max(max, cell.d_max.load());
+    }
+
+    record->metricId() = d_metricId;
+    record->count()    = toCount(count);
+    record->total()    = static_cast<double>(total);
+    record->min()      = (k_INT_DEFAULT_MIN == min)
+                       ? MetricRecord::k_DEFAULT_MIN
+                       : static_cast<double>(min);
+    record->max()      = (k_INT_DEFAULT_MAX == max)
+                       ? MetricRecord::k_DEFAULT_MAX
+                       : static_cast<double>(max);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,528 @@
+// balm_shardedcollector.h                                            -*-C++-*-
+#ifndef INCLUDED_BALM_SHARDEDCOLLECTOR
+#define INCLUDED_BALM_SHARDEDCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide lock-free, per-thread sharded metric collectors.
+//
+//@CLASSES:
+//   balm::ShardedCollector: sharded collector for 'double' metric values
+//   balm::ShardedIntegerCollector: sharded collector for 'int' metric values
+//
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_collectorrepository,
+//           balm_metrics
+//
+//@DESCRIPTION: This component provides two mechanisms,
+// 'balm::ShardedCollector' and 'balm::ShardedIntegerCollector', for
+// collecting and aggregating the values of a metric that is updated from many
+// threads simultaneously.  These classes provide the same interface, and
+// aggregate the same values (the count of events, and the total, minimum, and
+// maximum of the associated measurement), as 'balm::Collector' and
+// 'balm::IntegerCollector' respectively.  However, where those collectors
+// serialize each 'update' on a single mutex, the collectors in this component
+// spread updates across a fixed number ('k_NUM_SHARDS') of cache-line-sized
+// cells.  A thread updating a sharded collector is mapped (by a hash of its
+// thread id) to one of the cells, and updates that cell using atomic
+// operations only.  The cells are merged when the collector's value is loaded
+// (e.g., by 'balm::MetricsManager' when metrics are published).
+//
+// A sharded collector is significantly faster than its mutex-based
+// counterpart when a metric is updated concurrently by several threads, and
+// comparable when updated by a single thread.  In exchange, a sharded
+// collector has a considerably larger footprint (roughly 'k_NUM_SHARDS'
+// cache lines), and 'load' and 'loadAndReset' must visit every cell.
+//
+///Thread Safety
+///-------------
+// 'balm::ShardedCollector' and 'balm::ShardedIntegerCollector' are fully
+// *thread-safe*, meaning that all non-creator operations on a given instance
+// can be safely invoked simultaneously from multiple threads.  However,
+// unlike 'balm::Collector', the individual aggregates of a sharded collector
+// are not read and reset as a single atomic unit.  An 'update' that occurs
+// concurrently with a 'loadAndReset' is guaranteed to be counted exactly once,
+// but its contribution to the count may be reported in one publication
+// interval, and its contribution to the total, minimum, and maximum in the
+// next.  Similarly, 'setCountTotalMinMax' and 'reset' are not atomic with
+// respect to concurrent updates.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Collecting a Frequently Updated Metric
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example we create a 'balm::ShardedIntegerCollector',
+// update its value, and then collect a 'balm::MetricRecord'.
+//
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "MyMetric");
+//  balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::ShardedIntegerCollector' object for 'myMetric' and
+// use the 'update' method to update its collected value.  In practice,
+// 'update' would typically be invoked from many threads:
+//..
+//  balm::ShardedIntegerCollector collector(myMetric);
+//
+//  collector.update(1);
+//  collector.update(3);
+//..
+// The collector accumulated the values 1 and 3.  The result should have a
+// count of 2, a total of 4 (3 + 1), a max of 3 (max(3, 1)), and a min of 1
+// (min(3, 1)):
+//..
+//  balm::MetricRecord record;
+//  collector.loadAndReset(&record);
+//
+//      assert(myMetric == record.metricId());
+//      assert(2        == record.count());
+//      assert(4        == record.total());
+//      assert(1        == record.min());
+//      assert(3        == record.max());
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                        // ============================
+                        // struct ShardedCollector_Cell
+                        // ============================
+
+struct ShardedCollector_Cell {
+    // This implementation 'struct' holds the aggregated values of a single
+    // shard of a sharded collector, padded to occupy a whole cache line.  The
+    // interpretation of the 'd_total', 'd_min', and 'd_max' values (integer
+    // values, or the bit-patterns of 'double' values) is determined by the
+    // collector owning the cell.
+    //
+    // This type is an implementation detail and *must* *not* be used
+    // (directly) by clients outside of this component.
+
+    // TYPES
+    enum {
+        k_DATA_SIZE = 4 * sizeof(bsls::AtomicInt64),
+        k_PAD_SIZE  = bslmt::Platform::e_CACHE_LINE_SIZE > k_DATA_SIZE
+                    ? bslmt::Platform::e_CACHE_LINE_SIZE - k_DATA_SIZE
+                    : 1
+    };
+
+    // DATA
+    bsls::AtomicInt64 d_count;              // count of events
+    bsls::AtomicInt64 d_total;              // total across events
+    bsls::AtomicInt64 d_min;                // minimum across events
+    bsls::AtomicInt64 d_max;                // maximum across events
+    char              d_pad[k_PAD_SIZE];    // padding to a cache line
+};
+
+                        // ============================
+                        // struct ShardedCollector_Util
+                        // ============================
+
+struct ShardedCollector_Util {
+    // This 'struct' provides a namespace for utility functions used in the
+    // implementation of the sharded collectors in this component.
+    //
+    // This type is an implementation detail and *must* *not* be used
+    // (directly) by clients outside of this component.
+
+    // TYPES
+    enum {
+        k_LOG2_NUM_SHARDS = 4,                        // log2 of shard count
+        k_NUM_SHARDS      = 1 << k_LOG2_NUM_SHARDS,   // number of shards
+        k_CELLS_SIZE      = (k_NUM_SHARDS + 1) * sizeof(ShardedCollector_Cell)
+            // size of the raw buffer from which a cache-line aligned array of
+            // 'k_NUM_SHARDS' cells can be obtained
+    };
+
+    // CLASS METHODS
+    static ShardedCollector_Cell *alignCells(char *buffer);
+        // Return the address of the first cache-line aligned address in the
+        // specified 'buffer', having the size 'k_CELLS_SIZE'.
+
+    static int shardIndex();
+        // Return the index, in the range '[0 .. k_NUM_SHARDS)', of the shard
+        // assigned to the calling thread.  Note that the same index is always
+        // returned for a particular thread, and that distinct threads may be
+        // assigned the same index.
+
+    static double toDouble(bsls::Types::Int64 bits);
+        // Return the 'double' value whose representation is the specified
+        // 'bits'.
+
+    static bsls::Types::Int64 toBits(double value);
+        // Return the representation of the specified 'value'.
+};
+
+                           // ======================
+                           // class ShardedCollector
+                           // ======================
+
+class ShardedCollector {
+    // This class provides a mechanism for collecting and aggregating the
+    // value of a metric over a period of time, optimized for concurrent
+    // updates from many threads.  The collector contains a 'MetricId' object
+    // identifying the metric being collected, and, for each of 'k_NUM_SHARDS'
+    // shards, the number of times an event occurred, and the total, minimum,
+    // and maximum aggregates of the associated measurement value.  The
+    // default value for the count is 0, the default value for the total is
+    // 0.0, the default minimum value is 'MetricRecord::k_DEFAULT_MIN', and the
+    // default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
+
+    // PRIVATE TYPES
+    typedef ShardedCollector_Util Util;
+    typedef ShardedCollector_Cell Cell;
+
+    // DATA
+    MetricId                                d_metricId;  // metric identifier
+    bsls::AlignedBuffer<Util::k_CELLS_SIZE> d_buffer;    // cell storage
+    Cell                                   *d_cells_p;   // aligned cells
+
+    // NOT IMPLEMENTED
+    ShardedCollector(const ShardedCollector&);
+    ShardedCollector& operator=(const ShardedCollector&);
+
+  public:
+    // PUBLIC CONSTANTS
+    static const int k_NUM_SHARDS = Util::k_NUM_SHARDS;  // number of shards
+
+    // CREATORS
+    explicit ShardedCollector(const MetricId& metricId);
+        // Create a sharded collector for a metric having the specified
+        // 'metricId', and having an initial count of 0, total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', and max of
+        // 'MetricRecord::k_DEFAULT_MAX'.
+
+    ~ShardedCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum values of the metric
+        // being collected to their default states.  After this operation, the
+        // count and total values will be 0, the minimum value will be
+        // 'MetricRecord::k_DEFAULT_MIN', and the maximum value will be
+        // 'MetricRecord::k_DEFAULT_MAX'.
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric being
+        // collected as well as the current count, total, minimum, and maximum
+        // aggregated values for that metric (merged across all shards); then
+        // reset the count, total, minimum, and maximum values to their default
+        // states.  After this operation, the count and total values will be 0,
+        // the minimum value will be 'MetricRecord::k_DEFAULT_MIN', and the
+        // maximum value will be 'MetricRecord::k_DEFAULT_MAX'.
+
+    void update(double value);
+        // Increment the event count by 1, add the specified 'value' to the
+        // total, if 'value' is less than the minimum value, set 'value' to be
+        // the minimum value, and if 'value' is greater than the maximum
+        // value, set 'value' to be the maximum value.  Note that this
+        // operation does not acquire a lock.
+
+    void accumulateCountTotalMinMax(int    count,
+                                    double total,
+                                    double min,
+                                    double max);
+        // Increment the event count by the specified 'count', add the
+        // specified 'total' to the accumulated total, and if the specified
+        // 'min' is less than the minimum value, set 'min' to be the minimum
+        // value, and if the specified 'max' is greater than the maximum value,
+        // set 'max' to be the maximum value.
+
+    void setCountTotalMinMax(int count, double total, double min, double max);
+        // Set the event count to the specified 'count', the total aggregate to
+        // the specified 'total', the minimum aggregate to the specified 'min'
+        // and the maximum aggregate to the specified 'max'.
+
+    // ACCESSORS
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the current count, total, minimum, and
+        // maximum aggregated values for the metric (merged across all
+        // shards).
+};
+
+                       // =============================
+                       // class ShardedIntegerCollector
+                       // =============================
+
+class ShardedIntegerCollector {
+    // This class provides a mechanism for collecting and aggregating the
+    // value of an integer metric over a period of time, optimized for
+    // concurrent updates from many threads.  The collector contains a
+    // 'MetricId' object identifying the metric being collected, and, for each
+    // of 'k_NUM_SHARDS' shards, the number of times an event occurred, and
+    // the total, minimum, and maximum aggregates of the associated
+    // measurement value.  The default value for the count is 0, the default
+    // value for the total is 0, and the minimum and maximum have no value
+    // until the first event is recorded (and are loaded as
+    // 'MetricRecord::k_DEFAULT_MIN' and 'MetricRecord::k_DEFAULT_MAX'
+    // respectively).
+
+    // PRIVATE TYPES
+    typedef ShardedCollector_Util Util;
+    typedef ShardedCollector_Cell Cell;
+
+    // DATA
+    MetricId                                d_metricId;  // metric identifier
+    bsls::AlignedBuffer<Util::k_CELLS_SIZE> d_buffer;    // cell storage
+    Cell                                   *d_cells_p;   // aligned cells
+
+    // NOT IMPLEMENTED
+    ShardedIntegerCollector(const ShardedIntegerCollector&);
+    ShardedIntegerCollector& operator=(const ShardedIntegerCollector&);
+
+  public:
+    // PUBLIC CONSTANTS
+    static const int k_NUM_SHARDS = Util::k_NUM_SHARDS;  // number of shards
+
+    // CREATORS
+    explicit ShardedIntegerCollector(const MetricId& metricId);
+        // Create a sharded integer collector for a metric having the specified
+        // 'metricId', and having an initial count of 0, total of 0, and no
+        // minimum or maximum value.
+
+    ~ShardedIntegerCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum values of the metric
+        // being collected to their default states.
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric being
+        // collected as well as the current count, total, minimum, and maximum
+        // aggregated values for that metric (merged across all shards); then
+        // reset the count, total, minimum, and maximum values to their default
+        // states.  If no minimum (maximum) value has been recorded, load
+        // 'MetricRecord::k_DEFAULT_MIN' ('MetricRecord::k_DEFAULT_MAX') into
+        // 'record'.
+
+    void update(int value);
+        // Increment the event count by 1, add the specified 'value' to the
+        // total, if 'value' is less than the minimum value, set 'value' to be
+        // the minimum value, and if 'value' is greater than the maximum
+        // value, set 'value' to be the maximum value.  Note that this
+        // operation does not acquire a lock.
+
+    void accumulateCountTotalMinMax(int count, int total, int min, int max);
+        // Increment the event count by the specified 'count', add the
+        // specified 'total' to the accumulated total, and if the specified
+        // 'min' is less than the minimum value, set 'min' to be the minimum
+        // value, and if the specified 'max' is greater than the maximum value,
+        // set 'max' to be the maximum value.
+
+    void setCountTotalMinMax(int count, int total, int min, int max);
+        // Set the event count to the specified 'count', the total aggregate to
+        // the specified 'total', the minimum aggregate to the specified 'min'
+        // and the maximum aggregate to the specified 'max'.
+
+    // ACCESSORS
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the current count, total, minimum, and
+        // maximum aggregated values for the metric (merged across all
+        // shards).  If no minimum (maximum) value has been recorded, load
+        // 'MetricRecord::k_DEFAULT_MIN' ('MetricRecord::k_DEFAULT_MAX') into
+        // 'record'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct ShardedCollector_Util
+                        // ----------------------------
+
+// CLASS METHODS
+inline
+ShardedCollector_Cell *ShardedCollector_Util::alignCells(char *buffer)
+{
+    const bsls::Types::UintPtr mask  = bslmt::Platform::e_CACHE_LINE_SIZE - 1;
+    const bsls::Types::UintPtr value =
+                                reinterpret_cast<bsls::Types::UintPtr>(buffer);
+    return reinterpret_cast<ShardedCollector_Cell *>((value + mask) & ~mask);
+}
+
+inline
+int ShardedCollector_Util::shardIndex()
+{
+    // Fibonacci hashing of the thread id: thread ids are frequently aligned
+    // addresses, so the high-order bits of the product are used.
+
+    const bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    return static_cast<int>((id * 0x9E3779B97F4A7C15ULL)
+                                                  >> (64 - k_LOG2_NUM_SHARDS));
+}
+
+inline
+double ShardedCollector_Util::toDouble(bsls::Types::Int64 bits)
+{
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+inline
+bsls::Types::Int64 ShardedCollector_Util::toBits(double value)
+{
+    bsls::Types::Int64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+                           // ----------------------
+                           // class ShardedCollector
+                           // ----------------------
+
+// CREATORS
+inline
+ShardedCollector::~ShardedCollector()
+{
+}
+
+// MANIPULATORS
+inline
+void ShardedCollector::update(double value)
+{
+    Cell& cell = d_cells_p[Util::shardIndex()];
+
+    cell.d_count.addRelaxed(1);
+
+    bsls::Types::Int64 bits = cell.d_total.loadRelaxed();
+    for (;;) {
+        const bsls::Types::Int64 newBits =
+                                  Util::toBits(Util::toDouble(bits) + value);
+        const bsls::Types::Int64 prev = cell.d_total.testAndSwap(bits,
+                                                                 newBits);
+        if (prev == bits) {
+            break;
+        }
+        bits = prev;
+    }
+
+    bits = cell.d_min.loadRelaxed();
+    while (value < Util::toDouble(bits)) {
+        const bsls::Types::Int64 prev =
+                      cell.d_min.testAndSwap(bits, Util::toBits(value));
+        if (prev == bits) {
+            break;
+        }
+        bits = prev;
+    }
+
+    bits = cell.d_max.loadRelaxed();
+    while (value > Util::toDouble(bits)) {
+        const bsls::Types::Int64 prev =
+                      cell.d_max.testAndSwap(bits, Util::toBits(value));
+        if (prev == bits) {
+            break;
+        }
+        bits = prev;
+    }
+}
+
+// ACCESSORS
+inline
+const MetricId& ShardedCollector::metricId() const
+{
+    return d_metricId;
+}
+
+                       // -----------------------------
+                       // class ShardedIntegerCollector
+                       // -----------------------------
+
+// CREATORS
+inline
+ShardedIntegerCollector::~ShardedIntegerCollector()
+{
+}
+
+// MANIPULATORS
+inline
+void ShardedIntegerCollector::update(int value)
+{
+    Cell& cell = d_cells_p[Util::shardIndex()];
+
+    cell.d_count.addRelaxed(1);
+    cell.d_total.addRelaxed(value);
+
+    bsls::Types::Int64 current = cell.d_min.loadRelaxed();
+    while (value < current) {
+        const bsls::Types::Int64 prev = cell.d_min.testAndSwap(current,
+                                                               value);
+        if (prev == current) {
+            break;
+        }
+        current = prev;
+    }
+
+    current = cell.d_max.loadRelaxed();
+    while (value > current) {
+        const bsls::Types::Int64 prev = cell.d_max.testAndSwap(current,
+                                                               value);
+        if (prev == current) {
+            break;
+        }
+        current = prev;
+    }
+}
+
+// ACCESSORS
+inline
+const MetricId& ShardedIntegerCollector::metricId() const
+{
+    return d_metricId;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,608 @@
+// balm_shardedcollector.t.cpp                                        -*-C++-*-
+#include <balm_shardedcollector.h>
+
+#include <balm_category.h>
+#include <balm_collector.h>
+#include <balm_integercollector.h>
+#include <balm_metricdescription.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The 'balm::ShardedCollector' and 'balm::ShardedIntegerCollector' are
+// mechanisms for collecting and recording aggregated metric values.  Ensure
+// values can be accumulated into and read out of the container, that values
+// recorded by different threads (and therefore, in general, different shards)
+// are merged correctly, and that the operations are thread safe.
+// ----------------------------------------------------------------------------
+// balm::ShardedCollector
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] balm::ShardedCollector(const balm::MetricId& metricId);
+// [ 2] ~balm::ShardedCollector();
+//
+// MANIPULATORS
+// [ 4] void reset();
+// [ 4] void loadAndReset(balm::MetricRecord *record);
+// [ 2] void update(double value);
+// [ 3] void accumulateCountTotalMinMax(int, double, double, double);
+// [ 3] void setCountTotalMinMax(int, double, double, double);
+//
+// ACCESSORS
+// [ 2] const balm::MetricId& metricId() const;
+// [ 2] void load(balm::MetricRecord *record) const;
+// ----------------------------------------------------------------------------
+// balm::ShardedIntegerCollector
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] balm::ShardedIntegerCollector(const balm::MetricId& metricId);
+// [ 2] ~balm::ShardedIntegerCollector();
+//
+// MANIPULATORS
+// [ 4] void reset();
+// [ 4] void loadAndReset(balm::MetricRecord *record);
+// [ 2] void update(int value);
+// [ 3] void accumulateCountTotalMinMax(int, int, int, int);
+// [ 3] void setCountTotalMinMax(int, int, int, int);
+//
+// ACCESSORS
+// [ 2] const balm::MetricId& metricId() const;
+// [ 2] void load(balm::MetricRecord *record) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+// [-1] UPDATE THROUGHPUT: MUTEX VS. SHARDED COLLECTORS
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::ShardedCollector        Obj;
+typedef balm::ShardedIntegerCollector IObj;
+typedef balm::MetricRecord            Rec;
+typedef balm::MetricDescription       Desc;
+typedef balm::MetricId                Id;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class COLLECTOR>
+void updateCollector(COLLECTOR       *collector,
+                     bslmt::Barrier  *barrier,
+                     int              numIterations,
+                     int              threadIndex)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // the specified 'numIterations' times with values in the range
+    // '[-threadIndex .. threadIndex]', where 'threadIndex' is specified.
+{
+    barrier->wait();
+    for (int i = 0; i < numIterations; ++i) {
+        collector->update(0 == i % 2 ? threadIndex : -threadIndex);
+    }
+}
+
+template <class COLLECTOR>
+double runThroughputTest(COLLECTOR *collector,
+                         int        numThreads,
+                         int        numIterations)
+    // Update the specified 'collector' the specified 'numIterations' times
+    // from each of the specified 'numThreads' threads, and return the elapsed
+    // wall time, in seconds.
+{
+    bslmt::Barrier                       barrier(numThreads + 1);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    for (int i = 0; i < numThreads; ++i) {
+        int rc = bslmt::ThreadUtil::create(
+                             &handles[i],
+                             bdlf::BindUtil::bind(&updateCollector<COLLECTOR>,
+                                                  collector,
+                                                  &barrier,
+                                                  numIterations,
+                                                  i + 1));
+        ASSERT(0 == rc);
+    }
+
+    bsls::Stopwatch timer;
+    timer.start();
+    barrier.wait();
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+    Desc desc_B(&cat_A, "B"); const Desc *DESC_B = &desc_B;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+    Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Example 1: Collecting a Frequently Updated Metric
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// In the following example we create a 'balm::ShardedIntegerCollector',
+// update its value, and then collect a 'balm::MetricRecord'.
+//
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "MyMetric");
+    balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::ShardedIntegerCollector' object for 'myMetric' and
+// use the 'update' method to update its collected value.  In practice,
+// 'update' would typically be invoked from many threads:
+//..
+    balm::ShardedIntegerCollector collector(myMetric);
+
+    collector.update(1);
+    collector.update(3);
+//..
+// The collector accumulated the values 1 and 3.  The result should have a
+// count of 2, a total of 4 (3 + 1), a max of 3 (max(3, 1)), and a min of 1
+// (min(3, 1)):
+//..
+    balm::MetricRecord record;
+    collector.loadAndReset(&record);
+
+        ASSERT(myMetric == record.metricId());
+        ASSERT(2        == record.count());
+        ASSERT(4        == record.total());
+        ASSERT(1        == record.min());
+        ASSERT(3        == record.max());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Updates from multiple threads, which are (in general) recorded
+        //:   in different shards, are each counted exactly once.
+        //:
+        //: 2 The minimum and maximum are merged across shards.
+        //
+        // Plan:
+        //: 1 Update a collector of each type from a number of threads, each
+        //:   thread recording a distinct range of values, and verify the
+        //:   merged count, total, minimum, and maximum.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY TEST" << endl
+                                  << "================" << endl;
+
+        const int NUM_THREADS    = 8;
+        const int NUM_ITERATIONS = 10000;
+
+        {
+            Obj mX(METRIC_A); const Obj& X = mX;
+            runThroughputTest(&mX, NUM_THREADS, NUM_ITERATIONS);
+
+            Rec r;
+            X.load(&r);
+            ASSERTV(r.count(), NUM_THREADS * NUM_ITERATIONS == r.count());
+            ASSERTV(r.total(), 0.0 == r.total());
+            ASSERTV(r.min(), -NUM_THREADS == r.min());
+            ASSERTV(r.max(),  NUM_THREADS == r.max());
+        }
+        {
+            IObj mX(METRIC_A); const IObj& X = mX;
+            runThroughputTest(&mX, NUM_THREADS, NUM_ITERATIONS);
+
+            Rec r;
+            X.load(&r);
+            ASSERTV(r.count(), NUM_THREADS * NUM_ITERATIONS == r.count());
+            ASSERTV(r.total(), 0.0 == r.total());
+            ASSERTV(r.min(), -NUM_THREADS == r.min());
+            ASSERTV(r.max(),  NUM_THREADS == r.max());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS: 'reset' and 'loadAndReset'
+        //
+        // Concerns:
+        //: 1 'loadAndReset' loads the merged value of all shards, and leaves
+        //:   the collector in its default state.
+        //:
+        //: 2 'reset' leaves the collector in its default state.
+        //
+        // Plan:
+        //: 1 Set values on the collectors, then verify 'loadAndReset' and
+        //:   'reset'.  (C-1..2)
+        //
+        // Testing:
+        //   void reset();
+        //   void loadAndReset(balm::MetricRecord *record);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'reset' AND 'loadAndReset'"
+                          << endl << "==================================="
+                          << endl;
+
+        const Rec EMPTY(METRIC_B);
+        {
+            Obj mX(METRIC_B); const Obj& X = mX;
+            Rec r;
+
+            mX.update(2.5);
+            mX.update(-1.5);
+            mX.loadAndReset(&r);
+            ASSERT(Rec(METRIC_B, 2, 1.0, -1.5, 2.5) == r);
+
+            X.load(&r);
+            ASSERTV(r, EMPTY == r);
+
+            mX.update(7);
+            mX.reset();
+            X.load(&r);
+            ASSERTV(r, EMPTY == r);
+        }
+        {
+            IObj mX(METRIC_B); const IObj& X = mX;
+            Rec r;
+
+            mX.update(2);
+            mX.update(-1);
+            mX.loadAndReset(&r);
+            ASSERT(Rec(METRIC_B, 2, 1.0, -1.0, 2.0) == r);
+
+            X.load(&r);
+            ASSERTV(r, EMPTY == r);
+
+            mX.update(INT_MAX);
+            mX.update(INT_MIN);
+            mX.loadAndReset(&r);
+            ASSERT(Rec(METRIC_B, 2, -1.0, INT_MIN, INT_MAX) == r);
+
+            mX.update(7);
+            mX.reset();
+            X.load(&r);
+            ASSERTV(r, EMPTY == r);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS: 'accumulateCountTotalMinMax' and
+        // 'setCountTotalMinMax'
+        //
+        // Concerns:
+        //: 1 'accumulateCountTotalMinMax' combines the supplied values with
+        //:   the collected values.
+        //:
+        //: 2 'setCountTotalMinMax' replaces the values of all shards.
+        //
+        // Plan:
+        //: 1 Apply a sequence of operations and verify the loaded values.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   void accumulateCountTotalMinMax(int, double, double, double);
+        //   void setCountTotalMinMax(int, double, double, double);
+        //   void accumulateCountTotalMinMax(int, int, int, int);
+        //   void setCountTotalMinMax(int, int, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'accumulate' AND 'setCountTotalMinMax'"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        {
+            Obj mX(METRIC_A); const Obj& X = mX;
+            Rec r;
+
+            mX.update(1.0);
+            mX.accumulateCountTotalMinMax(3, 6.0, -1.0, 4.0);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 4, 7.0, -1.0, 4.0) == r);
+
+            mX.setCountTotalMinMax(2, 3.0, 1.0, 2.0);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 2, 3.0, 1.0, 2.0) == r);
+        }
+        {
+            IObj mX(METRIC_A); const IObj& X = mX;
+            Rec r;
+
+            mX.update(1);
+            mX.accumulateCountTotalMinMax(3, 6, -1, 4);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 4, 7.0, -1.0, 4.0) == r);
+
+            mX.setCountTotalMinMax(2, 3, 1, 2);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 2, 3.0, 1.0, 2.0) == r);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATOR AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A newly created collector has the default value.
+        //:
+        //: 2 'update' accumulates the count, total, minimum, and maximum.
+        //:
+        //: 3 'metricId' returns the id supplied at construction.
+        //
+        // Plan:
+        //: 1 Create collectors, update them with a sequence of values, and
+        //:   verify the loaded values after each update.  (C-1..3)
+        //
+        // Testing:
+        //   balm::ShardedCollector(const balm::MetricId& metricId);
+        //   ~balm::ShardedCollector();
+        //   void update(double value);
+        //   const balm::MetricId& metricId() const;
+        //   void load(balm::MetricRecord *record) const;
+        //   balm::ShardedIntegerCollector(const balm::MetricId& metricId);
+        //   ~balm::ShardedIntegerCollector();
+        //   void update(int value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'update' AND 'load'" << endl
+                                  << "===========================" << endl;
+
+        {
+            Obj mX(METRIC_A); const Obj& X = mX;
+            Rec r;
+
+            ASSERT(METRIC_A == X.metricId());
+            X.load(&r);
+            ASSERT(Rec(METRIC_A) == r);
+
+            mX.update(1.5);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 1, 1.5, 1.5, 1.5) == r);
+
+            mX.update(-2.5);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 2, -1.0, -2.5, 1.5) == r);
+
+            mX.update(4.0);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 3, 3.0, -2.5, 4.0) == r);
+        }
+        {
+            IObj mX(METRIC_A); const IObj& X = mX;
+            Rec r;
+
+            ASSERT(METRIC_A == X.metricId());
+            X.load(&r);
+            ASSERT(Rec(METRIC_A) == r);
+
+            mX.update(1);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 1, 1.0, 1.0, 1.0) == r);
+
+            mX.update(-2);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 2, -1.0, -2.0, 1.0) == r);
+
+            mX.update(4);
+            X.load(&r);
+            ASSERT(Rec(METRIC_A, 3, 3.0, -2.0, 4.0) == r);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Exercise the basic functionality of both collectors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        Obj  mX(METRIC_A);
+        IObj mY(METRIC_B);
+
+        mX.update(1.0);
+        mX.update(2.0);
+        mY.update(3);
+
+        Rec r;
+        mX.loadAndReset(&r);
+        ASSERT(Rec(METRIC_A, 2, 3.0, 1.0, 2.0) == r);
+        mY.loadAndReset(&r);
+        ASSERT(Rec(METRIC_B, 1, 3.0, 3.0, 3.0) == r);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // UPDATE THROUGHPUT: MUTEX VS. SHARDED COLLECTORS
+        //
+        // Concerns:
+        //: 1 Compare the throughput of 'update' on the mutex-based
+        //:   'balm::Collector' and 'balm::IntegerCollector' with that of the
+        //:   sharded collectors, for an increasing number of threads.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, ..., 32 threads, update a single collector of each
+        //:   type from all threads and report the number of updates per
+        //:   second.  The 3rd command line argument, if supplied, is the
+        //:   number of updates per thread.
+        //
+        // Testing:
+        //   UPDATE THROUGHPUT: MUTEX VS. SHARDED COLLECTORS
+        // --------------------------------------------------------------------
+
+        cout << endl << "UPDATE THROUGHPUT: MUTEX VS. SHARDED COLLECTORS"
+             << endl << "==============================================="
+             << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        for (int numThreads = 1; numThreads <= 32; numThreads *= 2) {
+            const double TOTAL = static_cast<double>(numThreads) *
+                                                                NUM_ITERATIONS;
+
+            balm::Collector        c(METRIC_A);
+            balm::IntegerCollector ic(METRIC_A);
+            Obj                    sc(METRIC_A);
+            IObj                   sic(METRIC_A);
+
+            const double cTime   = runThroughputTest(&c,
+                                                     numThreads,
+                                                     NUM_ITERATIONS);
+            const double icTime  = runThroughputTest(&ic,
+                                                     numThreads,
+                                                     NUM_ITERATIONS);
+            const double scTime  = runThroughputTest(&sc,
+                                                     numThreads,
+                                                     NUM_ITERATIONS);
+            const double sicTime = runThroughputTest(&sic,
+                                                     numThreads,
+                                                     NUM_ITERATIONS);
+
+            cout << "threads: "           << numThreads
+                 << "\tCollector: "       << TOTAL / cTime   << "/s"
+                 << "\tShardedCollector: " << TOTAL / scTime  << "/s"
+                 << "\tIntegerCollector: " << TOTAL / icTime  << "/s"
+                 << "\tShardedIntegerCollector: "
+                 << TOTAL / sicTime << "/s" << endl;
+
+            if (veryVerbose) {
+                Rec r;
+                sic.load(&r);
+                P(r);
+            }
+        }
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -103,6 +103,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlat_valuetypefunctions.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_iterator.h>
 
 #include <bsls_assert.h>
@@ -161,6 +162,14 @@ class Base64Parser {
         // 'INPUT_ITERATOR' must be dereferenceable to a 'char' value.  The
         // behavior is undefined unless an object is associated with this
         // parser.
+
+    int pushCharacters(const char *begin, const char *end);
+        // Push the characters ranging from the specified 'begin' up to (but
+        // not including) the specified 'end' into this parser.  Return 0 if
+        // successful and non-zero otherwise.  The behavior is undefined
+        // unless an object is associated with this parser.  Note that this
+        // overload decodes the characters directly into the associated
+        // object, in bulk, rather than appending one byte at a time.
 };
 
 // ============================================================================
@@ -239,6 +248,42 @@ int Base64Parser<TYPE>::pushCharacters(INPUT_ITERATOR begin,
     return k_SUCCESS;
 }
 
+template <class TYPE>
+int Base64Parser<TYPE>::pushCharacters(const char *begin, const char *end)
+{
+    BSLS_ASSERT(d_object_p);
+    BSLS_ASSERT(begin <= end);
+
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    // Grow the object by the maximum decoded length and decode into it (using
+    // pointers, for both supported types, so that the decoder converts
+    // complete groups in bulk), then trim it to the decoded length.
+
+    const bsl::size_t size = d_object_p->size();
+
+    d_object_p->resize(size + bdlde::Base64Decoder::maxDecodedLength(
+                                              static_cast<int>(end - begin)));
+
+    int numOut;
+    int numIn;
+    int status = d_base64Decoder.convert(d_object_p->begin() + size,
+                                         &numOut,
+                                         &numIn,
+                                         begin,
+                                         end);
+
+    d_object_p->resize(size + numOut);
+
+    if (0 > status) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    BSLS_ASSERT(0 == status);  // nothing should be retained by decoder
+
+    return k_SUCCESS;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
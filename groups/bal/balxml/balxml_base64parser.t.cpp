@@ -5,15 +5,20 @@
 
 #include <bdlb_printmethods.h>
 
+#include <bdlde_base64encoder.h>
+
 #include <bsls_review.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
+#include <bsl_deque.h>
 #include <bsl_iostream.h>
 #include <bsl_istream.h>
 #include <bsl_iterator.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 using namespace BloombergLP;
@@ -370,6 +375,40 @@ void printValue(bsl::ostream& out, const char& value)
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
 
+// ============================================================================
+//                            HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+template <class TYPE, class INPUT>
+bsl::vector<int> parseInChunks(TYPE         *result,
+                               const INPUT&  input,
+                               bsl::size_t   chunkSize)
+    // Parse the specified 'input' into the specified 'result', pushing at
+    // most the specified 'chunkSize' characters at a time through iterators
+    // of 'INPUT', and return the status of each call to 'pushCharacters'
+    // (stopping after the first failure) followed by that of 'endParse'.
+{
+    balxml::Base64Parser<TYPE> parser;
+    bsl::vector<int>           statuses;
+
+    ASSERT(0 == parser.beginParse(result));
+
+    typename INPUT::const_iterator begin = input.begin();
+    for (bsl::size_t i = 0; i < input.size(); i += chunkSize) {
+        const bsl::size_t              length = bsl::min(chunkSize,
+                                                         input.size() - i);
+        typename INPUT::const_iterator end    = begin + length;
+
+        statuses.push_back(parser.pushCharacters(begin, end));
+        if (0 != statuses.back()) {
+            return statuses;                                          // RETURN
+        }
+        begin = end;
+    }
+    statuses.push_back(parser.endParse());
+    return statuses;
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -447,7 +486,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -461,6 +500,115 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING BULK 'pushCharacters'
+        //
+        // Concerns:
+        //: 1 'pushCharacters' on 'const char *' ranges (which decodes in bulk
+        //:   directly into the associated object) produces the same result
+        //:   and statuses as on other iterators, for both supported types,
+        //:   for any split of the input into pushes, with and without line
+        //:   breaks, and for invalid input.
+        //
+        // Plan:
+        //: 1 For a set of encodings of pseudo-random data of various lengths,
+        //:   with lines of 76 characters and without line breaks, and each
+        //:   with an unrecognized character inserted in its middle, parse
+        //:   each encoding in chunks of various sizes into a 'bsl::string'
+        //:   and a 'bsl::vector<char>' using 'const char *' ranges, and into
+        //:   a 'bsl::vector<char>' using 'bsl::deque<char>' iterators, and
+        //:   verify that the statuses and results are identical.  (C-1)
+        //
+        // Testing:
+        //   int pushCharacters(const char *begin, const char *end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BULK 'pushCharacters'"
+                          << "\n=============================" << endl;
+
+        const int LENGTHS[]   = { 0, 1, 2, 3, 57, 100, 1000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int LINE_LENGTHS[]   = { 0, 76 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                                        / sizeof *LINE_LENGTHS;
+
+        const bsl::size_t CHUNKS[]   = { 1, 3, 4, 7, 64, 10000 };
+        const int         NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            bsl::string data(LENGTH, '\0');
+            for (int i = 0; i < LENGTH; ++i) {
+                data[i] = static_cast<char>(i * 37 + LENGTH);
+            }
+
+            for (int tj = 0; tj < NUM_LINE_LENGTHS; ++tj) {
+                const int LINE_LENGTH = LINE_LENGTHS[tj];
+
+                bsl::string encoded(bdlde::Base64Encoder::encodedLength(
+                                                                  LENGTH,
+                                                                  LINE_LENGTH),
+                                    '\0');
+                bdlde::Base64Encoder::encode(&encoded[0],
+                                             data.data(),
+                                             data.data() + LENGTH,
+                                             LINE_LENGTH);
+
+                for (int corrupt = 0; corrupt < 2; ++corrupt) {
+                    bsl::string input(encoded);
+                    if (corrupt) {
+                        input.insert(input.size() / 2, 1, '!');
+                    }
+                    const bsl::deque<char> INPUT_DEQUE(input.begin(),
+                                                       input.end());
+
+                    for (int tk = 0; tk < NUM_CHUNKS; ++tk) {
+                        const bsl::size_t CHUNK = CHUNKS[tk];
+
+                        if (veryVerbose) {
+                            T_ P_(LENGTH) P_(LINE_LENGTH) P_(corrupt) P(CHUNK)
+                        }
+
+                        bsl::vector<char> expected;
+                        bsl::vector<char> vector;
+                        bsl::string       string;
+
+                        const bsl::vector<int> EXP_STATUSES =
+                                parseInChunks(&expected, INPUT_DEQUE, CHUNK);
+
+                        const bsl::vector<int> VECTOR_STATUSES =
+                                        parseInChunks(&vector, input, CHUNK);
+                        const bsl::vector<int> STRING_STATUSES =
+                                        parseInChunks(&string, input, CHUNK);
+
+                        LOOP4_ASSERT(LENGTH, LINE_LENGTH, corrupt, CHUNK,
+                                     EXP_STATUSES == VECTOR_STATUSES);
+                        LOOP4_ASSERT(LENGTH, LINE_LENGTH, corrupt, CHUNK,
+                                     EXP_STATUSES == STRING_STATUSES);
+                        LOOP4_ASSERT(LENGTH, LINE_LENGTH, corrupt, CHUNK,
+                                     expected == vector);
+                        LOOP4_ASSERT(LENGTH, LINE_LENGTH, corrupt, CHUNK,
+                                     bsl::string(expected.begin(),
+                                                 expected.end()) == string);
+
+                        if (!corrupt) {
+                            LOOP3_ASSERT(LENGTH, LINE_LENGTH, CHUNK,
+                                         0 == EXP_STATUSES.back());
+                            LOOP3_ASSERT(LENGTH, LINE_LENGTH, CHUNK,
+                                         data == string);
+                        }
+                        else {
+                            LOOP3_ASSERT(LENGTH, LINE_LENGTH, CHUNK,
+                                         0 != EXP_STATUSES.back());
+                        }
+                    }
+                }
+            }
+        }
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // THOROUGH TEST
@@ -17,6 +17,8 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 #include <balxml_base64parser.h>
 #include <balxml_hexparser.h>
 
+#include <bdlb_numericparseutil.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bdldfp_decimalutil.h>
@@ -125,6 +127,18 @@ int parseDoubleImpl(double *result, const char *input, bool formatDecimal)
         break;
     } // End switch
 
+    // Most numbers are converted by the locale-independent fast path, which
+    // fails (rather than reporting an out-of-range value) for any text it
+    // does not handle; 'strtod' is used for the rest.
+
+    bslstl::StringRef remainder;
+
+    if (0 == bdlb::NumericParseUtil::parseDoubleFast(result,
+                                                     &remainder,
+                                                     input)) {
+        return remainder.empty() ? BAEXML_SUCCESS : BAEXML_FAILURE;   // RETURN
+    }
+
     char *end = 0;
     errno = 0;
     *result = bsl::strtod(input, &end);
@@ -12,6 +12,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 
+#include <bdlb_numericformatutil.h>
 #include <bdlb_print.h>
 #include <bdlde_base64encoder.h>
 #include <bdldfp_decimalutil.h>
@@ -32,32 +33,38 @@ namespace {
 
 // HELPER FUNCTIONS
 
-template <class INPUT_ITERATOR>
 bsl::ostream& encodeBase64(bsl::ostream&  stream,
-                           INPUT_ITERATOR begin,
-                           INPUT_ITERATOR end)
+                           const char    *begin,
+                           const char    *end)
     // Write the base64 encoding of the character sequence defined by the
-    // specified 'begin' and 'end' iterators into the specified 'stream' and
-    // return 'stream'.  Each instantiation of this private function is called
-    // only once (by the functions below) and can thus be inlined without
-    // causing code bloat.
+    // specified 'begin' and 'end' pointers into the specified 'stream' and
+    // return 'stream'.
 {
-    bdlde::Base64Encoder base64Encoder(0);  // 0 means do not insert CRLF
+    // The input is encoded (in bulk) in chunks whose length is a multiple of
+    // 3, so that the encodings of consecutive chunks concatenate without
+    // padding, through a local buffer written to 'stream' in a single call.
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    enum {
+        k_CHUNK_LENGTH  = 768,
+        k_BUFFER_LENGTH = k_CHUNK_LENGTH / 3 * 4
+    };
 
-        int status = base64Encoder.convert(outputIterator, begin, end);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
-    }
+    char buffer[k_BUFFER_LENGTH];
 
-    {
-        bsl::ostreambuf_iterator<char> outputIterator(stream);
+    while (end - begin > k_CHUNK_LENGTH) {
+        const int numOut = bdlde::Base64Encoder::encode(buffer,
+                                                        begin,
+                                                        begin + k_CHUNK_LENGTH,
+                                                        0);
+        BSLS_ASSERT(k_BUFFER_LENGTH == numOut);
 
-        int status = base64Encoder.endConvert(outputIterator);
-        (void)status; BSLS_ASSERT(0 == status);  // nothing should be retained
+        stream.write(buffer, numOut);
+        begin += k_CHUNK_LENGTH;
     }
 
+    const int numOut = bdlde::Base64Encoder::encode(buffer, begin, end, 0);
+    stream.write(buffer, numOut);
+
     return stream;
 }
 
@@ -739,7 +746,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return encodeBase64(stream, object.begin(), object.end());
+    return encodeBase64(stream, object.data(), object.data() + object.size());
 }
 
 bsl::ostream&
@@ -749,7 +756,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&               stream,
                                 bdlat_TypeCategory::Simple)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return encodeBase64(stream, object.begin(), object.end());
+    return encodeBase64(stream, object.data(), object.data() + object.size());
 }
 
 bsl::ostream&
@@ -759,7 +766,7 @@ TypesPrintUtil_Imp::printBase64(bsl::ostream&              stream,
                                 bdlat_TypeCategory::Array)
 {
     // Calls a function in the unnamed namespace.  Cannot be inlined.
-    return encodeBase64(stream, object.begin(), object.end());
+    return encodeBase64(stream, object.data(), object.data() + object.size());
 }
 
 // HEX FUNCTIONS
@@ -928,24 +935,21 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
-
-        char buffer[FLT_DIG + 20];  // buffer with headroom
+        // Write the shortest text that round-trips, using fixed or scientific
+        // notation as '%.*g' does at a precision of 'FLT_DIG + 1' (the
+        // precision formerly passed to 'sprintf') if that many digits
+        // suffice.  Note that, as 'FLT_DIG + 1' exceeds the number of digits
+        // that every 'float' preserves, the digits may differ from those
+        // written by 'sprintf', which may include one that is not needed.
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
+        char buffer[bdlb::NumericFormatUtil::k_FLOAT_BUFFER_SIZE];
 
-        const int len =
-                    bsl::sprintf(buffer, "%.*g", FLT_DIG + 1, (double) object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        int len = bdlb::NumericFormatUtil::formatShortest(buffer,
+                                                          object,
+                                                          FLT_DIG + 1);
+        if (0 == len) {
+            len = bdlb::NumericFormatUtil::formatShortest(buffer, object);
+        }
 
         stream.write(buffer, len);
       } break;
@@ -974,23 +978,22 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
-
-        char buffer[DBL_DIG + 20];  // buffer with headroom
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len = bsl::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        // Write the shortest text that round-trips, using fixed or scientific
+        // notation as '%.*g' does at a precision of 'DBL_DIG + 1' (the
+        // precision formerly passed to 'sprintf') if that many digits
+        // suffice.  Note that, as 'DBL_DIG + 1' exceeds the number of digits
+        // that every 'double' preserves, 'sprintf' may have written a digit
+        // that is not needed to round-trip (e.g., "9.694867473874471" for the
+        // 'double' closest to 9.69486747387447), which is omitted here.
+
+        char buffer[bdlb::NumericFormatUtil::k_DOUBLE_BUFFER_SIZE];
+
+        int len = bdlb::NumericFormatUtil::formatShortest(buffer,
+                                                          object,
+                                                          DBL_DIG + 1);
+        if (0 == len) {
+            len = bdlb::NumericFormatUtil::formatShortest(buffer, object);
+        }
 
         stream.write(buffer, len);
       } break;
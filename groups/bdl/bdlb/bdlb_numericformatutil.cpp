@@ -0,0 +1,690 @@
+// bdlb_numericformatutil.cpp                                         -*-C++-*-
+#include <bdlb_numericformatutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlb_numericformatutil_cpp, "$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+
+///Implementation Notes
+///--------------------
+// The implementation follows Grisu2 as described by Loitsch (see
+// {Algorithm}).  A floating point value 'v' is represented as a "do-it-
+// yourself" floating point number, 'DiyFp', having a 64-bit significand 'f'
+// and a binary exponent 'e', so that 'v == f * 2^e'.  The boundaries 'm-' and
+// 'm+' of the rounding interval of 'v' (the midpoints between 'v' and its
+// neighbors) are computed exactly, normalized, and multiplied by a cached
+// power of ten, 'c ~= 10^-K', chosen so that the binary exponent of the
+// scaled boundaries lies in '[-60 .. -32]'.  The integral part of the scaled
+// upper boundary then fits in 32 bits, and digits are generated from it (and
+// then from its fractional part) until the remainder falls within the scaled
+// (and conservatively narrowed) interval.  Finally, the last digit is
+// adjusted toward the scaled 'v' while the result remains in the interval.
+//
+// The cached powers are the 64-bit significands (correctly rounded) of
+// '10^k' for 'k' in '[-348 .. 340]' in steps of 8; the table is stored as
+// pairs of 32-bit halves to avoid relying on 64-bit integer literals.
+
+namespace BloombergLP {
+namespace bdlb {
+
+namespace {
+
+typedef bsls::Types::Uint64 Uint64;
+
+                               // ===========
+                               // class DiyFp
+                               // ===========
+
+struct DiyFp {
+    // This 'struct' represents the value 'd_f * 2^d_e'.
+
+    // DATA
+    Uint64 d_f;  // significand
+    int    d_e;  // binary exponent
+};
+
+inline
+DiyFp makeDiyFp(Uint64 f, int e)
+    // Return the 'DiyFp' having the specified significand 'f' and the
+    // specified binary exponent 'e'.
+{
+    DiyFp result;
+    result.d_f = f;
+    result.d_e = e;
+    return result;
+}
+
+inline
+DiyFp multiply(const DiyFp& lhs, const DiyFp& rhs)
+    // Return the product of the specified 'lhs' and 'rhs', keeping the most
+    // significant 64 bits of the 128-bit product of the significands, rounded
+    // to nearest.
+{
+    const Uint64 k_MASK = 0xffffffffu;
+
+    const Uint64 a = lhs.d_f >> 32;
+    const Uint64 b = lhs.d_f & k_MASK;
+    const Uint64 c = rhs.d_f >> 32;
+    const Uint64 d = rhs.d_f & k_MASK;
+
+    const Uint64 ac = a * c;
+    const Uint64 bc = b * c;
+    const Uint64 ad = a * d;
+    const Uint64 bd = b * d;
+
+    Uint64 tmp = (bd >> 32) + (ad & k_MASK) + (bc & k_MASK);
+    tmp += 1u << 31;  // round
+
+    return makeDiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32),
+                     lhs.d_e + rhs.d_e + 64);
+}
+
+inline
+DiyFp normalize(const DiyFp& value)
+    // Return the specified 'value' shifted so that the most significant bit
+    // of its significand is set.  The behavior is undefined unless
+    // '0 != value.d_f'.
+{
+    const int shift = BitUtil::numLeadingUnsetBits(
+                                   static_cast<BitUtil::uint64_t>(value.d_f));
+    return makeDiyFp(value.d_f << shift, value.d_e - shift);
+}
+
+                           // ==================
+                           // struct CachedPower
+                           // ==================
+
+struct CachedPower {
+    // This 'struct' holds the normalized 64-bit approximation,
+    // 'significand * 2^d_binaryExponent', of '10^d_decimalExponent'.
+
+    // DATA
+    unsigned int d_significandHi;    // upper 32 bits of the significand
+    unsigned int d_significandLo;    // lower 32 bits of the significand
+    short        d_binaryExponent;   // binary exponent
+    short        d_decimalExponent;  // decimal exponent
+};
+
+const CachedPower k_CACHED_POWERS[] = {
+    { 0xfa8fd5a0, 0x081c0288, -1220, -348 },  // 1e-348
+    { 0xbaaee17f, 0xa23ebf76, -1193, -340 },  // 1e-340
+    { 0x8b16fb20, 0x3055ac76, -1166, -332 },  // 1e-332
+    { 0xcf42894a, 0x5dce35ea, -1140, -324 },  // 1e-324
+    { 0x9a6bb0aa, 0x55653b2d, -1113, -316 },  // 1e-316
+    { 0xe61acf03, 0x3d1a45df, -1087, -308 },  // 1e-308
+    { 0xab70fe17, 0xc79ac6ca, -1060, -300 },  // 1e-300
+    { 0xff77b1fc, 0xbebcdc4f, -1034, -292 },  // 1e-292
+    { 0xbe5691ef, 0x416bd60c, -1007, -284 },  // 1e-284
+    { 0x8dd01fad, 0x907ffc3c,  -980, -276 },  // 1e-276
+    { 0xd3515c28, 0x31559a83,  -954, -268 },  // 1e-268
+    { 0x9d71ac8f, 0xada6c9b5,  -927, -260 },  // 1e-260
+    { 0xea9c2277, 0x23ee8bcb,  -901, -252 },  // 1e-252
+    { 0xaecc4991, 0x4078536d,  -874, -244 },  // 1e-244
+    { 0x823c1279, 0x5db6ce57,  -847, -236 },  // 1e-236
+    { 0xc2109436, 0x4dfb5637,  -821, -228 },  // 1e-228
+    { 0x9096ea6f, 0x3848984f,  -794, -220 },  // 1e-220
+    { 0xd77485cb, 0x25823ac7,  -768, -212 },  // 1e-212
+    { 0xa086cfcd, 0x97bf97f4,  -741, -204 },  // 1e-204
+    { 0xef340a98, 0x172aace5,  -715, -196 },  // 1e-196
+    { 0xb23867fb, 0x2a35b28e,  -688, -188 },  // 1e-188
+    { 0x84c8d4df, 0xd2c63f3b,  -661, -180 },  // 1e-180
+    { 0xc5dd4427, 0x1ad3cdba,  -635, -172 },  // 1e-172
+    { 0x936b9fce, 0xbb25c996,  -608, -164 },  // 1e-164
+    { 0xdbac6c24, 0x7d62a584,  -582, -156 },  // 1e-156
+    { 0xa3ab6658, 0x0d5fdaf6,  -555, -148 },  // 1e-148
+    { 0xf3e2f893, 0xdec3f126,  -529, -140 },  // 1e-140
+    { 0xb5b5ada8, 0xaaff80b8,  -502, -132 },  // 1e-132
+    { 0x87625f05, 0x6c7c4a8b,  -475, -124 },  // 1e-124
+    { 0xc9bcff60, 0x34c13053,  -449, -116 },  // 1e-116
+    { 0x964e858c, 0x91ba2655,  -422, -108 },  // 1e-108
+    { 0xdff97724, 0x70297ebd,  -396, -100 },  // 1e-100
+    { 0xa6dfbd9f, 0xb8e5b88f,  -369,  -92 },  // 1e-92
+    { 0xf8a95fcf, 0x88747d94,  -343,  -84 },  // 1e-84
+    { 0xb9447093, 0x8fa89bcf,  -316,  -76 },  // 1e-76
+    { 0x8a08f0f8, 0xbf0f156b,  -289,  -68 },  // 1e-68
+    { 0xcdb02555, 0x653131b6,  -263,  -60 },  // 1e-60
+    { 0x993fe2c6, 0xd07b7fac,  -236,  -52 },  // 1e-52
+    { 0xe45c10c4, 0x2a2b3b06,  -210,  -44 },  // 1e-44
+    { 0xaa242499, 0x697392d3,  -183,  -36 },  // 1e-36
+    { 0xfd87b5f2, 0x8300ca0e,  -157,  -28 },  // 1e-28
+    { 0xbce50864, 0x92111aeb,  -130,  -20 },  // 1e-20
+    { 0x8cbccc09, 0x6f5088cc,  -103,  -12 },  // 1e-12
+    { 0xd1b71758, 0xe219652c,   -77,   -4 },  // 1e-4
+    { 0x9c400000, 0x00000000,   -50,    4 },  // 1e4
+    { 0xe8d4a510, 0x00000000,   -24,   12 },  // 1e12
+    { 0xad78ebc5, 0xac620000,     3,   20 },  // 1e20
+    { 0x813f3978, 0xf8940984,    30,   28 },  // 1e28
+    { 0xc097ce7b, 0xc90715b3,    56,   36 },  // 1e36
+    { 0x8f7e32ce, 0x7bea5c70,    83,   44 },  // 1e44
+    { 0xd5d238a4, 0xabe98068,   109,   52 },  // 1e52
+    { 0x9f4f2726, 0x179a2245,   136,   60 },  // 1e60
+    { 0xed63a231, 0xd4c4fb27,   162,   68 },  // 1e68
+    { 0xb0de6538, 0x8cc8ada8,   189,   76 },  // 1e76
+    { 0x83c7088e, 0x1aab65db,   216,   84 },  // 1e84
+    { 0xc45d1df9, 0x42711d9a,   242,   92 },  // 1e92
+    { 0x924d692c, 0xa61be758,   269,  100 },  // 1e100
+    { 0xda01ee64, 0x1a708dea,   295,  108 },  // 1e108
+    { 0xa26da399, 0x9aef774a,   322,  116 },  // 1e116
+    { 0xf209787b, 0xb47d6b85,   348,  124 },  // 1e124
+    { 0xb454e4a1, 0x79dd1877,   375,  132 },  // 1e132
+    { 0x865b8692, 0x5b9bc5c2,   402,  140 },  // 1e140
+    { 0xc83553c5, 0xc8965d3d,   428,  148 },  // 1e148
+    { 0x952ab45c, 0xfa97a0b3,   455,  156 },  // 1e156
+    { 0xde469fbd, 0x99a05fe3,   481,  164 },  // 1e164
+    { 0xa59bc234, 0xdb398c25,   508,  172 },  // 1e172
+    { 0xf6c69a72, 0xa3989f5c,   534,  180 },  // 1e180
+    { 0xb7dcbf53, 0x54e9bece,   561,  188 },  // 1e188
+    { 0x88fcf317, 0xf22241e2,   588,  196 },  // 1e196
+    { 0xcc20ce9b, 0xd35c78a5,   614,  204 },  // 1e204
+    { 0x98165af3, 0x7b2153df,   641,  212 },  // 1e212
+    { 0xe2a0b5dc, 0x971f303a,   667,  220 },  // 1e220
+    { 0xa8d9d153, 0x5ce3b396,   694,  228 },  // 1e228
+    { 0xfb9b7cd9, 0xa4a7443c,   720,  236 },  // 1e236
+    { 0xbb764c4c, 0xa7a44410,   747,  244 },  // 1e244
+    { 0x8bab8eef, 0xb6409c1a,   774,  252 },  // 1e252
+    { 0xd01fef10, 0xa657842c,   800,  260 },  // 1e260
+    { 0x9b10a4e5, 0xe9913129,   827,  268 },  // 1e268
+    { 0xe7109bfb, 0xa19c0c9d,   853,  276 },  // 1e276
+    { 0xac2820d9, 0x623bf429,   880,  284 },  // 1e284
+    { 0x80444b5e, 0x7aa7cf85,   907,  292 },  // 1e292
+    { 0xbf21e440, 0x03acdd2d,   933,  300 },  // 1e300
+    { 0x8e679c2f, 0x5e44ff8f,   960,  308 },  // 1e308
+    { 0xd433179d, 0x9c8cb841,   986,  316 },  // 1e316
+    { 0x9e19db92, 0xb4e31ba9,  1013,  324 },  // 1e324
+    { 0xeb96bf6e, 0xbadf77d9,  1039,  332 },  // 1e332
+    { 0xaf87023b, 0x9bf0ee6b,  1066,  340 },  // 1e340
+};
+
+const unsigned int k_POWERS_OF_10[] = {
+    1u,  10u,  100u,  1000u,  10000u,  100000u,  1000000u,  10000000u,
+    100000000u,  1000000000u
+};
+
+inline
+DiyFp cachedPower(int *decimalExponent, int binaryExponent)
+    // Return the cached power of ten, 'c', such that the binary exponent of
+    // the product of 'c' and a normalized 'DiyFp' having the specified
+    // 'binaryExponent' lies in '[-60 .. -32]', and load into the specified
+    // 'decimalExponent' the negation of the decimal exponent of 'c'.
+{
+    // 0.30102999566398114 is 'log10(2)'; 'k' is 'ceil(-(e + 61) * log10(2))'
+    // offset by 347 so that it is non-negative.
+
+    const double dk = (-61 - binaryExponent) * 0.30102999566398114 + 347;
+    int          k  = static_cast<int>(dk);
+    if (dk - k > 0.0) {
+        ++k;
+    }
+
+    const int index = (k >> 3) + 1;
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < static_cast<int>(sizeof  k_CACHED_POWERS
+                                              / sizeof *k_CACHED_POWERS));
+
+    const CachedPower& power = k_CACHED_POWERS[index];
+
+    const Uint64 significand =
+                          (static_cast<Uint64>(power.d_significandHi) << 32)
+                        | power.d_significandLo;
+
+    *decimalExponent = -power.d_decimalExponent;
+    return makeDiyFp(significand, power.d_binaryExponent);
+}
+
+inline
+int numDecimalDigits(unsigned int value)
+    // Return the number of decimal digits in the specified 'value', or 1 if
+    // 'value' is 0.
+{
+    int result = 1;
+    while (result < 10 && value >= k_POWERS_OF_10[result]) {
+        ++result;
+    }
+    return result;
+}
+
+inline
+void roundWeed(char   *digits,
+               int     numDigits,
+               Uint64  delta,
+               Uint64  rest,
+               Uint64  tenKappa,
+               Uint64  distance)
+    // Decrement the last of the specified 'numDigits' 'digits' while doing so
+    // moves the represented value (whose distance below the scaled upper
+    // boundary is the specified 'rest') closer to the scaled input (whose
+    // distance below that boundary is the specified 'distance') and keeps it
+    // within the specified 'delta' of the boundary, where the specified
+    // 'tenKappa' is the scaled weight of the last digit.
+{
+    while (rest < distance
+        && delta - rest >= tenKappa
+        && (rest + tenKappa < distance
+         || distance - rest > rest + tenKappa - distance)) {
+        --digits[numDigits - 1];
+        rest += tenKappa;
+    }
+}
+
+int generateDigits(char         *digits,
+                   int          *decimalExponent,
+                   const DiyFp&  value,
+                   const DiyFp&  upper,
+                   Uint64        delta)
+    // Load into the specified 'digits' the shortest digit sequence, 'D', such
+    // that 'D * 10^k' lies within the specified 'delta' below the specified
+    // 'upper' boundary, add 'k' to the specified 'decimalExponent', and return
+    // the number of digits.  The specified 'value' is the scaled input, and
+    // 'upper' and 'value' have the same binary exponent, which lies in
+    // '[-60 .. -32]'.
+{
+    const int    shift    = -upper.d_e;
+    const Uint64 one      = static_cast<Uint64>(1) << shift;
+    const Uint64 mask     = one - 1;
+    Uint64       distance = upper.d_f - value.d_f;
+
+    unsigned int integral   = static_cast<unsigned int>(upper.d_f >> shift);
+    Uint64       fractional = upper.d_f & mask;
+
+    int kappa     = numDecimalDigits(integral);
+    int numDigits = 0;
+
+    while (kappa > 0) {
+        const unsigned int divisor = k_POWERS_OF_10[kappa - 1];
+        const unsigned int digit   = integral / divisor;
+        integral %= divisor;
+
+        if (digit || numDigits) {
+            digits[numDigits++] = static_cast<char>('0' + digit);
+        }
+        --kappa;
+
+        const Uint64 rest = (static_cast<Uint64>(integral) << shift)
+                                                                  + fractional;
+        if (rest <= delta) {
+            *decimalExponent += kappa;
+            roundWeed(digits,
+                      numDigits,
+                      delta,
+                      rest,
+                      static_cast<Uint64>(k_POWERS_OF_10[kappa]) << shift,
+                      distance);
+            return numDigits;                                         // RETURN
+        }
+    }
+
+    for (;;) {
+        // 'distance' does not exceed 'delta', and the loop ends before
+        // 'delta' exceeds '10 * one', so neither overflows.
+
+        fractional *= 10;
+        delta      *= 10;
+        distance   *= 10;
+
+        const char digit = static_cast<char>(fractional >> shift);
+        if (digit || numDigits) {
+            digits[numDigits++] = static_cast<char>('0' + digit);
+        }
+        fractional &= mask;
+        --kappa;
+
+        if (fractional < delta) {
+            *decimalExponent += kappa;
+            roundWeed(digits, numDigits, delta, fractional, one, distance);
+            return numDigits;                                         // RETURN
+        }
+    }
+}
+
+int grisu2(char       *digits,
+           int        *exponent,
+           Uint64      significand,
+           int         binaryExponent,
+           bool        isLowerBoundaryCloser)
+    // Load into the specified 'digits' the Grisu2 digits of the positive
+    // value 'significand * 2^binaryExponent', for the specified
+    // 'significand' and 'binaryExponent', load into the specified 'exponent'
+    // the decimal exponent of the leading digit, and return the number of
+    // digits.  The specified 'isLowerBoundaryCloser' indicates that the next
+    // lower value of the type is closer than the next higher value (i.e., the
+    // significand is a power of two and the value is normal, but not the
+    // least normal).
+{
+    const DiyFp v     = normalize(makeDiyFp(significand, binaryExponent));
+    const DiyFp plus  = normalize(makeDiyFp((significand << 1) + 1,
+                                            binaryExponent - 1));
+    DiyFp       minus =
+                      isLowerBoundaryCloser
+                      ? makeDiyFp((significand << 2) - 1, binaryExponent - 2)
+                      : makeDiyFp((significand << 1) - 1, binaryExponent - 1);
+    minus.d_f <<= minus.d_e - plus.d_e;
+    minus.d_e   = plus.d_e;
+
+    BSLS_ASSERT_SAFE(v.d_e == plus.d_e);
+
+    int         k;
+    const DiyFp c  = cachedPower(&k, plus.d_e);
+    const DiyFp w  = multiply(v, c);
+    DiyFp       wp = multiply(plus, c);
+    DiyFp       wm = multiply(minus, c);
+
+    // Narrow the interval by one unit on either side to account for the
+    // rounding error of 'multiply'.
+
+    ++wm.d_f;
+    --wp.d_f;
+
+    int numDigits = generateDigits(digits, &k, w, wp, wp.d_f - wm.d_f);
+
+    // Remove trailing zeros, which do not affect the exponent of the leading
+    // digit.
+
+    *exponent = numDigits + k - 1;
+    while (numDigits > 1 && '0' == digits[numDigits - 1]) {
+        --numDigits;
+    }
+    return numDigits;
+}
+
+char *writeExponent(char *buffer, int exponent)
+    // Write to the specified 'buffer' the specified 'exponent' as 'e' followed
+    // by a sign and at least two digits, and return the address one past the
+    // last character written.
+{
+    *buffer++ = 'e';
+    if (exponent < 0) {
+        *buffer++ = '-';
+        exponent  = -exponent;
+    }
+    else {
+        *buffer++ = '+';
+    }
+
+    if (exponent >= 100) {
+        *buffer++ = static_cast<char>('0' + exponent / 100);
+        exponent %= 100;
+    }
+    *buffer++ = static_cast<char>('0' + exponent / 10);
+    *buffer++ = static_cast<char>('0' + exponent % 10);
+    return buffer;
+}
+
+int layout(char       *buffer,
+           bool        isNegative,
+           const char *digits,
+           int         numDigits,
+           int         exponent,
+           int         precision)
+    // Write to the specified 'buffer' the value having the specified
+    // 'numDigits' 'digits', the specified decimal 'exponent' of its leading
+    // digit, and a sign indicated by the specified 'isNegative', laid out as
+    // by the '%g' conversion of 'printf' at the specified 'precision', and
+    // return the number of characters written.  The behavior is undefined
+    // unless 'numDigits <= precision'.
+{
+    char *p = buffer;
+
+    if (isNegative) {
+        *p++ = '-';
+    }
+
+    if (exponent < -4 || exponent >= precision) {
+        *p++ = digits[0];
+        if (numDigits > 1) {
+            *p++ = '.';
+            bsl::memcpy(p, digits + 1, numDigits - 1);
+            p += numDigits - 1;
+        }
+        p = writeExponent(p, exponent);
+    }
+    else if (exponent < 0) {
+        *p++ = '0';
+        *p++ = '.';
+        for (int i = exponent + 1; i < 0; ++i) {
+            *p++ = '0';
+        }
+        bsl::memcpy(p, digits, numDigits);
+        p += numDigits;
+    }
+    else if (numDigits <= exponent + 1) {
+        bsl::memcpy(p, digits, numDigits);
+        p += numDigits;
+        for (int i = numDigits; i <= exponent; ++i) {
+            *p++ = '0';
+        }
+    }
+    else {
+        bsl::memcpy(p, digits, exponent + 1);
+        p += exponent + 1;
+        *p++ = '.';
+        bsl::memcpy(p, digits + exponent + 1, numDigits - exponent - 1);
+        p += numDigits - exponent - 1;
+    }
+
+    return static_cast<int>(p - buffer);
+}
+
+inline
+int doubleDigits(char *digits, int *exponent, bool *isNegative, double value)
+    // Load into the specified 'digits' and 'exponent' the shortest digits of
+    // the absolute value of the specified 'value' and the decimal exponent of
+    // the leading digit, load into the specified 'isNegative' the sign bit of
+    // 'value', and return the number of digits.
+{
+    const Uint64 k_HIDDEN_BIT = static_cast<Uint64>(1) << 52;
+
+    Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+
+    *isNegative = 0 != (bits >> 63);
+
+    const int    biasedExponent = static_cast<int>(bits >> 52) & 0x7ff;
+    const Uint64 fraction       = bits & (k_HIDDEN_BIT - 1);
+
+    BSLS_ASSERT(0x7ff != biasedExponent);
+
+    if (0 == biasedExponent) {
+        if (0 == fraction) {
+            digits[0] = '0';
+            *exponent = 0;
+            return 1;                                                 // RETURN
+        }
+        return grisu2(digits, exponent, fraction, -1074, false);      // RETURN
+    }
+    return grisu2(digits,
+                  exponent,
+                  fraction | k_HIDDEN_BIT,
+                  biasedExponent - 1075,
+                  0 == fraction && biasedExponent > 1);
+}
+
+inline
+int floatDigits(char *digits, int *exponent, bool *isNegative, float value)
+    // Load into the specified 'digits' and 'exponent' the shortest digits of
+    // the absolute value of the specified 'value' and the decimal exponent of
+    // the leading digit, load into the specified 'isNegative' the sign bit of
+    // 'value', and return the number of digits.
+{
+    const unsigned int k_HIDDEN_BIT = 1u << 23;
+
+    unsigned int bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+
+    *isNegative = 0 != (bits >> 31);
+
+    const int          biasedExponent = static_cast<int>(bits >> 23) & 0xff;
+    const unsigned int fraction       = bits & (k_HIDDEN_BIT - 1);
+
+    BSLS_ASSERT(0xff != biasedExponent);
+
+    if (0 == biasedExponent) {
+        if (0 == fraction) {
+            digits[0] = '0';
+            *exponent = 0;
+            return 1;                                                 // RETURN
+        }
+        return grisu2(digits, exponent, fraction, -149, false);       // RETURN
+    }
+    return grisu2(digits,
+                  exponent,
+                  fraction | k_HIDDEN_BIT,
+                  biasedExponent - 150,
+                  0 == fraction && biasedExponent > 1);
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // struct NumericFormatUtil
+                          // ------------------------
+
+// CLASS METHODS
+int NumericFormatUtil::formatShortest(char *buffer, double value)
+{
+    BSLS_ASSERT(buffer);
+
+    char digits[k_MAX_DOUBLE_DIGITS + 1];
+    int  exponent;
+    bool isNegative;
+
+    const int numDigits = doubleDigits(digits, &exponent, &isNegative, value);
+
+    BSLS_ASSERT(numDigits <= k_MAX_DOUBLE_DIGITS);
+
+    return layout(buffer,
+                  isNegative,
+                  digits,
+                  numDigits,
+                  exponent,
+                  k_MAX_DOUBLE_DIGITS);
+}
+
+int NumericFormatUtil::formatShortest(char *buffer, float value)
+{
+    BSLS_ASSERT(buffer);
+
+    char digits[k_MAX_DOUBLE_DIGITS + 1];
+    int  exponent;
+    bool isNegative;
+
+    const int numDigits = floatDigits(digits, &exponent, &isNegative, value);
+
+    BSLS_ASSERT(numDigits <= k_MAX_FLOAT_DIGITS);
+
+    return layout(buffer,
+                  isNegative,
+                  digits,
+                  numDigits,
+                  exponent,
+                  k_MAX_FLOAT_DIGITS);
+}
+
+int NumericFormatUtil::formatShortest(char   *buffer,
+                                      double  value,
+                                      int     maxSignificantDigits)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(1 <= maxSignificantDigits);
+    BSLS_ASSERT(     maxSignificantDigits <= k_MAX_DOUBLE_DIGITS);
+
+    char digits[k_MAX_DOUBLE_DIGITS + 1];
+    int  exponent;
+    bool isNegative;
+
+    const int numDigits = doubleDigits(digits, &exponent, &isNegative, value);
+
+    if (numDigits > maxSignificantDigits) {
+        return 0;                                                     // RETURN
+    }
+    return layout(buffer,
+                  isNegative,
+                  digits,
+                  numDigits,
+                  exponent,
+                  maxSignificantDigits);
+}
+
+int NumericFormatUtil::formatShortest(char  *buffer,
+                                      float  value,
+                                      int    maxSignificantDigits)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(1 <= maxSignificantDigits);
+    BSLS_ASSERT(     maxSignificantDigits <= k_MAX_FLOAT_DIGITS);
+
+    char digits[k_MAX_DOUBLE_DIGITS + 1];
+    int  exponent;
+    bool isNegative;
+
+    const int numDigits = floatDigits(digits, &exponent, &isNegative, value);
+
+    if (numDigits > maxSignificantDigits) {
+        return 0;                                                     // RETURN
+    }
+    return layout(buffer,
+                  isNegative,
+                  digits,
+                  numDigits,
+                  exponent,
+                  maxSignificantDigits);
+}
+
+int NumericFormatUtil::shortestDigits(char   *digits,
+                                      int    *exponent,
+                                      double  value)
+{
+    BSLS_ASSERT(digits);
+    BSLS_ASSERT(exponent);
+
+    char buffer[k_MAX_DOUBLE_DIGITS + 1];
+    bool isNegative;
+
+    const int numDigits = doubleDigits(buffer, exponent, &isNegative, value);
+
+    BSLS_ASSERT(numDigits <= k_MAX_DOUBLE_DIGITS);
+
+    bsl::memcpy(digits, buffer, numDigits);
+    return numDigits;
+}
+
+int NumericFormatUtil::shortestDigits(char  *digits,
+                                      int   *exponent,
+                                      float  value)
+{
+    BSLS_ASSERT(digits);
+    BSLS_ASSERT(exponent);
+
+    char buffer[k_MAX_DOUBLE_DIGITS + 1];
+    bool isNegative;
+
+    const int numDigits = floatDigits(buffer, exponent, &isNegative, value);
+
+    BSLS_ASSERT(numDigits <= k_MAX_FLOAT_DIGITS);
+
+    bsl::memcpy(digits, buffer, numDigits);
+    return numDigits;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
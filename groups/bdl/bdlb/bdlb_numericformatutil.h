@@ -0,0 +1,198 @@
+// bdlb_numericformatutil.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLB_NUMERICFORMATUTIL
+#define INCLUDED_BDLB_NUMERICFORMATUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide shortest round-trip text conversions of floating point.
+//
+//@CLASSES:
+//  bdlb::NumericFormatUtil: namespace for floating point formatting functions
+//
+//@SEE_ALSO: bdlb_numericparseutil
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'bdlb::NumericFormatUtil', containing utility functions that write the
+// textual representation of a 'double' or 'float' value having the fewest
+// significant decimal digits that, when parsed back with correct rounding
+// (e.g., by 'bdlb::NumericParseUtil::parseDouble' or 'strtod'), yields the
+// original value.  For example, the 'double' closest to 0.3 is written as
+// "0.3", whereas 'printf("%.17g")' writes "0.29999999999999999", and the sum
+// '0.1 + 0.2' is written as "0.30000000000000004", whereas 'printf("%.15g")'
+// writes "0.3", which does not round-trip.
+//
+// The functions are independent of the current locale, allocate no memory,
+// and are substantially faster than the 'printf' family of functions.
+//
+///Output Format
+///-------------
+// The text is laid out as by the '%g' conversion of 'printf' at a precision,
+// 'P', of 17 for 'double' and 9 for 'float' (the number of digits that always
+// suffices to round-trip), or of a caller-specified 'maxSignificantDigits':
+//
+//: o If the decimal exponent, 'X', of the value (i.e., the power of 10 of its
+//:   leading digit) satisfies '-4 <= X < P', fixed notation is used, such as
+//:   "1234.5" or "0.001".
+//:
+//: o Otherwise scientific notation is used, having a single digit before the
+//:   decimal point, and an exponent having an explicit sign and at least two
+//:   digits, such as "1.5e-07" or "1e+21".
+//:
+//: o Trailing zeros, and a decimal point not followed by a digit, are never
+//:   written.  Negative values, including negative zero, are preceded by '-'.
+//
+// The 'maxSignificantDigits' overloads fail, writing nothing, if the
+// representation produced (see {Algorithm}) has more than
+// 'maxSignificantDigits' digits.  When they succeed and 'maxSignificantDigits'
+// does not exceed 'bsl::numeric_limits<TYPE>::digits10' (15 for 'double' and
+// 6 for 'float'), the text is identical to that written by 'printf("%.*g")'
+// at that precision, since the correctly rounded value at that precision is
+// then the shortest representation.  These overloads therefore provide a fast
+// path for formatting at a limited precision, for which a caller must provide
+// a fallback.
+//
+///Algorithm
+///---------
+// The digits are generated by the Grisu2 algorithm (see Florian Loitsch,
+// "Printing Floating-Point Numbers Quickly and Accurately with Integers",
+// PLDI 2010), using 64-bit integer arithmetic and a table of 87 cached powers
+// of ten.  The generated digits always lie strictly within the interval of
+// decimal values that round to the input, so the output always round-trips.
+// In rare cases (fewer than 0.1% of 'double' values, and somewhat more of
+// 'float' values) a representation longer than the shortest possible is
+// produced, typically because the shorter one lies exactly on the boundary of
+// the interval.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a 'double' Compactly
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write prices into a text message, using as few
+// characters as possible while preserving each value exactly.
+//
+// First, we create a buffer large enough for any 'double':
+//..
+//  char buffer[bdlb::NumericFormatUtil::k_DOUBLE_BUFFER_SIZE];
+//..
+// Then, we format a value that has no exact binary representation:
+//..
+//  int length = bdlb::NumericFormatUtil::formatShortest(buffer, 100.07);
+//  assert(bsl::string(buffer, length) == "100.07");
+//..
+// Next, we format a value needing all 17 digits, and a large value:
+//..
+//  length = bdlb::NumericFormatUtil::formatShortest(buffer, 0.1 + 0.2);
+//  assert(bsl::string(buffer, length) == "0.30000000000000004");
+//
+//  length = bdlb::NumericFormatUtil::formatShortest(buffer, -2.5e100);
+//  assert(bsl::string(buffer, length) == "-2.5e+100");
+//..
+// Finally, we format at a limited precision, which fails if the value needs
+// more digits than allowed:
+//..
+//  length = bdlb::NumericFormatUtil::formatShortest(buffer, 100.07, 6);
+//  assert(bsl::string(buffer, length) == "100.07");
+//
+//  length = bdlb::NumericFormatUtil::formatShortest(buffer, 1.0 / 3, 6);
+//  assert(0 == length);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                          // ========================
+                          // struct NumericFormatUtil
+                          // ========================
+
+struct NumericFormatUtil {
+    // This 'struct' provides a namespace for a suite of stateless functions
+    // that write the shortest round-trip textual representations of floating
+    // point values.
+
+    // CONSTANTS
+    enum {
+        k_MAX_DOUBLE_DIGITS  = 17,  // maximum significant digits of a 'double'
+
+        k_MAX_FLOAT_DIGITS   = 9,   // maximum significant digits of a 'float'
+
+        k_DOUBLE_BUFFER_SIZE = 24,  // sufficient for any formatted 'double',
+                                    // e.g., "-2.2250738585072014e-308"
+
+        k_FLOAT_BUFFER_SIZE  = 16   // sufficient for any formatted 'float',
+                                    // e.g., "-1.17549435e-38"
+    };
+
+    // CLASS METHODS
+    static int formatShortest(char *buffer, double value);
+    static int formatShortest(char *buffer, float value);
+        // Write to the specified 'buffer' the shortest textual representation
+        // of the specified 'value' that round-trips (see {Output Format}), and
+        // return the number of characters written.  No null terminator is
+        // written.  The behavior is undefined unless 'buffer' has room for at
+        // least 'k_DOUBLE_BUFFER_SIZE' characters if 'value' is a 'double',
+        // or 'k_FLOAT_BUFFER_SIZE' characters if 'value' is a 'float', and
+        // 'value' is neither infinite nor a NaN.
+
+    static int formatShortest(char   *buffer,
+                              double  value,
+                              int     maxSignificantDigits);
+    static int formatShortest(char   *buffer,
+                              float   value,
+                              int     maxSignificantDigits);
+        // Write to the specified 'buffer' the shortest textual representation
+        // of the specified 'value' that round-trips, laid out as by
+        // 'printf("%.*g")' with a precision of the specified
+        // 'maxSignificantDigits' (see {Output Format}), and return the number
+        // of characters written, if that representation has no more than
+        // 'maxSignificantDigits' significant digits; otherwise, return 0
+        // without writing to 'buffer'.  No null terminator is written.  The
+        // behavior is undefined unless
+        // '1 <= maxSignificantDigits <= k_MAX_DOUBLE_DIGITS' and 'buffer' has
+        // room for at least 'k_DOUBLE_BUFFER_SIZE' characters if 'value' is a
+        // 'double', '1 <= maxSignificantDigits <= k_MAX_FLOAT_DIGITS' and
+        // 'buffer' has room for at least 'k_FLOAT_BUFFER_SIZE' characters if
+        // 'value' is a 'float', and 'value' is neither infinite nor a NaN.
+        // Note that 0 may be returned in rare cases in which a representation
+        // having 'maxSignificantDigits' digits exists (see {Algorithm}).
+
+    static int shortestDigits(char *digits, int *exponent, double value);
+    static int shortestDigits(char *digits, int *exponent, float value);
+        // Load into the specified 'digits' the shortest sequence of decimal
+        // digits, 'd1 d2 ... dn', that round-trips to the absolute value of
+        // the specified 'value' when read as 'd1.d2...dn * 10^X', load 'X'
+        // into the specified 'exponent', and return 'n'.  Neither a sign nor
+        // a null terminator is written; the first digit is non-zero unless
+        // 'value' is zero, in which case "0" is written and 'X' is 0.  The
+        // behavior is undefined unless 'digits' has room for at least
+        // 'k_MAX_DOUBLE_DIGITS' characters if 'value' is a 'double', or
+        // 'k_MAX_FLOAT_DIGITS' characters if 'value' is a 'float', and 'value'
+        // is neither infinite nor a NaN.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1026 @@
+// bdlb_numericformatutil.t.cpp                                       -*-C++-*-
+
+#include <bdlb_numericformatutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility whose functions are pure: the output
+// depends only on the input value.  We verify the digit generation against a
+// table of values whose shortest representations are known, the layout
+// against tables of expected strings, and then, for large numbers of
+// pseudo-random bit patterns, that the output (1) parses back (using 'strtod'
+// or 'strtof') to the original value, (2) has at most one digit more than the
+// shortest round-trip representation found by exhaustive search, and (3) for
+// the precision-limited overloads, is identical to the output of 'snprintf'.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int shortestDigits(char *, int *, double);
+// [ 2] int shortestDigits(char *, int *, float);
+// [ 3] int formatShortest(char *, double);
+// [ 3] int formatShortest(char *, float);
+// [ 4] int formatShortest(char *, double, int);
+// [ 4] int formatShortest(char *, float, int);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] ROUND TRIP AND SHORTNESS
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlb::NumericFormatUtil Util;
+typedef bsls::Types::Uint64     Uint64;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Advance the specified 'state' of a 64-bit xorshift generator, and
+    // return the new state.
+{
+    Uint64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+double randomDouble(Uint64 *state)
+    // Return a finite 'double' having a pseudo-random bit pattern obtained
+    // from the specified 'state'.
+{
+    for (;;) {
+        const Uint64 bits = nextRandom(state);
+        if (0x7ff != ((bits >> 52) & 0x7ff)) {
+            double result;
+            bsl::memcpy(&result, &bits, sizeof result);
+            return result;                                            // RETURN
+        }
+    }
+}
+
+float randomFloat(Uint64 *state)
+    // Return a finite 'float' having a pseudo-random bit pattern obtained
+    // from the specified 'state'.
+{
+    for (;;) {
+        const unsigned int bits = static_cast<unsigned int>(
+                                                     nextRandom(state) >> 32);
+        if (0xff != ((bits >> 23) & 0xff)) {
+            float result;
+            bsl::memcpy(&result, &bits, sizeof result);
+            return result;                                            // RETURN
+        }
+    }
+}
+
+bool isSameBits(double lhs, double rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same bit
+    // pattern, and 'false' otherwise.
+{
+    return 0 == bsl::memcmp(&lhs, &rhs, sizeof lhs);
+}
+
+bool isSameBits(float lhs, float rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same bit
+    // pattern, and 'false' otherwise.
+{
+    return 0 == bsl::memcmp(&lhs, &rhs, sizeof lhs);
+}
+
+double parse(const char *text, double)
+    // Return the 'double' value of the specified 'text'.
+{
+    return bsl::strtod(text, 0);
+}
+
+float parse(const char *text, float)
+    // Return the 'float' value of the specified 'text'.
+{
+    return bsl::strtof(text, 0);
+}
+
+template <class TYPE>
+int shortestBySearch(TYPE value)
+    // Return the least number of significant decimal digits of any decimal
+    // value that parses back to the specified 'value'.  Note that, at the
+    // boundary of a binade, the decimal nearest to 'value' at a given
+    // precision may lie outside the (asymmetric) rounding interval although
+    // its upper neighbor lies within it, so both are tried.
+{
+    BSLMF_ASSERT(sizeof(long long) >= 8);
+
+    for (int numDigits = 1; ; ++numDigits) {
+        char buffer[64];
+        snprintf(buffer,
+                 sizeof buffer,
+                 "%.*e",
+                 numDigits - 1,
+                 static_cast<double>(value));
+        if (isSameBits(parse(buffer, value), value)) {
+            return numDigits;                                         // RETURN
+        }
+
+        // Form the decimal one unit in the last place greater in magnitude.
+
+        long long   significand = 0;
+        const char *p           = buffer;
+        bool        isNegative  = '-' == *p;
+        p += isNegative;
+        for (; 'e' != *p; ++p) {
+            if ('.' != *p) {
+                significand = significand * 10 + (*p - '0');
+            }
+        }
+        const int exponent = atoi(p + 1) - (numDigits - 1);
+        snprintf(buffer,
+                 sizeof buffer,
+                 "%s%llde%d",
+                 isNegative ? "-" : "",
+                 significand + 1,
+                 exponent);
+        if (isSameBits(parse(buffer, value), value)) {
+            return numDigits;                                         // RETURN
+        }
+    }
+}
+
+template <class TYPE>
+bsl::string format(TYPE value)
+    // Return the result of 'Util::formatShortest' for the specified 'value'.
+{
+    char buffer[Util::k_DOUBLE_BUFFER_SIZE];
+    return bsl::string(buffer, Util::formatShortest(buffer, value));
+}
+
+template <class TYPE>
+bsl::string format(TYPE value, int maxSignificantDigits)
+    // Return the result of 'Util::formatShortest' for the specified 'value'
+    // and 'maxSignificantDigits'.
+{
+    char buffer[Util::k_DOUBLE_BUFFER_SIZE];
+    return bsl::string(buffer,
+                       Util::formatShortest(buffer,
+                                            value,
+                                            maxSignificantDigits));
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a 'double' Compactly
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write prices into a text message, using as few
+// characters as possible while preserving each value exactly.
+//
+// First, we create a buffer large enough for any 'double':
+//..
+    char buffer[bdlb::NumericFormatUtil::k_DOUBLE_BUFFER_SIZE];
+//..
+// Then, we format a value that has no exact binary representation:
+//..
+    int length = bdlb::NumericFormatUtil::formatShortest(buffer, 100.07);
+    ASSERT(bsl::string(buffer, length) == "100.07");
+//..
+// Next, we format a value needing all 17 digits, and a large value:
+//..
+    length = bdlb::NumericFormatUtil::formatShortest(buffer, 0.1 + 0.2);
+    ASSERT(bsl::string(buffer, length) == "0.30000000000000004");
+
+    length = bdlb::NumericFormatUtil::formatShortest(buffer, -2.5e100);
+    ASSERT(bsl::string(buffer, length) == "-2.5e+100");
+//..
+// Finally, we format at a limited precision, which fails if the value needs
+// more digits than allowed:
+//..
+    length = bdlb::NumericFormatUtil::formatShortest(buffer, 100.07, 6);
+    ASSERT(bsl::string(buffer, length) == "100.07");
+
+    length = bdlb::NumericFormatUtil::formatShortest(buffer, 1.0 / 3, 6);
+    ASSERT(0 == length);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ROUND TRIP AND SHORTNESS
+        //
+        // Concerns:
+        //: 1 The text written for every finite value parses back, with correct
+        //:   rounding, to exactly that value.
+        //:
+        //: 2 The number of significant digits written is never more than one
+        //:   greater than the shortest round-trip representation, and is
+        //:   rarely greater at all.
+        //:
+        //: 3 Subnormal values and the boundaries of the binades (where the
+        //:   rounding interval is asymmetric) are handled correctly.
+        //
+        // Plan:
+        //: 1 For a large number of pseudo-random bit patterns, and for every
+        //:   power of two, of both 'double' and 'float', format the value,
+        //:   parse it back with 'strtod' or 'strtof', and verify that the bit
+        //:   pattern is unchanged.  (C-1, 3)
+        //:
+        //: 2 For the same values, find the shortest round-trip precision by
+        //:   searching with 'snprintf("%.*e")', and verify that the number of
+        //:   digits produced by 'shortestDigits' exceeds it by at most one,
+        //:   and that fewer than 1% of the values need the extra digit.
+        //:   (C-2)
+        //
+        // Testing:
+        //   ROUND TRIP AND SHORTNESS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ROUND TRIP AND SHORTNESS" << endl
+                          << "========================" << endl;
+
+        const int NUM_VALUES = veryVerbose ? 1000000 : 100000;
+
+        if (verbose) cout << "\tTesting 'double'." << endl;
+        {
+            Uint64 state       = 0x9e3779b97f4a7c15ULL;
+            int    numLonger   = 0;
+            int    numVerified = 0;
+
+            for (int i = -1074; i <= 1023 + NUM_VALUES; ++i) {
+                const double VALUE = i <= 1023
+                                     ? ldexp(1.0, i)
+                                     : randomDouble(&state);
+
+                char buffer[Util::k_DOUBLE_BUFFER_SIZE + 1];
+                const int LENGTH = Util::formatShortest(buffer, VALUE);
+                ASSERTV(i, 0 < LENGTH);
+                ASSERTV(i, LENGTH <= Util::k_DOUBLE_BUFFER_SIZE);
+                buffer[LENGTH] = '\0';
+
+                ASSERTV(buffer, isSameBits(VALUE, parse(buffer, VALUE)));
+
+                char digits[Util::k_MAX_DOUBLE_DIGITS];
+                int  exponent;
+                const int NUM_DIGITS = Util::shortestDigits(digits,
+                                                            &exponent,
+                                                            VALUE);
+                const int SHORTEST   = shortestBySearch(VALUE);
+
+                ASSERTV(buffer, NUM_DIGITS, SHORTEST, SHORTEST <= NUM_DIGITS);
+
+                numLonger += NUM_DIGITS > SHORTEST;
+                ++numVerified;
+            }
+
+            if (verbose) { P_(numVerified) P(numLonger) }
+            ASSERTV(numLonger, numVerified, numLonger * 100 < numVerified);
+        }
+
+        if (verbose) cout << "\tTesting 'float'." << endl;
+        {
+            Uint64 state       = 0x2545f4914f6cdd1dULL;
+            int    numLonger   = 0;
+            int    numVerified = 0;
+
+            for (int i = -149; i <= 127 + NUM_VALUES; ++i) {
+                const float VALUE = i <= 127
+                                    ? static_cast<float>(ldexp(1.0, i))
+                                    : randomFloat(&state);
+
+                char buffer[Util::k_FLOAT_BUFFER_SIZE + 1];
+                const int LENGTH = Util::formatShortest(buffer, VALUE);
+                ASSERTV(i, 0 < LENGTH);
+                ASSERTV(i, LENGTH <= Util::k_FLOAT_BUFFER_SIZE);
+                buffer[LENGTH] = '\0';
+
+                ASSERTV(buffer, isSameBits(VALUE, parse(buffer, VALUE)));
+
+                char digits[Util::k_MAX_FLOAT_DIGITS];
+                int  exponent;
+                const int NUM_DIGITS = Util::shortestDigits(digits,
+                                                            &exponent,
+                                                            VALUE);
+                const int SHORTEST   = shortestBySearch(VALUE);
+
+                ASSERTV(buffer, NUM_DIGITS, SHORTEST, SHORTEST <= NUM_DIGITS);
+
+                numLonger += NUM_DIGITS > SHORTEST;
+                ++numVerified;
+            }
+
+            if (verbose) { P_(numVerified) P(numLonger) }
+            ASSERTV(numLonger, numVerified, numLonger * 100 < numVerified);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FORMAT AT LIMITED PRECISION
+        //
+        // Concerns:
+        //: 1 If the shortest representation has more digits than allowed, 0
+        //:   is returned and nothing is written.
+        //:
+        //: 2 Otherwise the layout follows '%g' at the requested precision.
+        //:
+        //: 3 For precisions not exceeding 'digits10', the output is identical
+        //:   to that of 'snprintf("%.*g")', or is empty in the rare cases that
+        //:   the text written by 'snprintf' lies exactly on the boundary of
+        //:   the rounding interval (see {Algorithm}).
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the output for a set of
+        //:   values and precisions.  (C-1, 2)
+        //:
+        //: 2 For a large number of pseudo-random values rounded to a random
+        //:   precision not exceeding 'digits10' via 'snprintf("%.*g")',
+        //:   verify that 'formatShortest' at that precision writes the same
+        //:   text or fails, and that fewer than 1% of the values fail.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an out-of-range precision.  (C-4)
+        //
+        // Testing:
+        //   int formatShortest(char *, double, int);
+        //   int formatShortest(char *, float, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FORMAT AT LIMITED PRECISION" << endl
+                          << "===========================" << endl;
+
+        if (verbose) cout << "\tTable-driven test." << endl;
+        {
+            static const struct {
+                int         d_line;       // source line number
+                double      d_value;      // value to format
+                int         d_precision;  // maximum significant digits
+                const char *d_expected;   // expected output ("" for failure)
+            } DATA[] = {
+                //LINE  VALUE            PREC  EXPECTED
+                //----  ---------------  ----  ---------------------
+                { L_,   0.0,               1,  "0"                   },
+                { L_,   1.0,               1,  "1"                   },
+                { L_,   10.0,              1,  "1e+01"               },
+                { L_,   10.0,              2,  "10"                  },
+                { L_,   15.0,              1,  ""                    },
+                { L_,   15.0,              2,  "15"                  },
+                { L_,   0.1,               1,  "0.1"                 },
+                { L_,   0.0001,            1,  "0.0001"              },
+                { L_,   0.00001,           1,  "1e-05"               },
+                { L_,   123456.0,          6,  "123456"              },
+                { L_,   1234567.0,         6,  ""                    },
+                { L_,   1234567.0,         7,  "1234567"             },
+                { L_,   1e6,               6,  "1e+06"               },
+                { L_,   1e6,               7,  "1000000"             },
+                { L_,   -100.07,           5,  "-100.07"             },
+                { L_,   -100.07,           4,  ""                    },
+                { L_,   0.1 + 0.2,        15,  ""                    },
+                { L_,   0.1 + 0.2,        17,  "0.30000000000000004" },
+                { L_,   1.0 / 3,          15,  ""                    },
+                { L_,   1.0 / 3,          16,  "0.3333333333333333"  },
+                { L_,   1e300,             1,  "1e+300"              },
+                { L_,   DBL_MAX,          17,  "1.7976931348623157e+308" },
+                { L_,   DBL_MAX,          16,  ""                    },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE      = DATA[ti].d_line;
+                const double      VALUE     = DATA[ti].d_value;
+                const int         PRECISION = DATA[ti].d_precision;
+                const bsl::string EXPECTED  = DATA[ti].d_expected;
+
+                const bsl::string result = format(VALUE, PRECISION);
+
+                if (veryVerbose) { T_ P_(LINE) P_(PRECISION) P(result) }
+
+                ASSERTV(LINE, EXPECTED, result, EXPECTED == result);
+            }
+        }
+
+        if (verbose) cout << "\tComparison with 'snprintf'." << endl;
+        {
+            const int NUM_VALUES = veryVerbose ? 1000000 : 100000;
+
+            Uint64 state       = 0x0123456789abcdefULL;
+            int    numFailed   = 0;
+            int    numVerified = 0;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const double VALUE     = randomDouble(&state);
+                const int    PRECISION = 1 + static_cast<int>(
+                                                   nextRandom(&state) % 15);
+
+                char expected[64];
+                snprintf(expected, sizeof expected, "%.*g", PRECISION, VALUE);
+                const double ROUNDED = parse(expected, VALUE);
+
+                if (ROUNDED - ROUNDED != 0) {
+                    continue;  // rounded up to infinity
+                }
+
+                const bsl::string result = format(ROUNDED, PRECISION);
+
+                ASSERTV(expected, result,
+                        result.empty() || result == expected);
+
+                numFailed += result.empty();
+                ++numVerified;
+            }
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const float VALUE     = randomFloat(&state);
+                const int   PRECISION = 1 + static_cast<int>(
+                                                    nextRandom(&state) % 6);
+
+                char expected[64];
+                snprintf(expected,
+                         sizeof expected,
+                         "%.*g",
+                         PRECISION,
+                         static_cast<double>(VALUE));
+                const float ROUNDED = parse(expected, VALUE);
+
+                if (ROUNDED - ROUNDED != 0) {
+                    continue;  // rounded up to infinity
+                }
+
+                const bsl::string result = format(ROUNDED, PRECISION);
+
+                ASSERTV(expected, result,
+                        result.empty() || result == expected);
+
+                numFailed += result.empty();
+                ++numVerified;
+            }
+
+            if (verbose) { P_(numVerified) P(numFailed) }
+            ASSERTV(numFailed, numVerified, numFailed * 100 < numVerified);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[Util::k_DOUBLE_BUFFER_SIZE];
+
+            ASSERT_FAIL(Util::formatShortest(buffer, 1.0,   0));
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0,   1));
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0,  17));
+            ASSERT_FAIL(Util::formatShortest(buffer, 1.0,  18));
+
+            ASSERT_FAIL(Util::formatShortest(buffer, 1.0f,  0));
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0f,  1));
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0f,  9));
+            ASSERT_FAIL(Util::formatShortest(buffer, 1.0f, 10));
+
+            ASSERT_FAIL(Util::formatShortest(0, 1.0, 1));
+            ASSERT_FAIL(Util::formatShortest(0, 1.0f, 1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FORMAT SHORTEST
+        //
+        // Concerns:
+        //: 1 Fixed notation is used for decimal exponents in '[-4 .. P)', and
+        //:   scientific notation otherwise, where 'P' is 17 for 'double' and
+        //:   9 for 'float'.
+        //:
+        //: 2 Trailing zeros and a trailing decimal point are not written.
+        //:
+        //: 3 Exponents have a sign and at least two digits.
+        //:
+        //: 4 Negative values, including negative zero, have a leading '-'.
+        //:
+        //: 5 The longest outputs fit within the documented buffer sizes.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the output for a set of
+        //:   values chosen to exercise each branch of the layout, including
+        //:   the extreme values of each type.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null buffer.  (C-6)
+        //
+        // Testing:
+        //   int formatShortest(char *, double);
+        //   int formatShortest(char *, float);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FORMAT SHORTEST" << endl
+                          << "===============" << endl;
+
+        if (verbose) cout << "\tTesting 'double'." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                double      d_value;     // value to format
+                const char *d_expected;  // expected output
+            } DATA[] = {
+                //LINE  VALUE                     EXPECTED
+                //----  ------------------------  -------------------------
+                { L_,   0.0,                      "0"                       },
+                { L_,   -0.0,                     "-0"                      },
+                { L_,   1.0,                      "1"                       },
+                { L_,   -1.0,                     "-1"                      },
+                { L_,   0.5,                      "0.5"                     },
+                { L_,   0.3,                      "0.3"                     },
+                { L_,   100.0,                    "100"                     },
+                { L_,   123.456,                  "123.456"                 },
+                { L_,   0.001,                    "0.001"                   },
+                { L_,   0.0001,                   "0.0001"                  },
+                { L_,   0.00012345,               "0.00012345"              },
+                { L_,   0.00001,                  "1e-05"                   },
+                { L_,   1.5e-7,                   "1.5e-07"                 },
+                { L_,   1e16,                     "10000000000000000"       },
+                { L_,   12345678901234567.0,      "12345678901234568"       },
+                { L_,   1e17,                     "1e+17"                   },
+                { L_,   1.5e17,                   "1.5e+17"                 },
+                { L_,   1e21,                     "1e+21"                   },
+                { L_,   1e100,                    "1e+100"                  },
+                { L_,   -2.5e-100,                "-2.5e-100"               },
+                { L_,   9007199254740993.0,       "9007199254740992"        },
+                { L_,   0.1 + 0.2,                "0.30000000000000004"     },
+                { L_,   5e-324,                   "5e-324"                  },
+                { L_,   -2.2250738585072014e-308, "-2.2250738585072014e-308"},
+                { L_,   DBL_MAX,                  "1.7976931348623157e+308" },
+                { L_,   DBL_MIN,                  "2.2250738585072014e-308" },
+                { L_,   DBL_EPSILON,              "2.220446049250313e-16"   },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const double      VALUE    = DATA[ti].d_value;
+                const bsl::string EXPECTED = DATA[ti].d_expected;
+
+                const bsl::string result = format(VALUE);
+
+                if (veryVerbose) { T_ P_(LINE) P(result) }
+
+                ASSERTV(LINE, EXPECTED, result, EXPECTED == result);
+                ASSERTV(LINE, result.size() <= Util::k_DOUBLE_BUFFER_SIZE);
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'float'." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                float       d_value;     // value to format
+                const char *d_expected;  // expected output
+            } DATA[] = {
+                //LINE  VALUE             EXPECTED
+                //----  ----------------  ------------------
+                { L_,   0.0f,             "0"                },
+                { L_,   -0.0f,            "-0"               },
+                { L_,   1.0f,             "1"                },
+                { L_,   0.1f,             "0.1"              },
+                { L_,   0.3f,             "0.3"              },
+                { L_,   100.07f,          "100.07"           },
+                { L_,   123456789.0f,     "123456790"        },
+                { L_,   1e9f,             "1e+09"            },
+                { L_,   16777217.0f,      "16777216"         },
+                { L_,   0.0001f,          "0.0001"           },
+                { L_,   1e-5f,            "1e-05"            },
+                { L_,   1.4e-45f,         "1e-45"            },
+                { L_,   -1.17549435e-38f, "-1.1754944e-38"   },
+                { L_,   FLT_MAX,          "3.4028235e+38"    },
+                { L_,   FLT_EPSILON,      "1.1920929e-07"    },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const float       VALUE    = DATA[ti].d_value;
+                const bsl::string EXPECTED = DATA[ti].d_expected;
+
+                const bsl::string result = format(VALUE);
+
+                if (veryVerbose) { T_ P_(LINE) P(result) }
+
+                ASSERTV(LINE, EXPECTED, result, EXPECTED == result);
+                ASSERTV(LINE, result.size() <= Util::k_FLOAT_BUFFER_SIZE);
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[Util::k_DOUBLE_BUFFER_SIZE];
+
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0));
+            ASSERT_FAIL(Util::formatShortest(0,      1.0));
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0f));
+            ASSERT_FAIL(Util::formatShortest(0,      1.0f));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SHORTEST DIGITS
+        //
+        // Concerns:
+        //: 1 The digits and exponent of values whose shortest representation
+        //:   is known are produced exactly.
+        //:
+        //: 2 The sign of 'value' is ignored.
+        //:
+        //: 3 Zero produces "0" with an exponent of 0.
+        //:
+        //: 4 No trailing zeros are produced.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the digits and exponent
+        //:   for a set of 'double' values and of 'float' values.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointer arguments.  (C-5)
+        //
+        // Testing:
+        //   int shortestDigits(char *, int *, double);
+        //   int shortestDigits(char *, int *, float);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SHORTEST DIGITS" << endl
+                          << "===============" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            double      d_value;     // value
+            const char *d_digits;    // expected digits of the 'double'
+            int         d_exponent;  // expected exponent of the 'double'
+        } DATA[] = {
+            //LINE  VALUE                     DIGITS                 EXP
+            //----  ------------------------  ---------------------  ----
+            { L_,   0.0,                      "0",                      0 },
+            { L_,   -0.0,                     "0",                      0 },
+            { L_,   1.0,                      "1",                      0 },
+            { L_,   -1.0,                     "1",                      0 },
+            { L_,   10.0,                     "1",                      1 },
+            { L_,   1000.0,                   "1",                      3 },
+            { L_,   0.25,                     "25",                    -1 },
+            { L_,   1.5,                      "15",                     0 },
+            { L_,   3.0e-300,                 "3",                   -300 },
+            { L_,   1.7976931348623157e308,   "17976931348623157",    308 },
+            { L_,   4.9406564584124654e-324,  "5",                   -324 },
+            { L_,   2.2250738585072009e-308,  "2225073858507201",    -308 },
+            { L_,   0.1 + 0.2,                "30000000000000004",     -1 },
+            { L_,   123456789012345680.0,     "12345678901234568",     17 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) cout << "\tTesting 'double'." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const double      VALUE    = DATA[ti].d_value;
+            const bsl::string DIGITS   = DATA[ti].d_digits;
+            const int         EXPONENT = DATA[ti].d_exponent;
+
+            char digits[Util::k_MAX_DOUBLE_DIGITS];
+            int  exponent = -9999;
+
+            const int n = Util::shortestDigits(digits, &exponent, VALUE);
+
+            const bsl::string result(digits, n);
+
+            if (veryVerbose) { T_ P_(LINE) P_(result) P(exponent) }
+
+            ASSERTV(LINE, DIGITS, result, DIGITS == result);
+            ASSERTV(LINE, EXPONENT, exponent, EXPONENT == exponent);
+        }
+
+        if (verbose) cout << "\tTesting 'float'." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                float       d_value;     // value
+                const char *d_digits;    // expected digits
+                int         d_exponent;  // expected exponent
+            } FDATA[] = {
+                //LINE  VALUE             DIGITS        EXP
+                //----  ----------------  -----------   ---
+                { L_,   0.0f,             "0",            0 },
+                { L_,   1.0f,             "1",            0 },
+                { L_,   -0.1f,            "1",           -1 },
+                { L_,   3.14159274f,      "31415927",     0 },
+                { L_,   3.4028235e38f,    "34028235",    38 },
+                { L_,   1.4e-45f,         "1",          -45 },
+                { L_,   1.17549435e-38f,  "11754944",   -38 },
+                { L_,   16777216.0f,      "16777216",     7 },
+                { L_,   33554432.0f,      "33554432",     7 },
+            };
+            const int NUM_FDATA = sizeof FDATA / sizeof *FDATA;
+
+            for (int ti = 0; ti < NUM_FDATA; ++ti) {
+                const int         LINE     = FDATA[ti].d_line;
+                const float       VALUE    = FDATA[ti].d_value;
+                const bsl::string DIGITS   = FDATA[ti].d_digits;
+                const int         EXPONENT = FDATA[ti].d_exponent;
+
+                char digits[Util::k_MAX_FLOAT_DIGITS];
+                int  exponent = -9999;
+
+                const int n = Util::shortestDigits(digits, &exponent, VALUE);
+
+                const bsl::string result(digits, n);
+
+                if (veryVerbose) { T_ P_(LINE) P_(result) P(exponent) }
+
+                ASSERTV(LINE, DIGITS, result, DIGITS == result);
+                ASSERTV(LINE, EXPONENT, exponent, EXPONENT == exponent);
+            }
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char digits[Util::k_MAX_DOUBLE_DIGITS];
+            int  exponent;
+
+            ASSERT_PASS(Util::shortestDigits(digits, &exponent, 1.0));
+            ASSERT_FAIL(Util::shortestDigits(0,      &exponent, 1.0));
+            ASSERT_FAIL(Util::shortestDigits(digits, 0,         1.0));
+            ASSERT_PASS(Util::shortestDigits(digits, &exponent, 1.0f));
+            ASSERT_FAIL(Util::shortestDigits(0,      &exponent, 1.0f));
+            ASSERT_FAIL(Util::shortestDigits(digits, 0,         1.0f));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a few values of each type and verify the output.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ASSERTV(format(1.0),     "1"       == format(1.0));
+        ASSERTV(format(-0.5),    "-0.5"    == format(-0.5));
+        ASSERTV(format(1e-10),   "1e-10"   == format(1e-10));
+        ASSERTV(format(0.1f),    "0.1"     == format(0.1f));
+        ASSERTV(format(1.5, 1),  ""        == format(1.5, 1));
+        ASSERTV(format(1.5, 2),  "1.5"     == format(1.5, 2));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 'formatShortest' is substantially faster than 'snprintf' at the
+        //:   precision needed to round-trip.
+        //
+        // Plan:
+        //: 1 Format a set of pseudo-random 'double' values, drawn from both
+        //:   the full bit-pattern range and from "price-like" values having
+        //:   few digits, with 'formatShortest', 'formatShortest' at a
+        //:   precision of 15, 'snprintf("%.17g")', and 'snprintf("%.15g")',
+        //:   and report the time per value for each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_VALUES = 1 << 16;
+        const int NUM_ROUNDS = argc > 2 ? atoi(argv[2]) : 20;
+
+        double *values = new double[NUM_VALUES];
+
+        for (int mode = 0; mode < 2; ++mode) {
+            Uint64 state = 0x9e3779b97f4a7c15ULL;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                values[i] = 0 == mode
+                            ? randomDouble(&state)
+                            : static_cast<double>(nextRandom(&state) % 1000000)
+                                                                       / 100.0;
+            }
+
+            cout << (0 == mode ? "random bit patterns" : "prices") << endl;
+
+            for (int method = 0; method < 4; ++method) {
+                static const char *const NAMES[] = {
+                    "formatShortest(double)    ",
+                    "formatShortest(double, 15)",
+                    "snprintf(\"%.17g\")         ",
+                    "snprintf(\"%.15g\")         ",
+                };
+
+                char            buffer[64];
+                bsls::Types::Int64 sum = 0;
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int r = 0; r < NUM_ROUNDS; ++r) {
+                    for (int i = 0; i < NUM_VALUES; ++i) {
+                        switch (method) {
+                          case 0: {
+                            sum += Util::formatShortest(buffer, values[i]);
+                          } break;
+                          case 1: {
+                            sum += Util::formatShortest(buffer,
+                                                        values[i],
+                                                        15);
+                          } break;
+                          case 2: {
+                            sum += snprintf(buffer,
+                                            sizeof buffer,
+                                            "%.17g",
+                                            values[i]);
+                          } break;
+                          default: {
+                            sum += snprintf(buffer,
+                                            sizeof buffer,
+                                            "%.15g",
+                                            values[i]);
+                          } break;
+                        }
+                        sum += buffer[0];
+                    }
+                }
+
+                timer.stop();
+
+                const double NS = timer.elapsedTime() * 1e9
+                                / NUM_VALUES
+                                / NUM_ROUNDS;
+
+                cout << "  " << NAMES[method] << ": " << NS << " ns/value"
+                     << " (" << sum % 10 << ")" << endl;
+            }
+        }
+
+        delete[] values;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
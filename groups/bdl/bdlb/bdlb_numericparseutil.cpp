@@ -4,6 +4,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlb_numericparseutil_cpp, "$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
 #include <bdlb_chartype.h>
 
 #include <bslma_allocator.h>
@@ -12,8 +13,11 @@ BSLS_IDENT_RCSID(bdlb_numericparseutil_cpp, "$Id$ $CSID$")
 #include <bsls_platform.h>
 #include <bslmf_assert.h>
 
-#include <bsl_cstdlib.h>  // strtod
-#include <bsl_clocale.h>  // setlocale
+#include <bsl_algorithm.h>  // min
+#include <bsl_cfloat.h>     // FLT_EVAL_METHOD
+#include <bsl_cstdlib.h>    // strtod
+#include <bsl_cstring.h>    // memcpy
+#include <bsl_clocale.h>    // setlocale
 
 #if defined(BSLS_PLATFORM_CMP_MSVC) && BSLS_PLATFORM_CMP_VERSION < 1900
 // Needed for fixing the broken 'strtod', see below.
@@ -46,6 +50,703 @@ int doubleSign(double number)
 }
 #endif
 
+typedef bsls::Types::Uint64 Uint64;
+
+#if (defined(FLT_EVAL_METHOD) && 0 == FLT_EVAL_METHOD)                       \
+ || defined(BSLS_PLATFORM_CPU_64_BIT)
+#define U_ENABLE_EXACT_FAST_PATH 1
+    // Floating point arithmetic on 'double' is performed at 'double'
+    // precision (and not, e.g., on the extended precision x87 stack), so a
+    // single multiplication or division is correctly rounded.
+#endif
+
+#if defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
+#define U_ENABLE_SWAR_DIGITS 1
+    // Eight characters loaded into a 'Uint64' have the first character in the
+    // least significant byte, as assumed by 'eightDigitsValue'.
+#endif
+
+                          // ----------------------
+                          // decimal integer digits
+                          // ----------------------
+
+#ifdef U_ENABLE_SWAR_DIGITS
+inline
+Uint64 loadEightCharacters(const char *characters)
+    // Return the 8 characters starting at the specified 'characters' as a
+    // 'Uint64' having the first character in its least significant byte.
+{
+    Uint64 result;
+    bsl::memcpy(&result, characters, sizeof result);
+    return result;
+}
+
+inline
+bool isEightDigits(Uint64 characters)
+    // Return 'true' if each of the 8 bytes of the specified 'characters' is
+    // an ASCII decimal digit, and 'false' otherwise.  A byte is a digit if its
+    // upper nibble is 3 and adding 6 to it leaves its upper nibble unchanged.
+{
+    const Uint64 k_HIGH_NIBBLES = 0xf0f0f0f0f0f0f0f0ULL;
+
+    return ((characters & k_HIGH_NIBBLES)
+          | (((characters + 0x0606060606060606ULL) & k_HIGH_NIBBLES) >> 4))
+                                                     == 0x3333333333333333ULL;
+}
+
+inline
+Uint64 eightDigitsValue(Uint64 characters)
+    // Return the value of the 8-digit decimal number whose digits, most
+    // significant first, are the bytes of the specified 'characters' from
+    // least to most significant.  The behavior is undefined unless
+    // 'isEightDigits(characters)'.  Pairs, then quadruples, of digits are
+    // combined in parallel, using three multiplications in total.
+{
+    const Uint64 k_LOW_BYTES = 0x000000ff000000ffULL;
+
+    characters -= 0x3030303030303030ULL;
+    characters  = characters * 10 + (characters >> 8);
+    return ((characters & k_LOW_BYTES) * (100 + (1000000ULL << 32))
+          + ((characters >> 16) & k_LOW_BYTES) * (1 + (10000ULL << 32)))
+                                                                        >> 32;
+}
+#endif
+
+const char *parseDecimalDigits(Uint64     *result,
+                               const char *begin,
+                               const char *end,
+                               Uint64      maxValue)
+    // Load into the specified 'result' the value of the longest run of
+    // decimal digits starting at the specified 'begin' and ending no later
+    // than the specified 'end' whose value does not exceed the specified
+    // 'maxValue', and return the end of that run.  The digits consumed, and
+    // the value loaded, are identical to those of the generic loop in
+    // 'NumericParseUtil::parseUnsignedInteger' for base 10.  The behavior is
+    // undefined unless 'begin <= end'.
+{
+    const Uint64   maxCheck = maxValue / 10;
+    const unsigned maxLast  = static_cast<unsigned>(maxValue % 10);
+
+    const char *p   = begin;
+    Uint64      res = 0;
+
+#ifdef U_ENABLE_SWAR_DIGITS
+    // Consume runs of 8 digits while the value stays within 'maxValue'.  A
+    // run accepted here would also have been consumed digit by digit, because
+    // the intermediate values are strictly less than 'maxCheck' unless
+    // 'maxCheck' is 0 (in which case the generic loop stops after a leading
+    // '0').  At most two runs are consumed, so the value cannot overflow.
+
+    if (0 != maxCheck) {
+        for (int run = 0; run < 2 && end - p >= 8; ++run, p += 8) {
+            const Uint64 characters = loadEightCharacters(p);
+            if (!isEightDigits(characters)) {
+                break;                                                 // BREAK
+            }
+            const Uint64 candidate = res * 100000000u
+                                   + eightDigitsValue(characters);
+            if (candidate > maxValue) {
+                break;                                                 // BREAK
+            }
+            res = candidate;
+        }
+    }
+#endif
+
+    for (; p != end; ++p) {
+        const unsigned digit = static_cast<unsigned char>(*p) - '0';
+        if (digit > 9) {
+            break;                                                     // BREAK
+        }
+        if (res < maxCheck) {
+            res = res * 10 + digit;
+        }
+        else {
+            if (res == maxCheck && digit <= maxLast) {
+                res = res * 10 + digit;
+                ++p;
+            }
+            break;                                                     // BREAK
+        }
+    }
+
+    *result = res;
+    return p;
+}
+
+                        // -----------------------------
+                        // decimal to binary conversion
+                        // -----------------------------
+
+#ifdef U_ENABLE_EXACT_FAST_PATH
+const double k_EXACT_POWERS_OF_10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+    // The powers of ten that are exactly representable as 'double'.
+
+const Uint64 k_MAX_EXACT_SIGNIFICAND = static_cast<Uint64>(1) << 53;
+    // The bound up to which all integers are exactly representable as
+    // 'double'.
+#endif
+
+enum {
+    k_MIN_POWER_OF_10 = -326,  // smallest decimal exponent in the table
+    k_MAX_POWER_OF_10 =  308   // largest decimal exponent in the table
+};
+
+const unsigned int k_POWERS_OF_10[][2] = {
+    { 0x84a57695, 0xfe98746d }, { 0xa5ced43b, 0x7e3e9188 },
+    { 0xcf42894a, 0x5dce35ea }, { 0x818995ce, 0x7aa0e1b2 },
+    { 0xa1ebfb42, 0x19491a1f }, { 0xca66fa12, 0x9f9b60a6 },
+    { 0xfd00b897, 0x478238d0 }, { 0x9e20735e, 0x8cb16382 },
+    { 0xc5a89036, 0x2fddbc62 }, { 0xf712b443, 0xbbd52b7b },
+    { 0x9a6bb0aa, 0x55653b2d }, { 0xc1069cd4, 0xeabe89f8 },
+    { 0xf148440a, 0x256e2c76 }, { 0x96cd2a86, 0x5764dbca },
+    { 0xbc807527, 0xed3e12bc }, { 0xeba09271, 0xe88d976b },
+    { 0x93445b87, 0x31587ea3 }, { 0xb8157268, 0xfdae9e4c },
+    { 0xe61acf03, 0x3d1a45df }, { 0x8fd0c162, 0x06306bab },
+    { 0xb3c4f1ba, 0x87bc8696 }, { 0xe0b62e29, 0x29aba83c },
+    { 0x8c71dcd9, 0xba0b4925 }, { 0xaf8e5410, 0x288e1b6f },
+    { 0xdb71e914, 0x32b1a24a }, { 0x892731ac, 0x9faf056e },
+    { 0xab70fe17, 0xc79ac6ca }, { 0xd64d3d9d, 0xb981787d },
+    { 0x85f04682, 0x93f0eb4e }, { 0xa76c5823, 0x38ed2621 },
+    { 0xd1476e2c, 0x07286faa }, { 0x82cca4db, 0x847945ca },
+    { 0xa37fce12, 0x6597973c }, { 0xcc5fc196, 0xfefd7d0c },
+    { 0xff77b1fc, 0xbebcdc4f }, { 0x9faacf3d, 0xf73609b1 },
+    { 0xc795830d, 0x75038c1d }, { 0xf97ae3d0, 0xd2446f25 },
+    { 0x9becce62, 0x836ac577 }, { 0xc2e801fb, 0x244576d5 },
+    { 0xf3a20279, 0xed56d48a }, { 0x9845418c, 0x345644d6 },
+    { 0xbe5691ef, 0x416bd60c }, { 0xedec366b, 0x11c6cb8f },
+    { 0x94b3a202, 0xeb1c3f39 }, { 0xb9e08a83, 0xa5e34f07 },
+    { 0xe858ad24, 0x8f5c22c9 }, { 0x91376c36, 0xd99995be },
+    { 0xb5854744, 0x8ffffb2d }, { 0xe2e69915, 0xb3fff9f9 },
+    { 0x8dd01fad, 0x907ffc3b }, { 0xb1442798, 0xf49ffb4a },
+    { 0xdd95317f, 0x31c7fa1d }, { 0x8a7d3eef, 0x7f1cfc52 },
+    { 0xad1c8eab, 0x5ee43b66 }, { 0xd863b256, 0x369d4a40 },
+    { 0x873e4f75, 0xe2224e68 }, { 0xa90de353, 0x5aaae202 },
+    { 0xd3515c28, 0x31559a83 }, { 0x8412d999, 0x1ed58091 },
+    { 0xa5178fff, 0x668ae0b6 }, { 0xce5d73ff, 0x402d98e3 },
+    { 0x80fa687f, 0x881c7f8e }, { 0xa139029f, 0x6a239f72 },
+    { 0xc9874347, 0x44ac874e }, { 0xfbe91419, 0x15d7a922 },
+    { 0x9d71ac8f, 0xada6c9b5 }, { 0xc4ce17b3, 0x99107c22 },
+    { 0xf6019da0, 0x7f549b2b }, { 0x99c10284, 0x4f94e0fb },
+    { 0xc0314325, 0x637a1939 }, { 0xf03d93ee, 0xbc589f88 },
+    { 0x96267c75, 0x35b763b5 }, { 0xbbb01b92, 0x83253ca2 },
+    { 0xea9c2277, 0x23ee8bcb }, { 0x92a1958a, 0x7675175f },
+    { 0xb749faed, 0x14125d36 }, { 0xe51c79a8, 0x5916f484 },
+    { 0x8f31cc09, 0x37ae58d2 }, { 0xb2fe3f0b, 0x8599ef07 },
+    { 0xdfbdcece, 0x67006ac9 }, { 0x8bd6a141, 0x006042bd },
+    { 0xaecc4991, 0x4078536d }, { 0xda7f5bf5, 0x90966848 },
+    { 0x888f9979, 0x7a5e012d }, { 0xaab37fd7, 0xd8f58178 },
+    { 0xd5605fcd, 0xcf32e1d6 }, { 0x855c3be0, 0xa17fcd26 },
+    { 0xa6b34ad8, 0xc9dfc06f }, { 0xd0601d8e, 0xfc57b08b },
+    { 0x823c1279, 0x5db6ce57 }, { 0xa2cb1717, 0xb52481ed },
+    { 0xcb7ddcdd, 0xa26da268 }, { 0xfe5d5415, 0x0b090b02 },
+    { 0x9efa548d, 0x26e5a6e1 }, { 0xc6b8e9b0, 0x709f109a },
+    { 0xf867241c, 0x8cc6d4c0 }, { 0x9b407691, 0xd7fc44f8 },
+    { 0xc2109436, 0x4dfb5636 }, { 0xf294b943, 0xe17a2bc4 },
+    { 0x979cf3ca, 0x6cec5b5a }, { 0xbd8430bd, 0x08277231 },
+    { 0xece53cec, 0x4a314ebd }, { 0x940f4613, 0xae5ed136 },
+    { 0xb9131798, 0x99f68584 }, { 0xe757dd7e, 0xc07426e5 },
+    { 0x9096ea6f, 0x3848984f }, { 0xb4bca50b, 0x065abe63 },
+    { 0xe1ebce4d, 0xc7f16dfb }, { 0x8d3360f0, 0x9cf6e4bd },
+    { 0xb080392c, 0xc4349dec }, { 0xdca04777, 0xf541c567 },
+    { 0x89e42caa, 0xf9491b60 }, { 0xac5d37d5, 0xb79b6239 },
+    { 0xd77485cb, 0x25823ac7 }, { 0x86a8d39e, 0xf77164bc },
+    { 0xa8530886, 0xb54dbdeb }, { 0xd267caa8, 0x62a12d66 },
+    { 0x8380dea9, 0x3da4bc60 }, { 0xa4611653, 0x8d0deb78 },
+    { 0xcd795be8, 0x70516656 }, { 0x806bd971, 0x4632dff6 },
+    { 0xa086cfcd, 0x97bf97f3 }, { 0xc8a883c0, 0xfdaf7df0 },
+    { 0xfad2a4b1, 0x3d1b5d6c }, { 0x9cc3a6ee, 0xc6311a63 },
+    { 0xc3f490aa, 0x77bd60fc }, { 0xf4f1b4d5, 0x15acb93b },
+    { 0x99171105, 0x2d8bf3c5 }, { 0xbf5cd546, 0x78eef0b6 },
+    { 0xef340a98, 0x172aace4 }, { 0x9580869f, 0x0e7aac0e },
+    { 0xbae0a846, 0xd2195712 }, { 0xe998d258, 0x869facd7 },
+    { 0x91ff8377, 0x5423cc06 }, { 0xb67f6455, 0x292cbf08 },
+    { 0xe41f3d6a, 0x7377eeca }, { 0x8e938662, 0x882af53e },
+    { 0xb23867fb, 0x2a35b28d }, { 0xdec681f9, 0xf4c31f31 },
+    { 0x8b3c113c, 0x38f9f37e }, { 0xae0b158b, 0x4738705e },
+    { 0xd98ddaee, 0x19068c76 }, { 0x87f8a8d4, 0xcfa417c9 },
+    { 0xa9f6d30a, 0x038d1dbc }, { 0xd47487cc, 0x8470652b },
+    { 0x84c8d4df, 0xd2c63f3b }, { 0xa5fb0a17, 0xc777cf09 },
+    { 0xcf79cc9d, 0xb955c2cc }, { 0x81ac1fe2, 0x93d599bf },
+    { 0xa21727db, 0x38cb002f }, { 0xca9cf1d2, 0x06fdc03b },
+    { 0xfd442e46, 0x88bd304a }, { 0x9e4a9cec, 0x15763e2e },
+    { 0xc5dd4427, 0x1ad3cdba }, { 0xf7549530, 0xe188c128 },
+    { 0x9a94dd3e, 0x8cf578b9 }, { 0xc13a148e, 0x3032d6e7 },
+    { 0xf18899b1, 0xbc3f8ca1 }, { 0x96f5600f, 0x15a7b7e5 },
+    { 0xbcb2b812, 0xdb11a5de }, { 0xebdf6617, 0x91d60f56 },
+    { 0x936b9fce, 0xbb25c995 }, { 0xb84687c2, 0x69ef3bfb },
+    { 0xe65829b3, 0x046b0afa }, { 0x8ff71a0f, 0xe2c2e6dc },
+    { 0xb3f4e093, 0xdb73a093 }, { 0xe0f218b8, 0xd25088b8 },
+    { 0x8c974f73, 0x83725573 }, { 0xafbd2350, 0x644eeacf },
+    { 0xdbac6c24, 0x7d62a583 }, { 0x894bc396, 0xce5da772 },
+    { 0xab9eb47c, 0x81f5114f }, { 0xd686619b, 0xa27255a2 },
+    { 0x8613fd01, 0x45877585 }, { 0xa798fc41, 0x96e952e7 },
+    { 0xd17f3b51, 0xfca3a7a0 }, { 0x82ef8513, 0x3de648c4 },
+    { 0xa3ab6658, 0x0d5fdaf5 }, { 0xcc963fee, 0x10b7d1b3 },
+    { 0xffbbcfe9, 0x94e5c61f }, { 0x9fd561f1, 0xfd0f9bd3 },
+    { 0xc7caba6e, 0x7c5382c8 }, { 0xf9bd690a, 0x1b68637b },
+    { 0x9c1661a6, 0x51213e2d }, { 0xc31bfa0f, 0xe5698db8 },
+    { 0xf3e2f893, 0xdec3f126 }, { 0x986ddb5c, 0x6b3a76b7 },
+    { 0xbe895233, 0x86091465 }, { 0xee2ba6c0, 0x678b597f },
+    { 0x94db4838, 0x40b717ef }, { 0xba121a46, 0x50e4ddeb },
+    { 0xe896a0d7, 0xe51e1566 }, { 0x915e2486, 0xef32cd60 },
+    { 0xb5b5ada8, 0xaaff80b8 }, { 0xe3231912, 0xd5bf60e6 },
+    { 0x8df5efab, 0xc5979c8f }, { 0xb1736b96, 0xb6fd83b3 },
+    { 0xddd0467c, 0x64bce4a0 }, { 0x8aa22c0d, 0xbef60ee4 },
+    { 0xad4ab711, 0x2eb3929d }, { 0xd89d64d5, 0x7a607744 },
+    { 0x87625f05, 0x6c7c4a8b }, { 0xa93af6c6, 0xc79b5d2d },
+    { 0xd389b478, 0x79823479 }, { 0x843610cb, 0x4bf160cb },
+    { 0xa54394fe, 0x1eedb8fe }, { 0xce947a3d, 0xa6a9273e },
+    { 0x811ccc66, 0x8829b887 }, { 0xa163ff80, 0x2a3426a8 },
+    { 0xc9bcff60, 0x34c13052 }, { 0xfc2c3f38, 0x41f17c67 },
+    { 0x9d9ba783, 0x2936edc0 }, { 0xc5029163, 0xf384a931 },
+    { 0xf64335bc, 0xf065d37d }, { 0x99ea0196, 0x163fa42e },
+    { 0xc06481fb, 0x9bcf8d39 }, { 0xf07da27a, 0x82c37088 },
+    { 0x964e858c, 0x91ba2655 }, { 0xbbe226ef, 0xb628afea },
+    { 0xeadab0ab, 0xa3b2dbe5 }, { 0x92c8ae6b, 0x464fc96f },
+    { 0xb77ada06, 0x17e3bbcb }, { 0xe5599087, 0x9ddcaabd },
+    { 0x8f57fa54, 0xc2a9eab6 }, { 0xb32df8e9, 0xf3546564 },
+    { 0xdff97724, 0x70297ebd }, { 0x8bfbea76, 0xc619ef36 },
+    { 0xaefae514, 0x77a06b03 }, { 0xdab99e59, 0x958885c4 },
+    { 0x88b402f7, 0xfd75539b }, { 0xaae103b5, 0xfcd2a881 },
+    { 0xd59944a3, 0x7c0752a2 }, { 0x857fcae6, 0x2d8493a5 },
+    { 0xa6dfbd9f, 0xb8e5b88e }, { 0xd097ad07, 0xa71f26b2 },
+    { 0x825ecc24, 0xc873782f }, { 0xa2f67f2d, 0xfa90563b },
+    { 0xcbb41ef9, 0x79346bca }, { 0xfea126b7, 0xd78186bc },
+    { 0x9f24b832, 0xe6b0f436 }, { 0xc6ede63f, 0xa05d3143 },
+    { 0xf8a95fcf, 0x88747d94 }, { 0x9b69dbe1, 0xb548ce7c },
+    { 0xc24452da, 0x229b021b }, { 0xf2d56790, 0xab41c2a2 },
+    { 0x97c560ba, 0x6b0919a5 }, { 0xbdb6b8e9, 0x05cb600f },
+    { 0xed246723, 0x473e3813 }, { 0x9436c076, 0x0c86e30b },
+    { 0xb9447093, 0x8fa89bce }, { 0xe7958cb8, 0x7392c2c2 },
+    { 0x90bd77f3, 0x483bb9b9 }, { 0xb4ecd5f0, 0x1a4aa828 },
+    { 0xe2280b6c, 0x20dd5232 }, { 0x8d590723, 0x948a535f },
+    { 0xb0af48ec, 0x79ace837 }, { 0xdcdb1b27, 0x98182244 },
+    { 0x8a08f0f8, 0xbf0f156b }, { 0xac8b2d36, 0xeed2dac5 },
+    { 0xd7adf884, 0xaa879177 }, { 0x86ccbb52, 0xea94baea },
+    { 0xa87fea27, 0xa539e9a5 }, { 0xd29fe4b1, 0x8e88640e },
+    { 0x83a3eeee, 0xf9153e89 }, { 0xa48ceaaa, 0xb75a8e2b },
+    { 0xcdb02555, 0x653131b6 }, { 0x808e1755, 0x5f3ebf11 },
+    { 0xa0b19d2a, 0xb70e6ed6 }, { 0xc8de0475, 0x64d20a8b },
+    { 0xfb158592, 0xbe068d2e }, { 0x9ced737b, 0xb6c4183d },
+    { 0xc428d05a, 0xa4751e4c }, { 0xf5330471, 0x4d9265df },
+    { 0x993fe2c6, 0xd07b7fab }, { 0xbf8fdb78, 0x849a5f96 },
+    { 0xef73d256, 0xa5c0f77c }, { 0x95a86376, 0x27989aad },
+    { 0xbb127c53, 0xb17ec159 }, { 0xe9d71b68, 0x9dde71af },
+    { 0x92267121, 0x62ab070d }, { 0xb6b00d69, 0xbb55c8d1 },
+    { 0xe45c10c4, 0x2a2b3b05 }, { 0x8eb98a7a, 0x9a5b04e3 },
+    { 0xb267ed19, 0x40f1c61c }, { 0xdf01e85f, 0x912e37a3 },
+    { 0x8b61313b, 0xbabce2c6 }, { 0xae397d8a, 0xa96c1b77 },
+    { 0xd9c7dced, 0x53c72255 }, { 0x881cea14, 0x545c7575 },
+    { 0xaa242499, 0x697392d2 }, { 0xd4ad2dbf, 0xc3d07787 },
+    { 0x84ec3c97, 0xda624ab4 }, { 0xa6274bbd, 0xd0fadd61 },
+    { 0xcfb11ead, 0x453994ba }, { 0x81ceb32c, 0x4b43fcf4 },
+    { 0xa2425ff7, 0x5e14fc31 }, { 0xcad2f7f5, 0x359a3b3e },
+    { 0xfd87b5f2, 0x8300ca0d }, { 0x9e74d1b7, 0x91e07e48 },
+    { 0xc6120625, 0x76589dda }, { 0xf79687ae, 0xd3eec551 },
+    { 0x9abe14cd, 0x44753b52 }, { 0xc16d9a00, 0x95928a27 },
+    { 0xf1c90080, 0xbaf72cb1 }, { 0x971da050, 0x74da7bee },
+    { 0xbce50864, 0x92111aea }, { 0xec1e4a7d, 0xb69561a5 },
+    { 0x9392ee8e, 0x921d5d07 }, { 0xb877aa32, 0x36a4b449 },
+    { 0xe69594be, 0xc44de15b }, { 0x901d7cf7, 0x3ab0acd9 },
+    { 0xb424dc35, 0x095cd80f }, { 0xe12e1342, 0x4bb40e13 },
+    { 0x8cbccc09, 0x6f5088cb }, { 0xafebff0b, 0xcb24aafe },
+    { 0xdbe6fece, 0xbdedd5be }, { 0x89705f41, 0x36b4a597 },
+    { 0xabcc7711, 0x8461cefc }, { 0xd6bf94d5, 0xe57a42bc },
+    { 0x8637bd05, 0xaf6c69b5 }, { 0xa7c5ac47, 0x1b478423 },
+    { 0xd1b71758, 0xe219652b }, { 0x83126e97, 0x8d4fdf3b },
+    { 0xa3d70a3d, 0x70a3d70a }, { 0xcccccccc, 0xcccccccc },
+    { 0x80000000, 0x00000000 }, { 0xa0000000, 0x00000000 },
+    { 0xc8000000, 0x00000000 }, { 0xfa000000, 0x00000000 },
+    { 0x9c400000, 0x00000000 }, { 0xc3500000, 0x00000000 },
+    { 0xf4240000, 0x00000000 }, { 0x98968000, 0x00000000 },
+    { 0xbebc2000, 0x00000000 }, { 0xee6b2800, 0x00000000 },
+    { 0x9502f900, 0x00000000 }, { 0xba43b740, 0x00000000 },
+    { 0xe8d4a510, 0x00000000 }, { 0x9184e72a, 0x00000000 },
+    { 0xb5e620f4, 0x80000000 }, { 0xe35fa931, 0xa0000000 },
+    { 0x8e1bc9bf, 0x04000000 }, { 0xb1a2bc2e, 0xc5000000 },
+    { 0xde0b6b3a, 0x76400000 }, { 0x8ac72304, 0x89e80000 },
+    { 0xad78ebc5, 0xac620000 }, { 0xd8d726b7, 0x177a8000 },
+    { 0x87867832, 0x6eac9000 }, { 0xa968163f, 0x0a57b400 },
+    { 0xd3c21bce, 0xcceda100 }, { 0x84595161, 0x401484a0 },
+    { 0xa56fa5b9, 0x9019a5c8 }, { 0xcecb8f27, 0xf4200f3a },
+    { 0x813f3978, 0xf8940984 }, { 0xa18f07d7, 0x36b90be5 },
+    { 0xc9f2c9cd, 0x04674ede }, { 0xfc6f7c40, 0x45812296 },
+    { 0x9dc5ada8, 0x2b70b59d }, { 0xc5371912, 0x364ce305 },
+    { 0xf684df56, 0xc3e01bc6 }, { 0x9a130b96, 0x3a6c115c },
+    { 0xc097ce7b, 0xc90715b3 }, { 0xf0bdc21a, 0xbb48db20 },
+    { 0x96769950, 0xb50d88f4 }, { 0xbc143fa4, 0xe250eb31 },
+    { 0xeb194f8e, 0x1ae525fd }, { 0x92efd1b8, 0xd0cf37be },
+    { 0xb7abc627, 0x050305ad }, { 0xe596b7b0, 0xc643c719 },
+    { 0x8f7e32ce, 0x7bea5c6f }, { 0xb35dbf82, 0x1ae4f38b },
+    { 0xe0352f62, 0xa19e306e }, { 0x8c213d9d, 0xa502de45 },
+    { 0xaf298d05, 0x0e4395d6 }, { 0xdaf3f046, 0x51d47b4c },
+    { 0x88d8762b, 0xf324cd0f }, { 0xab0e93b6, 0xefee0053 },
+    { 0xd5d238a4, 0xabe98068 }, { 0x85a36366, 0xeb71f041 },
+    { 0xa70c3c40, 0xa64e6c51 }, { 0xd0cf4b50, 0xcfe20765 },
+    { 0x82818f12, 0x81ed449f }, { 0xa321f2d7, 0x226895c7 },
+    { 0xcbea6f8c, 0xeb02bb39 }, { 0xfee50b70, 0x25c36a08 },
+    { 0x9f4f2726, 0x179a2245 }, { 0xc722f0ef, 0x9d80aad6 },
+    { 0xf8ebad2b, 0x84e0d58b }, { 0x9b934c3b, 0x330c8577 },
+    { 0xc2781f49, 0xffcfa6d5 }, { 0xf316271c, 0x7fc3908a },
+    { 0x97edd871, 0xcfda3a56 }, { 0xbde94e8e, 0x43d0c8ec },
+    { 0xed63a231, 0xd4c4fb27 }, { 0x945e455f, 0x24fb1cf8 },
+    { 0xb975d6b6, 0xee39e436 }, { 0xe7d34c64, 0xa9c85d44 },
+    { 0x90e40fbe, 0xea1d3a4a }, { 0xb51d13ae, 0xa4a488dd },
+    { 0xe264589a, 0x4dcdab14 }, { 0x8d7eb760, 0x70a08aec },
+    { 0xb0de6538, 0x8cc8ada8 }, { 0xdd15fe86, 0xaffad912 },
+    { 0x8a2dbf14, 0x2dfcc7ab }, { 0xacb92ed9, 0x397bf996 },
+    { 0xd7e77a8f, 0x87daf7fb }, { 0x86f0ac99, 0xb4e8dafd },
+    { 0xa8acd7c0, 0x222311bc }, { 0xd2d80db0, 0x2aabd62b },
+    { 0x83c7088e, 0x1aab65db }, { 0xa4b8cab1, 0xa1563f52 },
+    { 0xcde6fd5e, 0x09abcf26 }, { 0x80b05e5a, 0xc60b6178 },
+    { 0xa0dc75f1, 0x778e39d6 }, { 0xc913936d, 0xd571c84c },
+    { 0xfb587849, 0x4ace3a5f }, { 0x9d174b2d, 0xcec0e47b },
+    { 0xc45d1df9, 0x42711d9a }, { 0xf5746577, 0x930d6500 },
+    { 0x9968bf6a, 0xbbe85f20 }, { 0xbfc2ef45, 0x6ae276e8 },
+    { 0xefb3ab16, 0xc59b14a2 }, { 0x95d04aee, 0x3b80ece5 },
+    { 0xbb445da9, 0xca61281f }, { 0xea157514, 0x3cf97226 },
+    { 0x924d692c, 0xa61be758 }, { 0xb6e0c377, 0xcfa2e12e },
+    { 0xe498f455, 0xc38b997a }, { 0x8edf98b5, 0x9a373fec },
+    { 0xb2977ee3, 0x00c50fe7 }, { 0xdf3d5e9b, 0xc0f653e1 },
+    { 0x8b865b21, 0x5899f46c }, { 0xae67f1e9, 0xaec07187 },
+    { 0xda01ee64, 0x1a708de9 }, { 0x884134fe, 0x908658b2 },
+    { 0xaa51823e, 0x34a7eede }, { 0xd4e5e2cd, 0xc1d1ea96 },
+    { 0x850fadc0, 0x9923329e }, { 0xa6539930, 0xbf6bff45 },
+    { 0xcfe87f7c, 0xef46ff16 }, { 0x81f14fae, 0x158c5f6e },
+    { 0xa26da399, 0x9aef7749 }, { 0xcb090c80, 0x01ab551c },
+    { 0xfdcb4fa0, 0x02162a63 }, { 0x9e9f11c4, 0x014dda7e },
+    { 0xc646d635, 0x01a1511d }, { 0xf7d88bc2, 0x4209a565 },
+    { 0x9ae75759, 0x6946075f }, { 0xc1a12d2f, 0xc3978937 },
+    { 0xf209787b, 0xb47d6b84 }, { 0x9745eb4d, 0x50ce6332 },
+    { 0xbd176620, 0xa501fbff }, { 0xec5d3fa8, 0xce427aff },
+    { 0x93ba47c9, 0x80e98cdf }, { 0xb8a8d9bb, 0xe123f017 },
+    { 0xe6d3102a, 0xd96cec1d }, { 0x9043ea1a, 0xc7e41392 },
+    { 0xb454e4a1, 0x79dd1877 }, { 0xe16a1dc9, 0xd8545e94 },
+    { 0x8ce2529e, 0x2734bb1d }, { 0xb01ae745, 0xb101e9e4 },
+    { 0xdc21a117, 0x1d42645d }, { 0x899504ae, 0x72497eba },
+    { 0xabfa45da, 0x0edbde69 }, { 0xd6f8d750, 0x9292d603 },
+    { 0x865b8692, 0x5b9bc5c2 }, { 0xa7f26836, 0xf282b732 },
+    { 0xd1ef0244, 0xaf2364ff }, { 0x8335616a, 0xed761f1f },
+    { 0xa402b9c5, 0xa8d3a6e7 }, { 0xcd036837, 0x130890a1 },
+    { 0x80222122, 0x6be55a64 }, { 0xa02aa96b, 0x06deb0fd },
+    { 0xc83553c5, 0xc8965d3d }, { 0xfa42a8b7, 0x3abbf48c },
+    { 0x9c69a972, 0x84b578d7 }, { 0xc38413cf, 0x25e2d70d },
+    { 0xf46518c2, 0xef5b8cd1 }, { 0x98bf2f79, 0xd5993802 },
+    { 0xbeeefb58, 0x4aff8603 }, { 0xeeaaba2e, 0x5dbf6784 },
+    { 0x952ab45c, 0xfa97a0b2 }, { 0xba756174, 0x393d88df },
+    { 0xe912b9d1, 0x478ceb17 }, { 0x91abb422, 0xccb812ee },
+    { 0xb616a12b, 0x7fe617aa }, { 0xe39c4976, 0x5fdf9d94 },
+    { 0x8e41ade9, 0xfbebc27d }, { 0xb1d21964, 0x7ae6b31c },
+    { 0xde469fbd, 0x99a05fe3 }, { 0x8aec23d6, 0x80043bee },
+    { 0xada72ccc, 0x20054ae9 }, { 0xd910f7ff, 0x28069da4 },
+    { 0x87aa9aff, 0x79042286 }, { 0xa99541bf, 0x57452b28 },
+    { 0xd3fa922f, 0x2d1675f2 }, { 0x847c9b5d, 0x7c2e09b7 },
+    { 0xa59bc234, 0xdb398c25 }, { 0xcf02b2c2, 0x1207ef2e },
+    { 0x8161afb9, 0x4b44f57d }, { 0xa1ba1ba7, 0x9e1632dc },
+    { 0xca28a291, 0x859bbf93 }, { 0xfcb2cb35, 0xe702af78 },
+    { 0x9defbf01, 0xb061adab }, { 0xc56baec2, 0x1c7a1916 },
+    { 0xf6c69a72, 0xa3989f5b }, { 0x9a3c2087, 0xa63f6399 },
+    { 0xc0cb28a9, 0x8fcf3c7f }, { 0xf0fdf2d3, 0xf3c30b9f },
+    { 0x969eb7c4, 0x7859e743 }, { 0xbc4665b5, 0x96706114 },
+    { 0xeb57ff22, 0xfc0c7959 }, { 0x9316ff75, 0xdd87cbd8 },
+    { 0xb7dcbf53, 0x54e9bece }, { 0xe5d3ef28, 0x2a242e81 },
+    { 0x8fa47579, 0x1a569d10 }, { 0xb38d92d7, 0x60ec4455 },
+    { 0xe070f78d, 0x3927556a }, { 0x8c469ab8, 0x43b89562 },
+    { 0xaf584166, 0x54a6babb }, { 0xdb2e51bf, 0xe9d0696a },
+    { 0x88fcf317, 0xf22241e2 }, { 0xab3c2fdd, 0xeeaad25a },
+    { 0xd60b3bd5, 0x6a5586f1 }, { 0x85c70565, 0x62757456 },
+    { 0xa738c6be, 0xbb12d16c }, { 0xd106f86e, 0x69d785c7 },
+    { 0x82a45b45, 0x0226b39c }, { 0xa34d7216, 0x42b06084 },
+    { 0xcc20ce9b, 0xd35c78a5 }, { 0xff290242, 0xc83396ce },
+    { 0x9f79a169, 0xbd203e41 }, { 0xc75809c4, 0x2c684dd1 },
+    { 0xf92e0c35, 0x37826145 }, { 0x9bbcc7a1, 0x42b17ccb },
+    { 0xc2abf989, 0x935ddbfe }, { 0xf356f7eb, 0xf83552fe },
+    { 0x98165af3, 0x7b2153de }, { 0xbe1bf1b0, 0x59e9a8d6 },
+    { 0xeda2ee1c, 0x7064130c }, { 0x9485d4d1, 0xc63e8be7 },
+    { 0xb9a74a06, 0x37ce2ee1 }, { 0xe8111c87, 0xc5c1ba99 },
+    { 0x910ab1d4, 0xdb9914a0 }, { 0xb54d5e4a, 0x127f59c8 },
+    { 0xe2a0b5dc, 0x971f303a }, { 0x8da471a9, 0xde737e24 },
+    { 0xb10d8e14, 0x56105dad }, { 0xdd50f199, 0x6b947518 },
+    { 0x8a5296ff, 0xe33cc92f }, { 0xace73cbf, 0xdc0bfb7b },
+    { 0xd8210bef, 0xd30efa5a }, { 0x8714a775, 0xe3e95c78 },
+    { 0xa8d9d153, 0x5ce3b396 }, { 0xd31045a8, 0x341ca07c },
+    { 0x83ea2b89, 0x2091e44d }, { 0xa4e4b66b, 0x68b65d60 },
+    { 0xce1de406, 0x42e3f4b9 }, { 0x80d2ae83, 0xe9ce78f3 },
+    { 0xa1075a24, 0xe4421730 }, { 0xc94930ae, 0x1d529cfc },
+    { 0xfb9b7cd9, 0xa4a7443c }, { 0x9d412e08, 0x06e88aa5 },
+    { 0xc491798a, 0x08a2ad4e }, { 0xf5b5d7ec, 0x8acb58a2 },
+    { 0x9991a6f3, 0xd6bf1765 }, { 0xbff610b0, 0xcc6edd3f },
+    { 0xeff394dc, 0xff8a948e }, { 0x95f83d0a, 0x1fb69cd9 },
+    { 0xbb764c4c, 0xa7a4440f }, { 0xea53df5f, 0xd18d5513 },
+    { 0x92746b9b, 0xe2f8552c }, { 0xb7118682, 0xdbb66a77 },
+    { 0xe4d5e823, 0x92a40515 }, { 0x8f05b116, 0x3ba6832d },
+    { 0xb2c71d5b, 0xca9023f8 }, { 0xdf78e4b2, 0xbd342cf6 },
+    { 0x8bab8eef, 0xb6409c1a }, { 0xae9672ab, 0xa3d0c320 },
+    { 0xda3c0f56, 0x8cc4f3e8 }, { 0x88658996, 0x17fb1871 },
+    { 0xaa7eebfb, 0x9df9de8d }, { 0xd51ea6fa, 0x85785631 },
+    { 0x8533285c, 0x936b35de }, { 0xa67ff273, 0xb8460356 },
+    { 0xd01fef10, 0xa657842c }, { 0x8213f56a, 0x67f6b29b },
+    { 0xa298f2c5, 0x01f45f42 }, { 0xcb3f2f76, 0x42717713 },
+    { 0xfe0efb53, 0xd30dd4d7 }, { 0x9ec95d14, 0x63e8a506 },
+    { 0xc67bb459, 0x7ce2ce48 }, { 0xf81aa16f, 0xdc1b81da },
+    { 0x9b10a4e5, 0xe9913128 }, { 0xc1d4ce1f, 0x63f57d72 },
+    { 0xf24a01a7, 0x3cf2dccf }, { 0x976e4108, 0x8617ca01 },
+    { 0xbd49d14a, 0xa79dbc82 }, { 0xec9c459d, 0x51852ba2 },
+    { 0x93e1ab82, 0x52f33b45 }, { 0xb8da1662, 0xe7b00a17 },
+    { 0xe7109bfb, 0xa19c0c9d }, { 0x906a617d, 0x450187e2 },
+    { 0xb484f9dc, 0x9641e9da }, { 0xe1a63853, 0xbbd26451 },
+    { 0x8d07e334, 0x55637eb2 }, { 0xb049dc01, 0x6abc5e5f },
+    { 0xdc5c5301, 0xc56b75f7 }, { 0x89b9b3e1, 0x1b6329ba },
+    { 0xac2820d9, 0x623bf429 }, { 0xd732290f, 0xbacaf133 },
+    { 0x867f59a9, 0xd4bed6c0 }, { 0xa81f3014, 0x49ee8c70 },
+    { 0xd226fc19, 0x5c6a2f8c }, { 0x83585d8f, 0xd9c25db7 },
+    { 0xa42e74f3, 0xd032f525 }, { 0xcd3a1230, 0xc43fb26f },
+    { 0x80444b5e, 0x7aa7cf85 }, { 0xa0555e36, 0x1951c366 },
+    { 0xc86ab5c3, 0x9fa63440 }, { 0xfa856334, 0x878fc150 },
+    { 0x9c935e00, 0xd4b9d8d2 }, { 0xc3b83581, 0x09e84f07 },
+    { 0xf4a642e1, 0x4c6262c8 }, { 0x98e7e9cc, 0xcfbd7dbd },
+    { 0xbf21e440, 0x03acdd2c }, { 0xeeea5d50, 0x04981478 },
+    { 0x95527a52, 0x02df0ccb }, { 0xbaa718e6, 0x8396cffd },
+    { 0xe950df20, 0x247c83fd }, { 0x91d28b74, 0x16cdd27e },
+    { 0xb6472e51, 0x1c81471d }, { 0xe3d8f9e5, 0x63a198e5 },
+    { 0x8e679c2f, 0x5e44ff8f }
+};
+    // The upper and lower 32 bits of the 64-bit significand, truncated and
+    // normalized so that its most significant bit is set, of '10^q' for 'q'
+    // in '[k_MIN_POWER_OF_10 .. k_MAX_POWER_OF_10]'.  The binary exponent of
+    // '10^q' is computed by 'binaryExponentOfPowerOf10'.
+
+inline
+int binaryExponentOfPowerOf10(int decimalExponent)
+    // Return 'floor(decimalExponent * log2(10))'.  The behavior is undefined
+    // unless '-1500 < decimalExponent < 1500'.  Note that 217706 is
+    // '2^16 * log2(10)', rounded up.
+{
+    return (217706 * decimalExponent) >> 16;
+}
+
+inline
+Uint64 multiplyHigh(Uint64 lhs, Uint64 rhs)
+    // Return the upper 64 bits of the 128-bit product of the specified 'lhs'
+    // and 'rhs'.
+{
+    const Uint64 k_MASK = 0xffffffffu;
+
+    const Uint64 a = lhs >> 32;
+    const Uint64 b = lhs & k_MASK;
+    const Uint64 c = rhs >> 32;
+    const Uint64 d = rhs & k_MASK;
+
+    const Uint64 ac = a * c;
+    const Uint64 bc = b * c;
+    const Uint64 ad = a * d;
+    const Uint64 bd = b * d;
+
+    const Uint64 middle = (bd >> 32) + (ad & k_MASK) + (bc & k_MASK);
+
+    return ac + (ad >> 32) + (bc >> 32) + (middle >> 32);
+}
+
+bool convertDecimal(double *result, Uint64 significand, int exponent)
+    // Load into the specified 'result' the correctly rounded 'double' value
+    // of 'significand * 10^exponent' for the specified 'significand' and
+    // 'exponent', and return 'true', if that value is a normal finite number
+    // whose rounding can be decided from a 64-bit approximation of
+    // '10^exponent'; otherwise, return 'false' with no effect.  The behavior
+    // is undefined unless '0 != significand'.
+    //
+    // This is the algorithm of Daniel Lemire, "Number Parsing at a Gigabyte
+    // per Second", Software: Practice and Experience 51(8), 2021 (after
+    // Michael Eisel), using a single-word table.  The normalized significand
+    // is multiplied by the truncated significand of '10^exponent'; since the
+    // truncation error is less than 1, the exact product lies in
+    // '[product, product + 2^64)', which changes the upper word by at most
+    // 1.  The upper 54 bits of the upper word determine the result and
+    // its rounding bit, except when the bits below the rounding position are
+    // within 1 of exactly half, in which case 'false' is returned.
+{
+    if (exponent < k_MIN_POWER_OF_10 || exponent > k_MAX_POWER_OF_10) {
+        return false;                                                 // RETURN
+    }
+
+    const unsigned int *power = k_POWERS_OF_10[exponent - k_MIN_POWER_OF_10];
+
+    const int    shift = BitUtil::numLeadingUnsetBits(
+                                      static_cast<BitUtil::uint64_t>(
+                                                                significand));
+    const Uint64 normalized = significand << shift;
+
+    const Uint64 high = multiplyHigh(
+                          normalized,
+                          (static_cast<Uint64>(power[0]) << 32) | power[1]);
+
+    // The most significant bit of 'high' is bit 63 or 62.  Keep 53 bits
+    // below it, and the bits below those for rounding.
+
+    const int    upperBit  = static_cast<int>(high >> 63);
+    const int    dropped   = upperBit + 10;
+    const Uint64 half      = static_cast<Uint64>(1) << (dropped - 1);
+    const Uint64 remaining = high & ((half << 1) - 1);
+
+    if (remaining == half || remaining == half - 1) {
+        return false;                                                 // RETURN
+    }
+
+    Uint64 mantissa       = high >> dropped;
+    int    biasedExponent = binaryExponentOfPowerOf10(exponent)
+                          + 63
+                          + upperBit
+                          - shift
+                          + 1023;
+
+    if (remaining > half) {
+        ++mantissa;
+        if (mantissa >> 53) {
+            mantissa >>= 1;
+            ++biasedExponent;
+        }
+    }
+
+    if (biasedExponent <= 0 || biasedExponent >= 0x7ff) {
+        // The result is subnormal, zero, or infinite, for which 'strtod'
+        // reports a range error.
+
+        return false;                                                 // RETURN
+    }
+
+    const Uint64 bits = (static_cast<Uint64>(biasedExponent) << 52)
+                      | (mantissa & ((static_cast<Uint64>(1) << 52) - 1));
+    bsl::memcpy(result, &bits, sizeof *result);
+    return true;
+}
+
+bool parseDecimal(double                   *result,
+                  bsl::size_t              *length,
+                  const bslstl::StringRef&  inputString)
+    // Parse the decimal floating point number at the start of the specified
+    // 'inputString' if its value can be computed quickly; if so, load the
+    // value into the specified 'result', load the number of characters parsed
+    // into the specified 'length', and return 'true'.  Otherwise, return
+    // 'false' with no effect.  The text accepted, and the value computed, are
+    // identical to those of 'strtod'.  The behavior is undefined unless
+    // 'inputString' is not empty and does not start with a space.
+    //
+    // When the decimal significand, 'w', is at most 2^53 and the decimal
+    // exponent, 'q', satisfies '|q| <= 22', the value is computed by a single
+    // correctly rounded multiplication or division of the exact 'double'
+    // values 'w' and '10^|q|' (see William D. Clinger, "How to Read Floating
+    // Point Numbers Accurately", PLDI 1990).  Otherwise, if 'w' has at most 19
+    // digits, the value is computed by 'convertDecimal'.  Other inputs,
+    // including hexadecimal numbers, infinities and NaNs, inputs whose result
+    // would overflow or underflow, and malformed text, are left to 'strtod'.
+{
+    enum { k_MAX_DIGITS = 19 };  // digits that always fit in 'Uint64'
+
+    const char       *p   = inputString.data();
+    const char *const end = p + inputString.length();
+
+    const bool isNegative = '-' == *p;
+    if (isNegative || '+' == *p) {
+        ++p;
+    }
+
+    // Skip leading zeros, which are not significant, rejecting hexadecimal
+    // numbers.
+
+    const char *const digitsBegin = p;
+    while (p != end && '0' == *p) {
+        ++p;
+    }
+    if (p != end && ('x' == *p || 'X' == *p) && p != digitsBegin) {
+        return false;                                                 // RETURN
+    }
+
+    Uint64 significand = 0;
+    int    numDigits   = 0;
+    int    exponent    = 0;
+    bool   hasDigits   = p != digitsBegin;
+
+    for (; p != end && static_cast<unsigned>(*p - '0') < 10; ++p) {
+        significand = significand * 10 + (*p - '0');
+        ++numDigits;
+    }
+    hasDigits = hasDigits || 0 != numDigits;
+
+    if (p != end && '.' == *p) {
+        ++p;
+        const char *const fractionBegin = p;
+        if (0 == numDigits) {
+            while (p != end && '0' == *p) {
+                ++p;
+            }
+            exponent = -static_cast<int>(p - fractionBegin);
+        }
+        const char *const significantBegin = p;
+        for (; p != end && static_cast<unsigned>(*p - '0') < 10; ++p) {
+            significand = significand * 10 + (*p - '0');
+            ++numDigits;
+            if (numDigits > k_MAX_DIGITS) {
+                return false;                                         // RETURN
+            }
+        }
+        exponent -= static_cast<int>(p - significantBegin);
+        hasDigits = hasDigits || p != fractionBegin;
+    }
+
+    if (!hasDigits || numDigits > k_MAX_DIGITS) {
+        return false;                                                 // RETURN
+    }
+
+    if (p != end && ('e' == *p || 'E' == *p)) {
+        // An exponent without digits is not part of the number.
+
+        const char *q = p + 1;
+        const bool  isNegativeExponent = q != end && '-' == *q;
+        if (q != end && ('-' == *q || '+' == *q)) {
+            ++q;
+        }
+        if (q != end && static_cast<unsigned>(*q - '0') < 10) {
+            int explicitExponent = 0;
+            for (; q != end && static_cast<unsigned>(*q - '0') < 10; ++q) {
+                if (explicitExponent >= 10000) {
+                    return false;                                     // RETURN
+                }
+                explicitExponent = explicitExponent * 10 + (*q - '0');
+            }
+            exponent += isNegativeExponent ? -explicitExponent
+                                           : explicitExponent;
+            p = q;
+        }
+    }
+
+    double value;
+    if (0 == significand) {
+        value = 0.0;
+    }
+#ifdef U_ENABLE_EXACT_FAST_PATH
+    else if (significand <= k_MAX_EXACT_SIGNIFICAND
+          && -22 <= exponent
+          && exponent <= 22) {
+        value = exponent < 0
+              ? static_cast<double>(significand)
+                                             / k_EXACT_POWERS_OF_10[-exponent]
+              : static_cast<double>(significand)
+                                              * k_EXACT_POWERS_OF_10[exponent];
+    }
+#endif
+    else if (!convertDecimal(&value, significand, exponent)) {
+        return false;                                                 // RETURN
+    }
+
+    *result = isNegative ? -value : value;
+    *length = p - inputString.data();
+    return true;
+}
+
 }  // close unnamed namespace
 
 
@@ -223,6 +924,10 @@ int NumericParseUtil::parseDouble(double                   *result,
         return -2;                                                    // RETURN
     }
 
+    if (0 == parseDoubleFast(result, remainder, inputString)) {
+        return 0;                                                     // RETURN
+    }
+
     static const size_type k_BUFFER_SIZE = 128;
 
     const bool             useLocalBuffer =
@@ -280,6 +985,25 @@ int NumericParseUtil::parseDouble(double                   *result,
 #endif
 }
 
+int NumericParseUtil::parseDoubleFast(double                   *result,
+                                      bslstl::StringRef        *remainder,
+                                      const bslstl::StringRef&  inputString)
+{
+    BSLS_ASSERT(remainder);
+    BSLS_ASSERT(result);
+
+    bsl::size_t length;
+    if (inputString.empty()
+     || CharType::isSpace(inputString[0])
+     || !parseDecimal(result, &length, inputString)) {
+        return -1;                                                    // RETURN
+    }
+
+    remainder->assign(inputString.data() + length,
+                      inputString.length() - length);
+    return 0;
+}
+
 int NumericParseUtil::parseInt(int                      *result,
                                bslstl::StringRef        *remainder,
                                const bslstl::StringRef&  inputString,
@@ -512,6 +1236,17 @@ int NumericParseUtil::parseUnsignedInteger(
         return -2;                                                    // RETURN
     }
 
+    if (10 == base) {
+        const char *begin = inputString.data();
+        const char *end   = parseDecimalDigits(&res,
+                                               begin,
+                                               begin + length,
+                                               maxValue);
+        remainder->assign(end, length - (end - begin));
+        *result = res;
+        return 0;                                                     // RETURN
+    }
+
     size_type i = 0;
     while (-1 != digit) {
         if (res < maxCheck) {
@@ -562,6 +1297,20 @@ int NumericParseUtil::parseUnsignedInteger(
         return -1;                                                    // RETURN
     }
 
+    if (10 == base) {
+        const char *begin = inputString.data();
+        const char *end   = parseDecimalDigits(
+                                   &res,
+                                   begin,
+                                   begin + bsl::min(length,
+                                                    static_cast<size_type>(
+                                                                maxNumDigits)),
+                                   maxValue);
+        remainder->assign(end, length - (end - begin));
+        *result = res;
+        return 0;                                                     // RETURN
+    }
+
     size_type i = 0;
     while (-1 != digit && maxNumDigits--) {
         if (res < maxCheck) {
@@ -97,6 +97,30 @@ BSLS_IDENT("$Id: $")
 // the standard library function 'strtod'.  For example, the ASCII string
 // "3.14159" is converted, on some platforms, to 3.1415899999999999.
 //
+// Decimal text having at most 19 significant digits, whose significand is at
+// most 2^53 and whose decimal exponent is at most 22 in magnitude (which
+// includes most text written by programs, such as prices and measurements),
+// is converted directly with a single, correctly rounded, floating point
+// multiplication or division.  Other decimal text having at most 19
+// significant digits whose value is a normal 'double' (such as text written
+// with 17 significant digits) is converted with 64-bit integer arithmetic
+// (using the algorithm of Eisel and Lemire), except in rare cases in which the
+// value is too close to the midpoint of two 'double' values for that
+// arithmetic to decide the rounding.  In neither case is the cost of 'strtod'
+// incurred, and the result is identical in every case.
+//
+// 'parseDoubleFast' performs only these conversions, and reports failure for
+// any other text.  Unlike 'parseDouble', it does not depend on the current
+// locale, so that it may be used by clients (such as codecs) that cannot
+// require the "C" locale, and that provide their own fallback.
+//
+///Integer Values
+///--------------
+// Decimal (i.e., base 10) digits are converted eight at a time, where the
+// platform permits, while the value remains within the maximum value, and
+// then one at a time.  The value, and the remainder, are identical to those
+// produced by converting one digit at a time.
+//
 ///Special Floating Point Values
 ///- - - - - - - - - - - - - - -
 // The IEEE-754 (double precision) floating point format supports the following
@@ -205,6 +229,23 @@ struct NumericParseUtil {
         // "C" locale, such that 'strcmp(setlocale(0, 0), "C") == 0'.  For more
         // information see {Floating Point Values}.
 
+    static int parseDoubleFast(double                   *result,
+                               bslstl::StringRef        *remainder,
+                               const bslstl::StringRef&  inputString);
+        // Parse the specified 'inputString' as 'parseDouble' does if it
+        // starts with decimal text having at most 19 significant digits whose
+        // value is zero or a normal 'double', and, if so, load the value into
+        // the specified 'result', load into the specified 'remainder' the
+        // remainder of 'inputString' immediately following the parsed text,
+        // and return 0.  Otherwise, and in the rare cases in which the value
+        // cannot be computed quickly (see {Floating Point Values}), return a
+        // non-zero value with no effect on 'result' and 'remainder'.  Note
+        // that, unlike 'parseDouble', this function does not depend on the
+        // current locale.  Also note that a non-zero return does not imply
+        // that 'inputString' does not start with a number (which may, e.g.,
+        // have more digits, be hexadecimal, or be out of range), for which a
+        // caller may resort to 'parseDouble' or 'strtod'.
+
     static int parseInt(int                      *result,
                         const bslstl::StringRef&  inputString,
                         int                       base = 10);
@@ -6,6 +6,7 @@
 #include <bslma_testallocator.h>           // for testing only
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bslim_testutil.h>
@@ -19,7 +20,9 @@
 #include <bsl_string.h>
 #include <bsl_vector.h>
 
+#include <bsl_cerrno.h>
 #include <bsl_climits.h>
+#include <bsl_clocale.h>
 #include <bsl_limits.h>
 
 #include <bsl_c_stdlib.h>
@@ -60,6 +63,7 @@ using namespace bdlb;
 // [ 3] parseSignedInteger(result, input, base, minVal, maxVal)
 // [ 4] parseDouble(double *res, StringRef *rest, StringRef in)
 // [ 4] parseDouble(double *res, StringRef in)
+// [ 4] parseDoubleFast(double *res, StringRef *rest, StringRef in)
 // [ 5] parseInt(result, rest, input, base = 10)
 // [ 5] parseInt(result, input, base = 10)
 // [ 6] parseInt64(result, rest, input, base = 10)
@@ -74,6 +78,7 @@ using namespace bdlb;
 // [10] parseUshort(result, input, base = 10)
 //-----------------------------------------------------------------------------
 // [11] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -1476,15 +1481,51 @@ int main(int argc, char *argv[])
         //:    3 The value is just large/small than representable
         //:    4 "Interesting" values from "A Program for Testing IEEE
         //:      Decimal-Binary Conversions", Vern Paxson, ICIR 1991.
+        //:
+        //:  4 The value and remainder are identical to those produced by
+        //:    'strtod', both for text handled by the exact fast path and for
+        //:    text that is not.
+        //:
+        //:  5 Text having at most 19 significant digits is correctly rounded
+        //:    over the whole exponent range, including values at, or next to,
+        //:    the midpoint of two adjacent 'double' values, and 'errno' is set
+        //:    exactly when 'strtod' sets it.
+        //:
+        //:  6 'parseDoubleFast' either produces the value and remainder
+        //:    produced by 'strtod', or fails with no effect on its arguments,
+        //:    and fails for text outside the range of the fast path.
+        //:
+        //:  7 'parseDoubleFast' does not depend on the current locale.
         //
         // Plan:
         //: 1 Use the table-driven approach with columns for input, base, and
         //:   expected result.  Use category partitioning to create a suite of
         //:   test vectors for an enumerated set of bases.
+        //:
+        //: 2 Generate a large number of pseudo-random decimal strings having
+        //:   varied signs, leading zeros, numbers of digits, decimal point
+        //:   positions, exponents, and trailing text, and compare the results
+        //:   with those of 'strtod'.  (C-4)
+        //:
+        //: 3 Generate pseudo-random significands of up to 19 digits with
+        //:   exponents from -360 to 339, and integers at, or within 1 of, the
+        //:   midpoint of two adjacent 'double' values, and compare the
+        //:   results, and 'errno', with those of 'strtod'.  (C-5)
+        //:
+        //: 4 Also parse the strings of P-2 with 'parseDoubleFast', and verify
+        //:   that, when it succeeds, the results are those of 'strtod', and
+        //:   that, otherwise, its arguments are unchanged.  Using a table of
+        //:   text outside the range of the fast path, verify that
+        //:   'parseDoubleFast' fails.  (C-6)
+        //:
+        //: 5 Where a locale having a decimal separator other than '.' is
+        //:   available, install it and verify that 'parseDoubleFast' still
+        //:   parses text having a '.' decimal point.  (C-7)
         //
         // Testing:
         //   parseDouble(double *res, StringRef *rest, StringRef in)
         //   parseDouble(double *res, StringRef in)
+        //   parseDoubleFast(double *res, StringRef *rest, StringRef in)
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -1998,6 +2039,231 @@ int main(int argc, char *argv[])
                 } // end for si....
             }
         }
+
+        if (verbose) cout << "\nComparison with 'strtod'." << endl;
+        {
+            // Generate decimal text of a variety of shapes, within and beyond
+            // the range of the exact fast path, and verify that the value and
+            // the remainder are identical to those produced by 'strtod'.
+
+            static const char *const SUFFIXES[] = {
+                "", "e", "e+", "e-", "E7", "e-3x", ".", "x", ",1"
+            };
+            const int NUM_SUFFIXES = sizeof SUFFIXES / sizeof *SUFFIXES;
+
+            Uint64 state = 0x9e3779b97f4a7c15ULL;
+
+            for (int i = 0; i < 100000; ++i) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                Uint64 bits = state;
+
+                bsl::string text;
+                switch (bits % 3) {
+                  case 1: text += '-'; break;
+                  case 2: text += '+'; break;
+                }
+                bits /= 3;
+
+                const int numLeadingZeros = static_cast<int>(bits % 3);
+                bits /= 3;
+                text.append(numLeadingZeros, '0');
+
+                const int numDigits = static_cast<int>(bits % 22);
+                bits /= 22;
+                const int pointPosition = static_cast<int>(bits % 24) - 1;
+                bits /= 24;
+                for (int d = 0; d < numDigits; ++d) {
+                    if (d == pointPosition) {
+                        text += '.';
+                    }
+                    text += static_cast<char>('0' + bits % 10);
+                    bits = bits / 10 ^ (state >> d);
+                }
+                if (0 != bits % 3) {
+                    char exponent[16];
+                    sprintf(exponent,
+                            "e%d",
+                            static_cast<int>(bits % 61) - 30);
+                    text += exponent;
+                }
+                text += SUFFIXES[(state >> 59) % NUM_SUFFIXES];
+
+                char  *endPtr;
+                const double EXPECTED = strtod(text.c_str(), &endPtr);
+                const bool   EXPECTED_FAIL = endPtr == text.c_str();
+
+                double    result = 37.0;
+                StringRef rest;
+                const int rv = NumericParseUtil::parseDouble(&result,
+                                                             &rest,
+                                                             text);
+
+                ASSERTV(text, rv, EXPECTED_FAIL == !!rv);
+                if (EXPECTED_FAIL) {
+                    ASSERTV(text, result, 37.0 == result);
+                }
+                else {
+                    ASSERTV(text, endPtr - text.c_str(),
+                            rest.data() - text.c_str(),
+                            endPtr == rest.data());
+                    ASSERTV(text, EXPECTED, result,
+                            0 == memcmp(&EXPECTED, &result, sizeof result));
+                }
+
+                double    fastResult = 37.0;
+                StringRef fastRest;
+                const int fastRv = NumericParseUtil::parseDoubleFast(
+                                                                   &fastResult,
+                                                                   &fastRest,
+                                                                   text);
+                if (0 == fastRv) {
+                    ASSERTV(text, !EXPECTED_FAIL);
+                    ASSERTV(text, endPtr == fastRest.data());
+                    ASSERTV(text, EXPECTED, fastResult,
+                            0 == memcmp(&EXPECTED,
+                                        &fastResult,
+                                        sizeof fastResult));
+                }
+                else {
+                    ASSERTV(text, fastResult, 37.0 == fastResult);
+                    ASSERTV(text, 0 == fastRest.data());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'parseDoubleFast' failures." << endl;
+        {
+            static const struct {
+                int         d_lineNum;  // source line number
+                const char *d_spec_p;   // specification string
+            } DATA[] = {
+                //LINE  SPEC
+                //----  -------------------------------
+                { L_,   ""                              },
+                { L_,   " 1"                            },
+                { L_,   "x"                             },
+                { L_,   "."                             },
+                { L_,   "-"                             },
+                { L_,   "0x1p3"                         },
+                { L_,   "inf"                           },
+                { L_,   "-infinity"                     },
+                { L_,   "nan"                           },
+                { L_,   "12345678901234567890"          },
+                { L_,   "1.2345678901234567890"         },
+                { L_,   "1e400"                         },
+                { L_,   "1e-400"                        },
+                { L_,   "4.9e-324"                      },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE = DATA[ti].d_lineNum;
+                const char *SPEC = DATA[ti].d_spec_p;
+
+                double    result = 37.0;
+                StringRef rest;
+                const int rv = NumericParseUtil::parseDoubleFast(&result,
+                                                                 &rest,
+                                                                 SPEC);
+                ASSERTV(LINE, SPEC, rv, 0 != rv);
+                ASSERTV(LINE, SPEC, result, 37.0 == result);
+                ASSERTV(LINE, SPEC, 0 == rest.data());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'parseDoubleFast' in other locales."
+                          << endl;
+        {
+            static const char *const LOCALES[] = {
+                "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8",
+                "de_DE", "fr_FR", "German", "French"
+            };
+            const int NUM_LOCALES = sizeof LOCALES / sizeof *LOCALES;
+
+            for (int li = 0; li < NUM_LOCALES; ++li) {
+                if (0 == setlocale(LC_NUMERIC, LOCALES[li])) {
+                    continue;                                       // CONTINUE
+                }
+                if (veryVerbose) { T_ P(LOCALES[li]) }
+
+                double    result = 37.0;
+                StringRef rest;
+                const int rv = NumericParseUtil::parseDoubleFast(&result,
+                                                                 &rest,
+                                                                 "-2.5e1,x");
+                ASSERTV(LOCALES[li], rv, 0 == rv);
+                ASSERTV(LOCALES[li], result, -25.0 == result);
+                ASSERTV(LOCALES[li], rest, ",x" == rest);
+
+                setlocale(LC_NUMERIC, "C");
+            }
+        }
+
+        if (verbose) cout << "\nComparison with 'strtod' beyond the exact"
+                          << " range." << endl;
+        {
+            // Generate significands of up to 19 digits with exponents over the
+            // whole range of 'double' (and beyond), and integers that lie
+            // exactly half way between, or next to the midpoint of, two
+            // adjacent 'double' values, and verify that the value, remainder,
+            // and 'errno' are identical to those produced by 'strtod'.
+
+            Uint64 state = 0x853c49e6748fea9bULL;
+
+            for (int i = 0; i < 200000; ++i) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                char text[64];
+                if (i % 4) {
+                    const int numDigits = 1 + static_cast<int>(state % 19);
+                    Uint64    significand = state >> 8;
+                    Uint64    limit = 1;
+                    for (int d = 0; d < numDigits; ++d) {
+                        limit *= 10;
+                    }
+                    significand %= limit;
+                    sprintf(text,
+                            "%llue%d",
+                            static_cast<unsigned long long>(significand),
+                            static_cast<int>((state >> 5) % 700) - 360);
+                }
+                else {
+                    const int    shift = 1 + static_cast<int>(state % 11);
+                    const Uint64 mantissa = (state >> 11) | (1ULL << 52);
+                    Uint64       significand = mantissa << shift;
+                    switch ((state >> 4) % 3) {
+                      case 0: significand += 1ULL << (shift - 1);       break;
+                      case 1: significand += (1ULL << (shift - 1)) - 1; break;
+                      case 2: significand += (1ULL << (shift - 1)) + 1; break;
+                    }
+                    sprintf(text,
+                            "%llu",
+                            static_cast<unsigned long long>(significand));
+                }
+
+                errno = 0;
+                char         *endPtr;
+                const double  EXPECTED = strtod(text, &endPtr);
+                const int     EXPECTED_ERRNO = errno;
+
+                errno = 0;
+                double    result = 37.0;
+                StringRef rest;
+                const int rv = NumericParseUtil::parseDouble(&result,
+                                                             &rest,
+                                                             text);
+
+                ASSERTV(text, rv, 0 == rv);
+                ASSERTV(text, EXPECTED_ERRNO, errno, EXPECTED_ERRNO == errno);
+                ASSERTV(text, endPtr == rest.data());
+                ASSERTV(text, EXPECTED, result,
+                        0 == memcmp(&EXPECTED, &result, sizeof result));
+            }
+        }
       } break;
       case 3: {
         // --------------------------------------------------------------------
@@ -2333,11 +2599,22 @@ int main(int argc, char *argv[])
         //:    1 The string ends unexpectedly
         //:    2 The value is as large or small as representable
         //:    3 The value is just large/small than representable
+        //:
+        //:  4 Decimal digits converted several at a time yield the same value
+        //:    and remainder as when converted one at a time, for every length
+        //:    of a run of digits, and every maximum value and maximum number
+        //:    of digits.
         //
         // Plan:
         //: 1 Use the table-driven approach with columns for input, base, and
         //:   expected result.  Use category partitioning to create a suite of
         //:   test vectors for an enumerated set of bases.
+        //:
+        //: 2 For runs of 1 to 24 random digits, all '9's, leading zeros, and
+        //:   the digits of boundary maximum values, followed by nothing or by
+        //:   a non-digit, parse the text in base 10 with a set of boundary
+        //:   maximum values and maximum numbers of digits, and compare the
+        //:   results with a digit-by-digit parse.  (C-4)
         //
         // Testing:
         //   parseUnsignedInteger(result, rest, in, base, maxVal)
@@ -2746,6 +3023,136 @@ int main(int argc, char *argv[])
                 }
             }
         }
+
+        if (verbose) cout << "\nComparison with a digit-by-digit parse."
+                          << endl;
+        {
+            // Decimal text is parsed several digits at a time.  Verify, for
+            // runs of digits of every length up to 24 ending at the end of the
+            // input or at a character adjacent to the digits (in the ASCII
+            // character set), and for maximum values and maximum numbers of
+            // digits around the boundaries of those runs, that the value and
+            // remainder are identical to those of a digit-by-digit parse.
+
+            static const Uint64 MAX_VALUES[] = {
+                0, 1, 5, 9, 10, 11, 99, 255, 65535, 99999999, 100000000,
+                4294967295ULL, 9999999999999999ULL, 10000000000000000ULL,
+                9223372036854775807ULL, 9223372036854775808ULL,
+                18446744073709551615ULL
+            };
+            const int NUM_MAX_VALUES = sizeof MAX_VALUES / sizeof *MAX_VALUES;
+
+            static const int MAX_NUM_DIGITS[] = {
+                0, 1, 7, 8, 9, 15, 16, 17, 19, 20, 100
+            };
+            const int NUM_MAX_NUM_DIGITS = sizeof  MAX_NUM_DIGITS
+                                         / sizeof *MAX_NUM_DIGITS;
+
+            static const char TERMINATORS[] = { '\0', '/', ':', ' ', 'a' };
+            const int NUM_TERMINATORS = sizeof  TERMINATORS
+                                      / sizeof *TERMINATORS;
+
+            Uint64 state = 0x2545f4914f6cdd1dULL;
+
+            for (int length = 1; length <= 24; ++length) {
+            for (int shape = 0; shape < 40; ++shape) {
+            for (int ti = 0; ti < NUM_TERMINATORS; ++ti) {
+                // Use mostly random digits, but also all '9's, leading zeros,
+                // and the digits of each maximum value.
+
+                bsl::string text;
+                for (int d = 0; d < length; ++d) {
+                    state ^= state << 13;
+                    state ^= state >> 7;
+                    state ^= state << 17;
+                    const char digit = 0 == shape ? '9'
+                                     : 1 == shape && d < length / 2 ? '0'
+                                     : static_cast<char>('0' + state % 10);
+                    text += digit;
+                }
+                if (2 <= shape && shape < 2 + NUM_MAX_VALUES) {
+                    char buffer[32];
+                    sprintf(buffer,
+                            "%llu",
+                            static_cast<unsigned long long>(
+                                                     MAX_VALUES[shape - 2]));
+                    text.replace(0,
+                                 bsl::min(text.length(), strlen(buffer)),
+                                 buffer,
+                                 bsl::min(text.length(), strlen(buffer)));
+                }
+                if (TERMINATORS[ti]) {
+                    text += TERMINATORS[ti];
+                    text += "123456789";
+                }
+
+                for (int mi = 0; mi < NUM_MAX_VALUES; ++mi) {
+                    const Uint64 MAX = MAX_VALUES[mi];
+
+                    // Parse digit by digit.
+
+                    Uint64      expected = 0;
+                    bsl::size_t numParsed = 0;
+                    while (numParsed < text.length()
+                        && '0' <= text[numParsed] && text[numParsed] <= '9') {
+                        const Uint64 digit = text[numParsed] - '0';
+                        if (expected < MAX / 10) {
+                            expected = expected * 10 + digit;
+                            ++numParsed;
+                        }
+                        else {
+                            if (expected == MAX / 10 && digit <= MAX % 10) {
+                                expected = expected * 10 + digit;
+                                ++numParsed;
+                            }
+                            break;
+                        }
+                    }
+
+                    Uint64    result = 37;
+                    StringRef rest;
+                    int       rv = NumericParseUtil::parseUnsignedInteger(
+                                                                      &result,
+                                                                      &rest,
+                                                                      text,
+                                                                      10,
+                                                                      MAX);
+                    ASSERTV(text, MAX, rv, 0 == rv);
+                    ASSERTV(text, MAX, expected, result, expected == result);
+                    ASSERTV(text, MAX, numParsed, rest.data() - text.data(),
+                            text.data() + numParsed == rest.data());
+
+                    for (int ni = 0; ni < NUM_MAX_NUM_DIGITS; ++ni) {
+                        const int DIGITS = MAX_NUM_DIGITS[ni];
+
+                        Uint64      expectedN = 0;
+                        bsl::size_t numParsedN = 0;
+                        while (numParsedN < static_cast<bsl::size_t>(DIGITS)
+                            && numParsedN < numParsed) {
+                            expectedN = expectedN * 10
+                                      + (text[numParsedN] - '0');
+                            ++numParsedN;
+                        }
+                        result = 37;
+                        rv     = NumericParseUtil::parseUnsignedInteger(
+                                                                      &result,
+                                                                      &rest,
+                                                                      text,
+                                                                      10,
+                                                                      MAX,
+                                                                      DIGITS);
+                        ASSERTV(text, MAX, DIGITS, rv, 0 == rv);
+                        ASSERTV(text, MAX, DIGITS, expectedN, result,
+                                expectedN == result);
+                        ASSERTV(text, MAX, DIGITS, numParsedN,
+                                rest.data() - text.data(),
+                                text.data() + numParsedN == rest.data());
+                    }
+                }
+            }
+            }
+            }
+        }
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -2878,6 +3285,192 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Each parsing function is faster than the corresponding C library
+        //:   function for typical inputs, including short integers, integers
+        //:   having many digits, and 'double' values both within and beyond
+        //:   the range of the exact fast path.
+        //
+        // Plan:
+        //: 1 For each of several sets of pseudo-random text, parse every
+        //:   string repeatedly with the function under test and with 'strtol',
+        //:   'strtoll', or 'strtod', and report the time per string for each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        enum {
+            e_INT_SHORT,     // 'parseInt', 1 to 5 digits
+            e_INT_LONG,      // 'parseInt', 9 or 10 digits
+            e_INT64,         // 'parseInt64', 16 to 19 digits
+            e_UINT_4_DIGITS, // 'parseUnsignedInteger', at most 4 digits
+            e_DOUBLE_PRICE,  // 'parseDouble', prices having 2 decimals
+            e_DOUBLE_17,     // 'parseDouble', 17 significant digits
+            e_DOUBLE_19      // 'parseDouble', 19 digits, large exponents
+        };
+
+        static const char *const NAMES[] = {
+            "parseInt, 1-5 digits       ",
+            "parseInt, 9-10 digits      ",
+            "parseInt64, 16-19 digits   ",
+            "parseUnsignedInteger, 4 max",
+            "parseDouble, prices        ",
+            "parseDouble, 17 digits     ",
+            "parseDouble, 19 digits e+-N",
+        };
+        const int NUM_SETS = sizeof NAMES / sizeof *NAMES;
+
+        const int NUM_STRINGS = 1 << 14;
+        const int NUM_ROUNDS  = argc > 2 ? atoi(argv[2]) : 20;
+
+        for (int set = 0; set < NUM_SETS; ++set) {
+            bsl::vector<bsl::string> strings;
+            strings.reserve(NUM_STRINGS);
+
+            Uint64 state = 0x9e3779b97f4a7c15ULL;
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                char buffer[64];
+                switch (set) {
+                  case e_INT_SHORT: {
+                    static const int LIMITS[] = {
+                        10, 100, 1000, 10000, 32768
+                    };
+                    sprintf(buffer,
+                            "%d",
+                            static_cast<int>((state >> 8)
+                                                      % LIMITS[state % 5]));
+                  } break;
+                  case e_INT_LONG: {
+                    sprintf(buffer,
+                            "%d",
+                            static_cast<int>(100000000 + (state >> 8)
+                                                            % 2000000000));
+                  } break;
+                  case e_INT64: {
+                    sprintf(buffer,
+                            "%lld",
+                            static_cast<long long>(
+                                1000000000000000LL
+                              + (state >> 1) % 9000000000000000000LL));
+                  } break;
+                  case e_UINT_4_DIGITS: {
+                    sprintf(buffer,
+                            "%04d-",
+                            static_cast<int>(state % 10000));
+                  } break;
+                  case e_DOUBLE_PRICE: {
+                    sprintf(buffer,
+                            "%d.%02d",
+                            static_cast<int>((state >> 8) % 10000),
+                            static_cast<int>(state % 100));
+                  } break;
+                  case e_DOUBLE_17: {
+                    sprintf(buffer,
+                            "%.17g",
+                            static_cast<double>(state >> 11) / (1ULL << 53));
+                  } break;
+                  default: {
+                    sprintf(buffer,
+                            "%llue%d",
+                            static_cast<unsigned long long>(
+                                    1000000000000000000ULL
+                                  + (state >> 1) % 8000000000000000000ULL),
+                            static_cast<int>(state % 600) - 300);
+                  } break;
+                }
+                strings.push_back(buffer);
+            }
+
+            cout << NAMES[set] << endl;
+
+            for (int method = 0; method < 2; ++method) {
+                Int64           sum = 0;
+                bsls::Stopwatch timer;
+                timer.start();
+
+                for (int r = 0; r < NUM_ROUNDS; ++r) {
+                    for (int i = 0; i < NUM_STRINGS; ++i) {
+                        const bsl::string& s = strings[i];
+                        char              *end;
+                        if (0 == method) {
+                            StringRef rest;
+                            switch (set) {
+                              case e_INT_SHORT:
+                              case e_INT_LONG: {
+                                int value;
+                                NumericParseUtil::parseInt(&value, &rest, s);
+                                sum += value;
+                              } break;
+                              case e_INT64: {
+                                Int64 value;
+                                NumericParseUtil::parseInt64(&value, &rest, s);
+                                sum += value;
+                              } break;
+                              case e_UINT_4_DIGITS: {
+                                Uint64 value;
+                                NumericParseUtil::parseUnsignedInteger(&value,
+                                                                       &rest,
+                                                                       s,
+                                                                       10,
+                                                                       9999,
+                                                                       4);
+                                sum += value;
+                              } break;
+                              default: {
+                                double value;
+                                NumericParseUtil::parseDouble(&value,
+                                                              &rest,
+                                                              s);
+                                sum += value < 1.0;
+                              } break;
+                            }
+                            sum += rest.length();
+                        }
+                        else {
+                            switch (set) {
+                              case e_INT_SHORT:
+                              case e_INT_LONG:
+                              case e_UINT_4_DIGITS: {
+                                sum += strtol(s.c_str(), &end, 10);
+                              } break;
+                              case e_INT64: {
+                                sum += strtoll(s.c_str(), &end, 10);
+                              } break;
+                              default: {
+                                sum += strtod(s.c_str(), &end) < 1.0;
+                              } break;
+                            }
+                            sum += end - s.c_str();
+                        }
+                    }
+                }
+
+                timer.stop();
+
+                const double NS = timer.elapsedTime() * 1e9
+                                / NUM_STRINGS
+                                / NUM_ROUNDS;
+
+                cout << "  " << (0 == method ? "NumericParseUtil"
+                                             : "C library       ")
+                     << ": " << NS << " ns/string (" << sum % 10 << ")"
+                     << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,437 @@
+// bdlbb_blobiovecutil.cpp                                            -*-C++-*-
+#include <bdlbb_blobiovecutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_blobiovecutil_cpp, "$Id$ $CSID$")
+
+#include <bdlbb_blobutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_utility.h>
+
+#include <bsl_c_limits.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <bsl_c_errno.h>
+#include <unistd.h>
+#endif
+
+namespace BloombergLP {
+namespace {
+
+typedef bdlbb::BlobIovecUtil Util;
+
+const int k_BATCH_SIZE =
+#ifdef IOV_MAX
+                         IOV_MAX < Util::k_MAX_NUM_IOVECS ? IOV_MAX :
+#endif
+                         Util::k_MAX_NUM_IOVECS;
+    // number of elements described in one system call
+
+// HELPER FUNCTIONS
+int loadIovecsFromPlace(Util::Iovec          *iovecs,
+                        int                   maxNumIovecs,
+                        const bdlbb::Blob&    blob,
+                        bsl::pair<int, int>  *place,
+                        int                  *length)
+    // Load into the specified 'iovecs' array, having room for the specified
+    // 'maxNumIovecs' elements, the description of the segments of the buffers
+    // of the specified 'blob' holding the bytes starting at the specified
+    // 'place', up to the specified 'length' bytes, and return the number of
+    // elements loaded.  Skip segments of zero length.  Decrease '*length' by
+    // the number of bytes described and, unless '*length' is then 0, set
+    // 'place' to the first byte not described.  The behavior is undefined
+    // unless '0 < maxNumIovecs', 'place' represents an actual byte position
+    // in the buffers of 'blob', and 'blob' has at least '*length' bytes
+    // (counting its capacity) starting at 'place'.
+{
+    int numIovecs = 0;
+    while (0 < *length && numIovecs < maxNumIovecs) {
+        const bdlbb::BlobBuffer& buffer = blob.buffer(place->first);
+        const int size = bsl::min(*length, buffer.size() - place->second);
+        if (0 < size) {
+            iovecs[numIovecs].iov_base = buffer.data() + place->second;
+            iovecs[numIovecs].iov_len  = size;
+            ++numIovecs;
+            *length -= size;
+        }
+        ++place->first;
+        place->second = 0;
+    }
+    return numIovecs;
+}
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+
+int readvImp(Util::FileDescriptor  descriptor,
+             const Util::Iovec    *iovecs,
+             int                   numIovecs,
+             const Util::Offset   *offset)
+    // Read into the segments described by the specified 'iovecs' array,
+    // having the specified 'numIovecs' elements, from the specified
+    // 'descriptor' with one system call, at the specified '*offset' in the
+    // file if 'offset' is not 0, and at the file offset of 'descriptor'
+    // otherwise.  Restart the call if it is interrupted by a signal.  Return
+    // the number of bytes read, or a negative value on error.
+{
+    ssize_t rc;
+    do {
+        if (!offset) {
+            rc = ::readv(descriptor, iovecs, numIovecs);
+        }
+        else {
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            rc = ::preadv64(descriptor, iovecs, numIovecs, *offset);
+#elif defined(BSLS_PLATFORM_OS_FREEBSD)
+            rc = ::preadv(descriptor, iovecs, numIovecs, *offset);
+#else
+            // 'preadv' is not available: read one segment at a time, stopping
+            // at the first short read.
+
+            rc = 0;
+            for (int i = 0; i < numIovecs; ++i) {
+                const ssize_t n = ::pread(descriptor,
+                                          iovecs[i].iov_base,
+                                          iovecs[i].iov_len,
+                                          *offset + rc);
+                if (n < 0) {
+                    rc = 0 < rc ? rc : n;
+                    break;
+                }
+                rc += n;
+                if (static_cast<bsl::size_t>(n) < iovecs[i].iov_len) {
+                    break;
+                }
+            }
+#endif
+        }
+    } while (rc < 0 && EINTR == errno);
+
+    return static_cast<int>(rc);
+}
+
+int writevImp(Util::FileDescriptor  descriptor,
+              const Util::Iovec    *iovecs,
+              int                   numIovecs,
+              const Util::Offset   *offset)
+    // Write the segments described by the specified 'iovecs' array, having
+    // the specified 'numIovecs' elements, to the specified 'descriptor' with
+    // one system call, at the specified '*offset' in the file if 'offset' is
+    // not 0, and at the file offset of 'descriptor' otherwise.  Restart the
+    // call if it is interrupted by a signal.  Return the number of bytes
+    // written, or a negative value on error.
+{
+    ssize_t rc;
+    do {
+        if (!offset) {
+            rc = ::writev(descriptor, iovecs, numIovecs);
+        }
+        else {
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            rc = ::pwritev64(descriptor, iovecs, numIovecs, *offset);
+#elif defined(BSLS_PLATFORM_OS_FREEBSD)
+            rc = ::pwritev(descriptor, iovecs, numIovecs, *offset);
+#else
+            // 'pwritev' is not available: write one segment at a time,
+            // stopping at the first short write.
+
+            rc = 0;
+            for (int i = 0; i < numIovecs; ++i) {
+                const ssize_t n = ::pwrite(descriptor,
+                                           iovecs[i].iov_base,
+                                           iovecs[i].iov_len,
+                                           *offset + rc);
+                if (n < 0) {
+                    rc = 0 < rc ? rc : n;
+                    break;
+                }
+                rc += n;
+                if (static_cast<bsl::size_t>(n) < iovecs[i].iov_len) {
+                    break;
+                }
+            }
+#endif
+        }
+    } while (rc < 0 && EINTR == errno);
+
+    return static_cast<int>(rc);
+}
+
+#else  // Windows
+
+int readvImp(Util::FileDescriptor  descriptor,
+             const Util::Iovec    *iovecs,
+             int                   numIovecs,
+             const Util::Offset   *offset)
+    // Read into the segments described by the specified 'iovecs' array,
+    // having the specified 'numIovecs' elements, from the specified
+    // 'descriptor', one segment at a time, stopping at the first short read,
+    // starting at the specified '*offset' in the file if 'offset' is not 0,
+    // and at the file pointer of 'descriptor' otherwise.  Return the number of
+    // bytes read, or a negative value on error.
+{
+    typedef bdls::FilesystemUtil FUtil;
+
+    if (offset &&
+        *offset != FUtil::seek(descriptor,
+                               *offset,
+                               FUtil::e_SEEK_FROM_BEGINNING)) {
+        return -1;                                                    // RETURN
+    }
+
+    int total = 0;
+    for (int i = 0; i < numIovecs; ++i) {
+        const int length = static_cast<int>(iovecs[i].iov_len);
+        const int rc     = FUtil::read(descriptor, iovecs[i].iov_base, length);
+        if (rc < 0) {
+            return 0 < total ? total : rc;                            // RETURN
+        }
+        total += rc;
+        if (rc < length) {
+            break;
+        }
+    }
+    return total;
+}
+
+int writevImp(Util::FileDescriptor  descriptor,
+              const Util::Iovec    *iovecs,
+              int                   numIovecs,
+              const Util::Offset   *offset)
+    // Write the segments described by the specified 'iovecs' array, having
+    // the specified 'numIovecs' elements, to the specified 'descriptor', one
+    // segment at a time, stopping at the first short write, starting at the
+    // specified '*offset' in the file if 'offset' is not 0, and at the file
+    // pointer of 'descriptor' otherwise.  Return the number of bytes written,
+    // or a negative value on error.
+{
+    typedef bdls::FilesystemUtil FUtil;
+
+    if (offset &&
+        *offset != FUtil::seek(descriptor,
+                               *offset,
+                               FUtil::e_SEEK_FROM_BEGINNING)) {
+        return -1;                                                    // RETURN
+    }
+
+    int total = 0;
+    for (int i = 0; i < numIovecs; ++i) {
+        const int length = static_cast<int>(iovecs[i].iov_len);
+        const int rc     = FUtil::write(descriptor,
+                                        iovecs[i].iov_base,
+                                        length);
+        if (rc < 0) {
+            return 0 < total ? total : rc;                            // RETURN
+        }
+        total += rc;
+        if (rc < length) {
+            break;
+        }
+    }
+    return total;
+}
+
+#endif
+
+int readImp(bdlbb::Blob          *blob,
+            Util::FileDescriptor  descriptor,
+            const Util::Offset   *offset,
+            int                   numBytes)
+    // Read up to the specified 'numBytes' bytes from the specified
+    // 'descriptor' into the specified 'blob', after its data, at the specified
+    // '*offset' in the file if 'offset' is not 0, and at the file offset of
+    // 'descriptor' otherwise.  Return the number of bytes read, or a negative
+    // value on error.  See 'BlobIovecUtil::read'.
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= numBytes);
+
+    if (0 == numBytes) {
+        return 0;                                                     // RETURN
+    }
+
+    const int oldLength = blob->length();
+    blob->setLength(oldLength + numBytes);
+
+    Util::Iovec iovecs[Util::k_MAX_NUM_IOVECS];
+    const int   numIovecs = Util::loadIovecs(iovecs,
+                                             k_BATCH_SIZE,
+                                             *blob,
+                                             oldLength,
+                                             numBytes);
+
+    const int rc = readvImp(descriptor, iovecs, numIovecs, offset);
+
+    // Trim the blob to the bytes actually read.  The buffers added to hold
+    // the rest are retained as capacity.
+
+    blob->setLength(oldLength + (0 < rc ? rc : 0));
+    return rc;
+}
+
+int writeImp(Util::FileDescriptor  descriptor,
+             const Util::Offset   *offset,
+             const bdlbb::Blob&    blob,
+             int                   position,
+             int                   length)
+    // Write to the specified 'descriptor' the specified 'length' bytes
+    // starting at the specified 'position' in the specified 'blob', at the
+    // specified '*offset' in the file if 'offset' is not 0, and at the file
+    // offset of 'descriptor' otherwise.  Return the number of bytes written,
+    // or a negative value if an error occurs before any byte is written.  See
+    // 'BlobIovecUtil::write'.
+{
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= blob.length() - length);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::pair<int, int> place =
+                     bdlbb::BlobUtil::findBufferIndexAndOffset(blob, position);
+
+    Util::Iovec  iovecs[Util::k_MAX_NUM_IOVECS];
+    Util::Iovec *first      = iovecs;
+    int          numIovecs  = 0;
+    int          remaining  = length;
+    int          numWritten = 0;
+
+    while (0 < numIovecs || 0 < remaining) {
+        if (0 == numIovecs) {
+            first     = iovecs;
+            numIovecs = loadIovecsFromPlace(iovecs,
+                                            k_BATCH_SIZE,
+                                            blob,
+                                            &place,
+                                            &remaining);
+        }
+
+        Util::Offset        currentOffset = 0;
+        const Util::Offset *offsetPtr     = 0;
+        if (offset) {
+            currentOffset = *offset + numWritten;
+            offsetPtr     = &currentOffset;
+        }
+
+        const int rc = writevImp(descriptor, first, numIovecs, offsetPtr);
+        if (rc <= 0) {
+            return 0 < numWritten || 0 == rc ? numWritten : rc;       // RETURN
+        }
+        numWritten += rc;
+
+        // Resume after a partial write.
+
+        Util::advanceIovecs(&first, &numIovecs, rc);
+    }
+    return numWritten;
+}
+
+}  // close unnamed namespace
+
+namespace bdlbb {
+
+                            // --------------------
+                            // struct BlobIovecUtil
+                            // --------------------
+
+// CLASS METHODS
+void BlobIovecUtil::advanceIovecs(Iovec       **iovecs,
+                                  int          *numIovecs,
+                                  bsl::size_t   numBytes)
+{
+    BSLS_ASSERT(iovecs);
+    BSLS_ASSERT(numIovecs);
+    BSLS_ASSERT(0 <= *numIovecs);
+
+    while (0 < *numIovecs && (*iovecs)->iov_len <= numBytes) {
+        numBytes -= (*iovecs)->iov_len;
+        ++*iovecs;
+        --*numIovecs;
+    }
+
+    if (0 < numBytes) {
+        BSLS_ASSERT(0 < *numIovecs);
+
+        (*iovecs)->iov_base = static_cast<char *>((*iovecs)->iov_base)
+                                                                    + numBytes;
+        (*iovecs)->iov_len -= numBytes;
+    }
+}
+
+int BlobIovecUtil::loadIovecs(Iovec       *iovecs,
+                              int          maxNumIovecs,
+                              const Blob&  blob,
+                              int          position,
+                              int          length)
+{
+    BSLS_ASSERT(iovecs);
+    BSLS_ASSERT(0 < maxNumIovecs);
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= blob.totalSize() - length);
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::pair<int, int> place = BlobUtil::findBufferIndexAndOffset(blob,
+                                                                   position);
+    return loadIovecsFromPlace(iovecs, maxNumIovecs, blob, &place, &length);
+}
+
+int BlobIovecUtil::read(Blob *blob, FileDescriptor descriptor, int numBytes)
+{
+    return readImp(blob, descriptor, 0, numBytes);
+}
+
+int BlobIovecUtil::readAt(Blob           *blob,
+                          FileDescriptor  descriptor,
+                          Offset          offset,
+                          int             numBytes)
+{
+    BSLS_ASSERT(0 <= offset);
+
+    return readImp(blob, descriptor, &offset, numBytes);
+}
+
+int BlobIovecUtil::write(FileDescriptor  descriptor,
+                         const Blob&     blob,
+                         int             position,
+                         int             length)
+{
+    return writeImp(descriptor, 0, blob, position, length);
+}
+
+int BlobIovecUtil::writeAt(FileDescriptor  descriptor,
+                           Offset          offset,
+                           const Blob&     blob,
+                           int             position,
+                           int             length)
+{
+    BSLS_ASSERT(0 <= offset);
+
+    return writeImp(descriptor, &offset, blob, position, length);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,312 @@
+// bdlbb_blobiovecutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLBB_BLOBIOVECUTIL
+#define INCLUDED_BDLBB_BLOBIOVECUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide scatter/gather I/O between blobs and file descriptors.
+//
+//@CLASSES:
+//  bdlbb::BlobIovecUtil: scatter/gather I/O on the buffers of a 'bdlbb::Blob'
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_blobutil, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlbb::BlobIovecUtil',
+// that reads and writes the data of a 'bdlbb::Blob' from and to a file
+// descriptor (a file, a pipe, or a socket) without copying it, by describing
+// the buffers of the blob with an array of 'iovec' structures passed to the
+// 'readv' and 'writev' system calls, or, for positional I/O, 'preadv' and
+// 'pwritev'.  By contrast, writing a blob through 'bdlbb::OutBlobStreamBuf' or
+// 'bdlbb::BlobUtil::write' copies it into the buffer of a stream, and
+// 'bdlbb::BlobUtil::getContiguousRangeOrCopy' copies it into a contiguous
+// buffer.
+//
+// 'loadIovecs' describes a range of bytes of a blob as an array of
+// 'BlobIovecUtil::Iovec' (a 'typedef' for 'iovec' on Unix platforms), one per
+// buffer of the blob holding bytes of the range: the first element starts at
+// the first byte of the range, which need not be the first byte of a buffer,
+// and the last element ends at the last byte of the range, so that the unused
+// tail of the last buffer is not described.  The range may extend past the
+// data of the blob into its capacity, e.g., to read data into it.
+// 'advanceIovecs' adjusts such an array after a system call has transferred
+// only some of the bytes it describes, which happens, e.g., when a socket's
+// send buffer fills up, so that the call can be repeated for the rest.
+//
+// 'write' and 'writeAt' write a range of bytes of a blob, issuing as many
+// system calls as needed to write all of it, each describing as many buffers
+// as the system allows, and resuming where the previous one stopped.  'read'
+// and 'readAt' read into the capacity following the data of a blob, growing it
+// with buffers from its factory as needed, and set the length of the blob to
+// cover exactly the bytes that were read.
+//
+///Platform-Specific Behavior
+///--------------------------
+// On Unix platforms, 'write' and 'read' use 'writev' and 'readv', and
+// 'writeAt' and 'readAt' use 'pwritev' and 'preadv' where available (Linux and
+// FreeBSD), or 'pwrite' and 'pread' for each buffer otherwise.  On Windows,
+// the buffers are transferred one at a time with 'bdls::FilesystemUtil::write'
+// and 'bdls::FilesystemUtil::read', and 'writeAt' and 'readAt' first move the
+// file pointer to the specified offset.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a Blob to a File Descriptor
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a message held in a blob made of small buffers, and
+// that we want to write it to a file descriptor (here, a pipe), and read it
+// back, without first copying it into a contiguous buffer.
+//
+// First, we create the blob, and fill it with a message:
+//..
+//  bdlbb::SimpleBlobBufferFactory factory(8);
+//  bdlbb::Blob                    blob(&factory);
+//
+//  const char MESSAGE[] = "Scatter/gather I/O saves a copy of every message.";
+//  const int  LENGTH    = sizeof MESSAGE - 1;
+//
+//  bdlbb::BlobUtil::append(&blob, MESSAGE, LENGTH);
+//  assert(7 == blob.numDataBuffers());
+//..
+// Then, we write the blob to the pipe, with a single call to 'writev':
+//..
+//  int fds[2];
+//  int rc = ::pipe(fds);
+//  assert(0 == rc);
+//
+//  rc = bdlbb::BlobIovecUtil::write(fds[1], blob);
+//  assert(LENGTH == rc);
+//..
+// Next, we read the message into another blob, with 'readv':
+//..
+//  bdlbb::Blob received(&factory);
+//
+//  rc = bdlbb::BlobIovecUtil::read(&received, fds[0], 1000);
+//  assert(LENGTH == rc);
+//  assert(LENGTH == received.length());
+//  assert(0      == bdlbb::BlobUtil::compare(blob, received));
+//..
+// Finally, we observe that 'loadIovecs' can describe any range of the blob,
+// which may start and end in the middle of a buffer:
+//..
+//  bdlbb::BlobIovecUtil::Iovec iovecs[8];
+//
+//  int numIovecs = bdlbb::BlobIovecUtil::loadIovecs(iovecs, 8, blob, 5, 20);
+//  assert(4 == numIovecs);
+//  assert(blob.buffer(0).data() + 5 == iovecs[0].iov_base);
+//  assert(3                         == iovecs[0].iov_len);
+//  assert(8                         == iovecs[1].iov_len);
+//  assert(8                         == iovecs[2].iov_len);
+//  assert(1                         == iovecs[3].iov_len);
+//
+//  ::close(fds[0]);
+//  ::close(fds[1]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <sys/uio.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                            // ====================
+                            // struct BlobIovecUtil
+                            // ====================
+
+struct BlobIovecUtil {
+    // This 'struct' provides a namespace for functions performing
+    // scatter/gather I/O on the buffers of a 'Blob'.
+
+    // TYPES
+#ifdef BSLS_PLATFORM_OS_UNIX
+    typedef ::iovec Iovec;
+        // 'Iovec' is an alias for the system's I/O vector element, describing
+        // a contiguous range of memory by its address, 'iov_base', and its
+        // length, 'iov_len'.
+#else
+    struct Iovec {
+        // This 'struct' describes a contiguous range of memory by its
+        // address, 'iov_base', and its length, 'iov_len', like the POSIX
+        // 'iovec'.
+
+        void        *iov_base;  // address of the first byte
+        bsl::size_t  iov_len;   // number of bytes
+    };
+#endif
+
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+        // 'FileDescriptor' is an alias for the operating system's native file
+        // descriptor or handle type.
+
+    typedef bdls::FilesystemUtil::Offset Offset;
+        // 'Offset' is an alias for a signed value representing the offset of
+        // a byte within a file.
+
+    enum { k_MAX_NUM_IOVECS = 64 };
+        // maximum number of elements described in one system call by the I/O
+        // functions of this component (fewer if the platform's 'IOV_MAX' is
+        // smaller)
+
+    // CLASS METHODS
+    static void advanceIovecs(Iovec       **iovecs,
+                              int          *numIovecs,
+                              bsl::size_t   numBytes);
+        // Advance the array of I/O vector elements addressed by the specified
+        // 'iovecs', having the number of elements addressed by the specified
+        // 'numIovecs', past its first specified 'numBytes' bytes: remove the
+        // elements that describe only bytes among the first 'numBytes', by
+        // incrementing '*iovecs' and decrementing '*numIovecs', and adjust
+        // the first remaining element to start after them.  The behavior is
+        // undefined unless 'numBytes' does not exceed the total length of the
+        // elements.  Note that this function is used to resume a system call
+        // that transferred only 'numBytes' of the bytes described by the
+        // array, and that it modifies the elements of the array.
+
+    static int loadIovecs(Iovec       *iovecs,
+                          int          maxNumIovecs,
+                          const Blob&  blob);
+    static int loadIovecs(Iovec       *iovecs,
+                          int          maxNumIovecs,
+                          const Blob&  blob,
+                          int          position,
+                          int          length);
+        // Load into the specified 'iovecs' array, having room for the
+        // specified 'maxNumIovecs' elements, the description of the
+        // consecutive segments of the buffers of the specified 'blob' holding
+        // the specified 'length' bytes starting at the specified 'position' in
+        // 'blob', or holding the data of 'blob' if 'position' and 'length' are
+        // not specified, and return the number of elements loaded.  Segments
+        // of zero length are not described.  If the range spans more than
+        // 'maxNumIovecs' buffers, only its first 'maxNumIovecs' segments are
+        // described.  The behavior is undefined unless '0 < maxNumIovecs',
+        // '0 <= position', '0 <= length', and
+        // 'position <= blob.totalSize() - length'.  Note that the range may
+        // extend past the data of 'blob' into its capacity.
+
+    static int read(Blob           *blob,
+                    FileDescriptor  descriptor,
+                    int             numBytes);
+        // Read up to the specified 'numBytes' bytes from the specified
+        // 'descriptor' into the specified 'blob', after its data, with a
+        // single system call (or, on Windows, with one call per buffer until
+        // one returns fewer bytes than requested).  First grow the blob if its
+        // capacity is insufficient.  Return the number of bytes read, which is
+        // 0 at the end of the file, and increase the length of 'blob' by that
+        // amount, or return a negative value, leaving the length of 'blob'
+        // unchanged, if an error occurs.  The behavior is undefined unless
+        // '0 <= numBytes' and the length of 'blob' is no more than
+        // 'INT_MAX - numBytes'.  Note that fewer than 'numBytes' bytes may be
+        // read even if more are available, as at most 'k_MAX_NUM_IOVECS'
+        // buffers are read into.
+
+    static int readAt(Blob           *blob,
+                      FileDescriptor  descriptor,
+                      Offset          offset,
+                      int             numBytes);
+        // Read up to the specified 'numBytes' bytes, starting at the specified
+        // 'offset' in the file associated with the specified 'descriptor',
+        // into the specified 'blob', after its data, as 'read' does.  On Unix
+        // platforms, the file offset associated with 'descriptor' is not
+        // changed.  The behavior is undefined unless '0 <= offset',
+        // '0 <= numBytes', and the length of 'blob' is no more than
+        // 'INT_MAX - numBytes'.
+
+    static int write(FileDescriptor descriptor, const Blob& blob);
+    static int write(FileDescriptor  descriptor,
+                     const Blob&     blob,
+                     int             position,
+                     int             length);
+        // Write to the specified 'descriptor' the specified 'length' bytes
+        // starting at the specified 'position' in the specified 'blob', or the
+        // data of 'blob' if 'position' and 'length' are not specified, and
+        // return the number of bytes written, which is less than 'length' only
+        // if the operating system stops accepting data after some bytes have
+        // been written (e.g., reporting 'EAGAIN' when 'descriptor' is a
+        // non-blocking socket whose send buffer is full), or a negative value
+        // if an error occurs before any byte is written.  System calls
+        // interrupted by a signal are restarted.  The behavior is undefined
+        // unless '0 <= position', '0 <= length', and
+        // 'position <= blob.length() - length'.
+
+    static int writeAt(FileDescriptor  descriptor,
+                       Offset          offset,
+                       const Blob&     blob);
+    static int writeAt(FileDescriptor  descriptor,
+                       Offset          offset,
+                       const Blob&     blob,
+                       int             position,
+                       int             length);
+        // Write, starting at the specified 'offset' in the file associated
+        // with the specified 'descriptor', the specified 'length' bytes
+        // starting at the specified 'position' in the specified 'blob', or the
+        // data of 'blob' if 'position' and 'length' are not specified, as
+        // 'write' does.  On Unix platforms, the file offset associated with
+        // 'descriptor' is not changed.  The behavior is undefined unless
+        // '0 <= offset', '0 <= position', '0 <= length', and
+        // 'position <= blob.length() - length'.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // struct BlobIovecUtil
+                            // --------------------
+
+// CLASS METHODS
+inline
+int BlobIovecUtil::loadIovecs(Iovec       *iovecs,
+                              int          maxNumIovecs,
+                              const Blob&  blob)
+{
+    return loadIovecs(iovecs, maxNumIovecs, blob, 0, blob.length());
+}
+
+inline
+int BlobIovecUtil::write(FileDescriptor descriptor, const Blob& blob)
+{
+    return write(descriptor, blob, 0, blob.length());
+}
+
+inline
+int BlobIovecUtil::writeAt(FileDescriptor  descriptor,
+                           Offset          offset,
+                           const Blob&     blob)
+{
+    return writeAt(descriptor, offset, blob, 0, blob.length());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
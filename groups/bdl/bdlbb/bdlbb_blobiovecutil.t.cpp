@@ -0,0 +1,1260 @@
+// bdlbb_blobiovecutil.t.cpp                                          -*-C++-*-
+#include <bdlbb_blobiovecutil.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <bsl_c_errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides functions that describe ranges of a blob
+// as arrays of I/O vector elements, and functions that read and write blobs
+// with them.  The arrays are verified against the addresses of the bytes of
+// the blob, computed independently.  The I/O functions are tested by writing
+// to and reading from a temporary file, and, on Unix platforms, a pipe, which
+// is made non-blocking to exercise partial writes.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void advanceIovecs(Iovec **, int *, size_t);
+// [ 3] int loadIovecs(Iovec *, int, const Blob&);
+// [ 3] int loadIovecs(Iovec *, int, const Blob&, int, int);
+// [ 5] int read(Blob *, FileDescriptor, int);
+// [ 5] int readAt(Blob *, FileDescriptor, Offset, int);
+// [ 4] int write(FileDescriptor, const Blob&);
+// [ 4] int write(FileDescriptor, const Blob&, int, int);
+// [ 4] int writeAt(FileDescriptor, Offset, const Blob&);
+// [ 4] int writeAt(FileDescriptor, Offset, const Blob&, int, int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: WRITE THROUGHPUT
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::BlobIovecUtil   Util;
+typedef Util::Iovec            Iovec;
+typedef bdlbb::Blob            Blob;
+typedef bdls::FilesystemUtil   FUtil;
+typedef FUtil::FileDescriptor  FileDescriptor;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+char patternByte(int index)
+    // Return the byte at the specified 'index' in the pattern used to fill
+    // the blobs and files of this test driver.
+{
+    return static_cast<char>(index % 251);
+}
+
+void appendPattern(Blob *blob, int length, int first = 0)
+    // Append to the specified 'blob' the specified 'length' bytes of the
+    // pattern, starting with the optionally specified 'first' byte.
+{
+    bsl::vector<char> data(length + 1);
+    for (int i = 0; i < length; ++i) {
+        data[i] = patternByte(first + i);
+    }
+    bdlbb::BlobUtil::append(blob, data.data(), length);
+}
+
+bool isPattern(const char *data, int length, int first)
+    // Return 'true' if the specified 'data', having the specified 'length',
+    // holds the bytes of the pattern starting with the specified 'first'
+    // byte, and 'false' otherwise.
+{
+    for (int i = 0; i < length; ++i) {
+        if (patternByte(first + i) != data[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool isPattern(const Blob& blob, int position, int length, int first)
+    // Return 'true' if the specified 'length' bytes starting at the specified
+    // 'position' in the specified 'blob' hold the bytes of the pattern
+    // starting with the specified 'first' byte, and 'false' otherwise.
+{
+    if (0 == length) {
+        return true;                                                  // RETURN
+    }
+    bsl::vector<char> data(length);
+    bdlbb::BlobUtil::copy(data.data(), blob, position, length);
+    return isPattern(data.data(), length, first);
+}
+
+char *addressOf(const Blob& blob, int position)
+    // Return the address of the byte at the specified 'position' in the
+    // buffers of the specified 'blob', which may be past its data, without
+    // using the component under test or 'bdlbb::BlobUtil'.
+{
+    for (int i = 0; i < blob.numBuffers(); ++i) {
+        if (position < blob.buffer(i).size()) {
+            return blob.buffer(i).data() + position;                  // RETURN
+        }
+        position -= blob.buffer(i).size();
+    }
+    BSLS_ASSERT_INVOKE("position past capacity");
+    return 0;
+}
+
+int checkIovecs(const Iovec *iovecs,
+                int          numIovecs,
+                const Blob&  blob,
+                int          position,
+                int          length)
+    // Return the number of bytes, starting at the specified 'position' in the
+    // specified 'blob', described contiguously and in order by the specified
+    // 'iovecs' array having the specified 'numIovecs' elements, if each
+    // element is a non-empty segment of a single buffer starting at the
+    // byte following the previous one, and if the elements describe no more
+    // than the specified 'length' bytes; return -1 otherwise.
+{
+    int described = 0;
+    for (int i = 0; i < numIovecs; ++i) {
+        const int size = static_cast<int>(iovecs[i].iov_len);
+        if (0 == size || length - described < size) {
+            return -1;                                                // RETURN
+        }
+        const char *base = static_cast<const char *>(iovecs[i].iov_base);
+        for (int j = 0; j < size; ++j) {
+            if (addressOf(blob, position + described + j) != base + j) {
+                return -1;                                            // RETURN
+            }
+        }
+        described += size;
+    }
+    return described;
+}
+
+int numSegments(const Blob& blob, int position, int length)
+    // Return the number of buffers of the specified 'blob' holding bytes of
+    // the range of the specified 'length' starting at the specified
+    // 'position'.
+{
+    int result = 0;
+    int begin  = 0;
+    for (int i = 0; 0 < length && i < blob.numBuffers(); ++i) {
+        const int end = begin + blob.buffer(i).size();
+        if (begin < end && begin < position + length && position < end) {
+            ++result;
+        }
+        begin = end;
+    }
+    return result;
+}
+
+bsl::string readFile(FileDescriptor descriptor, int offset, int length)
+    // Return the (up to) specified 'length' bytes starting at the specified
+    // 'offset' in the file associated with the specified 'descriptor'.  Note
+    // that the file offset of 'descriptor' is changed.
+{
+    bsl::string result(length, '\0');
+    FUtil::seek(descriptor, offset, FUtil::e_SEEK_FROM_BEGINNING);
+    int numRead = 0;
+    while (numRead < length) {
+        const int rc = FUtil::read(descriptor,
+                                   &result[numRead],
+                                   length - numRead);
+        if (rc <= 0) {
+            break;
+        }
+        numRead += rc;
+    }
+    result.resize(numRead);
+    return result;
+}
+
+                              // ==============
+                              // class TempFile
+                              // ==============
+
+class TempFile {
+    // This class manages a temporary file, open for reading and writing, that
+    // is removed on destruction.
+
+    // DATA
+    bsl::string    d_path;
+    FileDescriptor d_descriptor;
+
+  private:
+    // NOT IMPLEMENTED
+    TempFile(const TempFile&);
+    TempFile& operator=(const TempFile&);
+
+  public:
+    // CREATORS
+    TempFile()
+    : d_descriptor(FUtil::createTemporaryFile(&d_path, "bdlbb_blobiovecutil"))
+        // Create a new temporary file.
+    {
+        BSLS_ASSERT(FUtil::k_INVALID_FD != d_descriptor);
+    }
+
+    ~TempFile()
+        // Close and remove the file managed by this object.
+    {
+        FUtil::close(d_descriptor);
+        FUtil::remove(d_path);
+    }
+
+    // ACCESSORS
+    FileDescriptor descriptor() const
+        // Return the descriptor of the file managed by this object.
+    {
+        return d_descriptor;
+    }
+
+    FUtil::Offset size() const
+        // Return the size of the file managed by this object.
+    {
+        return FUtil::getFileSize(d_path);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose     = argc > 2;
+    const bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a Blob to a File Descriptor
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a message held in a blob made of small buffers, and
+// that we want to write it to a file descriptor (here, a pipe), and read it
+// back, without first copying it into a contiguous buffer.
+//
+// First, we create the blob, and fill it with a message:
+//..
+    bdlbb::SimpleBlobBufferFactory factory(8);
+    bdlbb::Blob                    blob(&factory);
+
+    const char MESSAGE[] = "Scatter/gather I/O saves a copy of every message.";
+    const int  LENGTH    = sizeof MESSAGE - 1;
+
+    bdlbb::BlobUtil::append(&blob, MESSAGE, LENGTH);
+    ASSERT(7 == blob.numDataBuffers());
+//..
+// Then, we write the blob to the pipe, with a single call to 'writev':
+//..
+    int fds[2];
+    int rc = ::pipe(fds);
+    ASSERT(0 == rc);
+
+    rc = bdlbb::BlobIovecUtil::write(fds[1], blob);
+    ASSERT(LENGTH == rc);
+//..
+// Next, we read the message into another blob, with 'readv':
+//..
+    bdlbb::Blob received(&factory);
+
+    rc = bdlbb::BlobIovecUtil::read(&received, fds[0], 1000);
+    ASSERT(LENGTH == rc);
+    ASSERT(LENGTH == received.length());
+    ASSERT(0      == bdlbb::BlobUtil::compare(blob, received));
+//..
+// Finally, we observe that 'loadIovecs' can describe any range of the blob,
+// which may start and end in the middle of a buffer:
+//..
+    bdlbb::BlobIovecUtil::Iovec iovecs[8];
+
+    int numIovecs = bdlbb::BlobIovecUtil::loadIovecs(iovecs, 8, blob, 5, 20);
+    ASSERT(4 == numIovecs);
+    ASSERT(blob.buffer(0).data() + 5 == iovecs[0].iov_base);
+    ASSERT(3                         == iovecs[0].iov_len);
+    ASSERT(8                         == iovecs[1].iov_len);
+    ASSERT(8                         == iovecs[2].iov_len);
+    ASSERT(1                         == iovecs[3].iov_len);
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+//..
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'read' AND 'readAt'
+        //
+        // Concerns:
+        //: 1 'read' reads up to the requested number of bytes from the file
+        //:   offset into the blob, after its data, and returns the number of
+        //:   bytes read.
+        //:
+        //: 2 The blob is grown as needed, and its length is increased by
+        //:   exactly the number of bytes read.
+        //:
+        //: 3 At the end of the file, 0 is returned; on error, a negative
+        //:   value is returned; in both cases the blob is unchanged.
+        //:
+        //: 4 A single system call reads into no more than 'k_MAX_NUM_IOVECS'
+        //:   buffers, and reading again continues where the previous call
+        //:   stopped.
+        //:
+        //: 5 'readAt' reads from the specified offset, and (on Unix) does not
+        //:   change the file offset.
+        //
+        // Plan:
+        //: 1 Write a pattern to a temporary file, then, for blobs with various
+        //:   buffer sizes and initial lengths, read it with 'read' in chunks
+        //:   of various sizes until 'read' returns 0, verifying the return
+        //:   value, the length, and the content of the blob after each call.
+        //:   (C-1..4)
+        //:
+        //: 2 Read from an invalid descriptor.  (C-3)
+        //:
+        //: 3 Repeat P-1 with 'readAt', at various offsets.  (C-1..3, 5)
+        //
+        // Testing:
+        //   int read(Blob *, FileDescriptor, int);
+        //   int readAt(Blob *, FileDescriptor, Offset, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'read' AND 'readAt'"
+                          << "\n===========================" << endl;
+
+        const int FILE_SIZE = 3000;
+
+        TempFile file;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(256);
+            Blob                           blob(&factory);
+            appendPattern(&blob, FILE_SIZE);
+            ASSERT(FILE_SIZE == Util::write(file.descriptor(), blob));
+        }
+
+        const int BUFFER_SIZES[]   = { 1, 3, 8, 100, 4096 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                                       / sizeof *BUFFER_SIZES;
+
+        const int INIT_LENGTHS[]   = { 0, 1, 5 };
+        const int NUM_INIT_LENGTHS = sizeof INIT_LENGTHS
+                                                       / sizeof *INIT_LENGTHS;
+
+        const int CHUNKS[]   = { 1, 10, 64, 500, 10000 };
+        const int NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+        if (verbose) cout << "\nTesting 'read'." << endl;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+        for (int tj = 0; tj < NUM_INIT_LENGTHS; ++tj) {
+        for (int tk = 0; tk < NUM_CHUNKS;       ++tk) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+            const int INIT_LENGTH = INIT_LENGTHS[tj];
+            const int CHUNK       = CHUNKS[tk];
+
+            if (veryVerbose) { T_ P_(BUFFER_SIZE) P_(INIT_LENGTH) P(CHUNK) }
+
+            // Reading one byte at a time from large buffers is slow and adds
+            // nothing.
+
+            if (1 == CHUNK && 8 < BUFFER_SIZE) {
+                continue;
+            }
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+            Blob                           blob(&factory);
+            appendPattern(&blob, INIT_LENGTH);
+
+            FUtil::seek(file.descriptor(), 0, FUtil::e_SEEK_FROM_BEGINNING);
+
+            // A call reads into at most 'k_MAX_NUM_IOVECS' buffers, the first
+            // of which may already be partially filled.
+
+            const int MAX_PER_CALL = (Util::k_MAX_NUM_IOVECS - 1)
+                                                          * BUFFER_SIZE + 1;
+
+            int numRead = 0;
+            int rc;
+            do {
+                const int LENGTH = blob.length();
+
+                rc = Util::read(&blob, file.descriptor(), CHUNK);
+
+                const int EXP_MIN = bsl::min(bsl::min(CHUNK, MAX_PER_CALL),
+                                             FILE_SIZE - numRead);
+                ASSERTV(BUFFER_SIZE, INIT_LENGTH, CHUNK, rc, EXP_MIN,
+                        EXP_MIN <= rc && rc <= CHUNK);
+                ASSERTV(BUFFER_SIZE, INIT_LENGTH, CHUNK, rc,
+                        LENGTH + (0 < rc ? rc : 0) == blob.length());
+                if (rc <= 0) {
+                    break;
+                }
+                numRead += rc;
+            } while (true);
+
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, CHUNK, rc, 0 == rc);
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, CHUNK, numRead,
+                    FILE_SIZE == numRead);
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, CHUNK,
+                    INIT_LENGTH + FILE_SIZE == blob.length());
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, CHUNK,
+                    isPattern(blob, 0, INIT_LENGTH, 0));
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, CHUNK,
+                    isPattern(blob, INIT_LENGTH, FILE_SIZE, 0));
+
+            // Reading 0 bytes does not change the blob.
+
+            ASSERT(0                       == Util::read(&blob,
+                                                         file.descriptor(),
+                                                         0));
+            ASSERT(INIT_LENGTH + FILE_SIZE == blob.length());
+        }
+        }
+        }
+
+        if (verbose) cout << "\nTesting errors." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(8);
+            Blob                           blob(&factory);
+            appendPattern(&blob, 5);
+
+            ASSERT(0 >  Util::read(&blob, FUtil::k_INVALID_FD, 100));
+            ASSERT(5 == blob.length());
+            ASSERT(0 >  Util::readAt(&blob, FUtil::k_INVALID_FD, 0, 100));
+            ASSERT(5 == blob.length());
+        }
+
+        if (verbose) cout << "\nTesting 'readAt'." << endl;
+
+        const int OFFSETS[]   = { 0, 1, 1000, FILE_SIZE - 1, FILE_SIZE,
+                                  FILE_SIZE + 100 };
+        const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+        for (int tj = 0; tj < NUM_INIT_LENGTHS; ++tj) {
+        for (int tk = 0; tk < NUM_OFFSETS;      ++tk) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+            const int INIT_LENGTH = INIT_LENGTHS[tj];
+            const int OFFSET      = OFFSETS[tk];
+            const int CHUNK       = 50;
+
+            if (veryVerbose) { T_ P_(BUFFER_SIZE) P_(INIT_LENGTH) P(OFFSET) }
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+            Blob                           blob(&factory);
+            appendPattern(&blob, INIT_LENGTH);
+
+            FUtil::seek(file.descriptor(), 7, FUtil::e_SEEK_FROM_BEGINNING);
+
+            const int EXP = bsl::max(0,
+                                     bsl::min(CHUNK, FILE_SIZE - OFFSET));
+
+            const int rc = Util::readAt(&blob,
+                                        file.descriptor(),
+                                        OFFSET,
+                                        CHUNK);
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, OFFSET, rc, EXP == rc);
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, OFFSET,
+                    INIT_LENGTH + EXP == blob.length());
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, OFFSET,
+                    isPattern(blob, 0, INIT_LENGTH, 0));
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, OFFSET,
+                    isPattern(blob, INIT_LENGTH, EXP, OFFSET));
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+            ASSERTV(BUFFER_SIZE, INIT_LENGTH, OFFSET,
+                    7 == FUtil::seek(file.descriptor(),
+                                     0,
+                                     FUtil::e_SEEK_FROM_CURRENT));
+#endif
+        }
+        }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'write' AND 'writeAt'
+        //
+        // Concerns:
+        //: 1 'write' writes the specified range of the blob, or its data, at
+        //:   the file offset, for any division of the blob into buffers,
+        //:   including more buffers than 'k_MAX_NUM_IOVECS', and returns the
+        //:   number of bytes written.
+        //:
+        //: 2 'writeAt' writes at the specified offset, and (on Unix) does not
+        //:   change the file offset.
+        //:
+        //: 3 When the descriptor stops accepting data, 'write' returns the
+        //:   number of bytes written, and writing the rest of the range
+        //:   resumes where it stopped.
+        //:
+        //: 4 If no byte can be written, a negative value is returned.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For blobs of various lengths made of buffers of various sizes,
+        //:   holding a pattern, and for ranges of those, write the range to
+        //:   a new temporary file with 'write', and at an offset with
+        //:   'writeAt', and verify the content and size of the file and its
+        //:   file offset.  (C-1..2)
+        //:
+        //: 2 On Unix, write a blob larger than the capacity of a non-blocking
+        //:   pipe, and verify that a partial write is reported, and that
+        //:   draining the pipe and writing the rest of the blob yields its
+        //:   data, then verify that writing to a full pipe fails.  (C-3..4)
+        //:
+        //: 3 Write to an invalid descriptor.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int write(FileDescriptor, const Blob&);
+        //   int write(FileDescriptor, const Blob&, int, int);
+        //   int writeAt(FileDescriptor, Offset, const Blob&);
+        //   int writeAt(FileDescriptor, Offset, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'write' AND 'writeAt'"
+                          << "\n=============================" << endl;
+
+        const int BUFFER_SIZES[]   = { 1, 3, 8, 100 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                                       / sizeof *BUFFER_SIZES;
+
+        const int LENGTHS[]   = { 0, 1, 7, 64, 1000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int OFFSET = 5;
+
+        if (verbose) cout << "\nTesting ranges." << endl;
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+        for (int tj = 0; tj < NUM_LENGTHS;      ++tj) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+            const int LENGTH      = LENGTHS[tj];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+            Blob                           blob(&factory);
+            appendPattern(&blob, LENGTH);
+
+            const int POSITIONS[] = { 0, 1, LENGTH / 2, LENGTH };
+
+            for (int tk = 0; tk < 4; ++tk) {
+                const int POSITION = POSITIONS[tk];
+
+                if (LENGTH < POSITION) {
+                    continue;
+                }
+
+                const int REMAINING = LENGTH - POSITION;
+                const int SIZES[]   = { 0, 1, REMAINING / 2, REMAINING };
+
+                for (int tl = 0; tl < 4; ++tl) {
+                    const int SIZE = SIZES[tl];
+
+                    if (REMAINING < SIZE) {
+                        continue;
+                    }
+
+                    if (veryVerbose) {
+                        T_ P_(BUFFER_SIZE) P_(LENGTH) P_(POSITION) P(SIZE)
+                    }
+
+                    {
+                        TempFile file;
+
+                        const int rc = Util::write(file.descriptor(),
+                                                   blob,
+                                                   POSITION,
+                                                   SIZE);
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE, rc,
+                                SIZE == rc);
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE,
+                                SIZE == FUtil::seek(
+                                                  file.descriptor(),
+                                                  0,
+                                                  FUtil::e_SEEK_FROM_CURRENT));
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE,
+                                SIZE == file.size());
+
+                        const bsl::string DATA = readFile(file.descriptor(),
+                                                          0,
+                                                          SIZE);
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE,
+                                SIZE == static_cast<int>(DATA.size()));
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE,
+                                isPattern(DATA.data(), SIZE, POSITION));
+                    }
+
+                    {
+                        TempFile file;
+
+                        const int rc = Util::writeAt(file.descriptor(),
+                                                     OFFSET,
+                                                     blob,
+                                                     POSITION,
+                                                     SIZE);
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE, rc,
+                                SIZE == rc);
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE,
+                                (SIZE ? OFFSET + SIZE : 0) == file.size());
+#ifdef BSLS_PLATFORM_OS_UNIX
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE,
+                                0 == FUtil::seek(file.descriptor(),
+                                                 0,
+                                                 FUtil::e_SEEK_FROM_CURRENT));
+#endif
+
+                        const bsl::string DATA = readFile(file.descriptor(),
+                                                          OFFSET,
+                                                          SIZE);
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE,
+                                SIZE == static_cast<int>(DATA.size()));
+                        ASSERTV(BUFFER_SIZE, LENGTH, POSITION, SIZE,
+                                isPattern(DATA.data(), SIZE, POSITION));
+                    }
+                }
+            }
+
+            if (LENGTH == blob.length()) {
+                TempFile file;
+
+                ASSERTV(BUFFER_SIZE, LENGTH,
+                        LENGTH == Util::write(file.descriptor(), blob));
+                ASSERTV(BUFFER_SIZE, LENGTH,
+                        LENGTH == Util::writeAt(file.descriptor(),
+                                                LENGTH,
+                                                blob));
+
+                const bsl::string DATA = readFile(file.descriptor(),
+                                                  0,
+                                                  2 * LENGTH);
+                ASSERTV(BUFFER_SIZE, LENGTH,
+                        2 * LENGTH == static_cast<int>(DATA.size()));
+                ASSERTV(BUFFER_SIZE, LENGTH,
+                        isPattern(DATA.data(), LENGTH, 0));
+                ASSERTV(BUFFER_SIZE, LENGTH,
+                        isPattern(DATA.data() + LENGTH, LENGTH, 0));
+            }
+        }
+        }
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        if (verbose) cout << "\nTesting partial writes." << endl;
+        {
+            // A pipe holds 64 KiB by default on Linux, and less elsewhere.
+
+            const int LENGTH = 1 << 20;
+
+            bdlbb::SimpleBlobBufferFactory factory(1000);
+            Blob                           blob(&factory);
+            appendPattern(&blob, LENGTH);
+
+            int fds[2];
+            ASSERT(0 == ::pipe(fds));
+            ASSERT(0 == ::fcntl(fds[1],
+                                F_SETFL,
+                                ::fcntl(fds[1], F_GETFL) | O_NONBLOCK));
+
+            bsl::vector<char> drained(LENGTH);
+
+            int numWritten = 0;
+            int numCalls   = 0;
+            while (numWritten < LENGTH) {
+                const int rc = Util::write(fds[1],
+                                           blob,
+                                           numWritten,
+                                           LENGTH - numWritten);
+                ASSERTV(numWritten, rc, 0 < rc);
+                if (rc <= 0) {
+                    break;
+                }
+                ++numCalls;
+
+                // Drain the pipe.
+
+                int numRead = 0;
+                while (numRead < rc) {
+                    const int n = static_cast<int>(
+                                      ::read(fds[0],
+                                             drained.data() + numWritten
+                                                            + numRead,
+                                             rc - numRead));
+                    ASSERTV(n, 0 < n);
+                    if (n <= 0) {
+                        break;
+                    }
+                    numRead += n;
+                }
+                numWritten += rc;
+            }
+
+            if (veryVerbose) { T_ P(numCalls) }
+
+            ASSERTV(numCalls, 1 < numCalls);
+            ASSERT(LENGTH == numWritten);
+            ASSERT(isPattern(drained.data(), LENGTH, 0));
+
+            // Fill the pipe, then observe that no byte can be written.
+
+            const int rc = Util::write(fds[1], blob);
+            ASSERTV(rc, 0 < rc && rc < LENGTH);
+
+            errno = 0;
+            ASSERT(0      > Util::write(fds[1], blob, rc, LENGTH - rc));
+            ASSERT(EAGAIN == errno || EWOULDBLOCK == errno);
+
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+#endif
+
+        if (verbose) cout << "\nTesting errors." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(256);
+            Blob                           blob(&factory);
+            appendPattern(&blob, 5);
+
+            ASSERT(0 > Util::write(FUtil::k_INVALID_FD, blob));
+            ASSERT(0 > Util::writeAt(FUtil::k_INVALID_FD, 0, blob));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            TempFile file;
+
+            bdlbb::SimpleBlobBufferFactory factory(8);
+            Blob                           blob(&factory);
+            appendPattern(&blob, 10);
+
+            const FileDescriptor FD = file.descriptor();
+
+            ASSERT_PASS(Util::write(FD, blob, 0, 10));
+            ASSERT_PASS(Util::write(FD, blob, 10, 0));
+            ASSERT_FAIL(Util::write(FD, blob, -1, 1));
+            ASSERT_FAIL(Util::write(FD, blob, 0, -1));
+            ASSERT_FAIL(Util::write(FD, blob, 0, 11));
+            ASSERT_FAIL(Util::write(FD, blob, 11, 0));
+
+            ASSERT_PASS(Util::writeAt(FD, 0, blob, 5, 5));
+            ASSERT_FAIL(Util::writeAt(FD, -1, blob, 0, 1));
+            ASSERT_FAIL(Util::writeAt(FD, 0, blob, 5, 6));
+
+            ASSERT_PASS(Util::read(&blob, FD, 0));
+            ASSERT_FAIL(Util::read(0, FD, 1));
+            ASSERT_FAIL(Util::read(&blob, FD, -1));
+            ASSERT_FAIL(Util::readAt(&blob, FD, -1, 1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadIovecs'
+        //
+        // Concerns:
+        //: 1 The elements loaded describe, in order, the segments of the
+        //:   buffers of the blob holding the specified range, the first
+        //:   starting at the first byte of the range and the last ending at
+        //:   its last byte, with one element per buffer spanned.
+        //:
+        //: 2 The range may extend past the data of the blob into its
+        //:   capacity.
+        //:
+        //: 3 Zero-size buffers are not described.
+        //:
+        //: 4 No more than the specified maximum number of elements are
+        //:   loaded, describing a prefix of the range.
+        //:
+        //: 5 The two-argument overload describes the data of the blob.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For blobs of various lengths made of buffers of various sizes,
+        //:   with capacity past their data, and for every range of the blob
+        //:   (or a sample of them, for large blobs), and for several maximum
+        //:   numbers of elements, verify the elements loaded against the
+        //:   addresses of the bytes of the range, computed independently.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Repeat P-1 for a blob with zero-size buffers inserted.  (C-3)
+        //:
+        //: 3 Compare the two-argument overload with the five-argument one.
+        //:   (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int loadIovecs(Iovec *, int, const Blob&);
+        //   int loadIovecs(Iovec *, int, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'loadIovecs'"
+                          << "\n====================" << endl;
+
+        const int BUFFER_SIZES[]   = { 1, 3, 8, 100 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                                       / sizeof *BUFFER_SIZES;
+
+        const int LENGTHS[]   = { 0, 1, 2, 7, 24, 300 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int MAX_NUM_IOVECS[]   = { 1, 2, 5, 1000 };
+        const int NUM_MAX_NUM_IOVECS = sizeof MAX_NUM_IOVECS
+                                                     / sizeof *MAX_NUM_IOVECS;
+
+        Iovec iovecs[1000];
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+        for (int tj = 0; tj < NUM_LENGTHS;      ++tj) {
+        for (int tk = 0; tk < 2;                ++tk) {
+            const int  BUFFER_SIZE = BUFFER_SIZES[ti];
+            const int  LENGTH      = LENGTHS[tj];
+            const bool ZERO_SIZE   = 1 == tk;
+
+            if (veryVerbose) { T_ P_(BUFFER_SIZE) P_(LENGTH) P(ZERO_SIZE) }
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+            Blob                           blob(&factory);
+            appendPattern(&blob, LENGTH);
+
+            // Add capacity past the data.
+
+            blob.setLength(LENGTH + 2 * BUFFER_SIZE);
+            blob.setLength(LENGTH);
+
+            if (ZERO_SIZE) {
+                bslma::Allocator *allocator =
+                                            bslma::Default::defaultAllocator();
+
+                bsl::shared_ptr<char> data(
+                                   static_cast<char *>(allocator->allocate(1)),
+                                   allocator);
+                bdlbb::BlobBuffer     empty(data, 0);
+
+                blob.insertBuffer(0, empty);
+                blob.insertBuffer(blob.numBuffers() / 2, empty);
+                blob.insertBuffer(blob.numBuffers(), empty);
+                ASSERTV(LENGTH, LENGTH == blob.length());
+            }
+
+            const int TOTAL_SIZE = blob.totalSize();
+
+            // Sample at most about 20 positions and lengths.
+
+            const int STEP = 1 + TOTAL_SIZE / 20;
+
+            for (int position = 0; position <= TOTAL_SIZE; position += STEP) {
+            for (int length = 0; length <= TOTAL_SIZE - position;
+                                                             length += STEP) {
+            for (int tl = 0; tl < NUM_MAX_NUM_IOVECS; ++tl) {
+                const int MAX = MAX_NUM_IOVECS[tl];
+
+                const int NUM_SEGMENTS = numSegments(blob, position, length);
+                const int EXP          = bsl::min(MAX, NUM_SEGMENTS);
+
+                const int rc = Util::loadIovecs(iovecs,
+                                                MAX,
+                                                blob,
+                                                position,
+                                                length);
+                ASSERTV(BUFFER_SIZE, LENGTH, position, length, MAX, rc,
+                        EXP == rc);
+
+                const int described = checkIovecs(iovecs,
+                                                  rc,
+                                                  blob,
+                                                  position,
+                                                  length);
+                ASSERTV(BUFFER_SIZE, LENGTH, position, length, MAX, described,
+                        MAX < NUM_SEGMENTS ? 0 < described
+                                           : length == described);
+            }
+            }
+            }
+
+            const int rc = Util::loadIovecs(iovecs, 1000, blob);
+            ASSERTV(BUFFER_SIZE, LENGTH, rc,
+                    numSegments(blob, 0, LENGTH) == rc);
+            ASSERTV(BUFFER_SIZE, LENGTH,
+                    LENGTH == checkIovecs(iovecs, rc, blob, 0, LENGTH));
+        }
+        }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(8);
+            Blob                           blob(&factory);
+            appendPattern(&blob, 10);
+
+            const int TOTAL_SIZE = blob.totalSize();
+
+            ASSERT_PASS(Util::loadIovecs(iovecs, 1, blob, 0, TOTAL_SIZE));
+            ASSERT_PASS(Util::loadIovecs(iovecs, 1, blob, TOTAL_SIZE, 0));
+            ASSERT_FAIL(Util::loadIovecs(0, 1, blob, 0, 1));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 0, blob, 0, 1));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 1, blob, -1, 1));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 1, blob, 0, -1));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 1, blob, 0, TOTAL_SIZE + 1));
+            ASSERT_FAIL(Util::loadIovecs(iovecs, 1, blob, TOTAL_SIZE + 1, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'advanceIovecs'
+        //
+        // Concerns:
+        //: 1 The elements wholly covered by the specified number of bytes are
+        //:   removed, and the first remaining one starts at the first byte
+        //:   not covered.
+        //:
+        //: 2 Advancing by 0 bytes changes nothing (except removing leading
+        //:   empty elements), and advancing by the total length removes all
+        //:   elements.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arrays of elements of various lengths describing consecutive
+        //:   bytes of a buffer, advance by every number of bytes up to the
+        //:   total length, and verify that the remaining elements describe
+        //:   the remaining bytes.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   void advanceIovecs(Iovec **, int *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'advanceIovecs'"
+                          << "\n=======================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_lengths;  // lengths of the elements, as digits
+        } DATA[] = {
+            //LINE  LENGTHS
+            //----  -------
+            { L_,   ""          },
+            { L_,   "1"         },
+            { L_,   "5"         },
+            { L_,   "11"        },
+            { L_,   "123"       },
+            { L_,   "9191"      },
+            { L_,   "8888888"   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        char buffer[100];
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const LENGTHS = DATA[ti].d_lengths;
+            const int         NUM     = static_cast<int>(bsl::strlen(LENGTHS));
+
+            int total = 0;
+            for (int i = 0; i < NUM; ++i) {
+                total += LENGTHS[i] - '0';
+            }
+
+            for (int numBytes = 0; numBytes <= total; ++numBytes) {
+                Iovec iovecs[10];
+                int   offset = 0;
+                for (int i = 0; i < NUM; ++i) {
+                    iovecs[i].iov_base = buffer + offset;
+                    iovecs[i].iov_len  = LENGTHS[i] - '0';
+                    offset += LENGTHS[i] - '0';
+                }
+
+                Iovec *first     = iovecs;
+                int    numIovecs = NUM;
+
+                Util::advanceIovecs(&first, &numIovecs, numBytes);
+
+                ASSERTV(LINE, numBytes, 0 <= numIovecs);
+                ASSERTV(LINE, numBytes, first + numIovecs == iovecs + NUM);
+
+                // The remaining elements describe the remaining bytes.
+
+                int position = numBytes;
+                for (int i = 0; i < numIovecs; ++i) {
+                    ASSERTV(LINE, numBytes, i, 0 < first[i].iov_len);
+                    ASSERTV(LINE, numBytes, i,
+                            buffer + position == first[i].iov_base);
+                    position += static_cast<int>(first[i].iov_len);
+                }
+                ASSERTV(LINE, numBytes, position, total == position);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Iovec iovecs[2];
+            iovecs[0].iov_base = buffer;
+            iovecs[0].iov_len  = 3;
+            iovecs[1].iov_base = buffer + 3;
+            iovecs[1].iov_len  = 4;
+
+            Iovec *first     = iovecs;
+            int    numIovecs = 2;
+
+            ASSERT_PASS(Util::advanceIovecs(&first, &numIovecs, 0));
+            ASSERT_FAIL(Util::advanceIovecs(0, &numIovecs, 0));
+            ASSERT_FAIL(Util::advanceIovecs(&first, 0, 0));
+            ASSERT_FAIL(Util::advanceIovecs(&first, &numIovecs, 8));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a blob to a temporary file, and read it back into another
+        //:   blob.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bdlbb::SimpleBlobBufferFactory factory(16);
+        Blob                           blob(&factory);
+        appendPattern(&blob, 100);
+
+        Iovec iovecs[Util::k_MAX_NUM_IOVECS];
+        ASSERT(7 == Util::loadIovecs(iovecs, Util::k_MAX_NUM_IOVECS, blob));
+
+        TempFile file;
+        ASSERT(100 == Util::write(file.descriptor(), blob));
+
+        Blob received(&factory);
+        ASSERT(100 == Util::readAt(&received, file.descriptor(), 0, 200));
+        ASSERT(100 == received.length());
+        ASSERT(0   == bdlbb::BlobUtil::compare(blob, received));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: WRITE THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Writing a blob with 'writeAt' is faster than copying it into a
+        //:   contiguous buffer and writing that.
+        //
+        // Plan:
+        //: 1 For blobs of 4 KiB to 1 MiB made of 1 KiB buffers, time writing
+        //:   them to the start of a temporary file, a total of 1 GiB (or the
+        //:   number of MiB given as the second argument), with 'writeAt', and
+        //:   with 'bdlbb::BlobUtil::getContiguousRangeOrCopy' followed by
+        //:   'bdls::FilesystemUtil::write', and report their throughput in
+        //:   GB/s.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: WRITE THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: WRITE THROUGHPUT"
+                          << "\n==================================" << endl;
+
+        int numMiB = argc > 2 ? atoi(argv[2]) : 0;
+        if (numMiB <= 0) {
+            numMiB = 1024;
+        }
+        const double TOTAL = numMiB * 1024.0 * 1024.0;
+
+        const int SIZES[]   = { 4096, 65536, 1 << 20 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        TempFile                       file;
+        bdlbb::SimpleBlobBufferFactory factory(1024);
+        bsl::vector<char>              copy(1 << 20);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE = SIZES[i];
+            const int REPS = static_cast<int>(TOTAL / SIZE);
+
+            Blob blob(&factory);
+            appendPattern(&blob, SIZE);
+
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int j = 0; j < REPS; ++j) {
+                Util::writeAt(file.descriptor(), 0, blob);
+            }
+            timer.stop();
+            const double IOVEC = TOTAL / timer.elapsedTime() / 1e9;
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < REPS; ++j) {
+                const char *data = bdlbb::BlobUtil::getContiguousRangeOrCopy(
+                                                                  copy.data(),
+                                                                  blob,
+                                                                  0,
+                                                                  SIZE);
+                FUtil::seek(file.descriptor(),
+                            0,
+                            FUtil::e_SEEK_FROM_BEGINNING);
+                FUtil::write(file.descriptor(), data, SIZE);
+            }
+            timer.stop();
+            const double COPY = TOTAL / timer.elapsedTime() / 1e9;
+
+            cout << "size " << SIZE
+                 << ": writeAt " << IOVEC << " GB/s"
+                 << ", copy and write " << COPY << " GB/s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -56,6 +56,37 @@ void copyFromPlace(char                *dstBuffer,
     } while (copied < length);
 }
 
+template <class CHECKSUM>
+void updateChecksumImp(CHECKSUM           *checksum,
+                       const bdlbb::Blob&  source,
+                       int                 position,
+                       int                 length)
+    // Update the specified 'checksum' to incorporate the specified 'length'
+    // bytes starting at the specified 'position' in the specified 'source'
+    // blob.  The behavior is undefined unless '0 <= position', '0 <= length',
+    // and 'position <= source.length() - length'.
+{
+    BSLS_ASSERT(checksum);
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= length);
+    BSLS_ASSERT(position <= source.length() - length);
+
+    if (0 == length) {
+        return;                                                       // RETURN
+    }
+
+    bsl::pair<int, int> place =
+                  bdlbb::BlobUtil::findBufferIndexAndOffset(source, position);
+    do {
+        const bdlbb::BlobBuffer& buf = source.buffer(place.first);
+        const int toUpdate = bsl::min(length, buf.size() - place.second);
+        checksum->update(buf.data() + place.second, toUpdate);
+        length -= toUpdate;
+        ++place.first;
+        place.second = 0;
+    } while (0 < length);
+}
+
 }  // close unnamed namespace
 
 namespace bdlbb {
@@ -696,6 +727,33 @@ int BlobUtil::compare(const Blob& a, const Blob& b)
 
     return lhsLen - rhsLen;
 }
+
+void BlobUtil::updateChecksum(bdlde::Crc32 *checksum, const Blob& source)
+{
+    updateChecksumImp(checksum, source, 0, source.length());
+}
+
+void BlobUtil::updateChecksum(bdlde::Crc64 *checksum, const Blob& source)
+{
+    updateChecksumImp(checksum, source, 0, source.length());
+}
+
+void BlobUtil::updateChecksum(bdlde::Crc32 *checksum,
+                              const Blob&   source,
+                              int           position,
+                              int           length)
+{
+    updateChecksumImp(checksum, source, position, length);
+}
+
+void BlobUtil::updateChecksum(bdlde::Crc64 *checksum,
+                              const Blob&   source,
+                              int           position,
+                              int           length)
+{
+    updateChecksumImp(checksum, source, position, length);
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -18,11 +18,19 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This 'struct' provides a variety of utilities for 'bdlbb::Blob'
 // objects, 'bdlbb::BlobUtil', such as I/O functions, comparison functions, and
 // streaming functions.
+//
+// The 'updateChecksum' functions update a 'bdlde::Crc32' or 'bdlde::Crc64'
+// checksum with the data of a blob, or of a range of it, one buffer at a
+// time, so that a frame held in a blob can be checksummed without first being
+// copied into a contiguous buffer.
 
 #include <bdlscm_version.h>
 
 #include <bdlbb_blob.h>
 
+#include <bdlde_crc32.h>
+#include <bdlde_crc64.h>
+
 #include <bslma_allocator.h>
 
 #include <bsls_assert.h>
@@ -216,6 +224,25 @@ struct BlobUtil {
         // lexicographically less than 'b', and a positive value if 'a' is
         // lexicographically greater than 'b'.
 
+    static void updateChecksum(bdlde::Crc32 *checksum, const Blob& source);
+    static void updateChecksum(bdlde::Crc64 *checksum, const Blob& source);
+        // Update the specified 'checksum' to incorporate the data of the
+        // specified 'source' blob, as if by calling 'update' on each data
+        // buffer of 'source' in turn.
+
+    static void updateChecksum(bdlde::Crc32 *checksum,
+                               const Blob&   source,
+                               int           position,
+                               int           length);
+    static void updateChecksum(bdlde::Crc64 *checksum,
+                               const Blob&   source,
+                               int           position,
+                               int           length);
+        // Update the specified 'checksum' to incorporate the specified
+        // 'length' bytes starting at the specified 'position' in the specified
+        // 'source' blob.  The behavior is undefined unless '0 <= position',
+        // '0 <= length', and 'position <= source.length() - length'.
+
     // ---------- DEPRECATED FUNCTIONS ------------- //
 
     // DEPRECATED FUNCTIONS: basicAllocator is no longer used
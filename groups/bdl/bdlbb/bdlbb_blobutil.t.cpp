@@ -12,6 +12,9 @@
 #include <bdlbb_blob.h>
 #include <bdlbb_simpleblobbufferfactory.h>
 
+#include <bdlde_crc32.h>
+#include <bdlde_crc64.h>
+
 #include <bdlsb_fixedmemoutstreambuf.h>
 
 #include <bslim_testutil.h>
@@ -34,6 +37,7 @@
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -41,6 +45,10 @@ using namespace bsl;  // automatically added by script
 //=============================================================================
 //                                  TEST PLAN
 //-----------------------------------------------------------------------------
+// [12] void updateChecksum(bdlde::Crc32 *, const Blob&);
+// [12] void updateChecksum(bdlde::Crc64 *, const Blob&);
+// [12] void updateChecksum(bdlde::Crc32 *, const Blob&, int, int);
+// [12] void updateChecksum(bdlde::Crc64 *, const Blob&, int, int);
 // [10] Testing copy to a blob
 // [ 9] Testing getContiguousRangeOrCopy
 // [ 8] Testing getContiguousDataBuffer
@@ -351,6 +359,162 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'updateChecksum'
+        //
+        // Concerns:
+        //: 1 The checksum is updated with the data of the blob, or of the
+        //:   specified range of it, for any division of the data into
+        //:   buffers, including a range starting or ending inside a buffer.
+        //:
+        //: 2 The bytes beyond the length of the blob are ignored.
+        //:
+        //: 3 The checksum is updated, rather than reset.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For blobs of various lengths made of buffers of various sizes,
+        //:   holding a pseudo-random pattern, and for ranges of the blob
+        //:   with a start and an end within a byte of those of a buffer,
+        //:   compare the checksums computed by 'updateChecksum' with those of
+        //:   a contiguous copy of the range, starting from a checksum that
+        //:   has already been updated.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void updateChecksum(bdlde::Crc32 *, const Blob&);
+        //   void updateChecksum(bdlde::Crc64 *, const Blob&);
+        //   void updateChecksum(bdlde::Crc32 *, const Blob&, int, int);
+        //   void updateChecksum(bdlde::Crc64 *, const Blob&, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'updateChecksum'"
+                          << "\n========================" << endl;
+
+        const int BUFFER_SIZES[]   = { 1, 7, 64, 100, 1000 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                                       / sizeof *BUFFER_SIZES;
+
+        const int LENGTHS[]   = { 0, 1, 63, 64, 65, 300, 2000 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const char PREFIX[] = "prefix";
+
+        for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+            const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+
+            for (int tj = 0; tj < NUM_LENGTHS; ++tj) {
+                const int LENGTH = LENGTHS[tj];
+
+                if (veryVerbose) { T_ P_(BUFFER_SIZE) P(LENGTH) }
+
+                Blob blob(&factory);
+                blob.setLength(LENGTH + BUFFER_SIZE / 2);
+
+                bsl::vector<char> data(LENGTH + BUFFER_SIZE / 2 + 1);
+                unsigned int      seed = 12345;
+                for (int i = 0; i < blob.length(); ++i) {
+                    seed    = seed * 1103515245 + 12345;
+                    data[i] = static_cast<char>(seed >> 16);
+                }
+                Util::copy(&blob, 0, data.data(), blob.length());
+                blob.setLength(LENGTH);
+
+                bdlde::Crc32 crc32(PREFIX, sizeof PREFIX);
+                bdlde::Crc64 crc64(PREFIX, sizeof PREFIX);
+                Util::updateChecksum(&crc32, blob);
+                Util::updateChecksum(&crc64, blob);
+
+                bdlde::Crc32 expected32(PREFIX, sizeof PREFIX);
+                bdlde::Crc64 expected64(PREFIX, sizeof PREFIX);
+                expected32.update(data.data(), LENGTH);
+                expected64.update(data.data(), LENGTH);
+
+                ASSERTV(BUFFER_SIZE, LENGTH, expected32 == crc32);
+                ASSERTV(BUFFER_SIZE, LENGTH, expected64 == crc64);
+
+                // Ranges start and end near every 'STEP / BUFFER_SIZE'th
+                // buffer boundary, so that at most ten are tried.
+
+                const int STEP = BUFFER_SIZE
+                               * (1 + LENGTH / (10 * BUFFER_SIZE));
+
+                for (int bi = 0; bi <= LENGTH; bi += STEP) {
+                for (int bj = bi; bj <= LENGTH; bj += STEP) {
+                for (int di = -1; di <= 1; ++di) {
+                for (int dj = -1; dj <= 1; ++dj) {
+                    const int POSITION = bi + di;
+                    const int END      = bj + dj;
+
+                    if (POSITION < 0 || END < POSITION || LENGTH < END) {
+                        continue;
+                    }
+
+                    const int NUM_BYTES = END - POSITION;
+
+                    bdlde::Crc32 mX32(PREFIX, sizeof PREFIX);
+                    bdlde::Crc64 mX64(PREFIX, sizeof PREFIX);
+                    Util::updateChecksum(&mX32, blob, POSITION, NUM_BYTES);
+                    Util::updateChecksum(&mX64, blob, POSITION, NUM_BYTES);
+
+                    bdlde::Crc32 exp32(PREFIX, sizeof PREFIX);
+                    bdlde::Crc64 exp64(PREFIX, sizeof PREFIX);
+                    exp32.update(data.data() + POSITION, NUM_BYTES);
+                    exp64.update(data.data() + POSITION, NUM_BYTES);
+
+                    ASSERTV(BUFFER_SIZE, LENGTH, POSITION, NUM_BYTES,
+                            exp32 == mX32);
+                    ASSERTV(BUFFER_SIZE, LENGTH, POSITION, NUM_BYTES,
+                            exp64 == mX64);
+                }
+                }
+                }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(10);
+
+            Blob blob(&factory);
+            blob.setLength(15);
+
+            bdlde::Crc32 crc32;
+            bdlde::Crc64 crc64;
+
+            ASSERT_PASS(Util::updateChecksum(&crc32, blob));
+            ASSERT_FAIL(Util::updateChecksum(static_cast<bdlde::Crc32 *>(0),
+                                             blob));
+            ASSERT_PASS(Util::updateChecksum(&crc64, blob));
+            ASSERT_FAIL(Util::updateChecksum(static_cast<bdlde::Crc64 *>(0),
+                                             blob));
+
+            ASSERT_PASS(Util::updateChecksum(&crc32, blob,  0,  0));
+            ASSERT_FAIL(Util::updateChecksum(&crc32, blob, -1,  0));
+            ASSERT_FAIL(Util::updateChecksum(&crc32, blob,  0, -1));
+            ASSERT_PASS(Util::updateChecksum(&crc32, blob, 15,  0));
+            ASSERT_PASS(Util::updateChecksum(&crc32, blob,  5, 10));
+            ASSERT_FAIL(Util::updateChecksum(&crc32, blob,  5, 11));
+            ASSERT_FAIL(Util::updateChecksum(&crc32, blob, 16,  0));
+
+            ASSERT_PASS(Util::updateChecksum(&crc64, blob,  0,  0));
+            ASSERT_FAIL(Util::updateChecksum(&crc64, blob, -1,  0));
+            ASSERT_FAIL(Util::updateChecksum(&crc64, blob,  0, -1));
+            ASSERT_PASS(Util::updateChecksum(&crc64, blob, 15,  0));
+            ASSERT_PASS(Util::updateChecksum(&crc64, blob,  5, 10));
+            ASSERT_FAIL(Util::updateChecksum(&crc64, blob,  5, 11));
+            ASSERT_FAIL(Util::updateChecksum(&crc64, blob, 16,  0));
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING FIX TO DRQS 144543867
@@ -0,0 +1,1016 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered map container.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressed unordered map container
+//
+//@SEE_ALSO: bdlc_flathashset, bdlc_flathashtable, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashMap', that implements an unordered map of unique keys to
+// values using an open-addressed hash table in which the key-value pairs are
+// stored directly in a single array of slots (see 'bdlc_flathashtable').
+//
+// 'bdlc::FlatHashMap' provides an interface similar to that of
+// 'bsl::unordered_map', but does not allocate a node per element, and looks
+// up keys by examining 16 one-byte control entries at once (using SSE2
+// instructions where available), so that lookups typically touch one cache
+// line of control bytes and one element.  For maps of small elements, lookup,
+// insertion, and iteration are therefore typically several times faster than
+// for 'bsl::unordered_map', and memory use is lower.
+//
+// In exchange, 'bdlc::FlatHashMap' offers weaker guarantees:
+//
+//: o Any insertion (including 'operator[]' for a new key), 'rehash', and
+//:   'reserve' may relocate every element, invalidating all iterators,
+//:   pointers, and references to elements.  (Erasing an element invalidates
+//:   only iterators, pointers, and references to that element.)
+//:
+//: o There is no bucket interface, and the maximum load factor is fixed at
+//:   7/8.
+//:
+//: o The 'value_type' is 'bsl::pair<KEY, VALUE>' (not
+//:   'bsl::pair<const KEY, VALUE>'), so that elements can be relocated by
+//:   moving; modifying the key of an element through an iterator results in
+//:   undefined behavior.
+//:
+//: o Insertion provides only the basic exception-safety guarantee if the
+//:   table is rehashed and 'bsl::pair<KEY, VALUE>' is neither bitwise
+//:   moveable nor has a non-throwing move constructor.
+//
+// The 'HASH' functor should distribute its result well over all the bits of
+// 'bsl::size_t'; the default 'bslh::Hash<>' does so.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a sequence of
+// words.  A 'bdlc::FlatHashMap' provides fast lookup of the count for a word,
+// and 'operator[]' inserts a zero count for a word seen for the first time.
+//
+// First, we define the words to count:
+//..
+//  const char *WORDS[] = { "apple", "banana", "apple", "cherry", "banana",
+//                          "apple" };
+//  const int   NUM_WORDS = static_cast<int>(sizeof WORDS / sizeof *WORDS);
+//..
+// Then, we create a map and count the words:
+//..
+//  bdlc::FlatHashMap<bsl::string, int> counts;
+//
+//  for (int i = 0; i < NUM_WORDS; ++i) {
+//      ++counts[WORDS[i]];
+//  }
+//..
+// Finally, we verify the counts:
+//..
+//  assert(3 == counts.size());
+//  assert(3 == counts["apple"]);
+//  assert(2 == counts["banana"]);
+//  assert(1 == counts["cherry"]);
+//  assert(!counts.contains("durian"));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ============================
+                        // struct FlatHashMap_EntryUtil
+                        // ============================
+
+template <class KEY, class VALUE, class ENTRY>
+struct FlatHashMap_EntryUtil {
+    // This templated utility provides methods to construct an 'ENTRY' from a
+    // key and to obtain the key of an 'ENTRY', for use by 'FlatHashTable'.
+
+    // CLASS METHODS
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Create, at the specified 'entry' address, an entry holding the
+        // specified 'key' and a default-constructed 'VALUE', using the
+        // specified 'allocator' to supply memory.
+
+    static const KEY& key(const ENTRY& entry);
+        // Return a reference offering non-modifiable access to the key of the
+        // specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashMap
+                            // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template implements a value-semantic container that holds
+    // an unordered set of key-value pairs having unique keys, stored in an
+    // open-addressed hash table.
+
+    // PRIVATE TYPES
+    typedef bsl::pair<KEY, VALUE>                                EntryType;
+    typedef FlatHashMap_EntryUtil<KEY, VALUE, EntryType>         EntryUtil;
+    typedef FlatHashTable<KEY, EntryType, EntryUtil, HASH, EQUAL>
+                                                                 ImplType;
+    typedef bslmf::MovableRefUtil                                MoveUtil;
+
+    // DATA
+    ImplType d_impl;  // underlying hash table
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                key_type;
+    typedef VALUE                              mapped_type;
+    typedef EntryType                          value_type;
+    typedef bsl::size_t                        size_type;
+    typedef bsl::ptrdiff_t                     difference_type;
+    typedef HASH                               hasher;
+    typedef EQUAL                              key_equal;
+    typedef value_type&                        reference;
+    typedef const value_type&                  const_reference;
+    typedef typename ImplType::iterator        iterator;
+    typedef typename ImplType::const_iterator  const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashMap();
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    explicit FlatHashMap(bsl::size_t capacity);
+    FlatHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty map.  Optionally specify a 'capacity' indicating
+        // the minimum initial number of slots; if 'capacity' is not
+        // supplied or is 0, no memory is allocated.  Optionally specify a
+        // 'hash' functor used to generate hash values for keys; if 'hash' is
+        // not supplied, a default-constructed 'HASH' is used.  Optionally
+        // specify an 'equal' functor used to compare keys; if 'equal' is not
+        // supplied, a default-constructed 'EQUAL' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator
+        // is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash  = HASH(),
+                const EQUAL&      equal = EQUAL(),
+                bslma::Allocator *basicAllocator = 0);
+        // Create a map, having the optionally specified 'capacity', 'hash',
+        // and 'equal' (see above), holding each value in the range
+        // '[first .. last)' whose key is not the key of a preceding value in
+        // the range.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless 'first' and
+        // 'last' delimit a valid range of values convertible to
+        // 'value_type'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashMap(bsl::initializer_list<value_type>  values,
+                bslma::Allocator                  *basicAllocator = 0);
+        // Create a map holding each of the specified 'values' whose key is
+        // not the key of a preceding value.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+#endif
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a map having the same value, hasher, and key-equality
+        // comparator as the specified 'original'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap> original);
+        // Create a map having the same value, hasher, key-equality
+        // comparator, and allocator as the specified 'original'.  'original'
+        // is left empty, with no capacity.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a map having the same value, hasher, and key-equality
+        // comparator as the specified 'original', using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  If
+        // 'basicAllocator' is the allocator of 'original', 'original' is left
+        // empty, with no capacity; otherwise it is left in a valid but
+        // unspecified state.
+
+    // ~FlatHashMap() = default;
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatHashMap& operator=(const FlatHashMap& rhs);
+        // Assign to this object the value, hasher, and key-equality
+        // comparator of the specified 'rhs', and return a reference providing
+        // modifiable access to this object.
+
+    FlatHashMap& operator=(bslmf::MovableRef<FlatHashMap> rhs);
+        // Assign to this object the value, hasher, and key-equality
+        // comparator of the specified 'rhs', and return a reference providing
+        // modifiable access to this object.  If this object and 'rhs' use the
+        // same allocator, 'rhs' is left empty, with no capacity; otherwise it
+        // is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashMap& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value of a map holding each of the
+        // specified 'values' whose key is not the key of a preceding value,
+        // and return a reference providing modifiable access to this object.
+#endif
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference to the value of the element having the specified
+        // 'key', first inserting an element having 'key' and a
+        // default-constructed 'VALUE' if there is no such element.
+
+    VALUE& at(const KEY& key);
+        // Return a reference to the value of the element having the specified
+        // 'key'.  Throw a 'std::out_of_range' exception if there is no such
+        // element.
+
+    void clear();
+        // Remove all elements from this map, retaining its capacity.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators delimiting the range of elements having
+        // the specified 'key', which is empty if there is no such element.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key', if any, and return
+        // the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove the element at the specified 'position', and return an
+        // iterator referring to the element following it, or the past-the-end
+        // iterator if there is none.  The behavior is undefined unless
+        // 'position' refers to an element of this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the range '[first .. last)', and return
+        // 'last' as a modifiable iterator.  The behavior is undefined unless
+        // 'first' and 'last' delimit a valid range of this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element having the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<value_type> value);
+        // Insert a copy of the specified 'value' (moved, in the second
+        // overload) if this map has no element having its key.  Return an
+        // iterator referring to the element of this map having the key of
+        // 'value', and 'true' if 'value' was inserted or 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert a copy of each value in the range '[first .. last)' whose
+        // key is not already present in this map.  The behavior is undefined
+        // unless 'first' and 'last' delimit a valid range of values
+        // convertible to 'value_type'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert a copy of each of the specified 'values' whose key is not
+        // already present in this map.
+#endif
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this map to the smallest valid capacity not
+        // less than the specified 'minimumCapacity' that admits the current
+        // number of elements.
+
+    void reserve(bsl::size_t numEntries);
+        // Increase, if needed, the capacity of this map so that it admits at
+        // least the specified 'numEntries' without rehashing.
+
+    void reset();
+        // Remove all elements from this map and release its memory, leaving
+        // it with no capacity.
+
+    bsl::pair<iterator, bool> try_emplace(const KEY& key);
+        // Insert an element having the specified 'key' and a
+        // default-constructed 'VALUE' if this map has no element having
+        // 'key'.  Return an iterator referring to the element of this map
+        // having 'key', and 'true' if an element was inserted or 'false'
+        // otherwise.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first element of this map, or
+        // the past-the-end iterator if this map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this map.
+
+                          // Aspects
+
+    void swap(FlatHashMap& other);
+        // Exchange the value, hasher, and key-equality comparator of this
+        // object with those of the specified 'other' object.  This method
+        // provides the no-throw exception-safety guarantee if 'HASH' and
+        // 'EQUAL' have no-throw swaps.  The behavior is undefined unless this
+        // object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference offering non-modifiable access to the value of
+        // the element having the specified 'key'.  Throw a
+        // 'std::out_of_range' exception if there is no such element.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this map.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map has an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map has no elements, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                        const KEY& key) const;
+        // Return a pair of iterators delimiting the range of elements having
+        // the specified 'key', which is empty if there is no such element.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element having the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this map.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality comparator of this map.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements to the capacity of this
+        // map, or 0 if it has no capacity.
+
+    float max_load_factor() const;
+        // Return the load factor beyond which this map is rehashed (7/8).
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this map, or
+        // the past-the-end iterator if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this map.
+
+                          // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps have the same
+    // value, and 'false' otherwise.  Two maps have the same value if they
+    // have the same number of elements and, for each element of 'lhs', 'rhs'
+    // has an element having the same key and the same value.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  If 'a' and
+    // 'b' use the same allocator, this function provides the no-throw
+    // exception-safety guarantee (if 'HASH' and 'EQUAL' do); otherwise, the
+    // values are exchanged by copying, and this function provides the basic
+    // guarantee.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct FlatHashMap_EntryUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE, class ENTRY>
+inline
+void FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::constructFromKey(
+                                                   ENTRY            *entry,
+                                                   bslma::Allocator *allocator,
+                                                   const KEY&        key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    // Create the value with the map's allocator, so that moving it into the
+    // entry need not copy.
+
+    bsls::ObjectBuffer<VALUE> value;
+    bslma::ConstructionUtil::construct(value.address(), allocator);
+    bslma::DestructorGuard<VALUE> guard(value.address());
+
+    bslma::ConstructionUtil::construct(entry,
+                                       allocator,
+                                       key,
+                                       bslmf::MovableRefUtil::move(
+                                                             value.object()));
+}
+
+template <class KEY, class VALUE, class ENTRY>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::key(const ENTRY& entry)
+{
+    return entry.first;
+}
+
+                            // -----------------
+                            // class FlatHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bslma::Allocator                  *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    d_impl.reserve(values.size());
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                            const FlatHashMap&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                       bslmf::MovableRef<FlatHashMap> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                               bslmf::MovableRef<FlatHashMap>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const FlatHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                            bslmf::MovableRef<FlatHashMap> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                      bsl::initializer_list<value_type> values)
+{
+    FlatHashMap other(values, d_impl.allocator());
+    swap(other);
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    return d_impl.tryEmplace(key).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                    "FlatHashMap<...>::at(key_type): invalid "
+                                    "key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator,
+          typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key)
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                         bslmf::MovableRef<value_type> value)
+{
+    return d_impl.insert(MoveUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                      bsl::initializer_list<value_type> values)
+{
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key)
+{
+    return d_impl.tryEmplace(key);
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+                          // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                    "FlatHashMap<...>::at(key_type): invalid "
+                                    "key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator,
+          typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.cbegin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.cend();
+}
+
+                          // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
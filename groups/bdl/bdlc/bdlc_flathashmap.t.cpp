@@ -0,0 +1,1081 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi', 'rand'
+#include <bsl_iostream.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thin, map-specific layer over
+// 'bdlc::FlatHashTable', which is tested thoroughly in its own test driver.
+// We therefore concentrate on the forwarding of each method to the table, on
+// the map-specific methods ('operator[]', 'at', and 'try_emplace'), and on
+// the propagation of the map's allocator to the keys and values of its
+// elements.  Negative test cases compare the performance of the map with that
+// of 'bsl::unordered_map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap();
+// [ 2] explicit FlatHashMap(bslma::Allocator *);
+// [ 2] explicit FlatHashMap(size_t);
+// [ 2] FlatHashMap(size_t, bslma::Allocator *);
+// [ 2] FlatHashMap(size_t, const HASH&, bslma::Allocator *);
+// [ 2] FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 2] FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+// [ 2] FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, ...);
+// [ 2] FlatHashMap(initializer_list<value_type>, bslma::Allocator *);
+// [ 4] FlatHashMap(const FlatHashMap&, bslma::Allocator *);
+// [ 4] FlatHashMap(MovableRef<FlatHashMap>);
+// [ 4] FlatHashMap(MovableRef<FlatHashMap>, bslma::Allocator *);
+//
+// MANIPULATORS
+// [ 4] FlatHashMap& operator=(const FlatHashMap&);
+// [ 4] FlatHashMap& operator=(MovableRef<FlatHashMap>);
+// [ 4] FlatHashMap& operator=(initializer_list<value_type>);
+// [ 3] VALUE& operator[](const KEY&);
+// [ 3] VALUE& at(const KEY&);
+// [ 3] void clear();
+// [ 3] pair<iterator, iterator> equal_range(const KEY&);
+// [ 3] size_t erase(const KEY&);
+// [ 3] iterator erase(const_iterator);
+// [ 3] iterator erase(iterator);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 3] iterator find(const KEY&);
+// [ 3] pair<iterator, bool> insert(const value_type&);
+// [ 3] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list<value_type>);
+// [ 3] void rehash(size_t);
+// [ 3] void reserve(size_t);
+// [ 3] void reset();
+// [ 3] pair<iterator, bool> try_emplace(const KEY&);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 4] void swap(FlatHashMap&);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY&) const;
+// [ 2] size_t capacity() const;
+// [ 3] bool contains(const KEY&) const;
+// [ 3] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const KEY&)
+// [ 3] const_iterator find(const KEY&) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 3] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashMap&, const FlatHashMap&);
+// [ 4] bool operator!=(const FlatHashMap&, const FlatHashMap&);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatHashMap&, FlatHashMap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: LOOKUP
+// [-2] PERFORMANCE: INSERTION
+// [-3] PERFORMANCE: ITERATION
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlc::FlatHashMap<int, int>                 Obj;
+typedef bdlc::FlatHashMap<bsl::string, bsl::string> StringObj;
+
+// The performance tests use the same hash functor for both containers.
+
+typedef bdlc::FlatHashMap<int, int, bsl::hash<int> > FlatMap;
+typedef bsl::unordered_map<int, int>                 NodeMap;
+
+// ============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct SeededHash {
+    // This functor hashes 'int' keys using a seed supplied at construction,
+    // so that hashers having different seeds are distinguishable.
+
+    int d_seed;
+
+    explicit SeededHash(int seed = 0)
+    : d_seed(seed)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return bslh::Hash<>()(key ^ d_seed);
+    }
+};
+
+struct ModEqual {
+    // This functor compares 'int' keys modulo a divisor supplied at
+    // construction.
+
+    int d_divisor;
+
+    explicit ModEqual(int divisor = 1000000)
+    : d_divisor(divisor)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs % d_divisor == rhs % d_divisor;
+    }
+};
+
+bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique to the specified 'value'.
+{
+    bsl::string result("a string long enough to allocate memory: ");
+    do {
+        result.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    } while (value);
+    return result;
+}
+
+template <class MAP>
+double timeLookups(const MAP& map, const bsl::vector<int>& keys, int numPasses)
+    // Return the number of seconds taken to look up each of the specified
+    // 'keys' in the specified 'map' the specified 'numPasses' times.
+{
+    bsls::Types::Int64 sum = 0;
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int pass = 0; pass < numPasses; ++pass) {
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            typename MAP::const_iterator it = map.find(keys[i]);
+            if (it != map.end()) {
+                sum += it->second;
+            }
+        }
+    }
+    timer.stop();
+
+    if (sum == 42) {
+        cout << "";  // Prevent the optimizer from discarding the lookups.
+    }
+    return timer.elapsedTime();
+}
+
+template <class MAP>
+double timeInsertions(const bsl::vector<int>& keys, int numPasses)
+    // Return the number of seconds taken to insert each of the specified
+    // 'keys' into an initially empty map of type 'MAP', the specified
+    // 'numPasses' times.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int pass = 0; pass < numPasses; ++pass) {
+        MAP map;
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            map[keys[i]] = static_cast<int>(i);
+        }
+        if (map.size() == 42) {
+            cout << "";
+        }
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+template <class MAP>
+double timeIteration(const MAP& map, int numPasses)
+    // Return the number of seconds taken to iterate over the specified 'map'
+    // the specified 'numPasses' times.
+{
+    bsls::Types::Int64 sum = 0;
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int pass = 0; pass < numPasses; ++pass) {
+        for (typename MAP::const_iterator it = map.begin();
+             it != map.end();
+             ++it) {
+            sum += it->second;
+        }
+    }
+    timer.stop();
+
+    if (sum == 42) {
+        cout << "";
+    }
+    return timer.elapsedTime();
+}
+
+bsl::vector<int> makeKeys(int numKeys, int seed)
+    // Return a vector of the specified 'numKeys' distinct pseudo-random keys
+    // generated from the specified 'seed'.
+{
+    bsl::vector<int> keys;
+    keys.reserve(numKeys);
+
+    bsls::Types::Uint64 state = static_cast<bsls::Types::Uint64>(seed);
+    for (int i = 0; i < numKeys; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        keys.push_back(static_cast<int>(state >> 33) * 2 + 1);
+    }
+    return keys;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a sequence of
+// words.  A 'bdlc::FlatHashMap' provides fast lookup of the count for a word,
+// and 'operator[]' inserts a zero count for a word seen for the first time.
+//
+// First, we define the words to count:
+//..
+    const char *WORDS[] = { "apple", "banana", "apple", "cherry", "banana",
+                            "apple" };
+    const int   NUM_WORDS = static_cast<int>(sizeof WORDS / sizeof *WORDS);
+//..
+// Then, we create a map and count the words:
+//..
+    bdlc::FlatHashMap<bsl::string, int> counts;
+
+    for (int i = 0; i < NUM_WORDS; ++i) {
+        ++counts[WORDS[i]];
+    }
+//..
+// Finally, we verify the counts:
+//..
+    ASSERT(3 == counts.size());
+    ASSERT(3 == counts["apple"]);
+    ASSERT(2 == counts["banana"]);
+    ASSERT(1 == counts["cherry"]);
+    ASSERT(!counts.contains("durian"));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment, 'swap', and the
+        //:   equality operators forward to the underlying table.
+        //:
+        //: 2 Equality compares the values of elements as well as the keys.
+        //:
+        //: 3 The allocator of the target of an assignment is unchanged, and is
+        //:   used for the elements it receives.
+        //
+        // Plan:
+        //: 1 Exercise each operation on maps of strings, using distinct test
+        //:   allocators, and verify the values and memory use.  (C-1..3)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap&, bslma::Allocator *);
+        //   FlatHashMap(MovableRef<FlatHashMap>);
+        //   FlatHashMap(MovableRef<FlatHashMap>, bslma::Allocator *);
+        //   FlatHashMap& operator=(const FlatHashMap&);
+        //   FlatHashMap& operator=(MovableRef<FlatHashMap>);
+        //   FlatHashMap& operator=(initializer_list<value_type>);
+        //   void swap(FlatHashMap&);
+        //   bool operator==(const FlatHashMap&, const FlatHashMap&);
+        //   bool operator!=(const FlatHashMap&, const FlatHashMap&);
+        //   void swap(FlatHashMap&, FlatHashMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("a",       veryVeryVeryVerbose);
+        bslma::TestAllocator tb("b",       veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+            for (int i = 0; i < 40; ++i) {
+                mX[makeString(i)] = makeString(-i);
+            }
+
+            StringObj mY(X, &tb);  const StringObj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+            ASSERT(&tb == Y.allocator());
+            ASSERT(0 == da.numBlocksInUse());
+
+            // Equality compares values as well as keys.
+
+            mY[makeString(7)] = makeString(700);
+            ASSERT(X != Y);
+            mY[makeString(7)] = makeString(-7);
+            ASSERT(X == Y);
+
+            {
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                StringObj mZ(MoveUtil::move(mX));  const StringObj& Z = mZ;
+                ASSERT(Y == Z);
+                ASSERT(X.empty());
+                ASSERT(&ta == Z.allocator());
+                ASSERT(tam.isTotalSame());
+
+                mX = MoveUtil::move(mZ);
+                ASSERT(Y == X);
+                ASSERT(Z.empty());
+                ASSERT(tam.isTotalSame());
+            }
+
+            StringObj mW(MoveUtil::move(mY), &ta);  const StringObj& W = mW;
+            ASSERT(X == W);
+            ASSERT(&ta == W.allocator());
+
+            mY = W;
+            ASSERT(X == Y);
+            ASSERT(&tb == Y.allocator());
+
+            mW.clear();
+            mW[makeString(1)] = makeString(1);
+
+            {
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                mW.swap(mX);
+                ASSERT(40 == W.size());
+                ASSERT(1  == X.size());
+                ASSERT(tam.isTotalSame());
+
+                swap(mW, mX);
+                ASSERT(1  == W.size());
+                ASSERT(40 == X.size());
+                ASSERT(tam.isTotalSame());
+            }
+
+            swap(mW, mY);
+            ASSERT(40 == W.size());
+            ASSERT(1  == Y.size());
+            ASSERT(&ta == W.allocator());
+            ASSERT(&tb == Y.allocator());
+            ASSERT(X == W);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mY = { { "a", "1" }, { "b", "2" }, { "a", "3" } };
+            ASSERT(2 == Y.size());
+            ASSERT("1" == Y.at("a"));
+            ASSERT(&tb == Y.allocator());
+#endif
+            ASSERT(0 == da.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'operator[]' and 'try_emplace' insert a default-constructed value
+        //:   for an absent key, and return the existing value otherwise.
+        //:
+        //: 2 'at' returns the value for a present key, and throws
+        //:   'std::out_of_range' for an absent key.
+        //:
+        //: 3 The keys and values of elements, however inserted, use the map's
+        //:   allocator; no memory comes from the default allocator.
+        //:
+        //: 4 Each remaining method forwards to the underlying table.
+        //
+        // Plan:
+        //: 1 Exercise each method on maps of strings using a test allocator,
+        //:   with a test allocator installed as the default, and verify the
+        //:   results and the memory use.  (C-1..4)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY&);
+        //   VALUE& at(const KEY&);
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const KEY&);
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   iterator find(const KEY&);
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<value_type>);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   pair<iterator, bool> try_emplace(const KEY&);
+        //   iterator begin();
+        //   iterator end();
+        //   const VALUE& at(const KEY&) const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const KEY&)
+        //   const_iterator find(const KEY&) const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS AND ACCESSORS" << endl
+                          << "==========================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            bsl::string KEY0(makeString(0), &ta);
+            bsl::string KEY1(makeString(1), &ta);
+            bsl::string KEY2(makeString(2), &ta);
+            bsl::string VAL0(makeString(100), &ta);
+
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            if (veryVerbose) cout << "\t'operator[]' and 'try_emplace'."
+                                  << endl;
+
+            bsl::string& v0 = mX[KEY0];
+            ASSERT(v0.empty());
+            ASSERT(&ta == v0.get_allocator().mechanism());
+            v0 = VAL0;
+            ASSERT(VAL0 == mX[KEY0]);
+            ASSERT(1 == X.size());
+
+            bsl::pair<StringObj::iterator, bool> r = mX.try_emplace(KEY0);
+            ASSERT(!r.second);
+            ASSERT(VAL0 == r.first->second);
+
+            r = mX.try_emplace(KEY1);
+            ASSERT(r.second);
+            ASSERT(KEY1 == r.first->first);
+            ASSERT(r.first->second.empty());
+            ASSERT(&ta == r.first->first.get_allocator().mechanism());
+            ASSERT(&ta == r.first->second.get_allocator().mechanism());
+
+            if (veryVerbose) cout << "\t'at'." << endl;
+
+            ASSERT(VAL0 == mX.at(KEY0));
+            ASSERT(VAL0 == X.at(KEY0));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                mX.at(KEY2);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(KEY2);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+            ASSERT(2 == X.size());
+
+            if (veryVerbose) cout << "\t'insert'." << endl;
+
+            const StringObj::value_type ENTRY(KEY2, VAL0, &ta);
+
+            bsl::pair<StringObj::iterator, bool> ri = mX.insert(ENTRY);
+            ASSERT(ri.second);
+            ASSERT(ENTRY == *ri.first);
+            ASSERT(&ta == ri.first->second.get_allocator().mechanism());
+
+            ri = mX.insert(StringObj::value_type(KEY2, KEY0, &ta));
+            ASSERT(!ri.second);
+            ASSERT(VAL0 == ri.first->second);
+
+            StringObj::value_type moved(makeString(3), makeString(4), &ta);
+            ri = mX.insert(MoveUtil::move(moved));
+            ASSERT(ri.second);
+            ASSERT(makeString(4) == ri.first->second);
+            ASSERT(4 == X.size());
+
+            const StringObj::value_type RANGE[] = {
+                StringObj::value_type(makeString(5), makeString(5), &ta),
+                StringObj::value_type(makeString(6), makeString(6), &ta),
+                StringObj::value_type(makeString(5), makeString(7), &ta),
+            };
+            mX.insert(RANGE, RANGE + 3);
+            ASSERT(6 == X.size());
+            ASSERT(makeString(5) == X.at(makeString(5)));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ { makeString(8), makeString(8) },
+                        { makeString(9), makeString(9) } });
+            ASSERT(8 == X.size());
+            mX.erase(makeString(8));
+            mX.erase(makeString(9));
+#endif
+
+            if (veryVerbose) cout << "\tLookup." << endl;
+
+            ASSERT(X.contains(KEY1));
+            ASSERT(1 == X.count(KEY1));
+            ASSERT(0 == X.count(makeString(99)));
+            ASSERT(X.end() == X.find(makeString(99)));
+            ASSERT(mX.end() == mX.find(makeString(99)));
+            ASSERT(KEY1 == X.find(KEY1)->first);
+            ASSERT(KEY1 == mX.find(KEY1)->first);
+
+            bsl::pair<StringObj::iterator, StringObj::iterator> er =
+                                                         mX.equal_range(KEY1);
+            ASSERT(1 == bsl::distance(er.first, er.second));
+
+            bsl::pair<StringObj::const_iterator, StringObj::const_iterator>
+                                     cer = X.equal_range(makeString(99));
+            ASSERT(cer.first == cer.second);
+
+            int count = 0;
+            for (StringObj::const_iterator it = X.cbegin();
+                 it != X.cend();
+                 ++it) {
+                ASSERT(X.contains(it->first));
+                ++count;
+            }
+            ASSERT(6 == count);
+
+            count = 0;
+            for (StringObj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second.append("!");
+                ++count;
+            }
+            ASSERT(6 == count);
+            ASSERT(VAL0 + "!" == X.at(KEY0));
+
+            count = static_cast<int>(bsl::distance(X.begin(), X.end()));
+            ASSERT(6 == count);
+
+            if (veryVerbose) cout << "\tCapacity." << endl;
+
+            ASSERT(16 == X.capacity());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(6.0f / 16.0f == X.load_factor());
+
+            mX.reserve(100);
+            ASSERT(128 == X.capacity());
+            ASSERT(6 == X.size());
+
+            mX.rehash(0);
+            ASSERT(16 == X.capacity());
+            ASSERT(VAL0 + "!" == X.at(KEY0));
+
+            // No element uses the default allocator.
+
+            ASSERT(0 == da.numBlocksInUse());
+
+            if (veryVerbose) cout << "\tErasure." << endl;
+
+            ASSERT(1 == mX.erase(KEY1));
+            ASSERT(0 == mX.erase(KEY1));
+            ASSERT(5 == X.size());
+
+            StringObj::iterator it = mX.find(KEY2);
+            mX.erase(it);
+            ASSERT(!X.contains(KEY2));
+
+            mX.erase(StringObj::const_iterator(mX.find(KEY0)));
+            ASSERT(!X.contains(KEY0));
+            ASSERT(3 == X.size());
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+
+            mX[KEY0] = VAL0;
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(16 == X.capacity());
+
+            mX[KEY0] = VAL0;
+            mX.reset();
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map having the specified capacity,
+        //:   functors, allocator, and elements.
+        //:
+        //: 2 If no allocator is supplied, the default allocator is used.
+        //:
+        //: 3 A constructor given no capacity allocates no memory.
+        //
+        // Plan:
+        //: 1 Create maps with each constructor, using stateful hash and
+        //:   equality functors, and verify the attributes of each.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   explicit FlatHashMap(bslma::Allocator *);
+        //   explicit FlatHashMap(size_t);
+        //   FlatHashMap(size_t, bslma::Allocator *);
+        //   FlatHashMap(size_t, const HASH&, bslma::Allocator *);
+        //   FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+        //   FlatHashMap(INPUT_ITERATOR, INPUT_ITERATOR, size_t, ...);
+        //   FlatHashMap(initializer_list<value_type>, bslma::Allocator *);
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS" << endl
+                          << "========" << endl;
+
+        typedef bdlc::FlatHashMap<int, int, SeededHash, ModEqual> FObj;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            const Obj X;
+            ASSERT(&da == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(X.empty());
+            ASSERT(0 == da.numBlocksTotal());
+        }
+        {
+            const Obj X(&ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+        {
+            const Obj X(static_cast<bsl::size_t>(20));
+            ASSERT(&da == X.allocator());
+            ASSERT(32 == X.capacity());
+            ASSERT(2 == da.numBlocksInUse());
+        }
+        {
+            const Obj X(20, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(32 == X.capacity());
+            ASSERT(2 == ta.numBlocksInUse());
+        }
+        {
+            const FObj X(5, SeededHash(7), &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(16 == X.capacity());
+            ASSERT(7 == X.hash_function().d_seed);
+            ASSERT(1000000 == X.key_eq().d_divisor);
+        }
+        {
+            FObj mX(0, SeededHash(7), ModEqual(10), &ta);  const FObj& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(7 == X.hash_function().d_seed);
+            ASSERT(10 == X.key_eq().d_divisor);
+
+            mX[3] = 1;
+            ASSERT(1 == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        const bsl::pair<int, int> VALUES[] = {
+            bsl::make_pair(1, 10),
+            bsl::make_pair(2, 20),
+            bsl::make_pair(1, 30),
+            bsl::make_pair(3, 40),
+        };
+        {
+            const Obj X(VALUES, VALUES + 4, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(3 == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(20 == X.at(2));
+            ASSERT(40 == X.at(3));
+        }
+        {
+            const FObj X(VALUES,
+                         VALUES + 4,
+                         100,
+                         SeededHash(3),
+                         ModEqual(5),
+                         &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(128 == X.capacity());
+            ASSERT(3 == X.hash_function().d_seed);
+            ASSERT(5 == X.key_eq().d_divisor);
+            ASSERT(3 == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(20 == X.at(2));
+        }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            const Obj X({ { 1, 10 }, { 2, 20 }, { 1, 30 } }, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(2 == X.size());
+            ASSERT(10 == X.at(1));
+        }
+#endif
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few elements, and compare the map with
+        //:   a 'bsl::unordered_map' holding the same elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj                         mX;
+        bsl::unordered_map<int, int> oracle;
+
+        for (int i = 0; i < 1000; ++i) {
+            const int key = (i * 37) % 501;
+            mX[key] += i;
+            oracle[key] += i;
+            if (0 == i % 3) {
+                mX.erase(key / 2);
+                oracle.erase(key / 2);
+            }
+        }
+
+        ASSERTV(oracle.size(), mX.size(), oracle.size() == mX.size());
+        for (bsl::unordered_map<int, int>::const_iterator it = oracle.begin();
+             it != oracle.end();
+             ++it) {
+            ASSERTV(it->first, mX.contains(it->first));
+            ASSERTV(it->first, it->second == mX.at(it->first));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LOOKUP
+        //
+        // Concerns:
+        //: 1 Successful and unsuccessful lookups in a 'bdlc::FlatHashMap' are
+        //:   faster than in a 'bsl::unordered_map' of the same elements.
+        //
+        // Plan:
+        //: 1 For maps of various sizes, time lookups of keys that are present
+        //:   and of keys that are absent in each container, and report the
+        //:   ratio.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: LOOKUP
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: LOOKUP" << endl
+             << "===================" << endl;
+
+        const int SIZES[]   = { 100, 10000, 1000000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N         = SIZES[ti];
+            const int NUM_PASSES = 10000000 / N;
+
+            const bsl::vector<int> keys   = makeKeys(N, 1);
+            bsl::vector<int>       misses = makeKeys(N, 2);
+            for (bsl::size_t i = 0; i < misses.size(); ++i) {
+                misses[i] -= 1;  // even, so never present
+            }
+
+            FlatMap flat;
+            NodeMap node;
+            for (int i = 0; i < N; ++i) {
+                flat[keys[i]] = i;
+                node[keys[i]] = i;
+            }
+
+            const double flatHit  = timeLookups(flat, keys,   NUM_PASSES);
+            const double nodeHit  = timeLookups(node, keys,   NUM_PASSES);
+            const double flatMiss = timeLookups(flat, misses, NUM_PASSES);
+            const double nodeMiss = timeLookups(node, misses, NUM_PASSES);
+
+            cout << "size " << N
+                 << ": hit: unordered_map " << nodeHit
+                 << "s, FlatHashMap " << flatHit
+                 << "s (x" << nodeHit / flatHit << ")"
+                 << "; miss: unordered_map " << nodeMiss
+                 << "s, FlatHashMap " << flatMiss
+                 << "s (x" << nodeMiss / flatMiss << ")" << endl;
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: INSERTION
+        //
+        // Concerns:
+        //: 1 Inserting into a 'bdlc::FlatHashMap' is faster than inserting
+        //:   into a 'bsl::unordered_map', including the cost of growth.
+        //
+        // Plan:
+        //: 1 For various numbers of keys, time the insertion of the keys into
+        //:   an initially empty container of each kind, and report the ratio.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: INSERTION
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: INSERTION" << endl
+             << "======================" << endl;
+
+        const int SIZES[]   = { 100, 10000, 1000000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N          = SIZES[ti];
+            const int NUM_PASSES = 2000000 / N;
+
+            const bsl::vector<int> keys = makeKeys(N, 3);
+
+            const double flat = timeInsertions<FlatMap>(keys, NUM_PASSES);
+            const double node = timeInsertions<NodeMap>(keys, NUM_PASSES);
+
+            cout << "size " << N
+                 << ": unordered_map " << node
+                 << "s, FlatHashMap " << flat
+                 << "s (x" << node / flat << ")" << endl;
+        }
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ITERATION
+        //
+        // Concerns:
+        //: 1 Iterating over a 'bdlc::FlatHashMap' is faster than iterating
+        //:   over a 'bsl::unordered_map' of the same elements.
+        //
+        // Plan:
+        //: 1 For maps of various sizes, time iteration over each container,
+        //:   and report the ratio.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: ITERATION
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: ITERATION" << endl
+             << "======================" << endl;
+
+        const int SIZES[]   = { 100, 10000, 1000000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N          = SIZES[ti];
+            const int NUM_PASSES = 20000000 / N;
+
+            const bsl::vector<int> keys = makeKeys(N, 4);
+
+            FlatMap flat;
+            NodeMap node;
+            for (int i = 0; i < N; ++i) {
+                flat[keys[i]] = i;
+                node[keys[i]] = i;
+            }
+
+            const double flatTime = timeIteration(flat, NUM_PASSES);
+            const double nodeTime = timeIteration(node, NUM_PASSES);
+
+            cout << "size " << N
+                 << ": unordered_map " << nodeTime
+                 << "s, FlatHashMap " << flatTime
+                 << "s (x" << nodeTime / flatTime << ")" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
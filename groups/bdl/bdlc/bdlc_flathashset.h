@@ -0,0 +1,851 @@
+// bdlc_flathashset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHSET
+#define INCLUDED_BDLC_FLATHASHSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered set container.
+//
+//@CLASSES:
+//  bdlc::FlatHashSet: open-addressed unordered set container
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashtable, bslstl_unorderedset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashSet', that implements an unordered set of unique keys using
+// an open-addressed hash table in which the keys are stored directly in a
+// single array of slots (see 'bdlc_flathashtable').
+//
+// 'bdlc::FlatHashSet' provides an interface similar to that of
+// 'bsl::unordered_set', but does not allocate a node per element, and looks
+// up keys by examining 16 one-byte control entries at once (using SSE2
+// instructions where available).  In exchange, it offers weaker guarantees
+// than 'bsl::unordered_set':
+//
+//: o Any insertion, 'rehash', and 'reserve' may relocate every element,
+//:   invalidating all iterators, pointers, and references to elements.
+//:   (Erasing an element invalidates only iterators, pointers, and references
+//:   to that element.)
+//:
+//: o There is no bucket interface, and the maximum load factor is fixed at
+//:   7/8.
+//
+// See 'bdlc_flathashmap' for further discussion.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we want to print each distinct value of a sequence once, in the
+// order of its first occurrence.
+//
+// First, we define the sequence:
+//..
+//  const int VALUES[]   = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+//  const int NUM_VALUES = static_cast<int>(sizeof VALUES / sizeof *VALUES);
+//..
+// Then, we use a 'bdlc::FlatHashSet' to record the values already seen, and
+// collect each value the first time it is inserted:
+//..
+//  bdlc::FlatHashSet<int> seen;
+//  bsl::vector<int>       distinct;
+//
+//  for (int i = 0; i < NUM_VALUES; ++i) {
+//      if (seen.insert(VALUES[i]).second) {
+//          distinct.push_back(VALUES[i]);
+//      }
+//  }
+//..
+// Finally, we verify the result:
+//..
+//  assert(7 == seen.size());
+//  assert(7 == distinct.size());
+//  assert(3 == distinct[0]);
+//  assert(1 == distinct[1]);
+//  assert(6 == distinct[6]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ============================
+                        // struct FlatHashSet_EntryUtil
+                        // ============================
+
+template <class ENTRY>
+struct FlatHashSet_EntryUtil {
+    // This templated utility provides methods to construct an 'ENTRY' from a
+    // key and to obtain the key of an 'ENTRY', for use by 'FlatHashTable'.
+    // For a set, the entry is the key.
+
+    // CLASS METHODS
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const ENTRY&      key);
+        // Create, at the specified 'entry' address, a copy of the specified
+        // 'key', using the specified 'allocator' to supply memory.
+
+    static const ENTRY& key(const ENTRY& entry);
+        // Return the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashSet
+                            // =================
+
+template <class KEY,
+          class HASH  = bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashSet {
+    // This class template implements a value-semantic container that holds
+    // an unordered set of unique keys, stored in an open-addressed hash
+    // table.
+
+    // PRIVATE TYPES
+    typedef FlatHashSet_EntryUtil<KEY>                            EntryUtil;
+    typedef FlatHashTable<KEY, KEY, EntryUtil, HASH, EQUAL>       ImplType;
+    typedef bslmf::MovableRefUtil                                 MoveUtil;
+
+    // DATA
+    ImplType d_impl;  // underlying hash table
+
+    // FRIENDS
+    template <class K, class H, class E>
+    friend bool operator==(const FlatHashSet<K, H, E>&,
+                           const FlatHashSet<K, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                key_type;
+    typedef KEY                                value_type;
+    typedef bsl::size_t                        size_type;
+    typedef bsl::ptrdiff_t                     difference_type;
+    typedef HASH                               hasher;
+    typedef EQUAL                              key_equal;
+    typedef value_type&                        reference;
+    typedef const value_type&                  const_reference;
+    typedef typename ImplType::const_iterator  iterator;
+    typedef typename ImplType::const_iterator  const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashSet, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashSet();
+    explicit FlatHashSet(bslma::Allocator *basicAllocator);
+    explicit FlatHashSet(bsl::size_t capacity);
+    FlatHashSet(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty set.  Optionally specify a 'capacity' indicating
+        // the minimum initial number of slots; if 'capacity' is not
+        // supplied or is 0, no memory is allocated.  Optionally specify a
+        // 'hash' functor used to generate hash values for keys; if 'hash' is
+        // not supplied, a default-constructed 'HASH' is used.  Optionally
+        // specify an 'equal' functor used to compare keys; if 'equal' is not
+        // supplied, a default-constructed 'EQUAL' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator
+        // is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash  = HASH(),
+                const EQUAL&      equal = EQUAL(),
+                bslma::Allocator *basicAllocator = 0);
+        // Create a set, having the optionally specified 'capacity', 'hash',
+        // and 'equal' (see above), holding each distinct key in the range
+        // '[first .. last)'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'first' and 'last' delimit a valid range of values convertible to
+        // 'KEY'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashSet(bsl::initializer_list<KEY>  values,
+                bslma::Allocator           *basicAllocator = 0);
+        // Create a set holding each distinct key of the specified 'values'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator
+        // is used.
+#endif
+
+    FlatHashSet(const FlatHashSet&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a set having the same value, hasher, and key-equality
+        // comparator as the specified 'original'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatHashSet(bslmf::MovableRef<FlatHashSet> original);
+        // Create a set having the same value, hasher, key-equality
+        // comparator, and allocator as the specified 'original'.  'original'
+        // is left empty, with no capacity.
+
+    FlatHashSet(bslmf::MovableRef<FlatHashSet>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a set having the same value, hasher, and key-equality
+        // comparator as the specified 'original', using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  If
+        // 'basicAllocator' is the allocator of 'original', 'original' is left
+        // empty, with no capacity; otherwise it is left in a valid but
+        // unspecified state.
+
+    // ~FlatHashSet() = default;
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatHashSet& operator=(const FlatHashSet& rhs);
+        // Assign to this object the value, hasher, and key-equality
+        // comparator of the specified 'rhs', and return a reference providing
+        // modifiable access to this object.
+
+    FlatHashSet& operator=(bslmf::MovableRef<FlatHashSet> rhs);
+        // Assign to this object the value, hasher, and key-equality
+        // comparator of the specified 'rhs', and return a reference providing
+        // modifiable access to this object.  If this object and 'rhs' use the
+        // same allocator, 'rhs' is left empty, with no capacity; otherwise it
+        // is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatHashSet& operator=(bsl::initializer_list<KEY> values);
+        // Assign to this object the value of a set holding each distinct key
+        // of the specified 'values', and return a reference providing
+        // modifiable access to this object.
+#endif
+
+    void clear();
+        // Remove all elements from this set, retaining its capacity.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key', if any, and return
+        // the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the element at the specified 'position', and return an
+        // iterator referring to the element following it, or the past-the-end
+        // iterator if there is none.  The behavior is undefined unless
+        // 'position' refers to an element of this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the range '[first .. last)', and return
+        // 'last'.  The behavior is undefined unless 'first' and 'last'
+        // delimit a valid range of this set.
+
+    bsl::pair<iterator, bool> insert(const KEY& key);
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<KEY> key);
+        // Insert a copy of the specified 'key' (moved, in the second
+        // overload) if it is not already present in this set.  Return an
+        // iterator referring to the element of this set equal to 'key', and
+        // 'true' if 'key' was inserted or 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert a copy of each key in the range '[first .. last)' that is
+        // not already present in this set.  The behavior is undefined unless
+        // 'first' and 'last' delimit a valid range of values convertible to
+        // 'KEY'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<KEY> values);
+        // Insert a copy of each of the specified 'values' that is not already
+        // present in this set.
+#endif
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this set to the smallest valid capacity not
+        // less than the specified 'minimumCapacity' that admits the current
+        // number of elements.
+
+    void reserve(bsl::size_t numEntries);
+        // Increase, if needed, the capacity of this set so that it admits at
+        // least the specified 'numEntries' without rehashing.
+
+    void reset();
+        // Remove all elements from this set and release its memory, leaving
+        // it with no capacity.
+
+                          // Aspects
+
+    void swap(FlatHashSet& other);
+        // Exchange the value, hasher, and key-equality comparator of this
+        // object with those of the specified 'other' object.  This method
+        // provides the no-throw exception-safety guarantee if 'HASH' and
+        // 'EQUAL' have no-throw swaps.  The behavior is undefined unless this
+        // object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of slots of this set.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains the specified 'key', and 'false'
+        // otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements equal to the specified 'key' (0 or
+        // 1).
+
+    bool empty() const;
+        // Return 'true' if this set has no elements, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                        const KEY& key) const;
+        // Return a pair of iterators delimiting the range of elements equal
+        // to the specified 'key', which is empty if there is no such element.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element equal to the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this set.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality comparator of this set.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements to the capacity of this
+        // set, or 0 if it has no capacity.
+
+    float max_load_factor() const;
+        // Return the load factor beyond which this set is rehashed (7/8).
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this set, or
+        // the past-the-end iterator if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this set.
+
+                          // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+bool operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets have the same
+    // value, and 'false' otherwise.  Two sets have the same value if they
+    // have the same number of elements and each element of 'lhs' is
+    // contained in 'rhs'.
+
+template <class KEY, class HASH, class EQUAL>
+bool operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void swap(FlatHashSet<KEY, HASH, EQUAL>& a, FlatHashSet<KEY, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  If 'a' and
+    // 'b' use the same allocator, this function provides the no-throw
+    // exception-safety guarantee (if 'HASH' and 'EQUAL' do); otherwise, the
+    // values are exchanged by copying, and this function provides the basic
+    // guarantee.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct FlatHashSet_EntryUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class ENTRY>
+inline
+void FlatHashSet_EntryUtil<ENTRY>::constructFromKey(
+                                                   ENTRY            *entry,
+                                                   bslma::Allocator *allocator,
+                                                   const ENTRY&      key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(entry, allocator, key);
+}
+
+template <class ENTRY>
+inline
+const ENTRY& FlatHashSet_EntryUtil<ENTRY>::key(const ENTRY& entry)
+{
+    return entry;
+}
+
+                            // -----------------
+                            // class FlatHashSet
+                            // -----------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                    bsl::initializer_list<KEY>  values,
+                                    bslma::Allocator           *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    d_impl.reserve(values.size());
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                            const FlatHashSet&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                       bslmf::MovableRef<FlatHashSet> original)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                               bslmf::MovableRef<FlatHashSet>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_impl(MoveUtil::move(MoveUtil::access(original).d_impl), basicAllocator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(const FlatHashSet& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(bslmf::MovableRef<FlatHashSet> rhs)
+{
+    d_impl = MoveUtil::move(MoveUtil::access(rhs).d_impl);
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(bsl::initializer_list<KEY> values)
+{
+    FlatHashSet other(values, d_impl.allocator());
+    swap(other);
+    return *this;
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator first, const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& key)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(key);
+    return bsl::pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(bslmf::MovableRef<KEY> key)
+{
+    bsl::pair<typename ImplType::iterator, bool> result =
+                                            d_impl.insert(MoveUtil::move(key));
+    return bsl::pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    d_impl.insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::insert(bsl::initializer_list<KEY> values)
+{
+    d_impl.insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+                          // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::swap(FlatHashSet& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator,
+          typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator>
+FlatHashSet<KEY, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+EQUAL FlatHashSet<KEY, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                          // Iterators
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.cbegin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cend() const
+{
+    return d_impl.cend();
+}
+
+                          // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashSet<KEY, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashSet<KEY, HASH, EQUAL>& a,
+                FlatHashSet<KEY, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashSet<KEY, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashSet<KEY, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
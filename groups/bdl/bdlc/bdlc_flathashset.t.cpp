@@ -0,0 +1,758 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thin, set-specific layer over
+// 'bdlc::FlatHashTable', which is tested thoroughly in its own test driver.
+// We therefore concentrate on the forwarding of each method to the table, on
+// the conversion of the iterators returned by the table, and on the
+// propagation of the set's allocator to its elements.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashSet();
+// [ 2] explicit FlatHashSet(bslma::Allocator *);
+// [ 2] explicit FlatHashSet(size_t);
+// [ 2] FlatHashSet(size_t, bslma::Allocator *);
+// [ 2] FlatHashSet(size_t, const HASH&, bslma::Allocator *);
+// [ 2] FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 2] FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+// [ 2] FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, size_t, ...);
+// [ 2] FlatHashSet(initializer_list<KEY>, bslma::Allocator *);
+// [ 3] FlatHashSet(const FlatHashSet&, bslma::Allocator *);
+// [ 3] FlatHashSet(MovableRef<FlatHashSet>);
+// [ 3] FlatHashSet(MovableRef<FlatHashSet>, bslma::Allocator *);
+//
+// MANIPULATORS
+// [ 3] FlatHashSet& operator=(const FlatHashSet&);
+// [ 3] FlatHashSet& operator=(MovableRef<FlatHashSet>);
+// [ 3] FlatHashSet& operator=(initializer_list<KEY>);
+// [ 2] void clear();
+// [ 2] size_t erase(const KEY&);
+// [ 2] iterator erase(const_iterator);
+// [ 2] iterator erase(const_iterator, const_iterator);
+// [ 2] pair<iterator, bool> insert(const KEY&);
+// [ 2] pair<iterator, bool> insert(MovableRef<KEY>);
+// [ 2] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 2] void insert(initializer_list<KEY>);
+// [ 2] void rehash(size_t);
+// [ 2] void reserve(size_t);
+// [ 2] void reset();
+// [ 3] void swap(FlatHashSet&);
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(const KEY&)
+// [ 2] const_iterator find(const KEY&) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const FlatHashSet&, const FlatHashSet&);
+// [ 3] bool operator!=(const FlatHashSet&, const FlatHashSet&);
+//
+// FREE FUNCTIONS
+// [ 3] void swap(FlatHashSet&, FlatHashSet&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlc::FlatHashSet<int>         Obj;
+typedef bdlc::FlatHashSet<bsl::string> StringObj;
+
+// ============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct SeededHash {
+    // This functor hashes 'int' keys using a seed supplied at construction,
+    // so that hashers having different seeds are distinguishable.
+
+    int d_seed;
+
+    explicit SeededHash(int seed = 0)
+    : d_seed(seed)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return bslh::Hash<>()(key ^ d_seed);
+    }
+};
+
+struct ModEqual {
+    // This functor compares 'int' keys modulo a divisor supplied at
+    // construction.
+
+    int d_divisor;
+
+    explicit ModEqual(int divisor = 1000000)
+    : d_divisor(divisor)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs % d_divisor == rhs % d_divisor;
+    }
+};
+
+struct ModHash {
+    // This functor hashes 'int' keys modulo a divisor supplied at
+    // construction, consistently with a 'ModEqual' having the same divisor.
+
+    int d_divisor;
+
+    explicit ModHash(int divisor = 1000000)
+    : d_divisor(divisor)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return bslh::Hash<>()(key % d_divisor);
+    }
+};
+
+bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique to the specified 'value'.
+{
+    bsl::string result("a string long enough to allocate memory: ");
+    do {
+        result.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    } while (value);
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we want to print each distinct value of a sequence once, in the
+// order of its first occurrence.
+//
+// First, we define the sequence:
+//..
+    const int VALUES[]   = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+    const int NUM_VALUES = static_cast<int>(sizeof VALUES / sizeof *VALUES);
+//..
+// Then, we use a 'bdlc::FlatHashSet' to record the values already seen, and
+// collect each value the first time it is inserted:
+//..
+    bdlc::FlatHashSet<int> seen;
+    bsl::vector<int>       distinct;
+
+    for (int i = 0; i < NUM_VALUES; ++i) {
+        if (seen.insert(VALUES[i]).second) {
+            distinct.push_back(VALUES[i]);
+        }
+    }
+//..
+// Finally, we verify the result:
+//..
+    ASSERT(7 == seen.size());
+    ASSERT(7 == distinct.size());
+    ASSERT(3 == distinct[0]);
+    ASSERT(1 == distinct[1]);
+    ASSERT(6 == distinct[6]);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copy and move construction and assignment, 'swap', and the
+        //:   equality operators forward to the underlying table.
+        //:
+        //: 2 The allocator of the target of an assignment is unchanged, and is
+        //:   used for the elements it receives.
+        //:
+        //: 3 Moving between sets having the same allocator, and swapping
+        //:   them, allocates no memory.
+        //
+        // Plan:
+        //: 1 Exercise each operation on sets of strings, using distinct test
+        //:   allocators, and verify the values and memory use.  (C-1..3)
+        //
+        // Testing:
+        //   FlatHashSet(const FlatHashSet&, bslma::Allocator *);
+        //   FlatHashSet(MovableRef<FlatHashSet>);
+        //   FlatHashSet(MovableRef<FlatHashSet>, bslma::Allocator *);
+        //   FlatHashSet& operator=(const FlatHashSet&);
+        //   FlatHashSet& operator=(MovableRef<FlatHashSet>);
+        //   FlatHashSet& operator=(initializer_list<KEY>);
+        //   void swap(FlatHashSet&);
+        //   bool operator==(const FlatHashSet&, const FlatHashSet&);
+        //   bool operator!=(const FlatHashSet&, const FlatHashSet&);
+        //   void swap(FlatHashSet&, FlatHashSet&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("a",       veryVeryVeryVerbose);
+        bslma::TestAllocator tb("b",       veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+            for (int i = 0; i < 40; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            StringObj mY(X, &tb);  const StringObj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+            ASSERT(&tb == Y.allocator());
+            ASSERT(0 == da.numBlocksInUse());
+
+            mY.erase(makeString(7));
+            ASSERT(X != Y);
+            mY.insert(makeString(7));
+            ASSERT(X == Y);
+
+            {
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                StringObj mZ(MoveUtil::move(mX));  const StringObj& Z = mZ;
+                ASSERT(Y == Z);
+                ASSERT(X.empty());
+                ASSERT(&ta == Z.allocator());
+                ASSERT(tam.isTotalSame());
+
+                mX = MoveUtil::move(mZ);
+                ASSERT(Y == X);
+                ASSERT(Z.empty());
+                ASSERT(tam.isTotalSame());
+            }
+
+            StringObj mW(MoveUtil::move(mY), &ta);  const StringObj& W = mW;
+            ASSERT(X == W);
+            ASSERT(&ta == W.allocator());
+
+            mY = W;
+            ASSERT(X == Y);
+            ASSERT(&tb == Y.allocator());
+
+            mW.clear();
+            mW.insert(makeString(1));
+
+            {
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                mW.swap(mX);
+                ASSERT(40 == W.size());
+                ASSERT(1  == X.size());
+                ASSERT(tam.isTotalSame());
+
+                swap(mW, mX);
+                ASSERT(1  == W.size());
+                ASSERT(40 == X.size());
+                ASSERT(tam.isTotalSame());
+            }
+
+            swap(mW, mY);
+            ASSERT(40 == W.size());
+            ASSERT(1  == Y.size());
+            ASSERT(&ta == W.allocator());
+            ASSERT(&tb == Y.allocator());
+            ASSERT(X == W);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mY = { "a", "b", "a" };
+            ASSERT(2 == Y.size());
+            ASSERT(Y.contains("a"));
+            ASSERT(Y.contains("b"));
+            ASSERT(&tb == Y.allocator());
+#endif
+            ASSERT(0 == da.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, MANIPULATORS, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor installs the specified capacity, hasher,
+        //:   key-equality comparator, and allocator, and holds each distinct
+        //:   key of the specified range.
+        //:
+        //: 2 'insert' reports whether the key was newly inserted, and returns
+        //:   an iterator to the element having the key.
+        //:
+        //: 3 The 'erase' overloads remove the specified elements, and return
+        //:   an iterator usable to continue an iteration.
+        //:
+        //: 4 'clear' retains the capacity, and 'reset' releases it.
+        //:
+        //: 5 The elements of the set use the allocator of the set.
+        //
+        // Plan:
+        //: 1 Construct sets using each constructor, and verify their
+        //:   attributes and contents.  (C-1)
+        //:
+        //: 2 Exercise each manipulator on sets of integers and of strings,
+        //:   verifying the results against a 'bsl::set' oracle, and verify
+        //:   the allocator of each element.  (C-2..5)
+        //
+        // Testing:
+        //   FlatHashSet();
+        //   explicit FlatHashSet(bslma::Allocator *);
+        //   explicit FlatHashSet(size_t);
+        //   FlatHashSet(size_t, bslma::Allocator *);
+        //   FlatHashSet(size_t, const HASH&, bslma::Allocator *);
+        //   FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator *);
+        //   FlatHashSet(INPUT_ITERATOR, INPUT_ITERATOR, size_t, ...);
+        //   FlatHashSet(initializer_list<KEY>, bslma::Allocator *);
+        //   void clear();
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   pair<iterator, bool> insert(const KEY&);
+        //   pair<iterator, bool> insert(MovableRef<KEY>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<KEY>);
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const KEY&)
+        //   const_iterator find(const KEY&) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, MANIPULATORS, AND ACCESSORS" << endl
+                          << "=====================================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator ta("test",    veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int VALUES[]   = { 5, 10, 15, 7, 5, 12 };
+        const int NUM_VALUES = static_cast<int>(sizeof VALUES
+                                                / sizeof *VALUES);
+
+        if (verbose) cout << "\tTesting constructors." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0   == X.size());
+            ASSERT(0   == X.capacity());
+            ASSERT(&da == X.allocator());
+            ASSERT(X.begin() == X.end());
+        }
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0   == X.capacity());
+            ASSERT(&ta == X.allocator());
+            ASSERT(0   == ta.numBlocksTotal());
+        }
+        {
+            Obj mX(40);  const Obj& X = mX;
+            ASSERT(64  == X.capacity());
+            ASSERT(&da == X.allocator());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            Obj mX(40, &ta);  const Obj& X = mX;
+            ASSERT(64  == X.capacity());
+            ASSERT(&ta == X.allocator());
+        }
+        {
+            typedef bdlc::FlatHashSet<int, SeededHash> SeededObj;
+
+            SeededObj mX(0, SeededHash(7), &ta);  const SeededObj& X = mX;
+            ASSERT(0   == X.capacity());
+            ASSERT(7   == X.hash_function().d_seed);
+            ASSERT(&ta == X.allocator());
+        }
+        {
+            typedef bdlc::FlatHashSet<int, ModHash, ModEqual> ModObj;
+
+            ModObj mX(16, ModHash(5), ModEqual(5), &ta);  const ModObj& X = mX;
+            ASSERT(16  == X.capacity());
+            ASSERT(5   == X.hash_function().d_divisor);
+            ASSERT(5   == X.key_eq().d_divisor);
+            ASSERT(&ta == X.allocator());
+
+            mX.insert(VALUES, VALUES + NUM_VALUES);
+            ASSERT(2 == X.size());
+            ASSERT(X.contains(20));
+            ASSERT(!X.contains(21));
+
+            ModObj mY(VALUES,
+                      VALUES + NUM_VALUES,
+                      0,
+                      ModHash(5),
+                      ModEqual(5),
+                      &ta);
+            const ModObj& Y = mY;
+            ASSERT(2   == Y.size());
+            ASSERT(&ta == Y.allocator());
+        }
+        {
+            Obj mX(VALUES, VALUES + NUM_VALUES, &ta);  const Obj& X = mX;
+            ASSERT(5   == X.size());
+            ASSERT(&ta == X.allocator());
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                ASSERTV(VALUES[i], 1 == X.count(VALUES[i]));
+            }
+        }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX({ 1, 2, 3, 2, 1 }, &ta);  const Obj& X = mX;
+            ASSERT(3   == X.size());
+            ASSERT(&ta == X.allocator());
+        }
+#endif
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting manipulators and accessors." << endl;
+        {
+            Obj           mX(&ta);  const Obj& X = mX;
+            bsl::set<int> oracle;
+
+            for (int i = 0; i < 200; ++i) {
+                const int key = (i * 17) % 113;
+
+                bsl::pair<Obj::iterator, bool> result = mX.insert(key);
+                const bool inserted = oracle.insert(key).second;
+
+                ASSERTV(i, inserted == result.second);
+                ASSERTV(i, key      == *result.first);
+                ASSERTV(i, result.first == X.find(key));
+            }
+            ASSERT(oracle.size() == X.size());
+            ASSERT(X.load_factor() <= X.max_load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+
+            bsl::size_t numVisited = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(*it, 1 == oracle.count(*it));
+                ++numVisited;
+            }
+            ASSERT(X.size() == numVisited);
+
+            ASSERT(X.end() == X.find(1000));
+            ASSERT(0       == X.count(1000));
+
+            bsl::pair<Obj::const_iterator, Obj::const_iterator> range =
+                                                            X.equal_range(17);
+            ASSERT(range.first != range.second);
+            ASSERT(17          == *range.first);
+            ASSERT(++range.first == range.second);
+
+            range = X.equal_range(1000);
+            ASSERT(range.first  == X.end());
+            ASSERT(range.second == X.end());
+
+            // Erase by key.
+
+            ASSERT(1 == mX.erase(17));
+            ASSERT(0 == mX.erase(17));
+            oracle.erase(17);
+            ASSERT(!X.contains(17));
+
+            // Erase by position, retaining only the even keys.
+
+            Obj::const_iterator it = X.begin();
+            while (it != X.end()) {
+                if (*it % 2) {
+                    oracle.erase(*it);
+                    it = mX.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERT(oracle.size() == X.size());
+            for (it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(*it, 0 == *it % 2);
+            }
+
+            // Erase a range.
+
+            Obj::const_iterator first = X.begin();
+            ++first;
+            Obj::const_iterator result = mX.erase(first, X.end());
+            ASSERT(X.end() == result);
+            ASSERT(1       == X.size());
+
+            const bsl::size_t capacity = X.capacity();
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(capacity == X.capacity());
+
+            mX.reserve(1000);
+            ASSERT(1000 <= X.capacity() * 7 / 8);
+
+            mX.insert(VALUES, VALUES + NUM_VALUES);
+            ASSERT(5 == X.size());
+
+            mX.rehash(0);
+            ASSERT(5  == X.size());
+            ASSERT(16 == X.capacity());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ 100, 5, 101 });
+            ASSERT(7 == X.size());
+#endif
+
+            mX.reset();
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            for (int i = 0; i < 50; ++i) {
+                const bsl::string key = makeString(i);
+                ASSERTV(i, mX.insert(key).second);
+                ASSERTV(i, !mX.insert(key).second);
+            }
+
+            bsl::string moved(makeString(1000), &ta);
+            ASSERT(mX.insert(MoveUtil::move(moved)).second);
+            ASSERT(51 == X.size());
+
+            for (StringObj::const_iterator it = X.begin();
+                 it != X.end();
+                 ++it) {
+                ASSERT(&ta == it->get_allocator().mechanism());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few elements, and compare the set with
+        //:   a 'bsl::set' holding the same elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj           mX;  const Obj& X = mX;
+        bsl::set<int> oracle;
+
+        for (int i = 0; i < 1000; ++i) {
+            const int key = (i * 37) % 501;
+            mX.insert(key);
+            oracle.insert(key);
+            if (0 == i % 3) {
+                mX.erase(key / 2);
+                oracle.erase(key / 2);
+            }
+        }
+
+        ASSERTV(oracle.size(), X.size(), oracle.size() == X.size());
+        for (bsl::set<int>::const_iterator it = oracle.begin();
+             it != oracle.end();
+             ++it) {
+            ASSERTV(*it, X.contains(*it));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
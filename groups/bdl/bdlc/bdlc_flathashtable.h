@@ -0,0 +1,1687 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table like Abseil 'flat_hash_map'.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressed hash table like Abseil 'flat_hash_map'
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides the class template
+// 'bdlc::FlatHashTable', an implementation of an open-addressed hash table in
+// the style of the Abseil "Swiss table".  The template is the common
+// implementation of 'bdlc::FlatHashMap' and 'bdlc::FlatHashSet', and is not
+// intended for direct client use.
+//
+// The table is parameterized by the 'KEY' type used for lookup, the 'ENTRY'
+// type stored in the table, an 'ENTRY_UTIL' type providing the means to
+// obtain the key of an entry and to construct an entry from a key, and the
+// 'HASH' and 'EQUAL' functor types applied to keys.  The 'ENTRY_UTIL' type
+// must provide the following static member functions:
+//..
+//  template <class KEY_TYPE>
+//  static void constructFromKey(ENTRY            *entry,
+//                               bslma::Allocator *allocator,
+//                               const KEY_TYPE&   key);
+//      // Create, at the specified 'entry' address, an entry having the
+//      // specified 'key' (and, for a map, a default-constructed value),
+//      // using the specified 'allocator' to supply memory.
+//
+//  static const KEY& key(const ENTRY& entry);
+//      // Return a reference offering non-modifiable access to the key of the
+//      // specified 'entry'.
+//..
+//
+///Table Layout
+///------------
+// The table stores its entries in a single array of 'capacity()' slots,
+// without any per-entry node or link.  A parallel array holds one control
+// byte per slot: a control byte either marks the slot as empty or erased, or
+// marks it as in use and holds seven bits of the hash value of the key of the
+// slot's entry.  The capacity is always either 0 or a power of two not less
+// than 16, and the slots are partitioned into groups of 16 consecutive slots.
+//
+// The hash value of a key selects the group at which the search for the key
+// starts, and the seven bits stored in the control byte.  A lookup examines
+// the 16 control bytes of a group at once (using SSE2 instructions where
+// available, see 'bdlc_flathashtable_groupcontrol'), compares the key only
+// against the entries whose control bytes match, and probes successive
+// groups (following a triangular sequence, which visits every group) until
+// a group containing an empty slot is found.  A successful lookup therefore
+// typically reads one cache line of control bytes and one entry, and an
+// unsuccessful lookup typically reads only the control bytes.
+//
+// The table is rehashed to double its capacity when an insertion would make
+// its load factor exceed 'max_load_factor()' (7/8).  An erased slot is marked
+// 'erased' rather than 'empty' if its group is full, so that probe sequences
+// passing through the group are not cut short, and such a slot counts
+// against the maximum load until the next rehash.  When an insertion finds
+// the maximum load exhausted while at most half of it is held by entries, the
+// table is instead rehashed at its current capacity, which purges the erased
+// slots; a workload that erases and inserts at a constant size therefore
+// keeps both its capacity and its lookup cost bounded.  The bits of the hash
+// value selecting the group and the control byte are taken from the product
+// of the hash value and a large odd constant, so hash functors having
+// poorly-distributed bits (e.g., the identity function on integers) still
+// give good group occupancy, although a high-quality hash functor such as
+// 'bslh::Hash<>' is recommended.
+//
+///Entry Stability
+///---------------
+// Entries are stored directly in the slot array, so any operation that may
+// rehash the table (inserting an entry, 'rehash', 'reserve') invalidates all
+// iterators, pointers, and references to entries.  Erasing an entry
+// invalidates only iterators, pointers, and references to that entry.  When
+// the table is rehashed, entries of a type that is bitwise moveable (see
+// 'bslmf_isbitwisemoveable') are relocated by copying their bytes; other
+// entries are move-constructed into their new slot and then destroyed.
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+#include <bsls_util.h>
+
+#include <bslstl_forwarditerator.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ===============================
+                     // class FlatHashTable_IteratorImp
+                     // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class implements the minimal interface required by
+    // 'bslstl::ForwardIterator' to iterate over the in-use slots of a
+    // 'FlatHashTable'.
+
+    // DATA
+    ENTRY              *d_entries_p;         // current entry, or 0 at end
+    const bsl::uint8_t *d_controls_p;        // control byte of current entry
+    bsl::size_t         d_additionalLength;  // number of slots following the
+                                             // current one
+
+    // FRIENDS
+    template <class OTHER_ENTRY>
+    friend bool operator==(const FlatHashTable_IteratorImp<OTHER_ENTRY>&,
+                           const FlatHashTable_IteratorImp<OTHER_ENTRY>&);
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create an iterator having the past-the-end value.
+
+    FlatHashTable_IteratorImp(ENTRY              *entries,
+                              const bsl::uint8_t *controls,
+                              bsl::size_t         additionalLength);
+        // Create an iterator referring to the specified 'entries', whose
+        // control byte is at the specified 'controls', that is followed by
+        // the specified 'additionalLength' slots.  The behavior is undefined
+        // unless '*controls' denotes a slot in use.
+
+    // FlatHashTable_IteratorImp(
+    //                 const FlatHashTable_IteratorImp& original) = default;
+        // Create an iterator having the value of the specified 'original'.
+
+    // ~FlatHashTable_IteratorImp() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    // FlatHashTable_IteratorImp& operator=(
+    //                      const FlatHashTable_IteratorImp& rhs) = default;
+        // Assign to this object the value of the specified 'rhs', and return
+        // a reference providing modifiable access to this object.
+
+    void operator++();
+        // Advance this iterator to the next slot in use, or to the
+        // past-the-end value if there is none.  The behavior is undefined
+        // unless this iterator is dereferenceable.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this iterator.  The
+        // behavior is undefined unless this iterator is dereferenceable.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same slot, or both have the past-the-end value, and 'false' otherwise.
+
+                     // ==================================
+                     // class FlatHashTable_ArrayProctor
+                     // ==================================
+
+template <class ENTRY>
+class FlatHashTable_ArrayProctor {
+    // This class implements a proctor that, unless its 'release' method is
+    // invoked, destroys the entries of the slots marked in use in an array
+    // of control bytes (optionally), and deallocates both the entry array and
+    // the control array.
+
+    // DATA
+    ENTRY            *d_entries_p;      // managed entries
+    bsl::uint8_t     *d_controls_p;     // managed controls
+    bsl::size_t       d_capacity;       // number of slots
+    bool              d_destroyInUse;   // destroy in-use entries if 'true'
+    bslma::Allocator *d_allocator_p;    // allocator of the arrays
+
+    // NOT IMPLEMENTED
+    FlatHashTable_ArrayProctor(const FlatHashTable_ArrayProctor&);
+    FlatHashTable_ArrayProctor& operator=(const FlatHashTable_ArrayProctor&);
+
+  public:
+    // CREATORS
+    FlatHashTable_ArrayProctor(ENTRY            *entries,
+                               bsl::uint8_t     *controls,
+                               bsl::size_t       capacity,
+                               bool              destroyInUse,
+                               bslma::Allocator *allocator);
+        // Create a proctor managing the specified 'entries' and 'controls'
+        // arrays of the specified 'capacity' slots, allocated from the
+        // specified 'allocator', that destroys the in-use entries if the
+        // specified 'destroyInUse' is 'true'.
+
+    ~FlatHashTable_ArrayProctor();
+        // Unless 'release' has been invoked, destroy the managed in-use
+        // entries (if so configured) and deallocate the managed arrays.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the arrays managed by this proctor.
+};
+
+                           // ===================
+                           // class FlatHashTable
+                           // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template implements an open-addressed hash table of unique
+    // keys in which each 'ENTRY' is stored directly in a slot of a single
+    // array, and each slot is described by a control byte in a parallel
+    // array (see {Table Layout}).
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl GroupControl;
+    typedef bslmf::MovableRefUtil      MoveUtil;
+
+    // DATA
+    ENTRY            *d_entries_p;    // array of 'd_capacity' slots
+    bsl::uint8_t     *d_controls_p;   // array of 'd_capacity' control bytes
+    bsl::size_t       d_size;         // number of entries
+    bsl::size_t       d_growthLeft;   // number of empty slots that may be
+                                      // filled before the next rehash
+    bsl::size_t       d_capacity;     // number of slots (0 or a power of 2
+                                      // not less than 'k_MIN_CAPACITY')
+    HASH              d_hasher;       // hash functor
+    EQUAL             d_equal;        // equality functor
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static void allocateArrays(ENTRY            **entries,
+                               bsl::uint8_t     **controls,
+                               bsl::size_t        capacity,
+                               bslma::Allocator  *allocator);
+        // Load into the specified 'entries' and 'controls' the addresses of
+        // newly allocated arrays of the specified 'capacity' slots and
+        // control bytes, respectively, obtained from the specified
+        // 'allocator', with each control byte set to 'k_EMPTY'.  If an
+        // exception is thrown, no memory is leaked.  The behavior is
+        // undefined unless '0 < capacity'.
+
+    static bsl::size_t capacityForEntries(bsl::size_t numEntries);
+        // Return the smallest valid capacity whose maximum load admits the
+        // specified 'numEntries', or 0 if 'numEntries' is 0.
+
+    static bsl::size_t findAvailable(const bsl::uint8_t *controls,
+                                     bsl::size_t         capacity,
+                                     bsl::size_t         hashValue);
+        // Return the index of the first available slot in the probe sequence
+        // of the specified 'hashValue' within the specified 'controls' array
+        // of the specified 'capacity' slots.  The behavior is undefined
+        // unless 'controls' has an available slot.
+
+    static bsl::size_t groupIndex(bsl::size_t hashValue,
+                                  bsl::size_t numGroups);
+        // Return the index of the first group in the probe sequence of the
+        // specified 'hashValue' in a table having the specified 'numGroups'.
+
+    static bsl::uint8_t hashControl(bsl::size_t hashValue);
+        // Return the control byte of a slot holding an entry whose key has
+        // the specified 'hashValue'.
+
+    static bsl::size_t maxLoad(bsl::size_t capacity);
+        // Return the maximum number of entries in a table having the
+        // specified 'capacity'.
+
+    // PRIVATE MANIPULATORS
+    void destroyEntries();
+        // Destroy each entry of this table, leaving the control bytes
+        // unchanged.
+
+    void eraseIndex(bsl::size_t index);
+        // Destroy the entry at the specified 'index' and mark its slot as
+        // available.  The behavior is undefined unless the slot at 'index' is
+        // in use.
+
+    bsl::size_t indexOfKey(bool        *notFound,
+                           const KEY&   key,
+                           bsl::size_t  hashValue);
+        // Return the index of the slot holding the entry having the
+        // specified 'key' whose hash value is the specified 'hashValue', and
+        // load 'false' into the specified 'notFound', if there is such an
+        // entry; otherwise, rehash this table if no empty slot may be filled
+        // (doubling its capacity unless at most half of its maximum load is
+        // held by entries), return the index of an available slot into which
+        // such an entry should be inserted, account for that slot being
+        // filled, and load 'true' into 'notFound'.
+
+    void rehashRaw(bsl::size_t newCapacity);
+        // Move the entries of this table to newly allocated arrays of the
+        // specified 'newCapacity' slots, leaving no erased slots.  The
+        // behavior is undefined unless 'newCapacity' is 0 or a power of 2 not
+        // less than 'k_MIN_CAPACITY', and 'size() <= maxLoad(newCapacity)'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findKey(const KEY& key, bsl::size_t hashValue) const;
+        // Return the index of the slot holding the entry having the specified
+        // 'key', whose hash value is the specified 'hashValue', or
+        // 'd_capacity' if there is no such entry.
+
+    FlatHashTable_IteratorImp<ENTRY> iteratorAt(bsl::size_t index) const;
+        // Return an iterator implementation referring to the slot at the
+        // specified 'index'.  The behavior is undefined unless the slot at
+        // 'index' is in use.
+
+  public:
+    // TYPES
+    typedef ENTRY                                          value_type;
+    typedef KEY                                            key_type;
+    typedef bsl::size_t                                    size_type;
+    typedef bsl::ptrdiff_t                                 difference_type;
+    typedef HASH                                           hasher;
+    typedef EQUAL                                          key_equal;
+
+    typedef bslstl::ForwardIterator<ENTRY,
+                                    FlatHashTable_IteratorImp<ENTRY> >
+                                                           iterator;
+    typedef bslstl::ForwardIterator<const ENTRY,
+                                    FlatHashTable_IteratorImp<ENTRY> >
+                                                           const_iterator;
+
+    // CONSTANTS
+    enum { k_MIN_CAPACITY = GroupControl::k_SIZE };
+        // smallest non-zero capacity
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table having at least the specified 'capacity',
+        // that will use the specified 'hash' to generate hash values for the
+        // keys of its entries and the specified 'equal' to compare keys.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  If 'capacity' is 0, no memory is allocated.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, hasher, and key-equality
+        // comparator as the specified 'original'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable> original);
+        // Create a table having the same value, hasher, key-equality
+        // comparator, and allocator as the specified 'original' by taking
+        // ownership of its arrays.  'original' is left empty, with no
+        // capacity.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable>  original,
+                  bslma::Allocator                 *basicAllocator);
+        // Create a table having the same value, hasher, and key-equality
+        // comparator as the specified 'original', using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  If
+        // 'basicAllocator' is the allocator of 'original', ownership of its
+        // arrays is transferred and 'original' is left empty; otherwise, its
+        // entries are moved into newly allocated arrays, and 'original' is
+        // left in a valid but unspecified state.
+
+    ~FlatHashTable();
+        // Destroy this object and each of its entries.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this object the value, hasher, and key-equality
+        // comparator of the specified 'rhs', and return a reference
+        // providing modifiable access to this object.  If an exception is
+        // thrown, this object is unchanged.
+
+    FlatHashTable& operator=(bslmf::MovableRef<FlatHashTable> rhs);
+        // Assign to this object the value, hasher, and key-equality
+        // comparator of the specified 'rhs', and return a reference
+        // providing modifiable access to this object.  If this object and
+        // 'rhs' use the same allocator, 'rhs' is left empty; otherwise, it is
+        // left in a valid but unspecified state.
+
+    void clear();
+        // Destroy each entry of this table, retaining its capacity.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators delimiting the range of entries having
+        // the specified 'key', which is empty if there is no such entry.
+
+    bsl::size_t erase(const KEY& key);
+        // Destroy the entry having the specified 'key', if any.  Return the
+        // number of entries destroyed (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Destroy the entry at the specified 'position', and return an
+        // iterator referring to the entry following it, or the past-the-end
+        // iterator if there is none.  The behavior is undefined unless
+        // 'position' refers to an entry of this table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Destroy the entries in the range '[first .. last)', and return
+        // 'last' as a modifiable iterator.  The behavior is undefined unless
+        // 'first' and 'last' delimit a valid range of this table.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the past-the-end iterator if there is no such entry.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<ENTRY> entry);
+        // Insert a copy of the specified 'entry' (moved, in the second
+        // overload) if this table has no entry having its key.  Return an
+        // iterator referring to the entry of this table having the key of
+        // 'entry', and 'true' if the entry was inserted or 'false' if an
+        // entry having that key was already present.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert a copy of each entry in the range '[first .. last)' whose
+        // key is not already present in this table.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this table to the smallest valid capacity
+        // not less than the specified 'minimumCapacity' that admits the
+        // current number of entries, and redistribute the entries.  Note that
+        // this method can reduce the capacity, and that rehashing to the
+        // current capacity reclaims the slots of erased entries.
+
+    void reserve(bsl::size_t numEntries);
+        // Increase, if needed, the capacity of this table so that it admits
+        // at least the specified 'numEntries' without rehashing, reclaiming
+        // the slots of erased entries if they would otherwise force a
+        // rehash.
+
+    void reset();
+        // Destroy each entry of this table and release its arrays, leaving
+        // it with no capacity.
+
+    bsl::pair<iterator, bool> tryEmplace(const KEY& key);
+        // Insert an entry created from the specified 'key' (see
+        // 'ENTRY_UTIL::constructFromKey') if this table has no entry having
+        // 'key'.  Return an iterator referring to the entry of this table
+        // having 'key', and 'true' if the entry was inserted or 'false'
+        // otherwise.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this table.
+
+                          // Aspects
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, hasher, and key-equality comparator of this
+        // object with those of the specified 'other' object.  This method
+        // provides the no-throw exception-safety guarantee if 'HASH' and
+        // 'EQUAL' have no-throw swaps.  The behavior is undefined unless this
+        // object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table has an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    const bsl::uint8_t *controls() const;
+        // Return the address of the array of 'capacity()' control bytes of
+        // this table, or 0 if it has no capacity.  Note that this method is
+        // intended for testing.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this table has no entries, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                        const KEY& key) const;
+        // Return a pair of iterators delimiting the range of entries having
+        // the specified 'key', which is empty if there is no such entry.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the past-the-end iterator if there is no such entry.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this table.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality comparator of this table.
+
+    float load_factor() const;
+        // Return the ratio of the number of entries to the capacity of this
+        // table, or 0 if it has no capacity.
+
+    float max_load_factor() const;
+        // Return the load factor beyond which this table is rehashed (7/8).
+
+    bsl::size_t size() const;
+        // Return the number of entries of this table.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this table.
+
+                          // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries and, for each entry of 'lhs', 'rhs'
+    // has an entry having the same key that compares equal to it (using
+    // 'ENTRY::operator==').
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  If 'a' and
+    // 'b' use the same allocator, this function provides the no-throw
+    // exception-safety guarantee (if 'HASH' and 'EQUAL' do); otherwise, the
+    // values are exchanged by copying, and this function provides the basic
+    // guarantee.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                     // -------------------------------
+                     // class FlatHashTable_IteratorImp
+                     // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entries_p(0)
+, d_controls_p(0)
+, d_additionalLength(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                         ENTRY              *entries,
+                                         const bsl::uint8_t *controls,
+                                         bsl::size_t         additionalLength)
+: d_entries_p(entries)
+, d_controls_p(controls)
+, d_additionalLength(additionalLength)
+{
+    BSLS_ASSERT_SAFE(entries);
+    BSLS_ASSERT_SAFE(controls);
+    BSLS_ASSERT_SAFE(0 == (*controls & FlatHashTable_GroupControl::k_EMPTY));
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_entries_p);
+
+    // Since the load factor of a table is at least 7/16 after growth, a
+    // byte-at-a-time scan typically finds the next slot in use within a few
+    // bytes, and measures faster than scanning a group at a time.
+
+    while (d_additionalLength) {
+        ++d_entries_p;
+        ++d_controls_p;
+        --d_additionalLength;
+
+        // Available slots, and only those, have the high bit set.
+
+        if (0 == (*d_controls_p & FlatHashTable_GroupControl::k_EMPTY)) {
+            return;                                                   // RETURN
+        }
+    }
+
+    d_entries_p  = 0;
+    d_controls_p = 0;
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_entries_p);
+
+    return *d_entries_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool bdlc::operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                      const FlatHashTable_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.d_entries_p == rhs.d_entries_p;
+}
+
+namespace bdlc {
+
+                     // ----------------------------------
+                     // class FlatHashTable_ArrayProctor
+                     // ----------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_ArrayProctor<ENTRY>::FlatHashTable_ArrayProctor(
+                                              ENTRY            *entries,
+                                              bsl::uint8_t     *controls,
+                                              bsl::size_t       capacity,
+                                              bool              destroyInUse,
+                                              bslma::Allocator *allocator)
+: d_entries_p(entries)
+, d_controls_p(controls)
+, d_capacity(capacity)
+, d_destroyInUse(destroyInUse)
+, d_allocator_p(allocator)
+{
+}
+
+template <class ENTRY>
+FlatHashTable_ArrayProctor<ENTRY>::~FlatHashTable_ArrayProctor()
+{
+    if (d_controls_p) {
+        if (d_destroyInUse) {
+            for (bsl::size_t i = 0; i < d_capacity; ++i) {
+                if (0 == (d_controls_p[i] &
+                                        FlatHashTable_GroupControl::k_EMPTY)) {
+                    bslma::DestructionUtil::destroy(d_entries_p + i);
+                }
+            }
+        }
+        d_allocator_p->deallocate(d_entries_p);
+        d_allocator_p->deallocate(d_controls_p);
+    }
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_ArrayProctor<ENTRY>::release()
+{
+    d_controls_p = 0;
+}
+
+                           // -------------------
+                           // class FlatHashTable
+                           // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocateArrays(
+                                               ENTRY            **entries,
+                                               bsl::uint8_t     **controls,
+                                               bsl::size_t        capacity,
+                                               bslma::Allocator  *allocator)
+{
+    BSLS_ASSERT_SAFE(entries);
+    BSLS_ASSERT_SAFE(controls);
+    BSLS_ASSERT_SAFE(0 < capacity);
+
+    *entries = static_cast<ENTRY *>(
+                                allocator->allocate(capacity * sizeof(ENTRY)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(*entries, allocator);
+
+    *controls = static_cast<bsl::uint8_t *>(allocator->allocate(capacity));
+    bsl::memset(*controls, GroupControl::k_EMPTY, capacity);
+
+    proctor.release();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacityForEntries(
+                                                        bsl::size_t numEntries)
+{
+    if (0 == numEntries) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t capacity = k_MIN_CAPACITY;
+    while (maxLoad(capacity) < numEntries) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                          const bsl::uint8_t *controls,
+                                          bsl::size_t         capacity,
+                                          bsl::size_t         hashValue)
+{
+    const bsl::size_t numGroups = capacity / GroupControl::k_SIZE;
+
+    bsl::size_t group = groupIndex(hashValue, numGroups);
+    for (bsl::size_t i = 1; ; ++i) {
+        const bsl::size_t   base = group * GroupControl::k_SIZE;
+        const bsl::uint32_t mask = GroupControl(controls + base).available();
+
+        if (mask) {
+            return base + bdlb::BitUtil::numTrailingUnsetBits(mask);  // RETURN
+        }
+
+        BSLS_ASSERT_SAFE(i < numGroups);
+
+        group = (group + i) & (numGroups - 1);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::groupIndex(
+                                                     bsl::size_t hashValue,
+                                                     bsl::size_t numGroups)
+{
+    // Use the high half of a Fibonacci-hashed product, so that every bit of
+    // the hash value affects the group.
+
+    return static_cast<bsl::size_t>(
+                 (static_cast<bsls::Types::Uint64>(hashValue)
+                                           * 0x9E3779B97F4A7C15ULL) >> 32)
+         & (numGroups - 1);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::uint8_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hashControl(
+                                                         bsl::size_t hashValue)
+{
+    // Use seven bits of the low half of the same product as 'groupIndex'.
+
+    return static_cast<bsl::uint8_t>(
+                 ((static_cast<bsls::Types::Uint64>(hashValue)
+                                           * 0x9E3779B97F4A7C15ULL) >> 25)
+         & 0x7F);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::maxLoad(
+                                                          bsl::size_t capacity)
+{
+    return capacity / 8 * 7;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::destroyEntries()
+{
+    for (bsl::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
+        bsl::uint32_t mask = GroupControl(d_controls_p + i).inUse();
+        while (mask) {
+            bslma::DestructionUtil::destroy(
+                  d_entries_p + i + bdlb::BitUtil::numTrailingUnsetBits(mask));
+            mask &= mask - 1;
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::eraseIndex(
+                                                             bsl::size_t index)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(0 == (d_controls_p[index] & GroupControl::k_EMPTY));
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    // A group that has an empty slot has never been full since the last
+    // rehash, so no probe sequence has continued past it, and the slot can
+    // be marked empty; otherwise it must be marked erased so that probe
+    // sequences passing through the group are not cut short.
+
+    const bsl::size_t base = index & ~static_cast<bsl::size_t>(
+                                                    GroupControl::k_SIZE - 1);
+    if (GroupControl(d_controls_p + base).containsEmpty()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+        ++d_growthLeft;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::indexOfKey(
+                                                      bool        *notFound,
+                                                      const KEY&   key,
+                                                      bsl::size_t  hashValue)
+{
+    BSLS_ASSERT_SAFE(notFound);
+
+    const bsl::size_t found = findKey(key, hashValue);
+    if (found != d_capacity) {
+        *notFound = false;
+        return found;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_growthLeft)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Erased slots use up the maximum load as surely as entries do.  If
+        // entries hold at most half of it, purge the erased slots in place,
+        // which leaves at least half of the maximum load for growth, so that
+        // the cost of the rehash is amortized over as many insertions as
+        // when doubling.
+
+        if (d_capacity && d_size <= maxLoad(d_capacity) / 2) {
+            rehashRaw(d_capacity);
+        }
+        else {
+            rehashRaw(d_capacity ? 2 * d_capacity
+                                 : static_cast<bsl::size_t>(k_MIN_CAPACITY));
+        }
+    }
+
+    const bsl::size_t index = findAvailable(d_controls_p,
+                                            d_capacity,
+                                            hashValue);
+
+    // Reusing an erased slot does not reduce the number of empty slots.
+
+    if (GroupControl::k_EMPTY == d_controls_p[index]) {
+        --d_growthLeft;
+    }
+
+    *notFound = true;
+    return index;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
+                                                       bsl::size_t newCapacity)
+{
+    BSLS_ASSERT(d_size <= maxLoad(newCapacity));
+
+    ENTRY        *entries  = 0;
+    bsl::uint8_t *controls = 0;
+
+    if (newCapacity) {
+        allocateArrays(&entries, &controls, newCapacity, d_allocator_p);
+    }
+
+    // Entries that are bitwise moveable are relocated by copying their bytes;
+    // until the old array is released, the originals remain the owners of
+    // any resources, so the proctor must not destroy the copies.
+
+    const bool isBitwise = bslmf::IsBitwiseMoveable<ENTRY>::value;
+
+    FlatHashTable_ArrayProctor<ENTRY> proctor(entries,
+                                              controls,
+                                              newCapacity,
+                                              !isBitwise,
+                                              d_allocator_p);
+    if (!newCapacity) {
+        proctor.release();
+    }
+
+    for (bsl::size_t i = 0; i < d_capacity; i += GroupControl::k_SIZE) {
+        bsl::uint32_t mask = GroupControl(d_controls_p + i).inUse();
+        while (mask) {
+            const bsl::size_t  from      = i +
+                                    bdlb::BitUtil::numTrailingUnsetBits(mask);
+            const bsl::size_t  hashValue =
+                                  d_hasher(ENTRY_UTIL::key(d_entries_p[from]));
+            const bsl::size_t  to        = findAvailable(controls,
+                                                         newCapacity,
+                                                         hashValue);
+            if (isBitwise) {
+                bsl::memcpy(static_cast<void *>(entries + to),
+                            static_cast<const void *>(d_entries_p + from),
+                            sizeof(ENTRY));
+            }
+            else {
+                bslma::ConstructionUtil::construct(
+                                          entries + to,
+                                          d_allocator_p,
+                                          MoveUtil::move(d_entries_p[from]));
+            }
+            controls[to] = hashControl(hashValue);
+            mask &= mask - 1;
+        }
+    }
+
+    proctor.release();
+
+    if (d_capacity) {
+        if (!isBitwise) {
+            destroyEntries();
+        }
+        d_allocator_p->deallocate(d_entries_p);
+        d_allocator_p->deallocate(d_controls_p);
+    }
+
+    d_entries_p  = entries;
+    d_controls_p = controls;
+    d_growthLeft = maxLoad(newCapacity) - d_size;
+    d_capacity   = newCapacity;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
+                                                 const KEY&  key,
+                                                 bsl::size_t hashValue) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_capacity)) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::uint8_t control   = hashControl(hashValue);
+    const bsl::size_t  numGroups = d_capacity / GroupControl::k_SIZE;
+
+    bsl::size_t group = groupIndex(hashValue, numGroups);
+    for (bsl::size_t i = 1; i <= numGroups; ++i) {
+        const bsl::size_t  base = group * GroupControl::k_SIZE;
+        const GroupControl groupControl(d_controls_p + base);
+
+        bsl::uint32_t candidates = groupControl.match(control);
+        while (candidates) {
+            const bsl::size_t index =
+                       base + bdlb::BitUtil::numTrailingUnsetBits(candidates);
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                             d_equal(ENTRY_UTIL::key(d_entries_p[index]),
+                                     key))) {
+                return index;                                         // RETURN
+            }
+            candidates &= candidates - 1;
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                             groupControl.containsEmpty())) {
+            break;
+        }
+
+        group = (group + i) & (numGroups - 1);
+    }
+
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+FlatHashTable_IteratorImp<ENTRY>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iteratorAt(
+                                                       bsl::size_t index) const
+{
+    return FlatHashTable_IteratorImp<ENTRY>(d_entries_p + index,
+                                            d_controls_p + index,
+                                            d_capacity - index - 1);
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                             bsl::size_t       capacity,
+                                             const HASH&       hash,
+                                             const EQUAL&      equal,
+                                             bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_growthLeft(0)
+, d_capacity(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        bsl::size_t newCapacity = k_MIN_CAPACITY;
+        while (newCapacity < capacity) {
+            newCapacity *= 2;
+        }
+        rehashRaw(newCapacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                         const FlatHashTable&  original,
+                                         bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_growthLeft(0)
+, d_capacity(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (0 == original.d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t capacity = original.d_capacity;
+
+    ENTRY        *entries;
+    bsl::uint8_t *controls;
+    allocateArrays(&entries, &controls, capacity, d_allocator_p);
+
+    // Entries are copied to the same slots, so the copy has the same probe
+    // sequences as 'original'.  Each in-use slot is marked erased until its
+    // entry is constructed, so that the proctor destroys only constructed
+    // entries while erased slots still extend the probe sequences.
+
+    for (bsl::size_t i = 0; i < capacity; ++i) {
+        controls[i] = (original.d_controls_p[i] & GroupControl::k_EMPTY)
+                    ? original.d_controls_p[i]
+                    : GroupControl::k_ERASED;
+    }
+
+    FlatHashTable_ArrayProctor<ENTRY> proctor(entries,
+                                              controls,
+                                              capacity,
+                                              true,
+                                              d_allocator_p);
+
+    for (bsl::size_t i = 0; i < capacity; ++i) {
+        if (0 == (original.d_controls_p[i] & GroupControl::k_EMPTY)) {
+            bslma::ConstructionUtil::construct(entries + i,
+                                               d_allocator_p,
+                                               original.d_entries_p[i]);
+            controls[i] = original.d_controls_p[i];
+        }
+    }
+
+    proctor.release();
+
+    d_entries_p  = entries;
+    d_controls_p = controls;
+    d_size       = original.d_size;
+    d_growthLeft = original.d_growthLeft;
+    d_capacity   = capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                     bslmf::MovableRef<FlatHashTable> original)
+: d_entries_p(MoveUtil::access(original).d_entries_p)
+, d_controls_p(MoveUtil::access(original).d_controls_p)
+, d_size(MoveUtil::access(original).d_size)
+, d_growthLeft(MoveUtil::access(original).d_growthLeft)
+, d_capacity(MoveUtil::access(original).d_capacity)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    FlatHashTable& lvalue = original;
+
+    lvalue.d_entries_p  = 0;
+    lvalue.d_controls_p = 0;
+    lvalue.d_size       = 0;
+    lvalue.d_growthLeft = 0;
+    lvalue.d_capacity   = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                             bslmf::MovableRef<FlatHashTable>  original,
+                             bslma::Allocator                 *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_growthLeft(0)
+, d_capacity(0)
+, d_hasher(MoveUtil::access(original).d_hasher)
+, d_equal(MoveUtil::access(original).d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    FlatHashTable& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        bslalg::SwapUtil::swap(&d_entries_p,  &lvalue.d_entries_p);
+        bslalg::SwapUtil::swap(&d_controls_p, &lvalue.d_controls_p);
+        bslalg::SwapUtil::swap(&d_size,       &lvalue.d_size);
+        bslalg::SwapUtil::swap(&d_growthLeft, &lvalue.d_growthLeft);
+        bslalg::SwapUtil::swap(&d_capacity,   &lvalue.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    reserve(lvalue.d_size);
+    for (iterator it = lvalue.begin(); it != lvalue.end(); ++it) {
+        insert(MoveUtil::move(*it));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    if (d_capacity) {
+        destroyEntries();
+        d_allocator_p->deallocate(d_entries_p);
+        d_allocator_p->deallocate(d_controls_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator_p);
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                          bslmf::MovableRef<FlatHashTable> rhs)
+{
+    FlatHashTable& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatHashTable other(MoveUtil::move(lvalue), d_allocator_p);
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    if (d_capacity) {
+        destroyEntries();
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+        d_size       = 0;
+        d_growthLeft = maxLoad(d_capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<
+      typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+      typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
+                                                                const KEY& key)
+{
+    iterator first = find(key);
+    iterator last  = first;
+    if (last != end()) {
+        ++last;
+    }
+    return bsl::pair<iterator, iterator>(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t index = findKey(key, d_hasher(key));
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+    eraseIndex(index);
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    const bsl::size_t index = bsls::Util::addressOf(*position) - d_entries_p;
+
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    FlatHashTable_IteratorImp<ENTRY> next = iteratorAt(index);
+    ++next;
+
+    eraseIndex(index);
+
+    return iterator(next);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(iterator position)
+{
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    // Erasing an entry does not move any other entry, so 'last' remains
+    // valid throughout.
+
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator(last.imp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    const bsl::size_t index = findKey(key, d_hasher(key));
+    if (index == d_capacity) {
+        return end();                                                 // RETURN
+    }
+    return iterator(iteratorAt(index));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+      typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+      bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    const KEY&        key       = ENTRY_UTIL::key(entry);
+    const bsl::size_t hashValue = d_hasher(key);
+
+    bool              notFound;
+    const bsl::size_t index = indexOfKey(&notFound, key, hashValue);
+
+    if (notFound) {
+        bslma::ConstructionUtil::construct(d_entries_p + index,
+                                           d_allocator_p,
+                                           entry);
+        d_controls_p[index] = hashControl(hashValue);
+        ++d_size;
+    }
+
+    return bsl::pair<iterator, bool>(iterator(iteratorAt(index)), notFound);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+      typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+      bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY&            lvalue    = entry;
+    const KEY&        key       = ENTRY_UTIL::key(lvalue);
+    const bsl::size_t hashValue = d_hasher(key);
+
+    bool              notFound;
+    const bsl::size_t index = indexOfKey(&notFound, key, hashValue);
+
+    if (notFound) {
+        bslma::ConstructionUtil::construct(d_entries_p + index,
+                                           d_allocator_p,
+                                           MoveUtil::move(lvalue));
+        d_controls_p[index] = hashControl(hashValue);
+        ++d_size;
+    }
+
+    return bsl::pair<iterator, bool>(iterator(iteratorAt(index)), notFound);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        insert(*first);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   bsl::size_t minimumCapacity)
+{
+    bsl::size_t newCapacity = capacityForEntries(d_size);
+
+    if (newCapacity < minimumCapacity) {
+        if (0 == newCapacity) {
+            newCapacity = k_MIN_CAPACITY;
+        }
+        while (newCapacity < minimumCapacity) {
+            newCapacity *= 2;
+        }
+    }
+
+    rehashRaw(newCapacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    if (maxLoad(d_capacity) < numEntries) {
+        rehashRaw(capacityForEntries(numEntries));
+    }
+    else if (d_size + d_growthLeft < numEntries) {
+        // Erased slots would force a rehash before 'numEntries' is reached,
+        // so purge them now.
+
+        rehashRaw(d_capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
+{
+    if (d_capacity) {
+        destroyEntries();
+        d_allocator_p->deallocate(d_entries_p);
+        d_allocator_p->deallocate(d_controls_p);
+
+        d_entries_p  = 0;
+        d_controls_p = 0;
+        d_size       = 0;
+        d_growthLeft = 0;
+        d_capacity   = 0;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+      typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+      bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::tryEmplace(const KEY& key)
+{
+    const bsl::size_t hashValue = d_hasher(key);
+
+    bool              notFound;
+    const bsl::size_t index = indexOfKey(&notFound, key, hashValue);
+
+    if (notFound) {
+        ENTRY_UTIL::constructFromKey(d_entries_p + index, d_allocator_p, key);
+        d_controls_p[index] = hashControl(hashValue);
+        ++d_size;
+    }
+
+    return bsl::pair<iterator, bool>(iterator(iteratorAt(index)), notFound);
+}
+
+                          // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    if (0 == d_size) {
+        return end();                                                 // RETURN
+    }
+
+    for (bsl::size_t i = 0; ; i += GroupControl::k_SIZE) {
+        BSLS_ASSERT_SAFE(i < d_capacity);
+
+        const bsl::uint32_t mask = GroupControl(d_controls_p + i).inUse();
+        if (mask) {
+            return iterator(iteratorAt(
+                         i + bdlb::BitUtil::numTrailingUnsetBits(mask)));
+                                                                      // RETURN
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator();
+}
+
+                          // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_growthLeft, &other.d_growthLeft);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_hasher,     &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,      &other.d_equal);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity()
+                                                                          const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                          const KEY& key) const
+{
+    return findKey(key, d_hasher(key)) != d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const bsl::uint8_t *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::controls() const
+{
+    return d_controls_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::count(
+                                                          const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<
+  typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator,
+  typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
+                                                          const KEY& key) const
+{
+    const_iterator first = find(key);
+    const_iterator last  = first;
+    if (last != end()) {
+        ++last;
+    }
+    return bsl::pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    const bsl::size_t index = findKey(key, d_hasher(key));
+    if (index == d_capacity) {
+        return end();                                                 // RETURN
+    }
+    return const_iterator(iteratorAt(index));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+EQUAL FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::load_factor() const
+{
+    return d_capacity ? static_cast<float>(d_size)
+                                           / static_cast<float>(d_capacity)
+                      : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::max_load_factor()
+                                                                          const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+                          // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_cast<FlatHashTable *>(this)->begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_iterator();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::cend() const
+{
+    return const_iterator();
+}
+
+                          // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bdlc::operator==(
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                  const_iterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        ConstIterator match = rhs.find(ENTRY_UTIL::key(*it));
+        if (match == rhs.end() || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+                FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureA(b,
+                                                               a.allocator());
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureB(a,
+                                                               b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1617 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslh_hash.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>     // 'atoi', 'rand'
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an open-addressed hash table template used to
+// implement 'bdlc::FlatHashMap' and 'bdlc::FlatHashSet'.  We instantiate the
+// table with entries that are their own keys, for both a bitwise-moveable
+// entry type ('int') and an allocating entry type ('bsl::string'), and with
+// hash functors of varying quality, including one that maps every key to the
+// same value so that every lookup must probe through full groups.  The
+// primary manipulators are 'tryEmplace' and 'erase(const KEY&)'; the basic
+// accessors are 'size', 'capacity', 'contains', and 'find'.  Finally, a
+// randomized test compares the table with a 'bsl::set' oracle.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator *);
+// [ 4] FlatHashTable(const FlatHashTable&, Allocator *);
+// [ 4] FlatHashTable(MovableRef<FlatHashTable>);
+// [ 4] FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+// [ 2] ~FlatHashTable();
+//
+// MANIPULATORS
+// [ 4] FlatHashTable& operator=(const FlatHashTable&);
+// [ 4] FlatHashTable& operator=(MovableRef<FlatHashTable>);
+// [ 3] void clear();
+// [ 2] pair<iterator, iterator> equal_range(const KEY&);
+// [ 2] size_t erase(const KEY&);
+// [ 2] iterator erase(const_iterator);
+// [ 2] iterator erase(iterator);
+// [ 2] iterator erase(const_iterator, const_iterator);
+// [ 2] iterator find(const KEY&);
+// [ 2] pair<iterator, bool> insert(const ENTRY&);
+// [ 2] pair<iterator, bool> insert(MovableRef<ENTRY>);
+// [ 2] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void rehash(size_t);
+// [ 3] void reserve(size_t);
+// [ 3] void reset();
+// [ 2] pair<iterator, bool> tryEmplace(const KEY&);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 4] void swap(FlatHashTable&);
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 2] bool contains(const KEY&) const;
+// [ 2] const bsl::uint8_t *controls() const;
+// [ 2] size_t count(const KEY&) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(const KEY&)
+// [ 2] const_iterator find(const KEY&) const;
+// [ 4] HASH hash_function() const;
+// [ 4] EQUAL key_eq() const;
+// [ 3] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashTable&, const FlatHashTable&);
+// [ 4] bool operator!=(const FlatHashTable&, const FlatHashTable&);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatHashTable&, FlatHashTable&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] EXCEPTION SAFETY
+// [ 6] RANDOMIZED OPERATIONS
+// [ 7] CONSTANT-SIZE ERASE/INSERT CHURN
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+template <class ENTRY>
+struct TestEntryUtil {
+    // This utility provides the 'ENTRY_UTIL' interface for entries that are
+    // their own keys.
+
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const ENTRY&      key)
+        // Create a copy of the specified 'key' at the specified 'entry'
+        // address using the specified 'allocator'.
+    {
+        bslma::ConstructionUtil::construct(entry, allocator, key);
+    }
+
+    static const ENTRY& key(const ENTRY& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+struct ConstantHash {
+    // This functor maps every key to the same hash value, so that every key
+    // has the same probe sequence and the same control byte.
+
+    template <class KEY>
+    bsl::size_t operator()(const KEY&) const
+    {
+        return 0;
+    }
+};
+
+struct IdentityHash {
+    // This functor maps each 'int' key to its own value.
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key);
+    }
+};
+
+struct StatefulHash {
+    // This functor hashes 'int' keys using a seed supplied at construction,
+    // so that hashers having different seeds are distinguishable.
+
+    int d_seed;
+
+    explicit StatefulHash(int seed = 0)
+    : d_seed(seed)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return bslh::Hash<>()(key ^ d_seed);
+    }
+};
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            TestEntryUtil<int>,
+                            bslh::Hash<>,
+                            bsl::equal_to<int> >        Obj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            TestEntryUtil<int>,
+                            ConstantHash,
+                            bsl::equal_to<int> >        CollidingObj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            TestEntryUtil<int>,
+                            IdentityHash,
+                            bsl::equal_to<int> >        IdentityObj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            TestEntryUtil<int>,
+                            StatefulHash,
+                            bsl::equal_to<int> >        StatefulObj;
+
+typedef bdlc::FlatHashTable<bsl::string,
+                            bsl::string,
+                            TestEntryUtil<bsl::string>,
+                            bslh::Hash<>,
+                            bsl::equal_to<bsl::string> > StringObj;
+
+typedef bdlc::FlatHashTable<bsl::string,
+                            bsl::string,
+                            TestEntryUtil<bsl::string>,
+                            ConstantHash,
+                            bsl::equal_to<bsl::string> > CollidingStringObj;
+
+bsl::string makeString(int value)
+    // Return a string, too long for the short-string optimization, that is
+    // unique to the specified 'value'.
+{
+    bsl::string result("a string long enough to allocate memory: ");
+    do {
+        result.push_back(static_cast<char>('0' + value % 10));
+        value /= 10;
+    } while (value);
+    return result;
+}
+
+template <class TABLE>
+bool verifyInvariants(const TABLE& table)
+    // Return 'true' if the specified 'table' satisfies its invariants: the
+    // capacity is 0 or a power of two not less than 16, the number of in-use
+    // control bytes equals 'size()', iteration visits 'size()' entries, and
+    // every entry is found by 'find'.
+{
+    const bsl::size_t capacity = table.capacity();
+
+    if (capacity && (capacity < 16 || (capacity & (capacity - 1)))) {
+        return false;                                                 // RETURN
+    }
+    if (table.size() > capacity / 8 * 7) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t inUse = 0;
+    for (bsl::size_t i = 0; i < capacity; ++i) {
+        if (0 == (table.controls()[i] & 0x80)) {
+            ++inUse;
+        }
+    }
+    if (inUse != table.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t visited = 0;
+    for (typename TABLE::const_iterator it = table.begin();
+         it != table.end();
+         ++it, ++visited) {
+        if (table.find(*it) != it) {
+            return false;                                             // RETURN
+        }
+    }
+    return visited == table.size();
+}
+
+template <class TABLE>
+bsl::size_t numEmptySlots(const TABLE& table)
+    // Return the number of slots of the specified 'table' whose control byte
+    // marks them as empty (i.e., never used since the last rehash).
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < table.capacity(); ++i) {
+        if (0x80 == table.controls()[i]) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+template <class TABLE>
+double meanProbeLength(const TABLE& table)
+    // Return the mean, over every starting group of the specified 'table',
+    // of the number of groups that an unsuccessful lookup probes, following
+    // the triangular probe sequence of the table until it reaches a group
+    // having an empty slot.  The behavior is undefined unless
+    // '0 < table.capacity()'.
+{
+    const bsl::size_t numGroups = table.capacity() / 16;
+
+    bsl::size_t total = 0;
+    for (bsl::size_t start = 0; start < numGroups; ++start) {
+        bsl::size_t group = start;
+        for (bsl::size_t i = 1; i <= numGroups; ++i) {
+            ++total;
+
+            bool hasEmpty = false;
+            for (bsl::size_t j = 0; j < 16; ++j) {
+                if (0x80 == table.controls()[group * 16 + j]) {
+                    hasEmpty = true;
+                }
+            }
+            if (hasEmpty) {
+                break;
+            }
+            group = (group + i) & (numGroups - 1);
+        }
+    }
+    return static_cast<double>(total) / static_cast<double>(numGroups);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONSTANT-SIZE ERASE/INSERT CHURN
+        //
+        // Concerns:
+        //: 1 Repeatedly erasing an entry and inserting a new one at a
+        //:   constant size grows the table at most once, and not at all if
+        //:   the size is at most half the maximum load.
+        //:
+        //: 2 The slots of erased entries do not accumulate: the number of
+        //:   slots that are not empty never exceeds the maximum load, and the
+        //:   number of groups probed by an unsuccessful lookup stays bounded,
+        //:   even at a size close to the maximum load.
+        //:
+        //: 3 'reserve' reclaims the slots of erased entries when they would
+        //:   otherwise force a rehash before the reserved number of entries
+        //:   is reached.
+        //
+        // Plan:
+        //: 1 Using a table of sizes and reserved numbers of entries, fill a
+        //:   table reserved accordingly to the size, then repeatedly erase
+        //:   its oldest key and insert a new key, with a good hash functor
+        //:   and with the identity hash functor.  Verify that the capacity
+        //:   is unchanged if the size is at most half the maximum load, and
+        //:   otherwise at most doubles, and then only once.  (C-1)
+        //:
+        //: 2 Periodically, verify that the number of empty slots is at least
+        //:   the capacity less the maximum load, and compute from the control
+        //:   bytes the mean number of groups an unsuccessful lookup probes,
+        //:   verifying that it is small.  Verify that every live key is
+        //:   found.  (C-2)
+        //:
+        //: 3 After the churn, 'reserve' the maximum load, and verify that
+        //:   inserting up to it allocates no memory.  (C-3)
+        //
+        // Testing:
+        //   CONSTANT-SIZE ERASE/INSERT CHURN
+        //   void reserve(size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTANT-SIZE ERASE/INSERT CHURN" << endl
+                          << "================================" << endl;
+
+        static const struct {
+            int d_line;     // source line number
+            int d_size;     // number of entries during the churn
+            int d_reserve;  // number of entries reserved initially
+        } DATA[] = {
+            //LINE  SIZE  RESERVE
+            //----  ----  -------
+            { L_,    100,     400 },
+            { L_,    200,     400 },
+            { L_,    200,     200 },
+            { L_,    400,     400 },
+            { L_,    440,     440 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int NUM_ROUNDS = 50000;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int SIZE    = DATA[ti].d_size;
+            const int RESERVE = DATA[ti].d_reserve;
+
+            if (veryVerbose) { T_ P_(LINE) P_(SIZE) P(RESERVE) }
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj         mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            IdentityObj mY(0, IdentityHash(), bsl::equal_to<int>(), &ta);
+
+            mX.reserve(RESERVE);
+            mY.reserve(RESERVE);
+
+            for (int i = 0; i < SIZE; ++i) {
+                mX.insert(i);
+                mY.insert(i);
+            }
+
+            const bsl::size_t CAPACITY = mX.capacity();
+            const bool        FIXED    = 2 * SIZE <=
+                                            static_cast<int>(CAPACITY / 8 * 7);
+
+            ASSERTV(LINE, CAPACITY == mY.capacity());
+
+            bsl::size_t prevCapacityX = CAPACITY;
+            bsl::size_t prevCapacityY = CAPACITY;
+            int         numGrowthsX   = 0;
+            int         numGrowthsY   = 0;
+
+            for (int i = 0; i < NUM_ROUNDS; ++i) {
+                ASSERTV(LINE, i, 1 == mX.erase(i));
+                ASSERTV(LINE, i, 1 == mY.erase(i));
+                ASSERTV(LINE, i, mX.insert(i + SIZE).second);
+                ASSERTV(LINE, i, mY.insert(i + SIZE).second);
+
+                ASSERTV(LINE, i, SIZE == static_cast<int>(mX.size()));
+                ASSERTV(LINE, i, SIZE == static_cast<int>(mY.size()));
+
+                if (prevCapacityX != mX.capacity()) {
+                    ++numGrowthsX;
+                    prevCapacityX = mX.capacity();
+                }
+                if (prevCapacityY != mY.capacity()) {
+                    ++numGrowthsY;
+                    prevCapacityY = mY.capacity();
+                }
+
+                if (0 == i % 500) {
+                    const bsl::size_t CAP_X   = mX.capacity();
+                    const bsl::size_t CAP_Y   = mY.capacity();
+                    const double      PROBE_X = meanProbeLength(mX);
+                    const double      PROBE_Y = meanProbeLength(mY);
+
+                    if (veryVeryVerbose) {
+                        T_ T_ P_(i) P_(CAP_X) P_(PROBE_X) P_(CAP_Y) P(PROBE_Y)
+                    }
+
+                    ASSERTV(LINE, i, numEmptySlots(mX),
+                            CAP_X - CAP_X / 8 * 7 <= numEmptySlots(mX));
+                    ASSERTV(LINE, i, numEmptySlots(mY),
+                            CAP_Y - CAP_Y / 8 * 7 <= numEmptySlots(mY));
+                    ASSERTV(LINE, i, PROBE_X, PROBE_X < 4.0);
+                    ASSERTV(LINE, i, PROBE_Y, PROBE_Y < 4.0);
+                    ASSERTV(LINE, i, verifyInvariants(mX));
+                    ASSERTV(LINE, i, verifyInvariants(mY));
+                }
+            }
+
+            ASSERTV(LINE, numGrowthsX, numGrowthsX <= (FIXED ? 0 : 1));
+            ASSERTV(LINE, numGrowthsY, numGrowthsY <= (FIXED ? 0 : 1));
+            ASSERTV(LINE, mX.capacity(), mX.capacity() <= 2 * CAPACITY);
+            ASSERTV(LINE, mY.capacity(), mY.capacity() <= 2 * CAPACITY);
+
+            for (int i = NUM_ROUNDS; i < NUM_ROUNDS + SIZE; ++i) {
+                ASSERTV(LINE, i, mX.contains(i));
+                ASSERTV(LINE, i, mY.contains(i));
+            }
+
+            // Reserving the maximum load reclaims the erased slots, if any,
+            // so that filling the table to it does not rehash.
+
+            const bsl::size_t MAX_LOAD_X = mX.capacity() / 8 * 7;
+            const bsl::size_t MAX_LOAD_Y = mY.capacity() / 8 * 7;
+
+            mX.reserve(MAX_LOAD_X);
+            mY.reserve(MAX_LOAD_Y);
+
+            const bsl::size_t CAP_X = mX.capacity();
+            const bsl::size_t CAP_Y = mY.capacity();
+
+            bslma::TestAllocatorMonitor tam(&ta);
+
+            for (int i = 0; mX.size() < MAX_LOAD_X; ++i) {
+                mX.insert(-1 - i);
+            }
+            for (int i = 0; mY.size() < MAX_LOAD_Y; ++i) {
+                mY.insert(-1 - i);
+            }
+
+            ASSERTV(LINE, tam.numBlocksTotalChange(), tam.isTotalSame());
+            ASSERTV(LINE, mX.capacity(), CAP_X == mX.capacity());
+            ASSERTV(LINE, mY.capacity(), CAP_Y == mY.capacity());
+            ASSERTV(LINE, verifyInvariants(mX));
+            ASSERTV(LINE, verifyInvariants(mY));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // RANDOMIZED OPERATIONS
+        //
+        // Concerns:
+        //: 1 Arbitrary sequences of insertions and erasures, interleaved with
+        //:   rehashing, leave the table holding exactly the keys inserted and
+        //:   not erased.
+        //:
+        //: 2 Erased slots are reused, and the table does not grow without
+        //:   bound under a workload of constant size.
+        //
+        // Plan:
+        //: 1 Perform pseudo-random insertions and erasures of keys from a
+        //:   small range, with occasional rehashes, on tables with a good
+        //:   hash functor and with the identity hash functor, and compare the
+        //:   table with a 'bsl::set' oracle after each operation.  (C-1)
+        //:
+        //: 2 Verify that the capacity remains bounded.  (C-2)
+        //
+        // Testing:
+        //   RANDOMIZED OPERATIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANDOMIZED OPERATIONS" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        const int NUM_OPS   = 20000;
+        const int KEY_RANGE = 500;
+
+        Obj           mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+        IdentityObj   mY(0, IdentityHash(), bsl::equal_to<int>(), &ta);
+        bsl::set<int> oracle;
+
+        srand(12345);
+        for (int i = 0; i < NUM_OPS; ++i) {
+            const int key = rand() % KEY_RANGE;
+            const int op  = rand() % 100;
+
+            if (op < 50) {
+                const bool inserted = oracle.insert(key).second;
+                ASSERTV(i, key, inserted == mX.insert(key).second);
+                ASSERTV(i, key, inserted == mY.tryEmplace(key).second);
+            }
+            else if (op < 99) {
+                const bsl::size_t erased = oracle.erase(key);
+                ASSERTV(i, key, erased == mX.erase(key));
+                ASSERTV(i, key, erased == mY.erase(key));
+            }
+            else {
+                mX.rehash(0);
+                mY.rehash(mY.capacity());
+            }
+
+            ASSERTV(i, oracle.size() == mX.size());
+            ASSERTV(i, oracle.size() == mY.size());
+
+            const int probe = rand() % KEY_RANGE;
+            const bool present = oracle.count(probe);
+            ASSERTV(i, probe, present == mX.contains(probe));
+            ASSERTV(i, probe, present == mY.contains(probe));
+
+            if (0 == i % 1000) {
+                ASSERTV(i, verifyInvariants(mX));
+                ASSERTV(i, verifyInvariants(mY));
+            }
+        }
+
+        ASSERT(verifyInvariants(mX));
+        ASSERT(verifyInvariants(mY));
+
+        for (bsl::set<int>::const_iterator it = oracle.begin();
+             it != oracle.end();
+             ++it) {
+            ASSERTV(*it, mX.contains(*it));
+            ASSERTV(*it, mY.contains(*it));
+        }
+
+        ASSERTV(mX.capacity(), mX.capacity() <= 2048);
+        ASSERTV(mY.capacity(), mY.capacity() <= 2048);
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an exception is thrown while inserting (including while
+        //:   rehashing), no memory is leaked and the table still holds its
+        //:   previous entries.
+        //:
+        //: 2 If an exception is thrown while copying a table, no memory is
+        //:   leaked.
+        //:
+        //: 3 If an exception is thrown during copy assignment, the target is
+        //:   unchanged.
+        //
+        // Plan:
+        //: 1 Using 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*', insert an
+        //:   allocating key into tables that are and are not at their maximum
+        //:   load, and verify the contents on each exception.  (C-1)
+        //:
+        //: 2 Likewise, copy-construct and copy-assign tables of allocating
+        //:   entries.  (C-2..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tInsertion." << endl;
+
+        for (int n = 0; n <= 30; ++n) {
+            StringObj mX(0,
+                         bslh::Hash<>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            const bsl::string VALUE = makeString(n);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                ASSERTV(n, X.size() == static_cast<bsl::size_t>(n)
+                        || X.size() == static_cast<bsl::size_t>(n + 1));
+
+                mX.insert(VALUE);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(n, static_cast<bsl::size_t>(n + 1) == X.size());
+            for (int i = 0; i <= n; ++i) {
+                ASSERTV(n, i, X.contains(makeString(i)));
+            }
+            ASSERTV(n, verifyInvariants(X));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tCopy construction and assignment." << endl;
+
+        for (int n = 0; n <= 30; n += 5) {
+            StringObj mX(0,
+                         bslh::Hash<>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                StringObj mY(X, &ta);  const StringObj& Y = mY;
+                ASSERTV(n, X == Y);
+                ASSERTV(n, verifyInvariants(Y));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            StringObj mZ(0,
+                         bslh::Hash<>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& Z = mZ;
+            mZ.insert(makeString(1000));
+
+            const StringObj ZZ(Z, &ta);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                ASSERTV(n, ZZ == Z || X == Z);
+
+                mZ = X;
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(n, X == Z);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 The copy constructor creates a table with the same value, hasher,
+        //:   and key-equality comparator, using the supplied allocator, and
+        //:   leaves the original unchanged.
+        //:
+        //: 2 The move constructor transfers the arrays of the original, which
+        //:   is left empty with no capacity; with a different allocator it
+        //:   moves the entries into new arrays.
+        //:
+        //: 3 Copy and move assignment assign the value and functors, and
+        //:   leave the allocator unchanged.
+        //:
+        //: 4 'swap' exchanges values and functors without allocating; the free
+        //:   'swap' also supports tables having different allocators.
+        //:
+        //: 5 'operator==' compares values independently of the order of
+        //:   insertion and of capacity; 'operator!=' is its negation.
+        //:
+        //: 6 Entries that are not bitwise moveable are correctly moved when
+        //:   the table is rehashed.
+        //
+        // Plan:
+        //: 1 For tables of 'int' and 'bsl::string' entries of various sizes,
+        //:   exercise each operation, verifying values, allocator use (with
+        //:   'bslma::TestAllocator' objects), and functors (using a
+        //:   stateful hash functor).  (C-1..6)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable&, Allocator *);
+        //   FlatHashTable(MovableRef<FlatHashTable>);
+        //   FlatHashTable(MovableRef<FlatHashTable>, Allocator *);
+        //   FlatHashTable& operator=(const FlatHashTable&);
+        //   FlatHashTable& operator=(MovableRef<FlatHashTable>);
+        //   void swap(FlatHashTable&);
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   bool operator==(const FlatHashTable&, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable&, const FlatHashTable&);
+        //   void swap(FlatHashTable&, FlatHashTable&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator ta("a", veryVeryVeryVerbose);
+        bslma::TestAllocator tb("b", veryVeryVeryVerbose);
+
+        const int SIZES[]   = { 0, 1, 14, 15, 100 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        if (verbose) cout << "\tEquality." << endl;
+        {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            Obj mY(256, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+
+            const Obj& X = mX;
+            const Obj& Y = mY;
+
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+
+            for (int i = 0; i < 50; ++i) {
+                mX.insert(i);
+                mY.insert(49 - i);
+                ASSERTV(i, (i == 49) == (X == Y));
+            }
+            ASSERT(X.capacity() != Y.capacity());
+            ASSERT(X == Y);
+
+            mY.erase(7);
+            ASSERT(X != Y);
+            mY.insert(50);
+            ASSERT(X != Y);
+        }
+
+        if (verbose) cout << "\tCopy construction." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            StringObj mX(0,
+                         bslh::Hash<>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(makeString(i));
+            }
+
+            bslma::TestAllocatorMonitor tam(&ta);
+
+            StringObj mY(X, &tb);  const StringObj& Y = mY;
+
+            ASSERTV(N, X == Y);
+            ASSERTV(N, &tb == Y.allocator());
+            ASSERTV(N, X.capacity() == Y.capacity());
+            ASSERTV(N, tam.isTotalSame());
+            ASSERTV(N, verifyInvariants(Y));
+            ASSERTV(N, (0 == N) == (0 == tb.numBlocksInUse()));
+
+            // The copy must be independent of the original.
+
+            mX.insert(makeString(1000));
+            ASSERTV(N, X != Y);
+        }
+        ASSERT(0 == tb.numBlocksInUse());
+
+        if (verbose) cout << "\tMove construction." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            StringObj mX(0,
+                         bslh::Hash<>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+            for (int i = 0; i < N; ++i) {
+                mX.insert(makeString(i));
+            }
+            const StringObj W(X, &ta);
+
+            {
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                StringObj mY(MoveUtil::move(mX));  const StringObj& Y = mY;
+
+                ASSERTV(N, W == Y);
+                ASSERTV(N, &ta == Y.allocator());
+                ASSERTV(N, tam.isTotalSame());
+                ASSERTV(N, 0 == X.size());
+                ASSERTV(N, 0 == X.capacity());
+
+                mX.insert(makeString(0));
+                ASSERTV(N, 1 == X.size());
+                mX.reset();
+
+                StringObj mZ(MoveUtil::move(mY), &tb);
+                const StringObj& Z = mZ;
+
+                ASSERTV(N, W == Z);
+                ASSERTV(N, &tb == Z.allocator());
+                ASSERTV(N, verifyInvariants(Z));
+            }
+            ASSERT(0 == tb.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tCopy and move assignment." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int N = SIZES[ti];
+                const int M = SIZES[tj];
+
+                StatefulObj mX(0, StatefulHash(1), bsl::equal_to<int>(), &ta);
+                StatefulObj mY(0, StatefulHash(2), bsl::equal_to<int>(), &tb);
+
+                const StatefulObj& X = mX;
+                const StatefulObj& Y = mY;
+
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(i);
+                }
+                for (int i = 0; i < M; ++i) {
+                    mY.insert(-i);
+                }
+
+                mY = X;
+                ASSERTV(N, M, X == Y);
+                ASSERTV(N, M, &tb == Y.allocator());
+                ASSERTV(N, M, 1 == Y.hash_function().d_seed);
+                ASSERTV(N, M, verifyInvariants(Y));
+
+                StatefulObj mZ(0, StatefulHash(3), bsl::equal_to<int>(), &ta);
+                const StatefulObj& Z = mZ;
+
+                mZ = MoveUtil::move(mX);
+                ASSERTV(N, M, Y == Z);
+                ASSERTV(N, M, 1 == Z.hash_function().d_seed);
+                ASSERTV(N, M, 0 == X.size());
+
+                mY = MoveUtil::move(mZ);
+                ASSERTV(N, M, N == static_cast<int>(Y.size()));
+                ASSERTV(N, M, &tb == Y.allocator());
+                ASSERTV(N, M, verifyInvariants(Y));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+
+        if (verbose) cout << "\tSwap." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int N = SIZES[ti];
+                const int M = SIZES[tj];
+
+                StatefulObj mX(0, StatefulHash(1), bsl::equal_to<int>(), &ta);
+                StatefulObj mY(0, StatefulHash(2), bsl::equal_to<int>(), &ta);
+                StatefulObj mZ(0, StatefulHash(3), bsl::equal_to<int>(), &tb);
+
+                const StatefulObj& X = mX;
+                const StatefulObj& Y = mY;
+                const StatefulObj& Z = mZ;
+
+                for (int i = 0; i < N; ++i) {
+                    mX.insert(i);
+                }
+                for (int i = 0; i < M; ++i) {
+                    mY.insert(-i);
+                }
+
+                const StatefulObj XX(X, &ta);
+                const StatefulObj YY(Y, &ta);
+
+                {
+                    bslma::TestAllocatorMonitor tam(&ta);
+
+                    mX.swap(mY);
+
+                    ASSERTV(N, M, YY == X);
+                    ASSERTV(N, M, XX == Y);
+                    ASSERTV(N, M, 2 == X.hash_function().d_seed);
+                    ASSERTV(N, M, 1 == Y.hash_function().d_seed);
+
+                    swap(mX, mY);
+
+                    ASSERTV(N, M, XX == X);
+                    ASSERTV(N, M, YY == Y);
+                    ASSERTV(N, M, tam.isTotalSame());
+                }
+
+                swap(mX, mZ);
+
+                ASSERTV(N, M, XX == Z);
+                ASSERTV(N, M, 0 == X.size());
+                ASSERTV(N, M, &ta == X.allocator());
+                ASSERTV(N, M, &tb == Z.allocator());
+                ASSERTV(N, M, 3 == X.hash_function().d_seed);
+                ASSERTV(N, M, 1 == Z.hash_function().d_seed);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == tb.numBlocksInUse());
+
+        if (verbose) cout << "\tRehashing non-bitwise-moveable entries."
+                          << endl;
+        {
+            CollidingStringObj mX(0,
+                                  ConstantHash(),
+                                  bsl::equal_to<bsl::string>(),
+                                  &ta);
+            const CollidingStringObj& X = mX;
+
+            for (int i = 0; i < 200; ++i) {
+                mX.insert(makeString(i));
+            }
+            ASSERT(200 == X.size());
+            for (int i = 0; i < 200; ++i) {
+                ASSERTV(i, X.contains(makeString(i)));
+            }
+            ASSERT(verifyInvariants(X));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANAGEMENT
+        //
+        // Concerns:
+        //: 1 The capacity is always 0 or a power of two not less than 16, and
+        //:   the table grows exactly when an insertion would exceed a load
+        //:   factor of 7/8.
+        //:
+        //: 2 'reserve' grows the table so that the requested number of
+        //:   entries can be inserted without rehashing, and never shrinks it.
+        //:
+        //: 3 'rehash' chooses the smallest valid capacity that is not less
+        //:   than its argument and admits the current entries, and can shrink
+        //:   the table.
+        //:
+        //: 4 'clear' retains the capacity; 'reset' releases all memory.
+        //:
+        //: 5 'load_factor' and 'max_load_factor' report the expected values.
+        //
+        // Plan:
+        //: 1 Insert keys one at a time, verifying the capacity after each
+        //:   insertion.  (C-1, 5)
+        //:
+        //: 2 Exercise 'reserve', 'rehash', 'clear', and 'reset' on tables of
+        //:   various sizes, verifying the capacity, the contents, and the
+        //:   memory in use.  (C-2..4)
+        //
+        // Testing:
+        //   void clear();
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        //   void reset();
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CAPACITY MANAGEMENT" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tGrowth." << endl;
+        {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            ASSERT(0    == X.capacity());
+            ASSERT(0.0f == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+
+            bsl::size_t expected = 16;
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i);
+                if (X.size() > expected / 8 * 7) {
+                    expected *= 2;
+                }
+                ASSERTV(i, X.capacity(), expected == X.capacity());
+                ASSERTV(i, X.load_factor() <= X.max_load_factor());
+            }
+            ASSERT(2 == ta.numBlocksInUse());
+            ASSERT(verifyInvariants(X));
+        }
+
+        if (verbose) cout << "\tInitial capacity." << endl;
+        {
+            const struct {
+                int         d_line;
+                bsl::size_t d_requested;
+                bsl::size_t d_expected;
+            } DATA[] = {
+                { L_,    0,    0 },
+                { L_,    1,   16 },
+                { L_,   16,   16 },
+                { L_,   17,   32 },
+                { L_,  100,  128 },
+                { L_, 1024, 1024 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                Obj mX(DATA[ti].d_requested,
+                       bslh::Hash<>(),
+                       bsl::equal_to<int>(),
+                       &ta);
+
+                ASSERTV(LINE, DATA[ti].d_expected == mX.capacity());
+                ASSERTV(LINE, 0 == mX.size());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\t'reserve'." << endl;
+        {
+            for (bsl::size_t n = 0; n < 300; n += 7) {
+                Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+                const Obj& X = mX;
+
+                mX.reserve(n);
+                const bsl::size_t CAPACITY = X.capacity();
+                ASSERTV(n, CAPACITY / 8 * 7 >= n);
+                ASSERTV(n, 0 == n || CAPACITY == 16 || CAPACITY / 16 * 7 < n);
+
+                for (bsl::size_t i = 0; i < n; ++i) {
+                    mX.insert(static_cast<int>(i));
+                }
+                ASSERTV(n, CAPACITY == X.capacity());
+
+                mX.reserve(0);
+                ASSERTV(n, CAPACITY == X.capacity());
+            }
+        }
+
+        if (verbose) cout << "\t'rehash'." << endl;
+        {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+
+            mX.rehash(1);
+            ASSERT(16 == X.capacity());
+
+            mX.rehash(1000);
+            ASSERT(1024 == X.capacity());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+
+            mX.rehash(0);
+            ASSERT(128 == X.capacity());
+            ASSERT(100 == X.size());
+            ASSERT(verifyInvariants(X));
+
+            mX.rehash(64);
+            ASSERT(128 == X.capacity());
+
+            mX.rehash(129);
+            ASSERT(256 == X.capacity());
+            ASSERT(verifyInvariants(X));
+
+            for (int i = 0; i < 100; ++i) {
+                mX.erase(i);
+            }
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tRehashing reclaims erased slots." << endl;
+        {
+            CollidingObj mX(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            const CollidingObj& X = mX;
+
+            for (int i = 0; i < 14; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(16 == X.capacity());
+
+            // Fill the table to its maximum load, so that the first group is
+            // full; erasing from a full group leaves an erased slot.
+
+            mX.insert(14);
+            ASSERT(32 == X.capacity());
+            for (int i = 0; i < 13; ++i) {
+                mX.insert(100 + i);
+            }
+            ASSERT(28 == X.size());
+            ASSERT(32 == X.capacity());
+
+            for (int i = 0; i < 13; ++i) {
+                mX.erase(100 + i);
+            }
+
+            int numErased = 0;
+            for (bsl::size_t i = 0; i < X.capacity(); ++i) {
+                numErased += 0xC0 == X.controls()[i];
+            }
+            ASSERTV(numErased, 0 < numErased);
+
+            mX.rehash(X.capacity());
+
+            numErased = 0;
+            for (bsl::size_t i = 0; i < X.capacity(); ++i) {
+                numErased += 0xC0 == X.controls()[i];
+            }
+            ASSERTV(numErased, 0 == numErased);
+            ASSERT(15 == X.size());
+            ASSERT(verifyInvariants(X));
+        }
+
+        if (verbose) cout << "\t'clear' and 'reset'." << endl;
+        {
+            StringObj mX(0,
+                         bslh::Hash<>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < 50; ++i) {
+                mX.insert(makeString(i));
+            }
+            const bsl::size_t CAPACITY = X.capacity();
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERT(X.empty());
+            ASSERT(CAPACITY == X.capacity());
+            ASSERT(2 == ta.numBlocksInUse());
+            ASSERT(X.begin() == X.end());
+            ASSERT(!X.contains(makeString(3)));
+
+            for (int i = 0; i < 50; ++i) {
+                mX.insert(makeString(i));
+            }
+            ASSERT(CAPACITY == X.capacity());
+
+            mX.reset();
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+
+            mX.reset();
+            ASSERT(0 == X.capacity());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 An empty table, with or without capacity, finds no key.
+        //:
+        //: 2 Inserting a key that is absent adds it; inserting a key that is
+        //:   present has no effect and returns an iterator to the existing
+        //:   entry.
+        //:
+        //: 3 Erasing a key that is present removes it and no other key;
+        //:   erasing an absent key has no effect.
+        //:
+        //: 4 Keys are found even when many keys share a probe sequence and
+        //:   control byte, across several groups, and after other keys in the
+        //:   probe sequence have been erased.
+        //:
+        //: 5 An erased slot is marked 'k_EMPTY' if its group has an empty
+        //:   slot, and 'k_ERASED' otherwise.
+        //:
+        //: 6 Iteration visits each entry exactly once; 'erase' of an iterator
+        //:   returns an iterator to the next entry.
+        //:
+        //: 7 All memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Using tables with a good hash functor and with a constant hash
+        //:   functor, insert and erase keys, verifying the results of each
+        //:   operation and the basic accessors.  (C-1..4, 7)
+        //:
+        //: 2 Inspect the control bytes after erasures.  (C-5)
+        //:
+        //: 3 Iterate over tables of various sizes, and erase all entries
+        //:   through iterators.  (C-6)
+        //
+        // Testing:
+        //   FlatHashTable(size_t, const HASH&, const EQUAL&, Allocator *);
+        //   ~FlatHashTable();
+        //   pair<iterator, iterator> equal_range(const KEY&);
+        //   size_t erase(const KEY&);
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   iterator find(const KEY&);
+        //   pair<iterator, bool> insert(const ENTRY&);
+        //   pair<iterator, bool> insert(MovableRef<ENTRY>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   pair<iterator, bool> tryEmplace(const KEY&);
+        //   iterator begin();
+        //   iterator end();
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   const bsl::uint8_t *controls() const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(const KEY&)
+        //   const_iterator find(const KEY&) const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                        << endl
+                        << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                        << "========================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tEmpty tables." << endl;
+        {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            Obj mY(16, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+
+            const Obj& X = mX;
+            const Obj& Y = mY;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.controls());
+            ASSERT(0 != Y.controls());
+
+            for (int i = -5; i < 5; ++i) {
+                ASSERTV(i, !X.contains(i));
+                ASSERTV(i, !Y.contains(i));
+                ASSERTV(i, 0 == X.count(i));
+                ASSERTV(i, X.end() == X.find(i));
+                ASSERTV(i, Y.end() == Y.find(i));
+                ASSERTV(i, 0 == mX.erase(i));
+                ASSERTV(i, 0 == mY.erase(i));
+            }
+            ASSERT(X.begin()  == X.end());
+            ASSERT(Y.cbegin() == Y.cend());
+            ASSERT(X.empty());
+            ASSERT(Y.empty());
+            ASSERT(0 == X.capacity());
+            ASSERT(16 == Y.capacity());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tInsertion and erasure." << endl;
+        {
+            Obj          mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            CollidingObj mY(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+
+            const Obj&          X = mX;
+            const CollidingObj& Y = mY;
+
+            const int N = 100;
+
+            for (int i = 0; i < N; ++i) {
+                const int KEY = i * 7;
+
+                bsl::pair<Obj::iterator, bool> rx = mX.insert(KEY);
+                bsl::pair<CollidingObj::iterator, bool> ry =
+                                                          mY.tryEmplace(KEY);
+
+                ASSERTV(i, rx.second);
+                ASSERTV(i, ry.second);
+                ASSERTV(i, KEY == *rx.first);
+                ASSERTV(i, KEY == *ry.first);
+
+                rx = mX.tryEmplace(KEY);
+                ry = mY.insert(KEY);
+
+                ASSERTV(i, !rx.second);
+                ASSERTV(i, !ry.second);
+                ASSERTV(i, KEY == *rx.first);
+                ASSERTV(i, KEY == *ry.first);
+                ASSERTV(i, rx.first == mX.find(KEY));
+                ASSERTV(i, ry.first == mY.find(KEY));
+
+                ASSERTV(i, static_cast<bsl::size_t>(i + 1) == X.size());
+                ASSERTV(i, static_cast<bsl::size_t>(i + 1) == Y.size());
+
+                for (int j = 0; j <= i; ++j) {
+                    ASSERTV(i, j, X.contains(j * 7));
+                    ASSERTV(i, j, Y.contains(j * 7));
+                    ASSERTV(i, j, !X.contains(j * 7 + 1));
+                    ASSERTV(i, j, !Y.contains(j * 7 + 1));
+                }
+            }
+            ASSERT(verifyInvariants(X));
+            ASSERT(verifyInvariants(Y));
+
+            // Erase every other key, then every remaining key, verifying that
+            // the keys later in each probe sequence are still found.
+
+            for (int pass = 0; pass < 2; ++pass) {
+                for (int i = pass; i < N; i += 2) {
+                    const int KEY = i * 7;
+
+                    ASSERTV(pass, i, 1 == mX.erase(KEY));
+                    ASSERTV(pass, i, 1 == mY.erase(KEY));
+                    ASSERTV(pass, i, 0 == mX.erase(KEY));
+                    ASSERTV(pass, i, 0 == mY.erase(KEY));
+                    ASSERTV(pass, i, !X.contains(KEY));
+                    ASSERTV(pass, i, !Y.contains(KEY));
+
+                    for (int j = i + 2; j < N; j += 2) {
+                        ASSERTV(pass, i, j, X.contains(j * 7));
+                        ASSERTV(pass, i, j, Y.contains(j * 7));
+                    }
+                }
+                ASSERTV(pass, verifyInvariants(X));
+                ASSERTV(pass, verifyInvariants(Y));
+            }
+            ASSERT(X.empty());
+            ASSERT(Y.empty());
+
+            // Erased slots are reused.
+
+            const bsl::size_t CAPACITY = Y.capacity();
+            for (int i = 0; i < N; ++i) {
+                mY.insert(i);
+            }
+            ASSERT(CAPACITY == Y.capacity());
+            ASSERT(verifyInvariants(Y));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tControl bytes of erased slots." << endl;
+        {
+            CollidingObj mX(32, ConstantHash(), bsl::equal_to<int>(), &ta);
+            const CollidingObj& X = mX;
+
+            // With a constant hash every probe sequence starts at group 0 and
+            // continues with group 1, so keys 0 to 15 fill group 0 and keys
+            // 16 to 27 occupy the first 12 slots of group 1.
+
+            for (int i = 0; i < 28; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(32 == X.capacity());
+
+            for (int i = 0; i < 28; ++i) {
+                ASSERTV(i, 0 == (X.controls()[i] & 0x80));
+            }
+            for (int i = 28; i < 32; ++i) {
+                ASSERTV(i, 0x80 == X.controls()[i]);
+            }
+
+            // Group 1 has an empty slot, so its erased slot becomes empty.
+
+            ASSERT(1 == mX.erase(20));
+            ASSERTV(X.controls()[20], 0x80 == X.controls()[20]);
+
+            // Group 0 is full, so its erased slot must not end the probe
+            // sequences of the keys in group 1.
+
+            ASSERT(1 == mX.erase(5));
+            ASSERTV(X.controls()[5], 0xC0 == X.controls()[5]);
+
+            for (int i = 0; i < 28; ++i) {
+                ASSERTV(i, (i != 5 && i != 20) == X.contains(i));
+            }
+
+            // The first available slot in the probe sequence is reused.
+
+            ASSERT(mX.insert(100).second);
+            ASSERTV(X.controls()[5], 0 == (X.controls()[5] & 0x80));
+            ASSERT(X.contains(100));
+            ASSERT(27 == X.size());
+            ASSERT(verifyInvariants(X));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tIteration." << endl;
+        {
+            for (int n = 0; n < 100; n += 9) {
+                Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+                const Obj& X = mX;
+
+                const int VALUES[] = { 5, 3, 9, 1 };
+                mX.insert(VALUES, VALUES + 4);
+                for (int i = 0; i < n; ++i) {
+                    mX.insert(1000 + i);
+                }
+
+                bsl::set<int> visited;
+                for (Obj::const_iterator it = X.cbegin();
+                     it != X.cend();
+                     ++it) {
+                    ASSERTV(n, *it, visited.insert(*it).second);
+                    ASSERTV(n, *it, X.contains(*it));
+                }
+                ASSERTV(n, X.size() == visited.size());
+
+                bsl::pair<Obj::iterator, Obj::iterator> r =
+                                                         mX.equal_range(9);
+                ASSERTV(n, 9 == *r.first);
+                ASSERTV(n, r.first != r.second);
+                ASSERTV(n, 1 == bsl::distance(r.first, r.second));
+
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> cr =
+                                                          X.equal_range(10);
+                ASSERTV(n, cr.first == cr.second);
+                ASSERTV(n, X.end() == cr.first);
+
+                // Erase through iterators: alternately using 'iterator' and
+                // 'const_iterator', then the whole remaining range.
+
+                Obj::iterator it = mX.begin();
+                for (int i = 0; i < n / 2 && it != mX.end(); ++i) {
+                    const int   KEY  = *it;
+                    const bsl::size_t SIZE = X.size();
+
+                    Obj::iterator next = it;
+                    ++next;
+
+                    it = (i % 2) ? mX.erase(it)
+                                 : mX.erase(Obj::const_iterator(it));
+                    ASSERTV(n, i, next == it);
+                    ASSERTV(n, i, !X.contains(KEY));
+                    ASSERTV(n, i, SIZE - 1 == X.size());
+                }
+
+                it = mX.erase(X.begin(), X.end());
+                ASSERTV(n, X.end() == it);
+                ASSERTV(n, X.empty());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tMoving insertion." << endl;
+        {
+            StringObj mX(0,
+                         bslh::Hash<>(),
+                         bsl::equal_to<bsl::string>(),
+                         &ta);
+            const StringObj& X = mX;
+
+            bsl::string value(makeString(42), &ta);
+            const bsl::string VALUE(value, &ta);
+
+            bslma::TestAllocatorMonitor tam(&ta);
+
+            bsl::pair<StringObj::iterator, bool> r =
+                                 mX.insert(bslmf::MovableRefUtil::move(value));
+            ASSERT(r.second);
+            ASSERT(VALUE == *r.first);
+            ASSERT(X.contains(VALUE));
+
+            // Moving a string with the same allocator does not allocate the
+            // string's buffer; only the table's arrays are allocated.
+
+            ASSERTV(tam.numBlocksTotalChange(),
+                    2 == tam.numBlocksTotalChange());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few keys, and verify the size and
+        //:   capacity of the table.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+        const Obj& X = mX;
+
+        ASSERT(0 == X.size());
+        ASSERT(0 == X.capacity());
+        ASSERT(0 == ta.numBlocksTotal());
+
+        ASSERT(mX.insert(1).second);
+        ASSERT(mX.insert(2).second);
+        ASSERT(!mX.insert(1).second);
+
+        ASSERT(2  == X.size());
+        ASSERT(16 == X.capacity());
+        ASSERT(X.contains(1));
+        ASSERT(X.contains(2));
+        ASSERT(!X.contains(3));
+
+        ASSERT(1 == mX.erase(1));
+        ASSERT(0 == mX.erase(1));
+        ASSERT(1 == X.size());
+        ASSERT(!X.contains(1));
+
+        Obj mY(X, &ta);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.insert(3);
+        ASSERT(X != Y);
+
+        mX.reset();
+        ASSERT(0 == X.capacity());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,259 @@
+// bdlc_flathashtable_groupcontrol.h                                  -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+#define INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of a flat hash table control group.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable_GroupControl: flat hash table group control
+//
+//@SEE_ALSO: bdlc_flathashtable
+//
+//@DESCRIPTION: This component provides a class,
+// 'bdlc::FlatHashTable_GroupControl', that is a value-semantic view of a
+// group of 16 consecutive control bytes of a 'bdlc::FlatHashTable', and
+// provides the means to determine, for all 16 bytes at once, which bytes
+// have a given value and which bytes denote available (i.e., empty or erased)
+// slots.  Each query returns a bit mask in which bit 'i' corresponds to
+// control byte 'i' of the group.
+//
+// A control byte either has its most-significant bit clear, in which case the
+// slot it controls is in use and the remaining seven bits hold a portion of
+// the hash value of the slot's element, or is one of the two special values
+// 'k_EMPTY' and 'k_ERASED', both of which have the most-significant bit set.
+//
+// On platforms supporting SSE2 the queries are each implemented with a
+// handful of 128-bit vector instructions; elsewhere, a portable SWAR ("SIMD
+// within a register") implementation operating on two 64-bit words is used.
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                      // ================================
+                      // class FlatHashTable_GroupControl
+                      // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides a view of a group of 'k_SIZE' control bytes of a
+    // flat hash table, and methods to query, in parallel, the bytes of the
+    // group.
+
+  public:
+    // CONSTANTS
+    static const bsl::uint8_t k_EMPTY  = 0x80;  // slot has never been used
+                                                // since the last rehash
+    static const bsl::uint8_t k_ERASED = 0xC0;  // slot is available, but
+                                                // previously held an element
+
+    enum { k_SIZE = 16 };  // number of control bytes in a group
+
+  private:
+    // DATA
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
+    __m128i             d_value;   // the control bytes
+#else
+    bsls::Types::Uint64 d_first;   // control bytes 0 to 7, byte 0 lowest
+    bsls::Types::Uint64 d_second;  // control bytes 8 to 15, byte 8 lowest
+#endif
+
+    // PRIVATE CLASS METHODS
+#if !defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
+    static bsls::Types::Uint64 load(const bsl::uint8_t *data);
+        // Return the 8 bytes starting at the specified 'data' as a word
+        // having 'data[0]' as its least-significant byte.
+
+    static bsl::uint32_t compress(bsls::Types::Uint64 value);
+        // Return a value whose bit 'i' is the most-significant bit of byte
+        // 'i' of the specified 'value', for 'i' in '[0 .. 8)'.  The behavior
+        // is undefined unless only the most-significant bit of each byte of
+        // 'value' may be set.
+
+    static bsls::Types::Uint64 matchBytes(bsls::Types::Uint64 value,
+                                          bsl::uint8_t        byte);
+        // Return a value having the most-significant bit of each byte set if
+        // the corresponding byte of the specified 'value' equals the
+        // specified 'byte', and all other bits clear.
+#endif
+
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl();
+    FlatHashTable_GroupControl(const FlatHashTable_GroupControl&);
+    FlatHashTable_GroupControl& operator=(const FlatHashTable_GroupControl&);
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const bsl::uint8_t *data);
+        // Create a group control object holding the 'k_SIZE' control bytes
+        // starting at the specified 'data'.  Note that 'data' need not be
+        // aligned.
+
+    // ~FlatHashTable_GroupControl() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    bsl::uint32_t available() const;
+        // Return a bit mask in which bit 'i' is set if control byte 'i' of
+        // this group denotes an available slot (i.e., is 'k_EMPTY' or
+        // 'k_ERASED'), and all other bits are clear.
+
+    bool containsEmpty() const;
+        // Return 'true' if any control byte of this group is 'k_EMPTY', and
+        // 'false' otherwise.
+
+    bsl::uint32_t inUse() const;
+        // Return a bit mask in which bit 'i' is set if control byte 'i' of
+        // this group denotes a slot that is in use, and all other bits are
+        // clear.
+
+    bsl::uint32_t match(bsl::uint8_t value) const;
+        // Return a bit mask in which bit 'i' is set if control byte 'i' of
+        // this group equals the specified 'value', and all other bits are
+        // clear.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class FlatHashTable_GroupControl
+                      // --------------------------------
+
+// PRIVATE CLASS METHODS
+#if !defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
+inline
+bsls::Types::Uint64 FlatHashTable_GroupControl::load(const bsl::uint8_t *data)
+{
+    // Assembling the word byte by byte is endian-neutral; compilers reduce it
+    // to a single load on little-endian platforms.
+
+    bsls::Types::Uint64 value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::compress(bsls::Types::Uint64 value)
+{
+    // Multiplying moves bit '8 * i' of 'value >> 7' to bit '56 + i', with no
+    // carries between the partial products.
+
+    return static_cast<bsl::uint32_t>(((value >> 7) * 0x0102040810204080ULL)
+                                                                       >> 56);
+}
+
+inline
+bsls::Types::Uint64 FlatHashTable_GroupControl::matchBytes(
+                                                 bsls::Types::Uint64 value,
+                                                 bsl::uint8_t        byte)
+{
+    const bsls::Types::Uint64 k_LOW7 = 0x7F7F7F7F7F7F7F7FULL;
+
+    // A byte of 'x' is zero if and only if the corresponding byte of 'value'
+    // equals 'byte'.  Adding 0x7F to the low seven bits of a byte sets its
+    // high bit unless those bits are all zero; this never carries into the
+    // adjacent byte, so (unlike the classic "has zero byte" test) the result
+    // has no false positives.
+
+    const bsls::Types::Uint64 x = value ^ (0x0101010101010101ULL * byte);
+    return ~(((x & k_LOW7) + k_LOW7) | x) & ~k_LOW7;
+}
+#endif
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                    const bsl::uint8_t *data)
+{
+    BSLS_ASSERT_SAFE(data);
+
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
+    d_value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+#else
+    d_first  = load(data);
+    d_second = load(data + 8);
+#endif
+}
+
+// ACCESSORS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::available() const
+{
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
+    return static_cast<bsl::uint32_t>(_mm_movemask_epi8(d_value));
+#else
+    const bsls::Types::Uint64 k_HIGH = 0x8080808080808080ULL;
+
+    return compress(d_first & k_HIGH) | (compress(d_second & k_HIGH) << 8);
+#endif
+}
+
+inline
+bool FlatHashTable_GroupControl::containsEmpty() const
+{
+    return 0 != match(k_EMPTY);
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & 0xFFFFu;
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_USE_SSE2)
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+
+    return static_cast<bsl::uint32_t>(
+                          _mm_movemask_epi8(_mm_cmpeq_epi8(d_value, pattern)));
+#else
+    return compress(matchBytes(d_first, value))
+         | (compress(matchBytes(d_second, value)) << 8);
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,319 @@
+// bdlc_flathashtable_groupcontrol.t.cpp                              -*-C++-*-
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>     // 'atoi', 'rand'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a view of 16 control bytes whose accessors
+// each compute, in parallel, a bit mask over the bytes.  We test the
+// accessors against a byte-at-a-time oracle, first on a table of interesting
+// byte patterns, then on pseudo-random groups, loaded from both aligned and
+// unaligned addresses.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit FlatHashTable_GroupControl(const bsl::uint8_t *data);
+//
+// ACCESSORS
+// [ 2] bsl::uint32_t available() const;
+// [ 2] bool containsEmpty() const;
+// [ 2] bsl::uint32_t inUse() const;
+// [ 2] bsl::uint32_t match(bsl::uint8_t value) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlc::FlatHashTable_GroupControl Obj;
+
+const bsl::uint8_t EMPTY  = Obj::k_EMPTY;
+const bsl::uint8_t ERASED = Obj::k_ERASED;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::uint32_t oracleMatch(const bsl::uint8_t *data, bsl::uint8_t value)
+    // Return the mask of the bytes of the 16 bytes at the specified 'data'
+    // that equal the specified 'value', computed one byte at a time.
+{
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < Obj::k_SIZE; ++i) {
+        if (data[i] == value) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+bsl::uint32_t oracleAvailable(const bsl::uint8_t *data)
+    // Return the mask of the bytes of the 16 bytes at the specified 'data'
+    // that are 'k_EMPTY' or 'k_ERASED', computed one byte at a time.
+{
+    return oracleMatch(data, EMPTY) | oracleMatch(data, ERASED);
+}
+
+void verifyGroup(const bsl::uint8_t *data, int line)
+    // Verify each accessor of a group control created from the 16 bytes at
+    // the specified 'data' against the oracles, reporting failures at the
+    // specified 'line'.  The behavior is undefined unless each byte is either
+    // 'k_EMPTY', 'k_ERASED', or less than 0x80.
+{
+    const Obj X(data);
+
+    const bsl::uint32_t AVAILABLE = oracleAvailable(data);
+
+    ASSERTV(line, AVAILABLE, X.available(), AVAILABLE == X.available());
+    ASSERTV(line, (~AVAILABLE & 0xFFFF) == X.inUse());
+    ASSERTV(line, (0 != oracleMatch(data, EMPTY)) == X.containsEmpty());
+
+    for (int v = 0; v < 256; ++v) {
+        const bsl::uint8_t VALUE = static_cast<bsl::uint8_t>(v);
+        ASSERTV(line, v, oracleMatch(data, VALUE) == X.match(VALUE));
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATOR AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The creator loads the 16 bytes at the supplied address, which
+        //:   need not be aligned.
+        //:
+        //: 2 'match' reports exactly the bytes equal to its argument, for
+        //:   every possible argument value, with no false positives from
+        //:   neighboring bytes.
+        //:
+        //: 3 'available' reports exactly the 'k_EMPTY' and 'k_ERASED' bytes,
+        //:   and 'inUse' exactly the others.
+        //:
+        //: 4 'containsEmpty' is 'true' if and only if a byte is 'k_EMPTY'.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the accessors, against
+        //:   byte-at-a-time oracles, for groups chosen to exercise boundary
+        //:   values (e.g., bytes adjacent to matching bytes, values differing
+        //:   from the target in only the high bit).  (C-2..4)
+        //:
+        //: 2 Repeat for pseudo-random groups placed at every offset within a
+        //:   larger buffer.  (C-1..4)
+        //
+        // Testing:
+        //   explicit FlatHashTable_GroupControl(const bsl::uint8_t *data);
+        //   bsl::uint32_t available() const;
+        //   bool containsEmpty() const;
+        //   bsl::uint32_t inUse() const;
+        //   bsl::uint32_t match(bsl::uint8_t value) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATOR AND ACCESSORS" << endl
+                          << "=====================" << endl;
+
+        const bsl::uint8_t E = EMPTY;
+        const bsl::uint8_t R = ERASED;
+
+        static const struct {
+            int          d_line;
+            bsl::uint8_t d_bytes[16];
+        } DATA[] = {
+            { L_, { E, E, E, E, E, E, E, E, E, E, E, E, E, E, E, E } },
+            { L_, { R, R, R, R, R, R, R, R, R, R, R, R, R, R, R, R } },
+            { L_, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } },
+            { L_, { 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+                    0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F } },
+            { L_, { E, 0, E, 0, E, 0, E, 0, E, 0, E, 0, E, 0, E, 0 } },
+            { L_, { 0, R, 1, E, 2, R, 3, E, 4, R, 5, E, 6, R, 7, E } },
+            { L_, { 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 1 } },
+            { L_, { 0x40, 0x41, 0x3F, 0x40, 0x00, 0x7F, 0x40, 0x01,
+                    R,    E,    0x40, 0x40, 0x40, 0x40, 0x40, 0x40 } },
+            { L_, { R, R, R, R, R, R, R, R, R, R, R, R, R, R, R, E } },
+            { L_, { E, R, R, R, R, R, R, R, R, R, R, R, R, R, R, R } },
+            { L_, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 } },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        if (verbose) cout << "\nTable-driven groups." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            verifyGroup(DATA[ti].d_bytes, DATA[ti].d_line);
+        }
+
+        if (verbose) cout << "\nPseudo-random, unaligned groups." << endl;
+
+        bsl::uint8_t buffer[Obj::k_SIZE * 3];
+
+        bsl::srand(12345);
+        for (int iteration = 0; iteration < 500; ++iteration) {
+            for (int i = 0; i < static_cast<int>(sizeof buffer); ++i) {
+                const int r = bsl::rand() % 8;
+                buffer[i] = 0 == r ? E
+                          : 1 == r ? R
+                          : static_cast<bsl::uint8_t>(bsl::rand() % 4 * 31);
+            }
+            for (int offset = 0; offset <= Obj::k_SIZE * 2; ++offset) {
+                verifyGroup(buffer + offset, iteration);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a group control from a small set of bytes and verify the
+        //:   values returned by each accessor.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ASSERT(16 == Obj::k_SIZE);
+        ASSERT(0 != (EMPTY  & 0x80));
+        ASSERT(0 != (ERASED & 0x80));
+        ASSERT(EMPTY != ERASED);
+
+        bsl::uint8_t bytes[Obj::k_SIZE];
+        bsl::memset(bytes, EMPTY, sizeof bytes);
+
+        bytes[0]  = 5;
+        bytes[3]  = 5;
+        bytes[7]  = ERASED;
+        bytes[15] = 0x7F;
+
+        const Obj X(bytes);
+
+        ASSERTV(X.match(5),    0x0009u == X.match(5));
+        ASSERTV(X.match(0x7F), 0x8000u == X.match(0x7F));
+        ASSERTV(X.match(0),    0u      == X.match(0));
+        ASSERTV(X.inUse(),     0x8009u == X.inUse());
+        ASSERTV(X.available(), 0x7FF6u == X.available());
+        ASSERT(X.containsEmpty());
+
+        bsl::memset(bytes, ERASED, sizeof bytes);
+        ASSERT(!Obj(bytes).containsEmpty());
+        ASSERT(0xFFFFu == Obj(bytes).available());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
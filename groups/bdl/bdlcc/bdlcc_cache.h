@@ -27,11 +27,15 @@ BSLS_IDENT("$Id: $")
 // fixed maximum size is obtained by setting the high and low watermarks to the
 // same value.
 //
-// Two eviction policies are supported: LRU (Least Recently Used) and FIFO
-// (First In, First Out).  With LRU, the item that has *not* been accessed for
-// the longest period of time will be evicted first.  With FIFO, the eviction
-// order is based on the order of insertion, with the earliest inserted item
-// being evicted first.
+// Three eviction policies are supported: LRU (Least Recently Used), FIFO
+// (First In, First Out), and CLOCK.  With LRU, the item that has *not* been
+// accessed for the longest period of time will be evicted first.  With FIFO,
+// the eviction order is based on the order of insertion, with the earliest
+// inserted item being evicted first.  CLOCK (also known as "second chance")
+// approximates LRU: an access merely marks the item as referenced, and when
+// an item is due for eviction, a referenced item is instead moved to the back
+// of the eviction queue, with its mark cleared, and the next item is
+// considered.
 //
 ///Thread Safety
 ///-------------
@@ -49,10 +53,12 @@ BSLS_IDENT("$Id: $")
 // All of the modifier methods of the cache potentially requires a write lock.
 // Of particular note is the 'tryGetValue' method, which requires a writer lock
 // only if the eviction queue needs to be modified.  This means 'tryGetValue'
-// requires only a read lock if the eviction policy is set to FIFO or the
-// argument 'modifyEvictionQueue' is set to 'false'.  For limited cases where
-// contention is likely, temporarily setting 'modifyEvictionQueue' to 'false'
-// might be of value.
+// requires only a read lock if the eviction policy is set to FIFO or CLOCK, or
+// the argument 'modifyEvictionQueue' is set to 'false'.  For limited cases
+// where contention is likely, temporarily setting 'modifyEvictionQueue' to
+// 'false' might be of value.  Where contention on the single lock of the cache
+// is a concern, 'bdlcc::StripedCache' partitions the items among independently
+// locked stripes.
 //
 // The 'visit' method acquires a read lock and calls the supplied visitor
 // function for every item in the cache, or until the visitor function returns
@@ -88,7 +94,8 @@ BSLS_IDENT("$Id: $")
 // +----------------------------------------------------+--------------------+
 // | tryGetValue                                        | O[1]               |
 // +----------------------------------------------------+--------------------+
-// | popFront                                           | O[1]               |
+// | popFront                                           | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
 // +----------------------------------------------------+--------------------+
 // | erase                                              | O[1]               |
 // +----------------------------------------------------+--------------------+
@@ -308,6 +315,7 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_review.h>
 
 #include <bsl_memory.h>
@@ -329,11 +337,46 @@ struct CacheEvictionPolicy {
     enum Enum {
         // Enumeration of supported cache eviction policies.
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,   // Least Recently Used
+        e_FIFO,  // First In, First Out
+        e_CLOCK  // CLOCK (second chance)
     };
 };
 
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+struct Cache_MapValue {
+    // This 'struct' holds the mapped value of an item of a cache: a pointer to
+    // the value of the item, the position of its key in the eviction queue,
+    // and, for the CLOCK eviction policy, whether the item was referenced
+    // since it was last considered for eviction.
+
+    // DATA
+    VALUE_PTR                d_valuePtr;    // value of the item
+    QUEUE_ITERATOR           d_queueIt;     // position in the eviction queue
+    mutable bsls::AtomicBool d_referenced;  // 'true' if referenced since last
+                                            // considered for eviction
+
+    // CREATORS
+    Cache_MapValue(const VALUE_PTR& valuePtr, QUEUE_ITERATOR queueIt);
+    Cache_MapValue(bslmf::MovableRef<VALUE_PTR> valuePtr,
+                   QUEUE_ITERATOR               queueIt);
+        // Create a mapped value holding the specified 'valuePtr' and
+        // 'queueIt', and marked as not referenced.
+
+    Cache_MapValue(const Cache_MapValue& original);
+    Cache_MapValue(bslmf::MovableRef<Cache_MapValue> original);
+        // Create a mapped value having the value of the specified 'original'
+        // object.
+
+    //! ~Cache_MapValue() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    Cache_MapValue& operator=(const Cache_MapValue& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+};
+
 template <class KEY>
 class Cache_QueueProctor {
     // This class implements a proctor that, on destruction, restores the queue
@@ -398,7 +441,8 @@ class Cache {
     typedef bsl::list<KEY>                                        QueueType;
         // Eviction queue type.
 
-    typedef bsl::pair<ValuePtrType, typename QueueType::iterator> MapValue;
+    typedef Cache_MapValue<ValuePtrType, typename QueueType::iterator>
+                                                                  MapValue;
         // Value type of the hash map.
 
     typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL>        MapType;
@@ -451,6 +495,12 @@ class Cache {
         // Evict the item at the specified 'mapIt' and invoke the post-eviction
         // callback for that item.
 
+    typename MapType::iterator findVictim();
+        // Return an iterator to the item to evict next.  If the eviction
+        // policy is CLOCK, first move each referenced item at the front of the
+        // eviction queue to the back of the queue and clear its mark.  The
+        // behavior is undefined unless this cache is not empty.
+
     bool insertValuePtrMoveImp(KEY          *key_p,
                                bool          moveKey,
                                ValuePtrType *valuePtr_p,
@@ -577,7 +627,10 @@ class Cache {
     int popFront();
         // Remove the item at the front of the eviction queue.  Invoke the
         // post-eviction callback for the removed item.  Return 0 on success,
-        // and 1 if this cache is empty.
+        // and 1 if this cache is empty.  Note that, if the eviction policy is
+        // CLOCK, referenced items at the front of the queue are first given a
+        // second chance, and the item removed is the one that would be evicted
+        // next.
 
     void setPostEvictionCallback(
                              const PostEvictionCallback& postEvictionCallback);
@@ -591,7 +644,8 @@ class Cache {
         // Load, into the specified 'value', the value associated with the
         // specified 'key' in this cache.  If the optionally specified
         // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
-        // move the cached item to the back of the eviction queue.  Return 0 on
+        // move the cached item to the back of the eviction queue, and if it
+        // is CLOCK, then mark the cached item as referenced.  Return 0 on
         // success, and 1 if 'key' does not exist in this cache.  Note that a
         // write lock is acquired only if this queue is modified.
 
@@ -704,6 +758,68 @@ void Cache_QueueProctor<KEY>::release()
     d_queue_p = 0;
 }
 
+                          // --------------------
+                          // class Cache_MapValue
+                          // --------------------
+
+// CREATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                                const VALUE_PTR& valuePtr,
+                                                QUEUE_ITERATOR   queueIt)
+: d_valuePtr(valuePtr)
+, d_queueIt(queueIt)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                  bslmf::MovableRef<VALUE_PTR> valuePtr,
+                                  QUEUE_ITERATOR               queueIt)
+: d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+, d_queueIt(queueIt)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                                const Cache_MapValue& original)
+: d_valuePtr(original.d_valuePtr)
+, d_queueIt(original.d_queueIt)
+, d_referenced(original.d_referenced.loadRelaxed())
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                  bslmf::MovableRef<Cache_MapValue> original)
+: d_valuePtr(bslmf::MovableRefUtil::move(
+                      bslmf::MovableRefUtil::access(original).d_valuePtr))
+, d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+, d_referenced(
+          bslmf::MovableRefUtil::access(original).d_referenced.loadRelaxed())
+{
+}
+
+// MANIPULATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>&
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::operator=(
+                                                     const Cache_MapValue& rhs)
+{
+    d_valuePtr = rhs.d_valuePtr;
+    d_queueIt  = rhs.d_queueIt;
+    d_referenced.storeRelaxed(rhs.d_referenced.loadRelaxed());
+    return *this;
+}
+
                         // -----------
                         // class Cache
                         // -----------
@@ -770,9 +886,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 
     while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(findVictim());
     }
 }
 
@@ -780,15 +894,40 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
 {
-    ValuePtrType value = mapIt->second.first;
+    ValuePtrType value = mapIt->second.d_valuePtr;
 
-    d_queue.erase(mapIt->second.second);
+    d_queue.erase(mapIt->second.d_queueIt);
     d_map.erase(mapIt);
 
     if (d_postEvictionCallback) {
         d_postEvictionCallback(value);
     }
 }
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::findVictim()
+{
+    BSLS_ASSERT(!d_queue.empty());
+
+    while (true) {
+        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        // Give a referenced item a second chance.  Since each item passed
+        // over is unmarked, this loop ends after at most one pass over the
+        // queue.
+
+        if (CacheEvictionPolicy::e_CLOCK != d_evictionPolicy
+         || !mapIt->second.d_referenced.loadRelaxed()) {
+            return mapIt;                                             // RETURN
+        }
+
+        mapIt->second.d_referenced.storeRelaxed(false);
+        d_queue.splice(d_queue.end(), d_queue, d_queue.begin());
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
@@ -811,13 +950,13 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt != d_map.end()) {
         if (k_RVALUE_ASSIGN && moveValuePtr) {
-            mapIt->second.first = bslmf::MovableRefUtil::move(valuePtr);
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
         }
         else {
-            mapIt->second.first = valuePtr;
+            mapIt->second.d_valuePtr = valuePtr;
         }
 
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
 
         // Move 'queueIt' to the back of 'd_queue'.
 
@@ -836,13 +975,10 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
 
         if (moveValuePtr) {
             new (mapValue_p) MapValue(bslmf::MovableRefUtil::move(valuePtr),
-                                      queueIt,
-                                      d_allocator_p);
+                                      queueIt);
         }
         else {
-            new (mapValue_p) MapValue(valuePtr,
-                                      queueIt,
-                                      d_allocator_p);
+            new (mapValue_p) MapValue(valuePtr, queueIt);
         }
         bslma::DestructorGuard<MapValue> mapValueGuard(mapValue_p);
 
@@ -1072,9 +1208,7 @@ int Cache<KEY, VALUE, HASH, EQUAL>::popFront()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
 
     if (d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(findVictim());
         return 0;                                                     // RETURN
     }
 
@@ -1115,10 +1249,16 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
         return 1;                                                     // RETURN
     }
 
-    *value = mapIt->second.first;
+    *value = mapIt->second.d_valuePtr;
+
+    if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy
+     && modifyEvictionQueue
+     && !mapIt->second.d_referenced.loadRelaxed()) {
+        mapIt->second.d_referenced.storeRelaxed(true);
+    }
 
     if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
         typename QueueType::iterator last = d_queue.end();
         --last;
         if (last != queueIt) {
@@ -1186,7 +1326,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
         const KEY&                             key = *queueIt;
         const typename MapType::const_iterator mapIt = d_map.find(key);
         BSLS_ASSERT(mapIt != d_map.end());
-        const ValuePtrType& valuePtr = mapIt->second.first;
+        const ValuePtrType& valuePtr = mapIt->second.d_valuePtr;
 
         if (!visitor(key, *valuePtr)) {
             break;
@@ -35,6 +35,7 @@
 #include <bsls_timeutil.h>  // 'CachePerformance'
 #include <bsls_types.h>     // 'BloombergLP::bsls::Types::Int64'
 
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_vector.h>
 #include <bsl_string.h>
@@ -128,7 +129,9 @@ using namespace bsl;
 // [15] THREAD SAFETY
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
-// [18] USAGE EXAMPLE
+// [18] REPRODUCE DRQS 134930805
+// [19] CLOCK EVICTION POLICY
+// [20] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
@@ -212,6 +215,37 @@ bool     veryVeryVerbose;
 bool veryVeryVeryVerbose;
 
 
+// ============================================================================
+//                         CASE 19 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace clockTest {
+
+typedef bdlcc::Cache<int, int> IntCache;
+
+struct KeyVisitor {
+    // Visitor appending the keys of the visited items to a vector.
+
+    bsl::vector<int> *d_keys_p;
+
+    bool operator()(int key, int) const
+    {
+        d_keys_p->push_back(key);
+        return true;
+    }
+};
+
+void keysOf(bsl::vector<int> *result, const IntCache& cache)
+    // Load into the specified 'result' the keys of the specified 'cache' in
+    // the order of its eviction queue.
+{
+    result->clear();
+    KeyVisitor visitor = { result };
+    cache.visit(visitor);
+}
+
+}  // close namespace clockTest
+
 namespace usageExample1 {
 
 void myPostEvictionCallback(bsl::shared_ptr<bsl::string> value)
@@ -4163,7 +4197,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4185,6 +4219,106 @@ int main(int argc, char *argv[])
         usageExample2::example2();
       } break;
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
+      case 19: {
+        // --------------------------------------------------------------------
+        // CLOCK EVICTION POLICY
+        //
+        // Concerns:
+        //: 1 With the CLOCK policy, 'tryGetValue' does not modify the order
+        //:   of the eviction queue, and marks the item only if
+        //:   'modifyEvictionQueue' is 'true'.
+        //:
+        //: 2 When an item is due for eviction, a marked item at the front of
+        //:   the queue is moved to the back of the queue, unmarked, and the
+        //:   next item is considered instead, both by 'popFront' and by the
+        //:   eviction triggered by 'insert'.
+        //:
+        //: 3 If every item is marked, the oldest item is evicted after a full
+        //:   pass over the queue.
+        //
+        // Plan:
+        //: 1 Insert items into a cache using the CLOCK policy, access some of
+        //:   them, and verify the order of the queue, and the items evicted
+        //:   by 'popFront' and 'insert', using a visitor and a post-eviction
+        //:   callback.  (C-1..3)
+        //
+        // Testing:
+        //   CLOCK EVICTION POLICY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLOCK EVICTION POLICY" << endl
+                          << "=====================" << endl;
+
+        typedef clockTest::IntCache IntCache;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            IntCache mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 4, 5, &ta);
+            const IntCache& X = mX;
+
+            ASSERT(bdlcc::CacheEvictionPolicy::e_CLOCK == X.evictionPolicy());
+
+            for (int i = 0; i < 5; ++i) {
+                mX.insert(i, i);
+            }
+
+            bsl::shared_ptr<int> value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+            ASSERT(0 == mX.tryGetValue(&value, 3, false));
+
+            bsl::vector<int> keys(&ta);
+            clockTest::keysOf(&keys, X);
+            const int EXP1[] = { 0, 1, 2, 3, 4 };
+            ASSERT(bsl::equal(keys.begin(), keys.end(), EXP1));
+
+            // '0' is marked, so '1' is popped, and '0' moves to the back.
+
+            ASSERT(0 == mX.popFront());
+            clockTest::keysOf(&keys, X);
+            const int EXP2[] = { 2, 3, 4, 0 };
+            ASSERTV(keys.size(), 4 == keys.size());
+            ASSERT(bsl::equal(keys.begin(), keys.end(), EXP2));
+
+            // Reach the high watermark, then trigger an eviction down to 3
+            // items: '2' is marked and moves to the back, '3' was not marked
+            // and is evicted, and so is '4'.
+
+            mX.insert(5, 5);
+            mX.insert(6, 6);
+            clockTest::keysOf(&keys, X);
+            const int EXP3[] = { 0, 5, 2, 6 };
+            ASSERTV(keys.size(), 4 == keys.size());
+            ASSERT(bsl::equal(keys.begin(), keys.end(), EXP3));
+        }
+
+        {
+            IntCache mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 3, 3, &ta);
+            const IntCache& X = mX;
+
+            for (int i = 0; i < 3; ++i) {
+                mX.insert(i, i);
+            }
+
+            bsl::shared_ptr<int> value;
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i));
+            }
+
+            // Every item is marked: after a full pass, all are unmarked and
+            // the oldest item is evicted.
+
+            mX.insert(3, 3);
+            bsl::vector<int> keys(&ta);
+            clockTest::keysOf(&keys, X);
+            const int EXP[] = { 1, 2, 3 };
+            ASSERTV(keys.size(), 3 == keys.size());
+            ASSERT(bsl::equal(keys.begin(), keys.end(), EXP));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // REPRODUCE DRQS 134930805
@@ -4273,7 +4407,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to insert.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: if F, use FIFO for eviction policy, if C, use
+        //   CLOCK; LRU othrwise.
         //
         // Concerns:
         //: 1 Calculates wall time, user time, and system time for inserting
@@ -4295,6 +4430,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 4 && argv[4][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 4 && argv[4][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         cacheperf::CachePerformance cp("testInsert1", evictionPolicy,
@@ -4312,7 +4449,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to insert.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: if F, use FIFO for eviction policy, if C, use
+        //   CLOCK; LRU othrwise.
         //   5th parameter: number of batches to divide the number of rows
         //   into.
         //
@@ -4336,6 +4474,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 4 && argv[4][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 4 && argv[4][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         int numBatches = argc > 5 ? atoi(argv[5]) : 1;
@@ -4357,7 +4497,8 @@ int main(int argc, char *argv[])
         //   control over the test, command line parameters are used.
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to read.
-        //   4th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   4th parameter: if F, use FIFO for eviction policy, if C, use
+        //   CLOCK; LRU othrwise.
         //   5th parameter: sparsity of values loaded.  Sparsity is the
         //   distance between consecutive values inserted, and represents how
         //   likely is a read to find the key given. A value of 1 means
@@ -4387,6 +4528,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 4 && argv[4][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 4 && argv[4][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         int sparsity = argc > 5 ? atoi(argv[5]) : 1;
@@ -4417,7 +4560,8 @@ int main(int argc, char *argv[])
         //   2nd parameter: number of threads.
         //   3rd parameter: number of rows to read.
         //   4th parameter: number of writer threads.
-        //   5th parameter: if F, use FIFO for eviction policy; LRU othrwise.
+        //   5th parameter: if F, use FIFO for eviction policy, if C, use
+        //   CLOCK; LRU othrwise.
         //   6th parameter: sparsity of values loaded.  Sparsity is the
         //   distance between consecutive values inserted, and represents how
         //   likely is a read to find the key given. A value of 1 means
@@ -4450,6 +4594,8 @@ int main(int argc, char *argv[])
         bdlcc::CacheEvictionPolicy::Enum  evictionPolicy =
             (argc > 5 && argv[5][0] == 'F' ?
             bdlcc::CacheEvictionPolicy::e_FIFO :
+            argc > 5 && argv[5][0] == 'C' ?
+            bdlcc::CacheEvictionPolicy::e_CLOCK :
             bdlcc::CacheEvictionPolicy::e_LRU);
 
         int sparsity = argc > 6 ? atoi(argv[6]) : 1;
@@ -0,0 +1,205 @@
+// bdlcc_stringinternpool.cpp                                         -*-C++-*-
+#include <bdlcc_stringinternpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_stringinternpool_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_alignment.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+
+#include <bsl_cstring.h>
+
+#include <new>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+namespace {
+namespace u {
+
+bsl::size_t powerCeil(bsl::size_t num)
+    // Return the smallest power of 2 that is not less than the specified
+    // 'num', or 1 if 'num' is 0.
+{
+    bsl::size_t power = 1;
+    while (power < num) {
+        power <<= 1;
+    }
+    return power;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                       // -----------------------------
+                       // class StringInternPool_Stripe
+                       // -----------------------------
+
+// CREATORS
+StringInternPool_Stripe::StringInternPool_Stripe(
+                                              bslma::Allocator *basicAllocator)
+: d_rwlock()
+, d_arena(bsls::Alignment::BSLS_BYTEALIGNED, basicAllocator)
+, d_strings(basicAllocator)
+{
+}
+
+// MANIPULATORS
+bslstl::StringRef StringInternPool_Stripe::intern(
+                                              const bslstl::StringRef& string)
+{
+    {
+        bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwlock);
+
+        SetType::const_iterator it = d_strings.find(string);
+        if (d_strings.end() != it) {
+            return *it;                                               // RETURN
+        }
+    }
+
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwlock);
+
+    // Another thread may have interned the same value after the read lock was
+    // released, so look again.
+
+    SetType::const_iterator it = d_strings.find(string);
+    if (d_strings.end() != it) {
+        return *it;                                                   // RETURN
+    }
+
+    // If the insertion below throws, the copy is not reclaimed until the
+    // stripe is destroyed, which is harmless.
+
+    const bsl::size_t  length = string.length();
+    char              *copy   = static_cast<char *>(
+                                                d_arena.allocate(length + 1));
+    if (length) {
+        bsl::memcpy(copy, string.data(), length);
+    }
+    copy[length] = '\0';
+
+    const bslstl::StringRef handle(copy, length);
+    d_strings.insert(handle);
+
+    return handle;
+}
+
+// ACCESSORS
+int StringInternPool_Stripe::find(bslstl::StringRef        *result,
+                                  const bslstl::StringRef&  string) const
+{
+    BSLS_ASSERT(result);
+
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwlock);
+
+    SetType::const_iterator it = d_strings.find(string);
+    if (d_strings.end() == it) {
+        return 1;                                                     // RETURN
+    }
+
+    *result = *it;
+    return 0;
+}
+
+bsl::size_t StringInternPool_Stripe::size() const
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_rwlock);
+
+    return d_strings.size();
+}
+
+                           // ----------------------
+                           // class StringInternPool
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+void StringInternPool::createStripes(bsl::size_t numStripes)
+{
+    BSLS_ASSERT(1 <= numStripes);
+
+    d_numStripes = u::powerCeil(numStripes);
+    d_stripeMask = d_numStripes - 1;
+
+    // Allocate the array of 'Stripe' objects, and construct them.
+
+    d_stripes_p = static_cast<Stripe *>(
+                      d_allocator_p->allocate(d_numStripes * sizeof(Stripe)));
+
+    bsl::size_t i = 0;
+    BSLS_TRY {
+        for (; i < d_numStripes; ++i) {
+            new (&d_stripes_p[i]) Stripe(d_allocator_p);
+        }
+    }
+    BSLS_CATCH(...) {
+        while (i > 0) {
+            bslma::DestructionUtil::destroy(&d_stripes_p[--i]);
+        }
+        d_allocator_p->deallocate(d_stripes_p);
+        BSLS_RETHROW;
+    }
+}
+
+// CREATORS
+StringInternPool::StringInternPool(bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_stripes_p(0)
+, d_numStripes(0)
+, d_stripeMask(0)
+{
+    createStripes(k_DEFAULT_NUM_STRIPES);
+}
+
+StringInternPool::StringInternPool(bsl::size_t       numStripes,
+                                   bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_stripes_p(0)
+, d_numStripes(0)
+, d_stripeMask(0)
+{
+    createStripes(numStripes);
+}
+
+StringInternPool::~StringInternPool()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        bslma::DestructionUtil::destroy(&d_stripes_p[i]);
+    }
+    d_allocator_p->deallocate(d_stripes_p);
+}
+
+// ACCESSORS
+bsl::size_t StringInternPool::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        result += d_stripes_p[i].size();
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
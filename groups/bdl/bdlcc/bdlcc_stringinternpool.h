@@ -0,0 +1,414 @@
+// bdlcc_stringinternpool.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLCC_STRINGINTERNPOOL
+#define INCLUDED_BDLCC_STRINGINTERNPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe pool of interned strings.
+//
+//@CLASSES:
+//  bdlcc::StringInternPool: thread-safe, lock-striped string interning pool
+//  bdlcc::StringInternPool::HandleHash: hash functor for handles
+//  bdlcc::StringInternPool::HandleEqualTo: equality functor for handles
+//
+//@SEE_ALSO: bdlcc_stripedcache, bslstl_stringref
+//
+//@DESCRIPTION: This component defines a mechanism, 'bdlcc::StringInternPool',
+// that maintains a single, stable copy of each distinct string value that is
+// *interned* into it.  Interning a string returns a 'bslstl::StringRef',
+// referred to as a *handle*, to the copy of that value held by the pool.  The
+// characters referred to by a handle remain valid, and unchanged, for the
+// lifetime of the pool, and are followed by a null character, so that
+// 'handle.data()' may also be used as a null-terminated string.
+//
+// Interning the same value any number of times, from any number of threads,
+// always yields handles referring to the same address.  Consequently, two
+// handles obtained from the same pool have the same value if and only if
+// their 'data()' addresses are equal, and an interned string can be hashed
+// and compared in constant time, regardless of its length.  The nested
+// functor types 'HandleHash' and 'HandleEqualTo' provide exactly these
+// operations, and are intended to be used as the hash and equality functors
+// of unordered containers keyed by handles.  Note that the usual value-based
+// comparison operators of 'bslstl::StringRef' also work for handles (and
+// give the same results), but their cost is proportional to the length of the
+// strings.
+//
+// A pool is most effective when a moderate number of distinct values are seen
+// repeatedly, such as ticker symbols, venue codes, or field names decoded from
+// incoming messages: each distinct value is copied (and allocated) only once,
+// after which interning it costs one hash computation and one lookup, and
+// every subsequent use of the handle as a key is allocation-free.
+//
+// Strings are never removed from a pool.  The memory of the interned strings
+// is supplied by an arena per stripe (see below) and is released only when
+// the pool is destroyed.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::StringInternPool' is fully thread-safe, meaning that all non-creator
+// operations on an object can be safely invoked simultaneously from multiple
+// threads.  Handles may be freely shared among threads.
+//
+// The interned strings are partitioned among a fixed number of *stripes*,
+// specified at construction (rounded up to a power of 2), by hashing their
+// values.  Each stripe is protected by its own reader-writer lock.  Interning
+// a value that is already in the pool, and 'find', acquire only the read lock
+// of the stripe of the value; interning a new value acquires the write lock of
+// that stripe.  'size' visits the stripes one at a time, and is therefore not
+// atomic with respect to concurrent interning.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Counting Quotes per Venue
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that we process a stream of quotes, each carrying the code of the
+// venue on which it was published, and that we want to count the quotes per
+// venue without allocating a key for each quote.
+//
+// First, we create a pool, and a map keyed by interned venue codes that uses
+// the hash and equality functors provided by the pool:
+//..
+//  typedef bdlcc::StringInternPool Pool;
+//
+//  Pool pool(&talloc);
+//
+//  bsl::unordered_map<bslstl::StringRef,
+//                     int,
+//                     Pool::HandleHash,
+//                     Pool::HandleEqualTo> quotesPerVenue(&talloc);
+//..
+// Then, we intern the venue code of each quote, which might, for example, be
+// decoded into a reused buffer, and count it.  Only the first occurrence of
+// each venue code is copied:
+//..
+//  const char *const QUOTES[] = { "XNYS", "XNAS", "XNYS", "BATS", "XNYS" };
+//
+//  char buffer[16];
+//  for (int i = 0; i < 5; ++i) {
+//      bsl::strcpy(buffer, QUOTES[i]);
+//      ++quotesPerVenue[pool.intern(buffer)];
+//  }
+//  assert(3 == pool.size());
+//  assert(3 == quotesPerVenue.size());
+//..
+// Next, we observe that interning an equal value yields the same address:
+//..
+//  const bslstl::StringRef nyse = pool.intern("XNYS");
+//  assert(nyse.data() == pool.intern(bsl::string("XNYS")).data());
+//  assert(3 == quotesPerVenue[nyse]);
+//..
+// Finally, we use 'find' to look up a value without adding it to the pool:
+//..
+//  bslstl::StringRef handle;
+//  assert(0    == pool.find(&handle, "XNAS"));
+//  assert(1    == quotesPerVenue[handle]);
+//  assert(0    != pool.find(&handle, "XLON"));
+//  assert(3    == pool.size());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_readerwritermutex.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>            // 'bsl::size_t'
+#include <bsl_unordered_set.h>
+
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                       // =============================
+                       // class StringInternPool_Stripe
+                       // =============================
+
+class StringInternPool_Stripe {
+    // This class implements one stripe of a 'StringInternPool': a set of
+    // interned strings, the arena supplying their memory, and the
+    // reader-writer lock protecting both.
+
+    // PRIVATE TYPES
+    typedef bsl::unordered_set<bslstl::StringRef, bslh::Hash<> > SetType;
+
+    // DATA
+    mutable bslmt::ReaderWriterMutex d_rwlock;  // protects 'd_strings' and
+                                                // 'd_arena'
+
+    bdlma::SequentialAllocator       d_arena;   // supplies the memory of the
+                                                // interned strings
+
+    SetType                          d_strings; // interned strings
+
+  private:
+    // NOT IMPLEMENTED
+    StringInternPool_Stripe(const StringInternPool_Stripe&);
+    StringInternPool_Stripe& operator=(const StringInternPool_Stripe&);
+
+  public:
+    // CREATORS
+    explicit StringInternPool_Stripe(bslma::Allocator *basicAllocator);
+        // Create an empty stripe, using the specified 'basicAllocator' to
+        // supply memory.
+
+    //! ~StringInternPool_Stripe() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    bslstl::StringRef intern(const bslstl::StringRef& string);
+        // Return a handle to the copy, held by this stripe, of the value of
+        // the specified 'string', adding a copy if there is none.
+
+    // ACCESSORS
+    int find(bslstl::StringRef        *result,
+             const bslstl::StringRef&  string) const;
+        // Load into the specified 'result' the handle to the copy, held by
+        // this stripe, of the value of the specified 'string'.  Return 0 on
+        // success, and a non-zero value, with no effect on 'result', if this
+        // stripe does not hold that value.
+
+    bsl::size_t size() const;
+        // Return the number of strings held by this stripe.
+};
+
+                           // ======================
+                           // class StringInternPool
+                           // ======================
+
+class StringInternPool {
+    // This class provides a thread-safe pool of interned strings, partitioned
+    // among independently locked stripes.  Interning a value returns a
+    // handle, referring to the single copy of that value held by the pool,
+    // that remains valid for the lifetime of the pool.
+
+  public:
+    // PUBLIC TYPES
+    struct HandleHash {
+        // This 'struct' provides a hash functor for handles returned by a
+        // 'StringInternPool', that hashes the address, rather than the value,
+        // of a handle.  The behavior is undefined unless the hashed handles
+        // were obtained from the same pool.
+
+        // ACCESSORS
+        bsl::size_t operator()(const bslstl::StringRef& handle) const;
+            // Return a hash value for the specified 'handle' computed from
+            // 'handle.data()'.
+    };
+
+    struct HandleEqualTo {
+        // This 'struct' provides an equality functor for handles returned by
+        // a 'StringInternPool', that compares the addresses, rather than the
+        // values, of handles.  The behavior is undefined unless the compared
+        // handles were obtained from the same pool.
+
+        // ACCESSORS
+        bool operator()(const bslstl::StringRef& lhs,
+                        const bslstl::StringRef& rhs) const;
+            // Return 'true' if the specified 'lhs' and 'rhs' handles refer to
+            // the same address, and 'false' otherwise.
+    };
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_STRIPES = 16  // default number of stripes
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef StringInternPool_Stripe Stripe;
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    Stripe           *d_stripes_p;    // array of stripes (owned)
+
+    bsl::size_t       d_numStripes;   // number of stripes, a power of 2
+
+    bsl::size_t       d_stripeMask;   // 'd_numStripes - 1'
+
+    // PRIVATE MANIPULATORS
+    void createStripes(bsl::size_t numStripes);
+        // Allocate and construct the stripes of this pool, whose number is the
+        // specified 'numStripes' rounded up to a power of 2.
+
+    // PRIVATE ACCESSORS
+    Stripe& stripe(const bslstl::StringRef& string) const;
+        // Return a reference to the stripe holding the value of the specified
+        // 'string'.
+
+  private:
+    // NOT IMPLEMENTED
+    StringInternPool(const StringInternPool&);
+    StringInternPool& operator=(const StringInternPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StringInternPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit StringInternPool(bslma::Allocator *basicAllocator = 0);
+    explicit StringInternPool(bsl::size_t       numStripes,
+                              bslma::Allocator *basicAllocator = 0);
+        // Create an empty string intern pool.  Optionally specify
+        // 'numStripes', the number of independently locked stripes among
+        // which the interned strings are partitioned, which is rounded up to a
+        // power of 2.  If 'numStripes' is not specified,
+        // 'k_DEFAULT_NUM_STRIPES' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < numStripes'.
+
+    ~StringInternPool();
+        // Destroy this object, and release the memory of all the strings
+        // interned into it.  The behavior is undefined if a handle obtained
+        // from this pool is used after this object is destroyed.
+
+    // MANIPULATORS
+    bslstl::StringRef intern(const bslstl::StringRef& string);
+        // Return a handle to the copy, held by this pool, of the value of the
+        // specified 'string', first adding a copy of that value to this pool
+        // if it is not already present.  The characters of the returned handle
+        // are followed by a null character and remain valid for the lifetime
+        // of this pool.  Every call to this method with an equal value, from
+        // any thread, returns a handle having the same 'data()' address.
+
+    // ACCESSORS
+    int find(bslstl::StringRef        *result,
+             const bslstl::StringRef&  string) const;
+        // Load into the specified 'result' the handle to the copy, held by
+        // this pool, of the value of the specified 'string'.  Return 0 on
+        // success, and a non-zero value, with no effect on 'result', if that
+        // value is not in this pool.
+
+    bsl::size_t numStripes() const;
+        // Return the number of stripes of this pool.
+
+    bsl::size_t size() const;
+        // Return the number of distinct strings interned into this pool.  Note
+        // that the value returned may be out of date if other threads are
+        // interning strings concurrently.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                    // -----------------------------------
+                    // struct StringInternPool::HandleHash
+                    // -----------------------------------
+
+// ACCESSORS
+inline
+bsl::size_t StringInternPool::HandleHash::operator()(
+                                      const bslstl::StringRef& handle) const
+{
+    // Interned strings are byte-aligned and packed in arenas, so that their
+    // addresses are well spread in the low bits, but not in the high bits.
+    // Fold the high bits into the low bits for the benefit of hash tables
+    // using the low bits only.
+
+    const bsls::Types::Uint64 address = reinterpret_cast<bsls::Types::UintPtr>(
+                                                                handle.data());
+    const bsls::Types::Uint64 product = address * 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<bsl::size_t>(product ^ (product >> 32));
+}
+
+                   // --------------------------------------
+                   // struct StringInternPool::HandleEqualTo
+                   // --------------------------------------
+
+// ACCESSORS
+inline
+bool StringInternPool::HandleEqualTo::operator()(
+                                       const bslstl::StringRef& lhs,
+                                       const bslstl::StringRef& rhs) const
+{
+    return lhs.data() == rhs.data();
+}
+
+                           // ----------------------
+                           // class StringInternPool
+                           // ----------------------
+
+// PRIVATE ACCESSORS
+inline
+StringInternPool::Stripe&
+StringInternPool::stripe(const bslstl::StringRef& string) const
+{
+    const bsl::size_t hash = bslh::Hash<>()(string);
+
+    // Use the high bits of the hash to select the stripe, since the hash
+    // table of each stripe uses the low bits.
+
+    return d_stripes_p[(hash >> (sizeof(hash) * 4)) & d_stripeMask];
+}
+
+// MANIPULATORS
+inline
+bslstl::StringRef StringInternPool::intern(const bslstl::StringRef& string)
+{
+    return stripe(string).intern(string);
+}
+
+// ACCESSORS
+inline
+int StringInternPool::find(bslstl::StringRef        *result,
+                           const bslstl::StringRef&  string) const
+{
+    return stripe(string).find(result, string);
+}
+
+inline
+bsl::size_t StringInternPool::numStripes() const
+{
+    return d_numStripes;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *StringInternPool::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,917 @@
+// bdlcc_stringinternpool.t.cpp                                       -*-C++-*-
+
+#include <bdlcc_stringinternpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>      // 'sprintf'
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'strcpy', 'strlen'
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::StringInternPool',
+// that holds one copy of each distinct string value interned into it, and
+// returns handles to those copies.  It is not a value-semantic type.
+//
+// The primary concern is that interning equal values always yields the same
+// address, that interning distinct values yields distinct addresses, and that
+// the characters referred to by a handle are an exact, null-terminated copy
+// of the interned value that is independent of the source of that value.  We
+// also verify that the strings are distributed among the stripes, that all
+// memory comes from the allocator supplied at construction, and that these
+// guarantees hold when many threads intern overlapping sets of values
+// concurrently.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StringInternPool(bslma::Allocator *basicAllocator = 0);
+// [ 2] StringInternPool(bsl::size_t numStripes, bslma::Allocator *ba = 0);
+// [ 2] ~StringInternPool();
+//
+// MANIPULATORS
+// [ 3] bslstl::StringRef intern(const bslstl::StringRef& string);
+//
+// ACCESSORS
+// [ 3] int find(bslstl::StringRef *result, const StringRef& string) const;
+// [ 2] bsl::size_t numStripes() const;
+// [ 3] bsl::size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// NESTED TYPES
+// [ 4] bsl::size_t HandleHash::operator()(const StringRef& handle) const;
+// [ 4] bool HandleEqualTo::operator()(const StringRef&, const StringRef&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] THREAD SAFETY
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: interned vs. 'bsl::string' keys
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+
+typedef bdlcc::StringInternPool Obj;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::string makeKey(int index)
+    // Return a 24-character key, having the specified 'index' embedded in it,
+    // resembling a field name.
+{
+    char buffer[32];
+    bsl::sprintf(buffer, "field_name_%06d_suffix", index);
+    return buffer;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          CASE 5 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace threaded {
+
+enum { k_NUM_KEYS = 2000, k_NUM_ITERATIONS = 20000 };
+
+struct Worker {
+    // Thread function interning keys in a random order, recording the handle
+    // of each key.
+
+    Obj                             *d_pool_p;
+    const bsl::vector<bsl::string>  *d_keys_p;
+    bsl::vector<bslstl::StringRef>  *d_handles_p;
+    bslmt::Barrier                  *d_barrier_p;
+    int                              d_seed;
+
+    void operator()() const
+    {
+        unsigned int seed = d_seed;
+        d_barrier_p->wait();
+
+        for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+            seed = seed * 1103515245 + 12345;
+            const int key = static_cast<int>((seed >> 8) % k_NUM_KEYS);
+
+            // Copy the key to a local buffer, so that the value interned does
+            // not share an address with the value interned by other threads.
+
+            char buffer[32];
+            bsl::strcpy(buffer, (*d_keys_p)[key].c_str());
+
+            const bslstl::StringRef handle = d_pool_p->intern(buffer);
+
+            ASSERTV(key, (*d_keys_p)[key] == handle);
+
+            bslstl::StringRef& recorded = (*d_handles_p)[key];
+            if (0 == recorded.data()) {
+                recorded = handle;
+            }
+            ASSERTV(key, recorded.data() == handle.data());
+        }
+    }
+};
+
+}  // close namespace threaded
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample1 {
+
+bslma::TestAllocator talloc("ue1", veryVeryVeryVerbose);
+
+void example1()
+{
+///Example 1: Counting Quotes per Venue
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that we process a stream of quotes, each carrying the code of the
+// venue on which it was published, and that we want to count the quotes per
+// venue without allocating a key for each quote.
+//
+// First, we create a pool, and a map keyed by interned venue codes that uses
+// the hash and equality functors provided by the pool:
+//..
+    typedef bdlcc::StringInternPool Pool;
+
+    Pool pool(&talloc);
+
+    bsl::unordered_map<bslstl::StringRef,
+                       int,
+                       Pool::HandleHash,
+                       Pool::HandleEqualTo> quotesPerVenue(&talloc);
+//..
+// Then, we intern the venue code of each quote, which might, for example, be
+// decoded into a reused buffer, and count it.  Only the first occurrence of
+// each venue code is copied:
+//..
+    const char *const QUOTES[] = { "XNYS", "XNAS", "XNYS", "BATS", "XNYS" };
+
+    char buffer[16];
+    for (int i = 0; i < 5; ++i) {
+        bsl::strcpy(buffer, QUOTES[i]);
+        ++quotesPerVenue[pool.intern(buffer)];
+    }
+    ASSERT(3 == pool.size());
+    ASSERT(3 == quotesPerVenue.size());
+//..
+// Next, we observe that interning an equal value yields the same address:
+//..
+    const bslstl::StringRef nyse = pool.intern("XNYS");
+    ASSERT(nyse.data() == pool.intern(bsl::string("XNYS")).data());
+    ASSERT(3 == quotesPerVenue[nyse]);
+//..
+// Finally, we use 'find' to look up a value without adding it to the pool:
+//..
+    bslstl::StringRef handle;
+    ASSERT(0    == pool.find(&handle, "XNAS"));
+    ASSERT(1    == quotesPerVenue[handle]);
+    ASSERT(0    != pool.find(&handle, "XLON"));
+    ASSERT(3    == pool.size());
+//..
+}
+
+}  // close namespace usageExample1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usageExample1::example1();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'intern' with equal values, from different
+        //:   threads, return the same address, and calls with distinct values
+        //:   return distinct addresses.
+        //:
+        //: 2 Concurrent calls to 'intern' do not corrupt the pool.
+        //
+        // Plan:
+        //: 1 Run several threads interning random keys from a common set, each
+        //:   recording the first handle it obtains for a key, and verifying
+        //:   that subsequent handles for that key have the same address.
+        //:   Afterwards, verify that the handles recorded by all threads for a
+        //:   given key are the same, that the handles of distinct keys are
+        //:   distinct, and that 'size' and 'find' agree with the keys
+        //:   interned.  (C-1..2)
+        //
+        // Testing:
+        //   THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD SAFETY" << endl
+                          << "=============" << endl;
+
+        const int NUM_THREADS = 6;
+
+        bslma::TestAllocator ta("test",    veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> keys(&sa);
+        for (int i = 0; i < threaded::k_NUM_KEYS; ++i) {
+            keys.push_back(makeKey(i));
+        }
+
+        const int NUM_STRIPES[] = { 1, 4, 16 };
+
+        for (int ts = 0; ts < 3; ++ts) {
+            {
+                Obj mX(NUM_STRIPES[ts], &ta);  const Obj& X = mX;
+
+                bsl::vector<bsl::vector<bslstl::StringRef> > handles(&sa);
+                handles.resize(NUM_THREADS);
+
+                bslmt::Barrier     barrier(NUM_THREADS);
+                bslmt::ThreadGroup threads;
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    handles[i].resize(threaded::k_NUM_KEYS);
+
+                    threaded::Worker worker = { &mX,
+                                                &keys,
+                                                &handles[i],
+                                                &barrier,
+                                                i * 7919 + 1 };
+                    threads.addThread(worker);
+                }
+                threads.joinAll();
+
+                bsl::size_t numInterned = 0;
+                for (int k = 0; k < threaded::k_NUM_KEYS; ++k) {
+                    bslstl::StringRef handle;
+                    for (int i = 0; i < NUM_THREADS; ++i) {
+                        const bslstl::StringRef& h = handles[i][k];
+                        if (0 == h.data()) {
+                            continue;
+                        }
+                        if (0 == handle.data()) {
+                            handle = h;
+                        }
+                        ASSERTV(ts, k, i, handle.data() == h.data());
+                    }
+
+                    bslstl::StringRef found;
+                    if (0 != handle.data()) {
+                        ++numInterned;
+                        ASSERTV(ts, k, 0 == X.find(&found, keys[k]));
+                        ASSERTV(ts, k, handle.data() == found.data());
+                    }
+                    else {
+                        ASSERTV(ts, k, 0 != X.find(&found, keys[k]));
+                    }
+                }
+                ASSERTV(ts, X.size(), numInterned == X.size());
+
+                // Distinct keys have distinct handles.
+
+                bsl::unordered_map<bslstl::StringRef,
+                                   int,
+                                   Obj::HandleHash,
+                                   Obj::HandleEqualTo> byAddress(&sa);
+                for (int k = 0; k < threaded::k_NUM_KEYS; ++k) {
+                    bslstl::StringRef found;
+                    if (0 == X.find(&found, keys[k])) {
+                        ASSERTV(ts, k, byAddress.insert(
+                                       bsl::make_pair(found, k)).second);
+                    }
+                }
+            }
+            ASSERTV(ts, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // HANDLE FUNCTORS
+        //
+        // Concerns:
+        //: 1 'HandleEqualTo' returns 'true' if and only if two handles refer
+        //:   to the same address, regardless of their values.
+        //:
+        //: 2 'HandleHash' returns the same value for handles referring to the
+        //:   same address, and different values for the handles of distinct
+        //:   interned strings (with high probability).
+        //:
+        //: 3 'HandleHash' spreads the handles of a pool across the buckets of
+        //:   a hash table.
+        //
+        // Plan:
+        //: 1 Compare handles obtained by interning equal and distinct values,
+        //:   and, to show that the values are not inspected, a 'StringRef'
+        //:   referring to a different address having the same value as a
+        //:   handle.  (C-1)
+        //:
+        //: 2 Intern many keys, and verify that the hash values of their
+        //:   handles are distinct, and that they are well spread modulo
+        //:   small powers of 2.  (C-2..3)
+        //
+        // Testing:
+        //   bsl::size_t HandleHash::operator()(const StringRef&) const;
+        //   bool HandleEqualTo::operator()(const StringRef&, const StringRef&)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HANDLE FUNCTORS" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator ta("test",    veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const Obj::HandleHash    hash    = Obj::HandleHash();
+        const Obj::HandleEqualTo equalTo = Obj::HandleEqualTo();
+
+        Obj mX(&ta);
+
+        const bslstl::StringRef A1 = mX.intern("alpha");
+        const bslstl::StringRef A2 = mX.intern(bsl::string("alpha"));
+        const bslstl::StringRef B  = mX.intern("beta");
+
+        const char              ALPHA[] = "alpha";
+        const bslstl::StringRef COPY(ALPHA);
+
+        ASSERT( equalTo(A1, A2));
+        ASSERT(!equalTo(A1, B));
+        ASSERT(!equalTo(A1, COPY));
+        ASSERT(A1 == COPY);
+
+        ASSERT(hash(A1) == hash(A2));
+        ASSERT(hash(A1) != hash(B));
+
+        if (verbose) cout << "\tVerify the spread of hash values." << endl;
+
+        const int NUM_KEYS = 4096;
+
+        bsl::vector<bsl::size_t> hashes(&sa);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            hashes.push_back(hash(mX.intern(makeKey(i))));
+        }
+
+        bsl::vector<bsl::size_t> sorted(hashes, &sa);
+        bsl::sort(sorted.begin(), sorted.end());
+        ASSERT(sorted.end() == bsl::adjacent_find(sorted.begin(),
+                                                  sorted.end()));
+
+        const int NUM_BUCKETS = 64;
+        int       counts[NUM_BUCKETS] = { 0 };
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            ++counts[hashes[i] % NUM_BUCKETS];
+        }
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            ASSERTV(i, counts[i], counts[i] > NUM_KEYS / NUM_BUCKETS / 2);
+            ASSERTV(i, counts[i], counts[i] < NUM_KEYS / NUM_BUCKETS * 2);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'intern', 'find', AND 'size'
+        //
+        // Concerns:
+        //: 1 'intern' returns a handle having the value of its argument, whose
+        //:   characters are followed by a null character.
+        //:
+        //: 2 'intern' returns the same address for equal values, regardless of
+        //:   the address of the argument, and distinct addresses for distinct
+        //:   values, including values differing only in length or having
+        //:   embedded null characters.
+        //:
+        //: 3 The characters of a handle are a copy, and are not affected by
+        //:   subsequent modification of the source of the interned value.
+        //:
+        //: 4 'find' loads the handle of an interned value, and returns a
+        //:   non-zero value, without modifying its 'result' argument or the
+        //:   pool, for a value that was not interned.
+        //:
+        //: 5 'size' returns the number of distinct values interned.
+        //:
+        //: 6 Interning a value that is already present does not allocate.
+        //:
+        //: 7 The empty string can be interned.
+        //
+        // Plan:
+        //: 1 For each of a set of values, with pools having 1 and 4 stripes,
+        //:   intern a copy of the value, held in a modifiable buffer, verify
+        //:   the handle, then overwrite the buffer and intern the value again
+        //:   from a different copy.  Verify the handles and 'size', and that
+        //:   the second call did not allocate.  (C-1..3, 5..7)
+        //:
+        //: 2 Verify 'find' for every value before and after it is interned.
+        //:   (C-4)
+        //
+        // Testing:
+        //   bslstl::StringRef intern(const bslstl::StringRef& string);
+        //   int find(bslstl::StringRef *result, const StringRef& str) const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'intern', 'find', AND 'size'" << endl
+                          << "============================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_value_p;
+            int         d_length;
+        } DATA[] = {
+            //LINE  VALUE                                         LENGTH
+            //----  --------------------------------------------  ------
+            { L_,   "",                                                0 },
+            { L_,   "A",                                               1 },
+            { L_,   "AB",                                              2 },
+            { L_,   "ABC",                                             3 },
+            { L_,   "AB\0C",                                           4 },
+            { L_,   "AB\0D",                                           4 },
+            { L_,   "\0",                                              1 },
+            { L_,   "IBM US Equity",                                  13 },
+            { L_,   "bid_price_venue_primary_exchange_code",          37 },
+            { L_,   "bid_price_venue_primary_exchange_code_and_more", 46 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int numStripes = 1; numStripes <= 4; numStripes *= 4) {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::TestAllocator         ta("test",    veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            {
+                Obj mX(numStripes, &ta);  const Obj& X = mX;
+
+                bslstl::StringRef handles[NUM_DATA];
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int   LINE   = DATA[ti].d_line;
+                    const char *VALUE  = DATA[ti].d_value_p;
+                    const int   LENGTH = DATA[ti].d_length;
+
+                    const bslstl::StringRef EXP(VALUE, LENGTH);
+
+                    bslstl::StringRef found("unchanged");
+                    ASSERTV(LINE, 0 != X.find(&found, EXP));
+                    ASSERTV(LINE, "unchanged" == found);
+                    ASSERTV(LINE, ti == static_cast<int>(X.size()));
+
+                    char buffer[64];
+                    bsl::memcpy(buffer, VALUE, LENGTH);
+
+                    const bslstl::StringRef H1 = mX.intern(
+                                           bslstl::StringRef(buffer, LENGTH));
+
+                    ASSERTV(LINE, EXP == H1);
+                    ASSERTV(LINE, buffer != H1.data());
+                    ASSERTV(LINE, '\0' == H1.data()[LENGTH]);
+                    ASSERTV(LINE, ti + 1 == static_cast<int>(X.size()));
+
+                    bsl::memset(buffer, 'x', sizeof buffer);
+                    ASSERTV(LINE, EXP == H1);
+
+                    const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+                    const bslstl::StringRef H2 = mX.intern(EXP);
+
+                    ASSERTV(LINE, H1.data()   == H2.data());
+                    ASSERTV(LINE, H1.length() == H2.length());
+                    ASSERTV(LINE, NUM_BLOCKS  == ta.numBlocksTotal());
+                    ASSERTV(LINE, ti + 1 == static_cast<int>(X.size()));
+
+                    ASSERTV(LINE, 0 == X.find(&found, EXP));
+                    ASSERTV(LINE, H1.data() == found.data());
+
+                    handles[ti] = H1;
+                }
+
+                // All the handles are still valid and distinct.
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int               LINE = DATA[ti].d_line;
+                    const bslstl::StringRef EXP(DATA[ti].d_value_p,
+                                                DATA[ti].d_length);
+
+                    ASSERTV(LINE, EXP == handles[ti]);
+                    ASSERTV(LINE,
+                            handles[ti].data() == mX.intern(EXP).data());
+
+                    for (int tj = 0; tj < ti; ++tj) {
+                        ASSERTV(LINE, tj,
+                                handles[ti].data() != handles[tj].data());
+                    }
+                }
+                ASSERTV(NUM_DATA == static_cast<int>(X.size()));
+            }
+            ASSERTV(numStripes, 0 == ta.numBlocksInUse());
+            ASSERTV(numStripes, 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed pool is empty and has
+        //:   'k_DEFAULT_NUM_STRIPES' stripes.
+        //:
+        //: 2 The number of stripes supplied at construction is rounded up to
+        //:   a power of 2.
+        //:
+        //: 3 The allocator supplied at construction, or the default allocator
+        //:   if none is supplied, is used to supply all memory, and all of it
+        //:   is released on destruction.
+        //:
+        //: 4 Strings are distributed among the stripes, so that the pool does
+        //:   not allocate more than a few blocks per stripe for many small
+        //:   strings.
+        //
+        // Plan:
+        //: 1 Create pools with and without an allocator, and with various
+        //:   numbers of stripes, and verify 'numStripes', 'size', and
+        //:   'allocator'.  Intern strings and verify the allocators used.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   explicit StringInternPool(bslma::Allocator *basicAllocator = 0);
+        //   StringInternPool(bsl::size_t numStripes, bslma::Allocator *ba);
+        //   ~StringInternPool();
+        //   bsl::size_t numStripes() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         ta("test",    veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&da == X.allocator());
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+            ASSERT(0 == X.size());
+
+            mX.intern("abc");
+            ASSERT(1 == X.size());
+            ASSERT(0 <  da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_numStripes;
+            bsl::size_t d_expected;
+        } DATA[] = {
+            //LINE  NUM STRIPES  EXPECTED
+            //----  -----------  --------
+            { L_,             1,        1 },
+            { L_,             2,        2 },
+            { L_,             3,        4 },
+            { L_,             4,        4 },
+            { L_,             5,        8 },
+            { L_,            16,       16 },
+            { L_,            17,       32 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int NUM_STRINGS = 1000;
+
+        bslma::TestAllocator     sa("scratch", veryVeryVeryVerbose);
+        bsl::vector<bsl::string> keys(&sa);
+        for (int i = 0; i < NUM_STRINGS; ++i) {
+            keys.push_back(makeKey(i));
+        }
+
+        const bsls::Types::Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE        = DATA[ti].d_line;
+            const bsl::size_t NUM_STRIPES = DATA[ti].d_numStripes;
+            const bsl::size_t EXPECTED    = DATA[ti].d_expected;
+
+            {
+                Obj mX(NUM_STRIPES, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, &ta == X.allocator());
+                ASSERTV(LINE, X.numStripes(), EXPECTED == X.numStripes());
+                ASSERTV(LINE, 0 == X.size());
+
+                for (int i = 0; i < NUM_STRINGS; ++i) {
+                    mX.intern(keys[i]);
+                }
+                ASSERTV(LINE, NUM_STRINGS == static_cast<int>(X.size()));
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+        ASSERT(NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, intern and find strings.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(4 == X.numStripes());
+            ASSERT(0 == X.size());
+
+            const bslstl::StringRef A = mX.intern("IBM");
+            const bslstl::StringRef B = mX.intern("AAPL");
+            ASSERT(2 == X.size());
+            ASSERT("IBM" == A);
+            ASSERT(0 == bsl::strcmp("AAPL", B.data()));
+
+            ASSERT(A.data() == mX.intern(bsl::string("IBM")).data());
+            ASSERT(2 == X.size());
+
+            bslstl::StringRef handle;
+            ASSERT(0 == X.find(&handle, "AAPL"));
+            ASSERT(B.data() == handle.data());
+            ASSERT(0 != X.find(&handle, "MSFT"));
+            ASSERT(2 == X.size());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: interned vs. 'bsl::string' keys
+        //   Compare the time taken to count occurrences of keys, received in
+        //   a reused buffer, in a hash map keyed by 'bsl::string', and in a
+        //   hash map keyed by interned handles.  Command line parameters:
+        //   2nd parameter: number of distinct keys (default 1000).
+        //   3rd parameter: number of lookups (default 2000000).
+        //
+        // Concerns:
+        //: 1 Interning a key and using the handle as a key of a hash map
+        //:   using 'HandleHash' and 'HandleEqualTo' is cheaper than creating a
+        //:   'bsl::string' key (which allocates for keys longer than the short
+        //:   string buffer) and hashing and comparing its characters.
+        //
+        // Plan:
+        //: 1 Time both approaches for 24-character keys.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: interned vs. 'bsl::string' keys
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: interned vs. 'bsl::string' keys"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        const int numKeys    = argc > 2 ? atoi(argv[2]) : 1000;
+        const int numLookups = argc > 3 ? atoi(argv[3]) : 2000000;
+
+        cout << "keys: " << numKeys << ", lookups: " << numLookups << endl;
+
+        bsl::vector<bsl::string> keys;
+        for (int i = 0; i < numKeys; ++i) {
+            keys.push_back(makeKey(i) + "_long_enough_to_spill");
+        }
+
+        bsl::vector<int> order;
+        unsigned int     seed = 1;
+        for (int i = 0; i < numLookups; ++i) {
+            seed = seed * 1103515245 + 12345;
+            order.push_back(static_cast<int>((seed >> 8) % numKeys));
+        }
+
+        char buffer[64];
+
+        bsl::unordered_map<bsl::string, int> byString;
+        bsls::Stopwatch                      stopwatch;
+        stopwatch.start(true);
+        for (int i = 0; i < numLookups; ++i) {
+            bsl::strcpy(buffer, keys[order[i]].c_str());
+            ++byString[bsl::string(buffer)];
+        }
+        stopwatch.stop();
+        const double stringTime = stopwatch.accumulatedUserTime();
+
+        Obj                                  pool;
+        bsl::unordered_map<bslstl::StringRef,
+                           int,
+                           Obj::HandleHash,
+                           Obj::HandleEqualTo> byHandle;
+        stopwatch.reset();
+        stopwatch.start(true);
+        for (int i = 0; i < numLookups; ++i) {
+            bsl::strcpy(buffer, keys[order[i]].c_str());
+            ++byHandle[pool.intern(buffer)];
+        }
+        stopwatch.stop();
+        const double handleTime = stopwatch.accumulatedUserTime();
+
+        stopwatch.reset();
+        stopwatch.start(true);
+        for (int i = 0; i < numLookups; ++i) {
+            ++byHandle[pool.intern(keys[order[i]])];
+        }
+        stopwatch.stop();
+        const double reinternTime = stopwatch.accumulatedUserTime();
+
+        // Lookups with the handles only, as would be done after interning the
+        // key once at the edge of the system.
+
+        bsl::vector<bslstl::StringRef> handles;
+        for (int i = 0; i < numKeys; ++i) {
+            handles.push_back(pool.intern(keys[i]));
+        }
+
+        stopwatch.reset();
+        stopwatch.start(true);
+        for (int i = 0; i < numLookups; ++i) {
+            ++byHandle[handles[order[i]]];
+        }
+        stopwatch.stop();
+        const double handleOnlyTime = stopwatch.accumulatedUserTime();
+
+        stopwatch.reset();
+        stopwatch.start(true);
+        for (int i = 0; i < numLookups; ++i) {
+            ++byString[keys[order[i]]];
+        }
+        stopwatch.stop();
+        const double stringOnlyTime = stopwatch.accumulatedUserTime();
+
+        cout << "string key, from buffer:   "
+             << stringTime / numLookups * 1e9 << " ns" << endl
+             << "interned key, from buffer: "
+             << handleTime / numLookups * 1e9 << " ns" << endl
+             << "interned key, re-intern:   "
+             << reinternTime / numLookups * 1e9 << " ns" << endl
+             << "string key, existing:      "
+             << stringOnlyTime / numLookups * 1e9 << " ns" << endl
+             << "interned key, existing:    "
+             << handleOnlyTime / numLookups * 1e9 << " ns" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1512 @@
+// bdlcc_stripedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_STRIPEDCACHE
+#define INCLUDED_BDLCC_STRIPEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-striped in-process cache with cost-based eviction.
+//
+//@CLASSES:
+//  bdlcc::StripedCache: in-process key-value cache partitioned into stripes
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::StripedCache', implementing a thread-safe in-memory key-value cache
+// that partitions its items among a fixed number of independently locked
+// *stripes*.  The interface of 'bdlcc::StripedCache' closely follows that of
+// 'bdlcc::Cache', and the same eviction policies
+// ('bdlcc::CacheEvictionPolicy') are supported.
+//
+// 'bdlcc::Cache' protects all of its items with a single reader-writer lock,
+// so that concurrent writers, and, with the LRU eviction policy, concurrent
+// readers that find the requested item, serialize on that lock.
+// 'bdlcc::StripedCache' instead assigns each item to one of its stripes by
+// hashing its key, and each stripe holds its own lock, hash map, and eviction
+// queue.  Operations on keys belonging to different stripes therefore do not
+// contend with one another.  Similarly to 'bdlcc::StripedUnorderedMap', the
+// number of stripes is specified at construction (rounded up to a power of 2)
+// and does not change during the lifetime of the cache.
+//
+///Cost and Eviction
+///-----------------
+// Each item in the cache has a *cost*.  By default, the cost of every item is
+// 1, so that the cost of the cache is its size.  Optionally, a cost function
+// may be supplied at construction, in which case the cost of an item is the
+// value returned by that function for the key and value of the item when it
+// is inserted.  For example, the cost function may return the number of bytes
+// used by a value so that the watermarks of the cache bound its memory
+// footprint rather than its number of items.
+//
+// The low and high watermarks of the cache are expressed in cost units, and
+// are divided evenly (rounding up) among the stripes.  Eviction is performed
+// independently by each stripe: after an item is inserted into a stripe, if
+// the total cost of the stripe exceeds its share of the high watermark, items
+// are evicted from the stripe, in the order dictated by the eviction policy,
+// until its total cost does not exceed its share of the low watermark.  The
+// item just inserted is never evicted by its own insertion.  Note that,
+// because eviction is per stripe, the cache may evict an item while the total
+// cost of the cache is below the high watermark if the keys are not evenly
+// distributed among the stripes.
+//
+///Eviction Policies
+///-----------------
+// With the LRU policy, a successful 'tryGetValue' (with 'modifyEvictionQueue'
+// set to 'true') moves the item to the back of the eviction queue of its
+// stripe, and therefore acquires the write lock of the stripe.  With the FIFO
+// and CLOCK policies, 'tryGetValue' acquires only the read lock of the stripe;
+// CLOCK merely marks the item as referenced, and a referenced item is given a
+// second chance when it is considered for eviction (see 'bdlcc_cache').  For
+// read-mostly workloads, CLOCK provides a close approximation of LRU at the
+// cost of FIFO.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::StripedCache' is fully thread-safe, meaning that all non-creator
+// operations on an object can be safely invoked simultaneously from multiple
+// threads.
+//
+// Operations on a single key acquire the lock of the stripe of that key only.
+// The bulk operations, 'eraseBulk' and 'insertBulk', as well as 'clear',
+// 'size', 'totalCost', and 'visit', operate on one stripe at a time, and are
+// therefore *not* atomic with respect to the cache as a whole.  The
+// post-eviction callback is invoked while the write lock of the stripe from
+// which the item was evicted is held, and must not call back into the cache.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Memory-Bounded Cache of Documents
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches documents, looked up by an integer
+// identifier, that vary widely in size, and that we want to bound the memory
+// used by the cache rather than the number of documents in it.
+//
+// First, we define a cost function returning the length of a document:
+//..
+//  bsl::size_t documentCost(int, const bsl::string& document)
+//  {
+//      return document.length();
+//  }
+//..
+// Then, we define a 'bdlcc::StripedCache' object, 'documents', having 4
+// stripes and the CLOCK eviction policy, whose total cost starts being
+// reduced once it exceeds 400 characters, down to 200 characters:
+//..
+//  typedef bdlcc::StripedCache<int, bsl::string> DocumentCache;
+//
+//  DocumentCache documents(bdlcc::CacheEvictionPolicy::e_CLOCK,
+//                          200,
+//                          400,
+//                          4,
+//                          &documentCost,
+//                          &talloc);
+//  assert(4 == documents.numStripes());
+//..
+// Next, we insert a few documents, and observe that the cost of the cache is
+// the sum of their lengths:
+//..
+//  documents.insert(1, bsl::string(40, 'a'));
+//  documents.insert(2, bsl::string(30, 'b'));
+//  documents.insert(3, bsl::string(20, 'c'));
+//  assert(3  == documents.size());
+//  assert(90 == documents.totalCost());
+//..
+// Then, we retrieve a document, which, with the CLOCK policy, only requires a
+// read lock on the stripe holding the document:
+//..
+//  bsl::shared_ptr<bsl::string> document;
+//  int rc = documents.tryGetValue(&document, 2);
+//  assert(0  == rc);
+//  assert(30 == document->length());
+//..
+// Now, we insert a very large document.  Each stripe may hold 100 characters
+// (its share of the high watermark), so inserting a 150-character document
+// evicts the other documents of its stripe, if any.  The large document
+// itself is retained, because an item is never evicted by its own insertion:
+//..
+//  documents.insert(4, bsl::string(150, 'd'));
+//  rc = documents.tryGetValue(&document, 4);
+//  assert(0   == rc);
+//  assert(150 == document->length());
+//..
+// Finally, we erase the large document, and observe that the cost of the
+// cache is reduced accordingly:
+//..
+//  const bsl::size_t cost = documents.totalCost();
+//  rc = documents.erase(4);
+//  assert(0          == rc);
+//  assert(cost - 150 == documents.totalCost());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_cache.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_allocatorargt.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bslmt_readerwritermutex.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>            // 'bsl::size_t'
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_list.h>
+#include <bsl_memory.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                         // =========================
+                         // struct StripedCache_Entry
+                         // =========================
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+struct StripedCache_Entry {
+    // This 'struct' holds the mapped value of an item of a stripe of a
+    // 'StripedCache': a pointer to the value of the item, the position of its
+    // key in the eviction queue of the stripe, the cost of the item, and, for
+    // the CLOCK eviction policy, whether the item was referenced since it was
+    // last considered for eviction.
+
+    // DATA
+    VALUE_PTR                d_valuePtr;    // value of the item
+    QUEUE_ITERATOR           d_queueIt;     // position in the eviction queue
+    bsl::size_t              d_cost;        // cost of the item
+    mutable bsls::AtomicBool d_referenced;  // 'true' if referenced since last
+                                            // considered for eviction
+
+    // CREATORS
+    StripedCache_Entry(const VALUE_PTR& valuePtr,
+                       QUEUE_ITERATOR   queueIt,
+                       bsl::size_t      cost);
+    StripedCache_Entry(bslmf::MovableRef<VALUE_PTR> valuePtr,
+                       QUEUE_ITERATOR               queueIt,
+                       bsl::size_t                  cost);
+        // Create an entry holding the specified 'valuePtr', 'queueIt', and
+        // 'cost', and marked as not referenced.
+
+    StripedCache_Entry(const StripedCache_Entry& original);
+    StripedCache_Entry(bslmf::MovableRef<StripedCache_Entry> original);
+        // Create an entry having the value of the specified 'original' entry.
+
+    //! ~StripedCache_Entry() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    StripedCache_Entry& operator=(const StripedCache_Entry& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+};
+
+                         // =========================
+                         // class StripedCache_Stripe
+                         // =========================
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class StripedCache_Stripe {
+    // This class implements one stripe of a 'StripedCache': a set of items,
+    // protected by a reader-writer lock, having an eviction queue and
+    // watermarks of its own.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::shared_ptr<VALUE>                   ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef bsl::function<void(const ValuePtrType&)> PostEvictionCallback;
+        // Type of function to call after an item has been evicted.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::list<KEY>                                        QueueType;
+        // Eviction queue type.
+
+    typedef StripedCache_Entry<ValuePtrType, typename QueueType::iterator>
+                                                                  Entry;
+        // Value type of the hash map.
+
+    typedef bsl::unordered_map<KEY, Entry, HASH, EQUAL>           MapType;
+        // Hash map type.
+
+    typedef bslmt::ReaderWriterMutex                              LockType;
+
+    // DATA
+    mutable LockType           d_rwlock;               // reader-writer lock
+
+    MapType                    d_map;                  // hash table storing
+                                                       // the items of this
+                                                       // stripe
+
+    QueueType                  d_queue;                // eviction order of
+                                                       // the keys of this
+                                                       // stripe, first to be
+                                                       // evicted at the front
+
+    bsl::size_t                d_totalCost;            // sum of the costs of
+                                                       // the items
+
+    CacheEvictionPolicy::Enum  d_evictionPolicy;       // eviction policy
+
+    bsl::size_t                d_lowWatermark;         // cost at which
+                                                       // eviction stops
+
+    bsl::size_t                d_highWatermark;        // cost above which
+                                                       // eviction starts
+
+    PostEvictionCallback       d_postEvictionCallback; // the function to call
+                                                       // after a value has
+                                                       // been evicted
+
+    // PRIVATE MANIPULATORS
+    void enforceHighWatermark(const typename MapType::iterator& keepIt);
+        // If the total cost of this stripe exceeds its high watermark, evict
+        // items, other than the item at the specified 'keepIt', until the
+        // total cost does not exceed the low watermark or 'keepIt' is the
+        // only item left.  Invoke the post-eviction callback for each item
+        // evicted.
+
+    void evictItem(const typename MapType::iterator& mapIt);
+        // Evict the item at the specified 'mapIt' and invoke the post-eviction
+        // callback for that item.
+
+    typename MapType::iterator findVictim(
+                                     const typename MapType::iterator& keepIt);
+        // Return an iterator to the item to evict next, skipping the item at
+        // the specified 'keepIt'.  If the eviction policy is CLOCK, first move
+        // each referenced item at the front of the eviction queue to the back
+        // of the queue and clear its mark.  The behavior is undefined unless
+        // this stripe holds at least one item other than 'keepIt'.
+
+  private:
+    // NOT IMPLEMENTED
+    StripedCache_Stripe(const StripedCache_Stripe&);
+    StripedCache_Stripe& operator=(const StripedCache_Stripe&);
+
+  public:
+    // CREATORS
+    StripedCache_Stripe(CacheEvictionPolicy::Enum  evictionPolicy,
+                        bsl::size_t                lowWatermark,
+                        bsl::size_t                highWatermark,
+                        const HASH&                hashFunction,
+                        const EQUAL&               equalFunction,
+                        bslma::Allocator          *basicAllocator);
+        // Create an empty stripe using the specified 'evictionPolicy',
+        // 'lowWatermark', 'highWatermark', 'hashFunction', and
+        // 'equalFunction', and using the specified 'basicAllocator' to supply
+        // memory.
+
+    //! ~StripedCache_Stripe() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this stripe.  Do *not* invoke the
+        // post-eviction callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this stripe.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    bool insert(KEY          *key_p,
+                bool          moveKey,
+                ValuePtrType *valuePtr_p,
+                bool          moveValuePtr,
+                bsl::size_t   cost);
+        // Add an item with the specified '*key_p', '*valuePtr_p', and 'cost'
+        // to this stripe, replacing the value and cost of the item if
+        // '*key_p' already exists, and then enforce the high watermark.  If
+        // the specified 'moveKey' is 'true', move '*key_p', and if the
+        // specified 'moveValuePtr' is 'true', move '*valuePtr_p'.  Return
+        // 'true' if '*key_p' was not previously in this stripe and 'false'
+        // otherwise.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback of this stripe to the specified
+        // 'postEvictionCallback'.
+
+    int tryGetValue(ValuePtrType *value,
+                    const KEY&    key,
+                    bool          modifyEvictionQueue);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this stripe, and, if the specified
+        // 'modifyEvictionQueue' is 'true', record the access according to the
+        // eviction policy.  Return 0 on success, and 1 if 'key' does not
+        // exist in this stripe.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this stripe.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the hash functor used by this stripe.
+
+    bsl::size_t size() const;
+        // Return the number of items in this stripe.
+
+    bsl::size_t totalCost() const;
+        // Return the sum of the costs of the items in this stripe.
+
+    template <class VISITOR>
+    bool visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this stripe in
+        // the order of its eviction queue until 'visitor' returns 'false'.
+        // Return 'false' if 'visitor' returned 'false', and 'true' otherwise.
+};
+
+                            // ==================
+                            // class StripedCache
+                            // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class StripedCache {
+    // This class represents an in-process key-value store, supporting a
+    // variety of eviction policies, whose items are partitioned among
+    // independently locked stripes.
+
+    // PRIVATE TYPES
+    typedef StripedCache_Stripe<KEY, VALUE, HASH, EQUAL> Stripe;
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::shared_ptr<VALUE>                            ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef bsl::function<void(const ValuePtrType&)> PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef bsl::function<bsl::size_t(const KEY&, const VALUE&)>
+                                                              CostFunction;
+        // Type of function returning the cost of an item.
+
+    typedef bsl::pair<KEY, ValuePtrType>                          KVType;
+        // Value type of a bulk insert entry.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_STRIPES = 4  // default number of stripes
+    };
+
+  private:
+    // DATA
+    bslma::Allocator          *d_allocator_p;   // memory allocator (held, not
+                                                // owned)
+
+    Stripe                    *d_stripes_p;     // array of stripes (owned)
+
+    bsl::size_t                d_numStripes;    // number of stripes, a power
+                                                // of 2
+
+    bsl::size_t                d_stripeMask;    // 'd_numStripes - 1'
+
+    CacheEvictionPolicy::Enum  d_evictionPolicy;  // eviction policy
+
+    bsl::size_t                d_lowWatermark;  // low watermark of the cache
+
+    bsl::size_t                d_highWatermark; // high watermark of the cache
+
+    CostFunction               d_costFunction;  // cost of an item, or empty
+                                                // for a unit cost
+
+    HASH                       d_hashFunction;  // hash functor used to select
+                                                // the stripe of a key
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t powerCeil(bsl::size_t num);
+        // Return the smallest power of 2 that is not less than the specified
+        // 'num', or 1 if 'num' is 0.
+
+    static bsl::size_t stripeWatermark(bsl::size_t watermark,
+                                       bsl::size_t numStripes);
+        // Return the share of the specified 'watermark' of each of
+        // 'numStripes' stripes, rounded up.
+
+    // PRIVATE MANIPULATORS
+    void createStripes(bsl::size_t  numStripes,
+                       const EQUAL& equalFunction);
+        // Allocate and construct the stripes of this cache, whose number is
+        // the specified 'numStripes' rounded up to a power of 2, using the
+        // specified 'equalFunction'.
+
+    void populateValuePtrType(ValuePtrType             *dst,
+                              const VALUE&              value,
+                              bsl::true_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              const VALUE&              value,
+                              bsl::false_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              bslmf::MovableRef<VALUE>  value,
+                              bsl::true_type);
+    void populateValuePtrType(ValuePtrType             *dst,
+                              bslmf::MovableRef<VALUE>  value,
+                              bsl::false_type);
+        // Allocate a footprint for the specified 'value', copy or move 'value'
+        // into the footprint and load the specified '*dst' with a pointer to
+        // the value.
+
+    Stripe& stripe(const KEY& key) const;
+        // Return a reference to the stripe holding the specified 'key'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t costOf(const KEY& key, const ValuePtrType& valuePtr) const;
+        // Return the cost of an item having the specified 'key' and the value
+        // at the specified 'valuePtr'.
+
+  private:
+    // NOT IMPLEMENTED
+    StripedCache(const StripedCache&);
+    StripedCache& operator=(const StripedCache&);
+
+  public:
+    // CREATORS
+    explicit StripedCache(bslma::Allocator *basicAllocator = 0);
+        // Create an empty LRU cache having no size limit and
+        // 'k_DEFAULT_NUM_STRIPES' stripes, and in which every item has a cost
+        // of 1.  Optionally specify a 'basicAllocator' used to supply memory.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.
+
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bslma::Allocator          *basicAllocator = 0);
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numStripes,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy',
+        // 'lowWatermark', and 'highWatermark', in which every item has a cost
+        // of 1.  Optionally specify 'numStripes', the number of stripes of the
+        // cache, rounded up to a power of 2.  If 'numStripes' is not
+        // specified, 'k_DEFAULT_NUM_STRIPES' is used.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'lowWatermark <= highWatermark',
+        // '1 <= lowWatermark', and '1 <= numStripes'.
+
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numStripes,
+                 const CostFunction&        costFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numStripes,
+                 const CostFunction&        costFunction,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy',
+        // 'lowWatermark', 'highWatermark', and 'numStripes' (rounded up to a
+        // power of 2), in which the cost of an item is the value returned by
+        // the specified 'costFunction' for the key and value of the item, or
+        // 1 if 'costFunction' is empty.  Optionally specify a 'hashFunction'
+        // used to generate the hash values for a given key, and an
+        // 'equalFunction' used to determine whether two keys have the same
+        // value.  Optionally specify the 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark', and
+        // '1 <= numStripes'.
+
+    ~StripedCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+        // Move the specified 'key' and its associated 'value' into this cache.
+        // If 'key' already exists, then its value and cost will be replaced.
+        // Note that all the methods that take moved objects provide the
+        // 'basic' but not the 'strong' exception guarantee.  Also note that
+        // 'key' must be copyable, even if it is moved.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value and cost will be
+        // replaced.  The behavior is undefined unless 'valuePtr' is not null.
+        // Note that 'key' must be copyable, even if it is moved.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the optionally specified
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
+        // move the cached item to the back of the eviction queue of its
+        // stripe, and if it is CLOCK, then mark the cached item as referenced.
+        // Return 0 on success, and 1 if 'key' does not exist in this cache.
+        // Note that a write lock on the stripe of 'key' is acquired only if
+        // the eviction queue of the stripe is modified.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache that
+        // returns 'true' if two 'KEY' objects have the same value, and 'false'
+        // otherwise.
+
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache to
+        // generate a hash value (of type 'std::size_t') for a 'KEY' object.
+
+    bsl::size_t highWatermark() const;
+        // Return the high watermark of this cache, in cost units.
+
+    bsl::size_t lowWatermark() const;
+        // Return the low watermark of this cache, in cost units.
+
+    bsl::size_t numStripes() const;
+        // Return the number of stripes of this cache.
+
+    bsl::size_t size() const;
+        // Return the current number of items in this cache.
+
+    bsl::size_t totalCost() const;
+        // Return the current sum of the costs of the items in this cache.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // stripe by stripe, and, within a stripe, in the order of its eviction
+        // queue, until 'visitor' returns 'false'.  The 'VISITOR' type must be
+        // a callable object that can be invoked in the same way as the
+        // function 'bool (const KEY&, const VALUE&)'.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // struct StripedCache_Entry
+                         // -------------------------
+
+// CREATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+StripedCache_Entry<VALUE_PTR, QUEUE_ITERATOR>::StripedCache_Entry(
+                                                    const VALUE_PTR& valuePtr,
+                                                    QUEUE_ITERATOR   queueIt,
+                                                    bsl::size_t      cost)
+: d_valuePtr(valuePtr)
+, d_queueIt(queueIt)
+, d_cost(cost)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+StripedCache_Entry<VALUE_PTR, QUEUE_ITERATOR>::StripedCache_Entry(
+                                        bslmf::MovableRef<VALUE_PTR> valuePtr,
+                                        QUEUE_ITERATOR               queueIt,
+                                        bsl::size_t                  cost)
+: d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+, d_queueIt(queueIt)
+, d_cost(cost)
+, d_referenced(false)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+StripedCache_Entry<VALUE_PTR, QUEUE_ITERATOR>::StripedCache_Entry(
+                                            const StripedCache_Entry& original)
+: d_valuePtr(original.d_valuePtr)
+, d_queueIt(original.d_queueIt)
+, d_cost(original.d_cost)
+, d_referenced(original.d_referenced.loadRelaxed())
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+StripedCache_Entry<VALUE_PTR, QUEUE_ITERATOR>::StripedCache_Entry(
+                              bslmf::MovableRef<StripedCache_Entry> original)
+: d_valuePtr(bslmf::MovableRefUtil::move(
+                      bslmf::MovableRefUtil::access(original).d_valuePtr))
+, d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+, d_cost(bslmf::MovableRefUtil::access(original).d_cost)
+, d_referenced(
+          bslmf::MovableRefUtil::access(original).d_referenced.loadRelaxed())
+{
+}
+
+// MANIPULATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+StripedCache_Entry<VALUE_PTR, QUEUE_ITERATOR>&
+StripedCache_Entry<VALUE_PTR, QUEUE_ITERATOR>::operator=(
+                                                 const StripedCache_Entry& rhs)
+{
+    d_valuePtr = rhs.d_valuePtr;
+    d_queueIt  = rhs.d_queueIt;
+    d_cost     = rhs.d_cost;
+    d_referenced.storeRelaxed(rhs.d_referenced.loadRelaxed());
+    return *this;
+}
+
+                         // -------------------------
+                         // class StripedCache_Stripe
+                         // -------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::StripedCache_Stripe(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_rwlock()
+, d_map(0, hashFunction, equalFunction, basicAllocator)
+, d_queue(basicAllocator)
+, d_totalCost(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_postEvictionCallback(bsl::allocator_arg, basicAllocator)
+{
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark(
+                                      const typename MapType::iterator& keepIt)
+{
+    if (d_totalCost <= d_highWatermark) {
+        return;                                                       // RETURN
+    }
+
+    while (d_totalCost > d_lowWatermark && d_map.size() > 1) {
+        evictItem(findVictim(keepIt));
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::evictItem(
+                                       const typename MapType::iterator& mapIt)
+{
+    ValuePtrType value = mapIt->second.d_valuePtr;
+
+    d_totalCost -= mapIt->second.d_cost;
+    d_queue.erase(mapIt->second.d_queueIt);
+    d_map.erase(mapIt);
+
+    if (d_postEvictionCallback) {
+        d_postEvictionCallback(value);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::findVictim(
+                                      const typename MapType::iterator& keepIt)
+{
+    BSLS_ASSERT(1 < d_queue.size());
+
+    while (true) {
+        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        // Skip 'keepIt' and give a referenced item a second chance.  Since
+        // each item passed over is unmarked, this loop ends after at most two
+        // passes over the queue.
+
+        if (mapIt != keepIt) {
+            if (CacheEvictionPolicy::e_CLOCK != d_evictionPolicy
+             || !mapIt->second.d_referenced.loadRelaxed()) {
+                return mapIt;                                         // RETURN
+            }
+            mapIt->second.d_referenced.storeRelaxed(false);
+        }
+
+        d_queue.splice(d_queue.end(), d_queue, d_queue.begin());
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+    d_map.clear();
+    d_queue.clear();
+    d_totalCost = 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    const typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    evictItem(mapIt);
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::insert(
+                                                    KEY          *key_p,
+                                                    bool          moveKey,
+                                                    ValuePtrType *valuePtr_p,
+                                                    bool          moveValuePtr,
+                                                    bsl::size_t   cost)
+{
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    enum { k_RVALUE_ASSIGN = true };
+#else
+    enum { k_RVALUE_ASSIGN = false };
+#endif
+
+    KEY&          key      = *key_p;
+    ValuePtrType& valuePtr = *valuePtr_p;
+
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+
+    typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt != d_map.end()) {
+        if (k_RVALUE_ASSIGN && moveValuePtr) {
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
+        }
+        else {
+            mapIt->second.d_valuePtr = valuePtr;
+        }
+        d_totalCost = d_totalCost - mapIt->second.d_cost + cost;
+        mapIt->second.d_cost = cost;
+
+        d_queue.splice(d_queue.end(), d_queue, mapIt->second.d_queueIt);
+
+        enforceHighWatermark(mapIt);
+        return false;                                                 // RETURN
+    }
+
+    d_queue.push_back(key);
+    typename QueueType::iterator queueIt = d_queue.end();
+    --queueIt;
+
+    BSLS_TRY {
+        bsls::ObjectBuffer<Entry> entryFootprint;
+        Entry *entry_p = entryFootprint.address();
+
+        if (moveValuePtr) {
+            new (entry_p) Entry(bslmf::MovableRefUtil::move(valuePtr),
+                                queueIt,
+                                cost);
+        }
+        else {
+            new (entry_p) Entry(valuePtr, queueIt, cost);
+        }
+        bslma::DestructorGuard<Entry> entryGuard(entry_p);
+
+        if (moveKey) {
+            mapIt = d_map.emplace(bslmf::MovableRefUtil::move(key),
+                                  bslmf::MovableRefUtil::move(*entry_p)).first;
+        }
+        else {
+            mapIt = d_map.emplace(key,
+                                  bslmf::MovableRefUtil::move(*entry_p)).first;
+        }
+    }
+    BSLS_CATCH(...) {
+        d_queue.pop_back();
+        BSLS_RETHROW;
+    }
+
+    d_totalCost += cost;
+
+    enforceHighWatermark(mapIt);
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
+    d_postEvictionCallback = postEvictionCallback;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                              ValuePtrType *value,
+                                              const KEY&    key,
+                                             bool          modifyEvictionQueue)
+{
+    const bool writeLock = CacheEvictionPolicy::e_LRU == d_evictionPolicy
+                        && modifyEvictionQueue;
+    if (writeLock) {
+        d_rwlock.lockWrite();
+    }
+    else {
+        d_rwlock.lockRead();
+    }
+
+    // Since the guard is constructed with a locked synchronization object, the
+    // guard's call to 'unlock' correctly handles both read and write
+    // scenarios.
+
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock, true);
+
+    const typename MapType::iterator mapIt = d_map.find(key);
+    if (mapIt == d_map.end()) {
+        return 1;                                                     // RETURN
+    }
+
+    *value = mapIt->second.d_valuePtr;
+
+    if (writeLock) {
+        d_queue.splice(d_queue.end(), d_queue, mapIt->second.d_queueIt);
+    }
+    else if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy
+          && modifyEvictionQueue
+          && !mapIt->second.d_referenced.loadRelaxed()) {
+        // Test the mark before setting it, so that hits on an item that is
+        // already marked do not write to its cache line.
+
+        mapIt->second.d_referenced.storeRelaxed(true);
+    }
+
+    return 0;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_map.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_map.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
+    return d_map.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::totalCost() const
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
+    return d_totalCost;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+bool StripedCache_Stripe<KEY, VALUE, HASH, EQUAL>::visit(
+                                                        VISITOR& visitor) const
+{
+    bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
+
+    for (typename QueueType::const_iterator queueIt = d_queue.begin();
+         queueIt != d_queue.end(); ++queueIt) {
+
+        const KEY&                             key = *queueIt;
+        const typename MapType::const_iterator mapIt = d_map.find(key);
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        if (!visitor(key, *mapIt->second.d_valuePtr)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                            // ------------------
+                            // class StripedCache
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::powerCeil(bsl::size_t num)
+{
+    bsl::size_t power = 1;
+    while (power < num) {
+        power <<= 1;
+    }
+    return power;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::stripeWatermark(
+                                                       bsl::size_t watermark,
+                                                       bsl::size_t numStripes)
+{
+    return watermark / numStripes + (0 != watermark % numStripes);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::createStripes(
+                                                bsl::size_t  numStripes,
+                                                const EQUAL& equalFunction)
+{
+    BSLS_ASSERT(1 <= numStripes);
+
+    d_numStripes = powerCeil(numStripes);
+    d_stripeMask = d_numStripes - 1;
+
+    const bsl::size_t low  = stripeWatermark(d_lowWatermark,  d_numStripes);
+    const bsl::size_t high = stripeWatermark(d_highWatermark, d_numStripes);
+
+    // Allocate the array of 'Stripe' objects, and construct them.
+
+    d_stripes_p = static_cast<Stripe *>(
+                      d_allocator_p->allocate(d_numStripes * sizeof(Stripe)));
+
+    bsl::size_t i = 0;
+    BSLS_TRY {
+        for (; i < d_numStripes; ++i) {
+            new (&d_stripes_p[i]) Stripe(d_evictionPolicy,
+                                         low,
+                                         high,
+                                         d_hashFunction,
+                                         equalFunction,
+                                         d_allocator_p);
+        }
+    }
+    BSLS_CATCH(...) {
+        while (i > 0) {
+            bslma::DestructionUtil::destroy(&d_stripes_p[--i]);
+        }
+        d_allocator_p->deallocate(d_stripes_p);
+        BSLS_RETHROW;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                                           ValuePtrType *dst,
+                                                           const VALUE&  value,
+                                                           bsl::true_type)
+{
+    dst->createInplace(d_allocator_p, value, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                                           ValuePtrType *dst,
+                                                           const VALUE&  value,
+                                                           bsl::false_type)
+{
+    dst->createInplace(d_allocator_p, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                               ValuePtrType             *dst,
+                                               bslmf::MovableRef<VALUE>  value,
+                                               bsl::true_type)
+{
+    dst->createInplace(d_allocator_p,
+                       bslmf::MovableRefUtil::move(value),
+                       d_allocator_p);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::populateValuePtrType(
+                                               ValuePtrType             *dst,
+                                               bslmf::MovableRef<VALUE>  value,
+                                               bsl::false_type)
+{
+    dst->createInplace(d_allocator_p, bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedCache<KEY, VALUE, HASH, EQUAL>::Stripe&
+StripedCache<KEY, VALUE, HASH, EQUAL>::stripe(const KEY& key) const
+{
+    // Select the stripe from the high bits of a Fibonacci-multiplied hash
+    // value, so that the stripe index is independent from the low bits used
+    // by the hash map of the stripe to select a bucket.
+
+    const bsls::Types::Uint64 hash =
+        static_cast<bsls::Types::Uint64>(d_hashFunction(key)) *
+                                                        0x9E3779B97F4A7C15ULL;
+    return d_stripes_p[static_cast<bsl::size_t>(hash >> 32) & d_stripeMask];
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::costOf(
+                                            const KEY&          key,
+                                            const ValuePtrType& valuePtr) const
+{
+    return d_costFunction ? d_costFunction(key, *valuePtr) : 1;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_stripes_p(0)
+, d_numStripes(0)
+, d_stripeMask(0)
+, d_evictionPolicy(CacheEvictionPolicy::e_LRU)
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_costFunction(bsl::allocator_arg, d_allocator_p)
+, d_hashFunction()
+{
+    createStripes(k_DEFAULT_NUM_STRIPES, EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_stripes_p(0)
+, d_numStripes(0)
+, d_stripeMask(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_costFunction(bsl::allocator_arg, d_allocator_p)
+, d_hashFunction()
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+
+    createStripes(k_DEFAULT_NUM_STRIPES, EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numStripes,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_stripes_p(0)
+, d_numStripes(0)
+, d_stripeMask(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_costFunction(bsl::allocator_arg, d_allocator_p)
+, d_hashFunction()
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+
+    createStripes(numStripes, EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numStripes,
+                                     const CostFunction&        costFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_stripes_p(0)
+, d_numStripes(0)
+, d_stripeMask(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_costFunction(bsl::allocator_arg, d_allocator_p, costFunction)
+, d_hashFunction()
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+
+    createStripes(numStripes, EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numStripes,
+                                     const CostFunction&        costFunction,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_stripes_p(0)
+, d_numStripes(0)
+, d_stripeMask(0)
+, d_evictionPolicy(evictionPolicy)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+, d_costFunction(bsl::allocator_arg, d_allocator_p, costFunction)
+, d_hashFunction(hashFunction)
+{
+    BSLS_REVIEW(lowWatermark <= highWatermark);
+    BSLS_REVIEW(1 <= lowWatermark);
+
+    createStripes(numStripes, equalFunction);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::~StripedCache()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        bslma::DestructionUtil::destroy(&d_stripes_p[i]);
+    }
+    d_allocator_p->deallocate(d_stripes_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_stripes_p[i].clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return stripe(key).erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        count += 0 == erase(keys[i]);
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr, value, bslma::UsesBslmaAllocator<VALUE>());
+                                                                 // might throw
+
+    const bsl::size_t cost = costOf(key, valuePtr);
+
+    stripe(key).insert(const_cast<KEY *>(&key), false, &valuePtr, true, cost);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               const KEY&               key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr,
+                         bslmf::MovableRefUtil::move(value),
+                         bslma::UsesBslmaAllocator<VALUE>());
+                                    // might throw, but BEFORE 'value' is moved
+
+    const bsl::size_t cost = costOf(key, valuePtr);
+
+    stripe(key).insert(const_cast<KEY *>(&key), false, &valuePtr, true, cost);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 bslmf::MovableRef<KEY> key,
+                                                 const VALUE&           value)
+{
+    KEY& localKey = key;
+
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr, value, bslma::UsesBslmaAllocator<VALUE>());
+                                                                 // might throw
+
+    const bsl::size_t cost = costOf(localKey, valuePtr);
+
+    stripe(localKey).insert(&localKey, true, &valuePtr, true, cost);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<KEY>   key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    KEY& localKey = key;
+
+    ValuePtrType valuePtr;
+    populateValuePtrType(&valuePtr,
+                         bslmf::MovableRefUtil::move(value),
+                         bslma::UsesBslmaAllocator<VALUE>());
+                                    // might throw, but BEFORE 'value' is moved
+
+    const bsl::size_t cost = costOf(localKey, valuePtr);
+
+    stripe(localKey).insert(&localKey, true, &valuePtr, true, cost);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 const KEY&          key,
+                                                 const ValuePtrType& valuePtr)
+{
+    BSLS_ASSERT(valuePtr);
+
+    const bsl::size_t cost = costOf(key, valuePtr);
+
+    stripe(key).insert(const_cast<KEY *>(&key),
+                       false,
+                       const_cast<ValuePtrType *>(&valuePtr),
+                       false,
+                       cost);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 bslmf::MovableRef<KEY> key,
+                                               const ValuePtrType&    valuePtr)
+{
+    BSLS_ASSERT(valuePtr);
+
+    KEY& localKey = key;
+
+    const bsl::size_t cost = costOf(localKey, valuePtr);
+
+    stripe(localKey).insert(&localKey,
+                            true,
+                            const_cast<ValuePtrType *>(&valuePtr),
+                            false,
+                            cost);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                               const bsl::vector<KVType>& data)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        const KEY&          key      = data[i].first;
+        const ValuePtrType& valuePtr = data[i].second;
+
+        BSLS_ASSERT(valuePtr);
+
+        count += stripe(key).insert(const_cast<KEY *>(&key),
+                                    false,
+                                    const_cast<ValuePtrType *>(&valuePtr),
+                                    false,
+                                    costOf(key, valuePtr));
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_stripes_p[i].setPostEvictionCallback(postEvictionCallback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    return stripe(key).tryGetValue(value, key, modifyEvictionQueue);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL StripedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_stripes_p[0].equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+StripedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_evictionPolicy;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH StripedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::numStripes() const
+{
+    return d_numStripes;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        result += d_stripes_p[i].size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::totalCost() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        result += d_stripes_p[i].totalCost();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        if (!d_stripes_p[i].visit(visitor)) {
+            break;
+        }
+    }
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY,  class VALUE,  class HASH,  class EQUAL>
+struct UsesBslmaAllocator<bdlcc::StripedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
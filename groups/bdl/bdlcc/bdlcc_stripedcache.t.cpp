@@ -0,0 +1,1312 @@
+// bdlcc_stripedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_stripedcache.h>
+
+#include <bdlcc_cache.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::StripedCache', that
+// provides an in-memory key-value cache partitioned into independently locked
+// stripes, with a configurable eviction policy and cost-based watermarks.
+// Like 'bdlcc::Cache', it is not a value-semantic type.
+//
+// Most of the behavior is that of a single stripe, which we test exactly by
+// creating caches having a single stripe.  The partitioning among stripes is
+// then tested through invariants that hold regardless of the stripe to which
+// a given key is assigned.  Thread safety is tested by running concurrent
+// operations and verifying the invariants of the cache afterwards.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StripedCache(bslma::Allocator *basicAllocator);
+// [ 2] StripedCache(policy, lowWat, highWat, basicAllocator);
+// [ 2] StripedCache(policy, lowWat, highWat, numStripes, basicAllocator);
+// [ 2] StripedCache(policy, low, high, numStripes, costFunction, alloc);
+// [ 2] StripedCache(policy, low, high, nS, costFunc, hash, equal, alloc);
+// [ 2] ~StripedCache();
+//
+// MANIPULATORS
+// [ 3] void clear();
+// [ 3] int erase(const KEY& key);
+// [ 3] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 3] void insert(const KEY& key, const VALUE& value);
+// [ 3] void insert(const KEY& key, MovableRef<VALUE> value);
+// [ 3] void insert(MovableRef<KEY> key, const VALUE& value);
+// [ 3] void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+// [ 3] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 3] void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+// [ 3] int insertBulk(const bsl::vector<KVType>& data);
+// [ 4] void setPostEvictionCallback(postEvictionCallback);
+// [ 3] int tryGetValue(value, key, modifyEvictionQueue);
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 2] bsl::size_t numStripes() const;
+// [ 3] bsl::size_t size() const;
+// [ 4] bsl::size_t totalCost() const;
+// [ 3] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] COST-BASED EVICTION
+// [ 5] EVICTION POLICIES
+// [ 6] STRIPES
+// [ 7] THREAD SAFETY
+// [ 8] USAGE EXAMPLE
+// [-1] READ SCALING PERFORMANCE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::StripedCache<int, int>   Obj;
+typedef Obj::ValuePtrType               ValuePtr;
+typedef bdlcc::CacheEvictionPolicy      Policy;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::size_t valueCost(int, const int& value)
+    // Return the specified 'value' as the cost of an item.
+{
+    return static_cast<bsl::size_t>(value);
+}
+
+struct ModHash {
+    // Hash functor returning a key modulo 'd_mod'.
+
+    int d_mod;
+
+    explicit ModHash(int mod = 1000)
+    : d_mod(mod)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key % d_mod);
+    }
+};
+
+struct ModEqual {
+    // Equality functor comparing keys modulo 'd_mod'.
+
+    int d_mod;
+
+    explicit ModEqual(int mod = 1000)
+    : d_mod(mod)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs % d_mod == rhs % d_mod;
+    }
+};
+
+class KeyCollector {
+    // Visitor appending the keys it visits to a vector, and stopping after a
+    // given number of keys.
+
+    bsl::vector<int> *d_keys_p;
+    bsl::size_t       d_limit;
+
+  public:
+    explicit KeyCollector(bsl::vector<int> *keys,
+                          bsl::size_t       limit = ~bsl::size_t(0))
+    : d_keys_p(keys)
+    , d_limit(limit)
+    {
+    }
+
+    bool operator()(int key, int)
+    {
+        d_keys_p->push_back(key);
+        return d_keys_p->size() < d_limit;
+    }
+};
+
+class EvictionRecorder {
+    // Post-eviction callback appending the evicted values to a vector.
+
+    bsl::vector<int> *d_values_p;
+
+  public:
+    explicit EvictionRecorder(bsl::vector<int> *values)
+    : d_values_p(values)
+    {
+    }
+
+    void operator()(const ValuePtr& value) const
+    {
+        d_values_p->push_back(*value);
+    }
+};
+
+bsl::vector<int> keysOf(const Obj& cache)
+    // Return the keys of the specified 'cache' in visiting order.
+{
+    bsl::vector<int> keys;
+    KeyCollector     collector(&keys);
+    cache.visit(collector);
+    return keys;
+}
+
+bool isEqual(const bsl::vector<int>& actual, const int *expected, int n)
+    // Return 'true' if the specified 'actual' holds the specified 'n'
+    // 'expected' values in order, and 'false' otherwise.
+{
+    return actual.size() == static_cast<bsl::size_t>(n)
+        && bsl::equal(actual.begin(), actual.end(), expected);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          CASE 7 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace threaded {
+
+enum { k_NUM_KEYS = 512, k_NUM_ITERATIONS = 20000 };
+
+struct Worker {
+    // Thread function performing a random mix of operations on a cache.
+
+    Obj            *d_cache_p;
+    bslmt::Barrier *d_barrier_p;
+    int             d_seed;
+
+    void operator()() const
+    {
+        unsigned int seed = d_seed;
+        d_barrier_p->wait();
+
+        for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+            seed = seed * 1103515245 + 12345;
+            const int key = static_cast<int>((seed >> 8) % k_NUM_KEYS);
+            const int op  = static_cast<int>((seed >> 24) % 16);
+
+            if (op < 10) {
+                ValuePtr value;
+                if (0 == d_cache_p->tryGetValue(&value, key)) {
+                    ASSERTV(key, *value, key == *value % k_NUM_KEYS);
+                }
+            }
+            else if (op < 15) {
+                d_cache_p->insert(key, key + k_NUM_KEYS * (op - 9));
+            }
+            else {
+                d_cache_p->erase(key);
+            }
+        }
+    }
+};
+
+}  // close namespace threaded
+
+// ============================================================================
+//                         CASE -1 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace readperf {
+
+template <class CACHE>
+struct Reader {
+    // Thread function reading random keys from a cache.
+
+    CACHE          *d_cache_p;
+    bslmt::Barrier *d_barrier_p;
+    int             d_numKeys;
+    int             d_numReads;
+    int             d_seed;
+
+    void operator()() const
+    {
+        unsigned int seed = d_seed;
+        d_barrier_p->wait();
+
+        bsl::shared_ptr<int> value;
+        for (int i = 0; i < d_numReads; ++i) {
+            seed = seed * 1103515245 + 12345;
+            d_cache_p->tryGetValue(&value,
+                                   static_cast<int>((seed >> 8) % d_numKeys));
+        }
+    }
+};
+
+template <class CACHE>
+double run(CACHE *cache, int numThreads, int numKeys, int numReads)
+    // Populate the specified 'cache' with the specified 'numKeys' keys, read
+    // random keys from it from the specified 'numThreads' threads, each doing
+    // the specified 'numReads' reads, and return the elapsed wall time.
+{
+    for (int i = 0; i < numKeys; ++i) {
+        cache->insert(i, i);
+    }
+
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threads;
+    for (int i = 0; i < numThreads; ++i) {
+        Reader<CACHE> reader = { cache, &barrier, numKeys, numReads, i + 1 };
+        threads.addThread(reader);
+    }
+
+    bsls::Stopwatch stopwatch;
+    stopwatch.start();
+    barrier.wait();
+    threads.joinAll();
+    stopwatch.stop();
+
+    return stopwatch.elapsedTime();
+}
+
+}  // close namespace readperf
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample1 {
+
+bslma::TestAllocator talloc("ue1", veryVeryVeryVerbose);
+
+///Example 1: A Memory-Bounded Cache of Documents
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches documents, looked up by an integer
+// identifier, that vary widely in size, and that we want to bound the memory
+// used by the cache rather than the number of documents in it.
+//
+// First, we define a cost function returning the length of a document:
+//..
+    bsl::size_t documentCost(int, const bsl::string& document)
+    {
+        return document.length();
+    }
+//..
+
+void example1()
+{
+// Then, we define a 'bdlcc::StripedCache' object, 'documents', having 4
+// stripes and the CLOCK eviction policy, whose total cost starts being
+// reduced once it exceeds 400 characters, down to 200 characters:
+//..
+    typedef bdlcc::StripedCache<int, bsl::string> DocumentCache;
+
+    DocumentCache documents(bdlcc::CacheEvictionPolicy::e_CLOCK,
+                            200,
+                            400,
+                            4,
+                            &documentCost,
+                            &talloc);
+    ASSERT(4 == documents.numStripes());
+//..
+// Next, we insert a few documents, and observe that the cost of the cache is
+// the sum of their lengths:
+//..
+    documents.insert(1, bsl::string(40, 'a'));
+    documents.insert(2, bsl::string(30, 'b'));
+    documents.insert(3, bsl::string(20, 'c'));
+    ASSERT(3  == documents.size());
+    ASSERT(90 == documents.totalCost());
+//..
+// Then, we retrieve a document, which, with the CLOCK policy, only requires a
+// read lock on the stripe holding the document:
+//..
+    bsl::shared_ptr<bsl::string> document;
+    int rc = documents.tryGetValue(&document, 2);
+    ASSERT(0  == rc);
+    ASSERT(30 == document->length());
+//..
+// Now, we insert a very large document.  Each stripe may hold 100 characters
+// (its share of the high watermark), so inserting a 150-character document
+// evicts the other documents of its stripe, if any.  The large document
+// itself is retained, because an item is never evicted by its own insertion:
+//..
+    documents.insert(4, bsl::string(150, 'd'));
+    rc = documents.tryGetValue(&document, 4);
+    ASSERT(0   == rc);
+    ASSERT(150 == document->length());
+//..
+// Finally, we erase the large document, and observe that the cost of the
+// cache is reduced accordingly:
+//..
+    const bsl::size_t cost = documents.totalCost();
+    rc = documents.erase(4);
+    ASSERT(0          == rc);
+    ASSERT(cost - 150 == documents.totalCost());
+//..
+}
+
+}  // close namespace usageExample1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usageExample1::example1();
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // THREAD SAFETY
+        //
+        // Concerns:
+        //: 1 Concurrent 'insert', 'tryGetValue', and 'erase' calls on keys of
+        //:   the same and of different stripes do not corrupt the cache, for
+        //:   every eviction policy.
+        //:
+        //: 2 The per-stripe watermarks hold once all operations complete.
+        //
+        // Plan:
+        //: 1 For each eviction policy, run several threads performing a
+        //:   random mix of operations on a shared cache, in which the value
+        //:   of an item is congruent to its key.  Verify the values read, and,
+        //:   afterwards, verify the size, cost, and content of the cache.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   THREAD SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD SAFETY" << endl
+                          << "=============" << endl;
+
+        const Policy::Enum POLICIES[] = {
+            Policy::e_LRU, Policy::e_FIFO, Policy::e_CLOCK
+        };
+        const int NUM_THREADS = 6;
+
+        for (int tp = 0; tp < 3; ++tp) {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+            {
+                Obj mX(POLICIES[tp], 64, 128, 8, &ta);  const Obj& X = mX;
+
+                bslmt::Barrier     barrier(NUM_THREADS);
+                bslmt::ThreadGroup threads;
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    threaded::Worker worker = { &mX, &barrier, i * 7919 + 1 };
+                    threads.addThread(worker);
+                }
+                threads.joinAll();
+
+                const bsl::vector<int> keys = keysOf(X);
+                ASSERTV(tp, X.size(), keys.size() == X.size());
+                ASSERTV(tp, X.size(), X.size() == X.totalCost());
+                ASSERTV(tp, X.size(), X.size() <= 8 * 16);
+
+                for (bsl::size_t i = 0; i < keys.size(); ++i) {
+                    ValuePtr value;
+                    ASSERTV(tp, keys[i], 0 == mX.tryGetValue(&value,
+                                                             keys[i]));
+                    ASSERTV(tp, keys[i], keys[i] ==
+                                     *value % int(threaded::k_NUM_KEYS));
+                }
+            }
+            ASSERTV(tp, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // STRIPES
+        //
+        // Concerns:
+        //: 1 The number of stripes is rounded up to a power of 2.
+        //:
+        //: 2 The watermarks are divided evenly, rounding up, among the
+        //:   stripes, and eviction is performed per stripe, so that the cost
+        //:   of the cache never exceeds the sum of the per-stripe shares of
+        //:   the high watermark (for unit costs).
+        //:
+        //: 3 Keys are distributed among all of the stripes, even if the low
+        //:   bits of their hash values are equal.
+        //:
+        //: 4 'visit' visits every item, stripe by stripe, and stops when the
+        //:   visitor returns 'false'.
+        //
+        // Plan:
+        //: 1 Create caches with various numbers of stripes and verify
+        //:   'numStripes'.  (C-1)
+        //:
+        //: 2 Insert many keys, whose hash values are multiples of 64, into
+        //:   caches with various numbers of stripes and watermarks, and verify
+        //:   that the size of the cache is bounded by the stripe shares of
+        //:   the high watermark, and that it exceeds the share of a single
+        //:   stripe.  (C-2..3)
+        //:
+        //: 3 Visit the cache with visitors stopping after various numbers of
+        //:   items.  (C-4)
+        //
+        // Testing:
+        //   STRIPES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STRIPES" << endl
+                          << "=======" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            const struct {
+                int         d_line;
+                bsl::size_t d_numStripes;
+                bsl::size_t d_expected;
+            } DATA[] = {
+                { L_,  1,  1 },
+                { L_,  2,  2 },
+                { L_,  3,  4 },
+                { L_,  4,  4 },
+                { L_,  5,  8 },
+                { L_, 16, 16 },
+                { L_, 17, 32 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                Obj mX(Policy::e_FIFO, 1, 1, DATA[ti].d_numStripes, &ta);
+                ASSERTV(LINE, DATA[ti].d_expected == mX.numStripes());
+            }
+        }
+
+        {
+            const struct {
+                int         d_line;
+                bsl::size_t d_numStripes;
+                bsl::size_t d_low;
+                bsl::size_t d_high;
+                bsl::size_t d_stripeHigh;
+            } DATA[] = {
+                { L_,  2,  10,  20, 10 },
+                { L_,  4,  10,  20,  5 },
+                { L_,  4,  10,  21,  6 },
+                { L_,  8,  30,  50,  7 },
+                { L_, 16,  16,  16,  1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE  = DATA[ti].d_line;
+                const bsl::size_t NS    = DATA[ti].d_numStripes;
+                const bsl::size_t SHIGH = DATA[ti].d_stripeHigh;
+
+                typedef bdlcc::StripedCache<int, int, ModHash, ModEqual> MObj;
+
+                MObj mX(Policy::e_CLOCK,
+                        DATA[ti].d_low,
+                        DATA[ti].d_high,
+                        NS,
+                        MObj::CostFunction(),
+                        ModHash(1 << 20),
+                        ModEqual(1 << 20),
+                        &ta);
+                const MObj& X = mX;
+
+                for (int i = 0; i < 1000; ++i) {
+                    mX.insert(i * 64, i);
+                    ASSERTV(LINE, i, X.size() <= NS * SHIGH);
+                }
+                ASSERTV(LINE, X.size(), X.size() >  SHIGH);
+
+                const bsl::size_t SIZE = X.size();
+                for (bsl::size_t limit = 1; limit <= SIZE + 1; ++limit) {
+                    bsl::vector<int> keys;
+                    KeyCollector     collector(&keys, limit);
+                    X.visit(collector);
+                    ASSERTV(LINE, limit, keys.size() == bsl::min(limit,
+                                                                 SIZE));
+                }
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // EVICTION POLICIES
+        //
+        // Concerns:
+        //: 1 With LRU, 'tryGetValue' moves the item to the back of the
+        //:   eviction queue unless 'modifyEvictionQueue' is 'false'.
+        //:
+        //: 2 With FIFO, 'tryGetValue' does not modify the eviction order.
+        //:
+        //: 3 With CLOCK, 'tryGetValue' marks the item, without changing the
+        //:   order of the queue, and a marked item at the front of the queue
+        //:   is moved to the back, unmarked, instead of being evicted.
+        //:
+        //: 4 Re-inserting an existing key moves it to the back of the queue.
+        //
+        // Plan:
+        //: 1 Using a single stripe, insert items, access some of them, insert
+        //:   more items to trigger eviction, and verify the evicted items and
+        //:   the resulting eviction order.  (C-1..4)
+        //
+        // Testing:
+        //   EVICTION POLICIES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EVICTION POLICIES" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const struct {
+            int           d_line;
+            Policy::Enum  d_policy;
+            bool          d_modify;
+            int           d_order[5];    // order after the accesses
+            int           d_evicted[2];  // evicted by inserting 5
+            int           d_final[4];    // order after inserting 5
+        } DATA[] = {
+            { L_, Policy::e_LRU,   true,  { 0, 3, 4, 1, 2 }, { 0, 3 },
+                                                             { 4, 1, 2, 5 } },
+            { L_, Policy::e_LRU,   false, { 0, 1, 2, 3, 4 }, { 0, 1 },
+                                                             { 2, 3, 4, 5 } },
+            { L_, Policy::e_FIFO,  true,  { 0, 1, 2, 3, 4 }, { 0, 1 },
+                                                             { 2, 3, 4, 5 } },
+            { L_, Policy::e_CLOCK, true,  { 0, 1, 2, 3, 4 }, { 0, 3 },
+                                                             { 4, 5, 1, 2 } },
+            { L_, Policy::e_CLOCK, false, { 0, 1, 2, 3, 4 }, { 0, 1 },
+                                                             { 2, 3, 4, 5 } },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int  LINE   = DATA[ti].d_line;
+            const bool MODIFY = DATA[ti].d_modify;
+
+            Obj mX(DATA[ti].d_policy, 4, 5, 1, &ta);  const Obj& X = mX;
+
+            bsl::vector<int> evicted;
+            mX.setPostEvictionCallback(EvictionRecorder(&evicted));
+
+            for (int i = 0; i < 5; ++i) {
+                mX.insert(i, i);
+            }
+
+            ValuePtr value;
+            ASSERTV(LINE, 0 == mX.tryGetValue(&value, 1, MODIFY));
+            ASSERTV(LINE, 0 == mX.tryGetValue(&value, 2, MODIFY));
+            ASSERTV(LINE, 1 == mX.tryGetValue(&value, 9, MODIFY));
+            ASSERTV(LINE, isEqual(keysOf(X), DATA[ti].d_order, 5));
+            ASSERTV(LINE, evicted.empty());
+
+            mX.insert(5, 5);
+            ASSERTV(LINE, isEqual(evicted, DATA[ti].d_evicted, 2));
+            ASSERTV(LINE, isEqual(keysOf(X), DATA[ti].d_final, 4));
+        }
+
+        if (verbose) cout << "\tCLOCK marks are cleared." << endl;
+        {
+            Obj mX(Policy::e_CLOCK, 2, 3, 1, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 3; ++i) {
+                mX.insert(i, i);
+            }
+
+            // Mark every item: a full pass over the queue unmarks all of
+            // them, and the oldest items are then evicted.
+
+            ValuePtr value;
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i));
+            }
+            mX.insert(3, 3);
+            const int EXP1[] = { 2, 3 };
+            ASSERT(isEqual(keysOf(X), EXP1, 2));
+
+            mX.insert(4, 4);
+            mX.insert(5, 5);
+            const int EXP2[] = { 4, 5 };
+            ASSERT(isEqual(keysOf(X), EXP2, 2));
+        }
+
+        if (verbose) cout << "\tRe-inserting a key." << endl;
+        {
+            const Policy::Enum POLICIES[] = {
+                Policy::e_LRU, Policy::e_FIFO, Policy::e_CLOCK
+            };
+            for (int tp = 0; tp < 3; ++tp) {
+                Obj mX(POLICIES[tp], 10, 10, 1, &ta);  const Obj& X = mX;
+
+                for (int i = 0; i < 3; ++i) {
+                    mX.insert(i, i);
+                }
+                mX.insert(0, 7);
+                const int EXP[] = { 1, 2, 0 };
+                ASSERTV(tp, isEqual(keysOf(X), EXP, 3));
+
+                ValuePtr value;
+                ASSERTV(tp, 0 == mX.tryGetValue(&value, 0));
+                ASSERTV(tp, 7 == *value);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COST-BASED EVICTION
+        //
+        // Concerns:
+        //: 1 Without a cost function, the cost of each item is 1.
+        //:
+        //: 2 With a cost function, the cost of an item is the value returned
+        //:   by the function, and 'totalCost' is the sum of the costs of the
+        //:   items, including after replacing, erasing, and evicting items.
+        //:
+        //: 3 Eviction starts when the cost of a stripe exceeds its share of
+        //:   the high watermark, and stops once it no longer exceeds its share
+        //:   of the low watermark.
+        //:
+        //: 4 The item being inserted is never evicted by its own insertion,
+        //:   even if its cost exceeds the high watermark.
+        //:
+        //: 5 The post-eviction callback is invoked for each evicted or erased
+        //:   item, but not by 'clear'.
+        //
+        // Plan:
+        //: 1 Using a single stripe and the 'valueCost' cost function, insert
+        //:   items of various costs, and verify 'totalCost', the evicted
+        //:   items, and the content of the cache after each step.  (C-1..5)
+        //
+        // Testing:
+        //   void setPostEvictionCallback(postEvictionCallback);
+        //   bsl::size_t totalCost() const;
+        //   COST-BASED EVICTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COST-BASED EVICTION" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tUnit cost." << endl;
+        {
+            Obj mX(Policy::e_FIFO, 2, 4, 1, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 4; ++i) {
+                mX.insert(i, 100);
+                ASSERTV(i, bsl::size_t(i + 1) == X.totalCost());
+            }
+            mX.insert(4, 100);
+            ASSERTV(X.size(), 2 == X.size());
+            ASSERTV(X.totalCost(), 2 == X.totalCost());
+        }
+
+        if (verbose) cout << "\tCost function." << endl;
+        {
+            Obj mX(Policy::e_FIFO, 10, 20, 1, &valueCost, &ta);
+            const Obj& X = mX;
+
+            bsl::vector<int> evicted;
+            mX.setPostEvictionCallback(EvictionRecorder(&evicted));
+
+            mX.insert(1, 5);
+            mX.insert(2, 6);
+            mX.insert(3, 7);
+            ASSERTV(X.totalCost(), 18 == X.totalCost());
+
+            // Replacing an item replaces its cost.
+
+            mX.insert(1, 2);
+            ASSERTV(X.totalCost(), 15 == X.totalCost());
+            ASSERT(evicted.empty());
+
+            // Reach the high watermark exactly: no eviction.
+
+            mX.insert(4, 5);
+            ASSERTV(X.totalCost(), 20 == X.totalCost());
+            ASSERT(evicted.empty());
+
+            // Exceed the high watermark: evict '2' (6), '3' (7), and '1' (2),
+            // in this order, until the cost is at most 10.
+
+            mX.insert(5, 4);
+            const int EVICTED[] = { 6, 7, 2 };
+            ASSERT(isEqual(evicted, EVICTED, 3));
+            ASSERTV(X.totalCost(), 9 == X.totalCost());
+            const int KEYS[] = { 4, 5 };
+            ASSERT(isEqual(keysOf(X), KEYS, 2));
+
+            // An item whose cost exceeds the high watermark evicts every
+            // other item, but is retained.
+
+            evicted.clear();
+            mX.insert(6, 50);
+            const int EVICTED2[] = { 5, 4 };
+            ASSERT(isEqual(evicted, EVICTED2, 2));
+            ASSERTV(X.totalCost(), 50 == X.totalCost());
+            ASSERTV(X.size(), 1 == X.size());
+
+            // Replacing the only item with an oversized value retains it.
+
+            evicted.clear();
+            mX.insert(6, 60);
+            ASSERT(evicted.empty());
+            ASSERTV(X.totalCost(), 60 == X.totalCost());
+
+            // The next insertion evicts the oversized item.
+
+            mX.insert(7, 1);
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERTV(X.totalCost(), 1 == X.totalCost());
+
+            evicted.clear();
+            ASSERT(0 == mX.erase(7));
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERTV(X.totalCost(), 0 == X.totalCost());
+
+            evicted.clear();
+            mX.insert(8, 3);
+            mX.clear();
+            ASSERT(evicted.empty());
+            ASSERTV(X.totalCost(), 0 == X.totalCost());
+        }
+
+        if (verbose) cout << "\tUpdating an item beyond the watermark."
+                          << endl;
+        {
+            Obj mX(Policy::e_CLOCK, 10, 20, 1, &valueCost, &ta);
+            const Obj& X = mX;
+
+            mX.insert(1, 5);
+            mX.insert(2, 5);
+            mX.insert(3, 5);
+
+            ValuePtr value;
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+
+            // Growing item 2 evicts items other than 2: 1 is given a second
+            // chance, so 3 is evicted, and then 1.
+
+            mX.insert(2, 12);
+            const int KEYS[] = { 2 };
+            ASSERT(isEqual(keysOf(X), KEYS, 1));
+            ASSERTV(X.totalCost(), 12 == X.totalCost());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Every 'insert' overload adds a new item or replaces the value of
+        //:   an existing item, and 'insertBulk' returns the number of new
+        //:   items.
+        //:
+        //: 2 'tryGetValue' returns 0 and loads the value of an existing key,
+        //:   and returns 1 otherwise.
+        //:
+        //: 3 'erase' and 'eraseBulk' remove existing items and report the
+        //:   number removed; 'clear' removes every item.
+        //:
+        //: 4 'size' and 'visit' reflect the content of the cache.
+        //:
+        //: 5 All memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Using a cache with several stripes and no watermarks, exercise
+        //:   each manipulator and verify the content of the cache with the
+        //:   accessors.  (C-1..5)
+        //
+        // Testing:
+        //   void clear();
+        //   int erase(const KEY& key);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, MovableRef<VALUE> value);
+        //   void insert(MovableRef<KEY> key, const VALUE& value);
+        //   void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   bsl::size_t size() const;
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        bslma::TestAllocator         ta("test",    veryVeryVeryVerbose);
+        {
+            typedef bdlcc::StripedCache<bsl::string, bsl::string> SObj;
+
+            SObj mX(&ta);  const SObj& X = mX;
+
+            const bsl::string K1("a key long enough to allocate memory 1",
+                                 &ta);
+            const bsl::string V1("a value long enough to allocate memory 1",
+                                 &ta);
+
+            mX.insert(K1, V1);
+            ASSERT(1 == X.size());
+
+            {
+                bsl::string k("a key long enough to allocate memory 2", &ta);
+                bsl::string v("a value long enough to allocate memory 2",
+                              &ta);
+                mX.insert(bslmf::MovableRefUtil::move(k), v);
+            }
+            {
+                bsl::string v("a value long enough to allocate memory 3",
+                              &ta);
+                mX.insert(bsl::string("k3", &ta),
+                          bslmf::MovableRefUtil::move(v));
+            }
+            {
+                bsl::string k("k4", &ta);
+                bsl::string v("v4", &ta);
+                mX.insert(bslmf::MovableRefUtil::move(k),
+                          bslmf::MovableRefUtil::move(v));
+            }
+            {
+                SObj::ValuePtrType vp;
+                vp.createInplace(&ta, "v5", &ta);
+                mX.insert(bsl::string("k5", &ta), vp);
+
+                bsl::string k("k6", &ta);
+                mX.insert(bslmf::MovableRefUtil::move(k), vp);
+            }
+            ASSERTV(X.size(), 6 == X.size());
+
+            SObj::ValuePtrType value;
+            ASSERT(0 == mX.tryGetValue(&value, K1));
+            ASSERT(V1 == *value);
+            ASSERT(0 == mX.tryGetValue(&value, bsl::string("k4", &ta)));
+            ASSERT("v4" == *value);
+            ASSERT(0 == mX.tryGetValue(&value, bsl::string("k6", &ta)));
+            ASSERT("v5" == *value);
+            ASSERT(1 == mX.tryGetValue(&value, bsl::string("k7", &ta)));
+
+            // Replace.
+
+            mX.insert(K1, bsl::string("v1", &ta));
+            ASSERTV(X.size(), 6 == X.size());
+            ASSERT(0 == mX.tryGetValue(&value, K1));
+            ASSERT("v1" == *value);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+
+        {
+            Obj mX(Policy::e_LRU, 1000, 1000, 8, &ta);  const Obj& X = mX;
+
+            bsl::vector<Obj::KVType> data(&ta);
+            for (int i = 0; i < 100; ++i) {
+                ValuePtr vp;
+                vp.createInplace(&ta, i * 2);
+                data.push_back(Obj::KVType(i, vp));
+            }
+
+            ASSERT(100 == mX.insertBulk(data));
+            ASSERT(100 == X.size());
+            ASSERT(  0 == mX.insertBulk(data));
+            ASSERT(100 == X.size());
+
+            bsl::vector<int> keys = keysOf(X);
+            bsl::sort(keys.begin(), keys.end());
+            ASSERT(100 == keys.size());
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, i == keys[i]);
+
+                ValuePtr value;
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i, i % 2));
+                ASSERTV(i, i * 2 == *value);
+            }
+
+            ASSERT(0 == mX.erase(7));
+            ASSERT(1 == mX.erase(7));
+            ASSERT(99 == X.size());
+
+            bsl::vector<int> eraseKeys(&ta);
+            eraseKeys.push_back(7);
+            eraseKeys.push_back(8);
+            eraseKeys.push_back(9);
+            eraseKeys.push_back(1000);
+            ASSERT(2 == mX.eraseBulk(eraseKeys));
+            ASSERT(97 == X.size());
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.totalCost());
+            ASSERT(keysOf(X).empty());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty cache having the specified
+        //:   attributes, and the documented defaults otherwise.
+        //:
+        //: 2 The supplied allocator, or the default allocator, is used, and
+        //:   all memory is released on destruction.
+        //:
+        //: 3 The supplied hash and equality functors are used.
+        //
+        // Plan:
+        //: 1 Create caches with each constructor, and verify the accessors
+        //:   and the allocators in use.  (C-1..2)
+        //:
+        //: 2 Create a cache with functors considering keys modulo 10, and
+        //:   verify that keys congruent modulo 10 refer to the same item.
+        //:   (C-3)
+        //
+        // Testing:
+        //   explicit StripedCache(bslma::Allocator *basicAllocator);
+        //   StripedCache(policy, lowWat, highWat, basicAllocator);
+        //   StripedCache(policy, lowWat, highWat, numStripes, basicAllocator);
+        //   StripedCache(policy, low, high, numStripes, costFunction, alloc);
+        //   StripedCache(policy, low, high, nS, costFunc, hash, equal, alloc);
+        //   ~StripedCache();
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numStripes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+        bslma::TestAllocator         ta("test",    veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 != da.numBlocksInUse());
+            ASSERT(Policy::e_LRU == X.evictionPolicy());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                          X.lowWatermark());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                         X.highWatermark());
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.totalCost());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(0 != ta.numBlocksInUse());
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(Policy::e_FIFO, 10, 20, &ta);  const Obj& X = mX;
+            ASSERT(Policy::e_FIFO == X.evictionPolicy());
+            ASSERT(10 == X.lowWatermark());
+            ASSERT(20 == X.highWatermark());
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+        }
+        {
+            Obj mX(Policy::e_CLOCK, 10, 20, 16, &ta);  const Obj& X = mX;
+            ASSERT(Policy::e_CLOCK == X.evictionPolicy());
+            ASSERT(10 == X.lowWatermark());
+            ASSERT(20 == X.highWatermark());
+            ASSERT(16 == X.numStripes());
+        }
+        {
+            Obj mX(Policy::e_LRU, 30, 40, 2, &valueCost, &ta);
+            const Obj& X = mX;
+            ASSERT(Policy::e_LRU == X.evictionPolicy());
+            ASSERT(30 == X.lowWatermark());
+            ASSERT(40 == X.highWatermark());
+            ASSERT(2 == X.numStripes());
+
+            mX.insert(1, 7);
+            ASSERT(7 == X.totalCost());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            typedef bdlcc::StripedCache<int, int, ModHash, ModEqual> MObj;
+
+            MObj mX(Policy::e_FIFO,
+                    100,
+                    100,
+                    4,
+                    MObj::CostFunction(),
+                    ModHash(10),
+                    ModEqual(10),
+                    &ta);
+            const MObj& X = mX;
+
+            ASSERT(10 == X.hashFunction().d_mod);
+            ASSERT(10 == X.equalFunction().d_mod);
+
+            mX.insert(3, 3);
+            mX.insert(13, 13);
+            ASSERT(1 == X.size());
+
+            MObj::ValuePtrType value;
+            ASSERT(0 == mX.tryGetValue(&value, 23));
+            ASSERT(13 == *value);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a cache, insert, look up, erase, and evict items.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(Policy::e_CLOCK, 40, 50, 4, &ta);  const Obj& X = mX;
+
+            mX.insert(1, 10);
+            mX.insert(2, 20);
+            ASSERT(2 == X.size());
+
+            ValuePtr value;
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT(10 == *value);
+            ASSERT(1 == mX.tryGetValue(&value, 3));
+
+            ASSERT(0 == mX.erase(1));
+            ASSERT(1 == X.size());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERTV(X.size(), X.size() <= 52);
+            ASSERTV(X.size(), X.size() >= 13);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // READ SCALING PERFORMANCE
+        //   Compare the time taken by concurrent 'tryGetValue' calls on a
+        //   'bdlcc::Cache' and on a 'bdlcc::StripedCache', with the LRU and
+        //   CLOCK eviction policies.  Command line parameters:
+        //   2nd parameter: number of reader threads (default 4).
+        //   3rd parameter: number of keys in the cache (default 10000).
+        //   4th parameter: number of reads per thread (default 1000000).
+        //   5th parameter: number of stripes (default 16).
+        //
+        // Concerns:
+        //: 1 Readers of a 'bdlcc::StripedCache' contend less than readers of a
+        //:   'bdlcc::Cache', and CLOCK readers less than LRU readers.
+        //
+        // Plan:
+        //: 1 Pre-load each cache and time the concurrent readers.  (C-1)
+        //
+        // Testing:
+        //   READ SCALING PERFORMANCE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "READ SCALING PERFORMANCE" << endl
+                          << "========================" << endl;
+
+        const int numThreads = argc > 2 ? atoi(argv[2]) : 4;
+        const int numKeys    = argc > 3 ? atoi(argv[3]) : 10000;
+        const int numReads   = argc > 4 ? atoi(argv[4]) : 1000000;
+        const int numStripes = argc > 5 ? atoi(argv[5]) : 16;
+
+        cout << "threads: " << numThreads
+             << ", keys: "  << numKeys
+             << ", reads per thread: " << numReads
+             << ", stripes: " << numStripes << endl;
+
+        const Policy::Enum POLICIES[] = { Policy::e_LRU, Policy::e_CLOCK };
+        const char *NAMES[] = { "LRU  ", "CLOCK" };
+
+        for (int tp = 0; tp < 2; ++tp) {
+            bdlcc::Cache<int, int> cache(POLICIES[tp],
+                                         numKeys * 2,
+                                         numKeys * 2);
+            cout << "Cache        " << NAMES[tp] << ": "
+                 << readperf::run(&cache, numThreads, numKeys, numReads)
+                 << "s" << endl;
+        }
+        for (int tp = 0; tp < 2; ++tp) {
+            Obj cache(POLICIES[tp], numKeys * 2, numKeys * 2, numStripes);
+            cout << "StripedCache " << NAMES[tp] << ": "
+                 << readperf::run(&cache, numThreads, numKeys, numReads)
+                 << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,8 +14,13 @@ BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 
 #include <bdlde_base64encoder.h>  // for testing only
 
+#include <bdlde_base64util.h>
+
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 
                 // ======================
@@ -106,6 +111,99 @@ const bool *const Base64Decoder::s_ignorableRelaxed_p =
                                             charsThatCanBeIgnoredInRelaxedMode;
 const char *const Base64Decoder::s_decoding_p = decoding;
 
+// PRIVATE MANIPULATORS
+int Base64Decoder::decodeBlocks(char       **out,
+                                const char **begin,
+                                const char  *end,
+                                int         *numEmitted,
+                                int          maxNumOut)
+{
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(begin);
+    BSLS_ASSERT(numEmitted);
+    BSLS_ASSERT(e_INPUT_STATE == d_state);
+    BSLS_ASSERT(0 == d_bitsInStack);
+
+    const char *const start = *begin;
+
+    while (true) {
+        bsl::size_t numQuanta = static_cast<bsl::size_t>(end - *begin) / 4;
+        if (0 <= maxNumOut) {
+            numQuanta = bsl::min<bsl::size_t>(numQuanta,
+                                              (maxNumOut - *numEmitted) / 3);
+        }
+
+        const bsl::size_t numDecoded = Base64Util::decodeQuanta(*out,
+                                                                *begin,
+                                                                numQuanta);
+        const int         numBytes   = static_cast<int>(numDecoded * 3);
+
+        *out        += numBytes;
+        *begin      += numDecoded * 4;
+        *numEmitted += numBytes;
+
+        // Skip any ignorable characters (typically a line break) following
+        // the decoded groups, which leave the state of this decoder unchanged,
+        // and resume bulk decoding after them.
+
+        const char *next = *begin;
+        while (next != end
+            && d_ignorable_p[static_cast<unsigned char>(*next)]) {
+            ++next;
+        }
+        if (next == *begin) {
+            break;
+        }
+        *begin = next;
+    }
+
+    return static_cast<int>(*begin - start);
+}
+
+int Base64Decoder::decodeBlocks(char **out,
+                                char **begin,
+                                char  *end,
+                                int   *numEmitted,
+                                int    maxNumOut)
+{
+    BSLS_ASSERT(begin);
+
+    const char *input    = *begin;
+    const int   numChars = decodeBlocks(out,
+                                        &input,
+                                        end,
+                                        numEmitted,
+                                        maxNumOut);
+
+    *begin += numChars;
+    return numChars;
+}
+
+// CLASS METHODS
+int Base64Decoder::decode(char       *out,
+                          int        *numOut,
+                          int        *numIn,
+                          const char *begin,
+                          const char *end,
+                          bool        unrecognizedIsErrorFlag)
+{
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(numIn);
+    BSLS_ASSERT(begin <= end);
+
+    Base64Decoder decoder(unrecognizedIsErrorFlag);
+
+    if (0 > decoder.convert(out, numOut, numIn, begin, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    int       numEndOut;
+    const int rc = decoder.endConvert(out + *numOut, &numEndOut);
+
+    *numOut += numEndOut;
+
+    return 0 > rc ? -1 : 0;
+}
 
 // CREATORS
 
@@ -153,6 +153,34 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Bulk Conversion
+///---------------
+// When 'convert' is supplied with pointers -- 'char *' output, and 'char *' or
+// 'const char *' input, which include the iterators of 'bsl::string' and
+// 'bsl::vector<char>' -- groups of four numeric Base64 characters are decoded
+// in blocks by the vectorized kernels of 'bdlde_base64util' (which use SSSE3
+// or AVX2 instructions when the running processor supports them) instead of
+// one character at a time.  Groups containing whitespace, '=', or any other
+// character are decoded one character at a time, so that the output, the
+// errors detected, and the treatment of 'maxNumOut' are unchanged.  In
+// addition, the class method 'decode' decodes an entire buffer in a single
+// call:
+//..
+//  const char  encoded[] = "QmFzZTY0";
+//  char        buffer[6];
+//  int         numOut;
+//  int         numIn;
+//
+//  assert(6 == bdlde::Base64Decoder::maxDecodedLength(8));
+//  assert(0 == bdlde::Base64Decoder::decode(buffer,
+//                                           &numOut,
+//                                           &numIn,
+//                                           encoded,
+//                                           encoded + 8));
+//  assert(6 == numOut);
+//  assert(0 == bsl::memcmp(buffer, "Base64", 6));
+//..
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Decoder' object to
@@ -453,8 +481,63 @@ class Base64Decoder {
     Base64Decoder(const Base64Decoder&);
     Base64Decoder& operator=(const Base64Decoder&);
 
+    // PRIVATE MANIPULATORS
+    template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+    int decodeBlocks(OUTPUT_ITERATOR *out,
+                     INPUT_ITERATOR  *begin,
+                     INPUT_ITERATOR   end,
+                     int             *numEmitted,
+                     int              maxNumOut);
+    int decodeBlocks(char       **out,
+                     const char **begin,
+                     const char  *end,
+                     int         *numEmitted,
+                     int          maxNumOut);
+    int decodeBlocks(char  **out,
+                     char  **begin,
+                     char   *end,
+                     int    *numEmitted,
+                     int     maxNumOut);
+        // Decode, in bulk, consecutive groups of four numeric Base64
+        // characters from the specified '*begin' position up to the specified
+        // 'end' position, stopping before the first group containing any
+        // other character, and before the specified '*numEmitted' number of
+        // bytes emitted by the current 'convert' call would exceed the
+        // specified 'maxNumOut' (unless 'maxNumOut' is negative), skipping
+        // any ignorable characters between groups, and advancing '*begin',
+        // the specified '*out', and '*numEmitted' accordingly.
+        // Return the number of input characters consumed.  The behavior is
+        // undefined unless this decoder is in the general input state and
+        // retains no bits.  Note that the overloads for pointers use the
+        // vectorized kernels of 'bdlde_base64util', and that the overload for
+        // other iterators does nothing and returns 0.
+
   public:
     // CLASS METHODS
+    static int decode(char       *out,
+                      int        *numOut,
+                      int        *numIn,
+                      const char *begin,
+                      const char *end,
+                      bool        unrecognizedIsErrorFlag = true);
+        // Decode the complete Base64 encoding starting at the specified
+        // 'begin' position up to, but not including, the specified 'end'
+        // position, writing the resulting bytes to the specified 'out'
+        // buffer.  Unrecognized characters (i.e., non-base64 characters other
+        // than whitespace) are treated as errors if the optionally specified
+        // 'unrecognizedIsErrorFlag' is 'true' (the default), and ignored
+        // otherwise.  Load into the specified 'numOut' and 'numIn' the number
+        // of output bytes produced and input characters consumed,
+        // respectively.  Return 0 on success, and -1 if the input is not a
+        // valid, complete Base64 encoding.  On error, '*numIn' counts the
+        // characters up to and including the first undecodable one (as for
+        // 'convert'), or is 'end - begin' if the input is valid but
+        // incomplete.  The behavior is undefined unless
+        // 'begin <= end' and 'out' can hold at least
+        // 'maxDecodedLength(end - begin)' bytes.  Note that the result is
+        // identical to that of a 'convert' call followed by an 'endConvert'
+        // call on a decoder created with 'unrecognizedIsErrorFlag'.
+
     static int maxDecodedLength(int inputLength);
         // Return the maximum number of decoded bytes that could result from an
         // input byte sequence of the specified 'inputLength' provided to the
@@ -600,6 +683,18 @@ Base64Decoder::Base64Decoder(bool unrecognizedIsErrorFlag)
 {
 }
 
+// PRIVATE MANIPULATORS
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+inline
+int Base64Decoder::decodeBlocks(OUTPUT_ITERATOR *,
+                                INPUT_ITERATOR  *,
+                                INPUT_ITERATOR   ,
+                                int             *,
+                                int              )
+{
+    return 0;
+}
+
 // MANIPULATORS
 template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
 int Base64Decoder::convert(OUTPUT_ITERATOR out,
@@ -648,6 +743,19 @@ int Base64Decoder::convert(OUTPUT_ITERATOR  out,
 
     if (e_INPUT_STATE == d_state) {
         while (18 >= d_bitsInStack && begin != end) {
+            if (0 == d_bitsInStack) {
+                // Decode complete groups in bulk, if the iterators permit it.
+
+                *numIn += decodeBlocks(&out,
+                                       &begin,
+                                       end,
+                                       &numEmitted,
+                                       maxNumOut);
+                if (begin == end) {
+                    break;
+                }
+            }
+
             const unsigned char byte = static_cast<unsigned char>(*begin);
 
             ++begin;
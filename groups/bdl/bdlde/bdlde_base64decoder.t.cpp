@@ -15,13 +15,17 @@
 #include <bslim_testutil.h>
 
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_iostream.h>
 #include <bsl_cstdlib.h>   // atoi()
 #include <bsl_cstring.h>   // memset()
 #include <bsl_cctype.h>    // isgraph()
 #include <bsl_climits.h>   // INT_MIN
+#include <bsl_deque.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <stdio.h>
 
@@ -175,6 +179,7 @@ using namespace bsl;  // automatically added by script
 // for the decoder; we will therefore ensure (using metafunctions) that no
 // default constructor can be instantiated.
 //-----------------------------------------------------------------------------
+// [12] static int decode(char *, int *, int *, const char *, ...);
 // [ 2] bdlde::Base64Decoder(int unrecognizedIsErrorFlag);
 // [ 3] ~bdlde::Base64Decoder();
 // [ 8] int convert(char *o, int *no, int *ni, begin, end, int mno);
@@ -210,6 +215,8 @@ using namespace bsl;  // automatically added by script
 //*[ 8] That a specified maximum output length is observed.
 //*[ 8] That surplus output beyond 'maxNumOut' is buffered properly.
 //*[10] STRESS TEST: The decoder properly decodes all encoded output.
+// [12] CONCERN: 'convert' on pointers matches other iterators.
+// [-1] PERFORMANCE: BULK CONVERSION
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1017,6 +1024,114 @@ bool isState(Obj *object, int state)
     return rv;
 }
 
+// ============================================================================
+//                    HELPER FUNCTIONS FOR BULK CONVERSION
+// ----------------------------------------------------------------------------
+
+template <class INPUT_ITERATOR>
+bsl::string decodeInSteps(bsl::vector<int> *trace,
+                          INPUT_ITERATOR    begin,
+                          INPUT_ITERATOR    end,
+                          int               length,
+                          bool              unrecognizedIsErrorFlag,
+                          int               maxNumOut)
+    // Return the output of decoding the specified 'length' characters from
+    // the specified 'begin' to the specified 'end' by a decoder created with
+    // the specified 'unrecognizedIsErrorFlag', calling 'convert' and then
+    // 'endConvert' repeatedly with the specified 'maxNumOut' limit until an
+    // error occurs or the input is consumed, and append to the specified
+    // 'trace' the status, 'numOut', 'numIn', output length, and the result
+    // of 'isAcceptable' after each call, and finally the result of 'isError'.
+{
+    Obj               decoder(unrecognizedIsErrorFlag);
+    bsl::vector<char> buffer(Obj::maxDecodedLength(length) + 1);
+    char             *out = buffer.data();
+
+    for (int i = 0; begin != end && i < 4 * length + 4; ++i) {
+        int       numOut;
+        int       numIn;
+        const int rc = decoder.convert(out,
+                                       &numOut,
+                                       &numIn,
+                                       begin,
+                                       end,
+                                       maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+        trace->push_back(numIn);
+        trace->push_back(decoder.outputLength());
+        trace->push_back(decoder.isAcceptable());
+
+        out += numOut;
+        bsl::advance(begin, numIn);
+
+        if (0 > rc) {
+            break;
+        }
+    }
+    for (int i = 0; !decoder.isError() && i < 4 * length + 4; ++i) {
+        int       numOut;
+        const int rc = decoder.endConvert(out, &numOut, maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+        trace->push_back(decoder.outputLength());
+
+        out += numOut;
+
+        if (0 >= rc) {
+            break;
+        }
+    }
+    trace->push_back(decoder.isError());
+    return bsl::string(buffer.data(), out);
+}
+
+class CharIterator {
+    // This class provides a minimal input iterator over a range of 'char',
+    // used to force 'convert' to process its input one character at a time
+    // for comparison with the bulk conversion of pointers.
+
+    // DATA
+    const char *d_ptr_p;  // current position
+
+  public:
+    // CREATORS
+    explicit CharIterator(const char *ptr)
+        // Create an iterator referring to the specified 'ptr'.
+    : d_ptr_p(ptr)
+    {
+    }
+
+    // MANIPULATORS
+    CharIterator& operator++()
+        // Advance this iterator and return a reference to it.
+    {
+        ++d_ptr_p;
+        return *this;
+    }
+
+    // ACCESSORS
+    char operator*() const
+        // Return the character referred to by this iterator.
+    {
+        return *d_ptr_p;
+    }
+
+    bool operator!=(const CharIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' do not refer
+        // to the same position, and 'false' otherwise.
+    {
+        return d_ptr_p != rhs.d_ptr_p;
+    }
+
+    bool operator==(const CharIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' refer to the
+        // same position, and 'false' otherwise.
+    {
+        return d_ptr_p == rhs.d_ptr_p;
+    }
+};
+
 // ============================================================================
 //                         SUPPORT FOR USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -1209,6 +1324,180 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(12)
+{
+        (void)veryVeryVerbose;
+        (void)veryVeryVeryVerbose;
+
+        // --------------------------------------------------------------------
+        // TESTING BULK CONVERSION AND 'decode'
+        //
+        // Concerns:
+        //: 1 'convert', when supplied with pointers (and hence decoding
+        //:   complete groups in bulk), produces the same output, consumes the
+        //:   same input, returns the same status, and leaves the decoder in
+        //:   the same state as when supplied with other iterators (which are
+        //:   decoded one character at a time), for valid input, for input
+        //:   holding whitespace, padding, and unrecognized characters at any
+        //:   position, in both error-reporting modes, and for every output
+        //:   limit.
+        //:
+        //: 2 The class method 'decode' produces the output of 'convert'
+        //:   followed by 'endConvert', and reports the same errors.
+        //
+        // Plan:
+        //: 1 Encode pseudo-random data of a set of lengths with a set of
+        //:   maximum line lengths, and derive further input by replacing one
+        //:   character of each encoding, at a set of positions, with a set of
+        //:   characters.
+        //:
+        //: 2 Decode each input in both modes by repeated calls to 'convert'
+        //:   and 'endConvert' with a set of output limits, using
+        //:   'const char *', 'char *', and 'bsl::deque<char>::const_iterator'
+        //:   input, and verify that the outputs, and the status, 'numOut',
+        //:   'numIn', 'outputLength', and 'isAcceptable' after each call, are
+        //:   the same.  (C-1)
+        //:
+        //: 3 Verify that 'decode' produces the output and status of P-2 when
+        //:   no output limit is imposed.  (C-2)
+        //
+        // Testing:
+        //   static int decode(char *, int *, int *, const char *, ...);
+        //   CONCERN: 'convert' on pointers matches other iterators.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BULK CONVERSION AND 'decode'" << endl
+                          << "====================================" << endl;
+
+        const int  LENGTHS[]      = { 0, 1, 2, 3, 5, 12, 24, 47, 48, 100,
+                                      300 };
+        const int  LINE_LENGTHS[] = { 0, 4, 76, 77 };
+        const int  MAX_NUM_OUTS[] = { -1, 1, 2, 3, 5, 13, 24, 100 };
+        const char REPLACEMENTS[] = { '!', '=', ' ', '\n', '\x80', 'A' };
+
+        const int NUM_LENGTHS      = sizeof LENGTHS / sizeof *LENGTHS;
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                                        / sizeof *LINE_LENGTHS;
+        const int NUM_MAX_NUM_OUTS = sizeof MAX_NUM_OUTS
+                                                        / sizeof *MAX_NUM_OUTS;
+        const int NUM_REPLACEMENTS = sizeof REPLACEMENTS
+                                                        / sizeof *REPLACEMENTS;
+
+        bsl::vector<char> data(300);
+        unsigned int      seed = 12345;
+        for (bsl::size_t i = 0; i < data.size(); ++i) {
+            seed    = seed * 1103515245 + 12345;
+            data[i] = static_cast<char>(seed >> 16);
+        }
+
+        bsl::vector<bsl::string> inputs;
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            for (int tj = 0; tj < NUM_LINE_LENGTHS; ++tj) {
+                const int LENGTH      = LENGTHS[ti];
+                const int LINE_LENGTH = LINE_LENGTHS[tj];
+
+                typedef bdlde::Base64Encoder Encoder;
+
+                bsl::string encoded(Encoder::encodedLength(LENGTH,
+                                                           LINE_LENGTH),
+                                    '\0');
+                Encoder::encode(&encoded[0],
+                                data.data(),
+                                data.data() + LENGTH,
+                                LINE_LENGTH);
+                inputs.push_back(encoded);
+
+                const int SIZE        = static_cast<int>(encoded.size());
+                const int POSITIONS[] = { 0, 1, 5, 17, 31, 32, 33, SIZE / 2,
+                                          SIZE - 2, SIZE - 1 };
+                const int NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS;
+
+                for (int tk = 0; tk < NUM_POSITIONS; ++tk) {
+                    const int POSITION = POSITIONS[tk];
+                    if (POSITION < 0 || POSITION >= SIZE) {
+                        continue;
+                    }
+                    for (int tl = 0; tl < NUM_REPLACEMENTS; ++tl) {
+                        bsl::string mutated(encoded);
+                        mutated[POSITION] = REPLACEMENTS[tl];
+                        inputs.push_back(mutated);
+                    }
+                }
+            }
+        }
+
+        for (bsl::size_t ti = 0; ti < inputs.size(); ++ti) {
+            const bsl::string&     INPUT  = inputs[ti];
+            const int              LENGTH = static_cast<int>(INPUT.size());
+            const bsl::deque<char> INPUT_DEQUE(INPUT.begin(), INPUT.end());
+            bsl::vector<char>      mutableInput(INPUT.begin(), INPUT.end());
+            mutableInput.push_back('\0');
+
+            for (int mode = 0; mode < 2; ++mode) {
+                const bool STRICT = 0 == mode;
+
+                bsl::vector<char> buffer(Obj::maxDecodedLength(LENGTH) + 1);
+                int               numOut = -1;
+                int               numIn  = -1;
+                const int         RC     = Obj::decode(buffer.data(),
+                                                       &numOut,
+                                                       &numIn,
+                                                       INPUT.data(),
+                                                       INPUT.data() + LENGTH,
+                                                       STRICT);
+                const bsl::string DECODED(buffer.data(), numOut);
+
+                for (int tj = 0; tj < NUM_MAX_NUM_OUTS; ++tj) {
+                    const int MAX_NUM_OUT = MAX_NUM_OUTS[tj];
+
+                    if (veryVerbose) {
+                        T_ P_(INPUT) P_(STRICT) P(MAX_NUM_OUT)
+                    }
+
+                    bsl::vector<int> expTrace;
+                    bsl::vector<int> trace;
+                    bsl::vector<int> mutableTrace;
+
+                    const bsl::string EXP = decodeInSteps(&expTrace,
+                                                          INPUT_DEQUE.begin(),
+                                                          INPUT_DEQUE.end(),
+                                                          LENGTH,
+                                                          STRICT,
+                                                          MAX_NUM_OUT);
+                    const bsl::string RESULT = decodeInSteps(
+                                                         &trace,
+                                                         INPUT.data(),
+                                                         INPUT.data() + LENGTH,
+                                                         LENGTH,
+                                                         STRICT,
+                                                         MAX_NUM_OUT);
+                    const bsl::string MUTABLE_RESULT = decodeInSteps(
+                                                  &mutableTrace,
+                                                  mutableInput.data(),
+                                                  mutableInput.data() + LENGTH,
+                                                  LENGTH,
+                                                  STRICT,
+                                                  MAX_NUM_OUT);
+
+                    LOOP3_ASSERT(ti, STRICT, MAX_NUM_OUT, EXP == RESULT);
+                    LOOP3_ASSERT(ti, STRICT, MAX_NUM_OUT, expTrace == trace);
+                    LOOP3_ASSERT(ti, STRICT, MAX_NUM_OUT,
+                                 EXP == MUTABLE_RESULT);
+                    LOOP3_ASSERT(ti, STRICT, MAX_NUM_OUT,
+                                 expTrace == mutableTrace);
+
+                    if (0 > MAX_NUM_OUT) {
+                        const bool FAILED = 0 != expTrace.back();
+
+                        LOOP2_ASSERT(ti, STRICT, FAILED == (0 > RC));
+                        LOOP2_ASSERT(ti, STRICT, EXP == DECODED);
+                    }
+                }
+            }
+        }
+}
+
 DEFINE_TEST_CASE(11)
 {
         (void)veryVeryVerbose;
@@ -5616,6 +5905,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(12);
         CASE(11);
         CASE(10);
         CASE(9);
@@ -5628,6 +5918,112 @@ int main(int argc, char *argv[])
         CASE(2);
         CASE(1);
 #undef CASE
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BULK CONVERSION
+        //
+        // Concerns:
+        //: 1 Encoding and decoding contiguous buffers (using the vectorized
+        //:   kernels of 'bdlde_base64util') is substantially faster than
+        //:   converting one character at a time.
+        //
+        // Plan:
+        //: 1 Repeatedly encode a 4 MiB buffer with lines of 76 characters,
+        //:   and decode the result, both with pointers and with a minimal
+        //:   iterator type, and report the throughput in GB/s of unencoded
+        //:   data.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BULK CONVERSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: BULK CONVERSION" << endl
+                          << "============================" << endl;
+
+        typedef bdlde::Base64Encoder Encoder;
+
+        const int NUM_ITERS = argc > 2 ? atoi(argv[2]) : 10;
+        const int LENGTH    = 4 << 20;
+
+        bsl::vector<char> data(LENGTH);
+        for (int i = 0; i < LENGTH; ++i) {
+            data[i] = static_cast<char>(i * 2654435761u >> 13);
+        }
+        const char *const BEGIN = data.data();
+        const char *const END   = BEGIN + LENGTH;
+
+        bsl::vector<char> encoded(Encoder::encodedLength(LENGTH, 76));
+        bsl::vector<char> decoded(LENGTH);
+
+        const double GIGABYTES = static_cast<double>(LENGTH) * NUM_ITERS
+                                                                       / 1e9;
+
+        cout << "Iterator     | encode (GB/s) | decode (GB/s)\n"
+             << "-------------+---------------+--------------\n";
+
+        for (int bulk = 1; bulk >= 0; --bulk) {
+            bsls::Stopwatch timer;
+
+            timer.start(true);
+            for (int i = 0; i < NUM_ITERS; ++i) {
+                Encoder encoder(76);
+                int     numOut;
+                int     numIn;
+                char   *out = encoded.data();
+                if (bulk) {
+                    encoder.convert(out, &numOut, &numIn, BEGIN, END);
+                }
+                else {
+                    encoder.convert(out,
+                                    &numOut,
+                                    &numIn,
+                                    CharIterator(BEGIN),
+                                    CharIterator(END));
+                }
+                out += numOut;
+                encoder.endConvert(out, &numOut);
+                out += numOut;
+                ASSERT(encoded.data() + encoded.size() == out);
+            }
+            timer.stop();
+            const double encodeTime = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start(true);
+            for (int i = 0; i < NUM_ITERS; ++i) {
+                Obj         decoder(true);
+                int         numOut;
+                int         numIn;
+                char       *out    = decoded.data();
+                const char *eBegin = encoded.data();
+                const char *eEnd   = eBegin + encoded.size();
+                if (bulk) {
+                    decoder.convert(out, &numOut, &numIn, eBegin, eEnd);
+                }
+                else {
+                    decoder.convert(out,
+                                    &numOut,
+                                    &numIn,
+                                    CharIterator(eBegin),
+                                    CharIterator(eEnd));
+                }
+                out += numOut;
+                decoder.endConvert(out, &numOut);
+                out += numOut;
+                ASSERT(decoded.data() + decoded.size() == out);
+            }
+            timer.stop();
+            const double decodeTime = timer.accumulatedWallTime();
+
+            ASSERT(data == decoded);
+
+            printf("%-12s | %13.2f | %13.2f\n",
+                   bulk ? "const char *" : "CharIterator",
+                   GIGABYTES / encodeTime,
+                   GIGABYTES / decodeTime);
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
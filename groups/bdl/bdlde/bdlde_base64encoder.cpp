@@ -12,8 +12,13 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
+#include <bdlde_base64util.h>
+
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 
                 // ======================
@@ -45,6 +50,112 @@ namespace bdlde {
 const char *const Base64Encoder::s_encodedChars_p       = enc;
 const int         Base64Encoder::s_defaultMaxLineLength = 76;
 
+// PRIVATE MANIPULATORS
+int Base64Encoder::encodeBlocks(char       **out,
+                                const char **begin,
+                                const char  *end,
+                                int          maxLength)
+{
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(begin);
+    BSLS_ASSERT(0 == d_bitsInStack);
+
+    if (0 != d_maxLineLength && 4 > d_maxLineLength) {
+        // Lines shorter than a quantum are left to the character-at-a-time
+        // path.
+
+        return 0;                                                     // RETURN
+    }
+
+    // 'maxLength' is less than the output length if no limit was specified
+    // (see 'convert').
+
+    const bool  isLimited = d_outputLength <= maxLength;
+    bsl::size_t numQuanta = static_cast<bsl::size_t>(end - *begin) / 3;
+    int         numIn     = 0;
+
+    while (0 < numQuanta) {
+        if (0 != d_maxLineLength) {
+            if (d_lineLength > d_maxLineLength) {
+                // Only the CR of a soft line break has been emitted.
+
+                break;
+            }
+            if (d_lineLength == d_maxLineLength) {
+                if (isLimited && 6 > maxLength - d_outputLength) {
+                    break;
+                }
+                *(*out)++ = '\r';
+                *(*out)++ = '\n';
+                d_outputLength += 2;
+                d_lineLength    = 0;
+            }
+            numQuanta = bsl::min<bsl::size_t>(
+                                       numQuanta,
+                                       (d_maxLineLength - d_lineLength) / 4);
+        }
+        if (isLimited) {
+            numQuanta = bsl::min<bsl::size_t>(
+                                           numQuanta,
+                                           (maxLength - d_outputLength) / 4);
+        }
+        if (0 == numQuanta) {
+            break;
+        }
+
+        const int numChars = static_cast<int>(
+                                 Base64Util::encodeQuanta(*out,
+                                                          *begin,
+                                                          numQuanta));
+        const int numBytes = static_cast<int>(numQuanta * 3);
+
+        *out           += numChars;
+        *begin         += numBytes;
+        numIn          += numBytes;
+        d_outputLength += numChars;
+        d_lineLength   += numChars;
+
+        numQuanta = static_cast<bsl::size_t>(end - *begin) / 3;
+    }
+
+    return numIn;
+}
+
+int Base64Encoder::encodeBlocks(char **out,
+                                char **begin,
+                                char  *end,
+                                int    maxLength)
+{
+    BSLS_ASSERT(begin);
+
+    const char *input = *begin;
+    const int   numIn = encodeBlocks(out, &input, end, maxLength);
+
+    *begin += numIn;
+    return numIn;
+}
+
+// CLASS METHODS
+int Base64Encoder::encode(char       *out,
+                          const char *begin,
+                          const char *end,
+                          int         maxLineLength)
+{
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 <= maxLineLength);
+
+    Base64Encoder encoder(maxLineLength);
+
+    int numOut;
+    int numIn;
+    encoder.convert(out, &numOut, &numIn, begin, end);
+
+    int numEndOut;
+    encoder.endConvert(out + numOut, &numEndOut);
+
+    return numOut + numEndOut;
+}
+
 // CREATORS
 Base64Encoder::~Base64Encoder()
 {
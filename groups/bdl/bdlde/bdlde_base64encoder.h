@@ -153,6 +153,25 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Bulk Conversion
+///---------------
+// When 'convert' is supplied with pointers -- 'char *' output, and 'char *' or
+// 'const char *' input, which include the iterators of 'bsl::string' and
+// 'bsl::vector<char>' -- complete 3-byte quanta are encoded in blocks by the
+// vectorized kernels of 'bdlde_base64util' (which use SSSE3 or AVX2
+// instructions when the running processor supports them) instead of one
+// character at a time.  The output, the line breaks, and the treatment of
+// 'maxNumOut' are unchanged.  In addition, the class method 'encode' encodes
+// an entire buffer, including padding, in a single call:
+//..
+//  const char  data[] = "Base64";
+//  char        buffer[8];
+//
+//  assert(8 == bdlde::Base64Encoder::encodedLength(6, 0));
+//  assert(8 == bdlde::Base64Encoder::encode(buffer, data, data + 6, 0));
+//  assert(0 == bsl::memcmp(buffer, "QmFzZTY0", 8));
+//..
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Encoder' object to
@@ -454,6 +473,31 @@ class Base64Encoder {
         // does not equal 'maxLength' at entry to this method and the internal
         // buffer contains at least one character of output.
 
+    template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+    int encodeBlocks(OUTPUT_ITERATOR *out,
+                     INPUT_ITERATOR  *begin,
+                     INPUT_ITERATOR   end,
+                     int              maxLength);
+    int encodeBlocks(char       **out,
+                     const char **begin,
+                     const char  *end,
+                     int          maxLength);
+    int encodeBlocks(char  **out,
+                     char  **begin,
+                     char   *end,
+                     int     maxLength);
+        // Encode, in bulk, as many complete 3-byte quanta from the specified
+        // '*begin' position up to the specified 'end' position as fit within
+        // the current output line (starting a new line first if necessary)
+        // and do not make the total number of emitted characters exceed the
+        // specified 'maxLength' (unless 'maxLength' is less than the number
+        // of characters emitted at entry), advancing '*begin' and the
+        // specified '*out' accordingly.  Return the number of input bytes
+        // consumed.  The behavior is undefined unless no bits are retained by
+        // this encoder.  Note that the overloads for pointers use the
+        // vectorized kernels of 'bdlde_base64util', and that the overload for
+        // other iterators does nothing and returns 0.
+
   public:
     // CLASS METHODS
     static int encodedLength(int inputLength);
@@ -493,6 +537,24 @@ class Base64Encoder {
         // Note also that the number of encoded bytes need not be the number of
         // *output* bytes.
 
+    static int encode(char       *out,
+                      const char *begin,
+                      const char *end,
+                      int         maxLineLength = 76);
+        // Encode the sequence of input bytes starting at the specified
+        // 'begin' position up to, but not including, the specified 'end'
+        // position, writing the complete Base64 encoding, including any
+        // trailing '=' characters, to the specified 'out' buffer, inserting
+        // a CRLF to prevent each output line from exceeding the optionally
+        // specified 'maxLineLength' (76, as recommended by the MIME standard,
+        // by default).  Return the number of characters written, which is
+        // 'encodedLength(end - begin, maxLineLength)'.  The behavior is
+        // undefined unless 'begin <= end', '0 <= maxLineLength', and 'out'
+        // can hold at least 'encodedLength(end - begin, maxLineLength)'
+        // characters.  Note that the output is identical to that of a
+        // 'convert' call followed by an 'endConvert' call on an encoder
+        // created with 'maxLineLength'.
+
     static bool isResidualOutput(int numBytes, int maxLineLength);
         // Return 'true' if an output sequence of the specified 'numBytes'
         // from an encoder having the specified 'maxLineLength' would be an
@@ -679,6 +741,16 @@ void Base64Encoder::encode(OUTPUT_ITERATOR *out, int maxLength)
     ++d_lineLength;
 }
 
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+inline
+int Base64Encoder::encodeBlocks(OUTPUT_ITERATOR *,
+                                INPUT_ITERATOR  *,
+                                INPUT_ITERATOR   ,
+                                int              )
+{
+    return 0;
+}
+
 // CLASS METHODS
 inline
 int Base64Encoder::encodedLength(int inputLength, int maxLineLength)
@@ -811,6 +883,15 @@ int Base64Encoder::convert(OUTPUT_ITERATOR  out,
     int tmpNumIn = 0;
 
     while (4 >= d_bitsInStack && begin != end) {
+        if (0 == d_bitsInStack) {
+            // Encode complete quanta in bulk, if the iterators permit it.
+
+            tmpNumIn += encodeBlocks(&out, &begin, end, maxLength);
+            if (begin == end) {
+                break;
+            }
+        }
+
         const unsigned char byte = static_cast<unsigned char>(*begin);
 
         ++begin;
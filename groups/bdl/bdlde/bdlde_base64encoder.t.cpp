@@ -21,7 +21,10 @@
 #include <bsl_cstring.h>   // memset()
 #include <bsl_cctype.h>    // isgraph()
 #include <bsl_climits.h>   // INT_MAX
+#include <bsl_deque.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -95,6 +98,7 @@ using namespace bsl;  // automatically added by script
 // arguments, 'bdeut::InputIterator' for 'convert' and 'bdeut::OutputIterator'
 // for both of these template methods.
 //-----------------------------------------------------------------------------
+// [14] static int encode(char *, const char *, const char *, int);
 // [ 7] static int encodedLength(int numInputBytes, int maxLineLength);
 // [10] bdlde::Base64Encoder();
 // [ 2] bdlde::Base64Encoder(int maxLineLength);
@@ -129,6 +133,7 @@ using namespace bsl;  // automatically added by script
 // [ 7] That each bit of a 2-byte quantum finds its appropriate spot.
 // [ 7] That each bit of a 1-byte quantum finds its appropriate spot.
 // [ 7] That output length is calculated properly.
+// [14] CONCERN: 'convert' on pointers matches other iterators.
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -1024,6 +1029,54 @@ int u_Base64Decoder_Test::endConvert(char *out, int *numOut, int maxNumOut)
 
 }  // close unnamed namespace
 
+// ============================================================================
+//                    HELPER FUNCTIONS FOR BULK CONVERSION
+// ----------------------------------------------------------------------------
+
+template <class INPUT_ITERATOR>
+bsl::string encodeInSteps(bsl::vector<int> *trace,
+                          INPUT_ITERATOR    begin,
+                          INPUT_ITERATOR    end,
+                          int               length,
+                          int               maxLineLength,
+                          int               maxNumOut)
+    // Return the encoding of the specified 'length' bytes from the specified
+    // 'begin' to the specified 'end' by an encoder created with the specified
+    // 'maxLineLength', calling 'convert' and then 'endConvert' repeatedly with
+    // the specified 'maxNumOut' limit, and append to the specified 'trace'
+    // the status, 'numOut', 'numIn', and output length after each call.
+{
+    Obj               encoder(maxLineLength);
+    bsl::vector<char> buffer(Obj::encodedLength(length, maxLineLength) + 1);
+    char             *out = buffer.data();
+
+    for (int i = 0; begin != end && i < 4 * length + 4; ++i) {
+        int numOut;
+        int numIn;
+        trace->push_back(encoder.convert(out,
+                                         &numOut,
+                                         &numIn,
+                                         begin,
+                                         end,
+                                         maxNumOut));
+        trace->push_back(numOut);
+        trace->push_back(numIn);
+        trace->push_back(encoder.outputLength());
+
+        out += numOut;
+        bsl::advance(begin, numIn);
+    }
+    for (int i = 0; !encoder.isDone() && i < 4 * length + 8; ++i) {
+        int numOut;
+        trace->push_back(encoder.endConvert(out, &numOut, maxNumOut));
+        trace->push_back(numOut);
+        trace->push_back(encoder.outputLength());
+
+        out += numOut;
+    }
+    return bsl::string(buffer.data(), out);
+}
+
 // ============================================================================
 //                         SUPPORT FOR USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -1220,6 +1273,132 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING BULK CONVERSION AND 'encode'
+        //
+        // Concerns:
+        //: 1 'convert', when supplied with pointers (and hence encoding
+        //:   complete quanta in bulk), produces the same output, consumes the
+        //:   same input, returns the same status, and leaves the encoder in
+        //:   the same state as when supplied with other iterators (which are
+        //:   encoded one character at a time), for every line length and
+        //:   output limit.
+        //:
+        //: 2 The class method 'encode' produces the output of 'convert'
+        //:   followed by 'endConvert', and returns 'encodedLength'.
+        //
+        // Plan:
+        //: 1 For a set of input lengths, maximum line lengths, and output
+        //:   limits, encode pseudo-random data by repeated calls to 'convert'
+        //:   and 'endConvert', using 'const char *', 'char *', and
+        //:   'bsl::deque<char>::const_iterator' input, and verify that the
+        //:   outputs, and the status, 'numOut', 'numIn', and 'outputLength'
+        //:   after each call, are the same.  (C-1)
+        //:
+        //: 2 Verify that 'encode' produces the output of P-1 when no output
+        //:   limit is imposed.  (C-2)
+        //
+        // Testing:
+        //   static int encode(char *, const char *, const char *, int);
+        //   CONCERN: 'convert' on pointers matches other iterators.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BULK CONVERSION AND 'encode'" << endl
+                          << "====================================" << endl;
+
+        const int LENGTHS[]       = { 0, 1, 2, 3, 4, 11, 12, 24, 29, 30, 31,
+                                      47, 48, 57, 58, 96, 99, 100, 255, 1000 };
+        const int LINE_LENGTHS[]  = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 16, 17, 76,
+                                      77, 100 };
+        const int MAX_NUM_OUTS[]  = { -1, 1, 2, 3, 4, 5, 6, 7, 9, 13, 32, 33,
+                                      78, 1000 };
+
+        const int NUM_LENGTHS      = sizeof LENGTHS / sizeof *LENGTHS;
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                                        / sizeof *LINE_LENGTHS;
+        const int NUM_MAX_NUM_OUTS = sizeof MAX_NUM_OUTS
+                                                        / sizeof *MAX_NUM_OUTS;
+
+        bsl::vector<char> data(1000);
+        unsigned int      seed = 12345;
+        for (bsl::size_t i = 0; i < data.size(); ++i) {
+            seed    = seed * 1103515245 + 12345;
+            data[i] = static_cast<char>(seed >> 16);
+        }
+        const bsl::deque<char> dataDeque(data.begin(), data.end());
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            const char                       *BEGIN  = data.data();
+            const char                       *END    = BEGIN + LENGTH;
+            bsl::deque<char>::const_iterator  DBEGIN = dataDeque.begin();
+            bsl::deque<char>::const_iterator  DEND   = DBEGIN + LENGTH;
+
+            for (int tj = 0; tj < NUM_LINE_LENGTHS; ++tj) {
+                const int LINE_LENGTH = LINE_LENGTHS[tj];
+
+                bsl::vector<char> buffer(
+                                   Obj::encodedLength(LENGTH, LINE_LENGTH) + 1,
+                                   '\0');
+
+                const int NUM_CHARS = Obj::encode(buffer.data(),
+                                                  BEGIN,
+                                                  END,
+                                                  LINE_LENGTH);
+                LOOP2_ASSERT(LENGTH, LINE_LENGTH,
+                     Obj::encodedLength(LENGTH, LINE_LENGTH) == NUM_CHARS);
+
+                const bsl::string ENCODED(buffer.data(), NUM_CHARS);
+
+                for (int tk = 0; tk < NUM_MAX_NUM_OUTS; ++tk) {
+                    const int MAX_NUM_OUT = MAX_NUM_OUTS[tk];
+
+                    if (veryVerbose) {
+                        T_ P_(LENGTH) P_(LINE_LENGTH) P(MAX_NUM_OUT)
+                    }
+
+                    bsl::vector<int> expTrace;
+                    bsl::vector<int> trace;
+                    bsl::vector<int> mutableTrace;
+
+                    const bsl::string EXP = encodeInSteps(&expTrace,
+                                                          DBEGIN,
+                                                          DEND,
+                                                          LENGTH,
+                                                          LINE_LENGTH,
+                                                          MAX_NUM_OUT);
+                    const bsl::string RESULT = encodeInSteps(&trace,
+                                                             BEGIN,
+                                                             END,
+                                                             LENGTH,
+                                                             LINE_LENGTH,
+                                                             MAX_NUM_OUT);
+                    const bsl::string MUTABLE_RESULT = encodeInSteps(
+                                                         &mutableTrace,
+                                                         data.begin(),
+                                                         data.begin() + LENGTH,
+                                                         LENGTH,
+                                                         LINE_LENGTH,
+                                                         MAX_NUM_OUT);
+
+                    LOOP3_ASSERT(LENGTH, LINE_LENGTH, MAX_NUM_OUT,
+                                 EXP == RESULT);
+                    LOOP3_ASSERT(LENGTH, LINE_LENGTH, MAX_NUM_OUT,
+                                 expTrace == trace);
+                    LOOP3_ASSERT(LENGTH, LINE_LENGTH, MAX_NUM_OUT,
+                                 EXP == MUTABLE_RESULT);
+                    LOOP3_ASSERT(LENGTH, LINE_LENGTH, MAX_NUM_OUT,
+                                 expTrace == mutableTrace);
+                    if (0 > MAX_NUM_OUT) {
+                        LOOP2_ASSERT(LENGTH, LINE_LENGTH, ENCODED == EXP);
+                    }
+                }
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING OPTIONAL NUMIN, NUMOUT
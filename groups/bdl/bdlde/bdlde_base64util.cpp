@@ -0,0 +1,683 @@
+// bdlde_base64util.cpp                                               -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_base64util_cpp,"$Id$ $CSID$")
+
+#include <bdlde_cpufeatures.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_log.h>
+#include <bsls_platform.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The vectorized kernels follow the approach described by Wojciech Mula and
+// Daniel Lemire in "Faster Base64 Encoding and Decoding Using AVX2
+// Instructions" (ACM Transactions on the Web, 2018).
+//
+// Encoding shuffles each 3-byte quantum into a 32-bit lane as 'b1 b0 b2 b1',
+// isolates the four 6-bit indices with two 16-bit multiplies, and translates
+// the indices to ASCII by adding an offset looked up (with 'pshufb') from the
+// range to which each index belongs.
+//
+// Decoding classifies each character by its high and low nibbles using two
+// 16-entry lookup tables whose entries have a common bit set if and only if
+// the character is *not* a numeric Base64 character, translates valid
+// characters to their 6-bit values with a third table, and packs the values
+// with 'pmaddubsw' and 'pmaddwd'.  A block containing an invalid character
+// (including '=' and whitespace) is left to the portable implementation,
+// which stops before the offending group.
+//
+// The AVX2 kernels clear the upper halves of the YMM registers with
+// 'vzeroupper' before returning or calling SSE code: the compiler does not do
+// so for functions built for a target that is not enabled on the command
+// line, and the resulting state transitions cost far more (on many processors)
+// than the work done by a call for a typical 76-character line.
+//
+// The kernels never store beyond the bytes they produce, and never read
+// beyond 'input + 3 * numQuanta' (when encoding) or 'input + 4 * numQuanta'
+// (when decoding).
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <immintrin.h>
+
+#define U_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define U_TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+
+namespace BloombergLP {
+namespace bdlde {
+
+namespace {
+
+typedef bsl::size_t (*QuantaFn)(char *, const char *, bsl::size_t);
+    // 'QuantaFn' is an alias for the type of the encoding and decoding
+    // kernels.
+
+const char k_ENCODING[] = {
+    // This table maps a 6-bit value to its Base64 encoding.
+
+//   0    1    2    3    4    5    6    7
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 000
+    'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 010
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 020
+    'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',  // 030
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',  // 040
+    'o', 'p', 'q', 'r', 's', 't', 'u', 'v',  // 050
+    'w', 'x', 'y', 'z', '0', '1', '2', '3',  // 060
+    '4', '5', '6', '7', '8', '9', '+', '/',  // 070
+};
+
+const unsigned char xx = 0xff;
+const unsigned char k_DECODING[256] = {
+    // This table maps a numeric Base64 character to its 6-bit value, and
+    // every other character to 0xff.
+
+    //  0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F
+    // --  --  --  --  --  --  --  --  --  --  --  --  --  --  --  --
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // 00
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // 10
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, 62, xx, xx, xx, 63,  // 20
+       52, 53, 54, 55, 56, 57, 58, 59, 60, 61, xx, xx, xx, xx, xx, xx,  // 30
+       xx,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,  // 40
+       15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, xx, xx, xx, xx, xx,  // 50
+       xx, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,  // 60
+       41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, xx, xx, xx, xx, xx,  // 70
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // 80
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // 90
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // A0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // B0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // C0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // D0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // E0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // F0
+};
+
+                          // ------------------------
+                          // portable implementation
+                          // ------------------------
+
+bsl::size_t encodePortable(char *out, const char *input, bsl::size_t numQuanta)
+    // Encode the specified 'numQuanta' quanta of the specified 'input' into
+    // the specified 'out', and return '4 * numQuanta'.
+{
+    const unsigned char *in = reinterpret_cast<const unsigned char *>(input);
+
+    for (bsl::size_t i = 0; i < numQuanta; ++i, in += 3, out += 4) {
+        const unsigned int bits = (in[0] << 16) | (in[1] << 8) | in[2];
+
+        out[0] = k_ENCODING[ bits >> 18        ];
+        out[1] = k_ENCODING[(bits >> 12) & 0x3f];
+        out[2] = k_ENCODING[(bits >>  6) & 0x3f];
+        out[3] = k_ENCODING[ bits        & 0x3f];
+    }
+    return 4 * numQuanta;
+}
+
+bsl::size_t decodePortable(char *out, const char *input, bsl::size_t numQuanta)
+    // Decode up to the specified 'numQuanta' groups of numeric Base64
+    // characters of the specified 'input' into the specified 'out', stopping
+    // before the first group holding another character, and return the number
+    // of groups decoded.
+{
+    const unsigned char *in = reinterpret_cast<const unsigned char *>(input);
+
+    bsl::size_t i = 0;
+    for (; i < numQuanta; ++i, in += 4, out += 3) {
+        const unsigned int a = k_DECODING[in[0]];
+        const unsigned int b = k_DECODING[in[1]];
+        const unsigned int c = k_DECODING[in[2]];
+        const unsigned int d = k_DECODING[in[3]];
+
+        if ((a | b | c | d) & 0x80) {
+            break;
+        }
+
+        const unsigned int bits = (a << 18) | (b << 12) | (c << 6) | d;
+
+        out[0] = static_cast<char>(bits >> 16);
+        out[1] = static_cast<char>(bits >>  8);
+        out[2] = static_cast<char>(bits);
+    }
+    return i;
+}
+
+#if defined(LIKE_X86_GCC)
+
+                           // ---------------------
+                           // SSSE3 implementation
+                           // ---------------------
+
+U_TARGET_SSSE3
+inline
+__m128i encodeIndicesSsse3(__m128i input)
+    // Return the 6-bit indices of the four quanta held in the low 12 bytes of
+    // the specified 'input', one index per byte.
+{
+    const __m128i in = _mm_shuffle_epi8(input,
+                                        _mm_setr_epi8(1, 0, 2, 1,
+                                                      4, 3, 5, 4,
+                                                      7, 6, 8, 7,
+                                                      10, 9, 11, 10));
+
+    // 'ac' holds indices 'a' and 'c' of each quantum in bits 10-15 and 26-31
+    // of each 32-bit lane, and 'bd' holds indices 'b' and 'd' in bits 4-9 and
+    // 16-21; the multiplies move them to the bytes in which they belong.
+
+    const __m128i ac = _mm_mulhi_epu16(
+                                 _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)),
+                                 _mm_set1_epi32(0x04000040));
+    const __m128i bd = _mm_mullo_epi16(
+                                 _mm_and_si128(in, _mm_set1_epi32(0x003f03f0)),
+                                 _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(ac, bd);
+}
+
+U_TARGET_SSSE3
+inline
+__m128i translateSsse3(__m128i indices)
+    // Return the Base64 characters encoding the specified 6-bit 'indices'.
+{
+    // Compute, for each index, the position of its range in 'offsets': 0 for
+    // [0, 25], 1 for [26, 51], 2 to 11 for [52, 61], 12 for 62 and 13 for 63.
+
+    const __m128i offsets = _mm_setr_epi8('A', 'a' - 26,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52,
+                                          '+' - 62, '/' - 63, 0, 0);
+
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    range = _mm_sub_epi8(range,
+                         _mm_cmpgt_epi8(indices, _mm_set1_epi8(25)));
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+}
+
+U_TARGET_SSSE3
+inline
+bool classifySsse3(__m128i *values, __m128i input)
+    // Load into the specified 'values' the 6-bit values of the 16 characters
+    // of the specified 'input', and return 'true' if they all are numeric
+    // Base64 characters, and 'false' otherwise (in which case 'values' is
+    // unspecified).
+{
+    const __m128i lutLo   = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                          0x11, 0x11, 0x11, 0x11,
+                                          0x11, 0x11, 0x13, 0x1A,
+                                          0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lutHi   = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                          0x04, 0x08, 0x04, 0x08,
+                                          0x10, 0x10, 0x10, 0x10,
+                                          0x10, 0x10, 0x10, 0x10);
+    const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                          0,  0,  0, 0,   0,   0,   0,   0);
+    const __m128i mask2F  = _mm_set1_epi8(0x2f);
+
+    const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(input, 4), mask2F);
+    const __m128i loNibbles = _mm_and_si128(input, mask2F);
+    const __m128i hi        = _mm_shuffle_epi8(lutHi, hiNibbles);
+    const __m128i lo        = _mm_shuffle_epi8(lutLo, loNibbles);
+
+    if (0xffff != _mm_movemask_epi8(
+                            _mm_cmpeq_epi8(_mm_and_si128(lo, hi),
+                                           _mm_setzero_si128()))) {
+        return false;                                                 // RETURN
+    }
+
+    const __m128i isSlash = _mm_cmpeq_epi8(input, mask2F);
+    const __m128i roll    = _mm_shuffle_epi8(lutRoll,
+                                             _mm_add_epi8(isSlash, hiNibbles));
+    *values = _mm_add_epi8(input, roll);
+    return true;
+}
+
+U_TARGET_SSSE3
+inline
+__m128i packSsse3(__m128i values)
+    // Return the 12 bytes decoded from the specified 16 6-bit 'values' in the
+    // low 12 bytes of the result.
+{
+    const __m128i pairs = _mm_maddubs_epi16(values,
+                                            _mm_set1_epi32(0x01400140));
+    const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(quads, _mm_setr_epi8(2, 1, 0,
+                                                 6, 5, 4,
+                                                 10, 9, 8,
+                                                 14, 13, 12,
+                                                 -1, -1, -1, -1));
+}
+
+U_TARGET_SSSE3
+inline
+void store12(char *out, __m128i bytes)
+    // Store the low 12 bytes of the specified 'bytes' into the specified
+    // 'out'.
+{
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(out), bytes);
+    const int high = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+    __builtin_memcpy(out + 8, &high, 4);
+}
+
+U_TARGET_SSSE3
+bsl::size_t encodeSsse3(char *out, const char *input, bsl::size_t numQuanta)
+    // Encode the specified 'numQuanta' quanta of the specified 'input' into
+    // the specified 'out', and return '4 * numQuanta'.
+{
+    // Each iteration encodes 4 quanta, but reads 16 bytes.
+
+    bsl::size_t i = 0;
+    for (; i + 6 <= numQuanta; i += 4, input += 12, out += 16) {
+        const __m128i in = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         translateSsse3(encodeIndicesSsse3(in)));
+    }
+    encodePortable(out, input, numQuanta - i);
+    return 4 * numQuanta;
+}
+
+U_TARGET_SSSE3
+bsl::size_t decodeSsse3(char *out, const char *input, bsl::size_t numQuanta)
+    // Decode up to the specified 'numQuanta' groups of numeric Base64
+    // characters of the specified 'input' into the specified 'out', stopping
+    // before the first group holding another character, and return the number
+    // of groups decoded.
+{
+    bsl::size_t i = 0;
+    for (; i + 4 <= numQuanta; i += 4, input += 16, out += 12) {
+        const __m128i in = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+
+        __m128i values;
+        if (!classifySsse3(&values, in)) {
+            break;
+        }
+        store12(out, packSsse3(values));
+    }
+    return i + decodePortable(out, input, numQuanta - i);
+}
+
+                           // --------------------
+                           // AVX2 implementation
+                           // --------------------
+
+U_TARGET_AVX2
+bsl::size_t encodeAvx2(char *out, const char *input, bsl::size_t numQuanta)
+    // Encode the specified 'numQuanta' quanta of the specified 'input' into
+    // the specified 'out', and return '4 * numQuanta'.
+{
+    const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1,
+                                             4, 3, 5, 4,
+                                             7, 6, 8, 7,
+                                             10, 9, 11, 10,
+                                             1, 0, 2, 1,
+                                             4, 3, 5, 4,
+                                             7, 6, 8, 7,
+                                             10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8('A', 'a' - 26,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52,
+                                             '+' - 62, '/' - 63, 0, 0,
+                                             'A', 'a' - 26,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52,
+                                             '+' - 62, '/' - 63, 0, 0);
+
+    // Each iteration encodes 8 quanta, the first 4 from the low lane and the
+    // next 4 from the high lane, but reads 28 bytes.
+
+    bsl::size_t i = 0;
+    for (; i + 10 <= numQuanta; i += 8, input += 24, out += 32) {
+        const __m128i lo = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+        const __m128i hi = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(input + 12));
+
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo),
+                                             hi,
+                                             1);
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        const __m256i ac = _mm256_mulhi_epu16(
+                           _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)),
+                           _mm256_set1_epi32(0x04000040));
+        const __m256i bd = _mm256_mullo_epi16(
+                           _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)),
+                           _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(ac, bd);
+
+        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        range = _mm256_sub_epi8(range,
+                                _mm256_cmpgt_epi8(indices,
+                                                  _mm256_set1_epi8(25)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                            _mm256_add_epi8(indices,
+                                            _mm256_shuffle_epi8(offsets,
+                                                                range)));
+    }
+    _mm256_zeroupper();
+
+    encodeSsse3(out, input, numQuanta - i);
+    return 4 * numQuanta;
+}
+
+U_TARGET_AVX2
+bsl::size_t decodeAvx2(char *out, const char *input, bsl::size_t numQuanta)
+    // Decode up to the specified 'numQuanta' groups of numeric Base64
+    // characters of the specified 'input' into the specified 'out', stopping
+    // before the first group holding another character, and return the number
+    // of groups decoded.
+{
+    const __m256i lutLo   = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                             0x11, 0x11, 0x11, 0x11,
+                                             0x11, 0x11, 0x13, 0x1A,
+                                             0x1B, 0x1B, 0x1B, 0x1A,
+                                             0x15, 0x11, 0x11, 0x11,
+                                             0x11, 0x11, 0x11, 0x11,
+                                             0x11, 0x11, 0x13, 0x1A,
+                                             0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lutHi   = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                             0x04, 0x08, 0x04, 0x08,
+                                             0x10, 0x10, 0x10, 0x10,
+                                             0x10, 0x10, 0x10, 0x10,
+                                             0x10, 0x10, 0x01, 0x02,
+                                             0x04, 0x08, 0x04, 0x08,
+                                             0x10, 0x10, 0x10, 0x10,
+                                             0x10, 0x10, 0x10, 0x10);
+    const __m256i lutRoll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                             0,  0,  0, 0,   0,   0,   0,   0,
+                                             0, 16, 19, 4, -65, -65, -71, -71,
+                                             0,  0,  0, 0,   0,   0,   0,   0);
+    const __m256i mask2F  = _mm256_set1_epi8(0x2f);
+    const __m256i pack    = _mm256_setr_epi8(2, 1, 0,
+                                             6, 5, 4,
+                                             10, 9, 8,
+                                             14, 13, 12,
+                                             -1, -1, -1, -1,
+                                             2, 1, 0,
+                                             6, 5, 4,
+                                             10, 9, 8,
+                                             14, 13, 12,
+                                             -1, -1, -1, -1);
+
+    bsl::size_t i = 0;
+    for (; i + 8 <= numQuanta; i += 8, input += 32, out += 24) {
+        const __m256i in = _mm256_loadu_si256(
+                                     reinterpret_cast<const __m256i *>(input));
+
+        const __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4),
+                                                   mask2F);
+        const __m256i loNibbles = _mm256_and_si256(in, mask2F);
+        const __m256i hi        = _mm256_shuffle_epi8(lutHi, hiNibbles);
+        const __m256i lo        = _mm256_shuffle_epi8(lutLo, loNibbles);
+
+        if (!_mm256_testz_si256(lo, hi)) {
+            break;
+        }
+
+        const __m256i isSlash = _mm256_cmpeq_epi8(in, mask2F);
+        const __m256i values  = _mm256_add_epi8(
+                                  in,
+                                  _mm256_shuffle_epi8(
+                                         lutRoll,
+                                         _mm256_add_epi8(isSlash, hiNibbles)));
+
+        const __m256i pairs = _mm256_maddubs_epi16(
+                                              values,
+                                              _mm256_set1_epi32(0x01400140));
+        const __m256i quads = _mm256_madd_epi16(
+                                              pairs,
+                                              _mm256_set1_epi32(0x00011000));
+        const __m256i bytes = _mm256_permutevar8x32_epi32(
+                                   _mm256_shuffle_epi8(quads, pack),
+                                   _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         _mm256_castsi256_si128(bytes));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + 16),
+                         _mm256_extracti128_si256(bytes, 1));
+    }
+    _mm256_zeroupper();
+
+    return i + decodeSsse3(out, input, numQuanta - i);
+}
+
+#endif  // LIKE_X86_GCC
+
+                          //=======================
+                          // class Base64Dispatcher
+                          //=======================
+
+class Base64Dispatcher {
+    // This class represents a singleton that selects, on construction, the
+    // fastest kernels supported by the running processor.
+
+    // DATA
+    QuantaFn d_encodeFn;
+    QuantaFn d_decodeFn;
+
+    // CREATORS
+    Base64Dispatcher();
+        // Create an instance of this class.
+
+    // NOT IMPLEMENTED
+    Base64Dispatcher(const Base64Dispatcher&);             // = delete;
+    Base64Dispatcher& operator=(const Base64Dispatcher&);  // = delete;
+
+  public:
+    // CLASS METHODS
+    static const Base64Dispatcher& instance();
+        // Return a reference to the singleton object.
+
+    // ACCESSORS
+    QuantaFn decodeFn() const;
+        // Return the selected decoding kernel.
+
+    QuantaFn encodeFn() const;
+        // Return the selected encoding kernel.
+};
+
+Base64Dispatcher::Base64Dispatcher()
+: d_encodeFn(&encodePortable)
+, d_decodeFn(&decodePortable)
+{
+#if defined(LIKE_X86_GCC)
+    if (CpuFeatures::isAvx2Supported()) {
+        BSLS_LOG_INFO("Using AVX2 version for Base64 conversion");
+        d_encodeFn = &encodeAvx2;
+        d_decodeFn = &decodeAvx2;
+    }
+    else if (CpuFeatures::isSsse3Supported()) {
+        BSLS_LOG_INFO("Using SSSE3 version for Base64 conversion "
+                      "(AVX2 instructions not available)");
+        d_encodeFn = &encodeSsse3;
+        d_decodeFn = &decodeSsse3;
+    }
+    else {
+        BSLS_LOG_INFO("Using software version for Base64 conversion "
+                      "(SSSE3 instructions not available)");
+    }
+#else
+    BSLS_LOG_INFO("Using software version for Base64 conversion "
+                  "(unsupported platform)");
+#endif
+}
+
+const Base64Dispatcher& Base64Dispatcher::instance()
+{
+    static const Base64Dispatcher *theInstance_p = 0;
+    BSLMT_ONCE_DO {
+        static const Base64Dispatcher theInstance;
+        theInstance_p = &theInstance;
+    }
+    return *theInstance_p;
+}
+
+inline
+QuantaFn Base64Dispatcher::decodeFn() const
+{
+    return d_decodeFn;
+}
+
+inline
+QuantaFn Base64Dispatcher::encodeFn() const
+{
+    return d_encodeFn;
+}
+
+}  // close unnamed namespace
+
+                              // -----------------
+                              // struct Base64Util
+                              // -----------------
+
+// CLASS METHODS
+bsl::size_t Base64Util::decodeQuanta(char        *out,
+                                     const char  *input,
+                                     bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out   || 0 == numQuanta);
+    BSLS_ASSERT(input || 0 == numQuanta);
+
+    return Base64Dispatcher::instance().decodeFn()(out, input, numQuanta);
+}
+
+bsl::size_t Base64Util::encodeQuanta(char        *out,
+                                     const char  *input,
+                                     bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out   || 0 == numQuanta);
+    BSLS_ASSERT(input || 0 == numQuanta);
+
+    return Base64Dispatcher::instance().encodeFn()(out, input, numQuanta);
+}
+
+                           // ----------------------
+                           // struct Base64Util_Impl
+                           // ----------------------
+
+// CLASS METHODS
+bool Base64Util_Impl::isAvx2Supported()
+{
+    return CpuFeatures::isAvx2Supported();
+}
+
+bool Base64Util_Impl::isSsse3Supported()
+{
+    return CpuFeatures::isSsse3Supported();
+}
+
+bsl::size_t Base64Util_Impl::decodeQuantaAvx2(char        *out,
+                                              const char  *input,
+                                              bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out   || 0 == numQuanta);
+    BSLS_ASSERT(input || 0 == numQuanta);
+
+#if defined(LIKE_X86_GCC)
+    if (isAvx2Supported()) {
+        return decodeAvx2(out, input, numQuanta);                     // RETURN
+    }
+#endif
+    return decodePortable(out, input, numQuanta);
+}
+
+bsl::size_t Base64Util_Impl::decodeQuantaPortable(char        *out,
+                                                  const char  *input,
+                                                  bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out   || 0 == numQuanta);
+    BSLS_ASSERT(input || 0 == numQuanta);
+
+    return decodePortable(out, input, numQuanta);
+}
+
+bsl::size_t Base64Util_Impl::decodeQuantaSsse3(char        *out,
+                                               const char  *input,
+                                               bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out   || 0 == numQuanta);
+    BSLS_ASSERT(input || 0 == numQuanta);
+
+#if defined(LIKE_X86_GCC)
+    if (isSsse3Supported()) {
+        return decodeSsse3(out, input, numQuanta);                    // RETURN
+    }
+#endif
+    return decodePortable(out, input, numQuanta);
+}
+
+bsl::size_t Base64Util_Impl::encodeQuantaAvx2(char        *out,
+                                              const char  *input,
+                                              bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out   || 0 == numQuanta);
+    BSLS_ASSERT(input || 0 == numQuanta);
+
+#if defined(LIKE_X86_GCC)
+    if (isAvx2Supported()) {
+        return encodeAvx2(out, input, numQuanta);                     // RETURN
+    }
+#endif
+    return encodePortable(out, input, numQuanta);
+}
+
+bsl::size_t Base64Util_Impl::encodeQuantaPortable(char        *out,
+                                                  const char  *input,
+                                                  bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out   || 0 == numQuanta);
+    BSLS_ASSERT(input || 0 == numQuanta);
+
+    return encodePortable(out, input, numQuanta);
+}
+
+bsl::size_t Base64Util_Impl::encodeQuantaSsse3(char        *out,
+                                               const char  *input,
+                                               bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out   || 0 == numQuanta);
+    BSLS_ASSERT(input || 0 == numQuanta);
+
+#if defined(LIKE_X86_GCC)
+    if (isSsse3Supported()) {
+        return encodeSsse3(out, input, numQuanta);                    // RETURN
+    }
+#endif
+    return encodePortable(out, input, numQuanta);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,210 @@
+// bdlde_base64util.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLDE_BASE64UTIL
+#define INCLUDED_BDLDE_BASE64UTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide vectorized block encoding and decoding of Base64 quanta.
+//
+//@CLASSES:
+//  bdlde::Base64Util     : encode and decode complete Base64 quanta in bulk
+//  bdlde::Base64Util_Impl: alternative implementations, for testing only
+//
+//@SEE_ALSO: bdlde_base64encoder, bdlde_base64decoder
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::Base64Util', that
+// supplies the low-level kernels used by 'bdlde::Base64Encoder' and
+// 'bdlde::Base64Decoder' to convert contiguous runs of complete *quanta* --
+// three bytes of data, encoded as four numeric Base64 characters -- without
+// the per-character state machine of those components.  The kernels neither
+// emit nor accept line breaks, padding ('='), or whitespace, which remain the
+// responsibility of the encoder and decoder; clients wishing to Base64-encode
+// or decode a buffer should use 'bdlde::Base64Encoder::encode' and
+// 'bdlde::Base64Decoder::decode' (or the 'convert' methods of those classes)
+// rather than this component directly.
+//
+// 'encodeQuanta' converts 'numQuanta * 3' bytes to 'numQuanta * 4' characters.
+// 'decodeQuanta' converts groups of four characters to three bytes each,
+// stopping before the first group that contains a character other than the 64
+// numeric Base64 characters, and returns the number of groups converted, so
+// that the caller can handle that group (which may hold padding, whitespace,
+// or an error) one character at a time.  Neither function writes to the
+// output beyond the bytes it produces.
+//
+// The struct 'bdlde::Base64Util_Impl' exposes each alternative implementation
+// so that they can be tested and benchmarked against one another; it should
+// not be used otherwise.
+//
+///Thread Safety
+///-------------
+// Thread safe.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// On x86 and x86-64 platforms built with a GCC-compatible compiler, the
+// kernels are implemented with SSSE3 and AVX2 instructions (encoding 12 or 24
+// bytes per iteration, respectively), in addition to a portable
+// implementation.  The implementation is selected once, on first use, by
+// querying the running processor with 'cpuid':
+//: o AVX2 is used if the processor and the operating system support it,
+//: o otherwise SSSE3 is used if the processor supports it,
+//: o otherwise the portable implementation is used.
+//
+// The portable implementation is used on all other platforms.
+//
+///Performance
+///-----------
+// See the test driver for this component in the '.t.cpp' for a benchmark, in
+// GB/s, of each implementation, and that of 'bdlde_base64decoder' for a
+// benchmark of the 'bdlde::Base64Encoder' and 'bdlde::Base64Decoder'
+// mechanisms that use them.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding Complete Quanta
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a block of data whose length is a multiple of three,
+// and we want to encode it as a single line of Base64 text.
+//
+// First, we prepare the data and a buffer for the encoded text:
+//..
+//  const char  data[] = "Base64 block"; // 12 bytes, i.e., 4 quanta
+//  char        encoded[16];
+//..
+// Then, we encode the four quanta:
+//..
+//  bsl::size_t numChars = bdlde::Base64Util::encodeQuanta(encoded, data, 4);
+//  assert(16 == numChars);
+//  assert(0  == bsl::memcmp(encoded, "QmFzZTY0IGJsb2Nr", 16));
+//..
+// Next, we decode the text back:
+//..
+//  char decoded[12];
+//
+//  bsl::size_t numGroups = bdlde::Base64Util::decodeQuanta(decoded,
+//                                                           encoded,
+//                                                           4);
+//  assert(4 == numGroups);
+//  assert(0 == bsl::memcmp(decoded, data, 12));
+//..
+// Finally, we observe that decoding stops before the first group holding a
+// character that is not a numeric Base64 character:
+//..
+//  encoded[9] = '=';
+//
+//  numGroups = bdlde::Base64Util::decodeQuanta(decoded, encoded, 4);
+//  assert(2 == numGroups);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                              // =================
+                              // struct Base64Util
+                              // =================
+
+struct Base64Util {
+    // This 'struct' provides a namespace for functions that convert complete
+    // Base64 quanta, using the fastest implementation supported by the
+    // running processor.
+
+    // CLASS METHODS
+    static bsl::size_t decodeQuanta(char        *out,
+                                    const char  *input,
+                                    bsl::size_t  numQuanta);
+        // Decode, into the specified 'out' buffer, consecutive groups of four
+        // numeric Base64 characters from the specified 'input', up to the
+        // specified 'numQuanta' groups, stopping before the first group that
+        // contains any other character.  Return the number of groups decoded,
+        // each resulting in three bytes written to 'out'.  The behavior is
+        // undefined unless 'input' has at least '4 * numQuanta' characters and
+        // 'out' can hold at least '3 * numQuanta' bytes.
+
+    static bsl::size_t encodeQuanta(char        *out,
+                                    const char  *input,
+                                    bsl::size_t  numQuanta);
+        // Encode, into the specified 'out' buffer, the specified 'numQuanta'
+        // 3-byte quanta of the specified 'input' as '4 * numQuanta' Base64
+        // characters, without line breaks, and return '4 * numQuanta'.  The
+        // behavior is undefined unless 'input' has at least '3 * numQuanta'
+        // bytes and 'out' can hold at least '4 * numQuanta' characters.
+};
+
+                           // ======================
+                           // struct Base64Util_Impl
+                           // ======================
+
+struct Base64Util_Impl {
+    // This 'struct' provides the alternative implementations of the functions
+    // of 'Base64Util'.  Each function has the contract of the 'Base64Util'
+    // function of the same name, and a function requiring instructions that
+    // are not supported by the running processor uses the portable
+    // implementation instead.
+
+    // CLASS METHODS
+    static bool isAvx2Supported();
+        // Return 'true' if the running processor and operating system support
+        // AVX2 instructions and this component was built to use them, and
+        // 'false' otherwise.
+
+    static bool isSsse3Supported();
+        // Return 'true' if the running processor supports SSSE3 instructions
+        // and this component was built to use them, and 'false' otherwise.
+
+    static bsl::size_t decodeQuantaAvx2(char        *out,
+                                        const char  *input,
+                                        bsl::size_t  numQuanta);
+    static bsl::size_t decodeQuantaPortable(char        *out,
+                                            const char  *input,
+                                            bsl::size_t  numQuanta);
+    static bsl::size_t decodeQuantaSsse3(char        *out,
+                                         const char  *input,
+                                         bsl::size_t  numQuanta);
+        // Decode, into the specified 'out' buffer, consecutive groups of four
+        // numeric Base64 characters from the specified 'input', up to the
+        // specified 'numQuanta' groups, stopping before the first group that
+        // contains any other character, and return the number of groups
+        // decoded.  See 'Base64Util::decodeQuanta'.
+
+    static bsl::size_t encodeQuantaAvx2(char        *out,
+                                        const char  *input,
+                                        bsl::size_t  numQuanta);
+    static bsl::size_t encodeQuantaPortable(char        *out,
+                                            const char  *input,
+                                            bsl::size_t  numQuanta);
+    static bsl::size_t encodeQuantaSsse3(char        *out,
+                                         const char  *input,
+                                         bsl::size_t  numQuanta);
+        // Encode, into the specified 'out' buffer, the specified 'numQuanta'
+        // 3-byte quanta of the specified 'input' as '4 * numQuanta' Base64
+        // characters, and return '4 * numQuanta'.  See
+        // 'Base64Util::encodeQuanta'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
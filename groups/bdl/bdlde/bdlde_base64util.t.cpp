@@ -0,0 +1,698 @@
+// bdlde_base64util.t.cpp                                             -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides kernels that encode and decode complete
+// Base64 quanta, with a portable, an SSSE3, and an AVX2 implementation, and a
+// dispatching function selecting one of them at run time.  We verify the
+// portable implementation against an independent, bit-by-bit oracle, and each
+// other implementation (including the dispatching one) against the portable
+// one, for every input length up to several vector widths, every input
+// alignment, every byte value, and (for decoding) every character value at
+// every position of a block.  We also verify that no implementation writes
+// beyond the bytes it produces.
+//
+// Performance
+// -----------
+// Case -1 measures the throughput of each implementation, in GB/s of
+// (unencoded) data, on a 4 MiB buffer.  The following figures were obtained
+// on a Linux x86-64 machine supporting AVX2 (GCC 12, '-O2'):
+//..
+//  Implementation | encode (GB/s) | decode (GB/s)
+//  ---------------+---------------+--------------
+//  portable       |          0.89 |          0.96
+//  SSSE3          |          4.72 |          3.31
+//  AVX2           |          7.98 |          6.38
+//..
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] size_t Base64Util::decodeQuanta(char *, const char *, size_t);
+// [ 2] size_t Base64Util::encodeQuanta(char *, const char *, size_t);
+// [ 1] bool Base64Util_Impl::isAvx2Supported();
+// [ 1] bool Base64Util_Impl::isSsse3Supported();
+// [ 3] size_t Base64Util_Impl::decodeQuantaAvx2(char *, const ...);
+// [ 3] size_t Base64Util_Impl::decodeQuantaPortable(char *, const ...);
+// [ 3] size_t Base64Util_Impl::decodeQuantaSsse3(char *, const ...);
+// [ 2] size_t Base64Util_Impl::encodeQuantaAvx2(char *, const ...);
+// [ 2] size_t Base64Util_Impl::encodeQuantaPortable(char *, const ...);
+// [ 2] size_t Base64Util_Impl::encodeQuantaSsse3(char *, const ...);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE: THROUGHPUT OF EACH IMPLEMENTATION
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Base64Util      Util;
+typedef bdlde::Base64Util_Impl Impl;
+
+typedef bsl::size_t (*QuantaFn)(char *, const char *, bsl::size_t);
+
+struct Implementation {
+    const char *d_name;
+    QuantaFn    d_encodeFn;
+    QuantaFn    d_decodeFn;
+};
+
+const Implementation IMPLEMENTATIONS[] = {
+    { "portable", &Impl::encodeQuantaPortable, &Impl::decodeQuantaPortable },
+    { "SSSE3",    &Impl::encodeQuantaSsse3,    &Impl::decodeQuantaSsse3    },
+    { "AVX2",     &Impl::encodeQuantaAvx2,     &Impl::decodeQuantaAvx2     },
+    { "default",  &Util::encodeQuanta,         &Util::decodeQuanta         },
+};
+const int NUM_IMPLEMENTATIONS = sizeof IMPLEMENTATIONS
+                                                     / sizeof *IMPLEMENTATIONS;
+
+const char SENTINEL = '\x5a';
+
+// ============================================================================
+//                            HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+void fillRandom(bsl::vector<char> *buffer, unsigned int seed)
+    // Load pseudo-random bytes, generated from the specified 'seed', into the
+    // specified 'buffer'.
+{
+    for (bsl::size_t i = 0; i < buffer->size(); ++i) {
+        seed         = seed * 1103515245 + 12345;
+        (*buffer)[i] = static_cast<char>(seed >> 16);
+    }
+}
+
+char oracleEncode(int value)
+    // Return the Base64 character encoding the specified 6-bit 'value'.
+{
+    return value < 26 ? static_cast<char>('A' + value)
+         : value < 52 ? static_cast<char>('a' + value - 26)
+         : value < 62 ? static_cast<char>('0' + value - 52)
+         : value == 62 ? '+'
+         : '/';
+}
+
+int oracleDecode(unsigned char character)
+    // Return the 6-bit value encoded by the specified 'character', or -1 if
+    // 'character' is not a numeric Base64 character.
+{
+    for (int value = 0; value < 64; ++value) {
+        if (oracleEncode(value) == static_cast<char>(character)) {
+            return value;                                             // RETURN
+        }
+    }
+    return -1;
+}
+
+void oracleEncodeQuanta(char *out, const char *input, bsl::size_t numQuanta)
+    // Encode the specified 'numQuanta' quanta of the specified 'input' into
+    // the specified 'out', one bit at a time.
+{
+    for (bsl::size_t i = 0; i < numQuanta * 4; ++i) {
+        int value = 0;
+        for (bsl::size_t bit = i * 6; bit < i * 6 + 6; ++bit) {
+            const int byte = static_cast<unsigned char>(input[bit / 8]);
+            value = (value << 1) | ((byte >> (7 - bit % 8)) & 1);
+        }
+        out[i] = oracleEncode(value);
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Encoding and Decoding Complete Quanta
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a block of data whose length is a multiple of three,
+// and we want to encode it as a single line of Base64 text.
+//
+// First, we prepare the data and a buffer for the encoded text:
+//..
+    const char  data[] = "Base64 block"; // 12 bytes, i.e., 4 quanta
+    char        encoded[16];
+//..
+// Then, we encode the four quanta:
+//..
+    bsl::size_t numChars = bdlde::Base64Util::encodeQuanta(encoded, data, 4);
+    ASSERT(16 == numChars);
+    ASSERT(0  == bsl::memcmp(encoded, "QmFzZTY0IGJsb2Nr", 16));
+//..
+// Next, we decode the text back:
+//..
+    char decoded[12];
+
+    bsl::size_t numGroups = bdlde::Base64Util::decodeQuanta(decoded,
+                                                             encoded,
+                                                             4);
+    ASSERT(4 == numGroups);
+    ASSERT(0 == bsl::memcmp(decoded, data, 12));
+//..
+// Finally, we observe that decoding stops before the first group holding a
+// character that is not a numeric Base64 character:
+//..
+    encoded[9] = '=';
+
+    numGroups = bdlde::Base64Util::decodeQuanta(decoded, encoded, 4);
+    ASSERT(2 == numGroups);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'decodeQuanta'
+        //
+        // Concerns:
+        //: 1 Each implementation decodes every group of numeric Base64
+        //:   characters as the inverse of 'encodeQuanta'.
+        //:
+        //: 2 Each implementation stops before the first group holding a
+        //:   character that is not numeric, for every character value at
+        //:   every position, and decodes the preceding groups correctly.
+        //:
+        //: 3 No implementation reads or writes beyond its bounds, or writes
+        //:   beyond the bytes it produces, for any length and alignment.
+        //
+        // Plan:
+        //: 1 For each implementation, for each number of groups up to 80, and
+        //:   each alignment of the input and output, decode the portable
+        //:   encoding of pseudo-random data into a buffer filled with a
+        //:   sentinel, and verify the result, the return value, and that the
+        //:   sentinel is intact beyond the output.  (C-1, 3)
+        //:
+        //: 2 For each implementation, each character value, and each position
+        //:   of a 48-group block, replace the character at that position and
+        //:   verify the return value, the decoded groups, and that the
+        //:   sentinel is intact beyond them.  (C-2..3)
+        //
+        // Testing:
+        //   size_t Base64Util::decodeQuanta(char *, const char *, size_t);
+        //   size_t Base64Util_Impl::decodeQuantaAvx2(char *, const ...);
+        //   size_t Base64Util_Impl::decodeQuantaPortable(char *, const ...);
+        //   size_t Base64Util_Impl::decodeQuantaSsse3(char *, const ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'decodeQuanta'" << endl
+                          << "======================" << endl;
+
+        const bsl::size_t MAX_QUANTA = 80;
+
+        bsl::vector<char> data(MAX_QUANTA * 3);
+        fillRandom(&data, 7);
+
+        bsl::vector<char> encoded(MAX_QUANTA * 4 + 32);
+        Impl::encodeQuantaPortable(encoded.data(), data.data(), MAX_QUANTA);
+
+        if (verbose) cout << "\nTesting lengths and alignments." << endl;
+
+        for (int ti = 0; ti < NUM_IMPLEMENTATIONS; ++ti) {
+            const Implementation& IMPL = IMPLEMENTATIONS[ti];
+
+            for (bsl::size_t n = 0; n <= MAX_QUANTA; ++n) {
+                for (int align = 0; align < 32; align += 5) {
+                    if (veryVerbose) { T_ P_(IMPL.d_name) P_(n) P(align) }
+
+                    // Place the input at the end of its buffer so that any
+                    // read beyond it is caught by tools detecting such reads.
+
+                    bsl::vector<char> in(n * 4 + align);
+                    bsl::memcpy(in.data() + align, encoded.data(), n * 4);
+
+                    bsl::vector<char> out(n * 3 + align + 32, SENTINEL);
+
+                    const bsl::size_t RC = IMPL.d_decodeFn(out.data() + align,
+                                                           in.data() + align,
+                                                           n);
+                    LOOP3_ASSERT(IMPL.d_name, n, align, n == RC);
+                    LOOP3_ASSERT(IMPL.d_name, n, align,
+                                 0 == bsl::memcmp(out.data() + align,
+                                                  data.data(),
+                                                  n * 3));
+                    for (bsl::size_t i = align + n * 3; i < out.size(); ++i) {
+                        LOOP4_ASSERT(IMPL.d_name, n, align, i,
+                                     SENTINEL == out[i]);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting every character at every position."
+                          << endl;
+
+        const bsl::size_t NUM_GROUPS = 48;
+
+        for (int ti = 0; ti < NUM_IMPLEMENTATIONS; ++ti) {
+            const Implementation& IMPL = IMPLEMENTATIONS[ti];
+
+            for (int c = 0; c < 256; ++c) {
+                const int  VALUE    = oracleDecode(
+                                               static_cast<unsigned char>(c));
+                const bool IS_VALID = 0 <= VALUE;
+
+                for (bsl::size_t pos = 0; pos < NUM_GROUPS * 4; ++pos) {
+                    bsl::vector<char> in(encoded.data(),
+                                         encoded.data() + NUM_GROUPS * 4);
+                    in[pos] = static_cast<char>(c);
+
+                    bsl::vector<char> out(NUM_GROUPS * 3 + 32, SENTINEL);
+
+                    const bsl::size_t RC  = IMPL.d_decodeFn(out.data(),
+                                                            in.data(),
+                                                            NUM_GROUPS);
+                    const bsl::size_t EXP = IS_VALID ? NUM_GROUPS : pos / 4;
+
+                    LOOP4_ASSERT(IMPL.d_name, c, pos, RC, EXP == RC);
+
+                    // Compare with the portable implementation, whose groups
+                    // are verified by the oracle in the breathing test, and
+                    // the unmodified groups with the original data.
+
+                    bsl::vector<char> expOut(NUM_GROUPS * 3 + 32, SENTINEL);
+                    Impl::decodeQuantaPortable(expOut.data(),
+                                               in.data(),
+                                               NUM_GROUPS);
+                    LOOP3_ASSERT(IMPL.d_name, c, pos, expOut == out);
+
+                    const bsl::size_t SAME = bsl::min(RC, pos / 4) * 3;
+                    LOOP3_ASSERT(IMPL.d_name, c, pos,
+                                 0 == bsl::memcmp(out.data(),
+                                                  data.data(),
+                                                  SAME));
+                    for (bsl::size_t i = RC * 3; i < out.size(); ++i) {
+                        LOOP4_ASSERT(IMPL.d_name, c, pos, i,
+                                     SENTINEL == out[i]);
+                    }
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'encodeQuanta'
+        //
+        // Concerns:
+        //: 1 Each implementation encodes every quantum as specified by RFC
+        //:   4648, for every byte value.
+        //:
+        //: 2 Each implementation returns '4 * numQuanta'.
+        //:
+        //: 3 No implementation reads or writes beyond its bounds, for any
+        //:   length and alignment.
+        //
+        // Plan:
+        //: 1 For each implementation, for each number of quanta up to 100,
+        //:   and each alignment of the input and output, encode pseudo-random
+        //:   data into a buffer filled with a sentinel, and verify the result
+        //:   against a bit-by-bit oracle, the return value, and that the
+        //:   sentinel is intact beyond the output.  (C-1..3)
+        //:
+        //: 2 For each implementation, encode the 768 bytes in which each byte
+        //:   value appears at each offset within a quantum, and verify the
+        //:   result against the oracle.  (C-1)
+        //
+        // Testing:
+        //   size_t Base64Util::encodeQuanta(char *, const char *, size_t);
+        //   size_t Base64Util_Impl::encodeQuantaAvx2(char *, const ...);
+        //   size_t Base64Util_Impl::encodeQuantaPortable(char *, const ...);
+        //   size_t Base64Util_Impl::encodeQuantaSsse3(char *, const ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'encodeQuanta'" << endl
+                          << "======================" << endl;
+
+        const bsl::size_t MAX_QUANTA = 100;
+
+        bsl::vector<char> data(MAX_QUANTA * 3);
+        fillRandom(&data, 3);
+
+        bsl::vector<char> expected(MAX_QUANTA * 4);
+        oracleEncodeQuanta(expected.data(), data.data(), MAX_QUANTA);
+
+        if (verbose) cout << "\nTesting lengths and alignments." << endl;
+
+        for (int ti = 0; ti < NUM_IMPLEMENTATIONS; ++ti) {
+            const Implementation& IMPL = IMPLEMENTATIONS[ti];
+
+            for (bsl::size_t n = 0; n <= MAX_QUANTA; ++n) {
+                for (int align = 0; align < 32; align += 3) {
+                    if (veryVerbose) { T_ P_(IMPL.d_name) P_(n) P(align) }
+
+                    bsl::vector<char> in(n * 3 + align);
+                    bsl::memcpy(in.data() + align, data.data(), n * 3);
+
+                    bsl::vector<char> out(n * 4 + align + 32, SENTINEL);
+
+                    const bsl::size_t RC = IMPL.d_encodeFn(out.data() + align,
+                                                           in.data() + align,
+                                                           n);
+                    LOOP3_ASSERT(IMPL.d_name, n, align, 4 * n == RC);
+                    LOOP3_ASSERT(IMPL.d_name, n, align,
+                                 0 == bsl::memcmp(out.data() + align,
+                                                  expected.data(),
+                                                  n * 4));
+                    for (bsl::size_t i = align + n * 4; i < out.size(); ++i) {
+                        LOOP4_ASSERT(IMPL.d_name, n, align, i,
+                                     SENTINEL == out[i]);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting every byte value." << endl;
+
+        bsl::vector<char> bytes(768);
+        for (int i = 0; i < 768; ++i) {
+            bytes[i] = static_cast<char>(i / 3 + (i % 3) * 85);
+        }
+        bsl::vector<char> expBytes(1024);
+        oracleEncodeQuanta(expBytes.data(), bytes.data(), 256);
+
+        for (int ti = 0; ti < NUM_IMPLEMENTATIONS; ++ti) {
+            const Implementation& IMPL = IMPLEMENTATIONS[ti];
+
+            bsl::vector<char> out(1024);
+            IMPL.d_encodeFn(out.data(), bytes.data(), 256);
+            LOOP_ASSERT(IMPL.d_name, expBytes == out);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode and decode the test vectors of RFC 4648 having complete
+        //:   quanta, with each implementation.
+        //:
+        //: 2 Verify that the portable decoding of every group of a set of
+        //:   characters matches the oracle.
+        //:
+        //: 3 Report the instruction sets supported.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   bool Base64Util_Impl::isAvx2Supported();
+        //   bool Base64Util_Impl::isSsse3Supported();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        if (verbose) {
+            P_(Impl::isSsse3Supported()) P(Impl::isAvx2Supported())
+        }
+
+        // AVX2 implies SSSE3.
+
+        ASSERT(!Impl::isAvx2Supported() || Impl::isSsse3Supported());
+
+        static const struct {
+            int         d_line;
+            const char *d_data_p;
+            const char *d_encoded_p;
+        } DATA[] = {
+            //LINE  DATA                           ENCODED
+            //----  -----------------------------  --------------------------
+            { L_,   "",                            ""                        },
+            { L_,   "foo",                         "Zm9v"                    },
+            { L_,   "foobar",                      "Zm9vYmFy"                },
+            { L_,   "\xfb\xff\xbf",                "+/+/"                    },
+            { L_,   "0123456789abcdefghijklmnopqr"
+                    "stuvwxyzABCDEFGHIJKLMNOPQRST",
+                                                   "MDEyMzQ1Njc4OWFiY2RlZmdo"
+                                                   "aWprbG1ub3BxcnN0dXZ3eHl6"
+                                                   "QUJDREVGR0hJSktMTU5PUFFS"
+                                                   "U1Q="                    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_IMPLEMENTATIONS; ++ti) {
+            const Implementation& IMPL = IMPLEMENTATIONS[ti];
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE    = DATA[tj].d_line;
+                const char *const INPUT   = DATA[tj].d_data_p;
+                const char *const ENCODED = DATA[tj].d_encoded_p;
+
+                // Only the complete quanta are converted.
+
+                const bsl::size_t N = bsl::strlen(INPUT) / 3;
+
+                char buffer[128];
+
+                LOOP2_ASSERT(IMPL.d_name, LINE,
+                             4 * N == IMPL.d_encodeFn(buffer, INPUT, N));
+                LOOP2_ASSERT(IMPL.d_name, LINE,
+                             0 == bsl::memcmp(buffer, ENCODED, 4 * N));
+
+                LOOP2_ASSERT(IMPL.d_name, LINE,
+                             N == IMPL.d_decodeFn(buffer, ENCODED, N));
+                LOOP2_ASSERT(IMPL.d_name, LINE,
+                             0 == bsl::memcmp(buffer, INPUT, 3 * N));
+            }
+        }
+
+        const char CHARS[] = "AZaz09+/=-_ \n\x80\xff";
+        for (int i = 0; CHARS[i]; ++i) {
+            for (int j = 0; CHARS[j]; ++j) {
+                const char GROUP[] = { 'Q', CHARS[i], 'g', CHARS[j] };
+                const int  A       = oracleDecode('Q');
+                const int  B       = oracleDecode(
+                                       static_cast<unsigned char>(CHARS[i]));
+                const int  C       = oracleDecode('g');
+                const int  D       = oracleDecode(
+                                       static_cast<unsigned char>(CHARS[j]));
+
+                char              buffer[3];
+                const bsl::size_t RC = Impl::decodeQuantaPortable(buffer,
+                                                                  GROUP,
+                                                                  1);
+                if (0 > B || 0 > D) {
+                    LOOP2_ASSERT(i, j, 0 == RC);
+                    continue;
+                }
+
+                const int BITS = (A << 18) | (B << 12) | (C << 6) | D;
+                LOOP2_ASSERT(i, j, 1 == RC);
+                LOOP2_ASSERT(i, j, static_cast<char>(BITS >> 16) == buffer[0]);
+                LOOP2_ASSERT(i, j, static_cast<char>(BITS >>  8) == buffer[1]);
+                LOOP2_ASSERT(i, j, static_cast<char>(BITS)       == buffer[2]);
+            }
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT OF EACH IMPLEMENTATION
+        //
+        // Concerns:
+        //: 1 The vectorized implementations are substantially faster than the
+        //:   portable one.
+        //
+        // Plan:
+        //: 1 For each implementation, repeatedly encode and decode a 4 MiB
+        //:   buffer, and report the throughput in GB/s of unencoded data.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: THROUGHPUT OF EACH IMPLEMENTATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: THROUGHPUT OF EACH IMPLEMENTATION"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        const bsl::size_t NUM_QUANTA = (4 << 20) / 3;
+        const int         NUM_ITERS  = argc > 2 ? atoi(argv[2]) : 50;
+
+        bsl::vector<char> data(NUM_QUANTA * 3);
+        fillRandom(&data, 11);
+
+        bsl::vector<char> encoded(NUM_QUANTA * 4);
+        bsl::vector<char> decoded(NUM_QUANTA * 3);
+
+        cout << "Implementation | encode (GB/s) | decode (GB/s)\n"
+             << "---------------+---------------+--------------\n";
+
+        for (int ti = 0; ti < NUM_IMPLEMENTATIONS; ++ti) {
+            const Implementation& IMPL = IMPLEMENTATIONS[ti];
+
+            bsls::Stopwatch timer;
+
+            timer.start(true);
+            for (int i = 0; i < NUM_ITERS; ++i) {
+                IMPL.d_encodeFn(encoded.data(), data.data(), NUM_QUANTA);
+            }
+            timer.stop();
+            const double encodeTime = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start(true);
+            for (int i = 0; i < NUM_ITERS; ++i) {
+                ASSERT(NUM_QUANTA == IMPL.d_decodeFn(decoded.data(),
+                                                     encoded.data(),
+                                                     NUM_QUANTA));
+            }
+            timer.stop();
+            const double decodeTime = timer.accumulatedWallTime();
+
+            ASSERT(data == decoded);
+
+            const double GIGABYTES = static_cast<double>(data.size())
+                                   * NUM_ITERS / 1e9;
+
+            printf("%-14s | %13.2f | %13.2f\n",
+                   IMPL.d_name,
+                   GIGABYTES / encodeTime,
+                   GIGABYTES / decodeTime);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -13,6 +13,7 @@
 BSLS_IDENT("$Id$ $CSID$")
 
 #include <bdlde_charconvertstatus.h>
+#include <bdlde_utf8util.h>
 
 #include <bsla_maybeunused.h>
 #include <bslmf_assert.h>
@@ -325,13 +326,21 @@ struct Capacity {
     void operator--() { --d_capacity; }
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
+
+    bsl::size_t clip(bsl::size_t numWords) const
+        // Return the lesser of the specified 'numWords' and the number of
+        // words that can be output while leaving room for the terminating
+        // null word.  The behavior is undefined unless '1 <= d_capacity'.
+    {
+        return bsl::min(numWords, d_capacity - 1);
+    }
 };
 
 struct NoOpCapacity {
@@ -345,12 +354,15 @@ struct NoOpCapacity {
     void operator--() {}
         // No-op.
 
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
         // No-op.
 
     // ACCESSORS
     bool operator<(bsl::size_t) const { return false; }
         // Return 'false'.
+
+    bsl::size_t clip(bsl::size_t numWords) const { return numWords; }
+        // Return the specified 'numWords'.
 };
 
 // LOCAL HELPER STRUCT
@@ -418,6 +430,18 @@ struct Utf8 {
             }
         }
 
+        bsl::size_t numSingleOctets(const OctetType *position) const
+            // Return the number of consecutive single octets beginning at the
+            // specified 'position' and prior to 'd_end'.  The behavior is
+            // undefined unless 'position <= d_end'.
+        {
+            BSLS_ASSERT(d_end >= position);
+
+            return BloombergLP::bdlde::Utf8Util::asciiPrefixLength(
+                                   reinterpret_cast<const char *>(position),
+                                   d_end - position);
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets' that are prior to
@@ -479,6 +503,14 @@ struct Utf8 {
             return 0 == *position;
         }
 
+        bsl::size_t numSingleOctets(const OctetType *) const
+            // Return 0.  Note that finding the end of a run of single octets
+            // would cost as much as translating them one at a time, because
+            // the end of input must be checked for at every octet.
+        {
+            return 0;
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets'.  The behavior is
@@ -1041,8 +1073,15 @@ bsl::size_t utf16BufferLength(const char  *srcBuffer,
                                           static_cast<const void*>(srcBuffer));
     while (!endFunctor.isFinished(octets)) {
         if      (Utf8::isSingleOctet(     *octets)) {
-            ++octets;
-            ++wordsNeeded;
+            const bsl::size_t numSingle = endFunctor.numSingleOctets(octets);
+            if (numSingle) {
+                octets      += numSingle;
+                wordsNeeded += numSingle;
+            }
+            else {
+                ++octets;
+                ++wordsNeeded;
+            }
         }
         else if (Utf8::isTwoOctetHeader(  *octets)) {
             octets += endFunctor.verifyContinuations(octets + 1, 1) ? 2 : 1;
@@ -1166,9 +1205,25 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
             break;
         }
 
-        // Single-octet case is simple and quick.
+        // Single-octet case is simple and quick.  If the end functor can find
+        // the length of a run of them cheaply, translate the whole run (or as
+        // much as fits) without checking for space and end of input at every
+        // octet.
 
         if (Utf8::isSingleOctet(*octets)) {
+            const bsl::size_t numSingle = dstCapacity.clip(
+                                          endFunctor.numSingleOctets(octets));
+            if (numSingle) {
+                for (bsl::size_t i = 0; i < numSingle; ++i) {
+                    dstBuffer[i] = SWAPPER::encodeSingleWord(octets[i]);
+                }
+                octets      += numSingle;
+                dstBuffer   += numSingle;
+                dstCapacity -= numSingle;
+                nCodePoints += numSingle;
+                continue;
+            }
+
             if (dstCapacity < 2) {
                 // Are we out of output room, with only space for the null?
 
@@ -128,8 +128,9 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
-// [15] USAGE EXAMPLE 2
-// [14] USAGE EXAMPLE 1
+// [16] USAGE EXAMPLE 2
+// [15] USAGE EXAMPLE 1
+// [14] TRANSLATING RUNS OF ASCII
 // [13] BACKWARDS BYTE ORDER TEST
 // [12] EMBEDDED ZEROES TEST
 // [11] UTF-16 -> UTF-8: THOROUGH BROKEN GLASS TEST
@@ -4448,7 +4449,7 @@ int main(int argc, char**argv)
     bslma::DefaultAllocatorGuard daGuard(&da);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         // --------------------------------------------------------------------
@@ -4575,6 +4576,120 @@ int main(int argc, char**argv)
 //..
       } break;
       case 14: {
+        // --------------------------------------------------------------------
+        // TRANSLATING RUNS OF ASCII
+        //
+        // Concerns:
+        //: 1 Runs of single octets in length-delimited input, which are
+        //:   translated a run at a time, are translated exactly as they are
+        //:   in null-terminated input, which is translated one octet at a
+        //:   time, in both byte orders.
+        //:
+        //: 2 A run is cut short by the capacity of the output, which is never
+        //:   overrun, and leaves room for the terminating null word.
+        //
+        // Plan:
+        //: 1 For a variety of lengths of ASCII text, with and without a
+        //:   multi-octet code point at various positions, translate the text
+        //:   into buffers of every capacity up to its length, in both byte
+        //:   orders, from both a 'StringRef' and a null-terminated string, and
+        //:   verify that the results are identical, and that the words after
+        //:   those written are unchanged.  (C-1..2)
+        //
+        // Testing:
+        //    utf8ToUtf16(unsigned short *, size_t, const StringRef&, ...)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TRANSLATING RUNS OF ASCII\n"
+                             "=========================\n";
+
+        enum { k_MAX_LEN = 100, k_BUF_LEN = k_MAX_LEN + 4 };
+
+        const unsigned short SENTINEL = 0xdead;
+
+        const int LENGTHS[] = { 0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33,
+                                47, 63, 64, 65, 95, 100 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const bdlde::ByteOrder::Enum ORDERS[] = { bdlde::ByteOrder::e_HOST,
+                                                  e_BACKWARDS };
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const int LEN = LENGTHS[li];
+
+            for (int pi = 0; pi < 5; ++pi) {
+                // 'pos' is the position of a 2-octet code point, if any,
+                // which is truncated if it is at the end of the input.
+
+                const int pos = 0 == pi ? -1
+                              : 1 == pi ? 0
+                              : 2 == pi ? LEN / 2
+                              : 3 == pi ? LEN - 2
+                              :           LEN - 1;
+                if (0 < pi && (pos < 0 || LEN <= pos)) {
+                    continue;
+                }
+
+                bsl::string src(&ta);
+                for (int i = 0; i < LEN; ++i) {
+                    src.push_back(static_cast<char>('!' + i % 90));
+                }
+                if (0 <= pos) {
+                    src[pos] = static_cast<char>(0xc3);
+                    if (pos + 1 < LEN) {
+                        src[pos + 1] = static_cast<char>(0xa9);
+                    }
+                }
+
+                const bsl::size_t NUM_WORDS = 0 <= pos && pos + 1 < LEN
+                                            ? LEN - 1
+                                            : LEN;
+
+                for (int oi = 0; oi < 2; ++oi) {
+                    const bdlde::ByteOrder::Enum ORDER = ORDERS[oi];
+
+                    for (int cap = 0; cap <= LEN + 2; ++cap) {
+                        unsigned short exp[k_BUF_LEN], out[k_BUF_LEN];
+                        bsl::fill(exp, exp + k_BUF_LEN, SENTINEL);
+                        bsl::fill(out, out + k_BUF_LEN, SENTINEL);
+
+                        bsl::size_t expNumCodePoints = 0, expNumWords = 0;
+                        bsl::size_t numCodePoints = 0, numWords = 0;
+
+                        const int EXP_RC = Util::utf8ToUtf16(exp,
+                                                             cap,
+                                                             src.c_str(),
+                                                             &expNumCodePoints,
+                                                             &expNumWords,
+                                                             '?',
+                                                             ORDER);
+                        const int RC = Util::utf8ToUtf16(
+                                                    out,
+                                                    cap,
+                                                    bslstl::StringRef(src),
+                                                    &numCodePoints,
+                                                    &numWords,
+                                                    '?',
+                                                    ORDER);
+
+                        ASSERTV(LEN, pos, oi, cap, EXP_RC, RC, EXP_RC == RC);
+                        ASSERTV(LEN, pos, oi, cap,
+                                expNumCodePoints == numCodePoints);
+                        ASSERTV(LEN, pos, oi, cap, expNumWords == numWords);
+                        ASSERTV(LEN, pos, oi, cap,
+                                bsl::equal(exp, exp + k_BUF_LEN, out));
+                        ASSERTV(LEN, pos, oi, cap, numWords,
+                                numWords <= bsl::size_t(cap));
+                        ASSERTV(LEN, pos, oi, cap,
+                                (bsl::size_t(cap) > NUM_WORDS)
+                                          == (0 == (Status::k_OUT_OF_SPACE_BIT
+                                                                      & RC)));
+                    }
+                }
+            }
+        }
+      } break;
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         // --------------------------------------------------------------------
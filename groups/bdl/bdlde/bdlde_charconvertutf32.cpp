@@ -8,7 +8,7 @@
 // ----------------------------------------------------------------------------
 
 #include <bdlde_charconvertutf32.h>
-#include <bdlde_utf8util.h>    // for testing only
+#include <bdlde_utf8util.h>    // 'Utf8Util::asciiPrefixLength'
 
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
@@ -182,7 +182,7 @@ struct Capacity {
     void operator--();
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta);
+    void operator-=(bsl::size_t delta);
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
@@ -193,6 +193,11 @@ struct Capacity {
     bool operator>=(bsl::size_t rhs) const;
         // Return 'true' if 'd_capacity' is greater than or equal to the
         // specified 'rhs', and 'false' otherwise.
+
+    bsl::size_t clip(bsl::size_t numWords) const;
+        // Return the lesser of the specified 'numWords' and the number of
+        // words that can be output while leaving room for the terminating
+        // null word.  The behavior is undefined unless '1 <= d_capacity'.
 };
 
                            // ---------------------
@@ -214,7 +219,7 @@ void Capacity::operator--()
 }
 
 inline
-void Capacity::operator-=(int delta)
+void Capacity::operator-=(bsl::size_t delta)
     // Decrement 'd_capacity' by 'delta'.
 {
     d_capacity -= delta;
@@ -237,6 +242,14 @@ bool Capacity::operator>=(bsl::size_t rhs) const
     return d_capacity >= rhs;
 }
 
+inline
+bsl::size_t Capacity::clip(bsl::size_t numWords) const
+{
+    BSLS_ASSERT(1 <= d_capacity);
+
+    return bsl::min(numWords, d_capacity - 1);
+}
+
                          // =========================
                          // local struct NoopCapacity
                          // =========================
@@ -257,7 +270,7 @@ struct NoopCapacity {
     void operator--();
         // No-op.
 
-    void operator-=(int);
+    void operator-=(bsl::size_t);
         // No-op.
 
     // ACCESSORS
@@ -266,6 +279,9 @@ struct NoopCapacity {
 
     bool operator>=(bsl::size_t) const;
         // Return 'true'.
+
+    bsl::size_t clip(bsl::size_t numWords) const;
+        // Return the specified 'numWords'.
 };
 
                          // -------------------------
@@ -285,7 +301,7 @@ void NoopCapacity::operator--()
 {}
 
 inline
-void NoopCapacity::operator-=(int)
+void NoopCapacity::operator-=(bsl::size_t)
     // No-op.
 {}
 
@@ -304,6 +320,12 @@ bool NoopCapacity::operator>=(bsl::size_t) const
     return true;
 }
 
+inline
+bsl::size_t NoopCapacity::clip(bsl::size_t numWords) const
+{
+    return numWords;
+}
+
                             // ====================
                             // local struct Swapper
                             // ====================
@@ -370,6 +392,11 @@ class Utf8PtrBasedEnd {
         // 'false' otherwise.  The behavior is undefined unless
         // 'position <= d_end'.
 
+    bsl::size_t numSingleOctets(const OctetType *position) const;
+        // Return the number of consecutive single octets beginning at the
+        // specified 'position' and prior to 'd_end'.  The behavior is
+        // undefined unless 'position <= d_end'.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after the specified 'skipBy' consecutive
@@ -406,6 +433,16 @@ bool Utf8PtrBasedEnd::isFinished(const OctetType *position) const
     }
 }
 
+inline
+bsl::size_t Utf8PtrBasedEnd::numSingleOctets(const OctetType *position) const
+{
+    BSLS_ASSERT(d_end >= position);
+
+    return BloombergLP::bdlde::Utf8Util::asciiPrefixLength(
+                                   reinterpret_cast<const char *>(position),
+                                   d_end - position);
+}
+
 inline
 const OctetType *Utf8PtrBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -462,6 +499,12 @@ struct Utf8ZeroBasedEnd {
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
 
+    bsl::size_t numSingleOctets(const OctetType *position) const;
+        // Return 0, regardless of the specified 'position'.  Note that finding
+        // the end of a run of single octets would cost as much as translating
+        // them one at a time, because the end of input must be checked for at
+        // every octet.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after up to the specified 'skipBy' consecutive
@@ -493,6 +536,12 @@ bool Utf8ZeroBasedEnd::isFinished(const OctetType *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf8ZeroBasedEnd::numSingleOctets(const OctetType *) const
+{
+    return 0;
+}
+
 inline
 const OctetType *Utf8ZeroBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -867,8 +916,18 @@ bsl::size_t utf32BufferLengthNeeded(const char  *input,
     const OctetType *octets = constOctetCast(input);
 
     bsl::size_t ret = 0;
-    for (; ! endFunctor.isFinished(octets); ++ret) {
-        octets = skipUtf8CodePoint(octets);
+    while (! endFunctor.isFinished(octets)) {
+        const bsl::size_t numSingle = isSingleOctet(*octets)
+                                    ? endFunctor.numSingleOctets(octets)
+                                    : 0;
+        if (numSingle) {
+            octets += numSingle;
+            ret    += numSingle;
+        }
+        else {
+            octets = skipUtf8CodePoint(octets);
+            ++ret;
+        }
     }
 
     return ret + 1;
@@ -1011,6 +1070,15 @@ class Utf8ToUtf32Translator {
         // capacity for the output, and 0 otherwise.  The behavior is undefined
         // unless at least 1 word of space is available in the output buffer.
 
+    bsl::size_t translateSingleOctets();
+        // Translate the run of single octets beginning at 'd_input', or as
+        // much of it as fits in the output, if the end functor can find its
+        // length, update the state of this object accordingly, and return the
+        // number of octets translated.  Return 0, with no effect, if the end
+        // functor cannot find the length of the run, or there is no room in
+        // the output.  The behavior is undefined unless at least 1 word of
+        // space is available in the output buffer.
+
   public:
     // CLASS METHODS
     static
@@ -1139,6 +1207,25 @@ Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::handleInvalidSequence()
     }
 }
 
+template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
+bsl::size_t
+Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translateSingleOctets()
+{
+    BSLS_ASSERT(d_capacity >= 1);
+
+    const bsl::size_t numSingle = d_capacity.clip(
+                                      d_endFunctor.numSingleOctets(d_input));
+
+    for (bsl::size_t i = 0; i < numSingle; ++i) {
+        d_output[i] = SWAPPER::swapBytes(d_input[i]);
+    }
+    d_input    += numSingle;
+    d_output   += numSingle;
+    d_capacity -= numSingle;
+
+    return numSingle;
+}
+
 // CLASS METHODS
 template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
 int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
@@ -1159,6 +1246,10 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
 
     int ret = 0;
     while (!endFunctor.isFinished(translator.d_input)) {
+        if (isSingleOctet(*translator.d_input)
+         && 0 != translator.translateSingleOctets()) {
+            continue;
+        }
         if (0 != translator.decodeCodePoint()) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
             ret = k_OUT_OF_SPACE_BIT;
@@ -74,7 +74,8 @@ using bsl::size_t;
 //:   capacity specified was adequate, and is never set on translations with
 //:   STL container output destinations.
 // ----------------------------------------------------------------------------
-// [17] USAGE EXAMPLE
+// [19] USAGE EXAMPLE
+// [18] UTF-32 <- UTF-8 Translating runs of ASCII
 // [16] UTF-32 <- UTF-8 Random garbage input, random error word
 // [15] UTF-32 <- UTF-8 Table generated random sequences, random error word
 // [14] UTF-8 <- UTF-32 Random garbage input, random error byte
@@ -2742,7 +2743,7 @@ int main(int argc, char **argv)
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Simple example illustrating how one might use the 'utf8ToUtf32'
@@ -2872,6 +2873,117 @@ int main(int argc, char **argv)
     ASSERT(v32.size()                   == codePointsWritten);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TRANSLATING RUNS OF ASCII
+        //
+        // Concerns:
+        //: 1 Runs of single octets in length-delimited input, which are
+        //:   translated a run at a time, are translated exactly as they are
+        //:   in null-terminated input, which is translated one octet at a
+        //:   time, in both byte orders.
+        //:
+        //: 2 A run is cut short by the capacity of the output, which is never
+        //:   overrun, and leaves room for the terminating null word.
+        //
+        // Plan:
+        //: 1 For a variety of lengths of ASCII text, with and without a
+        //:   multi-octet code point at various positions, translate the text
+        //:   into buffers of every capacity up to its length, in both byte
+        //:   orders, from both a 'StringRef' and a null-terminated string, and
+        //:   verify that the results are identical, and that the words after
+        //:   those written are unchanged.  (C-1..2)
+        //
+        // Testing:
+        //    utf8ToUtf32(unsigned int *, size_t, const StringRef&, ...)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TRANSLATING RUNS OF ASCII\n"
+                             "=========================\n";
+
+        enum { k_MAX_LEN = 100, k_BUF_LEN = k_MAX_LEN + 4 };
+
+        const unsigned int SENTINEL = 0xdeadbeef;
+
+        const int LENGTHS[] = { 0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33,
+                                47, 63, 64, 65, 95, 100 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const bdlde::ByteOrder::Enum ORDERS[] = {
+                                             bdlde::ByteOrder::e_LITTLE_ENDIAN,
+                                             bdlde::ByteOrder::e_BIG_ENDIAN };
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const int LEN = LENGTHS[li];
+
+            for (int pi = 0; pi < 5; ++pi) {
+                // 'pos' is the position of a 2-octet code point, if any,
+                // which is truncated if it is at the end of the input.
+
+                const int pos = 0 == pi ? -1
+                              : 1 == pi ? 0
+                              : 2 == pi ? LEN / 2
+                              : 3 == pi ? LEN - 2
+                              :           LEN - 1;
+                if (0 < pi && (pos < 0 || LEN <= pos)) {
+                    continue;
+                }
+
+                bsl::string src;
+                for (int i = 0; i < LEN; ++i) {
+                    src.push_back(static_cast<char>('!' + i % 90));
+                }
+                if (0 <= pos) {
+                    src[pos] = static_cast<char>(0xc3);
+                    if (pos + 1 < LEN) {
+                        src[pos + 1] = static_cast<char>(0xa9);
+                    }
+                }
+
+                const bsl::size_t NUM_WORDS = 0 <= pos && pos + 1 < LEN
+                                            ? LEN - 1
+                                            : LEN;
+
+                for (int oi = 0; oi < 2; ++oi) {
+                    const bdlde::ByteOrder::Enum ORDER = ORDERS[oi];
+
+                    for (int cap = 0; cap <= LEN + 2; ++cap) {
+                        unsigned int exp[k_BUF_LEN], out[k_BUF_LEN];
+                        bsl::fill(exp, exp + k_BUF_LEN, SENTINEL);
+                        bsl::fill(out, out + k_BUF_LEN, SENTINEL);
+
+                        bsl::size_t expNumWords = 0, numWords = 0;
+
+                        const int EXP_RC = Util::utf8ToUtf32(exp,
+                                                             cap,
+                                                             src.c_str(),
+                                                             &expNumWords,
+                                                             '?',
+                                                             ORDER);
+                        const int RC = Util::utf8ToUtf32(
+                                                    out,
+                                                    cap,
+                                                    bslstl::StringRef(src),
+                                                    &numWords,
+                                                    '?',
+                                                    ORDER);
+
+                        LOOP6_ASSERT(LEN, pos, oi, cap, EXP_RC, RC,
+                                     EXP_RC == RC);
+                        LOOP4_ASSERT(LEN, pos, oi, cap,
+                                     expNumWords == numWords);
+                        LOOP4_ASSERT(LEN, pos, oi, cap,
+                                     bsl::equal(exp, exp + k_BUF_LEN, out));
+                        LOOP5_ASSERT(LEN, pos, oi, cap, numWords,
+                                     numWords <= bsl::size_t(cap));
+                        LOOP4_ASSERT(LEN, pos, oi, cap,
+                                     (bsl::size_t(cap) > NUM_WORDS) ==
+                                     (0 == (Status::k_OUT_OF_SPACE_BIT & RC)));
+                    }
+                }
+            }
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // RANDOM TABLE DRIVEN UTF-8 -> UTF-32 TEST PLUS EMBEDDED NULLS
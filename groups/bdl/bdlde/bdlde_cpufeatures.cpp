@@ -0,0 +1,206 @@
+// bdlde_cpufeatures.cpp                                              -*-C++-*-
+#include <bdlde_cpufeatures.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_cpufeatures_cpp,"$Id$ $CSID$")
+
+#include <bslmt_once.h>
+
+#include <bsls_platform.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <cpuid.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlde {
+
+namespace {
+
+                              // ================
+                              // class FeatureSet
+                              // ================
+
+class FeatureSet {
+    // This class represents a singleton that queries, on construction, the
+    // instruction sets supported by the running processor.
+
+    // DATA
+    bool d_isAvx2Supported;
+    bool d_isPclmulSupported;
+    bool d_isShaNiSupported;
+    bool d_isSse41Supported;
+    bool d_isSsse3Supported;
+
+    // CREATORS
+    FeatureSet();
+        // Create an instance of this class.
+
+    // NOT IMPLEMENTED
+    FeatureSet(const FeatureSet&);             // = delete;
+    FeatureSet& operator=(const FeatureSet&);  // = delete;
+
+  public:
+    // CLASS METHODS
+    static const FeatureSet& instance();
+        // Return a reference to the singleton object.
+
+    // ACCESSORS
+    bool isAvx2Supported() const;
+        // Return 'true' if AVX2 is supported, and 'false' otherwise.
+
+    bool isPclmulSupported() const;
+        // Return 'true' if carry-less multiplication is supported, and
+        // 'false' otherwise.
+
+    bool isShaNiSupported() const;
+        // Return 'true' if the SHA extensions are supported, and 'false'
+        // otherwise.
+
+    bool isSse41Supported() const;
+        // Return 'true' if SSE4.1 is supported, and 'false' otherwise.
+
+    bool isSsse3Supported() const;
+        // Return 'true' if SSSE3 is supported, and 'false' otherwise.
+};
+
+FeatureSet::FeatureSet()
+: d_isAvx2Supported(false)
+, d_isPclmulSupported(false)
+, d_isShaNiSupported(false)
+, d_isSse41Supported(false)
+, d_isSsse3Supported(false)
+{
+#if defined(LIKE_X86_GCC)
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return;                                                       // RETURN
+    }
+
+    d_isSsse3Supported  = 0 != (ecx & bit_SSSE3);
+    d_isSse41Supported  = 0 != (ecx & bit_SSE4_1);
+    d_isPclmulSupported = 0 != (ecx & bit_PCLMUL);
+
+    // The AVX family may be used only if the operating system saves the XMM
+    // and YMM state, as indicated by bits 1 and 2 of 'XCR0'.
+
+    const unsigned int k_OSXSAVE = 1u << 27;
+    const unsigned int k_AVX     = 1u << 28;
+
+    bool isAvxEnabled = false;
+    if ((ecx & (k_OSXSAVE | k_AVX)) == (k_OSXSAVE | k_AVX)) {
+        unsigned int xcr0Lo, xcr0Hi;
+        __asm__ __volatile__("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+        isAvxEnabled = (xcr0Lo & 0x6) == 0x6;
+    }
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return;                                                       // RETURN
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    const unsigned int k_AVX2 = 1u << 5;
+    const unsigned int k_SHA  = 1u << 29;
+
+    d_isAvx2Supported  = isAvxEnabled && 0 != (ebx & k_AVX2);
+    d_isShaNiSupported = 0 != (ebx & k_SHA);
+#endif
+}
+
+const FeatureSet& FeatureSet::instance()
+{
+    static const FeatureSet *theInstance_p = 0;
+    BSLMT_ONCE_DO {
+        static const FeatureSet theInstance;
+        theInstance_p = &theInstance;
+    }
+    return *theInstance_p;
+}
+
+inline
+bool FeatureSet::isAvx2Supported() const
+{
+    return d_isAvx2Supported;
+}
+
+inline
+bool FeatureSet::isPclmulSupported() const
+{
+    return d_isPclmulSupported;
+}
+
+inline
+bool FeatureSet::isShaNiSupported() const
+{
+    return d_isShaNiSupported;
+}
+
+inline
+bool FeatureSet::isSse41Supported() const
+{
+    return d_isSse41Supported;
+}
+
+inline
+bool FeatureSet::isSsse3Supported() const
+{
+    return d_isSsse3Supported;
+}
+
+}  // close unnamed namespace
+
+                             // ------------------
+                             // struct CpuFeatures
+                             // ------------------
+
+// CLASS METHODS
+bool CpuFeatures::isAvx2Supported()
+{
+    return FeatureSet::instance().isAvx2Supported();
+}
+
+bool CpuFeatures::isPclmulSupported()
+{
+    return FeatureSet::instance().isPclmulSupported();
+}
+
+bool CpuFeatures::isShaNiSupported()
+{
+    return FeatureSet::instance().isShaNiSupported();
+}
+
+bool CpuFeatures::isSse41Supported()
+{
+    return FeatureSet::instance().isSse41Supported();
+}
+
+bool CpuFeatures::isSsse3Supported()
+{
+    return FeatureSet::instance().isSsse3Supported();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
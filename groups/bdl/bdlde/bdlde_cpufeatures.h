@@ -0,0 +1,112 @@
+// bdlde_cpufeatures.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLDE_CPUFEATURES
+#define INCLUDED_BDLDE_CPUFEATURES
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide run-time detection of optional x86 instruction sets.
+//
+//@CLASSES:
+//  bdlde::CpuFeatures: query the instruction sets of the running processor
+//
+//@SEE_ALSO: bdlde_base64util, bdlde_crc32, bdlde_crc64, bdlde_sha2,
+//           bdlde_utf8util
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::CpuFeatures', that
+// reports whether the running processor (and, where it matters, the operating
+// system) supports each of the optional instruction sets for which components
+// of this package provide vectorized kernels.  The components use it, once,
+// to select the fastest kernel that can be run; it is not meant for direct
+// client use.
+//
+// The processor is queried with the 'cpuid' instruction (and, for the AVX
+// family, 'xgetbv') on first use, and the results are kept for the lifetime
+// of the process.  On platforms other than x86 and x86-64 built with a
+// GCC-compatible compiler, where no component of this package provides such
+// kernels, every query returns 'false'.
+//
+///Thread Safety
+///-------------
+// Thread safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Selecting a Kernel
+///- - - - - - - - - - - - - - -
+// Suppose that we have portable, SSSE3, and AVX2 implementations of some
+// function, and want to select, once, the fastest one that the running
+// processor supports:
+//..
+//  typedef int (*KernelFn)(const char *, int);
+//
+//  KernelFn selectKernel()
+//  {
+//      if (bdlde::CpuFeatures::isAvx2Supported()) {
+//          return &kernelAvx2;                                       // RETURN
+//      }
+//      if (bdlde::CpuFeatures::isSsse3Supported()) {
+//          return &kernelSsse3;                                      // RETURN
+//      }
+//      return &kernelPortable;
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                            // ==================
+                            // struct CpuFeatures
+                            // ==================
+
+struct CpuFeatures {
+    // This 'struct' provides a namespace for functions reporting whether the
+    // running processor supports optional x86 instruction sets.
+
+    // CLASS METHODS
+    static bool isAvx2Supported();
+        // Return 'true' if the running processor supports AVX2 instructions
+        // and the operating system preserves the AVX registers across context
+        // switches, and 'false' otherwise.
+
+    static bool isPclmulSupported();
+        // Return 'true' if the running processor supports the carry-less
+        // multiplication instruction ('PCLMULQDQ'), and 'false' otherwise.
+
+    static bool isShaNiSupported();
+        // Return 'true' if the running processor supports the SHA extensions
+        // ("SHA-NI"), and 'false' otherwise.
+
+    static bool isSse41Supported();
+        // Return 'true' if the running processor supports SSE4.1
+        // instructions, and 'false' otherwise.
+
+    static bool isSsse3Supported();
+        // Return 'true' if the running processor supports SSSE3 instructions,
+        // and 'false' otherwise.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,337 @@
+// bdlde_cpufeatures.t.cpp                                            -*-C++-*-
+#include <bdlde_cpufeatures.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_platform.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test reports whether the running processor supports
+// each of a set of instruction sets.  Where the compiler provides its own
+// means of querying the processor ('__builtin_cpu_supports'), we use it as an
+// oracle; elsewhere, we verify that every query returns 'false'.  We also
+// verify the implications between the instruction sets, and that the results
+// do not change from one call to the next.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bool isAvx2Supported();
+// [ 2] bool isPclmulSupported();
+// [ 2] bool isShaNiSupported();
+// [ 2] bool isSse41Supported();
+// [ 2] bool isSsse3Supported();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::CpuFeatures Obj;
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <cpuid.h>
+#endif
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+typedef int (*KernelFn)(const char *, int);
+
+int kernelPortable(const char *, int length)
+{
+    return length;
+}
+
+int kernelSsse3(const char *, int length)
+{
+    return length;
+}
+
+int kernelAvx2(const char *, int length)
+{
+    return length;
+}
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Selecting a Kernel
+///- - - - - - - - - - - - - - -
+// Suppose that we have portable, SSSE3, and AVX2 implementations of some
+// function, and want to select, once, the fastest one that the running
+// processor supports:
+//..
+    KernelFn selectKernel()
+    {
+        if (bdlde::CpuFeatures::isAvx2Supported()) {
+            return &kernelAvx2;                                       // RETURN
+        }
+        if (bdlde::CpuFeatures::isSsse3Supported()) {
+            return &kernelSsse3;                                      // RETURN
+        }
+        return &kernelPortable;
+    }
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        const KernelFn kernel = selectKernel();
+
+        ASSERT(Obj::isAvx2Supported()  == (&kernelAvx2  == kernel));
+        ASSERT(Obj::isSsse3Supported() || &kernelPortable == kernel);
+        ASSERT(5 == kernel("hello", 5));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING QUERIES
+        //
+        // Concerns:
+        //: 1 Each query reports whether the running processor supports the
+        //:   corresponding instruction set.
+        //:
+        //: 2 Each query returns 'false' on platforms where this component
+        //:   does not query the processor.
+        //
+        // Plan:
+        //: 1 Where the compiler provides '__builtin_cpu_supports', compare
+        //:   the result of each query with it.  '__builtin_cpu_supports' does
+        //:   not report the SHA extensions on all supported compilers, so
+        //:   compare 'isShaNiSupported' with the bit read directly with
+        //:   'cpuid'.  (C-1)
+        //:
+        //: 2 Elsewhere, verify that each query returns 'false'.  (C-2)
+        //
+        // Testing:
+        //   bool isAvx2Supported();
+        //   bool isPclmulSupported();
+        //   bool isShaNiSupported();
+        //   bool isSse41Supported();
+        //   bool isSsse3Supported();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING QUERIES" << endl
+                          << "===============" << endl;
+
+#if defined(LIKE_X86_GCC)
+        __builtin_cpu_init();
+
+        ASSERTV(Obj::isAvx2Supported(),
+                !!__builtin_cpu_supports("avx2") == Obj::isAvx2Supported());
+        ASSERTV(Obj::isPclmulSupported(),
+                !!__builtin_cpu_supports("pclmul")
+                                                 == Obj::isPclmulSupported());
+        ASSERTV(Obj::isSse41Supported(),
+                !!__builtin_cpu_supports("sse4.1") == Obj::isSse41Supported());
+        ASSERTV(Obj::isSsse3Supported(),
+                !!__builtin_cpu_supports("ssse3") == Obj::isSsse3Supported());
+
+        unsigned int eax, ebx, ecx, edx;
+        bool         isSha = false;
+        if (__get_cpuid_max(0, 0) >= 7) {
+            __cpuid_count(7, 0, eax, ebx, ecx, edx);
+            isSha = 0 != (ebx & (1u << 29));
+        }
+        ASSERTV(Obj::isShaNiSupported(), isSha == Obj::isShaNiSupported());
+#else
+        ASSERT(!Obj::isAvx2Supported());
+        ASSERT(!Obj::isPclmulSupported());
+        ASSERT(!Obj::isShaNiSupported());
+        ASSERT(!Obj::isSse41Supported());
+        ASSERT(!Obj::isSsse3Supported());
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Report the instruction sets supported.
+        //:
+        //: 2 Verify that each query returns the same result when called
+        //:   again, and that AVX2 support implies SSE4.1 support, which
+        //:   implies SSSE3 support.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bool IS_AVX2   = Obj::isAvx2Supported();
+        const bool IS_PCLMUL = Obj::isPclmulSupported();
+        const bool IS_SHA_NI = Obj::isShaNiSupported();
+        const bool IS_SSE41  = Obj::isSse41Supported();
+        const bool IS_SSSE3  = Obj::isSsse3Supported();
+
+        if (verbose) {
+            P_(IS_SSSE3) P_(IS_SSE41) P_(IS_AVX2) P_(IS_PCLMUL) P(IS_SHA_NI)
+        }
+
+        ASSERT(IS_AVX2   == Obj::isAvx2Supported());
+        ASSERT(IS_PCLMUL == Obj::isPclmulSupported());
+        ASSERT(IS_SHA_NI == Obj::isShaNiSupported());
+        ASSERT(IS_SSE41  == Obj::isSse41Supported());
+        ASSERT(IS_SSSE3  == Obj::isSsse3Supported());
+
+        ASSERT(!IS_AVX2  || IS_SSE41);
+        ASSERT(!IS_SSE41 || IS_SSSE3);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,7 +14,14 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 
 #include <bslmf_assert.h>
 
+#include <bdlde_cpufeatures.h>
+
+#include <bslmt_once.h>
+
 #include <bsls_annotation.h>
+#include <bsls_log.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -93,10 +100,43 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 //..
 //  http://ravenphpscripts.com/modules.php?name=Forums&file=viewtopic&t=614
 //..
+//
+// Inputs of at least 64 bytes are processed with the carry-less multiplication
+// instruction, when available, following Gopal et al., "Fast CRC Computation
+// for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009).  Four
+// 128-bit accumulators are each *folded* forward by 512 bits (i.e., multiplied
+// by 'x^512' modulo the polynomial, 'P') and added to the next 64 bytes of
+// input, the accumulators are then folded into one, and the remaining 16-byte
+// blocks are folded into it.  Each fold multiplies the two 64-bit halves of an
+// accumulator by precomputed constants 'x^(D + 63) mod P' and 'x^(D - 1) mod
+// P', where 'D' is the folding distance in bits (the exponents are one less
+// than in the non-reflected case since the product of two bit-reflected 64-bit
+// values is a bit-reflected 127-bit value).  Rather than reducing the final
+// accumulator with a Barrett reduction, its 16 bytes are fed to the table
+// lookup implementation, starting from a zero register, which yields the same
+// remainder.
+//
+// 'combine' uses the identity 'crc(A + B) = crc(A) * x^(8 * len(B)) + crc(B)
+// (mod P)' of Mark Adler's 'crc32_combine' in zlib, with a table of the powers
+// 'x^(8 * 2^k) mod P', so that the multiplier is formed with one modular
+// multiplication per bit set in 'len(B)'.
 
 #include <bsls_assert.h>
 #include <bsl_ostream.h>
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <immintrin.h>
+
+#define U_TARGET_PCLMUL __attribute__((target("pclmul,sse4.1")))
+#endif
+
 namespace BloombergLP {
 
 BSLMF_ASSERT(4 == sizeof(unsigned int));
@@ -159,20 +199,63 @@ static const unsigned int CRC_TABLE[256] = {
 };
 
 namespace bdlde {
-                                // -----------
-                                // class Crc32
-                                // -----------
+namespace {
 
-// MANIPULATORS
-void Crc32::update(const void *data, bsl::size_t length)
+typedef unsigned int (*UpdateFn)(unsigned int         crc,
+                                 const unsigned char *data,
+                                 bsl::size_t          length);
+    // 'UpdateFn' is an alias for a function that returns the CRC-32 register
+    // (i.e., the bitwise complement of the checksum) resulting from the
+    // specified 'crc' register and the specified 'data' having the specified
+    // 'length'.
+
+const bsl::size_t k_PCLMUL_MIN_LENGTH = 64;
+    // minimum length of the input of 'updatePclmul'
+
+const unsigned int COMBINE_TABLE[64] = {
+    // 'COMBINE_TABLE[k]' is 'x^(8 * 2^k) mod P', bit-reflected.
+
+    0x00800000, 0x00008000, 0xedb88320, 0xb1e6b092, 0xa06a2517,
+    0xed627dae, 0x88d14467, 0xd7bbfe6a, 0xec447f11, 0x8e7ea170,
+    0x6427800e, 0x4d47bae0, 0x09fe548f, 0x83852d0f, 0x30362f1a,
+    0x7b5a9cc3, 0x31fec169, 0x9fec022a, 0x6c8dedc4, 0x15d6874d,
+    0x5fde7a4e, 0xbad90e37, 0x2e4e5eef, 0x4eaba214, 0xa8a472c0,
+    0x429a969e, 0x148d302a, 0xc40ba6d0, 0xc4e22c3c, 0x40000000,
+    0x20000000, 0x08000000, 0x00800000, 0x00008000, 0xedb88320,
+    0xb1e6b092, 0xa06a2517, 0xed627dae, 0x88d14467, 0xd7bbfe6a,
+    0xec447f11, 0x8e7ea170, 0x6427800e, 0x4d47bae0, 0x09fe548f,
+    0x83852d0f, 0x30362f1a, 0x7b5a9cc3, 0x31fec169, 0x9fec022a,
+    0x6c8dedc4, 0x15d6874d, 0x5fde7a4e, 0xbad90e37, 0x2e4e5eef,
+    0x4eaba214, 0xa8a472c0, 0x429a969e, 0x148d302a, 0xc40ba6d0,
+    0xc4e22c3c, 0x40000000, 0x20000000, 0x08000000
+};
+
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+    // Return the product, modulo the CRC-32 polynomial, of the specified 'a'
+    // and 'b' polynomials, all in bit-reflected form.
 {
-    BSLS_ASSERT(data || !length);
+    unsigned int product = 0;
+    for (unsigned int mask = 0x80000000; mask; mask >>= 1) {
+        if (a & mask) {
+            product ^= b;
+        }
+        b = (b & 1) ? (b >> 1) ^ 0xedb88320 : b >> 1;
+    }
+    return product;
+}
 
+unsigned int updatePortable(unsigned int         crc,
+                            const unsigned char *data,
+                            bsl::size_t          length)
+    // Return the CRC-32 register resulting from the specified 'crc' register
+    // and the specified 'data' having the specified 'length', using the table
+    // lookup algorithm.
+{
     // The following is a Duff's Device-based implementation of a common
     // algorithm (see end of RFC 1952).
 
-    const unsigned char *d   = (const unsigned char *)data;
-    unsigned int         tmp = d_crc;
+    const unsigned char *d   = data;
+    unsigned int         tmp = crc;
 
     switch (length % 4) {
       case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
@@ -193,7 +276,185 @@ void Crc32::update(const void *data, bsl::size_t length)
         --n;
     }
 
-    d_crc = tmp;
+    return tmp;
+}
+
+#if defined(LIKE_X86_GCC)
+
+                             // -------------
+                             // PCLMUL kernel
+                             // -------------
+
+U_TARGET_PCLMUL
+inline
+__m128i fold(__m128i value, __m128i constants)
+    // Return a 128-bit value congruent, modulo the CRC-32 polynomial, to the
+    // specified 'value' multiplied by the power of 'x' whose residues are
+    // held by the specified 'constants'.
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00),
+                         _mm_clmulepi64_si128(value, constants, 0x11));
+}
+
+U_TARGET_PCLMUL
+unsigned int updatePclmul(unsigned int         crc,
+                          const unsigned char *data,
+                          bsl::size_t          length)
+    // Return the CRC-32 register resulting from the specified 'crc' register
+    // and the specified 'data' having the specified 'length', using the
+    // carry-less multiplication instruction.  The behavior is undefined unless
+    // 'k_PCLMUL_MIN_LENGTH <= length'.
+{
+    BSLS_ASSERT(k_PCLMUL_MIN_LENGTH <= length);
+
+    typedef bsls::Types::Int64 Int64;
+
+    // The residues of 'x^575' and 'x^511', and of 'x^191' and 'x^127', shifted
+    // to the top of a 64-bit word.
+
+    const __m128i k512 = _mm_set_epi64x(
+                                   static_cast<Int64>(0xcad38e8f00000000ULL),
+                                   static_cast<Int64>(0x653d982200000000ULL));
+    const __m128i k128 = _mm_set_epi64x(
+                                   static_cast<Int64>(0x9ba54c6f00000000ULL),
+                                   static_cast<Int64>(0x65673b4600000000ULL));
+
+    const __m128i *p = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(p),
+                               _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i x1 = _mm_loadu_si128(p + 1);
+    __m128i x2 = _mm_loadu_si128(p + 2);
+    __m128i x3 = _mm_loadu_si128(p + 3);
+    p      += 4;
+    length -= 64;
+
+    while (64 <= length) {
+        x0 = _mm_xor_si128(fold(x0, k512), _mm_loadu_si128(p));
+        x1 = _mm_xor_si128(fold(x1, k512), _mm_loadu_si128(p + 1));
+        x2 = _mm_xor_si128(fold(x2, k512), _mm_loadu_si128(p + 2));
+        x3 = _mm_xor_si128(fold(x3, k512), _mm_loadu_si128(p + 3));
+        p      += 4;
+        length -= 64;
+    }
+
+    x0 = _mm_xor_si128(fold(x0, k128), x1);
+    x0 = _mm_xor_si128(fold(x0, k128), x2);
+    x0 = _mm_xor_si128(fold(x0, k128), x3);
+
+    while (16 <= length) {
+        x0 = _mm_xor_si128(fold(x0, k128), _mm_loadu_si128(p));
+        ++p;
+        length -= 16;
+    }
+
+    unsigned char remainder[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(remainder), x0);
+
+    return updatePortable(updatePortable(0, remainder, sizeof remainder),
+                          reinterpret_cast<const unsigned char *>(p),
+                          length);
+}
+
+#endif  // LIKE_X86_GCC
+
+                            //======================
+                            // class Crc32Dispatcher
+                            //======================
+
+class Crc32Dispatcher {
+    // This class represents a singleton that selects, on construction, the
+    // fastest CRC-32 function supported by the running processor.
+
+    // DATA
+    UpdateFn d_updateFn;
+
+    // CREATORS
+    Crc32Dispatcher();
+        // Create an instance of this class.
+
+    // NOT IMPLEMENTED
+    Crc32Dispatcher(const Crc32Dispatcher&);             // = delete;
+    Crc32Dispatcher& operator=(const Crc32Dispatcher&);  // = delete;
+
+  public:
+    // CLASS METHODS
+    static const Crc32Dispatcher& instance();
+        // Return a reference to the singleton object.
+
+    // ACCESSORS
+    UpdateFn updateFn() const;
+        // Return the selected function for inputs of at least
+        // 'k_PCLMUL_MIN_LENGTH' bytes.
+};
+
+Crc32Dispatcher::Crc32Dispatcher()
+: d_updateFn(&updatePortable)
+{
+#if defined(LIKE_X86_GCC)
+    if (Crc32_Impl::isPclmulSupported()) {
+        BSLS_LOG_INFO("Using PCLMUL version for CRC-32");
+        d_updateFn = &updatePclmul;
+    }
+    else {
+        BSLS_LOG_INFO("Using software version for CRC-32 "
+                      "(PCLMUL not available)");
+    }
+#else
+    BSLS_LOG_INFO("Using software version for CRC-32 "
+                  "(unsupported platform)");
+#endif
+}
+
+const Crc32Dispatcher& Crc32Dispatcher::instance()
+{
+    static const Crc32Dispatcher *theInstance_p = 0;
+    BSLMT_ONCE_DO {
+        static const Crc32Dispatcher theInstance;
+        theInstance_p = &theInstance;
+    }
+    return *theInstance_p;
+}
+
+inline
+UpdateFn Crc32Dispatcher::updateFn() const
+{
+    return d_updateFn;
+}
+
+}  // close unnamed namespace
+
+                                // -----------
+                                // class Crc32
+                                // -----------
+
+// CLASS METHODS
+unsigned int Crc32::combine(unsigned int crcA,
+                            unsigned int crcB,
+                            bsl::size_t  lengthB)
+{
+    unsigned int crc = crcA;
+    for (int k = 0; lengthB; ++k, lengthB >>= 1) {
+        if (lengthB & 1) {
+            crc = multiplyModP(COMBINE_TABLE[k], crc);
+        }
+    }
+    return crc ^ crcB;
+}
+
+// MANIPULATORS
+void Crc32::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    const unsigned char *d = static_cast<const unsigned char *>(data);
+
+    if (length < k_PCLMUL_MIN_LENGTH) {
+        d_crc = updatePortable(d_crc, d, length);
+    }
+    else {
+        d_crc = Crc32Dispatcher::instance().updateFn()(d_crc, d, length);
+    }
 }
 
 // ACCESSORS
@@ -223,6 +484,46 @@ bsl::ostream& Crc32::print(bsl::ostream& stream) const
     return stream << array;
 }
 
+                              // -----------------
+                              // struct Crc32_Impl
+                              // -----------------
+
+// CLASS METHODS
+bool Crc32_Impl::isPclmulSupported()
+{
+    // The PCLMUL kernel also uses SSE4.1 instructions.
+
+    return CpuFeatures::isPclmulSupported() && CpuFeatures::isSse41Supported();
+}
+
+unsigned int Crc32_Impl::calculatePclmul(const void   *data,
+                                         bsl::size_t   length,
+                                         unsigned int  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    const unsigned char *d = static_cast<const unsigned char *>(data);
+
+#if defined(LIKE_X86_GCC)
+    if (isPclmulSupported() && k_PCLMUL_MIN_LENGTH <= length) {
+        return ~updatePclmul(~crc, d, length);                        // RETURN
+    }
+#endif
+
+    return ~updatePortable(~crc, d, length);
+}
+
+unsigned int Crc32_Impl::calculateSoftware(const void   *data,
+                                           bsl::size_t   length,
+                                           unsigned int  crc)
+{
+    BSLS_ASSERT(data || !length);
+
+    return ~updatePortable(~crc,
+                           static_cast<const unsigned char *>(data),
+                           length);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -17,6 +17,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Crc32: stores and updates a CRC-32 checksum
+//  bdlde::Crc32_Impl: alternative implementations, for testing only
 //
 //@SEE_ALSO:
 //
@@ -29,8 +30,28 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+// The class method 'combine' computes the checksum of the concatenation of two
+// sequences of bytes from their checksums and the length of the second one,
+// in time logarithmic in that length, without accessing the bytes themselves.
+// Large buffers can thus be checksummed in chunks, possibly in parallel, whose
+// checksums are then merged.
+//
+// The struct 'bdlde::Crc32_Impl' exposes each alternative implementation of
+// the checksum computation so that they can be tested and benchmarked against
+// one another; it should not be used otherwise.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// On x86 and x86-64 platforms built with a GCC-compatible compiler, 'update'
+// processes inputs of at least 64 bytes by *folding* them, 64 bytes per
+// iteration, with the carry-less multiplication instruction ('pclmulqdq') if
+// the running processor supports it, which is determined once, on first use,
+// by querying the processor with 'cpuid'.  Otherwise, and on all other
+// platforms, a portable table-driven implementation is used.
+//
 ///Usage
 ///-----
+///-----
 // The following snippets of code illustrate a typical use of the
 // 'bdlde::Crc32' class.  Each function would typically execute in separate
 // processes or potentially on separate machines.  The 'senderExample' function
@@ -83,6 +104,28 @@ BSLS_IDENT("$Id: $")
 //      assert(crcLocal == crc);
 //  }
 //..
+// The checksum of a buffer can also be computed from the checksums of its
+// parts, for example, when they are computed by different threads.  Here we
+// checksum the two halves of a buffer separately, and then merge their
+// checksums with 'combine':
+//..
+//  void combineExample()
+//      // Compute the CRC-32 checksum of a buffer from those of its halves.
+//  {
+//      const char        buffer[] = "The quick brown fox jumps over the lazy";
+//      const bsl::size_t length   = sizeof buffer - 1;
+//      const bsl::size_t half     = length / 2;
+//
+//      const bdlde::Crc32 first(buffer, half);
+//      const bdlde::Crc32 second(buffer + half, length - half);
+//
+//      const unsigned int crc = bdlde::Crc32::combine(first.checksum(),
+//                                                     second.checksum(),
+//                                                     length - half);
+//
+//      assert(bdlde::Crc32(buffer, length).checksum() == crc);
+//  }
+//..
 
 #include <bdlscm_version.h>
 
@@ -122,6 +165,15 @@ class Crc32 {
 
   public:
     // CLASS METHODS
+    static unsigned int combine(unsigned int crcA,
+                                unsigned int crcB,
+                                bsl::size_t  lengthB);
+        // Return the CRC-32 checksum of the concatenation of a sequence of
+        // bytes whose checksum is the specified 'crcA' and a sequence of bytes
+        // whose checksum is the specified 'crcB' and whose length is the
+        // specified 'lengthB'.  Note that this operation takes time
+        // logarithmic in 'lengthB'.
+
     static int maxSupportedBdexVersion(int versionSelector);
         // Return the maximum valid BDEX format version, as indicated by the
         // specified 'versionSelector', to be passed to the 'bdexStreamOut'
@@ -243,6 +295,34 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Crc32& checksum);
     // Write to the specified output 'stream' the specified 'checksum' value
     // and return a reference to the modifiable 'stream'.
 
+                              // =================
+                              // struct Crc32_Impl
+                              // =================
+
+struct Crc32_Impl {
+    // This 'struct' provides the alternative implementations of the CRC-32
+    // computation used by 'Crc32'.
+
+    // CLASS METHODS
+    static bool isPclmulSupported();
+        // Return 'true' if the running processor supports the carry-less
+        // multiplication instruction and this component was built to use it,
+        // and 'false' otherwise.
+
+    static unsigned int calculatePclmul(const void   *data,
+                                        bsl::size_t   length,
+                                        unsigned int  crc = 0);
+    static unsigned int calculateSoftware(const void   *data,
+                                          bsl::size_t   length,
+                                          unsigned int  crc = 0);
+        // Return the CRC-32 checksum of the concatenation of a sequence of
+        // bytes whose checksum is the optionally specified 'crc' and the
+        // specified 'data' having the specified 'length'.  If 'crc' is not
+        // specified, return the checksum of 'data'.  'calculatePclmul' uses
+        // the portable implementation if 'isPclmulSupported' returns 'false'.
+        // Note that if 'data' is 0, then 'length' also must be 0.
+};
+
 // ============================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
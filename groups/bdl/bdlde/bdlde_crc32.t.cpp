@@ -72,6 +72,7 @@ using namespace bsl;  // automatically added by script
 //
 //-----------------------------------------------------------------------------
 // CLASS METHODS
+// [15] static unsigned int combine(unsigned int, unsigned int, size_t);
 // [10] static int maxSupportedBdexVersion(int);
 //
 // CREATORS
@@ -98,10 +99,12 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] Crc32_Impl: calculateSoftware, calculatePclmul
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: THROUGHPUT
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc32& gg(bdlde::Crc32 *object, const char *spec);
@@ -168,6 +171,8 @@ static void aSsErT(int c, const char *s, int i)
 // ----------------------------------------------------------------------------
 
 typedef bdlde::Crc32        Obj;
+typedef bdlde::Crc32_Impl   Impl;
+typedef unsigned int        Value;
 typedef bslx::TestInStream  In;
 typedef bslx::TestOutStream Out;
 
@@ -228,6 +233,27 @@ void receiverExample(In& input)
     // verify that the received and locally-computed checksums match
     ASSERT(crcLocal == crc);
 }
+//..
+// The checksum of a buffer can also be computed from the checksums of its
+// parts, for example, when they are computed by different threads.  Here we
+// checksum the two halves of a buffer separately, and then merge their
+// checksums with 'combine':
+//..
+void combineExample()
+    // Compute the CRC-32 checksum of a buffer from those of its halves.
+{
+    const char        buffer[] = "The quick brown fox jumps over the lazy";
+    const bsl::size_t length   = sizeof buffer - 1;
+    const bsl::size_t half     = length / 2;
+
+    const bdlde::Crc32 first(buffer, half);
+    const bdlde::Crc32 second(buffer + half, length - half);
+
+    const unsigned int crc = bdlde::Crc32::combine(first.checksum(),
+                                                   second.checksum(),
+                                                   length - half);
+    ASSERT(bdlde::Crc32(buffer, length).checksum() == crc);
+}
 
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
@@ -259,6 +285,16 @@ void printHex(const char *str)
 // PH(X) without '\n'.
 #define PH_(X) cout << #X " = "; printHex(X); cout << ", " << flush;
 
+void fillRandom(char *buffer, bsl::size_t length, unsigned int seed)
+    // Load into the specified 'buffer' having the specified 'length' a
+    // pseudo-random sequence of bytes determined by the specified 'seed'.
+{
+    for (bsl::size_t i = 0; i < length; ++i) {
+        seed      = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+}
+
                         // -----------------------
                         // RFC 1952 IMPLEMENTATION
                         // -----------------------
@@ -516,7 +552,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -527,8 +563,8 @@ int main(int argc, char *argv[])
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Run the usage example functions 'senderExample' and
-        //   'receiverExample'.
+        //   Run the usage example functions 'senderExample',
+        //   'receiverExample', and 'combineExample'.
         //
         // Testing:
         //   Usage example.
@@ -546,6 +582,214 @@ int main(int argc, char *argv[])
 
         receiverExample(in);
 
+        combineExample();
+
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'Crc32_Impl'
+        //
+        // Concerns:
+        //: 1 Each implementation computes the CRC-32 checksum of the
+        //:   concatenation of the data whose checksum is the supplied
+        //:   checksum and the supplied data, for any length and alignment of
+        //:   the data, including lengths around the multiples of the 16 and
+        //:   64 bytes processed per step by the PCLMUL implementation.
+        //:
+        //: 2 'update' computes the same checksum when the data are supplied
+        //:   in pieces, whichever implementation each piece is processed by.
+        //
+        // Plan:
+        //: 1 For each length from 0 to 1100 bytes, each misalignment of a
+        //:   pseudo-random buffer up to 15 bytes, and several initial
+        //:   checksums, compare the results of 'calculateSoftware' and
+        //:   'calculatePclmul' with those of the oracle 'update_crc'.  (C-1)
+        //:
+        //: 2 Update objects with a pseudo-random buffer divided in pieces of
+        //:   various sizes, and compare their checksums with that of the
+        //:   oracle.  (C-2)
+        //
+        // Testing:
+        //   Crc32_Impl: calculateSoftware, calculatePclmul
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'Crc32_Impl'"
+                          << "\n==================" << endl;
+
+        if (verbose) {
+            P(Impl::isPclmulSupported());
+        }
+
+        enum { k_MAX_LENGTH = 1100, k_MAX_OFFSET = 16 };
+
+        static char buffer[k_MAX_LENGTH + k_MAX_OFFSET];
+        fillRandom(buffer, sizeof buffer, 1);
+
+        const Value SEEDS[] = { 0, 1, 0x12345678, 0xffffffff };
+        const int NUM_SEEDS = sizeof SEEDS / sizeof *SEEDS;
+
+        if (verbose) cout << "\nComparing implementations with oracle."
+                          << endl;
+
+        for (int si = 0; si < NUM_SEEDS; ++si) {
+            const Value SEED = SEEDS[si];
+
+            for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+                for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                    const char *DATA = buffer + offset;
+
+                    const Value EXP = update_crc(SEED, DATA, length);
+
+                    const Value SOFTWARE =
+                                Impl::calculateSoftware(DATA, length, SEED);
+                    const Value PCLMUL   =
+                                  Impl::calculatePclmul(DATA, length, SEED);
+
+                    LOOP4_ASSERT(si, offset, length, SOFTWARE,
+                                 EXP == SOFTWARE);
+                    LOOP4_ASSERT(si, offset, length, PCLMUL,
+                                 EXP == PCLMUL);
+                }
+            }
+        }
+
+        ASSERT(0 == Impl::calculateSoftware(0, 0));
+        ASSERT(0 == Impl::calculatePclmul(0, 0));
+
+        if (verbose) cout << "\nUpdating in pieces." << endl;
+
+        const int PIECE_SIZES[] = { 1, 15, 16, 17, 63, 64, 65, 200, 1000 };
+        const int NUM_PIECE_SIZES = sizeof PIECE_SIZES / sizeof *PIECE_SIZES;
+
+        for (int pi = 0; pi < NUM_PIECE_SIZES; ++pi) {
+            const int PIECE_SIZE = PIECE_SIZES[pi];
+
+            for (int length = 0; length <= k_MAX_LENGTH; length += 7) {
+                Obj mX;  const Obj& X = mX;
+
+                for (int i = 0; i < length; i += PIECE_SIZE) {
+                    const int NUM_BYTES = length - i < PIECE_SIZE
+                                        ? length - i
+                                        : PIECE_SIZE;
+                    mX.update(buffer + i, NUM_BYTES);
+                }
+
+                LOOP2_ASSERT(PIECE_SIZE, length,
+                             crc(buffer, length) == X.checksum());
+            }
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //
+        // Concerns:
+        //: 1 'combine' returns the checksum of the concatenation of two
+        //:   sequences of bytes, given their checksums and the length of the
+        //:   second one, for any lengths, including 0.
+        //:
+        //: 2 'combine' is correct for lengths having any bit set, including
+        //:   lengths too large for the data to be checksummed in a test.
+        //
+        // Plan:
+        //: 1 For each division of pseudo-random buffers of various lengths
+        //:   in two parts, compare the result of 'combine' applied to the
+        //:   checksums of the parts, computed by the oracle 'update_crc',
+        //:   with the checksum of the whole buffer.  (C-1)
+        //:
+        //: 2 For each length '2^k' and '2^k + 1', for 'k' up to 22, compare
+        //:   the result of 'combine' with the checksum of a pseudo-random
+        //:   prefix followed by that many zero bytes.  (C-2)
+        //:
+        //: 3 For pseudo-random lengths of up to 62 bits, verify that
+        //:   combining three checksums is associative.  (C-2)
+        //
+        // Testing:
+        //   static unsigned int combine(unsigned int, unsigned int, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'combine'"
+                          << "\n=================" << endl;
+
+        enum { k_MAX_LENGTH = 300 };
+
+        char buffer[k_MAX_LENGTH];
+        fillRandom(buffer, sizeof buffer, 2);
+
+        if (verbose) cout << "\nComparing with oracle." << endl;
+
+        for (int length = 0; length <= k_MAX_LENGTH; length += 3) {
+            const Value EXP = crc(buffer, length);
+
+            for (int split = 0; split <= length; ++split) {
+                const int   LENGTH_B = length - split;
+                const Value CRC_A    = crc(buffer, split);
+                const Value CRC_B    = crc(buffer + split, LENGTH_B);
+
+                LOOP2_ASSERT(length, split,
+                             EXP == Obj::combine(CRC_A, CRC_B, LENGTH_B));
+            }
+        }
+
+        if (verbose) cout << "\nCombining with long runs of zeros." << endl;
+
+        {
+            enum { k_MAX_LOG2 = 22 };
+
+            bsl::vector<char> zeros((1 << k_MAX_LOG2) + 1, 0);
+
+            const Value CRC_A = crc(buffer, k_MAX_LENGTH);
+
+            for (int k = 0; k <= k_MAX_LOG2; ++k) {
+                for (int d = 0; d <= 1; ++d) {
+                    const bsl::size_t LENGTH = (bsl::size_t(1) << k) + d;
+
+                    Obj mX(buffer, k_MAX_LENGTH);  const Obj& X = mX;
+                    mX.update(zeros.data(), LENGTH);
+
+                    const Value CRC_B = Obj(zeros.data(), LENGTH).checksum();
+
+                    LOOP2_ASSERT(k, d, X.checksum() ==
+                                           Obj::combine(CRC_A, CRC_B, LENGTH));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting associativity." << endl;
+
+        {
+            bsls::Types::Uint64 seed = 3;
+            for (int i = 0; i < 1000; ++i) {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                const bsls::Types::Uint64 LENGTH_B = seed >> 2;
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                const bsls::Types::Uint64 LENGTH_C = seed >> (2 + i % 60);
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+                if (bsl::size_t(-1) < LENGTH_B + LENGTH_C) {
+                    continue;
+                }
+
+                const Value CRC_A = static_cast<Value>(seed);
+                const Value CRC_B = static_cast<Value>(seed >> 7);
+                const Value CRC_C = static_cast<Value>(seed >> 13);
+
+                const bsl::size_t B = static_cast<bsl::size_t>(LENGTH_B);
+                const bsl::size_t C = static_cast<bsl::size_t>(LENGTH_C);
+
+                const Value LEFT  = Obj::combine(Obj::combine(CRC_A, CRC_B, B),
+                                               CRC_C,
+                                               C);
+                const Value RIGHT = Obj::combine(CRC_A,
+                                               Obj::combine(CRC_B, CRC_C, C),
+                                               B + C);
+
+                LOOP3_ASSERT(i, B, C, LEFT == RIGHT);
+            }
+        }
+
+        ASSERT(0x1234 == Obj::combine(0x1234, 0, 0));
+        ASSERT(0      == Obj::combine(0,      0, 1000000));
       } break;
       case 14: {
         // --------------------------------------------------------------------
@@ -2680,6 +2924,79 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THROUGHPUT
+        //
+        // Concerns:
+        //: 1 The PCLMUL implementation is faster than the portable one for
+        //:   inputs of at least 64 bytes.
+        //
+        // Plan:
+        //: 1 For inputs of 64 bytes to 1 MiB, time 'calculateSoftware',
+        //:   'calculatePclmul', and 'update' over a total of 256 MiB (or the
+        //:   number of MiB given as the second argument), and report their
+        //:   throughput in GB/s.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST: THROUGHPUT"
+                          << "\n============================" << endl;
+
+        int numMiB = argc > 2 ? atoi(argv[2]) : 0;
+        if (numMiB <= 0) {
+            numMiB = 256;
+        }
+        const double TOTAL = numMiB * 1024.0 * 1024.0;
+
+        cout << "PCLMUL supported: "
+             << Impl::isPclmulSupported() << endl;
+
+        const bsl::size_t SIZES[] = { 64, 256, 1024, 4096, 65536, 1 << 20 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        bsl::vector<char> buffer(1 << 20);
+        fillRandom(buffer.data(), buffer.size(), 3);
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const bsl::size_t SIZE = SIZES[i];
+            const int         REPS = static_cast<int>(TOTAL / SIZE);
+
+            Value           result = 0;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int j = 0; j < REPS; ++j) {
+                result ^= Impl::calculateSoftware(buffer.data(), SIZE);
+            }
+            timer.stop();
+            const double SOFTWARE = TOTAL / timer.elapsedTime() / 1e9;
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < REPS; ++j) {
+                result ^= Impl::calculatePclmul(buffer.data(), SIZE);
+            }
+            timer.stop();
+            const double PCLMUL = TOTAL / timer.elapsedTime() / 1e9;
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < REPS; ++j) {
+                result ^= Obj(buffer.data(), SIZE).checksum();
+            }
+            timer.stop();
+            const double UPDATE = TOTAL / timer.elapsedTime() / 1e9;
+
+            cout << "size " << SIZE
+                 << ": software " << SOFTWARE << " GB/s"
+                 << ", pclmul "   << PCLMUL   << " GB/s"
+                 << ", update "   << UPDATE   << " GB/s"
+                 << " (" << (result & 1) << ")" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
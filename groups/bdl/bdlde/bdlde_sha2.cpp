@@ -1,10 +1,60 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bdlde_cpufeatures.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_log.h>
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
+#include <bsl_cstring.h>
 #include <bsl_ostream.h>
 
+// IMPLEMENTATION NOTES
+// --------------------
+// The SHA-224 and SHA-256 block function ('transform' for 32-bit words) is
+// dispatched, once, to the fastest kernel supported by the running processor.
+// The SHA-NI kernel follows the reference code in Intel's "Intel SHA
+// Extensions" white paper (2013): the state is kept as the two vectors
+// 'ABEF' and 'CDGH' required by 'sha256rnds2', which performs two rounds,
+// and the message schedule is computed four words at a time with
+// 'sha256msg1' and 'sha256msg2'.
+//
+// The AVX2 kernel used by 'Sha2Util' hashes eight messages at once, holding
+// word 'i' of the state of message 'j' in 32-bit lane 'j' of vector 'i'.  The
+// blocks of the eight messages are transposed into that layout as they are
+// loaded.  Each message is padded separately, and a lane whose message has no
+// more blocks is fed an all-zero block whose result is discarded, so that
+// messages of different lengths can share a batch.  Since this kernel does
+// the work of eight portable block functions with little more than the
+// instruction count of one, it is the fastest kernel for batches of small
+// messages on processors lacking the SHA extensions.  It is about as fast as
+// the SHA-NI kernel applied to each message in turn for messages shorter than
+// a block, and slower for longer messages, so it is not used when the SHA
+// extensions are available.
+//
+// The AVX2 kernel clears the upper halves of the YMM registers with
+// 'vzeroupper' before returning, as the compiler does not do so for functions
+// built for a target that is not enabled on the command line.
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <immintrin.h>
+
+#define U_TARGET_AVX2   __attribute__((target("avx2")))
+#define U_TARGET_SHA_NI __attribute__((target("sha,sse4.1")))
+#endif
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -247,6 +297,19 @@ void transform(INTEGER             *state,
     }
 }
 
+void transform(bsl::uint32_t             *state,
+               const unsigned char       *message,
+               bsl::uint64_t              numberOfBuffers,
+               bsl::uint64_t              bufferSize,
+               const bsl::uint32_t      (&constants)[64]);
+    // Update the specified SHA-224 or SHA-256 'state' with the hashed
+    // contents of the specified 'message' having a length equal to the
+    // specified 'bufferSize' times the specified 'numberOfBuffers', using the
+    // fastest kernel supported by the running processor.  The behavior is
+    // undefined unless 'bufferSize' is 64 and 'constants' is
+    // 'sha256Constants'.  Note that this overload is preferred to the
+    // 'transform' template for 32-bit words.
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -344,6 +407,535 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
     }
 }
 
+                            // ------------------
+                            // VECTORIZED KERNELS
+                            // ------------------
+
+typedef void (*BlocksFn)(bsl::uint32_t *, const unsigned char *, bsl::size_t);
+    // 'BlocksFn' is an alias for the type of the SHA-256 block functions.
+
+typedef void (*DigestsFn)(unsigned char *,
+                          const void *const *,
+                          const bsl::size_t *,
+                          bsl::size_t);
+    // 'DigestsFn' is an alias for the type of the functions computing the
+    // digests of a batch of messages.
+
+const bsl::size_t k_SHA256_BLOCK_SIZE = 512 / 8;
+
+const bsl::uint32_t sha256InitialState[8] = {
+    // First 32 bits of the fractional part of the square root of the first 8
+    // primes.
+
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+void blocksPortable(bsl::uint32_t       *state,
+                    const unsigned char *blocks,
+                    bsl::size_t          numBlocks)
+    // Update the specified 'state' with the specified 'numBlocks' 64-byte
+    // 'blocks' using the portable implementation.
+{
+    transform<bsl::uint32_t, 64>(state,
+                                 blocks,
+                                 numBlocks,
+                                 k_SHA256_BLOCK_SIZE,
+                                 sha256Constants);
+}
+
+bsl::size_t loadSha256Tail(unsigned char       *tail,
+                           const unsigned char *message,
+                           bsl::size_t          length)
+    // Load into the specified 'tail', which must hold two blocks, the padded
+    // final blocks of the specified 'message' having the specified 'length',
+    // i.e., the 'length % 64' bytes that follow the last complete block,
+    // followed by the SHA-2 padding and the length in bits, and return the
+    // number of blocks (1 or 2) loaded.
+{
+    const bsl::size_t numComplete = length / k_SHA256_BLOCK_SIZE;
+    const bsl::size_t numLeft     = length % k_SHA256_BLOCK_SIZE;
+    const bsl::size_t numBlocks   = numLeft + 1 + sizeof(bsl::uint64_t)
+                                                         <= k_SHA256_BLOCK_SIZE
+                                    ? 1
+                                    : 2;
+
+    bsl::memset(tail, 0, 2 * k_SHA256_BLOCK_SIZE);
+    if (numLeft) {
+        bsl::memcpy(tail,
+                    message + numComplete * k_SHA256_BLOCK_SIZE,
+                    numLeft);
+    }
+    tail[numLeft] = 1 << 7;
+    unpack(static_cast<bsl::uint64_t>(length) * 8,
+           tail + numBlocks * k_SHA256_BLOCK_SIZE - sizeof(bsl::uint64_t));
+    return numBlocks;
+}
+
+void loadSha256Digest(unsigned char       *result,
+                      const unsigned char *message,
+                      bsl::size_t          length,
+                      BlocksFn             blocksFn)
+    // Load into the specified 'result' the SHA-256 digest of the specified
+    // 'message' having the specified 'length', computed with the specified
+    // 'blocksFn'.  Note that complete blocks are hashed in place, without
+    // being copied.
+{
+    bsl::uint32_t state[8];
+    bsl::copy(sha256InitialState, sha256InitialState + 8, state);
+
+    blocksFn(state, message, length / k_SHA256_BLOCK_SIZE);
+
+    unsigned char tail[2 * k_SHA256_BLOCK_SIZE];
+    blocksFn(state, tail, loadSha256Tail(tail, message, length));
+
+    for (int i = 0; i < 8; ++i) {
+        unpack(state[i], result + i * sizeof(bsl::uint32_t));
+    }
+}
+
+void digestsPortable(unsigned char      *results,
+                     const void *const  *messages,
+                     const bsl::size_t  *lengths,
+                     bsl::size_t         numMessages)
+    // Load into the specified 'results' the SHA-256 digests of the specified
+    // 'numMessages' 'messages' having the specified 'lengths', one at a time,
+    // using the portable block function.
+{
+    for (bsl::size_t i = 0; i < numMessages; ++i) {
+        loadSha256Digest(results + i * Sha256::k_DIGEST_SIZE,
+                         static_cast<const unsigned char *>(messages[i]),
+                         lengths[i],
+                         &blocksPortable);
+    }
+}
+
+#if defined(LIKE_X86_GCC)
+
+                           // --------------------
+                           // SHA-NI implementation
+                           // --------------------
+
+U_TARGET_SHA_NI
+inline
+void roundsShaNi(__m128i *state0, __m128i *state1, __m128i words, int group)
+    // Perform, on the specified 'state0' ('ABEF') and 'state1' ('CDGH'), the
+    // four rounds of the specified 'group' (i.e., rounds '4 * group' to
+    // '4 * group + 3'), whose message schedule words are the specified
+    // 'words'.
+{
+    const __m128i msg = _mm_add_epi32(
+            words,
+            _mm_loadu_si128((const __m128i *)(sha256Constants + 4 * group)));
+
+    *state1 = _mm_sha256rnds2_epu32(*state1, *state0, msg);
+    *state0 = _mm_sha256rnds2_epu32(*state0,
+                                    *state1,
+                                    _mm_shuffle_epi32(msg, 0x0e));
+}
+
+U_TARGET_SHA_NI
+inline
+__m128i scheduleShaNi(__m128i w0, __m128i w1, __m128i w2, __m128i w3)
+    // Return the message schedule words of the group of four rounds that
+    // follows the groups whose words are the specified 'w0', 'w1', 'w2', and
+    // 'w3', in that order.
+{
+    return _mm_sha256msg2_epu32(
+                       _mm_add_epi32(_mm_sha256msg1_epu32(w0, w1),
+                                     _mm_alignr_epi8(w3, w2, 4)),
+                       w3);
+}
+
+U_TARGET_SHA_NI
+void blocksShaNi(bsl::uint32_t       *state,
+                 const unsigned char *blocks,
+                 bsl::size_t          numBlocks)
+    // Update the specified 'state' with the specified 'numBlocks' 64-byte
+    // 'blocks' using the SHA extensions.
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                            0x0405060700010203ULL);
+
+    // Rearrange the state from 'ABCD' and 'EFGH' (with 'A' and 'E' in the
+    // lowest lanes) to 'ABEF' and 'CDGH' (with 'F' and 'H' lowest).
+
+    __m128i tmp    = _mm_loadu_si128((const __m128i *)state);
+    __m128i state1 = _mm_loadu_si128((const __m128i *)(state + 4));
+
+    tmp            = _mm_shuffle_epi32(tmp, 0xb1);     // CDAB
+    state1         = _mm_shuffle_epi32(state1, 0x1b);  // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);  // ABEF
+    state1         = _mm_blend_epi16(state1, tmp, 0xf0);  // CDGH
+
+    for (; numBlocks; --numBlocks, blocks += k_SHA256_BLOCK_SIZE) {
+        const __m128i abefSave = state0;
+        const __m128i cdghSave = state1;
+
+        const __m128i *block = (const __m128i *)blocks;
+
+        __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128(block),     byteSwap);
+        __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128(block + 1), byteSwap);
+        __m128i w2 = _mm_shuffle_epi8(_mm_loadu_si128(block + 2), byteSwap);
+        __m128i w3 = _mm_shuffle_epi8(_mm_loadu_si128(block + 3), byteSwap);
+
+        roundsShaNi(&state0, &state1, w0, 0);
+        roundsShaNi(&state0, &state1, w1, 1);
+        roundsShaNi(&state0, &state1, w2, 2);
+        roundsShaNi(&state0, &state1, w3, 3);
+
+        for (int group = 4; group < 16; group += 4) {
+            w0 = scheduleShaNi(w0, w1, w2, w3);
+            roundsShaNi(&state0, &state1, w0, group);
+            w1 = scheduleShaNi(w1, w2, w3, w0);
+            roundsShaNi(&state0, &state1, w1, group + 1);
+            w2 = scheduleShaNi(w2, w3, w0, w1);
+            roundsShaNi(&state0, &state1, w2, group + 2);
+            w3 = scheduleShaNi(w3, w0, w1, w2);
+            roundsShaNi(&state0, &state1, w3, group + 3);
+        }
+
+        state0 = _mm_add_epi32(state0, abefSave);
+        state1 = _mm_add_epi32(state1, cdghSave);
+    }
+
+    tmp    = _mm_shuffle_epi32(state0, 0x1b);       // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xb1);       // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xf0);    // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);       // HGFE
+
+    _mm_storeu_si128((__m128i *)state, state0);
+    _mm_storeu_si128((__m128i *)(state + 4), state1);
+}
+
+void digestsShaNi(unsigned char      *results,
+                  const void *const  *messages,
+                  const bsl::size_t  *lengths,
+                  bsl::size_t         numMessages)
+    // Load into the specified 'results' the SHA-256 digests of the specified
+    // 'numMessages' 'messages' having the specified 'lengths', one at a time,
+    // using the SHA extensions.
+{
+    for (bsl::size_t i = 0; i < numMessages; ++i) {
+        loadSha256Digest(results + i * Sha256::k_DIGEST_SIZE,
+                         static_cast<const unsigned char *>(messages[i]),
+                         lengths[i],
+                         &blocksShaNi);
+    }
+}
+
+                            // -------------------
+                            // AVX2 implementation
+                            // -------------------
+
+U_TARGET_AVX2
+inline
+__m256i rotateRightAvx2(__m256i value, int shift)
+    // Return the specified 'value' with each 32-bit lane rotated by the
+    // specified 'shift' bits to the right.
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+                           _mm256_slli_epi32(value, 32 - shift));
+}
+
+U_TARGET_AVX2
+inline
+void transposeAvx2(__m256i *rows)
+    // Transpose, in place, the 8x8 matrix of 32-bit words held in the
+    // specified 'rows'.
+{
+    const __m256i t0 = _mm256_unpacklo_epi32(rows[0], rows[1]);
+    const __m256i t1 = _mm256_unpackhi_epi32(rows[0], rows[1]);
+    const __m256i t2 = _mm256_unpacklo_epi32(rows[2], rows[3]);
+    const __m256i t3 = _mm256_unpackhi_epi32(rows[2], rows[3]);
+    const __m256i t4 = _mm256_unpacklo_epi32(rows[4], rows[5]);
+    const __m256i t5 = _mm256_unpackhi_epi32(rows[4], rows[5]);
+    const __m256i t6 = _mm256_unpacklo_epi32(rows[6], rows[7]);
+    const __m256i t7 = _mm256_unpackhi_epi32(rows[6], rows[7]);
+
+    const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+    rows[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    rows[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    rows[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    rows[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    rows[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    rows[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    rows[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    rows[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+U_TARGET_AVX2
+void digestsLanesAvx2(unsigned char      *results,
+                      const void *const  *messages,
+                      const bsl::size_t  *lengths,
+                      bsl::size_t         numMessages)
+    // Load into the specified 'results' the SHA-256 digests of the specified
+    // 'numMessages' 'messages' having the specified 'lengths', hashing the
+    // messages in parallel, one per 32-bit lane.  The behavior is undefined
+    // unless '0 < numMessages <= 8'.
+{
+    const int k_NUM_LANES = 8;
+
+    static const unsigned char zeroBlock[k_SHA256_BLOCK_SIZE] = { 0 };
+
+    const __m256i byteSwap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                               0x0405060700010203ULL,
+                                               0x0c0d0e0f08090a0bULL,
+                                               0x0405060700010203ULL);
+
+    const unsigned char *data[k_NUM_LANES];
+    bsl::size_t          numComplete[k_NUM_LANES];
+    bsl::size_t          numBlocks[k_NUM_LANES];
+    unsigned char        tails[k_NUM_LANES][2 * k_SHA256_BLOCK_SIZE];
+    bsl::size_t          maxBlocks = 0;
+
+    for (int j = 0; j < k_NUM_LANES; ++j) {
+        if (bsl::size_t(j) < numMessages) {
+            data[j]        = static_cast<const unsigned char *>(messages[j]);
+            numComplete[j] = lengths[j] / k_SHA256_BLOCK_SIZE;
+            numBlocks[j]   = numComplete[j]
+                           + loadSha256Tail(tails[j], data[j], lengths[j]);
+            maxBlocks      = bsl::max(maxBlocks, numBlocks[j]);
+        }
+        else {
+            data[j]        = zeroBlock;
+            numComplete[j] = 0;
+            numBlocks[j]   = 0;
+        }
+    }
+
+    __m256i state[8];
+    for (int i = 0; i < 8; ++i) {
+        state[i] = _mm256_set1_epi32(static_cast<int>(sha256InitialState[i]));
+    }
+
+    for (bsl::size_t bi = 0; bi < maxBlocks; ++bi) {
+        const unsigned char *block[k_NUM_LANES];
+        int                  isActive[k_NUM_LANES];
+        for (int j = 0; j < k_NUM_LANES; ++j) {
+            if (bi < numComplete[j]) {
+                block[j] = data[j] + bi * k_SHA256_BLOCK_SIZE;
+            }
+            else if (bi < numBlocks[j]) {
+                block[j] = tails[j] + (bi - numComplete[j])
+                                                         * k_SHA256_BLOCK_SIZE;
+            }
+            else {
+                block[j] = zeroBlock;
+            }
+            isActive[j] = bi < numBlocks[j] ? -1 : 0;
+        }
+
+        // Load the message schedule, transposing each half block of the
+        // eight messages so that word 'i' of message 'j' is in lane 'j' of
+        // 'w[i]'.
+
+        __m256i w[64];
+        for (int half = 0; half < 2; ++half) {
+            for (int j = 0; j < k_NUM_LANES; ++j) {
+                w[8 * half + j] = _mm256_shuffle_epi8(
+                   _mm256_loadu_si256((const __m256i *)(block[j] + 32 * half)),
+                   byteSwap);
+            }
+            transposeAvx2(w + 8 * half);
+        }
+        for (int i = 16; i < 64; ++i) {
+            const __m256i s0 = _mm256_xor_si256(
+                              _mm256_xor_si256(rotateRightAvx2(w[i - 15], 7),
+                                               rotateRightAvx2(w[i - 15], 18)),
+                              _mm256_srli_epi32(w[i - 15], 3));
+            const __m256i s1 = _mm256_xor_si256(
+                              _mm256_xor_si256(rotateRightAvx2(w[i - 2], 17),
+                                               rotateRightAvx2(w[i - 2], 19)),
+                              _mm256_srli_epi32(w[i - 2], 10));
+            w[i] = _mm256_add_epi32(_mm256_add_epi32(w[i - 16], s0),
+                                    _mm256_add_epi32(w[i - 7], s1));
+        }
+
+        __m256i a = state[0], b = state[1], c = state[2], d = state[3];
+        __m256i e = state[4], f = state[5], g = state[6], h = state[7];
+        for (int i = 0; i < 64; ++i) {
+            const __m256i bigS1 = _mm256_xor_si256(
+                                     _mm256_xor_si256(rotateRightAvx2(e, 6),
+                                                      rotateRightAvx2(e, 11)),
+                                     rotateRightAvx2(e, 25));
+            const __m256i ch    = _mm256_xor_si256(_mm256_and_si256(e, f),
+                                                   _mm256_andnot_si256(e, g));
+            const __m256i t1    = _mm256_add_epi32(
+                    _mm256_add_epi32(_mm256_add_epi32(h, bigS1),
+                                     _mm256_add_epi32(ch, w[i])),
+                    _mm256_set1_epi32(static_cast<int>(sha256Constants[i])));
+            const __m256i bigS0 = _mm256_xor_si256(
+                                     _mm256_xor_si256(rotateRightAvx2(a, 2),
+                                                      rotateRightAvx2(a, 13)),
+                                     rotateRightAvx2(a, 22));
+            const __m256i maj   = _mm256_or_si256(
+                                  _mm256_and_si256(a, b),
+                                  _mm256_and_si256(_mm256_or_si256(a, b), c));
+
+            h = g;
+            g = f;
+            f = e;
+            e = _mm256_add_epi32(d, t1);
+            d = c;
+            c = b;
+            b = a;
+            a = _mm256_add_epi32(t1, _mm256_add_epi32(bigS0, maj));
+        }
+
+        // Update the state of the lanes whose messages have this block.
+
+        const __m256i active = _mm256_loadu_si256((const __m256i *)isActive);
+        const __m256i sums[8] = {
+            _mm256_add_epi32(state[0], a),  _mm256_add_epi32(state[1], b),
+            _mm256_add_epi32(state[2], c),  _mm256_add_epi32(state[3], d),
+            _mm256_add_epi32(state[4], e),  _mm256_add_epi32(state[5], f),
+            _mm256_add_epi32(state[6], g),  _mm256_add_epi32(state[7], h)
+        };
+        for (int i = 0; i < 8; ++i) {
+            state[i] = _mm256_blendv_epi8(state[i], sums[i], active);
+        }
+    }
+
+    // Transpose the state back to one digest per lane, in big-endian order.
+
+    transposeAvx2(state);
+
+    for (int j = 0; bsl::size_t(j) < numMessages; ++j) {
+        _mm256_storeu_si256((__m256i *)(results + j * Sha256::k_DIGEST_SIZE),
+                            _mm256_shuffle_epi8(state[j], byteSwap));
+    }
+
+    _mm256_zeroupper();
+}
+
+void digestsAvx2(unsigned char      *results,
+                 const void *const  *messages,
+                 const bsl::size_t  *lengths,
+                 bsl::size_t         numMessages)
+    // Load into the specified 'results' the SHA-256 digests of the specified
+    // 'numMessages' 'messages' having the specified 'lengths', eight at a
+    // time, using AVX2 instructions.
+{
+    const bsl::size_t k_NUM_LANES = 8;
+
+    for (bsl::size_t i = 0; i < numMessages; i += k_NUM_LANES) {
+        digestsLanesAvx2(results + i * Sha256::k_DIGEST_SIZE,
+                         messages + i,
+                         lengths + i,
+                         bsl::min(k_NUM_LANES, numMessages - i));
+    }
+}
+
+#endif  // LIKE_X86_GCC
+
+                            //=====================
+                            // class Sha2Dispatcher
+                            //=====================
+
+class Sha2Dispatcher {
+    // This class represents a singleton that selects, on construction, the
+    // fastest kernels supported by the running processor.
+
+    // DATA
+    BlocksFn  d_blocksFn;
+    DigestsFn d_digestsFn;
+
+    // CREATORS
+    Sha2Dispatcher();
+        // Create an instance of this class.
+
+    // NOT IMPLEMENTED
+    Sha2Dispatcher(const Sha2Dispatcher&);             // = delete;
+    Sha2Dispatcher& operator=(const Sha2Dispatcher&);  // = delete;
+
+  public:
+    // CLASS METHODS
+    static const Sha2Dispatcher& instance();
+        // Return a reference to the singleton object.
+
+    // ACCESSORS
+    BlocksFn blocksFn() const;
+        // Return the selected SHA-256 block function.
+
+    DigestsFn digestsFn() const;
+        // Return the selected function computing the SHA-256 digests of a
+        // batch of messages.
+};
+
+Sha2Dispatcher::Sha2Dispatcher()
+: d_blocksFn(&blocksPortable)
+, d_digestsFn(&digestsPortable)
+{
+#if defined(LIKE_X86_GCC)
+    if (Sha2Util_Impl::isShaNiSupported()) {
+        BSLS_LOG_INFO("Using SHA-NI version for SHA-256");
+        d_blocksFn  = &blocksShaNi;
+        d_digestsFn = &digestsShaNi;
+    }
+    else if (Sha2Util_Impl::isAvx2Supported()) {
+        BSLS_LOG_INFO("Using AVX2 version for batches of SHA-256 digests "
+                      "(SHA extensions not available)");
+        d_digestsFn = &digestsAvx2;
+    }
+    else {
+        BSLS_LOG_INFO("Using software version for SHA-256 "
+                      "(SHA extensions and AVX2 not available)");
+    }
+#else
+    BSLS_LOG_INFO("Using software version for SHA-256 "
+                  "(unsupported platform)");
+#endif
+}
+
+const Sha2Dispatcher& Sha2Dispatcher::instance()
+{
+    static const Sha2Dispatcher *theInstance_p = 0;
+    BSLMT_ONCE_DO {
+        static const Sha2Dispatcher theInstance;
+        theInstance_p = &theInstance;
+    }
+    return *theInstance_p;
+}
+
+inline
+BlocksFn Sha2Dispatcher::blocksFn() const
+{
+    return d_blocksFn;
+}
+
+inline
+DigestsFn Sha2Dispatcher::digestsFn() const
+{
+    return d_digestsFn;
+}
+
+void transform(bsl::uint32_t             *state,
+               const unsigned char       *message,
+               bsl::uint64_t              numberOfBuffers,
+               bsl::uint64_t              bufferSize,
+               const bsl::uint32_t      (&constants)[64])
+{
+    BSLS_ASSERT(k_SHA256_BLOCK_SIZE == bufferSize);
+    BSLS_ASSERT(&sha256Constants    == &constants);
+
+    (void)bufferSize;
+    (void)constants;
+
+    Sha2Dispatcher::instance().blocksFn()(
+                                  state,
+                                  message,
+                                  static_cast<bsl::size_t>(numberOfBuffers));
+}
+
 } // close unnamed namespace
 
 Sha224::Sha224()
@@ -650,6 +1242,117 @@ bsl::ostream& Sha512::print(bsl::ostream& stream) const
     return stream;
 }
 
+                               // ---------------
+                               // struct Sha2Util
+                               // ---------------
+
+// CLASS METHODS
+void Sha2Util::loadSha256Digests(unsigned char      *results,
+                                 const void *const  *messages,
+                                 const bsl::size_t  *lengths,
+                                 bsl::size_t         numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+    Sha2Dispatcher::instance().digestsFn()(results,
+                                           messages,
+                                           lengths,
+                                           numMessages);
+}
+
+                             // --------------------
+                             // struct Sha2Util_Impl
+                             // --------------------
+
+// CLASS METHODS
+bool Sha2Util_Impl::isAvx2Supported()
+{
+    return CpuFeatures::isAvx2Supported();
+}
+
+bool Sha2Util_Impl::isShaNiSupported()
+{
+    // The SHA-NI kernel also uses SSE4.1 instructions.
+
+    return CpuFeatures::isShaNiSupported() && CpuFeatures::isSse41Supported();
+}
+
+void Sha2Util_Impl::loadSha256DigestsAvx2(unsigned char      *results,
+                                          const void *const  *messages,
+                                          const bsl::size_t  *lengths,
+                                          bsl::size_t         numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+#if defined(LIKE_X86_GCC)
+    if (isAvx2Supported()) {
+        digestsAvx2(results, messages, lengths, numMessages);
+        return;                                                       // RETURN
+    }
+#endif
+    digestsPortable(results, messages, lengths, numMessages);
+}
+
+void Sha2Util_Impl::loadSha256DigestsPortable(unsigned char      *results,
+                                              const void *const  *messages,
+                                              const bsl::size_t  *lengths,
+                                              bsl::size_t         numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+    digestsPortable(results, messages, lengths, numMessages);
+}
+
+void Sha2Util_Impl::loadSha256DigestsShaNi(unsigned char      *results,
+                                           const void *const  *messages,
+                                           const bsl::size_t  *lengths,
+                                           bsl::size_t         numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+#if defined(LIKE_X86_GCC)
+    if (isShaNiSupported()) {
+        digestsShaNi(results, messages, lengths, numMessages);
+        return;                                                       // RETURN
+    }
+#endif
+    digestsPortable(results, messages, lengths, numMessages);
+}
+
+void Sha2Util_Impl::transformSha256Portable(bsl::uint32_t       *state,
+                                            const unsigned char *blocks,
+                                            bsl::size_t          numBlocks)
+{
+    BSLS_ASSERT(state);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+
+    blocksPortable(state, blocks, numBlocks);
+}
+
+void Sha2Util_Impl::transformSha256ShaNi(bsl::uint32_t       *state,
+                                         const unsigned char *blocks,
+                                         bsl::size_t          numBlocks)
+{
+    BSLS_ASSERT(state);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+
+#if defined(LIKE_X86_GCC)
+    if (isShaNiSupported()) {
+        blocksShaNi(state, blocks, numBlocks);
+        return;                                                       // RETURN
+    }
+#endif
+    blocksPortable(state, blocks, numBlocks);
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
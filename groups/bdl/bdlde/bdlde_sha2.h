@@ -12,6 +12,8 @@ BSLS_IDENT("$Id$ $CSID$")
 //  bdlde::Sha256: value-semantic type representing a SHA-256 digest
 //  bdlde::Sha384: value-semantic type representing a SHA-384 digest
 //  bdlde::Sha512: value-semantic type representing a SHA-512 digest
+//  bdlde::Sha2Util: compute the SHA-256 digests of many messages at once
+//  bdlde::Sha2Util_Impl: alternative implementations, for testing only
 //
 //@SEE_ALSO: bdlde_md5
 //
@@ -25,6 +27,36 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+// In addition, the 'struct' 'bdlde::Sha2Util' provides a function,
+// 'loadSha256Digests', that computes the SHA-256 digests of a batch of
+// independent messages.  For small messages this is substantially faster than
+// hashing each message with a separate 'bdlde::Sha256' object, as the work of
+// several messages can proceed in parallel.  The struct 'bdlde::Sha2Util_Impl'
+// exposes each alternative implementation so that they can be tested and
+// benchmarked against one another; it should not be used otherwise.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// On x86 and x86-64 platforms built with a GCC-compatible compiler, the
+// SHA-224 and SHA-256 block function used by 'bdlde::Sha224', 'bdlde::Sha256'
+// and 'bdlde::Sha2Util' is implemented with the SHA extensions ("SHA-NI") in
+// addition to the portable implementation, and 'bdlde::Sha2Util' can also hash
+// eight messages in parallel, one per 32-bit lane of an AVX2 register.  The
+// implementation is selected once, on first use, by querying the running
+// processor with 'cpuid':
+//: o The SHA extensions are used if the processor supports them; this is the
+//:   fastest implementation for single messages, and for batches of messages
+//:   of a block (64 bytes) or more.
+//:
+//: o Otherwise, 'bdlde::Sha2Util' uses the AVX2 implementation if the
+//:   processor and the operating system support it.
+//:
+//: o Otherwise, the portable implementation is used.
+//
+// The portable implementation is used on all other platforms, and for SHA-384
+// and SHA-512.  See the test driver for this component in the '.t.cpp' for a
+// benchmark, in GB/s, of each implementation across message sizes.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.  The
@@ -73,6 +105,47 @@ BSLS_IDENT("$Id$ $CSID$")
 //      ASSERT(validatePassword(password, salt, expected));
 //  }
 //..
+//
+///Example 2: Hashing a Batch of Small Messages
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we store small objects by content, and need the SHA-256 digest
+// of each object in a batch that has just been received.
+//
+// First, we describe each object by its address and length:
+//..
+//  const char *const objects[] = { "abc", "", "some object", "abc" };
+//  const bsl::size_t NUM_OBJECTS = sizeof objects / sizeof *objects;
+//
+//  const void  *messages[NUM_OBJECTS];
+//  bsl::size_t  lengths[NUM_OBJECTS];
+//  for (bsl::size_t i = 0; i < NUM_OBJECTS; ++i) {
+//      messages[i] = objects[i];
+//      lengths[i]  = bsl::strlen(objects[i]);
+//  }
+//..
+// Then, we compute all of the digests with a single call:
+//..
+//  unsigned char digests[NUM_OBJECTS][bdlde::Sha256::k_DIGEST_SIZE];
+//  bdlde::Sha2Util::loadSha256Digests(&digests[0][0],
+//                                     messages,
+//                                     lengths,
+//                                     NUM_OBJECTS);
+//..
+// Finally, we observe that each digest is the one computed by 'Sha256', and
+// that equal objects have equal digests:
+//..
+//  for (bsl::size_t i = 0; i < NUM_OBJECTS; ++i) {
+//      unsigned char expected[bdlde::Sha256::k_DIGEST_SIZE];
+//      bdlde::Sha256(messages[i], lengths[i]).loadDigest(expected);
+//
+//      ASSERT(bsl::equal(expected,
+//                        expected + bdlde::Sha256::k_DIGEST_SIZE,
+//                        digests[i]));
+//  }
+//  ASSERT(bsl::equal(digests[0],
+//                    digests[0] + bdlde::Sha256::k_DIGEST_SIZE,
+//                    digests[3]));
+//..
 
 #include <bdlscm_version.h>
 
@@ -484,6 +557,79 @@ bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
     // Write to the specified output 'stream' the specified SHA-2 'digest' and
     // return a reference to the modifiable 'stream'.
 
+                               // ===============
+                               // struct Sha2Util
+                               // ===============
+
+struct Sha2Util {
+    // This 'struct' provides a namespace for functions that compute the
+    // digests of many independent messages at once, using the fastest
+    // implementation supported by the running processor.
+
+    // CLASS METHODS
+    static void loadSha256Digests(unsigned char      *results,
+                                  const void *const  *messages,
+                                  const bsl::size_t  *lengths,
+                                  bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digest of each of the
+        // specified 'numMessages' messages, the 'i'th of which is at
+        // 'messages[i]' and has 'lengths[i]' bytes, as 'numMessages'
+        // consecutive digests of 'Sha256::k_DIGEST_SIZE' bytes each.  The
+        // behavior is undefined unless 'results' can hold
+        // 'numMessages * Sha256::k_DIGEST_SIZE' bytes, 'messages' and
+        // 'lengths' each have at least 'numMessages' elements, and
+        // '[messages[i], messages[i] + lengths[i])' is a valid range for each
+        // 'i'.  Note that 'messages[i]' may be 0 if 'lengths[i]' is 0.
+};
+
+                             // ====================
+                             // struct Sha2Util_Impl
+                             // ====================
+
+struct Sha2Util_Impl {
+    // This 'struct' provides the alternative implementations of the SHA-256
+    // block function and of 'Sha2Util::loadSha256Digests'.  A function
+    // requiring instructions that are not supported by the running processor
+    // uses the portable implementation instead.
+
+    // CLASS METHODS
+    static bool isAvx2Supported();
+        // Return 'true' if the running processor and operating system support
+        // AVX2 instructions and this component was built to use them, and
+        // 'false' otherwise.
+
+    static bool isShaNiSupported();
+        // Return 'true' if the running processor supports the SHA extensions
+        // and this component was built to use them, and 'false' otherwise.
+
+    static void loadSha256DigestsAvx2(unsigned char      *results,
+                                      const void *const  *messages,
+                                      const bsl::size_t  *lengths,
+                                      bsl::size_t         numMessages);
+    static void loadSha256DigestsPortable(unsigned char      *results,
+                                          const void *const  *messages,
+                                          const bsl::size_t  *lengths,
+                                          bsl::size_t         numMessages);
+    static void loadSha256DigestsShaNi(unsigned char      *results,
+                                       const void *const  *messages,
+                                       const bsl::size_t  *lengths,
+                                       bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digest of each of the
+        // specified 'numMessages' messages, the 'i'th of which is at
+        // 'messages[i]' and has 'lengths[i]' bytes.  See
+        // 'Sha2Util::loadSha256Digests'.
+
+    static void transformSha256Portable(bsl::uint32_t       *state,
+                                        const unsigned char *blocks,
+                                        bsl::size_t          numBlocks);
+    static void transformSha256ShaNi(bsl::uint32_t       *state,
+                                     const unsigned char *blocks,
+                                     bsl::size_t          numBlocks);
+        // Update the specified SHA-224 or SHA-256 'state', an array of 8
+        // words, with the specified 'numBlocks' 64-byte blocks at the
+        // specified 'blocks'.
+};
+
 // ============================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -133,9 +134,20 @@ using namespace bsl;
 // [23] bsl::ostream& operator<<(bsl::ostream& stream, const Sha256& digest);
 // [24] bsl::ostream& operator<<(bsl::ostream& stream, const Sha384& digest);
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
+//
+// UTILITIES
+// [27] void Sha2Util::loadSha256Digests(results, messages, lengths, num);
+// [26] bool Sha2Util_Impl::isAvx2Supported();
+// [26] bool Sha2Util_Impl::isShaNiSupported();
+// [26] void Sha2Util_Impl::loadSha256DigestsAvx2(...);
+// [26] void Sha2Util_Impl::loadSha256DigestsPortable(...);
+// [26] void Sha2Util_Impl::loadSha256DigestsShaNi(...);
+// [26] void Sha2Util_Impl::transformSha256Portable(...);
+// [26] void Sha2Util_Impl::transformSha256ShaNi(...);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
+// [-1] PERFORMANCE: THROUGHPUT ACROSS MESSAGE SIZES
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -336,6 +348,51 @@ void assertPasswordIsExpected()
 
     ASSERT(validatePassword(password, salt, expected));
 }
+//..
+//
+///Example 2: Hashing a Batch of Small Messages
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we store small objects by content, and need the SHA-256 digest
+// of each object in a batch that has just been received.
+//
+// First, we describe each object by its address and length:
+//..
+void hashBatch()
+    // Compute the digests of a batch of objects and verify them.
+{
+    const char *const objects[] = { "abc", "", "some object", "abc" };
+    const bsl::size_t NUM_OBJECTS = sizeof objects / sizeof *objects;
+
+    const void  *messages[NUM_OBJECTS];
+    bsl::size_t  lengths[NUM_OBJECTS];
+    for (bsl::size_t i = 0; i < NUM_OBJECTS; ++i) {
+        messages[i] = objects[i];
+        lengths[i]  = bsl::strlen(objects[i]);
+    }
+//..
+// Then, we compute all of the digests with a single call:
+//..
+    unsigned char digests[NUM_OBJECTS][bdlde::Sha256::k_DIGEST_SIZE];
+    bdlde::Sha2Util::loadSha256Digests(&digests[0][0],
+                                       messages,
+                                       lengths,
+                                       NUM_OBJECTS);
+//..
+// Finally, we observe that each digest is the one computed by 'Sha256', and
+// that equal objects have equal digests:
+//..
+    for (bsl::size_t i = 0; i < NUM_OBJECTS; ++i) {
+        unsigned char expected[bdlde::Sha256::k_DIGEST_SIZE];
+        bdlde::Sha256(messages[i], lengths[i]).loadDigest(expected);
+
+        ASSERT(bsl::equal(expected,
+                          expected + bdlde::Sha256::k_DIGEST_SIZE,
+                          digests[i]));
+    }
+    ASSERT(bsl::equal(digests[0],
+                      digests[0] + bdlde::Sha256::k_DIGEST_SIZE,
+                      digests[3]));
+}
 
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
@@ -495,6 +552,93 @@ void testTwoArgumentConstructor(const char (&message)[LENGTH])
     ASSERT(digest1 == digest2);
 }
 
+bsl::uint32_t nextRandom(bsl::uint32_t *seed)
+    // Return the next pseudo-random value of the sequence having the
+    // specified 'seed', and update 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (*seed >> 16) | (*seed << 16);
+}
+
+typedef void (*DigestsFn)(unsigned char *,
+                          const void *const *,
+                          const bsl::size_t *,
+                          bsl::size_t);
+
+void testLoadSha256Digests(DigestsFn loadDigests)
+    // Verify that the specified 'loadDigests', an implementation of
+    // 'Sha2Util::loadSha256Digests', loads the SHA-256 digest of each message
+    // of batches of known messages, and of messages of various lengths, and
+    // does not write beyond the digests.
+{
+    const bsl::size_t k_SIZE = bdlde::Sha256::k_DIGEST_SIZE;
+
+    // The known messages, in one batch.
+    {
+        const bsl::size_t NUM_MESSAGES = arraySize(inputMessages);
+
+        const void    *messages[NUM_MESSAGES];
+        bsl::size_t    lengths[NUM_MESSAGES];
+        unsigned char  results[NUM_MESSAGES][k_SIZE];
+        for (bsl::size_t i = 0; i < NUM_MESSAGES; ++i) {
+            messages[i] = inputMessages[i].data();
+            lengths[i]  = inputMessages[i].length();
+        }
+
+        loadDigests(&results[0][0], messages, lengths, NUM_MESSAGES);
+
+        bsl::string hexDigest;
+        for (bsl::size_t i = 0; i < NUM_MESSAGES; ++i) {
+            toHex(&hexDigest, results[i]);
+            ASSERTV(i, hexDigest, sha256Results[i] == hexDigest);
+        }
+    }
+
+    // Batches of every size up to 19, with lengths around block boundaries.
+    {
+        const bsl::size_t LENGTHS[] = { 0, 1, 3, 31, 55, 56, 63, 64, 65, 100,
+                                        119, 120, 127, 128, 129, 200, 1000 };
+        const bsl::size_t NUM_LENGTHS = arraySize(LENGTHS);
+
+        bsl::vector<unsigned char> data(1000 + 19 * 7);
+        bsl::uint32_t              seed = 7;
+        for (bsl::size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<unsigned char>(nextRandom(&seed));
+        }
+
+        for (bsl::size_t num = 0; num < 20; ++num) {
+            for (bsl::size_t offset = 0; offset < NUM_LENGTHS; ++offset) {
+                bsl::vector<const void *>  messages(num + 1);
+                bsl::vector<bsl::size_t>   lengths(num + 1);
+                bsl::vector<unsigned char> results((num + 1) * k_SIZE, 0xa5);
+
+                for (bsl::size_t i = 0; i < num; ++i) {
+                    lengths[i]  = LENGTHS[(i * 5 + offset) % NUM_LENGTHS];
+                    messages[i] = lengths[i] ? &data[i * 7] : 0;
+                }
+
+                loadDigests(results.data(),
+                            messages.data(),
+                            lengths.data(),
+                            num);
+
+                for (bsl::size_t i = 0; i < num; ++i) {
+                    unsigned char expected[k_SIZE];
+                    bdlde::Sha256(messages[i], lengths[i]).loadDigest(
+                                                                     expected);
+                    ASSERTV(num, offset, i, lengths[i],
+                            bsl::equal(expected,
+                                       expected + k_SIZE,
+                                       &results[i * k_SIZE]));
+                }
+                for (bsl::size_t i = num * k_SIZE; i < results.size(); ++i) {
+                    ASSERTV(num, offset, i, 0xa5 == results[i]);
+                }
+            }
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -509,18 +653,19 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
-        //   This will test the usage example provided in the component header
+        //   This will test the usage examples provided in the component header
         //   file.
         //
         // Concerns:
-        //   The usage example provided in the component header file must
+        //   The usage examples provided in the component header file must
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Run the usage example function 'assertPasswordIsExpected'.
+        //   Run the usage example functions 'assertPasswordIsExpected' and
+        //   'hashBatch'.
         //
         // Testing:
         //   Usage example.
@@ -530,6 +675,122 @@ int main(int argc, char *argv[])
                           << "=====================" "\n";
 
         assertPasswordIsExpected();
+        hashBatch();
+      } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'Sha2Util::loadSha256Digests'
+        //
+        // Concerns:
+        //: 1 Each digest loaded is the SHA-256 digest of the corresponding
+        //:   message.
+        //:
+        //: 2 Messages of different lengths, including empty messages, can be
+        //:   hashed in the same batch, and a batch may be empty.
+        //:
+        //: 3 No memory beyond the digests is written.
+        //
+        // Plan:
+        //: 1 Hash the known messages, in one batch, and compare the digests
+        //:   to the expected values.  (C-1)
+        //:
+        //: 2 For batches of every size from 0 to 19, of messages whose
+        //:   lengths vary across block boundaries, compare each digest to
+        //:   that computed by 'Sha256', and verify that a sentinel following
+        //:   the digests is unchanged.  (C-1..3)
+        //
+        // Testing:
+        //   void Sha2Util::loadSha256Digests(results, messages, lengths, num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'Sha2Util::loadSha256Digests'" "\n"
+                             "======================================" "\n";
+
+        testLoadSha256Digests(&bdlde::Sha2Util::loadSha256Digests);
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'Sha2Util_Impl'
+        //
+        // Concerns:
+        //: 1 Each implementation of the SHA-256 block function updates a
+        //:   state identically, for any number of blocks.
+        //:
+        //: 2 Each implementation of 'loadSha256Digests' loads the SHA-256
+        //:   digest of each message, for batches of any size holding messages
+        //:   of any lengths, and writes no memory beyond the digests.
+        //:
+        //: 3 An implementation that is not supported by the running processor
+        //:   falls back to the portable implementation.
+        //
+        // Plan:
+        //: 1 Apply each block function to pseudo-random states and blocks, for
+        //:   0 to 9 blocks, and compare the results to those of the portable
+        //:   block function.  (C-1, 3)
+        //:
+        //: 2 Test each implementation of 'loadSha256Digests' as in case 27.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   bool Sha2Util_Impl::isAvx2Supported();
+        //   bool Sha2Util_Impl::isShaNiSupported();
+        //   void Sha2Util_Impl::loadSha256DigestsAvx2(...);
+        //   void Sha2Util_Impl::loadSha256DigestsPortable(...);
+        //   void Sha2Util_Impl::loadSha256DigestsShaNi(...);
+        //   void Sha2Util_Impl::transformSha256Portable(...);
+        //   void Sha2Util_Impl::transformSha256ShaNi(...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'Sha2Util_Impl'" "\n"
+                             "=======================" "\n";
+
+        typedef bdlde::Sha2Util_Impl Impl;
+
+        if (verbose) cout << "SHA-NI: " << Impl::isShaNiSupported()
+                          << ", AVX2: " << Impl::isAvx2Supported() << "\n";
+
+        if (verbose) cout << "Block functions\n";
+        {
+            const bsl::size_t k_MAX_BLOCKS = 9;
+
+            bsl::vector<unsigned char> blocks(k_MAX_BLOCKS * 64);
+            bsl::uint32_t              seed = 1;
+            for (int iteration = 0; iteration < 20; ++iteration) {
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    blocks[i] = static_cast<unsigned char>(nextRandom(&seed));
+                }
+                bsl::uint32_t initial[8];
+                for (int i = 0; i < 8; ++i) {
+                    initial[i] = nextRandom(&seed);
+                }
+
+                for (bsl::size_t n = 0; n <= k_MAX_BLOCKS; ++n) {
+                    bsl::uint32_t expected[8], state[8];
+
+                    bsl::copy(initial, initial + 8, expected);
+                    Impl::transformSha256Portable(expected, blocks.data(), n);
+
+                    bsl::copy(initial, initial + 8, state);
+                    Impl::transformSha256ShaNi(state, blocks.data(), n);
+                    ASSERTV(iteration, n,
+                            bsl::equal(expected, expected + 8, state));
+
+                    ASSERTV(iteration, n,
+                            0 == n || !bsl::equal(expected,
+                                                  expected + 8,
+                                                  initial));
+                }
+            }
+        }
+
+        if (verbose) cout << "'loadSha256DigestsPortable'\n";
+        testLoadSha256Digests(&Impl::loadSha256DigestsPortable);
+
+        if (verbose) cout << "'loadSha256DigestsAvx2'\n";
+        testLoadSha256Digests(&Impl::loadSha256DigestsAvx2);
+
+        if (verbose) cout << "'loadSha256DigestsShaNi'\n";
+        testLoadSha256Digests(&Impl::loadSha256DigestsShaNi);
       } break;
       case 25: {
         // --------------------------------------------------------------------
@@ -1250,6 +1511,116 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT ACROSS MESSAGE SIZES
+        //
+        // Concerns:
+        //: 1 The hardware-accelerated implementations are substantially
+        //:   faster than the portable one, for both small and large messages.
+        //
+        // Plan:
+        //: 1 For each message size, hash 16 MiB of messages of that size with
+        //:   each implementation of 'Sha2Util::loadSha256Digests', and with
+        //:   one 'Sha256' and one 'Sha512' object per message, and report the
+        //:   throughput in GB/s.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: THROUGHPUT ACROSS MESSAGE SIZES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: THROUGHPUT ACROSS MESSAGE SIZES\n"
+                             "============================================\n";
+
+        typedef bdlde::Sha2Util_Impl Impl;
+
+        typedef void (*DigestsFn)(unsigned char *,
+                                  const void *const *,
+                                  const bsl::size_t *,
+                                  bsl::size_t);
+
+        const struct {
+            const char *d_name;
+            DigestsFn   d_fn;
+        } IMPLS[] = {
+            { "portable", &Impl::loadSha256DigestsPortable },
+            { "avx2",     &Impl::loadSha256DigestsAvx2     },
+            { "sha-ni",   &Impl::loadSha256DigestsShaNi    },
+        };
+        const int NUM_IMPLS = static_cast<int>(sizeof IMPLS / sizeof *IMPLS);
+
+        const bsl::size_t SIZES[] = { 32, 64, 256, 1024, 4096, 65536 };
+        const int         NUM_SIZES = static_cast<int>(sizeof SIZES
+                                                       / sizeof *SIZES);
+
+        const bsl::size_t k_TOTAL   = 16 << 20;
+        const int         NUM_ITERS = argc > 2 ? atoi(argv[2]) : 2;
+
+        bsl::vector<unsigned char> data(k_TOTAL);
+        bsl::uint32_t              seed = 1;
+        for (bsl::size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<unsigned char>(nextRandom(&seed));
+        }
+
+        cout << "SHA-NI: " << Impl::isShaNiSupported()
+             << ", AVX2: " << Impl::isAvx2Supported() << "\n"
+             << "GB/s by message size (bytes):\n"
+             << "size";
+        for (int ti = 0; ti < NUM_IMPLS; ++ti) {
+            cout << '\t' << IMPLS[ti].d_name;
+        }
+        cout << "\tSha256\tSha512\n";
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const bsl::size_t SIZE         = SIZES[si];
+            const bsl::size_t NUM_MESSAGES = k_TOTAL / SIZE;
+            const double      GIGABYTES    = static_cast<double>(k_TOTAL)
+                                           * NUM_ITERS / 1e9;
+
+            bsl::vector<const void *>  messages(NUM_MESSAGES);
+            bsl::vector<bsl::size_t>   lengths(NUM_MESSAGES, SIZE);
+            bsl::vector<unsigned char> results(NUM_MESSAGES * 64);
+            for (bsl::size_t i = 0; i < NUM_MESSAGES; ++i) {
+                messages[i] = data.data() + i * SIZE;
+            }
+
+            cout << SIZE;
+            for (int ti = 0; ti < NUM_IMPLS; ++ti) {
+                bsls::Stopwatch timer;
+                timer.start(true);
+                for (int i = 0; i < NUM_ITERS; ++i) {
+                    IMPLS[ti].d_fn(results.data(),
+                                   messages.data(),
+                                   lengths.data(),
+                                   NUM_MESSAGES);
+                }
+                timer.stop();
+                cout << '\t' << GIGABYTES / timer.accumulatedWallTime();
+            }
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+            for (int i = 0; i < NUM_ITERS; ++i) {
+                for (bsl::size_t m = 0; m < NUM_MESSAGES; ++m) {
+                    bdlde::Sha256(messages[m], SIZE).loadDigest(
+                                                          &results[m * 64]);
+                }
+            }
+            timer.stop();
+            cout << '\t' << GIGABYTES / timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start(true);
+            for (int i = 0; i < NUM_ITERS; ++i) {
+                for (bsl::size_t m = 0; m < NUM_MESSAGES; ++m) {
+                    bdlde::Sha512(messages[m], SIZE).loadDigest(
+                                                          &results[m * 64]);
+                }
+            }
+            timer.stop();
+            cout << '\t' << GIGABYTES / timer.accumulatedWallTime() << "\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
@@ -12,13 +12,66 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
+#include <bdlde_cpufeatures.h>
+
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_log.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The functions taking an explicit length first pass the string to a
+// vectorized kernel that returns the length of a prefix known to consist of
+// complete, valid UTF-8 sequences, and the number of code points in that
+// prefix, and then continue with the scalar code from the end of that prefix.
+// The kernel may stop early (e.g., before the last, partial block, or before
+// a block containing an error), so the scalar code alone decides whether, and
+// where, the string is invalid; the kernel just saves it from examining
+// (most of) a valid string one code point at a time.
+//
+// The vectorized validation follows the approach described by John Keiser
+// and Daniel Lemire in "Validating UTF-8 In Less Than One Instruction Per
+// Byte" (Software: Practice and Experience, 2021).  Each pair of consecutive
+// bytes is classified by three 16-entry tables, indexed (with 'pshufb') by
+// the high and low nibbles of the first byte and the high nibble of the
+// second, whose entries have a common bit if and only if the pair is invalid
+// (too short or too long a sequence, an overlong encoding, a surrogate, or a
+// value above 'U+10ffff').  A continuation byte following a continuation byte
+// is then checked against the lead bytes two and three positions earlier.
+// A block holding only ASCII is valid unless the previous block ended with an
+// incomplete sequence.  The number of code points is the number of bytes
+// that are not continuation bytes.
+//
+// The AVX2 kernels clear the upper halves of the YMM registers with
+// 'vzeroupper' before returning or calling SSE code, because the compiler
+// does not do so for functions built for a target that is not enabled on the
+// command line.
+//
+// The kernels never read beyond 'string + length'.
 
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
 
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <immintrin.h>
+
+#define U_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define U_TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+
 // LOCAL CONSTANTS
 
 namespace {
@@ -85,6 +138,575 @@ int utf8Size(char character)
 
 }  // close unnamed namespace
 
+// VECTORIZED KERNELS
+
+namespace {
+
+typedef bsls::Types::size_type size_type;
+typedef bsls::Types::IntPtr    IntPtr;
+
+typedef size_type (*AsciiPrefixFn)(const char *, size_type);
+    // 'AsciiPrefixFn' is an alias for the type of the kernels that find the
+    // length of the ASCII prefix of a string.
+
+typedef size_type (*ValidPrefixFn)(IntPtr *, const char *, size_type);
+    // 'ValidPrefixFn' is an alias for the type of the kernels that find the
+    // length of a valid UTF-8 prefix of a string.
+
+                          // ------------------------
+                          // portable implementation
+                          // ------------------------
+
+size_type asciiPrefixPortable(const char *string, size_type length)
+    // Return the number of consecutive bytes having values less than 0x80 at
+    // the beginning of the specified 'string' having the specified 'length'.
+{
+    typedef bsls::Types::Uint64 Word;
+
+    const Word k_HIGH_BITS = 0x8080808080808080ULL;
+
+    size_type i = 0;
+    for (; i + sizeof(Word) <= length; i += sizeof(Word)) {
+        Word word;
+        bsl::memcpy(&word, string + i, sizeof(Word));
+        if (word & k_HIGH_BITS) {
+            break;
+        }
+    }
+    while (i < length && 0 == (string[i] & 0x80)) {
+        ++i;
+    }
+    return i;
+}
+
+size_type validPrefixPortable(IntPtr     *numCodePoints,
+                              const char *string,
+                              size_type   length)
+    // Return the length of the ASCII prefix of the specified 'string' having
+    // the specified 'length', rounded down to a multiple of 8, and load that
+    // length into the specified 'numCodePoints'.
+{
+    size_type prefix = asciiPrefixPortable(string, length) & ~size_type(7);
+
+    *numCodePoints = static_cast<IntPtr>(prefix);
+    return prefix;
+}
+
+#if defined(LIKE_X86_GCC)
+
+                          // ----------------------
+                          // vectorized validation
+                          // ----------------------
+
+// The following error bits classify a pair of consecutive bytes, where
+// 'prev1' is the first byte and 'input' the second.  A pair is invalid if the
+// bits produced for it by all three of 'k_BYTE_1_HIGH' (indexed by the high
+// nibble of 'prev1'), 'k_BYTE_1_LOW' (indexed by the low nibble of 'prev1'),
+// and 'k_BYTE_2_HIGH' (indexed by the high nibble of 'input') have a common
+// bit, except for 'k_TWO_CONTS', which is expected exactly where 'input' is
+// the third or fourth byte of a sequence.
+
+enum {
+    k_TOO_SHORT   = 1 << 0,  // 11______ 0_______, or 11______ 11______
+    k_TOO_LONG    = 1 << 1,  // 0_______ 10______
+    k_OVERLONG_3  = 1 << 2,  // 11100000 100_____
+    k_TOO_LARGE   = 1 << 3,  // 11110100 1001____, or 11110100 101_____
+    k_SURROGATE   = 1 << 4,  // 11101101 101_____
+    k_OVERLONG_2  = 1 << 5,  // 1100000_ 10______
+    k_TOO_LARGE_2 = 1 << 6,  // 11110101 1000____, or greater lead byte
+    k_OVERLONG_4  = 1 << 6,  // 11110000 1000____
+    k_TWO_CONTS   = 1 << 7,  // 10______ 10______
+
+    k_CARRY       = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+};
+
+const unsigned char k_BYTE_1_HIGH[16] = {
+    // 0_______: ASCII
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    // 10______: continuation
+    k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS,
+    // 1100____: 2-byte lead
+    k_TOO_SHORT | k_OVERLONG_2,
+    // 1101____: 2-byte lead
+    k_TOO_SHORT,
+    // 1110____: 3-byte lead
+    k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE,
+    // 1111____: 4-byte lead, or invalid
+    k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_2 | k_OVERLONG_4
+};
+
+const unsigned char k_BYTE_1_LOW[16] = {
+    // ____0000
+    k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4,
+    // ____0001
+    k_CARRY | k_OVERLONG_2,
+    // ____001_
+    k_CARRY,
+    k_CARRY,
+    // ____0100
+    k_CARRY | k_TOO_LARGE,
+    // ____0101 .. ____1100
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2,
+    // ____1101
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2 | k_SURROGATE,
+    // ____111_
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2,
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_2
+};
+
+const unsigned char k_BYTE_2_HIGH[16] = {
+    // 0_______: ASCII
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    // 1000____
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3 | k_TOO_LARGE_2
+                                                             | k_OVERLONG_4,
+    // 1001____
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3 | k_TOO_LARGE,
+    // 101_____
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE  | k_TOO_LARGE,
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE  | k_TOO_LARGE,
+    // 11______: lead
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT
+};
+
+const unsigned char k_INCOMPLETE_MAX[32] = {
+    // This table holds, for each of the last three bytes of a 32-byte block,
+    // the greatest value of a byte in that position that does not start a
+    // sequence continuing past the end of the block.  The last 16 entries are
+    // used for 16-byte blocks.
+
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+};
+
+                          // ----------------------
+                          // SSSE3 implementation
+                          // ----------------------
+
+U_TARGET_SSSE3
+inline
+__m128i checkBlockSsse3(__m128i input, __m128i prev)
+    // Return a vector having a non-zero byte if the specified 'input' block
+    // contains invalid UTF-8, given that it follows the specified 'prev'
+    // block, and having all zero bytes otherwise.  Note that a sequence that
+    // is incomplete at the end of 'input' is not reported.
+{
+    const __m128i lowNibbles = _mm_set1_epi8(0x0f);
+
+    const __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+
+    const __m128i byte1High = _mm_shuffle_epi8(
+                        _mm_loadu_si128((const __m128i *)k_BYTE_1_HIGH),
+                        _mm_and_si128(_mm_srli_epi16(prev1, 4), lowNibbles));
+    const __m128i byte1Low = _mm_shuffle_epi8(
+                        _mm_loadu_si128((const __m128i *)k_BYTE_1_LOW),
+                        _mm_and_si128(prev1, lowNibbles));
+    const __m128i byte2High = _mm_shuffle_epi8(
+                        _mm_loadu_si128((const __m128i *)k_BYTE_2_HIGH),
+                        _mm_and_si128(_mm_srli_epi16(input, 4), lowNibbles));
+
+    const __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low),
+                                          byte2High);
+
+    // A continuation byte following a continuation byte is valid only as the
+    // third or fourth byte of a sequence, i.e., if 'prev2' is the lead byte
+    // of a 3- or 4-byte sequence, or 'prev3' that of a 4-byte sequence.
+
+    const __m128i isThird  = _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80));
+    const __m128i isFourth = _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80));
+    const __m128i must23   = _mm_and_si128(_mm_or_si128(isThird, isFourth),
+                                           _mm_set1_epi8(char(0x80)));
+
+    return _mm_xor_si128(must23, special);
+}
+
+U_TARGET_SSSE3
+size_type asciiPrefixSsse3(const char *string, size_type length)
+    // Return the number of consecutive bytes having values less than 0x80 at
+    // the beginning of the specified 'string' having the specified 'length'.
+{
+    size_type i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const int mask = _mm_movemask_epi8(
+                          _mm_loadu_si128((const __m128i *)(string + i)));
+        if (mask) {
+            return i + __builtin_ctz(mask);                           // RETURN
+        }
+    }
+    return i + asciiPrefixPortable(string + i, length - i);
+}
+
+U_TARGET_SSSE3
+size_type validPrefixSsse3(IntPtr     *numCodePoints,
+                           const char *string,
+                           size_type   length)
+    // Validate the specified 'string' having the specified 'length' 16 bytes
+    // at a time, up to the first block containing invalid UTF-8 or the last
+    // complete block, and return the length of the longest validated prefix
+    // that ends with a complete sequence.  Load into the specified
+    // 'numCodePoints' the number of code points in that prefix.
+{
+    const __m128i zero        = _mm_setzero_si128();
+    const __m128i one         = _mm_set1_epi8(1);
+    const __m128i minLead     = _mm_set1_epi8(-64);  // 0xc0
+    const __m128i incomplete  = _mm_loadu_si128(
+                                (const __m128i *)(k_INCOMPLETE_MAX + 16));
+
+    __m128i prev              = zero;
+    __m128i prevIncomplete    = zero;
+    __m128i numConts          = zero;  // continuation bytes, in 2 counters
+    __m128i numContsAtGood    = zero;
+
+    size_type good          = 0;
+    size_type trailingConts = 0;  // continuation bytes after 'good'
+    for (size_type i = 0; i + 16 <= length; i += 16) {
+        if (good == i) {
+            // No sequence is pending, so skip any run of ASCII four blocks at
+            // a time.
+
+            while (i + 64 <= length) {
+                const __m128i *block = (const __m128i *)(string + i);
+                const __m128i  any   = _mm_or_si128(
+                          _mm_or_si128(_mm_loadu_si128(block),
+                                       _mm_loadu_si128(block + 1)),
+                          _mm_or_si128(_mm_loadu_si128(block + 2),
+                                       _mm_loadu_si128(block + 3)));
+                if (_mm_movemask_epi8(any)) {
+                    break;
+                }
+                i += 64;
+            }
+            if (good != i) {
+                good = i;
+                prev = zero;
+                if (i + 16 > length) {
+                    break;
+                }
+            }
+        }
+
+        const __m128i input = _mm_loadu_si128((const __m128i *)(string + i));
+
+        __m128i error;
+        if (0 == _mm_movemask_epi8(input)) {
+            error          = prevIncomplete;
+            prevIncomplete = zero;
+        }
+        else {
+            error          = checkBlockSsse3(input, prev);
+            prevIncomplete = _mm_subs_epu8(input, incomplete);
+
+            const __m128i isCont = _mm_cmpgt_epi8(minLead, input);
+            numConts = _mm_add_epi64(
+                           numConts,
+                           _mm_sad_epu8(_mm_and_si128(isCont, one), zero));
+        }
+
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(error, zero))) {
+            break;
+        }
+
+        prev           = input;
+        numContsAtGood = numConts;
+        if (0xffff == _mm_movemask_epi8(_mm_cmpeq_epi8(prevIncomplete,
+                                                       zero))) {
+            good          = i + 16;
+            trailingConts = 0;
+        }
+        else {
+            // The block ends with an incomplete sequence, so the prefix ends
+            // before its lead byte, and excludes the continuation bytes that
+            // follow that byte.
+
+            const int leads    = ~_mm_movemask_epi8(
+                                          _mm_cmpgt_epi8(minLead, input));
+            const int lastLead = 31 - __builtin_clz(leads & 0xffff);
+
+            good          = i + lastLead;
+            trailingConts = 15 - lastLead;
+        }
+    }
+
+    bsls::Types::Uint64 conts[2];
+    _mm_storeu_si128((__m128i *)conts, numContsAtGood);
+
+    *numCodePoints = static_cast<IntPtr>(
+                                good - (conts[0] + conts[1] - trailingConts));
+    return good;
+}
+
+                           // ---------------------
+                           // AVX2 implementation
+                           // ---------------------
+
+U_TARGET_AVX2
+inline
+__m256i checkBlockAvx2(__m256i input, __m256i prev)
+    // Return a vector having a non-zero byte if the specified 'input' block
+    // contains invalid UTF-8, given that it follows the specified 'prev'
+    // block, and having all zero bytes otherwise.  Note that a sequence that
+    // is incomplete at the end of 'input' is not reported.
+{
+    const __m256i lowNibbles = _mm256_set1_epi8(0x0f);
+
+    // 'vpalignr' works within 128-bit lanes, so shift in the high lane of
+    // 'prev' for the low lane of 'input', and the low lane of 'input' for its
+    // high lane.
+
+    const __m256i shifted = _mm256_permute2x128_si256(prev, input, 0x21);
+    const __m256i prev1   = _mm256_alignr_epi8(input, shifted, 15);
+    const __m256i prev2   = _mm256_alignr_epi8(input, shifted, 14);
+    const __m256i prev3   = _mm256_alignr_epi8(input, shifted, 13);
+
+    const __m256i byte1High = _mm256_shuffle_epi8(
+                  _mm256_broadcastsi128_si256(
+                         _mm_loadu_si128((const __m128i *)k_BYTE_1_HIGH)),
+                  _mm256_and_si256(_mm256_srli_epi16(prev1, 4), lowNibbles));
+    const __m256i byte1Low = _mm256_shuffle_epi8(
+                  _mm256_broadcastsi128_si256(
+                         _mm_loadu_si128((const __m128i *)k_BYTE_1_LOW)),
+                  _mm256_and_si256(prev1, lowNibbles));
+    const __m256i byte2High = _mm256_shuffle_epi8(
+                  _mm256_broadcastsi128_si256(
+                         _mm_loadu_si128((const __m128i *)k_BYTE_2_HIGH)),
+                  _mm256_and_si256(_mm256_srli_epi16(input, 4), lowNibbles));
+
+    const __m256i special = _mm256_and_si256(
+                                   _mm256_and_si256(byte1High, byte1Low),
+                                   byte2High);
+
+    const __m256i isThird  = _mm256_subs_epu8(prev2,
+                                              _mm256_set1_epi8(0xe0 - 0x80));
+    const __m256i isFourth = _mm256_subs_epu8(prev3,
+                                              _mm256_set1_epi8(0xf0 - 0x80));
+    const __m256i must23   = _mm256_and_si256(
+                                      _mm256_or_si256(isThird, isFourth),
+                                      _mm256_set1_epi8(char(0x80)));
+
+    return _mm256_xor_si256(must23, special);
+}
+
+U_TARGET_AVX2
+size_type asciiPrefixAvx2(const char *string, size_type length)
+    // Return the number of consecutive bytes having values less than 0x80 at
+    // the beginning of the specified 'string' having the specified 'length'.
+{
+    size_type i = 0;
+    for (; i + 32 <= length; i += 32) {
+        const unsigned int mask = _mm256_movemask_epi8(
+                       _mm256_loadu_si256((const __m256i *)(string + i)));
+        if (mask) {
+            _mm256_zeroupper();
+            return i + __builtin_ctz(mask);                           // RETURN
+        }
+    }
+    _mm256_zeroupper();
+
+    return i + asciiPrefixSsse3(string + i, length - i);
+}
+
+U_TARGET_AVX2
+size_type validPrefixAvx2(IntPtr     *numCodePoints,
+                          const char *string,
+                          size_type   length)
+    // Validate the specified 'string' having the specified 'length' 32 bytes
+    // at a time, up to the first block containing invalid UTF-8 or the last
+    // complete block, and return the length of the longest validated prefix
+    // that ends with a complete sequence.  Load into the specified
+    // 'numCodePoints' the number of code points in that prefix.
+{
+    const __m256i zero        = _mm256_setzero_si256();
+    const __m256i one         = _mm256_set1_epi8(1);
+    const __m256i minLead     = _mm256_set1_epi8(-64);  // 0xc0
+    const __m256i incomplete  = _mm256_loadu_si256(
+                                       (const __m256i *)k_INCOMPLETE_MAX);
+
+    __m256i prev              = zero;
+    __m256i prevIncomplete    = zero;
+    __m256i numConts          = zero;  // continuation bytes, in 4 counters
+    __m256i numContsAtGood    = zero;
+
+    size_type good          = 0;
+    size_type trailingConts = 0;  // continuation bytes after 'good'
+    for (size_type i = 0; i + 32 <= length; i += 32) {
+        if (good == i) {
+            // No sequence is pending, so skip any run of ASCII four blocks at
+            // a time.
+
+            while (i + 128 <= length) {
+                const __m256i *block = (const __m256i *)(string + i);
+                const __m256i  any   = _mm256_or_si256(
+                       _mm256_or_si256(_mm256_loadu_si256(block),
+                                       _mm256_loadu_si256(block + 1)),
+                       _mm256_or_si256(_mm256_loadu_si256(block + 2),
+                                       _mm256_loadu_si256(block + 3)));
+                if (_mm256_movemask_epi8(any)) {
+                    break;
+                }
+                i += 128;
+            }
+            if (good != i) {
+                good = i;
+                prev = zero;
+                if (i + 32 > length) {
+                    break;
+                }
+            }
+        }
+
+        const __m256i input = _mm256_loadu_si256(
+                                           (const __m256i *)(string + i));
+
+        __m256i error;
+        if (0 == _mm256_movemask_epi8(input)) {
+            error          = prevIncomplete;
+            prevIncomplete = zero;
+        }
+        else {
+            error          = checkBlockAvx2(input, prev);
+            prevIncomplete = _mm256_subs_epu8(input, incomplete);
+
+            const __m256i isCont = _mm256_cmpgt_epi8(minLead, input);
+            numConts = _mm256_add_epi64(
+                        numConts,
+                        _mm256_sad_epu8(_mm256_and_si256(isCont, one), zero));
+        }
+
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
+
+        prev           = input;
+        numContsAtGood = numConts;
+        if (_mm256_testz_si256(prevIncomplete, prevIncomplete)) {
+            good          = i + 32;
+            trailingConts = 0;
+        }
+        else {
+            // The block ends with an incomplete sequence, so the prefix ends
+            // before its lead byte, and excludes the continuation bytes that
+            // follow that byte.
+
+            const unsigned int leads    = ~_mm256_movemask_epi8(
+                                       _mm256_cmpgt_epi8(minLead, input));
+            const int          lastLead = 31 - __builtin_clz(leads);
+
+            good          = i + lastLead;
+            trailingConts = 31 - lastLead;
+        }
+    }
+
+    const __m128i sum = _mm_add_epi64(
+                                 _mm256_castsi256_si128(numContsAtGood),
+                                 _mm256_extracti128_si256(numContsAtGood, 1));
+    bsls::Types::Uint64 conts[2];
+    _mm_storeu_si128((__m128i *)conts, sum);
+
+    _mm256_zeroupper();
+
+    *numCodePoints = static_cast<IntPtr>(
+                                good - (conts[0] + conts[1] - trailingConts));
+    return good;
+}
+
+#endif  // LIKE_X86_GCC
+
+                           //=====================
+                           // class Utf8Dispatcher
+                           //=====================
+
+class Utf8Dispatcher {
+    // This class represents a singleton that selects, on construction, the
+    // fastest kernels supported by the running processor.
+
+    // DATA
+    AsciiPrefixFn d_asciiPrefixFn;
+    ValidPrefixFn d_validPrefixFn;
+
+    // CREATORS
+    Utf8Dispatcher();
+        // Create an instance of this class.
+
+    // NOT IMPLEMENTED
+    Utf8Dispatcher(const Utf8Dispatcher&);             // = delete;
+    Utf8Dispatcher& operator=(const Utf8Dispatcher&);  // = delete;
+
+  public:
+    // CLASS METHODS
+    static const Utf8Dispatcher& instance();
+        // Return a reference to the singleton object.
+
+    // ACCESSORS
+    AsciiPrefixFn asciiPrefixFn() const;
+        // Return the selected kernel for finding ASCII prefixes.
+
+    ValidPrefixFn validPrefixFn() const;
+        // Return the selected kernel for finding valid UTF-8 prefixes.
+};
+
+Utf8Dispatcher::Utf8Dispatcher()
+: d_asciiPrefixFn(&asciiPrefixPortable)
+, d_validPrefixFn(&validPrefixPortable)
+{
+#if defined(LIKE_X86_GCC)
+    if (bdlde::CpuFeatures::isAvx2Supported()) {
+        BSLS_LOG_INFO("Using AVX2 version for UTF-8 validation");
+        d_asciiPrefixFn = &asciiPrefixAvx2;
+        d_validPrefixFn = &validPrefixAvx2;
+    }
+    else if (bdlde::CpuFeatures::isSsse3Supported()) {
+        BSLS_LOG_INFO("Using SSSE3 version for UTF-8 validation "
+                      "(AVX2 instructions not available)");
+        d_asciiPrefixFn = &asciiPrefixSsse3;
+        d_validPrefixFn = &validPrefixSsse3;
+    }
+    else {
+        BSLS_LOG_INFO("Using software version for UTF-8 validation "
+                      "(SSSE3 instructions not available)");
+    }
+#else
+    BSLS_LOG_INFO("Using software version for UTF-8 validation "
+                  "(unsupported platform)");
+#endif
+}
+
+const Utf8Dispatcher& Utf8Dispatcher::instance()
+{
+    static const Utf8Dispatcher *theInstance_p = 0;
+    BSLMT_ONCE_DO {
+        static const Utf8Dispatcher theInstance;
+        theInstance_p = &theInstance;
+    }
+    return *theInstance_p;
+}
+
+inline
+AsciiPrefixFn Utf8Dispatcher::asciiPrefixFn() const
+{
+    return d_asciiPrefixFn;
+}
+
+inline
+ValidPrefixFn Utf8Dispatcher::validPrefixFn() const
+{
+    return d_validPrefixFn;
+}
+
+}  // close unnamed namespace
+
 // STATIC HELPER FUNCTIONS
 
 static inline
@@ -259,10 +881,15 @@ static int validateAndCountCodePoints(const char             **invalidString,
     BSLS_ASSERT_SAFE(string);
     BSLS_ASSERT_SAFE(0 <= bsls::Types::IntPtr(length));
 
-    const char       *pc     = string;
+    IntPtr numPrefixCodePoints;
+    const char *pc = string + Utf8Dispatcher::instance().validPrefixFn()(
+                                                         &numPrefixCodePoints,
+                                                         string,
+                                                         length);
+
     const char *const pcEnd4 = string + length - 4;
 
-    int count = 0;
+    int count = static_cast<int>(numPrefixCodePoints);
 
     while (pc <= pcEnd4) {
         switch ((*pc >> 4) & 0xf) {
@@ -609,6 +1236,16 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
 
     const char * const endOfInput = string + length;
 
+    // Skip a prefix that is known to be valid.  Note that a prefix of at most
+    // 'numCodePoints' bytes cannot hold more than 'numCodePoints' code points.
+
+    const size_type maxPrefix = length < size_type(numCodePoints)
+                              ? length
+                              : size_type(numCodePoints);
+    string += Utf8Dispatcher::instance().validPrefixFn()(&ret,
+                                                         string,
+                                                         maxPrefix);
+
     // Note that we keep 'string' pointing to the beginning of the Unicode
     // code point being processed, and only advance it to the next code point
     // between iterations.
@@ -1027,6 +1664,14 @@ int Utf8Util::appendUtf8Character(bsl::string *output, unsigned int codepnt)
 
 // BDE_VERIFY pragma: pop
 
+Utf8Util::size_type Utf8Util::asciiPrefixLength(const char *string,
+                                                size_type   length)
+{
+    BSLS_ASSERT(string || 0 == length);
+
+    return Utf8Dispatcher::instance().asciiPrefixFn()(string, length);
+}
+
 int Utf8Util::getByteSize(const char* codepoint)
 {
     BSLS_ASSERT_SAFE(isValidUtf8(codepoint));
@@ -1180,6 +1825,101 @@ Utf8Util::IntPtr Utf8Util::numBytesIfValid(
     return numBytes;
 }
 
+                            // --------------------
+                            // struct Utf8Util_Impl
+                            // --------------------
+
+// CLASS METHODS
+bool Utf8Util_Impl::isAvx2Supported()
+{
+    return CpuFeatures::isAvx2Supported();
+}
+
+bool Utf8Util_Impl::isSsse3Supported()
+{
+    return CpuFeatures::isSsse3Supported();
+}
+
+Utf8Util_Impl::size_type Utf8Util_Impl::asciiPrefixLengthAvx2(
+                                                    const char *string,
+                                                    size_type   length)
+{
+    BSLS_ASSERT(string || 0 == length);
+
+#if defined(LIKE_X86_GCC)
+    if (isAvx2Supported()) {
+        return asciiPrefixAvx2(string, length);                       // RETURN
+    }
+#endif
+    return asciiPrefixPortable(string, length);
+}
+
+Utf8Util_Impl::size_type Utf8Util_Impl::asciiPrefixLengthPortable(
+                                                    const char *string,
+                                                    size_type   length)
+{
+    BSLS_ASSERT(string || 0 == length);
+
+    return asciiPrefixPortable(string, length);
+}
+
+Utf8Util_Impl::size_type Utf8Util_Impl::asciiPrefixLengthSsse3(
+                                                    const char *string,
+                                                    size_type   length)
+{
+    BSLS_ASSERT(string || 0 == length);
+
+#if defined(LIKE_X86_GCC)
+    if (isSsse3Supported()) {
+        return asciiPrefixSsse3(string, length);                      // RETURN
+    }
+#endif
+    return asciiPrefixPortable(string, length);
+}
+
+Utf8Util_Impl::size_type Utf8Util_Impl::validPrefixLengthAvx2(
+                                                   IntPtr     *numCodePoints,
+                                                   const char *string,
+                                                   size_type   length)
+{
+    BSLS_ASSERT(numCodePoints);
+    BSLS_ASSERT(string || 0 == length);
+
+#if defined(LIKE_X86_GCC)
+    if (isAvx2Supported()) {
+        return validPrefixAvx2(numCodePoints, string, length);        // RETURN
+    }
+#endif
+    return validPrefixPortable(numCodePoints, string, length);
+}
+
+Utf8Util_Impl::size_type Utf8Util_Impl::validPrefixLengthPortable(
+                                                   IntPtr     *numCodePoints,
+                                                   const char *string,
+                                                   size_type   length)
+{
+    BSLS_ASSERT(numCodePoints);
+    BSLS_ASSERT(string || 0 == length);
+
+    return validPrefixPortable(numCodePoints, string, length);
+}
+
+Utf8Util_Impl::size_type Utf8Util_Impl::validPrefixLengthSsse3(
+                                                   IntPtr     *numCodePoints,
+                                                   const char *string,
+                                                   size_type   length)
+{
+    BSLS_ASSERT(numCodePoints);
+    BSLS_ASSERT(string || 0 == length);
+
+#if defined(LIKE_X86_GCC)
+    if (isSsse3Supported()) {
+        return validPrefixSsse3(numCodePoints, string, length);       // RETURN
+    }
+#endif
+    return validPrefixPortable(numCodePoints, string, length);
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
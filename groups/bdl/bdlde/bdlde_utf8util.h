@@ -17,6 +17,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Utf8Util: namespace for utilities for UTF-8 encodings
+//  bdlde::Utf8Util_Impl: alternative kernel implementations, for testing only
 //
 //@DESCRIPTION: This component provides, within the 'bdlde::Utf8Util' 'struct',
 // a suite of static functions supporting UTF-8 encoded strings.  Two
@@ -28,7 +29,7 @@ BSLS_IDENT("$Id: $")
 // meaning that only 1-, 2-, 3-, and 4-byte sequences are allowed.  Values
 // above 'U+10ffff' are also not allowed.
 //
-// Six types of functions are provided:
+// Seven types of functions are provided:
 //
 //: o 'isValid', which checks for validity, per RFC 3629, of a (candidate)
 //:   UTF-8 string.  "Overlong values", that is, values encoded in more bytes
@@ -54,6 +55,9 @@ BSLS_IDENT("$Id: $")
 //:
 //: o 'appendUtf8Character', which appends a single Unicode code point to a
 //:   UTF-8 string.
+//:
+//: o 'asciiPrefixLength', which returns the number of ASCII bytes at the
+//:   start of a string, each of which is a single code point.
 //
 // Embedded null bytes are allowed in strings that are accompanied by an
 // explicit length argument.  Naturally, null-terminated C-style strings cannot
@@ -68,6 +72,23 @@ BSLS_IDENT("$Id: $")
 //  http://en.wikipedia.org/wiki/Utf-8
 //..
 //
+///Vectorized Validation
+///---------------------
+// On x86 and x86-64 platforms built with a GCC-compatible compiler, the
+// functions taking an explicit 'length' ('isValid', 'numCodePointsIfValid',
+// and 'advanceIfValid') first validate the input 32 (or 16) bytes at a time
+// with AVX2 (or SSSE3) instructions, selected once, on first use, by querying
+// the running processor with 'cpuid', and examine one code point at a time
+// only the end of the input and any block containing invalid UTF-8;
+// 'asciiPrefixLength' scans its input in the same way.  On other platforms,
+// these functions skip runs of ASCII 8 bytes at a time.  The results are the
+// same in all cases.  Null-terminated strings are always examined one code
+// point at a time, because their length is not known in advance.
+//
+// The struct 'bdlde::Utf8Util_Impl' exposes each alternative kernel so that
+// they can be tested and benchmarked against one another; it should not be
+// used otherwise.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -348,6 +369,13 @@ struct Utf8Util {
         // '[0 .. numCodePoints]'.  Also note that 'string' may contain less
         // than 'length' Unicode code points.
 
+    static size_type asciiPrefixLength(const char *string, size_type length);
+        // Return the number of consecutive ASCII bytes (i.e., bytes having
+        // values less than 0x80) at the beginning of the specified 'string'
+        // having the specified 'length' (in bytes).  'string' need not be
+        // null-terminated and can contain embedded null bytes.  Note that the
+        // bytes counted are each a complete, valid UTF-8 code point.
+
     static bool isValid(const char *string);
         // Return 'true' if the specified 'string' contains valid UTF-8, and
         // 'false' otherwise.  'string' is necessarily null-terminated, so it
@@ -499,6 +527,58 @@ struct Utf8Util {
         // non-zero value otherwise.
 };
 
+                            // ====================
+                            // struct Utf8Util_Impl
+                            // ====================
+
+struct Utf8Util_Impl {
+    // This 'struct' provides the alternative implementations of the kernels
+    // used by 'Utf8Util'.  A function requiring instructions that are not
+    // supported by the running processor uses the portable implementation
+    // instead.
+
+    // PUBLIC TYPES
+    typedef Utf8Util::size_type size_type;
+    typedef Utf8Util::IntPtr    IntPtr;
+
+    // CLASS METHODS
+    static bool isAvx2Supported();
+        // Return 'true' if the running processor and operating system support
+        // AVX2 instructions and this component was built to use them, and
+        // 'false' otherwise.
+
+    static bool isSsse3Supported();
+        // Return 'true' if the running processor supports SSSE3 instructions
+        // and this component was built to use them, and 'false' otherwise.
+
+    static size_type asciiPrefixLengthAvx2(const char *string,
+                                           size_type   length);
+    static size_type asciiPrefixLengthPortable(const char *string,
+                                               size_type   length);
+    static size_type asciiPrefixLengthSsse3(const char *string,
+                                            size_type   length);
+        // Return the number of consecutive ASCII bytes at the beginning of the
+        // specified 'string' having the specified 'length'.  See
+        // 'Utf8Util::asciiPrefixLength'.
+
+    static size_type validPrefixLengthAvx2(IntPtr     *numCodePoints,
+                                           const char *string,
+                                           size_type   length);
+    static size_type validPrefixLengthPortable(IntPtr     *numCodePoints,
+                                               const char *string,
+                                               size_type   length);
+    static size_type validPrefixLengthSsse3(IntPtr     *numCodePoints,
+                                            const char *string,
+                                            size_type   length);
+        // Return the length of a prefix of the specified 'string' having the
+        // specified 'length' (in bytes) that consists of complete, valid
+        // UTF-8 sequences, and load into the specified 'numCodePoints' the
+        // number of code points in that prefix.  Note that the prefix is not
+        // necessarily the longest valid one: each implementation validates
+        // whole blocks of input (the portable one, just ASCII), and may
+        // return 0 even if 'string' is entirely valid.
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
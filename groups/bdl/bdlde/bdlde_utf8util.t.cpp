@@ -14,6 +14,7 @@
 #include <bslim_testutil.h>
 
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -57,8 +58,11 @@ using bsl::size_t;
 //: o Test case 10 Test 'numBytesIfValid'.
 //: o Test case 11 Test 'getByteSize'.
 //: o Test case 12 Test 'appendUtf8Character'.
+//: o Test case 13 Test the vectorized kernels, and the functions using them,
+//:   against the null-terminated functions, which do not use them.
 //-----------------------------------------------------------------------------
 // CLASS METHODS
+// [13] size_type asciiPrefixLength(const char *, size_type);
 // [12] int appendUtf8Character(bsl::string *, unsigned int);
 // [11] int getByteSize(const char *);
 // [10] IntPtr numBytesIfValid(const bslstl::StringRef&, IntPtr);
@@ -97,11 +101,13 @@ using bsl::size_t;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
-// [13] USAGE EXAMPLE 1
-// [14] USAGE EXAMPLE 2
+// [14] USAGE EXAMPLE 1
+// [15] USAGE EXAMPLE 2
 // [ 9] 'advanceIfValid' on correct input followed by incorrect input
+// [13] Utf8Util_Impl
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE: THROUGHPUT OF VALIDATION
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -2802,7 +2808,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -2913,7 +2919,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
@@ -3012,6 +3018,235 @@ int main(int argc, char *argv[])
     ASSERT(false == bdlde::Utf8Util::isValid(stringWithOverlong.c_str()));
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING VECTORIZED KERNELS
+        //
+        // Concerns:
+        //: 1 Each implementation of 'asciiPrefixLength' returns the offset of
+        //:   the first byte having its high bit set, for every length and
+        //:   every position of that byte.
+        //:
+        //: 2 Each implementation of 'validPrefixLength' returns the length of
+        //:   a valid prefix ending on a code point boundary, together with its
+        //:   number of code points, and never includes an invalid sequence,
+        //:   wherever the error lies relative to the block boundaries.
+        //:
+        //: 3 For valid input, the prefix validated by the vectorized kernels
+        //:   falls short of the end by less than a block and 3 bytes.
+        //:
+        //: 4 The functions taking a length, which use the kernels, return the
+        //:   same results as the null-terminated functions, which do not.
+        //
+        // Plan:
+        //: 1 For every length up to 200 and every position of a non-ASCII
+        //:   byte, call each implementation of 'asciiPrefixLength'.  (C-1)
+        //:
+        //: 2 Starting from a multilingual string and random valid strings,
+        //:   overwrite each byte in turn with a variety of values (all values
+        //:   for one starting offset), and compare the results of each kernel,
+        //:   'isValid', 'numCodePointsIfValid', and 'advanceIfValid' taking a
+        //:   length with those of the null-terminated functions.  (C-2..4)
+        //
+        // Testing:
+        //   size_type asciiPrefixLength(const char *, size_type);
+        //   Utf8Util_Impl
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING VECTORIZED KERNELS\n"
+                             "==========================\n";
+
+        typedef bdlde::Utf8Util_Impl Impl;
+        typedef Obj::IntPtr          IntPtr;
+        typedef Obj::size_type       size_type;
+
+        typedef size_type (*AsciiFn)(const char *, size_type);
+        typedef size_type (*ValidFn)(IntPtr *, const char *, size_type);
+
+        const struct {
+            const char *d_name;
+            AsciiFn     d_asciiFn;
+            ValidFn     d_validFn;
+            size_type   d_blockSize;
+            bool        d_isVectorized;
+        } IMPLS[] = {
+            { "portable", &Impl::asciiPrefixLengthPortable,
+                          &Impl::validPrefixLengthPortable,  8, false },
+            { "ssse3",    &Impl::asciiPrefixLengthSsse3,
+                          &Impl::validPrefixLengthSsse3,    16,
+                                                   Impl::isSsse3Supported() },
+            { "avx2",     &Impl::asciiPrefixLengthAvx2,
+                          &Impl::validPrefixLengthAvx2,     32,
+                                                    Impl::isAvx2Supported() },
+        };
+        const int NUM_IMPLS = static_cast<int>(sizeof IMPLS / sizeof *IMPLS);
+
+        if (verbose) cout << "SSSE3: " << Impl::isSsse3Supported()
+                          << ", AVX2: " << Impl::isAvx2Supported() << endl;
+
+        if (verbose) cout << "'asciiPrefixLength'\n";
+        {
+            enum { k_MAX_LEN = 200 };
+
+            char buffer[k_MAX_LEN];
+            bsl::memset(buffer, 'a', sizeof buffer);
+
+            for (int len = 0; len <= k_MAX_LEN; ++len) {
+                for (int ii = 0; ii < NUM_IMPLS; ++ii) {
+                    ASSERTV(IMPLS[ii].d_name, len,
+                            size_type(len) ==
+                                           IMPLS[ii].d_asciiFn(buffer, len));
+                }
+                ASSERTV(len,
+                        size_type(len) == Obj::asciiPrefixLength(buffer, len));
+
+                for (int pos = 0; pos < len; ++pos) {
+                    for (int value = 0x7f; value <= 0xff; value += 0x40) {
+                        buffer[pos] = static_cast<char>(value);
+
+                        const size_type EXP = 0x7f == value ? len : pos;
+
+                        for (int ii = 0; ii < NUM_IMPLS; ++ii) {
+                            ASSERTV(IMPLS[ii].d_name, len, pos, value,
+                                    EXP == IMPLS[ii].d_asciiFn(buffer, len));
+                        }
+                        ASSERTV(len, pos, value,
+                                EXP == Obj::asciiPrefixLength(buffer, len));
+                    }
+                    buffer[pos] = 'a';
+                }
+            }
+        }
+
+        if (verbose) cout << "'validPrefixLength' and its clients\n";
+        {
+            bsl::vector<bsl::string> bases;
+
+            // Long runs of ASCII between multibyte sequences exercise the
+            // ASCII-only path of the kernels.
+
+            bsl::string mixed(30, 'a');
+            mixed += "\xe2\x82\xac";
+            mixed.append(40, 'b');
+            for (int i = 0; i < 20; ++i) {
+                appendRandCorrectCodePoint(&mixed, false);
+            }
+            mixed.append(33, 'c');
+            mixed += "\xf0\x9f\x98\x80";
+            mixed.append(20, 'd');
+            bases.push_back(mixed);
+
+            bases.push_back(bsl::string(charUtf8MultiLang, 160));
+
+            for (int j = 0; j < 4; ++j) {
+                bsl::string random;
+                while (random.length() < 100) {
+                    appendRandCorrectCodePoint(&random, false);
+                }
+                bases.push_back(random);
+            }
+
+            const unsigned char VALUES[] = {
+                0x01, 0x41, 0x7f, 0x80, 0x8f, 0x90, 0x9f, 0xa0, 0xbf, 0xc0,
+                0xc1, 0xc2, 0xdf, 0xe0, 0xe1, 0xed, 0xee, 0xef, 0xf0, 0xf1,
+                0xf4, 0xf5, 0xf7, 0xf8, 0xfe, 0xff
+            };
+            const int NUM_VALUES = static_cast<int>(sizeof VALUES);
+
+            for (size_t bi = 0; bi < bases.size(); ++bi) {
+                for (int offset = 0; offset < 4; ++offset) {
+                    const bsl::string base = bases[bi].substr(offset);
+                    const int         LEN  = static_cast<int>(base.length());
+
+                    const int numValues = 0 == offset ? 255 : NUM_VALUES;
+
+                    for (int pos = -1; pos < LEN; ++pos) {
+                        for (int vi = 0; vi < (pos < 0 ? 1 : numValues);
+                                                                        ++vi) {
+                            bsl::string str(base);
+                            if (0 <= pos) {
+                                str[pos] = static_cast<char>(
+                                       0 == offset ? vi + 1 : VALUES[vi]);
+                            }
+                            const char *STR = str.c_str();
+
+                            // The null-terminated functions do not use the
+                            // kernels, and serve as the oracle.
+
+                            const char   *expInvalid = 0;
+                            const IntPtr  EXP = Obj::numCodePointsIfValid(
+                                                                   &expInvalid,
+                                                                   STR);
+                            const size_type VALID_LEN = EXP >= 0
+                                                        ? LEN
+                                                        : expInvalid - STR;
+
+                            for (int ii = 0; ii < NUM_IMPLS; ++ii) {
+                                IntPtr numCodePoints = -1;
+                                const size_type PREFIX = IMPLS[ii].d_validFn(
+                                                                &numCodePoints,
+                                                                STR,
+                                                                LEN);
+                                ASSERTV(IMPLS[ii].d_name, bi, pos, vi,
+                                        PREFIX, VALID_LEN,
+                                        PREFIX <= VALID_LEN);
+
+                                const bsl::string  prefix(STR, PREFIX);
+                                const char        *dummy = 0;
+                                ASSERTV(IMPLS[ii].d_name, bi, offset, pos, vi,
+                                        numCodePoints ==
+                                            Obj::numCodePointsIfValid(
+                                                              &dummy,
+                                                              prefix.c_str()));
+
+                                if (EXP >= 0 && IMPLS[ii].d_isVectorized) {
+                                    const size_type BLOCK =
+                                                         IMPLS[ii].d_blockSize;
+                                    ASSERTV(IMPLS[ii].d_name, bi, pos, vi,
+                                            PREFIX, LEN,
+                                            PREFIX + BLOCK + 3 >
+                                                              size_type(LEN));
+                                }
+                            }
+
+                            const char *invalid = 0;
+                            ASSERTV(bi, offset, pos, vi,
+                                    (EXP >= 0) == Obj::isValid(STR, LEN));
+                            ASSERTV(bi, offset, pos, vi, EXP,
+                                    EXP == Obj::numCodePointsIfValid(&invalid,
+                                                                     STR,
+                                                                     LEN));
+                            ASSERTV(bi, offset, pos, vi,
+                                    EXP >= 0 || expInvalid == invalid);
+
+                            for (IntPtr n = 0; n < LEN + 2; n += n + 1) {
+                                int         expStatus, status;
+                                const char *expResult, *result;
+
+                                const IntPtr EXP_NUM = Obj::advanceIfValid(
+                                                                    &expStatus,
+                                                                    &expResult,
+                                                                    STR,
+                                                                    n);
+                                const IntPtr NUM = Obj::advanceIfValid(
+                                                                       &status,
+                                                                       &result,
+                                                                       STR,
+                                                                       LEN,
+                                                                       n);
+                                ASSERTV(bi, offset, pos, vi, n,
+                                        EXP_NUM == NUM);
+                                ASSERTV(bi, offset, pos, vi, n,
+                                        (0 == expStatus) == (0 == status));
+                                ASSERTV(bi, offset, pos, vi, n,
+                                        expResult == result);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING 'appendUtf8Character'
@@ -5059,6 +5294,113 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT OF VALIDATION
+        //
+        // Concerns:
+        //: 1 The vectorized kernels validate substantially faster than the
+        //:   portable one, on both ASCII and multilingual text.
+        //
+        // Plan:
+        //: 1 For each implementation, repeatedly find the valid prefix of a
+        //:   4 MiB buffer of ASCII text and of multilingual text, and report
+        //:   the throughput, in GB/s, over the validated prefix.
+        //:
+        //: 2 Report the throughput of 'isValid' on the same buffers, passing
+        //:   their length (which uses the fastest kernel) and not (which does
+        //:   not).  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: THROUGHPUT OF VALIDATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: THROUGHPUT OF VALIDATION\n"
+                               "=====================================\n";
+
+        typedef bdlde::Utf8Util_Impl Impl;
+        typedef Obj::IntPtr          IntPtr;
+        typedef Obj::size_type       size_type;
+
+        typedef size_type (*ValidFn)(IntPtr *, const char *, size_type);
+
+        const struct {
+            const char *d_name;
+            ValidFn     d_validFn;
+        } IMPLS[] = {
+            { "portable", &Impl::validPrefixLengthPortable },
+            { "ssse3",    &Impl::validPrefixLengthSsse3    },
+            { "avx2",     &Impl::validPrefixLengthAvx2     },
+        };
+        const int NUM_IMPLS = static_cast<int>(sizeof IMPLS / sizeof *IMPLS);
+
+        const bsl::size_t LEN       = 4 << 20;
+        const int         NUM_ITERS = argc > 2 ? atoi(argv[2]) : 20;
+
+        bsl::string ascii, multi;
+        while (ascii.length() < LEN) {
+            ascii += "The quick brown fox jumps over the lazy dog. ";
+        }
+        while (multi.length() + bsl::strlen(charUtf8MultiLang) <= LEN) {
+            multi += charUtf8MultiLang;
+        }
+        ascii.resize(LEN);
+
+        const bsl::string *TEXTS[]      = { &ascii, &multi };
+        const char        *TEXT_NAMES[] = { "ascii", "multilingual" };
+
+        for (int xi = 0; xi < 2; ++xi) {
+            const bsl::string& TEXT      = *TEXTS[xi];
+            const double       GIGABYTES = static_cast<double>(TEXT.length())
+                                         * NUM_ITERS / 1e9;
+
+            cout << TEXT_NAMES[xi] << ":\n";
+
+            for (int ti = 0; ti < NUM_IMPLS; ++ti) {
+                IntPtr          numCodePoints = 0;
+                size_type       prefix        = 0;
+                bsls::Stopwatch timer;
+
+                timer.start(true);
+                for (int i = 0; i < NUM_ITERS; ++i) {
+                    numCodePoints = 0;
+                    prefix        = IMPLS[ti].d_validFn(&numCodePoints,
+                                                        TEXT.data(),
+                                                        TEXT.length());
+                }
+                timer.stop();
+
+                // The portable kernel validates only an ASCII prefix, so
+                // report the throughput of the prefix actually validated.
+
+                cout << "    " << IMPLS[ti].d_name << ": "
+                     << static_cast<double>(prefix) * NUM_ITERS / 1e9
+                                                / timer.accumulatedWallTime()
+                     << " GB/s (" << prefix << " bytes)\n";
+            }
+
+            bsls::Stopwatch timer;
+
+            timer.start(true);
+            for (int i = 0; i < NUM_ITERS; ++i) {
+                ASSERT(Obj::isValid(TEXT.data(), TEXT.length()));
+            }
+            timer.stop();
+
+            cout << "    isValid(s, len): "
+                 << GIGABYTES / timer.accumulatedWallTime() << " GB/s\n";
+
+            timer.reset();
+            timer.start(true);
+            for (int i = 0; i < NUM_ITERS; ++i) {
+                ASSERT(Obj::isValid(TEXT.c_str()));
+            }
+            timer.stop();
+
+            cout << "    isValid(s):      "
+                 << GIGABYTES / timer.accumulatedWallTime() << " GB/s\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -29,8 +29,10 @@ BSLS_IDENT_RCSID(bdema_multipool_cpp,"$Id$ $CSID$")
 #include <bsls_performancehint.h>
 #include <bsls_log.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_cstdio.h>  // 'fprintf'
 #include <bsl_cstdint.h>
+#include <bsl_cstring.h>
 #include <bsl_limits.h>
 
 #include <new>           // placement 'new'
@@ -45,6 +47,24 @@ enum {
 
 namespace bdlma {
 
+                 // ---------------------------------------
+                 // struct ConcurrentMultipool::ThreadCache
+                 // ---------------------------------------
+
+struct ConcurrentMultipool::ThreadCache {
+    // This 'struct' holds, for each pool of a multipool, a magazine of free
+    // blocks private to a single thread.  Each cache is allocated as a single
+    // buffer whose trailing storage holds the magazine blocks and counts.
+
+    // DATA
+    ConcurrentMultipool  *d_multipool_p;  // multipool owning this cache
+    ThreadCache          *d_next_p;       // next cache in owner's list
+    ThreadCache          *d_prev_p;       // previous cache in owner's list
+    void                **d_blocks_p;     // 'numPools * magazineCapacity'
+                                          // cached blocks
+    int                  *d_counts_p;     // number of blocks in each magazine
+};
+
                         // -------------------------
                         // class ConcurrentMultipool
                         // -------------------------
@@ -182,6 +202,104 @@ void ConcurrentMultipool::initialize(
     autoPoolsDeallocator.release();
 }
 
+void ConcurrentMultipool::initializeThreadCaching(int magazineCapacity)
+{
+    BSLS_ASSERT(0 <= magazineCapacity);
+
+    if (0 == magazineCapacity) {
+        return;                                                       // RETURN
+    }
+
+    if (0 != bslmt::ThreadUtil::createKey(
+                                           &d_threadCacheKey,
+                                           (bslmt::ThreadUtil::Destructor)
+                                           &releaseThreadCache)) {
+        return;                                                       // RETURN
+    }
+
+    d_magazineCapacity = magazineCapacity;
+}
+
+ConcurrentMultipool::ThreadCache *ConcurrentMultipool::threadCache()
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                             bslmt::ThreadUtil::getSpecific(d_threadCacheKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+        return cache;                                                 // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    // The magazines of all pools are laid out contiguously after the cache
+    // header, followed by the block count of each magazine.
+
+    const bsl::size_t numBlocks = static_cast<bsl::size_t>(d_numPools)
+                                * static_cast<bsl::size_t>(d_magazineCapacity);
+
+    char *buffer = static_cast<char *>(d_allocAdapter.allocate(
+                                              sizeof(ThreadCache)
+                                            + numBlocks * sizeof(void *)
+                                            + d_numPools * sizeof(int)));
+
+    cache = new (buffer) ThreadCache();
+    cache->d_multipool_p = this;
+    cache->d_blocks_p    = reinterpret_cast<void **>(
+                                                 buffer + sizeof(ThreadCache));
+    cache->d_counts_p    = reinterpret_cast<int *>(cache->d_blocks_p
+                                                                  + numBlocks);
+    bsl::memset(cache->d_counts_p, 0, d_numPools * sizeof(int));
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_threadCacheKey, cache)) {
+        d_allocAdapter.deallocate(buffer);
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    cache->d_prev_p = 0;
+    cache->d_next_p = d_threadCaches_p;
+    if (d_threadCaches_p) {
+        d_threadCaches_p->d_prev_p = cache;
+    }
+    d_threadCaches_p = cache;
+
+    return cache;
+}
+
+// PRIVATE CLASS METHODS
+void ConcurrentMultipool::releaseThreadCache(void *threadCache)
+{
+    ThreadCache         *cache     = static_cast<ThreadCache *>(threadCache);
+    ConcurrentMultipool *multipool = cache->d_multipool_p;
+
+    for (int i = 0; i < multipool->d_numPools; ++i) {
+        void **blocks = cache->d_blocks_p + i * multipool->d_magazineCapacity;
+        for (int j = 0; j < cache->d_counts_p[i]; ++j) {
+            multipool->d_pools_p[i].deallocate(blocks[j]);
+        }
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&multipool->d_mutex);
+
+        if (cache->d_prev_p) {
+            cache->d_prev_p->d_next_p = cache->d_next_p;
+        }
+        else {
+            multipool->d_threadCaches_p = cache->d_next_p;
+        }
+        if (cache->d_next_p) {
+            cache->d_next_p->d_prev_p = cache->d_prev_p;
+        }
+    }
+
+    // 'd_allocAdapter' acquires 'd_mutex', so 'cache' is deallocated only
+    // after the guard above is released.
+
+    multipool->d_allocAdapter.deallocate(cache);
+}
+
 // PRIVATE ACCESSORS
 inline
 int ConcurrentMultipool::findPool(bsls::Types::size_type size) const
@@ -196,6 +314,8 @@ ConcurrentMultipool(bslma::Allocator *basicAllocator)
 : d_numPools(k_DEFAULT_NUM_POOLS)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
 {
     initialize(bsls::BlockGrowth::BSLS_GEOMETRIC, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -206,6 +326,8 @@ ConcurrentMultipool(int               numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
 {
     initialize(bsls::BlockGrowth::BSLS_GEOMETRIC, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -216,6 +338,8 @@ ConcurrentMultipool(bsls::BlockGrowth::Strategy  growthStrategy,
 : d_numPools(k_DEFAULT_NUM_POOLS)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
 {
     initialize(growthStrategy, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -227,6 +351,8 @@ ConcurrentMultipool(int                          numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
 {
     initialize(growthStrategy, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -238,6 +364,8 @@ ConcurrentMultipool(int                                numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
 {
     initialize(growthStrategyArray, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -250,10 +378,28 @@ ConcurrentMultipool(int                          numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
 {
     initialize(growthStrategy, maxBlocksPerChunk);
 }
 
+ConcurrentMultipool::
+ConcurrentMultipool(int                          numPools,
+                    bsls::BlockGrowth::Strategy  growthStrategy,
+                    int                          maxBlocksPerChunk,
+                    int                          magazineCapacity,
+                    bslma::Allocator            *basicAllocator)
+: d_numPools(numPools)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
+{
+    initialize(growthStrategy, maxBlocksPerChunk);
+    initializeThreadCaching(magazineCapacity);
+}
+
 ConcurrentMultipool::
 ConcurrentMultipool(int                                numPools,
                     const bsls::BlockGrowth::Strategy *growthStrategyArray,
@@ -262,6 +408,8 @@ ConcurrentMultipool(int                                numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
 {
     initialize(growthStrategyArray, maxBlocksPerChunk);
 }
@@ -274,6 +422,8 @@ ConcurrentMultipool(int                          numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
 {
     initialize(growthStrategy, maxBlocksPerChunkArray);
 }
@@ -286,12 +436,27 @@ ConcurrentMultipool(int                                numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_magazineCapacity(0)
+, d_threadCaches_p(0)
 {
     initialize(growthStrategyArray, maxBlocksPerChunkArray);
 }
 
 ConcurrentMultipool::~ConcurrentMultipool()
 {
+    if (d_magazineCapacity) {
+        // Deleting the key first guarantees that 'releaseThreadCache' is not
+        // invoked for any of the caches deallocated below.
+
+        bslmt::ThreadUtil::deleteKey(d_threadCacheKey);
+
+        while (d_threadCaches_p) {
+            ThreadCache *cache = d_threadCaches_p;
+            d_threadCaches_p   = cache->d_next_p;
+            d_allocAdapter.deallocate(cache);
+        }
+    }
+
     d_blockList.release();
     for (int i = 0; i < d_numPools; ++i) {
         d_pools_p[i].release();
@@ -307,7 +472,28 @@ void *ConcurrentMultipool::allocate(bsls::Types::size_type size)
         if (size <= d_maxBlockSize) {
             const int pool = findPool(size);
 
-            Header *p = static_cast<Header *>(d_pools_p[pool].allocate());
+            Header      *p     = 0;
+            ThreadCache *cache = d_magazineCapacity ? threadCache() : 0;
+
+            if (cache) {
+                int&   count  = cache->d_counts_p[pool];
+                void **blocks = cache->d_blocks_p + pool * d_magazineCapacity;
+
+                if (0 == count) {
+                    // Refill the empty magazine with a batch of blocks from
+                    // the shared pool.
+
+                    const int batchSize = (d_magazineCapacity + 1) / 2;
+                    for (; count < batchSize; ++count) {
+                        blocks[count] = d_pools_p[pool].allocate();
+                    }
+                }
+
+                p = static_cast<Header *>(blocks[--count]);
+            }
+            else {
+                p = static_cast<Header *>(d_pools_p[pool].allocate());
+            }
 
             p->d_header.d_poolIdx = pool;
 
@@ -339,6 +525,35 @@ void ConcurrentMultipool::deallocate(void *address)
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
         d_blockList.deallocate(h);
     }
+    else if (d_magazineCapacity) {
+        // A thread that has never allocated from this multipool has no cache
+        // and returns 'h' directly to the shared pool.
+
+        ThreadCache *cache = static_cast<ThreadCache *>(
+                             bslmt::ThreadUtil::getSpecific(d_threadCacheKey));
+        if (!cache) {
+            d_pools_p[pool].deallocate(h);
+            return;                                                   // RETURN
+        }
+
+        int&   count  = cache->d_counts_p[pool];
+        void **blocks = cache->d_blocks_p + pool * d_magazineCapacity;
+
+        if (d_magazineCapacity == count) {
+            // Flush the oldest half of the full magazine to the shared pool,
+            // retaining the most recently deallocated (and likely cache-hot)
+            // blocks.
+
+            const int batchSize = (d_magazineCapacity + 1) / 2;
+            for (int i = 0; i < batchSize; ++i) {
+                d_pools_p[pool].deallocate(blocks[i]);
+            }
+            count -= batchSize;
+            bsl::memmove(blocks, blocks + batchSize, count * sizeof *blocks);
+        }
+
+        blocks[count++] = h;
+    }
     else {
         d_pools_p[pool].deallocate(h);
     }
@@ -346,6 +561,19 @@ void ConcurrentMultipool::deallocate(void *address)
 
 void ConcurrentMultipool::release()
 {
+    if (d_magazineCapacity) {
+        // The blocks cached by each thread are about to be released along
+        // with the pools that supplied them.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        for (ThreadCache *cache = d_threadCaches_p;
+             cache;
+             cache = cache->d_next_p) {
+            bsl::memset(cache->d_counts_p, 0, d_numPools * sizeof(int));
+        }
+    }
+
     for (int i = 0; i < d_numPools; ++i) {
         d_pools_p[i].release();
     }
@@ -92,6 +92,12 @@ BSLS_IDENT("$Id: $")
 //:   internal pool, or directly if the maximum block size is exceeded).  If
 //:   not specified, the currently installed default allocator (see
 //:   'bslma_default') is used.
+//:
+//: 5 MAGAZINE CAPACITY -- the maximum number of free blocks of each size that
+//:   each thread may cache privately (see {Per-Thread Magazine Cache}).  If
+//:   not specified, no blocks are cached per thread.  Note that the magazine
+//:   capacity can be configured only if the number of pools, the growth
+//:   strategy, and the maximum blocks per chunk are also configured.
 //
 // A default-constructed multipool has a relatively small,
 // implementation-defined number of pools 'N' with respective block sizes
@@ -112,6 +118,36 @@ BSLS_IDENT("$Id: $")
 // single value applying to all of the maintained pools, or as an array of
 // values, with the elements applying to each individually maintained pool.
 //
+///Per-Thread Magazine Cache
+///-------------------------
+// Each 'bdlma::ConcurrentPool' keeps its free blocks on a single shared list
+// whose head is updated atomically by every allocation and deallocation.  When
+// many threads allocate and deallocate blocks of the same size, that list head
+// becomes a point of contention, and the cache line holding it migrates
+// between the processors on every operation.
+//
+// A multipool can optionally be created with a non-zero *magazine capacity*,
+// in which case each thread that uses the multipool is given, for each pool, a
+// private, bounded stack (a "magazine") of free blocks.  Allocation requests
+// are satisfied from the calling thread's magazine, which is refilled with a
+// batch of (about half of 'magazineCapacity') blocks from the shared pool when
+// it is empty; deallocated blocks are returned to the calling thread's
+// magazine, which flushes a batch of its oldest blocks back to the shared pool
+// when it is full.  In the steady state, most operations therefore touch only
+// memory private to the calling thread.  Note that a block may be deallocated
+// by a thread other than the one that allocated it.
+//
+// The magazine layer trades memory for scalability: each thread may retain up
+// to 'magazineCapacity' free blocks per pool, and the bookkeeping for each
+// thread's magazines is itself allocated from the underlying allocator the
+// first time that thread allocates from the multipool.  The blocks held by a
+// thread's magazines are returned to the shared pools when that thread exits;
+// all magazines are emptied by 'release' and freed by the destructor.  Each
+// multipool having a non-zero magazine capacity consumes one thread-specific
+// storage key (see 'bslmt_threadutil'); if no key is available, the multipool
+// silently operates without magazines (see 'magazineCapacity').  The behavior
+// is undefined if a thread that has used the multipool exits concurrently with
+// the destruction of the multipool.
 //
 ///Usage
 ///-----
@@ -464,6 +500,7 @@ BSLS_IDENT("$Id: $")
 #include <bslma_deleterhelper.h>
 
 #include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_alignmentutil.h>
 #include <bsls_blockgrowth.h>
@@ -506,6 +543,10 @@ class ConcurrentMultipool {
         } d_header;
     };
 
+    struct ThreadCache;
+        // This 'struct', defined in the implementation file, holds the
+        // magazines of free blocks cached by a single thread.
+
     // DATA
     ConcurrentPool   *d_pools_p;       // array of memory pools, each
                                        // dispensing fixed-size memory blocks
@@ -525,6 +566,20 @@ class ConcurrentMultipool {
     ConcurrentAllocatorAdapter
                       d_allocAdapter;  // thread-safe adapter
 
+    int               d_magazineCapacity;
+                                       // maximum number of free blocks cached
+                                       // per thread per pool (0 if thread
+                                       // caching is disabled)
+
+    bslmt::ThreadUtil::Key
+                      d_threadCacheKey;
+                                       // key of the calling thread's cache
+                                       // (valid only if 'd_magazineCapacity')
+
+    ThreadCache      *d_threadCaches_p;
+                                       // list of all thread caches, guarded
+                                       // by 'd_mutex'
+
   private:
     // NOT IMPLEMENTED
     ConcurrentMultipool(const ConcurrentMultipool&);
@@ -546,6 +601,23 @@ class ConcurrentMultipool {
         // with the corresponding growth strategy or max blocks per chunk entry
         // within the array.
 
+    void initializeThreadCaching(int magazineCapacity);
+        // Enable the per-thread caching of up to the specified
+        // 'magazineCapacity' free blocks per pool.  If 'magazineCapacity' is
+        // 0, or a thread-specific storage key can not be obtained, thread
+        // caching is disabled.
+
+    ThreadCache *threadCache();
+        // Return the address of the cache of the calling thread, creating it
+        // if the calling thread does not yet have one, or 0 if the cache can
+        // not be registered.  The behavior is undefined unless thread caching
+        // is enabled.
+
+    static void releaseThreadCache(void *threadCache);
+        // Return the blocks held by the specified 'threadCache' to the pools
+        // of the multipool owning it, and deallocate 'threadCache'.  This
+        // function is invoked on the exit of each thread having a cache.
+
     // PRIVATE ACCESSORS
     int findPool(bsls::Types::size_type size) const;
         // Return the index of the memory pool in this multipool for an
@@ -598,6 +670,21 @@ class ConcurrentMultipool {
         // 2; if geometric growth would exceed the maximum value, the chunk
         // size is capped at that value).
 
+    ConcurrentMultipool(int                          numPools,
+                        bsls::BlockGrowth::Strategy  growthStrategy,
+                        int                          maxBlocksPerChunk,
+                        int                          magazineCapacity,
+                        bslma::Allocator            *basicAllocator = 0);
+        // Create a multipool memory manager having the specified 'numPools',
+        // 'growthStrategy', and 'maxBlocksPerChunk', as described above, that
+        // caches up to the specified 'magazineCapacity' free blocks per pool
+        // in each thread that uses it (see {Per-Thread Magazine Cache}).  If
+        // 'magazineCapacity' is 0, no blocks are cached per thread.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numPools',
+        // '1 <= maxBlocksPerChunk', and '0 <= magazineCapacity'.
+
     ConcurrentMultipool(int                                numPools,
                         const bsls::BlockGrowth::Strategy *growthStrategyArray,
                         bslma::Allocator                  *basicAllocator = 0);
@@ -701,6 +788,11 @@ class ConcurrentMultipool {
         // 'size <= maxPooledBlockSize()' and '0 <= numBlocks'.
 
     // ACCESSORS
+    int magazineCapacity() const;
+        // Return the maximum number of free blocks cached per pool by each
+        // thread using this multipool object, or 0 if this multipool does not
+        // cache blocks per thread.
+
     int numPools() const;
         // Return the number of pools managed by this multipool object.
 
@@ -746,6 +838,12 @@ void ConcurrentMultipool::deleteObjectRaw(const TYPE *object)
 }
 
 // ACCESSORS
+inline
+int ConcurrentMultipool::magazineCapacity() const
+{
+    return d_magazineCapacity;
+}
+
 inline
 int ConcurrentMultipool::numPools() const
 {
@@ -65,11 +65,14 @@ using namespace bsl;  // automatically added by script
 // [ 9] void deleteObjectRaw(const TYPE *object);
 // [ 5] void release();
 // [ 6] void reserveCapacity(bsls::Types::size_type size, int numObjects);
+// [12] ConcurrentMultipool(numPools, gs, maxBlocks, magazineCap, ba);
+// [12] int magazineCapacity() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 7] CONCURRENCY TEST
 // [11] OLD USAGE EXAMPLE
-// [12] USAGE EXAMPLE
+// [12] PER-THREAD MAGAZINE CACHE
+// [13] USAGE EXAMPLE
 
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
@@ -295,6 +298,51 @@ extern "C" void *workerThread(void *arg) {
     return arg;
 }
 
+struct MagazineArgs {
+    // This 'struct' describes the blocks operated on by 'allocateBlocks' and
+    // 'deallocateBlocks'.
+
+    Obj                  *d_multipool_p;  // multipool under test
+    bsl::vector<void *>  *d_blocks_p;     // blocks (de)allocated
+    int                   d_size;         // size of each allocated block
+};
+
+extern "C" void *allocateBlocks(void *arg)
+    // Replace each element of the vector described by the specified 'arg' (a
+    // 'MagazineArgs') by a newly allocated block of the described size.  This
+    // function is intended to be a thread entry point.
+{
+    MagazineArgs *args = static_cast<MagazineArgs *>(arg);
+
+    for (bsl::size_t i = 0; i < args->d_blocks_p->size(); ++i) {
+        (*args->d_blocks_p)[i] = args->d_multipool_p->allocate(args->d_size);
+        scribble(static_cast<char *>((*args->d_blocks_p)[i]), args->d_size);
+    }
+    return arg;
+}
+
+extern "C" void *deallocateBlocks(void *arg)
+    // Deallocate each block in the vector described by the specified 'arg' (a
+    // 'MagazineArgs'), then clear the vector.  This function is intended to be
+    // a thread entry point.
+{
+    MagazineArgs *args = static_cast<MagazineArgs *>(arg);
+
+    for (bsl::size_t i = 0; i < args->d_blocks_p->size(); ++i) {
+        args->d_multipool_p->deallocate((*args->d_blocks_p)[i]);
+    }
+    args->d_blocks_p->clear();
+    return arg;
+}
+
+extern "C" void *allocateAndDeallocateBlocks(void *arg)
+    // Invoke 'allocateBlocks', then 'deallocateBlocks', with the specified
+    // 'arg'.  This function is intended to be a thread entry point.
+{
+    allocateBlocks(arg);
+    return deallocateBlocks(arg);
+}
+
 //=============================================================================
 //                                USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -661,7 +709,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -730,6 +778,296 @@ int main(int argc, char *argv[])
             // Now 'pM' and 'pBuf' are also invalid addresses.
         }
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING PER-THREAD MAGAZINE CACHE
+        //
+        // Concerns:
+        //: 1 A multipool created without a magazine capacity, or with a
+        //:   capacity of 0, does not cache blocks per thread.
+        //:
+        //: 2 A multipool having a magazine capacity refills an empty magazine
+        //:   with a batch of blocks from the shared pool, and satisfies
+        //:   subsequent requests of the same size from that magazine.
+        //:
+        //: 3 Deallocated blocks are reused by the deallocating thread, most
+        //:   recently deallocated first.
+        //:
+        //: 4 A full magazine flushes a batch of blocks back to the shared
+        //:   pool, where they are available to other threads.
+        //:
+        //: 5 The blocks cached by a thread are returned to the shared pools,
+        //:   and the cache itself deallocated, when the thread exits.
+        //:
+        //: 6 Blocks may be deallocated by a thread other than the one that
+        //:   allocated them.
+        //:
+        //: 7 'release' empties every magazine, and the destructor releases all
+        //:   memory, including the caches of threads that are still running.
+        //:
+        //: 8 Concurrent allocation and deallocation from many threads is
+        //:   thread-safe.
+        //
+        // Plan:
+        //: 1 Verify 'magazineCapacity' for objects created by each relevant
+        //:   constructor.  (C-1)
+        //:
+        //: 2 Using a test allocator and fixed chunks of a single block, count
+        //:   the allocations made by the multipool to verify the batch sizes
+        //:   of refills and flushes, and the reuse of deallocated blocks.
+        //:   (C-2..4)
+        //:
+        //: 3 Allocate and deallocate blocks in other threads, and verify that
+        //:   no memory is acquired from the test allocator to satisfy
+        //:   requests that can be served from blocks returned to the shared
+        //:   pools by those threads.  (C-5..6)
+        //:
+        //: 4 Verify the blocks in use by the test allocator after 'release'
+        //:   and destruction.  (C-7)
+        //:
+        //: 5 Repeat the concurrency test of case 7 with thread caching
+        //:   enabled.  (C-8)
+        //
+        // Testing:
+        //   ConcurrentMultipool(numPools, gs, maxBlocks, magazineCap, ba);
+        //   int magazineCapacity() const;
+        //   PER-THREAD MAGAZINE CACHE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PER-THREAD MAGAZINE CACHE" << endl
+                          << "=================================" << endl;
+
+        const bsls::BlockGrowth::Strategy FIXED =
+                                             bsls::BlockGrowth::BSLS_CONSTANT;
+
+        if (verbose) cout << "\nTesting 'magazineCapacity'." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mA(&ta);                  ASSERT( 0 == mA.magazineCapacity());
+            Obj mB(4, FIXED, 1, &ta);     ASSERT( 0 == mB.magazineCapacity());
+            Obj mC(4, FIXED, 1, 0, &ta);  ASSERT( 0 == mC.magazineCapacity());
+            Obj mD(4, FIXED, 1, 1, &ta);  ASSERT( 1 == mD.magazineCapacity());
+            Obj mE(4, FIXED, 1, 16, &ta); ASSERT(16 == mE.magazineCapacity());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting refill and reuse." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            // With a capacity of 4, magazines are refilled and flushed in
+            // batches of 2 blocks, and each chunk holds a single block.
+
+            Obj mX(4, FIXED, 1, 4, &ta);
+
+            bsls::Types::Int64 n = ta.numAllocations();
+
+            // The first allocation creates the thread's cache, then refills
+            // the magazine with 2 blocks.
+
+            char *p0 = static_cast<char *>(mX.allocate(8));
+            ASSERT(n + 3 == ta.numAllocations());
+            ASSERT(0 == recPool(p0));
+            scribble(p0, 8);
+
+            char *p1 = static_cast<char *>(mX.allocate(5));
+            ASSERT(n + 3 == ta.numAllocations());
+            ASSERT(0 == recPool(p1));
+            ASSERT(p0 != p1);
+
+            char *p2 = static_cast<char *>(mX.allocate(8));
+            ASSERT(n + 5 == ta.numAllocations());
+            ASSERT(p0 != p2 && p1 != p2);
+
+            // Other sizes use separate magazines.
+
+            char *q0 = static_cast<char *>(mX.allocate(16));
+            ASSERT(n + 7 == ta.numAllocations());
+            ASSERT(1 == recPool(q0));
+
+            // Deallocated blocks are reused, most recent first.
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            ASSERT(p2 == mX.allocate(8));
+            ASSERT(p1 == mX.allocate(8));
+
+            // Blocks above the maximum pooled size are not cached.
+
+            char *big = static_cast<char *>(mX.allocate(1024));
+            ASSERT(n + 8 == ta.numAllocations());
+            ASSERT(-1 == recPool(big));
+            mX.deallocate(big);
+
+            mX.deallocate(p0);
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            mX.deallocate(q0);
+            ASSERT(n + 8 == ta.numAllocations());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting flush and thread exit." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(4, FIXED, 1, 4, &ta);
+
+            bsl::vector<void *> blocks(10);
+            MagazineArgs        args = { &mX, &blocks, 8 };
+
+            // Allocate 10 blocks and deallocate them in this thread: the
+            // magazine keeps 4 of them and flushes the other 6, in batches of
+            // 2, to the shared pool.
+
+            allocateBlocks(&args);
+
+            const bsls::Types::Int64 NUM_ALLOC = ta.numAllocations();
+            const bsls::Types::Int64 NUM_INUSE = ta.numBlocksInUse();
+
+            deallocateBlocks(&args);
+            ASSERT(NUM_ALLOC == ta.numAllocations());
+
+            // Another thread can allocate the 6 flushed blocks; only its
+            // cache is allocated from 'ta'.
+
+            blocks.resize(6);
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  allocateBlocks,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERTV(ta.numAllocations(), NUM_ALLOC + 1 == ta.numAllocations());
+
+            // When that thread exits, its (empty) cache is deallocated.
+
+            ASSERTV(ta.numBlocksInUse(), NUM_INUSE == ta.numBlocksInUse());
+
+            // Blocks allocated by one thread can be deallocated by another.
+            // A thread that has never allocated from the multipool has no
+            // cache, and returns blocks directly to the shared pool.
+
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  deallocateBlocks,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(NUM_ALLOC + 1 == ta.numAllocations());
+            ASSERT(NUM_INUSE     == ta.numBlocksInUse());
+
+            // This thread now has 4 cached blocks, and the shared pool 6.
+
+            blocks.resize(10);
+            allocateBlocks(&args);
+            ASSERT(NUM_ALLOC + 1 == ta.numAllocations());
+
+            void *extra = mX.allocate(8);
+            ASSERT(NUM_ALLOC + 1 < ta.numAllocations());
+            mX.deallocate(extra);
+
+            deallocateBlocks(&args);
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(4, FIXED, 1, 4, &ta);
+
+            bsl::vector<void *> blocks(4);
+            MagazineArgs        args = { &mX, &blocks, 8 };
+
+            const bsls::Types::Int64 NUM_INUSE = ta.numBlocksInUse();
+
+            // A thread that exits with a full magazine returns its blocks to
+            // the shared pool, and deallocates its cache.
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  allocateAndDeallocateBlocks,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(NUM_INUSE + 4 == ta.numBlocksInUse());
+
+            // This thread finds those blocks in the shared pool.
+
+            const bsls::Types::Int64 NUM_ALLOC = ta.numAllocations();
+
+            blocks.resize(4);
+            allocateBlocks(&args);
+            ASSERT(NUM_ALLOC + 1 == ta.numAllocations());
+
+            deallocateBlocks(&args);
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'release' and destructor." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            {
+                Obj mX(4, FIXED, 1, 4, &ta);
+
+                const bsls::Types::Int64 NUM_INUSE = ta.numBlocksInUse();
+
+                void *p = mX.allocate(8);
+                ASSERT(p);
+
+                mX.release();
+
+                // Only this thread's cache remains.
+
+                ASSERT(NUM_INUSE + 1 == ta.numBlocksInUse());
+
+                // The emptied magazine is refilled on the next allocation.
+
+                const bsls::Types::Int64 NUM_ALLOC = ta.numAllocations();
+
+                p = mX.allocate(8);
+                ASSERT(NUM_ALLOC + 2 == ta.numAllocations());
+                mX.deallocate(p);
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting concurrency." << endl;
+        {
+            bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+
+            bslma::TestAllocator ta;
+            Obj                  mX(4,
+                                    bsls::BlockGrowth::BSLS_GEOMETRIC,
+                                    32,
+                                    16,
+                                    &ta);
+
+            const int SIZES [] = { 1 , 2 , 4,  8, 16, 32, 64, 128, 256, 512,
+                                   1 , 2 , 4,  8, 16, 32, 64, 128, 256, 512};
+
+            const int NUM_SIZES = sizeof (SIZES) / sizeof(*SIZES);
+
+            WorkerArgs args;
+            args.d_allocator = &mX;
+            args.d_sizes     = (const int *)&SIZES;
+            args.d_numSizes  = NUM_SIZES;
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::create(&threads[i],
+                                                   workerThread,
+                                                   &args);
+                LOOP_ASSERT(i, 0 == rc);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                int rc = bslmt::ThreadUtil::join(threads[i]);
+                LOOP_ASSERT(i, 0 == rc);
+            }
+            mX.release();
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING OLD USAGE EXAMPLE
@@ -93,6 +93,12 @@ BSLS_IDENT("$Id: $")
 //:   internal pool, or directly if the maximum block size is exceeded).  If
 //:   not specified, the currently installed default allocator (see
 //:   'bslma_default') is used.
+//: 5 MAGAZINE CAPACITY -- the maximum number of free blocks of each size that
+//:   each thread may cache privately, in front of the shared pools (see
+//:   {'bdlma_concurrentmultipool'|Per-Thread Magazine Cache}).  If not
+//:   specified, no blocks are cached per thread.  Note that the magazine
+//:   capacity can be configured only if the number of pools, the growth
+//:   strategy, and the maximum blocks per chunk are also configured.
 //
 // A default-constructed multipool allocator has a relatively small,
 // implementation-defined number of pools 'N' with respective block sizes
@@ -364,6 +370,24 @@ class ConcurrentMultipoolAllocator : public bdlma::ManagedAllocator {
         // 2; if geometric growth would exceed the maximum value, the chunk
         // size is capped at that value).
 
+    ConcurrentMultipoolAllocator(
+                              int                          numPools,
+                              bsls::BlockGrowth::Strategy  growthStrategy,
+                              int                          maxBlocksPerChunk,
+                              int                          magazineCapacity,
+                              bslma::Allocator            *basicAllocator = 0);
+        // Create a multipool allocator having the specified 'numPools',
+        // 'growthStrategy', and 'maxBlocksPerChunk', as described above, that
+        // caches up to the specified 'magazineCapacity' free blocks per pool
+        // in each thread that uses it.  If 'magazineCapacity' is 0, no blocks
+        // are cached per thread.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '1 <= numPools', '1 <= maxBlocksPerChunk', and
+        // '0 <= magazineCapacity'.  Note that per-thread caching reduces
+        // contention between threads that allocate and deallocate blocks of
+        // the same size, at the cost of memory retained by each thread.
+
     ConcurrentMultipoolAllocator(
                         int                                numPools,
                         const bsls::BlockGrowth::Strategy *growthStrategyArray,
@@ -452,6 +476,11 @@ class ConcurrentMultipoolAllocator : public bdlma::ManagedAllocator {
         // allocator.
 
     // ACCESSORS
+    int magazineCapacity() const;
+        // Return the maximum number of free blocks cached per pool by each
+        // thread using this multipool allocator, or 0 if this allocator does
+        // not cache blocks per thread.
+
     int numPools() const;
         // Return the number of pools managed by this multipool allocator.
 
@@ -525,6 +554,21 @@ ConcurrentMultipoolAllocator::ConcurrentMultipoolAllocator(
 {
 }
 
+inline
+ConcurrentMultipoolAllocator::ConcurrentMultipoolAllocator(
+                  int                               numPools,
+                  bsls::BlockGrowth::Strategy       growthStrategy,
+                  int                               maxBlocksPerChunk,
+                  int                               magazineCapacity,
+                  bslma::Allocator                 *basicAllocator)
+: d_multipool(numPools,
+              growthStrategy,
+              maxBlocksPerChunk,
+              magazineCapacity,
+              basicAllocator)
+{
+}
+
 inline
 ConcurrentMultipoolAllocator::ConcurrentMultipoolAllocator(
                   int                                numPools,
@@ -568,6 +612,12 @@ void ConcurrentMultipoolAllocator::reserveCapacity(
 }
 
 // ACCESSORS
+inline
+int ConcurrentMultipoolAllocator::magazineCapacity() const
+{
+    return d_multipool.magazineCapacity();
+}
+
 inline
 int ConcurrentMultipoolAllocator::numPools() const
 {
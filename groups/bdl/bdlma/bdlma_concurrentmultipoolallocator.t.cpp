@@ -68,8 +68,10 @@ using namespace bsl;  // automatically added by script
 // [2] void deallocate(address);
 // [1] void release();
 // [3] void reserveCapacity(numBytes);
+// [7] bdlma::ConcurrentMultipoolAllocator(numPools, gs, maxBlk, magCap, Z);
+// [7] int magazineCapacity() const;
 //-----------------------------------------------------------------------------
-// [7] USAGE EXAMPLE
+// [8] USAGE EXAMPLE
 
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
@@ -849,7 +851,7 @@ int main(int argc, char *argv[])
     bslma::Allocator     *Z = &testAllocator;
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
 // Finally, in 'main', we can create a 'bdlma::ConcurrentMultipoolAllocator'
 // and pass it to our 'my_NamedGraphContainer'.  Since we know that the maximum
 // block size needed is 32 (comes from 'sizeof(my_Graph)'), we can calculate
@@ -869,6 +871,94 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // MAGAZINE CAPACITY TEST
+        //   Create a multipool allocator and a multipool, both having a
+        //   magazine capacity, and initialize each with its own instance of
+        //   test allocator.  Request memory of varying sizes from the
+        //   multipool allocator, deallocate and reallocate the same blocks,
+        //   and verify that only the unpooled blocks are requested again from
+        //   the test allocator.  Perform the same requests on the multipool,
+        //   and verify that, after 'release', both test allocators contain
+        //   the same number of bytes in use.
+        //
+        // Testing:
+        //   bdlma::ConcurrentMultipoolAllocator(numPools, gs, maxBlk,
+        //                                       magCap, Z);
+        //   int magazineCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "MAGAZINE CAPACITY TEST" << endl
+                                  << "======================" << endl;
+
+        const bsls::BlockGrowth::Strategy GEO =
+                                            bsls::BlockGrowth::BSLS_GEOMETRIC;
+
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mA(5, GEO, 8, &ta);
+            ASSERT(0 == mA.magazineCapacity());
+
+            Obj mB(5, GEO, 8, 0, &ta);
+            ASSERT(0 == mB.magazineCapacity());
+        }
+
+        const int DATA[] = { 1, 5, 8, 9, 16, 17, 64, 128, 129, 1000 };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        const int MAGAZINE_CAPACITIES[] = { 1, 2, 7, 32 };
+        enum { NUM_CAPACITIES = sizeof  MAGAZINE_CAPACITIES
+                              / sizeof *MAGAZINE_CAPACITIES };
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            const int CAPACITY = MAGAZINE_CAPACITIES[ci];
+
+            bslma::TestAllocator multipoolAllocatorTA(veryVeryVerbose);
+            bslma::TestAllocator multipoolTA(veryVeryVerbose);
+
+            Obj                        mX(5,
+                                          GEO,
+                                          8,
+                                          CAPACITY,
+                                          &multipoolAllocatorTA);
+            bdlma::ConcurrentMultipool mp(5, GEO, 8, CAPACITY, &multipoolTA);
+
+            LOOP_ASSERT(CAPACITY, CAPACITY == mX.magazineCapacity());
+
+            void *blocks[NUM_DATA];
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                blocks[i] = mX.allocate(DATA[i]);
+                mp.deallocate(mp.allocate(DATA[i]));
+                LOOP2_ASSERT(CAPACITY, i, blocks[i]);
+            }
+
+            const bsls::Types::Int64 NUM_ALLOC =
+                                         multipoolAllocatorTA.numAllocations();
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            for (int i = 0; i < NUM_DATA; ++i) {
+                blocks[i] = mX.allocate(DATA[i]);
+            }
+
+            // Only the 2 blocks larger than 'maxPooledBlockSize()' are
+            // allocated again.
+
+            LOOP_ASSERT(CAPACITY, NUM_ALLOC + 2 ==
+                                        multipoolAllocatorTA.numAllocations());
+
+            mX.release();
+            mp.release();
+
+            LOOP_ASSERT(CAPACITY,
+                        multipoolTA.numBytesInUse() ==
+                                         multipoolAllocatorTA.numBytesInUse());
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING OLD USAGE EXAMPLE
@@ -12,8 +12,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
 #include <bdlf_bind.h>
 
+#include <bdlma_concurrentpool.h>
+
 #include <bdlt_timeunitratio.h>
 
 #include <bslmt_lockguard.h>
@@ -23,6 +27,8 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 #include <bsls_review.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
 #include <bsl_vector.h>
 
 // Implementation note: When casting, we often cast through 'void *' or
@@ -30,6 +36,16 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 
 namespace BloombergLP {
 
+// CONSTANTS
+static const bsls::Types::Int64 k_DISPATCHER_AWAKE =
+                              bsl::numeric_limits<bsls::Types::Int64>::min();
+    // value of 'd_wheelWakeTime' while the dispatcher thread is not waiting
+
+static const bsls::Types::Int64 k_NO_DEADLINE =
+                              bsl::numeric_limits<bsls::Types::Int64>::max();
+    // value of 'd_wheelWakeTime' while the dispatcher thread waits without a
+    // deadline
+
 // STATIC FUNCTIONS
 static inline
 void defaultDispatcherFunction(const bsl::function<void()>& callback)
@@ -119,10 +135,519 @@ bsls::TimeInterval EventSchedulerTestTimeSource_Data::currentTime() const
     return d_currentTime;
 }
 
+                   // =====================================
+                   // class EventScheduler_TimingWheelEvent
+                   // =====================================
+
+class EventScheduler_TimingWheelEvent {
+    // This 'class' represents an event held by the timing wheel of an event
+    // scheduler in timing-wheel mode.  An event is a node of a circular,
+    // doubly-linked list identifying the slot of the wheel that holds it.  The
+    // lifetime of an event is governed by a reference count: the wheel holds
+    // a reference while the event is scheduled, as does each handle to the
+    // event and the dispatcher thread while it executes the event.
+
+    // NOT IMPLEMENTED
+    EventScheduler_TimingWheelEvent(const EventScheduler_TimingWheelEvent&);
+    EventScheduler_TimingWheelEvent& operator=(
+                                       const EventScheduler_TimingWheelEvent&);
+
+  public:
+    // DATA
+    EventScheduler_TimingWheelEvent *d_prev_p;     // previous event in list
+
+    EventScheduler_TimingWheelEvent *d_next_p;     // next event in list
+
+    bsls::Types::Int64               d_time;       // time at which the event
+                                                   // is due, in microseconds
+
+    bsls::Types::Int64               d_interval;   // interval of a recurring
+                                                   // event, in microseconds,
+                                                   // or 0 for a one-time event
+
+    int                              d_list;       // index of the list of the
+                                                   // wheel holding the event,
+                                                   // or -1 if not scheduled
+
+    bsls::AtomicInt                  d_refCount;   // number of references
+
+    bdlma::ConcurrentPool           *d_pool_p;     // pool supplying the memory
+                                                   // of this object (held)
+
+    bsl::function<void()>            d_callback;   // callback of the event
+
+    // CREATORS
+    EventScheduler_TimingWheelEvent(
+                                 bsls::Types::Int64            time,
+                                 bsls::Types::Int64            interval,
+                                 int                           numReferences,
+                                 const bsl::function<void()>&  callback,
+                                 bdlma::ConcurrentPool        *pool,
+                                 bslma::Allocator             *basicAllocator);
+        // Create an event due at the specified 'time' (in microseconds) and,
+        // if the specified 'interval' (in microseconds) is positive, every
+        // 'interval' thereafter, having the specified 'numReferences' and
+        // executing the specified 'callback'.  The memory of this object was
+        // supplied by the specified 'pool'.  Use the specified
+        // 'basicAllocator' to supply memory.
+
+    //! ~EventScheduler_TimingWheelEvent() = default;
+        // Destroy this object.
+};
+
+// CREATORS
+EventScheduler_TimingWheelEvent::EventScheduler_TimingWheelEvent(
+                                 bsls::Types::Int64            time,
+                                 bsls::Types::Int64            interval,
+                                 int                           numReferences,
+                                 const bsl::function<void()>&  callback,
+                                 bdlma::ConcurrentPool        *pool,
+                                 bslma::Allocator             *basicAllocator)
+: d_prev_p(0)
+, d_next_p(0)
+, d_time(time)
+, d_interval(interval)
+, d_list(-1)
+, d_refCount(numReferences)
+, d_pool_p(pool)
+, d_callback(bsl::allocator_arg_t(), basicAllocator, callback)
+{
+}
+
+                      // ================================
+                      // class EventScheduler_TimingWheel
+                      // ================================
+
+class EventScheduler_TimingWheel {
+    // This 'class' implements a hashed hierarchical timing wheel holding the
+    // events of an event scheduler in timing-wheel mode.  Time is divided into
+    // *ticks* of a fixed resolution, and an event due at time 't' becomes
+    // *expired* once the current tick reaches 'ceil(t / resolution)'.  The
+    // wheel has 'k_NUM_LEVELS' levels of 'k_NUM_SLOTS' slots each; an event
+    // is held by the slot, at the level of the most significant bit in which
+    // its tick differs from the current tick, that is indexed by the bits of
+    // its tick at that level.  Events too distant for the wheel are held by an
+    // overflow list, and expired events by a list in the order in which they
+    // expired.  When the current tick advances, the slots it crosses are
+    // emptied and their events are re-inserted, moving each event to a lower
+    // level or to the expired list.  Inserting or removing an event therefore
+    // takes constant time, and each event is moved at most once per level.
+    // This class is not thread-safe; the scheduler protects it by its mutex.
+
+    // PRIVATE TYPES
+    typedef EventScheduler_TimingWheelEvent Event;
+    typedef bsl::uint64_t                   Uint64;
+    typedef bsls::Types::Int64              Int64;
+
+    enum {
+        k_BITS_PER_LEVEL = 6,
+        k_NUM_SLOTS      = 1 << k_BITS_PER_LEVEL,
+        k_NUM_LEVELS     = 6,
+        k_OVERFLOW       = k_NUM_LEVELS * k_NUM_SLOTS,  // overflow list
+        k_EXPIRED,                                      // expired list
+        k_NUM_LISTS
+    };
+
+    // DATA
+    Int64                 d_resolution;            // length of a tick, in
+                                                   // microseconds
+
+    Uint64                d_currentTick;           // current tick
+
+    Uint64                d_occupied[k_NUM_LEVELS];
+                                                   // bit mask, per level, of
+                                                   // the non-empty slots
+
+    Event                *d_lists[k_NUM_LISTS];    // first event of each slot,
+                                                   // of the overflow list, and
+                                                   // of the expired list
+
+    bsl::vector<Event *>  d_moved;                 // events being re-inserted
+                                                   // by 'advance'
+
+    bsl::vector<Event *>  d_expired;               // events expired by
+                                                   // 'advance'
+
+    bdlma::ConcurrentPool d_pool;                  // pool supplying the memory
+                                                   // of the events
+
+    bslma::Allocator     *d_allocator_p;           // memory allocator (held)
+
+    // NOT IMPLEMENTED
+    EventScheduler_TimingWheel(const EventScheduler_TimingWheel&);
+    EventScheduler_TimingWheel& operator=(const EventScheduler_TimingWheel&);
+
+    // PRIVATE CLASS METHODS
+    static bool isEarlier(const Event *lhs, const Event *rhs);
+        // Return 'true' if the specified 'lhs' is due before the specified
+        // 'rhs', and 'false' otherwise.
+
+    static Uint64 rotateRight(Uint64 value, int numBits);
+        // Return the specified 'value' rotated right by the specified
+        // 'numBits'.  The behavior is undefined unless '0 <= numBits < 64'.
+
+    // PRIVATE MANIPULATORS
+    void append(int list, Event *event);
+        // Append the specified 'event' to the specified 'list'.
+
+    void moveList(int list);
+        // Remove all events of the specified 'list' and append them to
+        // 'd_moved'.
+
+    // PRIVATE ACCESSORS
+    Uint64 tick(Int64 time) const;
+        // Return the first tick at, or after, the specified 'time' (in
+        // microseconds).
+
+  public:
+    // CREATORS
+    EventScheduler_TimingWheel(Int64             resolution,
+                               Int64             now,
+                               bslma::Allocator *basicAllocator);
+        // Create an empty timing wheel having ticks of the specified
+        // 'resolution' (in microseconds) and whose current tick contains the
+        // specified 'now' (in microseconds).  Use the specified
+        // 'basicAllocator' to supply memory.  The behavior is undefined
+        // unless '1 <= resolution'.
+
+    ~EventScheduler_TimingWheel();
+        // Destroy this object.  The behavior is undefined unless this wheel
+        // is empty and no event created by it is outstanding.
+
+    // MANIPULATORS
+    void advance(Int64 now);
+        // Advance the current tick of this wheel to the tick containing the
+        // specified 'now' (in microseconds), and move the events becoming due
+        // to the expired list, in the order of their scheduled times.  This
+        // method has no effect if the current tick contains a later time.
+
+    Event *createEvent(Int64                         time,
+                       Int64                         interval,
+                       int                           numReferences,
+                       const bsl::function<void()>&  callback);
+        // Return the address of a new event, not yet scheduled, that is due at
+        // the specified 'time' and, if the specified 'interval' is positive,
+        // every 'interval' thereafter, having the specified 'numReferences'
+        // and executing the specified 'callback'.  Note that this method is
+        // thread-safe.
+
+    Event *frontExpired() const;
+        // Return the address of the first expired event, or 0 if there is no
+        // expired event.
+
+    void insert(Event *event);
+        // Schedule the specified 'event', which is not scheduled, according to
+        // its time.
+
+    void remove(Event *event);
+        // Unschedule the specified 'event', which is scheduled.
+
+    void removeAll(bsl::vector<Event *> *events);
+        // Unschedule all events of this wheel, and append them to the
+        // specified 'events'.
+
+    // ACCESSORS
+    Int64 nextExpiryTime() const;
+        // Return the time (in microseconds) at which the wheel should next be
+        // advanced, i.e., the beginning of the first tick at which a
+        // scheduled event either becomes due or moves to a lower level, or
+        // the maximum 'Int64' value if there is no such tick.  Note that this
+        // method ignores the expired list.
+
+    Int64 resolution() const;
+        // Return the length of a tick of this wheel, in microseconds.
+};
+
+// PRIVATE CLASS METHODS
+bool EventScheduler_TimingWheel::isEarlier(const Event *lhs, const Event *rhs)
+{
+    return lhs->d_time < rhs->d_time;
+}
+
+bsl::uint64_t EventScheduler_TimingWheel::rotateRight(Uint64 value,
+                                                      int    numBits)
+{
+    return numBits ? (value >> numBits) | (value << (64 - numBits)) : value;
+}
+
+// PRIVATE MANIPULATORS
+void EventScheduler_TimingWheel::append(int list, Event *event)
+{
+    Event *head = d_lists[list];
+    if (0 == head) {
+        event->d_prev_p = event;
+        event->d_next_p = event;
+        d_lists[list]   = event;
+    }
+    else {
+        event->d_prev_p          = head->d_prev_p;
+        event->d_next_p          = head;
+        head->d_prev_p->d_next_p = event;
+        head->d_prev_p           = event;
+    }
+    event->d_list = list;
+}
+
+void EventScheduler_TimingWheel::moveList(int list)
+{
+    Event *head = d_lists[list];
+    if (0 == head) {
+        return;                                                       // RETURN
+    }
+
+    Event *event = head;
+    do {
+        Event *next = event->d_next_p;
+        event->d_list = -1;
+        d_moved.push_back(event);
+        event = next;
+    } while (event != head);
+
+    d_lists[list] = 0;
+}
+
+// PRIVATE ACCESSORS
+bsl::uint64_t EventScheduler_TimingWheel::tick(Int64 time) const
+{
+    if (time <= 0) {
+        return 0;                                                     // RETURN
+    }
+    return time / d_resolution + (0 != time % d_resolution);
+}
+
+// CREATORS
+EventScheduler_TimingWheel::EventScheduler_TimingWheel(
+                                            Int64             resolution,
+                                            Int64             now,
+                                            bslma::Allocator *basicAllocator)
+: d_resolution(resolution)
+, d_currentTick(now <= 0 ? 0 : now / resolution)
+, d_moved(basicAllocator)
+, d_expired(basicAllocator)
+, d_pool(sizeof(Event), basicAllocator)
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT(1 <= resolution);
+
+    bsl::fill(d_occupied, d_occupied + k_NUM_LEVELS, 0);
+    bsl::fill(d_lists, d_lists + k_NUM_LISTS, static_cast<Event *>(0));
+}
+
+EventScheduler_TimingWheel::~EventScheduler_TimingWheel()
+{
+    BSLS_ASSERT(0 == d_lists[k_EXPIRED]);
+    BSLS_ASSERT(0 == d_lists[k_OVERFLOW]);
+}
+
+// MANIPULATORS
+void EventScheduler_TimingWheel::advance(Int64 now)
+{
+    const Uint64 newTick = now <= 0 ? 0 : now / d_resolution;
+    if (newTick <= d_currentTick) {
+        return;                                                       // RETURN
+    }
+
+    // Empty the slots of each level whose range of ticks is entered by the
+    // move from the current tick to 'newTick'.  Each level has a slot per
+    // 'k_NUM_SLOTS' consecutive blocks, so entering 'k_NUM_SLOTS' blocks or
+    // more means entering every slot.
+
+    d_moved.clear();
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        const int    shift = level * k_BITS_PER_LEVEL;
+        const Uint64 first = (d_currentTick >> shift) + 1;
+        const Uint64 last  = newTick >> shift;
+
+        if (first > last) {
+            break;
+        }
+
+        Uint64 mask = ~Uint64(0);
+        if (last - first < k_NUM_SLOTS - 1) {
+            const int numSlots = static_cast<int>(last - first) + 1;
+            const int begin    = static_cast<int>(first % k_NUM_SLOTS);
+
+            mask = rotateRight((Uint64(1) << numSlots) - 1,
+                               (k_NUM_SLOTS - begin) % k_NUM_SLOTS);
+        }
+        mask &= d_occupied[level];
+        d_occupied[level] &= ~mask;
+
+        while (mask) {
+            const int slot = bdlb::BitUtil::numTrailingUnsetBits(mask);
+            mask &= mask - 1;
+            moveList(level * k_NUM_SLOTS + slot);
+        }
+    }
+
+    const int overflowShift = k_NUM_LEVELS * k_BITS_PER_LEVEL;
+    if ((d_currentTick >> overflowShift) != (newTick >> overflowShift)) {
+        moveList(k_OVERFLOW);
+    }
+
+    d_currentTick = newTick;
+
+    // Re-insert the moved events, collecting the expired ones so that they
+    // join the expired list in the order of their scheduled times.
+
+    d_expired.clear();
+    for (bsl::size_t i = 0; i < d_moved.size(); ++i) {
+        Event *event = d_moved[i];
+        if (tick(event->d_time) <= d_currentTick) {
+            d_expired.push_back(event);
+        }
+        else {
+            insert(event);
+        }
+    }
+
+    bsl::stable_sort(d_expired.begin(), d_expired.end(), &isEarlier);
+    for (bsl::size_t i = 0; i < d_expired.size(); ++i) {
+        append(k_EXPIRED, d_expired[i]);
+    }
+}
+
+EventScheduler_TimingWheel::Event *EventScheduler_TimingWheel::createEvent(
+                               Int64                         time,
+                               Int64                         interval,
+                               int                           numReferences,
+                               const bsl::function<void()>&  callback)
+{
+    return new (d_pool) Event(time,
+                              interval,
+                              numReferences,
+                              callback,
+                              &d_pool,
+                              d_allocator_p);
+}
+
+EventScheduler_TimingWheel::Event *
+EventScheduler_TimingWheel::frontExpired() const
+{
+    return d_lists[k_EXPIRED];
+}
+
+void EventScheduler_TimingWheel::insert(Event *event)
+{
+    BSLS_ASSERT(-1 == event->d_list);
+
+    const Uint64 eventTick = tick(event->d_time);
+    if (eventTick <= d_currentTick) {
+        append(k_EXPIRED, event);
+        return;                                                       // RETURN
+    }
+
+    const int level = (63 - bdlb::BitUtil::numLeadingUnsetBits(
+                                                  eventTick ^ d_currentTick))
+                    / k_BITS_PER_LEVEL;
+    if (k_NUM_LEVELS <= level) {
+        append(k_OVERFLOW, event);
+        return;                                                       // RETURN
+    }
+
+    const int slot = static_cast<int>(
+                     (eventTick >> (level * k_BITS_PER_LEVEL)) % k_NUM_SLOTS);
+
+    append(level * k_NUM_SLOTS + slot, event);
+    d_occupied[level] |= Uint64(1) << slot;
+}
+
+void EventScheduler_TimingWheel::remove(Event *event)
+{
+    const int list = event->d_list;
+    BSLS_ASSERT(0 <= list);
+
+    if (event->d_next_p == event) {
+        d_lists[list] = 0;
+        if (list < k_OVERFLOW) {
+            d_occupied[list / k_NUM_SLOTS] &=
+                                     ~(Uint64(1) << (list % k_NUM_SLOTS));
+        }
+    }
+    else {
+        event->d_prev_p->d_next_p = event->d_next_p;
+        event->d_next_p->d_prev_p = event->d_prev_p;
+        if (d_lists[list] == event) {
+            d_lists[list] = event->d_next_p;
+        }
+    }
+    event->d_list = -1;
+}
+
+void EventScheduler_TimingWheel::removeAll(bsl::vector<Event *> *events)
+{
+    d_moved.clear();
+    for (int list = 0; list < k_NUM_LISTS; ++list) {
+        moveList(list);
+    }
+    bsl::fill(d_occupied, d_occupied + k_NUM_LEVELS, 0);
+
+    events->insert(events->end(), d_moved.begin(), d_moved.end());
+    d_moved.clear();
+}
+
+// ACCESSORS
+bsls::Types::Int64 EventScheduler_TimingWheel::nextExpiryTime() const
+{
+    // The first non-empty slot after the slot of the current tick at a level
+    // is reached when the current tick enters the corresponding block of that
+    // level.
+
+    Uint64 nextTick = ~Uint64(0);
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        if (0 == d_occupied[level]) {
+            continue;
+        }
+
+        const int    shift   = level * k_BITS_PER_LEVEL;
+        const Uint64 block   = d_currentTick >> shift;
+        const int    current = static_cast<int>(block % k_NUM_SLOTS);
+        const Uint64 ahead   = rotateRight(d_occupied[level],
+                                           (current + 1) % k_NUM_SLOTS);
+        const Uint64 next    = (block
+                               + bdlb::BitUtil::numTrailingUnsetBits(ahead)
+                               + 1) << shift;
+
+        nextTick = bsl::min(nextTick, next);
+    }
+
+    if (d_lists[k_OVERFLOW]) {
+        const int overflowShift = k_NUM_LEVELS * k_BITS_PER_LEVEL;
+
+        nextTick = bsl::min(
+                      nextTick,
+                      ((d_currentTick >> overflowShift) + 1) << overflowShift);
+    }
+
+    const Int64 k_MAX = bsl::numeric_limits<Int64>::max();
+    if (nextTick > static_cast<Uint64>(k_MAX / d_resolution)) {
+        return k_MAX;                                                 // RETURN
+    }
+    return static_cast<Int64>(nextTick) * d_resolution;
+}
+
+bsls::Types::Int64 EventScheduler_TimingWheel::resolution() const
+{
+    return d_resolution;
+}
+
                            // --------------------
                            // class EventScheduler
                            // --------------------
 
+// PRIVATE CLASS METHODS
+void EventScheduler::addWheelEventReference(WheelEvent *event)
+{
+    ++event->d_refCount;
+}
+
+void EventScheduler::releaseWheelEventReference(WheelEvent *event)
+{
+    if (0 == --event->d_refCount) {
+        event->d_pool_p->deleteObject(event);
+    }
+}
+
 // PRIVATE MANIPULATORS
 bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::Types::Int64 *now)
 {
@@ -164,6 +689,11 @@ bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::Types::Int64 *now)
 
 void EventScheduler::dispatchEvents()
 {
+    if (d_wheel_p) {
+        dispatchWheelEvents();
+        return;                                                       // RETURN
+    }
+
     bsls::Types::Int64 now = d_currentTimeFunctor().totalMicroseconds();
 
     while (1) {
@@ -230,6 +760,83 @@ void EventScheduler::dispatchEvents()
 
 }
 
+void EventScheduler::dispatchWheelEvents()
+{
+    while (1) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        // Get ready for the next iteration.
+
+        if (d_currentWheelEvent) {
+            releaseWheelEventReference(d_currentWheelEvent);
+            d_currentWheelEvent = 0;
+        }
+
+        if (d_dispatcherAwaited) {
+            d_dispatcherAwaited = false;
+            d_iterationCondition.broadcast();
+        }
+
+        // Now proceed with the next iteration.
+
+        if (!d_running) {
+            return;                                                   // RETURN
+        }
+
+        bsls::Types::Int64 now = d_currentTimeFunctor().totalMicroseconds();
+
+        d_wheel_p->advance(now);
+
+        WheelEvent *event = d_wheel_p->frontExpired();
+
+        // An expired event may not yet be due if the clock was set back.
+
+        if (0 == event || now < event->d_time) {
+            d_wheelWakeTime = event ? event->d_time
+                                    : d_wheel_p->nextExpiryTime();
+            ++d_waitCount;
+            if (k_NO_DEADLINE == d_wheelWakeTime) {
+                d_queueCondition.wait(&d_mutex);
+            }
+            else {
+                bsls::TimeInterval w;
+                w.addMicroseconds(d_wheelWakeTime);
+                d_queueCondition.timedWait(&d_mutex, w);
+            }
+            d_wheelWakeTime = k_DISPATCHER_AWAKE;
+            continue;
+        }
+
+        // We have an event due for execution.  A recurring event is
+        // rescheduled before execution, and the reference of the wheel to a
+        // one-time event is transferred to 'd_currentWheelEvent'.
+
+        d_wheel_p->remove(event);
+        if (event->d_interval) {
+            event->d_time += event->d_interval;
+            d_wheel_p->insert(event);
+            addWheelEventReference(event);
+        }
+        else {
+            --d_numWheelEvents;
+        }
+        d_currentWheelEvent = event;
+
+        lock.release()->unlock();
+        d_dispatcherFunctor(event->d_callback);
+    }
+}
+
+void EventScheduler::initWheel(const bsls::TimeInterval& resolution)
+{
+    BSLS_ASSERT(1 <= resolution.totalMicroseconds());
+
+    d_wheel_p = new (*allocator()) EventScheduler_TimingWheel(
+                                  resolution.totalMicroseconds(),
+                                  d_currentTimeFunctor().totalMicroseconds(),
+                                  allocator());
+}
+
 void EventScheduler::releaseCurrentEvents()
 {
     if (d_currentRecurringEvent) {
@@ -243,6 +850,102 @@ void EventScheduler::releaseCurrentEvents()
     }
 }
 
+int EventScheduler::cancelWheelEvent(WheelEvent *event, bool wait)
+{
+    if (0 == event) {
+        return EventQueue::e_INVALID;                                 // RETURN
+    }
+
+    bool canceled = false;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+        if (-1 != event->d_list) {
+            d_wheel_p->remove(event);
+            if (event->d_interval) {
+                --d_numWheelRecurringEvents;
+            }
+            else {
+                --d_numWheelEvents;
+            }
+            canceled = true;
+        }
+
+        // Wait until the next iteration if currently executing the event.
+
+        while (wait && d_currentWheelEvent == event) {
+            d_dispatcherAwaited = true;
+            d_iterationCondition.wait(&d_mutex);
+        }
+    }
+
+    if (!canceled) {
+        return EventQueue::e_NOT_FOUND;                               // RETURN
+    }
+
+    releaseWheelEventReference(event);
+    return 0;
+}
+
+int EventScheduler::rescheduleWheelEvent(
+                                    WheelEvent                *event,
+                                    const bsls::TimeInterval&  newEpochTime,
+                                    bool                       wait)
+{
+    if (0 == event) {
+        return EventQueue::e_INVALID;                                 // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    if (-1 == event->d_list) {
+
+        // Wait until the event is dispatched if currently executing it.
+
+        while (wait && d_currentWheelEvent == event) {
+            d_dispatcherAwaited = true;
+            d_iterationCondition.wait(&d_mutex);
+        }
+        return EventQueue::e_NOT_FOUND;                               // RETURN
+    }
+
+    d_wheel_p->remove(event);
+    event->d_time = newEpochTime.totalMicroseconds();
+    d_wheel_p->insert(event);
+
+    if (event->d_time < d_wheelWakeTime) {
+        d_queueCondition.signal();
+    }
+    return 0;
+}
+
+EventScheduler::WheelEvent *EventScheduler::scheduleWheelEvent(
+                                bool                          keepReference,
+                                bsls::Types::Int64            epochTime,
+                                bsls::Types::Int64            interval,
+                                const bsl::function<void()>&  callback)
+{
+    WheelEvent *event = d_wheel_p->createEvent(epochTime,
+                                               interval,
+                                               keepReference ? 2 : 1,
+                                               callback);
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_wheel_p->insert(event);
+    if (interval) {
+        ++d_numWheelRecurringEvents;
+    }
+    else {
+        ++d_numWheelEvents;
+    }
+
+    if (epochTime < d_wheelWakeTime) {
+        d_queueCondition.signal();
+    }
+    return keepReference ? event : 0;
+}
+
 // CREATORS
 EventScheduler::EventScheduler(bslma::Allocator *basicAllocator)
 : d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
@@ -259,6 +962,11 @@ EventScheduler::EventScheduler(bslma::Allocator *basicAllocator)
 , d_currentEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
+, d_wheel_p(0)
+, d_currentWheelEvent(0)
+, d_wheelWakeTime(k_DISPATCHER_AWAKE)
+, d_numWheelEvents(0)
+, d_numWheelRecurringEvents(0)
 {
 }
 
@@ -278,6 +986,11 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
 , d_currentEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
+, d_wheel_p(0)
+, d_currentWheelEvent(0)
+, d_wheelWakeTime(k_DISPATCHER_AWAKE)
+, d_numWheelEvents(0)
+, d_numWheelRecurringEvents(0)
 {
 }
 
@@ -298,6 +1011,11 @@ EventScheduler::EventScheduler(
 , d_currentEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
+, d_wheel_p(0)
+, d_currentWheelEvent(0)
+, d_wheelWakeTime(k_DISPATCHER_AWAKE)
+, d_numWheelEvents(0)
+, d_numWheelRecurringEvents(0)
 {
 }
 
@@ -319,12 +1037,77 @@ EventScheduler::EventScheduler(
 , d_currentEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
+, d_wheel_p(0)
+, d_currentWheelEvent(0)
+, d_wheelWakeTime(k_DISPATCHER_AWAKE)
+, d_numWheelEvents(0)
+, d_numWheelRecurringEvents(0)
 {
 }
 
+EventScheduler::EventScheduler(
+                                 bsls::SystemClockType::Enum  clockType,
+                                 const bsls::TimeInterval&    wheelResolution,
+                                 bslma::Allocator            *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+, d_wheel_p(0)
+, d_currentWheelEvent(0)
+, d_wheelWakeTime(k_DISPATCHER_AWAKE)
+, d_numWheelEvents(0)
+, d_numWheelRecurringEvents(0)
+{
+    initWheel(wheelResolution);
+}
+
+EventScheduler::EventScheduler(
+                          const EventScheduler::Dispatcher&  dispatcherFunctor,
+                          bsls::SystemClockType::Enum        clockType,
+                          const bsls::TimeInterval&          wheelResolution,
+                          bslma::Allocator                  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+, d_wheel_p(0)
+, d_currentWheelEvent(0)
+, d_wheelWakeTime(k_DISPATCHER_AWAKE)
+, d_numWheelEvents(0)
+, d_numWheelRecurringEvents(0)
+{
+    initWheel(wheelResolution);
+}
+
 EventScheduler::~EventScheduler()
 {
     BSLS_ASSERT(bslmt::ThreadUtil::invalidHandle() == d_dispatcherThread);
+
+    if (d_wheel_p) {
+        cancelAllEvents();
+        allocator()->deleteObject(d_wheel_p);
+    }
 }
 
 // MANIPULATORS
@@ -393,6 +1176,17 @@ EventScheduler::scheduleEvent(EventHandle                  *event,
                               const bsls::TimeInterval&     epochTime,
                               const bsl::function<void()>&  callback)
 {
+    if (d_wheel_p) {
+        WheelEvent *wheelEvent = scheduleWheelEvent(
+                                               true,
+                                               epochTime.totalMicroseconds(),
+                                               0,
+                                               callback);
+        event->release();
+        event->d_wheelEvent_p = wheelEvent;
+        return;                                                       // RETURN
+    }
+
     bool newTop;
 
     d_eventQueue.addR(&event->d_handle,
@@ -410,6 +1204,18 @@ void EventScheduler::scheduleEventRaw(Event                        **event,
                                       const bsls::TimeInterval&      epochTime,
                                       const bsl::function<void()>&   callback)
 {
+    if (d_wheel_p) {
+        WheelEvent *wheelEvent = scheduleWheelEvent(
+                                               0 != event,
+                                               epochTime.totalMicroseconds(),
+                                               0,
+                                               callback);
+        if (event) {
+            *event = static_cast<Event *>(static_cast<void *>(wheelEvent));
+        }
+        return;                                                       // RETURN
+    }
+
     bool newTop;
 
     d_eventQueue.addRawR((EventQueue::Pair **)event,
@@ -440,6 +1246,18 @@ EventScheduler::scheduleRecurringEvent(
         stime = (d_currentTimeFunctor() + interval).totalMicroseconds();
     }
 
+    if (d_wheel_p) {
+        WheelEvent *wheelEvent = scheduleWheelEvent(
+                             true,
+                             stime,
+                             bsl::max<bsls::Types::Int64>(
+                                             1, interval.totalMicroseconds()),
+                             callback);
+        event->release();
+        event->d_wheelEvent_p = wheelEvent;
+        return;                                                       // RETURN
+    }
+
     RecurringEventData recurringEventData(callback, interval);
 
     bool newTop;
@@ -472,6 +1290,20 @@ EventScheduler::scheduleRecurringEventRaw(
         stime = (d_currentTimeFunctor() + interval).totalMicroseconds();
     }
 
+    if (d_wheel_p) {
+        WheelEvent *wheelEvent = scheduleWheelEvent(
+                             0 != event,
+                             stime,
+                             bsl::max<bsls::Types::Int64>(
+                                             1, interval.totalMicroseconds()),
+                             callback);
+        if (event) {
+            *event = static_cast<RecurringEvent *>(
+                                       static_cast<void *>(wheelEvent));
+        }
+        return;                                                       // RETURN
+    }
+
     RecurringEventData recurringEventData(callback, interval);
 
     bool newTop;
@@ -513,6 +1345,10 @@ int EventScheduler::cancelEventAndWait(const RecurringEvent *handle)
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_wheel_p) {
+        return cancelWheelEvent(toWheelEvent(handle), true);          // RETURN
+    }
+
     const RecurringEventQueue::Pair *itemPtr =
                        reinterpret_cast<const RecurringEventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
@@ -550,6 +1386,10 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_wheel_p) {
+        return cancelWheelEvent(toWheelEvent(handle), true);          // RETURN
+    }
+
     const EventQueue::Pair *itemPtr =
                              reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
@@ -602,6 +1442,12 @@ int EventScheduler::cancelEventAndWait(RecurringEventHandle *handle)
 int EventScheduler::rescheduleEvent(const Event               *handle,
                                     const bsls::TimeInterval&  newEpochTime)
 {
+    if (d_wheel_p) {
+        return rescheduleWheelEvent(toWheelEvent(handle),
+                                    newEpochTime,
+                                    false);                           // RETURN
+    }
+
     const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
 
@@ -625,6 +1471,12 @@ int EventScheduler::rescheduleEventAndWait(
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_wheel_p) {
+        return rescheduleWheelEvent(toWheelEvent(handle),
+                                    newEpochTime,
+                                    true);                            // RETURN
+    }
+
     const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
                                        reinterpret_cast<const void *>(handle));
     int ret;
@@ -664,6 +1516,21 @@ int EventScheduler::rescheduleEventAndWait(
 
 void EventScheduler::cancelAllEvents()
 {
+    if (d_wheel_p) {
+        bsl::vector<WheelEvent *> events(allocator());
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+            d_wheel_p->removeAll(&events);
+            d_numWheelEvents          = 0;
+            d_numWheelRecurringEvents = 0;
+        }
+        for (bsl::size_t i = 0; i < events.size(); ++i) {
+            releaseWheelEventReference(events[i]);
+        }
+        return;                                                       // RETURN
+    }
+
     d_eventQueue.removeAll();
     d_recurringQueue.removeAll();
 }
@@ -673,12 +1540,13 @@ void EventScheduler::cancelAllEventsAndWait()
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
-    d_eventQueue.removeAll();
-    d_recurringQueue.removeAll();
+    cancelAllEvents();
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (0 == d_currentEvent && 0 == d_currentRecurringEvent) {
+        if (0 == d_currentEvent
+         && 0 == d_currentRecurringEvent
+         && 0 == d_currentWheelEvent) {
             break;
         }
         else {
@@ -688,6 +1556,16 @@ void EventScheduler::cancelAllEventsAndWait()
     }
 }
 
+// ACCESSORS
+bsls::TimeInterval EventScheduler::wheelResolution() const
+{
+    bsls::TimeInterval resolution;
+    if (d_wheel_p) {
+        resolution.addMicroseconds(d_wheel_p->resolution());
+    }
+    return resolution;
+}
+
                     // ----------------------------------
                     // class EventSchedulerTestTimeSource
                     // ----------------------------------
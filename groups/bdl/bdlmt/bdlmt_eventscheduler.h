@@ -111,6 +111,29 @@ BSLS_IDENT("$Id: $")
 // dispatcher thread becomes available; once the backlog is worked off, events
 // will be executed at or near their scheduled times.
 //
+///Timing-Wheel Mode
+///-----------------
+// By default, a 'bdlmt::EventScheduler' keeps its events in skip lists, so
+// that scheduling, rescheduling, and cancelling an event takes time
+// logarithmic in the number of events.  When a scheduler manages a large
+// number of events that are mostly cancelled before they are due (e.g., a
+// timeout per connection, cancelled whenever data arrives), these operations
+// may dominate.  A scheduler constructed with a *timing-wheel* *resolution*
+// instead keeps its events in a hashed hierarchical timing wheel, in which
+// scheduling, rescheduling, and cancelling an event take constant time.
+//
+// The timing wheel divides time into *ticks* of the specified resolution.
+// An event is not dispatched before its scheduled time, but is dispatched no
+// sooner than the end of the tick in which its scheduled time falls; i.e., in
+// timing-wheel mode an event may be dispatched up to one resolution later
+// than in the default mode.  Events becoming due in the same dispatcher
+// iteration are dispatched in the order of their scheduled times, one-time
+// and recurring events alike, and an event scheduled at a time already passed
+// is dispatched after the events that are already due.
+//
+// The API of the scheduler, including its handles, test time source, and
+// clock-type semantics, is the same in both modes.
+//
 ///Supported Clock-Types
 ///---------------------
 // The component 'bsls::SystemClockType' supplies the enumeration indicating
@@ -409,6 +432,8 @@ namespace bdlmt {
 class EventSchedulerEventHandle;
 class EventSchedulerRecurringEventHandle;
 class EventSchedulerTestTimeSource_Data;
+class EventScheduler_TimingWheel;
+class EventScheduler_TimingWheelEvent;
 
                             // ====================
                             // class EventScheduler
@@ -433,6 +458,8 @@ class EventScheduler {
 
     typedef bsl::function<bsls::TimeInterval()>            CurrentTimeFunctor;
 
+    typedef EventScheduler_TimingWheelEvent                WheelEvent;
+
     // FRIENDS
     friend class EventSchedulerEventHandle;
     friend class EventSchedulerRecurringEventHandle;
@@ -518,6 +545,40 @@ class EventScheduler {
     bsls::SystemClockType::Enum
                           d_clockType;          // clock type used
 
+    EventScheduler_TimingWheel
+                         *d_wheel_p;            // timing wheel holding the
+                                                // events in timing-wheel mode
+                                                // (owned), and 0 otherwise
+
+    WheelEvent           *d_currentWheelEvent;  // reference to the event being
+                                                // executed in timing-wheel
+                                                // mode
+
+    bsls::Types::Int64    d_wheelWakeTime;      // time, in microseconds, until
+                                                // which the dispatcher waits
+                                                // in timing-wheel mode; the
+                                                // minimum 'Int64' if it is not
+                                                // waiting, and the maximum if
+                                                // it waits without a deadline
+
+    bsls::AtomicInt       d_numWheelEvents;     // number of one-time events in
+                                                // timing-wheel mode
+
+    bsls::AtomicInt       d_numWheelRecurringEvents;
+                                                // number of recurring events
+                                                // in timing-wheel mode
+
+    // PRIVATE CLASS METHODS
+    static void addWheelEventReference(WheelEvent *event);
+        // Increment the reference count of the specified 'event'.
+
+    static void releaseWheelEventReference(WheelEvent *event);
+        // Decrement the reference count of the specified 'event', and destroy
+        // it if the count drops to 0.
+
+    static WheelEvent *toWheelEvent(const void *handle);
+        // Return the timing-wheel event referred to by the specified 'handle'.
+
     // PRIVATE MANIPULATORS
     bsls::Types::Int64 chooseNextEvent(bsls::Types::Int64 *now);
         // Pick either 'd_currentEvent' or 'd_currentRecurringEvent' as the
@@ -540,10 +601,46 @@ class EventScheduler {
         // event queues at their scheduled times.  Note that this method
         // implements the dispatching thread.
 
+    void dispatchWheelEvents();
+        // While d_running is true, execute the events of the timing wheel at
+        // their scheduled times.  Note that this method implements the
+        // dispatching thread in timing-wheel mode.
+
+    void initWheel(const bsls::TimeInterval& resolution);
+        // Create the timing wheel used to hold the events of this scheduler,
+        // having the specified 'resolution'.  The behavior is undefined
+        // unless 'resolution' is at least one microsecond.
+
     void releaseCurrentEvents();
         // Release 'd_currentRecurringEvent' and 'd_currentEvent', if they
         // refer to valid events.
 
+    int cancelWheelEvent(WheelEvent *event, bool wait);
+        // Cancel the specified timing-wheel 'event'.  If the specified 'wait'
+        // is 'true', block until 'event' is not being dispatched.  Return 0
+        // on success, and a non-zero value if 'event' is 0 or has already
+        // been dispatched or canceled.
+
+    int rescheduleWheelEvent(WheelEvent                *event,
+                             const bsls::TimeInterval&  newEpochTime,
+                             bool                       wait);
+        // Reschedule the specified timing-wheel 'event' at the specified
+        // 'newEpochTime'.  If the specified 'wait' is 'true', block until
+        // 'event' is either rescheduled or dispatched.  Return 0 on success,
+        // and a non-zero value if 'event' is 0 or has already been
+        // dispatched.
+
+    WheelEvent *scheduleWheelEvent(bool                          keepReference,
+                                   bsls::Types::Int64            epochTime,
+                                   bsls::Types::Int64            interval,
+                                   const bsl::function<void()>&  callback);
+        // Schedule the specified 'callback' to be dispatched at the specified
+        // 'epochTime' (in microseconds) and, if the specified 'interval' (in
+        // microseconds) is positive, every 'interval' thereafter.  Return the
+        // address of the scheduled event if the specified 'keepReference' is
+        // 'true', in which case the caller must release the returned
+        // reference, and 0 otherwise.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(EventScheduler, bslma::UsesBslmaAllocator);
@@ -589,6 +686,31 @@ class EventScheduler {
         // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
         // the currently installed default allocator is used.
 
+    EventScheduler(bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    wheelResolution,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler in timing-wheel mode, having the
+        // specified 'wheelResolution' (see {Timing-Wheel Mode} in the
+        // component documentation), using the default dispatcher functor and
+        // the specified 'clockType' to indicate the epoch used for all time
+        // intervals.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // 'wheelResolution' is at least one microsecond.
+
+    EventScheduler(const Dispatcher&            dispatcherFunctor,
+                   bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    wheelResolution,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler in timing-wheel mode, having the
+        // specified 'wheelResolution' (see {Timing-Wheel Mode} in the
+        // component documentation), using the specified 'dispatcherFunctor'
+        // and the specified 'clockType' to indicate the epoch used for all
+        // time intervals.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'wheelResolution' is at least one microsecond.
+
     ~EventScheduler();
         // Discard all unprocessed events and destroy this object.  The
         // behavior is undefined unless the scheduler is stopped.
@@ -822,6 +944,11 @@ class EventScheduler {
         // Return the number of recurring events registered with this
         // scheduler.
 
+    bsls::TimeInterval wheelResolution() const;
+        // Return the resolution of the timing wheel of this scheduler if it
+        // was created in timing-wheel mode, and 0 otherwise (see
+        // {Timing-Wheel Mode} in the component documentation).
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -843,7 +970,10 @@ class EventSchedulerEventHandle
                             bsl::function<void()> > EventQueue;
 
     // DATA
-    EventQueue::PairHandle  d_handle;
+    EventQueue::PairHandle           d_handle;         // skip-list event
+
+    EventScheduler_TimingWheelEvent *d_wheelEvent_p;   // timing-wheel event
+                                                       // (counted reference)
 
     // FRIENDS
     friend class EventScheduler;
@@ -895,7 +1025,10 @@ class EventSchedulerRecurringEventHandle
                             RecurringEventData>        RecurringEventQueue;
 
     // DATA
-    RecurringEventQueue::PairHandle  d_handle;
+    RecurringEventQueue::PairHandle  d_handle;        // skip-list event
+
+    EventScheduler_TimingWheelEvent *d_wheelEvent_p;  // timing-wheel event
+                                                      // (counted reference)
 
     // FRIENDS
     friend class EventScheduler;
@@ -995,6 +1128,7 @@ class EventSchedulerTestTimeSource {
 // CREATORS
 inline
 EventSchedulerEventHandle::EventSchedulerEventHandle()
+: d_wheelEvent_p(0)
 {
 }
 
@@ -1002,12 +1136,19 @@ inline
 EventSchedulerEventHandle::EventSchedulerEventHandle(
                                      const EventSchedulerEventHandle& original)
 : d_handle(original.d_handle)
+, d_wheelEvent_p(original.d_wheelEvent_p)
 {
+    if (d_wheelEvent_p) {
+        EventScheduler::addWheelEventReference(d_wheelEvent_p);
+    }
 }
 
 inline
 EventSchedulerEventHandle::~EventSchedulerEventHandle()
 {
+    if (d_wheelEvent_p) {
+        EventScheduler::releaseWheelEventReference(d_wheelEvent_p);
+    }
 }
 
 // MANIPULATORS
@@ -1016,6 +1157,14 @@ EventSchedulerEventHandle&
 EventSchedulerEventHandle::operator=(const EventSchedulerEventHandle& rhs)
 {
     d_handle = rhs.d_handle;
+
+    if (rhs.d_wheelEvent_p) {
+        EventScheduler::addWheelEventReference(rhs.d_wheelEvent_p);
+    }
+    if (d_wheelEvent_p) {
+        EventScheduler::releaseWheelEventReference(d_wheelEvent_p);
+    }
+    d_wheelEvent_p = rhs.d_wheelEvent_p;
     return *this;
 }
 
@@ -1023,6 +1172,11 @@ inline
 void EventSchedulerEventHandle::release()
 {
     d_handle.release();
+
+    if (d_wheelEvent_p) {
+        EventScheduler::releaseWheelEventReference(d_wheelEvent_p);
+        d_wheelEvent_p = 0;
+    }
 }
 }  // close package namespace
 
@@ -1034,6 +1188,10 @@ inline
 bdlmt::EventSchedulerEventHandle::
 operator const bdlmt::EventSchedulerEventHandle::Event*() const
 {
+    if (d_wheelEvent_p) {
+        return static_cast<const Event *>(
+                                   static_cast<const void *>(d_wheelEvent_p));
+    }
     return (const Event*)((const EventQueue::Pair*)d_handle);
 }
 
@@ -1046,6 +1204,7 @@ namespace bdlmt {
 // CREATORS
 inline
 EventSchedulerRecurringEventHandle::EventSchedulerRecurringEventHandle()
+: d_wheelEvent_p(0)
 {
 }
 
@@ -1053,12 +1212,19 @@ inline
 EventSchedulerRecurringEventHandle::EventSchedulerRecurringEventHandle(
                             const EventSchedulerRecurringEventHandle& original)
 : d_handle(original.d_handle)
+, d_wheelEvent_p(original.d_wheelEvent_p)
 {
+    if (d_wheelEvent_p) {
+        EventScheduler::addWheelEventReference(d_wheelEvent_p);
+    }
 }
 
 inline
 EventSchedulerRecurringEventHandle::~EventSchedulerRecurringEventHandle()
 {
+    if (d_wheelEvent_p) {
+        EventScheduler::releaseWheelEventReference(d_wheelEvent_p);
+    }
 }
 
 // MANIPULATORS
@@ -1066,6 +1232,11 @@ inline
 void EventSchedulerRecurringEventHandle::release()
 {
     d_handle.release();
+
+    if (d_wheelEvent_p) {
+        EventScheduler::releaseWheelEventReference(d_wheelEvent_p);
+        d_wheelEvent_p = 0;
+    }
 }
 
 inline
@@ -1074,6 +1245,14 @@ EventSchedulerRecurringEventHandle::operator=(
                                  const EventSchedulerRecurringEventHandle& rhs)
 {
     d_handle = rhs.d_handle;
+
+    if (rhs.d_wheelEvent_p) {
+        EventScheduler::addWheelEventReference(rhs.d_wheelEvent_p);
+    }
+    if (d_wheelEvent_p) {
+        EventScheduler::releaseWheelEventReference(d_wheelEvent_p);
+    }
+    d_wheelEvent_p = rhs.d_wheelEvent_p;
     return *this;
 }
 }  // close package namespace
@@ -1086,6 +1265,10 @@ inline
 bdlmt::EventSchedulerRecurringEventHandle::operator
        const bdlmt::EventSchedulerRecurringEventHandle::RecurringEvent*() const
 {
+    if (d_wheelEvent_p) {
+        return static_cast<const RecurringEvent *>(
+                                   static_cast<const void *>(d_wheelEvent_p));
+    }
     return (const RecurringEvent*)((const RecurringEventQueue::Pair*)d_handle);
 }
 
@@ -1095,10 +1278,21 @@ namespace bdlmt {
                             // class EventScheduler
                             // --------------------
 
+// PRIVATE CLASS METHODS
+inline
+EventScheduler::WheelEvent *EventScheduler::toWheelEvent(const void *handle)
+{
+    return static_cast<WheelEvent *>(const_cast<void *>(handle));
+}
+
 // MANIPULATORS
 inline
 int EventScheduler::cancelEvent(const Event *handle)
 {
+    if (d_wheel_p) {
+        return cancelWheelEvent(toWheelEvent(handle), false);         // RETURN
+    }
+
     const EventQueue::Pair *itemPtr =
                         reinterpret_cast<const EventQueue::Pair*>(
                                         reinterpret_cast<const void*>(handle));
@@ -1109,6 +1303,10 @@ int EventScheduler::cancelEvent(const Event *handle)
 inline
 int EventScheduler::cancelEvent(const RecurringEvent *handle)
 {
+    if (d_wheel_p) {
+        return cancelWheelEvent(toWheelEvent(handle), false);         // RETURN
+    }
+
     const RecurringEventQueue::Pair *itemPtr =
                 reinterpret_cast<const RecurringEventQueue::Pair*>(
                                         reinterpret_cast<const void*>(handle));
@@ -1126,6 +1324,11 @@ void EventScheduler::scheduleEvent(const bsls::TimeInterval&    epochTime,
 inline
 void EventScheduler::releaseEventRaw(Event *handle)
 {
+    if (d_wheel_p) {
+        releaseWheelEventReference(toWheelEvent(handle));
+        return;                                                       // RETURN
+    }
+
     d_eventQueue.releaseReferenceRaw(reinterpret_cast<EventQueue::Pair*>(
                                              reinterpret_cast<void*>(handle)));
 }
@@ -1133,6 +1336,11 @@ void EventScheduler::releaseEventRaw(Event *handle)
 inline
 void EventScheduler::releaseEventRaw(RecurringEvent *handle)
 {
+    if (d_wheel_p) {
+        releaseWheelEventReference(toWheelEvent(handle));
+        return;                                                       // RETURN
+    }
+
     d_recurringQueue.releaseReferenceRaw(
                          reinterpret_cast<RecurringEventQueue::Pair*>(
                                              reinterpret_cast<void*>(handle)));
@@ -1152,6 +1360,11 @@ inline
 EventScheduler::Event*
 EventScheduler::addEventRefRaw(Event *handle) const
 {
+    if (d_wheel_p) {
+        addWheelEventReference(toWheelEvent(handle));
+        return handle;                                                // RETURN
+    }
+
     EventQueue::Pair *h = reinterpret_cast<EventQueue::Pair*>(
                                               reinterpret_cast<void*>(handle));
     return reinterpret_cast<Event*>(d_eventQueue.addPairReferenceRaw(h));
@@ -1161,6 +1374,11 @@ inline
 EventScheduler::RecurringEvent*
 EventScheduler::addRecurringEventRefRaw(RecurringEvent *handle) const
 {
+    if (d_wheel_p) {
+        addWheelEventReference(toWheelEvent(handle));
+        return handle;                                                // RETURN
+    }
+
     RecurringEventQueue::Pair *h =
                                reinterpret_cast<RecurringEventQueue::Pair*>(
                                               reinterpret_cast<void*>(handle));
@@ -1183,13 +1401,14 @@ bsls::TimeInterval EventScheduler::now() const
 inline
 int EventScheduler::numEvents() const
 {
-    return d_eventQueue.length();
+    return d_wheel_p ? d_numWheelEvents.load() : d_eventQueue.length();
 }
 
 inline
 int EventScheduler::numRecurringEvents() const
 {
-    return d_recurringQueue.length();
+    return d_wheel_p ? d_numWheelRecurringEvents.load()
+                     : d_recurringQueue.length();
 }
 
                                   // Aspects
@@ -24,6 +24,8 @@
 #include <bslma_testallocator.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_timedsemaphore.h>
@@ -42,6 +44,7 @@
 #include <unistd.h>
 #endif
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
 #include <bsl_cstddef.h>
@@ -52,6 +55,7 @@
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -96,6 +100,8 @@ using namespace bsl;  // automatically added by script
 //
 // [08] bdlmt::EventScheduler(dispatcher, allocator = 0);
 // [20] bdlmt::EventScheduler(disp, clockType, alloc = 0);
+// [27] bdlmt::EventScheduler(clockType, wheelResolution, alloc = 0);
+// [27] bdlmt::EventScheduler(disp, clockType, wheelResolution, alloc = 0);
 //
 // [01] ~bdlmt::EventScheduler();
 //
@@ -118,6 +124,7 @@ using namespace bsl;  // automatically added by script
 // [21] bsls::SystemClockType::Enum clockType() const;
 // [23] bsls::TimeInterval now() const;
 // [24] bslma::Allocator *allocator() const;
+// [27] bsls::TimeInterval wheelResolution() const;
 //-----------------------------------------------------------------------------
 // [01] BREATHING TEST
 // [25] DRQS 150355963: 'advanceTime' WITH UNDER A MICROSECOND
@@ -126,7 +133,8 @@ using namespace bsl;  // automatically added by script
 // [10] TESTING CONCURRENT SCHEDULING AND CANCELLING
 // [11] TESTING CONCURRENT SCHEDULING AND CANCELLING-ALL
 // [22] CLOCK REPLACEMENT BREATHING TEST
-// [27] USAGE EXAMPLE
+// [27] TESTING TIMING-WHEEL MODE
+// [28] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -942,6 +950,124 @@ void my_Server::dataAvailable(my_Server::Connection *connection,
 
 }  // close namespace EVENTSCHEDULER_TEST_CASE_USAGE
 
+// ============================================================================
+//                         CASE 27 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_27 {
+
+class Recorder {
+    // This class records the identifiers of the events it is invoked for and
+    // the times, according to a scheduler, at which it is invoked.
+
+    // DATA
+    Obj                            *d_scheduler_p;  // scheduler (held)
+    mutable bslmt::Mutex            d_mutex;        // protects the records
+    bsl::vector<int>                d_ids;          // recorded identifiers
+    bsl::vector<bsls::TimeInterval> d_times;        // recorded times
+
+  public:
+    // CREATORS
+    explicit Recorder(Obj *scheduler)
+        // Create a recorder reading the time from the specified 'scheduler'.
+    : d_scheduler_p(scheduler)
+    {
+    }
+
+    // MANIPULATORS
+    void clear()
+        // Remove all records.
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_ids.clear();
+        d_times.clear();
+    }
+
+    void record(int id)
+        // Record the specified 'id' along with the current time.
+    {
+        bsls::TimeInterval now = d_scheduler_p->now();
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        d_ids.push_back(id);
+        d_times.push_back(now);
+    }
+
+    // ACCESSORS
+    int count(int id) const
+        // Return the number of records having the specified 'id'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        return static_cast<int>(bsl::count(d_ids.begin(), d_ids.end(), id));
+    }
+
+    int id(int index) const
+        // Return the identifier of the specified 'index'th record.
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        return d_ids[index];
+    }
+
+    int size() const
+        // Return the number of records.
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        return static_cast<int>(d_ids.size());
+    }
+
+    bsls::TimeInterval time(int index) const
+        // Return the time of the specified 'index'th record.
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+        return d_times[index];
+    }
+};
+
+void alignTime(bdlmt::EventSchedulerTestTimeSource *timeSource,
+               bsls::Types::Int64                   resolution)
+    // Advance the specified 'timeSource' to the next time that is a multiple
+    // of the specified 'resolution' (in microseconds).
+{
+    const bsls::TimeInterval now  = timeSource->now();
+    const bsls::Types::Int64 tick = now.totalMicroseconds() / resolution;
+
+    bsls::TimeInterval next;
+    next.addMicroseconds((tick + 1) * resolution);
+    timeSource->advanceTime(next - now);
+}
+
+void dispatch(const bsl::function<void()>& callback)
+    // Invoke the specified 'callback'.
+{
+    callback();
+}
+
+void postSemaphore(bslmt::Semaphore *semaphore)
+    // Post the specified 'semaphore'.
+{
+    semaphore->post();
+}
+
+bsls::TimeInterval microseconds(bsls::Types::Int64 value)
+    // Return a time interval of the specified 'value' microseconds.
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(value);
+    return result;
+}
+
+bsls::TimeInterval expiryTime(const bsls::TimeInterval& time,
+                              bsls::Types::Int64        resolution)
+    // Return the time at which a timing wheel of the specified 'resolution'
+    // (in microseconds) dispatches an event scheduled at the specified
+    // 'time', assuming 'time' is a whole number of microseconds.
+{
+    bsls::Types::Int64 t = time.totalMicroseconds();
+    return microseconds((t + resolution - 1) / resolution * resolution);
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_27
+
 // ============================================================================
 //                         CASE 25 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2365,7 +2491,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLES:
         //
@@ -2425,6 +2551,419 @@ int main(int argc, char *argv[])
         ASSERT(0 < ta.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING TIMING-WHEEL MODE
+        //
+        // Concerns:
+        //: 1 'wheelResolution' returns the resolution supplied at
+        //:   construction, and 0 for a scheduler not in timing-wheel mode.
+        //:
+        //: 2 An event is not dispatched before its scheduled time, and is
+        //:   dispatched at the end of the tick in which its time falls,
+        //:   whether it is due in one tick, or is held by a higher level of
+        //:   the wheel, or is beyond the range of the wheel.
+        //:
+        //: 3 Events becoming due at the same time are dispatched in the order
+        //:   of their scheduled times, and an event scheduled in the past is
+        //:   dispatched promptly.
+        //:
+        //: 4 Events can be canceled and rescheduled by handle and by raw
+        //:   pointer, with the same return values as in the default mode, and
+        //:   'numEvents' and 'numRecurringEvents' reflect the scheduled
+        //:   events.
+        //:
+        //: 5 Recurring events are dispatched every interval until canceled.
+        //:
+        //: 6 Handles share ownership of an event through copy construction
+        //:   and assignment, and 'cancelAllEvents' cancels every event.
+        //:
+        //: 7 All memory is supplied by the scheduler's allocator and is
+        //:   released.
+        //:
+        //: 8 The scheduler dispatches events according to its clock.
+        //
+        // Plan:
+        //: 1 Create schedulers with and without a resolution and verify
+        //:   'wheelResolution'.  (C-1)
+        //:
+        //: 2 Using a test time source, schedule events at a range of distances
+        //:   and, for each, advance the time to just before and then to the
+        //:   end of the tick of the event, verifying when it is dispatched.
+        //:   (C-2)
+        //:
+        //: 3 Schedule events in decreasing order of time, advance past all of
+        //:   them at once, and verify the order of dispatch.  Then schedule an
+        //:   event in the past and verify that it is dispatched.  (C-3)
+        //:
+        //: 4 Cancel and reschedule events through each interface, verifying
+        //:   return values, the event counts, and the dispatched events.
+        //:   (C-4..6)
+        //:
+        //: 5 Use a test allocator for each scheduler and verify that no memory
+        //:   is outstanding after its destruction.  (C-7)
+        //:
+        //: 6 Schedule an event with the system clock and verify that it is
+        //:   not dispatched early.  (C-8)
+        //
+        // Testing:
+        //   EventScheduler(clockType, wheelResolution, allocator = 0);
+        //   EventScheduler(disp, clockType, wheelResolution, alloc = 0);
+        //   bsls::TimeInterval wheelResolution() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TIMING-WHEEL MODE" << endl
+                          << "=========================" << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_27;
+
+        const bsls::SystemClockType::Enum monotonic =
+                                            bsls::SystemClockType::e_MONOTONIC;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tTesting 'wheelResolution'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(bsls::TimeInterval() == X.wheelResolution());
+
+            Obj mY(monotonic, bsls::TimeInterval(0, 5000), &oa);
+            const Obj& Y = mY;
+            ASSERT(bsls::TimeInterval(0, 5000) == Y.wheelResolution());
+            ASSERT(monotonic                   == Y.clockType());
+            ASSERT(&oa                         == Y.allocator());
+            ASSERT(0                           == Y.numEvents());
+            ASSERT(0                           == Y.numRecurringEvents());
+
+            Obj mZ(&dispatch, monotonic, bsls::TimeInterval(0, 1000), &oa);
+            const Obj& Z = mZ;
+            ASSERT(bsls::TimeInterval(0, 1000) == Z.wheelResolution());
+        }
+
+        if (verbose) cout << "\tTesting time of dispatch." << endl;
+        {
+            static const bsls::Types::Int64 DATA[] = {
+                // distance of the event, in ticks
+                1, 2, 63, 64, 65, 127, 4095, 4096, 4097, 262145,
+                16777217, 1073741825, 68719476737LL, 206158430209LL
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            const bsls::Types::Int64 RES = 1000;
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(monotonic, microseconds(RES), &oa);
+                bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+                // Align the time on a microsecond, but not on a tick.
+
+                alignTime(&timeSource, RES);
+                timeSource.advanceTime(microseconds(7));
+
+                Recorder recorder(&mX);
+                mX.start();
+
+                const bsls::TimeInterval START = timeSource.now();
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const bsls::TimeInterval T =
+                                      START + microseconds(DATA[ti] * RES - 3);
+                    mX.scheduleEvent(T,
+                                     bdlf::BindUtil::bind(&Recorder::record,
+                                                          &recorder,
+                                                          ti));
+                }
+                ASSERT(NUM_DATA == mX.numEvents());
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const bsls::TimeInterval T =
+                                      START + microseconds(DATA[ti] * RES - 3);
+                    const bsls::TimeInterval E = expiryTime(T, RES);
+
+                    if (veryVerbose) { P_(ti) P_(T) P(E) }
+
+                    ASSERTV(ti, T <= E);
+                    ASSERTV(ti, E - T < microseconds(RES));
+
+                    timeSource.advanceTime(E - microseconds(1)
+                                                          - timeSource.now());
+                    ASSERTV(ti, recorder.size(), ti == recorder.size());
+
+                    timeSource.advanceTime(microseconds(1));
+                    ASSERTV(ti, recorder.size(), ti + 1 == recorder.size());
+                    if (ti < recorder.size()) {
+                        ASSERTV(ti, recorder.id(ti),   ti == recorder.id(ti));
+                        ASSERTV(ti, recorder.time(ti), E == recorder.time(ti));
+                    }
+                    ASSERTV(ti, NUM_DATA - ti - 1 == mX.numEvents());
+                }
+                mX.stop();
+            }
+            ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tTesting order of dispatch." << endl;
+        {
+            const bsls::Types::Int64 RES = 10000;
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(monotonic, microseconds(RES), &oa);
+                bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+                Recorder recorder(&mX);
+                mX.start();
+
+                const bsls::TimeInterval START = timeSource.now();
+                for (int i = 0; i < 10; ++i) {
+                    mX.scheduleEvent(START + microseconds((10 - i) * 997),
+                                     bdlf::BindUtil::bind(&Recorder::record,
+                                                          &recorder,
+                                                          i));
+                }
+                mX.scheduleRecurringEvent(
+                                 microseconds(1000000),
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      100),
+                                 START + microseconds(5 * 997 + 1));
+                ASSERT(10 == mX.numEvents());
+                ASSERT(1  == mX.numRecurringEvents());
+
+                timeSource.advanceTime(microseconds(3 * RES));
+
+                ASSERTV(recorder.size(), 11 == recorder.size());
+                if (11 == recorder.size()) {
+                    for (int i = 0; i < 5; ++i) {
+                        ASSERTV(i, recorder.id(i), 9 - i == recorder.id(i));
+                    }
+                    ASSERTV(recorder.id(5), 100 == recorder.id(5));
+                    for (int i = 6; i < 11; ++i) {
+                        ASSERTV(i, recorder.id(i), 10 - i == recorder.id(i));
+                    }
+                }
+                ASSERT(0 == mX.numEvents());
+                ASSERT(1 == mX.numRecurringEvents());
+
+                recorder.clear();
+                mX.scheduleEvent(timeSource.now() - bsls::TimeInterval(1),
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      1));
+                timeSource.advanceTime(microseconds(1));
+                ASSERTV(recorder.size(), 1 == recorder.size());
+                ASSERT(0 == mX.numEvents());
+
+                mX.cancelAllEvents();
+                ASSERT(0 == mX.numRecurringEvents());
+                mX.stop();
+            }
+            ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tTesting cancel and reschedule." << endl;
+        {
+            const bsls::Types::Int64 RES = 1000;
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(monotonic, microseconds(RES), &oa);
+                bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+
+                Recorder recorder(&mX);
+                mX.start();
+
+                alignTime(&timeSource, RES);
+
+                const bsls::TimeInterval START = timeSource.now();
+                const bsls::TimeInterval S1(1);
+                const bsls::TimeInterval S2(2);
+                const bsls::TimeInterval S3(3);
+                const bsls::TimeInterval HALF(0.5);
+
+                EventHandle h1, h2, h3;
+                mX.scheduleEvent(&h1,
+                                 START + S1,
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      1));
+                mX.scheduleEvent(&h2,
+                                 START + S1,
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      2));
+                Event *e3;
+                mX.scheduleEventRaw(&e3,
+                                    START + S1,
+                                    bdlf::BindUtil::bind(&Recorder::record,
+                                                         &recorder,
+                                                         3));
+                ASSERT(0 != static_cast<const Event *>(h1));
+                ASSERT(0 != e3);
+                ASSERT(3 == mX.numEvents());
+
+                // Copies share the event.
+
+                {
+                    EventHandle h1Copy(h1);
+                    ASSERT(static_cast<const Event *>(h1) ==
+                           static_cast<const Event *>(h1Copy));
+                    h3 = h1Copy;
+                    ASSERT(static_cast<const Event *>(h1) ==
+                           static_cast<const Event *>(h3));
+                    h3 = h2;
+                    h3 = h3;
+                    ASSERT(static_cast<const Event *>(h2) ==
+                           static_cast<const Event *>(h3));
+                }
+
+                ASSERT(0 == mX.cancelEvent(&h2));
+                ASSERT(0 == static_cast<const Event *>(h2));
+                ASSERT(0 != mX.cancelEvent(&h2));
+                ASSERT(0 != mX.cancelEvent(static_cast<const Event *>(h3)));
+                ASSERT(2 == mX.numEvents());
+
+                ASSERT(0 == mX.rescheduleEvent(h1, START + S2));
+                ASSERT(0 == mX.rescheduleEventAndWait(e3, START + S3));
+                ASSERT(0 != mX.rescheduleEvent(h3, START + S3));
+
+                timeSource.advanceTime(S1);
+                ASSERTV(recorder.size(), 0 == recorder.size());
+
+                timeSource.advanceTime(S1);
+                ASSERTV(recorder.size(), 1 == recorder.size());
+                ASSERT(1 == mX.numEvents());
+
+                ASSERT(0 != mX.cancelEvent(&h1));
+                ASSERT(0 != mX.rescheduleEvent(h3, START + S3));
+
+                Event *e3Copy = mX.addEventRefRaw(e3);
+                ASSERT(e3Copy == e3);
+                mX.releaseEventRaw(e3Copy);
+
+                ASSERT(0 == mX.cancelEventAndWait(e3));
+                ASSERT(0 != mX.cancelEventAndWait(e3));
+                mX.releaseEventRaw(e3);
+                ASSERT(0 == mX.numEvents());
+
+                timeSource.advanceTime(S1);
+                ASSERTV(recorder.size(), 1 == recorder.size());
+                if (1 == recorder.size()) {
+                    ASSERT(1              == recorder.id(0));
+                    ASSERT(START + S2 == recorder.time(0));
+                }
+
+                // Recurring events
+
+                recorder.clear();
+
+                RecurringEventHandle r1, r2;
+                RecurringEvent *r3;
+                mX.scheduleRecurringEvent(
+                                     &r1,
+                                     S1,
+                                     bdlf::BindUtil::bind(&Recorder::record,
+                                                          &recorder,
+                                                          1));
+                mX.scheduleRecurringEvent(
+                                     &r2,
+                                     S2,
+                                     bdlf::BindUtil::bind(&Recorder::record,
+                                                          &recorder,
+                                                          2),
+                                     timeSource.now() + HALF);
+                mX.scheduleRecurringEventRaw(
+                                     &r3,
+                                     HALF,
+                                     bdlf::BindUtil::bind(&Recorder::record,
+                                                          &recorder,
+                                                          3));
+                ASSERT(3 == mX.numRecurringEvents());
+
+                timeSource.advanceTime(HALF);
+                ASSERTV(recorder.count(2), 1 == recorder.count(2));
+                ASSERTV(recorder.count(3), 1 == recorder.count(3));
+
+                timeSource.advanceTime(HALF);
+                ASSERTV(recorder.count(1), 1 == recorder.count(1));
+                ASSERTV(recorder.count(3), 2 == recorder.count(3));
+
+                ASSERT(0 == mX.cancelEvent(&r2));
+                ASSERT(0 == static_cast<const RecurringEvent *>(r2));
+                ASSERT(0 != mX.cancelEvent(&r2));
+                ASSERT(2 == mX.numRecurringEvents());
+
+                timeSource.advanceTime(HALF);
+                timeSource.advanceTime(HALF);
+                ASSERTV(recorder.count(1), 2 == recorder.count(1));
+                ASSERTV(recorder.count(2), 1 == recorder.count(2));
+                ASSERTV(recorder.count(3), 4 == recorder.count(3));
+
+                ASSERT(0 == mX.cancelEventAndWait(r3));
+                mX.releaseEventRaw(r3);
+                ASSERT(1 == mX.numRecurringEvents());
+
+                timeSource.advanceTime(S1);
+                ASSERTV(recorder.count(1), 3 == recorder.count(1));
+                ASSERTV(recorder.count(3), 4 == recorder.count(3));
+                ASSERTV(recorder.size(),   8 == recorder.size());
+
+                // 'cancelAllEvents'
+
+                mX.scheduleEvent(timeSource.now() + S1,
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      4));
+                mX.scheduleEvent(&h1,
+                                 timeSource.now() + bsls::TimeInterval(100000),
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      5));
+                ASSERT(2 == mX.numEvents());
+
+                mX.cancelAllEventsAndWait();
+                ASSERT(0 == mX.numEvents());
+                ASSERT(0 == mX.numRecurringEvents());
+                ASSERT(0 != mX.cancelEvent(&r1));
+                ASSERT(0 != mX.cancelEvent(&h1));
+
+                timeSource.advanceTime(bsls::TimeInterval(200000));
+                ASSERTV(recorder.size(), 8 == recorder.size());
+
+                mX.stop();
+            }
+            ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tTesting with the system clock." << endl;
+        {
+            const bsls::Types::Int64 RES = 10000;
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(monotonic, microseconds(RES), &oa);
+
+                bslmt::Semaphore   semaphore;
+                bsls::TimeInterval dispatched;
+                mX.start();
+
+                const bsls::TimeInterval T = mX.now() + microseconds(50000);
+                mX.scheduleEvent(T, bdlf::BindUtil::bind(&postSemaphore,
+                                                         &semaphore));
+                semaphore.wait();
+                ASSERT(T <= mX.now());
+
+                mX.stop();
+            }
+            ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+        }
+
+        ASSERTV(da.numBytesInUse(), 0 == da.numBytesInUse());
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // DRQS 150475152: AFTER TEST TIME SOURCE DESTRUCTION
@@ -6105,6 +6644,86 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: SCHEDULING AND CANCELING TIMEOUTS
+        //
+        // Concerns:
+        //: 1 In timing-wheel mode, scheduling, rescheduling, and canceling an
+        //:   event is cheaper than in the default mode when many events are
+        //:   scheduled.
+        //
+        // Plan:
+        //: 1 For each mode, schedule a large number of timeouts through
+        //:   handles, reschedule each of them several times, and cancel them,
+        //:   and report the time taken by each phase.  (C-1)
+        //
+        // Testing:
+        //   BENCHMARK: SCHEDULING AND CANCELING TIMEOUTS
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << "BENCHMARK: SCHEDULING AND CANCELING TIMEOUTS" << endl
+                 << "============================================" << endl;
+        }
+
+        const int NUM_EVENTS      = argc > 2 ? bsl::atoi(argv[2]) : 200000;
+        const int NUM_RESCHEDULES = 4;
+
+        const bsls::SystemClockType::Enum monotonic =
+                                            bsls::SystemClockType::e_MONOTONIC;
+
+        bsl::vector<EventHandle> handles(NUM_EVENTS);
+
+        for (int mode = 0; mode < 2; ++mode) {
+            bsl::shared_ptr<Obj> mX = 0 == mode
+                   ? bsl::make_shared<Obj>(monotonic)
+                   : bsl::make_shared<Obj>(monotonic,
+                                           bsls::TimeInterval(0, 1000000));
+            mX->start();
+
+            const bsls::TimeInterval NOW = mX->now();
+            bsls::Stopwatch          stopwatch;
+
+            stopwatch.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX->scheduleEvent(&handles[i],
+                                  NOW + bsls::TimeInterval(30 + i % 1000, 0),
+                                  &noop);
+            }
+            stopwatch.stop();
+            const double scheduleTime = stopwatch.accumulatedWallTime();
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int j = 1; j <= NUM_RESCHEDULES; ++j) {
+                for (int i = 0; i < NUM_EVENTS; ++i) {
+                    const bsls::TimeInterval T(30 + j + i % 1000, 0);
+
+                    mX->rescheduleEvent(handles[i], NOW + T);
+                }
+            }
+            stopwatch.stop();
+            const double rescheduleTime = stopwatch.accumulatedWallTime();
+
+            stopwatch.reset();
+            stopwatch.start();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                mX->cancelEvent(&handles[i]);
+            }
+            stopwatch.stop();
+            const double cancelTime = stopwatch.accumulatedWallTime();
+
+            ASSERT(0 == mX->numEvents());
+            mX->stop();
+
+            cout << (0 == mode ? "skip list:    " : "timing wheel: ")
+                 << NUM_EVENTS << " events, schedule " << scheduleTime
+                 << "s, reschedule (x" << NUM_RESCHEDULES << ") "
+                 << rescheduleTime << "s, cancel " << cancelTime << "s"
+                 << endl;
+        }
+      } break;
       case -100: {
         // --------------------------------------------------------------------
         // The router simulation (kind of) test
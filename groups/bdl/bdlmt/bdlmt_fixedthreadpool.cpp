@@ -17,6 +17,8 @@ BSLS_IDENT_RCSID(bdlmt_fixedthreadpool_cpp,"$Id$ $CSID$")
 #include <bdlf_memfn.h>
 #include <bdlt_currenttime.h>
 
+#include <bslma_default.h>
+
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
@@ -69,7 +71,7 @@ void FixedThreadPool::processJobs()
 {
     while (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
                                         e_RUN == d_control.loadRelaxed())) {
-        Job functor;
+        QueuedJob functor(bsl::allocator_arg, d_allocator_p);
 
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
                                               d_queue.tryPopFront(&functor))) {
@@ -92,7 +94,7 @@ void FixedThreadPool::processJobs()
 void FixedThreadPool::drainQueue()
 {
     while (e_DRAIN == d_control.loadRelaxed()) {
-        Job functor;
+        QueuedJob functor(bsl::allocator_arg, d_allocator_p);
 
         const int ret = d_queue.tryPopFront(&functor);
         if (ret) {
@@ -196,6 +198,35 @@ int FixedThreadPool::startNewThread()
     return rc;
 }
 
+int FixedThreadPool::enqueueQueuedJob(bslmf::MovableRef<QueuedJob> job)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(job));
+
+    const int ret = d_queue.pushBack(bslmf::MovableRefUtil::move(job));
+
+    if (0 == ret && d_numThreadsWaiting) {
+        // Wake up waiting threads.
+
+        d_queueSemaphore.post();
+    }
+
+    return ret;
+}
+
+int FixedThreadPool::tryEnqueueQueuedJob(bslmf::MovableRef<QueuedJob> job)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(job));
+
+    const int ret = d_queue.tryPushBack(bslmf::MovableRefUtil::move(job));
+
+    if (0 == ret && d_numThreadsWaiting) {
+        // Wake up waiting threads.
+
+        d_queueSemaphore.post();
+    }
+    return ret;
+}
+
 // CREATORS
 
 FixedThreadPool::FixedThreadPool(
@@ -210,6 +241,7 @@ FixedThreadPool::FixedThreadPool(
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(threadAttributes, basicAllocator)
 , d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT_OPT(1          <= numThreads);
     BSLS_ASSERT_OPT(1          <= maxNumPendingJobs);
@@ -232,6 +264,7 @@ FixedThreadPool::FixedThreadPool(int               numThreads,
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(basicAllocator)
 , d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT_OPT(0 != d_numThreads);
 
@@ -253,58 +286,38 @@ int FixedThreadPool::enqueueJob(const Job& functor)
 {
     BSLS_ASSERT(functor);
 
-    const int ret = d_queue.pushBack(functor);
-
-    if (0 == ret && d_numThreadsWaiting) {
-        // Wake up waiting threads.
-
-        d_queueSemaphore.post();
-    }
-
-    return ret;
+    QueuedJob job(bsl::allocator_arg, d_allocator_p, functor);
+    return enqueueQueuedJob(bslmf::MovableRefUtil::move(job));
 }
 
 int FixedThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
 {
     BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
 
-    const int ret = d_queue.pushBack(bslmf::MovableRefUtil::move(functor));
-
-    if (0 == ret && d_numThreadsWaiting) {
-        // Wake up waiting threads.
-
-        d_queueSemaphore.post();
-    }
-
-    return ret;
+    QueuedJob job(bsl::allocator_arg,
+                  d_allocator_p,
+                  bslmf::MovableRefUtil::move(
+                                     bslmf::MovableRefUtil::access(functor)));
+    return enqueueQueuedJob(bslmf::MovableRefUtil::move(job));
 }
 
 int FixedThreadPool::tryEnqueueJob(const Job& functor)
 {
     BSLS_ASSERT(functor);
 
-    const int ret = d_queue.tryPushBack(functor);
-
-    if (0 == ret && d_numThreadsWaiting) {
-        // Wake up waiting threads.
-
-        d_queueSemaphore.post();
-    }
-    return ret;
+    QueuedJob job(bsl::allocator_arg, d_allocator_p, functor);
+    return tryEnqueueQueuedJob(bslmf::MovableRefUtil::move(job));
 }
 
 int FixedThreadPool::tryEnqueueJob(bslmf::MovableRef<Job> functor)
 {
     BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
 
-    const int ret = d_queue.tryPushBack(bslmf::MovableRefUtil::move(functor));
-
-    if (0 == ret && d_numThreadsWaiting) {
-        // Wake up waiting threads.
-
-        d_queueSemaphore.post();
-    }
-    return ret;
+    QueuedJob job(bsl::allocator_arg,
+                  d_allocator_p,
+                  bslmf::MovableRefUtil::move(
+                                     bslmf::MovableRefUtil::access(functor)));
+    return tryEnqueueQueuedJob(bslmf::MovableRefUtil::move(job));
 }
 
 void FixedThreadPool::drain()
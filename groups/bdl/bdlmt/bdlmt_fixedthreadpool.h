@@ -47,6 +47,9 @@ BSLS_IDENT("$Id: $")
 // functions or the passing of multiple user-defined arguments.  See the 'bdef'
 // package-level documentation for more on functors and their usage.
 //
+// Pending functor jobs are held in 'bdlmt::InplaceJob::Job' objects (see
+// 'bdlmt_inplacejob').
+//
 // Unlike a 'bdlmt::ThreadPool', an application can not tune a
 // 'bdlmt::FixedThreadPool' once it is created with a specified number of
 // threads and queue capacity, hence the name "fixed" thread pool.  An
@@ -296,8 +299,11 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlmt_inplacejob.h>
+
 #include <bdlcc_fixedqueue.h>
 
+#include <bslmf_allocatorargt.h>
 #include <bslmf_movableref.h>
 
 #include <bslmt_mutex.h>
@@ -364,8 +370,12 @@ class FixedThreadPool {
     };
 
   private:
+    // PRIVATE TYPES
+    typedef InplaceJob::Job QueuedJob;
+
     // DATA
-    Queue                   d_queue;              // underlying queue
+    bdlcc::FixedQueue<QueuedJob>
+                            d_queue;              // underlying queue
 
     bslmt::Semaphore        d_queueSemaphore;     // used to implemented
                                                   // blocking popping on the
@@ -412,6 +422,9 @@ class FixedThreadPool {
     const int               d_numThreads;         // number of configured
                                                   // processing threads.
 
+    bslma::Allocator       *d_allocator_p;        // memory allocator (held,
+                                                  // not owned)
+
 #if defined(BSLS_PLATFORM_OS_UNIX)
     sigset_t                d_blockSet;           // set of signals to be
                                                   // blocked in managed threads
@@ -444,6 +457,19 @@ class FixedThreadPool {
     void interruptWorkerThreads();
         // Awaken any waiting worker threads by signaling the queue semaphore.
 
+    int enqueueQueuedJob(bslmf::MovableRef<QueuedJob> job);
+        // Enqueue the specified 'job' to be executed by the next available
+        // thread.  Return 0 if enqueued successfully, and a non-zero value if
+        // queuing is currently disabled.  The behavior is undefined unless
+        // 'job' is not empty and uses the allocator of this thread pool.
+
+    int tryEnqueueQueuedJob(bslmf::MovableRef<QueuedJob> job);
+        // Attempt to enqueue the specified 'job' to be executed by the next
+        // available thread.  Return 0 if enqueued successfully, and a nonzero
+        // value if queuing is currently disabled or the queue is full.  The
+        // behavior is undefined unless 'job' is not empty and uses the
+        // allocator of this thread pool.
+
     // NOT IMPLEMENTED
     FixedThreadPool(const FixedThreadPool&);
     FixedThreadPool& operator=(const FixedThreadPool&);
@@ -497,6 +523,19 @@ class FixedThreadPool {
         // unless 'functor' is not "unset".  See 'bsl::function' for more
         // information on functors.
 
+    template <class FUNCTOR>
+    int enqueueJob(const FUNCTOR& functor);
+        // Enqueue the specified 'functor' to be executed by the next available
+        // thread.  Return 0 if enqueued successfully, and a non-zero value if
+        // queuing is currently disabled.  Note that this function can block if
+        // the underlying fixed queue has reached full capacity; use
+        // 'tryEnqueueJob' instead for non-blocking.  Also note that, unlike
+        // converting 'functor' to a 'Job', this function does not allocate
+        // memory to hold a 'functor' no larger than
+        // 'InplaceJob::k_INPLACE_SIZE'.  'FUNCTOR' must be copy constructible
+        // and invocable with no arguments.  The behavior is undefined unless
+        // 'functor' is not a null pointer or an empty function wrapper.
+
     int enqueueJob(FixedThreadPoolJobFunc function, void *userData);
         // Enqueue the specified 'function' to be executed by the next
         // available thread.  The specified 'userData' pointer will be passed
@@ -510,6 +549,17 @@ class FixedThreadPool {
         // nonzero value if queuing is currently disabled or the queue is full.
         // The behavior is undefined unless 'functor' is not "unset".
 
+    template <class FUNCTOR>
+    int tryEnqueueJob(const FUNCTOR& functor);
+        // Attempt to enqueue the specified 'functor' to be executed by the
+        // next available thread.  Return 0 if enqueued successfully, and a
+        // nonzero value if queuing is currently disabled or the queue is full.
+        // Note that, unlike converting 'functor' to a 'Job', this function
+        // does not allocate memory to hold a 'functor' no larger than
+        // 'InplaceJob::k_INPLACE_SIZE'.  'FUNCTOR' must be copy constructible
+        // and invocable with no arguments.  The behavior is undefined unless
+        // 'functor' is not a null pointer or an empty function wrapper.
+
     int tryEnqueueJob(FixedThreadPoolJobFunc function, void *userData);
         // Attempt to enqueue the specified 'function' to be executed by the
         // next available thread.  The specified 'userData' pointer will be
@@ -588,6 +638,14 @@ void FixedThreadPool::enable()
     d_queue.enable();
 }
 
+template <class FUNCTOR>
+inline
+int FixedThreadPool::enqueueJob(const FUNCTOR& functor)
+{
+    QueuedJob job(bsl::allocator_arg, d_allocator_p, functor);
+    return enqueueQueuedJob(bslmf::MovableRefUtil::move(job));
+}
+
 inline
 int FixedThreadPool::enqueueJob(FixedThreadPoolJobFunc  function,
                                 void                   *userData)
@@ -595,6 +653,14 @@ int FixedThreadPool::enqueueJob(FixedThreadPoolJobFunc  function,
     return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
 }
 
+template <class FUNCTOR>
+inline
+int FixedThreadPool::tryEnqueueJob(const FUNCTOR& functor)
+{
+    QueuedJob job(bsl::allocator_arg, d_allocator_p, functor);
+    return tryEnqueueQueuedJob(bslmf::MovableRefUtil::move(job));
+}
+
 inline
 int FixedThreadPool::tryEnqueueJob(FixedThreadPoolJobFunc  function,
                                    void                   *userData)
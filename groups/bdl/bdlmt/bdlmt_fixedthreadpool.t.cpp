@@ -16,9 +16,16 @@
 #include <bslma_testallocator.h>
 
 #include <bdlt_currenttime.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
 
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
 #include <bsls_types.h>
@@ -66,6 +73,8 @@ using namespace bsl;  // automatically added by script
 // [ 3] ~bdlmt::FixedThreadPool();
 // [ 3] int enqueueJob(const bsl::function<void()>& );
 // [15] int enqueueJob(bslmf::MovableRef<Job>);
+// [16] int enqueueJob(const FUNCTOR&);
+// [16] int tryEnqueueJob(const FUNCTOR&);
 // [ 3] int numThreads() const;
 // [ 4] int enqueueJob(FixedThreadPoolJobFunc, void *);
 // [ 4] void start();
@@ -582,6 +591,31 @@ void CopyCountingFunctor::operator()()
 
 }  // close namespace FIXEDTHREADPOOL_CASE_15
 
+// ============================================================================
+//                         CASE 16 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FIXEDTHREADPOOL_CASE_16 {
+
+struct CountingJob {
+    // This functor increments a counter.  It is larger than the in-place
+    // buffer of 'bsl::function', but fits in that of a job held by a pool.
+
+    bsls::AtomicInt *d_counter_p;                 // counter to increment
+    char             d_payload[64 - sizeof(bsls::AtomicInt *)];
+                                                  // unused
+
+    BSLMF_NESTED_TRAIT_DECLARATION(CountingJob, bslmf::IsBitwiseMoveable);
+
+    void operator()() const
+        // Increment the counter of this functor.
+    {
+        ++*d_counter_p;
+    }
+};
+
+}  // close namespace FIXEDTHREADPOOL_CASE_16
+
 
 // ============================================================================
 //                         CASE 11 RELATED ENTITIES
@@ -752,6 +786,80 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // case 0 is always the first case
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING ENQUEUING FUNCTORS IN PLACE
+        //
+        // Concerns:
+        //: 1 'Job' is 'bsl::function<void()>'.
+        //:
+        //: 2 Enqueuing a functor that is no larger than
+        //:   'bdlmt::InplaceJob::k_INPLACE_SIZE', without converting it to a
+        //:   'Job', allocates no memory, even if the functor is too large to
+        //:   be held in place by a 'bsl::function'.
+        //:
+        //: 3 The functors so enqueued are executed.
+        //
+        // Plan:
+        //: 1 Verify that 'Job' is 'bsl::function<void()>'.  (C-1)
+        //:
+        //: 2 Start a pool using a test allocator, then enqueue a number of
+        //:   64-byte functors, with both 'enqueueJob' and 'tryEnqueueJob'.
+        //:   Verify that neither the test allocator nor the default allocator
+        //:   allocates any memory.  (C-2)
+        //:
+        //: 3 Drain the pool and verify that every functor was executed.
+        //:   (C-3)
+        //
+        // Testing:
+        //   int enqueueJob(const FUNCTOR&);
+        //   int tryEnqueueJob(const FUNCTOR&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING ENQUEUING FUNCTORS IN PLACE\n"
+                          << "===================================" << endl;
+
+        using namespace FIXEDTHREADPOOL_CASE_16;
+
+        ASSERT((bsl::is_same<Obj::Job, bsl::function<void()> >::value));
+
+        BSLMF_ASSERT(sizeof(CountingJob) <= bdlmt::InplaceJob::k_INPLACE_SIZE);
+
+        enum { k_NUM_THREADS = 2, k_NUM_JOBS = 100 };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        Obj mX(k_NUM_THREADS, k_NUM_JOBS, &ta);
+        ASSERT(0 == mX.start());
+
+        bsls::AtomicInt counter(0);
+        CountingJob     job = { &counter, { 0 } };
+
+        const bsls::Types::Int64 NUM_BLOCKS         = ta.numBlocksTotal();
+        const bsls::Types::Int64 NUM_DEFAULT_BLOCKS =
+                                                   taDefault.numBlocksTotal();
+
+        int numEnqueued = 0;
+        for (int i = 0; i < k_NUM_JOBS; ++i) {
+            if (i % 2) {
+                ASSERTV(i, 0 == mX.enqueueJob(job));
+                ++numEnqueued;
+            }
+            else if (0 == mX.tryEnqueueJob(job)) {
+                ++numEnqueued;
+            }
+        }
+
+        ASSERTV(NUM_BLOCKS, ta.numBlocksTotal(),
+                NUM_BLOCKS == ta.numBlocksTotal());
+        ASSERTV(NUM_DEFAULT_BLOCKS, taDefault.numBlocksTotal(),
+                NUM_DEFAULT_BLOCKS == taDefault.numBlocksTotal());
+
+        mX.drain();
+        ASSERTV(numEnqueued, counter, numEnqueued == counter);
+
+        mX.stop();
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING MOVING ENQUEUEJOB
@@ -0,0 +1,125 @@
+// bdlmt_inplacejob.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLMT_INPLACEJOB
+#define INCLUDED_BDLMT_INPLACEJOB
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide the type in which thread pools hold pending jobs.
+//
+//@CLASSES:
+//  bdlmt::InplaceJob: namespace for the job type held by thread pools
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool,
+//           bdlmt_workstealingthreadpool, bslstl_inplacefunction
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlmt::InplaceJob', that
+// defines the type, 'bdlmt::InplaceJob::Job', in which the thread pools of
+// this package hold the functors submitted to them until they are executed,
+// and the size, 'bdlmt::InplaceJob::k_INPLACE_SIZE', of its in-place buffer.
+// The type is a 'bsl::inplace_function' (see 'bslstl_inplacefunction') whose
+// in-place buffer holds 12 pointers, so that a pool can hold a functor no
+// larger than that (such as a lambda capturing a few values, a
+// 'bdlf::BindUtil::bind' binder having a few bound arguments, or a
+// 'bsl::function') without allocating memory for it.
+//
+// The public job type of each thread pool remains 'bsl::function<void()>';
+// this type is used only to hold jobs inside the pools, and is not meant for
+// direct client use.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Holding a Job Without Allocating
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a thread pool is submitted a functor that binds a function to
+// several arguments, and holds it until one of its threads is available.
+//
+// First, we define the functor, which is too large to be held in place by a
+// 'bsl::function<void()>':
+//..
+//  struct SumJob {
+//      // This functor stores the sum of its arguments in the object
+//      // addressed by 'd_result_p'.
+//
+//      int   *d_result_p;
+//      double d_arguments[8];
+//
+//      BSLMF_NESTED_TRAIT_DECLARATION(SumJob, bslmf::IsBitwiseMoveable);
+//
+//      void operator()() const
+//      {
+//          double sum = 0;
+//          for (int i = 0; i < 8; ++i) {
+//              sum += d_arguments[i];
+//          }
+//          *d_result_p = static_cast<int>(sum);
+//      }
+//  };
+//..
+// Then, we wrap a 'SumJob' in a 'bdlmt::InplaceJob::Job', as a thread pool
+// does when it is submitted the functor, and observe that no memory is
+// allocated:
+//..
+//  bslma::TestAllocator ta;
+//  int                  result = 0;
+//  SumJob               sumJob = { &result, { 1, 2, 3, 4, 5, 6, 7, 8 } };
+//
+//  bdlmt::InplaceJob::Job job(bsl::allocator_arg, &ta, sumJob);
+//  assert(job.is_inplace());
+//  assert(0 == ta.numBlocksTotal());
+//..
+// Finally, we execute the job:
+//..
+//  job();
+//  assert(36 == result);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslstl_inplacefunction.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                             // =================
+                             // struct InplaceJob
+                             // =================
+
+struct InplaceJob {
+    // This 'struct' provides a namespace for the type in which the thread
+    // pools of this package hold pending jobs, and for the size of its
+    // in-place buffer.
+
+    // CONSTANTS
+    static const bsl::size_t k_INPLACE_SIZE = 12 * sizeof(void *);
+        // Size, in bytes, of the in-place buffer of 'Job'.
+
+    // TYPES
+    typedef bsl::inplace_function<void(), k_INPLACE_SIZE> Job;
+        // 'Job' is the type in which a thread pool holds a pending job.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
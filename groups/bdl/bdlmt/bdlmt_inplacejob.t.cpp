@@ -0,0 +1,355 @@
+// bdlmt_inplacejob.t.cpp                                             -*-C++-*-
+#include <bdlmt_inplacejob.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test defines a constant and a typedef.  We verify the
+// value of the constant, and that the typedef holds in place, without
+// allocating memory, the functors that the thread pools of this package are
+// commonly submitted.
+// ----------------------------------------------------------------------------
+// CONSTANTS
+// [ 2] const bsl::size_t k_INPLACE_SIZE;
+//
+// TYPES
+// [ 2] InplaceJob::Job
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::InplaceJob Obj;
+
+namespace {
+
+void addTo(int *result, int a, int b, int c, int d)
+    // Add the sum of the specified 'a', 'b', 'c', and 'd' to the object
+    // addressed by the specified 'result'.
+{
+    *result += a + b + c + d;
+}
+
+void increment(int *result)
+    // Increment the object addressed by the specified 'result'.
+{
+    ++*result;
+}
+
+template <class FUNCTOR>
+void verifyInplace(int line, const FUNCTOR& functor, int *result, int expected)
+    // Create, with a test allocator, a 'bdlmt::InplaceJob::Job' holding the
+    // specified 'functor', copy it, and invoke the copy.  Verify that both
+    // jobs hold 'functor' in place, that no memory is allocated, and that
+    // invoking the copy adds the specified 'expected' to the object addressed
+    // by the specified 'result'.  Report failures using the specified 'line'.
+{
+    bslma::TestAllocator ta("job");
+
+    bdlmt::InplaceJob::Job        mX(bsl::allocator_arg, &ta, functor);
+    const bdlmt::InplaceJob::Job& X = mX;
+
+    ASSERTV(line, X.is_inplace());
+
+    bdlmt::InplaceJob::Job mY(bsl::allocator_arg, &ta, X);
+
+    ASSERTV(line, mY.is_inplace());
+    ASSERTV(line, ta.numBlocksTotal(), 0 == ta.numBlocksTotal());
+
+    *result = 0;
+    mY();
+    ASSERTV(line, *result, expected == *result);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Holding a Job Without Allocating
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a thread pool is submitted a functor that binds a function to
+// several arguments, and holds it until one of its threads is available.
+//
+// First, we define the functor, which is too large to be held in place by a
+// 'bsl::function<void()>':
+//..
+    struct SumJob {
+        // This functor stores the sum of its arguments in the object
+        // addressed by 'd_result_p'.
+
+        int   *d_result_p;
+        double d_arguments[8];
+
+        BSLMF_NESTED_TRAIT_DECLARATION(SumJob, bslmf::IsBitwiseMoveable);
+
+        void operator()() const
+        {
+            double sum = 0;
+            for (int i = 0; i < 8; ++i) {
+                sum += d_arguments[i];
+            }
+            *d_result_p = static_cast<int>(sum);
+        }
+    };
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we wrap a 'SumJob' in a 'bdlmt::InplaceJob::Job', as a thread pool
+// does when it is submitted the functor, and observe that no memory is
+// allocated:
+//..
+    bslma::TestAllocator ta;
+    int                  result = 0;
+    SumJob               sumJob = { &result, { 1, 2, 3, 4, 5, 6, 7, 8 } };
+
+    bdlmt::InplaceJob::Job job(bsl::allocator_arg, &ta, sumJob);
+    ASSERT(job.is_inplace());
+    ASSERT(0 == ta.numBlocksTotal());
+//..
+// Finally, we execute the job:
+//..
+    job();
+    ASSERT(36 == result);
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'InplaceJob'
+        //
+        // Concerns:
+        //: 1 The in-place buffer of 'Job' holds 12 pointers.
+        //:
+        //: 2 A 'bsl::function<void()>', and binders having a few bound
+        //:   arguments, are held in place, and neither creating nor copying a
+        //:   'Job' holding them allocates memory.
+        //:
+        //: 3 A 'Job' holding a 'bsl::function<void()>' invokes it.
+        //
+        // Plan:
+        //: 1 Verify the value of 'k_INPLACE_SIZE'.  (C-1)
+        //:
+        //: 2 For each of a 'bsl::function<void()>' and two binders, create a
+        //:   'Job' holding it with a test allocator, copy it, and invoke the
+        //:   copy.  Verify that both are held in place, that no memory is
+        //:   allocated, and that the functor is invoked.  (C-2..3)
+        //
+        // Testing:
+        //   const bsl::size_t k_INPLACE_SIZE;
+        //   InplaceJob::Job
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'InplaceJob'" << endl
+                          << "====================" << endl;
+
+        ASSERTV(Obj::k_INPLACE_SIZE,
+                12 * sizeof(void *) == Obj::k_INPLACE_SIZE);
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        int result = 0;
+
+        const bsl::function<void()> FUNCTION(bsl::allocator_arg,
+                                             &da,
+                                             bdlf::BindUtil::bind(&increment,
+                                                                  &result));
+
+        verifyInplace(L_, FUNCTION, &result, 1);
+        verifyInplace(L_,
+                      bdlf::BindUtil::bind(&increment, &result),
+                      &result,
+                      1);
+        verifyInplace(L_,
+                      bdlf::BindUtil::bind(&addTo, &result, 1, 2, 3, 4),
+                      &result,
+                      10);
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a 'Job' holding a function pointer, and invoke it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        if (verbose) P(Obj::k_INPLACE_SIZE);
+
+        int result = 0;
+
+        Obj::Job mX(bdlf::BindUtil::bind(&increment, &result));
+
+        ASSERT(mX.is_inplace());
+
+        mX();
+        ASSERT(1 == result);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -16,6 +16,7 @@ BSLS_IDENT_RCSID(bdlmt_threadpool_cpp,"$Id$ $CSID$")
 #include <bsls_systemclocktype.h>
 #include <bsls_systemtime.h>
 #include <bsls_assert.h>
+#include <bsls_nullptr.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
@@ -92,16 +93,30 @@ ThreadPoolWaitNode::ThreadPoolWaitNode()
 }
 
 // PRIVATE MANIPULATORS
-void ThreadPool::doEnqueueJob(const Job& job)
+void ThreadPool::doEnqueueJob(bslmf::MovableRef<QueuedJob> job)
 {
-    d_queue.push_back(job);
+    d_queue.push_back(bslmf::MovableRefUtil::move(job));
     wakeThreadIfNeeded();
 }
 
-void ThreadPool::doEnqueueJob(bslmf::MovableRef<Job> job)
+int ThreadPool::enqueueQueuedJob(bslmf::MovableRef<QueuedJob> job)
 {
-    d_queue.push_back(bslmf::MovableRefUtil::move(job));
-    wakeThreadIfNeeded();
+    if (!bslmf::MovableRefUtil::access(job)) {
+        // Abort here if the 'job' is "unset".  This prevents a crash inside
+        // 'workerThread' (where the context of 'job' would be lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    if (!d_enabled) {
+        return -1;                                                    // RETURN
+    }
+
+    doEnqueueJob(bslmf::MovableRefUtil::move(job));
+
+    return startThreadIfNeeded();
 }
 
 void ThreadPool::wakeThreadIfNeeded()
@@ -217,7 +232,8 @@ int ThreadPool::startNewThread()
 void ThreadPool::workerThread()
 {
     ThreadPoolWaitNode waitNode;
-    Job functor;
+    QueuedJob          functor(bsl::allocator_arg,
+                               d_queue.get_allocator().mechanism());
     while (1) {
         // The functor has to be cleared when we are *not* holding the lock
         // because it might have some objects bound with non-trivial
@@ -225,7 +241,7 @@ void ThreadPool::workerThread()
 
         bool functorWasSetFlag = false;
         if (functor) {
-            functor = Job();
+            functor = bsl::nullptr_t();
             functorWasSetFlag = true;
         }
 
@@ -310,7 +326,7 @@ void ThreadPool::workerThread()
                 }
             }
 
-            functor = d_queue.front();
+            functor = bslmf::MovableRefUtil::move(d_queue.front());
             d_queue.pop_front();
 
             // Although user-enqueued functors cannot be null, 'stop()' and
@@ -393,44 +409,19 @@ void ThreadPool::drain()
 
 int ThreadPool::enqueueJob(const Job& functor)
 {
-    if (!functor) {
-        // Abort here if the 'functor' is "unset".  This prevents a crash
-        // inside 'workerThread' (where the context of 'functor' would be
-        // lost).
-
-        BSLS_ASSERT(0);
-        bsl::abort();  // abort (for when 'assert' is removed by optimization)
-    }
-
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-    if (!d_enabled) {
-        return -1;                                                    // RETURN
-    }
-
-    doEnqueueJob(functor);
-
-    return startThreadIfNeeded();
+    QueuedJob job(bsl::allocator_arg,
+                  d_queue.get_allocator().mechanism(),
+                  functor);
+    return enqueueQueuedJob(bslmf::MovableRefUtil::move(job));
 }
 
 int ThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
 {
-    if (!bslmf::MovableRefUtil::access(functor)) {
-        // Abort here if the 'functor' is "unset".  This prevents a crash
-        // inside 'workerThread' (where the context of 'functor' would be
-        // lost).
-
-        BSLS_ASSERT(0);
-        bsl::abort();  // abort (for when 'assert' is removed by optimization)
-    }
-
-    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-    if (!d_enabled) {
-        return -1;                                                    // RETURN
-    }
-
-    doEnqueueJob(bslmf::MovableRefUtil::move(functor));
-
-    return startThreadIfNeeded();
+    QueuedJob job(bsl::allocator_arg,
+                  d_queue.get_allocator().mechanism(),
+                  bslmf::MovableRefUtil::move(
+                                     bslmf::MovableRefUtil::access(functor)));
+    return enqueueQueuedJob(bslmf::MovableRefUtil::move(job));
 }
 
 void ThreadPool::shutdown()
@@ -442,7 +433,8 @@ void ThreadPool::shutdown()
         d_queue.pop_front();
     }
     for (int i = 0; i < d_threadCount; ++i) {
-        doEnqueueJob(Job());
+        QueuedJob nullJob;
+        doEnqueueJob(bslmf::MovableRefUtil::move(nullJob));
     }
     while (d_threadCount) {
         d_drainCond.wait(&d_mutex);
@@ -487,7 +479,8 @@ void ThreadPool::stop()
     d_enabled = 0;
 
     for (int i = 0; i < d_threadCount; ++i) {
-        doEnqueueJob(Job());
+        QueuedJob nullJob;
+        doEnqueueJob(bslmf::MovableRefUtil::move(nullJob));
     }
     while (d_threadCount) {
         d_drainCond.wait(&d_mutex);
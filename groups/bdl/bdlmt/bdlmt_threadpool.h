@@ -47,6 +47,9 @@ BSLS_IDENT("$Id: $")
 // or the passing of multiple user-defined arguments.  See the 'bdef' package
 // documentation for more on functors and their usage.
 //
+// Pending functor jobs are held in 'bdlmt::InplaceJob::Job' objects (see
+// 'bdlmt_inplacejob').
+//
 // An application can tune the thread pool by adjusting the minimum and maximum
 // number of threads in the pool, and the maximum amount of time that
 // dynamically created threads can idle before being destroyed.  To avoid
@@ -344,6 +347,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlmt_inplacejob.h>
+
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
@@ -357,6 +362,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_compilerfeatures.h>
 #include <bsls_platform.h>  // BSLS_PLATFORM_OS_UNIX
 
+#include <bslmf_allocatorargt.h>
 #include <bslmf_functionpointertraits.h>
 #include <bslmf_movableref.h>
 
@@ -408,8 +414,12 @@ class ThreadPool {
     typedef bsl::function<void()> Job;
 
   private:
+    // PRIVATE TYPES
+    typedef InplaceJob::Job QueuedJob;
+
     // PRIVATE DATA
-    bsl::deque<Job>      d_queue;          // queue of pending jobs
+    bsl::deque<QueuedJob>
+                         d_queue;          // queue of pending jobs
 
     mutable bslmt::Mutex d_mutex;          // mutex used to control access to
                                            // this thread pool
@@ -478,12 +488,17 @@ class ThreadPool {
     friend void* ThreadPoolEntry(void *);
 
     // PRIVATE MANIPULATORS
-    void doEnqueueJob(const Job& job);
-    void doEnqueueJob(bslmf::MovableRef<Job> job);
+    void doEnqueueJob(bslmf::MovableRef<QueuedJob> job);
         // Internal method used to push the specified 'job' onto 'd_queue' and
         // signal the next waiting thread if any.  Note that this method must
         // be called with 'd_mutex' locked.
 
+    int enqueueQueuedJob(bslmf::MovableRef<QueuedJob> job);
+        // Enqueue the specified 'job' to be executed by the next available
+        // thread.  Return 0 if enqueued successfully, and a non-zero value if
+        // queuing is currently disabled.  The behavior is undefined unless
+        // 'job' is not empty.
+
     void wakeThreadIfNeeded();
         // Signal this thread and pop the current thread from the wait list.
 
@@ -545,6 +560,17 @@ class ThreadPool {
         // 'functor' is not "unset".  See 'bsl::function' for more information
         // on functors.
 
+    template <class FUNCTOR>
+    int enqueueJob(const FUNCTOR& functor);
+        // Enqueue the specified 'functor' to be executed by the next available
+        // thread.  Return 0 if enqueued successfully, and a non-zero value if
+        // queuing is currently disabled.  Note that, unlike converting
+        // 'functor' to a 'Job', this function does not allocate memory to hold
+        // a 'functor' no larger than 'InplaceJob::k_INPLACE_SIZE'.  'FUNCTOR'
+        // must be copy constructible and invocable with no arguments.  The
+        // behavior is undefined unless 'functor' is not a null pointer or an
+        // empty function wrapper.
+
     int enqueueJob(ThreadPoolJobFunc function, void *userData);
         // Enqueue the specified 'function' to be executed by the next
         // available thread.  The specified 'userData' pointer will be passed
@@ -634,6 +660,16 @@ class ThreadPool {
 
 // MANIPULATORS
 
+template <class FUNCTOR>
+inline
+int ThreadPool::enqueueJob(const FUNCTOR& functor)
+{
+    QueuedJob job(bsl::allocator_arg,
+                  d_queue.get_allocator().mechanism(),
+                  functor);
+    return enqueueQueuedJob(bslmf::MovableRefUtil::move(job));
+}
+
 inline
 int ThreadPool::enqueueJob(ThreadPoolJobFunc function, void *userData)
 {
@@ -13,8 +13,14 @@
 
 #include <bslmt_configuration.h>
 
+#include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
 #include <bdlf_bind.h>
 
 #include <bsls_assert.h>
@@ -62,6 +68,7 @@ using namespace bsl;  // automatically added by script
 // [3 ] ~bdlmt::ThreadPool();
 // [  ] int enqueueJob(bsl::function<void()>);
 // [4 ] int enqueueJob(ThreadPoolJobFunc , void *);
+// [15] int enqueueJob(const FUNCTOR&);
 // [4 ] void start();
 // [4 ] void stop();
 // [4 ] void drain();
@@ -681,6 +688,31 @@ void CopyCountingFunctor::operator()()
 
 }  // close namespace case14
 
+// ============================================================================
+//                         CASE 15 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace case15 {
+
+struct CountingJob {
+    // This functor increments a counter.  It is larger than the in-place
+    // buffer of 'bsl::function', but fits in that of a job held by a pool.
+
+    bsls::AtomicInt *d_counter_p;                 // counter to increment
+    char             d_payload[64 - sizeof(bsls::AtomicInt *)];
+                                                  // unused
+
+    BSLMF_NESTED_TRAIT_DECLARATION(CountingJob, bslmf::IsBitwiseMoveable);
+
+    void operator()() const
+        // Increment the counter of this functor.
+    {
+        ++*d_counter_p;
+    }
+};
+
+}  // close namespace case15
+
 // ============================================================================
 //                          CASE 8 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -817,6 +849,84 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0: // 0 is always the first test case
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING ENQUEUING FUNCTORS IN PLACE
+        //
+        // Concerns:
+        //: 1 'Job' is 'bsl::function<void()>'.
+        //:
+        //: 2 Enqueuing a functor that is no larger than
+        //:   'bdlmt::InplaceJob::k_INPLACE_SIZE', without converting it to a
+        //:   'Job', does not allocate memory for the functor, even if it is
+        //:   too large to be held in place by a 'bsl::function'.
+        //:
+        //: 3 The functors so enqueued are executed.
+        //
+        // Plan:
+        //: 1 Verify that 'Job' is 'bsl::function<void()>'.  (C-1)
+        //:
+        //: 2 Start a pool using a test allocator, then enqueue a number of
+        //:   64-byte functors.  Verify that the default allocator allocates
+        //:   no memory, and that the test allocator allocates fewer blocks
+        //:   than the number of functors (the queue of the pool allocates a
+        //:   block for every few jobs).  (C-2)
+        //:
+        //: 3 Drain the pool and verify that every functor was executed.
+        //:   (C-3)
+        //
+        // Testing:
+        //   int enqueueJob(const FUNCTOR&);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "TESTING ENQUEUING FUNCTORS IN PLACE" << endl
+                 << "===================================" << endl;
+
+        using namespace case15;
+
+        ASSERT((bsl::is_same<Obj::Job, bsl::function<void()> >::value));
+
+        BSLMF_ASSERT(sizeof(CountingJob) <= bdlmt::InplaceJob::k_INPLACE_SIZE);
+
+        enum {
+            MIN_THREADS = 1,
+            MAX_THREADS = 2,
+            IDLE_TIME   = 1000,
+            NUM_JOBS    = 100
+        };
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslmt::ThreadAttributes attributes;
+        Obj                     mX(attributes,
+                                   MIN_THREADS,
+                                   MAX_THREADS,
+                                   IDLE_TIME,
+                                   &testAllocator);
+        ASSERT(0 == mX.start());
+
+        bsls::AtomicInt counter(0);
+        CountingJob     job = { &counter, { 0 } };
+
+        const bsls::Types::Int64 NUM_BLOCKS = testAllocator.numBlocksTotal();
+        const bsls::Types::Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+        for (int i = 0; i < NUM_JOBS; ++i) {
+            ASSERTV(i, 0 == mX.enqueueJob(job));
+        }
+
+        ASSERTV(NUM_BLOCKS, testAllocator.numBlocksTotal(),
+                testAllocator.numBlocksTotal() - NUM_BLOCKS < NUM_JOBS);
+        ASSERTV(NUM_DEFAULT_BLOCKS, da.numBlocksTotal(),
+                NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+
+        mX.drain();
+        ASSERTV(counter, NUM_JOBS == counter);
+
+        mX.stop();
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING MOVING ENQUEUEJOB METHOD
@@ -0,0 +1,712 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+///IMPLEMENTATION NOTES
+///--------------------
+///Deque
+///- - -
+// 'WorkStealingThreadPool_Deque' follows Chase and Lev, with the memory
+// orderings of Le et al., "Correct and Efficient Work-Stealing for Weak Memory
+// Models" (PPoPP 2013).  The owner of the deque publishes an item by storing
+// it in the array and then storing the incremented back index with release
+// semantics, so that a thief reading the back index with (at least) acquire
+// semantics observes the item.  The one race requiring a stronger ordering is
+// that between 'popBack' and 'steal' for the last item of the deque: 'popBack'
+// decrements the back index *and then* reads the front index, while 'steal'
+// reads the front index *and then* the back index, both using sequentially
+// consistent operations, so that at least one of the two threads observes
+// the other; both then contend for the item with a compare-and-swap on the
+// front index.
+//
+// When the array is full, 'pushBack' replaces it with one of twice the
+// capacity.  A thief that has read the address of the old array may still
+// read an item from it, so the old array is retained (on 'd_retired_p') until
+// the deque is destroyed.  The items of the old array are not modified after
+// it is replaced, and the compare-and-swap on the front index ensures that an
+// item read from the old array is returned by only one thread.
+//
+///Parking
+///- - - -
+// An idle thread "parks" by incrementing 'd_numParkedThreads', looking for a
+// job one last time, and (if it finds none) waiting on 'd_parkSemaphore'.  A
+// submitter, having published a job, wakes a thread by decrementing
+// 'd_numParkedThreads' if it is positive, and then posting 'd_parkSemaphore'.
+// Both sides access 'd_numParkedThreads' with sequentially consistent
+// read-modify-write operations, so either the parking thread observes the
+// job or the submitter observes the parking thread.  (A plain load of the
+// count by the submitter would not do: the job may be published by a release
+// store, which the load could be reordered before.)
+//
+// A parking thread that finds a job after incrementing 'd_numParkedThreads'
+// withdraws by decrementing the count.  If the count is already 0, a
+// submitter has claimed the thread (i.e., has decremented the count on its
+// behalf and posted, or is about to post, the semaphore), and the thread
+// consumes that post by waiting on the semaphore, which returns promptly.
+// Consequently, the number of posts never exceeds the number of waits, and
+// 'd_numParkedThreads' is the number of threads waiting (or committed to wait)
+// and not yet claimed.
+//
+///Quiescence
+/// - - - - -
+// The pool is quiescent when every thread is parked and no job is pending.
+// 'isQuiescent' first checks that no job is pending, and then that every
+// thread is parked.  A job pending when the second check succeeds must have
+// been submitted after the first check; a job submitted by a thread of the
+// pool requires that thread not be parked, and a job submitted externally
+// claims a parked thread.  In either case, some thread is not parked at the
+// second check, and so it fails.  The thread completing the count of parked
+// threads broadcasts 'd_drainCondition' if a thread is blocked in 'drain'.
+
+#include <bslmt_lockguard.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigfillset
+#endif
+
+#include <bsl_cstddef.h>
+
+namespace {
+
+enum {
+    k_INITIAL_DEQUE_CAPACITY = 256,  // default capacity of a deque
+
+    k_NUM_SPINS              = 32    // number of times an idle thread looks
+                                     // for a job before parking
+};
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+inline
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified xorshift generator 'state' and return its new
+    // value.  The behavior is undefined unless '*state' is not 0.
+{
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                    // ----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // ----------------------------------
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool_Deque::Array *
+WorkStealingThreadPool_Deque::allocateArray(bsls::Types::Int64 capacity)
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    const bsl::size_t size = sizeof(Array)
+                             + static_cast<bsl::size_t>(capacity - 1)
+                                                       * sizeof(AtomicPointer);
+
+    Array *array = static_cast<Array *>(d_allocator_p->allocate(size));
+
+    array->d_next_p = 0;
+    array->d_mask   = capacity - 1;
+    for (bsls::Types::Int64 i = 0; i < capacity; ++i) {
+        bsls::AtomicOperations::initPointer(&array->d_items[i], 0);
+    }
+    return array;
+}
+
+WorkStealingThreadPool_Deque::Array *
+WorkStealingThreadPool_Deque::grow(Array              *array,
+                                   bsls::Types::Int64  front,
+                                   bsls::Types::Int64  back)
+{
+    Array *newArray = allocateArray(2 * (array->d_mask + 1));
+
+    for (bsls::Types::Int64 i = front; i < back; ++i) {
+        void *item = bsls::AtomicOperations::getPtrRelaxed(
+                                           &array->d_items[i & array->d_mask]);
+        bsls::AtomicOperations::setPtrRelaxed(
+                                     &newArray->d_items[i & newArray->d_mask],
+                                     item);
+    }
+
+    array->d_next_p = d_retired_p;
+    d_retired_p     = array;
+
+    d_array_p.storeRelease(newArray);
+    return newArray;
+}
+
+// CREATORS
+WorkStealingThreadPool_Deque::WorkStealingThreadPool_Deque(
+                                            int               initialCapacity,
+                                            bslma::Allocator *basicAllocator)
+: d_front(0)
+, d_back(0)
+, d_array_p(0)
+, d_retired_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 <= initialCapacity);
+
+    bsls::Types::Int64 capacity = 1;
+    if (0 == initialCapacity) {
+        capacity = k_INITIAL_DEQUE_CAPACITY;
+    }
+    else {
+        while (capacity < initialCapacity) {
+            capacity *= 2;
+        }
+    }
+
+    d_array_p = allocateArray(capacity);
+}
+
+WorkStealingThreadPool_Deque::~WorkStealingThreadPool_Deque()
+{
+    d_allocator_p->deallocate(d_array_p.loadRelaxed());
+
+    while (d_retired_p) {
+        Array *next = d_retired_p->d_next_p;
+        d_allocator_p->deallocate(d_retired_p);
+        d_retired_p = next;
+    }
+}
+
+// MANIPULATORS
+void *WorkStealingThreadPool_Deque::popBack()
+{
+    const bsls::Types::Int64 back  = d_back.loadRelaxed() - 1;
+    Array                   *array = d_array_p.loadRelaxed();
+
+    d_back = back;
+
+    const bsls::Types::Int64 front = d_front;
+
+    if (front > back) {
+        // The deque is empty.
+
+        d_back.storeRelaxed(back + 1);
+        return 0;                                                     // RETURN
+    }
+
+    void *item = bsls::AtomicOperations::getPtrRelaxed(
+                                        &array->d_items[back & array->d_mask]);
+
+    if (front == back) {
+        // 'item' is the last one, for which thieves may be contending.
+
+        if (front != d_front.testAndSwap(front, front + 1)) {
+            item = 0;
+        }
+        d_back.storeRelaxed(back + 1);
+    }
+    return item;
+}
+
+void WorkStealingThreadPool_Deque::pushBack(void *item)
+{
+    BSLS_ASSERT(item);
+
+    const bsls::Types::Int64 back  = d_back.loadRelaxed();
+    const bsls::Types::Int64 front = d_front.loadAcquire();
+    Array                   *array = d_array_p.loadRelaxed();
+
+    if (back - front > array->d_mask) {
+        array = grow(array, front, back);
+    }
+
+    bsls::AtomicOperations::setPtrRelaxed(
+                                         &array->d_items[back & array->d_mask],
+                                         item);
+
+    d_back.storeRelease(back + 1);
+}
+
+void *WorkStealingThreadPool_Deque::steal()
+{
+    const bsls::Types::Int64 front = d_front;
+    const bsls::Types::Int64 back  = d_back;
+
+    if (front >= back) {
+        return 0;                                                     // RETURN
+    }
+
+    Array *array = d_array_p.loadAcquire();
+    void  *item  = bsls::AtomicOperations::getPtrAcquire(
+                                       &array->d_items[front & array->d_mask]);
+
+    if (front != d_front.testAndSwap(front, front + 1)) {
+        // Another thread removed the item first.
+
+        return 0;                                                     // RETURN
+    }
+    return item;
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+                        // ------------------------------------
+                        // struct WorkStealingThreadPool::Worker
+                        // ------------------------------------
+
+// CREATORS
+WorkStealingThreadPool::Worker::Worker(unsigned int      seed,
+                                       bslma::Allocator *basicAllocator)
+: d_deque(0, basicAllocator)
+, d_random(seed ? seed : 1)
+{
+}
+
+// PRIVATE MANIPULATORS
+WorkStealingThreadPool::QueuedJob *WorkStealingThreadPool::createJob(
+                                                bslmf::MovableRef<Job> functor)
+{
+    typedef bslmf::MovableRefUtil MoveUtil;
+
+    BSLS_ASSERT(MoveUtil::access(functor));
+
+    return new (*d_allocator_p) QueuedJob(
+                                   bsl::allocator_arg,
+                                   d_allocator_p,
+                                   MoveUtil::move(MoveUtil::access(functor)));
+}
+
+void WorkStealingThreadPool::destroyJob(QueuedJob *job)
+{
+    d_allocator_p->deleteObjectRaw(job);
+}
+
+WorkStealingThreadPool::QueuedJob *WorkStealingThreadPool::findJob(
+                                                                Worker *worker)
+{
+    QueuedJob *job = static_cast<QueuedJob *>(worker->d_deque.popBack());
+    if (job) {
+        return job;                                                   // RETURN
+    }
+
+    if (0 < d_numInjected.loadRelaxed()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_injectedMutex);
+
+        if (!d_injected.empty()) {
+            job = d_injected.front();
+            d_injected.pop_front();
+            --d_numInjected;
+            return job;                                               // RETURN
+        }
+    }
+
+    const unsigned int numWorkers = static_cast<unsigned int>(d_numThreads);
+    if (1 < numWorkers) {
+        const unsigned int start = nextRandom(&worker->d_random) % numWorkers;
+
+        for (unsigned int i = 0; i < numWorkers; ++i) {
+            Worker *victim = d_workers[(start + i) % numWorkers];
+            if (victim != worker) {
+                job = static_cast<QueuedJob *>(victim->d_deque.steal());
+                if (job) {
+                    return job;                                       // RETURN
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::initialize()
+{
+    BSLS_ASSERT_OPT(1 <= d_numThreads);
+
+    disable();
+
+    d_workers.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(
+                               static_cast<unsigned int>(i + 1) * 0x9E3779B9U,
+                               d_allocator_p));
+    }
+
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+void WorkStealingThreadPool::removeAllJobs()
+{
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        WorkStealingThreadPool_Deque& deque = d_workers[i]->d_deque;
+
+        while (void *job = deque.popBack()) {
+            destroyJob(static_cast<QueuedJob *>(job));
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_injectedMutex);
+
+    while (!d_injected.empty()) {
+        destroyJob(d_injected.front());
+        d_injected.pop_front();
+    }
+    d_numInjected = 0;
+}
+
+int WorkStealingThreadPool::submit(QueuedJob *job)
+{
+    Worker *worker = static_cast<Worker *>(
+                                  bslmt::ThreadUtil::getSpecific(d_workerKey));
+
+    if (worker) {
+        worker->d_deque.pushBack(job);
+    }
+    else {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_enabled)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            destroyJob(job);
+            return 1;                                                 // RETURN
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_injectedMutex);
+
+        d_injected.push_back(job);
+        ++d_numInjected;
+    }
+
+    wakeThread();
+    return 0;
+}
+
+WorkStealingThreadPool::QueuedJob *WorkStealingThreadPool::waitForJob(
+                                                                Worker *worker)
+{
+    QueuedJob *job = 0;
+
+    ++d_numIdleThreads;
+
+    while (!job && e_RUNNING == d_state) {
+        for (int i = 0; i < k_NUM_SPINS && e_RUNNING == d_state; ++i) {
+            bslmt::ThreadUtil::yield();
+
+            job = findJob(worker);
+            if (job) {
+                break;
+            }
+        }
+
+        if (job || e_RUNNING != d_state) {
+            break;
+        }
+
+        // Park.  See the implementation notes.
+
+        const int numParked = ++d_numParkedThreads;
+
+        job = findJob(worker);
+
+        if (job || e_RUNNING != d_state) {
+            // Withdraw, or consume the post of a submitter that claimed this
+            // thread.
+
+            for (;;) {
+                const int n = d_numParkedThreads;
+                if (0 == n) {
+                    d_parkSemaphore.wait();
+                    break;
+                }
+                if (n == d_numParkedThreads.testAndSwap(n, n - 1)) {
+                    break;
+                }
+            }
+            break;
+        }
+
+        if (d_numThreads == numParked && 0 < d_numDrainWaiters) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_drainMutex);
+            d_drainCondition.broadcast();
+        }
+
+        d_parkSemaphore.wait();
+    }
+
+    --d_numIdleThreads;
+
+    return job;
+}
+
+void WorkStealingThreadPool::wakeThread()
+{
+    // Read the count with a read-modify-write operation, ordering it after
+    // the (release) store publishing the job.  See the implementation notes.
+
+    int numParked = d_numParkedThreads.add(0);
+
+    while (0 < numParked) {
+        const int previous = d_numParkedThreads.testAndSwap(numParked,
+                                                            numParked - 1);
+        if (previous == numParked) {
+            d_parkSemaphore.post();
+            return;                                                   // RETURN
+        }
+        numParked = previous;
+    }
+}
+
+void WorkStealingThreadPool::workerThread(int index)
+{
+    Worker *worker = d_workers[index];
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, worker);
+
+    while (e_RUNNING == d_state) {
+        QueuedJob *job = findJob(worker);
+        if (!job) {
+            job = waitForJob(worker);
+            if (!job) {
+                break;
+            }
+        }
+
+        (*job)();
+        destroyJob(job);
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, 0);
+}
+
+// PRIVATE ACCESSORS
+bool WorkStealingThreadPool::isQuiescent() const
+{
+    if (0 < d_numInjected) {
+        return false;                                                 // RETURN
+    }
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        if (0 < d_workers[i]->d_deque.length()) {
+            return false;                                             // RETURN
+        }
+    }
+    return d_numThreads == d_numParkedThreads;
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                             int               numThreads,
+                                             bslma::Allocator *basicAllocator)
+: d_workers(basicAllocator)
+, d_injected(basicAllocator)
+, d_numInjected(0)
+, d_enabled(false)
+, d_state(e_STOPPED)
+, d_numIdleThreads(0)
+, d_numParkedThreads(0)
+, d_numDrainWaiters(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                            const bslmt::ThreadAttributes&  threadAttributes,
+                            int                             numThreads,
+                            bslma::Allocator               *basicAllocator)
+: d_workers(basicAllocator)
+, d_injected(basicAllocator)
+, d_numInjected(0)
+, d_enabled(false)
+, d_state(e_STOPPED)
+, d_numIdleThreads(0)
+, d_numParkedThreads(0)
+, d_numDrainWaiters(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        d_allocator_p->deleteObjectRaw(d_workers[i]);
+    }
+
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    ++d_numDrainWaiters;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_drainMutex);
+
+        while (isStarted() && !isQuiescent()) {
+            d_drainCondition.wait(&d_drainMutex);
+        }
+    }
+    --d_numDrainWaiters;
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_metaMutex);
+
+    disable();
+
+    if (isStarted()) {
+        d_state = e_STOPPED;
+        for (int i = 0; i < d_numThreads; ++i) {
+            wakeThread();
+        }
+        d_threadGroup.joinAll();
+
+        bslmt::LockGuard<bslmt::Mutex> drainGuard(&d_drainMutex);
+        d_drainCondition.broadcast();
+    }
+
+    removeAllJobs();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_metaMutex);
+
+    if (isStarted()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_state = e_RUNNING;
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = 0;
+    for (int i = 0; 0 == rc && i < d_numThreads; ++i) {
+        rc = d_threadGroup.addThread(
+                   bdlf::BindUtil::bind(&WorkStealingThreadPool::workerThread,
+                                        this,
+                                        i),
+                   d_threadAttributes);
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    if (0 != rc) {
+        d_state = e_STOPPED;
+        for (int i = 0; i < d_numThreads; ++i) {
+            wakeThread();
+        }
+        d_threadGroup.joinAll();
+        return -1;                                                    // RETURN
+    }
+
+    enable();
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_metaMutex);
+
+    disable();
+
+    if (!isStarted()) {
+        return;                                                       // RETURN
+    }
+
+    drain();
+
+    d_state = e_STOPPED;
+    for (int i = 0; i < d_numThreads; ++i) {
+        wakeThread();
+    }
+    d_threadGroup.joinAll();
+
+    bslmt::LockGuard<bslmt::Mutex> drainGuard(&d_drainMutex);
+    d_drainCondition.broadcast();
+}
+
+// ACCESSORS
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    int numPending = d_numInjected;
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        numPending += d_workers[i]->d_deque.length();
+    }
+    return numPending;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,681 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size thread pool whose threads steal jobs.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingThreadPool: fixed-size pool of work-stealing threads
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that executes user-defined functions
+// ("jobs") on a fixed number of threads.  Unlike 'bdlmt::FixedThreadPool' and
+// 'bdlmt::ThreadPool', which hold pending jobs in a single queue shared by
+// every thread, each thread of a 'bdlmt::WorkStealingThreadPool' holds its own
+// double-ended queue ("deque") of jobs.  A thread executes the jobs of its own
+// deque, most recently enqueued first, and, when its deque is empty, "steals"
+// the least recently enqueued job from the deque of another thread chosen at
+// random.  Threads therefore contend with each other only when one of them
+// runs out of work.
+//
+// This design suits workloads in which jobs create further jobs (e.g., a
+// request fanned out into many sub-requests, or a recursive divide-and-conquer
+// algorithm): a job enqueued by a job executing in the pool is pushed onto the
+// deque of the executing thread without acquiring any lock, and is typically
+// executed by that same thread while its data are still in the thread's cache,
+// unless another, idle, thread steals it first.
+//
+///Job Submission
+///--------------
+// Jobs are submitted with 'enqueueJob', which accepts either a 'bsl::function'
+// or a C-style function and a 'void *' argument.  A job submitted by a job
+// executing in the pool ("local submission") is pushed onto the deque of the
+// calling thread.  A job submitted by any other thread ("external submission")
+// is pushed onto a queue shared by all threads of the pool, which is protected
+// by a mutex; each thread checks that queue after its own deque and before
+// stealing from other threads.  Pending functor jobs are held in
+// 'bdlmt::InplaceJob::Job' objects (see 'bdlmt_inplacejob').
+//
+// Queuing can be disabled with 'disable', after which external submissions
+// fail.  Local submissions always succeed, so that the jobs executing during
+// 'stop' can complete any work they have fanned out.
+//
+// The number of pending jobs is not bounded, so 'enqueueJob' never blocks.
+//
+///Idle Threads
+///------------
+// A thread that finds no job to execute spins, repeatedly yielding the
+// processor and looking for a job, for a short while before "parking" on a
+// semaphore.  A submission wakes a parked thread only if there is one, so no
+// system call is made to submit a job while every thread is busy.
+//
+///Draining and Stopping
+///---------------------
+// 'drain' blocks until the pool is quiescent: every thread is parked and no
+// job is pending.  In particular, 'drain' waits for the jobs submitted by the
+// jobs executing when it is called.  'stop' disables queuing, drains the pool,
+// and joins its threads; 'shutdown' disables queuing, joins the threads once
+// they complete the jobs they are executing, and then discards the pending
+// jobs.  Neither 'drain', 'stop', nor 'shutdown' may be called from a job
+// executing in the pool.
+//
+///Thread Safety
+///-------------
+// 'bdlmt::WorkStealingThreadPool' is *fully thread-safe* (i.e., all
+// non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.  Note that jobs
+// are allocated and deallocated concurrently, so the allocator supplied at
+// construction must be thread-safe.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with 'bdlmt::FixedThreadPool', on Unix platforms all the threads in the
+// pool block all asynchronous signals, i.e., all signals except 'SIGBUS',
+// 'SIGFPE', 'SIGILL', 'SIGSEGV', 'SIGSYS', 'SIGABRT', 'SIGTRAP', and 'SIGIOT'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out a Recursive Computation
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we count the number of nodes of a (perfect) tree by having
+// each job count one node and enqueue a job for each child of that node.  The
+// jobs for the children are local submissions, so each lands on the deque of
+// the thread that enqueued it, from which idle threads steal.
+//
+// First, we define a function that counts a node of the specified 'depth'
+// below the root of a tree having the specified 'height', and enqueues a job
+// for each of the node's children:
+//..
+//  void countNodes(bdlmt::WorkStealingThreadPool *pool,
+//                  bsls::AtomicInt               *count,
+//                  int                            depth,
+//                  int                            height)
+//  {
+//      ++*count;
+//
+//      if (depth < height) {
+//          for (int i = 0; i < 4; ++i) {
+//              pool->enqueueJob(bdlf::BindUtil::bind(&countNodes,
+//                                                    pool,
+//                                                    count,
+//                                                    depth + 1,
+//                                                    height));
+//          }
+//      }
+//  }
+//..
+// Then, we create and start a pool of 4 threads:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4);
+//
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we enqueue a job counting the root of a tree of height 6:
+//..
+//  bsls::AtomicInt count(0);
+//
+//  rc = pool.enqueueJob(bdlf::BindUtil::bind(&countNodes,
+//                                            &pool,
+//                                            &count,
+//                                            0,
+//                                            6));
+//  assert(0 == rc);
+//..
+// Now, we wait for the pool to become quiescent.  Note that 'drain' waits not
+// only for the job enqueued above, but also for all the jobs it, directly or
+// indirectly, enqueues:
+//..
+//  pool.drain();
+//..
+// Finally, we verify that every node of the tree, '(4^7 - 1) / 3' of them, has
+// been counted, and stop the pool:
+//..
+//  assert(5461 == count);
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlmt_inplacejob.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmf_allocatorargt.h>
+#include <bslmf_movableref.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigset_t
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+                    // ==================================
+                    // class WorkStealingThreadPool_Deque
+                    // ==================================
+
+class WorkStealingThreadPool_Deque {
+    // This class is an implementation detail of 'WorkStealingThreadPool' and
+    // should not be used by clients of this component.  It provides an
+    // unbounded, lock-free, double-ended queue of non-null 'void *' items
+    // (Chase and Lev, "Dynamic Circular Work-Stealing Deque", SPAA 2005).  A
+    // single thread, the "owner" of the deque, pushes and pops items at the
+    // back of the deque; any thread can "steal" the item at the front.  The
+    // items are held in a circular array that the owner replaces with one of
+    // twice the capacity when full; replaced arrays are retained until the
+    // deque is destroyed, as a thief may still be reading them.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations::AtomicTypes::Pointer AtomicPointer;
+
+    struct Array {
+        // This 'struct' holds a circular array of items, allocated with room
+        // for 'd_mask + 1' elements of 'd_items'.
+
+        Array              *d_next_p;    // next replaced array, or 0
+        bsls::Types::Int64  d_mask;      // capacity of 'd_items' minus one
+        AtomicPointer       d_items[1];  // items (capacity 'd_mask + 1')
+    };
+
+    // DATA
+    bsls::AtomicInt64     d_front;      // index of the front item (modified
+                                        // by thieves and the owner)
+
+    bsls::AtomicInt64     d_back;       // index one past the back item
+                                        // (modified only by the owner)
+
+    bsls::AtomicPointer<Array>
+                          d_array_p;    // current array of items
+
+    Array                *d_retired_p;  // arrays replaced by 'd_array_p'
+
+    bslma::Allocator     *d_allocator_p;  // memory allocator (held, not
+                                          // owned)
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Deque(const WorkStealingThreadPool_Deque&);
+    WorkStealingThreadPool_Deque& operator=(
+                                          const WorkStealingThreadPool_Deque&);
+
+    // PRIVATE MANIPULATORS
+    Array *allocateArray(bsls::Types::Int64 capacity);
+        // Return the address of a newly allocated array having the specified
+        // 'capacity'.  The behavior is undefined unless 'capacity' is a power
+        // of two.
+
+    Array *grow(Array              *array,
+                bsls::Types::Int64  front,
+                bsls::Types::Int64  back);
+        // Replace the specified 'array' with one having twice its capacity,
+        // holding the items having indices in the range '[front .. back)', and
+        // return the address of the new array.  The behavior is undefined
+        // unless the calling thread is the owner of this deque.
+
+  public:
+    // CREATORS
+    explicit WorkStealingThreadPool_Deque(
+                                         int               initialCapacity = 0,
+                                         bslma::Allocator *basicAllocator = 0);
+        // Create an empty deque.  Optionally specify an 'initialCapacity' of
+        // the array holding the items; if 'initialCapacity' is 0 (or is not
+        // specified), an implementation-defined capacity is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 <= initialCapacity'.
+
+    ~WorkStealingThreadPool_Deque();
+        // Destroy this deque.  Note that the items held by this deque, if
+        // any, are not affected.
+
+    // MANIPULATORS
+    void *popBack();
+        // Remove the item at the back of this deque and return it, or return
+        // 0 if this deque is empty.  The behavior is undefined unless the
+        // calling thread is the owner of this deque.
+
+    void pushBack(void *item);
+        // Append the specified 'item' to the back of this deque.  The
+        // behavior is undefined unless 'item' is not 0 and the calling thread
+        // is the owner of this deque.
+
+    void *steal();
+        // Remove the item at the front of this deque and return it, or return
+        // 0 if this deque is empty or another thread concurrently removed
+        // that item.
+
+    // ACCESSORS
+    int length() const;
+        // Return a snapshot of the number of items in this deque.
+};
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a pool of a fixed number of threads, each
+    // holding a deque of jobs and stealing jobs from the deques of the other
+    // threads when its own deque is empty.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef InplaceJob::Job QueuedJob;
+
+    enum {
+        k_CACHE_LINE_SIZE = 64  // assumed size of a cache line, in bytes
+    };
+
+    enum State {
+        e_STOPPED,  // no thread is started
+        e_RUNNING   // threads execute jobs
+    };
+
+    struct Worker {
+        // This 'struct' holds the state of one thread of the pool.  It is
+        // padded so that the states of different threads do not share a
+        // cache line.
+
+        WorkStealingThreadPool_Deque  d_deque;      // jobs ('QueuedJob *')
+        unsigned int                  d_random;     // state of the generator
+                                                    // choosing victims
+        char                          d_pad[k_CACHE_LINE_SIZE];
+
+        explicit Worker(unsigned int seed, bslma::Allocator *basicAllocator);
+            // Create a 'Worker' object whose victims are chosen by a
+            // generator seeded with the specified 'seed', using the specified
+            // 'basicAllocator' to supply memory.
+    };
+
+    // DATA
+    bsl::vector<Worker *>    d_workers;          // thread states (owned)
+
+    bsl::deque<QueuedJob *>  d_injected;         // externally submitted jobs
+
+    bslmt::Mutex             d_injectedMutex;    // protects 'd_injected'
+
+    bsls::AtomicInt          d_numInjected;      // length of 'd_injected'
+
+    bsls::AtomicBool         d_enabled;          // 'true' if external
+                                                 // submissions are accepted
+
+    bsls::AtomicInt          d_state;            // 'e_RUNNING' or
+                                                 // 'e_STOPPED'
+
+    bsls::AtomicInt          d_numIdleThreads;   // threads looking for a job
+
+    bsls::AtomicInt          d_numParkedThreads; // threads parked, or about
+                                                 // to park, and not yet woken
+                                                 // (see implementation)
+
+    bslmt::Semaphore         d_parkSemaphore;    // semaphore on which idle
+                                                 // threads park
+
+    bsls::AtomicInt          d_numDrainWaiters;  // threads blocked in 'drain'
+
+    bslmt::Mutex             d_drainMutex;       // used with
+                                                 // 'd_drainCondition'
+
+    bslmt::Condition         d_drainCondition;   // signaled when the pool may
+                                                 // have become quiescent
+
+    bslmt::Mutex             d_metaMutex;        // serializes 'start', 'stop',
+                                                 // and 'shutdown'
+
+    bslmt::ThreadUtil::Key   d_workerKey;        // key of the thread-specific
+                                                 // 'Worker' of the calling
+                                                 // thread
+
+    bslmt::ThreadGroup       d_threadGroup;      // threads of this pool
+
+    bslmt::ThreadAttributes  d_threadAttributes; // attributes of the threads
+
+    const int                d_numThreads;       // number of threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                 d_blockSet;         // signals blocked in the
+                                                 // threads of this pool
+#endif
+
+    bslma::Allocator        *d_allocator_p;      // memory allocator (held,
+                                                 // not owned)
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+    // PRIVATE MANIPULATORS
+    template <class FUNCTOR>
+    QueuedJob *createJob(const FUNCTOR& functor);
+    QueuedJob *createJob(bslmf::MovableRef<Job> functor);
+        // Return the address of a newly created job holding a copy of the
+        // specified 'functor'.
+
+    void destroyJob(QueuedJob *job);
+        // Destroy the specified 'job', created by 'createJob'.
+
+    QueuedJob *findJob(Worker *worker);
+        // Return the address of a pending job removed from the deque of the
+        // specified 'worker', from the queue of externally submitted jobs, or
+        // from the deque of another thread, in that order of preference, or 0
+        // if no pending job was found.
+
+    void initialize();
+        // Initialize the thread states of this pool.  Note that this method
+        // is called by each constructor.
+
+    void removeAllJobs();
+        // Destroy all pending jobs.  The behavior is undefined unless no
+        // thread of this pool is started.
+
+    int submit(QueuedJob *job);
+        // Submit the specified 'job' for execution.  Return 0 on success, and
+        // a non-zero value (destroying 'job') if 'job' is submitted
+        // externally and queuing is disabled.
+
+    QueuedJob *waitForJob(Worker *worker);
+        // Spin, and then park, until a job is found for the specified
+        // 'worker'; return the address of the job, or 0 if this pool is
+        // stopped first.
+
+    void wakeThread();
+        // Wake a parked thread, if any.
+
+    void workerThread(int index);
+        // Execute jobs, as the thread whose state is held by
+        // 'd_workers[index]' for the specified 'index', until this pool is
+        // stopped.
+
+    // PRIVATE ACCESSORS
+    bool isQuiescent() const;
+        // Return 'true' if every thread of this pool is parked and no job is
+        // pending, and 'false' otherwise.
+
+  public:
+    // CREATORS
+    explicit WorkStealingThreadPool(int               numThreads,
+                                    bslma::Allocator *basicAllocator = 0);
+    WorkStealingThreadPool(
+                          const bslmt::ThreadAttributes&  threadAttributes,
+                          int                             numThreads,
+                          bslma::Allocator               *basicAllocator = 0);
+        // Create a thread pool having the specified 'numThreads' threads.
+        // Optionally specify 'threadAttributes' used to create the threads.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The threads are not started, and queuing is disabled, until
+        // 'start' is called.  The behavior is undefined unless
+        // '1 <= numThreads'.
+
+    ~WorkStealingThreadPool();
+        // Shut down this thread pool (see 'shutdown'), and destroy it.
+
+    // MANIPULATORS
+    void disable();
+        // Disable queuing of jobs submitted by threads other than those of
+        // this pool.  Note that this method has no effect on the pending jobs
+        // or on jobs submitted by jobs executing in this pool.
+
+    void enable();
+        // Enable queuing of jobs submitted by threads other than those of
+        // this pool.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' for execution by a thread of this
+        // pool.  If the calling thread is a thread of this pool, 'functor' is
+        // pushed onto the deque of that thread; otherwise it is enqueued on
+        // the queue of externally submitted jobs.  Return 0 on success, and a
+        // non-zero value if the calling thread is not a thread of this pool
+        // and queuing is disabled.  The behavior is undefined unless
+        // 'functor' is not empty.
+
+    template <class FUNCTOR>
+    int enqueueJob(const FUNCTOR& functor);
+        // Enqueue the specified 'functor' for execution by a thread of this
+        // pool.  If the calling thread is a thread of this pool, 'functor' is
+        // pushed onto the deque of that thread; otherwise it is enqueued on
+        // the queue of externally submitted jobs.  Return 0 on success, and a
+        // non-zero value if the calling thread is not a thread of this pool
+        // and queuing is disabled.  Note that, unlike converting 'functor' to
+        // a 'Job', this function does not allocate memory to hold a 'functor'
+        // no larger than 'InplaceJob::k_INPLACE_SIZE' separately from its
+        // job.  'FUNCTOR' must be copy constructible and invocable with no
+        // arguments.  The behavior is undefined unless 'functor' is not a
+        // null pointer or an empty function wrapper.
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' for execution, with the specified
+        // 'userData' as its argument, by a thread of this pool.  Return 0 on
+        // success, and a non-zero value if the calling thread is not a thread
+        // of this pool and queuing is disabled.  The behavior is undefined
+        // unless 'function' is not 0.
+
+    void drain();
+        // Block until every thread of this pool is idle and no job is
+        // pending, or return immediately if the threads of this pool are not
+        // started.  Note that jobs submitted concurrently by threads other
+        // than those of this pool may or may not be executed before this
+        // method returns.  The behavior is undefined if this method is called
+        // by a job executing in this pool.
+
+    void shutdown();
+        // Disable queuing, wait for the threads of this pool to complete the
+        // jobs they are executing, join the threads, and then destroy all
+        // pending jobs without executing them.  This method has no effect if
+        // the threads are not started.  The behavior is undefined if this
+        // method is called by a job executing in this pool.
+
+    int start();
+        // Start the threads of this pool and enable queuing.  Return 0 on
+        // success, and a non-zero value (with no threads started) otherwise.
+        // This method has no effect, and returns 0, if the threads are
+        // already started.
+
+    void stop();
+        // Disable queuing, wait until every thread of this pool is idle and
+        // no job is pending (see 'drain'), and then join the threads.  This
+        // method has no effect if the threads are not started.  The behavior
+        // is undefined if this method is called by a job executing in this
+        // pool.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if queuing of jobs submitted by threads other than
+        // those of this pool is enabled, and 'false' otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if the threads of this pool are started, and 'false'
+        // otherwise.
+
+    bool isWorkerThread() const;
+        // Return 'true' if the calling thread is a thread of this pool, and
+        // 'false' otherwise.
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of threads of this pool that are
+        // executing a job.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs enqueued in this pool but
+        // not yet started.
+
+    int numThreads() const;
+        // Return the number of threads of this pool.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of threads of this pool that are
+        // started.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                    // ----------------------------------
+                    // class WorkStealingThreadPool_Deque
+                    // ----------------------------------
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool_Deque::length() const
+{
+    const bsls::Types::Int64 front  = d_front.loadAcquire();
+    const bsls::Types::Int64 length = d_back.loadAcquire() - front;
+
+    return length > 0 ? static_cast<int>(length) : 0;
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+template <class FUNCTOR>
+inline
+WorkStealingThreadPool::QueuedJob *WorkStealingThreadPool::createJob(
+                                                        const FUNCTOR& functor)
+{
+    QueuedJob *job = new (*d_allocator_p) QueuedJob(bsl::allocator_arg,
+                                                    d_allocator_p,
+                                                    functor);
+    BSLS_ASSERT(*job);
+
+    return job;
+}
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_enabled = false;
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    d_enabled = true;
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    return submit(createJob(functor));
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    return submit(createJob(bslmf::MovableRefUtil::move(functor)));
+}
+
+template <class FUNCTOR>
+inline
+int WorkStealingThreadPool::enqueueJob(const FUNCTOR& functor)
+{
+    return submit(createJob(functor));
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return d_enabled;
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return e_RUNNING == d_state.loadRelaxed();
+}
+
+inline
+bool WorkStealingThreadPool::isWorkerThread() const
+{
+    return 0 != bslmt::ThreadUtil::getSpecific(d_workerKey);
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    const int numActive = d_threadGroup.numThreads()
+                                             - d_numIdleThreads.loadRelaxed();
+    return numActive > 0 ? numActive : 0;
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1285 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              OVERVIEW
+// A work-stealing thread pool holds a lock-free deque of jobs per thread, and
+// a mutex-protected queue of jobs submitted from outside the pool.  We first
+// test the component-private deque, single-threaded and then with concurrent
+// thieves, verifying that every item is removed exactly once.  We then test
+// the pool: job submission from outside and inside the pool, 'drain' waiting
+// for jobs enqueued by jobs, the 'start'/'stop'/'shutdown' life cycle, and the
+// parking and waking of idle threads.
+//
+// In addition to positive test cases (run in the nightly builds), a negative
+// test case -1 can be run manually to compare the performance of this pool
+// with that of 'bdlmt::FixedThreadPool'.
+// ----------------------------------------------------------------------------
+// WorkStealingThreadPool_Deque
+// [ 2] WorkStealingThreadPool_Deque(int, bslma::Allocator *);
+// [ 2] ~WorkStealingThreadPool_Deque();
+// [ 2] void *popBack();
+// [ 2] void pushBack(void *);
+// [ 2] void *steal();
+// [ 2] int length() const;
+//
+// WorkStealingThreadPool
+// [ 4] WorkStealingThreadPool(int, bslma::Allocator *);
+// [ 4] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 6] ~WorkStealingThreadPool();
+// [ 4] void disable();
+// [ 4] void enable();
+// [ 4] int enqueueJob(const Job&);
+// [ 4] int enqueueJob(bslmf::MovableRef<Job>);
+// [ 4] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 5] void drain();
+// [ 6] void shutdown();
+// [ 4] int start();
+// [ 6] void stop();
+// [ 4] bool isEnabled() const;
+// [ 4] bool isStarted() const;
+// [ 4] bool isWorkerThread() const;
+// [ 7] int numActiveThreads() const;
+// [ 6] int numPendingJobs() const;
+// [ 4] int numThreads() const;
+// [ 4] int numThreadsStarted() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCURRENT STEALING
+// [ 5] JOBS ENQUEUING JOBS
+// [ 7] PARKING AND WAKING IDLE THREADS
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: FAN-OUT AND FLAT SUBMISSION
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool       Obj;
+typedef bdlmt::WorkStealingThreadPool_Deque Deque;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void *toItem(bsls::Types::IntPtr value)
+    // Return the specified 'value' as a (non-null) deque item.
+{
+    return reinterpret_cast<void *>(value);
+}
+
+bsls::Types::IntPtr fromItem(void *item)
+    // Return the value of the specified deque 'item'.
+{
+    return reinterpret_cast<bsls::Types::IntPtr>(item);
+}
+
+void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+extern "C" void incrementCallback(void *counter)
+    // Increment the 'bsls::AtomicInt' at the specified 'counter' address.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void waitOn(bslmt::Semaphore *start, bslmt::Semaphore *stop)
+    // Post the specified 'start' semaphore, and then wait on the specified
+    // 'stop' semaphore.
+{
+    start->post();
+    stop->wait();
+}
+
+void fanOut(Obj             *pool,
+            bsls::AtomicInt *count,
+            int              depth,
+            int              height,
+            int              fanOutDegree)
+    // Increment the specified 'count' and, unless the specified 'depth' is
+    // equal to the specified 'height', enqueue on the specified 'pool' the
+    // specified 'fanOutDegree' jobs calling this function for 'depth + 1'.
+{
+    ++*count;
+
+    if (depth < height) {
+        for (int i = 0; i < fanOutDegree; ++i) {
+            int rc = pool->enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                           pool,
+                                                           count,
+                                                           depth + 1,
+                                                           height,
+                                                           fanOutDegree));
+            ASSERTV(rc, 0 == rc);
+        }
+    }
+}
+
+int numTreeNodes(int height, int fanOutDegree)
+    // Return the number of nodes of a perfect tree of the specified 'height'
+    // in which every inner node has the specified 'fanOutDegree' children.
+{
+    int numNodes = 0;
+    int numLevelNodes = 1;
+    for (int depth = 0; depth <= height; ++depth) {
+        numNodes      += numLevelNodes;
+        numLevelNodes *= fanOutDegree;
+    }
+    return numNodes;
+}
+
+void checkIsWorkerThread(Obj *pool, bsls::AtomicInt *numChecked)
+    // Verify that the calling thread is a thread of the specified 'pool', and
+    // increment the specified 'numChecked'.
+{
+    ASSERT(pool->isWorkerThread());
+    ++*numChecked;
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void checkSignalMask(bsls::AtomicInt *numChecked)
+    // Verify that the calling thread blocks the asynchronous signal 'SIGINT'
+    // but not the synchronous signal 'SIGSEGV', and increment the specified
+    // 'numChecked'.
+{
+    sigset_t blockedSet;
+    sigemptyset(&blockedSet);
+    pthread_sigmask(SIG_BLOCK, NULL, &blockedSet);
+
+    ASSERT(0 == sigismember(&blockedSet, SIGSEGV));
+    ASSERT(1 == sigismember(&blockedSet, SIGINT));
+
+    ++*numChecked;
+}
+#endif
+
+                       // ==========================
+                       // struct ConcurrentDequeTest
+                       // ==========================
+
+struct ConcurrentDequeTest {
+    // This 'struct' holds the state shared by the owner and the thieves of
+    // a deque in test case 3.
+
+    Deque             d_deque;
+    bsls::AtomicInt  *d_numRemoved;  // removals per item value (owned)
+    bsls::AtomicBool  d_done;
+    bsls::AtomicInt   d_numStolen;
+    bslmt::Barrier    d_barrier;
+
+    ConcurrentDequeTest(int numItems, int numThreads)
+    : d_deque(2)  // force the deque to grow while thieves steal
+    , d_numRemoved(new bsls::AtomicInt[numItems])
+    , d_done(false)
+    , d_numStolen(0)
+    , d_barrier(numThreads)
+    {
+    }
+
+    ~ConcurrentDequeTest()
+    {
+        delete [] d_numRemoved;
+    }
+};
+
+void thief(ConcurrentDequeTest *test)
+    // Steal items from the deque of the specified 'test', counting each
+    // removal, until the owner is done.
+{
+    test->d_barrier.wait();
+
+    for (;;) {
+        const bool done = test->d_done;
+
+        void *item = test->d_deque.steal();
+        if (item) {
+            ++test->d_numRemoved[fromItem(item) - 1];
+            ++test->d_numStolen;
+        }
+        else if (done && 0 == test->d_deque.length()) {
+            break;
+        }
+    }
+}
+
+void owner(ConcurrentDequeTest *test, int numItems)
+    // Push the specified 'numItems' items onto the deque of the specified
+    // 'test', popping some of them back in between, count each removal, and
+    // signal when done.
+{
+    test->d_barrier.wait();
+
+    for (int i = 1; i <= numItems; ++i) {
+        test->d_deque.pushBack(toItem(i));
+
+        if (0 == i % 3) {
+            void *item = test->d_deque.popBack();
+            if (item) {
+                ++test->d_numRemoved[fromItem(item) - 1];
+            }
+        }
+    }
+
+    // Race the thieves for the remaining items.
+
+    while (void *item = test->d_deque.popBack()) {
+        ++test->d_numRemoved[fromItem(item) - 1];
+    }
+
+    test->d_done = true;
+}
+
+volatile int busyWorkSink;
+
+void busyWork(int numIterations)
+    // Perform the specified 'numIterations' iterations of a loop that cannot
+    // be optimized away.
+{
+    int value = 0;
+    for (int i = 0; i < numIterations; ++i) {
+        value = value * 31 + i;
+    }
+    busyWorkSink = value;
+}
+
+void fanOutFixed(bdlmt::FixedThreadPool *pool,
+                 bsls::AtomicInt        *count,
+                 int                     depth,
+                 int                     height,
+                 int                     fanOutDegree,
+                 int                     work)
+    // Perform the specified 'work' iterations of busy work, increment the
+    // specified 'count' and, unless the specified 'depth' is equal to the
+    // specified 'height', enqueue on the specified 'pool' the specified
+    // 'fanOutDegree' jobs calling this function for 'depth + 1'.
+{
+    busyWork(work);
+    ++*count;
+
+    if (depth < height) {
+        for (int i = 0; i < fanOutDegree; ++i) {
+            pool->enqueueJob(bdlf::BindUtil::bind(&fanOutFixed,
+                                                  pool,
+                                                  count,
+                                                  depth + 1,
+                                                  height,
+                                                  fanOutDegree,
+                                                  work));
+        }
+    }
+}
+
+void fanOutStealing(Obj             *pool,
+                    bsls::AtomicInt *count,
+                    int              depth,
+                    int              height,
+                    int              fanOutDegree,
+                    int              work)
+    // Perform the specified 'work' iterations of busy work, increment the
+    // specified 'count' and, unless the specified 'depth' is equal to the
+    // specified 'height', enqueue on the specified 'pool' the specified
+    // 'fanOutDegree' jobs calling this function for 'depth + 1'.
+{
+    busyWork(work);
+    ++*count;
+
+    if (depth < height) {
+        for (int i = 0; i < fanOutDegree; ++i) {
+            pool->enqueueJob(bdlf::BindUtil::bind(&fanOutStealing,
+                                                  pool,
+                                                  count,
+                                                  depth + 1,
+                                                  height,
+                                                  fanOutDegree,
+                                                  work));
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Fanning Out a Recursive Computation
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we count the number of nodes of a (perfect) tree by having
+// each job count one node and enqueue a job for each child of that node.  The
+// jobs for the children are local submissions, so each lands on the deque of
+// the thread that enqueued it, from which idle threads steal.
+//
+// First, we define a function that counts a node of the specified 'depth'
+// below the root of a tree having the specified 'height', and enqueues a job
+// for each of the node's children:
+//..
+    void countNodes(bdlmt::WorkStealingThreadPool *pool,
+                    bsls::AtomicInt               *count,
+                    int                            depth,
+                    int                            height)
+    {
+        ++*count;
+
+        if (depth < height) {
+            for (int i = 0; i < 4; ++i) {
+                pool->enqueueJob(bdlf::BindUtil::bind(&countNodes,
+                                                      pool,
+                                                      count,
+                                                      depth + 1,
+                                                      height));
+            }
+        }
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE_1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // case 0 is always the first case
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE_1;
+
+// Then, we create and start a pool of 4 threads:
+//..
+    bdlmt::WorkStealingThreadPool pool(4);
+
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we enqueue a job counting the root of a tree of height 6:
+//..
+    bsls::AtomicInt count(0);
+
+    rc = pool.enqueueJob(bdlf::BindUtil::bind(&countNodes,
+                                              &pool,
+                                              &count,
+                                              0,
+                                              6));
+    ASSERT(0 == rc);
+//..
+// Now, we wait for the pool to become quiescent.  Note that 'drain' waits not
+// only for the job enqueued above, but also for all the jobs it, directly or
+// indirectly, enqueues:
+//..
+    pool.drain();
+//..
+// Finally, we verify that every node of the tree, '(4^7 - 1) / 3' of them, has
+// been counted, and stop the pool:
+//..
+    ASSERT(5461 == count);
+
+    pool.stop();
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // PARKING AND WAKING IDLE THREADS
+        //
+        // Concerns:
+        //: 1 Threads finding no job eventually park, after which
+        //:   'numActiveThreads' is 0.
+        //:
+        //: 2 A job submitted while every thread is parked is executed
+        //:   promptly, whether submitted from outside or inside the pool.
+        //:
+        //: 3 'drain' returns when the pool is quiescent, repeatedly.
+        //
+        // Plan:
+        //: 1 Start a pool and wait until 'numActiveThreads' is 0.  (C-1)
+        //:
+        //: 2 Repeatedly, sleep long enough for every thread to park, enqueue
+        //:   a job, and wait on a semaphore that the job posts, with a
+        //:   timeout.  Alternate between a job submitted from outside the
+        //:   pool and one enqueuing another job.  (C-2)
+        //:
+        //: 3 Call 'drain' after each round.  (C-3)
+        //
+        // Testing:
+        //   int numActiveThreads() const;
+        //   PARKING AND WAKING IDLE THREADS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARKING AND WAKING IDLE THREADS" << endl
+                          << "===============================" << endl;
+
+        const int NUM_THREADS = 4;
+        const int NUM_ROUNDS  = 20;
+
+        Obj mX(NUM_THREADS, &ta);
+        ASSERT(0 == mX.start());
+
+        for (int i = 0; i < 1000 && 0 != mX.numActiveThreads(); ++i) {
+            bslmt::ThreadUtil::microSleep(1000);
+        }
+        ASSERTV(mX.numActiveThreads(), 0 == mX.numActiveThreads());
+
+        bsls::AtomicInt count(0);
+        for (int round = 0; round < NUM_ROUNDS; ++round) {
+            bslmt::ThreadUtil::microSleep(5000);
+
+            if (round % 2) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                               &mX,
+                                                               &count,
+                                                               0,
+                                                               1,
+                                                               1)));
+            }
+            else {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                               &count)));
+            }
+
+            const int expected = round / 2 * 3 + (round % 2 ? 3 : 1);
+
+            for (int i = 0; i < 2000 && expected != count; ++i) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            ASSERTV(round, expected, count, expected == count);
+
+            mX.drain();
+            ASSERTV(round, mX.numPendingJobs(), 0 == mX.numPendingJobs());
+        }
+
+        mX.stop();
+        ASSERT(0 == mX.numThreadsStarted());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'stop', 'shutdown', AND RESTARTING
+        //
+        // Concerns:
+        //: 1 'stop' executes every pending job before joining the threads.
+        //:
+        //: 2 'shutdown' joins the threads once the executing jobs complete,
+        //:   and destroys the pending jobs without executing them.
+        //:
+        //: 3 Both disable queuing, and a pool can be restarted after either.
+        //:
+        //: 4 The destructor shuts down a started pool, and all memory is
+        //:   released.
+        //:
+        //: 5 'numPendingJobs' counts the jobs not yet started.
+        //
+        // Plan:
+        //: 1 Block every thread of a pool in a job waiting on a semaphore,
+        //:   enqueue further jobs from outside the pool, and check
+        //:   'numPendingJobs'.  Release the blocked jobs and call 'stop';
+        //:   verify that every job was executed.  (C-1, 3, 5)
+        //:
+        //: 2 Restart the pool, and repeat, calling 'shutdown' from another
+        //:   thread while the jobs are blocked; verify that no further job was
+        //:   executed.  (C-2, 3)
+        //:
+        //: 3 Destroy a started pool having pending jobs, and verify that the
+        //:   test allocator has no outstanding allocation.  (C-4)
+        //
+        // Testing:
+        //   ~WorkStealingThreadPool();
+        //   void shutdown();
+        //   void stop();
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'stop', 'shutdown', AND RESTARTING" << endl
+                          << "==================================" << endl;
+
+        const int NUM_THREADS = 3;
+        const int NUM_JOBS    = 50;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(NUM_THREADS, &oa);
+
+            bslmt::Semaphore started;
+            bslmt::Semaphore release;
+            bsls::AtomicInt  count(0);
+
+            if (veryVerbose) cout << "\tTesting 'stop'." << endl;
+
+            ASSERT(0 == mX.start());
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOn,
+                                                               &started,
+                                                               &release)));
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                started.wait();
+            }
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                               &count)));
+            }
+            ASSERTV(mX.numPendingJobs(), NUM_JOBS == mX.numPendingJobs());
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                release.post();
+            }
+            mX.stop();
+
+            ASSERTV(count, NUM_JOBS == count);
+            ASSERT(!mX.isStarted());
+            ASSERT(!mX.isEnabled());
+            ASSERT(0 == mX.numThreadsStarted());
+            ASSERT(0 == mX.numPendingJobs());
+            ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                           &count)));
+
+            if (veryVerbose) cout << "\tTesting 'shutdown'." << endl;
+
+            count = 0;
+            ASSERT(0 == mX.start());
+            ASSERT(mX.isEnabled());
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOn,
+                                                               &started,
+                                                               &release)));
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                started.wait();
+            }
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                               &count)));
+            }
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                   &handle,
+                                   bdlf::BindUtil::bind(&Obj::shutdown, &mX)));
+
+            for (int i = 0; i < 1000 && mX.isEnabled(); ++i) {
+                bslmt::ThreadUtil::microSleep(1000);
+            }
+            ASSERT(!mX.isEnabled());
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                release.post();
+            }
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(count, 0 == count);
+            ASSERT(!mX.isStarted());
+            ASSERT(0 == mX.numPendingJobs());
+
+            if (veryVerbose) cout << "\tTesting the destructor." << endl;
+
+            ASSERT(0 == mX.start());
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&waitOn,
+                                                               &started,
+                                                               &release)));
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                started.wait();
+            }
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                               &count)));
+            }
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                release.post();
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // JOBS ENQUEUING JOBS
+        //
+        // Concerns:
+        //: 1 Jobs enqueued by jobs are executed exactly once.
+        //:
+        //: 2 'drain' waits for the jobs enqueued, directly or indirectly, by
+        //:   the jobs executing or pending when it is called.
+        //:
+        //: 3 Jobs executing in the pool can enqueue jobs while queuing is
+        //:   disabled, and 'stop' executes them.
+        //:
+        //: 4 A pool having a single thread works.
+        //
+        // Plan:
+        //: 1 For pools of 1 to 6 threads, enqueue a job fanning out into a
+        //:   tree of jobs, call 'drain', and verify the number of jobs
+        //:   executed.  (C-1, 2, 4)
+        //:
+        //: 2 Enqueue a job fanning out into a tree of jobs, disable queuing,
+        //:   call 'stop', and verify the number of jobs executed.  (C-3)
+        //
+        // Testing:
+        //   void drain();
+        //   JOBS ENQUEUING JOBS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "JOBS ENQUEUING JOBS" << endl
+                          << "===================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_height;
+            int d_fanOutDegree;
+        } DATA[] = {
+            //LINE  HEIGHT  DEGREE
+            //----  ------  ------
+            { L_,        0,      1 },
+            { L_,        5,      1 },
+            { L_,        3,      5 },
+            { L_,        6,      4 },
+            { L_,       12,      2 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int numThreads = 1; numThreads <= 6; ++numThreads) {
+            Obj mX(numThreads, &ta);
+            ASSERT(0 == mX.start());
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int HEIGHT = DATA[ti].d_height;
+                const int DEGREE = DATA[ti].d_fanOutDegree;
+
+                const int EXPECTED = numTreeNodes(HEIGHT, DEGREE);
+
+                if (veryVerbose) { T_ P_(numThreads) P_(LINE) P(EXPECTED) }
+
+                bsls::AtomicInt count(0);
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                               &mX,
+                                                               &count,
+                                                               0,
+                                                               HEIGHT,
+                                                               DEGREE)));
+                mX.drain();
+
+                ASSERTV(numThreads, LINE, EXPECTED, count, EXPECTED == count);
+                ASSERTV(numThreads, LINE, 0 == mX.numPendingJobs());
+            }
+
+            bsls::AtomicInt count(0);
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                           &mX,
+                                                           &count,
+                                                           0,
+                                                           6,
+                                                           4)));
+            mX.disable();
+            mX.stop();
+
+            ASSERTV(numThreads, count, numTreeNodes(6, 4) == count);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // JOB SUBMISSION AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A pool is created stopped, with queuing disabled, and having the
+        //:   specified number of threads.
+        //:
+        //: 2 'start' starts the threads and enables queuing; calling it again
+        //:   has no effect.
+        //:
+        //: 3 Each 'enqueueJob' overload submits a job that is executed, and
+        //:   fails while queuing is disabled.
+        //:
+        //: 4 'isWorkerThread' is 'true' only in the threads of the pool.
+        //:
+        //: 5 The threads of the pool block asynchronous signals.
+        //:
+        //: 6 Memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Create pools with each constructor and check the accessors.
+        //:   (C-1)
+        //:
+        //: 2 Start a pool twice and check the accessors.  (C-2)
+        //:
+        //: 3 Submit jobs with each overload of 'enqueueJob', while queuing is
+        //:   enabled and while it is disabled, and verify the number executed
+        //:   after 'drain'.  (C-3)
+        //:
+        //: 4 Submit jobs checking 'isWorkerThread' and the signal mask.
+        //:   (C-4, 5)
+        //:
+        //: 5 Check the allocators' use.  (C-6)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int, bslma::Allocator *);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+        //   void disable();
+        //   void enable();
+        //   int enqueueJob(const Job&);
+        //   int enqueueJob(bslmf::MovableRef<Job>);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   int start();
+        //   bool isEnabled() const;
+        //   bool isStarted() const;
+        //   bool isWorkerThread() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "JOB SUBMISSION AND BASIC ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        for (int ci = 0; ci < 2; ++ci) {
+            const int NUM_THREADS = 2 + ci;
+
+            bslmt::ThreadAttributes attributes;
+            attributes.setStackSize(256 * 1024);
+
+            Obj *objPtr = 0 == ci
+                          ? new (oa) Obj(NUM_THREADS, &oa)
+                          : new (oa) Obj(attributes, NUM_THREADS, &oa);
+            Obj&       mX = *objPtr;
+            const Obj& X  = mX;
+
+            ASSERT(NUM_THREADS == X.numThreads());
+            ASSERT(0           == X.numThreadsStarted());
+            ASSERT(!X.isStarted());
+            ASSERT(!X.isEnabled());
+            ASSERT(!X.isWorkerThread());
+            ASSERT(0           == X.numPendingJobs());
+
+            bsls::AtomicInt count(0);
+
+            ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                           &count)));
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.start());
+
+            ASSERT(NUM_THREADS == X.numThreadsStarted());
+            ASSERT(X.isStarted());
+            ASSERT(X.isEnabled());
+            ASSERT(!X.isWorkerThread());
+
+            const Obj::Job job(bdlf::BindUtil::bind(&increment, &count));
+
+            ASSERT(0 == mX.enqueueJob(job));
+            {
+                Obj::Job movedJob(job);
+                ASSERT(0 == mX.enqueueJob(
+                                       bslmf::MovableRefUtil::move(movedJob)));
+            }
+            ASSERT(0 == mX.enqueueJob(&incrementCallback, &count));
+
+            mX.drain();
+            ASSERTV(ci, count, 3 == count);
+
+            mX.disable();
+            ASSERT(!X.isEnabled());
+
+            ASSERT(0 != mX.enqueueJob(job));
+            {
+                Obj::Job movedJob(job);
+                ASSERT(0 != mX.enqueueJob(
+                                       bslmf::MovableRefUtil::move(movedJob)));
+            }
+            ASSERT(0 != mX.enqueueJob(&incrementCallback, &count));
+
+            mX.enable();
+            ASSERT(X.isEnabled());
+
+            bsls::AtomicInt numChecked(0);
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                          &checkIsWorkerThread,
+                                                          &mX,
+                                                          &numChecked)));
+#if defined(BSLS_PLATFORM_OS_UNIX)
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                              &checkSignalMask,
+                                                              &numChecked)));
+#else
+                ++numChecked;
+#endif
+            }
+
+            mX.drain();
+            ASSERTV(ci, count, 3 == count);
+            ASSERTV(ci, numChecked, 20 == numChecked);
+
+            oa.deleteObject(objPtr);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENT STEALING
+        //
+        // Concerns:
+        //: 1 With thieves stealing concurrently with the owner pushing and
+        //:   popping, including while the deque grows, every item is removed
+        //:   exactly once.
+        //
+        // Plan:
+        //: 1 Have an owner thread push a sequence of distinct items onto a
+        //:   deque of small initial capacity, popping some of them back in
+        //:   between, while several thief threads steal.  Count the removals
+        //:   of each item and verify that each is 1.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT STEALING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT STEALING" << endl
+                          << "===================" << endl;
+
+        const int NUM_THIEVES = 3;
+        const int NUM_ITEMS   = 200 * 1000;
+        const int NUM_ROUNDS  = 5;
+
+        for (int round = 0; round < NUM_ROUNDS; ++round) {
+            ConcurrentDequeTest test(NUM_ITEMS, NUM_THIEVES + 1);
+
+            bslmt::ThreadUtil::Handle handles[NUM_THIEVES];
+            for (int i = 0; i < NUM_THIEVES; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                         &handles[i],
+                                         bdlf::BindUtil::bind(&thief, &test)));
+            }
+
+            owner(&test, NUM_ITEMS);
+
+            for (int i = 0; i < NUM_THIEVES; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            for (int i = 0; i < NUM_ITEMS; ++i) {
+                ASSERTV(round, i, test.d_numRemoved[i],
+                        1 == test.d_numRemoved[i]);
+            }
+            ASSERT(0 == test.d_deque.length());
+
+            if (veryVerbose) { T_ P_(round) P(test.d_numStolen) }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'WorkStealingThreadPool_Deque'
+        //
+        // Concerns:
+        //: 1 'popBack' removes the most recently pushed item, and 'steal' the
+        //:   least recently pushed one.
+        //:
+        //: 2 Both return 0 on an empty deque, and leave it usable.
+        //:
+        //: 3 The deque grows beyond its initial capacity, preserving the
+        //:   order of its items, including after the indices wrap around the
+        //:   array.
+        //:
+        //: 4 'length' returns the number of items.
+        //:
+        //: 5 Memory is supplied by the specified allocator, and released on
+        //:   destruction.
+        //
+        // Plan:
+        //: 1 For several initial capacities, push a number of items
+        //:   exceeding the capacity after first cycling items through the
+        //:   deque, and remove them alternately from the back and the front,
+        //:   checking the items and 'length'.  (C-1..4)
+        //:
+        //: 2 Check the test allocator.  (C-5)
+        //
+        // Testing:
+        //   WorkStealingThreadPool_Deque(int, bslma::Allocator *);
+        //   ~WorkStealingThreadPool_Deque();
+        //   void *popBack();
+        //   void pushBack(void *);
+        //   void *steal();
+        //   int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'WorkStealingThreadPool_Deque'" << endl
+                          << "==============================" << endl;
+
+        const int CAPACITIES[] = { 0, 1, 2, 3, 8 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            const int CAPACITY = CAPACITIES[ci];
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Deque mX(CAPACITY, &oa);  const Deque& X = mX;
+
+                ASSERT(0 == X.length());
+                ASSERT(0 == mX.popBack());
+                ASSERT(0 == mX.steal());
+                ASSERT(0 == X.length());
+
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                // Advance the indices so that they wrap around the array.
+
+                for (int i = 1; i <= 5; ++i) {
+                    mX.pushBack(toItem(i));
+                    ASSERT(1 == X.length());
+                    ASSERT(i == fromItem(mX.steal()));
+                }
+
+                const int NUM_ITEMS = 600;
+
+                for (int i = 1; i <= NUM_ITEMS; ++i) {
+                    mX.pushBack(toItem(i));
+                    ASSERTV(ci, i, X.length(), i == X.length());
+                }
+                ASSERT(numAllocations < oa.numAllocations());
+
+                int front = 1;
+                int back  = NUM_ITEMS;
+                while (front <= back) {
+                    ASSERTV(ci, back, front,
+                            back - front + 1 == X.length());
+
+                    const bsls::Types::IntPtr expected = (front + back) % 2
+                                                       ? back--
+                                                       : front++;
+                    const bsls::Types::IntPtr actual   = expected > back
+                                                       ? fromItem(mX.popBack())
+                                                       : fromItem(mX.steal());
+                    ASSERTV(ci, expected, actual, expected == actual);
+                }
+
+                ASSERT(0 == X.length());
+                ASSERT(0 == mX.popBack());
+                ASSERT(0 == mX.steal());
+
+                mX.pushBack(toItem(7));
+                ASSERT(7 == fromItem(mX.popBack()));
+                ASSERT(0 == X.length());
+            }
+            ASSERTV(ci, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue a few jobs, drain, and stop the pool.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(2, &ta);
+
+        ASSERT(0 == mX.start());
+
+        bsls::AtomicInt count(0);
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&increment,
+                                                           &count)));
+        }
+        mX.drain();
+        ASSERTV(count, 100 == count);
+
+        ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                       &mX,
+                                                       &count,
+                                                       0,
+                                                       3,
+                                                       3)));
+        mX.stop();
+        ASSERTV(count, 140 == count);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FAN-OUT AND FLAT SUBMISSION
+        //   Compare this pool with 'bdlmt::FixedThreadPool'.
+        //
+        // Concerns:
+        //: 1 Jobs enqueued by jobs are executed faster than by a pool sharing
+        //:   a single queue.
+        //:
+        //: 2 Jobs enqueued from outside the pool are not executed markedly
+        //:   slower than by a pool sharing a single queue.
+        //
+        // Plan:
+        //: 1 For 1 to 8 threads, time the execution of a tree of jobs, each
+        //:   performing some busy work and enqueuing its children, on each
+        //:   pool.  (C-1)
+        //:
+        //: 2 For 1 to 8 threads, time the execution of a large number of jobs
+        //:   enqueued from the main thread on each pool.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE: FAN-OUT AND FLAT SUBMISSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: FAN-OUT AND FLAT SUBMISSION" << endl
+                          << "========================================"
+                          << endl;
+
+        const int HEIGHT   = 9;
+        const int DEGREE   = 4;
+        const int WORK     = argc > 2 ? atoi(argv[2]) : 200;
+        const int NUM_FLAT = 500 * 1000;
+
+        const int NUM_NODES = numTreeNodes(HEIGHT, DEGREE);
+
+        bslma::NewDeleteAllocator na;
+
+        cout << "jobs per tree: " << NUM_NODES
+             << ", busy-work iterations per job: " << WORK << endl;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            double fixedTree, stealingTree, fixedFlat, stealingFlat;
+            {
+                bdlmt::FixedThreadPool pool(numThreads, NUM_NODES, &na);
+                ASSERT(0 == pool.start());
+
+                bsls::AtomicInt count(0);
+                bsls::Stopwatch timer;
+                timer.start();
+                pool.enqueueJob(bdlf::BindUtil::bind(&fanOutFixed,
+                                                     &pool,
+                                                     &count,
+                                                     0,
+                                                     HEIGHT,
+                                                     DEGREE,
+                                                     WORK));
+                while (NUM_NODES != count) {
+                    bslmt::ThreadUtil::yield();
+                }
+                timer.stop();
+                fixedTree = timer.elapsedTime();
+
+                count = 0;
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_FLAT; ++i) {
+                    pool.enqueueJob(bdlf::BindUtil::bind(&increment, &count));
+                }
+                pool.drain();
+                timer.stop();
+                fixedFlat = timer.elapsedTime();
+                ASSERT(NUM_FLAT == count);
+
+                pool.stop();
+            }
+            {
+                Obj pool(numThreads, &na);
+                ASSERT(0 == pool.start());
+
+                bsls::AtomicInt count(0);
+                bsls::Stopwatch timer;
+                timer.start();
+                pool.enqueueJob(bdlf::BindUtil::bind(&fanOutStealing,
+                                                     &pool,
+                                                     &count,
+                                                     0,
+                                                     HEIGHT,
+                                                     DEGREE,
+                                                     WORK));
+                pool.drain();
+                timer.stop();
+                stealingTree = timer.elapsedTime();
+                ASSERT(NUM_NODES == count);
+
+                count = 0;
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_FLAT; ++i) {
+                    pool.enqueueJob(bdlf::BindUtil::bind(&increment, &count));
+                }
+                pool.drain();
+                timer.stop();
+                stealingFlat = timer.elapsedTime();
+                ASSERT(NUM_FLAT == count);
+
+                pool.stop();
+            }
+
+            cout << "threads: " << numThreads
+                 << "\n\ttree: fixed " << fixedTree
+                 << "s, work-stealing " << stealingTree
+                 << "s\n\tflat: fixed " << fixedFlat
+                 << "s, work-stealing " << stealingFlat << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -3,6 +3,7 @@
 #include <bslh_defaultseededhashalgorithm.h>
 #include <bslh_siphashalgorithm.h>
 #include <bslh_spookyhashalgorithm.h>
+#include <bslh_xxh3hashalgorithm.h>
 
 #include <bsls_alignmentfromtype.h>
 #include <bsls_assert.h>
@@ -1051,6 +1052,9 @@ int main(int argc, char *argv[])
             ASSERT((bslmf::IsSame<size_t,
                                   Hash<SpookyHashAlgorithm>::result_type>
                                                                      ::VALUE));
+            ASSERT((bslmf::IsSame<size_t,
+                                  Hash<Xxh3HashAlgorithm>::result_type>
+                                                                     ::VALUE));
         }
 
         if (verbose) printf("Invoke 'operator()' and verify the return type is"
@@ -1065,6 +1069,9 @@ int main(int argc, char *argv[])
 
             ASSERT(TypeChecker<Hash<SpookyHashAlgorithm>::result_type>::
                                 isCorrectType(Hash<SpookyHashAlgorithm>()(1)));
+
+            ASSERT(TypeChecker<Hash<Xxh3HashAlgorithm>::result_type>::
+                                  isCorrectType(Hash<Xxh3HashAlgorithm>()(1)));
         }
 
       } break;
@@ -3,6 +3,8 @@
 #include <bslh_defaultseededhashalgorithm.h>
 #include <bslh_seedgenerator.h>
 #include <bslh_siphashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+#include <bslh_xxh3hashalgorithm.h>
 
 #include <bslmf_issame.h>
 
@@ -468,6 +470,9 @@ int main(int argc, char *argv[])
             ASSERT((bslmf::IsSame<size_t,
                                   SeededHash<SeedGen, SpookyHashAlgorithm>
                                                        ::result_type>::VALUE));
+            ASSERT((bslmf::IsSame<size_t,
+                                  SeededHash<SeedGen, Xxh3HashAlgorithm>
+                                                       ::result_type>::VALUE));
         }
 
         if (verbose) printf("Invoke 'operator()' and verify the return type is"
@@ -476,12 +481,15 @@ int main(int argc, char *argv[])
             typedef SeededHash<SeedGen, DefaultSeededHashAlgorithm> S1;
             typedef SeededHash<SeedGen, SipHashAlgorithm>           S2;
             typedef SeededHash<SeedGen, SpookyHashAlgorithm>        S3;
+            typedef SeededHash<SeedGen, Xxh3HashAlgorithm>          S4;
 
             ASSERT(TypeChecker<S1::result_type>::isCorrectType(S1()(1)));
 
             ASSERT(TypeChecker<S1::result_type>::isCorrectType(S2()(1)));
 
             ASSERT(TypeChecker<S1::result_type>::isCorrectType(S3()(1)));
+
+            ASSERT(TypeChecker<S1::result_type>::isCorrectType(S4()(1)));
         }
 
       } break;
@@ -0,0 +1,633 @@
+// bslh_xxh3hashalgorithm.cpp                                         -*-C++-*-
+#include <bslh_xxh3hashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy'
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+#include <intrin.h>   // for '_umul128'
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define U_XXH3_USE_AVX2 1
+#elif defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define U_XXH3_USE_SSE2 1
+#endif
+
+///Changes
+///-------
+// The algorithm below follows the XXH3 64-bit implementation of the
+// "xxhash.h" header (version 0.8.2), whose license is reproduced in
+// 'bslh_xxh3hashalgorithm.h'.  The streaming logic ('update' and
+// 'computeHash') mirrors 'XXH3_update' and 'XXH3_64bits_digest' of that
+// header, using the same 256-byte internal buffer, so that hashes computed
+// incrementally are identical to those of 'XXH3_64bits_withSeed' applied to
+// the concatenated input.
+
+namespace BloombergLP {
+
+namespace bslh {
+
+typedef bsls::Types::Uint64 Uint64;
+
+enum {
+    k_STRIPE_LENGTH        = 64,   // bytes consumed by one accumulation
+
+    k_STRIPES_PER_BLOCK    = 16,   // accumulations between scrambles
+
+    k_SECRET_CONSUME_RATE  = 8,    // secret advance per stripe
+
+    k_SECRET_LIMIT         = 128,  // offset of the scramble secret
+
+    k_SECRET_LASTACC_START = 7,    // back-off of the last stripe's secret
+
+    k_SECRET_MERGEACCS     = 11,   // offset of the merge secret
+
+    k_SECRET_LENGTH        = 192,  // length of the default secret
+
+    k_MIDSIZE_MAX          = 240,  // longest input hashed without stripes
+
+    k_MIDSIZE_STARTOFFSET  = 3,
+    k_MIDSIZE_LASTOFFSET   = 17
+};
+
+static const Uint64 k_PRIME32_1 = 0x9E3779B1ULL;
+static const Uint64 k_PRIME32_2 = 0x85EBCA77ULL;
+static const Uint64 k_PRIME32_3 = 0xC2B2AE3DULL;
+
+static const Uint64 k_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const Uint64 k_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const Uint64 k_PRIME64_3 = 0x165667B19E3779F9ULL;
+static const Uint64 k_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const Uint64 k_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+static const Uint64 k_PRIME_MX1 = 0x165667919E3779F9ULL;
+static const Uint64 k_PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+static const unsigned char k_DEFAULT_SECRET[k_SECRET_LENGTH] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe,
+    0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb,
+    0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78,
+    0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e,
+    0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb,
+    0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e,
+    0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f,
+    0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31,
+    0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3,
+    0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49,
+    0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc,
+    0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28,
+    0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+    // The default secret of the XXH3 algorithm.
+
+                        // ----------------------
+                        // static helper routines
+                        // ----------------------
+
+static inline
+Uint64 read64(const unsigned char *p)
+    // Return the 64-bit little-endian value at the specified 'p'.
+{
+    Uint64 value;
+    memcpy(&value, p, sizeof value);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(value);
+}
+
+static inline
+Uint64 read32(const unsigned char *p)
+    // Return the 32-bit little-endian value at the specified 'p'.
+{
+    unsigned int value;
+    memcpy(&value, p, sizeof value);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(value);
+}
+
+static inline
+void write64(unsigned char *p, Uint64 value)
+    // Store the specified 'value' at the specified 'p' in little-endian byte
+    // order.
+{
+    value = BSLS_BYTEORDER_HOST_U64_TO_LE(value);
+    memcpy(p, &value, sizeof value);
+}
+
+static inline
+Uint64 rotl64(Uint64 x, int r)
+    // Return the specified 'x' rotated left by the specified 'r' bits.
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline
+Uint64 multiplyFold(Uint64 lhs, Uint64 rhs)
+    // Return the exclusive-or of the low and high 64-bit halves of the 128-bit
+    // product of the specified 'lhs' and 'rhs'.
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 Uint128;
+
+    const Uint128 product = static_cast<Uint128>(lhs) * rhs;
+    return static_cast<Uint64>(product) ^ static_cast<Uint64>(product >> 64);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+    Uint64 high;
+    const Uint64 low = _umul128(lhs, rhs, &high);
+    return low ^ high;
+#else
+    const Uint64 loLo = (lhs & 0xFFFFFFFFULL) * (rhs & 0xFFFFFFFFULL);
+    const Uint64 hiLo = (lhs >> 32)           * (rhs & 0xFFFFFFFFULL);
+    const Uint64 loHi = (lhs & 0xFFFFFFFFULL) * (rhs >> 32);
+    const Uint64 hiHi = (lhs >> 32)           * (rhs >> 32);
+
+    const Uint64 cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFULL) + loHi;
+    const Uint64 upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+    const Uint64 lower = (cross << 32) | (loLo & 0xFFFFFFFFULL);
+    return lower ^ upper;
+#endif
+}
+
+static inline
+Uint64 avalanche64(Uint64 h)
+    // Return the specified 'h' mixed by the XXH64 avalanche function.
+{
+    h ^= h >> 33;
+    h *= k_PRIME64_2;
+    h ^= h >> 29;
+    h *= k_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline
+Uint64 avalanche(Uint64 h)
+    // Return the specified 'h' mixed by the XXH3 avalanche function.
+{
+    h ^= h >> 37;
+    h *= k_PRIME_MX1;
+    h ^= h >> 32;
+    return h;
+}
+
+static inline
+Uint64 rrmxmx(Uint64 h, Uint64 length)
+    // Return the specified 'h' mixed, together with the specified 'length',
+    // by a stronger avalanche function, used for inputs of 4 to 8 bytes.
+{
+    h ^= rotl64(h, 49) ^ rotl64(h, 24);
+    h *= k_PRIME_MX2;
+    h ^= (h >> 35) + length;
+    h *= k_PRIME_MX2;
+    h ^= h >> 28;
+    return h;
+}
+
+static inline
+Uint64 mix16Bytes(const unsigned char *input,
+                  const unsigned char *secret,
+                  Uint64               seed)
+    // Return the mix of the 16 bytes at the specified 'input' with the 16
+    // bytes at the specified 'secret' and the specified 'seed'.
+{
+    return multiplyFold(read64(input)     ^ (read64(secret)     + seed),
+                        read64(input + 8) ^ (read64(secret + 8) - seed));
+}
+
+static inline
+Uint64 hashShort(const unsigned char *input, size_t length, Uint64 seed)
+    // Return the hash of the specified 'input' having the specified 'length'
+    // with the specified 'seed'.  The behavior is undefined unless
+    // '16 >= length'.
+{
+    const unsigned char *secret = k_DEFAULT_SECRET;
+
+    if (length > 8) {
+        const Uint64 bitflip1 = (read64(secret + 24) ^ read64(secret + 32))
+                              + seed;
+        const Uint64 bitflip2 = (read64(secret + 40) ^ read64(secret + 48))
+                              - seed;
+        const Uint64 low  = read64(input)              ^ bitflip1;
+        const Uint64 high = read64(input + length - 8) ^ bitflip2;
+        return avalanche(length
+                       + bsls::ByteOrderUtil::swapBytes(low)
+                       + high
+                       + multiplyFold(low, high));                    // RETURN
+    }
+    if (length >= 4) {
+        seed ^= static_cast<Uint64>(bsls::ByteOrderUtil::swapBytes(
+                                    static_cast<unsigned int>(seed))) << 32;
+        const Uint64 bitflip = (read64(secret + 8) ^ read64(secret + 16))
+                             - seed;
+        const Uint64 input64 = read32(input + length - 4)
+                             + (read32(input) << 32);
+        return rrmxmx(input64 ^ bitflip, length);                     // RETURN
+    }
+    if (length) {
+        const Uint64 c1 = input[0];
+        const Uint64 c2 = input[length >> 1];
+        const Uint64 c3 = input[length - 1];
+        const Uint64 combined = (c1 << 16) | (c2 << 24) | c3
+                              | (static_cast<Uint64>(length) << 8);
+        const Uint64 bitflip = (read32(secret) ^ read32(secret + 4)) + seed;
+        return avalanche64(combined ^ bitflip);                       // RETURN
+    }
+    return avalanche64(seed ^ read64(secret + 56) ^ read64(secret + 64));
+}
+
+static inline
+Uint64 hashMedium(const unsigned char *input, size_t length, Uint64 seed)
+    // Return the hash of the specified 'input' having the specified 'length'
+    // with the specified 'seed'.  The behavior is undefined unless
+    // '16 < length <= 128'.
+{
+    const unsigned char *secret = k_DEFAULT_SECRET;
+
+    Uint64 acc = length * k_PRIME64_1;
+    if (length > 32) {
+        if (length > 64) {
+            if (length > 96) {
+                acc += mix16Bytes(input + 48,          secret +  96, seed);
+                acc += mix16Bytes(input + length - 64, secret + 112, seed);
+            }
+            acc += mix16Bytes(input + 32,          secret + 64, seed);
+            acc += mix16Bytes(input + length - 48, secret + 80, seed);
+        }
+        acc += mix16Bytes(input + 16,          secret + 32, seed);
+        acc += mix16Bytes(input + length - 32, secret + 48, seed);
+    }
+    acc += mix16Bytes(input,               secret,      seed);
+    acc += mix16Bytes(input + length - 16, secret + 16, seed);
+    return avalanche(acc);
+}
+
+static
+Uint64 hashMidsize(const unsigned char *input, size_t length, Uint64 seed)
+    // Return the hash of the specified 'input' having the specified 'length'
+    // with the specified 'seed'.  The behavior is undefined unless
+    // '128 < length <= 240'.
+{
+    const unsigned char *secret   = k_DEFAULT_SECRET;
+    const size_t         numRounds = length / 16;
+
+    Uint64 acc = length * k_PRIME64_1;
+    for (size_t i = 0; i < 8; ++i) {
+        acc += mix16Bytes(input + 16 * i, secret + 16 * i, seed);
+    }
+    Uint64 accEnd = mix16Bytes(input + length - 16,
+                               secret + 136 - k_MIDSIZE_LASTOFFSET,
+                               seed);
+    acc = avalanche(acc);
+    for (size_t i = 8; i < numRounds; ++i) {
+        accEnd += mix16Bytes(input + 16 * i,
+                             secret + 16 * (i - 8) + k_MIDSIZE_STARTOFFSET,
+                             seed);
+    }
+    return avalanche(acc + accEnd);
+}
+
+#if defined(U_XXH3_USE_SSE2)
+static inline
+__m128i accumulate128(__m128i acc, const __m128i *input, const __m128i *key)
+    // Return the specified pair of accumulator lanes, 'acc', updated with the
+    // 16 bytes at the specified 'input' keyed with the 16 bytes at the
+    // specified 'key': each 64-bit lane of keyed data is multiplied by its
+    // own high half, and the unkeyed data is added to the neighboring lane.
+{
+    const __m128i data        = _mm_loadu_si128(input);
+    const __m128i dataKey     = _mm_xor_si128(data, _mm_loadu_si128(key));
+    const __m128i dataKeyHigh = _mm_shuffle_epi32(dataKey,
+                                                  _MM_SHUFFLE(0, 3, 0, 1));
+    const __m128i product     = _mm_mul_epu32(dataKey, dataKeyHigh);
+    return _mm_add_epi64(_mm_add_epi64(acc, product),
+                         _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+#endif
+
+static
+void accumulate(Uint64              *accumulators,
+                const unsigned char *input,
+                const unsigned char *secret,
+                size_t               numStripes)
+    // Accumulate into the specified 'accumulators' the specified 'numStripes'
+    // consecutive 64-byte stripes starting at the specified 'input', keying
+    // stripe 'n' with the 64 bytes starting at 'secret + 8 * n' for the
+    // specified 'secret'.
+{
+#if defined(U_XXH3_USE_AVX2)
+    __m256i acc0 = _mm256_loadu_si256(
+                                 reinterpret_cast<__m256i *>(accumulators));
+    __m256i acc1 = _mm256_loadu_si256(
+                             reinterpret_cast<__m256i *>(accumulators + 4));
+
+    for (; numStripes; --numStripes) {
+        const __m256i *in  = reinterpret_cast<const __m256i *>(input);
+        const __m256i *key = reinterpret_cast<const __m256i *>(secret);
+
+        __m256i data    = _mm256_loadu_si256(in);
+        __m256i dataKey = _mm256_xor_si256(data, _mm256_loadu_si256(key));
+        __m256i product = _mm256_mul_epu32(dataKey,
+                                           _mm256_srli_epi64(dataKey, 32));
+        acc0 = _mm256_add_epi64(
+                  _mm256_add_epi64(acc0, product),
+                  _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        data    = _mm256_loadu_si256(in + 1);
+        dataKey = _mm256_xor_si256(data, _mm256_loadu_si256(key + 1));
+        product = _mm256_mul_epu32(dataKey, _mm256_srli_epi64(dataKey, 32));
+        acc1 = _mm256_add_epi64(
+                  _mm256_add_epi64(acc1, product),
+                  _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        input  += k_STRIPE_LENGTH;
+        secret += k_SECRET_CONSUME_RATE;
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(accumulators),     acc0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(accumulators + 4), acc1);
+#elif defined(U_XXH3_USE_SSE2)
+    __m128i acc0 = _mm_loadu_si128(reinterpret_cast<__m128i *>(accumulators));
+    __m128i acc1 = _mm_loadu_si128(
+                                reinterpret_cast<__m128i *>(accumulators + 2));
+    __m128i acc2 = _mm_loadu_si128(
+                                reinterpret_cast<__m128i *>(accumulators + 4));
+    __m128i acc3 = _mm_loadu_si128(
+                                reinterpret_cast<__m128i *>(accumulators + 6));
+
+    for (; numStripes; --numStripes) {
+        const __m128i *in  = reinterpret_cast<const __m128i *>(input);
+        const __m128i *key = reinterpret_cast<const __m128i *>(secret);
+
+        acc0 = accumulate128(acc0, in,     key);
+        acc1 = accumulate128(acc1, in + 1, key + 1);
+        acc2 = accumulate128(acc2, in + 2, key + 2);
+        acc3 = accumulate128(acc3, in + 3, key + 3);
+
+        input  += k_STRIPE_LENGTH;
+        secret += k_SECRET_CONSUME_RATE;
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(accumulators),     acc0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(accumulators + 2), acc1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(accumulators + 4), acc2);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(accumulators + 6), acc3);
+#else
+    for (; numStripes; --numStripes) {
+        for (int lane = 0; lane < 8; ++lane) {
+            const Uint64 data    = read64(input + 8 * lane);
+            const Uint64 dataKey = data ^ read64(secret + 8 * lane);
+
+            accumulators[lane ^ 1] += data;
+            accumulators[lane]     += (dataKey & 0xFFFFFFFFULL)
+                                    * (dataKey >> 32);
+        }
+
+        input  += k_STRIPE_LENGTH;
+        secret += k_SECRET_CONSUME_RATE;
+    }
+#endif
+}
+
+static
+void scramble(Uint64 *accumulators, const unsigned char *secret)
+    // Scramble the specified 'accumulators' using the 64 bytes at the
+    // specified 'secret'.
+{
+    for (int lane = 0; lane < 8; ++lane) {
+        Uint64 acc = accumulators[lane];
+        acc ^= acc >> 47;
+        acc ^= read64(secret + 8 * lane);
+        acc *= k_PRIME32_1;
+        accumulators[lane] = acc;
+    }
+}
+
+static
+const unsigned char *consumeStripes(Uint64              *accumulators,
+                                    size_t              *numStripesSoFar,
+                                    const unsigned char *input,
+                                    size_t               numStripes,
+                                    const unsigned char *secret)
+    // Accumulate into the specified 'accumulators' the specified 'numStripes'
+    // stripes starting at the specified 'input', using the specified
+    // 'secret', and scrambling the accumulators each time a block of
+    // 'k_STRIPES_PER_BLOCK' stripes is completed.  Update the specified
+    // 'numStripesSoFar' to the number of stripes accumulated in the
+    // incomplete block, and return the address following the consumed input.
+{
+    const unsigned char *initialSecret =
+                            secret + *numStripesSoFar * k_SECRET_CONSUME_RATE;
+
+    if (numStripes >= k_STRIPES_PER_BLOCK - *numStripesSoFar) {
+        size_t numStripesThisIteration = k_STRIPES_PER_BLOCK
+                                       - *numStripesSoFar;
+        do {
+            accumulate(accumulators,
+                       input,
+                       initialSecret,
+                       numStripesThisIteration);
+            scramble(accumulators, secret + k_SECRET_LIMIT);
+
+            input      += numStripesThisIteration * k_STRIPE_LENGTH;
+            numStripes -= numStripesThisIteration;
+
+            numStripesThisIteration = k_STRIPES_PER_BLOCK;
+            initialSecret           = secret;
+        } while (numStripes >= k_STRIPES_PER_BLOCK);
+        *numStripesSoFar = 0;
+    }
+    if (numStripes) {
+        accumulate(accumulators, input, initialSecret, numStripes);
+        input            += numStripes * k_STRIPE_LENGTH;
+        *numStripesSoFar += numStripes;
+    }
+    return input;
+}
+
+static
+void initializeLongState(Uint64        *accumulators,
+                         unsigned char *secret,
+                         Uint64         seed)
+    // Load the initial accumulator values into the specified 'accumulators'
+    // and, if the specified 'seed' is non-zero, load the secret derived from
+    // 'seed' into the specified 'secret'.
+{
+    accumulators[0] = k_PRIME32_3;
+    accumulators[1] = k_PRIME64_1;
+    accumulators[2] = k_PRIME64_2;
+    accumulators[3] = k_PRIME64_3;
+    accumulators[4] = k_PRIME64_4;
+    accumulators[5] = k_PRIME32_2;
+    accumulators[6] = k_PRIME64_5;
+    accumulators[7] = k_PRIME32_1;
+
+    if (seed) {
+        for (int i = 0; i < k_SECRET_LENGTH; i += 16) {
+            write64(secret + i,     read64(k_DEFAULT_SECRET + i)     + seed);
+            write64(secret + i + 8, read64(k_DEFAULT_SECRET + i + 8) - seed);
+        }
+    }
+}
+
+                        // -----------------------
+                        // class Xxh3HashAlgorithm
+                        // -----------------------
+
+// PRIVATE MANIPULATORS
+void Xxh3HashAlgorithm::update(const unsigned char *data, size_t numBytes)
+{
+    BSLS_ASSERT(d_bufferLength + numBytes > k_BUFFER_LENGTH);
+
+    if (0 == d_consumedLength) {
+        // Nothing has been accumulated yet.
+
+        initializeLongState(d_accumulators, d_secret, d_seed);
+    }
+    d_consumedLength += d_bufferLength + numBytes;
+
+    const unsigned char *secret = d_seed ? d_secret : k_DEFAULT_SECRET;
+    const unsigned char *end    = data + numBytes;
+
+    if (d_bufferLength) {
+        const size_t loadLength = k_BUFFER_LENGTH - d_bufferLength;
+        memcpy(d_buffer + d_bufferLength, data, loadLength);
+        data += loadLength;
+        consumeStripes(d_accumulators,
+                       &d_numStripesSoFar,
+                       d_buffer,
+                       k_BUFFER_LENGTH / k_STRIPE_LENGTH,
+                       secret);
+        d_bufferLength = 0;
+    }
+
+    if (end - data > k_BUFFER_LENGTH) {
+        // Consume all but the final (possibly complete) stripe directly from
+        // 'data', and keep a copy of the last consumed stripe, which is
+        // needed if fewer than 'k_STRIPE_LENGTH' bytes remain.
+
+        const size_t numStripes = (end - 1 - data) / k_STRIPE_LENGTH;
+        data = consumeStripes(d_accumulators,
+                              &d_numStripesSoFar,
+                              data,
+                              numStripes,
+                              secret);
+        memcpy(d_buffer + k_BUFFER_LENGTH - k_STRIPE_LENGTH,
+               data - k_STRIPE_LENGTH,
+               k_STRIPE_LENGTH);
+    }
+
+    d_bufferLength    = end - data;
+    d_consumedLength -= d_bufferLength;
+    memcpy(d_buffer, data, d_bufferLength);
+}
+
+// MANIPULATORS
+Xxh3HashAlgorithm::result_type Xxh3HashAlgorithm::computeHash()
+{
+    if (0 == d_consumedLength) {
+        // All of the data is buffered.
+
+        if (d_bufferLength <= 16) {
+            return hashShort(d_buffer, d_bufferLength, d_seed);       // RETURN
+        }
+        if (d_bufferLength <= 128) {
+            return hashMedium(d_buffer, d_bufferLength, d_seed);      // RETURN
+        }
+        if (d_bufferLength <= k_MIDSIZE_MAX) {
+            return hashMidsize(d_buffer, d_bufferLength, d_seed);     // RETURN
+        }
+
+        // Nothing has been accumulated yet.
+
+        initializeLongState(d_accumulators, d_secret, d_seed);
+    }
+
+    // Digest using a copy of the accumulators, so that this object is left
+    // unchanged.
+
+    const unsigned char *secret = d_seed ? d_secret : k_DEFAULT_SECRET;
+
+    Uint64 accumulators[k_NUM_ACCUMULATORS];
+    memcpy(accumulators, d_accumulators, sizeof accumulators);
+
+    unsigned char        lastStripe[k_STRIPE_LENGTH];
+    const unsigned char *lastStripePtr;
+
+    if (d_bufferLength >= k_STRIPE_LENGTH) {
+        size_t numStripesSoFar = d_numStripesSoFar;
+        consumeStripes(accumulators,
+                       &numStripesSoFar,
+                       d_buffer,
+                       (d_bufferLength - 1) / k_STRIPE_LENGTH,
+                       secret);
+        lastStripePtr = d_buffer + d_bufferLength - k_STRIPE_LENGTH;
+    }
+    else {
+        // The last stripe begins in the previously consumed data, a copy of
+        // which is at the end of the buffer.
+
+        const size_t catchupLength = k_STRIPE_LENGTH - d_bufferLength;
+        memcpy(lastStripe,
+               d_buffer + k_BUFFER_LENGTH - catchupLength,
+               catchupLength);
+        memcpy(lastStripe + catchupLength, d_buffer, d_bufferLength);
+        lastStripePtr = lastStripe;
+    }
+    accumulate(accumulators,
+               lastStripePtr,
+               secret + k_SECRET_LIMIT - k_SECRET_LASTACC_START,
+               1);
+
+    const unsigned char *mergeSecret = secret + k_SECRET_MERGEACCS;
+
+    Uint64 result = (d_consumedLength + d_bufferLength) * k_PRIME64_1;
+    for (int i = 0; i < 4; ++i, mergeSecret += 16) {
+        result += multiplyFold(accumulators[2 * i]     ^ read64(mergeSecret),
+                               accumulators[2 * i + 1] ^ read64(mergeSecret
+                                                                     + 8));
+    }
+    return avalanche(result);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#undef U_XXH3_USE_AVX2
+#undef U_XXH3_USE_SSE2
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
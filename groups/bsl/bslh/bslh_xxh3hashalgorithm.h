@@ -0,0 +1,557 @@
+// bslh_xxh3hashalgorithm.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLH_XXH3HASHALGORITHM
+#define INCLUDED_BSLH_XXH3HASHALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the 64-bit XXH3 hash algorithm.
+//
+//@CLASSES:
+//  bslh::Xxh3HashAlgorithm: functor implementing the 64-bit XXH3 algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_seededhash, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::Xxh3HashAlgorithm' implements the 64-bit variant of the
+// XXH3 algorithm by Yann Collet (a member of the xxHash family, see
+// https://github.com/Cyan4973/xxHash).  This algorithm is a general purpose
+// algorithm that has been designed for a fast, well-distributed hash of both
+// very short inputs (such as the strings typically used as keys in unordered
+// associative containers) and very long inputs (such as file contents).  It
+// produces the same hashes as the canonical 'XXH3_64bits' and
+// 'XXH3_64bits_withSeed' functions of the reference implementation.
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh' (internal users can also find
+// information here {TEAM BDE:USING MODULAR HASHING<GO>})
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+// There are *no* security guarantees made by 'bslh::Xxh3HashAlgorithm',
+// meaning attackers may be able to engineer keys that will cause a Denial of
+// Service (DoS) attack in hash tables using this algorithm.  Note that even if
+// an attacker does not know the seed used to initialize this algorithm, they
+// may still be able to produce keys that will cause a DoS attack in hash
+// tables using this algorithm.  If security is required, an algorithm that
+// documents better secure properties should be used, such as
+// 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  Inputs of at most 16 bytes are hashed with a
+// handful of multiplications and no loops, and inputs of at most 240 bytes
+// are hashed without touching the per-object accumulators.  Longer inputs are
+// processed in 64-byte stripes, using SSE2 (or AVX2 when the translation unit
+// is compiled with AVX2 enabled) on x86 platforms.  As a result, this
+// algorithm is faster than 'bslh::SpookyHashAlgorithm' on inputs of all
+// lengths, and substantially so on inputs of up to a few hundred bytes.
+//
+// Data passed to 'operator()' is buffered (up to 256 bytes) until
+// 'computeHash' is called, so that the short-input paths are used whenever
+// the total length of the hashed data is short, irrespective of how many
+// calls to 'operator()' were made to supply it.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm is endian-independent: input bytes are always read as
+// little-endian words, so the same sequence of bytes (and the same seed) will
+// produce the same hash on every platform.  Note that the hash of an object
+// that is not a sequence of bytes (e.g., an 'int') still depends on the
+// object's representation on the platform.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Creating and Using a Hash Table
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have any array of types that define 'operator==', and we want a
+// fast way to find out if values are contained in the array.  We can create a
+// 'HashTable' data structure that is capable of looking up values in O(1)
+// time.
+//
+// Further suppose that we will be storing futures (the financial instruments)
+// in this table.  Since futures have standardized names, we don't have to
+// worry about any malicious values causing collisions.  We will want to use a
+// general purpose hashing algorithm with a good hash distribution and good
+// speed, in particular on the short strings that make up the names.  This
+// algorithm will need to be in the form of a hash functor -- an object that
+// will take objects stored in our array as input, and yield a 64-bit int
+// value.  The functor can pass the attributes of the 'TYPE' that are salient
+// to hashing into the hashing algorithm, and then return the hash that is
+// produced.
+//
+// We can use the result of the hash function to index into our array of
+// 'buckets'.  Each 'bucket' is simply a pointer to a value in our original
+// array of 'TYPE' objects.
+//
+// First, we define our 'HashTable' template class, with the two type
+// parameters: 'TYPE' (the type being referenced) and 'HASHER' (a functor that
+// produces the hash).
+//..
+//  template <class TYPE, class HASHER>
+//  class HashTable {
+//      // This class template implements a hash table providing fast lookup of
+//      // an external, non-owned, array of values of (template parameter)
+//      // 'TYPE'.
+//      //
+//      // The (template parameter) 'TYPE' shall have a transitive, symmetric
+//      // 'operator==' function.  There is no requirement that it have any
+//      // kind of creator defined.
+//      //
+//      // The 'HASHER' template parameter type must be a functor with a method
+//      // having the following signature:
+//      //..
+//      //  size_t operator()(TYPE)  const;
+//      //                   -OR-
+//      //  size_t operator()(const TYPE&) const;
+//      //..
+//      // and 'HASHER' shall have a publicly accessible default constructor
+//      // and destructor.
+//      //
+//      // Note that this hash table has numerous simplifications because we
+//      // know the size of the array and never have to resize the table.
+//
+//      // DATA
+//      const TYPE       *d_values;             // Array of values table is to
+//                                              // hold
+//      size_t            d_numValues;          // Length of 'd_values'.
+//      const TYPE      **d_bucketArray;        // Contains ptrs into
+//                                              // 'd_values'
+//      size_t            d_bucketArrayMask;    // Will always be '2^N - 1'.
+//      HASHER            d_hasher;
+//
+//    private:
+//      // PRIVATE ACCESSORS
+//      bool lookup(size_t      *idx,
+//                  const TYPE&  value,
+//                  size_t       hashValue) const;
+//          // Look up the specified 'value', having the specified 'hashValue',
+//          // and load its index in 'd_bucketArray' into the specified 'idx'.
+//          // If not found, return the vacant entry in 'd_bucketArray' where
+//          // it should be inserted.  Return 'true' if 'value' is found and
+//          // 'false' otherwise.
+//
+//    public:
+//      // CREATORS
+//      HashTable(const TYPE *valuesArray,
+//                size_t      numValues);
+//          // Create a hash table referring to the specified 'valuesArray'
+//          // having length of the specified 'numValues'.  No value in
+//          // 'valuesArray' shall have the same value as any of the other
+//          // values in 'valuesArray'
+//
+//      ~HashTable();
+//          // Free up memory used by this hash table.
+//
+//      // ACCESSORS
+//      bool contains(const TYPE& value) const;
+//          // Return true if the specified 'value' is found in the table and
+//          // false otherwise.
+//  };
+//..
+// Then, we define a 'Future' class, which holds a c-string 'name', char
+// 'callMonth', and short 'callYear'.
+//..
+//  class Future {
+//      // This class identifies a future contract.  It tracks the name, call
+//      // month and year of the contract it represents, and allows equality
+//      // comparison.
+//
+//      // DATA
+//      const char *d_name;    // held, not owned
+//      const char  d_callMonth;
+//      const short d_callYear;
+//
+//    public:
+//      // CREATORS
+//      Future(const char *name, const char callMonth, const short callYear)
+//      : d_name(name), d_callMonth(callMonth), d_callYear(callYear)
+//          // Create a 'Future' object out of the specified 'name',
+//          // 'callMonth', and 'callYear'.
+//      {}
+//
+//      Future() : d_name(""), d_callMonth('\0'), d_callYear(0)
+//          // Create a 'Future' with default values.
+//      {}
+//
+//      // ACCESSORS
+//      const char * getMonth() const
+//          // Return the month that this future expires.
+//      {
+//          return &d_callMonth;
+//      }
+//
+//      const char * getName() const
+//          // Return the name of this future
+//      {
+//          return d_name;
+//      }
+//
+//      const short * getYear() const
+//          // Return the year that this future expires
+//      {
+//          return &d_callYear;
+//      }
+//
+//      bool operator==(const Future& other) const
+//          // Compare this to the specified 'other' object and return true if
+//          // they are equal
+//      {
+//          return (!strcmp(d_name, other.d_name))  &&
+//             d_callMonth == other.d_callMonth &&
+//             d_callYear  == other.d_callYear;
+//      }
+//  };
+//
+//  bool operator!=(const Future& lhs, const Future& rhs)
+//      // Compare compare the specified 'lhs' and 'rhs' objects and return
+//      // true if they are not equal
+//  {
+//      return !(lhs == rhs);
+//  }
+//..
+// Next, we need a hash functor for 'Future'.  We are going to use the
+// 'Xxh3HashAlgorithm' because it is a fast, general purpose hashing algorithm
+// that will provide an easy way to combine the attributes of 'Future' objects
+// that are salient to hashing into one reasonable hash that will distribute
+// the items evenly throughout the hash table.  Note that, as the attributes
+// are buffered, the three attributes below are hashed together by the
+// short-input path of the algorithm.
+//..
+//  struct HashFuture {
+//      // This struct is a functor that will apply the 'Xxh3HashAlgorithm' to
+//      // objects of type 'Future'.
+//
+//      size_t operator()(const Future& future) const
+//          // Return the hash of the of the specified 'future'.  Note that
+//          // this uses the 'Xxh3HashAlgorithm' to quickly combine the
+//          // attributes of 'Future' objects that are salient to hashing into
+//          // a hash suitable for a hash table.
+//      {
+//          Xxh3HashAlgorithm hash;
+//
+//          hash(future.getName(),  strlen(future.getName()));
+//          hash(future.getMonth(), sizeof(char));
+//          hash(future.getYear(),  sizeof(short));
+//
+//          return static_cast<size_t>(hash.computeHash());
+//      }
+//  };
+//..
+// Then, we want to actually use our hash table on 'Future' objects.  We create
+// an array of 'Future's based on data that was originally from some external
+// source:
+//..
+//      Future futures[] = { Future("Swiss Franc", 'F', 2014),
+//                           Future("US Dollar", 'G', 2015),
+//                           Future("Canadian Dollar", 'Z', 2014),
+//                           Future("British Pound", 'M', 2015),
+//                           Future("Deutsche Mark", 'X', 2016),
+//                           Future("Eurodollar", 'Q', 2017)};
+//      enum { NUM_FUTURES = sizeof futures / sizeof *futures };
+//..
+// Next, we create our HashTable 'hashTable'.  We pass the functor that we
+// defined above as the second argument:
+//..
+//      HashTable<Future, HashFuture> hashTable(futures, NUM_FUTURES);
+//..
+// Now, we verify that each element in our array registers with count:
+//..
+//      for ( int i = 0; i < 6; ++i) {
+//          ASSERT(hashTable.contains(futures[i]));
+//      }
+//..
+// Finally, we verify that futures not in our original array are correctly
+// identified as not being in the set:
+//..
+//      ASSERT(!hashTable.contains(Future("French Franc", 'N', 2019)));
+//      ASSERT(!hashTable.contains(Future("Swiss Franc", 'X', 2014)));
+//      ASSERT(!hashTable.contains(Future("US Dollar", 'F', 2014)));
+//..
+//
+///Changes
+///-------
+// The algorithm implemented by this component is that of the 'xxhash.h'
+// header (version 0.8.2) referenced below.  The implementation has been
+// rewritten to meet BDE standards.  Changes made to the original code
+// include:
+//
+//: 1 Adding 'BloombergLP' and 'bslh' namespaces
+//:
+//: 2 Providing only the 64-bit XXH3 variant, as a streaming functor named
+//:   'Xxh3HashAlgorithm', rather than the 'XXH3_64bits*' C functions
+//:
+//: 3 Added 'k_SEED_LENGTH' and a constructor accepting a 'const char *'
+//:   seed, read as a little-endian 64-bit seed
+//:
+//: 4 Removed the option of a user-supplied secret, and the 'XXH_VECTOR'
+//:   dispatch in favor of compile-time selection of SSE2 or AVX2
+//:
+//: 5 The per-seed secret, and the accumulators, are computed only when the
+//:   total length of the hashed data exceeds the internal buffer
+//:
+//: 6 Whitespace changes for formatting, and added comments
+//
+///Third-Party Documentation
+///-------------------------
+//------------------------------- xxhash.h ------------------------------------
+//
+// xxHash - Extremely Fast Hash algorithm
+// Header File
+// Copyright (C) 2012-2023 Yann Collet
+//
+// BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//    * Redistributions in binary form must reproduce the above
+//      copyright notice, this list of conditions and the following disclaimer
+//      in the documentation and/or other materials provided with the
+//      distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// You can contact the author at:
+//   - xxHash homepage: https://www.xxhash.com
+//   - xxHash source repository: https://github.com/Cyan4973/xxHash
+//
+//-----------------------------------------------------------------------------
+
+#include <bslscm_version.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy'
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // =============================
+                          // class bslh::Xxh3HashAlgorithm
+                          // =============================
+
+class Xxh3HashAlgorithm {
+    // This class wraps an implementation of the 64-bit "XXH3" hash algorithm
+    // in an interface that is usable in the modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_ACCUMULATORS = 8,    // number of 64-bit lanes in a stripe
+
+        k_STRIPE_LENGTH    = 64,   // bytes consumed by one accumulation
+
+        k_BUFFER_LENGTH    = 256,  // bytes buffered before accumulating
+
+        k_SECRET_LENGTH    = 192   // length of the (default) secret
+    };
+
+    // DATA
+    Uint64        d_accumulators[k_NUM_ACCUMULATORS];
+        // Stores the intermediate state of the algorithm for inputs longer
+        // than 'k_BUFFER_LENGTH'; not initialized until such input is seen.
+
+    unsigned char d_buffer[k_BUFFER_LENGTH];
+        // Used to buffer data until there is more than can be hashed by the
+        // short-input paths of the algorithm.  After the accumulators have
+        // been initialized, the final 'k_STRIPE_LENGTH' bytes of the buffer
+        // hold the last stripe of data that was accumulated.
+
+    unsigned char d_secret[k_SECRET_LENGTH];
+        // The secret derived from the seed, used in place of the default
+        // secret for inputs longer than 'k_BUFFER_LENGTH' when the seed is
+        // non-zero; not initialized until such input is seen.
+
+    Uint64        d_seed;
+        // The seed of this algorithm.
+
+    Uint64        d_consumedLength;
+        // The length of the data that has been passed into the algorithm and
+        // is not currently held in the buffer; zero until more than
+        // 'k_BUFFER_LENGTH' bytes have been passed in.
+
+    size_t        d_bufferLength;
+        // The length of the data currently stored in the buffer.
+
+    size_t        d_numStripesSoFar;
+        // The number of stripes accumulated since the accumulators were last
+        // scrambled.
+
+    // NOT IMPLEMENTED
+    Xxh3HashAlgorithm(const Xxh3HashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    Xxh3HashAlgorithm& operator=(const Xxh3HashAlgorithm& rhs);// = delete;
+        // Do not allow assignment.
+
+    // PRIVATE MANIPULATORS
+    void update(const unsigned char *data, size_t numBytes);
+        // Incorporate the specified 'data', having the specified 'numBytes',
+        // into the internal state of this object.  The behavior is undefined
+        // unless 'd_bufferLength + numBytes > k_BUFFER_LENGTH'.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+    // CREATORS
+    Xxh3HashAlgorithm();
+        // Create a 'bslh::Xxh3HashAlgorithm' using the default (zero) seed.
+
+    explicit Xxh3HashAlgorithm(const char *seed);
+        // Create a 'bslh::Xxh3HashAlgorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed'.
+        // The seed is read as a little-endian integer, and each bit of the
+        // supplied seed will contribute to the final hash produced by
+        // 'computeHash()'.  The behaviour is undefined unless 'seed' points
+        // to at least 8 bytes of initialized memory.  Note that an all-zero
+        // seed produces the same hashes as the default constructor.
+
+    //! ~Xxh3HashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that a value will be returned, even if data has not been
+        // passed into 'operator()'.  Also note that, unlike some other 'bslh'
+        // algorithms, this function does not change the state of this object,
+        // so that further data may be passed to 'operator()' to compute the
+        // hash of a longer sequence of bytes.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+// CREATORS
+inline
+Xxh3HashAlgorithm::Xxh3HashAlgorithm()
+: d_seed(0)
+, d_consumedLength(0)
+, d_bufferLength(0)
+, d_numStripesSoFar(0)
+{
+}
+
+inline
+Xxh3HashAlgorithm::Xxh3HashAlgorithm(const char *seed)
+: d_seed(static_cast<Uint64>(static_cast<unsigned char>(seed[0]))       |
+         static_cast<Uint64>(static_cast<unsigned char>(seed[1])) << 8  |
+         static_cast<Uint64>(static_cast<unsigned char>(seed[2])) << 16 |
+         static_cast<Uint64>(static_cast<unsigned char>(seed[3])) << 24 |
+         static_cast<Uint64>(static_cast<unsigned char>(seed[4])) << 32 |
+         static_cast<Uint64>(static_cast<unsigned char>(seed[5])) << 40 |
+         static_cast<Uint64>(static_cast<unsigned char>(seed[6])) << 48 |
+         static_cast<Uint64>(static_cast<unsigned char>(seed[7])) << 56)
+, d_consumedLength(0)
+, d_bufferLength(0)
+, d_numStripesSoFar(0)
+{
+    // The seed is assembled byte-by-byte to avoid unaligned reads, and so
+    // that the hashes produced do not depend on the endianness of the
+    // platform.
+}
+
+// MANIPULATORS
+inline
+void Xxh3HashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    if (numBytes <= k_BUFFER_LENGTH - d_bufferLength) {
+        if (numBytes) {
+            memcpy(d_buffer + d_bufferLength, data, numBytes);
+            d_bufferLength += numBytes;
+        }
+    }
+    else {
+        update(static_cast<const unsigned char *>(data), numBytes);
+    }
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::Xxh3HashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1134 @@
+// bslh_xxh3hashalgorithm.t.cpp                                     -*-C++-*-
+#include <bslh_xxh3hashalgorithm.h>
+
+#include <bslh_siphashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by a known-good implementation of the hashing algorithm
+// (the reference 'xxhash.h', version 0.8.2), for input lengths covering each
+// of the short-input paths and the striped path of the algorithm, with and
+// without a seed.  The component will also be tested for conformance to the
+// requirements on 'bslh' hashing algorithms, outlined in the 'bslh' package
+// level documentation.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 5] enum { k_SEED_LENGTH = 8 };
+//
+// CREATORS
+// [ 2] Xxh3HashAlgorithm();
+// [ 2] Xxh3HashAlgorithm(const char *seed);
+// [ 2] ~Xxh3HashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] Trait IsBitwiseMoveable
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  PRINTF FORMAT MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ZU BSLS_BSLTESTUTIL_FORMAT_ZU
+
+//=============================================================================
+//                             USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Creating and Using a Hash Table
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have any array of types that define 'operator==', and we want a
+// fast way to find out if values are contained in the array.  We can create a
+// 'HashTable' data structure that is capable of looking up values in O(1)
+// time.
+//
+// Further suppose that we will be storing futures (the financial instruments)
+// in this table.  Since futures have standardized names, we don't have to
+// worry about any malicious values causing collisions.  We will want to use a
+// general purpose hashing algorithm with a good hash distribution and good
+// speed, in particular on the short strings that make up the names.  This
+// algorithm will need to be in the form of a hash functor -- an object that
+// will take objects stored in our array as input, and yield a 64-bit int
+// value.  The functor can pass the attributes of the 'TYPE' that are salient
+// to hashing into the hashing algorithm, and then return the hash that is
+// produced.
+//
+// We can use the result of the hash function to index into our array of
+// 'buckets'.  Each 'bucket' is simply a pointer to a value in our original
+// array of 'TYPE' objects.
+//
+// First, we define our 'HashTable' template class, with the two type
+// parameters: 'TYPE' (the type being referenced) and 'HASHER' (a functor that
+// produces the hash).
+
+    template <class TYPE, class HASHER>
+    class HashTable {
+        // This class template implements a hash table providing fast lookup of
+        // an external, non-owned, array of values of (template parameter)
+        // 'TYPE'.
+        //
+        // The (template parameter) 'TYPE' shall have a transitive, symmetric
+        // 'operator==' function.  There is no requirement that it have any
+        // kind of creator defined.
+        //
+        // The 'HASHER' template parameter type must be a functor with a method
+        // having the following signature:
+        //..
+        //  size_t operator()(TYPE)  const;
+        //                   -OR-
+        //  size_t operator()(const TYPE&) const;
+        //..
+        // and 'HASHER' shall have a publicly accessible default constructor
+        // and destructor.
+        //
+        // Note that this hash table has numerous simplifications because we
+        // know the size of the array and never have to resize the table.
+
+        // DATA
+        const TYPE       *d_values;          // Array of values table is to
+                                             // hold
+        size_t            d_numValues;       // Length of 'd_values'.
+        const TYPE      **d_bucketArray;     // Contains ptrs into 'd_values'
+        size_t            d_bucketArrayMask; // Will always be '2^N - 1'.
+        HASHER            d_hasher;          // User supplied hashing algorithm
+
+
+      private:
+        // PRIVATE ACCESSORS
+        bool lookup(size_t      *idx,
+                    const TYPE&  value,
+                    size_t       hashValue) const;
+            // Look up the specified 'value', having the specified 'hashValue',
+            // and load its index in 'd_bucketArray' into the specified 'idx'.
+            // If not found, return the vacant entry in 'd_bucketArray' where
+            // it should be inserted.  Return 'true' if 'value' is found and
+            // 'false' otherwise.
+
+      public:
+        // CREATORS
+        HashTable(const TYPE *valuesArray,
+                  size_t      numValues);
+            // Create a hash table referring to the specified 'valuesArray'
+            // having length of the specified 'numValues'.  No value in
+            // 'valuesArray' shall have the same value as any of the other
+            // values in 'valuesArray'
+
+        ~HashTable();
+            // Free up memory used by this hash table.
+
+        // ACCESSORS
+        bool contains(const TYPE& value) const;
+            // Return true if the specified 'value' is found in the table and
+            // false otherwise.
+    };
+
+// Then, we define a 'Future' class, which holds a c-string 'name', char
+// 'callMonth', and short 'callYear'.
+
+    class Future {
+        // This class identifies a future contract.  It tracks the name, call
+        // month and year of the contract it represents, and allows equality
+        // comparison.
+
+        // DATA
+        const char *d_name;    // held, not owned
+        const char  d_callMonth;
+        const short d_callYear;
+
+      public:
+        // CREATORS
+        Future(const char *name, const char callMonth, const short callYear)
+        : d_name(name), d_callMonth(callMonth), d_callYear(callYear)
+            // Create a 'Future' object out of the specified 'name',
+            // 'callMonth', and 'callYear'.
+        {}
+
+        Future() : d_name(""), d_callMonth('\0'), d_callYear(0)
+            // Create a 'Future' with default values.
+        {}
+
+        // ACCESSORS
+        const char * getMonth() const
+            // Return the month that this future expires.
+        {
+            return &d_callMonth;
+        }
+
+        const char * getName() const
+            // Return the name of this future
+        {
+            return d_name;
+        }
+
+        const short * getYear() const
+            // Return the year that this future expires
+        {
+            return &d_callYear;
+        }
+
+        bool operator==(const Future& other) const
+            // Compare this to the specified 'other' object and return true if
+            // they are equal
+        {
+            return (!strcmp(d_name, other.d_name))  &&
+               d_callMonth == other.d_callMonth &&
+               d_callYear  == other.d_callYear;
+        }
+    };
+
+    bool operator!=(const Future& lhs, const Future& rhs)
+        // Compare compare the specified 'lhs' and 'rhs' objects and return
+        // true if they are not equal
+    {
+        return !(lhs == rhs);
+    }
+
+// Next, we need a hash functor for 'Future'.  We are going to use the
+// 'Xxh3HashAlgorithm' because it is a fast, general purpose hashing algorithm
+// that will provide an easy way to combine the attributes of 'Future' objects
+// that are salient to hashing into one reasonable hash that will distribute
+// the items evenly throughout the hash table.  Note that, as the attributes
+// are buffered, the three attributes below are hashed together by the
+// short-input path of the algorithm.
+
+    struct HashFuture {
+        // This struct is a functor that will apply the 'Xxh3HashAlgorithm'
+        // to objects of type 'Future'.
+
+        size_t operator()(const Future& future) const
+            // Return the hash of the of the specified 'future'.  Note that
+            // this uses the 'Xxh3HashAlgorithm' to quickly combine the
+            // attributes of 'Future' objects that are salient to hashing into
+            // a hash suitable for a hash table.
+        {
+            Xxh3HashAlgorithm hash;
+
+            hash(future.getName(),  strlen(future.getName()));
+            hash(future.getMonth(), sizeof(char));
+            hash(future.getYear(),  sizeof(short));
+
+            return static_cast<size_t>(hash.computeHash());
+        }
+    };
+
+//=============================================================================
+//                     ELIDED USAGE EXAMPLE IMPLEMENTATIONS
+//-----------------------------------------------------------------------------
+
+// PRIVATE ACCESSORS
+template <class TYPE, class HASHER>
+bool HashTable<TYPE, HASHER>::lookup(size_t      *idx,
+                                     const TYPE&  value,
+                                     size_t       hashValue) const
+{
+    const TYPE *ptr;
+    for (*idx = hashValue & d_bucketArrayMask; (ptr = d_bucketArray[*idx]);
+                                   *idx = (*idx + 1) & d_bucketArrayMask) {
+        if (value == *ptr) {
+            return true;                                              // RETURN
+        }
+    }
+    // value was not found in table
+
+    return false;
+}
+
+// CREATORS
+template <class TYPE, class HASHER>
+HashTable<TYPE, HASHER>::HashTable(const TYPE *valuesArray,
+                                   size_t      numValues)
+: d_values(valuesArray)
+, d_numValues(numValues)
+, d_hasher()
+{
+    size_t bucketArrayLength = 4;
+    while (bucketArrayLength < numValues * 4) {
+        bucketArrayLength *= 2;
+
+    }
+    d_bucketArrayMask = bucketArrayLength - 1;
+    d_bucketArray = new const TYPE *[bucketArrayLength];
+    memset(d_bucketArray,  0, bucketArrayLength * sizeof(TYPE *));
+
+    for (unsigned i = 0; i < numValues; ++i) {
+        const TYPE& value = d_values[i];
+        size_t idx;
+        BSLS_ASSERT_OPT(!lookup(&idx, value, d_hasher(value)));
+        d_bucketArray[idx] = &d_values[i];
+    }
+}
+
+template <class TYPE, class HASHER>
+HashTable<TYPE, HASHER>::~HashTable()
+{
+    delete [] d_bucketArray;
+}
+
+// ACCESSORS
+template <class TYPE, class HASHER>
+bool HashTable<TYPE, HASHER>::contains(const TYPE& value) const
+{
+    size_t idx;
+    return lookup(&idx, value, d_hasher(value));
+}
+
+
+//=============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef Xxh3HashAlgorithm Obj;
+typedef BloombergLP::bsls::Types::Uint64 Uint64;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+void fillTestData(unsigned char *data, size_t length)
+    // Load into the specified 'data' the specified 'length' bytes of the
+    // pattern used to generate the expected hashes of case 3.
+{
+    for (size_t i = 0; i < length; ++i) {
+        data[i] = static_cast<unsigned char>((i * 131 + 7) ^ (i >> 5));
+    }
+}
+
+static
+Uint64 seededHash(Uint64 seed, const void *data, size_t length)
+    // Return the hash of the specified 'data' having the specified 'length'
+    // computed by an 'Obj' having the specified 'seed'.
+{
+    char seedBytes[Obj::k_SEED_LENGTH];
+    for (int i = 0; i < Obj::k_SEED_LENGTH; ++i) {
+        seedBytes[i] = static_cast<char>(seed >> (8 * i));
+    }
+    Obj hash(seedBytes);
+    hash(data, length);
+    return hash.computeHash();
+}
+
+template <class HASHALG>
+double timeHash(const char           *seed,
+                const unsigned char  *data,
+                size_t                length,
+                int                   numIterations,
+                Uint64               *checksum)
+    // Return the average time, in nanoseconds, taken by the (template
+    // parameter) 'HASHALG', constructed with the specified 'seed', to hash
+    // the specified 'data' having the specified 'length', over the specified
+    // 'numIterations'.  Accumulate the computed hashes into the specified
+    // 'checksum' to prevent the computation from being optimized away.  Note
+    // that the hashed bytes are rotated each iteration so that the hashes are
+    // not loop invariant.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    Uint64 sum = 0;
+    for (int i = 0; i < numIterations; ++i) {
+        HASHALG hash(seed);
+        hash(data + (i & 7), length);
+        sum += hash.computeHash();
+    }
+    timer.stop();
+    *checksum += sum;
+    return timer.accumulatedWallTime() * 1e9 / numIterations;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The hashing algorithm can be used to create more powerful
+        //   components such as functors that can be used to power hash tables.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+// Then, we want to actually use our hash table on 'Future' objects.  We create
+// an array of 'Future's based on data that was originally from some external
+// source:
+
+        Future futures[] = { Future("Swiss Franc", 'F', 2014),
+                             Future("US Dollar", 'G', 2015),
+                             Future("Canadian Dollar", 'Z', 2014),
+                             Future("British Pound", 'M', 2015),
+                             Future("Deutsche Mark", 'X', 2016),
+                             Future("Eurodollar", 'Q', 2017)};
+        enum { NUM_FUTURES = sizeof futures / sizeof *futures };
+
+// Next, we create our HashTable 'hashTable'.  We pass the functor that we
+// defined above as the second argument:
+
+        HashTable<Future, HashFuture> hashTable(futures, NUM_FUTURES);
+
+// Now, we verify that each element in our array registers with count:
+        for ( int i = 0; i < 6; ++i) {
+            ASSERT(hashTable.contains(futures[i]));
+        }
+
+// Finally, we verify that futures not in our original array are correctly
+// identified as not being in the set:
+
+        ASSERT(!hashTable.contains(Future("French Franc", 'N', 2019)));
+        ASSERT(!hashTable.contains(Future("Swiss Franc", 'X', 2014)));
+        ASSERT(!hashTable.contains(Future("US Dollar", 'F', 2014)));
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the 'bslalg::HasTrait'
+        //:   metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        if (verbose) printf("ASSERT the presence of the trait using the"
+                            " 'bslalg::HasTrait' metafunction. (C-1)\n");
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<Xxh3HashAlgorithm>::value);
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_SEED_LENGTH'
+        //   The class is a seeded algorithm and should expose a
+        //   'k_SEED_LENGTH' enum.
+        //
+        // Concerns:
+        //: 1 'k_SEED_LENGTH' is publicly accessible.
+        //:
+        //: 2 'k_SEED_LENGTH' is set to 8.
+        //
+        // Plan:
+        //: 1 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value. (C-1,2)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 8 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'k_SEED_LENGTH'"
+                            "\n=======================\n");
+
+        if (verbose) printf("Access 'k_SEED_LENGTH' and ASSERT it is equal to"
+                            " the expected value. (C-1,2)\n");
+        {
+            ASSERT(8 == Xxh3HashAlgorithm::k_SEED_LENGTH);
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all 'bslh' hashing algorithms
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then assign
+        //:   to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        if (verbose) printf("ASSERT the typedef is accessible and is the"
+                            " correct type using 'bslmf::IsSame'. (C-1)\n");
+        {
+            ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                                  Obj::result_type>::VALUE));
+        }
+
+        if (verbose) printf("Declare the expected signature of 'computeHash()'"
+                            " and then assign to it.  If it compiles, the test"
+                            " passes. (C-2)\n");
+        {
+            Obj::result_type (Obj::*expectedSignature) ();
+
+            expectedSignature = &Obj::computeHash;
+            (void)expectedSignature;
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify the class provides an overload for the function call
+        //   operator that can be called with some bytes and a length.  Verify
+        //   that calling 'operator()' will permute the algorithm's internal
+        //   state as specified by XXH3.  Verify that 'computeHash()' returns
+        //   the final value specified by the canonical XXH3 implementation.
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 'computeHash()' returns the appropriate value according to the
+        //:   XXH3 specification, for inputs of every length class (0, 1-3,
+        //:   4-8, 9-16, 17-128, 129-240, and longer than 240 bytes, including
+        //:   inputs that are longer than the internal buffer and those that
+        //:   span several blocks), with and without a seed.
+        //:
+        //: 3 Given the same bytes, the function call operator will permute the
+        //:   internal state of the algorithm in the same way, regardless of
+        //:   whether the bytes are passed in all at once or in pieces, and
+        //:   regardless of where the pieces are split relative to the
+        //:   internal buffer and stripe boundaries.
+        //:
+        //: 4 Byte sequences passed in to 'operator()' with a length of 0 will
+        //:   not contribute to the final hash.
+        //:
+        //: 5 'computeHash()' does not change the state of the object, so that
+        //:   more data can be hashed afterwards.
+        //:
+        //: 6 An all-zero seed produces the same hashes as the default
+        //:   constructor.
+        //:
+        //: 7 'operator()' does a BSLS_ASSERT for null pointers and non-zero
+        //:   length, and not for null pointers and zero length.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, hash a deterministic byte
+        //:   pattern of various lengths with various seeds, and check the
+        //:   output of 'computeHash()' against the expected results generated
+        //:   by the reference implementation, 'XXH3_64bits_withSeed'.
+        //:   (C-1,2,6)
+        //:
+        //: 2 For each entry in the table, hash the same bytes in chunks of
+        //:   several fixed sizes, interleaved with calls having a length of 0,
+        //:   and verify the result is the expected hash.  (C-3,4)
+        //:
+        //: 3 For every length up to 600 bytes, and every split point, hash
+        //:   the pattern in two pieces and verify the result matches that of
+        //:   hashing it all at once.  (C-3)
+        //:
+        //: 4 Call 'computeHash()' after each chunk of the chunked hash of
+        //:   plan item 2, and verify the final result is unchanged.  (C-5)
+        //:
+        //: 5 Call 'operator()' with a null pointer. (C-7)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                       "\nTESTING 'operator()' AND 'computeHash()'"
+                       "\n========================================\n");
+
+        static const Uint64 SEEDS[] = { 0, 1, 0x0123456789ABCDEFULL };
+
+        static const struct {
+            int    d_line;          // source line number
+            int    d_length;        // number of bytes hashed
+            int    d_seedIndex;     // index into 'SEEDS'
+            Uint64 d_expectedHash;  // hash computed by 'xxhash.h'
+        } DATA[] = {
+            //LINE LENGTH SEED  HASH
+            //---- ------ ----  ---------------------
+            { L_,     0,    0, 0x2D06800538D394C2ULL },
+            { L_,     1,    0, 0x4C5CCA45D0F4811FULL },
+            { L_,     2,    0, 0x29C60963CBFA4E6EULL },
+            { L_,     3,    0, 0x6E3E2670E61106ACULL },
+            { L_,     4,    0, 0x5C4C63133443D03FULL },
+            { L_,     5,    0, 0x49F5EB3111280B63ULL },
+            { L_,     7,    0, 0x46A5C724D51FE43FULL },
+            { L_,     8,    0, 0xF9FD4DD0B04D78F5ULL },
+            { L_,     9,    0, 0x7C20DF9712C26EDFULL },
+            { L_,    15,    0, 0xB345A7B2698BA575ULL },
+            { L_,    16,    0, 0x86ABF6BACCEA0858ULL },
+            { L_,    17,    0, 0xB58BF5DC5022D071ULL },
+            { L_,    31,    0, 0x48442FCD5518B086ULL },
+            { L_,    32,    0, 0xE3712ED84C04A66EULL },
+            { L_,    33,    0, 0xE335C742F3F8ADADULL },
+            { L_,    63,    0, 0x6698079595E6971FULL },
+            { L_,    64,    0, 0xFA6E79F1D9165C99ULL },
+            { L_,    65,    0, 0x76C7E71C2979E602ULL },
+            { L_,    96,    0, 0x4B7A71D881F48AF1ULL },
+            { L_,    97,    0, 0xB934B1130D03818DULL },
+            { L_,   127,    0, 0xD700DBAC20E1553AULL },
+            { L_,   128,    0, 0x2680D5C80A7E0575ULL },
+            { L_,   129,    0, 0x796A1B5A8F163DDBULL },
+            { L_,   200,    0, 0xF05DEFA7D96C565AULL },
+            { L_,   239,    0, 0xD99969B301FC5EA2ULL },
+            { L_,   240,    0, 0xB4E4D3D4178554ADULL },
+            { L_,   241,    0, 0x70F411EA6CFF6E3AULL },
+            { L_,   255,    0, 0x345EB0E2C2CD44AEULL },
+            { L_,   256,    0, 0xDC585501FF13C67DULL },
+            { L_,   257,    0, 0x5DDD35F238998387ULL },
+            { L_,   300,    0, 0x5E4D7D52D170FF66ULL },
+            { L_,   511,    0, 0xFF032C4DC0DFE529ULL },
+            { L_,   512,    0, 0xFC850D3258812F00ULL },
+            { L_,  1023,    0, 0x390D1C4C2E07E9C1ULL },
+            { L_,  1024,    0, 0x9FAF02BA05C8D5C7ULL },
+            { L_,  1025,    0, 0x0470B27E0B3EF6A8ULL },
+            { L_,  2048,    0, 0x1A530B844AA94C4EULL },
+            { L_,  2049,    0, 0x889A942701759CCDULL },
+            { L_,  4096,    0, 0xCDBF944C485EF45EULL },
+            { L_, 10000,    0, 0xD874CC9B82FE2322ULL },
+            { L_,     0,    1, 0x4DC5B0CC826F6703ULL },
+            { L_,     1,    1, 0x0A187BF012ECA100ULL },
+            { L_,     2,    1, 0xDCDA77790BD3AD3BULL },
+            { L_,     3,    1, 0x09B2077206B1496DULL },
+            { L_,     4,    1, 0x16D938BF1343226DULL },
+            { L_,     5,    1, 0x41173453C513EDCFULL },
+            { L_,     7,    1, 0xA35F56F323668CBAULL },
+            { L_,     8,    1, 0xD1129F0BF6E39A1DULL },
+            { L_,     9,    1, 0xF495C810D169A686ULL },
+            { L_,    15,    1, 0x0B3B2C9EDA875107ULL },
+            { L_,    16,    1, 0x216FE4CA42FEF4FFULL },
+            { L_,    17,    1, 0x426160E58ECD06D5ULL },
+            { L_,    31,    1, 0x8A25F5FF02CA64C4ULL },
+            { L_,    32,    1, 0x7F964D5361B090E5ULL },
+            { L_,    33,    1, 0x47A7FEB999AACEF6ULL },
+            { L_,    63,    1, 0xFC9091469A4785A0ULL },
+            { L_,    64,    1, 0x6BF3A7B19A560B32ULL },
+            { L_,    65,    1, 0x0AECB02BAD0EC954ULL },
+            { L_,    96,    1, 0xC546306A01AE9D6CULL },
+            { L_,    97,    1, 0xB32643963D204C05ULL },
+            { L_,   127,    1, 0x32EE9421F8BF8127ULL },
+            { L_,   128,    1, 0x43CD140BF785EDD4ULL },
+            { L_,   129,    1, 0x114708EBED750900ULL },
+            { L_,   200,    1, 0x5C6184F0D0F063DAULL },
+            { L_,   239,    1, 0xC1E1AF76A2061BA0ULL },
+            { L_,   240,    1, 0x65F31F476F30CA6CULL },
+            { L_,   241,    1, 0x19A9CB99749ED3FDULL },
+            { L_,   255,    1, 0x80F8D9DA881BB81EULL },
+            { L_,   256,    1, 0x616159EA137D9E54ULL },
+            { L_,   257,    1, 0xA1FA1D951C4D878FULL },
+            { L_,   300,    1, 0xA64CAA07F9CA6872ULL },
+            { L_,   511,    1, 0xF70ED30F087BCE02ULL },
+            { L_,   512,    1, 0x74F5C4BF568A299CULL },
+            { L_,  1023,    1, 0x75DE46E1DE11AD63ULL },
+            { L_,  1024,    1, 0x3DE30118355641F8ULL },
+            { L_,  1025,    1, 0x867394CB7B79CF14ULL },
+            { L_,  2048,    1, 0xA19F15FFD87BD5D8ULL },
+            { L_,  2049,    1, 0x49D88D331C682217ULL },
+            { L_,  4096,    1, 0x852C70E62EC8B84FULL },
+            { L_, 10000,    1, 0x8F1596A03AEEB364ULL },
+            { L_,     0,    2, 0xCC1CA35A1B089C5CULL },
+            { L_,     1,    2, 0x6DCB95D31DE5966BULL },
+            { L_,     2,    2, 0x567D5B9B9C8A52A7ULL },
+            { L_,     3,    2, 0x911F06F10DDB4CD2ULL },
+            { L_,     4,    2, 0xAC127D990D6A1500ULL },
+            { L_,     5,    2, 0xF9672E909A41D02BULL },
+            { L_,     7,    2, 0x1F0BC6AC217AEAC0ULL },
+            { L_,     8,    2, 0x9C622CA7116E701FULL },
+            { L_,     9,    2, 0x6CCFF5BE3CC44EC4ULL },
+            { L_,    15,    2, 0xECFD996CAB36987DULL },
+            { L_,    16,    2, 0x81EBFA79D47AA6F2ULL },
+            { L_,    17,    2, 0xFD2E9D73F8CCA2D4ULL },
+            { L_,    31,    2, 0x1A82E99247522C93ULL },
+            { L_,    32,    2, 0xDDD67146DD8432E2ULL },
+            { L_,    33,    2, 0xB025A367381D3507ULL },
+            { L_,    63,    2, 0x2E334B97253DD22CULL },
+            { L_,    64,    2, 0xE43D2EC5D7C9B2DFULL },
+            { L_,    65,    2, 0x5D46AD3A6CAA8709ULL },
+            { L_,    96,    2, 0x4B2F9CC00DB91190ULL },
+            { L_,    97,    2, 0x70EC5F57F618A862ULL },
+            { L_,   127,    2, 0x02A25CDD6BE06F84ULL },
+            { L_,   128,    2, 0x81F223FEFC738097ULL },
+            { L_,   129,    2, 0xD7D0AD0D6BF18522ULL },
+            { L_,   200,    2, 0xD6189ABD2C36DABDULL },
+            { L_,   239,    2, 0x25487D197989172DULL },
+            { L_,   240,    2, 0xCE0E6F3B70E89B50ULL },
+            { L_,   241,    2, 0x4B96E8F62478A8ABULL },
+            { L_,   255,    2, 0xF090D113574AAE81ULL },
+            { L_,   256,    2, 0x3D53F132D7FAF700ULL },
+            { L_,   257,    2, 0x3BDD51AD6456D8E5ULL },
+            { L_,   300,    2, 0xFF030E529474B355ULL },
+            { L_,   511,    2, 0x6E2BF69E3BA1BCD0ULL },
+            { L_,   512,    2, 0xDE5A4C6D8B0A5308ULL },
+            { L_,  1023,    2, 0x715A0B7B04EDFB43ULL },
+            { L_,  1024,    2, 0x429202DE41F6C0E9ULL },
+            { L_,  1025,    2, 0xEC9B538B292DFC7FULL },
+            { L_,  2048,    2, 0x514518693C00D2F2ULL },
+            { L_,  2049,    2, 0x321CA10BA9E63D09ULL },
+            { L_,  4096,    2, 0xAA2F3AEE616848AAULL },
+            { L_, 10000,    2, 0x0B671DA67D26AE09ULL },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        enum { k_MAX_LENGTH = 10000 };
+
+        static unsigned char input[k_MAX_LENGTH];
+        fillTestData(input, k_MAX_LENGTH);
+
+        if (verbose) printf("Check the output of 'computeHash()' against the"
+                            " expected results from a known good version of"
+                            " the algorithm. (C-1,2,6)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int    LINE   = DATA[i].d_line;
+                const size_t LENGTH = DATA[i].d_length;
+                const Uint64 SEED   = SEEDS[DATA[i].d_seedIndex];
+                const Uint64 HASH   = DATA[i].d_expectedHash;
+
+                if (veryVerbose) { P_(LINE) P_(LENGTH) P(SEED) }
+
+                ASSERTV(LINE, HASH == seededHash(SEED, input, LENGTH));
+
+                if (0 == SEED) {
+                    Obj hash;
+                    hash(input, LENGTH);
+                    ASSERTV(LINE, HASH == hash.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Hash the bytes in chunks, interleaved with"
+                            " zero-length calls and calls to 'computeHash()'"
+                            ". (C-3,4,5)\n");
+        {
+            static const size_t CHUNKS[] = {
+                1, 3, 7, 16, 63, 64, 65, 100, 240, 255, 256, 257, 1000
+            };
+            const int NUM_CHUNKS = sizeof CHUNKS / sizeof *CHUNKS;
+
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int    LINE   = DATA[i].d_line;
+                const size_t LENGTH = DATA[i].d_length;
+                const Uint64 SEED   = SEEDS[DATA[i].d_seedIndex];
+                const Uint64 HASH   = DATA[i].d_expectedHash;
+
+                char seedBytes[Obj::k_SEED_LENGTH];
+                for (int k = 0; k < Obj::k_SEED_LENGTH; ++k) {
+                    seedBytes[k] = static_cast<char>(SEED >> (8 * k));
+                }
+
+                for (int j = 0; j != NUM_CHUNKS; ++j) {
+                    const size_t CHUNK = CHUNKS[j];
+
+                    if (veryVeryVerbose) { P_(LINE) P(CHUNK) }
+
+                    Obj hash(seedBytes);
+                    for (size_t offset = 0; offset < LENGTH; offset += CHUNK) {
+                        const size_t n = LENGTH - offset < CHUNK
+                                       ? LENGTH - offset
+                                       : CHUNK;
+                        hash(input + offset, n);
+                        hash(input, 0);
+                        hash.computeHash();
+                    }
+                    ASSERTV(LINE, CHUNK, HASH == hash.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Hash the bytes in two pieces, for every split"
+                            " point. (C-3)\n");
+        {
+            for (size_t length = 0; length <= 600; ++length) {
+                const Uint64 EXP0 = seededHash(0, input, length);
+                const Uint64 EXP1 = seededHash(SEEDS[2], input, length);
+
+                for (size_t split = 0; split <= length; ++split) {
+                    Obj hash0;
+                    hash0(input,         split);
+                    hash0(input + split, length - split);
+                    ASSERTV(length, split, EXP0 == hash0.computeHash());
+
+                    char seedBytes[Obj::k_SEED_LENGTH];
+                    for (int k = 0; k < Obj::k_SEED_LENGTH; ++k) {
+                        seedBytes[k] = static_cast<char>(SEEDS[2] >> (8 * k));
+                    }
+                    Obj hash1(seedBytes);
+                    hash1(input,         split);
+                    hash1(input + split, length - split);
+                    ASSERTV(length, split, EXP1 == hash1.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Verify different seeds produce different"
+                            " hashes.\n");
+        {
+            static const size_t LENGTHS[] = { 0, 3, 8, 16, 100, 200, 1000 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int i = 0; i != NUM_LENGTHS; ++i) {
+                const size_t LENGTH = LENGTHS[i];
+
+                ASSERTV(LENGTH, seededHash(0, input, LENGTH) !=
+                                              seededHash(1, input, LENGTH));
+                ASSERTV(LENGTH, seededHash(1, input, LENGTH) !=
+                                              seededHash(2, input, LENGTH));
+            }
+        }
+
+        if (verbose) printf("Call 'operator()' with null pointers. (C-7)\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj().operator()(   0, 5));
+            ASSERT_PASS(Obj().operator()(   0, 0));
+            ASSERT_PASS(Obj().operator()(data, 5));
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the implicit destructor as well as the explicit
+        //   default and parameterized constructors are publicly callable.
+        //   Verify that the algorithm can be instantiated with or without a
+        //   seed.  Note that a null pointer is not tested here, because there
+        //   is no way to perform a BSLS_ASSERT before dereferenceing the
+        //   pointer (without a performance penalty).
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be created using the parameterized constructor.
+        //:
+        //: 3 Objects can be destroyed.
+        //
+        // Plan:
+        //: 1 Create a default constructed 'Xxh3HashAlgorithm' and allow it
+        //:   to leave scope to be destroyed. (C-1,3)
+        //:
+        //: 2 Call the parameterized constructor with a seed. (C-2)
+        //
+        // Testing:
+        //   Xxh3HashAlgorithm();
+        //   Xxh3HashAlgorithm(const char *seed);
+        //   ~Xxh3HashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nTESTING CREATORS"
+                   "\n================\n");
+
+        if (verbose) printf("Create a default constructed"
+                            " 'Xxh3HashAlgorithm' and allow it to leave"
+                            " scope to be destroyed. (C-1,3)\n");
+        {
+            Obj alg1;
+        }
+
+        if (verbose) printf("Call the parameterized constructor with a seed."
+                            " (C-2)\n");
+        {
+            const char seed[Obj::k_SEED_LENGTH] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+            Obj alg1(seed);
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bsl::Xxh3HashAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings. (C-1)
+        //:
+        //: 4 Verify different hashes are produced for different 'int's. (C-1)
+        //:
+        //: 5 Verify the same hashes are produced for the same 'int's. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) printf("Instantiate 'bsl::Xxh3HashAlgorithm'\n");
+        {
+            Xxh3HashAlgorithm hashAlg;
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different c-strings.\n");
+        {
+            Xxh3HashAlgorithm hashAlg1;
+            Xxh3HashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Goodbye World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " c-strings.\n");
+        {
+            Xxh3HashAlgorithm hashAlg1;
+            Xxh3HashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Hello World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different 'int's.\n");
+        {
+            Xxh3HashAlgorithm hashAlg1;
+            Xxh3HashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 654321;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " 'int's.\n");
+        {
+            Xxh3HashAlgorithm hashAlg1;
+            Xxh3HashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 123456;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the time taken by 'Xxh3HashAlgorithm' to hash keys of
+        //   various sizes with that taken by 'SpookyHashAlgorithm' and
+        //   'SipHashAlgorithm'.
+        //
+        // Concerns:
+        //: 1 'Xxh3HashAlgorithm' is faster than the other 'bslh' algorithms
+        //:   on short keys, and has a higher throughput on long keys.
+        //
+        // Plan:
+        //: 1 For each key size, hash a key of that size, one algorithm object
+        //:   per key, many times with each algorithm, and report the average
+        //:   time per hash and the throughput.  The number of iterations can
+        //:   be scaled by passing a factor as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        const int SCALE = argc > 2 ? atoi(argv[2]) : 1;
+
+        static const size_t SIZES[] = {
+            1, 4, 8, 12, 16, 24, 32, 48, 64, 96, 128, 200, 240, 256, 512,
+            1024, 4096, 65536
+        };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        enum { k_MAX_SIZE = 65536 + 8 };
+
+        static unsigned char data[k_MAX_SIZE];
+        fillTestData(data, k_MAX_SIZE);
+
+        const char seed[16] = {
+            0x1B, 0x11, 0x7C, 0x2A, 0x70, 0x2B, 0x10, 0x75,
+            0x78, 0x37, 0x47, 0x41, 0x77, 0x00, 0x09, 0x73
+        };
+
+        Uint64 checksum = 0;
+
+        printf("%8s %21s %21s %21s\n",
+               "bytes",
+               "XXH3 ns (GB/s)",
+               "Spooky ns (GB/s)",
+               "SipHash ns (GB/s)");
+
+        for (int i = 0; i != NUM_SIZES; ++i) {
+            const size_t SIZE = SIZES[i];
+            const int    ITER = static_cast<int>(SCALE
+                                    * (20000000 / (SIZE + 32) + 1000));
+
+            const double xxh3 = timeHash<Xxh3HashAlgorithm>(
+                                          seed, data, SIZE, ITER, &checksum);
+            const double spooky = timeHash<SpookyHashAlgorithm>(
+                                          seed, data, SIZE, ITER, &checksum);
+            const double sip = timeHash<SipHashAlgorithm>(
+                                          seed, data, SIZE, ITER, &checksum);
+
+            printf("%8d %10.1f (%8.2f) %10.1f (%8.2f) %10.1f (%8.2f)\n",
+                   static_cast<int>(SIZE),
+                   xxh3,   static_cast<double>(SIZE) / xxh3,
+                   spooky, static_cast<double>(SIZE) / spooky,
+                   sip,    static_cast<double>(SIZE) / sip);
+        }
+
+        if (veryVerbose) { P(checksum) }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
+
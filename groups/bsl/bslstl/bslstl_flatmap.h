@@ -0,0 +1,1905 @@
+// bslstl_flatmap.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMAP
+#define INCLUDED_BSLSTL_FLATMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map of unique keys held in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_map: ordered key-value map container with contiguous storage
+//
+//@SEE_ALSO: bslstl_flatmultimap, bslstl_flatset, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_map', implementing an ordered associative container mapping
+// unique keys to values, in the manner of 'bsl::map', but storing its
+// key-value pairs contiguously, in key order, in a 'bsl::vector' rather than
+// in the nodes of a balanced binary tree.  The interface follows that of
+// 'std::flat_map' (C++23) where that is practical for C++03, with one
+// notable difference: the key-value pairs are held in a single vector, rather
+// than in separate vectors of keys and of values, so that 'value_type' is
+// 'bsl::pair<KEY, VALUE>' and 'iterator' is a pointer to such a pair.
+//
+// An instantiation of 'flat_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of key-value pairs) and the
+// ordered sequence of key-value pairs the 'flat_map' contains.  If 'flat_map'
+// is instantiated with a key type or mapped-value type that is not itself
+// value-semantic, then it will not retain all of its value-semantic qualities.
+//
+// The trade-offs between 'flat_map' and 'bsl::map' are those described for
+// 'flat_set' and 'bsl::set' in {'bslstl_flatset'}: much faster iteration,
+// lookup, and bulk construction, at the cost of linear-time insertion and
+// erasure of single entries, and of invalidating iterators on every insertion
+// or erasure.  Both 'KEY' and 'VALUE' must be 'move-insertable' and
+// 'move-assignable' for any method that modifies the map.
+//
+///Modifying Keys
+///--------------
+// Since 'value_type' is 'bsl::pair<KEY, VALUE>' (rather than the
+// 'bsl::pair<const KEY, VALUE>' of 'bsl::map'), which allows the pairs to be
+// moved within the underlying vector, the 'first' member of an element
+// referred to by an 'iterator' is modifiable.  The behavior is undefined if
+// the key of an element is modified through an 'iterator' other than by a
+// modification that leaves it equivalent to its original value.
+//
+///Operations
+///----------
+// The run-time complexity of the operations on 'flat_map' is that of the
+// corresponding operations on 'flat_set' (see {'bslstl_flatset'}), with the
+// addition of:
+//..
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | a[k], a.at(k)                                      | O[log(n)] if 'k'   |
+//  |                                                    | is present; O[n]   |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Table of Status Descriptions
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that a web server must describe each HTTP status code it returns.
+// The descriptions are fixed when the server starts, and are looked up for
+// every response; a 'flat_map' is ideal for such a table.
+//
+// First, we define the table in no particular order:
+//..
+//  typedef bsl::pair<int, const char *> Entry;
+//
+//  const Entry ENTRIES[] = {
+//      Entry(404, "Not Found"),
+//      Entry(200, "OK"),
+//      Entry(500, "Internal Server Error"),
+//      Entry(301, "Moved Permanently"),
+//      Entry(304, "Not Modified"),
+//  };
+//  const int NUM_ENTRIES = sizeof ENTRIES / sizeof *ENTRIES;
+//..
+// Then, we build a 'flat_map' from the table, which sorts it in a single step:
+//..
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  bsl::flat_map<int, const char *> descriptions(ENTRIES,
+//                                                ENTRIES + NUM_ENTRIES,
+//                                                &oa);
+//  assert(NUM_ENTRIES == descriptions.size());
+//..
+// Next, we look up some codes:
+//..
+//  assert(0 == strcmp("OK", descriptions.at(200)));
+//  assert(descriptions.end() == descriptions.find(418));
+//..
+// Then, we add a description that was missing, using 'operator[]':
+//..
+//  descriptions[418] = "I'm a teapot";
+//  assert(0 == strcmp("I'm a teapot", descriptions.find(418)->second));
+//..
+// Finally, we observe that iteration visits the codes in order:
+//..
+//  int previous = 0;
+//  for (bsl::flat_map<int, const char *>::const_iterator it =
+//                                                       descriptions.begin();
+//       it != descriptions.end();
+//       ++it) {
+//      assert(previous < it->first);
+//      previous = it->first;
+//  }
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flattreeutil.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_stdexceptutil.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_swaputil.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_destructorguard.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_addlvaluereference.h>
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_nativestd.h>
+#include <bsls_objectbuffer.h>
+
+#include <algorithm>
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                              // ==============
+                              // class flat_map
+                              // ==============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<bsl::pair<KEY, VALUE> > >
+class flat_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys (of the
+    // template parameter type 'KEY') mapped to values (of the template
+    // parameter type 'VALUE') in contiguous storage.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   except for 'BDEX' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef bsl::pair<KEY, VALUE>                                  ValueType;
+        // This typedef is an alias for the type of the elements of this map.
+
+    typedef BloombergLP::bslstl::UnorderedMapKeyConfiguration<KEY, ValueType>
+                                                                   KeyConfig;
+        // This typedef is an alias for the policy used to extract the key from
+        // an element of this map.
+
+    typedef BloombergLP::bslstl::FlatTreeUtil                      TreeUtil;
+        // This typedef is an alias for the utility implementing the searching
+        // and ordering of the elements of this map.
+
+    typedef BloombergLP::bslmf::MovableRefUtil                     MoveUtil;
+        // This typedef is a convenient alias for the utility associated with
+        // movable references.
+
+    typedef bsl::allocator_traits<ALLOCATOR>                 AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                       key_type;
+    typedef VALUE                                     mapped_type;
+    typedef ValueType                                 value_type;
+    typedef COMPARATOR                                key_compare;
+    typedef ALLOCATOR                                 allocator_type;
+    typedef bsl::vector<value_type, ALLOCATOR>        container_type;
+    typedef value_type&                               reference;
+    typedef const value_type&                         const_reference;
+
+    typedef typename container_type::size_type        size_type;
+    typedef typename container_type::difference_type  difference_type;
+    typedef typename container_type::pointer          pointer;
+    typedef typename container_type::const_pointer    const_pointer;
+
+    typedef typename container_type::iterator         iterator;
+    typedef typename container_type::const_iterator   const_iterator;
+    typedef bsl::reverse_iterator<iterator>           reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by adapting an object of (template parameter) type
+        // 'COMPARATOR', which compares two objects of (template parameter)
+        // type 'KEY'.
+
+        // FRIENDS
+        friend class flat_map;
+
+      protected:
+        // PROTECTED DATA
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member 'protected'
+
+        // PROTECTED CREATORS
+        value_compare(COMPARATOR comparator)                        // IMPLICIT
+            // Create a 'value_compare' object that uses the specified
+            // 'comparator'.
+        : comp(comparator)
+        {
+        }
+
+      public:
+        // PUBLIC TYPES
+        typedef bool       result_type;
+        typedef value_type first_argument_type;
+        typedef value_type second_argument_type;
+
+        // ACCESSORS
+        bool operator()(const value_type& x, const value_type& y) const
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction, and 'false' otherwise.
+        {
+            return comp(x.first, y.first);
+        }
+    };
+
+  private:
+    // DATA
+    COMPARATOR     d_comparator;  // orders the keys
+    container_type d_data;        // key-value pairs, in key order
+
+  public:
+    // CREATORS
+    flat_map();
+    explicit flat_map(const COMPARATOR& comparator,
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty map.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.  Note that a 'bslma::Allocator *' can be
+        // supplied for 'basicAllocator' if the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+    : d_comparator(comparator)
+    , d_data(basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug (see 'bslstl_map').
+    }
+
+    explicit flat_map(const ALLOCATOR& basicAllocator);
+        // Create an empty map that uses the specified 'basicAllocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // map.  Note that a 'bslma::Allocator *' can be supplied for
+        // 'basicAllocator' if the (template parameter) type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    flat_map(const flat_map& original);
+        // Create a map having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this map.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.
+
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original);    // IMPLICIT
+        // Create a map having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new map.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this map.  The allocator associated with 'original' is
+        // propagated for use in the newly-created map.  'original' is left in
+        // a valid but unspecified state.
+
+    flat_map(const flat_map& original, const ALLOCATOR& basicAllocator);
+        // Create a map having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this map.  Note that a 'bslma::Allocator *' can be supplied for
+        // 'basicAllocator' if the (template parameter) type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original,
+             const ALLOCATOR&                         basicAllocator);
+        // Create a map having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // map if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.  Use a copy of
+        // 'original.key_comp()' to order the keys contained in this map.
+
+    explicit flat_map(
+           BloombergLP::bslmf::MovableRef<container_type> container,
+           const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+        // Create a map holding the key-value pairs in the specified
+        // 'container', which is adopted (in constant time) as the underlying
+        // sequence of this map and then sorted by key, keeping only the first
+        // of any pairs having equivalent keys.  Optionally specify a
+        // 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  This map uses the
+        // allocator of 'container'.  'container' is left in a valid but
+        // unspecified state.
+
+    flat_map(sorted_unique_t,
+             BloombergLP::bslmf::MovableRef<container_type> container,
+             const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+        // Create a map holding the key-value pairs in the specified
+        // 'container', which is adopted (in constant time) as the underlying
+        // sequence of this map.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  This map uses the allocator of
+        // 'container'.  'container' is left in a valid but unspecified state.
+        // The behavior is undefined unless the keys in 'container' are
+        // strictly ordered according to 'comparator'.
+
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const ALLOCATOR&  basicAllocator);
+        // Create a map, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those pairs having a
+        // key equivalent to that which appears earlier in the sequence.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.  If the type
+        // 'ALLOCATOR' is 'bsl::allocator' and 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.  The
+        // pairs are appended to the underlying sequence and then sorted as a
+        // whole, so that this operation has 'O[N]' complexity if the sequence
+        // is ordered according to 'comparator', and 'O[N * log(N)]'
+        // complexity otherwise, where 'N' is the number of elements between
+        // 'first' and 'last'.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  Note that a 'bslma::Allocator *' can
+        // be supplied for 'basicAllocator' if the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const ALLOCATOR&  basicAllocator);
+        // Create a map holding the key-value pairs in the sequence starting at
+        // the specified 'first' element, and ending immediately before the
+        // specified 'last' element, in 'O[N]' time, where 'N' is the number of
+        // elements in the sequence.  Optionally specify a 'comparator' and a
+        // 'basicAllocator' as for the constructor above.  The behavior is
+        // undefined unless the keys of the sequence are strictly ordered
+        // according to 'comparator'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_map(std::initializer_list<value_type> values,
+             const COMPARATOR&                 comparator = COMPARATOR(),
+             const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+    flat_map(std::initializer_list<value_type> values,
+             const ALLOCATOR&                  basicAllocator);
+        // Create a map and insert each 'value_type' object in the specified
+        // 'values' initializer list, ignoring those pairs having a key
+        // equivalent to that which appears earlier in the list.  Optionally
+        // specify a 'comparator' and a 'basicAllocator' as for the range
+        // constructor above.
+#endif
+
+    ~flat_map();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_map& operator=(const flat_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // If an exception is thrown, '*this' is left in a valid but
+        // unspecified state.
+
+    flat_map& operator=(BloombergLP::bslmf::MovableRef<flat_map> rhs)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_move_assignment',
+        // and return a reference providing modifiable access to this object.
+        // The contents of 'rhs' are moved (in constant time) to this map if
+        // 'get_allocator() == rhs.get_allocator()' (after accounting for the
+        // aforementioned trait); otherwise, the pairs of 'rhs' are
+        // move-inserted into this map.  'rhs' is left in a valid but
+        // unspecified state, and if an exception is thrown, '*this' is left
+        // in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_map& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // map and then inserting each 'value_type' object in the specified
+        // 'values' initializer list, ignoring those pairs having a key
+        // equivalent to that which appears earlier in the list; return a
+        // reference providing modifiable access to this object.
+#endif
+
+    typename add_lvalue_reference<VALUE>::type operator[](const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key'; if this 'flat_map' does not
+        // already contain a 'value_type' object having an equivalent key,
+        // first insert a new 'value_type' object having 'key' and a
+        // default-constructed 'VALUE' object, and return a reference to the
+        // newly mapped (default) value.
+
+    typename add_lvalue_reference<VALUE>::type operator[](
+                                 BloombergLP::bslmf::MovableRef<key_type> key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key'; if this 'flat_map' does not
+        // already contain a 'value_type' object having an equivalent key,
+        // first insert a new 'value_type' object having the move-inserted
+        // 'key' and a default-constructed 'VALUE' object, and return a
+        // reference to the newly mapped (default) value.
+
+    typename add_lvalue_reference<VALUE>::type at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key', if such an entry exists;
+        // otherwise, throw a 'std::out_of_range' exception.  Note that this
+        // method may also throw a different kind of exception if the
+        // (user-supplied) comparator throws.
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this map.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or 'rend' if this map is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    pair<iterator, bool> insert(const value_type& value);
+    pair<iterator, bool> insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this map if a key equivalent to
+        // that of 'value' does not already exist in this map; otherwise, if a
+        // key equivalent to that of 'value' already exists in this map, this
+        // method has no effect.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) 'value_type'
+        // object in this map whose key is equivalent to that of 'value', and
+        // whose 'second' member is 'true' if a new value was inserted, and
+        // 'false' if the key was already present.  This operation has 'O[N]'
+        // complexity, where 'N' is the size of this map, and invalidates all
+        // iterators to this map if a value is inserted.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this map (in constant time, plus
+        // the time to move the pairs that follow it, if the specified 'hint'
+        // is the position immediately following the position of 'value' in
+        // the ordered sequence of pairs, and in logarithmic time plus that
+        // time otherwise) if a key equivalent to that of 'value' does not
+        // already exist in this map; otherwise, this method has no effect.
+        // Return an iterator referring to the (possibly newly inserted)
+        // 'value_type' object whose key is equivalent to that of 'value'.
+        // The behavior is undefined unless 'hint' is an iterator in the range
+        // '[begin() .. end()]' (both endpoints included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to that of the object is neither already contained in
+        // this map nor earlier in the range.  The pairs are appended to the
+        // underlying sequence and then merged with it (see
+        // 'bslstl_flattreeutil'), so that this operation has
+        // 'O[N + M * log(M)]' complexity, where 'N' is the size of this map
+        // and 'M' is the length of the range.  If an exception is thrown while
+        // the range is being appended, this map is left unchanged; if one is
+        // thrown while the pairs are being ordered, this map is left empty.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or before
+        // 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to that of the object is not already contained in this
+        // map.  The behavior is undefined unless the keys of the range are
+        // strictly ordered according to 'key_comp()'.  Note that this
+        // operation has 'O[N + M]' complexity, where 'N' is the size of this
+        // map and 'M' is the length of the range.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this map the value of each 'value_type' object in the
+        // specified 'values' initializer list if a key equivalent to that of
+        // the object is neither already contained in this map nor earlier in
+        // the list.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... Args>
+    pair<iterator, bool> emplace(Args&&... arguments);
+        // Insert into this map a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', if a key equivalent to that of such a
+        // value does not already exist in this map; otherwise, this method has
+        // no effect (other than possibly creating a temporary 'value_type'
+        // object).  Return a pair whose 'first' member is an iterator
+        // referring to the (possibly newly created and inserted) object in
+        // this map whose key is equivalent to that of an object constructed
+        // from 'arguments', and whose 'second' member is 'true' if a new value
+        // was inserted, and 'false' if an equivalent key was already present.
+        // The new object is constructed at the end of the underlying sequence
+        // and then rotated into position.
+
+    template <class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... arguments);
+        // Insert into this map a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', if a key equivalent to that of such a
+        // value does not already exist in this map; otherwise, this method has
+        // no effect (other than possibly creating a temporary 'value_type'
+        // object).  Return an iterator referring to the (possibly newly
+        // created and inserted) object in this map whose key is equivalent to
+        // that of an object constructed from 'arguments'.  The specified
+        // 'hint' is accepted for compatibility with 'bsl::map', and is not
+        // used.  The behavior is undefined unless 'hint' is an iterator in the
+        // range '[begin() .. end()]' (both endpoints included).
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this map.  This method
+        // invalidates all iterators at or after 'position'.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // map.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the 'value_type' object whose key is equivalent
+        // to the specified 'key', if such an entry exists, and return 1;
+        // otherwise, if there is no 'value_type' object having an equivalent
+        // key, return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this map or
+        // are the 'end' iterator, and the 'first' position is at or before the
+        // 'last' position in the ordered sequence provided by this container.
+
+    void swap(flat_map& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with the value and
+        // comparator of the specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees 'O[1]' complexity if either allocators are exchanged or
+        // this object was created with the same allocator as 'other' (unless
+        // swapping the (user-supplied) comparators throws); otherwise, it
+        // has 'O[n + m]' complexity, where 'n' and 'm' are the sizes of this
+        // object and 'other', respectively.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this map.  Note that the map is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    void reserve(size_type numPairs);
+        // Change the capacity of this map to at least the specified
+        // 'numPairs'.  If an exception is thrown, this map is left unchanged.
+        // Note that this method has no effect if the current capacity meets
+        // or exceeds the required capacity.
+
+    void shrink_to_fit();
+        // Minimize the memory used by this map to the extent possible without
+        // moving any pairs.
+
+    // Turn off complaints about necessarily class-defined methods.
+    // BDE_VERIFY pragma: push
+    // BDE_VERIFY pragma: -CD01
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    erase(const LOOKUP_KEY& key)
+        // Remove from this map the 'value_type' objects whose keys are
+        // equivalent to the specified 'key', and return the number of objects
+        // removed.  Note that although a map maintains unique keys, the
+        // returned value can be other than 0 or 1, because a transparent
+        // comparator may have been supplied that provides a different (but
+        // compatible) partitioning of keys for 'LOOKUP_KEY' as the comparisons
+        // used to order the keys in the map.
+    {
+        const pair<iterator, iterator> range = equal_range(key);
+        const size_type numErased = range.second - range.first;
+        d_data.erase(range.first, range.second);
+        return numErased;
+    }
+
+    iterator find(const key_type& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map whose key is equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+    {
+        iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map whose key is equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+    {
+        iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    iterator lower_bound(const key_type& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain such an object.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain such an object.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    iterator upper_bound(const key_type& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is greater
+        // than the specified 'key', and the past-the-end iterator if this map
+        // does not contain such an object.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is greater
+        // than the specified 'key', and the past-the-end iterator if this map
+        // does not contain such an object.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  Note that since a map
+        // maintains unique keys, the range will contain at most one element.
+    {
+        iterator startIt = lower_bound(key);
+        iterator endIt   = startIt;
+        if (endIt != end() && !d_comparator(key, endIt->first)) {
+            ++endIt;
+        }
+        return pair<iterator, iterator>(startIt, endIt);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  Note that although a
+        // map maintains unique keys, the range may contain more than one
+        // element, because a transparent comparator may have been supplied
+        // that provides a different (but compatible) partitioning of keys for
+        // 'LOOKUP_KEY' as the comparisons used to order the keys in the map.
+    {
+        iterator startIt = lower_bound(key);
+        return pair<iterator, iterator>(
+                         startIt,
+                         TreeUtil::upperBound<KeyConfig>(startIt,
+                                                         d_data.end(),
+                                                         key,
+                                                         d_comparator));
+    }
+
+    // BDE_VERIFY pragma: pop
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    typename add_lvalue_reference<const VALUE>::type at(const key_type& key)
+                                                                         const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with a key that is equivalent to the
+        // specified 'key', if such an entry exists; otherwise, throw a
+        // 'std::out_of_range' exception.  Note that this method may also throw
+        // a different kind of exception if the (user-supplied) comparator
+        // throws.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this map.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'rend' if this map is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'cend' iterator if this map is empty.
+
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this map.
+
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'crend' if this map is empty.
+
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this map.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of key-value pairs this map can hold without
+        // allocating memory.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // map; if a comparator was supplied at construction, return its value,
+        // otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by comparing
+        // their keys using 'key_comp()'.
+
+    const container_type& sequence() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reference providing non-modifiable access to the vector
+        // holding the key-value pairs of this map, in key order.
+
+    // Turn off complaints about necessarily class-defined methods.
+    // BDE_VERIFY pragma: push
+    // BDE_VERIFY pragma: -CD01
+
+    const_iterator find(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    bool contains(const key_type& key) const
+        // Return 'true' if this map contains a 'value_type' object whose key
+        // is equivalent to the specified 'key', and 'false' otherwise.
+    {
+        return find(key) != end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this map contains a 'value_type' object whose key
+        // is equivalent to the specified 'key', and 'false' otherwise.
+    {
+        return find(key) != end();
+    }
+
+    size_type count(const key_type& key) const
+        // Return the number of 'value_type' objects within this map whose keys
+        // are equivalent to the specified 'key'.  Note that since a map
+        // maintains unique keys, the returned value will be either 0 or 1.
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this map whose keys
+        // are equivalent to the specified 'key'.  Note that although a map
+        // maintains unique keys, the returned value can be other than 0 or 1,
+        // because a transparent comparator may have been supplied that
+        // provides a different (but compatible) partitioning of keys for
+        // 'LOOKUP_KEY' as the comparisons used to order the keys in the map.
+    {
+        const pair<const_iterator, const_iterator> range = equal_range(key);
+        return range.second - range.first;
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain such an object.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain such an object.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this map does not contain such an object.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this map does not contain such an object.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  Note that since a map
+        // maintains unique keys, the range will contain at most one element.
+    {
+        const_iterator startIt = lower_bound(key);
+        const_iterator endIt   = startIt;
+        if (endIt != end() && !d_comparator(key, endIt->first)) {
+            ++endIt;
+        }
+        return pair<const_iterator, const_iterator>(startIt, endIt);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  Note that although a
+        // map maintains unique keys, the range may contain more than one
+        // element, because a transparent comparator may have been supplied
+        // that provides a different (but compatible) partitioning of keys for
+        // 'LOOKUP_KEY' as the comparisons used to order the keys in the map.
+    {
+        const_iterator startIt = lower_bound(key);
+        return pair<const_iterator, const_iterator>(
+                         startIt,
+                         TreeUtil::upperBound<KeyConfig>(startIt,
+                                                         d_data.end(),
+                                                         key,
+                                                         d_comparator));
+    }
+
+    // BDE_VERIFY pragma: pop
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_map' objects 'lhs' and 'rhs'
+    // have the same value if they have the same number of key-value pairs, and
+    // each element in the ordered sequence of key-value pairs of 'lhs' has the
+    // same value as the corresponding element in the ordered sequence of
+    // key-value pairs of 'rhs'.  This method requires that the (template
+    // parameter) types 'KEY' and 'VALUE' both be 'equality-comparable'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_map' objects 'lhs' and
+    // 'rhs' do not have the same value if they do not have the same number of
+    // key-value pairs, or some element in the ordered sequence of key-value
+    // pairs of 'lhs' does not have the same value as the corresponding element
+    // in the ordered sequence of key-value pairs of 'rhs'.  This method
+    // requires that the (template parameter) types 'KEY' and 'VALUE' both be
+    // 'equality-comparable'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than that of the specified 'rhs' map, and 'false'
+    // otherwise (see 'bsl::map').  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than that of the specified 'rhs' map, and
+    // 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than or equal to that of the specified 'rhs' map,
+    // and 'false' otherwise.  Note that this operator returns '!(rhs < lhs)'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // map, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with the
+    // value and comparator of the specified 'b' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'a' with that of 'b'.  See the
+    // 'swap' method for complexity and exception-safety guarantees.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                              // --------------
+                              // class flat_map
+                              // --------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map()
+: d_comparator()
+, d_data()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                               const ALLOCATOR& basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                      const flat_map& original)
+: d_comparator(original.d_comparator)
+, d_data(original.d_data)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                             BloombergLP::bslmf::MovableRef<flat_map> original)
+: d_comparator(MoveUtil::access(original).d_comparator)
+, d_data(MoveUtil::move(MoveUtil::access(original).d_data))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              const flat_map&  original,
+                                              const ALLOCATOR& basicAllocator)
+: d_comparator(original.d_comparator)
+, d_data(original.d_data, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                       BloombergLP::bslmf::MovableRef<flat_map> original,
+                       const ALLOCATOR&                         basicAllocator)
+: d_comparator(MoveUtil::access(original).d_comparator)
+, d_data(MoveUtil::move(MoveUtil::access(original).d_data), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                 BloombergLP::bslmf::MovableRef<container_type> container,
+                 const COMPARATOR&                              comparator)
+: d_comparator(comparator)
+, d_data(MoveUtil::move(container))
+{
+    TreeUtil::mergeTailUnique<KeyConfig>(&d_data, 0, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                 sorted_unique_t,
+                 BloombergLP::bslmf::MovableRef<container_type> container,
+                 const COMPARATOR&                              comparator)
+: d_comparator(comparator)
+, d_data(MoveUtil::move(container))
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSortedUnique<KeyConfig>(d_data.begin(),
+                                                         d_data.end(),
+                                                         d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const COMPARATOR& comparator,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator(comparator)
+, d_data(basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                       sorted_unique_t,
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const COMPARATOR& comparator,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator(comparator)
+, d_data(first, last, basicAllocator)
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSortedUnique<KeyConfig>(d_data.begin(),
+                                                         d_data.end(),
+                                                         d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                       sorted_unique_t,
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator()
+, d_data(first, last, basicAllocator)
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSortedUnique<KeyConfig>(d_data.begin(),
+                                                         d_data.end(),
+                                                         d_comparator));
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                             std::initializer_list<value_type> values,
+                             const COMPARATOR&                 comparator,
+                             const ALLOCATOR&                  basicAllocator)
+: d_comparator(comparator)
+, d_data(basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                             std::initializer_list<value_type> values,
+                             const ALLOCATOR&                  basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~flat_map()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const flat_map& rhs)
+{
+    if (this != &rhs) {
+        d_data       = rhs.d_data;
+        d_comparator = rhs.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                  BloombergLP::bslmf::MovableRef<flat_map> rhs)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    flat_map& lvalue = rhs;
+
+    if (this != &lvalue) {
+        d_data       = MoveUtil::move(lvalue.d_data);
+        d_comparator = lvalue.d_comparator;
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename add_lvalue_reference<VALUE>::type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](const key_type& key)
+{
+    iterator it = lower_bound(key);
+    if (it == end() || d_comparator(key, it->first)) {
+        BloombergLP::bsls::ObjectBuffer<VALUE> temp;  // for default 'VALUE'
+
+        ALLOCATOR alloc = d_data.get_allocator();
+
+        AllocatorTraits::construct(alloc, temp.address());
+
+        BloombergLP::bslma::DestructorGuard<VALUE> guard(temp.address());
+
+        // Unfortunately, in C++03, there are user types where a MovableRef
+        // will not safely degrade to a lvalue reference when a move
+        // constructor is not available, so 'move' cannot be used directly on a
+        // user supplied type (see 'bslstl_map').
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        return d_data.emplace(it,
+                              key,
+                              MoveUtil::move(temp.object()))->second; // RETURN
+#else
+        return d_data.emplace(it, key, temp.object())->second;        // RETURN
+#endif
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename add_lvalue_reference<VALUE>::type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](
+                                  BloombergLP::bslmf::MovableRef<key_type> key)
+{
+    key_type& lvalue = key;
+
+    iterator it = lower_bound(lvalue);
+    if (it == end() || d_comparator(lvalue, it->first)) {
+        BloombergLP::bsls::ObjectBuffer<VALUE> temp;  // for default 'VALUE'
+
+        ALLOCATOR alloc = d_data.get_allocator();
+
+        AllocatorTraits::construct(alloc, temp.address());
+
+        BloombergLP::bslma::DestructorGuard<VALUE> guard(temp.address());
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        return d_data.emplace(it,
+                              MoveUtil::move(lvalue),
+                              MoveUtil::move(temp.object()))->second; // RETURN
+#else
+        return d_data.emplace(it, lvalue, temp.object())->second;     // RETURN
+#endif
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename add_lvalue_reference<VALUE>::type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    iterator it = find(key);
+    if (it == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    iterator it = lower_bound(value.first);
+    if (it != end() && !d_comparator(value.first, it->first)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(d_data.insert(it, value), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    iterator it = lower_bound(lvalue.first);
+    if (it != end() && !d_comparator(lvalue.first, it->first)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(d_data.insert(it, MoveUtil::move(lvalue)),
+                                true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                    const value_type& value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint);
+    BSLS_ASSERT_SAFE(hint     <= cend());
+
+    if ((hint == cend()   || d_comparator(value.first, hint->first))
+     && (hint == cbegin() || d_comparator((hint - 1)->first, value.first))) {
+        return d_data.insert(hint, value);                            // RETURN
+    }
+    return insert(value).first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint);
+    BSLS_ASSERT_SAFE(hint     <= cend());
+
+    value_type& lvalue = value;
+
+    if ((hint == cend()   || d_comparator(lvalue.first, hint->first))
+     && (hint == cbegin() || d_comparator((hint - 1)->first, lvalue.first))) {
+        return d_data.insert(hint, MoveUtil::move(lvalue));           // RETURN
+    }
+    return insert(MoveUtil::move(lvalue)).first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    TreeUtil::insertRangeUnique<KeyConfig>(&d_data, first, last, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    // The merge detects input that is entirely ordered after the current
+    // contents, so no special handling is needed here.
+
+    TreeUtil::insertRangeUnique<KeyConfig>(&d_data, first, last, d_comparator);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(Args&&... arguments)
+{
+    // Construct the new pair in place at the end of the sequence, then rotate
+    // it into position, so that it is moved no more than it would be by
+    // 'insert'.
+
+    d_data.emplace_back(BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+
+    iterator last = d_data.end() - 1;
+    iterator it   = TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                                    last,
+                                                    last->first,
+                                                    d_comparator);
+    if (it != last && !d_comparator(last->first, it->first)) {
+        d_data.pop_back();
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    native_std::rotate(it, last, d_data.end());
+    return pair<iterator, bool>(it, true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                                                    const_iterator,
+                                                    Args&&...      arguments)
+{
+    return emplace(BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...).first;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_data.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == cend()) {
+        return 0;                                                     // RETURN
+    }
+    d_data.erase(it);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+    return d_data.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(flat_map& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    bsl::swap(d_data, other.d_data);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    d_data.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(size_type numPairs)
+{
+    d_data.reserve(numPairs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_data.shrink_to_fit();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.get_allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename add_lvalue_reference<const VALUE>::type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key) const
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return rbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return rend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::container_type&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::sequence() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                  const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1385 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bsl::flat_map' is a thin adapter of 'bsl::vector' whose searching and
+// ordering are delegated to 'bslstl::FlatTreeUtil' (tested separately), in
+// the same manner as 'bsl::flat_set' (also tested separately).  We therefore
+// concentrate on the forwarding of each method, on the methods specific to a
+// map ('operator[]', 'at', and the modifiable lookups), on the allocator
+// supplied to keys and mapped values, and on agreement with 'bsl::map' for
+// the same operations.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map();
+// [ 2] explicit flat_map(const COMPARATOR&, const ALLOCATOR& = ALLOCATOR());
+// [ 2] explicit flat_map(const ALLOCATOR&);
+// [ 2] flat_map(const flat_map&);
+// [ 2] flat_map(MovableRef<flat_map>);
+// [ 2] flat_map(const flat_map&, const ALLOCATOR&);
+// [ 2] flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+// [ 2] explicit flat_map(MovableRef<container_type>, const COMPARATOR&);
+// [ 2] flat_map(sorted_unique_t, MovableRef<container_type>, const COMP&);
+// [ 2] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMP&, const ALLOC&);
+// [ 2] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+// [ 2] flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 2] flat_map(initializer_list<value_type>, const COMP&, const ALLOC&);
+// [ 2] flat_map(initializer_list<value_type>, const ALLOCATOR&);
+// [ 2] ~flat_map();
+//
+// MANIPULATORS
+// [ 5] flat_map& operator=(const flat_map&);
+// [ 5] flat_map& operator=(MovableRef<flat_map>);
+// [ 5] flat_map& operator=(initializer_list<value_type>);
+// [ 3] VALUE& operator[](const key_type&);
+// [ 3] VALUE& operator[](MovableRef<key_type>);
+// [ 3] VALUE& at(const key_type&);
+// [ 4] iterator begin();
+// [ 4] iterator end();
+// [ 4] reverse_iterator rbegin();
+// [ 4] reverse_iterator rend();
+// [ 3] pair<iterator, bool> insert(const value_type&);
+// [ 3] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] iterator insert(const_iterator, MovableRef<value_type>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list<value_type>);
+// [ 3] pair<iterator, bool> emplace(Args&&...);
+// [ 3] iterator emplace_hint(const_iterator, Args&&...);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] size_type erase(const LOOKUP_KEY&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 5] void swap(flat_map&);
+// [ 3] void clear();
+// [ 2] void reserve(size_type);
+// [ 2] void shrink_to_fit();
+// [ 4] iterator find(const key_type&);
+// [ 4] iterator lower_bound(const key_type&);
+// [ 4] iterator upper_bound(const key_type&);
+// [ 4] pair<iterator, iterator> equal_range(const key_type&);
+// [ 4] iterator find(const LOOKUP_KEY&);
+// [ 4] iterator lower_bound(const LOOKUP_KEY&);
+// [ 4] iterator upper_bound(const LOOKUP_KEY&);
+// [ 4] pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 3] const VALUE& at(const key_type&) const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_reverse_iterator rbegin() const;
+// [ 4] const_reverse_iterator rend() const;
+// [ 4] const_iterator cbegin() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_reverse_iterator crbegin() const;
+// [ 4] const_reverse_iterator crend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type capacity() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 2] const container_type& sequence() const;
+// [ 4] bool contains(const key_type&) const;
+// [ 4] const_iterator find(const key_type&) const;
+// [ 4] size_type count(const key_type&) const;
+// [ 4] const_iterator lower_bound(const key_type&) const;
+// [ 4] const_iterator upper_bound(const key_type&) const;
+// [ 4] pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [ 4] bool contains(const LOOKUP_KEY&) const;
+// [ 4] const_iterator find(const LOOKUP_KEY&) const;
+// [ 4] size_type count(const LOOKUP_KEY&) const;
+// [ 4] const_iterator lower_bound(const LOOKUP_KEY&) const;
+// [ 4] const_iterator upper_bound(const LOOKUP_KEY&) const;
+// [ 4] pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const flat_map&, const flat_map&);
+// [ 5] bool operator!=(const flat_map&, const flat_map&);
+// [ 5] bool operator< (const flat_map&, const flat_map&);
+// [ 5] bool operator> (const flat_map&, const flat_map&);
+// [ 5] bool operator<=(const flat_map&, const flat_map&);
+// [ 5] bool operator>=(const flat_map&, const flat_map&);
+// [ 5] void swap(flat_map&, flat_map&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'flat_map' vs. 'map'
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_map<int, int>              Obj;
+typedef Obj::value_type                      Pair;
+typedef bsl::map<int, int>                   Reference;
+typedef bsl::flat_map<bsl::string, bsl::string>
+                                             StringObj;
+typedef bslmf::MovableRefUtil                MoveUtil;
+
+BSLMF_ASSERT((bsl::is_same<bsl::pair<int, int>, Obj::value_type>::value));
+BSLMF_ASSERT((bsl::is_same<bsl::pair<int, int> *, Obj::iterator>::value));
+
+namespace {
+
+struct TransparentLess {
+    // This 'struct' provides a transparent comparator for 'int' keys that
+    // counts the number of comparisons it performs with 'long' lookup keys.
+
+    // PUBLIC TYPES
+    typedef void is_transparent;
+
+    // CLASS DATA
+    static int s_numLongComparisons;
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'lhs < rhs'.
+    {
+        return lhs < rhs;
+    }
+
+    bool operator()(long lhs, int rhs) const
+        // Return 'lhs < rhs'.
+    {
+        ++s_numLongComparisons;
+        return lhs < rhs;
+    }
+
+    bool operator()(int lhs, long rhs) const
+        // Return 'lhs < rhs'.
+    {
+        ++s_numLongComparisons;
+        return lhs < rhs;
+    }
+};
+
+int TransparentLess::s_numLongComparisons = 0;
+
+bool greaterInt(int lhs, int rhs)
+    // Return 'true' if the specified 'lhs' is greater than the specified
+    // 'rhs', and 'false' otherwise.
+{
+    return lhs > rhs;
+}
+
+template <class OBJ>
+bool verifyEqual(const OBJ& object, const Reference& reference)
+    // Return 'true' if the specified 'object' holds the same key-value pairs,
+    // in the same order, as the specified 'reference', and 'false' otherwise.
+{
+    if (object.size() != reference.size()) {
+        return false;                                                 // RETURN
+    }
+    Reference::const_iterator rit = reference.begin();
+    for (typename OBJ::const_iterator it = object.begin();
+         it != object.end();
+         ++it, ++rit) {
+        if (it->first != rit->first || it->second != rit->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Table of Status Descriptions
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that a web server must describe each HTTP status code it returns.
+// The descriptions are fixed when the server starts, and are looked up for
+// every response; a 'flat_map' is ideal for such a table.
+//
+// First, we define the table in no particular order:
+//..
+        typedef bsl::pair<int, const char *> Entry;
+
+        const Entry ENTRIES[] = {
+            Entry(404, "Not Found"),
+            Entry(200, "OK"),
+            Entry(500, "Internal Server Error"),
+            Entry(301, "Moved Permanently"),
+            Entry(304, "Not Modified"),
+        };
+        const int NUM_ENTRIES = sizeof ENTRIES / sizeof *ENTRIES;
+//..
+// Then, we build a 'flat_map' from the table, which sorts it in a single step:
+//..
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::flat_map<int, const char *> descriptions(ENTRIES,
+                                                      ENTRIES + NUM_ENTRIES,
+                                                      &oa);
+        ASSERT(NUM_ENTRIES == descriptions.size());
+//..
+// Next, we look up some codes:
+//..
+        ASSERT(0 == strcmp("OK", descriptions.at(200)));
+        ASSERT(descriptions.end() == descriptions.find(418));
+//..
+// Then, we add a description that was missing, using 'operator[]':
+//..
+        descriptions[418] = "I'm a teapot";
+        ASSERT(0 == strcmp("I'm a teapot", descriptions.find(418)->second));
+//..
+// Finally, we observe that iteration visits the codes in order:
+//..
+        int previous = 0;
+        for (bsl::flat_map<int, const char *>::const_iterator it =
+                                                         descriptions.begin();
+             it != descriptions.end();
+             ++it) {
+            ASSERT(previous < it->first);
+            previous = it->first;
+        }
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Assignment copies (or moves) the pairs and the comparator, and
+        //:   retains the allocator of the target.
+        //:
+        //: 2 'swap' exchanges the pairs and comparators, including between
+        //:   maps using different allocators.
+        //:
+        //: 3 The comparison operators compare the pair sequences
+        //:   lexicographically, taking the mapped values into account.
+        //
+        // Plan:
+        //: 1 Assign between maps with different allocators and comparators,
+        //:   and check the value, comparator and allocator of the target.
+        //:   (C-1)
+        //:
+        //: 2 Swap maps having the same and different allocators.  (C-2)
+        //:
+        //: 3 Use the table-driven technique for the comparison operators.
+        //:   (C-3)
+        //
+        // Testing:
+        //   flat_map& operator=(const flat_map&);
+        //   flat_map& operator=(MovableRef<flat_map>);
+        //   flat_map& operator=(initializer_list<value_type>);
+        //   void swap(flat_map&);
+        //   bool operator==(const flat_map&, const flat_map&);
+        //   bool operator!=(const flat_map&, const flat_map&);
+        //   bool operator< (const flat_map&, const flat_map&);
+        //   bool operator> (const flat_map&, const flat_map&);
+        //   bool operator<=(const flat_map&, const flat_map&);
+        //   bool operator>=(const flat_map&, const flat_map&);
+        //   void swap(flat_map&, flat_map&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        typedef bsl::flat_map<int, int, bool (*)(int, int)> FpObj;
+
+        const Pair VALUES[] = { Pair(3, 30), Pair(1, 10), Pair(4, 40),
+                                Pair(1, 11), Pair(5, 50), Pair(9, 90),
+                                Pair(2, 20), Pair(6, 60) };
+
+        if (verbose) printf("\tTesting assignment.\n");
+        {
+            FpObj mY(VALUES, VALUES + 8, &greaterInt, &za);
+            const FpObj& Y = mY;
+
+            FpObj mX(static_cast<bool (*)(int, int)>(0), &oa);
+            const FpObj& X = mX;
+
+            ASSERT(&mX == &(mX = Y));
+            ASSERT(Y == X);
+            ASSERT(&greaterInt == X.key_comp());
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(9 == X.begin()->first);
+
+            FpObj mZ(&oa);  const FpObj& Z = mZ;
+            mZ = MoveUtil::move(mX);
+            ASSERT(Y == Z);
+            ASSERT(&greaterInt == Z.key_comp());
+            ASSERT(&oa == Z.get_allocator());
+
+            mZ = MoveUtil::move(mY);  // different allocator
+            ASSERT(&oa == Z.get_allocator());
+            ASSERT(7 == Z.size());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mZ = { Pair(7, 1), Pair(8, 2), Pair(7, 3) };
+            ASSERT(2 == Z.size());
+            ASSERT(8 == Z.begin()->first);
+            ASSERT(1 == Z.at(7));
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tTesting 'swap'.\n");
+        {
+            Obj mX(VALUES, VALUES + 4, &oa);  const Obj& X = mX;
+            Obj mY(VALUES + 4, VALUES + 8, &oa);  const Obj& Y = mY;
+            Obj mZ(&za);  const Obj& Z = mZ;
+
+            const Obj XX(X, &oa), YY(Y, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+            mX.swap(mY);
+            ASSERT(NUM_ALLOCS == oa.numAllocations());
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+
+            swap(mX, mZ);
+            ASSERT(YY == Z);
+            ASSERT(X.empty());
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(&za == Z.get_allocator());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tTesting comparison operators.\n");
+        {
+            // Each spec is a sequence of key-value digit pairs.
+
+            static const struct {
+                int         d_line;
+                const char *d_spec;
+            } DATA[] = {
+                // Listed in increasing lexicographical order.
+
+                { L_, ""       },
+                { L_, "10"     },
+                { L_, "1020"   },
+                { L_, "102030" },
+                { L_, "1030"   },
+                { L_, "11"     },
+                { L_, "1120"   },
+                { L_, "20"     },
+                { L_, "2030"   },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const char *const SPEC1 = DATA[ti].d_spec;
+                Obj mX(&oa);  const Obj& X = mX;
+                for (const char *p = SPEC1; *p; p += 2) {
+                    mX[p[0] - '0'] = p[1] - '0';
+                }
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const char *const SPEC2 = DATA[tj].d_spec;
+                    Obj mY(&za);  const Obj& Y = mY;
+                    for (const char *p = SPEC2; *p; p += 2) {
+                        mY[p[0] - '0'] = p[1] - '0';
+                    }
+
+                    ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                    ASSERTV(ti, tj, (ti != tj) == (X != Y));
+                    ASSERTV(ti, tj, (ti <  tj) == (X <  Y));
+                    ASSERTV(ti, tj, (ti >  tj) == (X >  Y));
+                    ASSERTV(ti, tj, (ti <= tj) == (X <= Y));
+                    ASSERTV(ti, tj, (ti >= tj) == (X >= Y));
+                }
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP AND ITERATION
+        //
+        // Concerns:
+        //: 1 Each lookup method, 'const' and non-'const', returns the same
+        //:   position as the corresponding method of 'bsl::map' having the
+        //:   same keys.
+        //:
+        //: 2 The transparent overloads are selected for a transparent
+        //:   comparator and a lookup key of a different type.
+        //:
+        //: 3 Forward and reverse iteration visit the pairs in order, and the
+        //:   mapped values are modifiable through an 'iterator'.
+        //
+        // Plan:
+        //: 1 For maps of every size in '[0 .. 20]' holding even keys, search
+        //:   for every key in '[-1 .. 2 * size]' and compare (by distance
+        //:   from 'begin') with a 'bsl::map'.  (C-1)
+        //:
+        //: 2 Repeat with a transparent comparator and 'long' lookup keys,
+        //:   verifying that the 'long' comparisons are used.  (C-2)
+        //:
+        //: 3 Compare the iteration sequences with those of the reference,
+        //:   then modify every mapped value through 'begin'.  (C-3)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   iterator find(const key_type&);
+        //   iterator lower_bound(const key_type&);
+        //   iterator upper_bound(const key_type&);
+        //   pair<iterator, iterator> equal_range(const key_type&);
+        //   iterator find(const LOOKUP_KEY&);
+        //   iterator lower_bound(const LOOKUP_KEY&);
+        //   iterator upper_bound(const LOOKUP_KEY&);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   bool contains(const key_type&) const;
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iter, const_iter> equal_range(const key_type&) const;
+        //   bool contains(const LOOKUP_KEY&) const;
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   size_type count(const LOOKUP_KEY&) const;
+        //   const_iterator lower_bound(const LOOKUP_KEY&) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY&) const;
+        //   pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP AND ITERATION"
+                            "\n====================\n");
+
+        typedef bsl::flat_map<int, int, TransparentLess> TObj;
+
+        for (int size = 0; size <= 20; ++size) {
+            Obj       mX;  const Obj&       X = mX;
+            TObj      mT;  const TObj&      T = mT;
+            Reference mR;  const Reference& R = mR;
+
+            for (int i = 0; i < size; ++i) {
+                mX.insert(Pair(2 * i, i));
+                mT.insert(Pair(2 * i, i));
+                mR.insert(Pair(2 * i, i));
+            }
+
+            ASSERTV(size, verifyEqual(X, R));
+            ASSERTV(size, verifyEqual(T, R));
+            ASSERTV(size, X.cend() - X.cbegin() == size);
+            ASSERTV(size, X.rend() - X.rbegin() == size);
+            ASSERTV(size, X.crend() - X.crbegin() == size);
+            ASSERTV(size, mX.rend() - mX.rbegin() == size);
+            ASSERTV(size, 0 == size || X.rbegin()->first == 2 * size - 2);
+            ASSERTV(size, 0 == size || mX.rbegin()->first == 2 * size - 2);
+            ASSERTV(size, 0 == size || X.crbegin()->first == 2 * size - 2);
+
+            for (int key = -1; key <= 2 * size; ++key) {
+                const long LKEY = key;
+
+#define DIST(CONTAINER, ITERATOR)                                             \
+    native_std::distance(CONTAINER.begin(), ITERATOR)
+
+                ASSERTV(size, key,
+                        DIST(R, R.find(key)) == DIST(X, X.find(key)));
+                ASSERTV(size, key,
+                        DIST(R, R.find(key)) == DIST(mX, mX.find(key)));
+                ASSERTV(size, key, R.count(key) == X.count(key));
+                ASSERTV(size, key, (1 == R.count(key)) == X.contains(key));
+                ASSERTV(size, key, DIST(R, R.lower_bound(key)) ==
+                                                  DIST(X, X.lower_bound(key)));
+                ASSERTV(size, key, DIST(R, R.lower_bound(key)) ==
+                                                DIST(mX, mX.lower_bound(key)));
+                ASSERTV(size, key, DIST(R, R.upper_bound(key)) ==
+                                                  DIST(X, X.upper_bound(key)));
+                ASSERTV(size, key, DIST(R, R.upper_bound(key)) ==
+                                                DIST(mX, mX.upper_bound(key)));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).first) ==
+                                          DIST(X, X.equal_range(key).first));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).second) ==
+                                          DIST(X, X.equal_range(key).second));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).first) ==
+                                        DIST(mX, mX.equal_range(key).first));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).second) ==
+                                        DIST(mX, mX.equal_range(key).second));
+
+                TransparentLess::s_numLongComparisons = 0;
+
+                ASSERTV(size, key,
+                        DIST(R, R.find(key)) == DIST(T, T.find(LKEY)));
+                ASSERTV(size, key,
+                        DIST(R, R.find(key)) == DIST(mT, mT.find(LKEY)));
+                ASSERTV(size, key, R.count(key) == T.count(LKEY));
+                ASSERTV(size, key, (1 == R.count(key)) == T.contains(LKEY));
+                ASSERTV(size, key, DIST(R, R.lower_bound(key)) ==
+                                               DIST(T, T.lower_bound(LKEY)));
+                ASSERTV(size, key, DIST(R, R.lower_bound(key)) ==
+                                             DIST(mT, mT.lower_bound(LKEY)));
+                ASSERTV(size, key, DIST(R, R.upper_bound(key)) ==
+                                               DIST(T, T.upper_bound(LKEY)));
+                ASSERTV(size, key, DIST(R, R.upper_bound(key)) ==
+                                             DIST(mT, mT.upper_bound(LKEY)));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).first) ==
+                                       DIST(T, T.equal_range(LKEY).first));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).second) ==
+                                       DIST(T, T.equal_range(LKEY).second));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).first) ==
+                                     DIST(mT, mT.equal_range(LKEY).first));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).second) ==
+                                     DIST(mT, mT.equal_range(LKEY).second));
+
+                ASSERTV(size, key,
+                        0 == size ||
+                                   0 < TransparentLess::s_numLongComparisons);
+#undef DIST
+            }
+
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second += 100;
+            }
+            for (Reference::iterator it = mR.begin(); it != mR.end(); ++it) {
+                it->second += 100;
+            }
+            ASSERTV(size, verifyEqual(X, R));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, EMPLACE, ERASE, AND ELEMENT ACCESS
+        //
+        // Concerns:
+        //: 1 Each single-pair insertion inserts the pair, in order, unless an
+        //:   equivalent key is present (in which case the mapped value is
+        //:   unchanged), and reports whether it did.
+        //:
+        //: 2 Hinted insertion produces the same result for correct and
+        //:   incorrect hints.
+        //:
+        //: 3 Range insertion merges the range, keeping existing pairs and the
+        //:   first of pairs having equivalent keys.
+        //:
+        //: 4 Each 'erase' removes the specified pairs and returns the correct
+        //:   value.
+        //:
+        //: 5 'operator[]' returns the existing mapped value or inserts a
+        //:   default-constructed one; 'at' returns the existing mapped value
+        //:   or throws 'std::out_of_range'.
+        //:
+        //: 6 Keys and mapped values that use allocators are supplied the
+        //:   map's allocator.
+        //:
+        //: 7 Range insertion is exception neutral.
+        //
+        // Plan:
+        //: 1 Perform a sequence of operations on a 'flat_map' and a
+        //:   'bsl::map', comparing the results and the contents after each.
+        //:   (C-1..5)
+        //:
+        //: 2 Insert 'bsl::string' keys and values, by copy, move,
+        //:   emplacement, and 'operator[]', and check their allocators.
+        //:   (C-6)
+        //:
+        //: 3 Insert a range in an exception test loop.  (C-7)
+        //
+        // Testing:
+        //   VALUE& operator[](const key_type&);
+        //   VALUE& operator[](MovableRef<key_type>);
+        //   VALUE& at(const key_type&);
+        //   const VALUE& at(const key_type&) const;
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   iterator insert(const_iterator, MovableRef<value_type>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<value_type>);
+        //   pair<iterator, bool> emplace(Args&&...);
+        //   iterator emplace_hint(const_iterator, Args&&...);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   size_type erase(const LOOKUP_KEY&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERT, EMPLACE, ERASE, AND ELEMENT ACCESS"
+                            "\n==========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting single-pair insertion.\n");
+        {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference mR;       const Reference& R = mR;
+
+            const int VALUES[] = { 5, 1, 9, 5, 3, 7, 1, 0, 10, 9, 4 };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const Pair V(VALUES[i], i);
+
+                bsl::pair<Obj::iterator, bool> rx = mX.insert(V);
+                bsl::pair<Reference::iterator, bool> rr = mR.insert(V);
+
+                ASSERTV(i, rr.second == rx.second);
+                ASSERTV(i, V.first == rx.first->first);
+                ASSERTV(i, rr.first->second == rx.first->second);
+                ASSERTV(i, verifyEqual(X, R));
+            }
+
+            // Hints: correct ('upper_bound'), 'begin', and 'end'.
+
+            for (int v = -2; v <= 12; ++v) {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+                Obj mW(X, &oa);  const Obj& W = mW;
+
+                Pair value(v, 100);
+
+                Obj::iterator ry = mY.insert(Y.upper_bound(v), Pair(v, 100));
+                Obj::iterator rz = mZ.insert(Z.begin(), Pair(v, 100));
+                Obj::iterator rw = mW.insert(W.end(), MoveUtil::move(value));
+
+                ASSERTV(v, v == ry->first && v == rz->first && v == rw->first);
+                ASSERTV(v, Y == Z && Z == W && Y.contains(v));
+                ASSERTV(v, (X.contains(v) ? X.at(v) : 100) == Y.at(v));
+            }
+
+            Pair value(2, 22);
+            ASSERT( mX.insert(MoveUtil::move(value)).second);
+            ASSERT(!mX.insert(Pair(2, 23)).second);
+            ASSERT(22 == X.at(2));
+            mR[2] = 22;
+            ASSERT(verifyEqual(X, R));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            bsl::pair<Obj::iterator, bool> re = mX.emplace(6, 66);
+            ASSERT(re.second);
+            ASSERT(6 == re.first->first && 66 == re.first->second);
+            re = mX.emplace(6, 67);
+            ASSERT(!re.second);
+            ASSERT(66 == re.first->second);
+            ASSERT(8 == mX.emplace_hint(X.end(), 8, 88)->first);
+            mR[6] = 66;
+            mR[8] = 88;
+            ASSERT(verifyEqual(X, R));
+#endif
+
+            ASSERT(1 == mX.erase(5));
+            ASSERT(0 == mX.erase(5));
+            ASSERT(1 == mR.erase(5));
+            ASSERT(verifyEqual(X, R));
+
+            Obj::iterator it = mX.erase(X.find(3));
+            ASSERT(4 == it->first);
+            mR.erase(3);
+            ASSERT(verifyEqual(X, R));
+
+            it = mX.erase(X.lower_bound(4), X.upper_bound(9));
+            ASSERT(10 == it->first);
+            mR.erase(mR.lower_bound(4), mR.upper_bound(9));
+            ASSERT(verifyEqual(X, R));
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting 'operator[]' and 'at'.\n");
+        {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference mR;       const Reference& R = mR;
+
+            const int KEYS[] = { 5, 1, 9, 5, 3, 7, 1, 0, 10, 9, 4 };
+            const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const int K = KEYS[i];
+
+                ASSERTV(i, mR[K] == mX[K]);
+                mX[K] += i;
+                mR[K] += i;
+                ASSERTV(i, verifyEqual(X, R));
+                ASSERTV(i, R.at(K) == X.at(K));
+                ASSERTV(i, R.at(K) == mX.at(K));
+
+                int key = K + 100;
+                mX[MoveUtil::move(key)] = i;
+                mR[K + 100] = i;
+                ASSERTV(i, verifyEqual(X, R));
+            }
+
+            mX.at(5) = 55;
+            ASSERT(55 == X.at(5));
+
+            bool caught = false;
+            try {
+                mX.at(2);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(2);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(!X.contains(2));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range insertion.\n");
+        {
+            const Pair HEAD[] = { Pair(2, 0), Pair(4, 0), Pair(6, 0),
+                                  Pair(8, 0) };
+            const Pair TAIL[] = { Pair(9, 1), Pair(4, 1), Pair(1, 1),
+                                  Pair(8, 1), Pair(8, 2), Pair(0, 1) };
+
+            Obj mX(HEAD, HEAD + 4, &oa);  const Obj& X = mX;
+            Reference mR(HEAD, HEAD + 4);  const Reference& R = mR;
+
+            mX.insert(TAIL, TAIL + 6);
+            mR.insert(TAIL, TAIL + 6);
+            ASSERT(verifyEqual(X, R));
+
+            const Pair SORTED[] = { Pair(3, 2), Pair(5, 2), Pair(7, 2),
+                                    Pair(11, 2), Pair(12, 2) };
+            mX.insert(bsl::sorted_unique, SORTED, SORTED + 5);
+            mR.insert(SORTED, SORTED + 5);
+            ASSERT(verifyEqual(X, R));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ Pair(100, 3), Pair(-1, 3), Pair(100, 4) });
+            mR.insert({ Pair(100, 3), Pair(-1, 3), Pair(100, 4) });
+            ASSERT(verifyEqual(X, R));
+#endif
+
+            typedef bsl::flat_map<int, int, TransparentLess> TObj;
+
+            TObj mT(X.begin(), X.end());  const TObj& T = mT;
+            ASSERT(1 == mT.erase(3L));
+            ASSERT(0 == mT.erase(3L));
+            ASSERT(T.size() + 1 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting exception neutrality.\n");
+        {
+            typedef StringObj::value_type StringPair;
+
+            const char *const WORDS[] = {
+                "delta-delta-delta-delta-delta-delta-delta",
+                "alpha-alpha-alpha-alpha-alpha-alpha-alpha",
+                "echo-echo-echo-echo-echo-echo-echo-echo",
+                "bravo-bravo-bravo-bravo-bravo-bravo-bravo",
+                "alpha-alpha-alpha-alpha-alpha-alpha-alpha",
+            };
+
+            bsl::vector<StringPair> input(&defaultAllocator);
+            for (int i = 0; i < 5; ++i) {
+                input.push_back(StringPair(WORDS[i], WORDS[4 - i]));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StringObj mX(&oa);  const StringObj& X = mX;
+
+                const bsls::Types::Int64 AL = oa.allocationLimit();
+                oa.setAllocationLimit(-1);
+                mX["charlie-charlie-charlie-charlie-charlie"] =
+                                   "charlie-charlie-charlie-charlie-charlie";
+                oa.setAllocationLimit(AL);
+
+                try {
+                    mX.insert(input.begin(), input.end());
+                }
+                catch (...) {
+                    ASSERT(X.empty() || 1 == X.size());
+                    throw;
+                }
+                ASSERTV(X.size(), 5 == X.size());
+                ASSERT('a' == X.begin()->first[0]);
+                ASSERT('b' == X.begin()->second[0]);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting allocator propagation to pairs.\n");
+        {
+            typedef StringObj::value_type StringPair;
+
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            const bsl::string A("a long string that does not fit in SSO a",
+                                &defaultAllocator);
+            StringPair        B(bsl::string(
+                                   "b long string that does not fit in SSO b",
+                                   &oa),
+                                bsl::string(
+                                   "b long string that does not fit in SSO b",
+                                   &oa),
+                                &oa);
+
+            ASSERT(mX.insert(StringPair(A, A, &defaultAllocator)).second);
+            ASSERT(mX.insert(X.end(), MoveUtil::move(B)) != X.end());
+            mX["c long string that does not fit in SSO c"] = A;
+
+            bsl::string D("d long string that does not fit in SSO d", &oa);
+            mX[MoveUtil::move(D)] = A;
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            ASSERT(mX.emplace("e long string that does not fit in SSO e", A)
+                                                                     .second);
+            ASSERT(!mX.emplace("e long string that does not fit in SSO e", A)
+                                                                     .second);
+            ASSERT('f' == mX.emplace_hint(
+                              X.begin(),
+                              "f long string that does not fit in SSO f",
+                              A)->first[0]);
+            ASSERT(6 == X.size());
+#endif
+            for (StringObj::const_iterator it = X.begin(); it != X.end();
+                                                                        ++it) {
+                ASSERT(&oa == it->first.get_allocator());
+                ASSERT(&oa == it->second.get_allocator());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map having the expected value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 Constructors taking unsorted input sort it and drop pairs having
+        //:   duplicate keys, keeping the first of them; constructors taking
+        //:   sorted input use it unchanged.
+        //:
+        //: 3 Adopting a container, and moving a map with the same allocator,
+        //:   allocate no memory.
+        //:
+        //: 4 'reserve' and 'shrink_to_fit' change the capacity.
+        //:
+        //: 5 'value_comp' compares pairs by key alone.
+        //
+        // Plan:
+        //: 1 Construct maps by each constructor and check their state and the
+        //:   memory allocated.  (C-1..5)
+        //
+        // Testing:
+        //   flat_map();
+        //   explicit flat_map(const COMPARATOR&, const ALLOCATOR&);
+        //   explicit flat_map(const ALLOCATOR&);
+        //   flat_map(const flat_map&);
+        //   flat_map(MovableRef<flat_map>);
+        //   flat_map(const flat_map&, const ALLOCATOR&);
+        //   flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+        //   explicit flat_map(MovableRef<container_type>, const COMPARATOR&);
+        //   flat_map(sorted_unique_t, MovableRef<container_type>, ...);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const COMP&, ...);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+        //   flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   flat_map(initializer_list<value_type>, const COMP&, const ALLOC&);
+        //   flat_map(initializer_list<value_type>, const ALLOCATOR&);
+        //   ~flat_map();
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   allocator_type get_allocator() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   size_type capacity() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const container_type& sequence() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const Pair VALUES[]   = { Pair(3, 0), Pair(1, 1), Pair(4, 2),
+                                  Pair(1, 3), Pair(5, 4), Pair(9, 5),
+                                  Pair(2, 6), Pair(6, 7), Pair(5, 8),
+                                  Pair(3, 9) };
+        const int  NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+        const Pair SORTED[]   = { Pair(1, 1), Pair(2, 6), Pair(3, 0),
+                                  Pair(4, 2), Pair(5, 4), Pair(6, 7),
+                                  Pair(9, 5) };
+        const int  NUM_SORTED = sizeof SORTED / sizeof *SORTED;
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 < X.max_size());
+            ASSERT(&defaultAllocator == X.get_allocator());
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());
+            mX[7] = 70;
+            mX.shrink_to_fit();
+            ASSERT(1 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        {
+            typedef bsl::flat_map<int, int, bool (*)(int, int)> FpObj;
+
+            FpObj mX(&greaterInt, &oa);  const FpObj& X = mX;
+            ASSERT(&greaterInt == X.key_comp());
+            ASSERT( X.value_comp()(Pair(2, 0), Pair(1, 1)));
+            ASSERT(!X.value_comp()(Pair(1, 0), Pair(1, 1)));
+            ASSERT(&oa == X.get_allocator());
+
+            FpObj mY(VALUES, VALUES + NUM_VALUES, &greaterInt, &oa);
+            const FpObj& Y = mY;
+            ASSERT(9 == Y.begin()->first);
+            ASSERT(1 == Y.rbegin()->first);
+            ASSERT(1 == Y.rbegin()->second);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        {
+            Obj mX(VALUES, VALUES + NUM_VALUES, &oa);  const Obj& X = mX;
+
+            ASSERT(NUM_SORTED == X.size());
+            ASSERT(native_std::equal(X.begin(), X.end(), SORTED));
+            ASSERT(1 == oa.numBlocksInUse());
+
+            Obj mY(bsl::sorted_unique, SORTED, SORTED + NUM_SORTED, &oa);
+            const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            Obj mZ(bsl::sorted_unique, SORTED, SORTED + NUM_SORTED);
+            const Obj& Z = mZ;
+            ASSERT(X == Z);
+            ASSERT(&defaultAllocator == Z.get_allocator());
+
+            // Copy and move.
+
+            Obj mA(X);  const Obj& A = mA;
+            ASSERT(X == A);
+            ASSERT(&defaultAllocator == A.get_allocator());
+
+            Obj mB(X, &za);  const Obj& B = mB;
+            ASSERT(X == B);
+            ASSERT(&za == B.get_allocator());
+
+            Obj mM(X, &oa);
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+            Obj mC(MoveUtil::move(mM));  const Obj& C = mC;
+            ASSERT(X == C);
+            ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+
+            Obj mD(MoveUtil::move(mC), &oa);  const Obj& D = mD;
+            ASSERT(X == D);
+            ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+
+            Obj mE(MoveUtil::move(mD), &za);  const Obj& E = mE;
+            ASSERT(X == E);
+            ASSERT(&za == E.get_allocator());
+
+            // Adopt a container.
+
+            bsl::vector<Pair> v(VALUES, VALUES + NUM_VALUES, &za);
+            const bsls::Types::Int64 NUM_Z = za.numBlocksTotal();
+
+            Obj mF(MoveUtil::move(v));  const Obj& F = mF;
+            ASSERT(X == F);
+            ASSERT(&za == F.get_allocator());
+            ASSERT(NUM_Z + 2 == za.numBlocksTotal());  // addresses, result
+
+            bsl::vector<Pair> w(SORTED, SORTED + NUM_SORTED, &za);
+            const bsls::Types::Int64 NUM_W = za.numBlocksTotal();
+
+            Obj mG(bsl::sorted_unique, MoveUtil::move(w));  const Obj& G = mG;
+            ASSERT(X == G);
+            ASSERT(NUM_W == za.numBlocksTotal());
+            ASSERT(F.sequence() == G.sequence());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX({ Pair(3, 0), Pair(1, 1), Pair(3, 2), Pair(2, 3) }, &oa);
+            const Obj& X = mX;
+            ASSERT(3 == X.size());
+            ASSERT(1 == X.begin()->first);
+            ASSERT(0 == X.at(3));
+
+            Obj mY({ Pair(3, 0), Pair(1, 1), Pair(3, 2), Pair(2, 3) },
+                   std::less<int>(),
+                   &oa);
+            const Obj& Y = mY;
+            ASSERT(X == Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform some ad-hoc tests.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT( mX.insert(Pair(5, 50)).second);
+        ASSERT( mX.insert(Pair(1, 10)).second);
+        ASSERT(!mX.insert(Pair(5, 51)).second);
+        mX[3] = 30;
+        ASSERT(3 == X.size());
+        ASSERT(1 == X.begin()->first);
+        ASSERT(5 == X.rbegin()->first);
+        ASSERT(50 == X.at(5));
+
+        ASSERT(X.contains(3));
+        ASSERT(!X.contains(4));
+        ASSERT(X.find(4) == X.end());
+        ASSERT(X.lower_bound(4)->first == 5);
+        ASSERT(X.upper_bound(3)->first == 5);
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+        mY[3] = 31;
+        ASSERT(X != Y);
+        ASSERT(X < Y);
+        ASSERT(1 == mY.erase(3));
+        ASSERT(X != Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'flat_map' vs. 'map'
+        //
+        // Concerns:
+        //: 1 Building, searching, and iterating a 'flat_map' is faster than
+        //:   doing the same with a 'bsl::map'.
+        //
+        // Plan:
+        //: 1 For maps from 'int' to 'int' of increasing size, time building
+        //:   each container from the same unordered range, a fixed number of
+        //:   random lookups (half of them successful), and a full iteration,
+        //:   and report the best of several runs.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'flat_map' vs. 'map'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'flat_map' vs. 'map'"
+                            "\n=================================\n");
+
+        const int NUM_LOOKUPS = 1 << 20;
+        const int NUM_RUNS    = 5;
+
+        // Use the new-delete allocator, so that the cost of bookkeeping in
+        // the test allocator does not penalize the node-based 'map'.
+
+        bslma::Allocator *oa = &bslma::NewDeleteAllocator::singleton();
+
+        bsl::vector<int> keys(NUM_LOOKUPS, oa);
+
+        printf("%9s  %21s  %21s  %21s\n",
+               "", "build (ns/pair)", "find (ns/lookup)", "iterate (ns/pair)");
+        printf("%9s  %10s %10s  %10s %10s  %10s %10s\n",
+               "size", "map", "flat_map", "map", "flat_map", "map",
+               "flat_map");
+
+        for (int size = 16; size <= (1 << 22); size *= 4) {
+            bsl::vector<Pair> input(oa);
+            input.reserve(size);
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < size; ++i) {
+                seed = seed * 1103515245 + 12345;
+                input.push_back(Pair(static_cast<int>(seed >> 1), i));
+            }
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                seed    = seed * 1103515245 + 12345;
+                keys[i] = i & 1 ? input[(seed >> 1) % size].first
+                                : static_cast<int>(seed >> 1);
+            }
+
+            double buildTime[2]   = { 1e9, 1e9 };
+            double findTime[2]    = { 1e9, 1e9 };
+            double iterateTime[2] = { 1e9, 1e9 };
+            long   found[2]       = { 0, 0 };
+            long   sum[2]         = { 0, 0 };
+
+            for (int run = 0; run < NUM_RUNS; ++run) {
+                bsls::Stopwatch timer;
+
+                timer.start();
+                Reference mR(input.begin(), input.end(), oa);
+                const Reference& R = mR;
+                timer.stop();
+                buildTime[0] = native_std::min(buildTime[0],
+                                               timer.elapsedTime());
+
+                timer.reset();
+                timer.start();
+                Obj mX(input.begin(), input.end(), oa);  const Obj& X = mX;
+                timer.stop();
+                buildTime[1] = native_std::min(buildTime[1],
+                                               timer.elapsedTime());
+
+                found[0] = 0;
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                    found[0] += R.end() != R.find(keys[i]);
+                }
+                timer.stop();
+                findTime[0] = native_std::min(findTime[0],
+                                              timer.elapsedTime());
+
+                found[1] = 0;
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                    found[1] += X.end() != X.find(keys[i]);
+                }
+                timer.stop();
+                findTime[1] = native_std::min(findTime[1],
+                                              timer.elapsedTime());
+
+                sum[0] = 0;
+                timer.reset();
+                timer.start();
+                for (Reference::const_iterator it = R.begin(); it != R.end();
+                                                                        ++it) {
+                    sum[0] += it->second;
+                }
+                timer.stop();
+                iterateTime[0] = native_std::min(iterateTime[0],
+                                                 timer.elapsedTime());
+
+                sum[1] = 0;
+                timer.reset();
+                timer.start();
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    sum[1] += it->second;
+                }
+                timer.stop();
+                iterateTime[1] = native_std::min(iterateTime[1],
+                                                 timer.elapsedTime());
+
+                ASSERTV(size, verifyEqual(X, R));
+            }
+            ASSERTV(size, found[0] == found[1]);
+            ASSERTV(size, sum[0] == sum[1]);
+
+            printf("%9d  %10.1f %10.1f  %10.1f %10.1f  %10.2f %10.2f\n",
+                   size,
+                   buildTime[0]   * 1e9 / size,
+                   buildTime[1]   * 1e9 / size,
+                   findTime[0]    * 1e9 / NUM_LOOKUPS,
+                   findTime[1]    * 1e9 / NUM_LOOKUPS,
+                   iterateTime[0] * 1e9 / size,
+                   iterateTime[1] * 1e9 / size);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1747 @@
+// bslstl_flatmultimap.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTIMAP
+#define INCLUDED_BSLSTL_FLATMULTIMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multimap of key-value pairs in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_multimap: ordered key-multi-value map with contiguous storage
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatmultiset, bslstl_multimap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_multimap', implementing an ordered associative container mapping
+// keys that need not be unique to values, in the manner of 'bsl::multimap',
+// but storing its key-value pairs contiguously, in key order, in a
+// 'bsl::vector' rather than in the nodes of a balanced binary tree.  The
+// interface follows that of 'std::flat_multimap' (C++23) where that is
+// practical for C++03, except that, as for 'flat_map' (see
+// {'bslstl_flatmap'}), the pairs are held in a single vector, so that
+// 'value_type' is 'bsl::pair<KEY, VALUE>'.  Pairs having equivalent keys are
+// kept in the order in which they were inserted.
+//
+// An instantiation of 'flat_multimap' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of key-value pairs) and
+// the ordered sequence of key-value pairs the 'flat_multimap' contains.  If
+// 'flat_multimap' is instantiated with a key type or mapped-value type that is
+// not itself value-semantic, then it will not retain all of its value-semantic
+// qualities.
+//
+// The trade-offs between 'flat_multimap' and 'bsl::multimap', the
+// requirements on 'KEY' and 'VALUE', and the restriction on modifying keys
+// through an 'iterator', are as described for 'flat_map' in
+// {'bslstl_flatmap'}.  The run-time complexity of the operations on
+// 'flat_multimap' is that of the corresponding operations on 'flat_multiset'
+// (see {'bslstl_flatmultiset'}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Indexing Log Records by Severity
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that, having read a log file, we want to list the messages of each
+// severity in the order in which they were logged.  A 'flat_multimap' keyed
+// by severity keeps messages of equal severity in insertion order.
+//
+// First, we define the records, in the order in which they were logged:
+//..
+//  typedef bsl::pair<int, const char *> Record;
+//
+//  const Record RECORDS[] = {
+//      Record(2, "disk 80% full"),
+//      Record(1, "request served"),
+//      Record(3, "disk full"),
+//      Record(2, "disk 90% full"),
+//      Record(1, "request served"),
+//  };
+//  const int NUM_RECORDS = sizeof RECORDS / sizeof *RECORDS;
+//..
+// Then, we build the index:
+//..
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  bsl::flat_multimap<int, const char *> index(RECORDS,
+//                                              RECORDS + NUM_RECORDS,
+//                                              &oa);
+//  assert(NUM_RECORDS == index.size());
+//..
+// Finally, we list the warnings (severity 2), and observe that they appear in
+// the order in which they were logged:
+//..
+//  typedef bsl::flat_multimap<int, const char *>::const_iterator Iterator;
+//
+//  bsl::pair<Iterator, Iterator> warnings = index.equal_range(2);
+//  assert(2 == warnings.second - warnings.first);
+//  assert(0 == strcmp("disk 80% full", warnings.first[0].second));
+//  assert(0 == strcmp("disk 90% full", warnings.first[1].second));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flattreeutil.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_swaputil.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_nativestd.h>
+
+#include <algorithm>
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                            // ===================
+                            // class flat_multimap
+                            // ===================
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<bsl::pair<KEY, VALUE> > >
+class flat_multimap {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having possibly duplicate keys
+    // (of the template parameter type 'KEY') mapped to values (of the
+    // template parameter type 'VALUE') in contiguous storage.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   except for 'BDEX' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef bsl::pair<KEY, VALUE>                                  ValueType;
+        // This typedef is an alias for the type of the elements of this
+        // multimap.
+
+    typedef BloombergLP::bslstl::UnorderedMapKeyConfiguration<KEY, ValueType>
+                                                                   KeyConfig;
+        // This typedef is an alias for the policy used to extract the key from
+        // an element of this multimap.
+
+    typedef BloombergLP::bslstl::FlatTreeUtil                      TreeUtil;
+        // This typedef is an alias for the utility implementing the searching
+        // and ordering of the elements of this multimap.
+
+    typedef BloombergLP::bslmf::MovableRefUtil                     MoveUtil;
+        // This typedef is a convenient alias for the utility associated with
+        // movable references.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                       key_type;
+    typedef VALUE                                     mapped_type;
+    typedef ValueType                                 value_type;
+    typedef COMPARATOR                                key_compare;
+    typedef ALLOCATOR                                 allocator_type;
+    typedef bsl::vector<value_type, ALLOCATOR>        container_type;
+    typedef value_type&                               reference;
+    typedef const value_type&                         const_reference;
+
+    typedef typename container_type::size_type        size_type;
+    typedef typename container_type::difference_type  difference_type;
+    typedef typename container_type::pointer          pointer;
+    typedef typename container_type::const_pointer    const_pointer;
+
+    typedef typename container_type::iterator         iterator;
+    typedef typename container_type::const_iterator   const_iterator;
+    typedef bsl::reverse_iterator<iterator>           reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' by adapting an object of (template parameter) type
+        // 'COMPARATOR', which compares two objects of (template parameter)
+        // type 'KEY'.
+
+        // FRIENDS
+        friend class flat_multimap;
+
+      protected:
+        // PROTECTED DATA
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member 'protected'
+
+        // PROTECTED CREATORS
+        value_compare(COMPARATOR comparator)                        // IMPLICIT
+            // Create a 'value_compare' object that uses the specified
+            // 'comparator'.
+        : comp(comparator)
+        {
+        }
+
+      public:
+        // PUBLIC TYPES
+        typedef bool       result_type;
+        typedef value_type first_argument_type;
+        typedef value_type second_argument_type;
+
+        // ACCESSORS
+        bool operator()(const value_type& x, const value_type& y) const
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction, and 'false' otherwise.
+        {
+            return comp(x.first, y.first);
+        }
+    };
+
+  private:
+    // DATA
+    COMPARATOR     d_comparator;  // orders the keys
+    container_type d_data;        // key-value pairs, in key order
+
+  public:
+    // CREATORS
+    flat_multimap();
+    explicit flat_multimap(const COMPARATOR& comparator,
+                           const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty multimap.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.  Note that a 'bslma::Allocator *' can be
+        // supplied for 'basicAllocator' if the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+    : d_comparator(comparator)
+    , d_data(basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug (see 'bslstl_multimap').
+    }
+
+    explicit flat_multimap(const ALLOCATOR& basicAllocator);
+        // Create an empty multimap that uses the specified 'basicAllocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // multimap.  Note that a 'bslma::Allocator *' can be supplied for
+        // 'basicAllocator' if the (template parameter) type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    flat_multimap(const flat_multimap& original);
+        // Create a multimap having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this multimap.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.
+
+    flat_multimap(BloombergLP::bslmf::MovableRef<flat_multimap> original);
+                                                                    // IMPLICIT
+        // Create a multimap having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new multimap.  Use a copy of 'original.key_comp()' to order the
+        // keys contained in this multimap.  The allocator associated with
+        // 'original' is propagated for use in the newly-created multimap.
+        // 'original' is left in a valid but unspecified state.
+
+    flat_multimap(const flat_multimap& original,
+                  const ALLOCATOR&     basicAllocator);
+        // Create a multimap having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this multimap.  Note that a 'bslma::Allocator *' can be supplied for
+        // 'basicAllocator' if the (template parameter) type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    flat_multimap(
+                 BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                 const ALLOCATOR&                              basicAllocator);
+        // Create a multimap having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // multimap if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.  Use a copy of
+        // 'original.key_comp()' to order the keys contained in this multimap.
+
+    explicit flat_multimap(
+           BloombergLP::bslmf::MovableRef<container_type> container,
+           const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+        // Create a multimap holding the key-value pairs in the specified
+        // 'container', which is adopted (in constant time) as the underlying
+        // sequence of this multimap and then stably sorted by key.  Optionally
+        // specify a 'comparator' used to order keys contained in this object.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  This multimap uses
+        // the allocator of 'container'.  'container' is left in a valid but
+        // unspecified state.
+
+    flat_multimap(sorted_equivalent_t,
+                  BloombergLP::bslmf::MovableRef<container_type> container,
+                  const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+        // Create a multimap holding the key-value pairs in the specified
+        // 'container', which is adopted (in constant time) as the underlying
+        // sequence of this multimap.  Optionally specify a 'comparator' used
+        // to order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  This multimap uses the allocator of
+        // 'container'.  'container' is left in a valid but unspecified state.
+        // The behavior is undefined unless the keys in 'container' are
+        // ordered according to 'comparator'.
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const ALLOCATOR&  basicAllocator);
+        // Create a multimap, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element.  Optionally
+        // specify a 'comparator' used to order keys contained in this object.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the currently
+        // installed default allocator is used.  The pairs are appended to the
+        // underlying sequence and then stably sorted as a whole, so that this
+        // operation has 'O[N]' complexity if the sequence is ordered according
+        // to 'comparator', and 'O[N * log(N)]' complexity otherwise, where 'N'
+        // is the number of elements between 'first' and 'last'.  The behavior
+        // is undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last'.  Note
+        // that a 'bslma::Allocator *' can be supplied for 'basicAllocator' if
+        // the type 'ALLOCATOR' is 'bsl::allocator' (the default).
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const ALLOCATOR&  basicAllocator);
+        // Create a multimap holding the key-value pairs in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, in 'O[N]' time, where 'N' is
+        // the number of elements in the sequence.  Optionally specify a
+        // 'comparator' and a 'basicAllocator' as for the constructor above.
+        // The behavior is undefined unless the keys of the sequence are
+        // ordered according to 'comparator'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multimap(std::initializer_list<value_type> values,
+                  const COMPARATOR&                 comparator = COMPARATOR(),
+                  const ALLOCATOR&                  basicAllocator =
+                                                                  ALLOCATOR());
+    flat_multimap(std::initializer_list<value_type> values,
+                  const ALLOCATOR&                  basicAllocator);
+        // Create a multimap and insert each 'value_type' object in the
+        // specified 'values' initializer list.  Optionally specify a
+        // 'comparator' and a 'basicAllocator' as for the range constructor
+        // above.
+#endif
+
+    ~flat_multimap();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_multimap& operator=(const flat_multimap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // If an exception is thrown, '*this' is left in a valid but
+        // unspecified state.
+
+    flat_multimap& operator=(BloombergLP::bslmf::MovableRef<flat_multimap> rhs)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_move_assignment',
+        // and return a reference providing modifiable access to this object.
+        // The contents of 'rhs' are moved (in constant time) to this multimap
+        // if 'get_allocator() == rhs.get_allocator()' (after accounting for
+        // the aforementioned trait); otherwise, the pairs of 'rhs' are
+        // move-inserted into this multimap.  'rhs' is left in a valid but
+        // unspecified state, and if an exception is thrown, '*this' is left
+        // in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multimap& operator=(std::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // multimap and then inserting each 'value_type' object in the
+        // specified 'values' initializer list; return a reference providing
+        // modifiable access to this object.
+#endif
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or the 'end' iterator if this multimap
+        // is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this multimap.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or 'rend' if this multimap is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multimap.
+
+    iterator insert(const value_type& value);
+    iterator insert(BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multimap, after any pairs
+        // having equivalent keys, and return an iterator referring to the
+        // newly inserted 'value_type' object.  This operation has 'O[N]'
+        // complexity, where 'N' is the size of this multimap, and invalidates
+        // all iterators to this multimap.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multimap (in constant time,
+        // plus the time to move the pairs that follow it, if the specified
+        // 'hint' is a valid position for 'value' in the ordered sequence of
+        // pairs, and in logarithmic time plus that time otherwise), and return
+        // an iterator referring to the newly inserted 'value_type' object.  If
+        // 'hint' is a valid position, 'value' is inserted immediately before
+        // 'hint'; otherwise, it is inserted after any pairs having equivalent
+        // keys.  The behavior is undefined unless 'hint' is an iterator in the
+        // range '[begin() .. end()]' (both endpoints included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, after any pairs
+        // having equivalent keys.  The pairs are appended to the underlying
+        // sequence and then merged with it (see 'bslstl_flattreeutil'), so
+        // that this operation has 'O[N + M * log(M)]' complexity, where 'N' is
+        // the size of this multimap and 'M' is the length of the range.  If an
+        // exception is thrown while the range is being appended, this multimap
+        // is left unchanged; if one is thrown while the pairs are being
+        // ordered, this multimap is left empty.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR first,
+                INPUT_ITERATOR last);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, after any pairs
+        // having equivalent keys.  The behavior is undefined unless the keys
+        // of the range are ordered according to 'key_comp()'.  Note that this
+        // operation has 'O[N + M]' complexity, where 'N' is the size of this
+        // multimap and 'M' is the length of the range.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<value_type> values);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the specified 'values' initializer list, after any pairs having
+        // equivalent keys.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... Args>
+    iterator emplace(Args&&... arguments);
+        // Insert into this multimap a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', after any pairs having equivalent keys,
+        // and return an iterator referring to the newly created and inserted
+        // object.  The new object is constructed at the end of the underlying
+        // sequence and then rotated into position.
+
+    template <class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... arguments);
+        // Insert into this multimap a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', immediately before the specified 'hint'
+        // if that is a valid position for the new object, and after any pairs
+        // having equivalent keys otherwise.  Return an iterator referring to
+        // the newly created and inserted object.  The behavior is undefined
+        // unless 'hint' is an iterator in the range '[begin() .. end()]' (both
+        // endpoints included).
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this multimap the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this multimap.  This method
+        // invalidates all iterators at or after 'position'.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // multimap.
+
+    size_type erase(const key_type& key);
+        // Remove from this multimap all 'value_type' objects whose keys are
+        // equivalent to the specified 'key', and return the number of objects
+        // removed.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multimap the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this multimap
+        // or are the 'end' iterator, and the 'first' position is at or before
+        // the 'last' position in the ordered sequence provided by this
+        // container.
+
+    void swap(flat_multimap& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with the value and
+        // comparator of the specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees 'O[1]' complexity if either allocators are exchanged or
+        // this object was created with the same allocator as 'other' (unless
+        // swapping the (user-supplied) comparators throws); otherwise, it
+        // has 'O[n + m]' complexity, where 'n' and 'm' are the sizes of this
+        // object and 'other', respectively.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this multimap.  Note that the multimap is
+        // empty after this call, but allocated memory may be retained for
+        // future use.
+
+    void reserve(size_type numPairs);
+        // Change the capacity of this multimap to at least the specified
+        // 'numPairs'.  If an exception is thrown, this multimap is left
+        // unchanged.  Note that this method has no effect if the current
+        // capacity meets or exceeds the required capacity.
+
+    void shrink_to_fit();
+        // Minimize the memory used by this multimap to the extent possible
+        // without moving any pairs.
+
+    // Turn off complaints about necessarily class-defined methods.
+    // BDE_VERIFY pragma: push
+    // BDE_VERIFY pragma: -CD01
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    erase(const LOOKUP_KEY& key)
+        // Remove from this multimap all 'value_type' objects whose keys are
+        // equivalent to the specified 'key', and return the number of objects
+        // removed.
+    {
+        const pair<iterator, iterator> range = equal_range(key);
+        const size_type numErased = range.second - range.first;
+        d_data.erase(range.first, range.second);
+        return numErased;
+    }
+
+    iterator find(const key_type& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+    {
+        iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+    {
+        iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    iterator lower_bound(const key_type& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multimap does not contain such an object.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multimap does not contain such an object.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    iterator upper_bound(const key_type& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this multimap does not contain such an object.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this multimap does not contain such an object.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.
+    {
+        iterator startIt = lower_bound(key);
+        return pair<iterator, iterator>(
+                         startIt,
+                         TreeUtil::upperBound<KeyConfig>(startIt,
+                                                         d_data.end(),
+                                                         key,
+                                                         d_comparator));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.
+    {
+        iterator startIt = lower_bound(key);
+        return pair<iterator, iterator>(
+                         startIt,
+                         TreeUtil::upperBound<KeyConfig>(startIt,
+                                                         d_data.end(),
+                                                         key,
+                                                         d_comparator));
+    }
+
+    // BDE_VERIFY pragma: pop
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // multimap.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or the 'end' iterator if this multimap
+        // is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this multimap.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multimap, or 'rend' if this multimap is
+        // empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multimap.
+
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or the 'cend' iterator if this multimap
+        // is empty.
+
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this multimap.
+
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multimap, or 'crend' if this multimap is
+        // empty.
+
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multimap.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this multimap contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this multimap.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this multimap could possibly hold.  Note that there is no
+        // guarantee that the multimap can successfully grow to the returned
+        // size, or even close to that size without running out of resources.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of key-value pairs this multimap can hold without
+        // allocating memory.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // multimap; if a comparator was supplied at construction, return its
+        // value, otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by comparing
+        // their keys using 'key_comp()'.
+
+    const container_type& sequence() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reference providing non-modifiable access to the vector
+        // holding the key-value pairs of this multimap, in key order.
+
+    // Turn off complaints about necessarily class-defined methods.
+    // BDE_VERIFY pragma: push
+    // BDE_VERIFY pragma: -CD01
+
+    const_iterator find(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, it->first) ? it : end();
+    }
+
+    bool contains(const key_type& key) const
+        // Return 'true' if this multimap contains a 'value_type' object whose
+        // key is equivalent to the specified 'key', and 'false' otherwise.
+    {
+        return find(key) != end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this multimap contains a 'value_type' object whose
+        // key is equivalent to the specified 'key', and 'false' otherwise.
+    {
+        return find(key) != end();
+    }
+
+    size_type count(const key_type& key) const
+        // Return the number of 'value_type' objects within this multimap whose
+        // keys are equivalent to the specified 'key'.
+    {
+        const pair<const_iterator, const_iterator> range = equal_range(key);
+        return range.second - range.first;
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this multimap whose
+        // keys are equivalent to the specified 'key'.
+    {
+        const pair<const_iterator, const_iterator> range = equal_range(key);
+        return range.second - range.first;
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater-than or equal-to the specified 'key', and the
+        // past-the-end iterator if this multimap does not contain such an
+        // object.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater-than or equal-to the specified 'key', and the
+        // past-the-end iterator if this multimap does not contain such an
+        // object.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater than the specified 'key', and the past-the-end iterator
+        // if this multimap does not contain such an object.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater than the specified 'key', and the past-the-end iterator
+        // if this multimap does not contain such an object.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.
+    {
+        const_iterator startIt = lower_bound(key);
+        return pair<const_iterator, const_iterator>(
+                         startIt,
+                         TreeUtil::upperBound<KeyConfig>(startIt,
+                                                         d_data.end(),
+                                                         key,
+                                                         d_comparator));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.
+    {
+        const_iterator startIt = lower_bound(key);
+        return pair<const_iterator, const_iterator>(
+                         startIt,
+                         TreeUtil::upperBound<KeyConfig>(startIt,
+                                                         d_data.end(),
+                                                         key,
+                                                         d_comparator));
+    }
+
+    // BDE_VERIFY pragma: pop
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multimap' objects 'lhs' and
+    // 'rhs' have the same value if they have the same number of key-value
+    // pairs, and each element in the ordered sequence of key-value pairs of
+    // 'lhs' has the same value as the corresponding element in the ordered
+    // sequence of key-value pairs of 'rhs'.  This method requires that the
+    // (template parameter) types 'KEY' and 'VALUE' both be
+    // 'equality-comparable'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_multimap' objects 'lhs'
+    // and 'rhs' do not have the same value if they do not have the same number
+    // of key-value pairs, or some element in the ordered sequence of key-value
+    // pairs of 'lhs' does not have the same value as the corresponding element
+    // in the ordered sequence of key-value pairs of 'rhs'.  This method
+    // requires that the (template parameter) types 'KEY' and 'VALUE' both be
+    // 'equality-comparable'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically less than that of the specified 'rhs' multimap, and
+    // 'false' otherwise (see 'bsl::multimap').  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically greater than that of the specified 'rhs' multimap, and
+    // 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  Note that this operator returns
+    // '!(rhs < lhs)'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with the
+    // value and comparator of the specified 'b' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'a' with that of 'b'.  See the
+    // 'swap' method for complexity and exception-safety guarantees.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class flat_multimap
+                            // -------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap()
+: d_comparator()
+, d_data()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                               const ALLOCATOR& basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                                 const flat_multimap& original)
+: d_comparator(original.d_comparator)
+, d_data(original.d_data)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                        BloombergLP::bslmf::MovableRef<flat_multimap> original)
+: d_comparator(MoveUtil::access(original).d_comparator)
+, d_data(MoveUtil::move(MoveUtil::access(original).d_data))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                          const flat_multimap& original,
+                                          const ALLOCATOR&     basicAllocator)
+: d_comparator(original.d_comparator)
+, d_data(original.d_data, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                  BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                  const ALLOCATOR&                              basicAllocator)
+: d_comparator(MoveUtil::access(original).d_comparator)
+, d_data(MoveUtil::move(MoveUtil::access(original).d_data), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                 BloombergLP::bslmf::MovableRef<container_type> container,
+                 const COMPARATOR&                              comparator)
+: d_comparator(comparator)
+, d_data(MoveUtil::move(container))
+{
+    TreeUtil::mergeTailMulti<KeyConfig>(&d_data, 0, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                 sorted_equivalent_t,
+                 BloombergLP::bslmf::MovableRef<container_type> container,
+                 const COMPARATOR&                              comparator)
+: d_comparator(comparator)
+, d_data(MoveUtil::move(container))
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSorted<KeyConfig>(d_data.begin(),
+                                                   d_data.end(),
+                                                   d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_comparator(comparator)
+, d_data(basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const ALLOCATOR&  basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            sorted_equivalent_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_comparator(comparator)
+, d_data(first, last, basicAllocator)
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSorted<KeyConfig>(d_data.begin(),
+                                                   d_data.end(),
+                                                   d_comparator));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            sorted_equivalent_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const ALLOCATOR&  basicAllocator)
+: d_comparator()
+, d_data(first, last, basicAllocator)
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSorted<KeyConfig>(d_data.begin(),
+                                                   d_data.end(),
+                                                   d_comparator));
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                             std::initializer_list<value_type> values,
+                             const COMPARATOR&                 comparator,
+                             const ALLOCATOR&                  basicAllocator)
+: d_comparator(comparator)
+, d_data(basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                             std::initializer_list<value_type> values,
+                             const ALLOCATOR&                  basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::~flat_multimap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                                      const flat_multimap& rhs)
+{
+    if (this != &rhs) {
+        d_data       = rhs.d_data;
+        d_comparator = rhs.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                             BloombergLP::bslmf::MovableRef<flat_multimap> rhs)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    flat_multimap& lvalue = rhs;
+
+    if (this != &lvalue) {
+        d_data       = MoveUtil::move(lvalue.d_data);
+        d_comparator = lvalue.d_comparator;
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                       const value_type& value)
+{
+    return d_data.insert(upper_bound(value.first), value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    return d_data.insert(upper_bound(lvalue.first), MoveUtil::move(lvalue));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                       const_iterator    hint,
+                                                       const value_type& value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint);
+    BSLS_ASSERT_SAFE(hint     <= cend());
+
+    if ((hint == cend()   || !d_comparator(hint->first, value.first))
+     && (hint == cbegin() || !d_comparator(value.first, (hint - 1)->first))) {
+        return d_data.insert(hint, value);                            // RETURN
+    }
+    return insert(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint);
+    BSLS_ASSERT_SAFE(hint     <= cend());
+
+    value_type& lvalue = value;
+
+    if ((hint == cend()   || !d_comparator(hint->first, lvalue.first))
+     && (hint == cbegin() || !d_comparator(lvalue.first, (hint - 1)->first))) {
+        return d_data.insert(hint, MoveUtil::move(lvalue));           // RETURN
+    }
+    return insert(MoveUtil::move(lvalue));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    TreeUtil::insertRangeMulti<KeyConfig>(&d_data, first, last, d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                          sorted_equivalent_t,
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    // The merge detects input that is entirely ordered after the current
+    // contents, so no special handling is needed here.
+
+    TreeUtil::insertRangeMulti<KeyConfig>(&d_data, first, last, d_comparator);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace(Args&&... arguments)
+{
+    d_data.emplace_back(BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+
+    iterator last = d_data.end() - 1;
+    iterator it   = TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                                    last,
+                                                    last->first,
+                                                    d_comparator);
+    native_std::rotate(it, last, d_data.end());
+    return it;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::emplace_hint(
+                                                   const_iterator hint,
+                                                   Args&&...      arguments)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint);
+    BSLS_ASSERT_SAFE(hint     <= cend());
+
+    const difference_type offset = hint - cbegin();
+
+    d_data.emplace_back(BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+
+    iterator last = d_data.end() - 1;
+    iterator it   = d_data.begin() + offset;
+
+    if ((it != last           && d_comparator(it->first, last->first))
+     || (it != d_data.begin() && d_comparator(last->first, (it - 1)->first))) {
+        // The hint is not a valid position for the new pair, so place it
+        // after any pairs having equivalent keys, as 'emplace' would.
+
+        it = TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                             last,
+                                             last->first,
+                                             d_comparator);
+    }
+    native_std::rotate(it, last, d_data.end());
+    return it;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != cend());
+
+    return d_data.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const pair<iterator, iterator> range = equal_range(key);
+    const size_type numErased = range.second - range.first;
+    d_data.erase(range.first, range.second);
+    return numErased;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                        const_iterator last)
+{
+    return d_data.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(
+                                                          flat_multimap& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    bsl::swap(d_data, other.d_data);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    d_data.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                            size_type numPairs)
+{
+    d_data.reserve(numPairs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_data.shrink_to_fit();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.get_allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+      flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+      flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+      flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return rbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename
+      flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return rend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_comparator);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename
+            flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::container_type&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::sequence() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+             const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                       bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
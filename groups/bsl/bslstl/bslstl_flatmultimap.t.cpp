@@ -0,0 +1,1115 @@
+// bslstl_flatmultimap.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultimap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_multimap.h>
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bsl::flat_multimap' is a thin adapter of 'bsl::vector' whose searching and
+// ordering are delegated to 'bslstl::FlatTreeUtil' (tested separately), in
+// the same manner as 'bsl::flat_multiset' (also tested separately).  We
+// therefore concentrate on the forwarding of each method, on the allocator
+// used, and on agreement with 'bsl::multimap' for the same operations.  Since
+// 'bsl::multimap' keeps pairs having equivalent keys in insertion order, we
+// compare the two using mapped values that identify each pair, which verifies
+// that 'flat_multimap' does the same.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multimap();
+// [ 2] explicit flat_multimap(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] explicit flat_multimap(const ALLOCATOR&);
+// [ 2] flat_multimap(const flat_multimap&);
+// [ 2] flat_multimap(MovableRef<flat_multimap>);
+// [ 2] flat_multimap(const flat_multimap&, const ALLOCATOR&);
+// [ 2] flat_multimap(MovableRef<flat_multimap>, const ALLOCATOR&);
+// [ 2] explicit flat_multimap(MovableRef<container_type>, const COMP&);
+// [ 2] flat_multimap(sorted_equivalent_t, MovableRef<container_type>, C);
+// [ 2] flat_multimap(INPUT_ITER, INPUT_ITER, const COMP&, const ALLOC&);
+// [ 2] flat_multimap(INPUT_ITER, INPUT_ITER, const ALLOCATOR&);
+// [ 2] flat_multimap(sorted_equivalent_t, INPUT_ITER, INPUT_ITER, ...);
+// [ 2] flat_multimap(initializer_list<value_type>, const COMP&, ...);
+// [ 2] flat_multimap(initializer_list<value_type>, const ALLOCATOR&);
+// [ 2] ~flat_multimap();
+//
+// MANIPULATORS
+// [ 5] flat_multimap& operator=(const flat_multimap&);
+// [ 5] flat_multimap& operator=(MovableRef<flat_multimap>);
+// [ 5] flat_multimap& operator=(initializer_list<value_type>);
+// [ 4] iterator begin();
+// [ 4] iterator end();
+// [ 4] reverse_iterator rbegin();
+// [ 4] reverse_iterator rend();
+// [ 3] iterator insert(const value_type&);
+// [ 3] iterator insert(MovableRef<value_type>);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] iterator insert(const_iterator, MovableRef<value_type>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list<value_type>);
+// [ 3] iterator emplace(Args&&...);
+// [ 3] iterator emplace_hint(const_iterator, Args&&...);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] size_type erase(const LOOKUP_KEY&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 5] void swap(flat_multimap&);
+// [ 3] void clear();
+// [ 2] void reserve(size_type);
+// [ 2] void shrink_to_fit();
+// [ 4] iterator find(const key_type&);
+// [ 4] iterator lower_bound(const key_type&);
+// [ 4] iterator upper_bound(const key_type&);
+// [ 4] pair<iterator, iterator> equal_range(const key_type&);
+// [ 4] iterator find(const LOOKUP_KEY&);
+// [ 4] iterator lower_bound(const LOOKUP_KEY&);
+// [ 4] iterator upper_bound(const LOOKUP_KEY&);
+// [ 4] pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_reverse_iterator rbegin() const;
+// [ 4] const_reverse_iterator rend() const;
+// [ 4] const_iterator cbegin() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_reverse_iterator crbegin() const;
+// [ 4] const_reverse_iterator crend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type capacity() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 2] const container_type& sequence() const;
+// [ 4] bool contains(const key_type&) const;
+// [ 4] const_iterator find(const key_type&) const;
+// [ 4] size_type count(const key_type&) const;
+// [ 4] const_iterator lower_bound(const key_type&) const;
+// [ 4] const_iterator upper_bound(const key_type&) const;
+// [ 4] pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [ 4] bool contains(const LOOKUP_KEY&) const;
+// [ 4] const_iterator find(const LOOKUP_KEY&) const;
+// [ 4] size_type count(const LOOKUP_KEY&) const;
+// [ 4] const_iterator lower_bound(const LOOKUP_KEY&) const;
+// [ 4] const_iterator upper_bound(const LOOKUP_KEY&) const;
+// [ 4] pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const flat_multimap&, const flat_multimap&);
+// [ 5] bool operator!=(const flat_multimap&, const flat_multimap&);
+// [ 5] bool operator< (const flat_multimap&, const flat_multimap&);
+// [ 5] bool operator> (const flat_multimap&, const flat_multimap&);
+// [ 5] bool operator<=(const flat_multimap&, const flat_multimap&);
+// [ 5] bool operator>=(const flat_multimap&, const flat_multimap&);
+// [ 5] void swap(flat_multimap&, flat_multimap&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct TransparentLess {
+    // This 'struct' provides a transparent comparator for 'int' keys that
+    // counts the number of comparisons it performs with 'long' lookup keys.
+
+    // PUBLIC TYPES
+    typedef void is_transparent;
+
+    // CLASS DATA
+    static int s_numLongComparisons;
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'lhs < rhs'.
+    {
+        return lhs < rhs;
+    }
+
+    bool operator()(long lhs, int rhs) const
+        // Return 'lhs < rhs'.
+    {
+        ++s_numLongComparisons;
+        return lhs < rhs;
+    }
+
+    bool operator()(int lhs, long rhs) const
+        // Return 'lhs < rhs'.
+    {
+        ++s_numLongComparisons;
+        return lhs < rhs;
+    }
+};
+
+int TransparentLess::s_numLongComparisons = 0;
+
+typedef bsl::flat_multimap<int, int, TransparentLess>    Obj;
+typedef Obj::value_type                                  Pair;
+typedef bsl::multimap<int, int>                          Reference;
+typedef bsl::flat_multimap<int, int>                     IntObj;
+typedef bsl::flat_multimap<bsl::string, bsl::string>     StringObj;
+typedef bslmf::MovableRefUtil                            MoveUtil;
+
+BSLMF_ASSERT((bsl::is_same<bsl::pair<int, int>, Obj::value_type>::value));
+BSLMF_ASSERT((bsl::is_same<bsl::pair<int, int> *, Obj::iterator>::value));
+
+namespace {
+
+template <class OBJ>
+bool verifyEqual(const OBJ& object, const Reference& reference)
+    // Return 'true' if the specified 'object' holds the same key-value pairs,
+    // in the same order, as the specified 'reference', and 'false' otherwise.
+{
+    if (object.size() != reference.size()) {
+        return false;                                                 // RETURN
+    }
+    Reference::const_iterator rit = reference.begin();
+    for (typename OBJ::const_iterator it = object.begin();
+         it != object.end();
+         ++it, ++rit) {
+        if (it->first != rit->first || it->second != rit->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Indexing Log Records by Severity
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that, having read a log file, we want to list the messages of each
+// severity in the order in which they were logged.  A 'flat_multimap' keyed
+// by severity keeps messages of equal severity in insertion order.
+//
+// First, we define the records, in the order in which they were logged:
+//..
+        typedef bsl::pair<int, const char *> Record;
+
+        const Record RECORDS[] = {
+            Record(2, "disk 80% full"),
+            Record(1, "request served"),
+            Record(3, "disk full"),
+            Record(2, "disk 90% full"),
+            Record(1, "request served"),
+        };
+        const int NUM_RECORDS = sizeof RECORDS / sizeof *RECORDS;
+//..
+// Then, we build the index:
+//..
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::flat_multimap<int, const char *> index(RECORDS,
+                                                    RECORDS + NUM_RECORDS,
+                                                    &oa);
+        ASSERT(NUM_RECORDS == index.size());
+//..
+// Finally, we list the warnings (severity 2), and observe that they appear in
+// the order in which they were logged:
+//..
+        typedef bsl::flat_multimap<int, const char *>::const_iterator Iterator;
+
+        bsl::pair<Iterator, Iterator> warnings = index.equal_range(2);
+        ASSERT(2 == warnings.second - warnings.first);
+        ASSERT(0 == strcmp("disk 80% full", warnings.first[0].second));
+        ASSERT(0 == strcmp("disk 90% full", warnings.first[1].second));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Assignment copies (or moves) the pairs and retains the allocator
+        //:   of the target.
+        //:
+        //: 2 'swap' exchanges the pairs, including between multimaps using
+        //:   different allocators.
+        //:
+        //: 3 The comparison operators compare the sequences of key-value pairs
+        //:   lexicographically, including pairs having repeated keys.
+        //
+        // Plan:
+        //: 1 Assign and swap between multimaps with different allocators, and
+        //:   check the value and allocator of each.  (C-1..2)
+        //:
+        //: 2 Use the table-driven technique for the comparison operators, with
+        //:   specifications listing the key and the mapped value of each pair
+        //:   as two digits.  (C-3)
+        //
+        // Testing:
+        //   flat_multimap& operator=(const flat_multimap&);
+        //   flat_multimap& operator=(MovableRef<flat_multimap>);
+        //   flat_multimap& operator=(initializer_list<value_type>);
+        //   void swap(flat_multimap&);
+        //   bool operator==(const flat_multimap&, const flat_multimap&);
+        //   bool operator!=(const flat_multimap&, const flat_multimap&);
+        //   bool operator< (const flat_multimap&, const flat_multimap&);
+        //   bool operator> (const flat_multimap&, const flat_multimap&);
+        //   bool operator<=(const flat_multimap&, const flat_multimap&);
+        //   bool operator>=(const flat_multimap&, const flat_multimap&);
+        //   void swap(flat_multimap&, flat_multimap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const Pair VALUES[] = { Pair(3, 0), Pair(1, 1), Pair(4, 2),
+                                Pair(1, 3), Pair(5, 4), Pair(9, 5),
+                                Pair(2, 6), Pair(6, 7) };
+
+        {
+            IntObj mY(VALUES, VALUES + 8, &za);  const IntObj& Y = mY;
+            IntObj mX(&oa);                      const IntObj& X = mX;
+
+            ASSERT(&mX == &(mX = Y));
+            ASSERT(Y == X);
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(2 == X.count(1));
+
+            IntObj mZ(&oa);  const IntObj& Z = mZ;
+            mZ = MoveUtil::move(mX);
+            ASSERT(Y == Z);
+
+            mZ = MoveUtil::move(mY);
+            ASSERT(&oa == Z.get_allocator());
+            ASSERT(8 == Z.size());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mZ = { Pair(7, 0), Pair(8, 1), Pair(7, 2) };
+            ASSERT(3 == Z.size());
+            ASSERT(2 == Z.count(7));
+            ASSERT(0 == Z.begin()->second);
+#endif
+
+            IntObj mA(VALUES, VALUES + 4, &oa);  const IntObj& A = mA;
+            IntObj mB(&za);                      const IntObj& B = mB;
+            const IntObj AA(A, &oa);
+
+            swap(mA, mB);
+            ASSERT(AA == B);
+            ASSERT(A.empty());
+            ASSERT(&oa == A.get_allocator());
+            ASSERT(&za == B.get_allocator());
+
+            mA.swap(mZ);
+            ASSERT(A.size() == 3 && Z.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        {
+            static const struct {
+                int         d_line;
+                const char *d_spec;
+            } DATA[] = {
+                // Listed in increasing lexicographical order.
+
+                { L_, ""       },
+                { L_, "10"     },
+                { L_, "1010"   },
+                { L_, "101020" },
+                { L_, "1011"   },
+                { L_, "1020"   },
+                { L_, "11"     },
+                { L_, "1110"   },
+                { L_, "20"     },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                IntObj mX(&oa);  const IntObj& X = mX;
+                for (const char *p = DATA[ti].d_spec; *p; p += 2) {
+                    mX.insert(Pair(p[0] - '0', p[1] - '0'));
+                }
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    IntObj mY(&za);  const IntObj& Y = mY;
+                    for (const char *p = DATA[tj].d_spec; *p; p += 2) {
+                        mY.insert(Pair(p[0] - '0', p[1] - '0'));
+                    }
+
+                    ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                    ASSERTV(ti, tj, (ti != tj) == (X != Y));
+                    ASSERTV(ti, tj, (ti <  tj) == (X <  Y));
+                    ASSERTV(ti, tj, (ti >  tj) == (X >  Y));
+                    ASSERTV(ti, tj, (ti <= tj) == (X <= Y));
+                    ASSERTV(ti, tj, (ti >= tj) == (X >= Y));
+                }
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP AND ITERATION
+        //
+        // Concerns:
+        //: 1 Each lookup method returns the same position as the
+        //:   corresponding method of 'bsl::multimap' having the same pairs,
+        //:   for keys that are absent, present once, and repeated.
+        //:
+        //: 2 The modifiable lookups return the same positions as the
+        //:   non-modifiable ones, and provide modifiable access to the mapped
+        //:   values.
+        //:
+        //: 3 The transparent overloads are usable with a lookup key of a
+        //:   different type, and pass that key to the comparator unconverted.
+        //:
+        //: 4 Forward and reverse iteration visit the pairs in order.
+        //
+        // Plan:
+        //: 1 For multimaps of every size in '[0 .. 30]' holding keys 'i / 3'
+        //:   for even 'i', search for every key in '[-1 .. size]' and compare
+        //:   (by distance from 'begin') with a 'bsl::multimap'.  Search using
+        //:   both 'int' and 'long' keys, and check that the comparator
+        //:   counted comparisons with the latter.  (C-1..4)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   iterator find(const key_type&);
+        //   iterator lower_bound(const key_type&);
+        //   iterator upper_bound(const key_type&);
+        //   pair<iterator, iterator> equal_range(const key_type&);
+        //   iterator find(const LOOKUP_KEY&);
+        //   iterator lower_bound(const LOOKUP_KEY&);
+        //   iterator upper_bound(const LOOKUP_KEY&);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   bool contains(const key_type&) const;
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iter, const_iter> equal_range(const key_type&) const;
+        //   bool contains(const LOOKUP_KEY&) const;
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   size_type count(const LOOKUP_KEY&) const;
+        //   const_iterator lower_bound(const LOOKUP_KEY&) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY&) const;
+        //   pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP AND ITERATION"
+                            "\n====================\n");
+
+        for (int size = 0; size <= 30; ++size) {
+            Obj       mX;  const Obj&       X = mX;
+            Reference mR;  const Reference& R = mR;
+
+            for (int i = 0; i < 2 * size; i += 2) {
+                mX.insert(Pair(i / 3, i));
+                mR.insert(Pair(i / 3, i));
+            }
+
+            ASSERTV(size, verifyEqual(X, R));
+            ASSERTV(size, X.cbegin() == X.begin() && X.cend() == X.end());
+            ASSERTV(size, mX.begin() == X.begin() && mX.end() == X.end());
+            ASSERTV(size, mX.rbegin() == X.rbegin());
+            ASSERTV(size, mX.rend() == X.rend());
+            ASSERTV(size, X.crbegin() == X.rbegin());
+            ASSERTV(size, X.crend() == X.rend());
+            ASSERTV(size, size == native_std::distance(X.rbegin(),
+                                                       X.rend()));
+            if (size) {
+                ASSERTV(size, X.rbegin()->second == R.rbegin()->second);
+            }
+
+            for (int key = -1; key <= size; ++key) {
+                const long LKEY = key;
+
+#define DIST(CONTAINER, ITERATOR)                                             \
+    native_std::distance(CONTAINER.begin(), ITERATOR)
+
+                ASSERTV(size, key, DIST(R, R.find(key)) ==
+                                                        DIST(X, X.find(key)));
+                ASSERTV(size, key, R.count(key) == X.count(key));
+                ASSERTV(size, key, (0 < R.count(key)) == X.contains(key));
+                ASSERTV(size, key, DIST(R, R.lower_bound(key)) ==
+                                                  DIST(X, X.lower_bound(key)));
+                ASSERTV(size, key, DIST(R, R.upper_bound(key)) ==
+                                                  DIST(X, X.upper_bound(key)));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).first) ==
+                                          DIST(X, X.equal_range(key).first));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).second) ==
+                                          DIST(X, X.equal_range(key).second));
+
+                ASSERTV(size, key, X.find(key) == mX.find(key));
+                ASSERTV(size, key, X.lower_bound(key) == mX.lower_bound(key));
+                ASSERTV(size, key, X.upper_bound(key) == mX.upper_bound(key));
+                ASSERTV(size, key, X.equal_range(key).first ==
+                                                  mX.equal_range(key).first);
+                ASSERTV(size, key, X.equal_range(key).second ==
+                                                 mX.equal_range(key).second);
+
+                TransparentLess::s_numLongComparisons = 0;
+
+                ASSERTV(size, key, X.find(key) == X.find(LKEY));
+                ASSERTV(size, key, X.find(key) == mX.find(LKEY));
+                ASSERTV(size, key, X.count(key) == X.count(LKEY));
+                ASSERTV(size, key, X.contains(key) == X.contains(LKEY));
+                ASSERTV(size, key, X.lower_bound(key) == X.lower_bound(LKEY));
+                ASSERTV(size, key, X.lower_bound(key) ==
+                                                        mX.lower_bound(LKEY));
+                ASSERTV(size, key, X.upper_bound(key) == X.upper_bound(LKEY));
+                ASSERTV(size, key, X.upper_bound(key) ==
+                                                        mX.upper_bound(LKEY));
+                ASSERTV(size, key, X.equal_range(key).first ==
+                                                   X.equal_range(LKEY).first);
+                ASSERTV(size, key, X.equal_range(key).second ==
+                                                 mX.equal_range(LKEY).second);
+
+                ASSERTV(size, key, (0 < size) ==
+                                 (0 < TransparentLess::s_numLongComparisons));
+#undef DIST
+            }
+
+            if (size) {
+                Obj::iterator it = mX.find(0);
+                it->second = -1;
+                ASSERTV(size, -1 == X.begin()->second);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, EMPLACE, AND ERASE
+        //
+        // Concerns:
+        //: 1 Each single-pair insertion inserts the pair after any pairs
+        //:   having equivalent keys, and returns an iterator to it.
+        //:
+        //: 2 Hinted insertion inserts at the hint if that keeps the keys in
+        //:   order, and after any pairs having equivalent keys otherwise.
+        //:
+        //: 3 Range insertion merges the range, placing the new pairs after
+        //:   existing pairs having equivalent keys and keeping their relative
+        //:   order.
+        //:
+        //: 4 Each 'erase' removes the specified pairs and returns the correct
+        //:   value.
+        //:
+        //: 5 The allocator of the multimap is passed to keys and mapped values
+        //:   that use one.
+        //:
+        //: 6 Range insertion is exception neutral.
+        //
+        // Plan:
+        //: 1 Perform a sequence of operations on a 'flat_multimap' and a
+        //:   'bsl::multimap', comparing the results and the contents
+        //:   (including the mapped values, which identify each pair) after
+        //:   each.  (C-1..4)
+        //:
+        //: 2 Insert into a multimap of strings and check their allocators.
+        //:   (C-5)
+        //:
+        //: 3 Insert a range in an exception test loop.  (C-6)
+        //
+        // Testing:
+        //   iterator insert(const value_type&);
+        //   iterator insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   iterator insert(const_iterator, MovableRef<value_type>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<value_type>);
+        //   iterator emplace(Args&&...);
+        //   iterator emplace_hint(const_iterator, Args&&...);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   size_type erase(const LOOKUP_KEY&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERT, EMPLACE, AND ERASE"
+                            "\n==========================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting single-pair insertion.\n");
+        {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference mR;       const Reference& R = mR;
+
+            const int KEYS[] = { 5, 1, 9, 5, 3, 7, 1, 0, 10, 9, 5, 4 };
+            const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const Pair VALUE(KEYS[i], i);
+
+                Obj::iterator it;
+                if (i % 2) {
+                    it = mX.insert(VALUE);
+                }
+                else {
+                    Pair value(VALUE);
+                    it = mX.insert(MoveUtil::move(value));
+                }
+                mR.insert(VALUE);
+
+                ASSERTV(i, VALUE == *it);
+                ASSERTV(i, verifyEqual(X, R));
+            }
+
+            // Hints: correct and incorrect, against the reference's handling
+            // of the same hints.
+
+            for (int key = -1; key <= 11; ++key) {
+                for (int h = 0; h <= static_cast<int>(X.size()); ++h) {
+                    Obj       mY(X, &oa);  const Obj& Y = mY;
+                    Reference mS(R);
+
+                    const Pair VALUE(key, 100);
+
+                    Obj::iterator       iy;
+                    if (h % 2) {
+                        iy = mY.insert(Y.begin() + h, VALUE);
+                    }
+                    else {
+                        Pair value(VALUE);
+                        iy = mY.insert(Y.begin() + h, MoveUtil::move(value));
+                    }
+                    Reference::iterator is = mS.begin();
+                    native_std::advance(is, h);
+                    is = mS.insert(is, VALUE);
+
+                    ASSERTV(key, h, VALUE == *iy);
+                    ASSERTV(key, h, iy - Y.begin() ==
+                                     native_std::distance(mS.begin(), is));
+                    ASSERTV(key, h, verifyEqual(Y, mS));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+                    Obj mZ(X, &oa);  const Obj& Z = mZ;
+                    Obj::iterator iz = mZ.emplace_hint(Z.begin() + h,
+                                                       key,
+                                                       100);
+                    ASSERTV(key, h, VALUE == *iz);
+                    ASSERTV(key, h, Y == Z);
+#endif
+                }
+            }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            Obj::iterator ie = mX.emplace(5, 200);
+            ASSERT(Pair(5, 200) == *ie);
+            mR.insert(Pair(5, 200));
+            ASSERT(verifyEqual(X, R));
+#endif
+
+            ASSERT(R.count(5) == mX.erase(5));
+            ASSERT(0 == mX.erase(5));
+            mR.erase(5);
+            ASSERT(verifyEqual(X, R));
+
+            TransparentLess::s_numLongComparisons = 0;
+            ASSERT(2 == mX.erase(9L));
+            ASSERT(0 < TransparentLess::s_numLongComparisons);
+            mR.erase(9);
+            ASSERT(verifyEqual(X, R));
+
+            Obj::iterator it = mX.erase(X.find(3));
+            ASSERT(4 == it->first);
+            mR.erase(mR.find(3));
+            ASSERT(verifyEqual(X, R));
+
+            it = mX.erase(X.lower_bound(1), X.upper_bound(4));
+            ASSERT(7 == it->first);
+            mR.erase(mR.lower_bound(1), mR.upper_bound(4));
+            ASSERT(verifyEqual(X, R));
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range insertion.\n");
+        {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference mR;       const Reference& R = mR;
+
+            const int HEAD[] = { 2, 4, 4, 6, 8 };
+            const int TAIL[] = { 9, 4, 1, 8, 8, 0, 4 };
+
+            bsl::vector<Pair> head, tail, sorted;
+            for (int i = 0; i < 5; ++i) {
+                head.push_back(Pair(HEAD[i], i));
+            }
+            for (int i = 0; i < 7; ++i) {
+                tail.push_back(Pair(TAIL[i], 10 + i));
+            }
+            for (int i = 0; i < 6; ++i) {
+                sorted.push_back(Pair(i * 2, 20 + i));
+            }
+
+            mX.insert(head.begin(), head.end());
+            mR.insert(head.begin(), head.end());
+            ASSERT(verifyEqual(X, R));
+
+            mX.insert(tail.begin(), tail.end());
+            mR.insert(tail.begin(), tail.end());
+            ASSERT(verifyEqual(X, R));
+
+            mX.insert(bsl::sorted_equivalent, sorted.begin(), sorted.end());
+            mR.insert(sorted.begin(), sorted.end());
+            ASSERT(verifyEqual(X, R));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            IntObj mY;  const IntObj& Y = mY;
+            mY.insert({ Pair(3, 0), Pair(1, 1), Pair(3, 2) });
+            mY.insert({ Pair(3, 3), Pair(0, 4) });
+            ASSERT(3 == Y.count(3));
+            ASSERT(0 == Y.begin()->first);
+            ASSERT(3 == Y.rbegin()->second);
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting allocator propagation.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            const bsl::string K("a key that is too long for the short buffer");
+            const bsl::string V("a value that is also too long for SSO");
+
+            mX.insert(StringObj::value_type(K, V));
+            mX.insert(X.end(), StringObj::value_type(K, V));
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            mX.emplace(K, V);
+#endif
+            for (StringObj::const_iterator it = X.begin(); it != X.end();
+                                                                        ++it) {
+                ASSERT(&oa == it->first.get_allocator());
+                ASSERT(&oa == it->second.get_allocator());
+            }
+            ASSERT(X.size() == X.count(K));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting exception neutrality.\n");
+        {
+            typedef bsl::pair<const char *, const char *> CharPair;
+
+            const CharPair WORDS[] = {
+                CharPair("delta-delta-delta-delta-delta-delta-delta",
+                         "one"),
+                CharPair("alpha-alpha-alpha-alpha-alpha-alpha-alpha",
+                         "two"),
+                CharPair("echo-echo-echo-echo-echo-echo-echo-echo",
+                         "three"),
+                CharPair("alpha-alpha-alpha-alpha-alpha-alpha-alpha",
+                         "four"),
+            };
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StringObj mX(&oa);  const StringObj& X = mX;
+
+                const bsls::Types::Int64 AL = oa.allocationLimit();
+                oa.setAllocationLimit(-1);
+                mX.insert(StringObj::value_type(
+                          bsl::string("charlie-charlie-charlie-charlie", &oa),
+                          bsl::string("zero", &oa)));
+                oa.setAllocationLimit(AL);
+
+                try {
+                    mX.insert(WORDS, WORDS + 4);
+                }
+                catch (...) {
+                    ASSERT(X.empty() || 1 == X.size());
+                    throw;
+                }
+                ASSERTV(X.size(), 5 == X.size());
+                ASSERT(2 == X.count(bsl::string(WORDS[1].first)));
+                ASSERT("two" == X.begin()->second);
+                ASSERT("four" == (X.begin() + 1)->second);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a multimap having the expected value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 Constructors taking unsorted input sort it stably, keeping pairs
+        //:   having duplicate keys; constructors taking sorted input use it
+        //:   unchanged.
+        //:
+        //: 3 Adopting a sorted container allocates no memory.
+        //:
+        //: 4 'reserve' and 'shrink_to_fit' change the capacity.
+        //
+        // Plan:
+        //: 1 Construct multimaps by each constructor and check their state,
+        //:   and the order of pairs having equivalent keys, against
+        //:   'bsl::multimap'.  (C-1..4)
+        //
+        // Testing:
+        //   flat_multimap();
+        //   explicit flat_multimap(const COMPARATOR&, const ALLOCATOR&);
+        //   explicit flat_multimap(const ALLOCATOR&);
+        //   flat_multimap(const flat_multimap&);
+        //   flat_multimap(MovableRef<flat_multimap>);
+        //   flat_multimap(const flat_multimap&, const ALLOCATOR&);
+        //   flat_multimap(MovableRef<flat_multimap>, const ALLOCATOR&);
+        //   explicit flat_multimap(MovableRef<container_type>, const COMP&);
+        //   flat_multimap(sorted_equivalent_t, MovableRef<container_type>, C);
+        //   flat_multimap(INPUT_ITER, INPUT_ITER, const COMP&, const ALLOC&);
+        //   flat_multimap(INPUT_ITER, INPUT_ITER, const ALLOCATOR&);
+        //   flat_multimap(sorted_equivalent_t, INPUT_ITER, INPUT_ITER, ...);
+        //   flat_multimap(initializer_list<value_type>, const COMP&, ...);
+        //   flat_multimap(initializer_list<value_type>, const ALLOCATOR&);
+        //   ~flat_multimap();
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   allocator_type get_allocator() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   size_type capacity() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const container_type& sequence() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const int KEYS[]   = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+        const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        bsl::vector<Pair> input(&za);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            input.push_back(Pair(KEYS[i], i));
+        }
+        const Reference R(input.begin(), input.end());
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 < X.max_size());
+            ASSERT(&defaultAllocator == X.get_allocator());
+        }
+        {
+            Obj mX(TransparentLess(), &oa);  const Obj& X = mX;
+            ASSERT(&oa == X.get_allocator());
+            (void) X.key_comp();
+            ASSERT( X.value_comp()(Pair(1, 9), Pair(2, 0)));
+            ASSERT(!X.value_comp()(Pair(1, 9), Pair(1, 0)));
+
+            mX.reserve(50);
+            ASSERT(50 <= X.capacity());
+            mX.insert(Pair(1, 1));
+            mX.shrink_to_fit();
+            ASSERT(1 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        {
+            Obj mX(input.begin(), input.end(), &oa);  const Obj& X = mX;
+            ASSERT(verifyEqual(X, R));
+            ASSERT(&oa == X.get_allocator());
+
+            Obj mY(input.begin(), input.end(), TransparentLess(), &oa);
+            const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            bsl::vector<Pair> v(input, &za);
+            Obj mZ(MoveUtil::move(v));  const Obj& Z = mZ;
+            ASSERT(verifyEqual(Z, R));
+            ASSERT(&za == Z.get_allocator());
+
+            bsl::vector<Pair> w(X.sequence(), &za);
+            const bsls::Types::Int64 NUM_BLOCKS = za.numBlocksTotal();
+            Obj mW(bsl::sorted_equivalent, MoveUtil::move(w));
+            const Obj& W = mW;
+            ASSERT(X == W);
+            ASSERT(NUM_BLOCKS == za.numBlocksTotal());
+
+            Obj mV(bsl::sorted_equivalent, X.begin(), X.end(), &oa);
+            const Obj& V = mV;
+            ASSERT(X == V);
+
+            Obj mU(bsl::sorted_equivalent,
+                   X.begin(),
+                   X.end(),
+                   TransparentLess(),
+                   &oa);
+            const Obj& U = mU;
+            ASSERT(X == U);
+
+            Obj mA(X);  const Obj& A = mA;
+            ASSERT(X == A);
+            ASSERT(&defaultAllocator == A.get_allocator());
+
+            Obj mB(X, &oa);  const Obj& B = mB;
+            ASSERT(X == B);
+            ASSERT(&oa == B.get_allocator());
+
+            const bsls::Types::Int64 NUM_OA = oa.numBlocksTotal();
+            Obj mC(MoveUtil::move(mB));  const Obj& C = mC;
+            ASSERT(X == C);
+            Obj mD(MoveUtil::move(mC), &oa);  const Obj& D = mD;
+            ASSERT(X == D);
+            ASSERT(NUM_OA == oa.numBlocksTotal());
+
+            Obj mE(MoveUtil::move(mD), &za);  const Obj& E = mE;
+            ASSERT(X == E);
+            ASSERT(&za == E.get_allocator());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            IntObj mX({ Pair(3, 0), Pair(1, 1), Pair(3, 2), Pair(2, 3) },
+                      &oa);
+            const IntObj& X = mX;
+            ASSERT(4 == X.size());
+            ASSERT(2 == X.count(3));
+            ASSERT(2 == X.rbegin()->second);
+
+            IntObj mY({ Pair(3, 0), Pair(1, 1), Pair(3, 2), Pair(2, 3) },
+                      std::less<int>(),
+                      &oa);
+            const IntObj& Y = mY;
+            ASSERT(X == Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform some ad-hoc tests.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj mX(&oa);  const IntObj& X = mX;
+        ASSERT(X.empty());
+
+        mX.insert(Pair(5, 0));
+        mX.insert(Pair(1, 1));
+        mX.insert(Pair(5, 2));
+        mX.insert(Pair(3, 3));
+        ASSERT(4 == X.size());
+        ASSERT(1 == X.begin()->first);
+        ASSERT(5 == X.rbegin()->first);
+        ASSERT(2 == X.rbegin()->second);
+        ASSERT(2 == X.count(5));
+
+        ASSERT(X.contains(3));
+        ASSERT(!X.contains(4));
+        ASSERT(X.find(4) == X.end());
+        ASSERT(0 == X.find(5)->second);
+        ASSERT(2 == X.end() - X.lower_bound(4));
+        ASSERT(X.upper_bound(5) == X.end());
+
+        IntObj mY(X, &oa);  const IntObj& Y = mY;
+        ASSERT(X == Y);
+        ASSERT(2 == mY.erase(5));
+        ASSERT(X != Y);
+        ASSERT(Y < X);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1570 @@
+// bslstl_flatmultiset.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTISET
+#define INCLUDED_BSLSTL_FLATMULTISET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multiset of keys held in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_multiset: ordered multiset container with contiguous storage
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatmultimap, bslstl_multiset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_multiset', implementing an ordered associative container holding
+// keys that need not be unique, in the manner of 'bsl::multiset', but storing
+// its keys contiguously, in key order, in a 'bsl::vector' rather than in the
+// nodes of a balanced binary tree.  The interface follows that of
+// 'std::flat_multiset' (C++23) where that is practical for C++03.  Equivalent
+// keys are kept in the order in which they were inserted.
+//
+// An instantiation of 'flat_multiset' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'flat_multiset' contains.  If 'flat_multiset' is
+// instantiated with a key type that is not itself value-semantic, then it will
+// not retain all of its value-semantic qualities.
+//
+// The trade-offs between 'flat_multiset' and 'bsl::multiset' are those
+// described for 'flat_set' and 'bsl::set' in {'bslstl_flatset'}: much faster
+// iteration, lookup, and bulk construction, at the cost of linear-time
+// insertion and erasure of single keys, and of invalidating iterators on every
+// modification.  The requirements on 'KEY', and the use of the 'ALLOCATOR',
+// are also as described there.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_multiset':
+//..
+//  Legend
+//  ------
+//  'K'             - template parameter 'KEY' of 'flat_multiset'
+//  'a', 'b'        - two distinct objects of type 'flat_multiset<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b', respectively
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'K' objects
+//  'k'             - an object of type 'K'
+//  'p1', 'p2'      - two 'const_iterator's belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_multiset<K> a;    (default construction)      | O[1]               |
+//  | flat_multiset<K> a(al);                            |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multiset<K> a(b); (copy construction)         | O[n]               |
+//  | flat_multiset<K> a(b, al);                         |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multiset<K> a(rv); (move construction)        | O[1] if 'a' and    |
+//  | flat_multiset<K> a(rv, al);                        | 'rv' use the same  |
+//  |                                                    | allocator; O[n]    |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multiset<K> a(i1, i2);                        | O[N] if [i1, i2)   |
+//  | flat_multiset<K> a(i1, i2, al);                    | is sorted;         |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multiset<K> a(sorted_equivalent, i1, i2);     | O[distance(i1,i2)] |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_multiset<K>(); (destruction)               | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;            (assignment)                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a, b)                              | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator; O[n + m]|
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty(), a.capacity()                  | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.get_allocator(), a.key_comp(), a.value_comp()    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k), a.emplace(args)                       | O[n]               |
+//  | a.insert(p1, k), a.emplace_hint(p1, args)          |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N * log(N)], |
+//  |                                                    | where N is         |
+//  |                                                    | distance(i1,i2)    |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(k), a.erase(p1, p2)           | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(N), a.shrink_to_fit()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.contains(k), a.find(k), a.lower_bound(k),        | O[log(n)]          |
+//  | a.upper_bound(k), a.equal_range(k)                 |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.count(k)                                         | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Computing Percentiles of a Sample
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we collect a sample of request latencies, in microseconds, and
+// want to report percentiles of the sample and the number of requests having
+// a particular latency.  Since the whole sample is available before any
+// question is asked, a 'flat_multiset' built in one step is a good fit.
+//
+// First, we build the multiset from the unordered sample:
+//..
+//  const int LATENCIES[] = { 250, 120, 980, 120, 400, 130, 120, 2000,
+//                            310, 150 };
+//  const int NUM_LATENCIES = sizeof LATENCIES / sizeof *LATENCIES;
+//
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  bsl::flat_multiset<int> sample(LATENCIES,
+//                                 LATENCIES + NUM_LATENCIES,
+//                                 &oa);
+//  assert(NUM_LATENCIES == sample.size());
+//..
+// Then, since the keys are contiguous, we can index the ordered sample
+// directly to find the median and the 90th percentile:
+//..
+//  assert( 200 == (sample.begin()[4] + sample.begin()[5]) / 2);
+//  assert( 980 == sample.begin()[NUM_LATENCIES * 9 / 10 - 1]);
+//..
+// Finally, we count the requests that took exactly 120 microseconds:
+//..
+//  assert(3 == sample.count(120));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flattreeutil.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_swaputil.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_nativestd.h>
+
+#include <algorithm>
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                            // ===================
+                            // class flat_multiset
+                            // ===================
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<KEY> >
+class flat_multiset {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of possibly duplicate keys (of the template
+    // parameter type, 'KEY') in contiguous storage.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   except for 'BDEX' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY> KeyConfig;
+        // This typedef is an alias for the policy used to extract the key from
+        // an element of this multiset.
+
+    typedef BloombergLP::bslstl::FlatTreeUtil                      TreeUtil;
+        // This typedef is an alias for the utility implementing the searching
+        // and ordering of the elements of this multiset.
+
+    typedef BloombergLP::bslmf::MovableRefUtil                     MoveUtil;
+        // This typedef is a convenient alias for the utility associated with
+        // movable references.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                       key_type;
+    typedef KEY                                       value_type;
+    typedef COMPARATOR                                key_compare;
+    typedef COMPARATOR                                value_compare;
+    typedef ALLOCATOR                                 allocator_type;
+    typedef bsl::vector<KEY, ALLOCATOR>               container_type;
+    typedef value_type&                               reference;
+    typedef const value_type&                         const_reference;
+
+    typedef typename container_type::size_type        size_type;
+    typedef typename container_type::difference_type  difference_type;
+    typedef typename container_type::pointer          pointer;
+    typedef typename container_type::const_pointer    const_pointer;
+
+    typedef typename container_type::const_iterator   iterator;
+    typedef typename container_type::const_iterator   const_iterator;
+    typedef bsl::reverse_iterator<iterator>           reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+  private:
+    // DATA
+    COMPARATOR     d_comparator;  // orders the keys
+    container_type d_data;        // keys, in order
+
+  public:
+    // CREATORS
+    flat_multiset();
+    explicit flat_multiset(const COMPARATOR& comparator,
+                           const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty multiset.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.  Note that a 'bslma::Allocator *' can be
+        // supplied for 'basicAllocator' if the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+    : d_comparator(comparator)
+    , d_data(basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug (see 'bslstl_multiset').
+    }
+
+    explicit flat_multiset(const ALLOCATOR& basicAllocator);
+        // Create an empty multiset that uses the specified 'basicAllocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // multiset.  Note that a 'bslma::Allocator *' can be supplied for
+        // 'basicAllocator' if the (template parameter) type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    flat_multiset(const flat_multiset& original);
+        // Create a multiset having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this multiset.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.
+
+    flat_multiset(BloombergLP::bslmf::MovableRef<flat_multiset> original);
+                                                                    // IMPLICIT
+        // Create a multiset having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new multiset.  Use a copy of 'original.key_comp()' to order the
+        // keys contained in this multiset.  The allocator associated with
+        // 'original' is propagated for use in the newly-created multiset.
+        // 'original' is left in a valid but unspecified state.
+
+    flat_multiset(const flat_multiset& original,
+                  const ALLOCATOR&     basicAllocator);
+        // Create a multiset having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this multiset.  Note that a 'bslma::Allocator *' can be supplied for
+        // 'basicAllocator' if the (template parameter) type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    flat_multiset(
+                 BloombergLP::bslmf::MovableRef<flat_multiset> original,
+                 const ALLOCATOR&                              basicAllocator);
+        // Create a multiset having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // multiset if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.  Use a copy of
+        // 'original.key_comp()' to order the keys contained in this multiset.
+
+    explicit flat_multiset(
+           BloombergLP::bslmf::MovableRef<container_type> container,
+           const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+        // Create a multiset holding the keys in the specified 'container',
+        // which is adopted (in constant time) as the underlying sequence of
+        // this multiset and then stably sorted.  Optionally specify a
+        // 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  This multiset uses
+        // the allocator of 'container'.  'container' is left in a valid but
+        // unspecified state.
+
+    flat_multiset(sorted_equivalent_t,
+                  BloombergLP::bslmf::MovableRef<container_type> container,
+                  const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+        // Create a multiset holding the keys in the specified 'container',
+        // which is adopted (in constant time) as the underlying sequence of
+        // this multiset.  Optionally specify a 'comparator' used to order keys
+        // contained in this object.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  This multiset uses the allocator of
+        // 'container'.  'container' is left in a valid but unspecified state.
+        // The behavior is undefined unless the keys in 'container' are ordered
+        // according to 'comparator'.
+
+    template <class INPUT_ITERATOR>
+    flat_multiset(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multiset(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const ALLOCATOR&  basicAllocator);
+        // Create a multiset, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element.  Optionally specify
+        // a 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the currently
+        // installed default allocator is used.  The keys are appended to the
+        // underlying sequence and then stably sorted as a whole, so that this
+        // operation has 'O[N]' complexity if the sequence is ordered according
+        // to 'comparator', and 'O[N * log(N)]' complexity otherwise, where 'N'
+        // is the number of elements between 'first' and 'last'.  The behavior
+        // is undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last'.  Note
+        // that a 'bslma::Allocator *' can be supplied for 'basicAllocator' if
+        // the type 'ALLOCATOR' is 'bsl::allocator' (the default).
+
+    template <class INPUT_ITERATOR>
+    flat_multiset(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multiset(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const ALLOCATOR&  basicAllocator);
+        // Create a multiset holding the keys in the sequence starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element, in 'O[N]' time, where 'N' is the number of
+        // elements in the sequence.  Optionally specify a 'comparator' and a
+        // 'basicAllocator' as for the constructor above.  The behavior is
+        // undefined unless the sequence is ordered according to 'comparator'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multiset(std::initializer_list<KEY> values,
+                  const COMPARATOR&          comparator = COMPARATOR(),
+                  const ALLOCATOR&           basicAllocator = ALLOCATOR());
+    flat_multiset(std::initializer_list<KEY> values,
+                  const ALLOCATOR&           basicAllocator);
+        // Create a multiset and insert each 'value_type' object in the
+        // specified 'values' initializer list.  Optionally specify a
+        // 'comparator' and a 'basicAllocator' as for the range constructor
+        // above.
+#endif
+
+    ~flat_multiset();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_multiset& operator=(const flat_multiset& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // If an exception is thrown, '*this' is left in a valid but
+        // unspecified state.
+
+    flat_multiset& operator=(BloombergLP::bslmf::MovableRef<flat_multiset> rhs)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_move_assignment',
+        // and return a reference providing modifiable access to this object.
+        // The contents of 'rhs' are moved (in constant time) to this multiset
+        // if 'get_allocator() == rhs.get_allocator()' (after accounting for
+        // the aforementioned trait); otherwise, the keys of 'rhs' are
+        // move-inserted into this multiset.  'rhs' is left in a valid but
+        // unspecified state, and if an exception is thrown, '*this' is left
+        // in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_multiset& operator=(std::initializer_list<KEY> values);
+        // Assign to this object the value resulting from first clearing this
+        // multiset and then inserting each 'value_type' object in the
+        // specified 'values' initializer list; return a reference providing
+        // modifiable access to this object.
+#endif
+
+    iterator insert(const value_type& value);
+    iterator insert(BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multiset, after any keys
+        // already in this multiset that are equivalent to 'value', and return
+        // an iterator referring to the newly inserted 'value_type' object.
+        // This operation has 'O[N]' complexity, where 'N' is the size of this
+        // multiset, and invalidates all iterators to this multiset.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multiset (in constant time,
+        // plus the time to move the keys that follow it, if 'value' may be
+        // placed immediately before the specified 'hint' without breaking the
+        // ordering of the keys, and in logarithmic time plus that time
+        // otherwise), and return an iterator referring to the newly inserted
+        // 'value_type' object.  If 'value' is placed other than at 'hint', it
+        // is placed after any equivalent keys.  The behavior is undefined
+        // unless 'hint' is an iterator in the range '[begin() .. end()]' (both
+        // endpoints included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multiset the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator.  The keys are
+        // appended to the underlying sequence and then merged with it (see
+        // 'bslstl_flattreeutil'), so that this operation has
+        // 'O[N + M * log(M)]' complexity, where 'N' is the size of this
+        // multiset and 'M' is the length of the range.  Equivalent keys keep
+        // their relative order, with keys from the range following those
+        // already in this multiset.  If an exception is thrown while the range
+        // is being appended, this multiset is left unchanged; if one is thrown
+        // while the keys are being ordered, this multiset is left empty.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR first,
+                INPUT_ITERATOR last);
+        // Insert into this multiset the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator.  The behavior is
+        // undefined unless the range is ordered according to 'key_comp()'.
+        // Note that this operation has 'O[N + M]' complexity, where 'N' is the
+        // size of this multiset and 'M' is the length of the range.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<KEY> values);
+        // Insert into this multiset the value of each 'value_type' object in
+        // the specified 'values' initializer list.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... Args>
+    iterator emplace(Args&&... arguments);
+        // Insert into this multiset a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', after any equivalent keys, and return
+        // an iterator referring to the newly created and inserted object.  The
+        // new object is constructed at the end of the underlying sequence and
+        // then rotated into position.
+
+    template <class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... arguments);
+        // Insert into this multiset a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', and return an iterator referring to the
+        // newly created and inserted object.  The object is placed immediately
+        // before the specified 'hint' if that does not break the ordering of
+        // the keys, and after any equivalent keys otherwise.  The behavior is
+        // undefined unless 'hint' is an iterator in the range
+        // '[begin() .. end()]' (both endpoints included).
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this multiset the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this multiset.  This method
+        // invalidates all iterators at or after 'position'.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // multiset.
+
+    size_type erase(const key_type& key);
+        // Remove from this multiset all 'value_type' objects that are
+        // equivalent to the specified 'key', if they exist, and return the
+        // number of objects erased; otherwise, if there are no 'value_type'
+        // objects equivalent to 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multiset the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return 'last'.  The behavior is undefined
+        // unless 'first' and 'last' either refer to elements in this multiset
+        // or are the 'end' iterator, and the 'first' position is at or before
+        // the 'last' position in the ordered sequence provided by this
+        // container.
+
+    void swap(flat_multiset& other)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with the value and
+        // comparator of the specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees 'O[1]' complexity if either allocators are exchanged or
+        // this object was created with the same allocator as 'other' (unless
+        // swapping the (user-supplied) comparators throws); otherwise, it
+        // has 'O[n + m]' complexity, where 'n' and 'm' are the sizes of this
+        // object and 'other', respectively.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this multiset.  Note that the multiset is
+        // empty after this call, but allocated memory may be retained for
+        // future use.
+
+    void reserve(size_type numKeys);
+        // Change the capacity of this multiset to at least the specified
+        // 'numKeys'.  If an exception is thrown, this multiset is left
+        // unchanged.  Note that this method has no effect if the current
+        // capacity meets or exceeds the required capacity.
+
+    void shrink_to_fit();
+        // Minimize the memory used by this multiset to the extent possible
+        // without moving any keys.
+
+    // Turn off complaints about necessarily class-defined methods.
+    // BDE_VERIFY pragma: push
+    // BDE_VERIFY pragma: -CD01
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    erase(const LOOKUP_KEY& key)
+        // Remove from this multiset all 'value_type' objects that are
+        // equivalent to the specified 'key', and return the number of objects
+        // removed.
+    {
+        const pair<const_iterator, const_iterator> range = equal_range(key);
+        const size_type numErased = range.second - range.first;
+        d_data.erase(range.first, range.second);
+        return numErased;
+    }
+
+    // BDE_VERIFY pragma: pop
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // multiset.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multiset, or the 'end' iterator if this multiset
+        // is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this multiset.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multiset, or 'rend' if this multiset is
+        // empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multiset.
+
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multiset, or the 'cend' iterator if this multiset
+        // is empty.
+
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this multiset.
+
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multiset, or 'crend' if this multiset is
+        // empty.
+
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multiset.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this multiset contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this multiset.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this multiset could possibly hold.  Note that there is no
+        // guarantee that the multiset can successfully grow to the returned
+        // size, or even close to that size without running out of resources.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of keys this multiset can hold without allocating
+        // memory.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // multiset; if a comparator was supplied at construction, return its
+        // value, otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects using
+        // 'key_comp()'.  Note that since 'value_type' is an alias to 'KEY' for
+        // 'flat_multiset', this method returns the same functor as
+        // 'key_comp()'.
+
+    const container_type& sequence() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reference providing non-modifiable access to the vector
+        // holding the keys of this multiset, in order.
+
+    // Turn off complaints about necessarily class-defined methods.
+    // BDE_VERIFY pragma: push
+    // BDE_VERIFY pragma: -CD01
+
+    const_iterator find(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multiset that is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, *it) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multiset that is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, *it) ? it : end();
+    }
+
+    bool contains(const key_type& key) const
+        // Return 'true' if this multiset contains a 'value_type' object
+        // equivalent to the specified 'key', and 'false' otherwise.
+    {
+        return find(key) != end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this multiset contains a 'value_type' object
+        // equivalent to the specified 'key', and 'false' otherwise.
+    {
+        return find(key) != end();
+    }
+
+    size_type count(const key_type& key) const
+        // Return the number of 'value_type' objects within this multiset that
+        // are equivalent to the specified 'key'.
+    {
+        const pair<const_iterator, const_iterator> range = equal_range(key);
+        return range.second - range.first;
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this multiset that
+        // are equivalent to the specified 'key'.
+    {
+        const pair<const_iterator, const_iterator> range = equal_range(key);
+        return range.second - range.first;
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multiset
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multiset does not contain a 'value_type'
+        // greater-than or equal-to 'key'.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multiset
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multiset does not contain a 'value_type'
+        // greater-than or equal-to 'key'.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multiset greater
+        // than the specified 'key', and the past-the-end iterator if this
+        // multiset does not contain a 'value_type' object greater-than 'key'.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multiset greater
+        // than the specified 'key', and the past-the-end iterator if this
+        // multiset does not contain a 'value_type' object greater-than 'key'.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multiset that are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.
+    {
+        const_iterator startIt = lower_bound(key);
+        return pair<const_iterator, const_iterator>(
+                         startIt,
+                         TreeUtil::upperBound<KeyConfig>(startIt,
+                                                         d_data.end(),
+                                                         key,
+                                                         d_comparator));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multiset that are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.
+    {
+        const_iterator startIt = lower_bound(key);
+        return pair<const_iterator, const_iterator>(
+                         startIt,
+                         TreeUtil::upperBound<KeyConfig>(startIt,
+                                                         d_data.end(),
+                                                         key,
+                                                         d_comparator));
+    }
+
+    // BDE_VERIFY pragma: pop
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multiset' objects 'lhs' and
+    // 'rhs' have the same value if they have the same number of keys, and each
+    // element in the ordered sequence of keys of 'lhs' has the same value as
+    // the corresponding element in the ordered sequence of keys of 'rhs'.
+    // This method requires that the (template parameter) type 'KEY' be
+    // 'equality-comparable'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_multiset' objects 'lhs'
+    // and 'rhs' do not have the same value if they do not have the same
+    // number of keys, or some element in the ordered sequence of keys of 'lhs'
+    // does not have the same value as the corresponding element in the ordered
+    // sequence of keys of 'rhs'.  This method requires that the (template
+    // parameter) type 'KEY' be 'equality-comparable'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically less than that of the specified 'rhs' multiset, and
+    // 'false' otherwise (see 'bsl::multiset').  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically greater than that of the specified 'rhs' multiset, and
+    // 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // multiset, and 'false' otherwise.  Note that this operator returns
+    // '!(rhs < lhs)'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multiset is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // multiset, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multiset<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_multiset<KEY, COMPARATOR, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with the
+    // value and comparator of the specified 'b' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'a' with that of 'b'.  See the
+    // 'swap' method for complexity and exception-safety guarantees.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class flat_multiset
+                            // -------------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset()
+: d_comparator()
+, d_data()
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                               const ALLOCATOR& basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                                 const flat_multiset& original)
+: d_comparator(original.d_comparator)
+, d_data(original.d_data)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                        BloombergLP::bslmf::MovableRef<flat_multiset> original)
+: d_comparator(MoveUtil::access(original).d_comparator)
+, d_data(MoveUtil::move(MoveUtil::access(original).d_data))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                         const flat_multiset& original,
+                                         const ALLOCATOR&     basicAllocator)
+: d_comparator(original.d_comparator)
+, d_data(original.d_data, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                  BloombergLP::bslmf::MovableRef<flat_multiset> original,
+                  const ALLOCATOR&                              basicAllocator)
+: d_comparator(MoveUtil::access(original).d_comparator)
+, d_data(MoveUtil::move(MoveUtil::access(original).d_data), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                 BloombergLP::bslmf::MovableRef<container_type> container,
+                 const COMPARATOR&                              comparator)
+: d_comparator(comparator)
+, d_data(MoveUtil::move(container))
+{
+    TreeUtil::mergeTailMulti<KeyConfig>(&d_data, 0, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                 sorted_equivalent_t,
+                 BloombergLP::bslmf::MovableRef<container_type> container,
+                 const COMPARATOR&                              comparator)
+: d_comparator(comparator)
+, d_data(MoveUtil::move(container))
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSorted<KeyConfig>(d_data.begin(),
+                                                   d_data.end(),
+                                                   d_comparator));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const COMPARATOR& comparator,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator(comparator)
+, d_data(basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                       sorted_equivalent_t,
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const COMPARATOR& comparator,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator(comparator)
+, d_data(first, last, basicAllocator)
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSorted<KeyConfig>(d_data.begin(),
+                                                   d_data.end(),
+                                                   d_comparator));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                       sorted_equivalent_t,
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator()
+, d_data(first, last, basicAllocator)
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSorted<KeyConfig>(d_data.begin(),
+                                                   d_data.end(),
+                                                   d_comparator));
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                    std::initializer_list<KEY> values,
+                                    const COMPARATOR&          comparator,
+                                    const ALLOCATOR&           basicAllocator)
+: d_comparator(comparator)
+, d_data(basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::flat_multiset(
+                                    std::initializer_list<KEY> values,
+                                    const ALLOCATOR&           basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::~flat_multiset()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                                      const flat_multiset& rhs)
+{
+    if (this != &rhs) {
+        d_data       = rhs.d_data;
+        d_comparator = rhs.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                             BloombergLP::bslmf::MovableRef<flat_multiset> rhs)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    flat_multiset& lvalue = rhs;
+
+    if (this != &lvalue) {
+        d_data       = MoveUtil::move(lvalue.d_data);
+        d_comparator = lvalue.d_comparator;
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                             std::initializer_list<KEY> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    return d_data.insert(upper_bound(value), value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    return d_data.insert(upper_bound(lvalue), MoveUtil::move(lvalue));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                  const value_type& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= hint);
+    BSLS_ASSERT_SAFE(hint    <= end());
+
+    if ((hint == end()   || !d_comparator(*hint, value))
+     && (hint == begin() || !d_comparator(value, *(hint - 1)))) {
+        return d_data.insert(hint, value);                            // RETURN
+    }
+    return insert(value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    BSLS_ASSERT_SAFE(begin() <= hint);
+    BSLS_ASSERT_SAFE(hint    <= end());
+
+    value_type& lvalue = value;
+
+    if ((hint == end()   || !d_comparator(*hint, lvalue))
+     && (hint == begin() || !d_comparator(lvalue, *(hint - 1)))) {
+        return d_data.insert(hint, MoveUtil::move(lvalue));           // RETURN
+    }
+    return insert(MoveUtil::move(lvalue));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last)
+{
+    TreeUtil::insertRangeMulti<KeyConfig>(&d_data, first, last, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(sorted_equivalent_t,
+                                                       INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last)
+{
+    // The merge detects input that is entirely ordered after the current
+    // contents, so no special handling is needed here.
+
+    TreeUtil::insertRangeMulti<KeyConfig>(&d_data, first, last, d_comparator);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                             std::initializer_list<KEY> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::emplace(Args&&... arguments)
+{
+    d_data.emplace_back(BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+
+    typename container_type::iterator last = d_data.end() - 1;
+    typename container_type::iterator it   =
+                              TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                                              last,
+                                                              *last,
+                                                              d_comparator);
+    native_std::rotate(it, last, d_data.end());
+    return it;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(
+                                                   const_iterator hint,
+                                                   Args&&...      arguments)
+{
+    BSLS_ASSERT_SAFE(begin() <= hint);
+    BSLS_ASSERT_SAFE(hint    <= end());
+
+    const difference_type offset = hint - begin();
+
+    d_data.emplace_back(BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+
+    typename container_type::iterator last = d_data.end() - 1;
+    typename container_type::iterator it   = d_data.begin() + offset;
+
+    if ((it != last           && d_comparator(*it, *last))
+     || (it != d_data.begin() && d_comparator(*last, *(it - 1)))) {
+        // The hint is not a valid position for the new key, so place it after
+        // any equivalent keys, as 'emplace' would.
+
+        it = TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                             last,
+                                             *last,
+                                             d_comparator);
+    }
+    native_std::rotate(it, last, d_data.end());
+    return it;
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_data.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const pair<const_iterator, const_iterator> range = equal_range(key);
+    const size_type numErased = range.second - range.first;
+    d_data.erase(range.first, range.second);
+    return numErased;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                 const_iterator last)
+{
+    return d_data.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::swap(flat_multiset& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    bsl::swap(d_data, other.d_data);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    d_data.clear();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::reserve(size_type numKeys)
+{
+    d_data.reserve(numKeys);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multiset<KEY, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_data.shrink_to_fit();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.get_allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return rbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::crend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return rend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::empty() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.empty();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.max_size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::capacity() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.capacity();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_multiset<KEY, COMPARATOR, ALLOCATOR>::container_type&
+flat_multiset<KEY, COMPARATOR, ALLOCATOR>::sequence() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_multiset<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,972 @@
+// bslstl_flatmultiset.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultiset.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_set.h>
+#include <bslstl_multiset.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bsl::flat_multiset' is a thin adapter of 'bsl::vector' whose searching and
+// ordering are delegated to 'bslstl::FlatTreeUtil' (tested separately).  We
+// therefore concentrate on the forwarding of each method, on the allocator
+// used, and on agreement with 'bsl::multiset' for the same operations.  Since
+// 'bsl::multiset' keeps equivalent keys in insertion order, we compare the
+// two using keys whose salient value is not entirely visible to the
+// comparator, which verifies that 'flat_multiset' does the same.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multiset();
+// [ 2] explicit flat_multiset(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] explicit flat_multiset(const ALLOCATOR&);
+// [ 2] flat_multiset(const flat_multiset&);
+// [ 2] flat_multiset(MovableRef<flat_multiset>);
+// [ 2] flat_multiset(const flat_multiset&, const ALLOCATOR&);
+// [ 2] flat_multiset(MovableRef<flat_multiset>, const ALLOCATOR&);
+// [ 2] explicit flat_multiset(MovableRef<container_type>, const COMP&);
+// [ 2] flat_multiset(sorted_equivalent_t, MovableRef<container_type>, C);
+// [ 2] flat_multiset(INPUT_ITER, INPUT_ITER, const COMP&, const ALLOC&);
+// [ 2] flat_multiset(INPUT_ITER, INPUT_ITER, const ALLOCATOR&);
+// [ 2] flat_multiset(sorted_equivalent_t, INPUT_ITER, INPUT_ITER, ...);
+// [ 2] flat_multiset(initializer_list<KEY>, const COMP&, const ALLOC&);
+// [ 2] flat_multiset(initializer_list<KEY>, const ALLOCATOR&);
+// [ 2] ~flat_multiset();
+//
+// MANIPULATORS
+// [ 5] flat_multiset& operator=(const flat_multiset&);
+// [ 5] flat_multiset& operator=(MovableRef<flat_multiset>);
+// [ 5] flat_multiset& operator=(initializer_list<KEY>);
+// [ 3] iterator insert(const value_type&);
+// [ 3] iterator insert(MovableRef<value_type>);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] iterator insert(const_iterator, MovableRef<value_type>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list<KEY>);
+// [ 3] iterator emplace(Args&&...);
+// [ 3] iterator emplace_hint(const_iterator, Args&&...);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] size_type erase(const LOOKUP_KEY&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 5] void swap(flat_multiset&);
+// [ 3] void clear();
+// [ 2] void reserve(size_type);
+// [ 2] void shrink_to_fit();
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_reverse_iterator rbegin() const;
+// [ 4] const_reverse_iterator rend() const;
+// [ 4] const_iterator cbegin() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_reverse_iterator crbegin() const;
+// [ 4] const_reverse_iterator crend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type capacity() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 2] const container_type& sequence() const;
+// [ 4] bool contains(const key_type&) const;
+// [ 4] const_iterator find(const key_type&) const;
+// [ 4] size_type count(const key_type&) const;
+// [ 4] const_iterator lower_bound(const key_type&) const;
+// [ 4] const_iterator upper_bound(const key_type&) const;
+// [ 4] pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [ 4] bool contains(const LOOKUP_KEY&) const;
+// [ 4] const_iterator find(const LOOKUP_KEY&) const;
+// [ 4] size_type count(const LOOKUP_KEY&) const;
+// [ 4] const_iterator lower_bound(const LOOKUP_KEY&) const;
+// [ 4] const_iterator upper_bound(const LOOKUP_KEY&) const;
+// [ 4] pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const flat_multiset&, const flat_multiset&);
+// [ 5] bool operator!=(const flat_multiset&, const flat_multiset&);
+// [ 5] bool operator< (const flat_multiset&, const flat_multiset&);
+// [ 5] bool operator> (const flat_multiset&, const flat_multiset&);
+// [ 5] bool operator<=(const flat_multiset&, const flat_multiset&);
+// [ 5] bool operator>=(const flat_multiset&, const flat_multiset&);
+// [ 5] void swap(flat_multiset&, flat_multiset&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::pair<int, int>                         Element;
+
+struct LessByFirst {
+    // This 'struct' provides a comparator that orders 'Element' objects by
+    // their 'first' members only, so that elements having the same 'first'
+    // are equivalent but distinguishable.  The comparator is transparent,
+    // and compares 'Element' objects with 'int' lookup keys.
+
+    // PUBLIC TYPES
+    typedef void is_transparent;
+
+    // ACCESSORS
+    bool operator()(const Element& lhs, const Element& rhs) const
+        // Return 'lhs.first < rhs.first'.
+    {
+        return lhs.first < rhs.first;
+    }
+
+    bool operator()(int lhs, const Element& rhs) const
+        // Return 'lhs < rhs.first'.
+    {
+        return lhs < rhs.first;
+    }
+
+    bool operator()(const Element& lhs, int rhs) const
+        // Return 'lhs.first < rhs'.
+    {
+        return lhs.first < rhs;
+    }
+};
+
+typedef bsl::flat_multiset<Element, LessByFirst>    Obj;
+typedef bsl::multiset<Element, LessByFirst>         Reference;
+typedef bsl::flat_multiset<int>                     IntObj;
+typedef bsl::flat_multiset<bsl::string>             StringObj;
+typedef bslmf::MovableRefUtil                       MoveUtil;
+
+namespace {
+
+bool verifyEqual(const Obj& object, const Reference& reference)
+    // Return 'true' if the specified 'object' holds the same elements, in the
+    // same order, as the specified 'reference', and 'false' otherwise.
+{
+    return object.size() == reference.size()
+        && native_std::equal(object.begin(), object.end(), reference.begin());
+}
+
+Element makeElement(int key, int tag)
+    // Return an element having the specified 'key' and 'tag'.
+{
+    return Element(key, tag);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Computing Percentiles of a Sample
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we collect a sample of request latencies, in microseconds, and
+// want to report percentiles of the sample and the number of requests having
+// a particular latency.  Since the whole sample is available before any
+// question is asked, a 'flat_multiset' built in one step is a good fit.
+//
+// First, we build the multiset from the unordered sample:
+//..
+        const int LATENCIES[] = { 250, 120, 980, 120, 400, 130, 120, 2000,
+                                  310, 150 };
+        const int NUM_LATENCIES = sizeof LATENCIES / sizeof *LATENCIES;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::flat_multiset<int> sample(LATENCIES,
+                                       LATENCIES + NUM_LATENCIES,
+                                       &oa);
+        ASSERT(NUM_LATENCIES == sample.size());
+//..
+// Then, since the keys are contiguous, we can index the ordered sample
+// directly to find the median and the 90th percentile:
+//..
+        ASSERT( 200 == (sample.begin()[4] + sample.begin()[5]) / 2);
+        ASSERT( 980 == sample.begin()[NUM_LATENCIES * 9 / 10 - 1]);
+//..
+// Finally, we count the requests that took exactly 120 microseconds:
+//..
+        ASSERT(3 == sample.count(120));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Assignment copies (or moves) the keys and retains the allocator
+        //:   of the target.
+        //:
+        //: 2 'swap' exchanges the keys, including between multisets using
+        //:   different allocators.
+        //:
+        //: 3 The comparison operators compare the key sequences
+        //:   lexicographically, including repeated keys.
+        //
+        // Plan:
+        //: 1 Assign and swap between multisets with different allocators, and
+        //:   check the value and allocator of each.  (C-1..2)
+        //:
+        //: 2 Use the table-driven technique for the comparison operators.
+        //:   (C-3)
+        //
+        // Testing:
+        //   flat_multiset& operator=(const flat_multiset&);
+        //   flat_multiset& operator=(MovableRef<flat_multiset>);
+        //   flat_multiset& operator=(initializer_list<KEY>);
+        //   void swap(flat_multiset&);
+        //   bool operator==(const flat_multiset&, const flat_multiset&);
+        //   bool operator!=(const flat_multiset&, const flat_multiset&);
+        //   bool operator< (const flat_multiset&, const flat_multiset&);
+        //   bool operator> (const flat_multiset&, const flat_multiset&);
+        //   bool operator<=(const flat_multiset&, const flat_multiset&);
+        //   bool operator>=(const flat_multiset&, const flat_multiset&);
+        //   void swap(flat_multiset&, flat_multiset&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const int VALUES[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+
+        {
+            IntObj mY(VALUES, VALUES + 8, &za);  const IntObj& Y = mY;
+            IntObj mX(&oa);                      const IntObj& X = mX;
+
+            ASSERT(&mX == &(mX = Y));
+            ASSERT(Y == X);
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(2 == X.count(1));
+
+            IntObj mZ(&oa);  const IntObj& Z = mZ;
+            mZ = MoveUtil::move(mX);
+            ASSERT(Y == Z);
+
+            mZ = MoveUtil::move(mY);
+            ASSERT(&oa == Z.get_allocator());
+            ASSERT(8 == Z.size());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mZ = { 7, 8, 7 };
+            ASSERT(3 == Z.size());
+            ASSERT(2 == Z.count(7));
+#endif
+
+            IntObj mA(VALUES, VALUES + 4, &oa);  const IntObj& A = mA;
+            IntObj mB(&za);                      const IntObj& B = mB;
+            const IntObj AA(A, &oa);
+
+            swap(mA, mB);
+            ASSERT(AA == B);
+            ASSERT(A.empty());
+            ASSERT(&oa == A.get_allocator());
+            ASSERT(&za == B.get_allocator());
+
+            mA.swap(mZ);
+            ASSERT(A.size() == 3 && Z.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        {
+            static const struct {
+                int         d_line;
+                const char *d_spec;
+            } DATA[] = {
+                // Listed in increasing lexicographical order.
+
+                { L_, ""     },
+                { L_, "1"    },
+                { L_, "11"   },
+                { L_, "112"  },
+                { L_, "12"   },
+                { L_, "122"  },
+                { L_, "2"    },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                IntObj mX(&oa);  const IntObj& X = mX;
+                for (const char *p = DATA[ti].d_spec; *p; ++p) {
+                    mX.insert(*p - '0');
+                }
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    IntObj mY(&za);  const IntObj& Y = mY;
+                    for (const char *p = DATA[tj].d_spec; *p; ++p) {
+                        mY.insert(*p - '0');
+                    }
+
+                    ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                    ASSERTV(ti, tj, (ti != tj) == (X != Y));
+                    ASSERTV(ti, tj, (ti <  tj) == (X <  Y));
+                    ASSERTV(ti, tj, (ti >  tj) == (X >  Y));
+                    ASSERTV(ti, tj, (ti <= tj) == (X <= Y));
+                    ASSERTV(ti, tj, (ti >= tj) == (X >= Y));
+                }
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP AND ITERATION
+        //
+        // Concerns:
+        //: 1 Each lookup method returns the same position as the
+        //:   corresponding method of 'bsl::multiset' having the same keys,
+        //:   for keys that are absent, present once, and repeated.
+        //:
+        //: 2 The transparent overloads are usable with a lookup key of a
+        //:   different type.
+        //:
+        //: 3 Forward and reverse iteration visit the keys in order.
+        //
+        // Plan:
+        //: 1 For multisets of every size in '[0 .. 30]' holding keys
+        //:   'i / 3' for even 'i', search for every key in '[-1 .. size]' and
+        //:   compare (by distance from 'begin') with a 'bsl::multiset'.
+        //:   Search using both 'Element' and 'int' keys.  (C-1..3)
+        //
+        // Testing:
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   bool contains(const key_type&) const;
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iter, const_iter> equal_range(const key_type&) const;
+        //   bool contains(const LOOKUP_KEY&) const;
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   size_type count(const LOOKUP_KEY&) const;
+        //   const_iterator lower_bound(const LOOKUP_KEY&) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY&) const;
+        //   pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP AND ITERATION"
+                            "\n====================\n");
+
+        for (int size = 0; size <= 30; ++size) {
+            Obj       mX;  const Obj&       X = mX;
+            Reference mR;  const Reference& R = mR;
+
+            for (int i = 0; i < 2 * size; i += 2) {
+                mX.insert(makeElement(i / 3, i));
+                mR.insert(makeElement(i / 3, i));
+            }
+
+            ASSERTV(size, verifyEqual(X, R));
+            ASSERTV(size, native_std::equal(X.cbegin(), X.cend(), R.begin()));
+            ASSERTV(size, native_std::equal(X.rbegin(), X.rend(), R.rbegin()));
+            ASSERTV(size, native_std::equal(X.crbegin(),
+                                            X.crend(),
+                                            R.rbegin()));
+
+            for (int key = -1; key <= size; ++key) {
+                const Element K = makeElement(key, -1);
+
+#define DIST(CONTAINER, ITERATOR)                                             \
+    native_std::distance(CONTAINER.begin(), ITERATOR)
+
+                ASSERTV(size, key, DIST(R, R.find(K)) == DIST(X, X.find(K)));
+                ASSERTV(size, key, R.count(K) == X.count(K));
+                ASSERTV(size, key, (0 < R.count(K)) == X.contains(K));
+                ASSERTV(size, key, DIST(R, R.lower_bound(K)) ==
+                                                    DIST(X, X.lower_bound(K)));
+                ASSERTV(size, key, DIST(R, R.upper_bound(K)) ==
+                                                    DIST(X, X.upper_bound(K)));
+                ASSERTV(size, key, DIST(R, R.equal_range(K).first) ==
+                                            DIST(X, X.equal_range(K).first));
+                ASSERTV(size, key, DIST(R, R.equal_range(K).second) ==
+                                            DIST(X, X.equal_range(K).second));
+
+                ASSERTV(size, key, DIST(R, R.find(K)) == DIST(X, X.find(key)));
+                ASSERTV(size, key, R.count(K) == X.count(key));
+                ASSERTV(size, key, (0 < R.count(K)) == X.contains(key));
+                ASSERTV(size, key, DIST(R, R.lower_bound(K)) ==
+                                                  DIST(X, X.lower_bound(key)));
+                ASSERTV(size, key, DIST(R, R.upper_bound(K)) ==
+                                                  DIST(X, X.upper_bound(key)));
+                ASSERTV(size, key, DIST(R, R.equal_range(K).first) ==
+                                          DIST(X, X.equal_range(key).first));
+                ASSERTV(size, key, DIST(R, R.equal_range(K).second) ==
+                                          DIST(X, X.equal_range(key).second));
+#undef DIST
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, EMPLACE, AND ERASE
+        //
+        // Concerns:
+        //: 1 Each single-key insertion inserts the key after any equivalent
+        //:   keys, and returns an iterator to it.
+        //:
+        //: 2 Hinted insertion inserts at the hint if that keeps the keys in
+        //:   order, and after any equivalent keys otherwise.
+        //:
+        //: 3 Range insertion merges the range, placing the new keys after
+        //:   equivalent existing keys and keeping their relative order.
+        //:
+        //: 4 Each 'erase' removes the specified keys and returns the correct
+        //:   value.
+        //:
+        //: 5 Range insertion is exception neutral.
+        //
+        // Plan:
+        //: 1 Perform a sequence of operations on a 'flat_multiset' and a
+        //:   'bsl::multiset', comparing the results and the contents
+        //:   (including the tags that the comparator ignores) after each.
+        //:   (C-1..4)
+        //:
+        //: 2 Insert a range in an exception test loop.  (C-5)
+        //
+        // Testing:
+        //   iterator insert(const value_type&);
+        //   iterator insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   iterator insert(const_iterator, MovableRef<value_type>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<KEY>);
+        //   iterator emplace(Args&&...);
+        //   iterator emplace_hint(const_iterator, Args&&...);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   size_type erase(const LOOKUP_KEY&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERT, EMPLACE, AND ERASE"
+                            "\n==========================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting single-key insertion.\n");
+        {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference mR;       const Reference& R = mR;
+
+            const int KEYS[] = { 5, 1, 9, 5, 3, 7, 1, 0, 10, 9, 5, 4 };
+            const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const Element E = makeElement(KEYS[i], i);
+
+                Obj::iterator it;
+                if (i % 2) {
+                    it = mX.insert(E);
+                }
+                else {
+                    Element e(E);
+                    it = mX.insert(MoveUtil::move(e));
+                }
+                mR.insert(E);
+
+                ASSERTV(i, E == *it);
+                ASSERTV(i, verifyEqual(X, R));
+            }
+
+            // Hints: correct and incorrect, against the reference's handling
+            // of the same hints.
+
+            for (int key = -1; key <= 11; ++key) {
+                for (int h = 0; h <= static_cast<int>(X.size()); ++h) {
+                    Obj       mY(X, &oa);  const Obj& Y = mY;
+                    Reference mS(R);
+
+                    const Element E = makeElement(key, 100);
+
+                    Obj::iterator       iy = mY.insert(Y.begin() + h, E);
+                    Reference::iterator is = mS.begin();
+                    native_std::advance(is, h);
+                    is = mS.insert(is, E);
+
+                    ASSERTV(key, h, E == *iy);
+                    ASSERTV(key, h, native_std::distance(Y.begin(), iy) ==
+                                     native_std::distance(mS.begin(), is));
+                    ASSERTV(key, h, verifyEqual(Y, mS));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+                    Obj mZ(X, &oa);  const Obj& Z = mZ;
+                    Obj::iterator iz = mZ.emplace_hint(Z.begin() + h,
+                                                       key,
+                                                       100);
+                    ASSERTV(key, h, E == *iz);
+                    ASSERTV(key, h, Y == Z);
+#endif
+                }
+            }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            Obj::iterator ie = mX.emplace(5, 200);
+            ASSERT(makeElement(5, 200) == *ie);
+            mR.insert(makeElement(5, 200));
+            ASSERT(verifyEqual(X, R));
+#endif
+
+            ASSERT(R.count(makeElement(5, 0)) == mX.erase(makeElement(5, 0)));
+            ASSERT(0 == mX.erase(makeElement(5, 0)));
+            mR.erase(makeElement(5, 0));
+            ASSERT(verifyEqual(X, R));
+
+            ASSERT(2 == mX.erase(9));  // transparent
+            mR.erase(makeElement(9, 0));
+            ASSERT(verifyEqual(X, R));
+
+            Obj::iterator it = mX.erase(X.find(3));
+            ASSERT(4 == it->first);
+            mR.erase(mR.find(makeElement(3, 0)));
+            ASSERT(verifyEqual(X, R));
+
+            it = mX.erase(X.lower_bound(1), X.upper_bound(4));
+            ASSERT(7 == it->first);
+            mR.erase(mR.lower_bound(makeElement(1, 0)),
+                     mR.upper_bound(makeElement(4, 0)));
+            ASSERT(verifyEqual(X, R));
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range insertion.\n");
+        {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference mR;       const Reference& R = mR;
+
+            const int HEAD[] = { 2, 4, 4, 6, 8 };
+            const int TAIL[] = { 9, 4, 1, 8, 8, 0, 4 };
+
+            bsl::vector<Element> head, tail, sorted;
+            for (int i = 0; i < 5; ++i) {
+                head.push_back(makeElement(HEAD[i], i));
+            }
+            for (int i = 0; i < 7; ++i) {
+                tail.push_back(makeElement(TAIL[i], 10 + i));
+            }
+            for (int i = 0; i < 6; ++i) {
+                sorted.push_back(makeElement(i * 2, 20 + i));
+            }
+
+            mX.insert(head.begin(), head.end());
+            mR.insert(head.begin(), head.end());
+            ASSERT(verifyEqual(X, R));
+
+            mX.insert(tail.begin(), tail.end());
+            mR.insert(tail.begin(), tail.end());
+            ASSERT(verifyEqual(X, R));
+
+            mX.insert(bsl::sorted_equivalent, sorted.begin(), sorted.end());
+            mR.insert(sorted.begin(), sorted.end());
+            ASSERT(verifyEqual(X, R));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            IntObj mY;  const IntObj& Y = mY;
+            mY.insert({ 3, 1, 3 });
+            mY.insert({ 3, 0 });
+            ASSERT(3 == Y.count(3));
+            ASSERT(0 == *Y.begin());
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting exception neutrality.\n");
+        {
+            const char *const WORDS[] = {
+                "delta-delta-delta-delta-delta-delta-delta",
+                "alpha-alpha-alpha-alpha-alpha-alpha-alpha",
+                "echo-echo-echo-echo-echo-echo-echo-echo",
+                "alpha-alpha-alpha-alpha-alpha-alpha-alpha",
+            };
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StringObj mX(&oa);  const StringObj& X = mX;
+
+                const bsls::Types::Int64 AL = oa.allocationLimit();
+                oa.setAllocationLimit(-1);
+                mX.insert(bsl::string("charlie-charlie-charlie-charlie-char",
+                                      &oa));
+                oa.setAllocationLimit(AL);
+
+                try {
+                    mX.insert(WORDS, WORDS + 4);
+                }
+                catch (...) {
+                    ASSERT(X.empty() || 1 == X.size());
+                    throw;
+                }
+                ASSERTV(X.size(), 5 == X.size());
+                ASSERT(2 == X.count(bsl::string(WORDS[1])));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a multiset having the expected value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 Constructors taking unsorted input sort it stably, keeping
+        //:   duplicates; constructors taking sorted input use it unchanged.
+        //:
+        //: 3 Adopting a sorted container allocates no memory.
+        //:
+        //: 4 'reserve' and 'shrink_to_fit' change the capacity.
+        //
+        // Plan:
+        //: 1 Construct multisets by each constructor and check their state,
+        //:   and the order of equivalent elements, against 'bsl::multiset'.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   flat_multiset();
+        //   explicit flat_multiset(const COMPARATOR&, const ALLOCATOR&);
+        //   explicit flat_multiset(const ALLOCATOR&);
+        //   flat_multiset(const flat_multiset&);
+        //   flat_multiset(MovableRef<flat_multiset>);
+        //   flat_multiset(const flat_multiset&, const ALLOCATOR&);
+        //   flat_multiset(MovableRef<flat_multiset>, const ALLOCATOR&);
+        //   explicit flat_multiset(MovableRef<container_type>, const COMP&);
+        //   flat_multiset(sorted_equivalent_t, MovableRef<container_type>, C);
+        //   flat_multiset(INPUT_ITER, INPUT_ITER, const COMP&, const ALLOC&);
+        //   flat_multiset(INPUT_ITER, INPUT_ITER, const ALLOCATOR&);
+        //   flat_multiset(sorted_equivalent_t, INPUT_ITER, INPUT_ITER, ...);
+        //   flat_multiset(initializer_list<KEY>, const COMP&, const ALLOC&);
+        //   flat_multiset(initializer_list<KEY>, const ALLOCATOR&);
+        //   ~flat_multiset();
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   allocator_type get_allocator() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   size_type capacity() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const container_type& sequence() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const int KEYS[]   = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+        const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        bsl::vector<Element> input(&za);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            input.push_back(makeElement(KEYS[i], i));
+        }
+        const Reference R(input.begin(), input.end());
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 < X.max_size());
+            ASSERT(&defaultAllocator == X.get_allocator());
+        }
+        {
+            Obj mX(LessByFirst(), &oa);  const Obj& X = mX;
+            ASSERT(&oa == X.get_allocator());
+            (void) X.key_comp();
+            (void) X.value_comp();
+
+            mX.reserve(50);
+            ASSERT(50 <= X.capacity());
+            mX.insert(makeElement(1, 1));
+            mX.shrink_to_fit();
+            ASSERT(1 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        {
+            Obj mX(input.begin(), input.end(), &oa);  const Obj& X = mX;
+            ASSERT(verifyEqual(X, R));
+            ASSERT(&oa == X.get_allocator());
+
+            Obj mY(input.begin(), input.end(), LessByFirst(), &oa);
+            const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            bsl::vector<Element> v(input, &za);
+            Obj mZ(MoveUtil::move(v));  const Obj& Z = mZ;
+            ASSERT(verifyEqual(Z, R));
+            ASSERT(&za == Z.get_allocator());
+
+            bsl::vector<Element> w(X.sequence(), &za);
+            const bsls::Types::Int64 NUM_BLOCKS = za.numBlocksTotal();
+            Obj mW(bsl::sorted_equivalent, MoveUtil::move(w));
+            const Obj& W = mW;
+            ASSERT(X == W);
+            ASSERT(NUM_BLOCKS == za.numBlocksTotal());
+
+            Obj mV(bsl::sorted_equivalent, X.begin(), X.end(), &oa);
+            const Obj& V = mV;
+            ASSERT(X == V);
+
+            Obj mU(bsl::sorted_equivalent,
+                   X.begin(),
+                   X.end(),
+                   LessByFirst(),
+                   &oa);
+            const Obj& U = mU;
+            ASSERT(X == U);
+
+            Obj mA(X);  const Obj& A = mA;
+            ASSERT(X == A);
+            ASSERT(&defaultAllocator == A.get_allocator());
+
+            Obj mB(X, &oa);  const Obj& B = mB;
+            ASSERT(X == B);
+            ASSERT(&oa == B.get_allocator());
+
+            const bsls::Types::Int64 NUM_OA = oa.numBlocksTotal();
+            Obj mC(MoveUtil::move(mB));  const Obj& C = mC;
+            ASSERT(X == C);
+            Obj mD(MoveUtil::move(mC), &oa);  const Obj& D = mD;
+            ASSERT(X == D);
+            ASSERT(NUM_OA == oa.numBlocksTotal());
+
+            Obj mE(MoveUtil::move(mD), &za);  const Obj& E = mE;
+            ASSERT(X == E);
+            ASSERT(&za == E.get_allocator());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            IntObj mX({ 3, 1, 3, 2 }, &oa);  const IntObj& X = mX;
+            ASSERT(4 == X.size());
+            ASSERT(2 == X.count(3));
+
+            IntObj mY({ 3, 1, 3, 2 }, std::less<int>(), &oa);
+            const IntObj& Y = mY;
+            ASSERT(X == Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform some ad-hoc tests.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj mX(&oa);  const IntObj& X = mX;
+        ASSERT(X.empty());
+
+        mX.insert(5);
+        mX.insert(1);
+        mX.insert(5);
+        mX.insert(3);
+        ASSERT(4 == X.size());
+        ASSERT(1 == *X.begin());
+        ASSERT(5 == *X.rbegin());
+        ASSERT(2 == X.count(5));
+
+        ASSERT(X.contains(3));
+        ASSERT(!X.contains(4));
+        ASSERT(X.find(4) == X.end());
+        ASSERT(2 == X.end() - X.lower_bound(4));
+        ASSERT(X.upper_bound(5) == X.end());
+
+        IntObj mY(X, &oa);  const IntObj& Y = mY;
+        ASSERT(X == Y);
+        ASSERT(2 == mY.erase(5));
+        ASSERT(X != Y);
+        ASSERT(Y < X);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
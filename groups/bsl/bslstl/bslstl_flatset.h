@@ -0,0 +1,1646 @@
+// bslstl_flatset.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATSET
+#define INCLUDED_BSLSTL_FLATSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set of unique keys held in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_set: ordered set container with contiguous storage
+//
+//@SEE_ALSO: bslstl_flatmultiset, bslstl_flatmap, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_set', implementing an ordered associative container holding
+// unique keys, in the manner of 'bsl::set', but storing its keys contiguously,
+// in key order, in a 'bsl::vector' rather than in the nodes of a balanced
+// binary tree.  The interface follows that of 'std::flat_set' (C++23) where
+// that is practical for C++03.
+//
+// An instantiation of 'flat_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'flat_set' contains.  If 'flat_set' is instantiated
+// with a key type that is not itself value-semantic, then it will not retain
+// all of its value-semantic qualities.
+//
+///Choosing Between 'flat_set' and 'set'
+///-------------------------------------
+// Compared to a 'bsl::set', a 'flat_set':
+//: o allocates a single block of memory instead of one node per key, and has
+//:   no per-key overhead beyond any unused capacity,
+//:
+//: o iterates over its keys in contiguous memory, which is many times faster
+//:   than following tree links for all but the smallest sets,
+//:
+//: o looks up keys with a binary search over contiguous memory that is free of
+//:   data-dependent branches (see 'bslstl_flattreeutil'), which is typically
+//:   faster than a tree search for all sizes,
+//:
+//: o can be built from an unordered range in a single 'O[N * log(N)]' sort
+//:   and a single allocation, and from an ordered range in 'O[N]',
+//:
+//: o but inserts or erases single keys in 'O[N]' time (moving every key
+//:   after the insertion point), rather than 'O[log(N)]' time, and
+//:
+//: o invalidates iterators and references to its keys whenever a key is
+//:   inserted or erased.
+// 'flat_set' is therefore a good choice for ordered data that is built once
+// (or in bulk) and read many times, and a poor choice for data that is
+// modified one key at a time after it has grown large.
+//
+///Requirements on 'KEY'
+///---------------------
+// The requirements on 'KEY' are those of 'bsl::set' (see {'bslstl_set'}), with
+// the addition that, since keys are moved within the underlying vector when
+// other keys are inserted or erased, 'KEY' must be 'move-insertable' and
+// 'move-assignable' for any method that modifies the set.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_set''s 'ALLOCATOR' template parameter
+// determines how that 'flat_set' will allocate memory, exactly as for
+// 'bsl::set': if 'ALLOCATOR' is 'bsl::allocator' (the default), then objects
+// of type 'flat_set' conform to the standard BDE allocator model, and the
+// allocator is also passed to the keys (if they use 'bslma' allocators).
+// Building a 'flat_set' from an unordered range additionally allocates, from
+// the same allocator, a temporary vector holding one address per key.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_set':
+//..
+//  Legend
+//  ------
+//  'K'             - template parameter 'KEY' of 'flat_set'
+//  'a', 'b'        - two distinct objects of type 'flat_set<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b', respectively
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'K' objects
+//  'k'             - an object of type 'K'
+//  'p1', 'p2'      - two 'const_iterator's belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_set<K> a;    (default construction)           | O[1]               |
+//  | flat_set<K> a(al);                                 |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(b); (copy construction)              | O[n]               |
+//  | flat_set<K> a(b, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(rv); (move construction)             | O[1] if 'a' and    |
+//  | flat_set<K> a(rv, al);                             | 'rv' use the same  |
+//  |                                                    | allocator; O[n]    |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(i1, i2);                             | O[N] if [i1, i2)   |
+//  | flat_set<K> a(i1, i2, al);                         | is sorted;         |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(sorted_unique, i1, i2);              | O[distance(i1,i2)] |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_set<K>(); (destruction)                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;            (assignment)                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a, b)                              | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator; O[n + m]|
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.empty(), a.capacity()                  | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.get_allocator(), a.key_comp(), a.value_comp()    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k), a.emplace(args)                       | O[n]               |
+//  | a.insert(p1, k), a.emplace_hint(p1, args)          |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N * log(N)], |
+//  |                                                    | where N is         |
+//  |                                                    | distance(i1,i2)    |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(k), a.erase(p1, p2)           | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(N), a.shrink_to_fit()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.contains(k), a.find(k), a.count(k),              | O[log(n)]          |
+//  | a.lower_bound(k), a.upper_bound(k),                |                    |
+//  | a.equal_range(k)                                   |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Read-Mostly Set of Identifiers
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service must reject requests naming instruments that are not
+// on an approved list.  The list is loaded, in no particular order, when the
+// service starts and is consulted for every request thereafter; it is an
+// ideal candidate for a 'flat_set'.
+//
+// First, we define a class that holds the approved identifiers:
+//..
+//  class ApprovedList {
+//      // This class holds a set of approved instrument identifiers.
+//
+//      // DATA
+//      bsl::flat_set<int> d_ids;  // approved identifiers
+//
+//    public:
+//      // CREATORS
+//      template <class INPUT_ITERATOR>
+//      ApprovedList(INPUT_ITERATOR    first,
+//                   INPUT_ITERATOR    last,
+//                   bslma::Allocator *basicAllocator = 0)
+//          // Create a list approving the identifiers in the specified range
+//          // '[first .. last)'.  Optionally specify a 'basicAllocator' used
+//          // to supply memory.  If 'basicAllocator' is 0, the currently
+//          // installed default allocator is used.
+//      : d_ids(first, last, basicAllocator)
+//      {
+//      }
+//
+//      // ACCESSORS
+//      bool isApproved(int id) const
+//          // Return 'true' if the specified 'id' is approved, and 'false'
+//          // otherwise.
+//      {
+//          return d_ids.contains(id);
+//      }
+//
+//      native_std::size_t numApproved() const
+//          // Return the number of approved identifiers.
+//      {
+//          return d_ids.size();
+//      }
+//  };
+//..
+// Then, we load a list, which happens to contain a duplicate:
+//..
+//  const int IDS[] = { 4417, 12, 987, 5, 12, 3001 };
+//
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  ApprovedList list(IDS, IDS + sizeof IDS / sizeof *IDS, &oa);
+//  assert(5 == list.numApproved());
+//..
+// Now, we observe that the whole set occupies a single block of memory (the
+// temporary used to sort the input having been released):
+//..
+//  assert(1 == oa.numBlocksInUse());
+//..
+// Finally, we check some identifiers:
+//..
+//  assert( list.isApproved(987));
+//  assert( list.isApproved(5));
+//  assert(!list.isApproved(6));
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_flattreeutil.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_swaputil.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_istransparentpredicate.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_nativestd.h>
+
+#include <algorithm>
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                              // ==============
+                              // class flat_set
+                              // ==============
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<KEY> >
+class flat_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of the template parameter type,
+    // 'KEY') in contiguous storage.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   except for 'BDEX' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY> KeyConfig;
+        // This typedef is an alias for the policy used to extract the key from
+        // an element of this set.
+
+    typedef BloombergLP::bslstl::FlatTreeUtil                      TreeUtil;
+        // This typedef is an alias for the utility implementing the searching
+        // and ordering of the elements of this set.
+
+    typedef BloombergLP::bslmf::MovableRefUtil                     MoveUtil;
+        // This typedef is a convenient alias for the utility associated with
+        // movable references.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                       key_type;
+    typedef KEY                                       value_type;
+    typedef COMPARATOR                                key_compare;
+    typedef COMPARATOR                                value_compare;
+    typedef ALLOCATOR                                 allocator_type;
+    typedef bsl::vector<KEY, ALLOCATOR>               container_type;
+    typedef value_type&                               reference;
+    typedef const value_type&                         const_reference;
+
+    typedef typename container_type::size_type        size_type;
+    typedef typename container_type::difference_type  difference_type;
+    typedef typename container_type::pointer          pointer;
+    typedef typename container_type::const_pointer    const_pointer;
+
+    typedef typename container_type::const_iterator   iterator;
+    typedef typename container_type::const_iterator   const_iterator;
+    typedef bsl::reverse_iterator<iterator>           reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+  private:
+    // DATA
+    COMPARATOR     d_comparator;  // orders the keys
+    container_type d_data;        // keys, in order
+
+  public:
+    // CREATORS
+    flat_set();
+    explicit flat_set(const COMPARATOR& comparator,
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Create an empty set.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.  Note that a 'bslma::Allocator *' can be
+        // supplied for 'basicAllocator' if the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+    : d_comparator(comparator)
+    , d_data(basicAllocator)
+    {
+        // The implementation is placed here in the class definition to work
+        // around an AIX compiler bug (see 'bslstl_set').
+    }
+
+    explicit flat_set(const ALLOCATOR& basicAllocator);
+        // Create an empty set that uses the specified 'basicAllocator' to
+        // supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // set.  Note that a 'bslma::Allocator *' can be supplied for
+        // 'basicAllocator' if the (template parameter) type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    flat_set(const flat_set& original);
+        // Create a set having the same value as the specified 'original'
+        // object.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this set.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.
+
+    flat_set(BloombergLP::bslmf::MovableRef<flat_set> original);    // IMPLICIT
+        // Create a set having the same value as the specified 'original'
+        // object by moving (in constant time) the contents of 'original' to
+        // the new set.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this set.  The allocator associated with 'original' is
+        // propagated for use in the newly-created set.  'original' is left in
+        // a valid but unspecified state.
+
+    flat_set(const flat_set& original, const ALLOCATOR& basicAllocator);
+        // Create a set having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this set.  Note that a 'bslma::Allocator *' can be supplied for
+        // 'basicAllocator' if the (template parameter) type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    flat_set(BloombergLP::bslmf::MovableRef<flat_set> original,
+             const ALLOCATOR&                         basicAllocator);
+        // Create a set having the same value as the specified 'original'
+        // object that uses the specified 'basicAllocator' to supply memory.
+        // The contents of 'original' are moved (in constant time) to the new
+        // set if 'basicAllocator == original.get_allocator()', and are
+        // move-inserted (in linear time) using 'basicAllocator' otherwise.
+        // 'original' is left in a valid but unspecified state.  Use a copy of
+        // 'original.key_comp()' to order the keys contained in this set.
+
+    explicit flat_set(
+           BloombergLP::bslmf::MovableRef<container_type> container,
+           const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+        // Create a set holding the keys in the specified 'container', which
+        // is adopted (in constant time) as the underlying sequence of this
+        // set and then sorted, keeping only the first of any keys that are
+        // equivalent.  Optionally specify a 'comparator' used to order keys
+        // contained in this object.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  This set uses the allocator of 'container'.
+        // 'container' is left in a valid but unspecified state.
+
+    flat_set(sorted_unique_t,
+             BloombergLP::bslmf::MovableRef<container_type> container,
+             const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+        // Create a set holding the keys in the specified 'container', which
+        // is adopted (in constant time) as the underlying sequence of this
+        // set.  Optionally specify a 'comparator' used to order keys
+        // contained in this object.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  This set uses the allocator of 'container'.
+        // 'container' is left in a valid but unspecified state.  The behavior
+        // is undefined unless the keys in 'container' are strictly ordered
+        // according to 'comparator'.
+
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const ALLOCATOR&  basicAllocator);
+        // Create a set, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those keys having a
+        // value equivalent to that which appears earlier in the sequence.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.  If the type
+        // 'ALLOCATOR' is 'bsl::allocator' and 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.  The
+        // keys are appended to the underlying sequence and then sorted as a
+        // whole, so that this operation has 'O[N]' complexity if the sequence
+        // is ordered according to 'comparator', and 'O[N * log(N)]'
+        // complexity otherwise, where 'N' is the number of elements between
+        // 'first' and 'last'.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  Note that a 'bslma::Allocator *' can
+        // be supplied for 'basicAllocator' if the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).
+
+    template <class INPUT_ITERATOR>
+    flat_set(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_set(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const ALLOCATOR&  basicAllocator);
+        // Create a set holding the keys in the sequence starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element, in 'O[N]' time, where 'N' is the number
+        // of elements in the sequence.  Optionally specify a 'comparator' and
+        // a 'basicAllocator' as for the constructor above.  The behavior is
+        // undefined unless the sequence is strictly ordered according to
+        // 'comparator'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_set(std::initializer_list<KEY> values,
+             const COMPARATOR&          comparator = COMPARATOR(),
+             const ALLOCATOR&           basicAllocator = ALLOCATOR());
+    flat_set(std::initializer_list<KEY> values,
+             const ALLOCATOR&           basicAllocator);
+        // Create a set and insert each 'value_type' object in the specified
+        // 'values' initializer list, ignoring those keys having a value
+        // equivalent to that which appears earlier in the list.  Optionally
+        // specify a 'comparator' and a 'basicAllocator' as for the range
+        // constructor above.
+#endif
+
+    ~flat_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_set& operator=(const flat_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // If an exception is thrown, '*this' is left in a valid but
+        // unspecified state.
+
+    flat_set& operator=(BloombergLP::bslmf::MovableRef<flat_set> rhs)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_move_assignment',
+        // and return a reference providing modifiable access to this object.
+        // The contents of 'rhs' are moved (in constant time) to this set if
+        // 'get_allocator() == rhs.get_allocator()' (after accounting for the
+        // aforementioned trait); otherwise, the keys of 'rhs' are
+        // move-inserted into this set.  'rhs' is left in a valid but
+        // unspecified state, and if an exception is thrown, '*this' is left
+        // in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    flat_set& operator=(std::initializer_list<KEY> values);
+        // Assign to this object the value resulting from first clearing this
+        // set and then inserting each 'value_type' object in the specified
+        // 'values' initializer list, ignoring those keys having a value
+        // equivalent to that which appears earlier in the list; return a
+        // reference providing modifiable access to this object.
+#endif
+
+    pair<iterator, bool> insert(const value_type& value);
+    pair<iterator, bool> insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, if a key
+        // equivalent to 'value' already exists in this set, this method has
+        // no effect.  Return a pair whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) 'value_type' object in
+        // this set that is equivalent to 'value', and whose 'second' member
+        // is 'true' if a new value was inserted, and 'false' if the value was
+        // already present.  This operation has 'O[N]' complexity, where 'N'
+        // is the size of this set, and invalidates all iterators to this set
+        // if a value is inserted.
+
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this set (in constant time, plus
+        // the time to move the keys that follow it, if the specified 'hint' is
+        // the position immediately following the position of 'value' in the
+        // ordered sequence of keys, and in logarithmic time plus that time
+        // otherwise) if a key equivalent to 'value' does not already exist in
+        // this set; otherwise, this method has no effect.  Return an iterator
+        // referring to the (possibly newly inserted) 'value_type' object that
+        // is equivalent to 'value'.  The behavior is undefined unless 'hint'
+        // is an iterator in the range '[begin() .. end()]' (both endpoints
+        // included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to the object is neither already contained in this set
+        // nor earlier in the range.  The keys are appended to the underlying
+        // sequence and then merged with it (see 'bslstl_flattreeutil'), so
+        // that this operation has 'O[N + M * log(M)]' complexity, where 'N'
+        // is the size of this set and 'M' is the length of the range.  If an
+        // exception is thrown while the range is being appended, this set is
+        // left unchanged; if one is thrown while the keys are being ordered,
+        // this set is left empty.  The behavior is undefined unless 'first'
+        // and 'last' refer to a sequence of valid values where 'first' is at
+        // a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to the object is not already contained in this set.  The
+        // behavior is undefined unless the range is strictly ordered according
+        // to 'key_comp()'.  Note that this operation has 'O[N + M]'
+        // complexity, where 'N' is the size of this set and 'M' is the length
+        // of the range.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(std::initializer_list<KEY> values);
+        // Insert into this set the value of each 'value_type' object in the
+        // specified 'values' initializer list if a key equivalent to the
+        // object is neither already contained in this set nor earlier in the
+        // list.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... Args>
+    pair<iterator, bool> emplace(Args&&... arguments);
+        // Insert into this set a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', if a key equivalent to such a value
+        // does not already exist in this set; otherwise, this method has no
+        // effect (other than possibly creating a temporary 'value_type'
+        // object).  Return a pair whose 'first' member is an iterator
+        // referring to the (possibly newly created and inserted) object in
+        // this set whose value is equivalent to that of an object constructed
+        // from 'arguments', and whose 'second' member is 'true' if a new value
+        // was inserted, and 'false' if an equivalent key was already present.
+        // The new object is constructed at the end of the underlying sequence
+        // and then rotated into position.
+
+    template <class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... arguments);
+        // Insert into this set a newly-created 'value_type' object,
+        // constructed by forwarding 'get_allocator()' (if required) and the
+        // specified (variable number of) 'arguments' to the corresponding
+        // constructor of 'value_type', if a key equivalent to such a value
+        // does not already exist in this set; otherwise, this method has no
+        // effect (other than possibly creating a temporary 'value_type'
+        // object).  Return an iterator referring to the (possibly newly
+        // created and inserted) object in this set whose value is equivalent
+        // to that of an object constructed from 'arguments'.  The specified
+        // 'hint' is accepted for compatibility with 'bsl::set', and is not
+        // used.  The behavior is undefined unless 'hint' is an iterator in the
+        // range '[begin() .. end()]' (both endpoints included).
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this set the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the
+        // sequence of elements maintained by this set.  This method
+        // invalidates all iterators at or after 'position'.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the 'value_type' object that is equivalent to
+        // the specified 'key', if such an entry exists, and return 1;
+        // otherwise, if there is no 'value_type' object that is equivalent to
+        // 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the 'value_type' objects starting at the
+        // specified 'first' position up to, but including the specified 'last'
+        // position, and return 'last'.  The behavior is undefined unless
+        // 'first' and 'last' either refer to elements in this set or are the
+        // 'end' iterator, and the 'first' position is at or before the 'last'
+        // position in the ordered sequence provided by this container.
+
+    void swap(flat_set& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value and comparator of this object with the value and
+        // comparator of the specified 'other' object.  Additionally, if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true', then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees 'O[1]' complexity if either allocators are exchanged or
+        // this object was created with the same allocator as 'other' (unless
+        // swapping the (user-supplied) comparators throws); otherwise, it
+        // has 'O[n + m]' complexity, where 'n' and 'm' are the sizes of this
+        // object and 'other', respectively.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all entries from this set.  Note that the set is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    void reserve(size_type numKeys);
+        // Change the capacity of this set to at least the specified 'numKeys'.
+        // If an exception is thrown, this set is left unchanged.  Note that
+        // this method has no effect if the current capacity meets or exceeds
+        // the required capacity.
+
+    void shrink_to_fit();
+        // Minimize the memory used by this set to the extent possible without
+        // moving any keys.
+
+    // Turn off complaints about necessarily class-defined methods.
+    // BDE_VERIFY pragma: push
+    // BDE_VERIFY pragma: -CD01
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    erase(const LOOKUP_KEY& key)
+        // Remove from this set the 'value_type' objects that are equivalent
+        // to the specified 'key', and return the number of objects removed.
+        // Note that although a set maintains unique keys, the returned value
+        // can be other than 0 or 1, because a transparent comparator may have
+        // been supplied that provides a different (but compatible)
+        // partitioning of keys for 'LOOKUP_KEY' as the comparisons used to
+        // order the keys in the set.
+    {
+        const pair<const_iterator, const_iterator> range = equal_range(key);
+        const size_type numErased = range.second - range.first;
+        d_data.erase(range.first, range.second);
+        return numErased;
+    }
+
+    // BDE_VERIFY pragma: pop
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this set, or the 'end' iterator if this set is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this set.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this set, or 'rend' if this set is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this set.
+
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this set, or the 'cend' iterator if this set is empty.
+
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this set.
+
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this set, or 'crend' if this set is empty.
+
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this set.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this set.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of keys this set can hold without allocating
+        // memory.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // set; if a comparator was supplied at construction, return its value,
+        // otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects using
+        // 'key_comp()'.  Note that since 'value_type' is an alias to 'KEY' for
+        // 'flat_set', this method returns the same functor as 'key_comp()'.
+
+    const container_type& sequence() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reference providing non-modifiable access to the vector
+        // holding the keys of this set, in order.
+
+    // Turn off complaints about necessarily class-defined methods.
+    // BDE_VERIFY pragma: push
+    // BDE_VERIFY pragma: -CD01
+
+    const_iterator find(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set that is equivalent to the specified
+        // 'key', if such an entry exists, and the past-the-end ('end')
+        // iterator otherwise.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, *it) ? it : end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set that is equivalent to the specified
+        // 'key', if such an entry exists, and the past-the-end ('end')
+        // iterator otherwise.
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, *it) ? it : end();
+    }
+
+    bool contains(const key_type& key) const
+        // Return 'true' if this set contains a 'value_type' object equivalent
+        // to the specified 'key', and 'false' otherwise.
+    {
+        return find(key) != end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this set contains a 'value_type' object equivalent
+        // to the specified 'key', and 'false' otherwise.
+    {
+        return find(key) != end();
+    }
+
+    size_type count(const key_type& key) const
+        // Return the number of 'value_type' objects within this set that are
+        // equivalent to the specified 'key'.  Note that since a set maintains
+        // unique keys, the returned value will be either 0 or 1.
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this set that are
+        // equivalent to the specified 'key'.  Note that although a set
+        // maintains unique keys, the returned value can be other than 0 or 1,
+        // because a transparent comparator may have been supplied that
+        // provides a different (but compatible) partitioning of keys for
+        // 'LOOKUP_KEY' as the comparisons used to order the keys in the set.
+    {
+        const pair<const_iterator, const_iterator> range = equal_range(key);
+        return range.second - range.first;
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater-than
+        // or equal-to the specified 'key', and the past-the-end iterator if
+        // this set does not contain a 'value_type' greater-than or equal-to
+        // 'key'.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater-than
+        // or equal-to the specified 'key', and the past-the-end iterator if
+        // this set does not contain a 'value_type' greater-than or equal-to
+        // 'key'.
+    {
+        return TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    const_iterator upper_bound(const key_type& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater than
+        // the specified 'key', and the past-the-end iterator if this set does
+        // not contain a 'value_type' object greater-than 'key'.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater than
+        // the specified 'key', and the past-the-end iterator if this set does
+        // not contain a 'value_type' object greater-than 'key'.
+    {
+        return TreeUtil::upperBound<KeyConfig>(d_data.begin(),
+                                               d_data.end(),
+                                               key,
+                                               d_comparator);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set that are equivalent to
+        // the specified 'key', where the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the end
+        // of the sequence.  Note that since a set maintains unique keys, the
+        // range will contain at most one element.
+    {
+        const_iterator startIt = lower_bound(key);
+        const_iterator endIt   = startIt;
+        if (endIt != end() && !d_comparator(key, *endIt)) {
+            ++endIt;
+        }
+        return pair<const_iterator, const_iterator>(startIt, endIt);
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set that are equivalent to
+        // the specified 'key', where the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the end
+        // of the sequence.  Note that although a set maintains unique keys,
+        // the range may contain more than one element, because a transparent
+        // comparator may have been supplied that provides a different (but
+        // compatible) partitioning of keys for 'LOOKUP_KEY' as the comparisons
+        // used to order the keys in the set.
+    {
+        const_iterator startIt = lower_bound(key);
+        return pair<const_iterator, const_iterator>(
+                         startIt,
+                         TreeUtil::upperBound<KeyConfig>(startIt,
+                                                         d_data.end(),
+                                                         key,
+                                                         d_comparator));
+    }
+
+    // BDE_VERIFY pragma: pop
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_set' objects 'lhs' and 'rhs'
+    // have the same value if they have the same number of keys, and each
+    // element in the ordered sequence of keys of 'lhs' has the same value as
+    // the corresponding element in the ordered sequence of keys of 'rhs'.
+    // This method requires that the (template parameter) type 'KEY' be
+    // 'equality-comparable'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_set' objects 'lhs' and
+    // 'rhs' do not have the same value if they do not have the same number of
+    // keys, or some element in the ordered sequence of keys of 'lhs' does not
+    // have the same value as the corresponding element in the ordered sequence
+    // of keys of 'rhs'.  This method requires that the (template parameter)
+    // type 'KEY' be 'equality-comparable'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator< (const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and 'false'
+    // otherwise (see 'bsl::set').  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator> (const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than that of the specified 'rhs' set, and
+    // 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than or equal to that of the specified 'rhs' set,
+    // and 'false' otherwise.  Note that this operator returns '!(rhs < lhs)'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_set<KEY, COMPARATOR, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value and comparator of the specified 'a' object with the
+    // value and comparator of the specified 'b' object.  Additionally, if
+    // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true', then exchange the allocator of 'a' with that of 'b'.  See the
+    // 'swap' method for complexity and exception-safety guarantees.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                              // --------------
+                              // class flat_set
+                              // --------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set()
+: d_comparator()
+, d_data()
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                               const ALLOCATOR& basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const flat_set& original)
+: d_comparator(original.d_comparator)
+, d_data(original.d_data)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                             BloombergLP::bslmf::MovableRef<flat_set> original)
+: d_comparator(MoveUtil::access(original).d_comparator)
+, d_data(MoveUtil::move(MoveUtil::access(original).d_data))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                         const flat_set&  original,
+                                         const ALLOCATOR& basicAllocator)
+: d_comparator(original.d_comparator)
+, d_data(original.d_data, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                       BloombergLP::bslmf::MovableRef<flat_set> original,
+                       const ALLOCATOR&                         basicAllocator)
+: d_comparator(MoveUtil::access(original).d_comparator)
+, d_data(MoveUtil::move(MoveUtil::access(original).d_data), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                 BloombergLP::bslmf::MovableRef<container_type> container,
+                 const COMPARATOR&                              comparator)
+: d_comparator(comparator)
+, d_data(MoveUtil::move(container))
+{
+    TreeUtil::mergeTailUnique<KeyConfig>(&d_data, 0, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                 sorted_unique_t,
+                 BloombergLP::bslmf::MovableRef<container_type> container,
+                 const COMPARATOR&                              comparator)
+: d_comparator(comparator)
+, d_data(MoveUtil::move(container))
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSortedUnique<KeyConfig>(d_data.begin(),
+                                                         d_data.end(),
+                                                         d_comparator));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const COMPARATOR& comparator,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator(comparator)
+, d_data(basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                       sorted_unique_t,
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const COMPARATOR& comparator,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator(comparator)
+, d_data(first, last, basicAllocator)
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSortedUnique<KeyConfig>(d_data.begin(),
+                                                         d_data.end(),
+                                                         d_comparator));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                       sorted_unique_t,
+                                       INPUT_ITERATOR    first,
+                                       INPUT_ITERATOR    last,
+                                       const ALLOCATOR&  basicAllocator)
+: d_comparator()
+, d_data(first, last, basicAllocator)
+{
+    BSLS_ASSERT_SAFE(TreeUtil::isSortedUnique<KeyConfig>(d_data.begin(),
+                                                         d_data.end(),
+                                                         d_comparator));
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                    std::initializer_list<KEY> values,
+                                    const COMPARATOR&          comparator,
+                                    const ALLOCATOR&           basicAllocator)
+: d_comparator(comparator)
+, d_data(basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                    std::initializer_list<KEY> values,
+                                    const ALLOCATOR&           basicAllocator)
+: d_comparator()
+, d_data(basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::~flat_set()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const flat_set& rhs)
+{
+    if (this != &rhs) {
+        d_data       = rhs.d_data;
+        d_comparator = rhs.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                  BloombergLP::bslmf::MovableRef<flat_set> rhs)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    flat_set& lvalue = rhs;
+
+    if (this != &lvalue) {
+        d_data       = MoveUtil::move(lvalue.d_data);
+        d_comparator = lvalue.d_comparator;
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                             std::initializer_list<KEY> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    const_iterator it = lower_bound(value);
+    if (it != end() && !d_comparator(value, *it)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(d_data.insert(it, value), true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type& lvalue = value;
+
+    const_iterator it = lower_bound(lvalue);
+    if (it != end() && !d_comparator(lvalue, *it)) {
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    return pair<iterator, bool>(d_data.insert(it, MoveUtil::move(lvalue)),
+                                true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                             const value_type& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= hint);
+    BSLS_ASSERT_SAFE(hint    <= end());
+
+    if ((hint == end()   || d_comparator(value, *hint))
+     && (hint == begin() || d_comparator(*(hint - 1), value))) {
+        return d_data.insert(hint, value);                            // RETURN
+    }
+    return insert(value).first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    BSLS_ASSERT_SAFE(begin() <= hint);
+    BSLS_ASSERT_SAFE(hint    <= end());
+
+    value_type& lvalue = value;
+
+    if ((hint == end()   || d_comparator(lvalue, *hint))
+     && (hint == begin() || d_comparator(*(hint - 1), lvalue))) {
+        return d_data.insert(hint, MoveUtil::move(lvalue));           // RETURN
+    }
+    return insert(MoveUtil::move(lvalue)).first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    TreeUtil::insertRangeUnique<KeyConfig>(&d_data, first, last, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                  INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    // The merge detects input that is entirely ordered after the current
+    // contents, so no special handling is needed here.
+
+    TreeUtil::insertRangeUnique<KeyConfig>(&d_data, first, last, d_comparator);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                             std::initializer_list<KEY> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::emplace(Args&&... arguments)
+{
+    // Construct the new key in place at the end of the sequence, then rotate
+    // it into position, so that it is moved no more than it would be by
+    // 'insert'.
+
+    d_data.emplace_back(BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+
+    typename container_type::iterator last = d_data.end() - 1;
+    typename container_type::iterator it   =
+                              TreeUtil::lowerBound<KeyConfig>(d_data.begin(),
+                                                              last,
+                                                              *last,
+                                                              d_comparator);
+    if (it != last && !d_comparator(*last, *it)) {
+        d_data.pop_back();
+        return pair<iterator, bool>(it, false);                       // RETURN
+    }
+    native_std::rotate(it, last, d_data.end());
+    return pair<iterator, bool>(it, true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class... Args>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::emplace_hint(const_iterator,
+                                                   Args&&...      arguments)
+{
+    return emplace(BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...).first;
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_data.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return 0;                                                     // RETURN
+    }
+    d_data.erase(it);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_data.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::swap(flat_set& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    bsl::swap(d_data, other.d_data);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    d_data.clear();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::reserve(size_type numKeys)
+{
+    d_data.reserve(numKeys);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_data.shrink_to_fit();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.get_allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return rbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return rend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::empty() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.empty();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.max_size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::capacity() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data.capacity();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_set<KEY, COMPARATOR, ALLOCATOR>::container_type&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::sequence() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_data;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1204 @@
+// bslstl_flatset.t.cpp                                               -*-C++-*-
+#include <bslstl_flatset.h>
+
+#include <bslstl_set.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bsl::flat_set' is a thin adapter of 'bsl::vector' whose searching and
+// ordering are delegated to 'bslstl::FlatTreeUtil' (tested separately).  We
+// therefore concentrate on the forwarding of each method, on the allocator
+// used (which must be the allocator of the set for all memory, including
+// temporaries), and on agreement with 'bsl::set' for the same operations.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_set();
+// [ 2] explicit flat_set(const COMPARATOR&, const ALLOCATOR& = ALLOCATOR());
+// [ 2] explicit flat_set(const ALLOCATOR&);
+// [ 2] flat_set(const flat_set&);
+// [ 2] flat_set(MovableRef<flat_set>);
+// [ 2] flat_set(const flat_set&, const ALLOCATOR&);
+// [ 2] flat_set(MovableRef<flat_set>, const ALLOCATOR&);
+// [ 2] explicit flat_set(MovableRef<container_type>, const COMPARATOR&);
+// [ 2] flat_set(sorted_unique_t, MovableRef<container_type>, const COMP&);
+// [ 2] flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const COMP&, const ALLOC&);
+// [ 2] flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+// [ 2] flat_set(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 2] flat_set(initializer_list<KEY>, const COMP&, const ALLOC&);
+// [ 2] flat_set(initializer_list<KEY>, const ALLOCATOR&);
+// [ 2] ~flat_set();
+//
+// MANIPULATORS
+// [ 5] flat_set& operator=(const flat_set&);
+// [ 5] flat_set& operator=(MovableRef<flat_set>);
+// [ 5] flat_set& operator=(initializer_list<KEY>);
+// [ 3] pair<iterator, bool> insert(const value_type&);
+// [ 3] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 3] iterator insert(const_iterator, const value_type&);
+// [ 3] iterator insert(const_iterator, MovableRef<value_type>);
+// [ 3] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] void insert(initializer_list<KEY>);
+// [ 3] pair<iterator, bool> emplace(Args&&...);
+// [ 3] iterator emplace_hint(const_iterator, Args&&...);
+// [ 3] iterator erase(const_iterator);
+// [ 3] size_type erase(const key_type&);
+// [ 3] size_type erase(const LOOKUP_KEY&);
+// [ 3] iterator erase(const_iterator, const_iterator);
+// [ 5] void swap(flat_set&);
+// [ 3] void clear();
+// [ 2] void reserve(size_type);
+// [ 2] void shrink_to_fit();
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_reverse_iterator rbegin() const;
+// [ 4] const_reverse_iterator rend() const;
+// [ 4] const_iterator cbegin() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_reverse_iterator crbegin() const;
+// [ 4] const_reverse_iterator crend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type capacity() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 2] const container_type& sequence() const;
+// [ 4] bool contains(const key_type&) const;
+// [ 4] const_iterator find(const key_type&) const;
+// [ 4] size_type count(const key_type&) const;
+// [ 4] const_iterator lower_bound(const key_type&) const;
+// [ 4] const_iterator upper_bound(const key_type&) const;
+// [ 4] pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [ 4] bool contains(const LOOKUP_KEY&) const;
+// [ 4] const_iterator find(const LOOKUP_KEY&) const;
+// [ 4] size_type count(const LOOKUP_KEY&) const;
+// [ 4] const_iterator lower_bound(const LOOKUP_KEY&) const;
+// [ 4] const_iterator upper_bound(const LOOKUP_KEY&) const;
+// [ 4] pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const flat_set&, const flat_set&);
+// [ 5] bool operator!=(const flat_set&, const flat_set&);
+// [ 5] bool operator< (const flat_set&, const flat_set&);
+// [ 5] bool operator> (const flat_set&, const flat_set&);
+// [ 5] bool operator<=(const flat_set&, const flat_set&);
+// [ 5] bool operator>=(const flat_set&, const flat_set&);
+// [ 5] void swap(flat_set&, flat_set&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'flat_set' vs. 'set'
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::flat_set<int>                   Obj;
+typedef bsl::set<int>                        Reference;
+typedef bsl::flat_set<bsl::string>           StringObj;
+typedef bslmf::MovableRefUtil                MoveUtil;
+
+namespace {
+
+struct TransparentLess {
+    // This 'struct' provides a transparent comparator for 'int' keys that
+    // counts the number of comparisons it performs with 'long' lookup keys.
+
+    // PUBLIC TYPES
+    typedef void is_transparent;
+
+    // CLASS DATA
+    static int s_numLongComparisons;
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'lhs < rhs'.
+    {
+        return lhs < rhs;
+    }
+
+    bool operator()(long lhs, int rhs) const
+        // Return 'lhs < rhs'.
+    {
+        ++s_numLongComparisons;
+        return lhs < rhs;
+    }
+
+    bool operator()(int lhs, long rhs) const
+        // Return 'lhs < rhs'.
+    {
+        ++s_numLongComparisons;
+        return lhs < rhs;
+    }
+};
+
+int TransparentLess::s_numLongComparisons = 0;
+
+bool greaterInt(int lhs, int rhs)
+    // Return 'true' if the specified 'lhs' is greater than the specified
+    // 'rhs', and 'false' otherwise.
+{
+    return lhs > rhs;
+}
+
+bool verifyEqual(const Obj& object, const Reference& reference)
+    // Return 'true' if the specified 'object' holds the same keys, in the same
+    // order, as the specified 'reference', and 'false' otherwise.
+{
+    return object.size() == reference.size()
+        && native_std::equal(object.begin(), object.end(), reference.begin());
+}
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Read-Mostly Set of Identifiers
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service must reject requests naming instruments that are not
+// on an approved list.  The list is loaded, in no particular order, when the
+// service starts and is consulted for every request thereafter; it is an
+// ideal candidate for a 'flat_set'.
+//
+// First, we define a class that holds the approved identifiers:
+//..
+    class ApprovedList {
+        // This class holds a set of approved instrument identifiers.
+
+        // DATA
+        bsl::flat_set<int> d_ids;  // approved identifiers
+
+      public:
+        // CREATORS
+        template <class INPUT_ITERATOR>
+        ApprovedList(INPUT_ITERATOR    first,
+                     INPUT_ITERATOR    last,
+                     bslma::Allocator *basicAllocator = 0)
+            // Create a list approving the identifiers in the specified range
+            // '[first .. last)'.  Optionally specify a 'basicAllocator' used
+            // to supply memory.  If 'basicAllocator' is 0, the currently
+            // installed default allocator is used.
+        : d_ids(first, last, basicAllocator)
+        {
+        }
+
+        // ACCESSORS
+        bool isApproved(int id) const
+            // Return 'true' if the specified 'id' is approved, and 'false'
+            // otherwise.
+        {
+            return d_ids.contains(id);
+        }
+
+        native_std::size_t numApproved() const
+            // Return the number of approved identifiers.
+        {
+            return d_ids.size();
+        }
+    };
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we load a list, which happens to contain a duplicate:
+//..
+        const int IDS[] = { 4417, 12, 987, 5, 12, 3001 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        ApprovedList list(IDS, IDS + sizeof IDS / sizeof *IDS, &oa);
+        ASSERT(5 == list.numApproved());
+//..
+// Now, we observe that the whole set occupies a single block of memory (the
+// temporary used to sort the input having been released):
+//..
+        ASSERT(1 == oa.numBlocksInUse());
+//..
+// Finally, we check some identifiers:
+//..
+        ASSERT( list.isApproved(987));
+        ASSERT( list.isApproved(5));
+        ASSERT(!list.isApproved(6));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ASSIGNMENT, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Assignment copies (or moves) the keys and the comparator, and
+        //:   retains the allocator of the target.
+        //:
+        //: 2 'swap' exchanges the keys and comparators, including between
+        //:   sets using different allocators.
+        //:
+        //: 3 The comparison operators compare the key sequences
+        //:   lexicographically.
+        //
+        // Plan:
+        //: 1 Assign between sets with different allocators and comparators,
+        //:   and check the value, comparator and allocator of the target.
+        //:   (C-1)
+        //:
+        //: 2 Swap sets having the same and different allocators.  (C-2)
+        //:
+        //: 3 Use the table-driven technique for the comparison operators.
+        //:   (C-3)
+        //
+        // Testing:
+        //   flat_set& operator=(const flat_set&);
+        //   flat_set& operator=(MovableRef<flat_set>);
+        //   flat_set& operator=(initializer_list<KEY>);
+        //   void swap(flat_set&);
+        //   bool operator==(const flat_set&, const flat_set&);
+        //   bool operator!=(const flat_set&, const flat_set&);
+        //   bool operator< (const flat_set&, const flat_set&);
+        //   bool operator> (const flat_set&, const flat_set&);
+        //   bool operator<=(const flat_set&, const flat_set&);
+        //   bool operator>=(const flat_set&, const flat_set&);
+        //   void swap(flat_set&, flat_set&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGNMENT, SWAP, AND COMPARISON"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        typedef bsl::flat_set<int, bool (*)(int, int)> FpObj;
+
+        const int VALUES[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+
+        if (verbose) printf("\tTesting assignment.\n");
+        {
+            FpObj mY(VALUES, VALUES + 8, &greaterInt, &za);
+            const FpObj& Y = mY;
+
+            FpObj mX(static_cast<bool (*)(int, int)>(0), &oa);
+            const FpObj& X = mX;
+
+            ASSERT(&mX == &(mX = Y));
+            ASSERT(Y == X);
+            ASSERT(&greaterInt == X.key_comp());
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(9 == *X.begin());
+
+            FpObj mZ(&oa);  const FpObj& Z = mZ;
+            mZ = MoveUtil::move(mX);
+            ASSERT(Y == Z);
+            ASSERT(&greaterInt == Z.key_comp());
+            ASSERT(&oa == Z.get_allocator());
+
+            mZ = MoveUtil::move(mY);  // different allocator
+            ASSERT(&oa == Z.get_allocator());
+            ASSERT(7 == Z.size());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mZ = { 7, 8, 7 };
+            ASSERT(2 == Z.size());
+            ASSERT(8 == *Z.begin());
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tTesting 'swap'.\n");
+        {
+            Obj mX(VALUES, VALUES + 4, &oa);  const Obj& X = mX;
+            Obj mY(VALUES + 4, VALUES + 8, &oa);  const Obj& Y = mY;
+            Obj mZ(&za);  const Obj& Z = mZ;
+
+            const Obj XX(X, &oa), YY(Y, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+            mX.swap(mY);
+            ASSERT(NUM_ALLOCS == oa.numAllocations());
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+
+            swap(mX, mZ);
+            ASSERT(YY == Z);
+            ASSERT(X.empty());
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(&za == Z.get_allocator());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tTesting comparison operators.\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_spec;
+            } DATA[] = {
+                // Listed in increasing lexicographical order.
+
+                { L_, ""     },
+                { L_, "1"    },
+                { L_, "12"   },
+                { L_, "123"  },
+                { L_, "13"   },
+                { L_, "2"    },
+                { L_, "23"   },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const char *const SPEC1 = DATA[ti].d_spec;
+                Obj mX(&oa);  const Obj& X = mX;
+                for (const char *p = SPEC1; *p; ++p) {
+                    mX.insert(*p - '0');
+                }
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const char *const SPEC2 = DATA[tj].d_spec;
+                    Obj mY(&za);  const Obj& Y = mY;
+                    for (const char *p = SPEC2; *p; ++p) {
+                        mY.insert(*p - '0');
+                    }
+
+                    ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                    ASSERTV(ti, tj, (ti != tj) == (X != Y));
+                    ASSERTV(ti, tj, (ti <  tj) == (X <  Y));
+                    ASSERTV(ti, tj, (ti >  tj) == (X >  Y));
+                    ASSERTV(ti, tj, (ti <= tj) == (X <= Y));
+                    ASSERTV(ti, tj, (ti >= tj) == (X >= Y));
+                }
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LOOKUP AND ITERATION
+        //
+        // Concerns:
+        //: 1 Each lookup method returns the same position as the
+        //:   corresponding method of 'bsl::set' having the same keys.
+        //:
+        //: 2 The transparent overloads are selected for a transparent
+        //:   comparator and a lookup key of a different type.
+        //:
+        //: 3 Forward and reverse iteration visit the keys in order.
+        //
+        // Plan:
+        //: 1 For sets of every size in '[0 .. 20]' holding even keys, search
+        //:   for every key in '[-1 .. 2 * size]' and compare (by distance
+        //:   from 'begin') with a 'bsl::set'.  (C-1)
+        //:
+        //: 2 Repeat with a transparent comparator and 'long' lookup keys,
+        //:   verifying that the 'long' comparisons are used.  (C-2)
+        //:
+        //: 3 Compare the iteration sequences with those of the reference.
+        //:   (C-3)
+        //
+        // Testing:
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   bool contains(const key_type&) const;
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iter, const_iter> equal_range(const key_type&) const;
+        //   bool contains(const LOOKUP_KEY&) const;
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   size_type count(const LOOKUP_KEY&) const;
+        //   const_iterator lower_bound(const LOOKUP_KEY&) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY&) const;
+        //   pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP AND ITERATION"
+                            "\n====================\n");
+
+        typedef bsl::flat_set<int, TransparentLess> TObj;
+
+        for (int size = 0; size <= 20; ++size) {
+            Obj       mX;  const Obj&       X = mX;
+            TObj      mT;  const TObj&      T = mT;
+            Reference mR;  const Reference& R = mR;
+
+            for (int i = 0; i < size; ++i) {
+                mX.insert(2 * i);
+                mT.insert(2 * i);
+                mR.insert(2 * i);
+            }
+
+            ASSERTV(size, verifyEqual(X, R));
+            ASSERTV(size, native_std::equal(X.cbegin(), X.cend(), R.begin()));
+            ASSERTV(size, native_std::equal(X.rbegin(), X.rend(), R.rbegin()));
+            ASSERTV(size, native_std::equal(X.crbegin(),
+                                            X.crend(),
+                                            R.rbegin()));
+
+            for (int key = -1; key <= 2 * size; ++key) {
+                const long LKEY = key;
+
+#define DIST(CONTAINER, ITERATOR)                                             \
+    native_std::distance(CONTAINER.begin(), ITERATOR)
+
+                ASSERTV(size, key,
+                        DIST(R, R.find(key)) == DIST(X, X.find(key)));
+                ASSERTV(size, key, R.count(key) == X.count(key));
+                ASSERTV(size, key, (1 == R.count(key)) == X.contains(key));
+                ASSERTV(size, key, DIST(R, R.lower_bound(key)) ==
+                                                  DIST(X, X.lower_bound(key)));
+                ASSERTV(size, key, DIST(R, R.upper_bound(key)) ==
+                                                  DIST(X, X.upper_bound(key)));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).first) ==
+                                          DIST(X, X.equal_range(key).first));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).second) ==
+                                          DIST(X, X.equal_range(key).second));
+
+                TransparentLess::s_numLongComparisons = 0;
+
+                ASSERTV(size, key,
+                        DIST(R, R.find(key)) == DIST(T, T.find(LKEY)));
+                ASSERTV(size, key, R.count(key) == T.count(LKEY));
+                ASSERTV(size, key, (1 == R.count(key)) == T.contains(LKEY));
+                ASSERTV(size, key, DIST(R, R.lower_bound(key)) ==
+                                               DIST(T, T.lower_bound(LKEY)));
+                ASSERTV(size, key, DIST(R, R.upper_bound(key)) ==
+                                               DIST(T, T.upper_bound(LKEY)));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).first) ==
+                                       DIST(T, T.equal_range(LKEY).first));
+                ASSERTV(size, key, DIST(R, R.equal_range(key).second) ==
+                                       DIST(T, T.equal_range(LKEY).second));
+
+                ASSERTV(size, key,
+                        0 == size ||
+                                   0 < TransparentLess::s_numLongComparisons);
+#undef DIST
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, EMPLACE, AND ERASE
+        //
+        // Concerns:
+        //: 1 Each single-key insertion inserts the key, in order, unless an
+        //:   equivalent key is present, and reports whether it did.
+        //:
+        //: 2 Hinted insertion produces the same result for correct and
+        //:   incorrect hints.
+        //:
+        //: 3 Range insertion merges the range, keeping existing keys.
+        //:
+        //: 4 Each 'erase' removes the specified keys and returns the correct
+        //:   value.
+        //:
+        //: 5 Keys that use allocators are supplied the set's allocator.
+        //:
+        //: 6 Range insertion is exception neutral.
+        //
+        // Plan:
+        //: 1 Perform a sequence of operations on a 'flat_set' and a
+        //:   'bsl::set', comparing the results and the contents after each.
+        //:   (C-1..4)
+        //:
+        //: 2 Insert 'bsl::string' keys, by copy, move, and emplacement, and
+        //:   check their allocators.  (C-5)
+        //:
+        //: 3 Insert a range in an exception test loop.  (C-6)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   iterator insert(const_iterator, MovableRef<value_type>);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<KEY>);
+        //   pair<iterator, bool> emplace(Args&&...);
+        //   iterator emplace_hint(const_iterator, Args&&...);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   size_type erase(const LOOKUP_KEY&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERT, EMPLACE, AND ERASE"
+                            "\n==========================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting single-key insertion.\n");
+        {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference mR;       const Reference& R = mR;
+
+            const int VALUES[] = { 5, 1, 9, 5, 3, 7, 1, 0, 10, 9, 4 };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const int V = VALUES[i];
+
+                bsl::pair<Obj::iterator, bool> rx = mX.insert(V);
+                bsl::pair<Reference::iterator, bool> rr = mR.insert(V);
+
+                ASSERTV(i, rr.second == rx.second);
+                ASSERTV(i, V == *rx.first);
+                ASSERTV(i, verifyEqual(X, R));
+            }
+
+            // Hints: correct ('upper_bound'), 'begin', and 'end'.
+
+            for (int v = -2; v <= 12; ++v) {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+                Obj mW(X, &oa);  const Obj& W = mW;
+
+                Obj::iterator ry = mY.insert(Y.upper_bound(v), v);
+                Obj::iterator rz = mZ.insert(Z.begin(), v);
+                Obj::iterator rw = mW.insert(W.end(), v);
+
+                ASSERTV(v, v == *ry && v == *rz && v == *rw);
+                ASSERTV(v, Y == Z && Z == W && Y.contains(v));
+            }
+
+            ASSERT(1 == mX.erase(5));
+            ASSERT(0 == mX.erase(5));
+            ASSERT(1 == mR.erase(5));
+            ASSERT(verifyEqual(X, R));
+
+            Obj::iterator it = mX.erase(X.find(3));
+            ASSERT(4 == *it);
+            mR.erase(3);
+            ASSERT(verifyEqual(X, R));
+
+            it = mX.erase(X.lower_bound(4), X.upper_bound(9));
+            ASSERT(10 == *it);
+            mR.erase(mR.lower_bound(4), mR.upper_bound(9));
+            ASSERT(verifyEqual(X, R));
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range insertion.\n");
+        {
+            const int HEAD[] = { 2, 4, 6, 8 };
+            const int TAIL[] = { 9, 4, 1, 8, 8, 0 };
+
+            Obj mX(HEAD, HEAD + 4, &oa);  const Obj& X = mX;
+            Reference mR(HEAD, HEAD + 4);  const Reference& R = mR;
+
+            mX.insert(TAIL, TAIL + 6);
+            mR.insert(TAIL, TAIL + 6);
+            ASSERT(verifyEqual(X, R));
+
+            const int SORTED[] = { 3, 5, 7, 11, 12 };
+            mX.insert(bsl::sorted_unique, SORTED, SORTED + 5);
+            mR.insert(SORTED, SORTED + 5);
+            ASSERT(verifyEqual(X, R));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX.insert({ 100, -1, 100 });
+            mR.insert({ 100, -1, 100 });
+            ASSERT(verifyEqual(X, R));
+#endif
+
+            typedef bsl::flat_set<int, TransparentLess> TObj;
+
+            TObj mT(X.begin(), X.end());  const TObj& T = mT;
+            ASSERT(1 == mT.erase(3L));
+            ASSERT(0 == mT.erase(3L));
+            ASSERT(T.size() + 1 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting exception neutrality.\n");
+        {
+            const char *const WORDS[] = {
+                "delta-delta-delta-delta-delta-delta-delta",
+                "alpha-alpha-alpha-alpha-alpha-alpha-alpha",
+                "echo-echo-echo-echo-echo-echo-echo-echo",
+                "bravo-bravo-bravo-bravo-bravo-bravo-bravo",
+                "alpha-alpha-alpha-alpha-alpha-alpha-alpha",
+            };
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StringObj mX(&oa);  const StringObj& X = mX;
+
+                const bsls::Types::Int64 AL = oa.allocationLimit();
+                oa.setAllocationLimit(-1);
+                mX.insert(bsl::string("charlie-charlie-charlie-charlie-char",
+                                      &oa));
+                oa.setAllocationLimit(AL);
+
+                try {
+                    mX.insert(WORDS, WORDS + 5);
+                }
+                catch (...) {
+                    ASSERT(X.empty() || 1 == X.size());
+                    throw;
+                }
+                ASSERTV(X.size(), 5 == X.size());
+                ASSERT('a' == (*X.begin())[0]);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting allocator propagation to keys.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            const bsl::string A("a long string that does not fit in SSO a",
+                                &defaultAllocator);
+            bsl::string       B("b long string that does not fit in SSO b",
+                                &oa);
+
+            ASSERT(mX.insert(A).second);
+            ASSERT(mX.insert(X.end(), MoveUtil::move(B)) != X.end());
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            ASSERT(mX.emplace("c long string that does not fit in SSO c")
+                                                                     .second);
+            ASSERT(!mX.emplace("c long string that does not fit in SSO c")
+                                                                     .second);
+            StringObj::iterator it = mX.emplace_hint(
+                                   X.begin(),
+                                   "d long string that does not fit in SSO d");
+            ASSERT('d' == (*it)[0]);
+            ASSERT(4 == X.size());
+#endif
+            for (StringObj::const_iterator it = X.begin(); it != X.end();
+                                                                        ++it) {
+                ASSERT(&oa == it->get_allocator());
+            }
+            std::greater_equal<bsl::string> notLess;
+            ASSERT(X.sequence().end() ==
+                              native_std::adjacent_find(X.sequence().begin(),
+                                                        X.sequence().end(),
+                                                        notLess));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a set having the expected value,
+        //:   comparator, and allocator.
+        //:
+        //: 2 Constructors taking unsorted input sort it and drop duplicates,
+        //:   keeping the first of equivalent keys; constructors taking
+        //:   sorted input use it unchanged.
+        //:
+        //: 3 Adopting a container, and moving a set with the same allocator,
+        //:   allocate no memory.
+        //:
+        //: 4 Building from a range allocates, other than the final storage,
+        //:   only temporary memory from the set's allocator.
+        //:
+        //: 5 'reserve' and 'shrink_to_fit' change the capacity.
+        //
+        // Plan:
+        //: 1 Construct sets by each constructor and check their state and the
+        //:   memory allocated.  (C-1..5)
+        //
+        // Testing:
+        //   flat_set();
+        //   explicit flat_set(const COMPARATOR&, const ALLOCATOR&);
+        //   explicit flat_set(const ALLOCATOR&);
+        //   flat_set(const flat_set&);
+        //   flat_set(MovableRef<flat_set>);
+        //   flat_set(const flat_set&, const ALLOCATOR&);
+        //   flat_set(MovableRef<flat_set>, const ALLOCATOR&);
+        //   explicit flat_set(MovableRef<container_type>, const COMPARATOR&);
+        //   flat_set(sorted_unique_t, MovableRef<container_type>, ...);
+        //   flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const COMP&, ...);
+        //   flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const ALLOCATOR&);
+        //   flat_set(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   flat_set(initializer_list<KEY>, const COMP&, const ALLOC&);
+        //   flat_set(initializer_list<KEY>, const ALLOCATOR&);
+        //   ~flat_set();
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   allocator_type get_allocator() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   size_type capacity() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const container_type& sequence() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const int VALUES[]   = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3 };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+        const int SORTED[]   = { 1, 2, 3, 4, 5, 6, 9 };
+        const int NUM_SORTED = sizeof SORTED / sizeof *SORTED;
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 < X.max_size());
+            ASSERT(&defaultAllocator == X.get_allocator());
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());
+            mX.insert(7);
+            mX.shrink_to_fit();
+            ASSERT(1 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        {
+            typedef bsl::flat_set<int, bool (*)(int, int)> FpObj;
+
+            FpObj mX(&greaterInt, &oa);  const FpObj& X = mX;
+            ASSERT(&greaterInt == X.key_comp());
+            ASSERT(&greaterInt == X.value_comp());
+            ASSERT(&oa == X.get_allocator());
+
+            FpObj mY(VALUES, VALUES + NUM_VALUES, &greaterInt, &oa);
+            const FpObj& Y = mY;
+            ASSERT(9 == *Y.begin());
+            ASSERT(1 == *Y.rbegin());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        {
+            oa.setAllocationLimit(-1);
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+            Obj mX(VALUES, VALUES + NUM_VALUES, &oa);  const Obj& X = mX;
+
+            ASSERT(NUM_SORTED == X.size());
+            ASSERT(native_std::equal(X.begin(), X.end(), SORTED));
+            ASSERT(1 == oa.numBlocksInUse());
+
+            // One block for the appended keys, one for the addresses of the
+            // keys, and one for the merged result.
+
+            ASSERTV(oa.numAllocations() - NUM_ALLOCS,
+                    3 == oa.numAllocations() - NUM_ALLOCS);
+
+            Obj mY(bsl::sorted_unique, SORTED, SORTED + NUM_SORTED, &oa);
+            const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            Obj mZ(bsl::sorted_unique, SORTED, SORTED + NUM_SORTED);
+            const Obj& Z = mZ;
+            ASSERT(X == Z);
+            ASSERT(&defaultAllocator == Z.get_allocator());
+
+            // Copy and move.
+
+            Obj mA(X);  const Obj& A = mA;
+            ASSERT(X == A);
+            ASSERT(&defaultAllocator == A.get_allocator());
+
+            Obj mB(X, &za);  const Obj& B = mB;
+            ASSERT(X == B);
+            ASSERT(&za == B.get_allocator());
+
+            Obj mM(X, &oa);
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+            Obj mC(MoveUtil::move(mM));  const Obj& C = mC;
+            ASSERT(X == C);
+            ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+
+            Obj mD(MoveUtil::move(mC), &oa);  const Obj& D = mD;
+            ASSERT(X == D);
+            ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+
+            Obj mE(MoveUtil::move(mD), &za);  const Obj& E = mE;
+            ASSERT(X == E);
+            ASSERT(&za == E.get_allocator());
+
+            // Adopt a container.
+
+            bsl::vector<int> v(VALUES, VALUES + NUM_VALUES, &za);
+            const bsls::Types::Int64 NUM_Z = za.numBlocksTotal();
+
+            Obj mF(MoveUtil::move(v));  const Obj& F = mF;
+            ASSERT(X == F);
+            ASSERT(&za == F.get_allocator());
+            ASSERT(NUM_Z + 2 == za.numBlocksTotal());  // addresses, result
+
+            bsl::vector<int> w(SORTED, SORTED + NUM_SORTED, &za);
+            const bsls::Types::Int64 NUM_W = za.numBlocksTotal();
+
+            Obj mG(bsl::sorted_unique, MoveUtil::move(w));  const Obj& G = mG;
+            ASSERT(X == G);
+            ASSERT(NUM_W == za.numBlocksTotal());
+            ASSERT(F.sequence() == G.sequence());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX({ 3, 1, 3, 2 }, &oa);  const Obj& X = mX;
+            ASSERT(3 == X.size());
+            ASSERT(1 == *X.begin());
+
+            Obj mY({ 3, 1, 3, 2 }, std::less<int>(), &oa);  const Obj& Y = mY;
+            ASSERT(X == Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform some ad-hoc tests.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT( mX.insert(5).second);
+        ASSERT( mX.insert(1).second);
+        ASSERT(!mX.insert(5).second);
+        ASSERT( mX.insert(3).second);
+        ASSERT(3 == X.size());
+        ASSERT(1 == *X.begin());
+        ASSERT(5 == *X.rbegin());
+
+        ASSERT(X.contains(3));
+        ASSERT(!X.contains(4));
+        ASSERT(X.find(4) == X.end());
+        ASSERT(*X.lower_bound(4) == 5);
+        ASSERT(*X.upper_bound(3) == 5);
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+        ASSERT(1 == mY.erase(3));
+        ASSERT(X != Y);
+        ASSERT(X < Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'flat_set' vs. 'set'
+        //
+        // Concerns:
+        //: 1 Building, searching, and iterating a 'flat_set' is faster than
+        //:   doing the same with a 'bsl::set'.
+        //
+        // Plan:
+        //: 1 For sets of 'int' of increasing size, time building each
+        //:   container from the same unordered range, a fixed number of
+        //:   random lookups (half of them successful), and a full iteration,
+        //:   and report the best of several runs.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'flat_set' vs. 'set'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'flat_set' vs. 'set'"
+                            "\n=================================\n");
+
+        const int NUM_LOOKUPS = 1 << 20;
+        const int NUM_RUNS    = 5;
+
+        // Use the new-delete allocator, so that the cost of bookkeeping in
+        // the test allocator does not penalize the node-based 'set'.
+
+        bslma::Allocator *oa = &bslma::NewDeleteAllocator::singleton();
+
+        bsl::vector<int> keys(NUM_LOOKUPS, oa);
+
+        printf("%9s  %21s  %21s  %21s\n",
+               "", "build (ns/key)", "find (ns/lookup)", "iterate (ns/key)");
+        printf("%9s  %10s %10s  %10s %10s  %10s %10s\n",
+               "size", "set", "flat_set", "set", "flat_set", "set",
+               "flat_set");
+
+        for (int size = 16; size <= (1 << 22); size *= 4) {
+            bsl::vector<int> input(size, oa);
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < size; ++i) {
+                seed     = seed * 1103515245 + 12345;
+                input[i] = static_cast<int>(seed >> 1);
+            }
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                seed    = seed * 1103515245 + 12345;
+                keys[i] = i & 1 ? input[(seed >> 1) % size]
+                                : static_cast<int>(seed >> 1);
+            }
+
+            double buildTime[2]   = { 1e9, 1e9 };
+            double findTime[2]    = { 1e9, 1e9 };
+            double iterateTime[2] = { 1e9, 1e9 };
+            long   found[2]       = { 0, 0 };
+            long   sum[2]         = { 0, 0 };
+
+            for (int run = 0; run < NUM_RUNS; ++run) {
+                bsls::Stopwatch timer;
+
+                timer.start();
+                Reference mR(input.begin(), input.end(), oa);
+                const Reference& R = mR;
+                timer.stop();
+                buildTime[0] = native_std::min(buildTime[0],
+                                               timer.elapsedTime());
+
+                timer.reset();
+                timer.start();
+                Obj mX(input.begin(), input.end(), oa);  const Obj& X = mX;
+                timer.stop();
+                buildTime[1] = native_std::min(buildTime[1],
+                                               timer.elapsedTime());
+
+                found[0] = 0;
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                    found[0] += R.end() != R.find(keys[i]);
+                }
+                timer.stop();
+                findTime[0] = native_std::min(findTime[0],
+                                              timer.elapsedTime());
+
+                found[1] = 0;
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                    found[1] += X.end() != X.find(keys[i]);
+                }
+                timer.stop();
+                findTime[1] = native_std::min(findTime[1],
+                                              timer.elapsedTime());
+
+                sum[0] = 0;
+                timer.reset();
+                timer.start();
+                for (Reference::const_iterator it = R.begin(); it != R.end();
+                                                                        ++it) {
+                    sum[0] += *it;
+                }
+                timer.stop();
+                iterateTime[0] = native_std::min(iterateTime[0],
+                                                 timer.elapsedTime());
+
+                sum[1] = 0;
+                timer.reset();
+                timer.start();
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    sum[1] += *it;
+                }
+                timer.stop();
+                iterateTime[1] = native_std::min(iterateTime[1],
+                                                 timer.elapsedTime());
+
+                ASSERTV(size, verifyEqual(X, R));
+            }
+            ASSERTV(size, found[0] == found[1]);
+            ASSERTV(size, sum[0] == sum[1]);
+
+            printf("%9d  %10.1f %10.1f  %10.1f %10.1f  %10.2f %10.2f\n",
+                   size,
+                   buildTime[0]   * 1e9 / size,
+                   buildTime[1]   * 1e9 / size,
+                   findTime[0]    * 1e9 / NUM_LOOKUPS,
+                   findTime[1]    * 1e9 / NUM_LOOKUPS,
+                   iterateTime[0] * 1e9 / size,
+                   iterateTime[1] * 1e9 / size);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,753 @@
+// bslstl_flattreeutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATTREEUTIL
+#define INCLUDED_BSLSTL_FLATTREEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide search and bulk-build algorithms for sorted vectors.
+//
+//@CLASSES:
+//  bslstl::FlatTreeUtil: namespace for sorted-sequence algorithms
+//  bsl::sorted_unique_t: tag type for sorted input having unique keys
+//  bsl::sorted_equivalent_t: tag type for sorted input
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatmap, bslalg_rbtreeutil
+//
+//@DESCRIPTION: This component provides a namespace, 'bslstl::FlatTreeUtil',
+// for the algorithms needed to implement ordered associative containers whose
+// elements are held, in key order, in a single contiguous sequence (a "flat
+// tree"), such as 'bsl::flat_set' and 'bsl::flat_map'.  The algorithms are
+// parameterized by a 'KEY_CONFIG' type that extracts the key from an element
+// (see {'KEY_CONFIG'}) and by a comparator inducing a strict weak ordering on
+// those keys.
+//
+// 'lowerBound' and 'upperBound' perform a binary search whose loop body is
+// free of data-dependent branches: each step halves the remaining range and
+// selects the half containing the result using a conditional move, so the
+// number of iterations depends only on the length of the range.  For searches
+// with unpredictable outcomes (the common case for lookups in large
+// containers) this avoids the branch mispredictions that dominate the cost of
+// a conventional binary search.  Since the next probe is known to be one of
+// two elements, both are prefetched, which hides much of the memory latency
+// of searching ranges that do not fit in cache.
+//
+// 'mergeTailUnique' and 'mergeTailMulti' restore the ordering invariant of a
+// container to which an arbitrary (unordered) sequence of elements has been
+// appended: the appended "tail" is sorted (indirectly, through a vector of
+// element addresses, so that the sort is stable and the elements themselves
+// are moved only once) and then merged with the already-sorted "head".  The
+// whole operation is 'O[N + M * log(M)]', where 'N' is the length of the head
+// and 'M' is the length of the tail, and it is skipped entirely if the tail is
+// found to already follow the head in order (as is the case when building
+// from sorted input).  'insertRangeUnique' and 'insertRangeMulti' combine
+// appending a range with the subsequent merge.
+//
+// This component also defines the tag types 'bsl::sorted_unique_t' and
+// 'bsl::sorted_equivalent_t' (and the corresponding tag objects
+// 'bsl::sorted_unique' and 'bsl::sorted_equivalent'), used to select the
+// constructors of flat containers that accept input already sorted by key.
+//
+///'KEY_CONFIG'
+///------------
+// The 'KEY_CONFIG' template parameter of the functions in this component must
+// provide:
+//..
+//  Name                  Description
+//  --------------------  ---------------------------------------------------
+//  KeyType               Alias for the type of the keys of the elements.
+//
+//  ValueType             Alias for the type of the elements.
+//
+//  extractKey(element)   Static function returning a 'const KeyType&' that
+//                        refers to the key of the specified 'element'.
+//..
+// 'bslstl::UnorderedSetKeyConfiguration' and
+// 'bslstl::UnorderedMapKeyConfiguration' are suitable key configurations for
+// sets (where the element is the key) and maps (where the key is the 'first'
+// member of a pair), respectively.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining a Sorted Vector of Unique Keys
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to keep a 'bsl::vector' of integers sorted and free of
+// duplicates, adding values in batches and searching it frequently.
+//
+// First, we define the key configuration (for which the element is the key)
+// and a comparator:
+//..
+//  typedef bslstl::UnorderedSetKeyConfiguration<int> KeyConfig;
+//  std::less<int>                                    comparator;
+//..
+// Then, we append an unordered batch of values (containing a duplicate) to an
+// empty vector and restore the ordering invariant:
+//..
+//  bsl::vector<int> values;
+//
+//  const int BATCH1[] = { 7, 3, 9, 3, 1 };
+//  bslstl::FlatTreeUtil::insertRangeUnique<KeyConfig>(&values,
+//                                                     BATCH1,
+//                                                     BATCH1 + 5,
+//                                                     comparator);
+//  assert(4 == values.size());
+//  assert(1 == values[0]);
+//  assert(3 == values[1]);
+//  assert(7 == values[2]);
+//  assert(9 == values[3]);
+//..
+// Next, we add a second batch, some of whose values are already present:
+//..
+//  const int BATCH2[] = { 8, 1, 2 };
+//  bslstl::FlatTreeUtil::insertRangeUnique<KeyConfig>(&values,
+//                                                     BATCH2,
+//                                                     BATCH2 + 3,
+//                                                     comparator);
+//  assert(6 == values.size());
+//  assert(2 == values[1]);
+//  assert(8 == values[4]);
+//..
+// Finally, we search the vector:
+//..
+//  bsl::vector<int>::const_iterator it =
+//      bslstl::FlatTreeUtil::lowerBound<KeyConfig>(values.begin(),
+//                                                  values.end(),
+//                                                  5,
+//                                                  comparator);
+//  assert(7 == *it);
+//
+//  it = bslstl::FlatTreeUtil::upperBound<KeyConfig>(values.begin(),
+//                                                   values.end(),
+//                                                   9,
+//                                                   comparator);
+//  assert(values.end() == it);
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_vector.h>
+
+#include <bslma_allocatortraits.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_nativestd.h>
+#include <bsls_performancehint.h>
+#include <bsls_util.h>
+
+#include <algorithm>
+
+namespace bsl {
+
+                          // ======================
+                          // struct sorted_unique_t
+                          // ======================
+
+struct sorted_unique_t {
+    // Tag type indicating that the input range supplied to a flat container
+    // constructor (or 'insert' method) is sorted by key and contains no two
+    // elements having equivalent keys.
+};
+
+static const sorted_unique_t sorted_unique = { };
+    // Value of type 'sorted_unique_t' used as actual argument to functions
+    // that accept a sorted range of unique keys.
+
+                        // ==========================
+                        // struct sorted_equivalent_t
+                        // ==========================
+
+struct sorted_equivalent_t {
+    // Tag type indicating that the input range supplied to a flat container
+    // constructor (or 'insert' method) is sorted by key, but may contain
+    // elements having equivalent keys.
+};
+
+static const sorted_equivalent_t sorted_equivalent = { };
+    // Value of type 'sorted_equivalent_t' used as actual argument to functions
+    // that accept a sorted range of (not necessarily unique) keys.
+
+}  // close namespace bsl
+
+namespace BloombergLP {
+namespace bslstl {
+
+                     // ====================================
+                     // class FlatTreeUtil_AddressComparator
+                     // ====================================
+
+template <class KEY_CONFIG, class COMPARATOR>
+class FlatTreeUtil_AddressComparator {
+    // This component-private class provides a functor ordering the addresses
+    // of elements by the keys of the elements they refer to, and elements
+    // having equivalent keys by their addresses, so that sorting addresses of
+    // elements of a contiguous sequence with this functor is stable.
+
+    // PRIVATE TYPES
+    typedef typename KEY_CONFIG::ValueType ValueType;
+
+    // DATA
+    const COMPARATOR *d_comparator_p;  // key comparator (held, not owned)
+
+  public:
+    // CREATORS
+    explicit FlatTreeUtil_AddressComparator(const COMPARATOR& comparator);
+        // Create a functor that orders element addresses using the specified
+        // 'comparator' to compare the keys of the elements.
+
+    // ACCESSORS
+    bool operator()(const ValueType *lhs, const ValueType *rhs) const;
+        // Return 'true' if the key of the element at the specified 'lhs'
+        // address is ordered before the key of the element at the specified
+        // 'rhs' address, or if the keys are equivalent and 'lhs < rhs', and
+        // 'false' otherwise.
+};
+
+                          // =========================
+                          // class FlatTreeUtil_Guard
+                          // =========================
+
+template <class CONTAINER>
+class FlatTreeUtil_Guard {
+    // This component-private class provides a proctor that, unless released,
+    // truncates a container to the length it had when the proctor was created
+    // (or clears it, if it has since become shorter) on destruction.
+
+    // PRIVATE TYPES
+    typedef typename CONTAINER::size_type size_type;
+
+    // DATA
+    CONTAINER *d_container_p;  // guarded container (held, not owned)
+    size_type  d_length;       // length to truncate to
+
+  private:
+    // NOT IMPLEMENTED
+    FlatTreeUtil_Guard(const FlatTreeUtil_Guard&);
+    FlatTreeUtil_Guard& operator=(const FlatTreeUtil_Guard&);
+
+  public:
+    // CREATORS
+    FlatTreeUtil_Guard(CONTAINER *container, size_type length);
+        // Create a proctor for the specified 'container' that, unless
+        // released, truncates it to the specified 'length' on destruction.
+
+    ~FlatTreeUtil_Guard();
+        // Unless this proctor has been released, erase the elements at and
+        // beyond the length supplied at construction from the guarded
+        // container, or clear the container if it is not longer than that.
+
+    // MANIPULATORS
+    void release();
+        // Release the guarded container from management by this proctor.
+};
+
+                            // ===================
+                            // struct FlatTreeUtil
+                            // ===================
+
+struct FlatTreeUtil {
+    // This 'struct' provides a namespace for utility functions that search,
+    // and maintain the ordering of, containers holding their elements sorted
+    // by key in contiguous storage.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class KEY_CONFIG, class CONTAINER, class COMPARATOR>
+    static void mergeTail(CONTAINER                      *container,
+                          typename CONTAINER::size_type   headLength,
+                          const COMPARATOR&               comparator,
+                          bool                            uniqueKeys);
+        // Order the elements of the specified 'container' by key according to
+        // the specified 'comparator', assuming that its first 'headLength'
+        // elements are already ordered; if the specified 'uniqueKeys' is
+        // 'true', additionally remove every element whose key is equivalent
+        // to that of an element preceding it.  The relative order of elements
+        // having equivalent keys is preserved.  If an exception is thrown,
+        // 'container' is left empty.
+
+  public:
+    // CLASS METHODS
+    template <class KEY_CONFIG,
+              class RANDOM_ITER,
+              class LOOKUP_KEY,
+              class COMPARATOR>
+    static RANDOM_ITER lowerBound(RANDOM_ITER       first,
+                                  RANDOM_ITER       last,
+                                  const LOOKUP_KEY& key,
+                                  const COMPARATOR& comparator);
+        // Return an iterator to the first element in the specified range
+        // '[first .. last)' whose key is not ordered before the specified
+        // 'key' according to the specified 'comparator', or 'last' if there
+        // is no such element.  The behavior is undefined unless the elements
+        // of the range are ordered by key according to 'comparator'.  Note
+        // that the number of key comparisons is exactly
+        // 'ceil(log2(last - first)) + 1' for non-empty ranges.
+
+    template <class KEY_CONFIG,
+              class RANDOM_ITER,
+              class LOOKUP_KEY,
+              class COMPARATOR>
+    static RANDOM_ITER upperBound(RANDOM_ITER       first,
+                                  RANDOM_ITER       last,
+                                  const LOOKUP_KEY& key,
+                                  const COMPARATOR& comparator);
+        // Return an iterator to the first element in the specified range
+        // '[first .. last)' whose key is ordered after the specified 'key'
+        // according to the specified 'comparator', or 'last' if there is no
+        // such element.  The behavior is undefined unless the elements of the
+        // range are ordered by key according to 'comparator'.
+
+    template <class KEY_CONFIG, class FORWARD_ITER, class COMPARATOR>
+    static bool isSorted(FORWARD_ITER      first,
+                         FORWARD_ITER      last,
+                         const COMPARATOR& comparator);
+        // Return 'true' if no element in the specified range
+        // '[first .. last)' has a key ordered, according to the specified
+        // 'comparator', before the key of the element preceding it, and
+        // 'false' otherwise.
+
+    template <class KEY_CONFIG, class FORWARD_ITER, class COMPARATOR>
+    static bool isSortedUnique(FORWARD_ITER      first,
+                               FORWARD_ITER      last,
+                               const COMPARATOR& comparator);
+        // Return 'true' if every element in the specified range
+        // '[first .. last)' has a key ordered, according to the specified
+        // 'comparator', after the key of the element preceding it, and
+        // 'false' otherwise.
+
+    template <class KEY_CONFIG, class CONTAINER, class COMPARATOR>
+    static void mergeTailMulti(CONTAINER                     *container,
+                               typename CONTAINER::size_type  headLength,
+                               const COMPARATOR&              comparator);
+        // Order the elements of the specified 'container' by key according to
+        // the specified 'comparator', given that the specified 'headLength'
+        // leading elements are already so ordered.  Elements having
+        // equivalent keys retain their relative order.  If an exception is
+        // thrown, 'container' is left empty.  The behavior is undefined
+        // unless 'headLength <= container->size()' and the first
+        // 'headLength' elements of 'container' are ordered by key.  Note that
+        // 'CONTAINER' must be a 'bsl::vector' (or provide the same interface)
+        // whose 'value_type' is 'KEY_CONFIG::ValueType'.
+
+    template <class KEY_CONFIG, class CONTAINER, class COMPARATOR>
+    static void mergeTailUnique(CONTAINER                     *container,
+                                typename CONTAINER::size_type  headLength,
+                                const COMPARATOR&              comparator);
+        // Order the elements of the specified 'container' by key according to
+        // the specified 'comparator', given that the specified 'headLength'
+        // leading elements are already so ordered and have unique keys, and
+        // erase every element whose key is equivalent to that of an element
+        // preceding it (in particular, elements of the head are always
+        // retained).  If an exception is thrown, 'container' is left empty.
+        // The behavior is undefined unless 'headLength <= container->size()'
+        // and the first 'headLength' elements of 'container' are strictly
+        // ordered by key.  Note that 'CONTAINER' must be a 'bsl::vector' (or
+        // provide the same interface) whose 'value_type' is
+        // 'KEY_CONFIG::ValueType'.
+
+    template <class KEY_CONFIG,
+              class CONTAINER,
+              class INPUT_ITER,
+              class COMPARATOR>
+    static void insertRangeMulti(CONTAINER         *container,
+                                 INPUT_ITER         first,
+                                 INPUT_ITER         last,
+                                 const COMPARATOR&  comparator);
+        // Insert into the specified 'container', whose elements are ordered
+        // by key according to the specified 'comparator', the elements in the
+        // specified range '[first .. last)', preserving that order.  Inserted
+        // elements are placed after the existing elements having equivalent
+        // keys and retain their relative order.  If an exception is thrown
+        // while appending the elements of the range, 'container' is left
+        // unchanged; if it is thrown while ordering them, 'container' is left
+        // empty.  The behavior is undefined unless the elements of
+        // 'container' are ordered by key.
+
+    template <class KEY_CONFIG,
+              class CONTAINER,
+              class INPUT_ITER,
+              class COMPARATOR>
+    static void insertRangeUnique(CONTAINER         *container,
+                                  INPUT_ITER         first,
+                                  INPUT_ITER         last,
+                                  const COMPARATOR&  comparator);
+        // Insert into the specified 'container', whose elements are strictly
+        // ordered by key according to the specified 'comparator', each
+        // element in the specified range '[first .. last)' whose key is not
+        // equivalent to that of an element already in 'container' or
+        // preceding it in the range, preserving that order.  If an exception
+        // is thrown while appending the elements of the range, 'container' is
+        // left unchanged; if it is thrown while ordering them, 'container' is
+        // left empty.  The behavior is undefined unless the elements of
+        // 'container' are strictly ordered by key.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                     // ------------------------------------
+                     // class FlatTreeUtil_AddressComparator
+                     // ------------------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+FlatTreeUtil_AddressComparator<KEY_CONFIG, COMPARATOR>::
+                  FlatTreeUtil_AddressComparator(const COMPARATOR& comparator)
+: d_comparator_p(&comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR>
+inline
+bool FlatTreeUtil_AddressComparator<KEY_CONFIG, COMPARATOR>::operator()(
+                                                   const ValueType *lhs,
+                                                   const ValueType *rhs) const
+{
+    const COMPARATOR& comparator = *d_comparator_p;
+
+    if (comparator(KEY_CONFIG::extractKey(*lhs),
+                   KEY_CONFIG::extractKey(*rhs))) {
+        return true;                                                  // RETURN
+    }
+    if (comparator(KEY_CONFIG::extractKey(*rhs),
+                   KEY_CONFIG::extractKey(*lhs))) {
+        return false;                                                 // RETURN
+    }
+    return lhs < rhs;
+}
+
+                          // -------------------------
+                          // class FlatTreeUtil_Guard
+                          // -------------------------
+
+// CREATORS
+template <class CONTAINER>
+inline
+FlatTreeUtil_Guard<CONTAINER>::FlatTreeUtil_Guard(CONTAINER *container,
+                                                  size_type  length)
+: d_container_p(container)
+, d_length(length)
+{
+}
+
+template <class CONTAINER>
+inline
+FlatTreeUtil_Guard<CONTAINER>::~FlatTreeUtil_Guard()
+{
+    if (d_container_p) {
+        if (d_length < d_container_p->size()) {
+            d_container_p->erase(d_container_p->begin() + d_length,
+                                 d_container_p->end());
+        }
+        else {
+            d_container_p->clear();
+        }
+    }
+}
+
+// MANIPULATORS
+template <class CONTAINER>
+inline
+void FlatTreeUtil_Guard<CONTAINER>::release()
+{
+    d_container_p = 0;
+}
+
+                            // -------------------
+                            // struct FlatTreeUtil
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class CONTAINER, class COMPARATOR>
+void FlatTreeUtil::mergeTail(CONTAINER                     *container,
+                             typename CONTAINER::size_type  headLength,
+                             const COMPARATOR&              comparator,
+                             bool                           uniqueKeys)
+{
+    typedef typename CONTAINER::value_type             ValueType;
+    typedef typename CONTAINER::size_type              SizeType;
+    typedef typename CONTAINER::allocator_type         AllocatorType;
+    typedef typename bsl::allocator_traits<AllocatorType>::
+                  template rebind_traits<const ValueType *>::allocator_type
+                                                       AddressAllocator;
+    typedef bsl::vector<const ValueType *, AddressAllocator>
+                                                       AddressVector;
+    typedef typename AddressVector::const_iterator     AddressIterator;
+    typedef bslmf::MovableRefUtil                      MoveUtil;
+
+    BSLS_ASSERT_SAFE(container);
+    BSLS_ASSERT_SAFE(headLength <= container->size());
+
+    const SizeType length = container->size();
+
+    // If the tail already follows the head in order, which is always the case
+    // when building from sorted input, there is nothing to do.
+
+    SizeType i = headLength ? headLength : 1;
+    for (; i < length; ++i) {
+        const ValueType& prev = (*container)[i - 1];
+        const ValueType& curr = (*container)[i];
+
+        if (uniqueKeys ? !comparator(KEY_CONFIG::extractKey(prev),
+                                     KEY_CONFIG::extractKey(curr))
+                       :  comparator(KEY_CONFIG::extractKey(curr),
+                                     KEY_CONFIG::extractKey(prev))) {
+            break;
+        }
+    }
+    if (length <= i) {
+        return;                                                       // RETURN
+    }
+
+    FlatTreeUtil_Guard<CONTAINER> guard(container, 0);
+
+    // Stably sort the tail indirectly, so that each element is moved exactly
+    // once, by the merge below.
+
+    AddressVector tail(AddressAllocator(container->get_allocator()));
+    tail.reserve(length - headLength);
+    for (SizeType j = headLength; j < length; ++j) {
+        tail.push_back(bsls::Util::addressOf((*container)[j]));
+    }
+    native_std::sort(
+                 tail.begin(),
+                 tail.end(),
+                 FlatTreeUtil_AddressComparator<KEY_CONFIG, COMPARATOR>(
+                                                                 comparator));
+
+    // Merge the head and the sorted tail, favoring the head (then the earlier
+    // element of the tail) when keys are equivalent.
+
+    CONTAINER result(container->get_allocator());
+    result.reserve(length);
+
+    const ValueType *head    = container->data();
+    const ValueType *headEnd = head + headLength;
+    AddressIterator  next    = tail.begin();
+    AddressIterator  nextEnd = tail.end();
+
+    while (head != headEnd || next != nextEnd) {
+        const ValueType *element;
+        if (next == nextEnd
+         || (head != headEnd && !comparator(KEY_CONFIG::extractKey(**next),
+                                            KEY_CONFIG::extractKey(*head)))) {
+            element = head++;
+        }
+        else {
+            element = *next++;
+        }
+
+        if (uniqueKeys
+         && !result.empty()
+         && !comparator(KEY_CONFIG::extractKey(result.back()),
+                        KEY_CONFIG::extractKey(*element))) {
+            continue;
+        }
+        result.push_back(MoveUtil::move(*const_cast<ValueType *>(element)));
+    }
+
+    container->swap(result);
+    guard.release();
+}
+
+// CLASS METHODS
+template <class KEY_CONFIG,
+          class RANDOM_ITER,
+          class LOOKUP_KEY,
+          class COMPARATOR>
+inline
+RANDOM_ITER FlatTreeUtil::lowerBound(RANDOM_ITER       first,
+                                     RANDOM_ITER       last,
+                                     const LOOKUP_KEY& key,
+                                     const COMPARATOR& comparator)
+{
+    typedef typename bsl::iterator_traits<RANDOM_ITER>::difference_type
+                                                                DifferenceType;
+
+    DifferenceType length = last - first;
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    // Invariant: the result is in '[first .. first + length]'.  The selection
+    // below compiles to a conditional move, so the loop has no branch that
+    // depends on the outcome of a comparison.
+
+    while (1 < length) {
+        const DifferenceType half = length / 2;
+
+        // Prefetch both candidates for the next probe, so that searches of
+        // large ranges overlap consecutive cache misses.
+
+        bsls::PerformanceHint::prefetchForReading(
+                                     bsls::Util::addressOf(first[half / 2]));
+        bsls::PerformanceHint::prefetchForReading(
+                              bsls::Util::addressOf(first[half + half / 2]));
+
+        first   = comparator(KEY_CONFIG::extractKey(first[half]), key)
+                ? first + half
+                : first;
+        length -= half;
+    }
+    return first + comparator(KEY_CONFIG::extractKey(*first), key);
+}
+
+template <class KEY_CONFIG,
+          class RANDOM_ITER,
+          class LOOKUP_KEY,
+          class COMPARATOR>
+inline
+RANDOM_ITER FlatTreeUtil::upperBound(RANDOM_ITER       first,
+                                     RANDOM_ITER       last,
+                                     const LOOKUP_KEY& key,
+                                     const COMPARATOR& comparator)
+{
+    typedef typename bsl::iterator_traits<RANDOM_ITER>::difference_type
+                                                                DifferenceType;
+
+    DifferenceType length = last - first;
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    while (1 < length) {
+        const DifferenceType half = length / 2;
+
+        bsls::PerformanceHint::prefetchForReading(
+                                     bsls::Util::addressOf(first[half / 2]));
+        bsls::PerformanceHint::prefetchForReading(
+                              bsls::Util::addressOf(first[half + half / 2]));
+
+        first   = !comparator(key, KEY_CONFIG::extractKey(first[half]))
+                ? first + half
+                : first;
+        length -= half;
+    }
+    return first + !comparator(key, KEY_CONFIG::extractKey(*first));
+}
+
+template <class KEY_CONFIG, class FORWARD_ITER, class COMPARATOR>
+bool FlatTreeUtil::isSorted(FORWARD_ITER      first,
+                            FORWARD_ITER      last,
+                            const COMPARATOR& comparator)
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    FORWARD_ITER prev = first;
+    while (++first != last) {
+        if (comparator(KEY_CONFIG::extractKey(*first),
+                       KEY_CONFIG::extractKey(*prev))) {
+            return false;                                             // RETURN
+        }
+        prev = first;
+    }
+    return true;
+}
+
+template <class KEY_CONFIG, class FORWARD_ITER, class COMPARATOR>
+bool FlatTreeUtil::isSortedUnique(FORWARD_ITER      first,
+                                  FORWARD_ITER      last,
+                                  const COMPARATOR& comparator)
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    FORWARD_ITER prev = first;
+    while (++first != last) {
+        if (!comparator(KEY_CONFIG::extractKey(*prev),
+                        KEY_CONFIG::extractKey(*first))) {
+            return false;                                             // RETURN
+        }
+        prev = first;
+    }
+    return true;
+}
+
+template <class KEY_CONFIG, class CONTAINER, class COMPARATOR>
+inline
+void FlatTreeUtil::mergeTailMulti(CONTAINER                     *container,
+                                  typename CONTAINER::size_type  headLength,
+                                  const COMPARATOR&              comparator)
+{
+    mergeTail<KEY_CONFIG>(container, headLength, comparator, false);
+}
+
+template <class KEY_CONFIG, class CONTAINER, class COMPARATOR>
+inline
+void FlatTreeUtil::mergeTailUnique(CONTAINER                     *container,
+                                   typename CONTAINER::size_type  headLength,
+                                   const COMPARATOR&              comparator)
+{
+    mergeTail<KEY_CONFIG>(container, headLength, comparator, true);
+}
+
+template <class KEY_CONFIG,
+          class CONTAINER,
+          class INPUT_ITER,
+          class COMPARATOR>
+void FlatTreeUtil::insertRangeMulti(CONTAINER         *container,
+                                    INPUT_ITER         first,
+                                    INPUT_ITER         last,
+                                    const COMPARATOR&  comparator)
+{
+    BSLS_ASSERT_SAFE(container);
+
+    const typename CONTAINER::size_type headLength = container->size();
+
+    FlatTreeUtil_Guard<CONTAINER> guard(container, headLength);
+    container->insert(container->end(), first, last);
+    guard.release();
+
+    mergeTail<KEY_CONFIG>(container, headLength, comparator, false);
+}
+
+template <class KEY_CONFIG,
+          class CONTAINER,
+          class INPUT_ITER,
+          class COMPARATOR>
+void FlatTreeUtil::insertRangeUnique(CONTAINER         *container,
+                                     INPUT_ITER         first,
+                                     INPUT_ITER         last,
+                                     const COMPARATOR&  comparator)
+{
+    BSLS_ASSERT_SAFE(container);
+
+    const typename CONTAINER::size_type headLength = container->size();
+
+    FlatTreeUtil_Guard<CONTAINER> guard(container, headLength);
+    container->insert(container->end(), first, last);
+    guard.release();
+
+    mergeTail<KEY_CONFIG>(container, headLength, comparator, true);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,812 @@
+// bslstl_flattreeutil.t.cpp                                          -*-C++-*-
+#include <bslstl_flattreeutil.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslstl::FlatTreeUtil' is a utility of function templates operating on
+// sorted random-access sequences.  The search functions are tested against
+// the standard algorithms on every position of every sorted sequence of small
+// length, and the merge functions against a reference implementation
+// ('stable_sort' followed, for unique keys, by 'unique') on tables of heads
+// and tails chosen to cover ordered, reverse-ordered, interleaved, and
+// duplicated input.  Elements carry a tag recording their original position,
+// which lets us verify that equivalent elements retain their relative order.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] RANDOM_ITER lowerBound(first, last, key, comparator);
+// [ 2] RANDOM_ITER upperBound(first, last, key, comparator);
+// [ 3] bool isSorted(first, last, comparator);
+// [ 3] bool isSortedUnique(first, last, comparator);
+// [ 4] void mergeTailMulti(container, headLength, comparator);
+// [ 4] void mergeTailUnique(container, headLength, comparator);
+// [ 5] void insertRangeMulti(container, first, last, comparator);
+// [ 5] void insertRangeUnique(container, first, last, comparator);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'lowerBound' vs. 'native_std::lower_bound'
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::FlatTreeUtil Obj;
+
+typedef bslstl::UnorderedSetKeyConfiguration<int>          IntConfig;
+
+typedef bsl::pair<int, int>                                Element;
+    // An element whose 'first' member is its key and whose 'second' member
+    // records its original position, so that stability can be observed.
+
+typedef bslstl::UnorderedMapKeyConfiguration<int, Element> ElementConfig;
+
+typedef bsl::vector<Element>                               ElementVector;
+
+namespace {
+
+bool lessInt(int lhs, int rhs)
+    // Return 'true' if the specified 'lhs' is less than the specified 'rhs',
+    // and 'false' otherwise.
+{
+    return lhs < rhs;
+}
+
+bool lessByKey(const Element& lhs, const Element& rhs)
+    // Return 'true' if the key of the specified 'lhs' is less than that of
+    // the specified 'rhs', and 'false' otherwise.
+{
+    return lhs.first < rhs.first;
+}
+
+bool equalByKey(const Element& lhs, const Element& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have equal keys, and
+    // 'false' otherwise.
+{
+    return lhs.first == rhs.first;
+}
+
+void gg(ElementVector *result, const char *spec, int firstTag)
+    // Append to the specified 'result' one element for each digit in the
+    // specified 'spec', having the value of the digit as its key and a tag
+    // counting up from the specified 'firstTag'.
+{
+    for (int tag = firstTag; *spec; ++spec, ++tag) {
+        result->push_back(Element(*spec - '0', tag));
+    }
+}
+
+void referenceMerge(ElementVector *result,
+                    const char    *head,
+                    const char    *tail,
+                    bool           uniqueKeys)
+    // Load into the specified 'result' the expected outcome of merging the
+    // elements described by the specified 'tail' with those described by the
+    // specified 'head', retaining only the first of elements having
+    // equivalent keys if the specified 'uniqueKeys' is 'true'.
+{
+    result->clear();
+    gg(result, head, 0);
+    gg(result, tail, 100);
+    native_std::stable_sort(result->begin(), result->end(), &lessByKey);
+    if (uniqueKeys) {
+        result->erase(native_std::unique(result->begin(),
+                                         result->end(),
+                                         &equalByKey),
+                      result->end());
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining a Sorted Vector of Unique Keys
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to keep a 'bsl::vector' of integers sorted and free of
+// duplicates, adding values in batches and searching it frequently.
+//
+// First, we define the key configuration (for which the element is the key)
+// and a comparator:
+//..
+        typedef bslstl::UnorderedSetKeyConfiguration<int> KeyConfig;
+        std::less<int>                                    comparator;
+//..
+// Then, we append an unordered batch of values (containing a duplicate) to an
+// empty vector and restore the ordering invariant:
+//..
+        bsl::vector<int> values;
+
+        const int BATCH1[] = { 7, 3, 9, 3, 1 };
+        bslstl::FlatTreeUtil::insertRangeUnique<KeyConfig>(&values,
+                                                           BATCH1,
+                                                           BATCH1 + 5,
+                                                           comparator);
+        ASSERT(4 == values.size());
+        ASSERT(1 == values[0]);
+        ASSERT(3 == values[1]);
+        ASSERT(7 == values[2]);
+        ASSERT(9 == values[3]);
+//..
+// Next, we add a second batch, some of whose values are already present:
+//..
+        const int BATCH2[] = { 8, 1, 2 };
+        bslstl::FlatTreeUtil::insertRangeUnique<KeyConfig>(&values,
+                                                           BATCH2,
+                                                           BATCH2 + 3,
+                                                           comparator);
+        ASSERT(6 == values.size());
+        ASSERT(2 == values[1]);
+        ASSERT(8 == values[4]);
+//..
+// Finally, we search the vector:
+//..
+        bsl::vector<int>::const_iterator it =
+            bslstl::FlatTreeUtil::lowerBound<KeyConfig>(values.begin(),
+                                                        values.end(),
+                                                        5,
+                                                        comparator);
+        ASSERT(7 == *it);
+
+        it = bslstl::FlatTreeUtil::upperBound<KeyConfig>(values.begin(),
+                                                         values.end(),
+                                                         9,
+                                                         comparator);
+        ASSERT(values.end() == it);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'insertRangeMulti' AND 'insertRangeUnique'
+        //
+        // Concerns:
+        //: 1 The elements of the range are inserted in order, with the
+        //:   existing elements winning over equivalent inserted ones for the
+        //:   unique variant, and preceding them for the multi variant.
+        //:
+        //: 2 Memory comes from the container's allocator only.
+        //:
+        //: 3 If an allocation fails, the container is left either unchanged or
+        //:   empty, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 For a table of heads and ranges, insert the range into a
+        //:   container holding the head and compare with a reference result.
+        //:   (C-1)
+        //:
+        //: 2 Use test allocators and an exception test loop.  (C-2..3)
+        //
+        // Testing:
+        //   void insertRangeMulti(container, first, last, comparator);
+        //   void insertRangeUnique(container, first, last, comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insertRangeMulti' AND 'insertRangeUnique'"
+                            "\n==========================================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_head;  // sorted, unique keys
+            const char *d_tail;
+        } DATA[] = {
+            //LINE  HEAD         TAIL
+            //----  ---------    ------------
+            { L_,   "",          ""           },
+            { L_,   "",          "5"          },
+            { L_,   "",          "97531"      },
+            { L_,   "",          "1133557799" },
+            { L_,   "2468",      ""           },
+            { L_,   "2468",      "9"          },
+            { L_,   "2468",      "0"          },
+            { L_,   "2468",      "5"          },
+            { L_,   "2468",      "4"          },
+            { L_,   "2468",      "86420"      },
+            { L_,   "2468",      "13579"      },
+            { L_,   "2468",      "2244668899" },
+            { L_,   "0123456789","9876543210" },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const HEAD = DATA[ti].d_head;
+            const char *const TAIL = DATA[ti].d_tail;
+
+            if (veryVerbose) { T_ P_(LINE) P_(HEAD) P(TAIL) }
+
+            for (int unique = 0; unique < 2; ++unique) {
+                ElementVector expected(&oa);
+                referenceMerge(&expected, HEAD, TAIL, unique);
+
+                ElementVector range(&oa);
+                gg(&range, TAIL, 100);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ElementVector mX(&oa);  const ElementVector& X = mX;
+
+                    const bsls::Types::Int64 AL = oa.allocationLimit();
+                    oa.setAllocationLimit(-1);
+                    gg(&mX, HEAD, 0);
+                    const ElementVector HEAD_ELEMENTS(X, &oa);
+                    oa.setAllocationLimit(AL);
+
+                    try {
+                        if (unique) {
+                            Obj::insertRangeUnique<ElementConfig>(
+                                                                &mX,
+                                                                range.begin(),
+                                                                range.end(),
+                                                                &lessInt);
+                        }
+                        else {
+                            Obj::insertRangeMulti<ElementConfig>(
+                                                                &mX,
+                                                                range.begin(),
+                                                                range.end(),
+                                                                &lessInt);
+                        }
+                    }
+                    catch (...) {
+                        ASSERTV(LINE, unique,
+                                X.empty() || X == HEAD_ELEMENTS);
+                        throw;
+                    }
+                    ASSERTV(LINE, unique, expected == X);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'mergeTailMulti' AND 'mergeTailUnique'
+        //
+        // Concerns:
+        //: 1 The resulting sequence is ordered by key.
+        //:
+        //: 2 Elements having equivalent keys retain their relative order, and
+        //:   elements of the head precede (or, for unique keys, are retained
+        //:   in preference to) equivalent elements of the tail.
+        //:
+        //: 3 An already-ordered tail is merged without allocating memory.
+        //:
+        //: 4 Temporary memory comes from the container's allocator, and is
+        //:   released.
+        //
+        // Plan:
+        //: 1 For a table of heads and tails, build a container holding the
+        //:   head followed by the tail, merge it, and compare the result
+        //:   (including tags) with the reference result.  (C-1..2)
+        //:
+        //: 2 Compare the number of allocations before and after the merge
+        //:   when the reference result equals the input.  (C-3)
+        //:
+        //: 3 Use a test allocator for the container and verify that the
+        //:   default allocator is unused.  (C-4)
+        //
+        // Testing:
+        //   void mergeTailMulti(container, headLength, comparator);
+        //   void mergeTailUnique(container, headLength, comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'mergeTailMulti' AND 'mergeTailUnique'"
+                            "\n======================================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_head;  // sorted, unique keys
+            const char *d_tail;
+        } DATA[] = {
+            //LINE  HEAD         TAIL
+            //----  ---------    ------------
+            { L_,   "",          ""           },
+            { L_,   "",          "1"          },
+            { L_,   "",          "12"         },
+            { L_,   "",          "21"         },
+            { L_,   "",          "11"         },
+            { L_,   "",          "0123456789" },
+            { L_,   "",          "9876543210" },
+            { L_,   "",          "5555555555" },
+            { L_,   "",          "1212121212" },
+            { L_,   "",          "3141592653" },
+            { L_,   "1",         ""           },
+            { L_,   "1",         "1"          },
+            { L_,   "1",         "0"          },
+            { L_,   "1",         "2"          },
+            { L_,   "1357",      "2468"       },
+            { L_,   "1357",      "8642"       },
+            { L_,   "1357",      "7531"       },
+            { L_,   "1357",      "89"         },
+            { L_,   "1357",      "0"          },
+            { L_,   "1357",      "3141592653" },
+            { L_,   "0123456789","0123456789" },
+            { L_,   "0123456789","9999900000" },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const HEAD = DATA[ti].d_head;
+            const char *const TAIL = DATA[ti].d_tail;
+            const int         HEAD_LENGTH = static_cast<int>(strlen(HEAD));
+
+            if (veryVerbose) { T_ P_(LINE) P_(HEAD) P(TAIL) }
+
+            for (int unique = 0; unique < 2; ++unique) {
+                ElementVector expected(&oa);
+                referenceMerge(&expected, HEAD, TAIL, unique);
+
+                ElementVector mX(&oa);  const ElementVector& X = mX;
+                gg(&mX, HEAD, 0);
+                gg(&mX, TAIL, 100);
+
+                const bool                     SAME = expected == X;
+                const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+                if (unique) {
+                    Obj::mergeTailUnique<ElementConfig>(&mX,
+                                                        HEAD_LENGTH,
+                                                        &lessInt);
+                }
+                else {
+                    Obj::mergeTailMulti<ElementConfig>(&mX,
+                                                       HEAD_LENGTH,
+                                                       &lessInt);
+                }
+
+                ASSERTV(LINE, unique, expected == X);
+                if (SAME) {
+                    ASSERTV(LINE, unique, NUM_ALLOCS == oa.numAllocations());
+                }
+                ASSERTV(LINE, unique, X.get_allocator() == &oa);
+            }
+        }
+        ASSERTV(0 == oa.numBlocksInUse());
+        ASSERTV(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'isSorted' AND 'isSortedUnique'
+        //
+        // Concerns:
+        //: 1 'isSorted' accepts non-decreasing sequences, and 'isSortedUnique'
+        //:   accepts only strictly increasing ones.
+        //:
+        //: 2 Empty and single-element sequences are sorted.
+        //
+        // Plan:
+        //: 1 Use the table-driven technique.  (C-1..2)
+        //
+        // Testing:
+        //   bool isSorted(first, last, comparator);
+        //   bool isSortedUnique(first, last, comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'isSorted' AND 'isSortedUnique'"
+                            "\n===============================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_spec;
+            bool        d_sorted;
+            bool        d_sortedUnique;
+        } DATA[] = {
+            //LINE  SPEC      SORTED  UNIQUE
+            //----  -------   ------  ------
+            { L_,   "",       true,   true   },
+            { L_,   "1",      true,   true   },
+            { L_,   "12",     true,   true   },
+            { L_,   "11",     true,   false  },
+            { L_,   "21",     false,  false  },
+            { L_,   "1234",   true,   true   },
+            { L_,   "1224",   true,   false  },
+            { L_,   "1243",   false,  false  },
+            { L_,   "2134",   false,  false  },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const char *const SPEC   = DATA[ti].d_spec;
+            const bool        SORTED = DATA[ti].d_sorted;
+            const bool        UNIQUE = DATA[ti].d_sortedUnique;
+
+            ElementVector mX;  const ElementVector& X = mX;
+            gg(&mX, SPEC, 0);
+
+            ASSERTV(LINE, SORTED == Obj::isSorted<ElementConfig>(X.begin(),
+                                                                 X.end(),
+                                                                 &lessInt));
+            ASSERTV(LINE, UNIQUE == Obj::isSortedUnique<ElementConfig>(
+                                                                X.begin(),
+                                                                X.end(),
+                                                                &lessInt));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'lowerBound' AND 'upperBound'
+        //
+        // Concerns:
+        //: 1 The functions return the same position as the corresponding
+        //:   standard algorithms for every key, including keys less than,
+        //:   greater than, and between the elements of the sequence.
+        //:
+        //: 2 Sequences of every length, including 0 and lengths that are and
+        //:   are not powers of 2, are handled.
+        //:
+        //: 3 Sequences with runs of equivalent keys are handled.
+        //:
+        //: 4 The functions accept a function pointer as comparator.
+        //
+        // Plan:
+        //: 1 For every length 'N' in '[0 .. 33]' and for two spacing patterns
+        //:   (distinct even keys, and keys repeated in pairs), build the
+        //:   sequence and search it for every key in '[-1 .. 2 * N + 1]',
+        //:   comparing the result with 'native_std::lower_bound' and
+        //:   'native_std::upper_bound'.  (C-1..3)
+        //:
+        //: 2 Repeat on 'Element' sequences, using the function 'lessInt' as
+        //:   comparator.  (C-4)
+        //
+        // Testing:
+        //   RANDOM_ITER lowerBound(first, last, key, comparator);
+        //   RANDOM_ITER upperBound(first, last, key, comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'lowerBound' AND 'upperBound'"
+                            "\n=============================\n");
+
+        std::less<int> comparator;
+
+        for (int n = 0; n <= 33; ++n) {
+            for (int pattern = 0; pattern < 2; ++pattern) {
+                bsl::vector<int> values;
+                ElementVector    elements;
+                for (int i = 0; i < n; ++i) {
+                    const int value = pattern ? i / 2 * 2 : 2 * i;
+                    values.push_back(value);
+                    elements.push_back(Element(value, i));
+                }
+
+                for (int key = -1; key <= 2 * n + 1; ++key) {
+                    const int *const B = values.data();
+                    const int *const E = B + n;
+
+                    const int *const EXP_LB =
+                                       native_std::lower_bound(B, E, key);
+                    const int *const EXP_UB =
+                                       native_std::upper_bound(B, E, key);
+
+                    ASSERTV(n, pattern, key,
+                            EXP_LB == Obj::lowerBound<IntConfig>(B,
+                                                                 E,
+                                                                 key,
+                                                                 comparator));
+                    ASSERTV(n, pattern, key,
+                            EXP_UB == Obj::upperBound<IntConfig>(B,
+                                                                 E,
+                                                                 key,
+                                                                 comparator));
+
+                    const ElementVector::const_iterator EB = elements.cbegin();
+                    const ElementVector::const_iterator EE = elements.cend();
+
+                    ASSERTV(n, pattern, key,
+                            EXP_LB - B == Obj::lowerBound<ElementConfig>(
+                                                                   EB,
+                                                                   EE,
+                                                                   key,
+                                                                   &lessInt)
+                                        - EB);
+                    ASSERTV(n, pattern, key,
+                            EXP_UB - B == Obj::upperBound<ElementConfig>(
+                                                                   EB,
+                                                                   EE,
+                                                                   key,
+                                                                   &lessInt)
+                                        - EB);
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform some ad-hoc tests.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        std::less<int>   comparator;
+        bsl::vector<int> mX(&oa);  const bsl::vector<int>& X = mX;
+
+        const int VALUES[] = { 5, 3, 8, 3, 1, 8, 9 };
+        Obj::insertRangeMulti<IntConfig>(&mX, VALUES, VALUES + 7, comparator);
+        ASSERTV(X.size(), 7 == X.size());
+        ASSERT(Obj::isSorted<IntConfig>(X.begin(), X.end(), comparator));
+        ASSERT(!Obj::isSortedUnique<IntConfig>(X.begin(),
+                                               X.end(),
+                                               comparator));
+
+        ASSERT(X.begin() + 1 == Obj::lowerBound<IntConfig>(X.begin(),
+                                                           X.end(),
+                                                           3,
+                                                           comparator));
+        ASSERT(X.begin() + 3 == Obj::upperBound<IntConfig>(X.begin(),
+                                                           X.end(),
+                                                           3,
+                                                           comparator));
+
+        mX.clear();
+        Obj::insertRangeUnique<IntConfig>(&mX, VALUES, VALUES + 7, comparator);
+        ASSERTV(X.size(), 5 == X.size());
+        ASSERT(Obj::isSortedUnique<IntConfig>(X.begin(), X.end(), comparator));
+        ASSERT(X.end() == Obj::lowerBound<IntConfig>(X.begin(),
+                                                     X.end(),
+                                                     10,
+                                                     comparator));
+        ASSERT(X.begin() == Obj::upperBound<IntConfig>(X.begin(),
+                                                       X.end(),
+                                                       0,
+                                                       comparator));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'lowerBound' vs. 'native_std::lower_bound'
+        //
+        // Concerns:
+        //: 1 The branch-free search is faster than the standard (branching)
+        //:   binary search for random lookups.
+        //
+        // Plan:
+        //: 1 For sorted 'int' sequences of increasing size, time a fixed
+        //:   number of random lookups with each algorithm and report the
+        //:   best of several runs.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'lowerBound' vs. 'native_std::lower_bound'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'lowerBound'"
+                            "\n=========================\n");
+
+        const int NUM_LOOKUPS = 1 << 20;
+        const int NUM_RUNS    = 5;
+
+        std::less<int>   comparator;
+        bsl::vector<int> keys(NUM_LOOKUPS);
+
+        for (int size = 16; size <= (1 << 24); size *= 4) {
+            bsl::vector<int> values(size);
+            for (int i = 0; i < size; ++i) {
+                values[i] = 2 * i;
+            }
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                seed    = seed * 1103515245 + 12345;
+                keys[i] = static_cast<int>((seed >> 1) % (2 * size));
+            }
+
+            double stdTime  = 1e9;
+            double utilTime = 1e9;
+            long   stdSum   = 0;
+            long   utilSum  = 0;
+
+            for (int run = 0; run < NUM_RUNS; ++run) {
+                bsls::Stopwatch timer;
+
+                stdSum = 0;
+                timer.start();
+                for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                    stdSum += native_std::lower_bound(values.begin(),
+                                                      values.end(),
+                                                      keys[i])
+                            - values.begin();
+                }
+                timer.stop();
+                stdTime = native_std::min(stdTime, timer.elapsedTime());
+
+                utilSum = 0;
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                    utilSum += Obj::lowerBound<IntConfig>(values.begin(),
+                                                          values.end(),
+                                                          keys[i],
+                                                          comparator)
+                             - values.begin();
+                }
+                timer.stop();
+                utilTime = native_std::min(utilTime, timer.elapsedTime());
+            }
+            ASSERTV(stdSum, utilSum, stdSum == utilSum);
+
+            printf("size: %9d  std::lower_bound: %6.1f ns  "
+                   "lowerBound: %6.1f ns\n",
+                   size,
+                   stdTime  * 1e9 / NUM_LOOKUPS,
+                   utilTime * 1e9 / NUM_LOOKUPS);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
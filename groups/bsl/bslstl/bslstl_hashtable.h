@@ -2921,6 +2921,27 @@ class HashTable {
         // the element following the range).  Also note that this hash-table
         // ensures all elements having the same key form a contiguous sequence.
 
+    template <class RESULT_TYPE, class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR findMany(KEY_ITERATOR    first,
+                             KEY_ITERATOR    last,
+                             OUTPUT_ITERATOR result) const;
+        // Look up each key in the range starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and write to the specified 'result' output iterator, in the order of
+        // the keys, a 'RESULT_TYPE' object constructed from the address of the
+        // link that 'find' would return for that key (a null pointer value if
+        // the key is not found).  Return the position one past the last
+        // element written.  'KEY_ITERATOR' must meet the requirements of a
+        // forward iterator whose 'value_type' is convertible to 'KeyType',
+        // and 'RESULT_TYPE' must be constructible from a
+        // 'bslalg::BidirectionalLink *'.  The behavior is undefined unless
+        // 'first' and 'last' refer to a valid range.  Note that the keys are
+        // processed in small batches: all keys of a batch are hashed and the
+        // memory holding their buckets, and then the first node of each
+        // bucket, is prefetched before any bucket is searched, so that the
+        // cache misses incurred by lookups in a large table overlap rather
+        // than being paid one after another.
+
     bool hasSameValue(const HashTable& other) const;
         // Return 'true' if the specified 'other' has the same value as this
         // object, and 'false' otherwise.  Two 'HashTable' objects have the
@@ -7033,6 +7054,77 @@ HashTable< KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findRange(
            : 0;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class RESULT_TYPE, class KEY_ITERATOR, class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findMany(
+                                            KEY_ITERATOR    first,
+                                            KEY_ITERATOR    last,
+                                            OUTPUT_ITERATOR result) const
+{
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    // The batch size bounds the number of outstanding prefetches, and should
+    // be about the number of cache misses a core can have in flight at once.
+
+    enum { k_BATCH_SIZE = 16 };
+
+    const bslalg::HashTableBucket *buckets[k_BATCH_SIZE];
+
+    while (first != last) {
+        KEY_ITERATOR batchBegin = first;
+        int          batchSize  = 0;
+
+        // Hash each key of the batch, and start loading its bucket.
+
+        while (first != last && batchSize < k_BATCH_SIZE) {
+            const KeyType& key = *first;
+
+            const bslalg::HashTableBucket *bucket =
+                                d_anchor.bucketArrayAddress() +
+                                ImpUtil::computeBucketIndex(
+                                            d_parameters.hashCodeForKey(key),
+                                            d_anchor.bucketArraySize());
+            bsls::PerformanceHint::prefetchForReading(bucket);
+            buckets[batchSize] = bucket;
+
+            ++first;
+            ++batchSize;
+        }
+
+        // By now the earliest buckets have arrived; start loading the first
+        // node of each non-empty bucket.
+
+        for (int i = 0; i < batchSize; ++i) {
+            const bslalg::BidirectionalLink *node = buckets[i]->first();
+            if (node) {
+                bsls::PerformanceHint::prefetchForReading(node);
+            }
+        }
+
+        // Search the buckets, in key order.
+
+        for (int i = 0; i < batchSize; ++i, ++batchBegin) {
+            const KeyType&             key   = *batchBegin;
+            bslalg::BidirectionalLink *found = 0;
+
+            for (bslalg::BidirectionalLink *cursor     = buckets[i]->first(),
+                                           * const end = buckets[i]->end();
+                                  end != cursor; cursor = cursor->nextLink()) {
+                if (d_parameters.comparator()(
+                                    key,
+                                    ImpUtil::extractKey<KEY_CONFIG>(cursor))) {
+                    found = cursor;
+                    break;
+                }
+            }
+            *result = RESULT_TYPE(found);
+            ++result;
+        }
+    }
+    return result;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bool
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasSameValue(
@@ -0,0 +1,32 @@
+// bslstl_inplacefunction.cpp                                         -*-C++-*-
+#include <bslstl_inplacefunction.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace bsl {
+
+                        // ---------------------------
+                        // struct InplaceFunction_Util
+                        // ---------------------------
+
+// CONSTANTS
+const std::size_t InplaceFunction_Util::k_DEFAULT_INPLACE_SIZE;
+
+}  // close namespace bsl
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
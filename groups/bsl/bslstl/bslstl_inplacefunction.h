@@ -0,0 +1,4770 @@
+// bslstl_inplacefunction.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLSTL_INPLACEFUNCTION
+#define INCLUDED_BSLSTL_INPLACEFUNCTION
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide function wrappers having a configurable in-place buffer.
+//
+//@CLASSES:
+//  bsl::inplace_function: copyable function wrapper with in-place buffer
+//  bsl::unique_function: move-only function wrapper with in-place buffer
+//
+//@SEE_ALSO: bslstl_function
+//
+//@DESCRIPTION: This component provides two class templates,
+// 'bsl::inplace_function' and 'bsl::unique_function', that, like
+// 'bsl::function', wrap an arbitrary invocable object (a function pointer or
+// a functor) having a given function prototype, but whose *in-place buffer*
+// -- the storage, within the wrapper itself, in which a small enough invocable
+// object is held without allocating memory -- has a size specified as a
+// template parameter.
+//
+// 'bsl::function' holds an invocable object in place only if it fits in a
+// buffer of six pointers, and otherwise allocates memory for it, both when the
+// 'bsl::function' is created, and whenever it is copied.  Function objects
+// that capture (or bind) more than a few values, which are common as jobs of
+// thread pools and as callbacks, therefore allocate memory every time they
+// are submitted.  Choosing an in-place buffer large enough for the function
+// objects at hand makes creating, moving, and copying the wrappers free of
+// allocation (unless the wrapped object itself allocates).
+//
+// 'bsl::inplace_function<PROTOTYPE, INPLACE_SIZE>' is copyable, and requires
+// the objects it wraps to be copy constructible.  'bsl::unique_function<
+// PROTOTYPE, INPLACE_SIZE>' is move-only, and can therefore wrap objects that
+// are move-only, such as functors owning a 'bslma::ManagedPtr', or that are
+// expensive to copy.  The default in-place buffer of both is
+// 'bsl::InplaceFunction_Util::k_DEFAULT_INPLACE_SIZE' bytes (8 pointers).
+//
+///In-Place Storage
+///----------------
+// An invocable object of type 'FUNC' is held in place if and only if:
+//
+//: o 'sizeof(FUNC) <= INPLACE_SIZE',
+//:
+//: o the alignment of 'FUNC' does not exceed the maximal alignment of the
+//:   platform, and
+//:
+//: o 'FUNC' is bitwise movable or is nothrow move constructible (see
+//:   'bsl::is_nothrow_move_constructible'), so that a wrapper can be moved and
+//:   swapped without throwing.  'bsl::function', 'bsl::inplace_function', and
+//:   'bsl::unique_function' are treated as nothrow move constructible.  Note
+//:   that, on C++03 platforms, this is known only for types that are bitwise
+//:   movable or declare either trait.
+//
+// Otherwise the object is allocated from the allocator of the wrapper, in
+// which case creating and copying the wrapper allocates memory, but moving a
+// wrapper into one having the same allocator does not.  The 'is_inplace'
+// accessor reports which representation a wrapper uses.  A wrapper occupies
+// its in-place buffer and three pointers, rounded up to the maximal alignment
+// of the platform.
+//
+///Differences from 'bsl::function'
+///--------------------------------
+// Both class templates provide the interface of 'bsl::function', with the
+// following differences:
+//
+//: o Only 'bslma::Allocator *' allocators are supported (the allocators of
+//:   other types accepted by 'bsl::function' are not).
+//:
+//: o Pointers to member functions cannot be wrapped directly; they can be
+//:   wrapped in a functor (such as 'bdlf::MemFn') or in a 'bsl::function'.
+//:
+//: o The legacy conversion to 'bdef_Function' is not provided.
+//
+// A 'bsl::function' can be wrapped by either class template and, conversely,
+// either can be wrapped by a 'bsl::function'.  A null function pointer, or an
+// empty 'bsl::function', 'bsl::inplace_function' or 'bsl::unique_function',
+// produces an empty wrapper.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocation-Free Callbacks
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that we submit callbacks that capture a price update, consisting of
+// a security identifier, a venue, and two prices, to a dispatcher.  The
+// update is 48 bytes on 64-bit platforms, and does not fit in the in-place
+// buffer of 'bsl::function' together with a pointer to the handler.
+//
+// First, we define the update, and a functor processing it:
+//..
+//  struct PriceUpdate {
+//      // This 'struct' describes a change of price.
+//
+//      char   d_security[16];
+//      char   d_venue[8];
+//      double d_bid;
+//      double d_ask;
+//      int    d_sequence;
+//  };
+//
+//  class UpdateHandler {
+//      // This class keeps the sum of the bid prices it has seen.
+//
+//      // DATA
+//      double d_sum;
+//
+//    public:
+//      // CREATORS
+//      UpdateHandler() : d_sum(0) {}
+//
+//      // MANIPULATORS
+//      void onUpdate(const PriceUpdate& update) { d_sum += update.d_bid; }
+//
+//      // ACCESSORS
+//      double sum() const { return d_sum; }
+//  };
+//
+//  struct ProcessUpdate {
+//      // This functor applies an update to a handler.
+//
+//      UpdateHandler *d_handler_p;
+//      PriceUpdate    d_update;
+//
+//      BSLMF_NESTED_TRAIT_DECLARATION(ProcessUpdate,
+//                                     bslmf::IsBitwiseMoveable);
+//
+//      void operator()() const { d_handler_p->onUpdate(d_update); }
+//  };
+//..
+// Then, we define the type of the callbacks, having an in-place buffer large
+// enough for 'ProcessUpdate':
+//..
+//  typedef bsl::inplace_function<void(), 64> Callback;
+//..
+// Next, we create a callback with a test allocator, and observe that it did
+// not allocate:
+//..
+//  bslma::TestAllocator ta;
+//  UpdateHandler        handler;
+//
+//  PriceUpdate   update  = { "IBM US", "XNYS", 130.5, 130.75, 1 };
+//  ProcessUpdate process = { &handler, update };
+//
+//  Callback callback(bsl::allocator_arg, &ta, process);
+//  assert(callback.is_inplace());
+//  assert(0 == ta.numBlocksTotal());
+//..
+// Then, we copy the callback, for example into a queue of pending callbacks,
+// and invoke the copy.  No memory is allocated either:
+//..
+//  bsl::vector<Callback> pending(&ta);
+//  pending.reserve(4);
+//  const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+//
+//  pending.push_back(callback);
+//  pending.back()();
+//  assert(numBlocks == ta.numBlocksTotal());
+//  assert(130.5     == handler.sum());
+//..
+// Finally, we observe that a 'bsl::function' holding the same functor
+// allocates memory:
+//..
+//  bsl::function<void()> function(bsl::allocator_arg, &ta, process);
+//  assert(numBlocks < ta.numBlocksTotal());
+//..
+//
+///Example 2: A Move-Only Callback
+///- - - - - - - - - - - - - - - -
+// Suppose that a callback must own a resource, held by a
+// 'bslma::ManagedPtr', that is released when the callback is destroyed.
+// Since 'bslma::ManagedPtr' cannot be copied, the callback cannot be wrapped
+// by a 'bsl::function' or a 'bsl::inplace_function', but it can be wrapped by
+// a 'bsl::unique_function'.
+//
+// First, we define the callback:
+//..
+//  struct ConsumeBuffer {
+//      // This functor returns the length of the buffer it owns.
+//
+//      bslma::ManagedPtr<bsl::string> d_buffer;
+//
+//      explicit ConsumeBuffer(bslma::ManagedPtr<bsl::string>& buffer)
+//      : d_buffer(bslmf::MovableRefUtil::move(buffer))
+//      {
+//      }
+//
+//      ConsumeBuffer(bslmf::MovableRef<ConsumeBuffer> original)
+//      : d_buffer(bslmf::MovableRefUtil::move(
+//                   bslmf::MovableRefUtil::access(original).d_buffer))
+//      {
+//      }
+//
+//      int operator()() const
+//      {
+//          return static_cast<int>(d_buffer->size());
+//      }
+//  };
+//..
+// Then, we wrap a 'ConsumeBuffer' object in a 'bsl::unique_function':
+//..
+//  bslma::ManagedPtr<bsl::string> buffer(new (ta) bsl::string("payload", &ta),
+//                                        &ta);
+//  ConsumeBuffer                  consumer(buffer);
+//
+//  bsl::unique_function<int()> consume(
+//                                    bsl::allocator_arg,
+//                                    &ta,
+//                                    bslmf::MovableRefUtil::move(consumer));
+//  assert(7 == consume());
+//..
+// Now, we transfer the callback to another 'bsl::unique_function', leaving
+// the original empty:
+//..
+//  bsl::unique_function<int()> next(
+//                                     bslmf::MovableRefUtil::move(consume));
+//  assert(!consume);
+//  assert(7 == next());
+//..
+// Finally, we observe that destroying the callback releases the buffer:
+//..
+//  const bsls::Types::Int64 numBlocksInUse = ta.numBlocksInUse();
+//  next = bsl::nullptr_t();
+//  assert(numBlocksInUse > ta.numBlocksInUse());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_function.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_allocatorargt.h>
+#include <bslmf_assert.h>
+#include <bslmf_forwardingtype.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isnothrowmoveconstructible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_usesallocatorargt.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_keyword.h>
+#include <bsls_nullptr.h>
+#include <bsls_unspecifiedbool.h>
+
+#include <cstddef>
+#include <cstring>
+#include <typeinfo>
+
+namespace bsl {
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+class inplace_function;
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+class unique_function;
+
+                        // ===========================
+                        // struct InplaceFunction_Util
+                        // ===========================
+
+struct InplaceFunction_Util {
+    // This component-private 'struct' provides a namespace for the types,
+    // constants, and utility functions shared by the implementations of
+    // 'inplace_function' and 'unique_function'.
+
+    // TYPES
+    enum Operation {
+        // Enumerate the operations performed by a manager function (see
+        // 'Manager') on the target held by a function wrapper.  In the
+        // following, 'dst' and 'src' are the buffers of function wrappers,
+        // and 'allocator' is the allocator of the wrapper owning 'dst'.
+
+        e_MOVE,            // relocate the target in 'src' to 'dst' (same
+                           // allocator); 'src' is left holding no object; does
+                           // not throw
+
+        e_MOVE_CONSTRUCT,  // move-construct a target in 'dst', using
+                           // 'allocator', from the target in 'src', which is
+                           // left valid
+
+        e_COPY,            // copy-construct a target in 'dst', using
+                           // 'allocator', from the target in 'src'
+
+        e_DESTROY,         // destroy the target in 'dst', releasing any memory
+                           // held for it to 'allocator'
+
+        e_GET_TARGET,      // return the address of the target in 'dst'
+
+        e_GET_TYPE_INFO    // return the address of the 'std::type_info' of
+                           // the type of the target
+    };
+
+    typedef const void *Manager(Operation                      operation,
+                                void                          *dst,
+                                void                          *src,
+                                BloombergLP::bslma::Allocator *allocator);
+        // A function of this type performs the specified 'operation' on the
+        // target held in the specified 'dst' buffer, or constructs one there
+        // from the target in the specified 'src' buffer, using the specified
+        // 'allocator', and returns the address of the target or
+        // 'std::type_info' for the operations that produce one, and 0
+        // otherwise.
+
+    typedef void (*GenericInvoker)();
+        // 'GenericInvoker' is the type in which the address of a function
+        // invoking a target is stored, independently of the prototype of the
+        // function wrapper.
+
+    // CONSTANTS
+    static const std::size_t k_DEFAULT_INPLACE_SIZE = 8 * sizeof(void *);
+        // default size, in bytes, of the in-place buffer of a function
+        // wrapper
+
+    // CLASS METHODS
+    template <class FUNC>
+    static bool isNull(const FUNC&);
+    template <class FUNC>
+    static bool isNull(FUNC *function);
+    template <class PROTOTYPE>
+    static bool isNull(const bsl::function<PROTOTYPE>& function);
+    template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+    static bool isNull(
+               const bsl::inplace_function<PROTOTYPE, INPLACE_SIZE>& function);
+    template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+    static bool isNull(
+                const bsl::unique_function<PROTOTYPE, INPLACE_SIZE>& function);
+        // Return 'true' if the specified 'function' is a null pointer or an
+        // empty function wrapper, and 'false' otherwise.  Note that a function
+        // wrapper constructed from a null 'function' is empty.
+};
+
+                    // ====================================
+                    // struct InplaceFunction_IsNothrowMove
+                    // ====================================
+
+template <class FUNC>
+struct InplaceFunction_IsNothrowMove
+: integral_constant<bool,
+                    BloombergLP::bslmf::IsBitwiseMoveable<FUNC>::value
+                 || is_nothrow_move_constructible<FUNC>::value> {
+    // This component-private metafunction determines whether relocating an
+    // object of (template parameter) type 'FUNC' cannot throw, which is
+    // required for 'FUNC' to be held in an in-place buffer.
+};
+
+template <class PROTOTYPE>
+struct InplaceFunction_IsNothrowMove<bsl::function<PROTOTYPE> >
+: true_type {
+    // 'bsl::function' does not declare its move constructor 'noexcept', but
+    // moving it never throws, since it holds in place only targets that are
+    // nothrow move constructible.
+};
+
+                      // ================================
+                      // struct InplaceFunction_IsInplace
+                      // ================================
+
+template <class FUNC, std::size_t INPLACE_SIZE>
+struct InplaceFunction_IsInplace
+: integral_constant<bool,
+                    sizeof(FUNC) <= INPLACE_SIZE
+                 && static_cast<int>(
+                          BloombergLP::bsls::AlignmentFromType<FUNC>::VALUE) <=
+                    static_cast<int>(
+                         BloombergLP::bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT)
+                 && InplaceFunction_IsNothrowMove<FUNC>::value> {
+    // This component-private metafunction determines whether an object of
+    // (template parameter) type 'FUNC' is held in the in-place buffer of a
+    // function wrapper whose buffer is (template parameter) 'INPLACE_SIZE'
+    // bytes, or is allocated.
+};
+
+                       // ==============================
+                       // struct InplaceFunction_Storage
+                       // ==============================
+
+template <class FUNC, bool INPLACE>
+struct InplaceFunction_Storage {
+    // This component-private 'struct' provides a namespace for the functions
+    // that create, access, relocate, and destroy a target of (template
+    // parameter) type 'FUNC' held in the in-place buffer of a function
+    // wrapper.  The partial specialization for a 'false' (template parameter)
+    // 'INPLACE' handles targets that are allocated, whose address is held in
+    // the buffer.
+
+    // CLASS METHODS
+    static FUNC *target(void *buffer);
+        // Return the address of the target held in the specified 'buffer'.
+
+    static void construct(void                          *buffer,
+                          BloombergLP::bslma::Allocator *allocator,
+                          const FUNC&                    source);
+    static void construct(void                          *buffer,
+                          BloombergLP::bslma::Allocator *allocator,
+                          BloombergLP::bslmf::MovableRef<FUNC>
+                                                         source);
+        // Create in the specified 'buffer' a target of type 'FUNC' that is
+        // copied or moved from the specified 'source', supplying the
+        // specified 'allocator' to the target if 'FUNC' uses 'bslma'
+        // allocators.  If an exception is thrown, 'buffer' is left holding no
+        // target.
+
+    static void relocate(void                          *dst,
+                         void                          *src,
+                         BloombergLP::bslma::Allocator *allocator);
+        // Relocate the target held in the specified 'src' buffer to the
+        // specified 'dst' buffer, both belonging to wrappers having the
+        // specified 'allocator', leaving 'src' holding no target.
+
+    static void destroy(void                          *buffer,
+                        BloombergLP::bslma::Allocator *allocator);
+        // Destroy the target held in the specified 'buffer', which was created
+        // with the specified 'allocator'.
+};
+
+template <class FUNC>
+struct InplaceFunction_Storage<FUNC, false> {
+    // This partial specialization of 'InplaceFunction_Storage' handles
+    // targets that are allocated.
+
+    // CLASS METHODS
+    static FUNC *target(void *buffer);
+    static void construct(void                          *buffer,
+                          BloombergLP::bslma::Allocator *allocator,
+                          const FUNC&                    source);
+    static void construct(void                          *buffer,
+                          BloombergLP::bslma::Allocator *allocator,
+                          BloombergLP::bslmf::MovableRef<FUNC>
+                                                         source);
+    static void relocate(void                          *dst,
+                         void                          *src,
+                         BloombergLP::bslma::Allocator *allocator);
+    static void destroy(void                          *buffer,
+                        BloombergLP::bslma::Allocator *allocator);
+};
+
+                       // ==============================
+                       // struct InplaceFunction_Manager
+                       // ==============================
+
+template <class FUNC, bool INPLACE, bool COPYABLE>
+struct InplaceFunction_Manager {
+    // This component-private 'struct' provides the manager function (see
+    // 'InplaceFunction_Util::Manager') for targets of (template parameter)
+    // type 'FUNC', held in place or allocated as indicated by (template
+    // parameter) 'INPLACE', of a function wrapper that is copyable if
+    // (template parameter) 'COPYABLE' is 'true'.
+
+    // PRIVATE TYPES
+    typedef InplaceFunction_Storage<FUNC, INPLACE> Storage;
+
+    // PRIVATE CLASS METHODS
+    static void copy(void                          *dst,
+                     void                          *src,
+                     BloombergLP::bslma::Allocator *allocator,
+                     true_type);
+    static void copy(void                          *dst,
+                     void                          *src,
+                     BloombergLP::bslma::Allocator *allocator,
+                     false_type);
+        // Copy-construct in the specified 'dst' buffer, using the specified
+        // 'allocator', the target held in the specified 'src' buffer.  The
+        // second overload is never called, and ensures that a copy
+        // constructor is not required for the targets of 'unique_function'.
+
+    // CLASS METHODS
+    static const void *manage(InplaceFunction_Util::Operation  operation,
+                              void                            *dst,
+                              void                            *src,
+                              BloombergLP::bslma::Allocator   *allocator);
+        // Perform the specified 'operation' on the specified 'dst' and 'src'
+        // buffers using the specified 'allocator'.  See
+        // 'InplaceFunction_Util::Operation'.
+};
+
+                         // =========================
+                         // class InplaceFunction_Rep
+                         // =========================
+
+template <std::size_t INPLACE_SIZE>
+class InplaceFunction_Rep {
+    // This component-private class template holds the target of a function
+    // wrapper having an in-place buffer of (template parameter) 'INPLACE_SIZE'
+    // bytes, and implements the operations of the wrapper that do not depend
+    // on its prototype.
+
+    // PRIVATE TYPES
+    typedef InplaceFunction_Util::Manager        Manager;
+    typedef InplaceFunction_Util::GenericInvoker GenericInvoker;
+    typedef BloombergLP::bsls::UnspecifiedBool<InplaceFunction_Rep>
+                                                 UnspecifiedBoolUtil;
+    typedef typename UnspecifiedBoolUtil::BoolType
+                                                 UnspecifiedBool;
+
+    BSLMF_ASSERT(INPLACE_SIZE >= sizeof(void *));
+
+    // DATA
+    mutable BloombergLP::bsls::AlignedBuffer<static_cast<int>(INPLACE_SIZE)>
+                                   d_buffer;       // target, or its address
+                                                   // if allocated
+
+    Manager                       *d_manager_p;    // manager of the target,
+                                                   // or 0 if empty
+
+    GenericInvoker                 d_invoker_p;    // invoker of the target,
+                                                   // or 0 if empty
+
+    BloombergLP::bslma::Allocator *d_allocator_p;  // allocator (held, not
+                                                   // owned)
+
+    // NOT IMPLEMENTED
+    InplaceFunction_Rep(const InplaceFunction_Rep&) BSLS_KEYWORD_DELETED;
+    InplaceFunction_Rep& operator=(
+                              const InplaceFunction_Rep&) BSLS_KEYWORD_DELETED;
+
+#if !defined(BSLS_COMPILERFEATURES_SUPPORT_OPERATOR_EXPLICIT)
+    // Function wrappers are not equality comparable, and must not be made so
+    // by their implicit conversion to 'UnspecifiedBool'.
+    bool operator==(const InplaceFunction_Rep&) const;  // Declared but not
+    bool operator!=(const InplaceFunction_Rep&) const;  // defined
+#endif
+
+  protected:
+    // PROTECTED CREATORS
+    explicit InplaceFunction_Rep(
+                       BloombergLP::bslma::Allocator *basicAllocator)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Create an empty object that uses the specified 'basicAllocator' to
+        // supply memory.  The behavior is undefined unless 'basicAllocator'
+        // is not 0.
+
+    ~InplaceFunction_Rep();
+        // Destroy this object.
+
+    // PROTECTED MANIPULATORS
+    template <bool COPYABLE, class FUNC>
+    void emplace(FUNC& func, GenericInvoker invoker);
+        // Move the specified 'func' into this object, as its target, to be
+        // invoked by the specified 'invoker', unless 'func' is null (see
+        // 'InplaceFunction_Util::isNull') in which case this object is left
+        // empty.  The (template parameter) 'COPYABLE' indicates whether this
+        // object can be copied.  The behavior is undefined unless this object
+        // is empty.
+
+    void copyFrom(const InplaceFunction_Rep& original);
+        // Make this object hold a copy, created with the allocator of this
+        // object, of the target of the specified 'original' object.  The
+        // behavior is undefined unless this object is empty, and 'original'
+        // is a copyable wrapper.
+
+    void moveFrom(InplaceFunction_Rep& original) BSLS_KEYWORD_NOEXCEPT;
+        // Make this object hold the target of the specified 'original'
+        // object, leaving 'original' empty.  The behavior is undefined unless
+        // this object is empty and uses the same allocator as 'original'.
+
+    void moveConstructFrom(InplaceFunction_Rep& original);
+        // Make this object hold the target of the specified 'original' object,
+        // relocating it if both objects use the same allocator, and otherwise
+        // move-constructing it with the allocator of this object, and leave
+        // 'original' empty.  The behavior is undefined unless this object is
+        // empty.
+
+    void reset() BSLS_KEYWORD_NOEXCEPT;
+        // Destroy the target of this object, if any, leaving it empty.
+
+    void swapRep(InplaceFunction_Rep& other) BSLS_KEYWORD_NOEXCEPT;
+        // Exchange the targets of this object and the specified 'other'
+        // object.  The behavior is undefined unless both objects use the same
+        // allocator.
+
+    // PROTECTED ACCESSORS
+    void *buffer() const;
+        // Return the address of the in-place buffer of this object.
+
+    GenericInvoker genericInvoker() const;
+        // Return the invoker of the target of this object, or 0 if this
+        // object is empty.
+
+  public:
+    // ACCESSORS
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_OPERATOR_EXPLICIT
+    explicit
+    operator bool() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this object holds a target, and 'false' otherwise.
+#else
+    operator UnspecifiedBool() const BSLS_KEYWORD_NOEXCEPT
+        // Return a value convertible to 'true' if this object holds a target,
+        // and a value convertible to 'false' otherwise.  Note that this
+        // conversion operator is defined in the class body in order to work
+        // around limitations of some compilers.
+    {
+        return UnspecifiedBoolUtil::makeValue(0 != d_manager_p);
+    }
+#endif
+
+    BloombergLP::bslma::Allocator *allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the allocator used by this object to supply memory.
+
+    bool is_inplace() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this object is empty or holds its target in its
+        // in-place buffer, and 'false' if the target is allocated.
+
+    template <class TYPE>
+    TYPE *target() BSLS_KEYWORD_NOEXCEPT;
+    template <class TYPE>
+    const TYPE *target() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the target of this object if it is of the
+        // (template parameter) 'TYPE', and 0 otherwise.
+
+    const std::type_info& target_type() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'typeid(void)' if this object is empty, and the
+        // 'std::type_info' of the type of its target otherwise.
+};
+
+                         // =========================
+                         // class InplaceFunction_Imp
+                         // =========================
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+class InplaceFunction_Imp;
+    // This component-private class template provides the invocation of the
+    // target of a function wrapper having the (template parameter) 'PROTOTYPE'
+    // and an in-place buffer of (template parameter) 'INPLACE_SIZE' bytes.
+    // Only the partial specialization for function prototypes is defined.
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES // $var-args=13
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+class InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+    // This partial specialization of 'InplaceFunction_Imp' invokes the target
+    // of a function wrapper having the prototype 'RET(ARGS...)'.
+
+    // PRIVATE TYPES
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+              typename BloombergLP::bslmf::ForwardingType<ARGS>::Type... args);
+        // A function of this type invokes the target held in the specified
+        // 'buffer' with the specified 'args'.
+
+    // PRIVATE CLASS METHODS
+    template <class FUNC>
+    static RET invoke(void *buffer,
+              typename BloombergLP::bslmf::ForwardingType<ARGS>::Type... args);
+        // Invoke the target of (template parameter) type 'FUNC' held in the
+        // specified 'buffer' with the specified 'args', and return the
+        // result, converted to 'RET'.
+
+  protected:
+    // PROTECTED CLASS METHODS
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+        // Return the address of the function invoking a target of (template
+        // parameter) type 'FUNC', converted to the generic invoker type.
+
+    // PROTECTED CREATORS
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+        // Create an empty object that uses the specified 'basicAllocator' to
+        // supply memory.
+
+  public:
+    // TYPES
+    typedef RET result_type;
+
+    // ACCESSORS
+    RET operator()(ARGS... args) const;
+        // Invoke the target of this object with the specified 'args', and
+        // return the result.  If this object is empty, throw
+        // 'bsl::bad_function_call' if exceptions are enabled, and otherwise
+        // the behavior is undefined.
+};
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl bslstl_inplacefunction.h
+#ifndef BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT
+#define BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT 13
+#endif
+#ifndef BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A
+#define BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A                               \
+        BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT
+#endif
+
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 0
+template <std::size_t INPLACE_SIZE, class RET>
+class InplaceFunction_Imp<RET(), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer);
+
+    template <class FUNC>
+    static RET invoke(void *buffer);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()() const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 0
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 1
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01>
+class InplaceFunction_Imp<RET(ARGS_01), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 1
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 2
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 2
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 3
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 3
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 4
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 4
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 5
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04,
+                              ARGS_05), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04,
+                   ARGS_05 args_05) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 5
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 6
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04,
+                              ARGS_05,
+                              ARGS_06), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04,
+                   ARGS_05 args_05,
+                   ARGS_06 args_06) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 6
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 7
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04,
+                              ARGS_05,
+                              ARGS_06,
+                              ARGS_07), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04,
+                   ARGS_05 args_05,
+                   ARGS_06 args_06,
+                   ARGS_07 args_07) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 7
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 8
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04,
+                              ARGS_05,
+                              ARGS_06,
+                              ARGS_07,
+                              ARGS_08), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04,
+                   ARGS_05 args_05,
+                   ARGS_06 args_06,
+                   ARGS_07 args_07,
+                   ARGS_08 args_08) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 8
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 9
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04,
+                              ARGS_05,
+                              ARGS_06,
+                              ARGS_07,
+                              ARGS_08,
+                              ARGS_09), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04,
+                   ARGS_05 args_05,
+                   ARGS_06 args_06,
+                   ARGS_07 args_07,
+                   ARGS_08 args_08,
+                   ARGS_09 args_09) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 9
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 10
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04,
+                              ARGS_05,
+                              ARGS_06,
+                              ARGS_07,
+                              ARGS_08,
+                              ARGS_09,
+                              ARGS_10), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04,
+                   ARGS_05 args_05,
+                   ARGS_06 args_06,
+                   ARGS_07 args_07,
+                   ARGS_08 args_08,
+                   ARGS_09 args_09,
+                   ARGS_10 args_10) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 10
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 11
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04,
+                              ARGS_05,
+                              ARGS_06,
+                              ARGS_07,
+                              ARGS_08,
+                              ARGS_09,
+                              ARGS_10,
+                              ARGS_11), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_11>::Type args_11);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_11>::Type args_11);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04,
+                   ARGS_05 args_05,
+                   ARGS_06 args_06,
+                   ARGS_07 args_07,
+                   ARGS_08 args_08,
+                   ARGS_09 args_09,
+                   ARGS_10 args_10,
+                   ARGS_11 args_11) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 11
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 12
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04,
+                              ARGS_05,
+                              ARGS_06,
+                              ARGS_07,
+                              ARGS_08,
+                              ARGS_09,
+                              ARGS_10,
+                              ARGS_11,
+                              ARGS_12), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_11>::Type args_11,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_12>::Type args_12);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_11>::Type args_11,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_12>::Type args_12);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04,
+                   ARGS_05 args_05,
+                   ARGS_06 args_06,
+                   ARGS_07 args_07,
+                   ARGS_08 args_08,
+                   ARGS_09 args_09,
+                   ARGS_10 args_10,
+                   ARGS_11 args_11,
+                   ARGS_12 args_12) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 12
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 13
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12,
+                                               class ARGS_13>
+class InplaceFunction_Imp<RET(ARGS_01,
+                              ARGS_02,
+                              ARGS_03,
+                              ARGS_04,
+                              ARGS_05,
+                              ARGS_06,
+                              ARGS_07,
+                              ARGS_08,
+                              ARGS_09,
+                              ARGS_10,
+                              ARGS_11,
+                              ARGS_12,
+                              ARGS_13), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_11>::Type args_11,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_12>::Type args_12,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_13>::Type args_13);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_11>::Type args_11,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_12>::Type args_12,
+           typename BloombergLP::bslmf::ForwardingType<ARGS_13>::Type args_13);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS_01 args_01,
+                   ARGS_02 args_02,
+                   ARGS_03 args_03,
+                   ARGS_04 args_04,
+                   ARGS_05 args_05,
+                   ARGS_06 args_06,
+                   ARGS_07 args_07,
+                   ARGS_08 args_08,
+                   ARGS_09 args_09,
+                   ARGS_10 args_10,
+                   ARGS_11 args_11,
+                   ARGS_12 args_12,
+                   ARGS_13 args_13) const;
+};
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_A >= 13
+
+#else
+// The generated code below is a workaround for the absence of perfect
+// forwarding in some compilers.
+
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+class InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>
+: public InplaceFunction_Rep<INPLACE_SIZE> {
+
+    typedef InplaceFunction_Rep<INPLACE_SIZE> Rep;
+
+    typedef RET Invoker(void *buffer,
+              typename BloombergLP::bslmf::ForwardingType<ARGS>::Type... args);
+
+    template <class FUNC>
+    static RET invoke(void *buffer,
+              typename BloombergLP::bslmf::ForwardingType<ARGS>::Type... args);
+
+  protected:
+    template <class FUNC>
+    static InplaceFunction_Util::GenericInvoker invoker();
+
+    explicit InplaceFunction_Imp(
+                               BloombergLP::bslma::Allocator *basicAllocator);
+
+  public:
+    typedef RET result_type;
+
+    RET operator()(ARGS... args) const;
+};
+
+// }}} END GENERATED CODE
+#endif
+
+                           // ======================
+                           // class inplace_function
+                           // ======================
+
+template <class PROTOTYPE,
+          std::size_t INPLACE_SIZE =
+                                  InplaceFunction_Util::k_DEFAULT_INPLACE_SIZE>
+class inplace_function : public InplaceFunction_Imp<PROTOTYPE, INPLACE_SIZE> {
+    // This class template provides a copyable, allocator-aware, wrapper of
+    // an invocable object (its *target*) having the (template parameter)
+    // 'PROTOTYPE', that holds targets of up to (template parameter)
+    // 'INPLACE_SIZE' bytes in place (see {In-Place Storage}).
+
+    // PRIVATE TYPES
+    typedef InplaceFunction_Imp<PROTOTYPE, INPLACE_SIZE> Base;
+    typedef BloombergLP::bslmf::MovableRefUtil           MoveUtil;
+
+    // PRIVATE MANIPULATORS
+    template <class FUNC>
+    void init(FUNC& func);
+        // Move the specified 'func' into this object, as its target, unless
+        // 'func' is null.  The behavior is undefined unless this object is
+        // empty.
+
+  public:
+    // CREATORS
+    inplace_function() BSLS_KEYWORD_NOEXCEPT;
+    inplace_function(nullptr_t) BSLS_KEYWORD_NOEXCEPT;              // IMPLICIT
+    inplace_function(allocator_arg_t,
+                     BloombergLP::bslma::Allocator *basicAllocator)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+    inplace_function(allocator_arg_t,
+                     BloombergLP::bslma::Allocator *basicAllocator,
+                     nullptr_t)                          BSLS_KEYWORD_NOEXCEPT;
+        // Create an empty function wrapper.  Optionally specify, preceded by
+        // 'bsl::allocator_arg', a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class FUNC>
+    inplace_function(FUNC func)                                     // IMPLICIT
+    : Base(BloombergLP::bslma::Default::defaultAllocator())
+    {
+        // Create a function wrapper whose target is the specified 'func'
+        // (moved into this object), or an empty wrapper if 'func' is a null
+        // pointer or an empty function wrapper, using the currently
+        // installed default allocator to supply memory if 'func' is not held
+        // in place.  'FUNC' must be copy constructible and invocable with the
+        // prototype of this wrapper.  Note that this constructor is defined
+        // in the class body to work around limitations of some compilers.
+
+        init(func);
+    }
+
+    template <class FUNC>
+    inplace_function(allocator_arg_t,
+                     BloombergLP::bslma::Allocator *basicAllocator,
+                     FUNC                           func)
+    : Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+    {
+        // Create a function wrapper whose target is the specified 'func'
+        // (moved into this object), or an empty wrapper if 'func' is a null
+        // pointer or an empty function wrapper, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  'FUNC' must be copy
+        // constructible and invocable with the prototype of this wrapper.
+
+        init(func);
+    }
+
+#if !defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    template <class FUNC>
+    inplace_function(BloombergLP::bslmf::MovableRef<FUNC> func)     // IMPLICIT
+    : Base(BloombergLP::bslma::Default::defaultAllocator())
+    {
+        // Create a function wrapper whose target is moved from the specified
+        // 'func', using the currently installed default allocator to supply
+        // memory if 'func' is not held in place.  Note that this overload
+        // is needed only on platforms without rvalue references.
+
+        init(MoveUtil::access(func));
+    }
+
+    template <class FUNC>
+    inplace_function(allocator_arg_t,
+                     BloombergLP::bslma::Allocator        *basicAllocator,
+                     BloombergLP::bslmf::MovableRef<FUNC>  func)
+    : Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+    {
+        // Create a function wrapper whose target is moved from the specified
+        // 'func', using the specified 'basicAllocator' to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  Note that this overload is needed only on platforms without
+        // rvalue references.
+
+        init(MoveUtil::access(func));
+    }
+#endif
+
+    inplace_function(const inplace_function& original);
+    inplace_function(allocator_arg_t,
+                     BloombergLP::bslma::Allocator *basicAllocator,
+                     const inplace_function&        original);
+        // Create a function wrapper whose target is a copy of the target of
+        // the specified 'original' wrapper, or an empty wrapper if 'original'
+        // is empty.  Optionally specify, preceded by 'bsl::allocator_arg', a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Note that the
+        // allocator of 'original' is not propagated.
+
+    inplace_function(BloombergLP::bslmf::MovableRef<inplace_function>
+                                             original) BSLS_KEYWORD_NOEXCEPT;
+        // Create a function wrapper having the target, and the allocator, of
+        // the specified 'original' wrapper, which is left empty.  Note that
+        // no memory is allocated, and no copy of the target is made.
+
+    inplace_function(
+              allocator_arg_t,
+              BloombergLP::bslma::Allocator                    *basicAllocator,
+              BloombergLP::bslmf::MovableRef<inplace_function>  original);
+        // Create a function wrapper having the target of the specified
+        // 'original' wrapper, which is left empty, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The target is
+        // relocated if 'basicAllocator' is the allocator of 'original', and is
+        // move-constructed otherwise.
+
+    //! ~inplace_function() = default;
+        // Destroy this object and its target.
+
+    // MANIPULATORS
+    inplace_function& operator=(const inplace_function& rhs);
+        // Make the target of this object a copy of the target of the
+        // specified 'rhs' wrapper, or make this object empty if 'rhs' is
+        // empty, and return a reference providing modifiable access to this
+        // object.  The allocator of this object is unchanged.
+
+    inplace_function& operator=(
+                        BloombergLP::bslmf::MovableRef<inplace_function> rhs);
+        // Make this object hold the target of the specified 'rhs' wrapper,
+        // leaving 'rhs' empty, and return a reference providing modifiable
+        // access to this object.  The allocator of this object is unchanged.
+        // The target is relocated if both objects use the same allocator, and
+        // is move-constructed otherwise.
+
+    template <class FUNC>
+    inplace_function& operator=(FUNC func)
+    {
+        // Make the specified 'func' (moved into this object) the target of
+        // this object, or make this object empty if 'func' is a null pointer
+        // or an empty function wrapper, and return a reference providing
+        // modifiable access to this object.  The allocator of this object is
+        // unchanged.  Note that this operator is defined in the class body to
+        // work around limitations of some compilers.
+
+        inplace_function temp(allocator_arg, this->allocator());
+        temp.init(func);
+        this->swapRep(temp);
+        return *this;
+    }
+
+#if !defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    template <class FUNC>
+    inplace_function& operator=(BloombergLP::bslmf::MovableRef<FUNC> func)
+    {
+        // Make the target of this object moved from the specified 'func', and
+        // return a reference providing modifiable access to this object.  The
+        // allocator of this object is unchanged.  Note that this overload is
+        // needed only on platforms without rvalue references.
+
+        inplace_function temp(allocator_arg, this->allocator());
+        temp.init(MoveUtil::access(func));
+        this->swapRep(temp);
+        return *this;
+    }
+#endif
+
+    inplace_function& operator=(nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+        // Make this object empty, and return a reference providing modifiable
+        // access to this object.
+
+    void swap(inplace_function& other) BSLS_KEYWORD_NOEXCEPT;
+        // Exchange the targets of this object and the specified 'other'
+        // wrapper.  The behavior is undefined unless both objects use the
+        // same allocator.
+};
+
+                           // =====================
+                           // class unique_function
+                           // =====================
+
+template <class PROTOTYPE,
+          std::size_t INPLACE_SIZE =
+                                  InplaceFunction_Util::k_DEFAULT_INPLACE_SIZE>
+class unique_function : public InplaceFunction_Imp<PROTOTYPE, INPLACE_SIZE> {
+    // This class template provides a move-only, allocator-aware, wrapper of
+    // an invocable object (its *target*) having the (template parameter)
+    // 'PROTOTYPE', that holds targets of up to (template parameter)
+    // 'INPLACE_SIZE' bytes in place (see {In-Place Storage}).  Targets need
+    // only be move constructible.
+
+    // PRIVATE TYPES
+    typedef InplaceFunction_Imp<PROTOTYPE, INPLACE_SIZE> Base;
+    typedef BloombergLP::bslmf::MovableRefUtil           MoveUtil;
+
+    // PRIVATE MANIPULATORS
+    template <class FUNC>
+    void init(FUNC& func);
+        // Move the specified 'func' into this object, as its target, unless
+        // 'func' is null.  The behavior is undefined unless this object is
+        // empty.
+
+    // NOT IMPLEMENTED
+    unique_function(const unique_function&) BSLS_KEYWORD_DELETED;
+    unique_function& operator=(const unique_function&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+    unique_function() BSLS_KEYWORD_NOEXCEPT;
+    unique_function(nullptr_t) BSLS_KEYWORD_NOEXCEPT;               // IMPLICIT
+    unique_function(allocator_arg_t,
+                    BloombergLP::bslma::Allocator *basicAllocator)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+    unique_function(allocator_arg_t,
+                    BloombergLP::bslma::Allocator *basicAllocator,
+                    nullptr_t)                           BSLS_KEYWORD_NOEXCEPT;
+        // Create an empty function wrapper.  Optionally specify, preceded by
+        // 'bsl::allocator_arg', a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class FUNC>
+    unique_function(FUNC func)                                      // IMPLICIT
+    : Base(BloombergLP::bslma::Default::defaultAllocator())
+    {
+        // Create a function wrapper whose target is the specified 'func'
+        // (moved into this object), or an empty wrapper if 'func' is a null
+        // pointer or an empty function wrapper, using the currently
+        // installed default allocator to supply memory if 'func' is not held
+        // in place.  'FUNC' must be move constructible and invocable with the
+        // prototype of this wrapper.  Note that this constructor is defined
+        // in the class body to work around limitations of some compilers.
+
+        init(func);
+    }
+
+    template <class FUNC>
+    unique_function(allocator_arg_t,
+                    BloombergLP::bslma::Allocator *basicAllocator,
+                    FUNC                           func)
+    : Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+    {
+        // Create a function wrapper whose target is the specified 'func'
+        // (moved into this object), or an empty wrapper if 'func' is a null
+        // pointer or an empty function wrapper, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  'FUNC' must be move
+        // constructible and invocable with the prototype of this wrapper.
+
+        init(func);
+    }
+
+#if !defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    template <class FUNC>
+    unique_function(BloombergLP::bslmf::MovableRef<FUNC> func)      // IMPLICIT
+    : Base(BloombergLP::bslma::Default::defaultAllocator())
+    {
+        // Create a function wrapper whose target is moved from the specified
+        // 'func', using the currently installed default allocator to supply
+        // memory if 'func' is not held in place.  Note that this overload,
+        // needed only on platforms without rvalue references, allows a
+        // move-only 'func' to be wrapped.
+
+        init(MoveUtil::access(func));
+    }
+
+    template <class FUNC>
+    unique_function(allocator_arg_t,
+                    BloombergLP::bslma::Allocator        *basicAllocator,
+                    BloombergLP::bslmf::MovableRef<FUNC>  func)
+    : Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+    {
+        // Create a function wrapper whose target is moved from the specified
+        // 'func', using the specified 'basicAllocator' to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  Note that this overload, needed only on platforms without
+        // rvalue references, allows a move-only 'func' to be wrapped.
+
+        init(MoveUtil::access(func));
+    }
+#endif
+
+    unique_function(BloombergLP::bslmf::MovableRef<unique_function>
+                                             original) BSLS_KEYWORD_NOEXCEPT;
+        // Create a function wrapper having the target, and the allocator, of
+        // the specified 'original' wrapper, which is left empty.  Note that
+        // no memory is allocated.
+
+    unique_function(
+               allocator_arg_t,
+               BloombergLP::bslma::Allocator                   *basicAllocator,
+               BloombergLP::bslmf::MovableRef<unique_function>  original);
+        // Create a function wrapper having the target of the specified
+        // 'original' wrapper, which is left empty, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The target is
+        // relocated if 'basicAllocator' is the allocator of 'original', and is
+        // move-constructed otherwise.
+
+    //! ~unique_function() = default;
+        // Destroy this object and its target.
+
+    // MANIPULATORS
+    unique_function& operator=(
+                         BloombergLP::bslmf::MovableRef<unique_function> rhs);
+        // Make this object hold the target of the specified 'rhs' wrapper,
+        // leaving 'rhs' empty, and return a reference providing modifiable
+        // access to this object.  The allocator of this object is unchanged.
+        // The target is relocated if both objects use the same allocator, and
+        // is move-constructed otherwise.
+
+    template <class FUNC>
+    unique_function& operator=(FUNC func)
+    {
+        // Make the specified 'func' (moved into this object) the target of
+        // this object, or make this object empty if 'func' is a null pointer
+        // or an empty function wrapper, and return a reference providing
+        // modifiable access to this object.  The allocator of this object is
+        // unchanged.  Note that this operator is defined in the class body to
+        // work around limitations of some compilers.
+
+        unique_function temp(allocator_arg, this->allocator());
+        temp.init(func);
+        this->swapRep(temp);
+        return *this;
+    }
+
+#if !defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+    template <class FUNC>
+    unique_function& operator=(BloombergLP::bslmf::MovableRef<FUNC> func)
+    {
+        // Make the target of this object moved from the specified 'func', and
+        // return a reference providing modifiable access to this object.  The
+        // allocator of this object is unchanged.  Note that this overload is
+        // needed only on platforms without rvalue references.
+
+        unique_function temp(allocator_arg, this->allocator());
+        temp.init(MoveUtil::access(func));
+        this->swapRep(temp);
+        return *this;
+    }
+#endif
+
+    unique_function& operator=(nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+        // Make this object empty, and return a reference providing modifiable
+        // access to this object.
+
+    void swap(unique_function& other) BSLS_KEYWORD_NOEXCEPT;
+        // Exchange the targets of this object and the specified 'other'
+        // wrapper.  The behavior is undefined unless both objects use the
+        // same allocator.
+};
+
+// FREE OPERATORS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+bool operator==(const inplace_function<PROTOTYPE, INPLACE_SIZE>& function,
+                nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+bool operator==(nullptr_t,
+                const inplace_function<PROTOTYPE, INPLACE_SIZE>& function)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+bool operator==(const unique_function<PROTOTYPE, INPLACE_SIZE>& function,
+                nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+bool operator==(nullptr_t,
+                const unique_function<PROTOTYPE, INPLACE_SIZE>& function)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+    // Return 'true' if the specified 'function' is empty, and 'false'
+    // otherwise.
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+bool operator!=(const inplace_function<PROTOTYPE, INPLACE_SIZE>& function,
+                nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+bool operator!=(nullptr_t,
+                const inplace_function<PROTOTYPE, INPLACE_SIZE>& function)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+bool operator!=(const unique_function<PROTOTYPE, INPLACE_SIZE>& function,
+                nullptr_t) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+bool operator!=(nullptr_t,
+                const unique_function<PROTOTYPE, INPLACE_SIZE>& function)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+    // Return 'true' if the specified 'function' holds a target, and 'false'
+    // otherwise.
+
+// FREE FUNCTIONS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+void swap(inplace_function<PROTOTYPE, INPLACE_SIZE>& a,
+          inplace_function<PROTOTYPE, INPLACE_SIZE>& b) BSLS_KEYWORD_NOEXCEPT;
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+void swap(unique_function<PROTOTYPE, INPLACE_SIZE>& a,
+          unique_function<PROTOTYPE, INPLACE_SIZE>& b) BSLS_KEYWORD_NOEXCEPT;
+    // Exchange the targets of the specified 'a' and 'b' function wrappers.
+    // The behavior is undefined unless both objects use the same allocator.
+
+// ============================================================================
+//                  INLINE AND TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // struct InplaceFunction_Util
+                        // ---------------------------
+
+// CLASS METHODS
+template <class FUNC>
+inline
+bool InplaceFunction_Util::isNull(const FUNC&)
+{
+    return false;
+}
+
+template <class FUNC>
+inline
+bool InplaceFunction_Util::isNull(FUNC *function)
+{
+    return 0 == function;
+}
+
+template <class PROTOTYPE>
+inline
+bool InplaceFunction_Util::isNull(const bsl::function<PROTOTYPE>& function)
+{
+    return !function;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool InplaceFunction_Util::isNull(
+                const bsl::inplace_function<PROTOTYPE, INPLACE_SIZE>& function)
+{
+    return !function;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool InplaceFunction_Util::isNull(
+                 const bsl::unique_function<PROTOTYPE, INPLACE_SIZE>& function)
+{
+    return !function;
+}
+
+                       // ------------------------------
+                       // struct InplaceFunction_Storage
+                       // ------------------------------
+
+// CLASS METHODS
+template <class FUNC, bool INPLACE>
+inline
+FUNC *InplaceFunction_Storage<FUNC, INPLACE>::target(void *buffer)
+{
+    return static_cast<FUNC *>(buffer);
+}
+
+template <class FUNC, bool INPLACE>
+inline
+void InplaceFunction_Storage<FUNC, INPLACE>::construct(
+                                 void                          *buffer,
+                                 BloombergLP::bslma::Allocator *allocator,
+                                 const FUNC&                    source)
+{
+    BloombergLP::bslma::ConstructionUtil::construct(target(buffer),
+                                                    allocator,
+                                                    source);
+}
+
+template <class FUNC, bool INPLACE>
+inline
+void InplaceFunction_Storage<FUNC, INPLACE>::construct(
+                           void                                 *buffer,
+                           BloombergLP::bslma::Allocator        *allocator,
+                           BloombergLP::bslmf::MovableRef<FUNC>  source)
+{
+    typedef BloombergLP::bslmf::MovableRefUtil MoveUtil;
+
+    BloombergLP::bslma::ConstructionUtil::construct(
+                                     target(buffer),
+                                     allocator,
+                                     MoveUtil::move(MoveUtil::access(source)));
+}
+
+template <class FUNC, bool INPLACE>
+inline
+void InplaceFunction_Storage<FUNC, INPLACE>::relocate(
+                                      void                          *dst,
+                                      void                          *src,
+                                      BloombergLP::bslma::Allocator *allocator)
+{
+    // 'bslma::ConstructionUtil::destructiveMove' copies, rather than moves,
+    // on C++03 platforms, which 'unique_function' targets do not support.
+
+    typedef BloombergLP::bslmf::MovableRefUtil MoveUtil;
+
+    FUNC *source = target(src);
+
+    if (BloombergLP::bslmf::IsBitwiseMoveable<FUNC>::value) {
+        std::memcpy(dst, static_cast<void *>(source), sizeof(FUNC));
+    }
+    else {
+        BloombergLP::bslma::ConstructionUtil::construct(
+                                                target(dst),
+                                                allocator,
+                                                MoveUtil::move(*source));
+        BloombergLP::bslma::DestructionUtil::destroy(source);
+    }
+}
+
+template <class FUNC, bool INPLACE>
+inline
+void InplaceFunction_Storage<FUNC, INPLACE>::destroy(
+                                         void                          *buffer,
+                                         BloombergLP::bslma::Allocator *)
+{
+    BloombergLP::bslma::DestructionUtil::destroy(target(buffer));
+}
+
+template <class FUNC>
+inline
+FUNC *InplaceFunction_Storage<FUNC, false>::target(void *buffer)
+{
+    return *static_cast<FUNC **>(buffer);
+}
+
+template <class FUNC>
+void InplaceFunction_Storage<FUNC, false>::construct(
+                                 void                          *buffer,
+                                 BloombergLP::bslma::Allocator *allocator,
+                                 const FUNC&                    source)
+{
+    FUNC *object = static_cast<FUNC *>(allocator->allocate(sizeof(FUNC)));
+
+    BloombergLP::bslma::DeallocatorProctor<BloombergLP::bslma::Allocator>
+                                                    proctor(object, allocator);
+
+    BloombergLP::bslma::ConstructionUtil::construct(object, allocator, source);
+
+    proctor.release();
+    *static_cast<FUNC **>(buffer) = object;
+}
+
+template <class FUNC>
+void InplaceFunction_Storage<FUNC, false>::construct(
+                           void                                 *buffer,
+                           BloombergLP::bslma::Allocator        *allocator,
+                           BloombergLP::bslmf::MovableRef<FUNC>  source)
+{
+    typedef BloombergLP::bslmf::MovableRefUtil MoveUtil;
+
+    FUNC *object = static_cast<FUNC *>(allocator->allocate(sizeof(FUNC)));
+
+    BloombergLP::bslma::DeallocatorProctor<BloombergLP::bslma::Allocator>
+                                                    proctor(object, allocator);
+
+    BloombergLP::bslma::ConstructionUtil::construct(
+                                     object,
+                                     allocator,
+                                     MoveUtil::move(MoveUtil::access(source)));
+
+    proctor.release();
+    *static_cast<FUNC **>(buffer) = object;
+}
+
+template <class FUNC>
+inline
+void InplaceFunction_Storage<FUNC, false>::relocate(
+                                            void                          *dst,
+                                            void                          *src,
+                                            BloombergLP::bslma::Allocator *)
+{
+    *static_cast<FUNC **>(dst) = *static_cast<FUNC **>(src);
+}
+
+template <class FUNC>
+inline
+void InplaceFunction_Storage<FUNC, false>::destroy(
+                                      void                          *buffer,
+                                      BloombergLP::bslma::Allocator *allocator)
+{
+    FUNC *object = target(buffer);
+
+    BloombergLP::bslma::DestructionUtil::destroy(object);
+    allocator->deallocate(object);
+}
+
+                       // ------------------------------
+                       // struct InplaceFunction_Manager
+                       // ------------------------------
+
+// PRIVATE CLASS METHODS
+template <class FUNC, bool INPLACE, bool COPYABLE>
+inline
+void InplaceFunction_Manager<FUNC, INPLACE, COPYABLE>::copy(
+                                      void                          *dst,
+                                      void                          *src,
+                                      BloombergLP::bslma::Allocator *allocator,
+                                      true_type)
+{
+    const FUNC& original = *Storage::target(src);
+    Storage::construct(dst, allocator, original);
+}
+
+template <class FUNC, bool INPLACE, bool COPYABLE>
+inline
+void InplaceFunction_Manager<FUNC, INPLACE, COPYABLE>::copy(
+                                               void                          *,
+                                               void                          *,
+                                               BloombergLP::bslma::Allocator *,
+                                               false_type)
+{
+    BSLS_ASSERT_INVOKE_NORETURN("'unique_function' targets are not copied");
+}
+
+// CLASS METHODS
+template <class FUNC, bool INPLACE, bool COPYABLE>
+const void *InplaceFunction_Manager<FUNC, INPLACE, COPYABLE>::manage(
+                             InplaceFunction_Util::Operation  operation,
+                             void                            *dst,
+                             void                            *src,
+                             BloombergLP::bslma::Allocator   *allocator)
+{
+    switch (operation) {
+      case InplaceFunction_Util::e_MOVE: {
+        Storage::relocate(dst, src, allocator);
+      } break;
+      case InplaceFunction_Util::e_MOVE_CONSTRUCT: {
+        Storage::construct(
+                    dst,
+                    allocator,
+                    BloombergLP::bslmf::MovableRefUtil::move(
+                                                     *Storage::target(src)));
+      } break;
+      case InplaceFunction_Util::e_COPY: {
+        copy(dst, src, allocator, integral_constant<bool, COPYABLE>());
+      } break;
+      case InplaceFunction_Util::e_DESTROY: {
+        Storage::destroy(dst, allocator);
+      } break;
+      case InplaceFunction_Util::e_GET_TARGET: {
+        return Storage::target(dst);                                  // RETURN
+      } break;
+      case InplaceFunction_Util::e_GET_TYPE_INFO: {
+        return &typeid(FUNC);                                         // RETURN
+      } break;
+    }
+    return 0;
+}
+
+                         // -------------------------
+                         // class InplaceFunction_Rep
+                         // -------------------------
+
+// PROTECTED CREATORS
+template <std::size_t INPLACE_SIZE>
+inline
+InplaceFunction_Rep<INPLACE_SIZE>::InplaceFunction_Rep(
+                        BloombergLP::bslma::Allocator *basicAllocator)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_manager_p(0)
+, d_invoker_p(0)
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT_SAFE(basicAllocator);
+}
+
+template <std::size_t INPLACE_SIZE>
+inline
+InplaceFunction_Rep<INPLACE_SIZE>::~InplaceFunction_Rep()
+{
+    reset();
+}
+
+// PROTECTED MANIPULATORS
+template <std::size_t INPLACE_SIZE>
+template <bool COPYABLE, class FUNC>
+inline
+void InplaceFunction_Rep<INPLACE_SIZE>::emplace(FUNC&          func,
+                                                GenericInvoker invoker)
+{
+    BSLS_ASSERT_SAFE(!d_manager_p);
+
+    if (InplaceFunction_Util::isNull(func)) {
+        return;                                                       // RETURN
+    }
+
+    typedef InplaceFunction_IsInplace<FUNC, INPLACE_SIZE> IsInplace;
+
+    InplaceFunction_Storage<FUNC, IsInplace::value>::construct(
+                                     buffer(),
+                                     d_allocator_p,
+                                     BloombergLP::bslmf::MovableRefUtil::move(
+                                                                        func));
+
+    d_manager_p =
+           &InplaceFunction_Manager<FUNC, IsInplace::value, COPYABLE>::manage;
+    d_invoker_p = invoker;
+}
+
+template <std::size_t INPLACE_SIZE>
+inline
+void InplaceFunction_Rep<INPLACE_SIZE>::copyFrom(
+                                           const InplaceFunction_Rep& original)
+{
+    BSLS_ASSERT_SAFE(!d_manager_p);
+
+    if (original.d_manager_p) {
+        original.d_manager_p(InplaceFunction_Util::e_COPY,
+                             buffer(),
+                             original.buffer(),
+                             d_allocator_p);
+        d_manager_p = original.d_manager_p;
+        d_invoker_p = original.d_invoker_p;
+    }
+}
+
+template <std::size_t INPLACE_SIZE>
+inline
+void InplaceFunction_Rep<INPLACE_SIZE>::moveFrom(
+                           InplaceFunction_Rep& original) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT_SAFE(!d_manager_p);
+    BSLS_ASSERT_SAFE(d_allocator_p == original.d_allocator_p);
+
+    if (original.d_manager_p) {
+        original.d_manager_p(InplaceFunction_Util::e_MOVE,
+                             buffer(),
+                             original.buffer(),
+                             d_allocator_p);
+        d_manager_p          = original.d_manager_p;
+        d_invoker_p          = original.d_invoker_p;
+        original.d_manager_p = 0;
+        original.d_invoker_p = 0;
+    }
+}
+
+template <std::size_t INPLACE_SIZE>
+void InplaceFunction_Rep<INPLACE_SIZE>::moveConstructFrom(
+                                                 InplaceFunction_Rep& original)
+{
+    if (d_allocator_p == original.d_allocator_p) {
+        moveFrom(original);
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(!d_manager_p);
+
+    if (original.d_manager_p) {
+        original.d_manager_p(InplaceFunction_Util::e_MOVE_CONSTRUCT,
+                             buffer(),
+                             original.buffer(),
+                             d_allocator_p);
+        d_manager_p = original.d_manager_p;
+        d_invoker_p = original.d_invoker_p;
+        original.reset();
+    }
+}
+
+template <std::size_t INPLACE_SIZE>
+inline
+void InplaceFunction_Rep<INPLACE_SIZE>::reset() BSLS_KEYWORD_NOEXCEPT
+{
+    if (d_manager_p) {
+        d_manager_p(InplaceFunction_Util::e_DESTROY,
+                    buffer(),
+                    0,
+                    d_allocator_p);
+        d_manager_p = 0;
+        d_invoker_p = 0;
+    }
+}
+
+template <std::size_t INPLACE_SIZE>
+void InplaceFunction_Rep<INPLACE_SIZE>::swapRep(
+                              InplaceFunction_Rep& other) BSLS_KEYWORD_NOEXCEPT
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    // Relocation does not throw, so the targets can be exchanged through a
+    // temporary buffer.
+
+    BloombergLP::bsls::AlignedBuffer<static_cast<int>(INPLACE_SIZE)> temp;
+
+    if (d_manager_p) {
+        d_manager_p(InplaceFunction_Util::e_MOVE,
+                    temp.buffer(),
+                    buffer(),
+                    d_allocator_p);
+    }
+    if (other.d_manager_p) {
+        other.d_manager_p(InplaceFunction_Util::e_MOVE,
+                          buffer(),
+                          other.buffer(),
+                          d_allocator_p);
+    }
+    if (d_manager_p) {
+        d_manager_p(InplaceFunction_Util::e_MOVE,
+                    other.buffer(),
+                    temp.buffer(),
+                    d_allocator_p);
+    }
+
+    Manager        *manager = d_manager_p;
+    GenericInvoker  invoker = d_invoker_p;
+
+    d_manager_p       = other.d_manager_p;
+    d_invoker_p       = other.d_invoker_p;
+    other.d_manager_p = manager;
+    other.d_invoker_p = invoker;
+}
+
+// PROTECTED ACCESSORS
+template <std::size_t INPLACE_SIZE>
+inline
+void *InplaceFunction_Rep<INPLACE_SIZE>::buffer() const
+{
+    return d_buffer.buffer();
+}
+
+template <std::size_t INPLACE_SIZE>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Rep<INPLACE_SIZE>::genericInvoker() const
+{
+    return d_invoker_p;
+}
+
+// ACCESSORS
+#ifdef BSLS_COMPILERFEATURES_SUPPORT_OPERATOR_EXPLICIT
+template <std::size_t INPLACE_SIZE>
+inline
+InplaceFunction_Rep<INPLACE_SIZE>::operator bool() const BSLS_KEYWORD_NOEXCEPT
+{
+    return 0 != d_manager_p;
+}
+#endif
+
+template <std::size_t INPLACE_SIZE>
+inline
+BloombergLP::bslma::Allocator *
+InplaceFunction_Rep<INPLACE_SIZE>::allocator() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_allocator_p;
+}
+
+template <std::size_t INPLACE_SIZE>
+inline
+bool InplaceFunction_Rep<INPLACE_SIZE>::is_inplace() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return !d_manager_p
+        || buffer() == d_manager_p(InplaceFunction_Util::e_GET_TARGET,
+                                   buffer(),
+                                   0,
+                                   d_allocator_p);
+}
+
+template <std::size_t INPLACE_SIZE>
+template <class TYPE>
+inline
+TYPE *InplaceFunction_Rep<INPLACE_SIZE>::target() BSLS_KEYWORD_NOEXCEPT
+{
+    if (!d_manager_p || typeid(TYPE) != target_type()) {
+        return 0;                                                     // RETURN
+    }
+
+    return static_cast<TYPE *>(const_cast<void *>(
+                           d_manager_p(InplaceFunction_Util::e_GET_TARGET,
+                                       buffer(),
+                                       0,
+                                       d_allocator_p)));
+}
+
+template <std::size_t INPLACE_SIZE>
+template <class TYPE>
+inline
+const TYPE *InplaceFunction_Rep<INPLACE_SIZE>::target() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return const_cast<InplaceFunction_Rep *>(this)->template target<TYPE>();
+}
+
+template <std::size_t INPLACE_SIZE>
+inline
+const std::type_info& InplaceFunction_Rep<INPLACE_SIZE>::target_type() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    if (!d_manager_p) {
+        return typeid(void);                                          // RETURN
+    }
+
+    return *static_cast<const std::type_info *>(
+                             d_manager_p(InplaceFunction_Util::e_GET_TYPE_INFO,
+                                           0,
+                                           0,
+                                           d_allocator_p));
+}
+
+                         // -------------------------
+                         // class InplaceFunction_Imp
+                         // -------------------------
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES // $var-args=13
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+              typename BloombergLP::bslmf::ForwardingType<ARGS>::Type... args)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    // The cast to 'RET' allows 'RET' to be 'void' when the target returns a
+    // value.
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS>::
+                   forwardToTarget(args)...));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+inline
+InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+inline
+RET InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>::operator()(
+                                                           ARGS... args) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(), args...);
+}
+#elif BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// The following section is automatically generated.  **DO NOT EDIT**
+// Generator command line: sim_cpp11_features.pl bslstl_inplacefunction.h
+#ifndef BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B
+#define BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B                               \
+        BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT
+#endif
+
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 0
+template <std::size_t INPLACE_SIZE, class RET>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(), INPLACE_SIZE>::invoke(
+                                                                  void *buffer)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET, target());
+}
+
+template <std::size_t INPLACE_SIZE, class RET>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET>
+inline
+InplaceFunction_Imp<RET(), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET>
+inline
+RET InplaceFunction_Imp<RET(), INPLACE_SIZE>::operator()() const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer());
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 0
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 1
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01>
+inline
+InplaceFunction_Imp<RET(ARGS_01), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01), INPLACE_SIZE>::operator()(
+                                                         ARGS_01 args_01) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(), args_01);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 1
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 2
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                         ARGS_02 args_02) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(), args_01, args_02);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 2
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 3
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                         ARGS_03 args_03) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(), args_01, args_02, args_03);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 3
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 4
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                         ARGS_04 args_04) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(), args_01, args_02, args_03, args_04);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 4
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 5
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_05>::
+                   forwardToTarget(args_05)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                               ARGS_04 args_04,
+                                                         ARGS_05 args_05) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(),
+                   args_01,
+                   args_02,
+                   args_03,
+                   args_04,
+                   args_05);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 5
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 6
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_05>::
+                   forwardToTarget(args_05),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_06>::
+                   forwardToTarget(args_06)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                               ARGS_04 args_04,
+                                                               ARGS_05 args_05,
+                                                         ARGS_06 args_06) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(),
+                   args_01,
+                   args_02,
+                   args_03,
+                   args_04,
+                   args_05,
+                   args_06);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 6
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 7
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_05>::
+                   forwardToTarget(args_05),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_06>::
+                   forwardToTarget(args_06),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_07>::
+                   forwardToTarget(args_07)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                               ARGS_04 args_04,
+                                                               ARGS_05 args_05,
+                                                               ARGS_06 args_06,
+                                                         ARGS_07 args_07) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(),
+                   args_01,
+                   args_02,
+                   args_03,
+                   args_04,
+                   args_05,
+                   args_06,
+                   args_07);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 7
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 8
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_05>::
+                   forwardToTarget(args_05),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_06>::
+                   forwardToTarget(args_06),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_07>::
+                   forwardToTarget(args_07),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_08>::
+                   forwardToTarget(args_08)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                               ARGS_04 args_04,
+                                                               ARGS_05 args_05,
+                                                               ARGS_06 args_06,
+                                                               ARGS_07 args_07,
+                                                         ARGS_08 args_08) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(),
+                   args_01,
+                   args_02,
+                   args_03,
+                   args_04,
+                   args_05,
+                   args_06,
+                   args_07,
+                   args_08);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 8
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 9
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_05>::
+                   forwardToTarget(args_05),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_06>::
+                   forwardToTarget(args_06),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_07>::
+                   forwardToTarget(args_07),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_08>::
+                   forwardToTarget(args_08),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_09>::
+                   forwardToTarget(args_09)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                               ARGS_04 args_04,
+                                                               ARGS_05 args_05,
+                                                               ARGS_06 args_06,
+                                                               ARGS_07 args_07,
+                                                               ARGS_08 args_08,
+                                                         ARGS_09 args_09) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(),
+                   args_01,
+                   args_02,
+                   args_03,
+                   args_04,
+                   args_05,
+                   args_06,
+                   args_07,
+                   args_08,
+                   args_09);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 9
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 10
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09,
+                            ARGS_10), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_05>::
+                   forwardToTarget(args_05),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_06>::
+                   forwardToTarget(args_06),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_07>::
+                   forwardToTarget(args_07),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_08>::
+                   forwardToTarget(args_08),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_09>::
+                   forwardToTarget(args_09),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_10>::
+                   forwardToTarget(args_10)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09,
+                        ARGS_10), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09,
+                        ARGS_10), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09,
+                            ARGS_10), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                               ARGS_04 args_04,
+                                                               ARGS_05 args_05,
+                                                               ARGS_06 args_06,
+                                                               ARGS_07 args_07,
+                                                               ARGS_08 args_08,
+                                                               ARGS_09 args_09,
+                                                         ARGS_10 args_10) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(),
+                   args_01,
+                   args_02,
+                   args_03,
+                   args_04,
+                   args_05,
+                   args_06,
+                   args_07,
+                   args_08,
+                   args_09,
+                   args_10);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 10
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 11
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09,
+                            ARGS_10,
+                            ARGS_11), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_11>::Type args_11)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_05>::
+                   forwardToTarget(args_05),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_06>::
+                   forwardToTarget(args_06),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_07>::
+                   forwardToTarget(args_07),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_08>::
+                   forwardToTarget(args_08),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_09>::
+                   forwardToTarget(args_09),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_10>::
+                   forwardToTarget(args_10),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_11>::
+                   forwardToTarget(args_11)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09,
+                        ARGS_10,
+                        ARGS_11), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09,
+                        ARGS_10,
+                        ARGS_11), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09,
+                            ARGS_10,
+                            ARGS_11), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                               ARGS_04 args_04,
+                                                               ARGS_05 args_05,
+                                                               ARGS_06 args_06,
+                                                               ARGS_07 args_07,
+                                                               ARGS_08 args_08,
+                                                               ARGS_09 args_09,
+                                                               ARGS_10 args_10,
+                                                         ARGS_11 args_11) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(),
+                   args_01,
+                   args_02,
+                   args_03,
+                   args_04,
+                   args_05,
+                   args_06,
+                   args_07,
+                   args_08,
+                   args_09,
+                   args_10,
+                   args_11);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 11
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 12
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09,
+                            ARGS_10,
+                            ARGS_11,
+                            ARGS_12), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_11>::Type args_11,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_12>::Type args_12)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_05>::
+                   forwardToTarget(args_05),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_06>::
+                   forwardToTarget(args_06),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_07>::
+                   forwardToTarget(args_07),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_08>::
+                   forwardToTarget(args_08),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_09>::
+                   forwardToTarget(args_09),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_10>::
+                   forwardToTarget(args_10),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_11>::
+                   forwardToTarget(args_11),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_12>::
+                   forwardToTarget(args_12)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09,
+                        ARGS_10,
+                        ARGS_11,
+                        ARGS_12), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09,
+                        ARGS_10,
+                        ARGS_11,
+                        ARGS_12), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09,
+                            ARGS_10,
+                            ARGS_11,
+                            ARGS_12), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                               ARGS_04 args_04,
+                                                               ARGS_05 args_05,
+                                                               ARGS_06 args_06,
+                                                               ARGS_07 args_07,
+                                                               ARGS_08 args_08,
+                                                               ARGS_09 args_09,
+                                                               ARGS_10 args_10,
+                                                               ARGS_11 args_11,
+                                                         ARGS_12 args_12) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(),
+                   args_01,
+                   args_02,
+                   args_03,
+                   args_04,
+                   args_05,
+                   args_06,
+                   args_07,
+                   args_08,
+                   args_09,
+                   args_10,
+                   args_11,
+                   args_12);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 12
+
+#if BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 13
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12,
+                                               class ARGS_13>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09,
+                            ARGS_10,
+                            ARGS_11,
+                            ARGS_12,
+                            ARGS_13), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_01>::Type args_01,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_02>::Type args_02,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_03>::Type args_03,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_04>::Type args_04,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_05>::Type args_05,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_06>::Type args_06,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_07>::Type args_07,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_08>::Type args_08,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_09>::Type args_09,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_10>::Type args_10,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_11>::Type args_11,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_12>::Type args_12,
+            typename BloombergLP::bslmf::ForwardingType<ARGS_13>::Type args_13)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS_01>::
+                   forwardToTarget(args_01),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_02>::
+                   forwardToTarget(args_02),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_03>::
+                   forwardToTarget(args_03),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_04>::
+                   forwardToTarget(args_04),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_05>::
+                   forwardToTarget(args_05),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_06>::
+                   forwardToTarget(args_06),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_07>::
+                   forwardToTarget(args_07),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_08>::
+                   forwardToTarget(args_08),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_09>::
+                   forwardToTarget(args_09),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_10>::
+                   forwardToTarget(args_10),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_11>::
+                   forwardToTarget(args_11),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_12>::
+                   forwardToTarget(args_12),
+                   BloombergLP::bslmf::ForwardingTypeUtil<ARGS_13>::
+                   forwardToTarget(args_13)));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12,
+                                               class ARGS_13>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09,
+                        ARGS_10,
+                        ARGS_11,
+                        ARGS_12,
+                        ARGS_13), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12,
+                                               class ARGS_13>
+inline
+InplaceFunction_Imp<RET(ARGS_01,
+                        ARGS_02,
+                        ARGS_03,
+                        ARGS_04,
+                        ARGS_05,
+                        ARGS_06,
+                        ARGS_07,
+                        ARGS_08,
+                        ARGS_09,
+                        ARGS_10,
+                        ARGS_11,
+                        ARGS_12,
+                        ARGS_13), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class ARGS_01,
+                                               class ARGS_02,
+                                               class ARGS_03,
+                                               class ARGS_04,
+                                               class ARGS_05,
+                                               class ARGS_06,
+                                               class ARGS_07,
+                                               class ARGS_08,
+                                               class ARGS_09,
+                                               class ARGS_10,
+                                               class ARGS_11,
+                                               class ARGS_12,
+                                               class ARGS_13>
+inline
+RET InplaceFunction_Imp<RET(ARGS_01,
+                            ARGS_02,
+                            ARGS_03,
+                            ARGS_04,
+                            ARGS_05,
+                            ARGS_06,
+                            ARGS_07,
+                            ARGS_08,
+                            ARGS_09,
+                            ARGS_10,
+                            ARGS_11,
+                            ARGS_12,
+                            ARGS_13), INPLACE_SIZE>::operator()(
+                                                               ARGS_01 args_01,
+                                                               ARGS_02 args_02,
+                                                               ARGS_03 args_03,
+                                                               ARGS_04 args_04,
+                                                               ARGS_05 args_05,
+                                                               ARGS_06 args_06,
+                                                               ARGS_07 args_07,
+                                                               ARGS_08 args_08,
+                                                               ARGS_09 args_09,
+                                                               ARGS_10 args_10,
+                                                               ARGS_11 args_11,
+                                                               ARGS_12 args_12,
+                                                         ARGS_13 args_13) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(),
+                   args_01,
+                   args_02,
+                   args_03,
+                   args_04,
+                   args_05,
+                   args_06,
+                   args_07,
+                   args_08,
+                   args_09,
+                   args_10,
+                   args_11,
+                   args_12,
+                   args_13);
+}
+#endif  // BSLSTL_INPLACEFUNCTION_VARIADIC_LIMIT_B >= 13
+
+#else
+// The generated code below is a workaround for the absence of perfect
+// forwarding in some compilers.
+
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+template <class FUNC>
+inline
+RET InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>::invoke(
+                                                                  void *buffer,
+              typename BloombergLP::bslmf::ForwardingType<ARGS>::Type... args)
+{
+    typedef InplaceFunction_Storage<
+                 FUNC,
+                 InplaceFunction_IsInplace<FUNC, INPLACE_SIZE>::value> Storage;
+
+    FUNC& target = *Storage::target(buffer);
+
+    return BSLSTL_FUNCTION_CAST_RESULT(RET,
+            target(BloombergLP::bslmf::ForwardingTypeUtil<ARGS>::
+                   forwardToTarget(args)...));
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+template <class FUNC>
+inline
+InplaceFunction_Util::GenericInvoker
+InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>::invoker()
+{
+    Invoker *invoker = &invoke<FUNC>;
+    return reinterpret_cast<InplaceFunction_Util::GenericInvoker>(invoker);
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+inline
+InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>::InplaceFunction_Imp(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: Rep(basicAllocator)
+{
+}
+
+template <std::size_t INPLACE_SIZE, class RET, class... ARGS>
+inline
+RET InplaceFunction_Imp<RET(ARGS...), INPLACE_SIZE>::operator()(
+                                                           ARGS... args) const
+{
+    Invoker *invoker = reinterpret_cast<Invoker *>(this->genericInvoker());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    if (!invoker) {
+        BSLS_THROW(bad_function_call());
+    }
+#else
+    BSLS_ASSERT_OPT(invoker);
+#endif
+
+    return invoker(this->buffer(), args...);
+}
+
+// }}} END GENERATED CODE
+#endif
+
+                           // ----------------------
+                           // class inplace_function
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+template <class FUNC>
+inline
+void inplace_function<PROTOTYPE, INPLACE_SIZE>::init(FUNC& func)
+{
+    this->template emplace<true>(func, Base::template invoker<FUNC>());
+}
+
+// CREATORS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>::inplace_function()
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base(BloombergLP::bslma::Default::defaultAllocator())
+{
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>::inplace_function(nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base(BloombergLP::bslma::Default::defaultAllocator())
+{
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>::inplace_function(
+                  allocator_arg_t,
+                  BloombergLP::bslma::Allocator *basicAllocator)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>::inplace_function(
+                  allocator_arg_t,
+                  BloombergLP::bslma::Allocator *basicAllocator,
+                  nullptr_t)                              BSLS_KEYWORD_NOEXCEPT
+: Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>::inplace_function(
+                                              const inplace_function& original)
+: Base(BloombergLP::bslma::Default::defaultAllocator())
+{
+    this->copyFrom(original);
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>::inplace_function(
+                          allocator_arg_t,
+                          BloombergLP::bslma::Allocator *basicAllocator,
+                          const inplace_function&        original)
+: Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+{
+    this->copyFrom(original);
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>::inplace_function(
+              BloombergLP::bslmf::MovableRef<inplace_function> original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base(MoveUtil::access(original).allocator())
+{
+    this->moveFrom(MoveUtil::access(original));
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>::inplace_function(
+              allocator_arg_t,
+              BloombergLP::bslma::Allocator                    *basicAllocator,
+              BloombergLP::bslmf::MovableRef<inplace_function>  original)
+: Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+{
+    this->moveConstructFrom(MoveUtil::access(original));
+}
+
+// MANIPULATORS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>&
+inplace_function<PROTOTYPE, INPLACE_SIZE>::operator=(
+                                                   const inplace_function& rhs)
+{
+    inplace_function temp(allocator_arg, this->allocator(), rhs);
+    this->swapRep(temp);
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>&
+inplace_function<PROTOTYPE, INPLACE_SIZE>::operator=(
+                         BloombergLP::bslmf::MovableRef<inplace_function> rhs)
+{
+    inplace_function& lvalue = MoveUtil::access(rhs);
+
+    if (this != &lvalue) {
+        if (this->allocator() == lvalue.allocator()) {
+            this->reset();
+            this->moveFrom(lvalue);
+        }
+        else {
+            inplace_function temp(allocator_arg,
+                                  this->allocator(),
+                                  MoveUtil::move(lvalue));
+            this->swapRep(temp);
+        }
+    }
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+inplace_function<PROTOTYPE, INPLACE_SIZE>&
+inplace_function<PROTOTYPE, INPLACE_SIZE>::operator=(nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    this->reset();
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+void inplace_function<PROTOTYPE, INPLACE_SIZE>::swap(inplace_function& other)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    this->swapRep(other);
+}
+
+                           // ---------------------
+                           // class unique_function
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+template <class FUNC>
+inline
+void unique_function<PROTOTYPE, INPLACE_SIZE>::init(FUNC& func)
+{
+    this->template emplace<false>(func, Base::template invoker<FUNC>());
+}
+
+// CREATORS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+unique_function<PROTOTYPE, INPLACE_SIZE>::unique_function()
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base(BloombergLP::bslma::Default::defaultAllocator())
+{
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+unique_function<PROTOTYPE, INPLACE_SIZE>::unique_function(nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base(BloombergLP::bslma::Default::defaultAllocator())
+{
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+unique_function<PROTOTYPE, INPLACE_SIZE>::unique_function(
+                  allocator_arg_t,
+                  BloombergLP::bslma::Allocator *basicAllocator)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+unique_function<PROTOTYPE, INPLACE_SIZE>::unique_function(
+                  allocator_arg_t,
+                  BloombergLP::bslma::Allocator *basicAllocator,
+                  nullptr_t)                              BSLS_KEYWORD_NOEXCEPT
+: Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+unique_function<PROTOTYPE, INPLACE_SIZE>::unique_function(
+               BloombergLP::bslmf::MovableRef<unique_function> original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base(MoveUtil::access(original).allocator())
+{
+    this->moveFrom(MoveUtil::access(original));
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+unique_function<PROTOTYPE, INPLACE_SIZE>::unique_function(
+               allocator_arg_t,
+               BloombergLP::bslma::Allocator                   *basicAllocator,
+               BloombergLP::bslmf::MovableRef<unique_function>  original)
+: Base(BloombergLP::bslma::Default::allocator(basicAllocator))
+{
+    this->moveConstructFrom(MoveUtil::access(original));
+}
+
+// MANIPULATORS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+unique_function<PROTOTYPE, INPLACE_SIZE>&
+unique_function<PROTOTYPE, INPLACE_SIZE>::operator=(
+                          BloombergLP::bslmf::MovableRef<unique_function> rhs)
+{
+    unique_function& lvalue = MoveUtil::access(rhs);
+
+    if (this != &lvalue) {
+        if (this->allocator() == lvalue.allocator()) {
+            this->reset();
+            this->moveFrom(lvalue);
+        }
+        else {
+            unique_function temp(allocator_arg,
+                                 this->allocator(),
+                                 MoveUtil::move(lvalue));
+            this->swapRep(temp);
+        }
+    }
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+unique_function<PROTOTYPE, INPLACE_SIZE>&
+unique_function<PROTOTYPE, INPLACE_SIZE>::operator=(nullptr_t)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    this->reset();
+    return *this;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+void unique_function<PROTOTYPE, INPLACE_SIZE>::swap(unique_function& other)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    this->swapRep(other);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool bsl::operator==(
+                const bsl::inplace_function<PROTOTYPE, INPLACE_SIZE>& function,
+                bsl::nullptr_t)                          BSLS_KEYWORD_NOEXCEPT
+{
+    return !function;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool bsl::operator==(
+                bsl::nullptr_t,
+                const bsl::inplace_function<PROTOTYPE, INPLACE_SIZE>& function)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return !function;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool bsl::operator==(
+                 const bsl::unique_function<PROTOTYPE, INPLACE_SIZE>& function,
+                 bsl::nullptr_t)                         BSLS_KEYWORD_NOEXCEPT
+{
+    return !function;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool bsl::operator==(
+                 bsl::nullptr_t,
+                 const bsl::unique_function<PROTOTYPE, INPLACE_SIZE>& function)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return !function;
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool bsl::operator!=(
+                const bsl::inplace_function<PROTOTYPE, INPLACE_SIZE>& function,
+                bsl::nullptr_t)                          BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(function);
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool bsl::operator!=(
+                bsl::nullptr_t,
+                const bsl::inplace_function<PROTOTYPE, INPLACE_SIZE>& function)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(function);
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool bsl::operator!=(
+                 const bsl::unique_function<PROTOTYPE, INPLACE_SIZE>& function,
+                 bsl::nullptr_t)                         BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(function);
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+bool bsl::operator!=(
+                 bsl::nullptr_t,
+                 const bsl::unique_function<PROTOTYPE, INPLACE_SIZE>& function)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return static_cast<bool>(function);
+}
+
+// FREE FUNCTIONS
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+void bsl::swap(bsl::inplace_function<PROTOTYPE, INPLACE_SIZE>& a,
+               bsl::inplace_function<PROTOTYPE, INPLACE_SIZE>& b)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    a.swap(b);
+}
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+inline
+void bsl::swap(bsl::unique_function<PROTOTYPE, INPLACE_SIZE>& a,
+               bsl::unique_function<PROTOTYPE, INPLACE_SIZE>& b)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bsl {
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+struct is_nothrow_move_constructible<
+                                 inplace_function<PROTOTYPE, INPLACE_SIZE> >
+: true_type {
+};
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+struct is_nothrow_move_constructible<unique_function<PROTOTYPE, INPLACE_SIZE> >
+: true_type {
+};
+
+}  // close namespace bsl
+
+namespace BloombergLP {
+namespace bslma {
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+struct UsesBslmaAllocator<bsl::inplace_function<PROTOTYPE, INPLACE_SIZE> >
+: bsl::true_type {
+};
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+struct UsesBslmaAllocator<bsl::unique_function<PROTOTYPE, INPLACE_SIZE> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+
+namespace bslmf {
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+struct UsesAllocatorArgT<bsl::inplace_function<PROTOTYPE, INPLACE_SIZE> >
+: bsl::true_type {
+};
+
+template <class PROTOTYPE, std::size_t INPLACE_SIZE>
+struct UsesAllocatorArgT<bsl::unique_function<PROTOTYPE, INPLACE_SIZE> >
+: bsl::true_type {
+};
+
+}  // close namespace bslmf
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1767 @@
+// bslstl_inplacefunction.t.cpp                                       -*-C++-*-
+#include <bslstl_inplacefunction.h>
+
+#include <bslstl_function.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_managedptr.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_isnothrowmoveconstructible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_usesallocatorargt.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_keyword.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <algorithm>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bsl::inplace_function' and 'bsl::unique_function' wrap invocable objects
+// ("targets") in an in-place buffer whose size is a template parameter, and
+// allocate targets that do not fit or whose relocation might throw.  We test
+// that the choice between the two representations follows the documented
+// rules, that the number of allocations, copies, and moves of targets is as
+// documented for each creator and manipulator, that the allocator is
+// propagated to targets that use one, that null targets produce empty
+// wrappers, that invocation forwards arguments and converts results, and that
+// 'unique_function' accepts move-only targets.  Targets that count their
+// copies and moves, and test allocators, are used to observe the behavior.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] inplace_function();
+// [ 2] inplace_function(nullptr_t);
+// [ 2] inplace_function(allocator_arg_t, Allocator *);
+// [ 2] inplace_function(allocator_arg_t, Allocator *, nullptr_t);
+// [ 2] inplace_function(FUNC);
+// [ 2] inplace_function(allocator_arg_t, Allocator *, FUNC);
+// [ 5] inplace_function(const inplace_function&);
+// [ 5] inplace_function(allocator_arg_t, Allocator *, const inplace_func...&);
+// [ 5] inplace_function(MovableRef<inplace_function>);
+// [ 5] inplace_function(allocator_arg_t, Allocator *, MovableRef<inplace...>);
+// [ 2] ~inplace_function();
+// [ 7] unique_function();
+// [ 7] unique_function(nullptr_t);
+// [ 7] unique_function(allocator_arg_t, Allocator *);
+// [ 7] unique_function(allocator_arg_t, Allocator *, nullptr_t);
+// [ 7] unique_function(FUNC);
+// [ 7] unique_function(allocator_arg_t, Allocator *, FUNC);
+// [ 7] unique_function(MovableRef<unique_function>);
+// [ 7] unique_function(allocator_arg_t, Allocator *, MovableRef<unique...>);
+// [ 7] ~unique_function();
+//
+// MANIPULATORS
+// [ 6] inplace_function& operator=(const inplace_function&);
+// [ 6] inplace_function& operator=(MovableRef<inplace_function>);
+// [ 6] inplace_function& operator=(FUNC);
+// [ 6] inplace_function& operator=(nullptr_t);
+// [ 6] void swap(inplace_function&);
+// [ 7] unique_function& operator=(MovableRef<unique_function>);
+// [ 7] unique_function& operator=(FUNC);
+// [ 7] unique_function& operator=(nullptr_t);
+// [ 7] void swap(unique_function&);
+//
+// ACCESSORS
+// [ 3] RET operator()(ARGS...) const;
+// [ 4] operator bool() const;
+// [ 2] Allocator *allocator() const;
+// [ 2] bool is_inplace() const;
+// [ 4] TYPE *target();
+// [ 4] const TYPE *target() const;
+// [ 4] const std::type_info& target_type() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const inplace_function&, nullptr_t);
+// [ 4] bool operator==(nullptr_t, const inplace_function&);
+// [ 4] bool operator!=(const inplace_function&, nullptr_t);
+// [ 4] bool operator!=(nullptr_t, const inplace_function&);
+// [ 7] bool operator==(const unique_function&, nullptr_t);
+// [ 7] bool operator!=(const unique_function&, nullptr_t);
+// [ 6] void swap(inplace_function&, inplace_function&);
+// [ 7] void swap(unique_function&, unique_function&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 9] USAGE EXAMPLE
+// [ 8] TYPE TRAITS
+// [-1] PERFORMANCE: 'inplace_function' vs. 'function'
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::inplace_function<int(int)>     Obj;
+typedef bsl::unique_function<int(int)>      UniqueObj;
+typedef bsl::inplace_function<int(int), 16> SmallObj;
+
+                            // ==================
+                            // struct SizedFunctor
+                            // ==================
+
+template <int SIZE>
+struct SizedFunctor {
+    // This bitwise movable functor occupies at least 'SIZE' bytes, and adds
+    // its first byte to its argument.
+
+    // DATA
+    char d_data[SIZE];
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SizedFunctor, bslmf::IsBitwiseMoveable);
+
+    // CREATORS
+    explicit SizedFunctor(char value = 1)
+    {
+        memset(d_data, value, SIZE);
+    }
+
+    // ACCESSORS
+    int operator()(int x) const
+    {
+        return x + d_data[0];
+    }
+};
+
+                          // =====================
+                          // class CountingFunctor
+                          // =====================
+
+class CountingFunctor {
+    // This functor, which is nothrow move constructible but not bitwise
+    // movable, counts the number of its objects that are live, and the number
+    // of times it is copied and moved.  It adds its value to its argument.
+
+    // DATA
+    int              d_value;
+    CountingFunctor *d_self_p;  // detects bitwise moves
+
+  public:
+    // CLASS DATA
+    static int s_numLive;
+    static int s_numCopies;
+    static int s_numMoves;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(CountingFunctor,
+                                   bsl::is_nothrow_move_constructible);
+
+    // CLASS METHODS
+    static void resetCounts()
+    {
+        s_numCopies = 0;
+        s_numMoves  = 0;
+    }
+
+    // CREATORS
+    explicit CountingFunctor(int value = 0)
+    : d_value(value)
+    , d_self_p(this)
+    {
+        ++s_numLive;
+    }
+
+    CountingFunctor(const CountingFunctor& original)
+    : d_value(original.d_value)
+    , d_self_p(this)
+    {
+        ASSERT(original.isValid());
+        ++s_numLive;
+        ++s_numCopies;
+    }
+
+    CountingFunctor(bslmf::MovableRef<CountingFunctor> original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+    : d_value(bslmf::MovableRefUtil::access(original).d_value)
+    , d_self_p(this)
+    {
+        ASSERT(bslmf::MovableRefUtil::access(original).isValid());
+        ++s_numLive;
+        ++s_numMoves;
+    }
+
+    ~CountingFunctor()
+    {
+        ASSERT(isValid());
+        --s_numLive;
+    }
+
+    // ACCESSORS
+    bool isValid() const
+    {
+        return this == d_self_p;
+    }
+
+    int operator()(int x) const
+    {
+        ASSERT(isValid());
+        return x + d_value;
+    }
+};
+
+int CountingFunctor::s_numLive   = 0;
+int CountingFunctor::s_numCopies = 0;
+int CountingFunctor::s_numMoves  = 0;
+
+                        // =========================
+                        // class ThrowingMoveFunctor
+                        // =========================
+
+class ThrowingMoveFunctor {
+    // This small functor has a (potentially) throwing copy constructor and no
+    // move constructor, and is therefore always allocated.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    explicit ThrowingMoveFunctor(int value)
+    : d_value(value)
+    {
+    }
+
+    ThrowingMoveFunctor(const ThrowingMoveFunctor& original)
+    : d_value(original.d_value)
+    {
+    }
+
+    // ACCESSORS
+    int operator()(int x) const
+    {
+        return x * d_value;
+    }
+};
+
+                          // ======================
+                          // class AllocatorFunctor
+                          // ======================
+
+class AllocatorFunctor {
+    // This functor uses a 'bslma' allocator to hold a string, and adds the
+    // length of the string to its argument.
+
+    // DATA
+    bsl::string d_string;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AllocatorFunctor,
+                                   bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(AllocatorFunctor,
+                                   bslmf::IsBitwiseMoveable);
+
+    // CREATORS
+    explicit AllocatorFunctor(const char       *value,
+                              bslma::Allocator *basicAllocator = 0)
+    : d_string(value, basicAllocator)
+    {
+    }
+
+    AllocatorFunctor(const AllocatorFunctor&  original,
+                     bslma::Allocator        *basicAllocator = 0)
+    : d_string(original.d_string, basicAllocator)
+    {
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const
+    {
+        return d_string.get_allocator().mechanism();
+    }
+
+    int operator()(int x) const
+    {
+        return x + static_cast<int>(d_string.length());
+    }
+};
+
+                           // =====================
+                           // class MoveOnlyFunctor
+                           // =====================
+
+class MoveOnlyFunctor {
+    // This move-only functor owns an 'int', and adds it to its argument.
+
+    // DATA
+    bslma::ManagedPtr<int> d_value;
+
+  private:
+    // NOT IMPLEMENTED
+    MoveOnlyFunctor(const MoveOnlyFunctor&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MoveOnlyFunctor,
+                                   bsl::is_nothrow_move_constructible);
+
+    // CREATORS
+    MoveOnlyFunctor(int value, bslma::Allocator *basicAllocator)
+    : d_value(new (*basicAllocator) int(value), basicAllocator)
+    {
+    }
+
+    MoveOnlyFunctor(bslmf::MovableRef<MoveOnlyFunctor> original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+    : d_value(bslmf::MovableRefUtil::move(
+                          bslmf::MovableRefUtil::access(original).d_value))
+    {
+    }
+
+    // ACCESSORS
+    int operator()(int x) const
+    {
+        return x + *d_value;
+    }
+};
+
+                        // ==========================
+                        // free functions for testing
+                        // ==========================
+
+int increment(int x)
+    // Return the specified 'x' plus one.
+{
+    return x + 1;
+}
+
+double scale(short value, double factor)
+    // Return the specified 'value' multiplied by the specified 'factor'.
+{
+    return value * factor;
+}
+
+void appendTo(bsl::string *result, const bsl::string& value)
+    // Append the specified 'value' to the specified 'result'.
+{
+    *result += value;
+}
+
+int sum13(int a1, int a2, int a3, int a4, int a5, int a6, int a7,
+          int a8, int a9, int a10, int a11, int a12, int a13)
+    // Return the sum of the specified 'a1' to 'a13'.
+{
+    return a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11 + a12 + a13;
+}
+
+struct NonConstFunctor {
+    // This functor, invocable only as a modifiable object, counts its
+    // invocations.
+
+    // DATA
+    int d_count;
+
+    // MANIPULATORS
+    int operator()(int x)
+    {
+        return x + ++d_count;
+    }
+};
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace UsageExample {
+
+///Example 1: Allocation-Free Callbacks
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that we submit callbacks that capture a price update, consisting of
+// a security identifier, a venue, and two prices, to a dispatcher.  The
+// update is 48 bytes on 64-bit platforms, and does not fit in the in-place
+// buffer of 'bsl::function' together with a pointer to the handler.
+//
+// First, we define the update, and a functor processing it:
+//..
+    struct PriceUpdate {
+        // This 'struct' describes a change of price.
+
+        char   d_security[16];
+        char   d_venue[8];
+        double d_bid;
+        double d_ask;
+        int    d_sequence;
+    };
+
+    class UpdateHandler {
+        // This class keeps the sum of the bid prices it has seen.
+
+        // DATA
+        double d_sum;
+
+      public:
+        // CREATORS
+        UpdateHandler() : d_sum(0) {}
+
+        // MANIPULATORS
+        void onUpdate(const PriceUpdate& update) { d_sum += update.d_bid; }
+
+        // ACCESSORS
+        double sum() const { return d_sum; }
+    };
+
+    struct ProcessUpdate {
+        // This functor applies an update to a handler.
+
+        UpdateHandler *d_handler_p;
+        PriceUpdate    d_update;
+
+        BSLMF_NESTED_TRAIT_DECLARATION(ProcessUpdate,
+                                       bslmf::IsBitwiseMoveable);
+
+        void operator()() const { d_handler_p->onUpdate(d_update); }
+    };
+//..
+
+///Example 2: A Move-Only Callback
+///- - - - - - - - - - - - - - - -
+// Suppose that a callback must own a resource, held by a
+// 'bslma::ManagedPtr', that is released when the callback is destroyed.
+// Since 'bslma::ManagedPtr' cannot be copied, the callback cannot be wrapped
+// by a 'bsl::function' or a 'bsl::inplace_function', but it can be wrapped by
+// a 'bsl::unique_function'.
+//
+// First, we define the callback:
+//..
+    struct ConsumeBuffer {
+        // This functor returns the length of the buffer it owns.
+
+        bslma::ManagedPtr<bsl::string> d_buffer;
+
+        explicit ConsumeBuffer(bslma::ManagedPtr<bsl::string>& buffer)
+        : d_buffer(bslmf::MovableRefUtil::move(buffer))
+        {
+        }
+
+        ConsumeBuffer(bslmf::MovableRef<ConsumeBuffer> original)
+        : d_buffer(bslmf::MovableRefUtil::move(
+                     bslmf::MovableRefUtil::access(original).d_buffer))
+        {
+        }
+
+        int operator()() const
+        {
+            return static_cast<int>(d_buffer->size());
+        }
+    };
+//..
+
+}  // close namespace UsageExample
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace UsageExample;
+
+        {
+// Then, we define the type of the callbacks, having an in-place buffer large
+// enough for 'ProcessUpdate':
+//..
+    typedef bsl::inplace_function<void(), 64> Callback;
+//..
+// Next, we create a callback with a test allocator, and observe that it did
+// not allocate:
+//..
+    bslma::TestAllocator ta;
+    UpdateHandler        handler;
+
+    PriceUpdate   update  = { "IBM US", "XNYS", 130.5, 130.75, 1 };
+    ProcessUpdate process = { &handler, update };
+
+    Callback callback(bsl::allocator_arg, &ta, process);
+    ASSERT(callback.is_inplace());
+    ASSERT(0 == ta.numBlocksTotal());
+//..
+// Then, we copy the callback, for example into a queue of pending callbacks,
+// and invoke the copy.  No memory is allocated either:
+//..
+    bsl::vector<Callback> pending(&ta);
+    pending.reserve(4);
+    const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+    pending.push_back(callback);
+    pending.back()();
+    ASSERT(numBlocks == ta.numBlocksTotal());
+    ASSERT(130.5     == handler.sum());
+//..
+// Finally, we observe that a 'bsl::function' holding the same functor
+// allocates memory:
+//..
+    bsl::function<void()> function(bsl::allocator_arg, &ta, process);
+    ASSERT(numBlocks < ta.numBlocksTotal());
+//..
+        }
+
+        {
+    bslma::TestAllocator ta;
+//..
+// Then, we wrap a 'ConsumeBuffer' object in a 'bsl::unique_function':
+//..
+    bslma::ManagedPtr<bsl::string> buffer(new (ta) bsl::string("payload", &ta),
+                                          &ta);
+    ConsumeBuffer                  consumer(buffer);
+
+    bsl::unique_function<int()> consume(
+                                      bsl::allocator_arg,
+                                      &ta,
+                                      bslmf::MovableRefUtil::move(consumer));
+    ASSERT(7 == consume());
+//..
+// Now, we transfer the callback to another 'bsl::unique_function', leaving
+// the original empty:
+//..
+    bsl::unique_function<int()> next(
+                                       bslmf::MovableRefUtil::move(consume));
+    ASSERT(!consume);
+    ASSERT(7 == next());
+//..
+// Finally, we observe that destroying the callback releases the buffer:
+//..
+    const bsls::Types::Int64 numBlocksInUse = ta.numBlocksInUse();
+    next = bsl::nullptr_t();
+    ASSERT(numBlocksInUse > ta.numBlocksInUse());
+//..
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 Both class templates use 'bslma' allocators, passed with the
+        //:   leading 'bsl::allocator_arg' convention.
+        //:
+        //: 2 Both class templates are nothrow move constructible, and are
+        //:   held in place when wrapped in another function wrapper (of any
+        //:   of the three kinds) that is large enough.
+        //:
+        //: 3 The size of a wrapper is its buffer plus three pointers, rounded
+        //:   up to the maximal alignment.
+        //
+        // Plan:
+        //: 1 Check the traits, and the representation chosen for wrappers of
+        //:   each kind held by each kind.  (C-1..2)
+        //:
+        //: 2 Check 'sizeof' for several buffer sizes.  (C-3)
+        //
+        // Testing:
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTYPE TRAITS"
+                            "\n===========\n");
+
+        ASSERT( bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT( bslma::UsesBslmaAllocator<UniqueObj>::value);
+        ASSERT( bslmf::UsesAllocatorArgT<Obj>::value);
+        ASSERT( bslmf::UsesAllocatorArgT<UniqueObj>::value);
+        ASSERT( bsl::is_nothrow_move_constructible<Obj>::value);
+        ASSERT( bsl::is_nothrow_move_constructible<UniqueObj>::value);
+        ASSERT(!bslmf::IsBitwiseMoveable<Obj>::value);
+
+        ASSERT((bsl::InplaceFunction_IsInplace<Obj, 128>::value));
+        ASSERT((bsl::InplaceFunction_IsInplace<UniqueObj, 128>::value));
+        ASSERT((bsl::InplaceFunction_IsInplace<bsl::function<int(int)>,
+                                               128>::value));
+        ASSERT(!(bsl::InplaceFunction_IsInplace<Obj, 64>::value));
+        ASSERT(!(bsl::InplaceFunction_IsInplace<ThrowingMoveFunctor,
+                                                128>::value));
+        ASSERT((bsl::InplaceFunction_IsInplace<CountingFunctor, 16>::value));
+        ASSERT((bsl::InplaceFunction_IsInplace<SizedFunctor<16>, 16>::value));
+        ASSERT(!(bsl::InplaceFunction_IsInplace<SizedFunctor<17>,
+                                                16>::value));
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            const Obj X(bsl::allocator_arg, &oa, SizedFunctor<8>(3));
+
+            bsl::inplace_function<int(int), 128> mY(bsl::allocator_arg,
+                                                    &oa,
+                                                    X);
+            ASSERT(mY.is_inplace());
+            ASSERT(0 != mY.target<Obj>());
+            ASSERT(4 == mY(1));
+
+            bsl::function<int(int)> mZ(bsl::allocator_arg, &oa, X);
+            ASSERT(4 == mZ(1));
+
+            bsl::inplace_function<int(int), 128> mW(bsl::allocator_arg,
+                                                    &oa,
+                                                    mZ);
+            ASSERT(mW.is_inplace());
+            ASSERT(4 == mW(1));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        typedef bsls::AlignmentUtil Align;
+
+        const std::size_t k_PTRS = 3 * sizeof(void *);
+
+        ASSERT(sizeof(Obj) == Align::roundUpToMaximalAlignment(
+                     bsl::InplaceFunction_Util::k_DEFAULT_INPLACE_SIZE
+                   + k_PTRS));
+        ASSERT(sizeof(SmallObj) ==
+                              Align::roundUpToMaximalAlignment(16 + k_PTRS));
+        ASSERT((sizeof(bsl::inplace_function<void(), 96>) ==
+                              Align::roundUpToMaximalAlignment(96 + k_PTRS)));
+        ASSERT(sizeof(UniqueObj) == sizeof(Obj));
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'unique_function'
+        //
+        // Concerns:
+        //: 1 'unique_function' wraps move-only targets, in place or
+        //:   allocated, and copyable targets.
+        //:
+        //: 2 Moving a 'unique_function' relocates its target without
+        //:   allocating, and leaves the source empty.
+        //:
+        //: 3 Moving with a different allocator move-constructs the target
+        //:   with that allocator, and releases the memory of the source.
+        //:
+        //: 4 Assignment, swap, comparison with 'nullptr', and null targets
+        //:   behave as for 'inplace_function'.
+        //
+        // Plan:
+        //: 1 Wrap 'MoveOnlyFunctor' objects in 'unique_function' objects with
+        //:   buffers large enough to hold them, and too small, and exercise
+        //:   each creator and manipulator, checking results and test
+        //:   allocators.  (C-1..4)
+        //
+        // Testing:
+        //   unique_function();
+        //   unique_function(nullptr_t);
+        //   unique_function(allocator_arg_t, Allocator *);
+        //   unique_function(allocator_arg_t, Allocator *, nullptr_t);
+        //   unique_function(FUNC);
+        //   unique_function(allocator_arg_t, Allocator *, FUNC);
+        //   unique_function(MovableRef<unique_function>);
+        //   unique_function(allocator_arg_t, Allocator *, MovableRef<un...>);
+        //   ~unique_function();
+        //   unique_function& operator=(MovableRef<unique_function>);
+        //   unique_function& operator=(FUNC);
+        //   unique_function& operator=(nullptr_t);
+        //   void swap(unique_function&);
+        //   bool operator==(const unique_function&, nullptr_t);
+        //   bool operator!=(const unique_function&, nullptr_t);
+        //   void swap(unique_function&, unique_function&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'unique_function'"
+                            "\n=================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\tEmpty objects.\n");
+        {
+            UniqueObj mA;
+            UniqueObj mB((bsl::nullptr_t()));
+            UniqueObj mC(bsl::allocator_arg, &oa);
+            UniqueObj mD(bsl::allocator_arg, &oa, bsl::nullptr_t());
+
+            ASSERT(!mA && !mB && !mC && !mD);
+            ASSERT(&defaultAllocator == mA.allocator());
+            ASSERT(&defaultAllocator == mB.allocator());
+            ASSERT(&oa               == mC.allocator());
+            ASSERT(&oa               == mD.allocator());
+            ASSERT(mA == bsl::nullptr_t());
+            ASSERT(bsl::nullptr_t() == mA);
+        }
+
+        if (verbose) printf("\tMove-only targets.\n");
+        {
+            MoveOnlyFunctor f(10, &oa);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            UniqueObj mX(bsl::allocator_arg, &oa, MoveUtil::move(f));
+            ASSERT(mX.is_inplace());
+            ASSERT(11 == mX(1));
+            ASSERT(1  == oa.numBlocksInUse());
+            ASSERT(mX != bsl::nullptr_t());
+            ASSERT(bsl::nullptr_t() != mX);
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            UniqueObj mY(MoveUtil::move(mX));
+            ASSERT(!mX);
+            ASSERT(11  == mY(1));
+            ASSERT(&oa == mY.allocator());
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            MoveOnlyFunctor g(20, &oa);
+            bsl::unique_function<int(int), sizeof(void *)> mS(
+                                                        bsl::allocator_arg,
+                                                        &oa,
+                                                        MoveUtil::move(g));
+            ASSERT(!mS.is_inplace());
+            ASSERT(21 == mS(1));
+            ASSERT(3  == oa.numBlocksInUse());
+
+            bsl::unique_function<int(int), sizeof(void *)> mT(
+                                                         MoveUtil::move(mS));
+            ASSERT(!mS);
+            ASSERT(21 == mT(1));
+            ASSERT(3  == oa.numBlocksInUse());
+
+            // Move to a different allocator.
+
+            bsl::unique_function<int(int), sizeof(void *)> mU(
+                                                        bsl::allocator_arg,
+                                                        &za,
+                                                        MoveUtil::move(mT));
+            ASSERT(!mT);
+            ASSERT(21 == mU(1));
+            ASSERT(2  == oa.numBlocksInUse());
+            ASSERT(1  == za.numBlocksInUse());
+
+            UniqueObj mV(bsl::allocator_arg, &za, MoveUtil::move(mY));
+            ASSERT(!mY);
+            ASSERT(11 == mV(1));
+            ASSERT(mV.is_inplace());
+            ASSERT(1  == za.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tCopyable targets.\n");
+        {
+            UniqueObj mX(&increment);
+            ASSERT(2 == mX(1));
+
+            UniqueObj mY(bsl::allocator_arg, &oa, SizedFunctor<128>(5));
+            ASSERT(!mY.is_inplace());
+            ASSERT(6 == mY(1));
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tAssignment and swap.\n");
+        {
+            UniqueObj mX(bsl::allocator_arg, &oa);
+            UniqueObj mY(bsl::allocator_arg, &oa);
+
+            MoveOnlyFunctor f(10, &oa);
+            mX = MoveUtil::move(f);
+            ASSERT(11 == mX(1));
+            ASSERT(1  == oa.numBlocksInUse());
+
+            mY = &increment;
+            ASSERT(2  == mY(1));
+
+            swap(mX, mY);
+            ASSERT(2  == mX(1));
+            ASSERT(11 == mY(1));
+
+            mX.swap(mY);
+            ASSERT(11 == mX(1));
+            ASSERT(2  == mY(1));
+
+            mY = MoveUtil::move(mX);
+            ASSERT(!mX);
+            ASSERT(11 == mY(1));
+            ASSERT(1  == oa.numBlocksInUse());
+
+            mY = MoveUtil::move(mY);
+            ASSERT(11 == mY(1));
+
+            UniqueObj mZ(bsl::allocator_arg, &za);
+            mZ = MoveUtil::move(mY);
+            ASSERT(!mY);
+            ASSERT(11 == mZ(1));
+            ASSERT(mZ.is_inplace());
+            ASSERT(1  == oa.numBlocksInUse());
+            ASSERT(0  == za.numBlocksInUse());
+
+            mZ = bsl::nullptr_t();
+            ASSERT(!mZ);
+            ASSERT(0 == oa.numBlocksInUse());
+
+            int (*nullFunction)(int) = 0;
+            mZ = nullFunction;
+            ASSERT(!mZ);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ASSIGNMENT AND SWAP
+        //
+        // Concerns:
+        //: 1 Assignment never changes the allocator of the assigned object.
+        //:
+        //: 2 Copy assignment copies the target with the allocator of the
+        //:   assigned object; assigning a function object moves it into the
+        //:   assigned object.
+        //:
+        //: 3 Move assignment between objects having the same allocator
+        //:   relocates the target without allocating or copying it, and
+        //:   leaves the source empty; with different allocators, the target
+        //:   is move-constructed with the allocator of the assigned object.
+        //:
+        //: 4 Self-assignment leaves the object unchanged.
+        //:
+        //: 5 Assigning 'nullptr' or a null target empties the object and
+        //:   releases its memory.
+        //:
+        //: 6 'swap' exchanges targets of any representation without copying
+        //:   or allocating.
+        //
+        // Plan:
+        //: 1 Using in-place and allocated 'CountingFunctor' targets (the
+        //:   latter in a 'SmallObj' having too small a buffer), perform each
+        //:   assignment and swap, checking the results, the allocator, the
+        //:   copy and move counts, and test allocators.  (C-1..6)
+        //
+        // Testing:
+        //   inplace_function& operator=(const inplace_function&);
+        //   inplace_function& operator=(MovableRef<inplace_function>);
+        //   inplace_function& operator=(FUNC);
+        //   inplace_function& operator=(nullptr_t);
+        //   void swap(inplace_function&);
+        //   void swap(inplace_function&, inplace_function&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nASSIGNMENT AND SWAP"
+                            "\n===================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\tCopy assignment.\n");
+        {
+            Obj       mX(bsl::allocator_arg, &oa, CountingFunctor(1));
+            const Obj Y(bsl::allocator_arg, &za, SizedFunctor<128>(2));
+            ASSERT(1 == za.numBlocksInUse());
+
+            mX = Y;
+            ASSERT(&oa == mX.allocator());
+            ASSERT(3   == mX(1));
+            ASSERT(1   == oa.numBlocksInUse());
+            ASSERT(0   == CountingFunctor::s_numLive);
+
+            CountingFunctor::resetCounts();
+
+            const Obj Z(bsl::allocator_arg, &za, CountingFunctor(5));
+            mX = Z;
+            ASSERT(6 == mX(1));
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(1 == CountingFunctor::s_numCopies);
+
+            mX = mX;
+            ASSERT(6 == mX(1));
+        }
+        ASSERT(0 == CountingFunctor::s_numLive);
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tAssignment of function objects.\n");
+        {
+            Obj mX(bsl::allocator_arg, &oa);
+
+            CountingFunctor::resetCounts();
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            CountingFunctor f(4);
+            mX = f;
+            ASSERT(5 == mX(1));
+            ASSERT(1 == CountingFunctor::s_numCopies);
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            mX = SizedFunctor<128>(2);
+            ASSERT(3 == mX(1));
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(1 == CountingFunctor::s_numLive);
+
+            mX = &increment;
+            ASSERT(2 == mX(1));
+            ASSERT(0 == oa.numBlocksInUse());
+
+            int (*nullFunction)(int) = 0;
+            mX = nullFunction;
+            ASSERT(!mX);
+
+            mX = &increment;
+            mX = bsl::nullptr_t();
+            ASSERT(!mX);
+            ASSERT(&oa == mX.allocator());
+        }
+        ASSERT(0 == CountingFunctor::s_numLive);
+
+        if (verbose) printf("\tMove assignment.\n");
+        {
+            SmallObj mX(bsl::allocator_arg, &oa, CountingFunctor(1));
+            SmallObj mY(bsl::allocator_arg, &oa, SizedFunctor<64>(2));
+            ASSERT(1 == oa.numBlocksInUse());
+
+            CountingFunctor::resetCounts();
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            mY = MoveUtil::move(mX);
+            ASSERT(!mX);
+            ASSERT(2 == mY(1));
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == CountingFunctor::s_numCopies);
+            ASSERT(1 == CountingFunctor::s_numMoves);
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            mY = MoveUtil::move(mY);
+            ASSERT(2 == mY(1));
+
+            SmallObj mZ(bsl::allocator_arg, &oa, SizedFunctor<64>(7));
+            mY = MoveUtil::move(mZ);
+            ASSERT(!mZ);
+            ASSERT(8 == mY(1));
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(numBlocks + 1 == oa.numBlocksTotal());
+
+            SmallObj mW(bsl::allocator_arg, &za);
+            mW = MoveUtil::move(mY);
+            ASSERT(!mY);
+            ASSERT(8   == mW(1));
+            ASSERT(&za == mW.allocator());
+            ASSERT(0   == oa.numBlocksInUse());
+            ASSERT(1   == za.numBlocksInUse());
+        }
+        ASSERT(0 == CountingFunctor::s_numLive);
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            SmallObj mX(bsl::allocator_arg, &oa, CountingFunctor(1));
+            SmallObj mY(bsl::allocator_arg, &oa, SizedFunctor<64>(2));
+            SmallObj mE(bsl::allocator_arg, &oa);
+
+            CountingFunctor::resetCounts();
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            mX.swap(mY);
+            ASSERT(3 == mX(1));
+            ASSERT(2 == mY(1));
+            ASSERT(!mX.is_inplace());
+            ASSERT( mY.is_inplace());
+
+            swap(mX, mY);
+            ASSERT(2 == mX(1));
+            ASSERT(3 == mY(1));
+
+            mE.swap(mX);
+            ASSERT(!mX);
+            ASSERT(2 == mE(1));
+
+            mE.swap(mE);
+            ASSERT(2 == mE(1));
+
+            ASSERT(0 == CountingFunctor::s_numCopies);
+            ASSERT(numBlocks == oa.numBlocksTotal());
+            ASSERT(1 == CountingFunctor::s_numLive);
+        }
+        ASSERT(0 == CountingFunctor::s_numLive);
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY AND MOVE CONSTRUCTION
+        //
+        // Concerns:
+        //: 1 The copy constructor copies the target once, using the default
+        //:   allocator unless one is supplied.
+        //:
+        //: 2 The move constructor keeps the allocator of the source, does not
+        //:   copy or allocate, relocates (bitwise if possible) the target,
+        //:   and leaves the source empty.
+        //:
+        //: 3 The extended move constructor relocates the target if the
+        //:   allocators are the same, and otherwise move-constructs it with
+        //:   the supplied allocator.
+        //:
+        //: 4 Targets using 'bslma' allocators get the allocator of the
+        //:   wrapper.
+        //:
+        //: 5 Copying or moving an empty wrapper produces an empty wrapper.
+        //
+        // Plan:
+        //: 1 For in-place and allocated targets, copy and move wrappers with
+        //:   and without allocators, checking results, copy and move counts,
+        //:   the allocators of wrappers and targets, and test allocators.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   inplace_function(const inplace_function&);
+        //   inplace_function(allocator_arg_t, Allocator *, const inpla...&);
+        //   inplace_function(MovableRef<inplace_function>);
+        //   inplace_function(allocator_arg_t, Allocator *, MovableRef<in...>);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY AND MOVE CONSTRUCTION"
+                            "\n==========================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\tIn-place targets.\n");
+        {
+            const Obj X(bsl::allocator_arg, &oa, CountingFunctor(3));
+
+            CountingFunctor::resetCounts();
+
+            const Obj Y(X);
+            ASSERT(4                 == Y(1));
+            ASSERT(&defaultAllocator == Y.allocator());
+            ASSERT(1                 == CountingFunctor::s_numCopies);
+            ASSERT(0                 == CountingFunctor::s_numMoves);
+
+            const Obj Z(bsl::allocator_arg, &za, X);
+            ASSERT(4   == Z(1));
+            ASSERT(&za == Z.allocator());
+            ASSERT(2   == CountingFunctor::s_numCopies);
+
+            Obj mA(bsl::allocator_arg, &oa, X);
+            Obj mB(MoveUtil::move(mA));
+            ASSERT(!mA);
+            ASSERT(4   == mB(1));
+            ASSERT(&oa == mB.allocator());
+            ASSERT(3   == CountingFunctor::s_numCopies);
+            ASSERT(1   == CountingFunctor::s_numMoves);
+
+            Obj mC(bsl::allocator_arg, &za, MoveUtil::move(mB));
+            ASSERT(!mB);
+            ASSERT(4   == mC(1));
+            ASSERT(&za == mC.allocator());
+            ASSERT(3   == CountingFunctor::s_numCopies);
+            ASSERT(2   == CountingFunctor::s_numMoves);
+
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(0 == za.numBlocksTotal());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERT(0 == CountingFunctor::s_numLive);
+
+        if (verbose) printf("\tAllocated targets.\n");
+        {
+            const SmallObj X(bsl::allocator_arg, &oa, CountingFunctor(3));
+            const SmallObj W(bsl::allocator_arg, &oa, SizedFunctor<64>(2));
+            ASSERT( X.is_inplace());
+            ASSERT(!W.is_inplace());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            const SmallObj Y(W);
+            ASSERT(3 == Y(1));
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+
+            SmallObj mA(bsl::allocator_arg, &oa, W);
+            ASSERT(2 == oa.numBlocksInUse());
+
+            const bsls::Types::Int64 numBlocks = oa.numBlocksTotal();
+
+            SmallObj mB(MoveUtil::move(mA));
+            ASSERT(!mA);
+            ASSERT(3 == mB(1));
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            SmallObj mC(bsl::allocator_arg, &oa, MoveUtil::move(mB));
+            ASSERT(!mB);
+            ASSERT(3 == mC(1));
+            ASSERT(numBlocks == oa.numBlocksTotal());
+
+            SmallObj mD(bsl::allocator_arg, &za, MoveUtil::move(mC));
+            ASSERT(!mC);
+            ASSERT(3 == mD(1));
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(1 == za.numBlocksInUse());
+
+            ThrowingMoveFunctor t(5);
+            Obj                 mE(bsl::allocator_arg, &oa, t);
+            ASSERT(!mE.is_inplace());
+            ASSERT(10 == mE(2));
+
+            Obj mF(MoveUtil::move(mE));
+            ASSERT(10 == mF(2));
+            ASSERT(2  == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\tTargets using allocators.\n");
+        {
+            const AllocatorFunctor f("a string long enough to allocate", &za);
+
+            Obj mX(bsl::allocator_arg, &oa, f);
+            ASSERT(mX.is_inplace());
+            ASSERT(&oa == mX.target<AllocatorFunctor>()->allocator());
+            ASSERT(33  == mX(1));
+
+            const Obj Y(bsl::allocator_arg, &za, mX);
+            ASSERT(&za == Y.target<AllocatorFunctor>()->allocator());
+
+            Obj mZ(bsl::allocator_arg, &za, MoveUtil::move(mX));
+            ASSERT(&za == mZ.target<AllocatorFunctor>()->allocator());
+            ASSERT(33  == mZ(1));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tEmpty wrappers.\n");
+        {
+            Obj mX(bsl::allocator_arg, &oa);
+
+            const Obj Y(mX);
+            ASSERT(!Y);
+
+            const Obj Z(bsl::allocator_arg, &za, mX);
+            ASSERT(!Z);
+
+            Obj mW(MoveUtil::move(mX));
+            ASSERT(!mW);
+            ASSERT(&oa == mW.allocator());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // NULL TARGETS AND TARGET ACCESS
+        //
+        // Concerns:
+        //: 1 A null function pointer, and empty 'bsl::function',
+        //:   'inplace_function', and 'unique_function' objects, produce empty
+        //:   wrappers, which compare equal to 'nullptr' and convert to
+        //:   'false'.
+        //:
+        //: 2 'target' returns the address of the target only if it has the
+        //:   requested type, for in-place and allocated targets, and
+        //:   'target_type' reports the type of the target, or 'void'.
+        //
+        // Plan:
+        //: 1 Create wrappers from null targets and check that they are empty.
+        //:   (C-1)
+        //:
+        //: 2 Check 'target' and 'target_type' on empty wrappers, and on
+        //:   wrappers holding function pointers, and in-place and allocated
+        //:   functors.  (C-2)
+        //
+        // Testing:
+        //   operator bool() const;
+        //   TYPE *target();
+        //   const TYPE *target() const;
+        //   const std::type_info& target_type() const;
+        //   bool operator==(const inplace_function&, nullptr_t);
+        //   bool operator==(nullptr_t, const inplace_function&);
+        //   bool operator!=(const inplace_function&, nullptr_t);
+        //   bool operator!=(nullptr_t, const inplace_function&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nNULL TARGETS AND TARGET ACCESS"
+                            "\n==============================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            int (*nullFunction)(int) = 0;
+
+            const bsl::function<int(int)> EF;
+            const Obj                     EO;
+            const SmallObj                ES;
+            UniqueObj                     mEU;
+
+            const Obj A(bsl::allocator_arg, &oa, nullFunction);
+            const Obj B(bsl::allocator_arg, &oa, EF);
+            const Obj C(bsl::allocator_arg, &oa, ES);
+            const Obj D(bsl::allocator_arg, &oa, EO);
+            UniqueObj mE(bsl::allocator_arg,
+                         &oa,
+                         bslmf::MovableRefUtil::move(mEU));
+
+            ASSERT(!A && !B && !C && !D && !mE);
+            ASSERT(A == bsl::nullptr_t() && bsl::nullptr_t() == A);
+            ASSERT(!(A != bsl::nullptr_t()) && !(bsl::nullptr_t() != A));
+            ASSERT(B == bsl::nullptr_t() && C == bsl::nullptr_t());
+
+            ASSERT(typeid(void) == A.target_type());
+            ASSERT(0            == A.target<int(*)(int)>());
+            ASSERT(0            == oa.numBlocksTotal());
+
+            const Obj F(bsl::allocator_arg, &oa, &increment);
+            ASSERT(F);
+            ASSERT(F != bsl::nullptr_t() && bsl::nullptr_t() != F);
+            ASSERT(!(F == bsl::nullptr_t()));
+        }
+
+        {
+            Obj mX(bsl::allocator_arg, &oa, &increment);
+            ASSERT(typeid(int(*)(int)) == mX.target_type());
+            ASSERT(0 != mX.target<int(*)(int)>());
+            ASSERT(&increment == *mX.target<int(*)(int)>());
+            ASSERT(0 == mX.target<CountingFunctor>());
+
+            mX = CountingFunctor(4);
+            ASSERT(typeid(CountingFunctor) == mX.target_type());
+            ASSERT(0 == mX.target<int(*)(int)>());
+            ASSERT(0 != mX.target<CountingFunctor>());
+            ASSERT(5 == (*mX.target<CountingFunctor>())(1));
+
+            const Obj& X = mX;
+            ASSERT(X.target<CountingFunctor>() ==
+                                                mX.target<CountingFunctor>());
+
+            mX = SizedFunctor<128>(2);
+            ASSERT(!mX.is_inplace());
+            ASSERT(typeid(SizedFunctor<128>) == mX.target_type());
+            ASSERT(2 == X.target<SizedFunctor<128> >()->d_data[0]);
+
+            // The target can be modified.
+
+            mX.target<SizedFunctor<128> >()->d_data[0] = 9;
+            ASSERT(10 == mX(1));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INVOCATION
+        //
+        // Concerns:
+        //: 1 Arguments are forwarded to the target, including by reference,
+        //:   for any number of arguments up to 13.
+        //:
+        //: 2 The result of the target is converted to the return type of the
+        //:   prototype, and discarded if that type is 'void'.
+        //:
+        //: 3 A target is invoked as a modifiable object, although the call
+        //:   operator of the wrapper is 'const'.
+        //:
+        //: 4 Invoking an empty wrapper throws 'bsl::bad_function_call' if
+        //:   exceptions are enabled.
+        //
+        // Plan:
+        //: 1 Invoke wrappers of free functions and functors having various
+        //:   prototypes, and check the results and side effects.  (C-1..3)
+        //:
+        //: 2 Invoke an empty wrapper, and check that 'bad_function_call' is
+        //:   thrown.  (C-4)
+        //
+        // Testing:
+        //   RET operator()(ARGS...) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINVOCATION"
+                            "\n==========\n");
+
+        {
+            const bsl::inplace_function<double(short, double)> X(&scale);
+            ASSERT(5.0 == X(2, 2.5));
+
+            const bsl::inplace_function<int(short, double)> Y(&scale);
+            ASSERT(5   == Y(2, 2.6));
+
+            const bsl::inplace_function<void(int)> Z(&increment);
+            Z(1);
+        }
+
+        {
+            bsl::string result("x");
+            const bsl::inplace_function<void(bsl::string *,
+                                             const bsl::string&)> X(&appendTo);
+            X(&result, bsl::string("yz"));
+            ASSERT("xyz" == result);
+        }
+
+        {
+            const bsl::inplace_function<int(int, int, int, int, int, int, int,
+                                            int, int, int, int, int, int)>
+                                                                    X(&sum13);
+            ASSERT(91 == X(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13));
+
+            const bsl::unique_function<int(int, int, int, int, int, int, int,
+                                           int, int, int, int, int, int)>
+                                                                    Y(&sum13);
+            ASSERT(13 == Y(1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1));
+        }
+
+        {
+            NonConstFunctor f = { 0 };
+            const Obj       X(f);
+            ASSERT(2 == X(1));
+            ASSERT(3 == X(1));
+            ASSERT(0 == f.d_count);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        {
+            const Obj X;
+            bool      caught = false;
+            try {
+                X(1);
+            }
+            catch (const bsl::bad_function_call&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            const UniqueObj Y;
+            caught = false;
+            try {
+                Y(1);
+            }
+            catch (const bsl::bad_function_call&) {
+                caught = true;
+            }
+            ASSERT(caught);
+        }
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND STORAGE
+        //
+        // Concerns:
+        //: 1 Default and 'nullptr' creators produce empty objects using the
+        //:   default allocator, or the supplied one, and do not allocate.
+        //:
+        //: 2 A target is held in place if and only if it fits in the buffer,
+        //:   is not over-aligned, and is bitwise movable or nothrow move
+        //:   constructible; otherwise it is allocated from the allocator of
+        //:   the wrapper (or the default allocator).
+        //:
+        //: 3 The target is moved, not copied, into the wrapper.
+        //:
+        //: 4 The destructor destroys the target and releases its memory.
+        //:
+        //: 5 If the construction of an allocated target throws, the memory is
+        //:   released.
+        //
+        // Plan:
+        //: 1 Create empty objects, and check 'allocator', 'is_inplace', and
+        //:   test allocators.  (C-1)
+        //:
+        //: 2 Create objects from functors of sizes around the buffer size,
+        //:   and from functors that are or are not nothrow movable, and
+        //:   check 'is_inplace', the invocation, the counts of copies, moves,
+        //:   and live objects, and the test allocators.  (C-2..4)
+        //:
+        //: 3 Create an allocated target with a test allocator that throws,
+        //:   and verify that no memory is leaked.  (C-5)
+        //
+        // Testing:
+        //   inplace_function();
+        //   inplace_function(nullptr_t);
+        //   inplace_function(allocator_arg_t, Allocator *);
+        //   inplace_function(allocator_arg_t, Allocator *, nullptr_t);
+        //   inplace_function(FUNC);
+        //   inplace_function(allocator_arg_t, Allocator *, FUNC);
+        //   ~inplace_function();
+        //   Allocator *allocator() const;
+        //   bool is_inplace() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS AND STORAGE"
+                            "\n====================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tEmpty objects.\n");
+        {
+            const Obj A;
+            const Obj B((bsl::nullptr_t()));
+            const Obj C(bsl::allocator_arg, &oa);
+            const Obj D(bsl::allocator_arg, &oa, bsl::nullptr_t());
+            const Obj E(bsl::allocator_arg, 0);
+
+            ASSERT(!A && !B && !C && !D && !E);
+            ASSERT(&defaultAllocator == A.allocator());
+            ASSERT(&defaultAllocator == B.allocator());
+            ASSERT(&oa               == C.allocator());
+            ASSERT(&oa               == D.allocator());
+            ASSERT(&defaultAllocator == E.allocator());
+            ASSERT(A.is_inplace());
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tIn-place and allocated targets.\n");
+        {
+            const SmallObj A(bsl::allocator_arg, &oa, SizedFunctor<15>(1));
+            const SmallObj B(bsl::allocator_arg, &oa, SizedFunctor<16>(2));
+            ASSERT(A.is_inplace());
+            ASSERT(B.is_inplace());
+            ASSERT(2 == A(1));
+            ASSERT(3 == B(1));
+            ASSERT(0 == oa.numBlocksTotal());
+
+            const SmallObj C(bsl::allocator_arg, &oa, SizedFunctor<17>(3));
+            ASSERT(!C.is_inplace());
+            ASSERT(4 == C(1));
+            ASSERT(1 == oa.numBlocksInUse());
+
+            const SmallObj D(SizedFunctor<17>(4));
+            ASSERT(!D.is_inplace());
+            ASSERT(5 == D(1));
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+
+            const Obj E(bsl::allocator_arg, &oa, ThrowingMoveFunctor(3));
+            ASSERT(!E.is_inplace());
+            ASSERT(6 == E(2));
+            ASSERT(2 == oa.numBlocksInUse());
+
+            const Obj F(bsl::allocator_arg, &oa, &increment);
+            ASSERT(F.is_inplace());
+            ASSERT(2 == F(1));
+            ASSERT(2 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\tTargets are moved, not copied.\n");
+        {
+            CountingFunctor::resetCounts();
+            {
+                CountingFunctor f(2);
+
+                const Obj X(bsl::allocator_arg, &oa, f);
+                ASSERT(X.is_inplace());
+                ASSERT(3 == X(1));
+                ASSERT(2 == CountingFunctor::s_numLive);
+
+                // One copy into the by-value parameter, then moves only.
+
+                ASSERT(1 == CountingFunctor::s_numCopies);
+            }
+            ASSERT(0 == CountingFunctor::s_numLive);
+
+            CountingFunctor::resetCounts();
+            {
+                const bsl::inplace_function<int(int), sizeof(void *)> X(
+                                                         bsl::allocator_arg,
+                                                         &oa,
+                                                         CountingFunctor(2));
+                ASSERT(!X.is_inplace());
+                ASSERT(3 == X(1));
+                ASSERT(1 == CountingFunctor::s_numLive);
+                ASSERT(0 == CountingFunctor::s_numCopies);
+                ASSERT(1 == oa.numBlocksInUse());
+            }
+            ASSERT(0 == CountingFunctor::s_numLive);
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\tException neutrality.\n");
+        {
+            bslma::TestAllocator ta("throwing", veryVeryVeryVerbose);
+            ta.setAllocationLimit(0);
+
+            bool caught = false;
+            try {
+                const Obj X(bsl::allocator_arg, &ta, SizedFunctor<128>(1));
+            }
+            catch (const bslma::TestAllocatorException&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Wrap a function pointer, a small functor, and a large functor,
+        //:   then copy, move, invoke, and reset the wrappers.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(bsl::allocator_arg, &oa, &increment);  const Obj& X = mX;
+        ASSERT(X);
+        ASSERT(X.is_inplace());
+        ASSERT(2 == X(1));
+
+        mX = SizedFunctor<32>(5);
+        ASSERT(X.is_inplace());
+        ASSERT(6 == X(1));
+        ASSERT(0 == oa.numBlocksTotal());
+
+        Obj mY(bsl::allocator_arg, &oa, X);  const Obj& Y = mY;
+        ASSERT(6 == Y(1));
+        ASSERT(0 == oa.numBlocksTotal());
+
+        mX = SizedFunctor<256>(7);
+        ASSERT(!X.is_inplace());
+        ASSERT(8 == X(1));
+        ASSERT(1 == oa.numBlocksInUse());
+
+        mY = X;
+        ASSERT(8 == Y(1));
+        ASSERT(2 == oa.numBlocksInUse());
+
+        Obj mZ(bslmf::MovableRefUtil::move(mX));  const Obj& Z = mZ;
+        ASSERT(!X);
+        ASSERT(8 == Z(1));
+        ASSERT(2 == oa.numBlocksInUse());
+
+        mY = bsl::nullptr_t();
+        ASSERT(!Y);
+        ASSERT(1 == oa.numBlocksInUse());
+
+        MoveOnlyFunctor f(10, &oa);
+        UniqueObj       mU(bsl::allocator_arg,
+                           &oa,
+                           bslmf::MovableRefUtil::move(f));
+        ASSERT(11 == mU(1));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'inplace_function' vs. 'function'
+        //
+        // Concerns:
+        //: 1 Creating and copying an 'inplace_function' holding a functor
+        //:   that is too large for the in-place buffer of 'bsl::function' is
+        //:   faster than doing the same with a 'bsl::function'.
+        //
+        // Plan:
+        //: 1 For functors of several sizes, time creating a wrapper, copying
+        //:   it, and invoking the copy, for 'bsl::function' and for
+        //:   'bsl::inplace_function' having a 96-byte buffer, and report the
+        //:   best of several runs.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'inplace_function' vs. 'function'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'inplace_function' vs. 'function'"
+                            "\n=============================================="
+                            "\n");
+
+        typedef bsl::function<int(int)>             Function;
+        typedef bsl::inplace_function<int(int), 96> Inplace;
+
+        const int NUM_ITERATIONS = 1 << 20;
+        const int NUM_RUNS       = 5;
+
+        // Use the new-delete allocator, as a thread pool would use the default
+        // allocator.
+
+        bslma::Allocator *oa = &bslma::NewDeleteAllocator::singleton();
+
+        printf("%5s  %14s  %14s\n", "size", "function (ns)", "inplace (ns)");
+
+        for (int size = 0; size < 4; ++size) {
+            double time[2] = { 1e9, 1e9 };
+            long   sum[2]  = { 0, 0 };
+
+            for (int run = 0; run < NUM_RUNS; ++run) {
+                for (int kind = 0; kind < 2; ++kind) {
+                    bsls::Stopwatch timer;
+
+                    sum[kind] = 0;
+                    timer.start();
+                    for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                        switch (size * 2 + kind) {
+#define U_TIME(INDEX, TYPE, SIZE)                                             \
+                          case INDEX: {                                       \
+                            const SizedFunctor<SIZE> f(static_cast<char>(i)); \
+                            TYPE mX(bsl::allocator_arg, oa, f);               \
+                            TYPE mY(bsl::allocator_arg, oa, mX);              \
+                            sum[kind] += mY(i);                               \
+                          } break;
+                          U_TIME(0, Function, 16)
+                          U_TIME(1, Inplace,  16)
+                          U_TIME(2, Function, 48)
+                          U_TIME(3, Inplace,  48)
+                          U_TIME(4, Function, 64)
+                          U_TIME(5, Inplace,  64)
+                          U_TIME(6, Function, 96)
+                          U_TIME(7, Inplace,  96)
+#undef U_TIME
+                        }
+                    }
+                    timer.stop();
+                    time[kind] = native_std::min(time[kind],
+                                                 timer.elapsedTime());
+                }
+            }
+            ASSERTV(size, sum[0] == sum[1]);
+
+            static const int SIZES[] = { 16, 48, 64, 96 };
+
+            printf("%5d  %14.1f  %14.1f\n",
+                   SIZES[size],
+                   time[0] * 1e9 / NUM_ITERATIONS,
+                   time[1] * 1e9 / NUM_ITERATIONS);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,2360 @@
+// bslstl_smallvector.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#define INCLUDED_BSLSTL_SMALLVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector that holds a few elements without allocating.
+//
+//@CLASSES:
+//   bsl::small_vector: vector with inline capacity for 'N' elements
+//
+//@SEE_ALSO: bslstl_vector, bslalg_arrayprimitives
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::small_vector', implementing a sequence container that stores its
+// elements contiguously, in the manner of 'bsl::vector', but that holds up to
+// a fixed number of elements (the *inline* *capacity*, specified by a template
+// parameter) in a buffer within the object itself.  Only when the size of a
+// 'small_vector' grows beyond its inline capacity are its elements moved to
+// memory supplied by its allocator, after which the 'small_vector' behaves as
+// a 'bsl::vector'.
+//
+// A 'small_vector' is appropriate for the many short sequences, typically of
+// no more than a handful of elements, built and destroyed in performance
+// critical code (e.g., the repeated fields of a decoded message), where the
+// allocation made by a 'bsl::vector' on its first insertion costs more than
+// the rest of the work done with the sequence.  The price is the size of the
+// object, which includes space for the inline elements whether or not they
+// are used, and the loss of constant-time move and swap for sequences held
+// inline.
+//
+// An instantiation of 'small_vector' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of elements) and the
+// sequence of values of its elements; the inline capacity is part of the type
+// rather than the value, and whether the elements are held inline is not
+// salient.
+//
+///Interface
+///---------
+// The interface of 'small_vector' is that of 'bsl::vector' (without the
+// 'vector<bool>' specialization), and its iterators are plain pointers, as
+// those of 'bsl::vector' are, so that code written against
+// 'bsl::vector<VALUE_TYPE>::iterator' will work unchanged.  The differences
+// are:
+//
+//: o 'capacity' never returns less than the inline capacity, and a
+//:   default-constructed 'small_vector' has that capacity.
+//:
+//: o 'shrink_to_fit' moves the elements back into the inline buffer if they
+//:   fit there, releasing the allocated memory.
+//:
+//: o Move construction, move assignment, and 'swap' take constant time only
+//:   if the elements of the source are held in allocated memory and the
+//:   allocators are equal.  Otherwise the elements are moved one by one, and
+//:   iterators into the source are invalidated.
+//:
+//: o 'emplace' and 'emplace_back' are provided only on platforms that support
+//:   variadic templates.
+//
+// An additional accessor, 'is_inline', reports whether the elements are
+// currently held in the inline buffer.
+//
+///Requirements on 'VALUE_TYPE'
+///----------------------------
+// The requirements on 'VALUE_TYPE' are those of 'bsl::vector'.  Elements are
+// relocated (between the inline buffer and allocated memory, or within the
+// sequence on insertion and erasure) using the utilities of
+// 'bslalg::ArrayPrimitives', so that types having the
+// 'bslmf::IsBitwiseMoveable' trait are relocated with 'memcpy' and 'memmove'
+// rather than by move-constructing and destroying each element.  Declaring
+// that trait for an element type is therefore the most effective way of making
+// the growth of a 'small_vector' (and of a 'bsl::vector') cheap.
+//
+// Note that 'small_vector' itself is *not* bitwise movable, since the pointers
+// it holds may refer to its own inline buffer.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'small_vector's 'ALLOCATOR' template parameter
+// determines how the memory for elements that do not fit in the inline buffer
+// will be allocated, exactly as for 'bsl::vector' (see {'bslstl_vector'}).  In
+// particular, if the (template parameter) type 'ALLOCATOR' is
+// 'bsl::allocator' (the default), the 'bslma::Allocator' supplied at
+// construction (or the default allocator) is also passed to each element
+// whose type uses 'bslma' allocators, whether the element is held inline or
+// not.
+//
+// Memory is allocated only when the size of the 'small_vector' exceeds its
+// current capacity, and the capacity then grows geometrically.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Decoding Repeated Fields Without Allocating
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we decode messages whose 'tags' field is a list of integers
+// that, in practice, almost never has more than four entries, and that we
+// decode millions of such messages per second.  Holding the tags in a
+// 'small_vector' having an inline capacity of 4 avoids an allocation for
+// almost every message.
+//
+// First, we define a function that decodes the tags from a comma-separated
+// list:
+//..
+//  template <class VECTOR>
+//  void decodeTags(VECTOR *result, const char *input)
+//      // Load into the specified 'result' the comma-separated integers in
+//      // the specified 'input'.
+//  {
+//      result->clear();
+//      while (*input) {
+//          result->push_back(static_cast<int>(strtol(input, 0, 10)));
+//          input = strchr(input, ',');
+//          if (!input) {
+//              break;
+//          }
+//          ++input;
+//      }
+//  }
+//..
+// Then, we decode a typical message, and observe that no memory is allocated:
+//..
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  bsl::small_vector<int, 4> tags(&oa);
+//
+//  decodeTags(&tags, "7,42,1999");
+//  assert(3    == tags.size());
+//  assert(42   == tags[1]);
+//  assert(true == tags.is_inline());
+//  assert(0    == oa.numBlocksTotal());
+//..
+// Next, we decode an unusually long list, which is moved to allocated memory:
+//..
+//  decodeTags(&tags, "1,2,3,4,5,6");
+//  assert(6     == tags.size());
+//  assert(false == tags.is_inline());
+//  assert(1     == oa.numBlocksInUse());
+//..
+// Finally, we clear the list and release the memory, returning to the inline
+// buffer:
+//..
+//  tags.clear();
+//  tags.shrink_to_fit();
+//  assert(true == tags.is_inline());
+//  assert(0    == oa.numBlocksInUse());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_stdexceptutil.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_autoarraydestructor.h>
+#include <bslalg_containerbase.h>
+#include <bslalg_rangecompare.h>
+#include <bslalg_hasstliterators.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_matchanytype.h>
+#include <bslmf_matcharithmetictype.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+#include <bsls_nativestd.h>
+#include <bsls_performancehint.h>
+
+#include <cstddef>
+#include <iterator>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace bsl {
+
+                             // ==================
+                             // class small_vector
+                             // ==================
+
+template <class                VALUE_TYPE,
+          native_std::size_t   INLINE_CAPACITY,
+          class                ALLOCATOR = allocator<VALUE_TYPE> >
+class small_vector : private BloombergLP::bslalg::ContainerBase<ALLOCATOR> {
+    // This class template provides a vector-like sequence container that
+    // holds up to (the template parameter) 'INLINE_CAPACITY' elements in a
+    // buffer embedded in the object, and allocates memory from (an object of
+    // the template parameter type) 'ALLOCATOR' only for longer sequences.  A
+    // call to any method that would result in a 'small_vector' having a size
+    // or capacity greater than the value returned by 'max_size' triggers a
+    // call to 'bslstl::StdExceptUtil::throwLengthError', and a call to 'at'
+    // with a position outside of the valid range triggers a call to
+    // 'bslstl::StdExceptUtil::throwOutOfRange'.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'BDEX' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    BSLMF_ASSERT(0 < INLINE_CAPACITY);
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::ArrayPrimitives          ArrayPrimitives;
+        // This 'typedef' is an alias for a utility class that provides many
+        // useful functions that operate on arrays.
+
+    typedef BloombergLP::bslalg::ContainerBase<ALLOCATOR> ContainerBase;
+        // This 'typedef' is an alias for the base class holding the allocator,
+        // applying the empty base class optimization whenever appropriate.
+
+    typedef BloombergLP::bslmf::MovableRefUtil            MoveUtil;
+        // This 'typedef' is a convenient alias for the utility associated with
+        // movable references.
+
+    typedef allocator_traits<ALLOCATOR>                   AllocatorTraits;
+        // This 'typedef' is an alias for the allocator traits type associated
+        // with this container.
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE_TYPE                                value_type;
+    typedef ALLOCATOR                                 allocator_type;
+    typedef VALUE_TYPE&                               reference;
+    typedef const VALUE_TYPE&                         const_reference;
+
+    typedef typename AllocatorTraits::size_type       size_type;
+    typedef typename AllocatorTraits::difference_type difference_type;
+    typedef typename AllocatorTraits::pointer         pointer;
+    typedef typename AllocatorTraits::const_pointer   const_pointer;
+
+    typedef VALUE_TYPE                               *iterator;
+    typedef VALUE_TYPE const                         *const_iterator;
+    typedef bsl::reverse_iterator<iterator>           reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>     const_reverse_iterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bsls::AlignedBuffer<
+             static_cast<int>(INLINE_CAPACITY * sizeof(VALUE_TYPE)),
+             BloombergLP::bsls::AlignmentFromType<VALUE_TYPE>::VALUE> Buffer;
+        // This 'typedef' is an alias for the type of the inline buffer.
+
+    class Proctor {
+        // This class provides a proctor for deallocating an array of
+        // 'VALUE_TYPE' objects obtained from the allocator of a
+        // 'small_vector', to be used when the elements are being moved to a
+        // larger array.
+
+        // DATA
+        VALUE_TYPE   *d_data_p;       // array pointer
+        size_type     d_capacity;     // capacity of the array
+        small_vector *d_container_p;  // container supplying the allocator
+
+      private:
+        // NOT IMPLEMENTED
+        Proctor(const Proctor&);
+        Proctor& operator=(const Proctor&);
+
+      public:
+        // CREATORS
+        Proctor(VALUE_TYPE *data, size_type capacity, small_vector *container);
+            // Create a proctor for the specified 'data' array of the specified
+            // 'capacity', using the allocator of the specified 'container' to
+            // deallocate 'data' upon destruction, unless this proctor's
+            // 'release' is called prior.
+
+        ~Proctor();
+            // Destroy this proctor, deallocating any data under management.
+
+        // MANIPULATORS
+        void release();
+            // Release from management the data currently managed by this
+            // proctor.
+    };
+
+    class CreationProctor {
+        // This class provides a proctor for destroying the elements of a
+        // 'small_vector', and deallocating any memory it holds, if one of its
+        // constructors throws an exception after having populated it
+        // partially.
+
+        // DATA
+        small_vector *d_container_p;  // container under construction
+
+      private:
+        // NOT IMPLEMENTED
+        CreationProctor(const CreationProctor&);
+        CreationProctor& operator=(const CreationProctor&);
+
+      public:
+        // CREATORS
+        explicit CreationProctor(small_vector *container);
+            // Create a proctor for the specified 'container', which will be
+            // emptied and will release its memory upon destruction of this
+            // proctor, unless this proctor's 'release' is called prior.
+
+        ~CreationProctor();
+            // Destroy this proctor, destroying the elements of the managed
+            // container, if any, and deallocating its memory.
+
+        // MANIPULATORS
+        void release();
+            // Release from management the container currently managed by this
+            // proctor.
+    };
+
+    // DATA
+    VALUE_TYPE *d_dataBegin_p;  // first element, in 'd_buffer' or allocated
+    VALUE_TYPE *d_dataEnd_p;    // one past the last element
+    size_type   d_capacity;     // number of elements 'd_dataBegin_p' can hold
+    Buffer      d_buffer;       // inline storage for 'INLINE_CAPACITY' values
+
+    // PRIVATE MANIPULATORS
+    VALUE_TYPE *inlineData();
+        // Return the address of the inline buffer of this object.
+
+    VALUE_TYPE *privateAllocate(size_type numElements);
+        // Return the address of an uninitialized array of the specified
+        // 'numElements' objects of 'VALUE_TYPE' allocated from the allocator
+        // of this object.
+
+    void privateAdopt(VALUE_TYPE *data,
+                      size_type   numElements,
+                      size_type   capacity);
+        // Release the (allocated) memory held by this object, if any, and
+        // take ownership of the specified 'data' array of the specified
+        // 'capacity', holding the specified 'numElements' elements.  The
+        // behavior is undefined unless the elements previously held by this
+        // object have been destroyed or moved destructively, and 'data' was
+        // obtained from the allocator of this object.
+
+    void privateDestroy();
+        // Destroy the elements of this object and release the (allocated)
+        // memory held by this object, if any, leaving this object in an
+        // invalid state.  This method is intended for use by the destructor.
+
+    void privateResetToInline();
+        // Make the (empty) inline buffer the storage of this object.  The
+        // behavior is undefined unless the elements previously held by this
+        // object have been destroyed or moved destructively, and the memory
+        // previously held by this object has been deallocated or transferred.
+
+    void privateStealFrom(small_vector *other);
+        // Take ownership of the elements and of the allocated memory of the
+        // specified 'other' object, leaving 'other' empty and using its inline
+        // buffer.  The behavior is undefined unless this object is empty and
+        // holds no allocated memory, 'other' holds allocated memory, and the
+        // allocators of this object and 'other' are equal.
+
+    template <class INPUT_ITER>
+    void privateInsertDispatch(
+                              const_iterator                          position,
+                              INPUT_ITER                              count,
+                              INPUT_ITER                              value,
+                              BloombergLP::bslmf::MatchArithmeticType ,
+                              BloombergLP::bslmf::Nil                 );
+        // Match integral type for 'INPUT_ITER'.
+
+    template <class INPUT_ITER>
+    void privateInsertDispatch(const_iterator              position,
+                               INPUT_ITER                  first,
+                               INPUT_ITER                  last,
+                               BloombergLP::bslmf::MatchAnyType ,
+                               BloombergLP::bslmf::MatchAnyType );
+        // Match non-integral type for 'INPUT_ITER'.
+
+    template <class INPUT_ITER>
+    void privateInsert(const_iterator                 position,
+                       INPUT_ITER                     first,
+                       INPUT_ITER                     last,
+                       const std::input_iterator_tag&);
+        // Specialized insertion for input iterators.
+
+    template <class FWD_ITER>
+    void privateInsert(const_iterator                   position,
+                       FWD_ITER                         first,
+                       FWD_ITER                         last,
+                       const std::forward_iterator_tag&);
+        // Specialized insertion for forward, bidirectional, and random-access
+        // iterators.
+
+    // PRIVATE ACCESSORS
+    const VALUE_TYPE *inlineData() const;
+        // Return the address of the inline buffer of this object.
+
+    size_type grownCapacity(size_type numElements, const char *message) const;
+        // Return the capacity to be allocated for this object to hold the
+        // specified 'numElements' elements, growing geometrically from the
+        // current capacity.  Call 'bslstl::StdExceptUtil::throwLengthError'
+        // with the specified 'message' if 'numElements > max_size()'.
+
+  public:
+    // CREATORS
+    small_vector() BSLS_KEYWORD_NOEXCEPT;
+    explicit small_vector(const ALLOCATOR& basicAllocator)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+        // Create an empty small vector.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not specified, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.  Note that a 'bslma::Allocator *' can be
+        // supplied for 'basicAllocator' if the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default).  Also note that this constructor
+        // allocates no memory.
+
+    explicit small_vector(size_type        initialSize,
+                          const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a small vector of the specified 'initialSize' whose every
+        // element is a default-constructed object of the (template parameter)
+        // type 'VALUE_TYPE'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not specified, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.  Throw 'std::length_error' if
+        // 'initialSize > max_size()'.  This method requires that the type
+        // 'VALUE_TYPE' be 'default-insertable' into this small vector (see
+        // {'bslstl_vector'}).
+
+    small_vector(size_type         initialSize,
+                 const VALUE_TYPE& value,
+                 const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create a small vector of the specified 'initialSize' whose every
+        // element is a copy of the specified 'value'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the currently
+        // installed default allocator is used.  Throw 'std::length_error' if
+        // 'initialSize > max_size()'.  This method requires that the type
+        // 'VALUE_TYPE' be 'copy-insertable' into this small vector.
+
+    template <class INPUT_ITER>
+    small_vector(INPUT_ITER       first,
+                 INPUT_ITER       last,
+                 const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a small vector, and insert (in order) each 'VALUE_TYPE'
+        // object in the range starting at the specified 'first' element, and
+        // ending immediately before the specified 'last' element.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not specified, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.  If the type
+        // 'ALLOCATOR' is 'bsl::allocator' and 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.  Throw
+        // 'std::length_error' if the number of elements in '[first .. last)'
+        // exceeds the value returned by the method 'max_size'.  The (template
+        // parameter) type 'INPUT_ITER' shall meet the requirements of an input
+        // iterator defined in the C++11 standard [24.2.3] providing access to
+        // values of a type convertible to 'value_type', and 'value_type' must
+        // be 'emplace-constructible' from '*i' into this small vector, where
+        // 'i' is a dereferenceable iterator in the range '[first .. last)'.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or before
+        // 'last'.
+
+    small_vector(const small_vector& original);
+        // Create a small vector having the same value as the specified
+        // 'original' object.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  This method requires that the (template
+        // parameter) type 'VALUE_TYPE' be 'copy-insertable' into this small
+        // vector.
+
+    small_vector(BloombergLP::bslmf::MovableRef<small_vector> original);
+                                                                    // IMPLICIT
+        // Create a small vector having the same value as the specified
+        // 'original' object by moving the contents of 'original' to the new
+        // small vector.  The allocator associated with 'original' is
+        // propagated for use in the newly-created small vector.  If 'original'
+        // holds its elements in allocated memory, that memory is transferred
+        // (in constant time); otherwise, the elements are relocated to the
+        // inline buffer of the new object, using 'memcpy' if 'VALUE_TYPE' is
+        // bitwise movable.  'original' is left empty.
+
+    small_vector(const small_vector& original,
+                 const ALLOCATOR&    basicAllocator);
+        // Create a small vector having the same value as the specified
+        // 'original' object that uses the specified 'basicAllocator' to supply
+        // memory.  This method requires that the (template parameter) type
+        // 'VALUE_TYPE' be 'copy-insertable' into this small vector.  Note that
+        // a 'bslma::Allocator *' can be supplied for 'basicAllocator' if the
+        // (template parameter) type 'ALLOCATOR' is 'bsl::allocator' (the
+        // default).
+
+    small_vector(BloombergLP::bslmf::MovableRef<small_vector> original,
+                 const ALLOCATOR&                             basicAllocator);
+        // Create a small vector having the same value as the specified
+        // 'original' object that uses the specified 'basicAllocator' to supply
+        // memory.  The contents of 'original' are moved as for the move
+        // constructor above if 'basicAllocator == original.get_allocator()',
+        // and are move-inserted (in linear time) using 'basicAllocator'
+        // otherwise.  'original' is left in a valid but unspecified state.
+        // This method requires that the (template parameter) type 'VALUE_TYPE'
+        // be 'move-insertable' into this small vector.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    small_vector(std::initializer_list<VALUE_TYPE> values,
+                 const ALLOCATOR&                  basicAllocator =
+                                                                  ALLOCATOR());
+        // Create a small vector and insert (in order) each 'VALUE_TYPE' object
+        // in the specified 'values' initializer list.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the currently
+        // installed default allocator is used.  This method requires that the
+        // (template parameter) type 'VALUE_TYPE' be 'copy-insertable' into
+        // this small vector.
+#endif
+
+    ~small_vector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    small_vector& operator=(const small_vector& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.  The
+        // allocator of this object is not changed.  If an exception is thrown,
+        // '*this' is left in a valid but unspecified state.  This method
+        // requires that the (template parameter) type 'VALUE_TYPE' be
+        // 'copy-assignable' and 'copy-insertable' into this small vector.
+
+    small_vector& operator=(BloombergLP::bslmf::MovableRef<small_vector> rhs)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.  The
+        // allocator of this object is not changed.  If 'rhs' holds its
+        // elements in allocated memory and 'get_allocator() ==
+        // rhs.get_allocator()', that memory is transferred (in constant time);
+        // otherwise, the elements of 'rhs' are moved (in linear time).  'rhs'
+        // is left in a valid but unspecified state, and if an exception is
+        // thrown, '*this' is left in a valid but unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    small_vector& operator=(std::initializer_list<VALUE_TYPE> values);
+        // Assign to this object the value resulting from first clearing this
+        // small vector and then inserting (in order) each 'value_type' object
+        // in the specified 'values' initializer list, and return a reference
+        // providing modifiable access to this object.  If an exception is
+        // thrown, '*this' is left in a valid but unspecified state.
+
+    void assign(std::initializer_list<VALUE_TYPE> values);
+        // Assign to this object the value resulting from first clearing this
+        // small vector and then inserting (in order) each 'value_type' object
+        // in the specified 'values' initializer list.  If an exception is
+        // thrown, '*this' is left in a valid but unspecified state.
+#endif
+
+    template <class INPUT_ITER>
+    void assign(INPUT_ITER first, INPUT_ITER last);
+        // Assign to this object the value resulting from first clearing this
+        // small vector and then inserting (in order) each 'value_type' object
+        // in the range starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element.  If an exception is
+        // thrown, '*this' is left in a valid but unspecified state.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last',
+        // and no element of the sequence is an element of this small vector.
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Assign to this object the value resulting from first clearing this
+        // small vector and then inserting the specified 'numElements' copies
+        // of the specified 'value'.  If an exception is thrown, '*this' is
+        // left in a valid but unspecified state.  Throw 'std::length_error' if
+        // 'numElements > max_size()'.
+
+                             // *** iterators ***
+
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing modifiable access to the first element
+        // in this small vector, or the past-the-end iterator if this small
+        // vector is empty.
+
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing modifiable access to this
+        // small vector.
+
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing modifiable access to the last
+        // element in this small vector, and the past-the-end reverse iterator
+        // if this small vector is empty.
+
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing modifiable access
+        // to this small vector.
+
+                          // *** element access ***
+
+    reference operator[](size_type position);
+        // Return a reference providing modifiable access to the element at the
+        // specified 'position' in this small vector.  The behavior is
+        // undefined unless 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference providing modifiable access to the element at the
+        // specified 'position' in this small vector.  Throw
+        // 'std::out_of_range' if 'position >= size()'.
+
+    reference front();
+        // Return a reference providing modifiable access to the first element
+        // in this small vector.  The behavior is undefined unless this small
+        // vector is not empty.
+
+    reference back();
+        // Return a reference providing modifiable access to the last element
+        // in this small vector.  The behavior is undefined unless this small
+        // vector is not empty.
+
+    VALUE_TYPE *data() BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the (modifiable) first element of this small
+        // vector.  Note that '[data() .. data() + size())' is always a valid
+        // range.
+
+                             // *** capacity ***
+
+    void resize(size_type newSize);
+        // Change the size of this small vector to the specified 'newSize'.
+        // Erase 'size() - newSize' elements at the back if 'newSize < size()',
+        // and append 'newSize - size()' default-constructed elements if
+        // 'newSize > size()'.  Throw 'std::length_error' if
+        // 'newSize > max_size()'.  This method requires that the (template
+        // parameter) type 'VALUE_TYPE' be 'default-insertable' and
+        // 'move-insertable' into this small vector.
+
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this small vector to the specified 'newSize'.
+        // Erase 'size() - newSize' elements at the back if 'newSize < size()',
+        // and append 'newSize - size()' copies of the specified 'value' if
+        // 'newSize > size()'.  Throw 'std::length_error' if
+        // 'newSize > max_size()'.  This method requires that the (template
+        // parameter) type 'VALUE_TYPE' be 'copy-insertable' into this small
+        // vector.
+
+    void reserve(size_type newCapacity);
+        // Change the capacity of this small vector to at least the specified
+        // 'newCapacity'.  If an exception is thrown, the value of this small
+        // vector is unchanged.  Throw 'std::length_error' if
+        // 'newCapacity > max_size()'.  Note that this method has no effect if
+        // the current capacity meets or exceeds the required capacity.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this small vector to its size, or to the
+        // inline capacity if that is larger, moving the elements back into the
+        // inline buffer (and releasing the allocated memory) if they fit
+        // there.  If an exception is thrown, the value of this small vector is
+        // unchanged.
+
+                            // *** modifiers ***
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... Args>
+    reference emplace_back(Args&&... arguments);
+        // Append to the end of this small vector a newly created 'value_type'
+        // object, constructed by forwarding 'get_allocator()' (if required)
+        // and the specified (variable number of) 'arguments' to the
+        // corresponding constructor of 'value_type', and return a reference
+        // providing modifiable access to the new element.  If an exception is
+        // thrown (other than by the move constructor of a non-copyable
+        // 'value_type'), this method has no effect.  This method requires that
+        // the (template parameter) 'VALUE_TYPE' be 'move-insertable' into this
+        // small vector and 'emplace-constructible' from 'arguments'.
+#endif
+
+    void push_back(const VALUE_TYPE& value);
+        // Append to the end of this small vector a copy of the specified
+        // 'value'.  If an exception is thrown, this method has no effect.
+        // Throw 'std::length_error' if 'size() == max_size()'.  This method
+        // requires that the (template parameter) type 'VALUE_TYPE' be
+        // 'copy-constructible'.
+
+    void push_back(BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Append to the end of this small vector the specified move-insertable
+        // 'value'.  'value' is left in a valid but unspecified state.  If an
+        // exception is thrown (other than by the move constructor of a
+        // non-copyable 'value_type'), this method has no effect.  Throw
+        // 'std::length_error' if 'size() == max_size()'.
+
+    void pop_back();
+        // Erase the last element from this small vector.  The behavior is
+        // undefined if this small vector is empty.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... Args>
+    iterator emplace(const_iterator position, Args&&... arguments);
+        // Insert at the specified 'position' in this small vector a newly
+        // created 'value_type' object, constructed by forwarding
+        // 'get_allocator()' (if required) and the specified (variable number
+        // of) 'arguments' to the corresponding constructor of 'value_type',
+        // and return an iterator referring to the newly created and inserted
+        // element.  If an exception is thrown (other than by the copy
+        // constructor, move constructor, assignment operator, or move
+        // assignment operator of 'value_type'), this method has no effect.
+        // Throw 'std::length_error' if 'size() == max_size()'.  The behavior
+        // is undefined unless 'position' is an iterator in the range
+        // '[cbegin() .. cend()]' (both endpoints included).
+#endif
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+        // Insert at the specified 'position' in this small vector a copy of
+        // the specified 'value', and return an iterator referring to the newly
+        // inserted element.  If an exception is thrown (other than by the copy
+        // constructor, move constructor, assignment operator, or move
+        // assignment operator of 'value_type'), this method has no effect.
+        // Throw 'std::length_error' if 'size() == max_size()'.  The behavior
+        // is undefined unless 'position' is an iterator in the range
+        // '[cbegin() .. cend()]' (both endpoints included).
+
+    iterator insert(const_iterator                             position,
+                    BloombergLP::bslmf::MovableRef<VALUE_TYPE> value);
+        // Insert at the specified 'position' in this small vector the
+        // specified move-insertable 'value', and return an iterator referring
+        // to the newly inserted element.  'value' is left in a valid but
+        // unspecified state.  If an exception is thrown (other than by the
+        // copy constructor, move constructor, assignment operator, or move
+        // assignment operator of 'value_type'), this method has no effect.
+        // Throw 'std::length_error' if 'size() == max_size()'.  The behavior
+        // is undefined unless 'position' is an iterator in the range
+        // '[cbegin() .. cend()]' (both endpoints included).
+
+    iterator insert(const_iterator    position,
+                    size_type         numElements,
+                    const VALUE_TYPE& value);
+        // Insert at the specified 'position' in this small vector the
+        // specified 'numElements' copies of the specified 'value', and return
+        // an iterator referring to the first newly inserted element.  If an
+        // exception is thrown (other than by the copy constructor, move
+        // constructor, assignment operator, or move assignment operator of
+        // 'value_type'), this method has no effect.  Throw 'std::length_error'
+        // if 'size() + numElements > max_size()'.  The behavior is undefined
+        // unless 'position' is an iterator in the range '[cbegin() .. cend()]'
+        // (both endpoints included).
+
+    template <class INPUT_ITER>
+    iterator insert(const_iterator position,
+                    INPUT_ITER     first,
+                    INPUT_ITER     last)
+        // Insert at the specified 'position' in this small vector the values
+        // in the range starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element, and return an
+        // iterator referring to the first newly inserted element.  If an
+        // exception is thrown (other than by the copy constructor, move
+        // constructor, assignment operator, or move assignment operator of
+        // 'value_type'), this method has no effect.  Throw 'std::length_error'
+        // if 'size() + distance(first, last) > max_size()'.  The behavior is
+        // undefined unless 'position' is an iterator in the range
+        // '[cbegin() .. cend()]' (both endpoints included), and 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.
+    {
+        // This function is defined in the class body, as is that of
+        // 'bsl::vector', to work around compilers having trouble matching
+        // out-of-line definitions of member templates.
+
+        BSLS_ASSERT_SAFE(cbegin() <= position);
+        BSLS_ASSERT_SAFE(position <= cend());
+
+        // If 'first' and 'last' are integral, then they are not iterators,
+        // and we should call 'insert(position, first, last)', where 'first' is
+        // actually a misnamed count, and 'last' is a misnamed value (see
+        // 'bsl::vector').
+
+        const size_type index = position - cbegin();
+        privateInsertDispatch(
+            position, first, last, first, BloombergLP::bslmf::Nil());
+        return begin() + index;
+    }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    iterator insert(const_iterator                    position,
+                    std::initializer_list<VALUE_TYPE> values);
+        // Insert at the specified 'position' in this small vector each
+        // 'VALUE_TYPE' object in the specified 'values' initializer list, and
+        // return an iterator referring to the first newly inserted element.
+        // If an exception is thrown (other than by the copy constructor, move
+        // constructor, assignment operator, or move assignment operator of
+        // 'value_type'), this method has no effect.  Throw
+        // 'std::length_error' if 'size() + values.size() > max_size()'.  The
+        // behavior is undefined unless 'position' is an iterator in the range
+        // '[cbegin() .. cend()]' (both endpoints included).
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this small vector the element at the specified
+        // 'position', and return an iterator providing modifiable access to
+        // the element immediately following the removed element, or to the
+        // position returned by the 'end' method if the removed element was the
+        // last in the sequence.  The behavior is undefined unless 'position'
+        // is an iterator in the range '[cbegin() .. cend())'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this small vector the sequence of elements starting at
+        // the specified 'first' position and ending before the specified
+        // 'last' position, and return an iterator providing modifiable access
+        // to the element immediately following the last removed element, or
+        // the position returned by the method 'end' if the removed elements
+        // were last in the sequence.  The behavior is undefined unless 'first'
+        // is an iterator in the range '[cbegin() .. cend()]' (both endpoints
+        // included) and 'last' is an iterator in the range
+        // '[first .. cend()]' (both endpoints included).
+
+    void swap(small_vector& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+        // Exchange the value of this object with that of the specified 'other'
+        // object.  The allocators are not exchanged.  This method provides the
+        // no-throw exception-safety guarantee, and has 'O[1]' complexity, if
+        // both objects hold their elements in allocated memory and their
+        // allocators are equal; otherwise, the elements are moved (with
+        // 'O[N]' complexity, where 'N' is the sum of the sizes of the two
+        // objects), and if an exception is thrown, both objects are left in
+        // valid but unspecified states.
+
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+        // Remove all elements from this small vector, making its size 0.  Note
+        // that although this small vector is empty after this call, it has
+        // the same capacity as before the call.
+
+    // ACCESSORS
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // small vector.
+
+                             // *** iterators ***
+
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return an iterator providing non-modifiable access to the first
+        // element in this small vector, and the past-the-end iterator if this
+        // small vector is empty.
+
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // this small vector.
+
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element in this small vector, and the past-the-end reverse
+        // iterator if this small vector is empty.
+
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to this small vector.
+
+                             // *** capacity ***
+
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements in this small vector.
+
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this small vector could possibly hold.  Note that there is no
+        // guarantee that the small vector can successfully grow to the
+        // returned size, or even close to that size without running out of
+        // resources.
+
+    size_type capacity() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the number of elements this small vector can hold without
+        // allocating memory.  Note that the returned value is never less than
+        // 'INLINE_CAPACITY'.
+
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if this small vector has size 0, and 'false'
+        // otherwise.
+
+    bool is_inline() const BSLS_KEYWORD_NOEXCEPT;
+        // Return 'true' if the elements of this small vector are held in its
+        // inline buffer, and 'false' if they are held in memory supplied by
+        // its allocator.
+
+                          // *** element access ***
+
+    const_reference operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the element at
+        // the specified 'position' in this small vector.  The behavior is
+        // undefined unless 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference providing non-modifiable access to the element at
+        // the specified 'position' in this small vector.  Throw
+        // 'std::out_of_range' if 'position >= size()'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element in this small vector.  The behavior is undefined unless this
+        // small vector is not empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element in this small vector.  The behavior is undefined unless this
+        // small vector is not empty.
+
+    const VALUE_TYPE *data() const BSLS_KEYWORD_NOEXCEPT;
+        // Return the address of the (non-modifiable) first element of this
+        // small vector.  Note that '[data() .. data() + size())' is always a
+        // valid range.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+bool operator==(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'small_vector' objects 'lhs' and
+    // 'rhs' have the same value if they have the same size, and each element
+    // in the sequence of elements of 'lhs' has the same value as the
+    // corresponding element in the sequence of elements of 'rhs'.  This
+    // method requires that the (template parameter) type 'VALUE_TYPE' be
+    // 'equality-comparable'.
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+bool operator!=(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'small_vector' objects 'lhs' and
+    // 'rhs' do not have the same value if they do not have the same size, or
+    // some element in the sequence of elements of 'lhs' does not have the
+    // same value as the corresponding element in the sequence of elements of
+    // 'rhs'.  This method requires that the (template parameter) type
+    // 'VALUE_TYPE' be 'equality-comparable'.
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+bool operator< (const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' small vector is
+    // lexicographically less than that of the specified 'rhs' small vector,
+    // and 'false' otherwise (see 'bsl::vector').  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+bool operator> (const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' small vector is
+    // lexicographically greater than that of the specified 'rhs' small vector,
+    // and 'false' otherwise.  Note that this operator returns 'rhs < lhs'.
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+bool operator<=(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' small vector is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // small vector, and 'false' otherwise.  Note that this operator returns
+    // '!(rhs < lhs)'.
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+bool operator>=(const small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                const small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' small vector is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // small vector, and 'false' otherwise.  Note that this operator returns
+    // '!(lhs < rhs)'.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+void swap(small_vector<VALUE_TYPE, N, ALLOCATOR>& a,
+          small_vector<VALUE_TYPE, N, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+    // Exchange the value of the specified 'a' object with that of the
+    // specified 'b' object.  See the 'swap' method for complexity and
+    // exception-safety guarantees.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // ---------------------------
+                         // class small_vector::Proctor
+                         // ---------------------------
+
+// CREATORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::Proctor::Proctor(
+                                                   VALUE_TYPE   *data,
+                                                   size_type     capacity,
+                                                   small_vector *container)
+: d_data_p(data)
+, d_capacity(capacity)
+, d_container_p(container)
+{
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::Proctor::~Proctor()
+{
+    if (d_data_p) {
+        d_container_p->deallocateN(d_data_p, d_capacity);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::Proctor::release()
+{
+    d_data_p = 0;
+}
+
+                     // -----------------------------------
+                     // class small_vector::CreationProctor
+                     // -----------------------------------
+
+// CREATORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::CreationProctor::CreationProctor(
+                                                       small_vector *container)
+: d_container_p(container)
+{
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::CreationProctor::~CreationProctor()
+{
+    if (d_container_p) {
+        d_container_p->privateDestroy();
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::CreationProctor::release()
+{
+    d_container_p = 0;
+}
+
+                             // ------------------
+                             // class small_vector
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, N, ALLOCATOR>::inlineData()
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, N, ALLOCATOR>::privateAllocate(
+                                                         size_type numElements)
+{
+    return this->allocateN(static_cast<VALUE_TYPE *>(0), numElements);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateAdopt(
+                                                    VALUE_TYPE *data,
+                                                    size_type   numElements,
+                                                    size_type   capacity)
+{
+    if (!is_inline()) {
+        this->deallocateN(d_dataBegin_p, d_capacity);
+    }
+    d_dataBegin_p = data;
+    d_dataEnd_p   = data + numElements;
+    d_capacity    = capacity;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateDestroy()
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   d_dataBegin_p,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator());
+    if (!is_inline()) {
+        this->deallocateN(d_dataBegin_p, d_capacity);
+    }
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateResetToInline()
+{
+    d_dataBegin_p = d_dataEnd_p = inlineData();
+    d_capacity    = N;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateStealFrom(
+                                                           small_vector *other)
+{
+    BSLS_ASSERT_SAFE(empty());
+    BSLS_ASSERT_SAFE(is_inline());
+    BSLS_ASSERT_SAFE(!other->is_inline());
+
+    d_dataBegin_p = other->d_dataBegin_p;
+    d_dataEnd_p   = other->d_dataEnd_p;
+    d_capacity    = other->d_capacity;
+    other->privateResetToInline();
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateInsertDispatch(
+                              const_iterator                          position,
+                              INPUT_ITER                              count,
+                              INPUT_ITER                              value,
+                              BloombergLP::bslmf::MatchArithmeticType ,
+                              BloombergLP::bslmf::Nil                 )
+{
+    // 'count' and 'value' are integral types that just happen to be the same.
+    // They are not iterators, so we call 'insert(position, count, value)'.
+
+    insert(position,
+           static_cast<size_type>(count),
+           static_cast<VALUE_TYPE>(value));
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateInsertDispatch(
+                                          const_iterator              position,
+                                          INPUT_ITER                  first,
+                                          INPUT_ITER                  last,
+                                          BloombergLP::bslmf::MatchAnyType ,
+                                          BloombergLP::bslmf::MatchAnyType )
+{
+    typedef typename iterator_traits<INPUT_ITER>::iterator_category Tag;
+    privateInsert(position, first, last, Tag());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateInsert(
+                                       const_iterator                 position,
+                                       INPUT_ITER                     first,
+                                       INPUT_ITER                     last,
+                                       const std::input_iterator_tag&)
+{
+    // The length of the range is unknown, so gather the elements in a
+    // temporary object (which will destroy them if an exception is thrown),
+    // and insert them from there.  Input iterators are rarely used, and the
+    // temporary object does not allocate for short ranges.
+
+    small_vector temp(get_allocator());
+    for (; first != last; ++first) {
+        temp.push_back(*first);
+    }
+    privateInsert(position,
+                  temp.d_dataBegin_p,
+                  temp.d_dataEnd_p,
+                  std::forward_iterator_tag());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+template <class FWD_ITER>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::privateInsert(
+                                     const_iterator                   position,
+                                     FWD_ITER                         first,
+                                     FWD_ITER                         last,
+                                     const std::forward_iterator_tag&)
+{
+    VALUE_TYPE *pos = const_cast<VALUE_TYPE *>(position);
+
+    const size_type numElements = native_std::distance(first, last);
+    const size_type maxInsert = max_size() - size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > maxInsert)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                      "small_vector<...>::insert(pos,f,l): vector too long");
+    }
+
+    const size_type newSize = size() + numElements;
+
+    if (newSize > d_capacity) {
+        const size_type newCapacity = grownCapacity(
+                      newSize,
+                      "small_vector<...>::insert(pos,f,l): vector too long");
+
+        VALUE_TYPE *newData = privateAllocate(newCapacity);
+        Proctor     proctor(newData, newCapacity, this);
+
+        ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                                  &d_dataEnd_p,
+                                                  d_dataBegin_p,
+                                                  pos,
+                                                  d_dataEnd_p,
+                                                  first,
+                                                  last,
+                                                  numElements,
+                                                  ContainerBase::allocator());
+        proctor.release();
+        privateAdopt(newData, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                first,
+                                last,
+                                numElements,
+                                ContainerBase::allocator());
+        d_dataEnd_p += numElements;
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+const VALUE_TYPE *small_vector<VALUE_TYPE, N, ALLOCATOR>::inlineData() const
+{
+    return reinterpret_cast<const VALUE_TYPE *>(d_buffer.buffer());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::grownCapacity(
+                                              size_type   numElements,
+                                              const char *message) const
+{
+    const size_type maxSize = max_size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > maxSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(message);
+    }
+
+    const size_type doubled = d_capacity <= maxSize / 2
+                            ? d_capacity * 2
+                            : maxSize;
+    return numElements < doubled ? doubled : numElements;
+}
+
+// CREATORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector() BSLS_KEYWORD_NOEXCEPT
+: ContainerBase(ALLOCATOR())
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                  const ALLOCATOR& basicAllocator) BSLS_KEYWORD_NOEXCEPT
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                              size_type        initialSize,
+                                              const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    CreationProctor proctor(this);
+    resize(initialSize);
+    proctor.release();
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                              size_type         initialSize,
+                                              const VALUE_TYPE& value,
+                                              const ALLOCATOR&  basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    CreationProctor proctor(this);
+    insert(d_dataEnd_p, initialSize, value);
+    proctor.release();
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                              INPUT_ITER       first,
+                                              INPUT_ITER       last,
+                                              const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    CreationProctor proctor(this);
+    insert(d_dataEnd_p, first, last);
+    proctor.release();
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                                  const small_vector& original)
+: ContainerBase(AllocatorTraits::select_on_container_copy_construction(
+                                                  original.get_allocator()))
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    CreationProctor proctor(this);
+    insert(d_dataEnd_p, original.begin(), original.end());
+    proctor.release();
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                         BloombergLP::bslmf::MovableRef<small_vector> original)
+: ContainerBase(MoveUtil::access(original).get_allocator())
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    small_vector& lvalue = original;
+
+    if (!lvalue.is_inline()) {
+        privateStealFrom(&lvalue);
+    }
+    else {
+        ArrayPrimitives::destructiveMove(d_dataBegin_p,
+                                         lvalue.d_dataBegin_p,
+                                         lvalue.d_dataEnd_p,
+                                         ContainerBase::allocator());
+        d_dataEnd_p        = d_dataBegin_p + lvalue.size();
+        lvalue.d_dataEnd_p = lvalue.d_dataBegin_p;
+    }
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                                          const small_vector& original,
+                                          const ALLOCATOR&    basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    CreationProctor proctor(this);
+    insert(d_dataEnd_p, original.begin(), original.end());
+    proctor.release();
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                  BloombergLP::bslmf::MovableRef<small_vector> original,
+                  const ALLOCATOR&                             basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    small_vector& lvalue = original;
+
+    if (basicAllocator == lvalue.get_allocator()) {
+        if (!lvalue.is_inline()) {
+            privateStealFrom(&lvalue);
+        }
+        else {
+            ArrayPrimitives::destructiveMove(d_dataBegin_p,
+                                             lvalue.d_dataBegin_p,
+                                             lvalue.d_dataEnd_p,
+                                             ContainerBase::allocator());
+            d_dataEnd_p        = d_dataBegin_p + lvalue.size();
+            lvalue.d_dataEnd_p = lvalue.d_dataBegin_p;
+        }
+    }
+    else {
+        // The elements must be created using the new allocator, so they
+        // cannot be relocated destructively, even if bitwise movable.
+
+        CreationProctor proctor(this);
+        reserve(lvalue.size());
+        ArrayPrimitives::moveConstruct(d_dataBegin_p,
+                                       lvalue.d_dataBegin_p,
+                                       lvalue.d_dataEnd_p,
+                                       ContainerBase::allocator());
+        d_dataEnd_p = d_dataBegin_p + lvalue.size();
+        proctor.release();
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>::small_vector(
+                             std::initializer_list<VALUE_TYPE> values,
+                             const ALLOCATOR&                  basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(N)
+{
+    CreationProctor proctor(this);
+    insert(d_dataEnd_p, values.begin(), values.end());
+    proctor.release();
+}
+#endif
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>::~small_vector()
+{
+    privateDestroy();
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>&
+small_vector<VALUE_TYPE, N, ALLOCATOR>::operator=(const small_vector& rhs)
+{
+    if (this != &rhs) {
+        assign(rhs.begin(), rhs.end());
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+small_vector<VALUE_TYPE, N, ALLOCATOR>&
+small_vector<VALUE_TYPE, N, ALLOCATOR>::operator=(
+                              BloombergLP::bslmf::MovableRef<small_vector> rhs)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    small_vector& lvalue = rhs;
+
+    if (this == &lvalue) {
+        return *this;                                                 // RETURN
+    }
+
+    if (get_allocator() == lvalue.get_allocator() && !lvalue.is_inline()) {
+        privateDestroy();
+        privateResetToInline();
+        privateStealFrom(&lvalue);
+        return *this;                                                 // RETURN
+    }
+
+    clear();
+    reserve(lvalue.size());
+    if (get_allocator() == lvalue.get_allocator()) {
+        ArrayPrimitives::destructiveMove(d_dataBegin_p,
+                                         lvalue.d_dataBegin_p,
+                                         lvalue.d_dataEnd_p,
+                                         ContainerBase::allocator());
+        d_dataEnd_p        = d_dataBegin_p + lvalue.size();
+        lvalue.d_dataEnd_p = lvalue.d_dataBegin_p;
+    }
+    else {
+        ArrayPrimitives::moveConstruct(d_dataBegin_p,
+                                       lvalue.d_dataBegin_p,
+                                       lvalue.d_dataEnd_p,
+                                       ContainerBase::allocator());
+        d_dataEnd_p = d_dataBegin_p + lvalue.size();
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, N, ALLOCATOR>&
+small_vector<VALUE_TYPE, N, ALLOCATOR>::operator=(
+                                      std::initializer_list<VALUE_TYPE> values)
+{
+    assign(values.begin(), values.end());
+    return *this;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::assign(
+                                      std::initializer_list<VALUE_TYPE> values)
+{
+    assign(values.begin(), values.end());
+}
+#endif
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::assign(INPUT_ITER first,
+                                                    INPUT_ITER last)
+{
+    clear();
+    insert(d_dataEnd_p, first, last);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::assign(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    // 'value' may be an element of this object, so build the new value aside
+    // before clearing this object.
+
+    small_vector temp(numElements, value, get_allocator());
+    *this = MoveUtil::move(temp);
+}
+
+                             // *** iterators ***
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::rbegin() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+                          // *** element access ***
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::operator[](size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                        "small_vector<...>::at(position): invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, N, ALLOCATOR>::data()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+                             // *** capacity ***
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::resize(size_type newSize)
+{
+    const size_type oldSize = size();
+
+    if (newSize <= oldSize) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   d_dataBegin_p + newSize,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator());
+        d_dataEnd_p = d_dataBegin_p + newSize;
+        return;                                                       // RETURN
+    }
+
+    if (newSize > d_capacity) {
+        reserve(grownCapacity(newSize,
+                          "small_vector<...>::resize(n): vector too long"));
+    }
+    ArrayPrimitives::defaultConstruct(d_dataEnd_p,
+                                      newSize - oldSize,
+                                      ContainerBase::allocator());
+    d_dataEnd_p = d_dataBegin_p + newSize;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::resize(size_type         newSize,
+                                                    const VALUE_TYPE& value)
+{
+    const size_type oldSize = size();
+
+    if (newSize <= oldSize) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   d_dataBegin_p + newSize,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator());
+        d_dataEnd_p = d_dataBegin_p + newSize;
+        return;                                                       // RETURN
+    }
+    insert(d_dataEnd_p, newSize - oldSize, value);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::reserve(size_type newCapacity)
+{
+    if (newCapacity <= d_capacity) {
+        return;                                                       // RETURN
+    }
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newCapacity > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                 "small_vector<...>::reserve(newCapacity): vector too long");
+    }
+
+    const size_type oldSize = size();
+    VALUE_TYPE     *newData = privateAllocate(newCapacity);
+    Proctor         proctor(newData, newCapacity, this);
+
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     ContainerBase::allocator());
+    proctor.release();
+    privateAdopt(newData, oldSize, newCapacity);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::shrink_to_fit()
+{
+    if (is_inline() || size() == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    const size_type oldSize = size();
+
+    if (oldSize <= N) {
+        VALUE_TYPE *oldData     = d_dataBegin_p;
+        size_type   oldCapacity = d_capacity;
+
+        ArrayPrimitives::destructiveMove(inlineData(),
+                                         d_dataBegin_p,
+                                         d_dataEnd_p,
+                                         ContainerBase::allocator());
+        privateResetToInline();
+        d_dataEnd_p = d_dataBegin_p + oldSize;
+        this->deallocateN(oldData, oldCapacity);
+        return;                                                       // RETURN
+    }
+
+    VALUE_TYPE *newData = privateAllocate(oldSize);
+    Proctor     proctor(newData, oldSize, this);
+
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     ContainerBase::allocator());
+    proctor.release();
+    privateAdopt(newData, oldSize, oldSize);
+}
+
+                            // *** modifiers ***
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+template <class... Args>
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::emplace_back(Args&&... arguments)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        AllocatorTraits::construct(
+                            ContainerBase::allocator(),
+                            d_dataEnd_p,
+                            BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+        ++d_dataEnd_p;
+        return *(d_dataEnd_p - 1);                                    // RETURN
+    }
+
+    const size_type oldSize     = size();
+    const size_type newCapacity = grownCapacity(
+                  oldSize + 1,
+                  "small_vector<...>::emplace_back(args...): vector too long");
+
+    VALUE_TYPE *newData = privateAllocate(newCapacity);
+    Proctor     proctor(newData, newCapacity, this);
+
+    // Construct the new element first, since 'arguments' may refer to an
+    // element of this object.
+
+    VALUE_TYPE *pos = newData + oldSize;
+    AllocatorTraits::construct(
+                            ContainerBase::allocator(),
+                            pos,
+                            BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE, ALLOCATOR> guard(
+                                                   pos,
+                                                   pos + 1,
+                                                   ContainerBase::allocator());
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     ContainerBase::allocator());
+    guard.release();
+    proctor.release();
+    privateAdopt(newData, oldSize + 1, newCapacity);
+    return *pos;
+}
+#endif
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::push_back(const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        AllocatorTraits::construct(ContainerBase::allocator(),
+                                   d_dataEnd_p,
+                                   value);
+        ++d_dataEnd_p;
+        return;                                                       // RETURN
+    }
+
+    const size_type oldSize     = size();
+    const size_type newCapacity = grownCapacity(
+                       oldSize + 1,
+                       "small_vector<...>::push_back(v): vector too long");
+
+    VALUE_TYPE *newData = privateAllocate(newCapacity);
+    Proctor     proctor(newData, newCapacity, this);
+
+    // Copy the new element first, since 'value' may be an element of this
+    // object.
+
+    VALUE_TYPE *pos = newData + oldSize;
+    AllocatorTraits::construct(ContainerBase::allocator(), pos, value);
+
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE, ALLOCATOR> guard(
+                                                   pos,
+                                                   pos + 1,
+                                                   ContainerBase::allocator());
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     ContainerBase::allocator());
+    guard.release();
+    proctor.release();
+    privateAdopt(newData, oldSize + 1, newCapacity);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::push_back(
+                              BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    VALUE_TYPE& lvalue = value;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        AllocatorTraits::construct(ContainerBase::allocator(),
+                                   d_dataEnd_p,
+                                   MoveUtil::move(lvalue));
+        ++d_dataEnd_p;
+        return;                                                       // RETURN
+    }
+
+    const size_type oldSize     = size();
+    const size_type newCapacity = grownCapacity(
+                      oldSize + 1,
+                      "small_vector<...>::push_back(rv): vector too long");
+
+    VALUE_TYPE *newData = privateAllocate(newCapacity);
+    Proctor     proctor(newData, newCapacity, this);
+
+    VALUE_TYPE *pos = newData + oldSize;
+    AllocatorTraits::construct(ContainerBase::allocator(),
+                               pos,
+                               MoveUtil::move(lvalue));
+
+    BloombergLP::bslalg::AutoArrayDestructor<VALUE_TYPE, ALLOCATOR> guard(
+                                                   pos,
+                                                   pos + 1,
+                                                   ContainerBase::allocator());
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     ContainerBase::allocator());
+    guard.release();
+    proctor.release();
+    privateAdopt(newData, oldSize + 1, newCapacity);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    AllocatorTraits::destroy(ContainerBase::allocator(), --d_dataEnd_p);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+template <class... Args>
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::emplace(const_iterator position,
+                                                Args&&...      arguments)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    VALUE_TYPE      *pos     = const_cast<VALUE_TYPE *>(position);
+    const size_type  index   = pos - d_dataBegin_p;
+    const size_type  newSize = size() + 1;
+
+    if (newSize > d_capacity) {
+        const size_type newCapacity = grownCapacity(
+                   newSize,
+                   "small_vector<...>::emplace(pos,args...): vector too long");
+
+        VALUE_TYPE *newData = privateAllocate(newCapacity);
+        Proctor     proctor(newData, newCapacity, this);
+
+        ArrayPrimitives::destructiveMoveAndEmplace(
+                            newData,
+                            &d_dataEnd_p,
+                            d_dataBegin_p,
+                            pos,
+                            d_dataEnd_p,
+                            ContainerBase::allocator(),
+                            BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+        proctor.release();
+        privateAdopt(newData, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::emplace(
+                            pos,
+                            d_dataEnd_p,
+                            ContainerBase::allocator(),
+                            BSLS_COMPILERFEATURES_FORWARD(Args, arguments)...);
+        ++d_dataEnd_p;
+    }
+    return d_dataBegin_p + index;
+}
+#endif
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::insert(const_iterator    position,
+                                               const VALUE_TYPE& value)
+{
+    return insert(position, size_type(1), value);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::insert(
+                           const_iterator                             position,
+                           BloombergLP::bslmf::MovableRef<VALUE_TYPE> value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    VALUE_TYPE& lvalue = value;
+
+    VALUE_TYPE      *pos     = const_cast<VALUE_TYPE *>(position);
+    const size_type  index   = pos - d_dataBegin_p;
+    const size_type  newSize = size() + 1;
+
+    if (newSize > d_capacity) {
+        const size_type newCapacity = grownCapacity(
+                        newSize,
+                        "small_vector<...>::insert(pos,rv): vector too long");
+
+        VALUE_TYPE *newData = privateAllocate(newCapacity);
+        Proctor     proctor(newData, newCapacity, this);
+
+        ArrayPrimitives::destructiveMoveAndEmplace(newData,
+                                                   &d_dataEnd_p,
+                                                   d_dataBegin_p,
+                                                   pos,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator(),
+                                                   MoveUtil::move(lvalue));
+        proctor.release();
+        privateAdopt(newData, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                MoveUtil::move(lvalue),
+                                ContainerBase::allocator());
+        ++d_dataEnd_p;
+    }
+    return d_dataBegin_p + index;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::insert(const_iterator    position,
+                                               size_type         numElements,
+                                               const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const size_type maxInsert = max_size() - size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > maxInsert)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                        "small_vector<...>::insert(pos,n,v): vector too long");
+    }
+
+    VALUE_TYPE      *pos     = const_cast<VALUE_TYPE *>(position);
+    const size_type  index   = pos - d_dataBegin_p;
+    const size_type  newSize = size() + numElements;
+
+    if (newSize > d_capacity) {
+        const size_type newCapacity = grownCapacity(
+                        newSize,
+                        "small_vector<...>::insert(pos,n,v): vector too long");
+
+        VALUE_TYPE *newData = privateAllocate(newCapacity);
+        Proctor     proctor(newData, newCapacity, this);
+
+        ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                                  &d_dataEnd_p,
+                                                  d_dataBegin_p,
+                                                  pos,
+                                                  d_dataEnd_p,
+                                                  value,
+                                                  numElements,
+                                                  ContainerBase::allocator());
+        proctor.release();
+        privateAdopt(newData, newSize, newCapacity);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                value,
+                                numElements,
+                                ContainerBase::allocator());
+        d_dataEnd_p += numElements;
+    }
+    return d_dataBegin_p + index;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::insert(
+                                    const_iterator                    position,
+                                    std::initializer_list<VALUE_TYPE> values)
+{
+    return insert(position, values.begin(), values.end());
+}
+#endif
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <  cend());
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::erase(const_iterator first,
+                                              const_iterator last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= first);
+    BSLS_ASSERT_SAFE(first    <= last);
+    BSLS_ASSERT_SAFE(last     <= cend());
+
+    const size_type numElements = last - first;
+    ArrayPrimitives::erase(const_cast<VALUE_TYPE *>(first),
+                           const_cast<VALUE_TYPE *>(last),
+                           d_dataEnd_p,
+                           ContainerBase::allocator());
+    d_dataEnd_p -= numElements;
+    return const_cast<VALUE_TYPE *>(first);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::swap(small_vector& other)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    if (this == &other) {
+        return;                                                       // RETURN
+    }
+
+    if (!is_inline()
+     && !other.is_inline()
+     && get_allocator() == other.get_allocator()) {
+        native_std::swap(d_dataBegin_p, other.d_dataBegin_p);
+        native_std::swap(d_dataEnd_p,   other.d_dataEnd_p);
+        native_std::swap(d_capacity,    other.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    small_vector temp(MoveUtil::move(*this), get_allocator());
+    *this = MoveUtil::move(other);
+    other = MoveUtil::move(temp);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, N, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                   d_dataBegin_p,
+                                                   d_dataEnd_p,
+                                                   ContainerBase::allocator());
+    d_dataEnd_p = d_dataBegin_p;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::allocator_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::get_allocator() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return ContainerBase::allocator();
+}
+
+                             // *** iterators ***
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::rbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::crbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, N, ALLOCATOR>::crend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+                             // *** capacity ***
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataEnd_p - d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::max_size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return AllocatorTraits::max_size(ContainerBase::allocator());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, N, ALLOCATOR>::capacity() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, N, ALLOCATOR>::empty() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p == d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, N, ALLOCATOR>::is_inline() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p == inlineData();
+}
+
+                          // *** element access ***
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::operator[](size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::at(size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                  "small_vector<...>::at(position) const: invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, N, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, N, ALLOCATOR>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+const VALUE_TYPE *small_vector<VALUE_TYPE, N, ALLOCATOR>::data() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_dataBegin_p;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                     const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                     const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                    const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                    const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                     const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& lhs,
+                     const bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+inline
+void bsl::swap(bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& a,
+               bsl::small_vector<VALUE_TYPE, N, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *sequence* containers:
+//: o A sequence container defines STL iterators.
+//: o A sequence container uses 'bslma' allocators if the (template parameter)
+//:   type 'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+// Note that, unlike 'bsl::vector', a 'small_vector' is not bitwise movable.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+struct HasStlIterators<bsl::small_vector<VALUE_TYPE, N, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class VALUE_TYPE, native_std::size_t N, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::small_vector<VALUE_TYPE, N, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1629 @@
+// bslstl_smallvector.t.cpp                                           -*-C++-*-
+#include <bslstl_smallvector.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bsl::small_vector' is a sequence container whose elements live in an
+// inline buffer until they outgrow it, and in allocated memory thereafter.
+// Its element manipulation is delegated to 'bslalg::ArrayPrimitives' (tested
+// separately), so we concentrate on the transitions between the inline buffer
+// and allocated memory (in both directions), on the number of allocations
+// made, on the relocation of bitwise movable and non-bitwise movable element
+// types, on alias safety, on exception neutrality, and on agreement with
+// 'bsl::vector' for the same sequence of operations.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] small_vector();
+// [ 2] explicit small_vector(const ALLOCATOR&);
+// [ 2] explicit small_vector(size_type, const ALLOCATOR& = ALLOCATOR());
+// [ 2] small_vector(size_type, const VALUE_TYPE&, const ALLOCATOR& = ...);
+// [ 2] small_vector(INPUT_ITER, INPUT_ITER, const ALLOCATOR& = ALLOCATOR());
+// [ 5] small_vector(const small_vector&);
+// [ 5] small_vector(MovableRef<small_vector>);
+// [ 5] small_vector(const small_vector&, const ALLOCATOR&);
+// [ 5] small_vector(MovableRef<small_vector>, const ALLOCATOR&);
+// [ 2] small_vector(initializer_list<VALUE_TYPE>, const ALLOCATOR& = ...);
+// [ 2] ~small_vector();
+//
+// MANIPULATORS
+// [ 5] small_vector& operator=(const small_vector&);
+// [ 5] small_vector& operator=(MovableRef<small_vector>);
+// [ 5] small_vector& operator=(initializer_list<VALUE_TYPE>);
+// [ 5] void assign(initializer_list<VALUE_TYPE>);
+// [ 5] void assign(INPUT_ITER, INPUT_ITER);
+// [ 5] void assign(size_type, const VALUE_TYPE&);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 2] reference operator[](size_type);
+// [ 2] reference at(size_type);
+// [ 2] reference front();
+// [ 2] reference back();
+// [ 2] VALUE_TYPE *data();
+// [ 3] void resize(size_type);
+// [ 3] void resize(size_type, const VALUE_TYPE&);
+// [ 3] void reserve(size_type);
+// [ 3] void shrink_to_fit();
+// [ 3] reference emplace_back(Args&&...);
+// [ 3] void push_back(const VALUE_TYPE&);
+// [ 3] void push_back(MovableRef<VALUE_TYPE>);
+// [ 3] void pop_back();
+// [ 4] iterator emplace(const_iterator, Args&&...);
+// [ 4] iterator insert(const_iterator, const VALUE_TYPE&);
+// [ 4] iterator insert(const_iterator, MovableRef<VALUE_TYPE>);
+// [ 4] iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+// [ 4] iterator insert(const_iterator, INPUT_ITER, INPUT_ITER);
+// [ 4] iterator insert(const_iterator, initializer_list<VALUE_TYPE>);
+// [ 4] iterator erase(const_iterator);
+// [ 4] iterator erase(const_iterator, const_iterator);
+// [ 5] void swap(small_vector&);
+// [ 3] void clear();
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type capacity() const;
+// [ 2] bool empty() const;
+// [ 2] bool is_inline() const;
+// [ 2] const_reference operator[](size_type) const;
+// [ 2] const_reference at(size_type) const;
+// [ 2] const_reference front() const;
+// [ 2] const_reference back() const;
+// [ 2] const VALUE_TYPE *data() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const small_vector&, const small_vector&);
+// [ 5] bool operator!=(const small_vector&, const small_vector&);
+// [ 5] bool operator< (const small_vector&, const small_vector&);
+// [ 5] bool operator> (const small_vector&, const small_vector&);
+// [ 5] bool operator<=(const small_vector&, const small_vector&);
+// [ 5] bool operator>=(const small_vector&, const small_vector&);
+// [ 5] void swap(small_vector&, small_vector&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 2] TYPE TRAITS
+// [-1] PERFORMANCE: 'small_vector' vs. 'vector'
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+
+//=============================================================================
+//             GLOBAL TYPEDEFS, FUNCTIONS AND VARIABLES FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::small_vector<int, 4>         Obj;
+typedef bsl::vector<int>                  Reference;
+typedef bsl::small_vector<bsl::string, 2> StringObj;
+
+                               // =============
+                               // class Tracked
+                               // =============
+
+class Tracked {
+    // This class provides a value-semantic type that is *not* bitwise
+    // movable: each object records its own address, which a bitwise copy
+    // would not update.  The number of live objects is counted.
+
+    // DATA
+    int      d_value;
+    Tracked *d_self_p;
+
+  public:
+    // CLASS DATA
+    static int s_numLive;
+
+    // CREATORS
+    explicit Tracked(int value = 0)
+    : d_value(value)
+    , d_self_p(this)
+    {
+        ++s_numLive;
+    }
+
+    Tracked(const Tracked& original)
+    : d_value(original.d_value)
+    , d_self_p(this)
+    {
+        ASSERT(original.isValid());
+        ++s_numLive;
+    }
+
+    ~Tracked()
+    {
+        ASSERT(isValid());
+        --s_numLive;
+    }
+
+    // MANIPULATORS
+    Tracked& operator=(const Tracked& rhs)
+    {
+        ASSERT(isValid());
+        ASSERT(rhs.isValid());
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    bool isValid() const
+    {
+        return this == d_self_p;
+    }
+
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+int Tracked::s_numLive = 0;
+
+bool operator==(const Tracked& lhs, const Tracked& rhs)
+{
+    return lhs.value() == rhs.value();
+}
+
+                             // =================
+                             // class Relocatable
+                             // =================
+
+class Relocatable {
+    // This class provides a bitwise-movable value-semantic type that counts
+    // the number of times it is copied.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static int s_numCopies;
+
+    // CREATORS
+    explicit Relocatable(int value = 0)
+    : d_value(value)
+    {
+    }
+
+    Relocatable(const Relocatable& original)
+    : d_value(original.d_value)
+    {
+        ++s_numCopies;
+    }
+
+    // MANIPULATORS
+    Relocatable& operator=(const Relocatable& rhs)
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+int Relocatable::s_numCopies = 0;
+
+namespace BloombergLP {
+namespace bslmf {
+
+template <>
+struct IsBitwiseMoveable<Relocatable> : bsl::true_type {
+};
+
+}  // close namespace bslmf
+}  // close enterprise namespace
+
+template <class CONTAINER>
+bool isSame(const CONTAINER& container, const Reference& reference)
+    // Return 'true' if the specified 'container' has the same sequence of
+    // 'int' values as the specified 'reference', and 'false' otherwise.
+{
+    return container.size() == reference.size()
+        && native_std::equal(container.begin(),
+                             container.end(),
+                             reference.begin());
+}
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Decoding Repeated Fields Without Allocating
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we decode messages whose 'tags' field is a list of integers
+// that, in practice, almost never has more than four entries, and that we
+// decode millions of such messages per second.  Holding the tags in a
+// 'small_vector' having an inline capacity of 4 avoids an allocation for
+// almost every message.
+//
+// First, we define a function that decodes the tags from a comma-separated
+// list:
+//..
+    template <class VECTOR>
+    void decodeTags(VECTOR *result, const char *input)
+        // Load into the specified 'result' the comma-separated integers in
+        // the specified 'input'.
+    {
+        result->clear();
+        while (*input) {
+            result->push_back(static_cast<int>(strtol(input, 0, 10)));
+            input = strchr(input, ',');
+            if (!input) {
+                break;
+            }
+            ++input;
+        }
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;
+    (void) veryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we decode a typical message, and observe that no memory is allocated:
+//..
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::small_vector<int, 4> tags(&oa);
+
+        decodeTags(&tags, "7,42,1999");
+        ASSERT(3    == tags.size());
+        ASSERT(42   == tags[1]);
+        ASSERT(true == tags.is_inline());
+        ASSERT(0    == oa.numBlocksTotal());
+//..
+// Next, we decode an unusually long list, which is moved to allocated memory:
+//..
+        decodeTags(&tags, "1,2,3,4,5,6");
+        ASSERT(6     == tags.size());
+        ASSERT(false == tags.is_inline());
+        ASSERT(1     == oa.numBlocksInUse());
+//..
+// Finally, we clear the list and release the memory, returning to the inline
+// buffer:
+//..
+        tags.clear();
+        tags.shrink_to_fit();
+        ASSERT(true == tags.is_inline());
+        ASSERT(0    == oa.numBlocksInUse());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, ASSIGNMENT, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copies have the value of the original, and use the expected
+        //:   allocator, allocating only if the value does not fit inline.
+        //:
+        //: 2 Moving from an object holding allocated memory, with equal
+        //:   allocators, transfers the memory without allocating, and leaves
+        //:   the source empty and inline.
+        //:
+        //: 3 Moving from an object holding its elements inline relocates the
+        //:   elements, without copying bitwise movable ones, and leaves the
+        //:   source empty.
+        //:
+        //: 4 Moving with unequal allocators copies the value into memory from
+        //:   the destination's allocator.
+        //:
+        //: 5 'swap' exchanges values for every combination of inline and
+        //:   allocated storage, and exchanges pointers when both objects hold
+        //:   allocated memory from equal allocators.
+        //:
+        //: 6 Assignment, including self-assignment and assignment from an
+        //:   element of the object itself, produces the expected value.
+        //:
+        //: 7 The comparison operators agree with those of 'bsl::vector'.
+        //
+        // Plan:
+        //: 1 For sources of every size from 0 to 10, copy, move, swap, and
+        //:   assign, checking the value, 'is_inline', and the number of
+        //:   allocations.  (C-1..6)
+        //:
+        //: 2 Compare all pairs of a set of short sequences with each operator
+        //:   and check the results against 'bsl::vector'.  (C-7)
+        //
+        // Testing:
+        //   small_vector(const small_vector&);
+        //   small_vector(MovableRef<small_vector>);
+        //   small_vector(const small_vector&, const ALLOCATOR&);
+        //   small_vector(MovableRef<small_vector>, const ALLOCATOR&);
+        //   small_vector& operator=(const small_vector&);
+        //   small_vector& operator=(MovableRef<small_vector>);
+        //   small_vector& operator=(initializer_list<VALUE_TYPE>);
+        //   void assign(initializer_list<VALUE_TYPE>);
+        //   void assign(INPUT_ITER, INPUT_ITER);
+        //   void assign(size_type, const VALUE_TYPE&);
+        //   void swap(small_vector&);
+        //   bool operator==(const small_vector&, const small_vector&);
+        //   bool operator!=(const small_vector&, const small_vector&);
+        //   bool operator< (const small_vector&, const small_vector&);
+        //   bool operator> (const small_vector&, const small_vector&);
+        //   bool operator<=(const small_vector&, const small_vector&);
+        //   bool operator>=(const small_vector&, const small_vector&);
+        //   void swap(small_vector&, small_vector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, SWAP, ASSIGNMENT, AND COMPARISON"
+                           "\n============================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting copy construction.\n");
+        for (int n = 0; n <= 10; ++n) {
+            Reference values;
+            for (int i = 0; i < n; ++i) {
+                values.push_back(i * 3);
+            }
+            const Obj X(values.begin(), values.end(), &oa);
+
+            const bsls::Types::Int64 B = defaultAllocator.numBlocksTotal();
+            {
+                const Obj Y(X);
+                ASSERTV(n, isSame(Y, values));
+                ASSERTV(n, &defaultAllocator == Y.get_allocator().mechanism());
+                ASSERTV(n, (n <= 4) == Y.is_inline());
+                ASSERTV(n, (n > 4) == defaultAllocator.numBlocksTotal() - B);
+            }
+            {
+                const bsls::Types::Int64 ZB = za.numBlocksTotal();
+                const Obj Y(X, &za);
+                ASSERTV(n, isSame(Y, values));
+                ASSERTV(n, &za == Y.get_allocator().mechanism());
+                ASSERTV(n, (n > 4) == za.numBlocksTotal() - ZB);
+            }
+        }
+
+        if (verbose) printf("\tTesting move construction.\n");
+        for (int n = 0; n <= 10; ++n) {
+            Reference values;
+            for (int i = 0; i < n; ++i) {
+                values.push_back(i * 3);
+            }
+
+            {
+                Obj mX(values.begin(), values.end(), &oa);
+                const Obj& X = mX;
+                const int *DATA = X.data();
+
+                const bsls::Types::Int64 B = oa.numBlocksTotal();
+                const Obj Y(bslmf::MovableRefUtil::move(mX));
+                ASSERTV(n, isSame(Y, values));
+                ASSERTV(n, &oa == Y.get_allocator().mechanism());
+                ASSERTV(n, B == oa.numBlocksTotal());
+                ASSERTV(n, (n > 4) == (DATA == Y.data()));
+                ASSERTV(n, X.empty());
+                ASSERTV(n, X.is_inline());
+                ASSERTV(n, 4 == X.capacity());
+            }
+            {
+                Obj mX(values.begin(), values.end(), &oa);
+                const Obj& X = mX;
+
+                const bsls::Types::Int64 B = oa.numBlocksTotal();
+                const Obj Y(bslmf::MovableRefUtil::move(mX), &oa);
+                ASSERTV(n, isSame(Y, values));
+                ASSERTV(n, B == oa.numBlocksTotal());
+                ASSERTV(n, X.empty());
+            }
+            {
+                Obj mX(values.begin(), values.end(), &oa);
+
+                const bsls::Types::Int64 ZB = za.numBlocksTotal();
+                const Obj Y(bslmf::MovableRefUtil::move(mX), &za);
+                ASSERTV(n, isSame(Y, values));
+                ASSERTV(n, &za == Y.get_allocator().mechanism());
+                ASSERTV(n, (n > 4) == za.numBlocksTotal() - ZB);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tTesting relocation of element types.\n");
+        {
+            typedef bsl::small_vector<Relocatable, 4> RelocatableObj;
+            typedef bsl::small_vector<Tracked, 4>     TrackedObj;
+
+            RelocatableObj mX(&oa);
+            for (int i = 0; i < 3; ++i) {
+                mX.push_back(Relocatable(i));
+            }
+            Relocatable::s_numCopies = 0;
+            RelocatableObj mY(bslmf::MovableRefUtil::move(mX));
+            ASSERTV(Relocatable::s_numCopies, 0 == Relocatable::s_numCopies);
+            ASSERT(3 == mY.size());
+            ASSERT(2 == mY[2].value());
+
+            {
+                TrackedObj mZ(&oa);
+                for (int i = 0; i < 3; ++i) {
+                    mZ.push_back(Tracked(i));
+                }
+                TrackedObj mW(bslmf::MovableRefUtil::move(mZ));
+                ASSERT(3 == mW.size());
+                for (int i = 0; i < 3; ++i) {
+                    ASSERTV(i, mW[i].isValid());
+                    ASSERTV(i, i == mW[i].value());
+                }
+                ASSERT(3 == Tracked::s_numLive);
+                mZ = bslmf::MovableRefUtil::move(mW);
+                ASSERT(3 == mZ.size());
+                ASSERT(mZ[1].isValid());
+            }
+            ASSERT(0 == Tracked::s_numLive);
+        }
+
+        if (verbose) printf("\tTesting swap.\n");
+        for (int n = 0; n <= 8; ++n) {
+            for (int m = 0; m <= 8; ++m) {
+                Reference u, v;
+                for (int i = 0; i < n; ++i) {
+                    u.push_back(i);
+                }
+                for (int i = 0; i < m; ++i) {
+                    v.push_back(100 + i);
+                }
+
+                Obj mX(u.begin(), u.end(), &oa);  const Obj& X = mX;
+                Obj mY(v.begin(), v.end(), &oa);  const Obj& Y = mY;
+
+                const int *XDATA = X.data();
+                const int *YDATA = Y.data();
+
+                const bsls::Types::Int64 B = oa.numBlocksTotal();
+                mX.swap(mY);
+                ASSERTV(n, m, isSame(X, v));
+                ASSERTV(n, m, isSame(Y, u));
+                if (n > 4 && m > 4) {
+                    ASSERTV(n, m, B == oa.numBlocksTotal());
+                    ASSERTV(n, m, YDATA == X.data());
+                    ASSERTV(n, m, XDATA == Y.data());
+                }
+
+                swap(mX, mY);
+                ASSERTV(n, m, isSame(X, u));
+                ASSERTV(n, m, isSame(Y, v));
+
+                Obj mZ(v.begin(), v.end(), &za);  const Obj& Z = mZ;
+                mX.swap(mZ);
+                ASSERTV(n, m, isSame(X, v));
+                ASSERTV(n, m, isSame(Z, u));
+                ASSERTV(n, m, &oa == X.get_allocator().mechanism());
+                ASSERTV(n, m, &za == Z.get_allocator().mechanism());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (verbose) printf("\tTesting assignment.\n");
+        for (int n = 0; n <= 8; ++n) {
+            for (int m = 0; m <= 8; ++m) {
+                Reference u, v;
+                for (int i = 0; i < n; ++i) {
+                    u.push_back(i);
+                }
+                for (int i = 0; i < m; ++i) {
+                    v.push_back(100 + i);
+                }
+
+                {
+                    Obj mX(u.begin(), u.end(), &oa);  const Obj& X = mX;
+                    const Obj Y(v.begin(), v.end(), &za);
+
+                    ASSERTV(n, m, &X == &(mX = Y));
+                    ASSERTV(n, m, isSame(X, v));
+                    ASSERTV(n, m, &oa == X.get_allocator().mechanism());
+
+                    mX = X;
+                    ASSERTV(n, m, isSame(X, v));
+                }
+                {
+                    Obj mX(u.begin(), u.end(), &oa);  const Obj& X = mX;
+                    Obj mY(v.begin(), v.end(), &oa);
+
+                    Obj& RESULT = (mX = bslmf::MovableRefUtil::move(mY));
+                    ASSERTV(n, m, &X == &RESULT);
+                    ASSERTV(n, m, isSame(X, v));
+
+                    mX = bslmf::MovableRefUtil::move(mX);
+                    ASSERTV(n, m, isSame(X, v));
+                }
+                {
+                    Obj mX(u.begin(), u.end(), &oa);  const Obj& X = mX;
+                    Obj mY(v.begin(), v.end(), &za);
+
+                    mX = bslmf::MovableRefUtil::move(mY);
+                    ASSERTV(n, m, isSame(X, v));
+                    ASSERTV(n, m, &oa == X.get_allocator().mechanism());
+                }
+                {
+                    Obj mX(u.begin(), u.end(), &oa);  const Obj& X = mX;
+
+                    mX.assign(v.begin(), v.end());
+                    ASSERTV(n, m, isSame(X, v));
+
+                    // Assign copies of an element of the object itself.
+
+                    if (m) {
+                        mX.assign(7, X[m - 1]);
+                        ASSERTV(n, m, isSame(X, Reference(7, 100 + m - 1)));
+                    }
+                    mX.assign(3, 9);
+                    ASSERTV(n, m, isSame(X, Reference(3, 9)));
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX = { 1, 2, 3, 4, 5 };
+            ASSERT(5 == X.size());
+            ASSERT(5 == X.back());
+
+            mX.assign({ 6 });
+            ASSERT(1 == X.size());
+            ASSERT(6 == X.front());
+        }
+#endif
+
+        if (verbose) printf("\tTesting comparison.\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_spec;
+            } DATA[] = {
+                { L_, ""       },
+                { L_, "a"      },
+                { L_, "aa"     },
+                { L_, "ab"     },
+                { L_, "abcde"  },
+                { L_, "abcdf"  },
+                { L_, "b"      },
+                { L_, "bbbbbb" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const char *SPEC1 = DATA[ti].d_spec;
+                const Reference RX(SPEC1, SPEC1 + strlen(SPEC1));
+                const Obj       X(RX.begin(), RX.end(), &oa);
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const char *SPEC2 = DATA[tj].d_spec;
+                    const Reference RY(SPEC2, SPEC2 + strlen(SPEC2));
+                    const Obj       Y(RY.begin(), RY.end(), &oa);
+
+                    ASSERTV(ti, tj, (RX == RY) == (X == Y));
+                    ASSERTV(ti, tj, (RX != RY) == (X != Y));
+                    ASSERTV(ti, tj, (RX <  RY) == (X <  Y));
+                    ASSERTV(ti, tj, (RX >  RY) == (X >  Y));
+                    ASSERTV(ti, tj, (RX <= RY) == (X <= Y));
+                    ASSERTV(ti, tj, (RX >= RY) == (X >= Y));
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INSERT, EMPLACE, AND ERASE
+        //
+        // Concerns:
+        //: 1 Each form of 'insert', 'emplace', and 'erase' produces the same
+        //:   sequence as the corresponding operation on 'bsl::vector', at
+        //:   every position, whether the elements are inline or not, and
+        //:   whether or not the operation moves them to (larger) allocated
+        //:   memory.
+        //:
+        //: 2 The returned iterator refers to the first inserted element, or to
+        //:   the element following the erased ones.
+        //:
+        //: 3 Inserting copies of an element of the object itself is correct.
+        //:
+        //: 4 'insert(pos, first, last)' with integral arguments inserts
+        //:   'first' copies of 'last', and works with input iterators.
+        //:
+        //: 5 Elements using 'bslma' allocators are given the allocator of the
+        //:   container, and an exception thrown during insertion leaves the
+        //:   container unchanged.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of insertions and erasures to a
+        //:   'small_vector' and a 'bsl::vector', checking the results after
+        //:   each step.  (C-1..3)
+        //:
+        //: 2 Insert from an 'istream_iterator' and with integral arguments.
+        //:   (C-4)
+        //:
+        //: 3 Insert long strings in the presence of injected exceptions.
+        //:   (C-5)
+        //
+        // Testing:
+        //   iterator emplace(const_iterator, Args&&...);
+        //   iterator insert(const_iterator, const VALUE_TYPE&);
+        //   iterator insert(const_iterator, MovableRef<VALUE_TYPE>);
+        //   iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+        //   iterator insert(const_iterator, INPUT_ITER, INPUT_ITER);
+        //   iterator insert(const_iterator, initializer_list<VALUE_TYPE>);
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERT, EMPLACE, AND ERASE"
+                            "\n==========================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting against 'bsl::vector'.\n");
+        for (int run = 0; run < 50; ++run) {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference mR(&sa);  const Reference& R = mR;
+
+            unsigned int seed = 12345 + run;
+            for (int step = 0; step < 40; ++step) {
+                seed = seed * 1103515245 + 12345;
+                const int    OP    = (seed >> 8) % 8;
+                const size_t INDEX = (seed >> 12) % (R.size() + 1);
+                const int    VALUE = static_cast<int>((seed >> 16) % 1000);
+
+                Obj::iterator       it;
+                Reference::iterator rt;
+
+                switch (OP) {
+                  case 0: {
+                    it = mX.insert(X.begin() + INDEX, VALUE);
+                    rt = mR.insert(mR.begin() + INDEX, VALUE);
+                  } break;
+                  case 1: {
+                    int value = VALUE;
+                    it = mX.insert(X.begin() + INDEX,
+                                   bslmf::MovableRefUtil::move(value));
+                    rt = mR.insert(mR.begin() + INDEX, VALUE);
+                  } break;
+                  case 2: {
+                    const size_t COUNT = VALUE % 5;
+                    it = mX.insert(X.begin() + INDEX, COUNT, VALUE);
+                    rt = mR.insert(mR.begin() + INDEX, COUNT, VALUE);
+                  } break;
+                  case 3: {
+                    const int    VALUES[] = { 1, 2, 3, 4, 5, 6 };
+                    const size_t COUNT    = VALUE % 7;
+                    it = mX.insert(X.begin() + INDEX, VALUES, VALUES + COUNT);
+                    rt = mR.insert(mR.begin() + INDEX, VALUES, VALUES + COUNT);
+                  } break;
+                  case 4: {
+                    // Insert a copy of an element of the object itself.
+
+                    if (R.empty()) {
+                        continue;
+                    }
+                    const size_t FROM = VALUE % R.size();
+                    it = mX.insert(X.begin() + INDEX, 3, X[FROM]);
+                    rt = mR.insert(mR.begin() + INDEX, 3, R[FROM]);
+                  } break;
+                  case 5: {
+                    if (INDEX == R.size()) {
+                        continue;
+                    }
+                    it = mX.erase(X.begin() + INDEX);
+                    rt = mR.erase(mR.begin() + INDEX);
+                  } break;
+                  default: {
+                    const size_t LAST = INDEX
+                                      + (VALUE % (R.size() - INDEX + 1));
+                    it = mX.erase(X.begin() + INDEX, X.begin() + LAST);
+                    rt = mR.erase(mR.begin() + INDEX, mR.begin() + LAST);
+                  } break;
+                }
+                ASSERTV(run, step, OP, isSame(X, R));
+                ASSERTV(run, step, OP,
+                        it - X.begin() == rt - mR.begin());
+                ASSERTV(run, step, OP, X.capacity() >= X.size());
+                ASSERTV(run, step, OP, X.is_inline() == (X.capacity() == 4));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        if (verbose) printf("\tTesting 'emplace'.\n");
+        for (int n = 0; n <= 6; ++n) {
+            for (int i = 0; i <= n; ++i) {
+                Obj       mX(&oa);  const Obj& X = mX;
+                Reference mR;
+                for (int j = 0; j < n; ++j) {
+                    mX.push_back(j);
+                    mR.push_back(j);
+                }
+                Obj::iterator it = mX.emplace(X.begin() + i, 77);
+                mR.emplace(mR.begin() + i, 77);
+                ASSERTV(n, i, isSame(X, mR));
+                ASSERTV(n, i, X.begin() + i == it);
+            }
+        }
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.insert(X.end(), { 1, 5 });
+            Obj::iterator it = mX.insert(X.begin() + 1, { 2, 3, 4 });
+            ASSERT(X.begin() + 1 == it);
+            ASSERT(5 == X.size());
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, i + 1 == X[i]);
+            }
+        }
+#endif
+
+        if (verbose) printf("\tTesting input iterators.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.push_back(0);
+            mX.push_back(9);
+
+            native_std::istringstream           in("1 2 3 4 5 6 7 8");
+            native_std::istream_iterator<int>   first(in);
+            native_std::istream_iterator<int>   last;
+
+            Obj::iterator it = mX.insert(X.begin() + 1, first, last);
+            ASSERT(X.begin() + 1 == it);
+            ASSERTV(X.size(), 10 == X.size());
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, X[i], i == X[i]);
+            }
+        }
+
+        if (verbose) printf("\tTesting integral arguments.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.insert(X.begin(), 3, 7);
+            ASSERT(3 == X.size());
+            ASSERT(7 == X[0] && 7 == X[2]);
+
+            const Obj Y(5, 2, &oa);
+            ASSERT(5 == Y.size());
+            ASSERT(2 == Y[4]);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting allocator propagation.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            const bsl::string LONG("a string too long for the short buffer",
+                                   &defaultAllocator);
+            for (int i = 0; i < 5; ++i) {
+                mX.insert(X.begin(), LONG);
+            }
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, LONG == X[i]);
+                ASSERTV(i, &oa == X[i].get_allocator().mechanism());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting exception neutrality.\n");
+        {
+            const bsl::string LONG("a string too long for the short buffer",
+                                   &defaultAllocator);
+
+            for (int n = 0; n <= 4; ++n) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    const bsls::Types::Int64 AL = oa.allocationLimit();
+                    oa.setAllocationLimit(-1);
+
+                    StringObj mX(&oa);  const StringObj& X = mX;
+                    for (int i = 0; i < n; ++i) {
+                        mX.push_back(bsl::string(1, char('a' + i)));
+                    }
+                    oa.setAllocationLimit(AL);
+
+                    try {
+                        mX.insert(X.begin() + n / 2, 2, LONG);
+                    }
+                    catch (...) {
+                        ASSERTV(n, n == static_cast<int>(X.size()));
+                        for (int i = 0; i < n; ++i) {
+                            ASSERTV(n, i, 1 == X[i].size());
+                        }
+                        throw;
+                    }
+                    ASSERTV(n, n + 2 == static_cast<int>(X.size()));
+                    ASSERTV(n, LONG == X[n / 2]);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // GROWTH AT THE BACK AND CAPACITY
+        //
+        // Concerns:
+        //: 1 Appending up to the inline capacity allocates no memory, and
+        //:   appending beyond it allocates once for each doubling of the
+        //:   capacity.
+        //:
+        //: 2 Moving to allocated memory relocates bitwise movable elements
+        //:   without copying them, and relocates other elements correctly.
+        //:
+        //: 3 Appending a copy of an element of the object itself, when the
+        //:   object is full, appends the correct value.
+        //:
+        //: 4 'reserve' allocates only when needed; 'shrink_to_fit' returns
+        //:   short sequences to the inline buffer and releases the memory;
+        //:   'resize' and 'clear' do not release memory.
+        //:
+        //: 5 An exception thrown while moving to allocated memory leaves the
+        //:   object unchanged and leaks no memory.
+        //
+        // Plan:
+        //: 1 Append elements one by one, checking 'is_inline', 'capacity', and
+        //:   the number of allocations after each.  (C-1)
+        //:
+        //: 2 Repeat with 'Relocatable' and 'Tracked' elements, checking the
+        //:   number of copies and the validity of each element.  (C-2)
+        //:
+        //: 3 Append 'X.back()' and 'X.front()' to a full object.  (C-3)
+        //:
+        //: 4 Call each capacity method at sizes around the inline capacity.
+        //:   (C-4)
+        //:
+        //: 5 Append a long string to full objects in the presence of injected
+        //:   exceptions.  (C-5)
+        //
+        // Testing:
+        //   void resize(size_type);
+        //   void resize(size_type, const VALUE_TYPE&);
+        //   void reserve(size_type);
+        //   void shrink_to_fit();
+        //   reference emplace_back(Args&&...);
+        //   void push_back(const VALUE_TYPE&);
+        //   void push_back(MovableRef<VALUE_TYPE>);
+        //   void pop_back();
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nGROWTH AT THE BACK AND CAPACITY"
+                            "\n===============================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting 'push_back' allocations.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            static const struct {
+                int d_size;       // size after appending
+                int d_capacity;   // expected capacity
+                int d_numBlocks;  // expected total allocations
+            } DATA[] = {
+                {  1,  4, 0 },
+                {  4,  4, 0 },
+                {  5,  8, 1 },
+                {  8,  8, 1 },
+                {  9, 16, 2 },
+                { 16, 16, 2 },
+                { 17, 32, 3 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            int size = 0;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                while (size < DATA[ti].d_size) {
+                    if (size & 1) {
+                        mX.push_back(size);
+                    }
+                    else {
+                        int value = size;
+                        mX.push_back(bslmf::MovableRefUtil::move(value));
+                    }
+                    ++size;
+                }
+                ASSERTV(ti, X.capacity(), DATA[ti].d_capacity == X.capacity());
+                ASSERTV(ti, DATA[ti].d_numBlocks == oa.numBlocksTotal());
+                ASSERTV(ti, 1 >= oa.numBlocksInUse());
+                ASSERTV(ti, (size <= 4) == X.is_inline());
+                for (int i = 0; i < size; ++i) {
+                    ASSERTV(ti, i, i == X[i]);
+                }
+            }
+
+            while (!X.empty()) {
+                const int BACK = X.back();
+                mX.pop_back();
+                ASSERTV(BACK, static_cast<int>(X.size()) == BACK);
+            }
+            ASSERT(32 == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        if (verbose) printf("\tTesting 'emplace_back'.\n");
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            for (int i = 0; i < 5; ++i) {
+                bsl::string& s = mX.emplace_back(3 + i, char('a' + i));
+                ASSERTV(i, &X.back() == &s);
+                ASSERTV(i, bsl::string(3 + i, char('a' + i)) == s);
+                ASSERTV(i, &oa == s.get_allocator().mechanism());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+
+        if (verbose) printf("\tTesting relocation of element types.\n");
+        {
+            bsl::small_vector<Relocatable, 4> mX(&oa);
+
+            for (int i = 0; i < 20; ++i) {
+                mX.push_back(Relocatable(i));
+            }
+            Relocatable::s_numCopies = 0;
+            mX.reserve(100);
+            mX.shrink_to_fit();
+            mX.insert(mX.begin(), Relocatable(-1));
+            ASSERTV(Relocatable::s_numCopies, 1 == Relocatable::s_numCopies);
+            for (int i = 0; i < 21; ++i) {
+                ASSERTV(i, i - 1 == mX[i].value());
+            }
+        }
+        {
+            bsl::small_vector<Tracked, 4> mX(&oa);
+
+            for (int i = 0; i < 20; ++i) {
+                mX.push_back(Tracked(i));
+                ASSERTV(i, i + 1 == Tracked::s_numLive);
+            }
+            for (int i = 0; i < 20; ++i) {
+                ASSERTV(i, mX[i].isValid());
+                ASSERTV(i, i == mX[i].value());
+            }
+            mX.resize(3);
+            ASSERT(3 == Tracked::s_numLive);
+            mX.shrink_to_fit();
+            ASSERT(mX.is_inline());
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, mX[i].isValid());
+                ASSERTV(i, i == mX[i].value());
+            }
+        }
+        ASSERT(0 == Tracked::s_numLive);
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting aliasing.\n");
+        for (int n = 1; n <= 9; ++n) {
+            StringObj mX(&oa);  const StringObj& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.push_back(bsl::string(40, char('a' + i)));
+            }
+            mX.shrink_to_fit();
+            ASSERTV(n, X.size() == X.capacity() || X.is_inline());
+
+            mX.resize(X.capacity());
+            mX.back() = X.front();
+            mX.push_back(X.back());
+            ASSERTV(n, X.front() == X.back());
+
+            mX.resize(X.capacity(), X.front());
+            mX.push_back(X.front());
+            ASSERTV(n, X.front() == X.back());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting capacity methods.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const bsls::Types::Int64 B = oa.numBlocksTotal();
+            mX.reserve(4);
+            ASSERT(X.is_inline());
+            ASSERT(B == oa.numBlocksTotal());
+
+            mX.resize(3);
+            ASSERT(3 == X.size());
+            ASSERT(0 == X[0] && 0 == X[2]);
+            ASSERT(X.is_inline());
+
+            mX.resize(6, 5);
+            ASSERT(6 == X.size());
+            ASSERT(0 == X[2] && 5 == X[3] && 5 == X[5]);
+            ASSERT(!X.is_inline());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.resize(2);
+            ASSERT(2 == X.size());
+            ASSERT(!X.is_inline());
+
+            mX.reserve(100);
+            ASSERT(100 == X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.shrink_to_fit();
+            ASSERT(X.is_inline());
+            ASSERT(4 == X.capacity());
+            ASSERT(2 == X.size());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.resize(7);
+            mX.reserve(50);
+            mX.shrink_to_fit();
+            ASSERT(7 == X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(7 == X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            bool caught = false;
+            try {
+                mX.reserve(X.max_size() + 1);
+            }
+            catch (const native_std::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting exception neutrality.\n");
+        {
+            const bsl::string LONG("a string too long for the short buffer",
+                                   &defaultAllocator);
+
+            for (int n = 0; n <= 4; ++n) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    const bsls::Types::Int64 AL = oa.allocationLimit();
+                    oa.setAllocationLimit(-1);
+
+                    StringObj mX(&oa);  const StringObj& X = mX;
+                    for (int i = 0; i < n; ++i) {
+                        mX.push_back(bsl::string(1, char('a' + i)));
+                    }
+                    oa.setAllocationLimit(AL);
+
+                    try {
+                        mX.push_back(LONG);
+                    }
+                    catch (...) {
+                        ASSERTV(n, n == static_cast<int>(X.size()));
+                        ASSERTV(n, (n <= 2) == X.is_inline());
+                        throw;
+                    }
+                    ASSERTV(n, n + 1 == static_cast<int>(X.size()));
+                    ASSERTV(n, LONG == X.back());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an object having the expected value and
+        //:   allocator, holding its elements inline if they fit, and otherwise
+        //:   allocating exactly once.
+        //:
+        //: 2 The default constructor allocates no memory and has a capacity
+        //:   equal to the inline capacity.
+        //:
+        //: 3 The iterators and element accessors refer to the elements, and
+        //:   'at' throws 'std::out_of_range' for an invalid position.
+        //:
+        //: 4 The type traits are as documented; in particular, 'small_vector'
+        //:   is not bitwise movable.
+        //
+        // Plan:
+        //: 1 For sizes from 0 to 10, create objects with each constructor and
+        //:   check their state and the number of allocations.  (C-1..2)
+        //:
+        //: 2 Check every accessor against the expected values.  (C-3)
+        //:
+        //: 3 Check the traits.  (C-4)
+        //
+        // Testing:
+        //   small_vector();
+        //   explicit small_vector(const ALLOCATOR&);
+        //   explicit small_vector(size_type, const ALLOCATOR& = ALLOCATOR());
+        //   small_vector(size_type, const VALUE_TYPE&, const ALLOCATOR&);
+        //   small_vector(INPUT_ITER, INPUT_ITER, const ALLOCATOR& = ...);
+        //   small_vector(initializer_list<VALUE_TYPE>, const ALLOCATOR&);
+        //   ~small_vector();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   reference operator[](size_type);
+        //   reference at(size_type);
+        //   reference front();
+        //   reference back();
+        //   VALUE_TYPE *data();
+        //   allocator_type get_allocator() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   size_type size() const;
+        //   size_type max_size() const;
+        //   size_type capacity() const;
+        //   bool empty() const;
+        //   bool is_inline() const;
+        //   const_reference operator[](size_type) const;
+        //   const_reference at(size_type) const;
+        //   const_reference front() const;
+        //   const_reference back() const;
+        //   const VALUE_TYPE *data() const;
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting default construction.\n");
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(4 == X.capacity());
+            ASSERT(X.is_inline());
+            ASSERT(X.begin() == X.end());
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+
+            const Obj Y(&oa);
+            ASSERT(Y.empty());
+            ASSERT(&oa == Y.get_allocator().mechanism());
+            ASSERT(0 < Y.max_size());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) printf("\tTesting value constructors.\n");
+        for (int n = 0; n <= 10; ++n) {
+            const bool INLINE = n <= 4;
+            Reference  values(&sa);
+            for (int i = 0; i < n; ++i) {
+                values.push_back(i * i);
+            }
+
+            {
+                const bsls::Types::Int64 B = oa.numBlocksTotal();
+                const Obj X(n, &oa);
+                ASSERTV(n, isSame(X, Reference(n, &sa)));
+                ASSERTV(n, INLINE == X.is_inline());
+                ASSERTV(n, !INLINE == oa.numBlocksTotal() - B);
+                ASSERTV(n, X.capacity(),
+                        (INLINE ? 4 : native_std::max(n, 8)) == X.capacity());
+            }
+            {
+                const bsls::Types::Int64 B = oa.numBlocksTotal();
+                const Obj X(n, 17, &oa);
+                ASSERTV(n, isSame(X, Reference(n, 17, &sa)));
+                ASSERTV(n, INLINE == X.is_inline());
+                ASSERTV(n, !INLINE == oa.numBlocksTotal() - B);
+            }
+            {
+                const bsls::Types::Int64 B = oa.numBlocksTotal();
+                const Obj X(values.begin(), values.end(), &oa);
+                ASSERTV(n, isSame(X, values));
+                ASSERTV(n, INLINE == X.is_inline());
+                ASSERTV(n, !INLINE == oa.numBlocksTotal() - B);
+            }
+            {
+                const bsls::Types::Int64 B = oa.numBlocksTotal();
+                Obj mX(values.begin(), values.end(), &oa);  const Obj& X = mX;
+
+                ASSERTV(n, X.cbegin() == X.data());
+                ASSERTV(n, X.cend()   == X.data() + n);
+                ASSERTV(n, mX.data()  == X.data());
+                ASSERTV(n, mX.begin() == X.begin());
+                ASSERTV(n, mX.end()   == X.end());
+                ASSERTV(n, n == X.rend() - X.rbegin());
+                ASSERTV(n, n == X.crend() - X.crbegin());
+                ASSERTV(n, n == mX.rend() - mX.rbegin());
+                ASSERTV(n, (0 == n) == X.empty());
+
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, i * i == X[i]);
+                    ASSERTV(n, i, i * i == X.at(i));
+                    ASSERTV(n, i, &mX[i] == &X[i]);
+                    ASSERTV(n, i, &mX.at(i) == &X[i]);
+                    ASSERTV(n, i, i * i == X.rbegin()[n - 1 - i]);
+                }
+                if (n) {
+                    ASSERTV(n, 0 == X.front());
+                    ASSERTV(n, (n - 1) * (n - 1) == X.back());
+                    ASSERTV(n, &mX.front() == &X.front());
+                    ASSERTV(n, &mX.back()  == &X.back());
+                }
+
+                bool caught = false;
+                try {
+                    X.at(n);
+                }
+                catch (const native_std::out_of_range&) {
+                    caught = true;
+                }
+                ASSERTV(n, caught);
+
+                caught = false;
+                try {
+                    mX.at(n + 1);
+                }
+                catch (const native_std::out_of_range&) {
+                    caught = true;
+                }
+                ASSERTV(n, caught);
+
+                ASSERTV(n, !INLINE == oa.numBlocksTotal() - B);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            const Obj X({ 1, 2, 3 }, &oa);
+            ASSERT(3 == X.size());
+            ASSERT(X.is_inline());
+            ASSERT(3 == X[2]);
+
+            const Obj Y({ 1, 2, 3, 4, 5, 6 }, &oa);
+            ASSERT(6 == Y.size());
+            ASSERT(!Y.is_inline());
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+
+        if (verbose) printf("\tTesting the allocator of elements.\n");
+        {
+            const bsl::string LONG("a string too long for the short buffer",
+                                   &defaultAllocator);
+            const StringObj X(3, LONG, &oa);
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, LONG == X[i]);
+                ASSERTV(i, &oa == X[i].get_allocator().mechanism());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting type traits.\n");
+        {
+            ASSERT( bslma::UsesBslmaAllocator<Obj>::value);
+            ASSERT( bslalg::HasStlIterators<Obj>::value);
+            ASSERT(!bslmf::IsBitwiseMoveable<Obj>::value);
+            typedef bsl::small_vector<int, 4, native_std::allocator<int> >
+                                                                     StdObj;
+            ASSERT(!bslma::UsesBslmaAllocator<StdObj>::value);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Append, access, copy, and erase elements, across the inline
+        //:   capacity.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(X.is_inline());
+
+        for (int i = 0; i < 4; ++i) {
+            mX.push_back(i);
+        }
+        ASSERT(4 == X.size());
+        ASSERT(X.is_inline());
+        ASSERT(0 == oa.numBlocksTotal());
+
+        mX.push_back(4);
+        ASSERT(5 == X.size());
+        ASSERT(!X.is_inline());
+        ASSERT(1 == oa.numBlocksInUse());
+        for (int i = 0; i < 5; ++i) {
+            ASSERTV(i, i == X[i]);
+        }
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.erase(mY.begin(), mY.begin() + 3);
+        ASSERT(2 == Y.size());
+        ASSERT(3 == Y[0]);
+        ASSERT(X != Y);
+        ASSERT(X <  Y);
+
+        mY.shrink_to_fit();
+        ASSERT(Y.is_inline());
+        ASSERT(1 == oa.numBlocksInUse());
+
+        mX.swap(mY);
+        ASSERT(2 == X.size());
+        ASSERT(5 == Y.size());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'small_vector' vs. 'vector'
+        //
+        // Concerns:
+        //: 1 Building and traversing a short 'small_vector' is faster than
+        //:   doing the same with a 'bsl::vector', and the cost beyond the
+        //:   inline capacity is comparable.
+        //
+        // Plan:
+        //: 1 For sizes from 0 to 32, time creating a container, appending
+        //:   'size' integers, summing them, and destroying the container, for
+        //:   'bsl::vector<int>' and 'bsl::small_vector<int, 8>', and report
+        //:   the best of several runs.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'small_vector' vs. 'vector'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'small_vector' vs. 'vector'"
+                            "\n========================================\n");
+
+        typedef bsl::small_vector<int, 8> SmallObj;
+
+        const int NUM_ITERATIONS = 1 << 20;
+        const int NUM_RUNS       = 5;
+
+        // Use the new-delete allocator, as a message decoder would use the
+        // default allocator.
+
+        bslma::Allocator *oa = &bslma::NewDeleteAllocator::singleton();
+
+        printf("%5s  %12s  %12s\n", "size", "vector (ns)", "small (ns)");
+
+        for (int size = 0; size <= 32; size = size < 8 ? size + 1 : size * 2) {
+            double time[2] = { 1e9, 1e9 };
+            long   sum[2]  = { 0, 0 };
+
+            for (int run = 0; run < NUM_RUNS; ++run) {
+                bsls::Stopwatch timer;
+
+                sum[0] = 0;
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    Reference mR(oa);
+                    for (int j = 0; j < size; ++j) {
+                        mR.push_back(i + j);
+                    }
+                    for (Reference::const_iterator it = mR.begin();
+                                                       it != mR.end(); ++it) {
+                        sum[0] += *it;
+                    }
+                }
+                timer.stop();
+                time[0] = native_std::min(time[0], timer.elapsedTime());
+
+                sum[1] = 0;
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                    SmallObj mX(oa);
+                    for (int j = 0; j < size; ++j) {
+                        mX.push_back(i + j);
+                    }
+                    for (SmallObj::const_iterator it = mX.begin();
+                                                       it != mX.end(); ++it) {
+                        sum[1] += *it;
+                    }
+                }
+                timer.stop();
+                time[1] = native_std::min(time[1], timer.elapsedTime());
+            }
+            ASSERTV(size, sum[0] == sum[1]);
+
+            printf("%5d  %12.1f  %12.1f\n",
+                   size,
+                   time[0] * 1e9 / NUM_ITERATIONS,
+                   time[1] * 1e9 / NUM_ITERATIONS);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //  bsl::basic_string: C++ standard compliant 'basic_string' implementation
 //  bsl::string: 'typedef' for 'bsl::basic_string<char>'
 //  bsl::wstring: 'typedef' for 'bsl::basic_string<wchar_t>'
+//  bsl::inline_capacity_char_traits: traits selecting the short string size
 //
 //@SEE_ALSO: ISO C++ Standard, Section 21 [strings]
 //
@@ -171,6 +172,29 @@ BSLS_IDENT("$Id: $")
 //  +-----------------------------------------+-------------------------------+
 //..
 //
+///Configuring the Short String Capacity
+///-------------------------------------
+// A 'basic_string' stores short strings in a buffer inside the object (the
+// *short* *string* *buffer*) and allocates memory only for longer strings.
+// The short string buffer of 'bsl::string' holds 23 characters on 64-bit
+// platforms (19 on 32-bit platforms).  Applications holding very many strings
+// slightly longer than that (e.g., identifiers or field names of 20 to 40
+// characters) can enlarge the buffer by supplying, as the 'CHAR_TRAITS'
+// parameter, 'bsl::inline_capacity_char_traits<CHAR_TYPE, N>', which behaves
+// exactly as 'bsl::char_traits<CHAR_TYPE>', except that the short string
+// buffer of a 'basic_string' using it holds at least 'N' characters (not
+// counting the null terminator).  For example:
+//..
+//  typedef bsl::inline_capacity_char_traits<char, 39> FieldNameTraits;
+//  typedef bsl::basic_string<char, FieldNameTraits>    FieldName;
+//
+//  FieldName name("bid_price_venue_primary_exchange_code");  // no allocation
+//..
+// Such a string is a distinct type from 'bsl::string' (of larger size), and
+// converts to and from other strings and string views through its 'data' and
+// 'size' accessors, or through iterators.  It can be written to the standard
+// streams, and hashed by 'bsl::hash'.
+//
 ///User-defined literals
 ///---------------------
 // The user-defined literal operators are declared for the 'bsl::string' and
@@ -767,17 +791,67 @@ String_Traits<native_std::char_traits<char> >::find(const char  *s,
 
 #endif
 
+                    // ==================================
+                    // struct inline_capacity_char_traits
+                    // ==================================
+
+template <class CHAR_TYPE,
+          native_std::size_t INLINE_CAPACITY,
+          class BASE_TRAITS = char_traits<CHAR_TYPE> >
+struct inline_capacity_char_traits : BASE_TRAITS {
+    // This 'struct' template provides character traits that behave exactly as
+    // (the template parameter) 'BASE_TRAITS' and, when supplied as the
+    // 'CHAR_TRAITS' parameter of 'basic_string', make the short string buffer
+    // of the string large enough to hold at least (the template parameter)
+    // 'INLINE_CAPACITY' characters, not counting the null terminator.  See
+    // {Configuring the Short String Capacity}.
+};
+
+                    // =================================
+                    // struct String_ShortBufferMinBytes
+                    // =================================
+
+template <class CHAR_TRAITS>
+struct String_ShortBufferMinBytes {
+    // This component-private meta-function provides, as 'value', the minimum
+    // size in bytes of the short string buffer of a 'basic_string' having the
+    // (template parameter) 'CHAR_TRAITS'.
+
+    enum { value = 20 };
+};
+
+template <class CHAR_TYPE,
+          native_std::size_t INLINE_CAPACITY,
+          class BASE_TRAITS>
+struct String_ShortBufferMinBytes<inline_capacity_char_traits<CHAR_TYPE,
+                                                              INLINE_CAPACITY,
+                                                              BASE_TRAITS> > {
+    // This partial specialization of 'String_ShortBufferMinBytes' provides the
+    // size of a short string buffer holding 'INLINE_CAPACITY' characters and
+    // a null terminator, or the default size if that is larger.
+
+    enum {
+        k_DEFAULT  = String_ShortBufferMinBytes<BASE_TRAITS>::value,
+        k_REQUIRED = (INLINE_CAPACITY + 1) * sizeof(CHAR_TYPE),
+        value      = k_REQUIRED > k_DEFAULT ? k_REQUIRED : k_DEFAULT
+    };
+};
+
                         // ================
                         // class String_Imp
                         // ================
 
-template <class CHAR_TYPE, class SIZE_TYPE>
+template <class CHAR_TYPE,
+          class SIZE_TYPE,
+          native_std::size_t MIN_BYTES = String_ShortBufferMinBytes<
+                                   native_std::char_traits<CHAR_TYPE> >::value>
 class String_Imp {
     // This component private 'class' describes the basic data layout for a
     // string class and provides methods to help encapsulate internal string
-    // implementation details.  It is parameterized by 'CHAR_TYPE' and
-    // 'SIZE_TYPE' only, and implements the portion of 'basic_string' that does
-    // not need to know about its (template parameter) types 'CHAR_TRAITS' or
+    // implementation details.  It is parameterized by 'CHAR_TYPE',
+    // 'SIZE_TYPE', and the minimum size in bytes of its short string buffer,
+    // 'MIN_BYTES', and implements the portion of 'basic_string' that does not
+    // need to know about its (template parameter) types 'CHAR_TRAITS' or
     // 'ALLOCATOR'.  It contains the following data fields: pointer to string,
     // short string buffer, length, and capacity.  The purpose of the short
     // string buffer is to implement a "short string optimization" such that
@@ -790,9 +864,10 @@ class String_Imp {
     enum ShortBufferConstraints {
         // This 'enum' contains values necessary to calculate the size of the
         // short string buffer.  The starting value is
-        // 'SHORT_BUFFER_MIN_BYTES', which defines the minimal number of bytes
-        // (or 'char' values) that the short string buffer should be able to
-        // contain.  Then this value is aligned to a word boundary.  Then we
+        // 'SHORT_BUFFER_MIN_BYTES' (the template parameter 'MIN_BYTES'), which
+        // defines the minimal number of bytes (or 'char' values) that the
+        // short string buffer should be able to contain.  Then this value is
+        // aligned to a word boundary.  Then we
         // make sure that it fits at least one 'CHAR_TYPE' character (because
         // the default state of the string object requires that the first
         // character is initialized with a NULL-terminator).  The final output
@@ -800,8 +875,9 @@ class String_Imp {
         // value.  It defines the capacity of the short string buffer and also
         // the capacity of the default-constructed empty string object.
 
-        SHORT_BUFFER_MIN_BYTES  = 20, // minimum required size of the short
-                                      // string buffer in bytes
+        SHORT_BUFFER_MIN_BYTES  = MIN_BYTES,
+                                    // minimum required size of the short
+                                    // string buffer in bytes
 
         SHORT_BUFFER_NEED_BYTES =
                               (SHORT_BUFFER_MIN_BYTES + sizeof(SIZE_TYPE) - 1)
@@ -978,7 +1054,8 @@ class String_ClearProctor {
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 class basic_string
     : private String_Imp<CHAR_TYPE,
-                         typename allocator_traits<ALLOCATOR>::size_type>
+                         typename allocator_traits<ALLOCATOR>::size_type,
+                         String_ShortBufferMinBytes<CHAR_TRAITS>::value>
     , public BloombergLP::bslalg::ContainerBase<ALLOCATOR>
 {
     // This class template provides an STL-compliant 'string' that conforms to
@@ -1054,7 +1131,9 @@ class basic_string
 
   private:
     // PRIVATE TYPES
-    typedef String_Imp<CHAR_TYPE, typename ALLOCATOR::size_type> Imp;
+    typedef String_Imp<CHAR_TYPE,
+                       typename ALLOCATOR::size_type,
+                       String_ShortBufferMinBytes<CHAR_TRAITS>::value> Imp;
 
     typedef BloombergLP::bslalg::ContainerBase<ALLOCATOR>        ContainerBase;
 
@@ -2645,6 +2724,22 @@ operator<<(std::basic_ostream<CHAR_TYPE, CHAR_TRAITS>&          os,
     // 'os.flags() | ios::left' is non-zero and before the string otherwise.
     // This function will do nothing unless 'os.good()' is true on entry.
 
+template <class CHAR_TYPE,
+          native_std::size_t INLINE_CAPACITY,
+          class BASE_TRAITS,
+          class ALLOCATOR>
+std::basic_ostream<CHAR_TYPE, BASE_TRAITS>&
+operator<<(std::basic_ostream<CHAR_TYPE, BASE_TRAITS>&  os,
+           const basic_string<CHAR_TYPE,
+                              inline_capacity_char_traits<CHAR_TYPE,
+                                                          INLINE_CAPACITY,
+                                                          BASE_TRAITS>,
+                              ALLOCATOR>&               str);
+    // Write the string specified by 'str' into the output stream specified by
+    // 'os', and return 'os', as for the above 'operator<<'.  Note that this
+    // overload allows strings having a configured short string capacity to be
+    // written to the standard streams.
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 std::basic_istream<CHAR_TYPE, CHAR_TRAITS>&
 operator>>(std::basic_istream<CHAR_TYPE, CHAR_TRAITS>&     is,
@@ -3005,11 +3100,12 @@ namespace bsl {
                           // ----------------
 
 // CLASS METHODS
-template <class CHAR_TYPE, class SIZE_TYPE>
+template <class CHAR_TYPE, class SIZE_TYPE, native_std::size_t MIN_BYTES>
 SIZE_TYPE
-String_Imp<CHAR_TYPE, SIZE_TYPE>::computeNewCapacity(SIZE_TYPE newLength,
-                                                     SIZE_TYPE oldCapacity,
-                                                     SIZE_TYPE maxSize)
+String_Imp<CHAR_TYPE, SIZE_TYPE, MIN_BYTES>::computeNewCapacity(
+                                                         SIZE_TYPE newLength,
+                                                         SIZE_TYPE oldCapacity,
+                                                         SIZE_TYPE maxSize)
 {
     BSLS_ASSERT_SAFE(newLength >= oldCapacity);
 
@@ -3036,19 +3132,19 @@ String_Imp<CHAR_TYPE, SIZE_TYPE>::computeNewCapacity(SIZE_TYPE newLength,
 }
 
 // CREATORS
-template <class CHAR_TYPE, class SIZE_TYPE>
+template <class CHAR_TYPE, class SIZE_TYPE, native_std::size_t MIN_BYTES>
 BSLS_PLATFORM_AGGRESSIVE_INLINE
-String_Imp<CHAR_TYPE, SIZE_TYPE>::String_Imp()
+String_Imp<CHAR_TYPE, SIZE_TYPE, MIN_BYTES>::String_Imp()
 : d_start_p(0)
 , d_length(0)
 , d_capacity(this->SHORT_BUFFER_CAPACITY)  // See {DRQS 131792157} for 'this'.
 {
 }
 
-template <class CHAR_TYPE, class SIZE_TYPE>
+template <class CHAR_TYPE, class SIZE_TYPE, native_std::size_t MIN_BYTES>
 BSLS_PLATFORM_AGGRESSIVE_INLINE
-String_Imp<CHAR_TYPE, SIZE_TYPE>::String_Imp(SIZE_TYPE length,
-                                             SIZE_TYPE capacity)
+String_Imp<CHAR_TYPE, SIZE_TYPE, MIN_BYTES>::String_Imp(SIZE_TYPE length,
+                                                        SIZE_TYPE capacity)
 : d_start_p(0)
 , d_length(length)
 , d_capacity(capacity <= static_cast<SIZE_TYPE>(this->SHORT_BUFFER_CAPACITY)
@@ -3058,8 +3154,8 @@ String_Imp<CHAR_TYPE, SIZE_TYPE>::String_Imp(SIZE_TYPE length,
 }
 
 // MANIPULATORS
-template <class CHAR_TYPE, class SIZE_TYPE>
-void String_Imp<CHAR_TYPE, SIZE_TYPE>::swap(String_Imp& other)
+template <class CHAR_TYPE, class SIZE_TYPE, native_std::size_t MIN_BYTES>
+void String_Imp<CHAR_TYPE, SIZE_TYPE, MIN_BYTES>::swap(String_Imp& other)
 {
     if (!isShortString() && !other.isShortString()) {
         // If both strings are long, swap the individual fields.
@@ -3077,9 +3173,9 @@ void String_Imp<CHAR_TYPE, SIZE_TYPE>::swap(String_Imp& other)
 }
 
 // PRIVATE MANIPULATORS
-template <class CHAR_TYPE, class SIZE_TYPE>
+template <class CHAR_TYPE, class SIZE_TYPE, native_std::size_t MIN_BYTES>
 inline
-void String_Imp<CHAR_TYPE, SIZE_TYPE>::resetFields()
+void String_Imp<CHAR_TYPE, SIZE_TYPE, MIN_BYTES>::resetFields()
 {
     d_start_p  = 0;
     d_length   = 0;
@@ -3087,9 +3183,9 @@ void String_Imp<CHAR_TYPE, SIZE_TYPE>::resetFields()
                                            // See {DRQS 131792157} for 'this'.
 }
 
-template <class CHAR_TYPE, class SIZE_TYPE>
+template <class CHAR_TYPE, class SIZE_TYPE, native_std::size_t MIN_BYTES>
 inline
-CHAR_TYPE *String_Imp<CHAR_TYPE, SIZE_TYPE>::dataPtr()
+CHAR_TYPE *String_Imp<CHAR_TYPE, SIZE_TYPE, MIN_BYTES>::dataPtr()
 {
     return isShortString()
            ? reinterpret_cast<CHAR_TYPE *>((void *)d_short.buffer())
@@ -3097,17 +3193,17 @@ CHAR_TYPE *String_Imp<CHAR_TYPE, SIZE_TYPE>::dataPtr()
 }
 
 // PRIVATE ACCESSORS
-template <class CHAR_TYPE, class SIZE_TYPE>
+template <class CHAR_TYPE, class SIZE_TYPE, native_std::size_t MIN_BYTES>
 inline
-bool String_Imp<CHAR_TYPE, SIZE_TYPE>::isShortString() const
+bool String_Imp<CHAR_TYPE, SIZE_TYPE, MIN_BYTES>::isShortString() const
 {
     return d_capacity == this->SHORT_BUFFER_CAPACITY;
                                            // See {DRQS 131792157} for 'this'.
 }
 
-template <class CHAR_TYPE, class SIZE_TYPE>
+template <class CHAR_TYPE, class SIZE_TYPE, native_std::size_t MIN_BYTES>
 inline
-const CHAR_TYPE *String_Imp<CHAR_TYPE, SIZE_TYPE>::dataPtr() const
+const CHAR_TYPE *String_Imp<CHAR_TYPE, SIZE_TYPE, MIN_BYTES>::dataPtr() const
 {
     return isShortString()
           ? reinterpret_cast<const CHAR_TYPE *>((const void *)d_short.buffer())
@@ -6470,6 +6566,54 @@ bsl::operator<<(std::basic_ostream<CHAR_TYPE, CHAR_TRAITS>&          os,
     return os;
 }
 
+template <class CHAR_TYPE,
+          native_std::size_t INLINE_CAPACITY,
+          class BASE_TRAITS,
+          class ALLOCATOR>
+std::basic_ostream<CHAR_TYPE, BASE_TRAITS>&
+bsl::operator<<(std::basic_ostream<CHAR_TYPE, BASE_TRAITS>&  os,
+                const basic_string<CHAR_TYPE,
+                                   inline_capacity_char_traits<CHAR_TYPE,
+                                                               INLINE_CAPACITY,
+                                                               BASE_TRAITS>,
+                                   ALLOCATOR>&               str)
+{
+    typedef std::basic_ostream<CHAR_TYPE, BASE_TRAITS> Ostrm;
+    typename Ostrm::sentry sentry(os);
+    bool ok = false;
+
+    if (sentry) {
+        ok = true;
+        std::size_t     n      = str.size();
+        std::size_t     padLen = 0;
+        bool            left   = (os.flags() & Ostrm::left) != 0;
+        std::streamsize w      = os.width(0);
+
+        std::basic_streambuf<CHAR_TYPE, BASE_TRAITS> *buf = os.rdbuf();
+
+        if (w > 0 && std::size_t(w) > n) {
+            padLen = std::size_t(w) - n;
+        }
+
+        if (!left) {
+            ok = bslstl_string_fill(os, buf, padLen);
+        }
+
+        ok = ok && (buf->sputn(str.data(), std::streamsize(n)) ==
+                        std::streamsize(n));
+
+        if (left) {
+            ok = ok && bslstl_string_fill(os, buf, padLen);
+        }
+    }
+
+    if (!ok) {
+        os.setstate(Ostrm::failbit);
+    }
+
+    return os;
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 std::basic_istream<CHAR_TYPE, CHAR_TRAITS>&
 bsl::operator>>(std::basic_istream<CHAR_TYPE, CHAR_TRAITS>&     is,
@@ -332,6 +332,7 @@ using bsls::nameOfType;
 // [27] DRQS 16870796
 // [ 9] basic_string& operator=(const CHAR_TYPE *s); [NEGATIVE ONLY]
 // [36] CONCERN: Methods qualified 'noexcept' in standard are so implemented.
+// [37] CONCERN: 'inline_capacity_char_traits' sets short string capacity
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int TestDriver:ggg(Obj *object, const char *spec, int vF = 1);
@@ -5754,6 +5755,165 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 37: {
+        // --------------------------------------------------------------------
+        // TESTING 'inline_capacity_char_traits'
+        //
+        // Concerns:
+        //: 1 A string whose traits are 'inline_capacity_char_traits<C, N>'
+        //:   has a short string capacity of at least 'N' characters, and
+        //:   never less than that of a string with the default traits.
+        //:
+        //: 2 Such a string does not allocate until its length exceeds its
+        //:   short string capacity, and allocates exactly once when it does.
+        //:
+        //: 3 Copy, move, swap, and assignment behave as for the default
+        //:   string, including when one operand is short and the other long.
+        //:
+        //: 4 The default short string capacity of 'bsl::string' and
+        //:   'bsl::wstring' is unchanged.
+        //:
+        //: 5 Such a string can be streamed (honoring the field width) and
+        //:   hashed, and its hash agrees with that of an equal 'bsl::string'.
+        //
+        // Plan:
+        //: 1 Instantiate strings of 'char' and 'wchar_t' with various inline
+        //:   capacities and verify 'capacity()' of a default-constructed
+        //:   object.  (C-1, 4)
+        //:
+        //: 2 Grow a string one character at a time using a test allocator and
+        //:   verify the number of allocations at each length.  (C-2)
+        //:
+        //: 3 Exercise the copy and move constructors, assignment operators,
+        //:   and 'swap' for all combinations of short and long values.  (C-3)
+        //:
+        //: 4 Stream a string with 'std::setw' and compare with the result for
+        //:   a 'bsl::string'; compare 'bsl::hash' of equal values.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: 'inline_capacity_char_traits' sets short string capacity
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'inline_capacity_char_traits'"
+                            "\n=====================================\n");
+
+        typedef bsl::inline_capacity_char_traits<char,     39> Traits39;
+        typedef bsl::inline_capacity_char_traits<char,      4> Traits4;
+        typedef bsl::inline_capacity_char_traits<wchar_t,  15> WTraits15;
+
+        typedef bsl::basic_string<char,    Traits39>  Str39;
+        typedef bsl::basic_string<char,    Traits4>   Str4;
+        typedef bsl::basic_string<wchar_t, WTraits15> WStr15;
+
+        if (verbose) printf("\tVerify short string capacities.\n");
+        {
+            ASSERTV(k_SHORT_BUFFER_CAPACITY_CHAR == bsl::string().capacity());
+            ASSERTV(k_SHORT_BUFFER_CAPACITY_WCHAR_T ==
+                                                    bsl::wstring().capacity());
+
+            ASSERTV(Str39().capacity(), 39 <= Str39().capacity());
+            ASSERTV(Str39().capacity(), 39 + sizeof(size_t) >
+                                                           Str39().capacity());
+            ASSERTV(Str4().capacity(),
+                    k_SHORT_BUFFER_CAPACITY_CHAR == Str4().capacity());
+            ASSERTV(WStr15().capacity(), 15 <= WStr15().capacity());
+
+            ASSERTV(sizeof(bsl::string) < sizeof(Str39));
+            ASSERTV(sizeof(bsl::string) == sizeof(Str4));
+        }
+
+        if (verbose) printf("\tVerify allocation on growth.\n");
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Str39                mX(&oa);
+            const Str39&         X = mX;
+            const size_t         CAP = X.capacity();
+
+            for (size_t len = 1; len <= CAP + 1; ++len) {
+                mX.push_back(static_cast<char>('a' + len % 26));
+
+                ASSERTV(len, len == X.size());
+                ASSERTV(len, (len <= CAP ? 0 : 1) == oa.numBlocksTotal());
+            }
+            ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tVerify value semantics.\n");
+        {
+            static const char *const VALUES[] = {
+                "",
+                "IBM",
+                "bid_price_venue_primary",                     // 23 characters
+                "bid_price_venue_primary_exchange_code",       // 37 characters
+                "bid_price_venue_primary_exchange_code_long_enough_to_spill"
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const char *const IV = VALUES[i];
+
+                const Str39 XI(IV, &oa);
+
+                const Str39 C(XI, &oa);
+                ASSERTV(i, XI == C);
+                ASSERTV(i, 0 == strcmp(IV, C.c_str()));
+
+                Str39 mM(XI, &oa);
+                const Str39 M(bslmf::MovableRefUtil::move(mM), &oa);
+                ASSERTV(i, XI == M);
+
+                for (int j = 0; j < NUM_VALUES; ++j) {
+                    const char *const JV = VALUES[j];
+
+                    Str39 mA(JV, &oa);  const Str39& A = mA;
+                    mA = XI;
+                    ASSERTV(i, j, XI == A);
+
+                    Str39 mB(JV, &oa);  const Str39& B = mB;
+                    Str39 mC(IV, &oa);  const Str39& C2 = mC;
+                    mB.swap(mC);
+                    ASSERTV(i, j, 0 == strcmp(IV, B.c_str()));
+                    ASSERTV(i, j, 0 == strcmp(JV, C2.c_str()));
+
+                    Str39 mD(JV, &oa);  const Str39& D = mD;
+                    Str39 mE(IV, &oa);
+                    mD = bslmf::MovableRefUtil::move(mE);
+                    ASSERTV(i, j, 0 == strcmp(IV, D.c_str()));
+                }
+            }
+            ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tVerify streaming and hashing.\n");
+        {
+            static const char *const VALUES[] = {
+                "", "IBM", "bid_price_venue_primary_exchange_code"
+            };
+            const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const Str39       X(VALUES[i]);
+                const bsl::string Y(VALUES[i]);
+
+                std::ostringstream xs;
+                std::ostringstream ys;
+                xs << std::setw(42) << std::left << X << '|' << X;
+                ys << std::setw(42) << std::left << Y << '|' << Y;
+                ASSERTV(i, xs.str() == ys.str());
+
+                ASSERTV(i,
+                        bsl::hash<Str39>()(X) == bsl::hash<bsl::string>()(Y));
+            }
+        }
+      } break;
       case 36: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
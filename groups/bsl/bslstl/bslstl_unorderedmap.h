@@ -194,6 +194,8 @@ BSLS_IDENT("$Id: $")
 //  'i1', 'i2'          - two iterators defining a sequence of 'value_type'
 //                        objects
 //  'k'                 - object of type 'K'
+//  'k1', 'k2'          - two iterators defining a sequence of 'K' objects
+//  'out'               - output iterator accepting iterators into 'a'
 //  'vt'                - object of type 'bsl::pair<const K, M>'
 //  'Args&&...'         - variable number of arguments
 //  't&&'               - movable reference to variable 't'
@@ -203,6 +205,7 @@ BSLS_IDENT("$Id: $")
 //  'distance(i1, i2)'  - number of elements in the range '[i1 .. i2)'
 //  'distance(ai1,ai2)' - number of elements in the range '[ai1 .. ai2)'
 //  'distance({*})'     - number of elements in the initializer list
+//  'distance(k1, k2)'  - number of elements in the range '[k1 .. k2)'
 //  'z'                 - floating point value representing a load factor
 //
 //  +----------------------------------------------------+--------------------+
@@ -319,6 +322,11 @@ BSLS_IDENT("$Id: $")
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
+//  | a.find_many(k1, k2, out)                           | Average: O[        |
+//  |                                                    |   distance(k1, k2)]|
+//  |                                                    | Worst:   O[n *     |
+//  |                                                    |   distance(k1, k2)]|
+//  +----------------------------------------------------+--------------------+
 //  | a.count(k)                                         | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -1478,6 +1486,23 @@ class unordered_map {
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_many(KEY_ITERATOR    first,
+                              KEY_ITERATOR    last,
+                              OUTPUT_ITERATOR result);
+        // Look up each key in the range starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and write to the specified 'result' output iterator, in the order of
+        // the keys, the 'iterator' that 'find' would return for that key.
+        // Return the position one past the last element written.
+        // 'KEY_ITERATOR' must meet the requirements of a forward iterator
+        // whose 'value_type' is convertible to 'key_type', and
+        // 'OUTPUT_ITERATOR' must accept 'iterator' values.  The behavior is
+        // undefined unless 'first' and 'last' refer to a valid range.  Note
+        // that the lookups are batched so that the cache misses of looking up
+        // many keys in a large unordered map overlap; prefer this method to
+        // calling 'find' in a loop when the keys are known up front.
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this unordered map if the key (the
         // 'first' element) of the object referred to by 'value' does not
@@ -1760,6 +1785,22 @@ class unordered_map {
         // the specified 'key', if such an entry exists, and the past-the-end
         // iterator ('end') otherwise.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_many(KEY_ITERATOR    first,
+                              KEY_ITERATOR    last,
+                              OUTPUT_ITERATOR result) const;
+        // Look up each key in the range starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and write to the specified 'result' output iterator, in the order of
+        // the keys, the 'const_iterator' that 'find' would return for that
+        // key.  Return the position one past the last element written.
+        // 'KEY_ITERATOR' must meet the requirements of a forward iterator
+        // whose 'value_type' is convertible to 'key_type', and
+        // 'OUTPUT_ITERATOR' must accept 'const_iterator' values.  The behavior
+        // is undefined unless 'first' and 'last' refer to a valid range.  Note
+        // that the lookups are batched so that the cache misses of looking up
+        // many keys in a large unordered map overlap.
+
     allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -2467,6 +2508,18 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find_many(
+                                                        KEY_ITERATOR    first,
+                                                        KEY_ITERATOR    last,
+                                                        OUTPUT_ITERATOR result)
+{
+    return d_impl.template findMany<iterator>(first, last, result);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -2764,6 +2817,18 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find_many(
+                                                  KEY_ITERATOR    first,
+                                                  KEY_ITERATOR    last,
+                                                  OUTPUT_ITERATOR result) const
+{
+    return d_impl.template findMany<const_iterator>(first, last, result);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
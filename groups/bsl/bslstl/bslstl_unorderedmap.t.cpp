@@ -32,6 +32,7 @@
 #include <bsls_nameof.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 #include <bsls_util.h>
 
@@ -179,6 +180,8 @@ using bsl::pair;
 // [13] pair<const_iter, const_iter> equal_range(const KEY&) const;
 // [ 4] iterator find(const KEY& key);
 // [ 4] const_iterator find(const KEY& key) const;
+// [40] OUTPUT_ITERATOR find_many(KEY_ITER, KEY_ITER, OUTPUT_ITERATOR);
+// [40] OUTPUT_ITERATOR find_many(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
 //
 // non-local iterators:
 // [14] iterator begin();
@@ -225,7 +228,8 @@ using bsl::pair;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [40] USAGE EXAMPLE
+// [41] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'find' VS. 'find_many'
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int  ggg(Obj *, const char *, bool verbose = true);
@@ -10420,7 +10424,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 40: {
+      case 41: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -10440,6 +10444,7 @@ int main(int argc, char *argv[])
                             "\n=============\n");
         usage();
       } break;
+      case 40: // falls through
       case 39: // falls through
       case 38: // falls through
       case 37: // falls through
@@ -11029,6 +11034,96 @@ int main(int argc, char *argv[])
         if (veryVerbose)
             printf("Final message to confim the end of the breathing test.\n");
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'find' VS. 'find_many'
+        //
+        // Concerns:
+        //: 1 Looking up a batch of keys in a map much larger than the cache
+        //:   with 'find_many' is faster than calling 'find' in a loop.
+        //
+        // Plan:
+        //: 1 Populate maps of increasing size with pseudo-random 'int' keys,
+        //:   and time looking up a fixed number of pseudo-random keys (about
+        //:   half of which are present) with 'find' in a loop and with
+        //:   'find_many'.  Verify both produce the same results, and report
+        //:   the average time per lookup.
+        //
+        // Testing:
+        //   PERFORMANCE: 'find' VS. 'find_many'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: 'find' VS. 'find_many'"
+               "\n===================================\n");
+
+        typedef bsl::unordered_map<int, int> Map;
+
+        const int NUM_LOOKUPS = 1 << 20;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bsl::vector<int>                 keys(NUM_LOOKUPS);
+        bsl::vector<Map::const_iterator> found(NUM_LOOKUPS);
+
+        for (int size = 1 << 10; size <= 1 << 22; size <<= 4) {
+            Map              mX;  const Map& X = mX;
+            bsl::vector<int> inserted(size);
+
+            mX.reserve(size);
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < size; ++i) {
+                seed = seed * 1103515245 + 12345;
+                inserted[i] = static_cast<int>(seed >> 1);
+                mX[inserted[i]] = i;
+            }
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                seed = seed * 1103515245 + 12345;
+                keys[i] = i & 1 ? inserted[(seed >> 1) % size]
+                                : static_cast<int>(seed >> 1);
+            }
+
+            // Report the best of several runs, to reduce noise.
+
+            const int NUM_RUNS = 5;
+
+            double findTime     = 1e9;
+            double findManyTime = 1e9;
+            size_t numFound     = 0;
+
+            for (int run = 0; run < NUM_RUNS; ++run) {
+                bsls::Stopwatch timer;
+
+                numFound = 0;
+                timer.start();
+                for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                    numFound += X.end() != X.find(keys[i]);
+                }
+                timer.stop();
+                findTime = native_std::min(findTime, timer.elapsedTime());
+
+                timer.reset();
+                timer.start();
+                X.find_many(keys.begin(), keys.end(), found.begin());
+                timer.stop();
+                findManyTime = native_std::min(findManyTime,
+                                               timer.elapsedTime());
+            }
+
+            size_t numFoundMany = 0;
+            for (int i = 0; i < NUM_LOOKUPS; ++i) {
+                ASSERTV(i, X.find(keys[i]) == found[i]);
+                numFoundMany += X.end() != found[i];
+            }
+            ASSERTV(numFound, numFoundMany, numFound == numFoundMany);
+
+            printf("size: %8d  find: %6.1f ns  find_many: %6.1f ns\n",
+                   size,
+                   findTime     * 1e9 / NUM_LOOKUPS,
+                   findManyTime * 1e9 / NUM_LOOKUPS);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
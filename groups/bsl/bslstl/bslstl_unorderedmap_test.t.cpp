@@ -181,6 +181,8 @@ using bsl::pair;
 // [13] pair<const_iter, const_iter> equal_range(const KEY&) const;
 // [ 4] iterator find(const KEY& key);
 // [ 4] const_iterator find(const KEY& key) const;
+// [40] OUTPUT_ITERATOR find_many(KEY_ITER, KEY_ITER, OUTPUT_ITERATOR);
+// [40] OUTPUT_ITERATOR find_many(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
 //
 // non-local iterators:
 // [14] iterator begin();
@@ -227,7 +229,7 @@ using bsl::pair;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [40] USAGE EXAMPLE
+// [41] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int  ggg(Obj *, const char *, bool verbose = true);
@@ -1484,6 +1486,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase40();
+        // Test 'find_many'.
+
     static void testCase38();
         // Test absence of 'erase' method ambiguity.
 
@@ -2218,6 +2223,114 @@ void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase31a_RunTest(
 }
 #endif
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase40()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'find_many'
+    //
+    // Concerns:
+    //: 1 'find_many' writes, for each key in the supplied range and in the
+    //:   order of the keys, the iterator that 'find' returns for that key,
+    //:   i.e., an iterator to the element if it exists and 'end' otherwise.
+    //:
+    //: 2 'find_many' returns the output iterator one past the last element
+    //:   written, and writes nothing for an empty range of keys.
+    //:
+    //: 3 Ranges of keys that are shorter than, equal to, and longer than (and
+    //:   not a multiple of) the internal batch size are handled correctly.
+    //:
+    //: 4 Keys may be repeated within the range.
+    //:
+    //: 5 Both the 'const' and non-'const' versions return the same value.
+    //:
+    //: 6 No memory is allocated.
+    //
+    // Plan:
+    //: 1 For a series of container lengths, create an object holding every
+    //:   other value of a set of distinct test values, and a 'vector' of keys
+    //:   consisting of every test value followed by the same values again.
+    //:
+    //: 2 For every prefix of the 'vector' of keys, call both versions of
+    //:   'find_many' writing to a 'vector' of iterators, and verify the
+    //:   returned iterator and that each written iterator equals the result
+    //:   of 'find' on the corresponding key.  (C-1..5)
+    //:
+    //: 3 Verify no memory is allocated from the object or default allocators.
+    //:   (C-6)
+    //
+    // Testing:
+    //   OUTPUT_ITERATOR find_many(KEY_ITER, KEY_ITER, OUTPUT_ITERATOR);
+    //   OUTPUT_ITERATOR find_many(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("TESTING 'find_many': %s\n"
+                        "-------------------\n", NameOf<KEY>().name());
+
+    const TestValues VALUES;  // contains 52 distinct increasing values
+
+    const size_t NUM_VALUES = VALUES.size();
+    const size_t MAX_LENGTH = NUM_VALUES / 2;
+
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bsl::vector<NoConstKey> keys(&sa);
+    for (int pass = 0; pass < 2; ++pass) {
+        for (size_t i = 0; i < NUM_VALUES; ++i) {
+            keys.push_back(VALUES[i].first);
+        }
+    }
+
+    for (size_t ti = 0; ti <= MAX_LENGTH; ti += (ti < 4 ? 1 : 5)) {
+        const size_t LENGTH = ti;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (size_t i = 0; i < LENGTH; ++i) {
+            primaryManipulator(&mX, u::idOf(VALUES[2 * i]));
+        }
+        ASSERTV(ti, LENGTH == X.size());
+
+        bsl::vector<Iter>  iters(keys.size(), Iter(), &sa);
+        bsl::vector<CIter> citers(keys.size(), CIter(), &sa);
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&da);
+
+        for (size_t tj = 0; tj <= keys.size(); ++tj) {
+            const size_t NUM_KEYS = tj;
+
+            typename bsl::vector<Iter>::iterator  mEnd =
+                mX.find_many(keys.begin(), keys.begin() + NUM_KEYS,
+                             iters.begin());
+            typename bsl::vector<CIter>::iterator cEnd =
+                 X.find_many(keys.begin(), keys.begin() + NUM_KEYS,
+                             citers.begin());
+
+            ASSERTV(ti, tj, iters.begin()  + NUM_KEYS == mEnd);
+            ASSERTV(ti, tj, citers.begin() + NUM_KEYS == cEnd);
+
+            for (size_t k = 0; k < NUM_KEYS; ++k) {
+                const size_t idx    = k % NUM_VALUES;
+                const bool   EXP_IN = 0 == idx % 2 && idx / 2 < LENGTH;
+
+                ASSERTV(ti, tj, k, mX.find(keys[k]) == iters[k]);
+                ASSERTV(ti, tj, k,  X.find(keys[k]) == citers[k]);
+                ASSERTV(ti, tj, k, EXP_IN == (X.end() != citers[k]));
+                ASSERTV(ti, tj, k, CIter(iters[k]) == citers[k]);
+            }
+        }
+
+        ASSERTV(ti, oam.isTotalSame());
+        ASSERTV(ti, dam.isTotalSame());
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
 void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase38()
 {
@@ -8062,6 +8175,23 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
+      case 40: {
+        // --------------------------------------------------------------------
+        // TESTING 'find_many'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'find_many'"
+                            "\n===================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase40,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR,
+                      bsltf::NonOptionalAllocTestType,
+                      bsltf::MovableTestType,
+                      bsltf::MovableAllocTestType);
+
+        TestDriver<TestKeyType, TestValueType>::testCase40();
+      } break;
       case 39: {
         // --------------------------------------------------------------------
         // SIMPLE MSVC COMPILATION FAILURE
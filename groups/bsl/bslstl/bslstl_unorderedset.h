@@ -177,11 +177,14 @@ BSLS_IDENT("$Id: $")
 //  'al             - an STL-style memory allocator
 //  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
 //  'k'             - an object of type 'K'
+//  'k1', 'k2'      - two iterators defining a sequence of 'K' objects
+//  'out'           - an output iterator accepting iterators into 'a'
 //  'rk'            - modifiable rvalue of type 'K'
 //  'v'             - an object of type 'value_type'
 //  'p1', 'p2'      - two iterators belonging to 'a'
 //  distance(i1,i2) - the number of elements in the range [i1, i2)
 //  distance(p1,p2) - the number of elements in the range [p1, p2)
+//  distance(k1,k2) - the number of elements in the range [k1, k2)
 //
 //  +----------------------------------------------------+--------------------+
 //  | Operation                                          | Complexity         |
@@ -274,6 +277,11 @@ BSLS_IDENT("$Id: $")
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
+//  | a.find_many(k1, k2, out)                           | Average: O[        |
+//  |                                                    |    distance(k1,k2)]|
+//  |                                                    | Worst:   O[n *     |
+//  |                                                    |    distance(k1,k2)]|
+//  +----------------------------------------------------+--------------------+
 //  | a.count(k)                                         | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -1392,6 +1400,23 @@ class unordered_set {
         // such an entry exists, and the past-the-end ('end') iterator
         // otherwise.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_many(KEY_ITERATOR    first,
+                              KEY_ITERATOR    last,
+                              OUTPUT_ITERATOR result);
+        // Look up each key in the range starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and write to the specified 'result' output iterator, in the order of
+        // the keys, the 'iterator' that 'find' would return for that key.
+        // Return the position one past the last element written.
+        // 'KEY_ITERATOR' must meet the requirements of a forward iterator
+        // whose 'value_type' is convertible to 'key_type', and
+        // 'OUTPUT_ITERATOR' must accept 'iterator' values.  The behavior is
+        // undefined unless 'first' and 'last' refer to a valid range.  Note
+        // that the lookups are batched so that the cache misses of looking up
+        // many keys in a large unordered set overlap; prefer this method to
+        // calling 'find' in a loop when the keys are known up front.
+
     pair<iterator, iterator> equal_range(const key_type& key);
         // Return a pair of iterators providing modifiable access to the
         // sequence of 'value_type' objects in this unordered set that are
@@ -1477,6 +1502,22 @@ class unordered_set {
         // 'key', if such an entry exists, and the past-the-end ('end')
         // iterator otherwise.
 
+    template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+    OUTPUT_ITERATOR find_many(KEY_ITERATOR    first,
+                              KEY_ITERATOR    last,
+                              OUTPUT_ITERATOR result) const;
+        // Look up each key in the range starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and write to the specified 'result' output iterator, in the order of
+        // the keys, the 'const_iterator' that 'find' would return for that
+        // key.  Return the position one past the last element written.
+        // 'KEY_ITERATOR' must meet the requirements of a forward iterator
+        // whose 'value_type' is convertible to 'key_type', and
+        // 'OUTPUT_ITERATOR' must accept 'const_iterator' values.  The behavior
+        // is undefined unless 'first' and 'last' refer to a valid range.  Note
+        // that the lookups are batched so that the cache misses of looking up
+        // many keys in a large unordered set overlap.
+
     size_type count(const key_type& key) const;
         // Return the number of 'value_type' objects within this set that are
         // equivalent to the specified 'key'.  Note that since an unordered set
@@ -2650,6 +2691,18 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find_many(
+                                                        KEY_ITERATOR    first,
+                                                        KEY_ITERATOR    last,
+                                                        OUTPUT_ITERATOR result)
+{
+    return d_impl.template findMany<iterator>(first, last, result);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
@@ -2866,6 +2919,18 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class KEY_ITERATOR, class OUTPUT_ITERATOR>
+inline
+OUTPUT_ITERATOR
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find_many(
+                                                  KEY_ITERATOR    first,
+                                                  KEY_ITERATOR    last,
+                                                  OUTPUT_ITERATOR result) const
+{
+    return d_impl.template findMany<const_iterator>(first, last, result);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
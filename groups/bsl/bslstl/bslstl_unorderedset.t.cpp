@@ -168,6 +168,8 @@ using bsls::NameOf;
 //*[13] size_type count(const key_type& key) const;
 //*[13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 //*[13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [34] OUTPUT_ITERATOR find_many(KEY_ITER, KEY_ITER, OUTPUT_ITERATOR);
+// [34] OUTPUT_ITERATOR find_many(KEY_ITER, KEY_ITER, OUTPUT_ITER) const;
 //
 // bucket interface:
 //*[26] size_type bucket_count() const;
@@ -198,7 +200,7 @@ using bsls::NameOf;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [34] USAGE EXAMPLE
+// [35] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 //*[ 3] int ggg(unordered_set<K,H,E,A> *object, const char *spec, int verbose);
@@ -4699,7 +4701,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 34: {
+      case 35: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -4854,6 +4856,7 @@ if (verbose) {
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 34: // falls through
       case 33: // falls through
       case 32: // falls through
       case 31: // falls through